@@ -311,6 +311,9 @@ takes precedence over ccache if a storage backend is configured" ON)
 
   define_option(ARROW_COMPUTE "Build all Arrow Compute kernels" OFF)
 
+  define_option(ARROW_COROUTINES
+                "Enable the C++20 coroutine adapters for Future and AsyncGenerator" OFF)
+
   define_option(ARROW_CSV "Build the Arrow CSV Parser Module" OFF)
 
   define_option(ARROW_CUDA
@@ -546,12 +549,23 @@ takes precedence over ccache if a storage backend is configured" ON)
   define_option(ARROW_WITH_ZLIB "Build with zlib compression" OFF)
   define_option(ARROW_WITH_ZSTD "Build with zstd compression" OFF)
 
+  define_option(ARROW_WITH_UCX
+                "Build the UCX transport for Arrow Flight, for RDMA-capable networks"
+                OFF
+                DEPENDS
+                ARROW_FLIGHT)
+
   define_option(ARROW_WITH_UTF8PROC
                 "Build with support for Unicode properties using the utf8proc library;(only used if ARROW_COMPUTE is ON or ARROW_GANDIVA is ON)"
                 ON)
   define_option(ARROW_WITH_RE2
                 "Build with support for regular expressions using the re2 library;(only used if ARROW_COMPUTE or ARROW_GANDIVA is ON)"
                 ON)
+  define_option(ARROW_WITH_SIMDJSON
+                "Build the JSON parser backend based on the simdjson library"
+                OFF
+                DEPENDS
+                ARROW_JSON)
 
   #----------------------------------------------------------------------
   if(MSVC_TOOLCHAIN)
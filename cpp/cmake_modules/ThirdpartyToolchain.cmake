@@ -64,9 +64,11 @@ set(ARROW_THIRDPARTY_DEPENDENCIES
     re2
     Protobuf
     RapidJSON
+    simdjson
     Snappy
     Substrait
     Thrift
+    ucx
     utf8proc
     xsimd
     ZLIB
@@ -211,12 +213,16 @@ macro(build_dependency DEPENDENCY_NAME)
     build_rapidjson()
   elseif("${DEPENDENCY_NAME}" STREQUAL "re2")
     build_re2()
+  elseif("${DEPENDENCY_NAME}" STREQUAL "simdjson")
+    build_simdjson()
   elseif("${DEPENDENCY_NAME}" STREQUAL "Snappy")
     build_snappy()
   elseif("${DEPENDENCY_NAME}" STREQUAL "Substrait")
     build_substrait()
   elseif("${DEPENDENCY_NAME}" STREQUAL "Thrift")
     build_thrift()
+  elseif("${DEPENDENCY_NAME}" STREQUAL "ucx")
+    build_ucx()
   elseif("${DEPENDENCY_NAME}" STREQUAL "utf8proc")
     build_utf8proc()
   elseif("${DEPENDENCY_NAME}" STREQUAL "xsimd")
@@ -2605,6 +2611,24 @@ if(ARROW_WITH_RAPIDJSON)
                      FALSE)
 endif()
 
+# ----------------------------------------------------------------------
+# simdjson
+
+function(build_simdjson)
+  message(FATAL_ERROR "Building simdjson from source is not supported. "
+                      "Install simdjson and use simdjson_SOURCE=SYSTEM.")
+endfunction()
+
+if(ARROW_WITH_SIMDJSON)
+  resolve_dependency(simdjson
+                     FORCE_ANY_NEWER_VERSION
+                     TRUE
+                     PC_PACKAGE_NAMES
+                     simdjson
+                     REQUIRED_VERSION
+                     "3.0.0")
+endif()
+
 macro(build_xsimd)
   message(STATUS "Building xsimd from source")
   set(XSIMD_PREFIX "${CMAKE_CURRENT_BINARY_DIR}/xsimd_ep/src/xsimd_ep-install")
@@ -3794,6 +3818,25 @@ if(ARROW_WITH_OPENTELEMETRY)
   message(STATUS "Found OpenTelemetry headers: ${OPENTELEMETRY_INCLUDE_DIR}")
 endif()
 
+# ----------------------------------------------------------------------
+# UCX
+
+function(build_ucx)
+  message(FATAL_ERROR "Building UCX from source is not supported. "
+                      "Install UCX (with RDMA support if needed) and use ucx_SOURCE=SYSTEM."
+  )
+endfunction()
+
+if(ARROW_WITH_UCX)
+  resolve_dependency(ucx
+                     ARROW_CMAKE_PACKAGE_NAME
+                     ArrowFlight
+                     ARROW_PC_PACKAGE_NAME
+                     arrow-flight
+                     PC_PACKAGE_NAMES
+                     ucx)
+endif()
+
 # ----------------------------------------------------------------------
 # AWS SDK for C++
 
@@ -32,12 +32,14 @@ using arrow::compute::ExecBatch;
 AccumulationQueue::AccumulationQueue(AccumulationQueue&& that) {
   this->batches_ = std::move(that.batches_);
   this->row_count_ = that.row_count_;
+  this->byte_count_ = that.byte_count_;
   that.Clear();
 }
 
 AccumulationQueue& AccumulationQueue::operator=(AccumulationQueue&& that) {
   this->batches_ = std::move(that.batches_);
   this->row_count_ = that.row_count_;
+  this->byte_count_ = that.byte_count_;
   that.Clear();
   return *this;
 }
@@ -47,16 +49,19 @@ void AccumulationQueue::Concatenate(AccumulationQueue&& that) {
   std::move(that.batches_.begin(), that.batches_.end(),
             std::back_inserter(this->batches_));
   this->row_count_ += that.row_count_;
+  this->byte_count_ += that.byte_count_;
   that.Clear();
 }
 
 void AccumulationQueue::InsertBatch(ExecBatch batch) {
   row_count_ += batch.length;
+  byte_count_ += batch.TotalBufferSize();
   batches_.emplace_back(std::move(batch));
 }
 
 void AccumulationQueue::Clear() {
   row_count_ = 0;
+  byte_count_ = 0;
   batches_.clear();
 }
 
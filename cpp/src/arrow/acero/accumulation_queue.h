@@ -36,7 +36,7 @@ using arrow::compute::ExecBatch;
 ///        be processed.
 class ARROW_ACERO_EXPORT AccumulationQueue {
  public:
-  AccumulationQueue() : row_count_(0) {}
+  AccumulationQueue() : row_count_(0), byte_count_(0) {}
   ~AccumulationQueue() = default;
 
   // We should never be copying ExecBatch around
@@ -50,12 +50,15 @@ class ARROW_ACERO_EXPORT AccumulationQueue {
   void InsertBatch(ExecBatch batch);
   int64_t row_count() { return row_count_; }
   size_t batch_count() { return batches_.size(); }
+  /// The total size of the buffers referenced by the queued batches
+  int64_t byte_count() const { return byte_count_; }
   bool empty() const { return batches_.empty(); }
   void Clear();
   ExecBatch& operator[](size_t i);
 
  private:
   int64_t row_count_;
+  int64_t byte_count_;
   std::vector<ExecBatch> batches_;
 };
 
@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <forward_list>
 #include <mutex>
 #include <sstream>
@@ -26,10 +27,12 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include "arrow/acero/accumulation_queue.h"
 #include "arrow/acero/aggregate_node.h"
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/spilling_util.h"
 #include "arrow/acero/util.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec_internal.h"
@@ -238,7 +241,9 @@ class ScalarAggregateNode : public ExecNode, public TracedNode {
   int total_output_batches_ = 0;
 };
 
-class GroupByNode : public ExecNode, public TracedNode {
+class GroupByNode : public ExecNode,
+                    public TracedNode,
+                    public util::SerialSequencingQueue::Processor {
  public:
   GroupByNode(ExecNode* input, std::shared_ptr<Schema> output_schema,
               std::vector<int> key_field_ids, std::vector<int> segment_key_field_ids,
@@ -246,7 +251,8 @@ class GroupByNode : public ExecNode, public TracedNode {
               std::vector<std::vector<TypeHolder>> agg_src_types,
               std::vector<std::vector<int>> agg_src_fieldsets,
               std::vector<Aggregate> aggs,
-              std::vector<const HashAggregateKernel*> agg_kernels)
+              std::vector<const HashAggregateKernel*> agg_kernels,
+              std::unique_ptr<RowSegmenter> key_segmenter = NULLPTR)
       : ExecNode(input->plan(), {input}, {"groupby"}, std::move(output_schema)),
         TracedNode(this),
         segmenter_(std::move(segmenter)),
@@ -256,7 +262,8 @@ class GroupByNode : public ExecNode, public TracedNode {
         agg_src_types_(std::move(agg_src_types)),
         agg_src_fieldsets_(std::move(agg_src_fieldsets)),
         aggs_(std::move(aggs)),
-        agg_kernels_(std::move(agg_kernels)) {}
+        agg_kernels_(std::move(agg_kernels)),
+        key_segmenter_(std::move(key_segmenter)) {}
 
   Status Init() override;
 
@@ -274,23 +281,25 @@ class GroupByNode : public ExecNode, public TracedNode {
 
   Status Consume(ExecSpan batch);
 
-  Status Merge();
-
-  Result<ExecBatch> Finalize();
-
   Status OutputNthBatch(int64_t n);
 
   Status OutputResult(bool is_last);
 
+  /// \brief Aggregate the spilling queue one partition at a time and output the
+  ///        results
+  Status OutputPartitionedResult();
+
+  /// \brief Merge and output the thread-local states of one key-hash partition
+  Status OutputHashPartition(int64_t partition);
+
+  /// \brief Aggregate the next batch of an input ordered by the grouping keys
+  Status Process(ExecBatch batch) override;
+
   Status InputReceived(ExecNode* input, ExecBatch batch) override;
 
   Status InputFinished(ExecNode* input, int total_batches) override;
 
-  Status StartProducing() override {
-    NoteStartProducing(ToStringExtra(0));
-    local_states_.resize(plan_->query_context()->max_concurrency());
-    return Status::OK();
-  }
+  Status StartProducing() override;
 
   void PauseProducing(ExecNode* output, int32_t counter) override {
     // TODO(ARROW-16260)
@@ -313,13 +322,15 @@ class GroupByNode : public ExecNode, public TracedNode {
     std::vector<std::unique_ptr<KernelState>> agg_states;
   };
 
-  ThreadLocalState* GetLocalState() {
-    size_t thread_index = plan_->query_context()->GetThreadIndex();
-    return &local_states_[thread_index];
-  }
-
   Status InitLocalStateIfNeeded(ThreadLocalState* state);
 
+  Status ConsumeInto(ThreadLocalState* state, const ExecSpan& batch);
+
+  /// \brief Merge states[1:] into states[0]
+  Status Merge(const std::vector<ThreadLocalState*>& states);
+
+  Result<ExecBatch> Finalize(ThreadLocalState* state);
+
   int output_batch_size() const {
     int result =
         static_cast<int>(plan_->query_context()->exec_context()->exec_chunksize());
@@ -330,6 +341,7 @@ class GroupByNode : public ExecNode, public TracedNode {
   }
 
   int output_task_group_id_;
+  int hash_partition_task_group_id_;
   /// \brief A segmenter for the segment-keys
   std::unique_ptr<RowSegmenter> segmenter_;
   /// \brief Holds values of the current batch that were selected for the segment-keys
@@ -348,8 +360,38 @@ class GroupByNode : public ExecNode, public TracedNode {
   /// \brief Total number of output batches produced
   int total_output_batches_ = 0;
 
+  /// \brief Upper bound on the number of key-hash partitions used to finalize the
+  ///        aggregation in parallel
+  static constexpr int kMaxNumHashPartitions = 32;
+  /// \brief Number of key-hash partitions, 1 when the input is not partitioned
+  ///
+  /// With more than one partition each thread keeps one state per partition, and the
+  /// partitions (which have disjoint sets of keys) are merged and finalized by
+  /// independent tasks instead of by a single serial merge.
+  int num_hash_partitions_ = 1;
+  /// \brief Output batches produced by the hash partition tasks
+  std::atomic<int> hash_partition_output_batches_{0};
+
+  /// \brief Thread-local states, indexed by thread_index * num_hash_partitions_ +
+  ///        partition
   std::vector<ThreadLocalState> local_states_;
   ExecBatch out_data_;
+
+  /// \brief Number of partitions used when QueryOptions::spill_memory_limit is set
+  static constexpr int kNumSpillPartitions = 64;
+  /// \brief Where input is spilled to when QueryOptions::spill_memory_limit is set
+  std::unique_ptr<util::SpillStore> spill_store_;
+  /// \brief Input batches, partitioned by grouping keys, when aggregation is deferred
+  ///        so that it can be done one partition at a time
+  std::unique_ptr<util::SpillingAccumulationQueue> spill_queue_;
+
+  /// \brief Segments the input on the grouping keys when the input is ordered by them
+  ///
+  /// Each group is then a contiguous run of rows which is output as soon as the input
+  /// moves past it, so no more than one batch worth of groups is held at a time.
+  std::unique_ptr<RowSegmenter> key_segmenter_;
+  /// \brief Delivers the input to Process in order when key_segmenter_ is set
+  std::unique_ptr<util::SerialSequencingQueue> sequencer_;
 };
 
 }  // namespace aggregate
@@ -27,9 +27,11 @@
 #include "arrow/compute/test_util_internal.h"
 #include "arrow/result.h"
 #include "arrow/table.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/string.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -233,6 +235,100 @@ TEST(GroupByNode, BasicParallel) {
                                       out_batches.batches);
 }
 
+TEST(GroupByNode, Spilling) {
+  constexpr int kNumBatches = 32;
+  constexpr int kBatchSize = 256;
+
+  std::shared_ptr<Schema> in_schema =
+      schema({field("key", int32()), field("value", int64())});
+  BatchesWithSchema input = MakeRandomBatches(in_schema, kNumBatches, kBatchSize);
+
+  std::vector<Aggregate> aggregates = {{"hash_sum", nullptr, "value", "sum"},
+                                       {"hash_count_all", "count"}};
+  Declaration plan = Declaration::Sequence(
+      {{"exec_batch_source", ExecBatchSourceNodeOptions(in_schema, input.batches)},
+       {"aggregate", AggregateNodeOptions(aggregates, /*keys=*/{"key"})}});
+
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> expected,
+                       DeclarationToTable(plan, /*use_threads=*/false));
+
+  for (int64_t spill_memory_limit : {1, 4096, 1 << 30}) {
+    ARROW_SCOPED_TRACE("spill_memory_limit=", spill_memory_limit);
+    for (bool use_threads : {false, true}) {
+      QueryOptions query_options;
+      query_options.use_threads = use_threads;
+      query_options.spill_memory_limit = spill_memory_limit;
+      ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                           DeclarationToTable(plan, query_options));
+      AssertTablesEqualIgnoringOrder(expected, actual);
+    }
+  }
+}
+
+TEST(GroupByNode, HashPartitionedParallel) {
+  // With more than one thread the input is partitioned by key hash and each partition
+  // is merged and finalized separately
+  constexpr int kNumBatches = 32;
+  constexpr int kBatchSize = 256;
+
+  std::shared_ptr<Schema> in_schema =
+      schema({field("key", int16()), field("value", int64())});
+  BatchesWithSchema input = MakeRandomBatches(in_schema, kNumBatches, kBatchSize);
+
+  std::vector<Aggregate> aggregates = {{"hash_sum", nullptr, "value", "sum"},
+                                       {"hash_count", nullptr, "value", "count"},
+                                       {"hash_count_all", "count_all"}};
+  Declaration plan = Declaration::Sequence(
+      {{"exec_batch_source", ExecBatchSourceNodeOptions(in_schema, input.batches)},
+       {"aggregate", AggregateNodeOptions(aggregates, /*keys=*/{"key"})}});
+
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> expected,
+                       DeclarationToTable(plan, /*use_threads=*/false));
+
+  for (int num_threads : {2, 4, 7}) {
+    ARROW_SCOPED_TRACE("num_threads=", num_threads);
+    ASSERT_OK_AND_ASSIGN(auto thread_pool,
+                         arrow::internal::ThreadPool::Make(num_threads));
+    ExecContext exec_context(default_memory_pool(), thread_pool.get());
+    ASSERT_FINISHES_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                                  DeclarationToTableAsync(plan, exec_context));
+    AssertTablesEqualIgnoringOrder(expected, actual);
+  }
+}
+
+TEST(GroupByNode, StreamingOnOrderedInput) {
+  // An input ordered by the keys lets groups be emitted as soon as the key changes
+  std::shared_ptr<Schema> in_schema =
+      schema({field("key", int32()), field("value", int64())});
+  BatchesWithSchema input;
+  input.schema = in_schema;
+  input.batches = {ExecBatchFromJSON({int32(), int64()}, "[[1, 1], [1, 2], [2, 3]]"),
+                   ExecBatchFromJSON({int32(), int64()}, "[[2, 4], [3, 5]]"),
+                   ExecBatchFromJSON({int32(), int64()}, "[[3, 6]]"),
+                   ExecBatchFromJSON({int32(), int64()}, "[[4, 7], [5, 8], [5, 9]]"),
+                   ExecBatchFromJSON({int32(), int64()}, "[[null, 10]]")};
+
+  for (bool use_threads : {false, true}) {
+    ARROW_SCOPED_TRACE("use_threads=", use_threads);
+    Declaration plan = Declaration::Sequence(
+        {{"source", SourceNodeOptions(in_schema, input.gen(use_threads, /*slow=*/false),
+                                      Ordering({compute::SortKey("key")}))},
+         {"aggregate", AggregateNodeOptions({{"hash_sum", nullptr, "value", "sum"},
+                                             {"hash_count_all", "count"}},
+                                            /*keys=*/{"key"})}});
+    ASSERT_OK_AND_ASSIGN(BatchesWithCommonSchema out_batches,
+                         DeclarationToExecBatches(plan, use_threads));
+
+    ExecBatch expected_batch = ExecBatchFromJSON(
+        {int32(), int64(), int64()},
+        "[[1, 3, 2], [2, 7, 2], [3, 11, 2], [4, 7, 1], [5, 17, 2], [null, 10, 1]]");
+    AssertExecBatchesEqualIgnoringOrder(out_batches.schema, {expected_batch},
+                                        out_batches.batches);
+    // Completed groups are output before the end of the input
+    ASSERT_GT(out_batches.batches.size(), 1);
+  }
+}
+
 TEST(ScalarAggregateNode, AnyAll) {
   // GH-43768: boolean_any and boolean_all with constant input should work well
   // when min_count != 0.
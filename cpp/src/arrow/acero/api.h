@@ -29,4 +29,5 @@
 /// @}
 
 #include "arrow/acero/exec_plan.h"
+#include "arrow/acero/expression_compiler.h"
 #include "arrow/acero/options.h"
@@ -43,6 +43,7 @@
 #include "arrow/acero/util.h"
 #include "arrow/array/builder_binary.h"
 #include "arrow/array/builder_primitive.h"
+#include "arrow/compute/api_vector.h"
 #ifndef NDEBUG
 #  include "arrow/compute/function_internal.h"
 #endif
@@ -474,8 +475,55 @@ class BackpressureController : public BackpressureControl {
   std::atomic<int32_t>& backpressure_counter_;
 };
 
-class InputState : public util::SerialSequencingQueue::Processor {
-  // InputState corresponds to an input
+// Backpressure for an input whose rows are split across the partitions of the node.
+// The input is only paused once the queues of all partitions are full: pausing it as
+// soon as one of them is full could deadlock, since that partition may be waiting for
+// another input that is paused because of a different partition.
+class PartitionedBackpressureController {
+ public:
+  PartitionedBackpressureController(ExecNode* node, ExecNode* output,
+                                    std::atomic<int32_t>& backpressure_counter,
+                                    size_t num_partitions)
+      : controller_(node, output, backpressure_counter),
+        num_partitions_(num_partitions) {}
+
+  // Makes the control of the queue of one of the partitions
+  std::unique_ptr<BackpressureControl> MakeControl() {
+    return std::make_unique<PartitionControl>(this);
+  }
+
+ private:
+  class PartitionControl : public BackpressureControl {
+   public:
+    explicit PartitionControl(PartitionedBackpressureController* parent)
+        : parent_(parent) {}
+
+    void Pause() override {
+      std::lock_guard<std::mutex> lock(parent_->mutex_);
+      if (++parent_->num_paused_ == parent_->num_partitions_) {
+        parent_->controller_.Pause();
+      }
+    }
+    void Resume() override {
+      std::lock_guard<std::mutex> lock(parent_->mutex_);
+      if (parent_->num_paused_-- == parent_->num_partitions_) {
+        parent_->controller_.Resume();
+      }
+    }
+
+   private:
+    PartitionedBackpressureController* parent_;
+  };
+
+  std::mutex mutex_;
+  BackpressureController controller_;
+  size_t num_partitions_;
+  size_t num_paused_ = 0;
+};
+
+class InputState {
+  // InputState corresponds to an input, or to the rows of an input that belong to a
+  // partition of the node.
   // Input record batches are queued up in InputState until processed and
   // turned into output record batches.
 
@@ -485,8 +533,7 @@ class InputState : public util::SerialSequencingQueue::Processor {
              const std::shared_ptr<arrow::Schema>& schema,
              const col_index_t time_col_index,
              const std::vector<col_index_t>& key_col_index)
-      : sequencer_(util::SerialSequencingQueue::Make(this)),
-        queue_(std::move(handler)),
+      : queue_(std::move(handler), QueuedBatchBytes),
         schema_(schema),
         time_col_index_(time_col_index),
         key_col_index_(key_col_index),
@@ -506,17 +553,17 @@ class InputState : public util::SerialSequencingQueue::Processor {
 
   static Result<std::unique_ptr<InputState>> Make(
       size_t index, TolType tolerance, bool must_hash, bool may_rehash,
-      KeyHasher* key_hasher, ExecNode* asof_input, AsofJoinNode* asof_node,
-      std::atomic<int32_t>& backpressure_counter,
+      KeyHasher* key_hasher, AsofJoinNode* asof_node,
+      std::unique_ptr<BackpressureControl> backpressure_control,
       const std::shared_ptr<arrow::Schema>& schema, const col_index_t time_col_index,
       const std::vector<col_index_t>& key_col_index) {
     constexpr size_t low_threshold = 4, high_threshold = 8;
-    std::unique_ptr<BackpressureControl> backpressure_control =
-        std::make_unique<BackpressureController>(
-            /*node=*/asof_input, /*output=*/asof_node, backpressure_counter);
+    constexpr uint64_t low_bytes_threshold = 32 << 20, high_bytes_threshold = 64 << 20;
     ARROW_ASSIGN_OR_RAISE(auto handler,
                           BackpressureHandler::Make(low_threshold, high_threshold,
-                                                    std::move(backpressure_control)));
+                                                    std::move(backpressure_control),
+                                                    low_bytes_threshold,
+                                                    high_bytes_threshold));
     return std::make_unique<InputState>(index, tolerance, must_hash, may_rehash,
                                         key_hasher, asof_node, std::move(handler), schema,
                                         time_col_index, key_col_index);
@@ -700,16 +747,7 @@ class InputState : public util::SerialSequencingQueue::Processor {
                DEBUG_MANIP(std::endl));
     return updated;
   }
-  Status InsertBatch(ExecBatch batch) {
-    return sequencer_->InsertBatch(std::move(batch));
-  }
 
-  Status Process(ExecBatch batch) override {
-    auto rb = *batch.ToRecordBatch(schema_);
-    DEBUG_SYNC(node_, "received batch from input ", index_, ":", DEBUG_MANIP(std::endl),
-               rb->ToString(), DEBUG_MANIP(std::endl));
-    return Push(rb);
-  }
   void Rehash() {
     DEBUG_SYNC(node_, "rehashing for input ", index_, ":", DEBUG_MANIP(std::endl));
     MemoStore new_memo(DEBUG_ADD(memo_.no_future_, node_, index_));
@@ -770,8 +808,6 @@ class InputState : public util::SerialSequencingQueue::Processor {
   }
 
  private:
-  // ExecBatch Sequencer
-  std::unique_ptr<util::SerialSequencingQueue> sequencer_;
   // Pending record batches. The latest is the front. Batches cannot be empty.
   BackpressureConcurrentQueue<std::shared_ptr<RecordBatch>> queue_;
   // Schema associated with the input
@@ -811,6 +847,202 @@ class InputState : public util::SerialSequencingQueue::Processor {
   std::vector<std::optional<col_index_t>> src_to_dst_;
 };
 
+// Restores the order of the left input in the output of a partitioned node.
+//
+// Each left row produces exactly one output row, in the partition the row is assigned
+// to and in the order of the rows of that partition.  So the output of left batch i
+// consists of the next partition_rows[p] output rows of each partition p, which are
+// gathered back into the order of the left batch once all of them are available.
+class OutputSequencer {
+ public:
+  OutputSequencer(size_t num_partitions, MemoryPool* pool)
+      : pending_rows_(num_partitions),
+        num_pending_rows_(num_partitions, 0),
+        pool_(pool) {}
+
+  // Registers the next left batch, with the number of its rows assigned to each
+  // partition, and the index of each of its rows within the concatenation of the rows of
+  // all partitions.  Left batches must be added in order, before any row of theirs is
+  // pushed.
+  void AddLeftBatch(std::vector<int64_t> partition_rows,
+                    std::shared_ptr<Array> positions) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    left_batches_.push_back({std::move(partition_rows), std::move(positions)});
+  }
+
+  // Adds output rows of a partition and returns the output batches that became complete
+  Result<std::vector<ExecBatch>> Push(size_t partition,
+                                      std::shared_ptr<RecordBatch> rows) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    num_pending_rows_[partition] += rows->num_rows();
+    pending_rows_[partition].push_back(std::move(rows));
+
+    std::vector<ExecBatch> out;
+    while (!left_batches_.empty() && IsComplete(left_batches_.front())) {
+      const LeftBatch& left_batch = left_batches_.front();
+      RecordBatchVector pieces;
+      int num_partitions_with_rows = 0;
+      for (size_t i = 0; i < pending_rows_.size(); ++i) {
+        int64_t needed = left_batch.partition_rows[i];
+        num_partitions_with_rows += needed > 0;
+        num_pending_rows_[i] -= needed;
+        auto& pending = pending_rows_[i];
+        while (needed > 0) {
+          std::shared_ptr<RecordBatch>& front = pending.front();
+          if (front->num_rows() <= needed) {
+            needed -= front->num_rows();
+            pieces.push_back(std::move(front));
+            pending.pop_front();
+          } else {
+            pieces.push_back(front->Slice(0, needed));
+            front = front->Slice(needed);
+            needed = 0;
+          }
+        }
+      }
+      if (!pieces.empty()) {
+        ARROW_ASSIGN_OR_RAISE(auto batch, ConcatenateRecordBatches(pieces, pool_));
+        // The rows of a single partition are already in order
+        if (num_partitions_with_rows > 1) {
+          ARROW_ASSIGN_OR_RAISE(Datum taken, compute::Take(batch, left_batch.positions));
+          batch = taken.record_batch();
+        }
+        ExecBatch out_b(*batch);
+        out_b.index = num_batches_++;
+        out.push_back(std::move(out_b));
+      }
+      left_batches_.pop_front();
+    }
+    return out;
+  }
+
+  // The number of output batches so far
+  int num_batches() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_batches_;
+  }
+
+ private:
+  struct LeftBatch {
+    std::vector<int64_t> partition_rows;
+    std::shared_ptr<Array> positions;
+  };
+
+  bool IsComplete(const LeftBatch& left_batch) const {
+    for (size_t i = 0; i < num_pending_rows_.size(); ++i) {
+      if (left_batch.partition_rows[i] > num_pending_rows_[i]) return false;
+    }
+    return true;
+  }
+
+  std::mutex mutex_;
+  std::deque<LeftBatch> left_batches_;
+  // Output rows of each partition that are not part of an output batch yet
+  std::vector<std::deque<std::shared_ptr<RecordBatch>>> pending_rows_;
+  std::vector<int64_t> num_pending_rows_;
+  int num_batches_ = 0;
+  MemoryPool* pool_;
+};
+
+// Sequences the batches of an input and, if the node is partitioned, distributes their
+// rows to the partitions by the hash of their by-key
+class InputPartitioner : public util::SerialSequencingQueue::Processor {
+ public:
+  InputPartitioner(size_t index, std::shared_ptr<Schema> schema,
+                   std::vector<InputState*> partitions, KeyHasher* key_hasher,
+                   OutputSequencer* output_sequencer, AsofJoinNode* node,
+                   ExecContext* exec_context)
+      : sequencer_(util::SerialSequencingQueue::Make(this)),
+        index_(index),
+        schema_(std::move(schema)),
+        partitions_(std::move(partitions)),
+        key_hasher_(key_hasher),
+        output_sequencer_(output_sequencer),
+        node_(node),
+        exec_context_(exec_context) {}
+
+  Status InsertBatch(ExecBatch batch) {
+    return sequencer_->InsertBatch(std::move(batch));
+  }
+
+  Status Process(ExecBatch batch) override {
+    ARROW_ASSIGN_OR_RAISE(auto rb, batch.ToRecordBatch(schema_));
+    DEBUG_SYNC(node_, "received batch from input ", index_, ":", DEBUG_MANIP(std::endl),
+               rb->ToString(), DEBUG_MANIP(std::endl));
+    if (partitions_.size() == 1) {
+      return partitions_[0]->Push(rb);
+    }
+
+    // Every partition receives a (possibly empty) slice of every batch, so that they all
+    // know when the input is finished
+    const size_t num_partitions = partitions_.size();
+    // The batch is not kept alive, a later one could be allocated at the same address
+    key_hasher_->Invalidate();
+    const std::vector<HashType>& hashes = key_hasher_->HashesFor(rb.get());
+    std::vector<int64_t> partition_rows(num_partitions, 0);
+    std::vector<uint32_t> row_partitions(rb->num_rows());
+    for (int64_t i = 0; i < rb->num_rows(); ++i) {
+      row_partitions[i] = static_cast<uint32_t>(hashes[i] % num_partitions);
+      ++partition_rows[row_partitions[i]];
+    }
+    std::vector<std::vector<int64_t>> partition_indices(num_partitions);
+    for (size_t p = 0; p < num_partitions; ++p) {
+      partition_indices[p].reserve(partition_rows[p]);
+    }
+    for (int64_t i = 0; i < rb->num_rows(); ++i) {
+      partition_indices[row_partitions[i]].push_back(i);
+    }
+
+    if (output_sequencer_) {
+      std::vector<int64_t> offsets(num_partitions, 0);
+      for (size_t p = 1; p < num_partitions; ++p) {
+        offsets[p] = offsets[p - 1] + partition_rows[p - 1];
+      }
+      Int64Builder positions(exec_context_->memory_pool());
+      RETURN_NOT_OK(positions.Resize(rb->num_rows()));
+      for (int64_t i = 0; i < rb->num_rows(); ++i) {
+        positions.UnsafeAppend(offsets[row_partitions[i]]++);
+      }
+      ARROW_ASSIGN_OR_RAISE(auto positions_array, positions.Finish());
+      output_sequencer_->AddLeftBatch(partition_rows, std::move(positions_array));
+    }
+
+    for (size_t p = 0; p < num_partitions; ++p) {
+      std::shared_ptr<RecordBatch> slice;
+      if (partition_rows[p] == 0) {
+        slice = rb->Slice(0, 0);
+      } else if (partition_rows[p] == rb->num_rows()) {
+        slice = rb;
+      } else {
+        Int64Builder indices(exec_context_->memory_pool());
+        RETURN_NOT_OK(indices.AppendValues(partition_indices[p]));
+        ARROW_ASSIGN_OR_RAISE(auto indices_array, indices.Finish());
+        ARROW_ASSIGN_OR_RAISE(
+            Datum taken,
+            compute::Take(rb, indices_array, compute::TakeOptions::NoBoundsCheck(),
+                          exec_context_));
+        slice = taken.record_batch();
+      }
+      RETURN_NOT_OK(partitions_[p]->Push(slice));
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::unique_ptr<util::SerialSequencingQueue> sequencer_;
+  // Index of the input
+  size_t index_;
+  std::shared_ptr<Schema> schema_;
+  // The state of the input in each partition
+  std::vector<InputState*> partitions_;
+  // Hasher for the by-key, only used if there are several partitions
+  KeyHasher* key_hasher_;
+  // Set for the left input if the output of the partitions must be re-sequenced
+  OutputSequencer* output_sequencer_;
+  AsofJoinNode* node_;
+  ExecContext* exec_context_;
+};
+
 /// Wrapper around UnmaterializedCompositeTable that knows how to emplace
 /// the join row-by-row
 template <size_t MAX_TABLES>
@@ -933,7 +1165,28 @@ class CompositeTableBuilder {
 // values are processed. Thus, AsofJoinNode is currently limited to about 100k by-keys for
 // guaranteeing this probability is below 1 in a billion. The fix is 128-bit hashing.
 // See ARROW-17653
-class AsofJoinNode : public ExecNode {
+class AsofJoinNode : public ExecNode, public TracedNode {
+  // The rows of the inputs whose by-key hash to a partition, joined independently of the
+  // other partitions by a process thread of its own
+  struct Partition {
+    explicit Partition(size_t index) : index(index) {}
+
+    size_t index;
+    // Hasher for the by-key of each input
+    std::vector<std::unique_ptr<KeyHasher>> key_hashers;
+    // InputStates
+    // Each input state corresponds to an input table
+    std::vector<std::unique_ptr<InputState>> state;
+    std::mutex gate;
+#ifdef ARROW_ENABLE_THREADING
+    // Queue for triggering processing of a given input
+    // (a false value is a poison pill)
+    ConcurrentQueue<bool> process;
+    // Worker thread
+    std::thread process_thread;
+#endif
+  };
+
   // A simple wrapper for the result of a single call to UpdateRhs(), identifying:
   // 1) If any RHS has advanced.
   // 2) If all RHS are up to date with LHS.
@@ -945,12 +1198,13 @@ class AsofJoinNode : public ExecNode {
   // and checks if all RHS are up to date with LHS. The reason they have to be performed
   // together is that they both depend on the emptiness of the RHS, which can be changed
   // by Push() executing in another thread.
-  Result<RhsUpdateState> UpdateRhs() {
-    auto& lhs = *state_.at(0);
+  Result<RhsUpdateState> UpdateRhs(const Partition& partition) {
+    const auto& state = partition.state;
+    auto& lhs = *state.at(0);
     auto lhs_latest_time = lhs.GetLatestTime();
     RhsUpdateState update_state{/*any_advanced=*/false, /*all_up_to_date_with_lhs=*/true};
-    for (size_t i = 1; i < state_.size(); ++i) {
-      auto& rhs = *state_[i];
+    for (size_t i = 1; i < state.size(); ++i) {
+      auto& rhs = *state[i];
 
       // Obtain RHS emptiness once for subsequent AdvanceAndMemoize() and CurrentEmpty().
       bool rhs_empty = rhs.Empty();
@@ -976,14 +1230,15 @@ class AsofJoinNode : public ExecNode {
     return update_state;
   }
 
-  Result<std::shared_ptr<RecordBatch>> ProcessInner() {
-    DCHECK(!state_.empty());
-    auto& lhs = *state_.at(0);
+  Result<std::shared_ptr<RecordBatch>> ProcessInner(Partition& partition) {
+    auto& state = partition.state;
+    DCHECK(!state.empty());
+    auto& lhs = *state.at(0);
 
     // Construct new target table if needed
-    CompositeTableBuilder<MAX_JOIN_TABLES> dst(state_, output_schema_,
+    CompositeTableBuilder<MAX_JOIN_TABLES> dst(state, output_schema_,
                                                plan()->query_context()->memory_pool(),
-                                               DEBUG_ADD(state_.size(), this));
+                                               DEBUG_ADD(state.size(), this));
 
     // Generate rows into the dst table until we either run out of data or hit the row
     // limit, or run out of input
@@ -991,7 +1246,7 @@ class AsofJoinNode : public ExecNode {
       // If LHS is finished or empty then there's nothing we can do here
       if (lhs.Finished() || lhs.Empty()) break;
 
-      ARROW_ASSIGN_OR_RAISE(auto rhs_update_state, UpdateRhs());
+      ARROW_ASSIGN_OR_RAISE(auto rhs_update_state, UpdateRhs(partition));
 
       // If we have received enough inputs to produce the next output batch
       // (decided by IsUpToDateWithLhsRow), we will perform the join and
@@ -999,7 +1254,7 @@ class AsofJoinNode : public ExecNode {
       // the LHS and adding joined row to rows_ (done by Emplace). Finally,
       // input batches that are no longer needed are removed to free up memory.
       if (rhs_update_state.all_up_to_date_with_lhs) {
-        dst.Emplace(state_, tolerance_);
+        dst.Emplace(state, tolerance_);
         ARROW_ASSIGN_OR_RAISE(bool advanced, lhs.Advance());
         if (!advanced) break;  // if we can't advance LHS, we're done for this batch
       } else {
@@ -1009,10 +1264,10 @@ class AsofJoinNode : public ExecNode {
 
     // Prune memo entries that have expired (to bound memory consumption)
     if (!lhs.Empty()) {
-      for (size_t i = 1; i < state_.size(); ++i) {
+      for (size_t i = 1; i < state.size(); ++i) {
         OnType ts = tolerance_.Expiry(lhs.GetLatestTime());
         if (ts != TolType::kMinValue) {
-          state_[i]->RemoveMemoEntriesWithLesserTime(ts);
+          state[i]->RemoveMemoEntriesWithLesserTime(ts);
         }
       }
     }
@@ -1026,6 +1281,28 @@ class AsofJoinNode : public ExecNode {
     }
   }
 
+  // Sends rows produced by a partition to the output, or through the output sequencer
+  Status Emit(const Partition& partition, std::shared_ptr<RecordBatch> out_rb) {
+    if (output_sequencer_) {
+      ARROW_ASSIGN_OR_RAISE(auto out_batches,
+                            output_sequencer_->Push(partition.index, std::move(out_rb)));
+      for (auto& out_b : out_batches) {
+        RETURN_NOT_OK(output_->InputReceived(this, std::move(out_b)));
+      }
+      return Status::OK();
+    }
+    ExecBatch out_b(*out_rb);
+    out_b.index = batches_produced_++;
+    DEBUG_SYNC(this, "produce batch ", out_b.index, ":", DEBUG_MANIP(std::endl),
+               out_rb->ToString(), DEBUG_MANIP(std::endl));
+    return output_->InputReceived(this, std::move(out_b));
+  }
+
+  int num_batches_produced() const {
+    return output_sequencer_ ? output_sequencer_->num_batches()
+                             : static_cast<int>(batches_produced_);
+  }
+
 #ifdef ARROW_ENABLE_THREADING
 
   template <typename Callable>
@@ -1036,6 +1313,9 @@ class AsofJoinNode : public ExecNode {
   };
 
   void EndFromProcessThread(Status st = Status::OK()) {
+    // Only the first partition to end the node (on an error, or the last one to finish)
+    // does so
+    if (ended_.exchange(true)) return;
     // We must spawn a new task to transfer off the process thread when
     // marking this finished.  Otherwise there is a chance that doing so could
     // mark the plan finished which may destroy the plan which will destroy this
@@ -1044,42 +1324,41 @@ class AsofJoinNode : public ExecNode {
         plan_->query_context()->executor()->Spawn([this, st = std::move(st)]() mutable {
           Defer cleanup([this, &st]() { process_task_.MarkFinished(st); });
           if (st.ok()) {
-            st = output_->InputFinished(this, batches_produced_);
+            st = output_->InputFinished(this, num_batches_produced());
           }
-          for (size_t i = 0; i < state_.size(); ++i) {
-            const auto& s = state_[i];
-            s->ForceShutdown();
+          for (size_t i = 0; i < inputs_.size(); ++i) {
+            for (const auto& partition : partitions_) {
+              partition->state[i]->ForceShutdown();
+            }
             st &= inputs_[i]->StopProducing();
           }
         }));
   }
 
-  bool CheckEnded() {
-    if (state_.at(0)->Finished()) {
-      EndFromProcessThread();
+  bool CheckEnded(const Partition& partition) {
+    if (partition.state.at(0)->Finished()) {
+      if (++partitions_finished_ == partitions_.size()) {
+        EndFromProcessThread();
+      }
       return false;
     }
     return true;
   }
 
-  bool Process() {
-    std::lock_guard<std::mutex> guard(gate_);
-    if (!CheckEnded()) {
+  bool Process(Partition& partition) {
+    std::lock_guard<std::mutex> guard(partition.gate);
+    if (!CheckEnded(partition)) {
       return false;
     }
 
     // Process batches while we have data
     for (;;) {
-      Result<std::shared_ptr<RecordBatch>> result = ProcessInner();
+      Result<std::shared_ptr<RecordBatch>> result = ProcessInner(partition);
 
       if (result.ok()) {
         auto out_rb = *result;
         if (!out_rb) break;
-        ExecBatch out_b(*out_rb);
-        out_b.index = batches_produced_++;
-        DEBUG_SYNC(this, "produce batch ", out_b.index, ":", DEBUG_MANIP(std::endl),
-                   out_rb->ToString(), DEBUG_MANIP(std::endl));
-        Status st = output_->InputReceived(this, std::move(out_b));
+        Status st = Emit(partition, std::move(out_rb));
         if (!st.ok()) {
           EndFromProcessThread(std::move(st));
         }
@@ -1094,7 +1373,7 @@ class AsofJoinNode : public ExecNode {
     //
     // It may happen here in cases where InputFinished was called before we were finished
     // producing results (so we didn't know the output size at that time)
-    if (!CheckEnded()) {
+    if (!CheckEnded(partition)) {
       return false;
     }
 
@@ -1103,19 +1382,21 @@ class AsofJoinNode : public ExecNode {
     return true;
   }
 
-  void ProcessThread() {
+  void ProcessThread(Partition* partition) {
     for (;;) {
-      if (!process_.WaitAndPop()) {
+      if (!partition->process.WaitAndPop()) {
         EndFromProcessThread();
         return;
       }
-      if (!Process()) {
+      if (!Process(*partition)) {
         return;
       }
     }
   }
 
-  static void ProcessThreadWrapper(AsofJoinNode* node) { node->ProcessThread(); }
+  static void ProcessThreadWrapper(AsofJoinNode* node, Partition* partition) {
+    node->ProcessThread(partition);
+  }
 #endif
 
  public:
@@ -1123,26 +1404,55 @@ class AsofJoinNode : public ExecNode {
                const std::vector<col_index_t>& indices_of_on_key,
                const std::vector<std::vector<col_index_t>>& indices_of_by_key,
                AsofJoinNodeOptions join_options, std::shared_ptr<Schema> output_schema,
-               std::vector<std::unique_ptr<KeyHasher>> key_hashers, bool must_hash,
-               bool may_rehash);
+               bool must_hash, bool may_rehash, size_t num_partitions);
 
   Status Init() override {
     auto inputs = this->inputs();
+    ExecContext* exec_context = plan()->query_context()->exec_context();
+    const size_t num_partitions = partitions_.size();
+    if (num_partitions > 1 && !ordering_.is_unordered()) {
+      output_sequencer_ = std::make_unique<OutputSequencer>(
+          num_partitions, plan()->query_context()->memory_pool());
+    }
     for (size_t i = 0; i < inputs.size(); i++) {
-      RETURN_NOT_OK(key_hashers_[i]->Init(plan()->query_context()->exec_context(),
-                                          inputs[i]->output_schema()));
-      ARROW_ASSIGN_OR_RAISE(
-          auto input_state,
-          InputState::Make(i, tolerance_, must_hash_, may_rehash_, key_hashers_[i].get(),
-                           inputs[i], this, backpressure_counter_,
-                           inputs[i]->output_schema(), indices_of_on_key_[i],
-                           indices_of_by_key_[i]));
-      state_.push_back(std::move(input_state));
+      auto& backpressure_controller = backpressure_controllers_.emplace_back(
+          std::make_unique<PartitionedBackpressureController>(
+              /*node=*/inputs[i], /*output=*/this, backpressure_counter_,
+              num_partitions));
+      std::vector<InputState*> input_states;
+      for (auto& partition : partitions_) {
+        auto& key_hasher = partition->key_hashers.emplace_back(
+            std::make_unique<KeyHasher>(i, indices_of_by_key_[i]));
+        key_hasher->node_ = this;
+        RETURN_NOT_OK(key_hasher->Init(exec_context, inputs[i]->output_schema()));
+        ARROW_ASSIGN_OR_RAISE(
+            auto input_state,
+            InputState::Make(i, tolerance_, must_hash_, may_rehash_, key_hasher.get(),
+                             this, backpressure_controller->MakeControl(),
+                             inputs[i]->output_schema(), indices_of_on_key_[i],
+                             indices_of_by_key_[i]));
+        input_states.push_back(input_state.get());
+        partition->state.push_back(std::move(input_state));
+      }
+
+      KeyHasher* partition_key_hasher = NULLPTR;
+      if (num_partitions > 1) {
+        auto& key_hasher = partition_key_hashers_.emplace_back(
+            std::make_unique<KeyHasher>(i, indices_of_by_key_[i]));
+        key_hasher->node_ = this;
+        RETURN_NOT_OK(key_hasher->Init(exec_context, inputs[i]->output_schema()));
+        partition_key_hasher = key_hasher.get();
+      }
+      input_partitioners_.push_back(std::make_unique<InputPartitioner>(
+          i, inputs[i]->output_schema(), std::move(input_states), partition_key_hasher,
+          i == 0 ? output_sequencer_.get() : NULLPTR, this, exec_context));
     }
 
-    col_index_t dst_offset = 0;
-    for (auto& state : state_)
-      dst_offset = state->InitSrcToDstMapping(dst_offset, !!dst_offset);
+    for (auto& partition : partitions_) {
+      col_index_t dst_offset = 0;
+      for (auto& state : partition->state)
+        dst_offset = state->InitSrcToDstMapping(dst_offset, !!dst_offset);
+    }
 
     return Status::OK();
   }
@@ -1150,8 +1460,10 @@ class AsofJoinNode : public ExecNode {
   virtual ~AsofJoinNode() {
 #ifdef ARROW_ENABLE_THREADING
     PushProcess(false);
-    if (process_thread_.joinable()) {
-      process_thread_.join();
+    for (auto& partition : partitions_) {
+      if (partition->process_thread.joinable()) {
+        partition->process_thread.join();
+      }
     }
 #endif
   }
@@ -1392,10 +1704,15 @@ class AsofJoinNode : public ExecNode {
         std::shared_ptr<Schema> output_schema,
         MakeOutputSchema(input_schema, indices_of_on_key, indices_of_by_key));
 
-    std::vector<std::unique_ptr<KeyHasher>> key_hashers;
-    for (size_t i = 0; i < n_input; i++) {
-      key_hashers.push_back(std::make_unique<KeyHasher>(i, indices_of_by_key[i]));
+    if (join_options.num_threads < 1) {
+      return Status::Invalid("AsofJoin requires a positive number of threads, got ",
+                             join_options.num_threads);
     }
+    // Rows can only be partitioned by a by-key
+    size_t num_partitions = n_by == 0 ? 1 : static_cast<size_t>(join_options.num_threads);
+#ifndef ARROW_ENABLE_THREADING
+    num_partitions = 1;
+#endif
     bool must_hash =
         n_by > 1 ||
         (n_by == 1 &&
@@ -1405,13 +1722,14 @@ class AsofJoinNode : public ExecNode {
     return plan->EmplaceNode<AsofJoinNode>(
         plan, inputs, std::move(input_labels), std::move(indices_of_on_key),
         std::move(indices_of_by_key), std::move(join_options), std::move(output_schema),
-        std::move(key_hashers), must_hash, may_rehash);
+        must_hash, may_rehash, num_partitions);
   }
 
   const char* kind_name() const override { return "AsofJoinNode"; }
   const Ordering& ordering() const override { return ordering_; }
 
   Status InputReceived(ExecNode* input, ExecBatch batch) override {
+    NoteInputReceived(input, batch);
     // InputReceived may be called after execution was finished. Pushing it to the
     // InputState is unnecessary since we're done (and anyway may cause the
     // BackPressureController to pause the input, causing a deadlock), so drop it.
@@ -1429,7 +1747,7 @@ class AsofJoinNode : public ExecNode {
     size_t k = std_find(inputs_, input) - inputs_.begin();
 
     // Put into the sequencing queue
-    ARROW_RETURN_NOT_OK(state_.at(k)->InsertBatch(std::move(batch)));
+    ARROW_RETURN_NOT_OK(input_partitioners_.at(k)->InsertBatch(std::move(batch)));
 
     PushProcess(true);
 
@@ -1437,11 +1755,11 @@ class AsofJoinNode : public ExecNode {
   }
 
   Status InputFinished(ExecNode* input, int total_batches) override {
-    {
-      std::lock_guard<std::mutex> guard(gate_);
-      ARROW_DCHECK(std_has(inputs_, input));
-      size_t k = std_find(inputs_, input) - inputs_.begin();
-      state_.at(k)->set_total_batches(total_batches);
+    ARROW_DCHECK(std_has(inputs_, input));
+    size_t k = std_find(inputs_, input) - inputs_.begin();
+    for (auto& partition : partitions_) {
+      std::lock_guard<std::mutex> guard(partition->gate);
+      partition->state.at(k)->set_total_batches(total_batches);
     }
     // Trigger a process call
     // The reason for this is that there are cases at the end of a table where we don't
@@ -1453,7 +1771,9 @@ class AsofJoinNode : public ExecNode {
   }
   void PushProcess(bool value) {
 #ifdef ARROW_ENABLE_THREADING
-    process_.Push(value);
+    for (auto& partition : partitions_) {
+      partition->process.Push(value);
+    }
 #else
     if (value) {
       ProcessNonThreaded();
@@ -1464,18 +1784,16 @@ class AsofJoinNode : public ExecNode {
   }
 
 #ifndef ARROW_ENABLE_THREADING
+  // Without threading there is a single partition
   bool ProcessNonThreaded() {
+    Partition& partition = *partitions_[0];
     while (!process_task_.is_finished()) {
-      Result<std::shared_ptr<RecordBatch>> result = ProcessInner();
+      Result<std::shared_ptr<RecordBatch>> result = ProcessInner(partition);
 
       if (result.ok()) {
         auto out_rb = *result;
         if (!out_rb) break;
-        ExecBatch out_b(*out_rb);
-        out_b.index = batches_produced_++;
-        DEBUG_SYNC(this, "produce batch ", out_b.index, ":", DEBUG_MANIP(std::endl),
-                   out_rb->ToString(), DEBUG_MANIP(std::endl));
-        Status st = output_->InputReceived(this, std::move(out_b));
+        Status st = Emit(partition, std::move(out_rb));
         if (!st.ok()) {
           // this isn't really from a thread,
           // but we call through to this for consistency
@@ -1489,7 +1807,7 @@ class AsofJoinNode : public ExecNode {
         return false;
       }
     }
-    auto& lhs = *state_.at(0);
+    auto& lhs = *partition.state.at(0);
     if (lhs.Finished() && !process_task_.is_finished()) {
       EndFromSingleThread(Status::OK());
     }
@@ -1499,11 +1817,12 @@ class AsofJoinNode : public ExecNode {
   void EndFromSingleThread(Status st = Status::OK()) {
     process_task_.MarkFinished(st);
     if (st.ok()) {
-      st = output_->InputFinished(this, batches_produced_);
+      st = output_->InputFinished(this, num_batches_produced());
     }
 
-    for (size_t i = 0; i < state_.size(); ++i) {
-      const auto& s = state_[i];
+    const auto& state = partitions_[0]->state;
+    for (size_t i = 0; i < state.size(); ++i) {
+      const auto& s = state[i];
       s->ForceShutdown();
       st &= inputs_[i]->StopProducing();
     }
@@ -1519,7 +1838,10 @@ class AsofJoinNode : public ExecNode {
       return Status::OK();
     }
 #ifdef ARROW_ENABLE_THREADING
-    process_thread_ = std::thread(&AsofJoinNode::ProcessThreadWrapper, this);
+    for (auto& partition : partitions_) {
+      partition->process_thread =
+          std::thread(&AsofJoinNode::ProcessThreadWrapper, this, partition.get());
+    }
 #endif
     return Status::OK();
   }
@@ -1529,7 +1851,9 @@ class AsofJoinNode : public ExecNode {
 
   Status StopProducingImpl() override {
 #ifdef ARROW_ENABLE_THREADING
-    process_.Clear();
+    for (auto& partition : partitions_) {
+      partition->process.Clear();
+    }
 #endif
     PushProcess(false);
     return Status::OK();
@@ -1542,17 +1866,22 @@ class AsofJoinNode : public ExecNode {
 #endif
 
  private:
-  // Outputs from this node are always in ascending order according to the on key
+  // Outputs from this node are in ascending order according to the on key, unless they
+  // are produced by several partitions and not re-sequenced
   const Ordering ordering_;
   std::vector<col_index_t> indices_of_on_key_;
   std::vector<std::vector<col_index_t>> indices_of_by_key_;
-  std::vector<std::unique_ptr<KeyHasher>> key_hashers_;
   bool must_hash_;
   bool may_rehash_;
-  // InputStates
-  // Each input state corresponds to an input table
-  std::vector<std::unique_ptr<InputState>> state_;
-  std::mutex gate_;
+  std::vector<std::unique_ptr<Partition>> partitions_;
+  // Sequences the batches of each input and distributes them to the partitions
+  std::vector<std::unique_ptr<InputPartitioner>> input_partitioners_;
+  // Hashers for the by-key of each input, used to partition it
+  std::vector<std::unique_ptr<KeyHasher>> partition_key_hashers_;
+  std::vector<std::unique_ptr<PartitionedBackpressureController>>
+      backpressure_controllers_;
+  // Set if the output of several partitions must be re-sequenced
+  std::unique_ptr<OutputSequencer> output_sequencer_;
   TolType tolerance_;
 #ifndef NDEBUG
   std::ostream* debug_os_;
@@ -1561,17 +1890,13 @@ class AsofJoinNode : public ExecNode {
 
   // Backpressure counter common to all inputs
   std::atomic<int32_t> backpressure_counter_;
-#ifdef ARROW_ENABLE_THREADING
-  // Queue for triggering processing of a given input
-  // (a false value is a poison pill)
-  ConcurrentQueue<bool> process_;
-  // Worker thread
-  std::thread process_thread_;
-#endif
   Future<> process_task_;
+  // Number of partitions whose left input is finished
+  std::atomic<size_t> partitions_finished_{0};
+  std::atomic<bool> ended_{false};
 
-  // In-progress batches produced
-  int batches_produced_ = 0;
+  // In-progress batches produced, if not re-sequenced
+  std::atomic<int> batches_produced_{0};
 };
 
 AsofJoinNode::AsofJoinNode(ExecPlan* plan, NodeVector inputs,
@@ -1579,15 +1904,16 @@ AsofJoinNode::AsofJoinNode(ExecPlan* plan, NodeVector inputs,
                            const std::vector<col_index_t>& indices_of_on_key,
                            const std::vector<std::vector<col_index_t>>& indices_of_by_key,
                            AsofJoinNodeOptions join_options,
-                           std::shared_ptr<Schema> output_schema,
-                           std::vector<std::unique_ptr<KeyHasher>> key_hashers,
-                           bool must_hash, bool may_rehash)
+                           std::shared_ptr<Schema> output_schema, bool must_hash,
+                           bool may_rehash, size_t num_partitions)
     : ExecNode(plan, inputs, input_labels,
                /*output_schema=*/std::move(output_schema)),
-      ordering_({SortKey(indices_of_on_key[0])}),
+      TracedNode(this),
+      ordering_(num_partitions > 1 && !join_options.sequence_output
+                    ? Ordering::Unordered()
+                    : Ordering({SortKey(indices_of_on_key[0])})),
       indices_of_on_key_(std::move(indices_of_on_key)),
       indices_of_by_key_(std::move(indices_of_by_key)),
-      key_hashers_(std::move(key_hashers)),
       must_hash_(must_hash),
       may_rehash_(may_rehash),
       tolerance_(TolType(join_options.tolerance)),
@@ -1595,15 +1921,9 @@ AsofJoinNode::AsofJoinNode(ExecPlan* plan, NodeVector inputs,
       debug_os_(join_options.debug_opts ? join_options.debug_opts->os : nullptr),
       debug_mutex_(join_options.debug_opts ? join_options.debug_opts->mutex : nullptr),
 #endif
-      backpressure_counter_(1)
-#ifdef ARROW_ENABLE_THREADING
-      ,
-      process_(),
-      process_thread_()
-#endif
-{
-  for (auto& key_hasher : key_hashers_) {
-    key_hasher->node_ = this;
+      backpressure_counter_(1) {
+  for (size_t i = 0; i < num_partitions; ++i) {
+    partitions_.push_back(std::make_unique<Partition>(i));
   }
 }
 
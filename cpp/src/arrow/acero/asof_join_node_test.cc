@@ -41,6 +41,7 @@
 #include "arrow/acero/util.h"
 #include "arrow/api.h"
 #include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/cast.h"
 #include "arrow/compute/row/row_encoder_internal.h"
 #include "arrow/compute/test_util_internal.h"
@@ -1590,6 +1591,61 @@ TEST(AsofJoinTest, BatchSequencing) {
   return TestSequencing(MakeIntegerBatches, /*num_batches=*/1000, /*batch_size=*/1);
 }
 
+TEST(AsofJoinTest, MultipleThreads) {
+  constexpr int kNumKeys = 17;
+  auto l_schema =
+      schema({field("time", int32()), field("key", int32()), field("l_value", int32())});
+  auto r_schema =
+      schema({field("time", int32()), field("key", int32()), field("r_value", int32())});
+  ASSERT_OK_AND_ASSIGN(
+      auto l_batches,
+      MakeIntegerBatches({[](int row) -> int64_t { return row; },
+                          [](int row) -> int64_t { return row % kNumKeys; },
+                          [](int row) -> int64_t { return row * 10; }},
+                         l_schema, /*num_batches=*/20, /*batch_size=*/50));
+  ASSERT_OK_AND_ASSIGN(
+      auto r_batches,
+      MakeIntegerBatches({[](int row) -> int64_t { return row * 3; },
+                          [](int row) -> int64_t { return row % (kNumKeys + 2); },
+                          [](int row) -> int64_t { return row * 10 + 1; }},
+                         r_schema, /*num_batches=*/10, /*batch_size=*/30));
+
+  for (int64_t tolerance : {-100, 100}) {
+    ARROW_SCOPED_TRACE("tolerance ", tolerance);
+    auto run = [&](int num_threads, bool sequence_output) {
+      AsofJoinNodeOptions options = GetRepeatedOptions(2, "time", {"key"}, tolerance);
+      options.num_threads = num_threads;
+      options.sequence_output = sequence_output;
+      Declaration l_src = {"source",
+                           SourceNodeOptions(l_schema, l_batches.gen(true, false))};
+      Declaration r_src = {"source",
+                           SourceNodeOptions(r_schema, r_batches.gen(true, false))};
+      Declaration asofjoin = {"asofjoin", {l_src, r_src}, std::move(options)};
+      QueryOptions query_options;
+      query_options.sequence_output = sequence_output;
+      return DeclarationToTable(std::move(asofjoin), query_options);
+    };
+    ASSERT_OK_AND_ASSIGN(auto expected, run(/*num_threads=*/1, true));
+    ASSERT_EQ(expected->num_rows(), 1000);
+
+    // The output of the threads is put back in the order of the left input
+    ASSERT_OK_AND_ASSIGN(auto sequenced, run(/*num_threads=*/4, true));
+    AssertTablesEqual(*expected, *sequenced, /*same_chunk_layout=*/false);
+
+    ASSERT_OK_AND_ASSIGN(auto unsequenced, run(/*num_threads=*/4, false));
+    compute::SortOptions sort_options({compute::SortKey("time")});
+    ASSERT_OK_AND_ASSIGN(auto sorted, compute::SortIndices(unsequenced, sort_options));
+    ASSERT_OK_AND_ASSIGN(auto unsequenced_sorted, compute::Take(unsequenced, sorted));
+    AssertTablesEqual(*expected, *unsequenced_sorted.table(),
+                      /*same_chunk_layout=*/false);
+  }
+
+  AsofJoinNodeOptions options = GetRepeatedOptions(2, "time", {"key"}, 0);
+  options.num_threads = 0;
+  DoInvalidPlanTest(l_batches, r_batches, options,
+                    "AsofJoin requires a positive number of threads");
+}
+
 template <typename BatchesMaker>
 void TestSchemaResolution(BatchesMaker maker, int num_batches, int batch_size) {
   // GH-39803: The key hasher needs to resolve the types of key columns. All other
@@ -23,34 +23,55 @@
 
 namespace arrow::acero {
 
+/// Pauses a producer when a queue holds too many items, or too many bytes, and resumes
+/// it once the queue is back below both low thresholds
 class BackpressureHandler {
  private:
   BackpressureHandler(size_t low_threshold, size_t high_threshold,
-                      std::unique_ptr<BackpressureControl> backpressure_control)
+                      std::unique_ptr<BackpressureControl> backpressure_control,
+                      uint64_t low_bytes_threshold, uint64_t high_bytes_threshold)
       : low_threshold_(low_threshold),
         high_threshold_(high_threshold),
+        low_bytes_threshold_(low_bytes_threshold),
+        high_bytes_threshold_(high_bytes_threshold),
         backpressure_control_(std::move(backpressure_control)) {}
 
  public:
+  /// The byte thresholds are only applied if high_bytes_threshold is positive
   static Result<BackpressureHandler> Make(
       size_t low_threshold, size_t high_threshold,
-      std::unique_ptr<BackpressureControl> backpressure_control) {
+      std::unique_ptr<BackpressureControl> backpressure_control,
+      uint64_t low_bytes_threshold = 0, uint64_t high_bytes_threshold = 0) {
     if (low_threshold >= high_threshold) {
       return Status::Invalid("low threshold (", low_threshold,
                              ") must be less than high threshold (", high_threshold, ")");
     }
+    if (high_bytes_threshold > 0 && low_bytes_threshold >= high_bytes_threshold) {
+      return Status::Invalid("low bytes threshold (", low_bytes_threshold,
+                             ") must be less than high bytes threshold (",
+                             high_bytes_threshold, ")");
+    }
     if (backpressure_control == NULLPTR) {
       return Status::Invalid("null backpressure control parameter");
     }
     BackpressureHandler backpressure_handler(low_threshold, high_threshold,
-                                             std::move(backpressure_control));
+                                             std::move(backpressure_control),
+                                             low_bytes_threshold, high_bytes_threshold);
     return backpressure_handler;
   }
 
-  void Handle(size_t start_level, size_t end_level) {
-    if (start_level < high_threshold_ && end_level >= high_threshold_) {
+  void Handle(size_t start_level, size_t end_level) { Update(end_level, 0); }
+
+  /// \brief Update the state of the queue, `level` items holding `bytes` bytes
+  void Update(size_t level, uint64_t bytes) {
+    const bool check_bytes = high_bytes_threshold_ > 0;
+    if (!paused_ &&
+        (level >= high_threshold_ || (check_bytes && bytes >= high_bytes_threshold_))) {
+      paused_ = true;
       backpressure_control_->Pause();
-    } else if (start_level > low_threshold_ && end_level <= low_threshold_) {
+    } else if (paused_ && level <= low_threshold_ &&
+               (!check_bytes || bytes <= low_bytes_threshold_)) {
+      paused_ = false;
       backpressure_control_->Resume();
     }
   }
@@ -58,6 +79,9 @@ class BackpressureHandler {
  private:
   size_t low_threshold_;
   size_t high_threshold_;
+  uint64_t low_bytes_threshold_;
+  uint64_t high_bytes_threshold_;
+  bool paused_ = false;
   std::unique_ptr<BackpressureControl> backpressure_control_;
 };
 
@@ -17,10 +17,15 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
+#include <cstdint>
+#include <functional>
 #include <mutex>
+#include <optional>
 #include <queue>
 #include "arrow/acero/backpressure_handler.h"
+#include "arrow/util/byte_size.h"
 
 namespace arrow::acero {
 
@@ -116,23 +121,22 @@ template <typename T>
 class BackpressureConcurrentQueue : private ConcurrentQueue<T> {
  private:
   struct DoHandle {
-    explicit DoHandle(BackpressureConcurrentQueue& queue)
-        : queue_(queue), start_size_(queue_.SizeUnlocked()) {}
+    explicit DoHandle(BackpressureConcurrentQueue& queue) : queue_(queue) {}
 
     ~DoHandle() {
       // unsynced access is safe since DoHandle is internally only used when the
       // lock is held
-      size_t end_size = queue_.SizeUnlocked();
-      queue_.handler_.Handle(start_size_, end_size);
+      queue_.handler_.Update(queue_.SizeUnlocked(), queue_.bytes_);
     }
 
     BackpressureConcurrentQueue& queue_;
-    size_t start_size_;
   };
 
  public:
-  explicit BackpressureConcurrentQueue(BackpressureHandler handler)
-      : handler_(std::move(handler)) {}
+  /// `item_bytes`, if given, measures the items for the byte thresholds of the handler
+  explicit BackpressureConcurrentQueue(
+      BackpressureHandler handler, std::function<uint64_t(const T&)> item_bytes = {})
+      : handler_(std::move(handler)), item_bytes_(std::move(item_bytes)) {}
 
   using ConcurrentQueue<T>::Empty;
   using ConcurrentQueue<T>::Front;
@@ -143,14 +147,20 @@ class BackpressureConcurrentQueue : private ConcurrentQueue<T> {
     std::unique_lock<std::mutex> lock(ConcurrentQueue<T>::GetMutex());
     ConcurrentQueue<T>::WaitUntilNonEmpty(lock);
     DoHandle do_handle(*this);
-    return ConcurrentQueue<T>::PopUnlocked();
+    T item = ConcurrentQueue<T>::PopUnlocked();
+    bytes_ -= ItemBytes(item);
+    return item;
   }
 
   // Pops the last item from the queue, or returns a nullopt if empty
   std::optional<T> TryPop() {
     std::unique_lock<std::mutex> lock(ConcurrentQueue<T>::GetMutex());
     DoHandle do_handle(*this);
-    return ConcurrentQueue<T>::TryPopUnlocked();
+    std::optional<T> item = ConcurrentQueue<T>::TryPopUnlocked();
+    if (item.has_value()) {
+      bytes_ -= ItemBytes(*item);
+    }
+    return item;
   }
 
   // Pushes an item to the queue
@@ -158,6 +168,7 @@ class BackpressureConcurrentQueue : private ConcurrentQueue<T> {
     if (shutdown_) return;
     std::unique_lock<std::mutex> lock(ConcurrentQueue<T>::GetMutex());
     DoHandle do_handle(*this);
+    bytes_ += ItemBytes(item);
     ConcurrentQueue<T>::PushUnlocked(item);
   }
 
@@ -165,6 +176,7 @@ class BackpressureConcurrentQueue : private ConcurrentQueue<T> {
   void Clear() {
     std::unique_lock<std::mutex> lock(ConcurrentQueue<T>::GetMutex());
     DoHandle do_handle(*this);
+    bytes_ = 0;
     ConcurrentQueue<T>::ClearUnlocked();
   }
 
@@ -174,8 +186,18 @@ class BackpressureConcurrentQueue : private ConcurrentQueue<T> {
   }
 
  private:
+  uint64_t ItemBytes(const T& item) const { return item_bytes_ ? item_bytes_(item) : 0; }
+
   BackpressureHandler handler_;
+  std::function<uint64_t(const T&)> item_bytes_;
+  uint64_t bytes_ = 0;
   std::atomic<bool> shutdown_{false};
 };
 
+/// The size of a queued record batch, for the byte thresholds of a
+/// BackpressureConcurrentQueue
+inline uint64_t QueuedBatchBytes(const std::shared_ptr<RecordBatch>& batch) {
+  return static_cast<uint64_t>(::arrow::util::TotalBufferSize(*batch));
+}
+
 }  // namespace arrow::acero
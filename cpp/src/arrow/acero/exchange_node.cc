@@ -0,0 +1,286 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/exec_plan_internal.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/partition_util.h"
+#include "arrow/acero/query_context.h"
+#include "arrow/acero/util.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/expression.h"
+#include "arrow/compute/key_hash_internal.h"
+#include "arrow/compute/light_array_internal.h"
+#include "arrow/compute/util_internal.h"
+#include "arrow/result.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging_internal.h"
+#include "arrow/util/tracing_internal.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+using compute::Hashing32;
+using compute::KeyColumnArray;
+using compute::TakeOptions;
+
+namespace acero {
+namespace {
+
+class ExchangeNode : public ExecNode, public TracedNode {
+ public:
+  ExchangeNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+               std::shared_ptr<Schema> output_schema, std::vector<int> key_ids,
+               int num_partitions)
+      : ExecNode(plan, std::move(inputs), {"input"}, std::move(output_schema)),
+        TracedNode(this),
+        key_ids_(std::move(key_ids)),
+        num_partitions_(num_partitions),
+        partitions_(num_partitions) {}
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "ExchangeNode"));
+
+    const auto& exchange_options = checked_cast<const ExchangeNodeOptions&>(options);
+    if (exchange_options.num_partitions < 1 ||
+        exchange_options.num_partitions > (1 << 15)) {
+      return Status::Invalid("Exchange requires between 1 and 32768 partitions, got ",
+                             exchange_options.num_partitions);
+    }
+    if (exchange_options.keys.empty()) {
+      return Status::Invalid("Exchange requires at least one key");
+    }
+
+    const auto& input_schema = inputs[0]->output_schema();
+    std::vector<int> key_ids;
+    for (const FieldRef& key : exchange_options.keys) {
+      ARROW_ASSIGN_OR_RAISE(auto match, key.FindOne(*input_schema));
+      const DataType& type = *input_schema->field(match[0])->type();
+      // The hash of dictionary indices would depend on the dictionary of each batch
+      if (match.indices().size() != 1 || type.id() == Type::DICTIONARY ||
+          !(is_fixed_width(type.id()) || is_binary_like(type.id()) ||
+            is_large_binary_like(type.id()))) {
+        return Status::NotImplemented("Exchange does not support key ", key.ToString(),
+                                      " of type ", type);
+      }
+      key_ids.push_back(match[0]);
+    }
+    if (input_schema->GetFieldIndex(exchange_options.partition_field) >= 0) {
+      return Status::Invalid("Exchange partition field '",
+                             exchange_options.partition_field,
+                             "' already exists in the input");
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        std::shared_ptr<Schema> output_schema,
+        input_schema->AddField(input_schema->num_fields(),
+                               field(exchange_options.partition_field, int32(),
+                                     /*nullable=*/false)));
+
+    return plan->EmplaceNode<ExchangeNode>(plan, std::move(inputs),
+                                           std::move(output_schema), std::move(key_ids),
+                                           exchange_options.num_partitions);
+  }
+
+  const char* kind_name() const override { return "ExchangeNode"; }
+
+  Status StartProducing() override {
+    NoteStartProducing(ToStringExtra());
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->PauseProducing(this, counter);
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->ResumeProducing(this, counter);
+  }
+
+  Status StopProducingImpl() override { return Status::OK(); }
+
+  Status InputReceived(ExecNode* input, ExecBatch batch) override {
+    auto scope = TraceInputReceived(batch);
+    DCHECK_EQ(input, inputs_[0]);
+    for (int64_t offset = 0; offset < batch.length; offset += ExecPlan::kMaxBatchSize) {
+      RETURN_NOT_OK(Partition(batch.Slice(offset, ExecPlan::kMaxBatchSize)));
+    }
+    if (input_counter_.Increment()) {
+      return output_->InputFinished(this, num_output_batches_.load());
+    }
+    return Status::OK();
+  }
+
+  Status InputFinished(ExecNode* input, int total_batches) override {
+    DCHECK_EQ(input, inputs_[0]);
+    EVENT_ON_CURRENT_SPAN("InputFinished", {{"batches.length", total_batches}});
+    if (input_counter_.SetTotal(total_batches)) {
+      return output_->InputFinished(this, num_output_batches_.load());
+    }
+    return Status::OK();
+  }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    std::stringstream ss;
+    const auto& input_schema = inputs_[0]->output_schema();
+    ss << "keys=[";
+    for (size_t i = 0; i < key_ids_.size(); ++i) {
+      if (i > 0) ss << ", ";
+      ss << '"' << input_schema->field(key_ids_[i])->name() << '"';
+    }
+    ss << "], num_partitions=" << num_partitions_;
+    return ss.str();
+  }
+
+ private:
+  // The batches of a partition waiting to be delivered.  At most one thread delivers
+  // the batches of a partition at a time, other threads only queue them.
+  struct PartitionQueue {
+    std::mutex mutex;
+    std::deque<ExecBatch> batches;
+    bool delivering = false;
+  };
+
+  // Splits a batch of at most kMaxBatchSize rows into one batch per partition
+  Status Partition(const ExecBatch& batch) {
+    const int64_t num_rows = batch.length;
+    if (num_rows == 0) {
+      return Status::OK();
+    }
+    if (num_partitions_ == 1) {
+      return Deliver(0, batch);
+    }
+    QueryContext* ctx = plan_->query_context();
+
+    std::vector<Datum> keys(key_ids_.size());
+    for (size_t i = 0; i < key_ids_.size(); ++i) {
+      keys[i] = batch[key_ids_[i]];
+      if (keys[i].is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(keys[i], MakeArrayFromScalar(*keys[i].scalar(), num_rows,
+                                                           ctx->memory_pool()));
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(ExecBatch key_batch, ExecBatch::Make(std::move(keys)));
+
+    arrow::util::TempVectorStack stack;
+    RETURN_NOT_OK(
+        stack.Init(ctx->scratch_memory_pool(), Hashing32::kHashBatchTempStackUsage));
+    std::vector<uint32_t> hashes(num_rows);
+    std::vector<KeyColumnArray> temp_column_arrays;
+    RETURN_NOT_OK(Hashing32::HashBatch(key_batch, hashes.data(), temp_column_arrays,
+                                       ctx->hardware_flags(), &stack, 0, num_rows));
+
+    // Map the hash onto [0, num_partitions) using its highest bits, the lowest ones
+    // are typically used to address hash table slots downstream
+    std::vector<uint16_t> ranges(num_partitions_ + 1);
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> row_ids_buf,
+                          AllocateBuffer(num_rows * sizeof(int32_t), ctx->memory_pool()));
+    auto* row_ids = row_ids_buf->mutable_data_as<int32_t>();
+    const uint64_t num_partitions = static_cast<uint64_t>(num_partitions_);
+    PartitionSort::Eval(
+        num_rows, num_partitions_, ranges.data(),
+        [&](int64_t i) { return (hashes[i] * num_partitions) >> 32; },
+        [&](int64_t i, int pos) { row_ids[pos] = static_cast<int32_t>(i); });
+
+    Int32Array all_row_ids(num_rows, std::move(row_ids_buf));
+    for (int partition = 0; partition < num_partitions_; ++partition) {
+      const int64_t begin = ranges[partition];
+      const int64_t length = ranges[partition + 1] - begin;
+      if (length == 0) {
+        continue;
+      }
+      std::shared_ptr<Array> partition_row_ids = all_row_ids.Slice(begin, length);
+      std::vector<Datum> values(batch.values.size());
+      for (size_t i = 0; i < values.size(); ++i) {
+        if (batch[i].is_scalar()) {
+          values[i] = batch[i];
+        } else {
+          ARROW_ASSIGN_OR_RAISE(values[i], compute::Take(batch[i], partition_row_ids,
+                                                         TakeOptions::NoBoundsCheck(),
+                                                         ctx->exec_context()));
+        }
+      }
+      RETURN_NOT_OK(Deliver(partition, ExecBatch(std::move(values), length)));
+    }
+    return Status::OK();
+  }
+
+  // Tags `rows` with their partition and passes them on, after any batches of the same
+  // partition which are already being delivered
+  Status Deliver(int partition, ExecBatch rows) {
+    rows.values.emplace_back(std::make_shared<Int32Scalar>(partition));
+    const std::string& partition_field = output_schema_->fields().back()->name();
+    rows.guarantee = compute::equal(compute::field_ref(partition_field),
+                                    compute::literal(partition));
+    num_output_batches_.fetch_add(1);
+
+    PartitionQueue& queue = partitions_[partition];
+    std::unique_lock<std::mutex> lk(queue.mutex);
+    queue.batches.push_back(std::move(rows));
+    if (queue.delivering) {
+      return Status::OK();
+    }
+    queue.delivering = true;
+    while (!queue.batches.empty()) {
+      ExecBatch next = std::move(queue.batches.front());
+      queue.batches.pop_front();
+      lk.unlock();
+      Status status = output_->InputReceived(this, std::move(next));
+      lk.lock();
+      if (!status.ok()) {
+        queue.delivering = false;
+        return status;
+      }
+    }
+    queue.delivering = false;
+    return Status::OK();
+  }
+
+  const std::vector<int> key_ids_;
+  const int num_partitions_;
+
+  AtomicCounter input_counter_;
+  std::atomic<int> num_output_batches_{0};
+  std::vector<PartitionQueue> partitions_;
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterExchangeNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(registry->AddFactory(std::string(ExchangeNodeOptions::kName),
+                                 ExchangeNode::Make));
+}
+
+}  // namespace internal
+}  // namespace acero
+}  // namespace arrow
@@ -0,0 +1,129 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <gmock/gmock-matchers.h>
+
+#include <unordered_map>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/test_util_internal.h"
+#include "arrow/compute/test_util_internal.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace acero {
+
+std::shared_ptr<Table> MakeInput() {
+  auto input_schema = schema({field("key", int32()), field("str", utf8())});
+  random::RandomArrayGenerator rng(42);
+  ArrayVector keys, strs;
+  for (int i = 0; i < 5; ++i) {
+    keys.push_back(rng.Int32(500, 0, 50, /*null_probability=*/0.1));
+    strs.push_back(rng.String(500, 0, 3, /*null_probability=*/0.1));
+  }
+  return Table::Make(input_schema, {std::make_shared<ChunkedArray>(keys),
+                                    std::make_shared<ChunkedArray>(strs)});
+}
+
+TEST(ExchangeNode, RoutesRowsByKey) {
+  std::shared_ptr<Table> input = MakeInput();
+  constexpr int kNumPartitions = 4;
+  for (bool use_threads : {false, true}) {
+    SCOPED_TRACE(use_threads ? "parallel" : "serial");
+    Declaration plan = Declaration::Sequence(
+        {{"table_source", TableSourceNodeOptions(input, /*max_batch_size=*/100)},
+         {"exchange", ExchangeNodeOptions({"key"}, kNumPartitions)}});
+    ASSERT_OK_AND_ASSIGN(BatchesWithCommonSchema result,
+                         DeclarationToExecBatches(std::move(plan), use_threads));
+    ASSERT_EQ(result.schema->num_fields(), 3);
+    ASSERT_EQ(result.schema->field(2)->name(), "__partition");
+
+    // Every batch belongs to one partition, and each key to one partition
+    std::unordered_map<std::string, int> key_partitions;
+    std::vector<std::shared_ptr<RecordBatch>> rows;
+    for (const ExecBatch& batch : result.batches) {
+      ASSERT_TRUE(batch[2].is_scalar());
+      const int partition = checked_cast<const Int32Scalar&>(*batch[2].scalar()).value;
+      ASSERT_GE(partition, 0);
+      ASSERT_LT(partition, kNumPartitions);
+      std::shared_ptr<Array> keys = batch[0].make_array();
+      for (int64_t i = 0; i < keys->length(); ++i) {
+        ASSERT_OK_AND_ASSIGN(auto key, keys->GetScalar(i));
+        auto inserted = key_partitions.emplace(key->ToString(), partition);
+        ASSERT_EQ(inserted.first->second, partition) << key->ToString();
+      }
+      ASSERT_OK_AND_ASSIGN(auto record_batch, batch.ToRecordBatch(result.schema));
+      ASSERT_OK_AND_ASSIGN(record_batch, record_batch->RemoveColumn(2));
+      rows.push_back(std::move(record_batch));
+    }
+    // The keys are spread over more than one partition
+    std::unordered_map<int, int> partition_sizes;
+    for (const auto& entry : key_partitions) {
+      ++partition_sizes[entry.second];
+    }
+    ASSERT_GT(partition_sizes.size(), 1);
+
+    ASSERT_OK_AND_ASSIGN(auto actual, Table::FromRecordBatches(input->schema(), rows));
+    AssertTablesEqualIgnoringOrder(input, actual);
+  }
+}
+
+TEST(ExchangeNode, FilterOnPartition) {
+  std::shared_ptr<Table> input = MakeInput();
+  auto run = [&](std::vector<Declaration> nodes) {
+    nodes.insert(nodes.begin(),
+                 {"table_source", TableSourceNodeOptions(input, /*max_batch_size=*/100)});
+    return DeclarationToTable(Declaration::Sequence(std::move(nodes)));
+  };
+  // The partitions are disjoint and together hold all rows
+  int64_t num_rows = 0;
+  for (int partition = 0; partition < 3; ++partition) {
+    ASSERT_OK_AND_ASSIGN(
+        auto rows, run({{"exchange", ExchangeNodeOptions({"key", "str"}, 3, "p")},
+                        {"filter", FilterNodeOptions(compute::equal(
+                                       compute::field_ref("p"),
+                                       compute::literal(partition)))}}));
+    num_rows += rows->num_rows();
+  }
+  ASSERT_EQ(num_rows, input->num_rows());
+}
+
+TEST(ExchangeNode, Invalid) {
+  std::shared_ptr<Table> input = MakeInput();
+  auto check_invalid = [&](ExchangeNodeOptions options, const std::string& message) {
+    Declaration plan = Declaration::Sequence(
+        {{"table_source", TableSourceNodeOptions(input)}, {"exchange", options}});
+    EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, testing::HasSubstr(message),
+                                    DeclarationToStatus(std::move(plan)));
+  };
+  check_invalid(ExchangeNodeOptions({"key"}, 0), "between 1 and 32768 partitions");
+  check_invalid(ExchangeNodeOptions({}, 2), "at least one key");
+  check_invalid(ExchangeNodeOptions({"key"}, 2, "str"), "already exists");
+}
+
+}  // namespace acero
+}  // namespace arrow
@@ -24,7 +24,9 @@
 #include <unordered_set>
 
 #include "arrow/acero/exec_plan_internal.h"
+#include "arrow/acero/join_planning.h"
 #include "arrow/acero/options.h"
+#include "arrow/acero/profile.h"
 #include "arrow/acero/query_context.h"
 #include "arrow/acero/task_util.h"
 #include "arrow/acero/util.h"
@@ -119,6 +121,12 @@ struct ExecPlanImpl : public ExecPlan {
 
     started_ = true;
 
+    if (const auto& profile = query_context_.options().profile) {
+      for (auto& node : nodes_) {
+        node->SetProfile(profile->AddNode(*node));
+      }
+    }
+
     // We call StartProducing on each of the nodes.  The source nodes should generally
     // start scheduling some tasks during this call.
     //
@@ -330,6 +338,10 @@ struct ExecPlanImpl : public ExecPlan {
     return ss.str();
   }
 
+  std::shared_ptr<const KeyValueMetadata> metadata_;
+  // Declared before the nodes so that it outlives them, the nodes may hold memory
+  // allocated from the query's scratch pool
+  QueryContext query_context_;
   Status error_st_;
   Future<> finished_ = Future<>::Make();
   bool started_ = false;
@@ -339,8 +351,6 @@ struct ExecPlanImpl : public ExecPlan {
   NodeVector sorted_nodes_;
   uint32_t auto_label_counter_ = 0;
   arrow::util::tracing::Span span_;
-  std::shared_ptr<const KeyValueMetadata> metadata_;
-  QueryContext query_context_;
   // This field only exists for backwards compatibility.  Remove once the deprecated
   // ExecPlan::Make overloads have been removed.
   std::shared_ptr<ThreadPool> owned_thread_pool_;
@@ -647,6 +657,10 @@ namespace {
 Future<std::shared_ptr<Table>> DeclarationToTableImpl(
     Declaration declaration, QueryOptions query_options,
     ::arrow::internal::Executor* cpu_executor) {
+  if (query_options.reorder_joins) {
+    ARROW_ASSIGN_OR_RAISE(declaration, ReorderJoins(std::move(declaration),
+                                                    query_options.function_registry));
+  }
   ExecContext exec_ctx(query_options.memory_pool, cpu_executor,
                        query_options.function_registry);
   std::shared_ptr<std::shared_ptr<Table>> output_table =
@@ -676,6 +690,10 @@ Future<std::vector<std::shared_ptr<RecordBatch>>> DeclarationToBatchesImpl(
 Future<BatchesWithCommonSchema> DeclarationToExecBatchesImpl(
     Declaration declaration, QueryOptions options,
     ::arrow::internal::Executor* cpu_executor) {
+  if (options.reorder_joins) {
+    ARROW_ASSIGN_OR_RAISE(
+        declaration, ReorderJoins(std::move(declaration), options.function_registry));
+  }
   std::shared_ptr<Schema> out_schema;
   AsyncGenerator<std::optional<ExecBatch>> sink_gen;
   ExecContext exec_ctx(options.memory_pool, cpu_executor, options.function_registry);
@@ -709,6 +727,10 @@ Future<BatchesWithCommonSchema> DeclarationToExecBatchesImpl(
 
 Future<> DeclarationToStatusImpl(Declaration declaration, QueryOptions options,
                                  ::arrow::internal::Executor* cpu_executor) {
+  if (options.reorder_joins) {
+    ARROW_ASSIGN_OR_RAISE(
+        declaration, ReorderJoins(std::move(declaration), options.function_registry));
+  }
   ExecContext exec_ctx(options.memory_pool, cpu_executor, options.function_registry);
   ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ExecPlan> exec_plan,
                         ExecPlan::Make(options, exec_ctx));
@@ -1013,6 +1035,10 @@ Result<AsyncGenerator<std::shared_ptr<RecordBatch>>> DeclarationToRecordBatchGen
     return DeclarationToRecordBatchGenerator(std::move(declaration), std::move(options),
                                              cpu_executor, out_schema, &tmp_plan);
   }
+  if (options.reorder_joins) {
+    ARROW_ASSIGN_OR_RAISE(
+        declaration, ReorderJoins(std::move(declaration), options.function_registry));
+  }
   auto converter = std::make_shared<BatchConverter>();
   ExecContext exec_ctx(options.memory_pool, cpu_executor, options.function_registry);
   std::shared_ptr<ExecPlan>& plan = *out_plan;
@@ -1116,8 +1142,11 @@ ExecFactoryRegistry* default_exec_factory_registry() {
       internal::RegisterAggregateNode(this);
       internal::RegisterSinkNode(this);
       internal::RegisterHashJoinNode(this);
+      internal::RegisterMergeJoinNode(this);
       internal::RegisterAsofJoinNode(this);
       internal::RegisterSortedMergeNode(this);
+      internal::RegisterWindowNode(this);
+      internal::RegisterExchangeNode(this);
     }
 
     Result<Factory> GetFactory(const std::string& factory_name) override {
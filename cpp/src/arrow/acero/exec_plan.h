@@ -157,6 +157,12 @@ class ARROW_ACERO_EXPORT ExecNode {
   const std::string& label() const { return label_; }
   void SetLabel(std::string label) { label_ = std::move(label); }
 
+  /// \brief The runtime statistics of this node, if the query is profiled
+  ///
+  /// See QueryOptions::profile.
+  NodeProfile* profile() const { return profile_; }
+  void SetProfile(NodeProfile* profile) { profile_ = profile; }
+
   virtual Status Validate() const;
 
   /// \brief the ordering of the output batches
@@ -202,6 +208,15 @@ class ARROW_ACERO_EXPORT ExecNode {
   /// maintain continuity.
   virtual const Ordering& ordering() const;
 
+  /// \brief Whether this node can receive batches with a selection vector
+  ///
+  /// A node returning true must honour ExecBatch::selection_vector on its input
+  /// batches, for example by evaluating expressions over them or by calling
+  /// ExecBatch::ApplySelection.  Producers such as the filter node only defer
+  /// filtering to their output when it returns true, and send materialized batches
+  /// otherwise.
+  virtual bool AcceptsSelectionVector() const { return false; }
+
   /// Upstream API:
   /// These functions are called by input nodes that want to inform this node
   /// about an updated condition (a new input batch or an impending
@@ -341,6 +356,7 @@ class ARROW_ACERO_EXPORT ExecNode {
   std::atomic<bool> stopped_;
   ExecPlan* plan_;
   std::string label_;
+  NodeProfile* profile_ = NULLPTR;
 
   NodeVector inputs_;
   std::vector<std::string> input_labels_;
@@ -602,6 +618,85 @@ struct ARROW_ACERO_EXPORT QueryOptions {
   /// If this field is not set then it will be treated as kWarn unless overridden
   /// by the ACERO_ALIGNMENT_HANDLING environment variable
   std::optional<UnalignedBufferHandling> unaligned_buffer_handling;
+
+  /// \brief The size in bytes that source nodes aim for when slicing batches
+  ///
+  /// By default sources slice batches of ExecPlan::kMaxBatchSize rows whatever the
+  /// width of the rows, so that a batch of wide rows can take megabytes while a batch
+  /// of narrow rows takes a few kilobytes.  If set, source and scan nodes size each
+  /// batch to about this many bytes instead, between 1024 and kMaxBatchSize rows.
+  /// Zero stands for the size of the L2 cache.  Ignored with legacy batching.
+  std::optional<int64_t> target_batch_bytes;
+
+  /// \brief Number of bytes a pipeline breaker may buffer before spilling to disk
+  ///
+  /// Nodes that need to accumulate their entire input before producing output (e.g.
+  /// the order_by node) will write data to temporary files in the platform temporary
+  /// directory once they hold more than this many bytes.
+  ///
+  /// When this is set, the aggregate node (without segment keys) partitions its input
+  /// by grouping keys and aggregates one partition at a time to bound the size of the
+  /// hash tables.  Partitions that don't fit in the budget are spilled.
+  ///
+  /// The hash join node partitions both inputs by join keys in the same way.  The
+  /// build side partitions that don't fit in the budget are spilled, along with the
+  /// matching probe side rows, and joined one partition at a time at the end.  This
+  /// doesn't apply to joins that use dictionaries or large binary keys.
+  ///
+  /// If this field is 0 (the default) then nothing is spilled and the whole input
+  /// is kept in memory.
+  int64_t spill_memory_limit = 0;
+
+  /// \brief Number of bytes the nodes of the plan may buffer in total
+  ///
+  /// Nodes that buffer data (e.g. the order_by and hash join nodes) account for it
+  /// with QueryContext::AccountMemory.  Once the plan as a whole holds more than this
+  /// many bytes, QueryContext::under_memory_pressure returns true and the nodes that
+  /// can spill do so.
+  ///
+  /// If this field is 0 (the default) then the plan has no budget.
+  int64_t memory_budget = 0;
+
+  /// \brief Whether to plan the hash joins of the declaration before running it
+  ///
+  /// When true, the declaration is rewritten with ReorderJoins (see join_planning.h)
+  /// before the plan is created: the inputs of hash joins are swapped so that the
+  /// hash table is built on the input estimated to be smaller, and chains of inner
+  /// joins are reordered to join the smallest relations first.  The output has the
+  /// same schema and rows but its rows may come in a different order.
+  bool reorder_joins = false;
+
+  /// \brief Priority of the tasks the plan submits to its executors
+  ///
+  /// The value is forwarded as ::arrow::internal::TaskHints::priority to both the
+  /// CPU executor and the IO executor.  The lower, the more urgent: when several
+  /// plans share a thread pool, a latency-sensitive plan can be given a lower value
+  /// so that its tasks are picked before those of batch-oriented plans.
+  int32_t task_priority = 0;
+
+  /// \brief Whether to allocate scratch memory from a per-query arena
+  ///
+  /// When true, the query owns an ArenaMemoryPool layered over the ExecContext's
+  /// memory pool.  Nodes allocate the short-lived buffers that never leave the plan
+  /// (temporary vector stacks, partitioning and selection buffers) from it, which
+  /// recycles memory across batches instead of going through the general purpose
+  /// allocator for each of them.  The arena is released when the plan is destroyed.
+  bool use_scratch_arena = false;
+
+  /// \brief A backend compiling the expressions of project and filter nodes
+  ///
+  /// If set, project and filter nodes compile their expressions with it when they
+  /// are created and evaluate the compiled form, falling back to the compute
+  /// kernels for the expressions it does not support.  See ExpressionCompiler.
+  std::shared_ptr<ExpressionCompiler> expression_compiler;
+
+  /// \brief Where to collect the runtime statistics of each node
+  ///
+  /// If set, every node of the plan is added to the profile when the plan starts,
+  /// and records the rows and batches flowing through it, the time spent processing
+  /// them, the time it was paused by backpressure and the memory it allocated.  Read
+  /// the profile with PlanProfile::ToTable once the plan has finished.
+  std::shared_ptr<PlanProfile> profile;
 };
 
 /// \brief Calculate the output schema of a declaration
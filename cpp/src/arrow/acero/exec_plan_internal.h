@@ -17,8 +17,14 @@
 
 #pragma once
 
+#include <vector>
+
 #include "arrow/acero/exec_plan.h"
 
+namespace arrow::acero {
+class HashJoinNodeOptions;
+}  // namespace arrow::acero
+
 namespace arrow::acero::internal {
 
 void RegisterSourceNode(ExecFactoryRegistry*);
@@ -31,7 +37,15 @@ void RegisterUnionNode(ExecFactoryRegistry*);
 void RegisterAggregateNode(ExecFactoryRegistry*);
 void RegisterSinkNode(ExecFactoryRegistry*);
 void RegisterHashJoinNode(ExecFactoryRegistry*);
+void RegisterMergeJoinNode(ExecFactoryRegistry*);
 void RegisterAsofJoinNode(ExecFactoryRegistry*);
 void RegisterSortedMergeNode(ExecFactoryRegistry*);
+void RegisterWindowNode(ExecFactoryRegistry*);
+void RegisterExchangeNode(ExecFactoryRegistry*);
+
+/// Make a merge join node if both inputs are ordered by the join keys and the merge join
+/// supports the join, returns nullptr otherwise
+Result<ExecNode*> MaybeMakeMergeJoinNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                         const HashJoinNodeOptions& join_options);
 
 }  // namespace arrow::acero::internal
@@ -21,10 +21,12 @@
 
 #include "arrow/acero/test_util_internal.h"
 #include "arrow/compute/cast.h"
+#include "arrow/compute/exec.h"
 #include "arrow/compute/expression.h"
 #include "arrow/dataset/partition.h"
 #include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/type.h"
 
 namespace arrow {
@@ -106,6 +108,39 @@ static void ExecuteScalarExpressionOverhead(benchmark::State& state, Expression
       static_cast<double>(state.iterations() * num_batches), benchmark::Counter::kIsRate);
 }
 
+auto chain_expression = greater(
+    call("add", {field_ref("a"), call("multiply", {field_ref("b"), field_ref("c")})}),
+    field_ref("d"));
+
+// Evaluate a + b * c > d either through ExecuteScalarExpression, which runs such
+// chains of kernels tile by tile on large batches, or kernel by kernel.
+static void ExecuteKernelChain(benchmark::State& state, bool use_expression) {
+  const int64_t rows_per_batch = state.range(0);
+
+  ExecContext ctx;
+  auto dataset_schema = schema({field("a", int64()), field("b", int64()),
+                                field("c", int64()), field("d", int64())});
+  random::RandomArrayGenerator rng(/*seed=*/42);
+  std::vector<Datum> values;
+  for (int i = 0; i < dataset_schema->num_fields(); ++i) {
+    values.emplace_back(rng.Int64(rows_per_batch, /*min=*/0, /*max=*/1000,
+                                  /*null_probability=*/0.01));
+  }
+  ExecBatch input(std::move(values), rows_per_batch);
+
+  ASSIGN_OR_ABORT(auto bound, chain_expression.Bind(*dataset_schema));
+  for (auto _ : state) {
+    if (use_expression) {
+      ABORT_NOT_OK(ExecuteScalarExpression(bound, input, &ctx).status());
+    } else {
+      ASSIGN_OR_ABORT(auto product, CallFunction("multiply", {input[1], input[2]}, &ctx));
+      ASSIGN_OR_ABORT(auto sum, CallFunction("add", {input[0], product}, &ctx));
+      ABORT_NOT_OK(CallFunction("greater", {sum, input[3]}, &ctx).status());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * rows_per_batch);
+}
+
 /// \brief Baseline benchmarks are implemented in pure C++ without arrow for performance
 /// comparison.
 template <typename BenchmarkType>
@@ -297,5 +332,13 @@ BENCHMARK_CAPTURE(ExecuteScalarExpressionOverhead, ref_only_expression,
     ->DenseThreadRange(1, std::thread::hardware_concurrency(),
                        std::thread::hardware_concurrency())
     ->UseRealTime();
+BENCHMARK_CAPTURE(ExecuteKernelChain, expression, /*use_expression=*/true)
+    ->ArgNames({"rows_per_batch"})
+    ->RangeMultiplier(10)
+    ->Range(10000, 10000000);
+BENCHMARK_CAPTURE(ExecuteKernelChain, kernel_by_kernel, /*use_expression=*/false)
+    ->ArgNames({"rows_per_batch"})
+    ->RangeMultiplier(10)
+    ->Range(10000, 10000000);
 }  // namespace acero
 }  // namespace arrow
@@ -0,0 +1,92 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "arrow/acero/visibility.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/expression.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace acero {
+
+/// \addtogroup acero-internals
+/// @{
+
+/// \brief The expressions of a project node, compiled by an ExpressionCompiler
+class ARROW_ACERO_EXPORT CompiledProjection {
+ public:
+  virtual ~CompiledProjection() = default;
+
+  /// \brief Evaluate the compiled expressions over a batch
+  ///
+  /// The batch has no selection vector. One value is returned per expression given
+  /// to ExpressionCompiler::CompileProjection; the values of the expressions which
+  /// were not compiled are left empty (Datum::NONE) and are evaluated by the node
+  /// with the compute kernels.
+  ///
+  /// This may be called concurrently.
+  virtual Result<std::vector<Datum>> Execute(const compute::ExecBatch& batch,
+                                             compute::ExecContext* ctx) const = 0;
+};
+
+/// \brief The predicate of a filter node, compiled by an ExpressionCompiler
+class ARROW_ACERO_EXPORT CompiledFilter {
+ public:
+  virtual ~CompiledFilter() = default;
+
+  /// \brief Select the rows of a batch for which the predicate is true
+  ///
+  /// The batch has no selection vector. This may be called concurrently.
+  virtual Result<std::shared_ptr<compute::SelectionVector>> Execute(
+      const compute::ExecBatch& batch, compute::ExecContext* ctx) const = 0;
+};
+
+/// \brief A backend compiling the expressions of project and filter nodes
+///
+/// When set in QueryOptions::expression_compiler, each project and filter node
+/// compiles its (bound) expressions once when it is created, and evaluates the
+/// compiled form instead of the compute kernels. Expressions the backend does not
+/// support are left to the compute kernels.
+class ARROW_ACERO_EXPORT ExpressionCompiler {
+ public:
+  virtual ~ExpressionCompiler() = default;
+
+  /// \brief Compile the expressions of a project node
+  ///
+  /// Returns nullptr if none of the expressions can be compiled.
+  virtual Result<std::unique_ptr<CompiledProjection>> CompileProjection(
+      const std::shared_ptr<Schema>& input_schema,
+      const std::vector<compute::Expression>& exprs) = 0;
+
+  /// \brief Compile the predicate of a filter node
+  ///
+  /// Returns nullptr if the predicate cannot be compiled.
+  virtual Result<std::unique_ptr<CompiledFilter>> CompileFilter(
+      const std::shared_ptr<Schema>& input_schema,
+      const compute::Expression& filter) = 0;
+};
+
+/// @}
+
+}  // namespace acero
+}  // namespace arrow
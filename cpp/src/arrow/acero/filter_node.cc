@@ -17,9 +17,11 @@
 
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/exec_plan_internal.h"
+#include "arrow/acero/expression_compiler.h"
 #include "arrow/acero/map_node.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/array/array_primitive.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/expression.h"
@@ -42,9 +44,11 @@ namespace {
 class FilterNode : public MapNode {
  public:
   FilterNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
-             std::shared_ptr<Schema> output_schema, Expression filter)
+             std::shared_ptr<Schema> output_schema, Expression filter,
+             std::unique_ptr<CompiledFilter> compiled_filter)
       : MapNode(plan, std::move(inputs), std::move(output_schema)),
-        filter_(std::move(filter)) {}
+        filter_(std::move(filter)),
+        compiled_filter_(std::move(compiled_filter)) {}
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
@@ -65,12 +69,21 @@ class FilterNode : public MapNode {
                                filter_expression.ToString(), " evaluates to ",
                                filter_expression.type()->ToString());
     }
+
+    std::unique_ptr<CompiledFilter> compiled_filter;
+    if (const auto& compiler = plan->query_context()->options().expression_compiler) {
+      ARROW_ASSIGN_OR_RAISE(compiled_filter,
+                            compiler->CompileFilter(schema, filter_expression));
+    }
     return plan->EmplaceNode<FilterNode>(plan, std::move(inputs), std::move(schema),
-                                         std::move(filter_expression));
+                                         std::move(filter_expression),
+                                         std::move(compiled_filter));
   }
 
   const char* kind_name() const override { return "FilterNode"; }
 
+  bool AcceptsSelectionVector() const override { return true; }
+
   Result<ExecBatch> ProcessBatch(ExecBatch batch) override {
     ARROW_ASSIGN_OR_RAISE(Expression simplified_filter,
                           SimplifyWithGuarantee(filter_, batch.guarantee));
@@ -81,15 +94,25 @@ class FilterNode : public MapNode {
                         {"filter.expression.simplified", simplified_filter.ToString()},
                         {"filter.length", batch.length}});
 
-    ARROW_ASSIGN_OR_RAISE(
-        Datum mask, ExecuteScalarExpression(simplified_filter, batch,
-                                            plan()->query_context()->exec_context()));
+    compute::ExecContext* ctx = plan()->query_context()->exec_context();
+    // The guarantee may have folded the filter into a literal, which is cheaper to
+    // handle below than the compiled filter
+    if (compiled_filter_ && !simplified_filter.literal()) {
+      ARROW_ASSIGN_OR_RAISE(batch, batch.ApplySelection(ctx));
+      ARROW_ASSIGN_OR_RAISE(auto selection, compiled_filter_->Execute(batch, ctx));
+      return EmitSelection(std::move(batch), std::move(selection), ctx);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(Datum mask,
+                          ExecuteScalarExpression(simplified_filter, batch, ctx));
 
     if (mask.is_scalar()) {
       const auto& mask_scalar = mask.scalar_as<BooleanScalar>();
       if (mask_scalar.is_valid && mask_scalar.value) {
-        return batch;
+        if (output_->AcceptsSelectionVector()) return batch;
+        return batch.ApplySelection(ctx);
       }
+      ARROW_ASSIGN_OR_RAISE(batch, batch.ApplySelection(ctx));
       return batch.Slice(0, 0);
     }
 
@@ -97,21 +120,51 @@ class FilterNode : public MapNode {
     DCHECK(!std::all_of(batch.values.begin(), batch.values.end(),
                         [](const Datum& value) { return value.is_scalar(); }));
 
-    auto values = batch.values;
-    for (auto& value : values) {
-      if (value.is_scalar()) continue;
-      ARROW_ASSIGN_OR_RAISE(value, Filter(value, mask, FilterOptions::Defaults()));
+    if (!mask.is_array() ||
+        (batch.selection_vector == nullptr && !output_->AcceptsSelectionVector())) {
+      ARROW_ASSIGN_OR_RAISE(batch, batch.ApplySelection(ctx));
+      auto values = batch.values;
+      for (auto& value : values) {
+        if (value.is_scalar()) continue;
+        ARROW_ASSIGN_OR_RAISE(value, Filter(value, mask, FilterOptions::Defaults()));
+      }
+      return ExecBatch::Make(std::move(values));
     }
-    return ExecBatch::Make(std::move(values));
+
+    ARROW_ASSIGN_OR_RAISE(auto selection, compute::SelectionVector::FromMask(
+                                              BooleanArray(mask.array()),
+                                              ctx->memory_pool()));
+    return EmitSelection(std::move(batch), std::move(selection), ctx);
   }
 
  protected:
+  // Defer the filter as a selection vector.  The selection is relative to the rows
+  // already selected, if any, so compose it with the existing selection.
+  Result<ExecBatch> EmitSelection(ExecBatch batch,
+                                  std::shared_ptr<compute::SelectionVector> selection,
+                                  compute::ExecContext* ctx) {
+    if (batch.selection_vector) {
+      ARROW_ASSIGN_OR_RAISE(
+          Datum composed,
+          Take(batch.selection_vector->data(), selection->data(),
+               compute::TakeOptions::NoBoundsCheck(), ctx));
+      selection = std::make_shared<compute::SelectionVector>(composed.array());
+    }
+    batch.length = selection->length();
+    batch.selection_vector = std::move(selection);
+    if (!output_->AcceptsSelectionVector()) {
+      return batch.ApplySelection(ctx);
+    }
+    return batch;
+  }
+
   std::string ToStringExtra(int indent = 0) const override {
     return "filter=" + filter_.ToString();
   }
 
  private:
   Expression filter_;
+  std::unique_ptr<CompiledFilter> compiled_filter_;
 };
 }  // namespace
 
@@ -59,10 +59,38 @@ using compute::Segment;
 namespace acero {
 namespace aggregate {
 
+namespace {
+
+// Whether the leading sort keys of `ordering` are exactly the grouping keys, in which
+// case the rows of each group are contiguous
+bool IsOrderedByKeys(const Ordering& ordering, const Schema& input_schema,
+                     const std::vector<int>& key_field_ids) {
+  const std::vector<compute::SortKey>& sort_keys = ordering.sort_keys();
+  if (key_field_ids.empty() || sort_keys.size() < key_field_ids.size()) {
+    return false;
+  }
+  std::unordered_set<int> remaining(key_field_ids.begin(), key_field_ids.end());
+  for (size_t i = 0; i < key_field_ids.size(); ++i) {
+    auto match = sort_keys[i].target.FindOne(input_schema);
+    if (!match.ok() || match->indices().size() != 1 ||
+        remaining.erase(match->indices()[0]) == 0) {
+      return false;
+    }
+  }
+  return remaining.empty();
+}
+
+}  // namespace
+
 Status GroupByNode::Init() {
   output_task_group_id_ = plan_->query_context()->RegisterTaskGroup(
       [this](size_t, int64_t task_id) { return OutputNthBatch(task_id); },
       [](size_t) { return Status::OK(); });
+  hash_partition_task_group_id_ = plan_->query_context()->RegisterTaskGroup(
+      [this](size_t, int64_t task_id) { return OutputHashPartition(task_id); },
+      [this](size_t) {
+        return output_->InputFinished(this, hash_partition_output_batches_.load());
+      });
   return Status::OK();
 }
 
@@ -194,11 +222,59 @@ Result<ExecNode*> GroupByNode::Make(ExecPlan* plan, std::vector<ExecNode*> input
       auto args, MakeAggregateNodeArgs(input_schema, keys, segment_keys, aggs, exec_ctx,
                                        is_cpu_parallel));
 
+  // If the input is sorted by the grouping keys then each group can be output as soon
+  // as the keys change instead of accumulating all groups until the end
+  std::unique_ptr<RowSegmenter> key_segmenter;
+  if (segment_keys.empty() &&
+      IsOrderedByKeys(input->ordering(), *input_schema, args.grouping_key_field_ids)) {
+    std::vector<TypeHolder> key_types;
+    bool nullable_keys = false;
+    for (int key_field_id : args.grouping_key_field_ids) {
+      const auto& key_field = input_schema->field(key_field_id);
+      key_types.emplace_back(key_field->type().get());
+      nullable_keys |= key_field->nullable();
+    }
+    ARROW_ASSIGN_OR_RAISE(key_segmenter,
+                          RowSegmenter::Make(key_types, nullable_keys, exec_ctx));
+  }
+
   return input->plan()->EmplaceNode<GroupByNode>(
       input, std::move(args.output_schema), std::move(args.grouping_key_field_ids),
       std::move(args.segment_key_field_ids), std::move(args.segmenter),
       std::move(args.kernel_intypes), std::move(args.target_fieldsets),
-      std::move(args.aggregates), std::move(args.kernels));
+      std::move(args.aggregates), std::move(args.kernels), std::move(key_segmenter));
+}
+
+Status GroupByNode::StartProducing() {
+  NoteStartProducing(ToStringExtra(0));
+
+  // Segmented and streaming aggregation already bound their state to one segment (or
+  // batch) at a time
+  QueryContext* query_context = plan_->query_context();
+  if (key_segmenter_) {
+    sequencer_ = util::SerialSequencingQueue::Make(this);
+  }
+  const int64_t spill_limit = query_context->options().spill_memory_limit;
+  if (spill_limit > 0 && segment_key_field_ids_.empty() && !key_segmenter_) {
+    ARROW_ASSIGN_OR_RAISE(spill_store_,
+                          util::SpillStore::Make(query_context->memory_pool()));
+    spill_queue_ = std::make_unique<util::SpillingAccumulationQueue>();
+    RETURN_NOT_OK(spill_queue_->Init(query_context, spill_store_.get(),
+                                     inputs_[0]->output_schema(), key_field_ids_,
+                                     kNumSpillPartitions, spill_limit));
+  }
+
+  // When running in parallel, partition the input by key hash so that the thread-local
+  // states can be merged and finalized one partition per task rather than all at once
+  // on a single thread.
+  const int capacity = query_context->executor()->GetCapacity();
+  if (capacity > 1 && !spill_queue_ && !key_segmenter_ &&
+      segment_key_field_ids_.empty() && !key_field_ids_.empty()) {
+    num_hash_partitions_ = static_cast<int>(std::min<int64_t>(
+        kMaxNumHashPartitions, bit_util::NextPower2(static_cast<int64_t>(capacity))));
+  }
+  local_states_.resize(query_context->max_concurrency() * num_hash_partitions_);
+  return Status::OK();
 }
 
 Status GroupByNode::ResetKernelStates() {
@@ -209,12 +285,32 @@ Status GroupByNode::ResetKernelStates() {
 
 Status GroupByNode::Consume(ExecSpan batch) {
   size_t thread_index = plan_->query_context()->GetThreadIndex();
-  if (thread_index >= local_states_.size()) {
+  const size_t num_threads = local_states_.size() / num_hash_partitions_;
+  if (thread_index >= num_threads) {
     return Status::IndexError("thread index ", thread_index, " is out of range [0, ",
-                              local_states_.size(), ")");
+                              num_threads, ")");
+  }
+
+  if (num_hash_partitions_ == 1) {
+    return ConsumeInto(&local_states_[thread_index], batch);
+  }
+  if (batch.length == 0) {
+    return Status::OK();
+  }
+  ARROW_ASSIGN_OR_RAISE(std::vector<ExecBatch> partitions,
+                        util::SpillingAccumulationQueue::PartitionBatch(
+                            batch.ToExecBatch(), key_field_ids_, num_hash_partitions_,
+                            plan_->query_context()));
+  ThreadLocalState* states = &local_states_[thread_index * num_hash_partitions_];
+  for (int i = 0; i < num_hash_partitions_; ++i) {
+    if (partitions[i].length > 0) {
+      RETURN_NOT_OK(ConsumeInto(&states[i], ExecSpan(partitions[i])));
+    }
   }
+  return Status::OK();
+}
 
-  auto state = &local_states_[thread_index];
+Status GroupByNode::ConsumeInto(ThreadLocalState* state, const ExecSpan& batch) {
   RETURN_NOT_OK(InitLocalStateIfNeeded(state));
 
   // Create a batch with key columns
@@ -252,13 +348,13 @@ Status GroupByNode::Consume(ExecSpan batch) {
   return Status::OK();
 }
 
-Status GroupByNode::Merge() {
+Status GroupByNode::Merge(const std::vector<ThreadLocalState*>& states) {
   arrow::util::tracing::Span span;
   START_COMPUTE_SPAN(span, "Merge",
                      {{"group_by", ToStringExtra(0)}, {"node.label", label()}});
-  ThreadLocalState* state0 = &local_states_[0];
-  for (size_t i = 1; i < local_states_.size(); ++i) {
-    ThreadLocalState* state = &local_states_[i];
+  ThreadLocalState* state0 = states[0];
+  for (size_t i = 1; i < states.size(); ++i) {
+    ThreadLocalState* state = states[i];
     if (!state->grouper) {
       continue;
     }
@@ -297,12 +393,11 @@ Status GroupByNode::Merge() {
   return Status::OK();
 }
 
-Result<ExecBatch> GroupByNode::Finalize() {
+Result<ExecBatch> GroupByNode::Finalize(ThreadLocalState* state) {
   arrow::util::tracing::Span span;
   START_COMPUTE_SPAN(span, "Finalize",
                      {{"group_by", ToStringExtra(0)}, {"node.label", label()}});
 
-  ThreadLocalState* state = &local_states_[0];
   // If we never got any batches, then state won't have been initialized
   RETURN_NOT_OK(InitLocalStateIfNeeded(state));
 
@@ -342,16 +437,25 @@ Status GroupByNode::OutputNthBatch(int64_t n) {
 }
 
 Status GroupByNode::OutputResult(bool is_last) {
-  // To simplify merging, ensure that the first grouper is nonempty
-  for (size_t i = 0; i < local_states_.size(); i++) {
-    if (local_states_[i].grouper) {
-      std::swap(local_states_[i], local_states_[0]);
-      break;
+  if (num_hash_partitions_ > 1) {
+    DCHECK(is_last);
+    return plan_->query_context()->StartTaskGroup(hash_partition_task_group_id_,
+                                                  num_hash_partitions_);
+  }
+
+  // To simplify merging, merge into the first nonempty state
+  std::vector<ThreadLocalState*> states;
+  for (auto& state : local_states_) {
+    if (state.grouper) {
+      states.push_back(&state);
     }
   }
+  if (states.empty()) {
+    states.push_back(&local_states_[0]);
+  }
 
-  RETURN_NOT_OK(Merge());
-  ARROW_ASSIGN_OR_RAISE(out_data_, Finalize());
+  RETURN_NOT_OK(Merge(states));
+  ARROW_ASSIGN_OR_RAISE(out_data_, Finalize(states[0]));
 
   int64_t num_output_batches = bit_util::CeilDiv(out_data_.length, output_batch_size());
   total_output_batches_ += static_cast<int>(num_output_batches);
@@ -368,11 +472,70 @@ Status GroupByNode::OutputResult(bool is_last) {
   return Status::OK();
 }
 
+Status GroupByNode::OutputHashPartition(int64_t partition) {
+  std::vector<ThreadLocalState*> states;
+  for (size_t i = static_cast<size_t>(partition); i < local_states_.size();
+       i += num_hash_partitions_) {
+    if (local_states_[i].grouper) {
+      states.push_back(&local_states_[i]);
+    }
+  }
+  if (states.empty()) {
+    return Status::OK();
+  }
+
+  RETURN_NOT_OK(Merge(states));
+  ARROW_ASSIGN_OR_RAISE(ExecBatch out_data, Finalize(states[0]));
+
+  int64_t batch_size = output_batch_size();
+  int64_t num_output_batches = bit_util::CeilDiv(out_data.length, batch_size);
+  hash_partition_output_batches_ += static_cast<int>(num_output_batches);
+  for (int64_t i = 0; i < num_output_batches; i++) {
+    ARROW_RETURN_NOT_OK(
+        output_->InputReceived(this, out_data.Slice(batch_size * i, batch_size)));
+  }
+  return Status::OK();
+}
+
+Status GroupByNode::OutputPartitionedResult() {
+  RETURN_NOT_OK(spill_queue_->Finish());
+  // Partitions have disjoint sets of keys so they can be aggregated (and the groupers
+  // and kernel states of previous partitions released) independently.
+  for (int i = 0; i < spill_queue_->num_partitions(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(util::AccumulationQueue batches,
+                          spill_queue_->TakePartition(i));
+    if (batches.row_count() == 0) {
+      continue;
+    }
+    for (size_t j = 0; j < batches.batch_count(); ++j) {
+      RETURN_NOT_OK(Consume(ExecSpan(batches[j])));
+    }
+    batches.Clear();
+    RETURN_NOT_OK(OutputResult(/*is_last=*/false));
+  }
+  spill_queue_.reset();
+  spill_store_.reset();
+  return output_->InputFinished(this, total_output_batches_);
+}
+
 Status GroupByNode::InputReceived(ExecNode* input, ExecBatch batch) {
   auto scope = TraceInputReceived(batch);
 
   DCHECK_EQ(input, inputs_[0]);
 
+  if (sequencer_) {
+    // Process counts the batch once it has been aggregated
+    return sequencer_->InsertBatch(std::move(batch));
+  }
+
+  if (spill_queue_) {
+    RETURN_NOT_OK(spill_queue_->InsertBatch(std::move(batch)));
+    if (input_counter_.Increment()) {
+      return OutputPartitionedResult();
+    }
+    return Status::OK();
+  }
+
   auto handler = [this](const ExecBatch& full_batch, const Segment& segment) {
     if (!segment.extends && segment.offset == 0)
       RETURN_NOT_OK(OutputResult(/*is_last=*/false));
@@ -393,11 +556,37 @@ Status GroupByNode::InputReceived(ExecNode* input, ExecBatch batch) {
   return Status::OK();
 }
 
+Status GroupByNode::Process(ExecBatch batch) {
+  ARROW_ASSIGN_OR_RAISE(ExecBatch key_batch, batch.SelectValues(key_field_ids_));
+  ARROW_ASSIGN_OR_RAISE(std::vector<Segment> segments,
+                        key_segmenter_->GetSegments(ExecSpan(key_batch)));
+  if (!segments.empty()) {
+    // Every group before the last one of this batch is complete, including the open
+    // group of the previous batch unless this batch continues it
+    const Segment& last = segments.back();
+    if (last.offset > 0) {
+      RETURN_NOT_OK(Consume(ExecSpan(batch.Slice(0, last.offset))));
+    }
+    if (segments.size() > 1 || !last.extends) {
+      RETURN_NOT_OK(OutputResult(/*is_last=*/false));
+    }
+    RETURN_NOT_OK(Consume(ExecSpan(batch.Slice(last.offset, last.length))));
+  }
+
+  if (input_counter_.Increment()) {
+    return OutputResult(/*is_last=*/true);
+  }
+  return Status::OK();
+}
+
 Status GroupByNode::InputFinished(ExecNode* input, int total_batches) {
   auto scope = TraceFinish();
   DCHECK_EQ(input, inputs_[0]);
 
   if (input_counter_.SetTotal(total_batches)) {
+    if (spill_queue_) {
+      return OutputPartitionedResult();
+    }
     RETURN_NOT_OK(OutputResult(/*is_last=*/true));
   }
   return Status::OK();
@@ -65,6 +65,7 @@ using internal::checked_cast;
 using internal::checked_pointer_cast;
 using internal::ToChars;
 
+using compute::ApproxCountDistinctOptions;
 using compute::ArgShape;
 using compute::CallFunction;
 using compute::CountOptions;
@@ -1316,6 +1317,116 @@ TEST_P(GroupBy, TDigest) {
       /*verbose=*/true);
 }
 
+TEST_P(GroupBy, TDigestSketch) {
+  auto table =
+      TableFromJSON(schema({field("argument", float64()), field("key", int64())}), {R"([
+    [1,    1],
+    [null, 1],
+    [0,    2],
+    [null, 3]
+])",
+                                                                                    R"([
+    [1,    4],
+    [4,    null],
+    [3,    1],
+    [0,    2]
+])",
+                                                                                    R"([
+    [-1,   2],
+    [1,    null],
+    [NaN,  3]
+])",
+                                                                                    R"([
+    [1,    4],
+    [1,    4],
+    [null, 4]
+  ])"});
+
+  auto quantiles = std::make_shared<TDigestOptions>(std::vector<double>{0.5, 0.9, 0.99});
+  auto keep_nulls =
+      std::make_shared<TDigestOptions>(/*q=*/0.5, /*delta=*/100, /*buffer_size=*/500,
+                                       /*skip_nulls=*/false, /*min_count=*/0);
+  auto min_count =
+      std::make_shared<TDigestOptions>(/*q=*/0.5, /*delta=*/100, /*buffer_size=*/500,
+                                       /*skip_nulls=*/true, /*min_count=*/3);
+  for (bool use_threads : {true, false}) {
+    SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+    ASSERT_OK_AND_ASSIGN(
+        Datum aggregated_and_grouped,
+        GroupByTest({table->GetColumnByName("argument"),
+                     table->GetColumnByName("argument"),
+                     table->GetColumnByName("argument")},
+                    {table->GetColumnByName("key")},
+                    {
+                        {"hash_tdigest", quantiles},
+                        {"hash_tdigest_sketch", nullptr},
+                        {"hash_tdigest_sketch", keep_nulls},
+                    },
+                    use_threads));
+    SortBy({"key_0"}, &aggregated_and_grouped);
+    ValidateOutput(aggregated_and_grouped);
+    const auto& result = aggregated_and_grouped.array_as<StructArray>();
+    ASSERT_EQ(result->field(2)->type_id(), Type::BINARY);
+    // Groups containing nulls don't have a sketch when nulls are not skipped
+    ASSERT_EQ(result->field(2)->null_count(), 0);
+    const std::vector<bool> expected_valid = {false, true, false, false, true};
+    for (int64_t i = 0; i < result->length(); ++i) {
+      EXPECT_EQ(result->field(3)->IsValid(i), expected_valid[i]) << i;
+    }
+
+    // Quantiles computed from the sketches are the ones of the raw values
+    ASSERT_OK_AND_ASSIGN(
+        Datum merged,
+        GroupByTest({result->field(2), result->field(2), result->field(3)},
+                    {result->field(0)},
+                    {
+                        {"hash_tdigest_merge", quantiles},
+                        {"hash_tdigest_merge", min_count},
+                        {"hash_tdigest_merge", keep_nulls},
+                    },
+                    use_threads));
+    SortBy({"key_0"}, &merged);
+    AssertDatumsApproxEqual(
+        ArrayFromJSON(struct_({
+                          field("key_0", int64()),
+                          field("hash_tdigest_merge", fixed_size_list(float64(), 3)),
+                          field("hash_tdigest_merge", fixed_size_list(float64(), 1)),
+                          field("hash_tdigest_merge", fixed_size_list(float64(), 1)),
+                      }),
+                      R"([
+    [1,    [1.0, 3.0, 3.0],    [null], [null]],
+    [2,    [0.0, 0.0, 0.0],    [0.0],  [0.0] ],
+    [3,    [null, null, null], [null], [null]],
+    [4,    [1.0, 1.0, 1.0],    [1.0],  [null]],
+    [null, [1.0, 4.0, 4.0],    [null], [1.0] ]
+  ])"),
+        merged,
+        /*verbose=*/true);
+    AssertDatumsApproxEqual(result->field(1), merged.array_as<StructArray>()->field(1),
+                            /*verbose=*/true);
+
+    // Sketches can be merged further, here all in one group
+    ASSERT_OK_AND_ASSIGN(merged,
+                         GroupByTest({result->field(2)},
+                                     {ArrayFromJSON(int64(), "[0, 0, 0, 0, 0]")},
+                                     {{"hash_tdigest_merge", quantiles}}, use_threads));
+    AssertDatumsApproxEqual(
+        ArrayFromJSON(struct_({
+                          field("key_0", int64()),
+                          field("hash_tdigest_merge", fixed_size_list(float64(), 3)),
+                      }),
+                      R"([[0, [1.0, 4.0, 4.0]]])"),
+        merged,
+        /*verbose=*/true);
+  }
+
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("Invalid tdigest"),
+      GroupByTest({ArrayFromJSON(binary(), R"(["not a tdigest"])")},
+                  {ArrayFromJSON(int64(), "[1]")}, {{"hash_tdigest_merge", nullptr}},
+                  /*use_threads=*/false));
+}
+
 TEST_P(GroupBy, TDigestDecimal) {
   auto batch = RecordBatchFromJSON(
       schema({field("argument0", decimal128(3, 2)), field("argument1", decimal256(3, 2)),
@@ -2388,6 +2499,79 @@ TEST_P(GroupBy, CountDistinct) {
   }
 }
 
+TEST_P(GroupBy, ApproxCountDistinct) {
+  auto low_precision = std::make_shared<ApproxCountDistinctOptions>(/*precision=*/8);
+  for (bool use_threads : {true, false}) {
+    SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+
+    auto table =
+        TableFromJSON(schema({field("argument", utf8()), field("key", int64())}), {R"([
+    ["foo", 1],
+    ["foo", 1]
+])",
+                                                                                   R"([
+    ["bar", 2],
+    [null,  3],
+    [null,  3]
+])",
+                                                                                   R"([
+    [null,  4],
+    ["baz", null]
+])",
+                                                                                   R"([
+    ["foo", 3],
+    ["",    2],
+    ["baz", 2],
+    ["bar", null],
+    ["foo", null]
+  ])"});
+
+    ASSERT_OK_AND_ASSIGN(
+        Datum aggregated_and_grouped,
+        AltGroupBy({table->GetColumnByName("argument"),
+                    table->GetColumnByName("argument"),
+                    table->GetColumnByName("argument")},
+                   {table->GetColumnByName("key")}, {},
+                   {
+                       {"hash_approx_count_distinct", nullptr, "agg_0",
+                        "hash_approx_count_distinct"},
+                       {"hash_approx_count_distinct", low_precision, "agg_1",
+                        "hash_approx_count_distinct"},
+                       {"hash_approx_count_distinct_sketch", nullptr, "agg_2",
+                        "hash_approx_count_distinct_sketch"},
+                   },
+                   use_threads));
+    SortBy({"key_0"}, &aggregated_and_grouped);
+    ValidateOutput(aggregated_and_grouped);
+
+    const auto& result = aggregated_and_grouped.array_as<StructArray>();
+    AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 2, 3, 4, null]"), *result->field(0),
+                      /*verbose=*/true);
+    AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 3, 1, 0, 3]"), *result->field(1),
+                      /*verbose=*/true);
+    AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 3, 1, 0, 3]"), *result->field(2),
+                      /*verbose=*/true);
+    ASSERT_EQ(result->field(3)->type_id(), Type::BINARY);
+
+    // Merging the per-group sketches again, this time all in one group
+    ASSERT_OK_AND_ASSIGN(
+        Datum merged,
+        AltGroupBy({result->field(3)}, {ArrayFromJSON(int64(), "[0, 0, 0, 0, 0]")}, {},
+                   {{"hash_approx_count_distinct_merge", nullptr, "agg_0",
+                     "hash_approx_count_distinct_merge"}},
+                   use_threads));
+    ValidateOutput(merged);
+    AssertDatumsEqual(ArrayFromJSON(struct_({
+                                        field("key_0", int64()),
+                                        field("hash_approx_count_distinct_merge",
+                                              int64()),
+                                    }),
+                                    R"([[0, 4]])"),
+                      merged,
+                      /*verbose=*/true);
+  }
+}
+
 TEST_P(GroupBy, Distinct) {
   auto all = std::make_shared<CountOptions>(CountOptions::ALL);
   auto only_valid = std::make_shared<CountOptions>(CountOptions::ONLY_VALID);
@@ -249,6 +249,18 @@ static void BM_HashJoinBasic_ProbeParallelism(benchmark::State& st) {
   HashJoinBasicBenchmarkImpl(st, settings);
 }
 
+// Scaling of the hash table build with the number of threads, for a build side much
+// larger than the probe side
+static void BM_HashJoinBasic_BuildScaling(benchmark::State& st) {
+  BenchmarkSettings settings;
+  settings.num_threads = static_cast<int>(st.range(0));
+  settings.num_build_batches = static_cast<int>(st.range(1));
+  settings.num_probe_batches = settings.num_threads;
+  settings.stats_probe_rows = false;
+
+  HashJoinBasicBenchmarkImpl(st, settings);
+}
+
 #ifdef ARROW_BUILD_DETAILED_BENCHMARKS  // Necessary to suppress warnings
 template <typename... Args>
 static void BM_HashJoinBasic_Selectivity(benchmark::State& st,
@@ -663,6 +675,12 @@ BENCHMARK(BM_HashJoinBasic_ProbeParallelism)
 
 #endif  // ARROW_BUILD_DETAILED_BENCHMARKS
 
+BENCHMARK(BM_HashJoinBasic_BuildScaling)
+    ->ArgNames({"Threads", "HashTable krows"})
+    ->ArgsProduct({benchmark::CreateRange(1, 128, 2), {1024, 16384}})
+    ->MeasureProcessCPUTime()
+    ->UseRealTime();
+
 void RowArrayDecodeBenchmark(benchmark::State& st, const std::shared_ptr<Schema>& schema,
                              int column_to_decode) {
   auto batches = MakeRandomBatches(schema, 1, std::numeric_limits<uint16_t>::max());
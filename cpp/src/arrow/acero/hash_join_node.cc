@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <mutex>
+#include <numeric>
 #include <unordered_set>
 #include <utility>
 
@@ -26,9 +27,16 @@
 #include "arrow/acero/hash_join_dict.h"
 #include "arrow/acero/hash_join_node.h"
 #include "arrow/acero/options.h"
+#include "arrow/acero/query_context.h"
+#include "arrow/acero/runtime_filter.h"
 #include "arrow/acero/schema_util.h"
+#include "arrow/acero/spilling_util.h"
+#include "arrow/acero/task_util.h"
 #include "arrow/acero/util.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/key_hash_internal.h"
+#include "arrow/compute/light_array_internal.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
 #include "arrow/util/logging_internal.h"
@@ -709,7 +717,7 @@ class HashJoinNode : public ExecNode, public TracedNode {
   HashJoinNode(ExecPlan* plan, NodeVector inputs, const HashJoinNodeOptions& join_options,
                std::shared_ptr<Schema> output_schema,
                std::unique_ptr<HashJoinSchema> schema_mgr, Expression filter,
-               std::unique_ptr<HashJoinImpl> impl)
+               std::unique_ptr<HashJoinImpl> impl, bool use_swiss_join)
       : ExecNode(plan, std::move(inputs), {"left", "right"},
                  /*output_schema=*/std::move(output_schema)),
         TracedNode(this),
@@ -718,6 +726,7 @@ class HashJoinNode : public ExecNode, public TracedNode {
         filter_(std::move(filter)),
         schema_mgr_(std::move(schema_mgr)),
         impl_(std::move(impl)),
+        use_swiss_join_(use_swiss_join),
         disable_bloom_filter_(join_options.disable_bloom_filter) {
     complete_.store(false);
   }
@@ -732,6 +741,13 @@ class HashJoinNode : public ExecNode, public TracedNode {
     const auto& join_options = checked_cast<const HashJoinNodeOptions&>(options);
     RETURN_NOT_OK(ValidateHashJoinNodeOptions(join_options));
 
+    // Inputs which are both ordered by the join keys are joined by merging them
+    ARROW_ASSIGN_OR_RAISE(ExecNode * merge_join,
+                          internal::MaybeMakeMergeJoinNode(plan, inputs, join_options));
+    if (merge_join != nullptr) {
+      return merge_join;
+    }
+
     const auto& left_schema = *(inputs[0]->output_schema());
     const auto& right_schema = *(inputs[1]->output_schema());
 
@@ -778,7 +794,7 @@ class HashJoinNode : public ExecNode, public TracedNode {
 
     return plan->EmplaceNode<HashJoinNode>(
         plan, inputs, join_options, std::move(output_schema), std::move(schema_mgr),
-        std::move(filter), std::move(impl));
+        std::move(filter), std::move(impl), use_swiss_join);
   }
 
   const char* kind_name() const override { return "HashJoinNode"; }
@@ -787,12 +803,24 @@ class HashJoinNode : public ExecNode, public TracedNode {
     if (batch.length == 0) {
       return Status::OK();
     }
+    if (build_spill_queue_) {
+      // The queue keeps its memory use under the spill limit
+      return build_spill_queue_->InsertBatch(std::move(batch));
+    }
+    // The build side stays in memory, as the hash table, until the join finishes
+    plan_->query_context()->AccountMemory(this, batch.TotalBufferSize());
     std::lock_guard<std::mutex> guard(build_side_mutex_);
     build_accumulator_.InsertBatch(std::move(batch));
     return Status::OK();
   }
 
   Status OnBuildSideFinished(size_t thread_index) {
+    if (build_spill_queue_) {
+      RETURN_NOT_OK(TakeResidentPartitions());
+    }
+    if (runtime_filter_target_) {
+      RETURN_NOT_OK(PublishRuntimeFilter());
+    }
     return pushdown_context_.BuildBloomFilter(
         thread_index, std::move(build_accumulator_),
         [this](size_t thread_index, AccumulationQueue batches) {
@@ -800,6 +828,275 @@ class HashJoinNode : public ExecNode, public TracedNode {
         });
   }
 
+  // Moves the build side partitions that stayed in memory to the build accumulator.
+  // If some partitions were spilled, the probe side rows of these are spilled too and
+  // joined once the in-memory partitions are done, see JoinSpilledPartitions.
+  Status TakeResidentPartitions() {
+    QueryContext* ctx = plan_->query_context();
+    RETURN_NOT_OK(build_spill_queue_->Finish());
+    spilled_partitions_.assign(kNumSpillPartitions, false);
+    bool any_spilled = false;
+    for (int i = 0; i < kNumSpillPartitions; ++i) {
+      if (build_spill_queue_->is_spilled(i)) {
+        spilled_partitions_[i] = true;
+        any_spilled = true;
+        continue;
+      }
+      ARROW_ASSIGN_OR_RAISE(AccumulationQueue batches,
+                            build_spill_queue_->TakePartition(i));
+      ctx->AccountMemory(this, batches.byte_count());
+      build_accumulator_.Concatenate(std::move(batches));
+    }
+    if (!any_spilled) {
+      return Status::OK();
+    }
+    probe_spill_queue_ = std::make_unique<util::SpillingAccumulationQueue>();
+    return probe_spill_queue_->Init(ctx, spill_store_.get(), inputs_[0]->output_schema(),
+                                    KeyInputIds(0), kNumSpillPartitions,
+                                    /*memory_limit=*/0);
+  }
+
+  // Probes the rows of `batch` whose build side partition is in memory and spills the
+  // other ones
+  Status ProbeBatch(size_t thread_index, ExecBatch batch) {
+    if (!probe_spill_queue_ || batch.length == 0) {
+      return impl_->ProbeSingleBatch(thread_index, std::move(batch));
+    }
+    QueryContext* ctx = plan_->query_context();
+    std::vector<uint16_t> partition_ids;
+    RETURN_NOT_OK(util::SpillingAccumulationQueue::PartitionIds(
+        batch, KeyInputIds(0), kNumSpillPartitions, ctx->hardware_flags(),
+        ctx->scratch_memory_pool(), &partition_ids));
+    ARROW_ASSIGN_OR_RAISE(
+        std::shared_ptr<Buffer> resident_rows,
+        AllocateBuffer(batch.length * sizeof(int64_t), ctx->memory_pool()));
+    ARROW_ASSIGN_OR_RAISE(
+        std::shared_ptr<Buffer> spilled_rows,
+        AllocateBuffer(batch.length * sizeof(int64_t), ctx->memory_pool()));
+    int64_t num_resident = 0;
+    int64_t num_spilled = 0;
+    for (int64_t i = 0; i < batch.length; ++i) {
+      if (spilled_partitions_[partition_ids[i]]) {
+        spilled_rows->mutable_data_as<int64_t>()[num_spilled++] = i;
+      } else {
+        resident_rows->mutable_data_as<int64_t>()[num_resident++] = i;
+      }
+    }
+
+    if (num_spilled == 0) {
+      return impl_->ProbeSingleBatch(thread_index, std::move(batch));
+    }
+    if (num_resident == 0) {
+      return probe_spill_queue_->InsertBatch(std::move(batch));
+    }
+    ARROW_ASSIGN_OR_RAISE(ExecBatch spilled, TakeRows(batch, spilled_rows, num_spilled));
+    RETURN_NOT_OK(probe_spill_queue_->InsertBatch(std::move(spilled)));
+    ARROW_ASSIGN_OR_RAISE(ExecBatch resident,
+                          TakeRows(batch, resident_rows, num_resident));
+    return impl_->ProbeSingleBatch(thread_index, std::move(resident));
+  }
+
+  // Takes the rows of `batch` whose indices are the first `length` int64 values of
+  // `row_ids`
+  Result<ExecBatch> TakeRows(const ExecBatch& batch,
+                             const std::shared_ptr<Buffer>& row_ids, int64_t length) {
+    auto indices = ArrayData::Make(int64(), length, {nullptr, row_ids});
+    std::vector<Datum> values(batch.values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+      if (batch[i].is_scalar()) {
+        values[i] = batch[i];
+      } else {
+        ARROW_ASSIGN_OR_RAISE(
+            values[i], compute::Take(batch[i], indices, compute::TakeOptions::NoBoundsCheck(),
+                                     plan_->query_context()->exec_context()));
+      }
+    }
+    return ExecBatch(std::move(values), length);
+  }
+
+  // Joins the spilled partitions, one at a time so that only one of them is in memory.
+  // Returns the number of output batches.
+  //
+  // Task groups can't be registered once the plan is running, so every partition is
+  // joined by a new join implementation whose tasks are run on the calling thread by a
+  // scheduler of its own.
+  Result<int64_t> JoinSpilledPartitions() {
+    QueryContext* ctx = plan_->query_context();
+    const size_t thread_index = ctx->GetThreadIndex();
+    RETURN_NOT_OK(probe_spill_queue_->Finish());
+    int64_t total_num_batches = 0;
+    for (int i = 0; i < kNumSpillPartitions && !complete_.load(); ++i) {
+      if (!spilled_partitions_[i]) {
+        continue;
+      }
+      std::unique_ptr<TaskScheduler> scheduler = TaskScheduler::Make();
+      ARROW_ASSIGN_OR_RAISE(std::unique_ptr<HashJoinImpl> impl,
+                            HashJoinImpl::MakeSwiss());
+      int64_t num_batches = 0;
+      RETURN_NOT_OK(impl->Init(
+          ctx, join_type_, num_threads_, &(schema_mgr_->proj_maps[0]),
+          &(schema_mgr_->proj_maps[1]), key_cmp_, filter_,
+          [&scheduler](std::function<Status(size_t, int64_t)> fn,
+                       std::function<Status(size_t)> on_finished) {
+            return scheduler->RegisterTaskGroup(std::move(fn), std::move(on_finished));
+          },
+          [&scheduler, ctx](int task_group_id, int64_t num_tasks) {
+            return scheduler->StartTaskGroup(ctx->GetThreadIndex(), task_group_id,
+                                             num_tasks);
+          },
+          [this](int64_t, ExecBatch batch) {
+            return this->OutputBatchCallback(std::move(batch));
+          },
+          [&num_batches](int64_t total_num_batches) {
+            num_batches = total_num_batches;
+            return Status::OK();
+          }));
+      scheduler->RegisterEnd();
+      RETURN_NOT_OK(scheduler->StartScheduling(
+          thread_index,
+          [ctx](std::function<Status(size_t)> fn) -> Status {
+            ctx->ScheduleTask(std::move(fn), "HashJoinNode::JoinSpilledPartition");
+            return Status::OK();
+          },
+          /*num_concurrent_tasks=*/1, /*use_sync_execution=*/true));
+
+      ARROW_ASSIGN_OR_RAISE(AccumulationQueue build,
+                            build_spill_queue_->TakePartition(i));
+      RETURN_NOT_OK(impl->BuildHashTable(thread_index, std::move(build),
+                                         [](size_t) { return Status::OK(); }));
+      ARROW_ASSIGN_OR_RAISE(AccumulationQueue probe,
+                            probe_spill_queue_->TakePartition(i));
+      for (size_t j = 0; j < probe.batch_count(); ++j) {
+        RETURN_NOT_OK(impl->ProbeSingleBatch(thread_index, std::move(probe[j])));
+      }
+      probe.Clear();
+      RETURN_NOT_OK(impl->ProbingFinished(thread_index));
+      total_num_batches += num_batches;
+    }
+    return total_num_batches;
+  }
+
+  // The indices of the key columns of a side in its input
+  std::vector<int> KeyInputIds(int side) const {
+    SchemaProjectionMap key_to_in = schema_mgr_->proj_maps[side].map(
+        HashJoinProjection::KEY, HashJoinProjection::INPUT);
+    std::vector<int> key_ids(key_to_in.num_cols);
+    for (int i = 0; i < key_to_in.num_cols; ++i) {
+      key_ids[i] = key_to_in.get(i);
+    }
+    return key_ids;
+  }
+
+  // Publishes the range of the build-side keys, and for small build sides the keys
+  // themselves, to the node producing the probe-side rows
+  Status PublishRuntimeFilter() {
+    QueryContext* ctx = plan_->query_context();
+    SchemaProjectionMap key_to_in =
+        schema_mgr_->proj_maps[1].map(HashJoinProjection::KEY, HashJoinProjection::INPUT);
+    const Schema& build_schema = *inputs_[1]->output_schema();
+    RuntimeFilter filter;
+    for (int i = 0; i < key_to_in.num_cols; ++i) {
+      const int input_idx = key_to_in.get(i);
+      ArrayVector chunks;
+      for (size_t ibatch = 0; ibatch < build_accumulator_.batch_count(); ++ibatch) {
+        const ExecBatch& batch = build_accumulator_[ibatch];
+        if (batch[input_idx].is_scalar()) {
+          ARROW_ASSIGN_OR_RAISE(auto chunk,
+                                MakeArrayFromScalar(*batch[input_idx].scalar(),
+                                                    batch.length, ctx->memory_pool()));
+          chunks.push_back(std::move(chunk));
+        } else {
+          chunks.push_back(batch[input_idx].make_array());
+        }
+      }
+      ARROW_ASSIGN_OR_RAISE(
+          auto keys,
+          ChunkedArray::Make(std::move(chunks), build_schema.field(input_idx)->type()));
+
+      RuntimeFilter::Key key;
+      key.column = runtime_filter_columns_[i];
+      Result<Datum> min_max = compute::MinMax(
+          keys, compute::ScalarAggregateOptions::Defaults(), ctx->exec_context());
+      if (min_max.ok()) {
+        const auto& min_max_scalar = min_max->scalar_as<StructScalar>();
+        key.min = min_max_scalar.value[0];
+        key.max = min_max_scalar.value[1];
+      } else if (!min_max.status().IsNotImplemented()) {
+        return min_max.status();
+      }
+      if (keys->length() <= kMaxRuntimeFilterSetInputRows) {
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> unique,
+                              compute::Unique(keys, ctx->exec_context()));
+        if (unique->length() <= kMaxRuntimeFilterSetSize) {
+          ARROW_ASSIGN_OR_RAISE(Datum non_null,
+                                compute::DropNull(unique, ctx->exec_context()));
+          key.value_set = non_null.make_array();
+        }
+      }
+      filter.keys.push_back(std::move(key));
+    }
+    return ctx->PublishRuntimeFilter(runtime_filter_target_, filter);
+  }
+
+  // Finds the node producing the probe-side rows and the indices of the probe-side keys
+  // in its output.  Like the Bloom filter pushdown this follows the probe side through
+  // other joins, and additionally through filter nodes.  Returns nullptr if probe-side
+  // rows without a match cannot be dropped.
+  std::pair<ExecNode*, std::vector<int>> FindRuntimeFilterTarget() const {
+    // These output probe-side rows without a match
+    if (join_type_ == JoinType::LEFT_ANTI || join_type_ == JoinType::LEFT_OUTER ||
+        join_type_ == JoinType::FULL_OUTER) {
+      return {nullptr, {}};
+    }
+    // Null keys can match with IS
+    for (JoinKeyCmp cmp : key_cmp_) {
+      if (cmp == JoinKeyCmp::IS) return {nullptr, {}};
+    }
+    SchemaProjectionMap probe_key_to_input =
+        schema_mgr_->proj_maps[0].map(HashJoinProjection::KEY, HashJoinProjection::INPUT);
+    std::vector<int> columns(probe_key_to_input.num_cols);
+    for (int i = 0; i < probe_key_to_input.num_cols; ++i) {
+      columns[i] = probe_key_to_input.get(i);
+      if (inputs_[0]->output_schema()->field(columns[i])->type()->id() ==
+          Type::DICTIONARY) {
+        return {nullptr, {}};
+      }
+    }
+
+    ExecNode* target = inputs_[0];
+    while (true) {
+      if (std::string_view(target->kind_name()) == "FilterNode") {
+        target = target->inputs()[0];
+        continue;
+      }
+      if (target->kind_name() != kind_name()) {
+        break;
+      }
+      auto* join = checked_cast<HashJoinNode*>(target);
+      // Dropping probe-side rows of these would change which of their build-side rows
+      // are output as unmatched
+      if (join->join_type_ == JoinType::RIGHT_OUTER ||
+          join->join_type_ == JoinType::FULL_OUTER) {
+        break;
+      }
+      SchemaProjectionMap output_to_input = join->schema_mgr_->proj_maps[0].map(
+          HashJoinProjection::OUTPUT, HashJoinProjection::INPUT);
+      // Probe-side columns come first in the output of a join
+      bool from_probe_side = true;
+      for (int column : columns) {
+        from_probe_side &= column < output_to_input.num_cols;
+      }
+      if (!from_probe_side) {
+        break;
+      }
+      for (int& column : columns) {
+        column = output_to_input.get(column);
+      }
+      target = join->inputs()[0];
+    }
+    return {target, std::move(columns)};
+  }
+
   Status OnBloomFilterFinished(size_t thread_index, AccumulationQueue batches) {
     RETURN_NOT_OK(pushdown_context_.PushBloomFilter(thread_index));
     return impl_->BuildHashTable(
@@ -824,7 +1121,7 @@ class HashJoinNode : public ExecNode, public TracedNode {
     {
       std::lock_guard<std::mutex> guard(probe_side_mutex_);
       if (!bloom_filters_ready_) {
-        probe_accumulator_.InsertBatch(std::move(batch));
+        QueueProbeBatch(std::move(batch));
         return Status::OK();
       }
     }
@@ -833,15 +1130,50 @@ class HashJoinNode : public ExecNode, public TracedNode {
     {
       std::lock_guard<std::mutex> guard(probe_side_mutex_);
       if (!hash_table_ready_) {
-        probe_accumulator_.InsertBatch(std::move(batch));
+        QueueProbeBatch(std::move(batch));
         return Status::OK();
       }
     }
-    RETURN_NOT_OK(impl_->ProbeSingleBatch(thread_index, std::move(batch)));
+    return ProbeOrCoalesce(thread_index, std::move(batch));
+  }
+
+  // Queues `batch` until the hash table is ready, must be called with
+  // probe_side_mutex_ held
+  void QueueProbeBatch(ExecBatch batch) {
+    const int64_t num_bytes = batch.TotalBufferSize();
+    queued_probe_bytes_ += num_bytes;
+    plan_->query_context()->AccountMemory(this, num_bytes);
+    probe_accumulator_.InsertBatch(std::move(batch));
+  }
+
+  // Probes `batch`, or buffers it if it is small (e.g. the output of a selective
+  // filter) until enough rows are buffered on this thread to amortize the per-batch
+  // cost of probing
+  Status ProbeOrCoalesce(size_t thread_index, ExecBatch batch) {
+    bool coalesce = coalesce_probe_batches_ && batch.length < kCoalesceProbeRows;
+    for (const Datum& value : batch.values) {
+      coalesce &= value.is_array();
+    }
+    if (!coalesce) {
+      return ProbeBatch(thread_index, std::move(batch));
+    }
+    compute::ExecBatchBuilder& pending = pending_probe_batches_[thread_index];
+    RETURN_NOT_OK(pending.AppendSelected(
+        plan_->query_context()->memory_pool(), batch, static_cast<int>(batch.length),
+        probe_row_ids_.data(), batch.num_values()));
+    if (pending.num_rows() >= kCoalesceProbeRows) {
+      return ProbeBatch(thread_index, pending.Flush());
+    }
     return Status::OK();
   }
 
   Status OnProbeSideFinished(size_t thread_index) {
+    // All probe side batches were received, probe the ones buffered by any thread
+    for (compute::ExecBatchBuilder& pending : pending_probe_batches_) {
+      if (pending.num_rows() > 0) {
+        RETURN_NOT_OK(ProbeBatch(thread_index, pending.Flush()));
+      }
+    }
     bool probing_finished;
     {
       std::lock_guard<std::mutex> guard(probe_side_mutex_);
@@ -892,6 +1224,8 @@ class HashJoinNode : public ExecNode, public TracedNode {
     bool probing_finished;
     {
       std::lock_guard<std::mutex> guard(probe_side_mutex_);
+      plan_->query_context()->AccountMemory(this, -queued_probe_bytes_);
+      queued_probe_bytes_ = 0;
       probing_finished = !queued_batches_probed_ && probe_side_finished_;
       queued_batches_probed_ = true;
     }
@@ -900,7 +1234,7 @@ class HashJoinNode : public ExecNode, public TracedNode {
   }
 
   Status InputReceived(ExecNode* input, ExecBatch batch) override {
-    auto scope = TraceInputReceived(batch);
+    auto scope = TraceInputReceived(input, batch);
     ARROW_DCHECK(std::find(inputs_.begin(), inputs_.end(), input) != inputs_.end());
     if (complete_.load()) {
       return Status::OK();
@@ -948,11 +1282,37 @@ class HashJoinNode : public ExecNode, public TracedNode {
           "which is incompatible with legacy batching");
     }
 
+    // With a spill limit, the inputs are hash-partitioned on the join keys and the
+    // partitions of the build side that don't fit in memory are joined one at a time
+    // after the others (a hybrid hash join).  Partitions must hash the keys of both
+    // sides in the same way, which the Swiss join guarantees by rejecting dictionaries.
+    // As the build side isn't in memory as a whole, it isn't summarized into runtime
+    // or Bloom filters then.
+    spill_memory_limit_ = use_swiss_join_ ? ctx->options().spill_memory_limit : 0;
+    if (spill_memory_limit_ > 0) {
+      disable_bloom_filter_ = true;
+    }
+
+    std::tie(runtime_filter_target_, runtime_filter_columns_) = FindRuntimeFilterTarget();
+    if (runtime_filter_target_ &&
+        (spill_memory_limit_ > 0 ||
+         !ctx->HasRuntimeFilterSubscribers(runtime_filter_target_))) {
+      runtime_filter_target_ = nullptr;
+    }
+
     bool use_sync_execution = ctx->executor()->GetCapacity() == 1;
     // TODO(ARROW-15732)
     // Each side of join might have an IO thread being called from. Once this is fixed
     // we will change it back to just the CPU's thread pool capacity.
     size_t num_threads = (GetCpuThreadPoolCapacity() + io::GetIOThreadPoolCapacity() + 1);
+    num_threads_ = num_threads;
+
+    coalesce_probe_batches_ = CanCoalesce(*inputs_[0]->output_schema());
+    if (coalesce_probe_batches_) {
+      pending_probe_batches_.resize(num_threads);
+      probe_row_ids_.resize(kCoalesceProbeRows);
+      std::iota(probe_row_ids_.begin(), probe_row_ids_.end(), 0);
+    }
 
     RETURN_NOT_OK(pushdown_context_.Init(
         this, num_threads,
@@ -983,8 +1343,7 @@ class HashJoinNode : public ExecNode, public TracedNode {
 
     task_group_probe_ = ctx->RegisterTaskGroup(
         [this](size_t thread_index, int64_t task_id) -> Status {
-          return impl_->ProbeSingleBatch(thread_index,
-                                         std::move(queued_batches_to_probe_[task_id]));
+          return ProbeBatch(thread_index, std::move(queued_batches_to_probe_[task_id]));
         },
         [this](size_t thread_index) -> Status {
           return OnQueuedBatchesProbed(thread_index);
@@ -995,6 +1354,14 @@ class HashJoinNode : public ExecNode, public TracedNode {
 
   Status StartProducing() override {
     NoteStartProducing(ToStringExtra());
+    if (spill_memory_limit_ > 0) {
+      QueryContext* ctx = plan_->query_context();
+      ARROW_ASSIGN_OR_RAISE(spill_store_, util::SpillStore::Make(ctx->memory_pool()));
+      build_spill_queue_ = std::make_unique<util::SpillingAccumulationQueue>();
+      RETURN_NOT_OK(build_spill_queue_->Init(ctx, spill_store_.get(),
+                                             inputs_[1]->output_schema(), KeyInputIds(1),
+                                             kNumSpillPartitions, spill_memory_limit_));
+    }
     RETURN_NOT_OK(
         pushdown_context_.StartProducing(plan_->query_context()->GetThreadIndex()));
     return Status::OK();
@@ -1022,13 +1389,33 @@ class HashJoinNode : public ExecNode, public TracedNode {
   }
 
  private:
+  // Whether ExecBatchBuilder can append batches of `schema`
+  static bool CanCoalesce(const Schema& schema) {
+    if (schema.num_fields() == 0) {
+      return false;
+    }
+    for (const auto& field : schema.fields()) {
+      const Type::type id = field->type()->id();
+      if (id == Type::DICTIONARY ||
+          !(is_fixed_width(id) || is_binary_like(id) || is_large_binary_like(id))) {
+        return false;
+      }
+    }
+    return true;
+  }
+
   Status OutputBatchCallback(ExecBatch batch) {
     return output_->InputReceived(this, std::move(batch));
   }
 
   Status FinishedCallback(int64_t total_num_batches) {
+    if (probe_spill_queue_) {
+      ARROW_ASSIGN_OR_RAISE(int64_t num_batches, JoinSpilledPartitions());
+      total_num_batches += num_batches;
+    }
     bool expected = false;
     if (complete_.compare_exchange_strong(expected, true)) {
+      plan_->query_context()->ReleaseMemory(this);
       return output_->InputFinished(this, static_cast<int>(total_num_batches));
     }
     return Status::OK();
@@ -1042,6 +1429,8 @@ class HashJoinNode : public ExecNode, public TracedNode {
   Expression filter_;
   std::unique_ptr<HashJoinSchema> schema_mgr_;
   std::unique_ptr<HashJoinImpl> impl_;
+  bool use_swiss_join_;
+  size_t num_threads_ = 0;
   util::AccumulationQueue build_accumulator_;
   util::AccumulationQueue probe_accumulator_;
   util::AccumulationQueue queued_batches_to_probe_;
@@ -1055,6 +1444,30 @@ class HashJoinNode : public ExecNode, public TracedNode {
   bool queued_batches_filtered_ = false;
   bool queued_batches_probed_ = false;
   bool probe_side_finished_ = false;
+  // Bytes of the probe side batches queued while the hash table was being built
+  int64_t queued_probe_bytes_ = 0;
+
+  // Probe side batches smaller than this are coalesced, see ProbeOrCoalesce
+  static constexpr int kCoalesceProbeRows = 4096;
+  bool coalesce_probe_batches_ = false;
+  std::vector<compute::ExecBatchBuilder> pending_probe_batches_;
+  std::vector<uint16_t> probe_row_ids_;
+
+  // The key set of a runtime filter is only computed for small build sides
+  static constexpr int64_t kMaxRuntimeFilterSetInputRows = 1 << 16;
+  static constexpr int64_t kMaxRuntimeFilterSetSize = 1 << 12;
+
+  ExecNode* runtime_filter_target_ = nullptr;
+  std::vector<int> runtime_filter_columns_;
+
+  // Set from QueryOptions::spill_memory_limit, see Init
+  static constexpr int kNumSpillPartitions = 64;
+  int64_t spill_memory_limit_ = 0;
+  std::unique_ptr<util::SpillStore> spill_store_;
+  std::unique_ptr<util::SpillingAccumulationQueue> build_spill_queue_;
+  // Only set if some build side partitions were spilled
+  std::unique_ptr<util::SpillingAccumulationQueue> probe_spill_queue_;
+  std::vector<bool> spilled_partitions_;
 
   friend struct BloomFilterPushdownContext;
   bool disable_bloom_filter_;
@@ -1100,7 +1513,7 @@ Status BloomFilterPushdownContext::Init(
   start_task_group_callback_ = std::move(start_task_group_callback);
   tld_.resize(num_threads);
   for (auto& local_data : tld_) {
-    RETURN_NOT_OK(local_data.stack.Init(ctx_->memory_pool(), kTempStackUsage));
+    RETURN_NOT_OK(local_data.stack.Init(ctx_->scratch_memory_pool(), kTempStackUsage));
   }
 
   return Status::OK();
@@ -22,10 +22,14 @@
 #include <random>
 #include <unordered_set>
 
+#include "arrow/acero/join_planning.h"
 #include "arrow/acero/options.h"
+#include "arrow/acero/query_context.h"
+#include "arrow/acero/runtime_filter.h"
 #include "arrow/acero/test_util_internal.h"
 #include "arrow/acero/util.h"
 #include "arrow/api.h"
+#include "arrow/compute/api_scalar.h"
 #include "arrow/compute/light_array_internal.h"
 #include "arrow/compute/row/row_encoder_internal.h"
 #include "arrow/compute/test_util_internal.h"
@@ -43,6 +47,7 @@ using testing::UnorderedElementsAreArray;
 namespace arrow {
 
 using arrow::gen::Constant;
+using arrow::internal::checked_cast;
 using arrow::random::kSeedMax;
 using arrow::random::RandomArrayGenerator;
 using compute::and_;
@@ -3583,5 +3588,271 @@ TEST(HashJoin, BuildSideLargeRowIds) {
   AssertRowCountEq(std::move(filter), num_match_rows * num_match_rows);
 }
 
+TEST(HashJoin, CoalescesSmallProbeBatches) {
+  RandomArrayGenerator rng(42);
+  // Many probe batches, made smaller still by a selective filter
+  BatchesWithSchema probe_input;
+  probe_input.schema = schema({field("key", int32()), field("str", utf8())});
+  for (int i = 0; i < 200; ++i) {
+    probe_input.batches.emplace_back(
+        std::vector<Datum>{rng.Int32(50, 0, 99), rng.String(50, 0, 5)}, 50);
+  }
+  BatchesWithSchema build_input;
+  build_input.schema = schema({field("bkey", int32()), field("bval", int64())});
+  for (int i = 0; i < 2; ++i) {
+    build_input.batches.emplace_back(
+        std::vector<Datum>{rng.Int32(100, 0, 99), rng.Int64(100, 0, 1000)}, 100);
+  }
+  HashJoinNodeOptions join_options(JoinType::INNER, {"key"}, {"bkey"});
+  Expression predicate = less(field_ref("key"), literal(10));
+
+  for (bool parallel : {false, true}) {
+    SCOPED_TRACE(parallel ? "parallel" : "serial");
+    auto source = [&](const BatchesWithSchema& input) {
+      return Declaration("source",
+                         SourceNodeOptions{input.schema, input.gen(parallel, false)});
+    };
+    Declaration filter_after_join = Declaration::Sequence(
+        {{"hashjoin", {source(probe_input), source(build_input)}, join_options},
+         {"filter", FilterNodeOptions{predicate}}});
+    ASSERT_OK_AND_ASSIGN(auto expected,
+                         DeclarationToTable(std::move(filter_after_join), parallel));
+    Declaration filtered_probe = Declaration::Sequence(
+        {source(probe_input), {"filter", FilterNodeOptions{predicate}}});
+    Declaration join_after_filter{
+        "hashjoin", {std::move(filtered_probe), source(build_input)}, join_options};
+    ASSERT_OK_AND_ASSIGN(auto actual,
+                         DeclarationToTable(std::move(join_after_filter), parallel));
+    ASSERT_GT(actual->num_rows(), 0);
+    AssertTablesEqualIgnoringOrder(expected, actual);
+  }
+}
+
+TEST(HashJoin, PublishesRuntimeFilter) {
+  BatchesWithSchema probe_input;
+  probe_input.schema = schema({field("payload", utf8()), field("id", int32())});
+  probe_input.batches = {
+      ExecBatchFromJSON({utf8(), int32()}, R"([["a", 1], ["b", 5], ["c", 9]])")};
+  BatchesWithSchema build_input;
+  build_input.schema = schema({field("key", int32())});
+  build_input.batches = {ExecBatchFromJSON({int32()}, R"([[3], [7]])"),
+                         ExecBatchFromJSON({int32()}, R"([[null], [5], [7]])")};
+
+  auto run = [&](JoinType join_type, JoinKeyCmp key_cmp,
+                 std::vector<RuntimeFilter>* filters) {
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<ExecPlan> plan, ExecPlan::Make());
+    ASSERT_OK_AND_ASSIGN(
+        ExecNode * probe,
+        MakeExecNode("source", plan.get(), {},
+                     SourceNodeOptions{probe_input.schema,
+                                       probe_input.gen(false, false)}));
+    plan->query_context()->SubscribeRuntimeFilters(
+        probe, [filters](const RuntimeFilter& filter) {
+          filters->push_back(filter);
+          return Status::OK();
+        });
+    // Filters are forwarded through filter nodes
+    ASSERT_OK_AND_ASSIGN(ExecNode * filter,
+                         MakeExecNode("filter", plan.get(), {probe},
+                                      FilterNodeOptions{literal(true)}));
+    ASSERT_OK_AND_ASSIGN(
+        ExecNode * build,
+        MakeExecNode("source", plan.get(), {},
+                     SourceNodeOptions{build_input.schema,
+                                       build_input.gen(false, false)}));
+    HashJoinNodeOptions join_options(join_type, {"id"}, {"key"}, literal(true));
+    join_options.key_cmp = {key_cmp};
+    ASSERT_OK_AND_ASSIGN(ExecNode * join, MakeExecNode("hashjoin", plan.get(),
+                                                       {filter, build}, join_options));
+    AsyncGenerator<std::optional<ExecBatch>> sink_gen;
+    ASSERT_OK(
+        MakeExecNode("sink", plan.get(), {join}, SinkNodeOptions{&sink_gen}).status());
+    ASSERT_FINISHES_OK(StartAndCollect(plan.get(), sink_gen));
+  };
+
+  for (JoinType join_type :
+       {JoinType::INNER, JoinType::LEFT_SEMI, JoinType::RIGHT_SEMI, JoinType::RIGHT_ANTI,
+        JoinType::RIGHT_OUTER}) {
+    ARROW_SCOPED_TRACE("join type ", ToString(join_type));
+    std::vector<RuntimeFilter> filters;
+    run(join_type, JoinKeyCmp::EQ, &filters);
+    ASSERT_EQ(filters.size(), 1);
+    ASSERT_EQ(filters[0].keys.size(), 1);
+    const RuntimeFilter::Key& key = filters[0].keys[0];
+    ASSERT_EQ(key.column, 1);
+    AssertScalarsEqual(*MakeScalar(int32_t{3}), *key.min);
+    AssertScalarsEqual(*MakeScalar(int32_t{7}), *key.max);
+    AssertArraysEqual(*ArrayFromJSON(int32(), "[3, 7, 5]"), *key.value_set);
+    Expression expected = and_(
+        {greater_equal(field_ref("id"), literal(3)),
+         less_equal(field_ref("id"), literal(7)),
+         call("is_in", {field_ref("id")}, compute::SetLookupOptions(key.value_set))});
+    ASSERT_EQ(filters[0].ToExpression(*probe_input.schema), expected);
+  }
+
+  // Probe-side rows without a match are output
+  for (JoinType join_type :
+       {JoinType::LEFT_OUTER, JoinType::LEFT_ANTI, JoinType::FULL_OUTER}) {
+    ARROW_SCOPED_TRACE("join type ", ToString(join_type));
+    std::vector<RuntimeFilter> filters;
+    run(join_type, JoinKeyCmp::EQ, &filters);
+    ASSERT_TRUE(filters.empty());
+  }
+  // Null keys match
+  std::vector<RuntimeFilter> filters;
+  run(JoinType::INNER, JoinKeyCmp::IS, &filters);
+  ASSERT_TRUE(filters.empty());
+}
+
+
+TEST(HashJoin, EstimateRowCount) {
+  RandomArrayGenerator rng(42);
+  auto table = Table::Make(schema({field("x", int32())}), {rng.Int32(100, 0, 9)});
+  Declaration source{"table_source", TableSourceNodeOptions(table)};
+  ASSERT_EQ(EstimateRowCount(source), 100);
+  ASSERT_EQ(EstimateRowCount(Declaration::Sequence(
+                {source, {"filter", FilterNodeOptions{literal(false)}}})),
+            50);
+  ASSERT_EQ(EstimateRowCount(Declaration::Sequence(
+                {source, {"fetch", FetchNodeOptions(90, 20)}})),
+            10);
+  ASSERT_EQ(EstimateRowCount(Declaration::Sequence(
+                {source,
+                 {"aggregate", AggregateNodeOptions{{{"count_all", "count"}}}}})),
+            1);
+  ASSERT_EQ(EstimateRowCount(Declaration{"union", {source, source}, ExecNodeOptions{}}),
+            200);
+  BatchesWithSchema batches;
+  batches.schema = table->schema();
+  ASSERT_EQ(EstimateRowCount(Declaration{
+                "source", SourceNodeOptions{batches.schema, batches.gen(false, false)}}),
+            std::nullopt);
+}
+
+TEST(HashJoin, ReorderJoinsSwapsBuildSide) {
+  RandomArrayGenerator rng(42);
+  auto small = Table::Make(schema({field("s_key", int32()), field("s_val", utf8())}),
+                           {rng.Int32(10, 0, 19), rng.String(10, 0, 5)});
+  auto large = Table::Make(schema({field("l_key", int32()), field("l_val", int64())}),
+                           {rng.Int32(500, 0, 19, /*null_probability=*/0.1),
+                            rng.Int64(500, 0, 9)});
+
+  for (JoinType join_type :
+       {JoinType::INNER, JoinType::LEFT_OUTER, JoinType::RIGHT_OUTER,
+        JoinType::FULL_OUTER, JoinType::LEFT_SEMI, JoinType::RIGHT_SEMI,
+        JoinType::LEFT_ANTI, JoinType::RIGHT_ANTI}) {
+    ARROW_SCOPED_TRACE("join type ", ToString(join_type));
+    Declaration join{"hashjoin",
+                     {Declaration{"table_source", TableSourceNodeOptions(small)},
+                      Declaration{"table_source", TableSourceNodeOptions(large)}},
+                     HashJoinNodeOptions(join_type, {"s_key"}, {"l_key"})};
+    ASSERT_OK_AND_ASSIGN(Declaration reordered, ReorderJoins(join));
+    // The hash table is now built on the small input
+    const Declaration* swapped = &reordered;
+    if (reordered.factory_name == "project") {
+      swapped = &std::get<Declaration>(reordered.inputs[0]);
+    }
+    ASSERT_EQ(swapped->factory_name, "hashjoin");
+    const auto& build = std::get<Declaration>(swapped->inputs[1]);
+    ASSERT_EQ(
+        checked_cast<const TableSourceNodeOptions&>(*build.options).table.get(),
+        small.get());
+
+    ASSERT_OK_AND_ASSIGN(auto expected, DeclarationToTable(join));
+    QueryOptions query_options;
+    query_options.reorder_joins = true;
+    ASSERT_OK_AND_ASSIGN(auto actual, DeclarationToTable(join, query_options));
+    AssertSchemaEqual(expected->schema(), actual->schema());
+    AssertTablesEqualIgnoringOrder(expected, actual);
+  }
+
+  // Joins with a residual filter are left as they are
+  Declaration filtered{"hashjoin",
+                       {Declaration{"table_source", TableSourceNodeOptions(small)},
+                        Declaration{"table_source", TableSourceNodeOptions(large)}},
+                       HashJoinNodeOptions(JoinType::INNER, {"s_key"}, {"l_key"},
+                                           greater(field_ref("l_val"), literal(3)))};
+  ASSERT_OK_AND_ASSIGN(Declaration reordered, ReorderJoins(filtered));
+  ASSERT_EQ(reordered.factory_name, "hashjoin");
+  const auto& probe = std::get<Declaration>(reordered.inputs[0]);
+  ASSERT_EQ(checked_cast<const TableSourceNodeOptions&>(*probe.options).table.get(),
+            small.get());
+}
+
+TEST(HashJoin, SpillingMatchesInMemory) {
+  RandomArrayGenerator rng(42);
+  auto left = Table::Make(schema({field("l_key", int32()), field("l_val", int64())}),
+                          {rng.Int32(2000, 0, 299, /*null_probability=*/0.1),
+                           rng.Int64(2000, 0, 9)});
+  auto right = Table::Make(schema({field("r_key", int32()), field("r_val", utf8())}),
+                           {rng.Int32(1000, 0, 399, /*null_probability=*/0.1),
+                            rng.String(1000, 0, 5)});
+  auto make_join = [&](JoinType join_type, Expression filter) {
+    return Declaration{"hashjoin",
+                       {Declaration{"table_source", TableSourceNodeOptions(left, 64)},
+                        Declaration{"table_source", TableSourceNodeOptions(right, 64)}},
+                       HashJoinNodeOptions(join_type, {"l_key"}, {"r_key"},
+                                           std::move(filter))};
+  };
+
+  for (Expression filter : {literal(true), greater(field_ref("l_val"), literal(3))}) {
+    for (JoinType join_type :
+         {JoinType::INNER, JoinType::LEFT_OUTER, JoinType::RIGHT_OUTER,
+          JoinType::FULL_OUTER, JoinType::LEFT_SEMI, JoinType::RIGHT_SEMI,
+          JoinType::LEFT_ANTI, JoinType::RIGHT_ANTI}) {
+      ARROW_SCOPED_TRACE("join type ", ToString(join_type), " filter ",
+                         filter.ToString());
+      Declaration join = make_join(join_type, filter);
+      ASSERT_OK_AND_ASSIGN(auto expected, DeclarationToTable(join));
+      // Spill every partition of the build side, then only some of them
+      for (int64_t spill_memory_limit : {1, 4096}) {
+        ARROW_SCOPED_TRACE("spill_memory_limit ", spill_memory_limit);
+        QueryOptions query_options;
+        query_options.spill_memory_limit = spill_memory_limit;
+        ASSERT_OK_AND_ASSIGN(auto actual, DeclarationToTable(join, query_options));
+        AssertSchemaEqual(expected->schema(), actual->schema());
+        AssertTablesEqualIgnoringOrder(expected, actual);
+      }
+    }
+  }
+}
+
+TEST(HashJoin, ReorderJoinsChain) {
+  RandomArrayGenerator rng(42);
+  auto facts = Table::Make(schema({field("f_key1", int32()), field("f_key2", int32()),
+                                   field("f_val", int64())}),
+                           {rng.Int32(1000, 0, 99), rng.Int32(1000, 0, 9),
+                            rng.Int64(1000, 0, 100)});
+  auto dim1 = Table::Make(schema({field("d1_key", int32()), field("d1_val", utf8())}),
+                          {rng.Int32(100, 0, 99), rng.String(100, 0, 5)});
+  auto dim2 = Table::Make(schema({field("d2_key", int32()), field("d2_val", int64())}),
+                          {rng.Int32(5, 0, 9), rng.Int64(5, 0, 100)});
+  auto source = [](const std::shared_ptr<Table>& table) {
+    return Declaration{"table_source", TableSourceNodeOptions(table)};
+  };
+  Declaration chain{"hashjoin",
+                    {Declaration{"hashjoin",
+                                 {source(facts), source(dim1)},
+                                 HashJoinNodeOptions({"f_key1"}, {"d1_key"})},
+                     source(dim2)},
+                    HashJoinNodeOptions({"f_key2"}, {"d2_key"})};
+  ASSERT_OK_AND_ASSIGN(Declaration reordered, ReorderJoins(chain));
+  // dim2 is joined first, and the original order of the columns is restored
+  ASSERT_EQ(reordered.factory_name, "project");
+  const auto& last_join = std::get<Declaration>(reordered.inputs[0]);
+  ASSERT_EQ(last_join.factory_name, "hashjoin");
+  const auto& last_build = std::get<Declaration>(last_join.inputs[1]);
+  ASSERT_EQ(
+      checked_cast<const TableSourceNodeOptions&>(*last_build.options).table.get(),
+      dim1.get());
+
+  ASSERT_OK_AND_ASSIGN(auto expected, DeclarationToTable(chain));
+  QueryOptions query_options;
+  query_options.reorder_joins = true;
+  ASSERT_OK_AND_ASSIGN(auto actual, DeclarationToTable(chain, query_options));
+  AssertSchemaEqual(expected->schema(), actual->schema());
+  AssertTablesEqualIgnoringOrder(expected, actual);
+}
+
 }  // namespace acero
 }  // namespace arrow
@@ -0,0 +1,426 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/acero/join_planning.h"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <variant>
+
+#include "arrow/acero/options.h"
+#include "arrow/array/array_base.h"
+#include "arrow/array/statistics.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/expression.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+
+namespace arrow {
+
+using compute::field_ref;
+
+namespace acero {
+
+namespace {
+
+// Fraction of the rows assumed to pass a filter
+constexpr double kFilterSelectivity = 0.5;
+
+struct RowCountEstimators {
+  std::mutex mutex;
+  std::unordered_map<std::string, RowCountEstimator> estimators;
+};
+
+RowCountEstimators* GetRowCountEstimators() {
+  static RowCountEstimators estimators;
+  return &estimators;
+}
+
+template <typename OptionsType>
+const OptionsType* GetOptions(const Declaration& declaration) {
+  return dynamic_cast<const OptionsType*>(declaration.options.get());
+}
+
+const Declaration* GetInput(const Declaration& declaration, size_t i) {
+  return std::get_if<Declaration>(&declaration.inputs[i]);
+}
+
+// The number of distinct values of a column of a table source, if its statistics tell
+std::optional<int64_t> DistinctCount(const Declaration& declaration,
+                                     const FieldRef& ref) {
+  const auto* options = GetOptions<TableSourceNodeOptions>(declaration);
+  if (declaration.factory_name != "table_source" || options == nullptr ||
+      options->table == nullptr) {
+    return std::nullopt;
+  }
+  auto maybe_path = ref.FindOne(*options->table->schema());
+  if (!maybe_path.ok() || maybe_path->indices().size() != 1) {
+    return std::nullopt;
+  }
+  const auto& column = options->table->column(maybe_path->indices()[0]);
+  if (column->num_chunks() != 1) {
+    return std::nullopt;
+  }
+  const auto& statistics = column->chunk(0)->statistics();
+  if (statistics == nullptr || !statistics->distinct_count.has_value()) {
+    return std::nullopt;
+  }
+  const auto count = std::visit([](auto count) { return static_cast<int64_t>(count); },
+                                *statistics->distinct_count);
+  return count > 0 ? std::optional<int64_t>(count) : std::nullopt;
+}
+
+std::optional<int64_t> EstimateHashJoin(
+    const Declaration& declaration, const std::vector<std::optional<int64_t>>& inputs) {
+  const auto* options = GetOptions<HashJoinNodeOptions>(declaration);
+  if (options == nullptr || inputs.size() != 2 || !inputs[0] || !inputs[1]) {
+    return std::nullopt;
+  }
+  const int64_t left = *inputs[0];
+  const int64_t right = *inputs[1];
+  switch (options->join_type) {
+    case JoinType::LEFT_SEMI:
+    case JoinType::LEFT_ANTI:
+      return left;
+    case JoinType::RIGHT_SEMI:
+    case JoinType::RIGHT_ANTI:
+      return right;
+    case JoinType::INNER:
+      break;
+    default:
+      return std::max(left, right);
+  }
+  if (options->left_keys.size() == 1 && options->right_keys.size() == 1 &&
+      GetInput(declaration, 0) != nullptr && GetInput(declaration, 1) != nullptr) {
+    auto left_distinct = DistinctCount(*GetInput(declaration, 0), options->left_keys[0]);
+    auto right_distinct =
+        DistinctCount(*GetInput(declaration, 1), options->right_keys[0]);
+    if (left_distinct && right_distinct) {
+      return static_cast<int64_t>(static_cast<double>(left) * static_cast<double>(right) /
+                                  std::max(*left_distinct, *right_distinct));
+    }
+  }
+  // Without statistics, assume that every row of the larger input matches one row of
+  // the smaller one (a join on a foreign key)
+  return std::max(left, right);
+}
+
+std::optional<int64_t> EstimateBuiltin(
+    const Declaration& declaration, const std::vector<std::optional<int64_t>>& inputs) {
+  const std::string& name = declaration.factory_name;
+  if (name == "table_source") {
+    const auto* options = GetOptions<TableSourceNodeOptions>(declaration);
+    if (options == nullptr || options->table == nullptr) {
+      return std::nullopt;
+    }
+    return options->table->num_rows();
+  }
+  if (name == "union") {
+    int64_t total = 0;
+    for (const auto& input : inputs) {
+      if (!input) {
+        return std::nullopt;
+      }
+      total += *input;
+    }
+    return total;
+  }
+  if (name == "hashjoin") {
+    return EstimateHashJoin(declaration, inputs);
+  }
+  if (inputs.size() != 1 || !inputs[0]) {
+    return std::nullopt;
+  }
+  const int64_t input = *inputs[0];
+  if (name == "project" || name == OrderByNodeOptions::kName) {
+    return input;
+  }
+  if (name == "filter") {
+    const auto* options = GetOptions<FilterNodeOptions>(declaration);
+    if (options != nullptr && options->filter_expression.Equals(literal(true))) {
+      return input;
+    }
+    return static_cast<int64_t>(static_cast<double>(input) * kFilterSelectivity);
+  }
+  if (name == FetchNodeOptions::kName) {
+    const auto* options = GetOptions<FetchNodeOptions>(declaration);
+    if (options == nullptr) {
+      return std::nullopt;
+    }
+    return std::min(std::max<int64_t>(input - options->offset, 0), options->count);
+  }
+  if (name == "aggregate") {
+    const auto* options = GetOptions<AggregateNodeOptions>(declaration);
+    if (options == nullptr) {
+      return std::nullopt;
+    }
+    return options->keys.empty() && options->segment_keys.empty() ? 1 : input;
+  }
+  return std::nullopt;
+}
+
+JoinType MirroredJoinType(JoinType join_type) {
+  switch (join_type) {
+    case JoinType::LEFT_SEMI:
+      return JoinType::RIGHT_SEMI;
+    case JoinType::RIGHT_SEMI:
+      return JoinType::LEFT_SEMI;
+    case JoinType::LEFT_ANTI:
+      return JoinType::RIGHT_ANTI;
+    case JoinType::RIGHT_ANTI:
+      return JoinType::LEFT_ANTI;
+    case JoinType::LEFT_OUTER:
+      return JoinType::RIGHT_OUTER;
+    case JoinType::RIGHT_OUTER:
+      return JoinType::LEFT_OUTER;
+    default:
+      return join_type;
+  }
+}
+
+bool OutputsBothInputs(JoinType join_type) {
+  return join_type == JoinType::INNER || join_type == JoinType::LEFT_OUTER ||
+         join_type == JoinType::RIGHT_OUTER || join_type == JoinType::FULL_OUTER;
+}
+
+std::shared_ptr<Schema> SchemaOrNull(const Declaration& declaration,
+                                     FunctionRegistry* function_registry) {
+  auto maybe_schema = DeclarationToSchema(declaration, function_registry);
+  return maybe_schema.ok() ? *std::move(maybe_schema) : nullptr;
+}
+
+// The hash join node builds its hash table on the right input, so swap the inputs if
+// the left one is estimated to be smaller
+Declaration MaybeSwapInputs(Declaration join, FunctionRegistry* function_registry) {
+  const auto* options = GetOptions<HashJoinNodeOptions>(join);
+  if (join.factory_name != "hashjoin" || options == nullptr || join.inputs.size() != 2 ||
+      GetInput(join, 0) == nullptr || GetInput(join, 1) == nullptr ||
+      !options->filter.Equals(literal(true))) {
+    return join;
+  }
+  const Declaration& left = *GetInput(join, 0);
+  const Declaration& right = *GetInput(join, 1);
+  const auto left_rows = EstimateRowCount(left);
+  const auto right_rows = EstimateRowCount(right);
+  if (!left_rows || !right_rows || *left_rows >= *right_rows) {
+    return join;
+  }
+
+  HashJoinNodeOptions swapped_options = *options;
+  swapped_options.join_type = MirroredJoinType(options->join_type);
+  std::swap(swapped_options.left_keys, swapped_options.right_keys);
+  std::swap(swapped_options.left_output, swapped_options.right_output);
+  std::swap(swapped_options.output_suffix_for_left,
+            swapped_options.output_suffix_for_right);
+  Declaration swapped(join.factory_name, {right, left}, std::move(swapped_options),
+                      join.label);
+  if (!OutputsBothInputs(options->join_type)) {
+    return swapped;
+  }
+
+  // The swapped join outputs the columns of the right input first, move them back
+  std::shared_ptr<Schema> join_schema = SchemaOrNull(join, function_registry);
+  std::shared_ptr<Schema> left_schema = SchemaOrNull(left, function_registry);
+  if (join_schema == nullptr || left_schema == nullptr) {
+    return join;
+  }
+  const int num_fields = join_schema->num_fields();
+  const int num_left = options->output_all
+                           ? left_schema->num_fields()
+                           : static_cast<int>(options->left_output.size());
+  std::vector<Expression> exprs;
+  std::vector<std::string> names;
+  for (int i = 0; i < num_fields; ++i) {
+    const int swapped_index = i < num_left ? num_fields - num_left + i : i - num_left;
+    exprs.push_back(field_ref(FieldPath({swapped_index})));
+    names.push_back(join_schema->field(i)->name());
+  }
+  return Declaration("project", {std::move(swapped)},
+                     ProjectNodeOptions(std::move(exprs), std::move(names)));
+}
+
+// An inner equi-join which can take part in the reordering of a chain of joins
+bool IsReorderableJoin(const Declaration& declaration) {
+  const auto* options = GetOptions<HashJoinNodeOptions>(declaration);
+  if (declaration.factory_name != "hashjoin" || options == nullptr ||
+      declaration.inputs.size() != 2 || GetInput(declaration, 0) == nullptr ||
+      GetInput(declaration, 1) == nullptr || options->join_type != JoinType::INNER ||
+      !options->output_all || !options->filter.Equals(literal(true))) {
+    return false;
+  }
+  return std::all_of(options->left_keys.begin(), options->left_keys.end(),
+                     [](const FieldRef& ref) { return ref.IsName(); });
+}
+
+Declaration Optimize(Declaration declaration, FunctionRegistry* function_registry);
+
+// Reorder a left-deep chain of inner joins join(join(r0, r1), r2)...  Each join of the
+// chain refers to the fields of the relations before it by name, so a relation can be
+// joined as soon as the fields its keys refer to have been joined.  The first relation
+// stays the probe side of the chain, and the others are joined smallest first.
+Declaration OptimizeJoinChain(const Declaration& top,
+                              FunctionRegistry* function_registry) {
+  // joins[i] joins relations[i + 1] to the relations before it
+  std::vector<Declaration> joins;
+  std::vector<Declaration> relations;
+  const Declaration* current = &top;
+  while (IsReorderableJoin(*current)) {
+    joins.push_back(*current);
+    relations.push_back(*GetInput(*current, 1));
+    current = GetInput(*current, 0);
+  }
+  relations.push_back(*current);
+  std::reverse(joins.begin(), joins.end());
+  std::reverse(relations.begin(), relations.end());
+  for (auto& relation : relations) {
+    relation = Optimize(std::move(relation), function_registry);
+  }
+
+  std::vector<std::shared_ptr<Schema>> schemas;
+  std::unordered_set<std::string> all_names;
+  bool names_are_unique = true;
+  for (const auto& relation : relations) {
+    schemas.push_back(SchemaOrNull(relation, function_registry));
+    if (schemas.back() == nullptr) {
+      names_are_unique = false;
+      break;
+    }
+    for (const auto& field : schemas.back()->fields()) {
+      names_are_unique &= all_names.insert(field->name()).second;
+    }
+  }
+
+  std::vector<size_t> order(relations.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  if (names_are_unique && relations.size() > 2) {
+    std::vector<int64_t> rows;
+    for (const auto& relation : relations) {
+      rows.push_back(
+          EstimateRowCount(relation).value_or(std::numeric_limits<int64_t>::max()));
+    }
+    std::unordered_set<std::string> joined_names;
+    for (const auto& field : schemas[0]->fields()) {
+      joined_names.insert(field->name());
+    }
+    std::vector<bool> joined(relations.size(), false);
+    for (size_t position = 1; position < order.size(); ++position) {
+      // The first relation not joined yet is always joinable, since its keys refer to
+      // the relations before it
+      size_t best = 0;
+      for (size_t i = 1; i < relations.size(); ++i) {
+        if (joined[i]) {
+          continue;
+        }
+        const auto& keys = GetOptions<HashJoinNodeOptions>(joins[i - 1])->left_keys;
+        const bool joinable =
+            std::all_of(keys.begin(), keys.end(), [&](const FieldRef& ref) {
+              return joined_names.count(*ref.name()) > 0;
+            });
+        if (joinable && (best == 0 || rows[i] < rows[best])) {
+          best = i;
+        }
+      }
+      joined[best] = true;
+      order[position] = best;
+      for (const auto& field : schemas[best]->fields()) {
+        joined_names.insert(field->name());
+      }
+    }
+  }
+
+  Declaration chain = relations[order[0]];
+  for (size_t position = 1; position < order.size(); ++position) {
+    const Declaration& join = joins[order[position] - 1];
+    chain = MaybeSwapInputs(Declaration(join.factory_name,
+                                        {std::move(chain), relations[order[position]]},
+                                        join.options, join.label),
+                            function_registry);
+  }
+  if (std::is_sorted(order.begin(), order.end())) {
+    return chain;
+  }
+  // Restore the order of the fields of the original chain
+  std::vector<Expression> exprs;
+  std::vector<std::string> names;
+  for (const auto& schema : schemas) {
+    for (const auto& field : schema->fields()) {
+      exprs.push_back(field_ref(field->name()));
+      names.push_back(field->name());
+    }
+  }
+  return Declaration("project", {std::move(chain)},
+                     ProjectNodeOptions(std::move(exprs), std::move(names)));
+}
+
+Declaration Optimize(Declaration declaration, FunctionRegistry* function_registry) {
+  if (IsReorderableJoin(declaration) && IsReorderableJoin(*GetInput(declaration, 0))) {
+    return OptimizeJoinChain(declaration, function_registry);
+  }
+  for (auto& input : declaration.inputs) {
+    if (auto* input_declaration = std::get_if<Declaration>(&input)) {
+      *input_declaration = Optimize(std::move(*input_declaration), function_registry);
+    }
+  }
+  return MaybeSwapInputs(std::move(declaration), function_registry);
+}
+
+}  // namespace
+
+void RegisterRowCountEstimator(const std::string& factory_name,
+                               RowCountEstimator estimator) {
+  auto* estimators = GetRowCountEstimators();
+  std::lock_guard<std::mutex> lk(estimators->mutex);
+  estimators->estimators[factory_name] = std::move(estimator);
+}
+
+std::optional<int64_t> EstimateRowCount(const Declaration& declaration) {
+  std::vector<std::optional<int64_t>> inputs;
+  inputs.reserve(declaration.inputs.size());
+  for (const auto& input : declaration.inputs) {
+    const auto* input_declaration = std::get_if<Declaration>(&input);
+    inputs.push_back(input_declaration != nullptr ? EstimateRowCount(*input_declaration)
+                                                  : std::nullopt);
+  }
+  RowCountEstimator estimator;
+  {
+    auto* estimators = GetRowCountEstimators();
+    std::lock_guard<std::mutex> lk(estimators->mutex);
+    auto it = estimators->estimators.find(declaration.factory_name);
+    if (it != estimators->estimators.end()) {
+      estimator = it->second;
+    }
+  }
+  if (estimator) {
+    return estimator(declaration, inputs);
+  }
+  return EstimateBuiltin(declaration, inputs);
+}
+
+Result<Declaration> ReorderJoins(Declaration declaration,
+                                 FunctionRegistry* function_registry) {
+  return Optimize(std::move(declaration), function_registry);
+}
+
+}  // namespace acero
+}  // namespace arrow
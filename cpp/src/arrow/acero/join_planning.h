@@ -0,0 +1,78 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/type_fwd.h"
+#include "arrow/acero/visibility.h"
+#include "arrow/result.h"
+
+namespace arrow {
+namespace acero {
+
+/// \brief Estimates the number of rows a declaration outputs
+///
+/// The estimator is given the declaration and the estimates of its inputs (std::nullopt
+/// for the inputs which could not be estimated) and returns std::nullopt if it cannot
+/// tell.
+using RowCountEstimator = std::function<std::optional<int64_t>(
+    const Declaration& declaration, const std::vector<std::optional<int64_t>>& inputs)>;
+
+/// \brief Register the estimator used for the declarations of a node factory
+///
+/// Estimators are built in for the table_source, filter, project, order_by, fetch,
+/// aggregate, union and hashjoin factories.  Modules defining other source nodes (e.g.
+/// the dataset scan node) register theirs so that joins over them can be planned.  A
+/// registered estimator replaces the built in one.
+ARROW_ACERO_EXPORT void RegisterRowCountEstimator(const std::string& factory_name,
+                                                  RowCountEstimator estimator);
+
+/// \brief Estimate the number of rows a declaration outputs
+///
+/// \return std::nullopt if any part of the declaration cannot be estimated
+ARROW_ACERO_EXPORT std::optional<int64_t> EstimateRowCount(
+    const Declaration& declaration);
+
+/// \brief Choose the build side of the hash joins of a declaration and reorder
+/// chains of inner joins
+///
+/// The hash join node builds its hash table on the right input.  For each hash join
+/// whose inputs can both be estimated, the inputs are swapped so that the smaller one is
+/// built on (mirroring the join type and adding a projection restoring the column
+/// order).  Left-deep chains of inner equi-joins are reordered greedily, joining the
+/// smallest relation that shares keys with the ones joined so far, as long as the names
+/// of the fields are unique across the chain.
+///
+/// Joins with a residual filter, and declarations whose schema cannot be computed, are
+/// left as they are.  The output of the rewritten declaration has the same schema and the
+/// same rows as the original one, though not necessarily in the same order.
+///
+/// \param declaration the declaration to rewrite
+/// \param function_registry the registry used to compute the schemas of declarations,
+///                          or null for the default one
+ARROW_ACERO_EXPORT Result<Declaration> ReorderJoins(
+    Declaration declaration, FunctionRegistry* function_registry = NULLPTR);
+
+}  // namespace acero
+}  // namespace arrow
@@ -0,0 +1,843 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/acero/accumulation_queue.h"
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/exec_plan_internal.h"
+#include "arrow/acero/hash_join_node.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/query_context.h"
+#include "arrow/acero/util.h"
+#include "arrow/array/array_binary.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging_internal.h"
+#include "arrow/util/tracing_internal.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+using compute::NullPlacement;
+using compute::SortKey;
+using compute::SortOrder;
+using compute::TakeOptions;
+
+namespace acero {
+namespace {
+
+constexpr const char* kMergeJoinName = "mergejoin";
+
+// Three-way comparison of two non-null values of a key column
+using CompareFn = int (*)(const Array& left, int64_t i, const Array& right, int64_t j);
+
+template <typename ArrayType>
+int CompareValues(const Array& left, int64_t i, const Array& right, int64_t j) {
+  const auto l = checked_cast<const ArrayType&>(left).GetView(i);
+  const auto r = checked_cast<const ArrayType&>(right).GetView(j);
+  return (r < l) - (l < r);
+}
+
+template <typename ArrowType>
+CompareFn CompareFnFor() {
+  return CompareValues<typename TypeTraits<ArrowType>::ArrayType>;
+}
+
+// Floating point keys are not supported, equality and order disagree on NaN
+CompareFn GetCompareFn(const DataType& type) {
+  switch (type.id()) {
+    case Type::BOOL:
+      return CompareFnFor<BooleanType>();
+    case Type::INT8:
+      return CompareFnFor<Int8Type>();
+    case Type::INT16:
+      return CompareFnFor<Int16Type>();
+    case Type::INT32:
+      return CompareFnFor<Int32Type>();
+    case Type::INT64:
+      return CompareFnFor<Int64Type>();
+    case Type::UINT8:
+      return CompareFnFor<UInt8Type>();
+    case Type::UINT16:
+      return CompareFnFor<UInt16Type>();
+    case Type::UINT32:
+      return CompareFnFor<UInt32Type>();
+    case Type::UINT64:
+      return CompareFnFor<UInt64Type>();
+    case Type::DATE32:
+      return CompareFnFor<Date32Type>();
+    case Type::DATE64:
+      return CompareFnFor<Date64Type>();
+    case Type::TIME32:
+      return CompareFnFor<Time32Type>();
+    case Type::TIME64:
+      return CompareFnFor<Time64Type>();
+    case Type::TIMESTAMP:
+      return CompareFnFor<TimestampType>();
+    case Type::DURATION:
+      return CompareFnFor<DurationType>();
+    case Type::STRING:
+      return CompareFnFor<StringType>();
+    case Type::BINARY:
+      return CompareFnFor<BinaryType>();
+    case Type::LARGE_STRING:
+      return CompareFnFor<LargeStringType>();
+    case Type::LARGE_BINARY:
+      return CompareFnFor<LargeBinaryType>();
+    case Type::FIXED_SIZE_BINARY:
+      return CompareFnFor<FixedSizeBinaryType>();
+    default:
+      return nullptr;
+  }
+}
+
+// The join keys, in the order in which both inputs are sorted by them
+struct MergeKeys {
+  std::vector<int> left_ids;
+  std::vector<int> right_ids;
+  std::vector<CompareFn> compare;
+  std::vector<bool> descending;
+  // Whether nulls are equal to each other (JoinKeyCmp::IS)
+  std::vector<bool> null_matches;
+  bool nulls_first = false;
+
+  size_t size() const { return compare.size(); }
+};
+
+Result<int> FindFieldId(const FieldRef& ref, const Schema& schema) {
+  ARROW_ASSIGN_OR_RAISE(FieldPath path, ref.FindOne(schema));
+  if (path.indices().size() != 1) {
+    return Status::NotImplemented("MergeJoin does not support nested field ",
+                                  ref.ToString());
+  }
+  return path[0];
+}
+
+// Matches the join keys to the leading sort keys of both inputs.  The sort keys may list
+// the join keys in any order, but a left sort key and the corresponding right sort key
+// must refer to the same pair of join keys and sort in the same direction.
+Result<MergeKeys> BindMergeKeys(const HashJoinNodeOptions& join_options,
+                                const ExecNode& left, const ExecNode& right) {
+  const Ordering& left_ordering = left.ordering();
+  const Ordering& right_ordering = right.ordering();
+  const size_t num_keys = join_options.left_keys.size();
+  if (left_ordering.sort_keys().size() < num_keys ||
+      right_ordering.sort_keys().size() < num_keys) {
+    return Status::NotImplemented(
+        "MergeJoin requires both inputs to be ordered by the join keys");
+  }
+  if (left_ordering.null_placement() != right_ordering.null_placement()) {
+    return Status::NotImplemented(
+        "MergeJoin requires both inputs to place nulls at the same end");
+  }
+  const Schema& left_schema = *left.output_schema();
+  const Schema& right_schema = *right.output_schema();
+
+  std::vector<int> left_key_ids(num_keys), right_key_ids(num_keys);
+  for (size_t i = 0; i < num_keys; ++i) {
+    ARROW_ASSIGN_OR_RAISE(left_key_ids[i],
+                          FindFieldId(join_options.left_keys[i], left_schema));
+    ARROW_ASSIGN_OR_RAISE(right_key_ids[i],
+                          FindFieldId(join_options.right_keys[i], right_schema));
+  }
+
+  MergeKeys keys;
+  keys.nulls_first = left_ordering.null_placement() == NullPlacement::AtStart;
+  std::vector<bool> used(num_keys, false);
+  for (size_t k = 0; k < num_keys; ++k) {
+    const SortKey& left_key = left_ordering.sort_keys()[k];
+    const SortKey& right_key = right_ordering.sort_keys()[k];
+    ARROW_ASSIGN_OR_RAISE(int left_id, FindFieldId(left_key.target, left_schema));
+    ARROW_ASSIGN_OR_RAISE(int right_id, FindFieldId(right_key.target, right_schema));
+    size_t i = 0;
+    while (i < num_keys &&
+           (used[i] || left_key_ids[i] != left_id || right_key_ids[i] != right_id)) {
+      ++i;
+    }
+    if (i == num_keys || left_key.order != right_key.order) {
+      return Status::NotImplemented(
+          "MergeJoin requires both inputs to be ordered by the join keys");
+    }
+    used[i] = true;
+
+    const DataType& left_type = *left_schema.field(left_id)->type();
+    const DataType& right_type = *right_schema.field(right_id)->type();
+    CompareFn compare = GetCompareFn(left_type);
+    if (compare == nullptr || !left_type.Equals(right_type)) {
+      return Status::NotImplemented("MergeJoin does not support keys of type ",
+                                    left_type, " and ", right_type);
+    }
+    keys.left_ids.push_back(left_id);
+    keys.right_ids.push_back(right_id);
+    keys.compare.push_back(compare);
+    keys.descending.push_back(left_key.order == SortOrder::Descending);
+    keys.null_matches.push_back(join_options.key_cmp[i] == JoinKeyCmp::IS);
+  }
+  return keys;
+}
+
+// The join is computed in the order of the left input, output rows keep the leading
+// left sort keys which are part of the output
+Ordering MakeOutputOrdering(const Ordering& left_ordering, const Schema& left_schema,
+                            const HashJoinSchema& schema_mgr) {
+  SchemaProjectionMap out_to_in =
+      schema_mgr.proj_maps[0].map(HashJoinProjection::OUTPUT, HashJoinProjection::INPUT);
+  std::vector<SortKey> sort_keys;
+  for (const SortKey& sort_key : left_ordering.sort_keys()) {
+    auto maybe_id = FindFieldId(sort_key.target, left_schema);
+    if (!maybe_id.ok()) {
+      break;
+    }
+    int out_id = 0;
+    while (out_id < out_to_in.num_cols && out_to_in.get(out_id) != *maybe_id) {
+      ++out_id;
+    }
+    if (out_id == out_to_in.num_cols) {
+      break;
+    }
+    sort_keys.emplace_back(FieldRef(out_id), sort_key.order);
+  }
+  if (sort_keys.empty()) {
+    return Ordering::Unordered();
+  }
+  return Ordering(std::move(sort_keys), left_ordering.null_placement());
+}
+
+bool IsSupportedJoinType(JoinType join_type) {
+  switch (join_type) {
+    case JoinType::INNER:
+    case JoinType::LEFT_OUTER:
+    case JoinType::LEFT_SEMI:
+    case JoinType::LEFT_ANTI:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/// \brief A join of two inputs which are ordered by the join keys
+///
+/// Both inputs are sequenced and merged as their batches arrive.  Only the right rows
+/// of the current key (the "run") are kept, along with whatever input has arrived but
+/// cannot be merged yet, so memory grows with the longest run instead of with the
+/// right input.  Output rows are in the order of the left input.
+class MergeJoinNode : public ExecNode, public TracedNode {
+ public:
+  MergeJoinNode(ExecPlan* plan, NodeVector inputs, JoinType join_type, MergeKeys keys,
+                std::unique_ptr<HashJoinSchema> schema_mgr,
+                std::shared_ptr<Schema> output_schema, Ordering output_ordering)
+      : ExecNode(plan, inputs, {"left", "right"}, std::move(output_schema)),
+        TracedNode(this),
+        join_type_(join_type),
+        keys_(std::move(keys)),
+        schema_mgr_(std::move(schema_mgr)),
+        output_ordering_(std::move(output_ordering)) {
+    for (int side = 0; side < 2; ++side) {
+      inputs_state_[side].node = this;
+      inputs_state_[side].side = side;
+      inputs_state_[side].key_ids = side == 0 ? &keys_.left_ids : &keys_.right_ids;
+    }
+  }
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 2, "MergeJoinNode"));
+    const auto& join_options = checked_cast<const HashJoinNodeOptions&>(options);
+    if (join_options.left_keys.empty() ||
+        join_options.left_keys.size() != join_options.right_keys.size() ||
+        join_options.left_keys.size() != join_options.key_cmp.size()) {
+      return Status::Invalid("key_cmp and keys must have the same, non-zero, size");
+    }
+    if (!IsSupportedJoinType(join_options.join_type)) {
+      return Status::NotImplemented("MergeJoin does not support ",
+                                    acero::ToString(join_options.join_type), " joins");
+    }
+    if (!join_options.filter.Equals(compute::literal(true))) {
+      return Status::NotImplemented("MergeJoin does not support a residual filter");
+    }
+
+    const auto& left_schema = *inputs[0]->output_schema();
+    const auto& right_schema = *inputs[1]->output_schema();
+    auto schema_mgr = std::make_unique<HashJoinSchema>();
+    if (join_options.output_all) {
+      RETURN_NOT_OK(schema_mgr->Init(
+          join_options.join_type, left_schema, join_options.left_keys, right_schema,
+          join_options.right_keys, join_options.filter,
+          join_options.output_suffix_for_left, join_options.output_suffix_for_right));
+    } else {
+      RETURN_NOT_OK(schema_mgr->Init(
+          join_options.join_type, left_schema, join_options.left_keys,
+          join_options.left_output, right_schema, join_options.right_keys,
+          join_options.right_output, join_options.filter,
+          join_options.output_suffix_for_left, join_options.output_suffix_for_right));
+    }
+    if (schema_mgr->HasDictionaries()) {
+      return Status::NotImplemented("MergeJoin does not support dictionaries");
+    }
+    ARROW_ASSIGN_OR_RAISE(MergeKeys keys,
+                          BindMergeKeys(join_options, *inputs[0], *inputs[1]));
+
+    std::shared_ptr<Schema> output_schema = schema_mgr->MakeOutputSchema(
+        join_options.output_suffix_for_left, join_options.output_suffix_for_right);
+    Ordering output_ordering =
+        MakeOutputOrdering(inputs[0]->ordering(), left_schema, *schema_mgr);
+    return plan->EmplaceNode<MergeJoinNode>(
+        plan, std::move(inputs), join_options.join_type, std::move(keys),
+        std::move(schema_mgr), std::move(output_schema), std::move(output_ordering));
+  }
+
+  const char* kind_name() const override { return "MergeJoinNode"; }
+
+  const Ordering& ordering() const override { return output_ordering_; }
+
+  Status StartProducing() override {
+    NoteStartProducing(ToStringExtra());
+    for (auto& input : inputs_state_) {
+      input.sequencer = util::SerialSequencingQueue::Make(&input);
+    }
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    std::vector<Action> actions;
+    {
+      std::lock_guard<std::mutex> lk(mutex_);
+      if (counter <= output_counter_) {
+        return;
+      }
+      output_counter_ = counter;
+      output_paused_ = true;
+      actions = UpdateBackpressure();
+    }
+    ApplyBackpressure(actions);
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    std::vector<Action> actions;
+    {
+      std::lock_guard<std::mutex> lk(mutex_);
+      if (counter <= output_counter_) {
+        return;
+      }
+      output_counter_ = counter;
+      output_paused_ = false;
+      actions = UpdateBackpressure();
+    }
+    ApplyBackpressure(actions);
+  }
+
+  Status StopProducingImpl() override { return Status::OK(); }
+
+  Status InputReceived(ExecNode* input, ExecBatch batch) override {
+    auto scope = TraceInputReceived(input, batch);
+    return inputs_state_[InputIndex(input)].sequencer->InsertBatch(std::move(batch));
+  }
+
+  Status InputFinished(ExecNode* input, int total_batches) override {
+    EVENT_ON_CURRENT_SPAN("InputFinished", {{"batches.length", total_batches}});
+    const int side = InputIndex(input);
+    std::vector<Action> actions;
+    {
+      std::lock_guard<std::mutex> lk(mutex_);
+      inputs_state_[side].total_batches = total_batches;
+      if (!inputs_state_[side].finished()) {
+        return Status::OK();
+      }
+      RETURN_NOT_OK(Merge(&actions));
+    }
+    return RunActions(actions);
+  }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    std::stringstream ss;
+    ss << "type=" << acero::ToString(join_type_) << ", keys=[";
+    const auto& left_schema = inputs_[0]->output_schema();
+    const auto& right_schema = inputs_[1]->output_schema();
+    for (size_t k = 0; k < keys_.size(); ++k) {
+      if (k > 0) ss << ", ";
+      ss << left_schema->field(keys_.left_ids[k])->name() << "="
+         << right_schema->field(keys_.right_ids[k])->name();
+    }
+    ss << "]";
+    return ss.str();
+  }
+
+ private:
+  // A batch of an input which may still be needed
+  struct Block {
+    std::shared_ptr<RecordBatch> batch;
+    // The key columns, in the order of MergeKeys
+    ArrayVector keys;
+    // The position of the first row among all rows of the input
+    int64_t offset;
+  };
+
+  // A row of an input, kept alive independently of the blocks
+  struct KeyRow {
+    ArrayVector keys;
+    int64_t row = -1;
+
+    bool valid() const { return row >= 0; }
+  };
+
+  struct InputState : public util::SerialSequencingQueue::Processor {
+    MergeJoinNode* node;
+    int side;
+    const std::vector<int>* key_ids;
+    std::unique_ptr<util::SerialSequencingQueue> sequencer;
+    std::deque<Block> blocks;
+    // Rows and batches delivered by the sequencer so far
+    int64_t num_rows = 0;
+    int num_batches = 0;
+    int total_batches = -1;
+    bool paused = false;
+    int32_t backpressure_counter = 0;
+
+    bool finished() const { return num_batches == total_batches; }
+
+    const Block& BlockOf(int64_t row) const {
+      auto it = std::upper_bound(
+          blocks.begin(), blocks.end(), row,
+          [](int64_t row, const Block& block) { return row < block.offset; });
+      DCHECK(it != blocks.begin());
+      return *(it - 1);
+    }
+
+    // Drops the blocks before `row`
+    void Release(int64_t row) {
+      while (!blocks.empty() &&
+             blocks.front().offset + blocks.front().batch->num_rows() <= row) {
+        blocks.pop_front();
+      }
+    }
+
+    Status Process(ExecBatch batch) override {
+      return node->ProcessBatch(side, std::move(batch));
+    }
+  };
+
+  // Work to be done outside of the lock: output batches to deliver, and inputs to pause
+  // or resume
+  struct Action {
+    ExecBatch batch;
+    bool finish = false;
+    int side = -1;
+    bool pause = false;
+    int32_t counter = 0;
+  };
+
+  MemoryPool* pool() const { return plan_->query_context()->memory_pool(); }
+
+  int InputIndex(const ExecNode* input) const {
+    DCHECK(input == inputs_[0] || input == inputs_[1]);
+    return input == inputs_[0] ? 0 : 1;
+  }
+
+  Status ProcessBatch(int side, ExecBatch batch) {
+    std::shared_ptr<RecordBatch> record_batch;
+    if (batch.length > 0) {
+      ARROW_ASSIGN_OR_RAISE(record_batch,
+                            batch.ToRecordBatch(inputs_[side]->output_schema(), pool()));
+    }
+    std::vector<Action> actions;
+    {
+      std::lock_guard<std::mutex> lk(mutex_);
+      InputState& input = inputs_state_[side];
+      ++input.num_batches;
+      if (record_batch && !done_) {
+        ArrayVector keys;
+        for (int key_id : *input.key_ids) {
+          keys.push_back(record_batch->column(key_id));
+        }
+        input.blocks.push_back(Block{std::move(record_batch), std::move(keys),
+                                     input.num_rows});
+        input.num_rows += batch.length;
+      }
+      RETURN_NOT_OK(Merge(&actions));
+    }
+    return RunActions(actions);
+  }
+
+  int Compare(const ArrayVector& left, int64_t i, const ArrayVector& right,
+              int64_t j) const {
+    for (size_t k = 0; k < keys_.size(); ++k) {
+      const bool left_null = left[k]->IsNull(i);
+      const bool right_null = right[k]->IsNull(j);
+      if (left_null || right_null) {
+        if (left_null && right_null) {
+          continue;
+        }
+        return (left_null != keys_.nulls_first) ? 1 : -1;
+      }
+      const int c = keys_.compare[k](*left[k], i, *right[k], j);
+      if (c != 0) {
+        return keys_.descending[k] ? -c : c;
+      }
+    }
+    return 0;
+  }
+
+  // Whether a row cannot match because of a null key
+  bool HasNullKey(const ArrayVector& keys, int64_t i) const {
+    for (size_t k = 0; k < keys_.size(); ++k) {
+      if (!keys_.null_matches[k] && keys[k]->IsNull(i)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Extends the run to all right rows with the key of its first row.  Returns false if
+  // more right rows are needed to know where the run ends.
+  Result<bool> FindRun() {
+    const InputState& right = inputs_state_[1];
+    while (run_end_ < right.num_rows) {
+      const Block& block = right.BlockOf(run_end_);
+      const int64_t i = run_end_ - block.offset;
+      if (run_begin_ == run_end_) {
+        if (HasNullKey(block.keys, i)) {
+          run_begin_ = ++run_end_;
+          continue;
+        }
+        if (run_key_.valid() &&
+            Compare(block.keys, i, run_key_.keys, run_key_.row) <= 0) {
+          return Status::Invalid("MergeJoin right input is not ordered by the join keys");
+        }
+        run_key_ = KeyRow{block.keys, i};
+        ++run_end_;
+        continue;
+      }
+      const int c = Compare(block.keys, i, run_key_.keys, run_key_.row);
+      if (c < 0) {
+        return Status::Invalid("MergeJoin right input is not ordered by the join keys");
+      }
+      if (c > 0) {
+        run_complete_ = true;
+        return true;
+      }
+      ++run_end_;
+    }
+    run_complete_ = right.finished();
+    return run_complete_;
+  }
+
+  bool EmitsUnmatched() const {
+    return join_type_ == JoinType::LEFT_OUTER || join_type_ == JoinType::LEFT_ANTI;
+  }
+
+  void EmitMatches(int64_t left_row) {
+    switch (join_type_) {
+      case JoinType::INNER:
+      case JoinType::LEFT_OUTER:
+        for (int64_t right_row = run_begin_; right_row < run_end_; ++right_row) {
+          pending_left_.push_back(left_row);
+          pending_right_.push_back(right_row);
+        }
+        break;
+      case JoinType::LEFT_SEMI:
+        pending_left_.push_back(left_row);
+        break;
+      default:
+        break;
+    }
+  }
+
+  void EmitUnmatched(int64_t left_row) {
+    if (EmitsUnmatched()) {
+      pending_left_.push_back(left_row);
+      if (join_type_ == JoinType::LEFT_OUTER) {
+        pending_right_.push_back(-1);
+      }
+    }
+  }
+
+  // Merges the rows which have arrived, queueing the output and backpressure changes
+  Status Merge(std::vector<Action>* actions) {
+    if (done_) {
+      return Status::OK();
+    }
+    InputState& left = inputs_state_[0];
+    while (left_row_ < left.num_rows) {
+      if (!run_complete_) {
+        ARROW_ASSIGN_OR_RAISE(bool found, FindRun());
+        if (!found) {
+          break;
+        }
+      }
+      const bool right_exhausted = run_begin_ == run_end_;
+      if (right_exhausted && !EmitsUnmatched()) {
+        // No further output is possible
+        left_row_ = left.num_rows;
+        break;
+      }
+      const Block& block = left.BlockOf(left_row_);
+      const int64_t i = left_row_ - block.offset;
+      bool matched = false;
+      if (!right_exhausted && !HasNullKey(block.keys, i)) {
+        const int c = Compare(block.keys, i, run_key_.keys, run_key_.row);
+        if (c > 0) {
+          // The left rows are past the run, move on to the next key
+          run_begin_ = run_end_;
+          run_complete_ = false;
+          continue;
+        }
+        matched = c == 0;
+      }
+      if (last_left_.valid() &&
+          Compare(block.keys, i, last_left_.keys, last_left_.row) < 0) {
+        return Status::Invalid("MergeJoin left input is not ordered by the join keys");
+      }
+      last_left_ = KeyRow{block.keys, i};
+      if (matched) {
+        EmitMatches(left_row_);
+      } else {
+        EmitUnmatched(left_row_);
+      }
+      ++left_row_;
+      if (static_cast<int64_t>(pending_left_.size()) >= ExecPlan::kMaxBatchSize) {
+        RETURN_NOT_OK(Flush(actions));
+      }
+    }
+    RETURN_NOT_OK(Flush(actions));
+    left.Release(left_row_);
+    inputs_state_[1].Release(run_begin_);
+    done_ = left.finished() && left_row_ == left.num_rows;
+    if (done_) {
+      // Let the right input run to completion, its remaining rows are not needed
+      inputs_state_[1].blocks.clear();
+      Action action;
+      action.finish = true;
+      actions->push_back(std::move(action));
+    }
+    for (Action& action : UpdateBackpressure()) {
+      actions->push_back(std::move(action));
+    }
+    return Status::OK();
+  }
+
+  // Pauses the inputs which are far ahead of the merge, except the input the merge is
+  // waiting for (which would deadlock), and all inputs while the output is paused
+  std::vector<Action> UpdateBackpressure() {
+    const InputState& left = inputs_state_[0];
+    const InputState& right = inputs_state_[1];
+    int waiting_for = -1;
+    if (!done_) {
+      waiting_for = (left_row_ == left.num_rows) ? 0 : 1;
+    }
+    const int64_t ahead[2] = {left.num_rows - left_row_, right.num_rows - run_end_};
+    std::vector<Action> actions;
+    for (int side = 0; side < 2; ++side) {
+      InputState& input = inputs_state_[side];
+      const bool pause =
+          !done_ && (output_paused_ ||
+                     (side != waiting_for && ahead[side] > kBackpressureRows));
+      if (pause != input.paused) {
+        input.paused = pause;
+        Action action;
+        action.side = side;
+        action.pause = pause;
+        action.counter = ++input.backpressure_counter;
+        actions.push_back(std::move(action));
+      }
+    }
+    return actions;
+  }
+
+  void ApplyBackpressure(const std::vector<Action>& actions) {
+    for (const Action& action : actions) {
+      if (action.side >= 0) {
+        if (action.pause) {
+          inputs_[action.side]->PauseProducing(this, action.counter);
+        } else {
+          inputs_[action.side]->ResumeProducing(this, action.counter);
+        }
+      }
+    }
+  }
+
+  Status RunActions(std::vector<Action>& actions) {
+    ApplyBackpressure(actions);
+    bool finished = false;
+    for (Action& action : actions) {
+      if (action.finish) {
+        finished = true;
+      } else if (action.side < 0) {
+        RETURN_NOT_OK(output_->InputReceived(this, std::move(action.batch)));
+      }
+    }
+    if (finished) {
+      return output_->InputFinished(this, num_output_batches_);
+    }
+    return Status::OK();
+  }
+
+  // Takes the rows of one side for the output, a negative row selects a null
+  Result<ArrayVector> TakeRows(int side, const std::vector<int64_t>& rows,
+                               int64_t last_row, int64_t length) {
+    const InputState& input = inputs_state_[side];
+    const Schema& input_schema = *inputs_[side]->output_schema();
+    SchemaProjectionMap out_to_in = schema_mgr_->proj_maps[side].map(
+        HashJoinProjection::OUTPUT, HashJoinProjection::INPUT);
+    ArrayVector columns;
+    if (last_row < 0) {
+      for (int k = 0; k < out_to_in.num_cols; ++k) {
+        const auto& type = input_schema.field(out_to_in.get(k))->type();
+        ARROW_ASSIGN_OR_RAISE(auto column, MakeArrayOfNull(type, length, pool()));
+        columns.push_back(std::move(column));
+      }
+      return columns;
+    }
+
+    const int64_t base = input.blocks.front().offset;
+    Int64Builder builder(pool());
+    RETURN_NOT_OK(builder.Reserve(length));
+    for (int64_t row : rows) {
+      if (row < 0) {
+        builder.UnsafeAppendNull();
+      } else {
+        builder.UnsafeAppend(row - base);
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto indices, builder.Finish());
+
+    size_t num_blocks = 0;
+    while (num_blocks < input.blocks.size() &&
+           input.blocks[num_blocks].offset <= last_row) {
+      ++num_blocks;
+    }
+    for (int k = 0; k < out_to_in.num_cols; ++k) {
+      const int column_id = out_to_in.get(k);
+      std::shared_ptr<Array> values;
+      if (num_blocks == 1) {
+        values = input.blocks.front().batch->column(column_id);
+      } else {
+        ArrayVector chunks;
+        for (size_t b = 0; b < num_blocks; ++b) {
+          chunks.push_back(input.blocks[b].batch->column(column_id));
+        }
+        ARROW_ASSIGN_OR_RAISE(values, Concatenate(chunks, pool()));
+      }
+      ARROW_ASSIGN_OR_RAISE(
+          Datum taken, compute::Take(values, indices, TakeOptions::NoBoundsCheck(),
+                                     plan_->query_context()->exec_context()));
+      columns.push_back(taken.make_array());
+    }
+    return columns;
+  }
+
+  // Materializes the pending output rows, as batches of at most kMaxBatchSize rows
+  Status Flush(std::vector<Action>* actions) {
+    const int64_t length = static_cast<int64_t>(pending_left_.size());
+    if (length > 0) {
+      ARROW_ASSIGN_OR_RAISE(ArrayVector columns,
+                            TakeRows(0, pending_left_, pending_left_.back(), length));
+      if (join_type_ == JoinType::INNER || join_type_ == JoinType::LEFT_OUTER) {
+        const int64_t last_right =
+            *std::max_element(pending_right_.begin(), pending_right_.end());
+        ARROW_ASSIGN_OR_RAISE(ArrayVector right_columns,
+                              TakeRows(1, pending_right_, last_right, length));
+        columns.insert(columns.end(), right_columns.begin(), right_columns.end());
+      }
+      pending_left_.clear();
+      pending_right_.clear();
+
+      std::vector<Datum> values(columns.begin(), columns.end());
+      ExecBatch out(std::move(values), length);
+      for (int64_t offset = 0; offset < length; offset += ExecPlan::kMaxBatchSize) {
+        Action action;
+        action.batch = out.Slice(offset, ExecPlan::kMaxBatchSize);
+        action.batch.index = num_output_batches_++;
+        actions->push_back(std::move(action));
+      }
+    }
+    return Status::OK();
+  }
+
+  // Rows an input may be ahead of the merge before it is paused
+  static constexpr int64_t kBackpressureRows = 4 * ExecPlan::kMaxBatchSize;
+
+  const JoinType join_type_;
+  const MergeKeys keys_;
+  const std::unique_ptr<HashJoinSchema> schema_mgr_;
+  const Ordering output_ordering_;
+
+  std::mutex mutex_;
+  InputState inputs_state_[2];
+  bool output_paused_ = false;
+  int32_t output_counter_ = 0;
+  bool done_ = false;
+
+  // The next left row to merge
+  int64_t left_row_ = 0;
+  // The right rows [run_begin_, run_end_) share the key of run_key_.  Once the run is
+  // complete, run_begin_ == run_end_ means that the right input is exhausted.
+  int64_t run_begin_ = 0;
+  int64_t run_end_ = 0;
+  bool run_complete_ = false;
+  KeyRow run_key_;
+  // The last merged left row, which the next one may not be less than
+  KeyRow last_left_;
+
+  // Output rows, as pairs of left and right rows (-1 for a null right side)
+  std::vector<int64_t> pending_left_;
+  std::vector<int64_t> pending_right_;
+  int num_output_batches_ = 0;
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterMergeJoinNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(registry->AddFactory(kMergeJoinName, MergeJoinNode::Make));
+}
+
+Result<ExecNode*> MaybeMakeMergeJoinNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                         const HashJoinNodeOptions& join_options) {
+  if (inputs.size() != 2 || inputs[0]->ordering().sort_keys().empty() ||
+      inputs[1]->ordering().sort_keys().empty()) {
+    return nullptr;
+  }
+  auto maybe_node = MergeJoinNode::Make(plan, std::move(inputs), join_options);
+  if (maybe_node.status().IsNotImplemented()) {
+    return nullptr;
+  }
+  return maybe_node;
+}
+
+}  // namespace internal
+}  // namespace acero
+}  // namespace arrow
@@ -0,0 +1,212 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <gmock/gmock-matchers.h>
+
+#include <algorithm>
+#include <random>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/test_util_internal.h"
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/compute/test_util_internal.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+using compute::ExecBatchFromJSON;
+using compute::NullPlacement;
+using compute::SortKey;
+using compute::SortOrder;
+
+namespace acero {
+
+// Batches of (key, str, val) rows ordered by key then str, with null keys first.  Keys
+// are drawn from a small range so that both sides have runs of equal keys, and runs
+// span batches.
+BatchesWithSchema MakeOrderedBatches(int num_rows, int max_key, int seed,
+                                     SortOrder order) {
+  std::default_random_engine rng(seed);
+  std::uniform_int_distribution<int> key_dist(-1, max_key);
+  std::vector<std::pair<int, int>> rows(num_rows);
+  for (auto& row : rows) {
+    row = {key_dist(rng), key_dist(rng) % 3};
+  }
+  std::sort(rows.begin(), rows.end(), [&](const auto& l, const auto& r) {
+    // -1 stands for null
+    if ((l.first < 0) != (r.first < 0)) return l.first < 0;
+    if (l.first != r.first) {
+      return order == SortOrder::Ascending ? l.first < r.first : l.first > r.first;
+    }
+    return order == SortOrder::Ascending ? l.second < r.second : l.second > r.second;
+  });
+
+  BatchesWithSchema out;
+  out.schema =
+      schema({field("key", int32()), field("str", utf8()), field("val", int64())});
+  constexpr int kBatchSize = 7;
+  for (int begin = 0; begin < num_rows; begin += kBatchSize) {
+    const int end = std::min(num_rows, begin + kBatchSize);
+    Int32Builder keys;
+    StringBuilder strs;
+    Int64Builder vals;
+    for (int i = begin; i < end; ++i) {
+      if (rows[i].first < 0) {
+        ARROW_EXPECT_OK(keys.AppendNull());
+      } else {
+        ARROW_EXPECT_OK(keys.Append(rows[i].first));
+      }
+      ARROW_EXPECT_OK(strs.Append(std::to_string(rows[i].second)));
+      ARROW_EXPECT_OK(vals.Append(seed * 1000 + i));
+    }
+    out.batches.emplace_back(
+        std::vector<Datum>{keys.Finish().ValueOrDie(), strs.Finish().ValueOrDie(),
+                           vals.Finish().ValueOrDie()},
+        end - begin);
+  }
+  return out;
+}
+
+Declaration OrderedSource(const BatchesWithSchema& input, Ordering ordering,
+                          bool parallel) {
+  return {"source",
+          SourceNodeOptions(input.schema, input.gen(parallel, /*slow=*/false),
+                            std::move(ordering))};
+}
+
+Declaration UnorderedSource(const BatchesWithSchema& input) {
+  return {"source", SourceNodeOptions(input.schema, input.gen(/*parallel=*/false,
+                                                              /*slow=*/false))};
+}
+
+void CheckMatchesHashJoin(const BatchesWithSchema& left, const BatchesWithSchema& right,
+                          const Ordering& ordering, const HashJoinNodeOptions& options) {
+  ASSERT_OK_AND_ASSIGN(
+      std::shared_ptr<Table> expected,
+      DeclarationToTable(Declaration("hashjoin",
+                                     {UnorderedSource(left), UnorderedSource(right)},
+                                     options)));
+  for (bool parallel : {false, true}) {
+    SCOPED_TRACE(parallel ? "parallel" : "serial");
+    Declaration merge_join("mergejoin",
+                           {OrderedSource(left, ordering, parallel),
+                            OrderedSource(right, ordering, parallel)},
+                           options);
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                         DeclarationToTable(std::move(merge_join)));
+    AssertTablesEqualIgnoringOrder(expected, actual);
+  }
+}
+
+TEST(MergeJoin, MatchesHashJoin) {
+  for (SortOrder order : {SortOrder::Ascending, SortOrder::Descending}) {
+    BatchesWithSchema left = MakeOrderedBatches(100, 20, 1, order);
+    BatchesWithSchema right = MakeOrderedBatches(80, 25, 2, order);
+    Ordering ordering({SortKey("key", order), SortKey("str", order)},
+                      NullPlacement::AtStart);
+    for (JoinType join_type : {JoinType::INNER, JoinType::LEFT_OUTER,
+                               JoinType::LEFT_SEMI, JoinType::LEFT_ANTI}) {
+      SCOPED_TRACE(ToString(join_type));
+      CheckMatchesHashJoin(left, right, ordering,
+                           HashJoinNodeOptions(join_type, {"key"}, {"key"},
+                                               compute::literal(true), "_l", "_r"));
+      // Both keys, listed in another order than the sort keys
+      CheckMatchesHashJoin(left, right, ordering,
+                           HashJoinNodeOptions(join_type, {"str", "key"}, {"str", "key"},
+                                               compute::literal(true), "_l", "_r"));
+    }
+  }
+}
+
+TEST(MergeJoin, OrderedOutput) {
+  BatchesWithSchema left = MakeOrderedBatches(60, 10, 3, SortOrder::Ascending);
+  BatchesWithSchema right = MakeOrderedBatches(60, 10, 4, SortOrder::Ascending);
+  Ordering ordering({SortKey("key")}, NullPlacement::AtStart);
+  // The hash join factory merges inputs which are ordered by the keys
+  Declaration join("hashjoin",
+                   {OrderedSource(left, ordering, /*parallel=*/true),
+                    OrderedSource(right, ordering, /*parallel=*/true)},
+                   HashJoinNodeOptions(JoinType::LEFT_OUTER, {"key"}, {"key"},
+                                       compute::literal(true), "_l", "_r"));
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  ASSERT_OK(join.AddToPlan(plan.get()));
+  EXPECT_THAT(plan->ToString(), testing::HasSubstr("MergeJoinNode"));
+
+  QueryOptions query_options;
+  query_options.sequence_output = true;
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                       DeclarationToTable(std::move(join), query_options));
+  // Output rows are in the order of the left input: null keys first, then ascending
+  ASSERT_GT(actual->num_rows(), 0);
+  ASSERT_OK_AND_ASSIGN(auto keys, Concatenate(actual->column(0)->chunks()));
+  const auto& key_array = checked_cast<const Int32Array&>(*keys);
+  for (int64_t i = 1; i < key_array.length(); ++i) {
+    ASSERT_FALSE(key_array.IsNull(i) && key_array.IsValid(i - 1)) << i;
+    if (key_array.IsValid(i - 1)) {
+      ASSERT_LE(key_array.Value(i - 1), key_array.Value(i)) << i;
+    }
+  }
+}
+
+TEST(MergeJoin, Unsupported) {
+  BatchesWithSchema input = MakeOrderedBatches(10, 5, 5, SortOrder::Ascending);
+  Ordering ordering({SortKey("key")});
+  auto check = [&](Declaration left, Declaration right, JoinType join_type,
+                   const std::string& message) {
+    Declaration join(
+        "mergejoin", {std::move(left), std::move(right)},
+        HashJoinNodeOptions(join_type, {"key"}, {"key"}, compute::literal(true), "_l",
+                            "_r"));
+    EXPECT_RAISES_WITH_MESSAGE_THAT(NotImplemented, testing::HasSubstr(message),
+                                    DeclarationToStatus(std::move(join)));
+  };
+  check(UnorderedSource(input), OrderedSource(input, ordering, false), JoinType::INNER,
+        "requires both inputs to be ordered by the join keys");
+  check(OrderedSource(input, ordering, false), OrderedSource(input, ordering, false),
+        JoinType::FULL_OUTER, "does not support FULL_OUTER joins");
+}
+
+TEST(MergeJoin, InputNotOrdered) {
+  BatchesWithSchema left;
+  left.schema = schema({field("key", int32())});
+  left.batches = {ExecBatchFromJSON({int32()}, "[[1], [3]]"),
+                  ExecBatchFromJSON({int32()}, "[[2], [4]]")};
+  BatchesWithSchema right;
+  right.schema = schema({field("rkey", int32())});
+  right.batches = {ExecBatchFromJSON({int32()}, "[[1], [2], [3], [4]]")};
+  Ordering left_ordering({SortKey("key")});
+  Ordering right_ordering({SortKey("rkey")});
+  Declaration join("mergejoin",
+                   {OrderedSource(left, left_ordering, false),
+                    OrderedSource(right, right_ordering, false)},
+                   HashJoinNodeOptions(JoinType::INNER, {"key"}, {"rkey"}));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid,
+                                  testing::HasSubstr("left input is not ordered"),
+                                  DeclarationToStatus(std::move(join)));
+}
+
+}  // namespace acero
+}  // namespace arrow
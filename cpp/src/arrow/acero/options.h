@@ -313,6 +313,10 @@ class ARROW_ACERO_EXPORT ProjectNodeOptions : public ExecNodeOptions {
 ///
 /// Segment keys are currently limited to single-threaded mode.
 ///
+/// If no segment keys are given but the input ordering (see ExecNode::ordering) starts
+/// with exactly the grouping keys, then the node streams in the same way: each group is
+/// emitted once the input has moved past it.
+///
 /// Both keys and segment-keys determine the group.  However segment-keys are also used
 /// for determining grouping segments, which should be large, and allow streaming a
 /// partial aggregation result after processing each segment.  One common use-case for
@@ -545,6 +549,49 @@ class ARROW_ACERO_EXPORT OrderByNodeOptions : public ExecNodeOptions {
   Ordering ordering;
 };
 
+/// \brief Keep only the top_k/bottom_k rows of the data, in sorted order
+///
+/// Unlike an order_by node followed by a fetch node this does not sort the whole input.
+/// Each thread keeps a bounded set of candidates, and rows that cannot make it into the
+/// result are rejected as soon as they arrive.  The candidates are merged and emitted
+/// once the input is finished.
+class ARROW_ACERO_EXPORT SelectKNodeOptions : public ExecNodeOptions {
+ public:
+  static constexpr std::string_view kName = "select_k";
+  explicit SelectKNodeOptions(SelectKOptions select_k_options)
+      : select_k_options(std::move(select_k_options)) {}
+
+  /// \brief how many rows to keep and the keys to select them by
+  SelectKOptions select_k_options;
+};
+
+/// \brief Route rows to a number of partitions by the hash of their keys
+///
+/// Every output batch holds rows of a single partition, all rows with equal keys land
+/// in the same partition.  The partition index of a batch is appended as an int32 column
+/// named `partition_field`, and is also part of the guarantee of the batch, so that a
+/// downstream filter on the partition index does not have to look at the rows.
+///
+/// Batches of one partition are never delivered concurrently, while batches of distinct
+/// partitions are.  A downstream node may therefore process each partition
+/// independently, keeping per-partition state without further synchronization.
+class ARROW_ACERO_EXPORT ExchangeNodeOptions : public ExecNodeOptions {
+ public:
+  static constexpr std::string_view kName = "exchange";
+  ExchangeNodeOptions(std::vector<FieldRef> keys, int num_partitions,
+                      std::string partition_field = "__partition")
+      : keys(std::move(keys)),
+        num_partitions(num_partitions),
+        partition_field(std::move(partition_field)) {}
+
+  /// \brief the keys whose hash selects the partition of a row
+  std::vector<FieldRef> keys;
+  /// \brief the number of partitions, at least 1
+  int num_partitions;
+  /// \brief the name of the int32 column holding the partition index
+  std::string partition_field;
+};
+
 enum class JoinType {
   LEFT_SEMI,
   RIGHT_SEMI,
@@ -561,6 +608,11 @@ std::string ToString(JoinType t);
 enum class JoinKeyCmp { EQ, IS };
 
 /// \brief a node which implements a join operation using a hash table
+///
+/// If both inputs are ordered by the join keys then inner, left outer, left semi and
+/// left anti joins without a residual filter are computed by merging the inputs
+/// instead.  The merge join (also available as the "mergejoin" factory) only holds the
+/// right rows of one key at a time and its output keeps the ordering of the left input.
 class ARROW_ACERO_EXPORT HashJoinNodeOptions : public ExecNodeOptions {
  public:
   static constexpr const char* default_output_suffix_for_left = "";
@@ -735,12 +787,26 @@ class ARROW_ACERO_EXPORT AsofJoinNodeOptions : public ExecNodeOptions {
   ///
   /// The tolerance is interpreted in the same units as the "on" key.
   int64_t tolerance;
+  /// \brief Number of threads that join the inputs
+  ///
+  /// Rows are distributed to the threads by the hash of their "by" key, so the rows of
+  /// each "by" key are still joined in "on" key order.  Has no effect if there is no
+  /// "by" key or if Arrow is built without threading.
+  int num_threads = 1;
+  /// \brief Whether the output of several threads is put back in the order of the left
+  /// input
+  ///
+  /// If false, output batches are emitted as soon as a thread produces them, and the
+  /// output is no longer ordered by the "on" key.  Rows of a same "by" key are still in
+  /// "on" key order.
+  bool sequence_output = true;
 };
 
 /// \brief a node which select top_k/bottom_k rows passed through it
 ///
-/// All batches pushed to this node will be accumulated, then selected, by the given
-/// fields. Then sorted batches will be forwarded to the generator in sorted order.
+/// Batches pushed to this node are reduced to a bounded set of candidates as they
+/// arrive, as described for SelectKNodeOptions. Then sorted batches will be forwarded
+/// to the generator in sorted order.
 class ARROW_ACERO_EXPORT SelectKSinkNodeOptions : public SinkNodeOptions {
  public:
   explicit SelectKSinkNodeOptions(
@@ -868,6 +934,86 @@ class ARROW_ACERO_EXPORT PivotLongerNodeOptions : public ExecNodeOptions {
   std::vector<std::string> measurement_field_names;
 };
 
+/// \brief A function computed by a window node
+///
+/// Each window function produces one value for every input row.  The following
+/// functions are computed by the node itself:
+///
+///  - "row_number": the 1-based position of the row in its partition
+///  - "rank": the row_number of the first row with the same ordering keys
+///  - "dense_rank": the number of distinct ordering keys up to and including the row
+///  - "lag" / "lead": the target value `offset` rows before / after the row in its
+///    partition, or null if there is no such row
+///
+/// Any other function is called as a vector function on the target values of each
+/// partition, which must return one value per row.  The cumulative functions (e.g.
+/// "cumulative_sum", "cumulative_max") give running aggregates over the rows from the
+/// start of the partition up to the current row.
+struct ARROW_ACERO_EXPORT WindowFunction {
+  WindowFunction() = default;
+
+  WindowFunction(std::string function, std::shared_ptr<compute::FunctionOptions> options,
+                 std::vector<FieldRef> target, std::string name = "")
+      : function(std::move(function)),
+        options(std::move(options)),
+        target(std::move(target)),
+        name(std::move(name)) {}
+
+  WindowFunction(std::string function, FieldRef target, std::string name)
+      : WindowFunction(std::move(function), /*options=*/NULLPTR,
+                       std::vector<FieldRef>{std::move(target)}, std::move(name)) {}
+
+  WindowFunction(std::string function, std::string name)
+      : WindowFunction(std::move(function), /*options=*/NULLPTR,
+                       /*target=*/std::vector<FieldRef>{}, std::move(name)) {}
+
+  /// the name of the window function
+  std::string function;
+
+  /// options for the function, only used by vector functions
+  std::shared_ptr<compute::FunctionOptions> options;
+
+  /// the field the function is applied to, empty for the ranking functions
+  std::vector<FieldRef> target;
+
+  /// optional output field name, defaults to the function name
+  std::string name;
+
+  /// number of rows to look back (lag) or ahead (lead)
+  int64_t offset = 1;
+};
+
+/// \brief Compute window functions over partitions of the input
+///
+/// This is the equivalent of `f(...) OVER (PARTITION BY partition_keys ORDER BY
+/// ordering)` in SQL, with a frame that always ends at the current row.  The output has
+/// all input columns followed by one column per window function.
+///
+/// If the input is already ordered by the partition keys (in any order or direction)
+/// followed by `ordering`, then the node streams: each partition is output as soon as
+/// the input moves past it.  Otherwise all input is accumulated and sorted first.  In
+/// both cases independent partitions are computed in parallel.
+class ARROW_ACERO_EXPORT WindowNodeOptions : public ExecNodeOptions {
+ public:
+  static constexpr std::string_view kName = "window";
+  explicit WindowNodeOptions(std::vector<WindowFunction> functions,
+                             std::vector<FieldRef> partition_keys = {},
+                             Ordering ordering = Ordering::Unordered())
+      : functions(std::move(functions)),
+        partition_keys(std::move(partition_keys)),
+        ordering(std::move(ordering)) {}
+
+  /// \brief The window functions to compute
+  std::vector<WindowFunction> functions;
+  /// \brief Rows with equal partition keys form a partition
+  std::vector<FieldRef> partition_keys;
+  /// \brief The order of the rows within each partition
+  ///
+  /// If this is unordered then the rows of a partition are taken in input order and
+  /// are all peers for "rank" and "dense_rank".
+  Ordering ordering;
+};
+
 /// @}
 
 }  // namespace acero
@@ -17,14 +17,20 @@
 
 #include "arrow/acero/order_by_impl.h"
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <vector>
 #include "arrow/acero/options.h"
+#include "arrow/acero/util.h"
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/expression.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
@@ -34,6 +40,7 @@ namespace arrow {
 
 using internal::checked_cast;
 
+using compute::ExecBatch;
 using compute::TakeOptions;
 
 namespace acero {
@@ -44,9 +51,10 @@ class SortBasicImpl : public OrderByImpl {
                 const SortOptions& options = SortOptions{})
       : ctx_(ctx), output_schema_(output_schema), options_(options) {}
 
-  void InputReceived(const std::shared_ptr<RecordBatch>& batch) override {
+  Status InputReceived(const std::shared_ptr<RecordBatch>& batch) override {
     std::unique_lock<std::mutex> lock(mutex_);
     batches_.push_back(batch);
+    return Status::OK();
   }
 
   Result<Datum> DoFinish() override {
@@ -69,24 +77,153 @@ class SortBasicImpl : public OrderByImpl {
   const SortOptions options_;
 };  // namespace compute
 
-class SelectKBasicImpl : public SortBasicImpl {
+// Keeps a bounded set of candidates per thread instead of the whole input.
+//
+// Once a thread has accumulated enough rows they are reduced to their top k.  The k-th
+// value of the first sort key then becomes a threshold: no row that compares worse
+// than it on the first key can be part of the result, so such rows are rejected as
+// soon as they arrive.  The thresholds of all threads are combined into the tightest
+// one.  The candidates of all threads are merged when the input is finished.
+class SelectKBasicImpl : public OrderByImpl {
  public:
   SelectKBasicImpl(ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
                    const SelectKOptions& options)
-      : SortBasicImpl(ctx, output_schema), options_(options) {}
+      : ctx_(ctx),
+        output_schema_(output_schema),
+        options_(options),
+        local_states_(ThreadIndexer::Capacity()) {}
+
+  Status InputReceived(const std::shared_ptr<RecordBatch>& batch) override {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> candidates, RejectRows(batch));
+    if (candidates->num_rows() == 0) {
+      return Status::OK();
+    }
+    LocalState& state = local_states_[thread_indexer_()];
+    state.num_rows += candidates->num_rows();
+    state.batches.push_back(std::move(candidates));
+    if (state.num_rows < std::max(2 * options_.k, kMinRowsToReduce)) {
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> top_k,
+                          SelectTopK(std::move(state.batches)));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> reduced,
+                          top_k->CombineChunksToBatch(ctx_->memory_pool()));
+    state.num_rows = reduced->num_rows();
+    state.batches = {reduced};
+    if (reduced->num_rows() == options_.k) {
+      RETURN_NOT_OK(UpdateThreshold(*reduced));
+    }
+    return Status::OK();
+  }
 
   Result<Datum> DoFinish() override {
-    std::unique_lock<std::mutex> lock(mutex_);
-    ARROW_ASSIGN_OR_RAISE(auto table,
-                          Table::FromRecordBatches(output_schema_, std::move(batches_)));
-    ARROW_ASSIGN_OR_RAISE(auto indices, SelectKUnstable(table, options_, ctx_));
-    return Take(table, indices, TakeOptions::NoBoundsCheck(), ctx_);
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    for (auto& state : local_states_) {
+      for (auto& batch : state.batches) {
+        batches.push_back(std::move(batch));
+      }
+    }
+    local_states_.clear();
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> top_k, SelectTopK(std::move(batches)));
+    return top_k;
   }
 
   std::string ToString() const override { return options_.ToString(); }
 
  private:
+  // Reducing too eagerly would run select_k on every (small) batch
+  static constexpr int64_t kMinRowsToReduce = 1 << 12;
+
+  struct LocalState {
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    int64_t num_rows = 0;
+  };
+
+  // The result is sorted
+  Result<std::shared_ptr<Table>> SelectTopK(
+      std::vector<std::shared_ptr<RecordBatch>> batches) {
+    ARROW_ASSIGN_OR_RAISE(auto table,
+                          Table::FromRecordBatches(output_schema_, std::move(batches)));
+    ARROW_ASSIGN_OR_RAISE(auto indices, SelectKUnstable(table, options_, ctx_));
+    ARROW_ASSIGN_OR_RAISE(Datum top_k,
+                          Take(table, indices, TakeOptions::NoBoundsCheck(), ctx_));
+    return top_k.table();
+  }
+
+  Result<std::shared_ptr<RecordBatch>> RejectRows(
+      const std::shared_ptr<RecordBatch>& batch) {
+    compute::Expression rejection_filter;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!threshold_) {
+        return batch;
+      }
+      rejection_filter = rejection_filter_;
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        Datum mask, ExecuteScalarExpression(rejection_filter, ExecBatch(*batch), ctx_));
+    if (mask.is_scalar()) {
+      const auto& keep = mask.scalar_as<BooleanScalar>();
+      return keep.is_valid && keep.value ? batch : batch->Slice(0, 0);
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        Datum filtered,
+        Filter(batch, mask, compute::FilterOptions::Defaults(), ctx_));
+    return filtered.record_batch();
+  }
+
+  // `top_k` holds exactly k sorted rows so its last row is the k-th value
+  Status UpdateThreshold(const RecordBatch& top_k) {
+    const compute::SortKey& first_key = options_.sort_keys[0];
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> column,
+                          first_key.target.GetOneFlattened(top_k));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Scalar> kth,
+                          column->GetScalar(top_k.num_rows() - 1));
+    // Nulls and NaNs are selected last, so nothing can be rejected against them
+    if (!kth->is_valid || IsNaN(*kth)) {
+      return Status::OK();
+    }
+    const bool descending = first_key.order == compute::SortOrder::Descending;
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (threshold_) {
+      ARROW_ASSIGN_OR_RAISE(Datum tighter,
+                            compute::CallFunction(descending ? "greater" : "less",
+                                                  {kth, threshold_}, ctx_));
+      if (!tighter.scalar_as<BooleanScalar>().value) {
+        return Status::OK();
+      }
+    }
+    // Rows equal to the threshold are kept since the next sort keys may break the tie
+    compute::Expression filter =
+        compute::call(descending ? "greater_equal" : "less_equal",
+                      {compute::field_ref(first_key.target), compute::literal(kth)});
+    ARROW_ASSIGN_OR_RAISE(rejection_filter_, filter.Bind(*output_schema_, ctx_));
+    threshold_ = std::move(kth);
+    return Status::OK();
+  }
+
+  static bool IsNaN(const Scalar& scalar) {
+    switch (scalar.type->id()) {
+      case Type::FLOAT:
+        return std::isnan(checked_cast<const FloatScalar&>(scalar).value);
+      case Type::DOUBLE:
+        return std::isnan(checked_cast<const DoubleScalar&>(scalar).value);
+      default:
+        return false;
+    }
+  }
+
+  ExecContext* ctx_;
+  std::shared_ptr<Schema> output_schema_;
   const SelectKOptions options_;
+
+  ThreadIndexer thread_indexer_;
+  std::vector<LocalState> local_states_;
+
+  // Guards threshold_ and rejection_filter_
+  std::mutex mutex_;
+  std::shared_ptr<Scalar> threshold_;
+  compute::Expression rejection_filter_;
 };
 
 Result<std::unique_ptr<OrderByImpl>> OrderByImpl::MakeSort(
@@ -37,7 +37,7 @@ class OrderByImpl {
  public:
   virtual ~OrderByImpl() = default;
 
-  virtual void InputReceived(const std::shared_ptr<RecordBatch>& batch) = 0;
+  virtual Status InputReceived(const std::shared_ptr<RecordBatch>& batch) = 0;
 
   virtual Result<Datum> DoFinish() = 0;
 
@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <mutex>
@@ -25,8 +26,13 @@
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/exec_plan_internal.h"
 #include "arrow/acero/options.h"
+#include "arrow/acero/order_by_impl.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/spilling_util.h"
 #include "arrow/acero/util.h"
+#include "arrow/chunk_resolver.h"
+#include "arrow/compute/kernels/vector_sort_internal.h"
+#include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/table.h"
 #include "arrow/util/checked_cast.h"
@@ -99,12 +105,29 @@ class OrderByNode : public ExecNode, public TracedNode {
     auto scope = TraceInputReceived(batch);
     DCHECK_EQ(input, inputs_[0]);
 
+    int64_t num_bytes = batch.TotalBufferSize();
     ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch,
                           batch.ToRecordBatch(output_schema_));
 
+    std::vector<std::shared_ptr<RecordBatch>> to_spill;
     {
       std::lock_guard lk(mutex_);
       accumulation_queue_.push_back(std::move(record_batch));
+      accumulated_bytes_ += num_bytes;
+      QueryContext* query_context = plan_->query_context();
+      query_context->AccountMemory(this, num_bytes);
+      const int64_t spill_limit = query_context->options().spill_memory_limit;
+      // Also spill early if the memory pool is running out of room
+      if ((spill_limit > 0 && accumulated_bytes_ > spill_limit) ||
+          query_context->under_memory_pressure()) {
+        to_spill = std::move(accumulation_queue_);
+        accumulation_queue_.clear();
+        query_context->AccountMemory(this, -accumulated_bytes_);
+        accumulated_bytes_ = 0;
+      }
+    }
+    if (!to_spill.empty()) {
+      RETURN_NOT_OK(SpillSortedRun(std::move(to_spill)));
     }
 
     if (counter_.Increment()) {
@@ -117,43 +140,391 @@ class OrderByNode : public ExecNode, public TracedNode {
     ARROW_ASSIGN_OR_RAISE(
         auto table,
         Table::FromRecordBatches(output_schema_, std::move(accumulation_queue_)));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> sorted_table, SortTable(table));
+    if (spilled_runs_.empty()) {
+      RETURN_NOT_OK(EmitTable(sorted_table));
+    } else {
+      RETURN_NOT_OK(MergeRuns(std::move(sorted_table)));
+    }
+    plan_->query_context()->ReleaseMemory(this);
+    return output_->InputFinished(this, num_output_batches_);
+  }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    std::stringstream ss;
+    ss << "ordering=" << ordering_.ToString();
+    return ss.str();
+  }
+
+ private:
+  // A sorted subset of the input, either spilled to disk or kept in memory
+  struct SortedRun {
+    std::unique_ptr<util::SpillFile> file;
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    int next_batch = 0;
+
+    int num_batches() const {
+      return file ? file->num_batches() : static_cast<int>(batches.size());
+    }
+    bool exhausted() const { return next_batch >= num_batches(); }
+  };
+
+  Result<std::shared_ptr<Table>> SortTable(const std::shared_ptr<Table>& table) {
     SortOptions sort_options(ordering_.sort_keys(), ordering_.null_placement());
     ExecContext* ctx = plan_->query_context()->exec_context();
     ARROW_ASSIGN_OR_RAISE(auto indices, SortIndices(table, sort_options, ctx));
     ARROW_ASSIGN_OR_RAISE(Datum sorted,
                           Take(table, indices, TakeOptions::NoBoundsCheck(), ctx));
-    const std::shared_ptr<Table>& sorted_table = sorted.table();
+    return sorted.table();
+  }
+
+  Status SpillSortedRun(std::vector<std::shared_ptr<RecordBatch>> batches) {
+    ARROW_ASSIGN_OR_RAISE(auto table,
+                          Table::FromRecordBatches(output_schema_, std::move(batches)));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> sorted_table, SortTable(table));
+    QueryContext* query_context = plan_->query_context();
+    {
+      std::lock_guard lk(mutex_);
+      if (!spill_store_) {
+        ARROW_ASSIGN_OR_RAISE(spill_store_,
+                              util::SpillStore::Make(query_context->memory_pool()));
+      }
+    }
+    SortedRun run;
+    ARROW_ASSIGN_OR_RAISE(run.file, spill_store_->CreateFile(output_schema_));
     TableBatchReader reader(*sorted_table);
     reader.set_chunksize(ExecPlan::kMaxBatchSize);
-    int batch_index = 0;
     while (true) {
       ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> next, reader.Next());
       if (!next) {
-        return output_->InputFinished(this, batch_index);
+        break;
+      }
+      ExecBatch exec_batch(*next);
+      auto mark = query_context->ReportTempFileIO(exec_batch.TotalBufferSize());
+      RETURN_NOT_OK(run.file->Write(exec_batch));
+    }
+    RETURN_NOT_OK(run.file->Finish());
+    std::lock_guard lk(mutex_);
+    spilled_runs_.push_back(std::move(run));
+    return Status::OK();
+  }
+
+  // Read the next non-empty batch of a run, or null if the run is exhausted
+  Result<std::shared_ptr<RecordBatch>> ReadNextBatch(SortedRun* run) {
+    MemoryPool* pool = plan_->query_context()->memory_pool();
+    while (!run->exhausted()) {
+      std::shared_ptr<RecordBatch> batch;
+      if (run->file) {
+        ARROW_ASSIGN_OR_RAISE(ExecBatch exec_batch,
+                              run->file->ReadBatch(run->next_batch));
+        ARROW_ASSIGN_OR_RAISE(batch, exec_batch.ToRecordBatch(output_schema_, pool));
+      } else {
+        batch = run->batches[run->next_batch];
+      }
+      ++run->next_batch;
+      if (batch->num_rows() > 0) {
+        return batch;
+      }
+    }
+    return nullptr;
+  }
+
+  using MergeSortKey = compute::internal::ResolvedTableSortKey;
+  using MergeComparator = compute::internal::MultipleKeyComparator<MergeSortKey>;
+
+  // Compares the rows of the current batches of the runs being merged.  Chunk i of
+  // every sort key is the current batch of run i.
+  class MergeCursors {
+   public:
+    MergeCursors(const Schema& schema, const Ordering& ordering,
+                 std::vector<std::shared_ptr<RecordBatch>> batches)
+        : schema_(schema), ordering_(ordering), batches_(std::move(batches)) {}
+
+    const RecordBatch& batch(int run) const { return *batches_[run]; }
+
+    Status Init() {
+      for (const auto& sort_key : ordering_.sort_keys()) {
+        ARROW_ASSIGN_OR_RAISE(FieldPath path, sort_key.target.FindOne(schema_));
+        paths_.push_back(std::move(path));
+      }
+      return Resolve();
+    }
+
+    // Replace the current batch of a run
+    Status SetBatch(int run, std::shared_ptr<RecordBatch> batch) {
+      batches_[run] = std::move(batch);
+      return Resolve();
+    }
+
+    // Whether `left` comes first in the merged output: rows are ordered by sort key,
+    // then by run and then by row, so the merge is stable.
+    bool Less(const ChunkLocation& left, const ChunkLocation& right) {
+      if (comparator_->Compare(left, right, 0)) {
+        return true;
+      }
+      if (!comparator_->Equals(left, right, 0)) {
+        return false;
+      }
+      if (left.chunk_index != right.chunk_index) {
+        return left.chunk_index < right.chunk_index;
+      }
+      return left.index_in_chunk < right.index_in_chunk;
+    }
+
+   private:
+    // The column comparators copy the resolved keys, so they are rebuilt as well
+    Status Resolve() {
+      comparator_.reset();
+      sort_keys_.clear();
+      for (size_t i = 0; i < paths_.size(); ++i) {
+        ARROW_ASSIGN_OR_RAISE(auto field, paths_[i].Get(schema_));
+        ArrayVector chunks;
+        chunks.reserve(batches_.size());
+        int64_t null_count = 0;
+        for (const auto& batch : batches_) {
+          ARROW_ASSIGN_OR_RAISE(auto column, paths_[i].GetFlattened(*batch));
+          null_count += column->null_count();
+          chunks.push_back(std::move(column));
+        }
+        sort_keys_.emplace_back(field->type(), std::move(chunks),
+                                ordering_.sort_keys()[i].order, null_count);
+      }
+      comparator_ =
+          std::make_unique<MergeComparator>(sort_keys_, ordering_.null_placement());
+      return comparator_->status();
+    }
+
+    const Schema& schema_;
+    const Ordering& ordering_;
+    std::vector<std::shared_ptr<RecordBatch>> batches_;
+    std::vector<FieldPath> paths_;
+    std::vector<MergeSortKey> sort_keys_;
+    std::unique_ptr<MergeComparator> comparator_;
+  };
+
+  // K-way merge of the sorted runs.
+  //
+  // A min-heap holds the next row of every run that isn't exhausted yet, ordered by
+  // (sort key, run index, row).  After popping the smallest row, the rows following it
+  // in the same run are emitted along with it as long as they still come before the
+  // new top of the heap, so that runs with little overlap are copied in slices.
+  Status MergeRuns(std::shared_ptr<Table> in_memory_run) {
+    std::vector<SortedRun> runs = std::move(spilled_runs_);
+    {
+      SortedRun run;
+      ARROW_ASSIGN_OR_RAISE(run.batches,
+                            TableBatchReader(*in_memory_run).ToRecordBatches());
+      runs.push_back(std::move(run));
+    }
+    in_memory_run.reset();
+
+    const int num_runs = static_cast<int>(runs.size());
+    std::vector<std::shared_ptr<RecordBatch>> batches(num_runs);
+    std::vector<ChunkLocation> heap;
+    for (int i = 0; i < num_runs; ++i) {
+      ARROW_ASSIGN_OR_RAISE(batches[i], ReadNextBatch(&runs[i]));
+      if (batches[i]) {
+        heap.emplace_back(i, 0);
+      } else {
+        ARROW_ASSIGN_OR_RAISE(batches[i], RecordBatch::MakeEmpty(output_schema_));
+      }
+    }
+    MergeCursors cursors(*output_schema_, ordering_, std::move(batches));
+    RETURN_NOT_OK(cursors.Init());
+    auto greater = [&](const ChunkLocation& left, const ChunkLocation& right) {
+      return cursors.Less(right, left);
+    };
+    std::make_heap(heap.begin(), heap.end(), greater);
+
+    std::vector<std::shared_ptr<RecordBatch>> output;
+    int64_t output_rows = 0;
+    while (!heap.empty()) {
+      std::pop_heap(heap.begin(), heap.end(), greater);
+      const ChunkLocation next = heap.back();
+      heap.pop_back();
+
+      const int run = static_cast<int>(next.chunk_index);
+      const RecordBatch& batch = cursors.batch(run);
+      const int64_t max_end =
+          std::min(batch.num_rows(),
+                   next.index_in_chunk + ExecPlan::kMaxBatchSize - output_rows);
+      int64_t end = next.index_in_chunk + 1;
+      while (end < max_end &&
+             (heap.empty() || cursors.Less(ChunkLocation(run, end), heap.front()))) {
+        ++end;
+      }
+      output.push_back(batch.Slice(next.index_in_chunk, end - next.index_in_chunk));
+      output_rows += end - next.index_in_chunk;
+      if (output_rows >= ExecPlan::kMaxBatchSize) {
+        RETURN_NOT_OK(EmitMerged(std::move(output)));
+        output.clear();
+        output_rows = 0;
+      }
+
+      if (end < batch.num_rows()) {
+        heap.emplace_back(run, end);
+      } else {
+        ARROW_ASSIGN_OR_RAISE(auto next_batch, ReadNextBatch(&runs[run]));
+        if (!next_batch) {
+          continue;
+        }
+        RETURN_NOT_OK(cursors.SetBatch(run, std::move(next_batch)));
+        heap.emplace_back(run, 0);
+      }
+      std::push_heap(heap.begin(), heap.end(), greater);
+    }
+    if (!output.empty()) {
+      RETURN_NOT_OK(EmitMerged(std::move(output)));
+    }
+    return Status::OK();
+  }
+
+  // Emit slices of the runs as one batch
+  Status EmitMerged(std::vector<std::shared_ptr<RecordBatch>> slices) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto batch,
+        ConcatenateRecordBatches(slices, plan_->query_context()->memory_pool()));
+    EmitBatch(std::move(batch));
+    return Status::OK();
+  }
+
+  Status EmitTable(std::shared_ptr<Table> table) {
+    TableBatchReader reader(*table);
+    reader.set_chunksize(ExecPlan::kMaxBatchSize);
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> next, reader.Next());
+      if (!next) {
+        return Status::OK();
+      }
+      EmitBatch(std::move(next));
+    }
+  }
+
+  void EmitBatch(std::shared_ptr<RecordBatch> batch) {
+    int index = num_output_batches_++;
+    plan_->query_context()->ScheduleTask(
+        [this, batch = std::move(batch), index]() mutable {
+          ExecBatch exec_batch(*batch);
+          exec_batch.index = index;
+          return output_->InputReceived(this, std::move(exec_batch));
+        },
+        "OrderByNode::ProcessBatch");
+  }
+
+  AtomicCounter counter_;
+  Ordering ordering_;
+  std::vector<std::shared_ptr<RecordBatch>> accumulation_queue_;
+  int64_t accumulated_bytes_ = 0;
+  std::unique_ptr<util::SpillStore> spill_store_;
+  std::vector<SortedRun> spilled_runs_;
+  int num_output_batches_ = 0;
+  std::mutex mutex_;
+};
+
+class SelectKNode : public ExecNode, public TracedNode {
+ public:
+  SelectKNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+              std::shared_ptr<Schema> output_schema, std::unique_ptr<OrderByImpl> impl,
+              Ordering ordering)
+      : ExecNode(plan, std::move(inputs), {"input"}, std::move(output_schema)),
+        TracedNode(this),
+        impl_(std::move(impl)),
+        ordering_(std::move(ordering)) {}
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "SelectKNode"));
+
+    const auto& select_k_options =
+        checked_cast<const SelectKNodeOptions&>(options).select_k_options;
+    if (select_k_options.k <= 0) {
+      return Status::Invalid("`k` must be > 0");
+    }
+    if (select_k_options.sort_keys.empty()) {
+      return Status::Invalid("`sort_keys` must not be empty");
+    }
+    std::shared_ptr<Schema> output_schema = inputs[0]->output_schema();
+    for (const auto& sort_key : select_k_options.sort_keys) {
+      RETURN_NOT_OK(sort_key.target.FindOne(*output_schema));
+    }
+    ARROW_ASSIGN_OR_RAISE(std::unique_ptr<OrderByImpl> impl,
+                          OrderByImpl::MakeSelectK(plan->query_context()->exec_context(),
+                                                   output_schema, select_k_options));
+    // select_k places nulls last whatever the sort order
+    Ordering ordering(select_k_options.sort_keys, compute::NullPlacement::AtEnd);
+    return plan->EmplaceNode<SelectKNode>(plan, std::move(inputs),
+                                          std::move(output_schema), std::move(impl),
+                                          std::move(ordering));
+  }
+
+  const char* kind_name() const override { return "SelectKNode"; }
+
+  const Ordering& ordering() const override { return ordering_; }
+
+  Status InputFinished(ExecNode* input, int total_batches) override {
+    DCHECK_EQ(input, inputs_[0]);
+    EVENT_ON_CURRENT_SPAN("InputFinished", {{"batches.length", total_batches}});
+    if (counter_.SetTotal(total_batches)) {
+      return DoFinish();
+    }
+    return Status::OK();
+  }
+
+  Status StartProducing() override {
+    NoteStartProducing(ToStringExtra());
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->PauseProducing(this, counter);
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->ResumeProducing(this, counter);
+  }
+
+  Status StopProducingImpl() override { return Status::OK(); }
+
+  Status InputReceived(ExecNode* input, ExecBatch batch) override {
+    auto scope = TraceInputReceived(batch);
+    DCHECK_EQ(input, inputs_[0]);
+
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch,
+                          batch.ToRecordBatch(output_schema_));
+    RETURN_NOT_OK(impl_->InputReceived(record_batch));
+    if (counter_.Increment()) {
+      return DoFinish();
+    }
+    return Status::OK();
+  }
+
+  Status DoFinish() {
+    ARROW_ASSIGN_OR_RAISE(Datum top_k, impl_->DoFinish());
+    TableBatchReader reader(*top_k.table());
+    reader.set_chunksize(ExecPlan::kMaxBatchSize);
+    int num_output_batches = 0;
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> next, reader.Next());
+      if (!next) {
+        break;
       }
-      int index = batch_index++;
-      plan_->query_context()->ScheduleTask(
-          [this, batch = std::move(next), index]() mutable {
-            ExecBatch exec_batch(*batch);
-            exec_batch.index = index;
-            return output_->InputReceived(this, std::move(exec_batch));
-          },
-          "OrderByNode::ProcessBatch");
+      ExecBatch exec_batch(*next);
+      exec_batch.index = num_output_batches++;
+      RETURN_NOT_OK(output_->InputReceived(this, std::move(exec_batch)));
     }
+    return output_->InputFinished(this, num_output_batches);
   }
 
  protected:
   std::string ToStringExtra(int indent = 0) const override {
-    std::stringstream ss;
-    ss << "ordering=" << ordering_.ToString();
-    return ss.str();
+    return std::string("by=") + impl_->ToString();
   }
 
  private:
   AtomicCounter counter_;
+  std::unique_ptr<OrderByImpl> impl_;
   Ordering ordering_;
-  std::vector<std::shared_ptr<RecordBatch>> accumulation_queue_;
-  std::mutex mutex_;
 };
 
 }  // namespace
@@ -163,6 +534,8 @@ namespace internal {
 void RegisterOrderByNode(ExecFactoryRegistry* registry) {
   DCHECK_OK(
       registry->AddFactory(std::string(OrderByNodeOptions::kName), OrderByNode::Make));
+  DCHECK_OK(
+      registry->AddFactory(std::string(SelectKNodeOptions::kName), SelectKNode::Make));
 }
 
 }  // namespace internal
@@ -22,6 +22,7 @@
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/test_nodes.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/table.h"
 #include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
@@ -47,7 +48,8 @@ std::shared_ptr<Table> TestTable() {
       ->Table(kRowsPerBatch, kNumBatches);
 }
 
-void CheckOrderBy(OrderByNodeOptions options) {
+void CheckOrderBy(OrderByNodeOptions options, int64_t spill_memory_limit = 0,
+                  int64_t memory_budget = 0) {
   constexpr random::SeedType kSeed = 42;
   constexpr int kJitterMod = 4;
   RegisterTestNodes();
@@ -60,6 +62,8 @@ void CheckOrderBy(OrderByNodeOptions options) {
     QueryOptions query_options;
     query_options.sequence_output = true;
     query_options.use_threads = use_threads;
+    query_options.spill_memory_limit = spill_memory_limit;
+    query_options.memory_budget = memory_budget;
     ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
                          DeclarationToTable(plan, query_options));
 
@@ -82,6 +86,80 @@ TEST(OrderByNode, Basic) {
       OrderByNodeOptions({{SortKey("up"), SortKey("down", SortOrder::Descending)}}));
 }
 
+TEST(OrderByNode, Spilling) {
+  // Spill every batch as its own run, then every few batches
+  for (int64_t spill_memory_limit : {1, 100}) {
+    ARROW_SCOPED_TRACE("spill_memory_limit=", spill_memory_limit);
+    CheckOrderBy(OrderByNodeOptions({{SortKey("up")}}), spill_memory_limit);
+    CheckOrderBy(OrderByNodeOptions({{SortKey("down", SortOrder::Descending)}}),
+                 spill_memory_limit);
+    CheckOrderBy(
+        OrderByNodeOptions({{SortKey("up"), SortKey("down", SortOrder::Descending)}}),
+        spill_memory_limit);
+  }
+}
+
+TEST(OrderByNode, MemoryBudget) {
+  // Going over the budget of the plan spills like the spill limit of the node does
+  for (int64_t memory_budget : {1, 100}) {
+    ARROW_SCOPED_TRACE("memory_budget=", memory_budget);
+    CheckOrderBy(OrderByNodeOptions({{SortKey("up")}}), /*spill_memory_limit=*/0,
+                 memory_budget);
+    CheckOrderBy(OrderByNodeOptions({{SortKey("down", SortOrder::Descending)}}),
+                 /*spill_memory_limit=*/0, memory_budget);
+  }
+}
+
+TEST(OrderByNode, SpillingWithDuplicateKeys) {
+  RegisterTestNodes();
+  std::shared_ptr<Table> input =
+      gen::Gen({{"key", gen::Random(uint8())}, {"value", gen::Step()}})
+          ->FailOnError()
+          ->Table(/*rows_per_chunk=*/128, /*num_chunks=*/16);
+  Ordering ordering({SortKey("key"), SortKey("value")});
+  Declaration plan =
+      Declaration::Sequence({{"table_source", TableSourceNodeOptions(input)},
+                             {"order_by", OrderByNodeOptions(ordering)}});
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> expected, DeclarationToTable(plan));
+
+  QueryOptions query_options;
+  query_options.sequence_output = true;
+  query_options.spill_memory_limit = 1024;
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                       DeclarationToTable(plan, query_options));
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST(OrderByNode, SpillingIsStable) {
+  // Rows with equal keys are spread over several runs and must keep their input order,
+  // also when the runs are merged more than one batch at a time
+  RegisterTestNodes();
+  // Every key repeats every 256 rows
+  std::shared_ptr<Table> input =
+      gen::Gen({{"key", gen::Step<uint8_t>(/*start=*/0, /*step=*/7)},
+                {"value", gen::Step()}})
+          ->FailOnError()
+          ->Table(/*rows_per_chunk=*/ExecPlan::kMaxBatchSize / 2, /*num_chunks=*/16);
+  for (auto order : {SortOrder::Ascending, SortOrder::Descending}) {
+    Ordering ordering({SortKey("key", order)});
+    ASSERT_OK_AND_ASSIGN(auto indices,
+                         compute::SortIndices(input, compute::SortOptions(ordering)));
+    ASSERT_OK_AND_ASSIGN(Datum expected, compute::Take(input, indices));
+
+    Declaration plan =
+        Declaration::Sequence({{"table_source", TableSourceNodeOptions(input)},
+                               {"order_by", OrderByNodeOptions(ordering)}});
+    QueryOptions query_options;
+    query_options.sequence_output = true;
+    query_options.use_threads = false;
+    // Runs of three input batches, which are read back as two batches
+    query_options.spill_memory_limit = 200 * 1024;
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                         DeclarationToTable(plan, query_options));
+    AssertTablesEqual(*expected.table(), *actual, /*same_chunk_layout=*/false);
+  }
+}
+
 TEST(OrderByNode, Large) {
   constexpr random::SeedType kSeed = 42;
   constexpr int kJitterMod = 4;
@@ -117,5 +195,61 @@ TEST(OrderByNode, Invalid) {
                       "`ordering` must be an explicit non-empty ordering");
 }
 
+void CheckSelectK(std::vector<SortKey> sort_keys) {
+  constexpr random::SeedType kSeed = 42;
+  constexpr int kJitterMod = 4;
+  constexpr int64_t kK = 100;
+  RegisterTestNodes();
+  // Many ties on the first key, broken by the second one.  Enough rows that the
+  // candidates are reduced and later batches are checked against a threshold.
+  std::shared_ptr<Table> input =
+      gen::Gen({{"key", gen::Random(int8())}, {"up", gen::Step()}})
+          ->FailOnError()
+          ->Table(/*rows_per_chunk=*/1024, /*num_chunks=*/64);
+  // select_k places nulls last
+  Ordering ordering(sort_keys, compute::NullPlacement::AtEnd);
+  Declaration expected_plan =
+      Declaration::Sequence({{"table_source", TableSourceNodeOptions(input)},
+                             {"order_by", OrderByNodeOptions(std::move(ordering))},
+                             {"fetch", FetchNodeOptions(0, kK)}});
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> expected,
+                       DeclarationToTable(std::move(expected_plan)));
+  Declaration plan = Declaration::Sequence(
+      {{"table_source", TableSourceNodeOptions(input)},
+       {"jitter", JitterNodeOptions(kSeed, kJitterMod)},
+       {"select_k", SelectKNodeOptions(SelectKOptions(kK, std::move(sort_keys)))}});
+  for (bool use_threads : {false, true}) {
+    QueryOptions query_options;
+    query_options.sequence_output = true;
+    query_options.use_threads = use_threads;
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                         DeclarationToTable(plan, query_options));
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+}
+
+TEST(SelectKNode, Basic) {
+  CheckSelectK({SortKey("up", SortOrder::Descending)});
+  CheckSelectK({SortKey("up", SortOrder::Ascending)});
+}
+
+TEST(SelectKNode, Ties) {
+  CheckSelectK({SortKey("key", SortOrder::Descending), SortKey("up")});
+  CheckSelectK({SortKey("key", SortOrder::Ascending), SortKey("up")});
+}
+
+TEST(SelectKNode, Invalid) {
+  std::shared_ptr<Table> input = TestTable();
+  auto check_invalid = [&](SelectKOptions options, const std::string& message) {
+    Declaration plan =
+        Declaration::Sequence({{"table_source", TableSourceNodeOptions(input)},
+                               {"select_k", SelectKNodeOptions(std::move(options))}});
+    EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, testing::HasSubstr(message),
+                                    DeclarationToStatus(std::move(plan)));
+  };
+  check_invalid(SelectKOptions(0, {SortKey("up")}), "`k` must be > 0");
+  check_invalid(SelectKOptions(1, {}), "`sort_keys` must not be empty");
+}
+
 }  // namespace acero
 }  // namespace arrow
@@ -19,12 +19,16 @@
 
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <set>
 
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
+#include "arrow/acero/profile.h"
 #include "arrow/acero/test_nodes.h"
 #include "arrow/acero/test_util_internal.h"
 #include "arrow/acero/util.h"
+#include "arrow/array/array_primitive.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/expression.h"
 #include "arrow/compute/test_util_internal.h"
@@ -37,6 +41,7 @@
 #include "arrow/testing/matchers.h"
 #include "arrow/testing/random.h"
 #include "arrow/util/async_generator.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/config.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
@@ -52,6 +57,8 @@ using testing::UnorderedElementsAreArray;
 
 namespace arrow {
 
+using internal::checked_cast;
+
 using compute::ArgShape;
 using compute::call;
 using compute::CountOptions;
@@ -224,6 +231,147 @@ TEST(ExecPlanExecution, SourceSink) {
   }
 }
 
+namespace {
+
+// Forwards tasks to another executor, recording the priority they were spawned with
+class PriorityRecordingExecutor : public ::arrow::internal::Executor {
+ public:
+  explicit PriorityRecordingExecutor(::arrow::internal::Executor* target)
+      : target_(target) {}
+
+  int GetCapacity() override { return target_->GetCapacity(); }
+
+  std::vector<int32_t> priorities() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return priorities_;
+  }
+
+ protected:
+  Status SpawnReal(::arrow::internal::TaskHints hints,
+                   ::arrow::internal::FnOnce<void()> task, StopToken stop_token,
+                   StopCallback&& stop_callback) override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      priorities_.push_back(hints.priority);
+    }
+    return target_->Spawn(hints, std::move(task), std::move(stop_token),
+                          std::move(stop_callback));
+  }
+
+ private:
+  ::arrow::internal::Executor* target_;
+  std::mutex mutex_;
+  std::vector<int32_t> priorities_;
+};
+
+}  // namespace
+
+TEST(ExecPlanExecution, TaskPriority) {
+  constexpr int32_t kPriority = -7;
+  PriorityRecordingExecutor executor(::arrow::internal::GetCpuThreadPool());
+  ExecContext exec_context(default_memory_pool(), &executor);
+  QueryOptions query_options;
+  query_options.task_priority = kPriority;
+
+  auto basic_data = MakeBasicBatches();
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(query_options, exec_context));
+  AsyncGenerator<std::optional<ExecBatch>> sink_gen;
+  ASSERT_OK(Declaration::Sequence(
+                {{"source", SourceNodeOptions{basic_data.schema,
+                                              basic_data.gen(/*parallel=*/true,
+                                                             /*slow=*/false)}},
+                 {"sink", SinkNodeOptions{&sink_gen}}})
+                .AddToPlan(plan.get()));
+  ASSERT_THAT(StartAndCollect(plan.get(), sink_gen),
+              Finishes(ResultWith(UnorderedElementsAreArray(basic_data.batches))));
+
+  std::vector<int32_t> priorities = executor.priorities();
+  ASSERT_FALSE(priorities.empty());
+  for (int32_t priority : priorities) {
+    ASSERT_EQ(kPriority, priority);
+  }
+}
+
+TEST(ExecPlanExecution, Profile) {
+  random::RandomArrayGenerator rng(42);
+  auto input = Table::Make(schema({field("i", int32())}),
+                           {rng.Int32(1000, 0, 100, /*null_probability=*/0)});
+  for (bool use_threads : {false, true}) {
+    SCOPED_TRACE(use_threads ? "parallel" : "serial");
+    Declaration plan = Declaration::Sequence(
+        {{"table_source", TableSourceNodeOptions(input, /*max_batch_size=*/100)},
+         {"filter", FilterNodeOptions(less(field_ref("i"), literal(50)))},
+         {"project",
+          ProjectNodeOptions({call("multiply", {field_ref("i"), literal(2)})})}});
+    QueryOptions query_options;
+    query_options.use_threads = use_threads;
+    query_options.profile = std::make_shared<PlanProfile>();
+    ASSERT_OK_AND_ASSIGN(auto result, DeclarationToTable(std::move(plan), query_options));
+
+    ASSERT_OK_AND_ASSIGN(auto profile, query_options.profile->ToTable());
+    ASSERT_OK(profile->ValidateFull());
+    ASSERT_EQ(profile->num_rows(), 4);
+    ASSERT_EQ(profile->num_columns(), 10);
+    ASSERT_OK_AND_ASSIGN(auto batch, profile->CombineChunksToBatch());
+    auto column = [&](const std::string& name) -> const Int64Array& {
+      return checked_cast<const Int64Array&>(*batch->GetColumnByName(name));
+    };
+    // The nodes are listed from the source to the sink
+    const auto& rows_in = column("rows_in");
+    const auto& rows_out = column("rows_out");
+    ASSERT_EQ(rows_in.Value(0), 0);
+    ASSERT_EQ(rows_out.Value(0), input->num_rows());
+    ASSERT_EQ(column("batches_out").Value(0), 10);
+    ASSERT_EQ(rows_in.Value(1), input->num_rows());
+    ASSERT_EQ(rows_out.Value(1), result->num_rows());
+    ASSERT_EQ(rows_in.Value(2), result->num_rows());
+    ASSERT_EQ(rows_out.Value(2), result->num_rows());
+    ASSERT_EQ(rows_in.Value(3), result->num_rows());
+    ASSERT_EQ(rows_out.Value(3), 0);
+    ASSERT_EQ(column("batches_in").Value(3), column("batches_out").Value(2));
+    // The project node allocates its output
+    ASSERT_GE(column("bytes_allocated").Value(2), result->num_rows() * 4);
+    ASSERT_GT(column("peak_bytes").Value(2), 0);
+    ASSERT_GT(column("processing_ns").Value(2), 0);
+  }
+}
+
+TEST(ExecPlanExecution, TargetBatchBytes) {
+  random::RandomArrayGenerator rng(42);
+  constexpr int64_t kNumRows = 100000;
+  auto narrow = Table::Make(schema({field("i", int64())}),
+                            {rng.Int64(kNumRows, 0, 100, /*null_probability=*/0)});
+  auto wide = Table::Make(schema({field("s", utf8())}),
+                          {rng.String(kNumRows, 200, 200, /*null_probability=*/0)});
+  auto batch_lengths = [&](std::shared_ptr<Table> table,
+                          std::optional<int64_t> target_batch_bytes) {
+    QueryOptions query_options;
+    query_options.target_batch_bytes = target_batch_bytes;
+    EXPECT_OK_AND_ASSIGN(
+        auto result, DeclarationToExecBatches(
+                         {"table_source", TableSourceNodeOptions(std::move(table))},
+                         query_options));
+    std::set<int64_t> lengths;
+    int64_t num_rows = 0;
+    for (const ExecBatch& batch : result.batches) {
+      lengths.insert(batch.length);
+      num_rows += batch.length;
+    }
+    EXPECT_EQ(num_rows, kNumRows);
+    return lengths;
+  };
+  // By default batches have the same number of rows however wide the rows are
+  ASSERT_EQ(*batch_lengths(narrow, std::nullopt).rbegin(), ExecPlan::kMaxBatchSize);
+  ASSERT_EQ(*batch_lengths(wide, std::nullopt).rbegin(), ExecPlan::kMaxBatchSize);
+  // 8 bytes per row
+  ASSERT_EQ(*batch_lengths(narrow, 64 * 1024).rbegin(), 8 * 1024);
+  // About 200 bytes per row, at least 1024 rows per batch
+  ASSERT_EQ(*batch_lengths(wide, 64 * 1024).rbegin(), 1024);
+  const int64_t wide_length = *batch_lengths(wide, 1024 * 1024).rbegin();
+  ASSERT_GE(wide_length, 1024 * 1024 / 210);
+  ASSERT_LE(wide_length, 1024 * 1024 / 200);
+}
+
 TEST(ExecPlanExecution, UseSinkAfterExecution) {
   AsyncGenerator<std::optional<ExecBatch>> sink_gen;
   {
@@ -1026,6 +1174,23 @@ TEST(ExecPlanExecution, SourceFilterSink) {
   AssertExecBatchesEqualIgnoringOrder(result.schema, result.batches, exp_batches);
 }
 
+TEST(ExecPlanExecution, SourceFilterFilterProjectSink) {
+  // The first filter defers its selection to the second one and to the project node
+  auto basic_data = MakeBasicBatches();
+  Declaration plan = Declaration::Sequence(
+      {{"source", SourceNodeOptions{basic_data.schema, basic_data.gen(/*parallel=*/false,
+                                                                      /*slow=*/false)}},
+       {"filter", FilterNodeOptions{greater_equal(field_ref("i32"), literal(4))}},
+       {"filter", FilterNodeOptions{not_(field_ref("bool"))}},
+       {"project", ProjectNodeOptions{{call("add", {field_ref("i32"), literal(1)})},
+                                      {"i32 + 1"}}}});
+
+  auto exp_batches = {ExecBatchFromJSON({int32()}, "[[5]]"),
+                      ExecBatchFromJSON({int32()}, "[[7], [8]]")};
+  ASSERT_OK_AND_ASSIGN(auto result, DeclarationToExecBatches(std::move(plan)));
+  AssertExecBatchesEqualIgnoringOrder(result.schema, result.batches, exp_batches);
+}
+
 TEST(ExecPlanExecution, SourceProjectSink) {
   auto basic_data = MakeBasicBatches();
   Declaration plan = Declaration::Sequence(
@@ -1523,8 +1688,10 @@ TEST(ExecPlanExecution, ScalarSourceGroupedSum) {
 }
 
 TEST(ExecPlanExecution, SelfInnerHashJoinSink) {
-  for (bool parallel : {false, true}) {
+  for (auto [parallel, use_scratch_arena] :
+       std::vector<std::pair<bool, bool>>{{false, false}, {true, false}, {true, true}}) {
     SCOPED_TRACE(parallel ? "parallel/merged" : "serial");
+    SCOPED_TRACE(use_scratch_arena ? "scratch arena" : "no scratch arena");
 
     auto input = MakeGroupableBatches();
 
@@ -1546,8 +1713,11 @@ TEST(ExecPlanExecution, SelfInnerHashJoinSink) {
 
     auto plan = Declaration("hashjoin", {left, right}, std::move(join_opts));
 
+    QueryOptions query_options;
+    query_options.use_threads = parallel;
+    query_options.use_scratch_arena = use_scratch_arena;
     ASSERT_OK_AND_ASSIGN(auto result,
-                         DeclarationToExecBatches(std::move(plan), parallel));
+                         DeclarationToExecBatches(std::move(plan), query_options));
 
     std::vector<ExecBatch> expected = {
         ExecBatchFromJSON({int32(), utf8(), int32(), utf8()}, R"([
@@ -0,0 +1,232 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/acero/profile.h"
+
+#include <algorithm>
+#include <chrono>
+#include <new>
+#include <unordered_map>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/table.h"
+
+namespace arrow {
+namespace acero {
+
+namespace {
+
+int64_t NowNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+thread_local NodeProfileScope* current_scope = NULLPTR;
+thread_local NodeProfile* current_profile = NULLPTR;
+
+// Prefixes each allocation with a header holding a reference to the profile of the node
+// which allocated it, so that it can be released against the same node
+class ProfilingMemoryPoolImpl : public MemoryPool {
+ public:
+  explicit ProfilingMemoryPoolImpl(MemoryPool* pool) : pool_(pool) {}
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override {
+    const int64_t header_size = HeaderSize(alignment);
+    uint8_t* raw;
+    RETURN_NOT_OK(pool_->Allocate(size + header_size, alignment, &raw));
+    NodeProfile* profile = current_profile;
+    if (profile != NULLPTR) {
+      profile->RecordAllocation(size);
+      new (raw) std::shared_ptr<NodeProfile>(profile->shared_from_this());
+    } else {
+      new (raw) std::shared_ptr<NodeProfile>();
+    }
+    *out = raw + header_size;
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) override {
+    const int64_t header_size = HeaderSize(alignment);
+    uint8_t* raw = *ptr - header_size;
+    RETURN_NOT_OK(pool_->Reallocate(old_size + header_size, new_size + header_size,
+                                    alignment, &raw));
+    // The header was moved along with the data, and still owns its reference
+    const auto& profile = *reinterpret_cast<std::shared_ptr<NodeProfile>*>(raw);
+    if (profile) {
+      if (new_size > old_size) {
+        profile->RecordAllocation(new_size - old_size);
+      } else {
+        profile->RecordFree(old_size - new_size);
+      }
+    }
+    *ptr = raw + header_size;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override {
+    const int64_t header_size = HeaderSize(alignment);
+    uint8_t* raw = buffer - header_size;
+    auto* profile = reinterpret_cast<std::shared_ptr<NodeProfile>*>(raw);
+    if (*profile) {
+      (*profile)->RecordFree(size);
+    }
+    profile->~shared_ptr();
+    pool_->Free(raw, size + header_size, alignment);
+  }
+
+  void ReleaseUnused() override { pool_->ReleaseUnused(); }
+  void PrintStats() override { pool_->PrintStats(); }
+  int64_t bytes_allocated() const override { return pool_->bytes_allocated(); }
+  int64_t max_memory() const override { return pool_->max_memory(); }
+  int64_t total_bytes_allocated() const override {
+    return pool_->total_bytes_allocated();
+  }
+  int64_t num_allocations() const override { return pool_->num_allocations(); }
+  std::string backend_name() const override { return pool_->backend_name(); }
+
+ private:
+  // A multiple of the alignment which can hold the header
+  static int64_t HeaderSize(int64_t alignment) {
+    return std::max<int64_t>(alignment,
+                             static_cast<int64_t>(sizeof(std::shared_ptr<NodeProfile>)));
+  }
+
+  MemoryPool* pool_;
+};
+
+}  // namespace
+
+void NodeProfile::RecordPause() {
+  int64_t expected = -1;
+  paused_since_.compare_exchange_strong(expected, NowNanos());
+}
+
+void NodeProfile::RecordResume() {
+  const int64_t since = paused_since_.exchange(-1);
+  if (since >= 0) {
+    paused_nanos_.fetch_add(NowNanos() - since, std::memory_order_relaxed);
+  }
+}
+
+void NodeProfile::RecordAllocation(int64_t bytes) {
+  bytes_allocated_.fetch_add(bytes, std::memory_order_relaxed);
+  const int64_t in_use =
+      bytes_in_use_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  int64_t peak = peak_bytes_.load(std::memory_order_relaxed);
+  while (in_use > peak &&
+         !peak_bytes_.compare_exchange_weak(peak, in_use, std::memory_order_relaxed)) {
+  }
+}
+
+PlanProfile::PlanProfile() = default;
+PlanProfile::~PlanProfile() = default;
+
+NodeProfile* PlanProfile::AddNode(const ExecNode& node) {
+  auto profile = std::make_shared<NodeProfile>(node.label(), node.kind_name());
+  std::lock_guard<std::mutex> lk(mutex_);
+  nodes_.push_back(profile);
+  return profile.get();
+}
+
+std::vector<const NodeProfile*> PlanProfile::nodes() const {
+  std::lock_guard<std::mutex> lk(mutex_);
+  std::vector<const NodeProfile*> out;
+  out.reserve(nodes_.size());
+  for (const auto& node : nodes_) {
+    out.push_back(node.get());
+  }
+  return out;
+}
+
+Result<std::shared_ptr<Table>> PlanProfile::ToTable(MemoryPool* pool) const {
+  std::vector<const NodeProfile*> profiles = nodes();
+  StringBuilder labels(pool), kinds(pool);
+  using Getter = int64_t (NodeProfile::*)() const;
+  const std::vector<std::pair<std::string, Getter>> counters = {
+      {"rows_in", &NodeProfile::rows_in},
+      {"batches_in", &NodeProfile::batches_in},
+      {"rows_out", &NodeProfile::rows_out},
+      {"batches_out", &NodeProfile::batches_out},
+      {"processing_ns", &NodeProfile::processing_nanos},
+      {"paused_ns", &NodeProfile::paused_nanos},
+      {"bytes_allocated", &NodeProfile::bytes_allocated},
+      {"peak_bytes", &NodeProfile::peak_bytes}};
+  for (const NodeProfile* profile : profiles) {
+    RETURN_NOT_OK(labels.Append(profile->label()));
+    RETURN_NOT_OK(kinds.Append(profile->kind()));
+  }
+
+  FieldVector fields = {field("label", utf8()), field("kind", utf8())};
+  ArrayVector columns(2);
+  RETURN_NOT_OK(labels.Finish(&columns[0]));
+  RETURN_NOT_OK(kinds.Finish(&columns[1]));
+  Int64Builder counter_builder(pool);
+  for (const auto& counter : counters) {
+    for (const NodeProfile* profile : profiles) {
+      RETURN_NOT_OK(counter_builder.Append((profile->*counter.second)()));
+    }
+    fields.push_back(field(counter.first, int64()));
+    ARROW_ASSIGN_OR_RAISE(auto column, counter_builder.Finish());
+    columns.push_back(std::move(column));
+  }
+  return Table::Make(schema(std::move(fields)), std::move(columns));
+}
+
+MemoryPool* PlanProfile::ProfilingMemoryPool(MemoryPool* pool) {
+  static std::mutex mutex;
+  // Leaked since buffers may be freed during static destruction
+  static auto* pools =
+      new std::unordered_map<MemoryPool*, std::unique_ptr<ProfilingMemoryPoolImpl>>();
+  std::lock_guard<std::mutex> lk(mutex);
+  auto& profiling_pool = (*pools)[pool];
+  if (!profiling_pool) {
+    profiling_pool = std::make_unique<ProfilingMemoryPoolImpl>(pool);
+  }
+  return profiling_pool.get();
+}
+
+NodeProfileScope::NodeProfileScope(NodeProfile* profile) : profile_(profile) {
+  if (profile_ == NULLPTR) {
+    return;
+  }
+  parent_ = current_scope;
+  current_scope = this;
+  current_profile = profile_;
+  start_nanos_ = NowNanos();
+}
+
+NodeProfileScope::~NodeProfileScope() {
+  if (profile_ == NULLPTR) {
+    return;
+  }
+  const int64_t elapsed = NowNanos() - start_nanos_;
+  profile_->RecordProcessing(elapsed - inner_nanos_);
+  if (parent_ != NULLPTR) {
+    parent_->inner_nanos_ += elapsed;
+  }
+  current_scope = parent_;
+  current_profile = parent_ != NULLPTR ? parent_->profile_ : NULLPTR;
+}
+
+NodeProfile* NodeProfileScope::Current() { return current_profile; }
+
+}  // namespace acero
+}  // namespace arrow
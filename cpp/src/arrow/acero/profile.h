@@ -0,0 +1,159 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "arrow/acero/type_fwd.h"
+#include "arrow/acero/visibility.h"
+#include "arrow/memory_pool.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace acero {
+
+/// \brief Runtime statistics of one node of a plan
+///
+/// The statistics are updated by the node (through TracedNode) while the plan runs,
+/// from any thread.  The buffers allocated during calls of the node keep its statistics
+/// alive, so that freeing them after the plan is gone is safe.
+class ARROW_ACERO_EXPORT NodeProfile : public std::enable_shared_from_this<NodeProfile> {
+ public:
+  NodeProfile(std::string label, std::string kind)
+      : label_(std::move(label)), kind_(std::move(kind)) {}
+
+  const std::string& label() const { return label_; }
+  const std::string& kind() const { return kind_; }
+
+  void RecordInput(int64_t rows) {
+    rows_in_.fetch_add(rows, std::memory_order_relaxed);
+    batches_in_.fetch_add(1, std::memory_order_relaxed);
+  }
+  void RecordOutput(int64_t rows) {
+    rows_out_.fetch_add(rows, std::memory_order_relaxed);
+    batches_out_.fetch_add(1, std::memory_order_relaxed);
+  }
+  void RecordProcessing(int64_t nanos) {
+    processing_nanos_.fetch_add(nanos, std::memory_order_relaxed);
+  }
+  /// \brief Record that the node stopped producing because of backpressure
+  void RecordPause();
+  /// \brief Record that the node resumed producing after RecordPause
+  void RecordResume();
+  void RecordAllocation(int64_t bytes);
+  void RecordFree(int64_t bytes) {
+    bytes_in_use_.fetch_sub(bytes, std::memory_order_relaxed);
+  }
+
+  int64_t rows_in() const { return rows_in_.load(); }
+  int64_t batches_in() const { return batches_in_.load(); }
+  int64_t rows_out() const { return rows_out_.load(); }
+  int64_t batches_out() const { return batches_out_.load(); }
+  /// \brief Time spent in calls of the node, excluding the time spent in the nodes it
+  /// delivered batches to from the same thread
+  int64_t processing_nanos() const { return processing_nanos_.load(); }
+  /// \brief Time the node spent paused by backpressure
+  int64_t paused_nanos() const { return paused_nanos_.load(); }
+  /// \brief Bytes allocated from the query's memory pool during calls of the node
+  int64_t bytes_allocated() const { return bytes_allocated_.load(); }
+  /// \brief The most bytes allocated by the node which were in use at the same time
+  int64_t peak_bytes() const { return peak_bytes_.load(); }
+
+ private:
+  const std::string label_;
+  const std::string kind_;
+  std::atomic<int64_t> rows_in_{0};
+  std::atomic<int64_t> batches_in_{0};
+  std::atomic<int64_t> rows_out_{0};
+  std::atomic<int64_t> batches_out_{0};
+  std::atomic<int64_t> processing_nanos_{0};
+  std::atomic<int64_t> paused_nanos_{0};
+  std::atomic<int64_t> paused_since_{-1};
+  std::atomic<int64_t> bytes_allocated_{0};
+  std::atomic<int64_t> bytes_in_use_{0};
+  std::atomic<int64_t> peak_bytes_{0};
+};
+
+/// \brief Runtime statistics of the nodes of a plan, see QueryOptions::profile
+///
+/// Collecting a profile is cheap enough to enable on production queries: each batch
+/// costs a few clock reads and atomic updates, and each allocation a small header.
+class ARROW_ACERO_EXPORT PlanProfile {
+ public:
+  PlanProfile();
+  ~PlanProfile();
+
+  /// \brief Add a node to the profile, called by the plan when it starts
+  ///
+  /// The returned statistics live as long as the profile.
+  NodeProfile* AddNode(const ExecNode& node);
+
+  /// \brief The statistics of the nodes, in the order in which they were added
+  std::vector<const NodeProfile*> nodes() const;
+
+  /// \brief The statistics as a table with one row per node
+  ///
+  /// The columns are label, kind, rows_in, batches_in, rows_out, batches_out,
+  /// processing_ns, paused_ns, bytes_allocated and peak_bytes.  Rows out of a node are
+  /// counted as they are received by the next node, so the sink's rows out are zero.
+  Result<std::shared_ptr<Table>> ToTable(
+      MemoryPool* pool = default_memory_pool()) const;
+
+  /// \brief A pool which attributes the allocations made during calls of a node to the
+  /// profile of that node
+  ///
+  /// At most one such pool is created for each pool, and lives until the process exits
+  /// since the buffers allocated from it may outlive the plan.
+  static MemoryPool* ProfilingMemoryPool(MemoryPool* pool);
+
+ private:
+  mutable std::mutex mutex_;
+  std::vector<std::shared_ptr<NodeProfile>> nodes_;
+};
+
+/// \brief Attributes the time spent on the current thread, and its allocations, to a
+/// node until destroyed
+///
+/// Scopes nest: the time spent in an inner scope is subtracted from the outer one.
+/// Does nothing if the profile is null.
+class ARROW_ACERO_EXPORT NodeProfileScope {
+ public:
+  explicit NodeProfileScope(NodeProfile* profile);
+  ~NodeProfileScope();
+
+  NodeProfileScope(const NodeProfileScope&) = delete;
+  NodeProfileScope& operator=(const NodeProfileScope&) = delete;
+
+  /// \brief The profile of the innermost scope of the current thread, if any
+  static NodeProfile* Current();
+
+ private:
+  NodeProfile* profile_;
+  NodeProfileScope* parent_ = NULLPTR;
+  int64_t start_nanos_ = 0;
+  int64_t inner_nanos_ = 0;
+};
+
+}  // namespace acero
+}  // namespace arrow
@@ -19,6 +19,7 @@
 
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/exec_plan_internal.h"
+#include "arrow/acero/expression_compiler.h"
 #include "arrow/acero/map_node.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
@@ -43,9 +44,11 @@ namespace {
 class ProjectNode : public MapNode {
  public:
   ProjectNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
-              std::shared_ptr<Schema> output_schema, std::vector<Expression> exprs)
+              std::shared_ptr<Schema> output_schema, std::vector<Expression> exprs,
+              std::unique_ptr<CompiledProjection> compiled)
       : MapNode(plan, std::move(inputs), std::move(output_schema)),
-        exprs_(std::move(exprs)) {}
+        exprs_(std::move(exprs)),
+        compiled_(std::move(compiled)) {}
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
@@ -77,26 +80,54 @@ class ProjectNode : public MapNode {
       fields[i] = field(std::move(names[i]), expr.type()->GetSharedPtr());
       ++i;
     }
+
+    std::unique_ptr<CompiledProjection> compiled;
+    if (const auto& compiler = plan->query_context()->options().expression_compiler) {
+      ARROW_ASSIGN_OR_RAISE(
+          compiled, compiler->CompileProjection(inputs[0]->output_schema(), exprs));
+    }
     return plan->EmplaceNode<ProjectNode>(plan, std::move(inputs),
-                                          schema(std::move(fields)), std::move(exprs));
+                                          schema(std::move(fields)), std::move(exprs),
+                                          std::move(compiled));
   }
 
   const char* kind_name() const override { return "ProjectNode"; }
 
+  bool AcceptsSelectionVector() const override { return true; }
+
   Result<ExecBatch> ProcessBatch(ExecBatch batch) override {
+    compute::ExecContext* ctx = plan()->query_context()->exec_context();
     std::vector<Datum> values{exprs_.size()};
+    if (compiled_) {
+      ARROW_ASSIGN_OR_RAISE(batch, batch.ApplySelection(ctx));
+      ARROW_ASSIGN_OR_RAISE(values, compiled_->Execute(batch, ctx));
+      DCHECK_EQ(values.size(), exprs_.size());
+    }
+
+    // Evaluate whatever was not compiled with the compute kernels
+    std::vector<size_t> remaining;
+    std::vector<Expression> simplified_exprs;
     for (size_t i = 0; i < exprs_.size(); ++i) {
-      arrow::util::tracing::Span span;
-      START_COMPUTE_SPAN(span, "Project",
-                         {{"project.type", exprs_[i].type()->ToString()},
-                          {"project.length", batch.length},
-                          {"project.expression", exprs_[i].ToString()}});
+      if (values[i].kind() != Datum::NONE) continue;
       ARROW_ASSIGN_OR_RAISE(Expression simplified_expr,
                             SimplifyWithGuarantee(exprs_[i], batch.guarantee));
+      remaining.push_back(i);
+      simplified_exprs.push_back(std::move(simplified_expr));
+    }
+    if (remaining.empty()) {
+      return ExecBatch{std::move(values), batch.length};
+    }
 
-      ARROW_ASSIGN_OR_RAISE(
-          values[i], ExecuteScalarExpression(simplified_expr, batch,
-                                             plan()->query_context()->exec_context()));
+    arrow::util::tracing::Span span;
+    START_COMPUTE_SPAN(span, "Project",
+                       {{"project.length", batch.length},
+                        {"project.expressions", ToStringExtra()}});
+    // Subexpressions shared between the projections are only computed once; this
+    // also applies a selection vector once to every referenced field.
+    ARROW_ASSIGN_OR_RAISE(std::vector<Datum> evaluated,
+                          ExecuteScalarExpressions(simplified_exprs, batch, ctx));
+    for (size_t i = 0; i < remaining.size(); ++i) {
+      values[remaining[i]] = std::move(evaluated[i]);
     }
     return ExecBatch{std::move(values), batch.length};
   }
@@ -119,6 +150,7 @@ class ProjectNode : public MapNode {
 
  private:
   std::vector<Expression> exprs_;
+  std::unique_ptr<CompiledProjection> compiled_;
 };
 
 }  // namespace
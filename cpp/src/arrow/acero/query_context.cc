@@ -16,6 +16,12 @@
 // under the License.
 
 #include "arrow/acero/query_context.h"
+
+#include <algorithm>
+
+#include "arrow/acero/profile.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/byte_size.h"
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/io_util.h"
 
@@ -30,12 +36,114 @@ io::IOContext GetIoContext(const QueryOptions& opts, const ExecContext& exec_con
   }
   return io::IOContext(exec_context.memory_pool(), opts.custom_io_executor);
 }
+
+// Routes the allocations of a profiled query through a pool which attributes them to
+// the nodes making them.  Queries allocate from the "acero" child of a
+// TrackingMemoryPool, if given one.
+ExecContext GetExecContext(const QueryOptions& opts, const ExecContext& exec_context) {
+  MemoryPool* pool = ChildMemoryPool(exec_context.memory_pool(), "acero");
+  if (opts.profile != nullptr) {
+    pool = PlanProfile::ProfilingMemoryPool(pool);
+  } else if (pool == exec_context.memory_pool()) {
+    return exec_context;
+  }
+  ExecContext context(pool, exec_context.executor(), exec_context.func_registry());
+  context.set_use_threads(exec_context.use_threads());
+  context.set_exec_chunksize(exec_context.exec_chunksize());
+  return context;
+}
 }  // namespace
 
+// Records the soft limit transitions of the query's CappedMemoryPool, if any
+class QueryContext::PressureListener : public MemoryPressureListener {
+ public:
+  void OnSoftLimitExceeded(int64_t) override {
+    under_pressure_.store(true, std::memory_order_relaxed);
+  }
+  void OnSoftLimitCleared(int64_t) override {
+    under_pressure_.store(false, std::memory_order_relaxed);
+  }
+
+  bool under_pressure() const { return under_pressure_.load(std::memory_order_relaxed); }
+
+ private:
+  std::atomic<bool> under_pressure_{false};
+};
+
 QueryContext::QueryContext(QueryOptions opts, ExecContext exec_context)
     : options_(std::move(opts)),
-      exec_context_(exec_context),
-      io_context_(GetIoContext(options_, exec_context_)) {}
+      exec_context_(GetExecContext(options_, exec_context)),
+      io_context_(GetIoContext(options_, exec_context_)) {
+  if (options_.use_scratch_arena) {
+    scratch_pool_ = std::make_unique<ArenaMemoryPool>(exec_context_.memory_pool());
+  }
+  // Look through the profiling pool, if any
+  if ((capped_pool_ = dynamic_cast<CappedMemoryPool*>(exec_context.memory_pool()))) {
+    pressure_listener_ = std::make_shared<PressureListener>();
+    capped_pool_->AddPressureListener(pressure_listener_);
+  }
+}
+
+QueryContext::~QueryContext() {
+  if (pressure_listener_) {
+    capped_pool_->RemovePressureListener(pressure_listener_.get());
+  }
+}
+
+bool QueryContext::under_memory_pressure() const {
+  if (options_.memory_budget > 0 && memory_in_use() > options_.memory_budget) {
+    return true;
+  }
+  return pressure_listener_ && pressure_listener_->under_pressure();
+}
+
+void QueryContext::AccountMemory(const ExecNode* node, int64_t bytes) {
+  std::lock_guard<std::mutex> lk(node_memory_mutex_);
+  node_memory_[node] += bytes;
+  memory_in_use_.fetch_add(bytes);
+}
+
+void QueryContext::ReleaseMemory(const ExecNode* node) {
+  std::lock_guard<std::mutex> lk(node_memory_mutex_);
+  auto it = node_memory_.find(node);
+  if (it != node_memory_.end()) {
+    memory_in_use_.fetch_sub(it->second);
+    node_memory_.erase(it);
+  }
+}
+
+int64_t QueryContext::memory_in_use(const ExecNode* node) const {
+  std::lock_guard<std::mutex> lk(node_memory_mutex_);
+  auto it = node_memory_.find(node);
+  return it == node_memory_.end() ? 0 : it->second;
+}
+
+int64_t QueryContext::TargetBatchRows(const ExecBatch& batch) const {
+  // Below this many rows, per-batch overhead dominates the cost of most nodes
+  constexpr int64_t kMinTargetBatchRows = 1024;
+  if (!options_.target_batch_bytes.has_value() || batch.length == 0) {
+    return ExecPlan::kMaxBatchSize;
+  }
+  int64_t target_bytes = *options_.target_batch_bytes;
+  if (target_bytes <= 0) {
+    target_bytes = cpu_info()->CacheSize(CpuInfo::CacheLevel::L2);
+  }
+  int64_t batch_bytes = 0;
+  for (const Datum& value : batch.values) {
+    if (!value.is_array()) {
+      continue;
+    }
+    auto value_bytes = util::ReferencedBufferSize(*value.array());
+    if (!value_bytes.ok()) {
+      return ExecPlan::kMaxBatchSize;
+    }
+    batch_bytes += *value_bytes;
+  }
+  const int64_t row_bytes =
+      std::max<int64_t>(1, bit_util::CeilDiv(batch_bytes, batch.length));
+  return std::clamp<int64_t>(target_bytes / row_bytes, kMinTargetBatchRows,
+                             ExecPlan::kMaxBatchSize);
+}
 
 const CpuInfo* QueryContext::cpu_info() const { return CpuInfo::GetInstance(); }
 int64_t QueryContext::hardware_flags() const { return cpu_info()->hardware_flags(); }
@@ -60,10 +168,15 @@ Result<Future<>> QueryContext::BeginExternalTask(std::string_view name) {
 
 void QueryContext::ScheduleTask(std::function<Status()> fn, std::string_view name) {
   ::arrow::internal::Executor* exec = executor();
+  ::arrow::internal::TaskHints hints;
+  hints.priority = options_.task_priority;
   // Adds a task which submits fn to the executor and tracks its progress.  If we're
   // already stopping then the task is ignored and fn is not executed.
   async_scheduler_->AddSimpleTask(
-      [exec, fn = std::move(fn)]() mutable { return exec->Submit(std::move(fn)); }, name);
+      [exec, hints, fn = std::move(fn)]() mutable {
+        return exec->Submit(hints, std::move(fn));
+      },
+      name);
 }
 
 void QueryContext::ScheduleTask(std::function<Status(size_t)> fn, std::string_view name) {
@@ -75,8 +188,13 @@ void QueryContext::ScheduleTask(std::function<Status(size_t)> fn, std::string_vi
 }
 
 void QueryContext::ScheduleIOTask(std::function<Status()> fn, std::string_view name) {
+  ::arrow::internal::TaskHints hints;
+  hints.priority = options_.task_priority;
   async_scheduler_->AddSimpleTask(
-      [this, fn]() { return io_context_.executor()->Submit(std::move(fn)); }, name);
+      [this, hints, fn]() {
+        return io_context_.executor()->Submit(hints, std::move(fn));
+      },
+      name);
 }
 
 int QueryContext::RegisterTaskGroup(std::function<Status(size_t, int64_t)> task,
@@ -87,5 +205,34 @@ int QueryContext::RegisterTaskGroup(std::function<Status(size_t, int64_t)> task,
 Status QueryContext::StartTaskGroup(int task_group_id, int64_t num_tasks) {
   return task_scheduler_->StartTaskGroup(GetThreadIndex(), task_group_id, num_tasks);
 }
+
+void QueryContext::SubscribeRuntimeFilters(const ExecNode* node,
+                                           RuntimeFilterCallback callback) {
+  std::lock_guard<std::mutex> lk(runtime_filters_mutex_);
+  runtime_filter_subscribers_[node].push_back(std::move(callback));
+}
+
+bool QueryContext::HasRuntimeFilterSubscribers(const ExecNode* node) const {
+  std::lock_guard<std::mutex> lk(runtime_filters_mutex_);
+  return runtime_filter_subscribers_.count(node) > 0;
+}
+
+Status QueryContext::PublishRuntimeFilter(const ExecNode* node,
+                                          const RuntimeFilter& filter) {
+  std::vector<RuntimeFilterCallback> callbacks;
+  {
+    std::lock_guard<std::mutex> lk(runtime_filters_mutex_);
+    auto it = runtime_filter_subscribers_.find(node);
+    if (it == runtime_filter_subscribers_.end()) {
+      return Status::OK();
+    }
+    callbacks = it->second;
+  }
+  for (const auto& callback : callbacks) {
+    RETURN_NOT_OK(callback(filter));
+  }
+  return Status::OK();
+}
+
 }  // namespace acero
 }  // namespace arrow
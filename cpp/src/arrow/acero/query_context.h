@@ -16,13 +16,20 @@
 // under the License.
 #pragma once
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <string_view>
+#include <unordered_map>
+#include <vector>
 
 #include "arrow/acero/exec_plan.h"
+#include "arrow/acero/runtime_filter.h"
 #include "arrow/acero/task_util.h"
 #include "arrow/acero/util.h"
 #include "arrow/compute/exec.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/memory_pool.h"
 #include "arrow/util/async_util.h"
 #include "arrow/util/type_fwd.h"
 
@@ -37,6 +44,7 @@ class ARROW_ACERO_EXPORT QueryContext {
  public:
   QueryContext(QueryOptions opts = {},
                ExecContext exec_context = *default_exec_context());
+  ~QueryContext();
 
   Status Init(arrow::util::AsyncTaskScheduler* scheduler);
 
@@ -44,6 +52,35 @@ class ARROW_ACERO_EXPORT QueryContext {
   int64_t hardware_flags() const;
   const QueryOptions& options() const { return options_; }
   MemoryPool* memory_pool() const { return exec_context_.memory_pool(); }
+  /// \brief The pool to allocate scratch memory from
+  ///
+  /// Memory allocated from this pool must be freed before the plan is destroyed, it
+  /// must not be used for data that is output by the plan.
+  /// \see QueryOptions::use_scratch_arena
+  MemoryPool* scratch_memory_pool() const {
+    return scratch_pool_ ? scratch_pool_.get() : memory_pool();
+  }
+  /// \brief Whether the memory pool of the query is above its soft limit
+  ///
+  /// This is true when the memory pool is a CappedMemoryPool above its soft limit, or
+  /// when the nodes of the plan hold more than QueryOptions::memory_budget bytes.
+  /// Nodes that buffer data should release memory (e.g. by spilling it) when this
+  /// returns true.
+  bool under_memory_pressure() const;
+  /// \brief Record that `node` now buffers `bytes` more bytes (or fewer, if negative)
+  ///
+  /// \see QueryOptions::memory_budget
+  void AccountMemory(const ExecNode* node, int64_t bytes);
+  /// \brief Forget about all the memory accounted to `node`
+  void ReleaseMemory(const ExecNode* node);
+  /// \brief The number of bytes buffered by the nodes of the plan
+  int64_t memory_in_use() const { return memory_in_use_.load(); }
+  /// \brief The number of bytes buffered by `node`
+  int64_t memory_in_use(const ExecNode* node) const;
+  /// \brief The number of rows to slice the batches of `batch` into
+  ///
+  /// \see QueryOptions::target_batch_bytes
+  int64_t TargetBatchRows(const ExecBatch& batch) const;
   ::arrow::internal::Executor* executor() const { return exec_context_.executor(); }
   ExecContext* exec_context() { return &exec_context_; }
   IOContext* io_context() { return &io_context_; }
@@ -133,12 +170,30 @@ class ARROW_ACERO_EXPORT QueryContext {
 
   size_t GetCurrentTempFileIO() { return in_flight_bytes_to_disk_.load(); }
 
+  /// \brief Receive the runtime filters addressed to `node`
+  ///
+  /// Should be called while the plan is being built, filters published before the
+  /// subscription are not delivered.
+  void SubscribeRuntimeFilters(const ExecNode* node, RuntimeFilterCallback callback);
+
+  /// \brief Whether anything subscribed to the runtime filters addressed to `node`
+  ///
+  /// Publishers can use this to avoid computing filters nobody would use.
+  bool HasRuntimeFilterSubscribers(const ExecNode* node) const;
+
+  /// \brief Deliver `filter` to the subscribers for `node`
+  Status PublishRuntimeFilter(const ExecNode* node, const RuntimeFilter& filter);
+
  private:
   QueryOptions options_;
   // To be replaced with Acero-specific context once scheduler is done and
   // we don't need ExecContext for kernels
   ExecContext exec_context_;
   IOContext io_context_;
+  std::unique_ptr<ArenaMemoryPool> scratch_pool_;
+  class PressureListener;
+  std::shared_ptr<PressureListener> pressure_listener_;
+  CappedMemoryPool* capped_pool_ = NULLPTR;
 
   arrow::util::AsyncTaskScheduler* async_scheduler_ = NULLPTR;
   std::unique_ptr<TaskScheduler> task_scheduler_ = TaskScheduler::Make();
@@ -146,6 +201,14 @@ class ARROW_ACERO_EXPORT QueryContext {
   ThreadIndexer thread_indexer_;
 
   std::atomic<size_t> in_flight_bytes_to_disk_{0};
+
+  std::atomic<int64_t> memory_in_use_{0};
+  mutable std::mutex node_memory_mutex_;
+  std::unordered_map<const ExecNode*, int64_t> node_memory_;
+
+  mutable std::mutex runtime_filters_mutex_;
+  std::unordered_map<const ExecNode*, std::vector<RuntimeFilterCallback>>
+      runtime_filter_subscribers_;
 };
 }  // namespace acero
 }  // namespace arrow
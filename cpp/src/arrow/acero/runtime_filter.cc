@@ -0,0 +1,52 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/acero/runtime_filter.h"
+
+#include <utility>
+
+#include "arrow/compute/api_scalar.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+
+namespace arrow {
+
+using compute::Expression;
+
+namespace acero {
+
+Expression RuntimeFilter::ToExpression(const Schema& schema) const {
+  std::vector<Expression> conditions;
+  for (const Key& key : keys) {
+    Expression column = compute::field_ref(schema.field(key.column)->name());
+    if (key.min && key.max) {
+      if (!key.min->is_valid || !key.max->is_valid) {
+        return compute::literal(false);
+      }
+      conditions.push_back(compute::greater_equal(column, compute::literal(key.min)));
+      conditions.push_back(compute::less_equal(column, compute::literal(key.max)));
+    }
+    if (key.value_set) {
+      conditions.push_back(
+          compute::call("is_in", {column}, compute::SetLookupOptions(key.value_set)));
+    }
+  }
+  return compute::and_(std::move(conditions));
+}
+
+}  // namespace acero
+}  // namespace arrow
@@ -0,0 +1,74 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "arrow/acero/visibility.h"
+#include "arrow/compute/expression.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace acero {
+
+/// \brief What a hash join knows about its keys once its build side is complete
+///
+/// A probe-side row whose key is outside of the range of the build-side keys, or not
+/// in the set of build-side keys, cannot find a match.  The node producing the
+/// probe-side rows may drop such rows, or skip the data they would be read from,
+/// before they reach the join.
+///
+/// A runtime filter is addressed to a node, see QueryContext::PublishRuntimeFilter.
+/// Nodes that can make use of it (such as the dataset scan) subscribe with
+/// QueryContext::SubscribeRuntimeFilters.  A filter is only ever an optimization:
+/// receivers may ignore it and joins still check every row.
+struct ARROW_ACERO_EXPORT RuntimeFilter {
+  struct Key {
+    /// \brief The index of the key column in the receiving node's output schema
+    int column;
+    /// \brief The smallest and largest non-null build-side key
+    ///
+    /// Null pointers if the range is unknown.  Null scalars if the build side has no
+    /// non-null key, in which case no probe-side row can match.
+    std::shared_ptr<Scalar> min, max;
+    /// \brief The distinct non-null build-side keys, only set for small build sides
+    std::shared_ptr<Array> value_set;
+  };
+
+  /// \brief The keys of the join, a row must satisfy the conditions on all of them
+  std::vector<Key> keys;
+
+  /// \brief An expression that is false for rows which cannot find a match
+  ///
+  /// Key columns are referenced by their name in `schema`, the output schema of the
+  /// receiving node, so that the expression can be simplified against guarantees on
+  /// these names (such as partition expressions).
+  compute::Expression ToExpression(const Schema& schema) const;
+};
+
+/// \brief A subscriber to the runtime filters addressed to a node
+///
+/// May be called from any thread, and more than once if several joins publish a
+/// filter for the same node.
+using RuntimeFilterCallback = std::function<Status(const RuntimeFilter&)>;
+
+}  // namespace acero
+}  // namespace arrow
@@ -512,7 +512,7 @@ struct OrderBySinkNode final : public SinkNode {
                           batch.ToRecordBatch(inputs_[0]->output_schema(),
                                               plan()->query_context()->memory_pool()));
 
-    impl_->InputReceived(std::move(record_batch));
+    RETURN_NOT_OK(impl_->InputReceived(std::move(record_batch)));
     if (input_counter_.Increment()) {
       return Finish();
     }
@@ -104,7 +104,7 @@ class InputState {
   InputState(size_t index, BackpressureHandler handler,
              const std::shared_ptr<arrow::Schema>& schema, const int time_col_index)
       : index_(index),
-        queue_(std::move(handler)),
+        queue_(std::move(handler), QueuedBatchBytes),
         schema_(schema),
         time_col_index_(time_col_index),
         time_type_id_(schema_->fields()[time_col_index_]->type()->id()) {}
@@ -116,11 +116,14 @@ class InputState {
                                      const std::shared_ptr<arrow::Schema>& schema,
                                      const col_index_t time_col_index) {
     constexpr size_t low_threshold = 4, high_threshold = 8;
+    constexpr uint64_t low_bytes_threshold = 32 << 20, high_bytes_threshold = 64 << 20;
     std::unique_ptr<arrow::acero::BackpressureControl> backpressure_control =
         std::make_unique<BackpressureController>(input, output, backpressure_counter);
     ARROW_ASSIGN_OR_RAISE(auto handler,
                           BackpressureHandler::Make(low_threshold, high_threshold,
-                                                    std::move(backpressure_control)));
+                                                    std::move(backpressure_control),
+                                                    low_bytes_threshold,
+                                                    high_bytes_threshold));
     return PtrType(new InputState(index, std::move(handler), schema, time_col_index));
   }
 
@@ -253,7 +256,7 @@ struct InputStateComparator {
   }
 };
 
-class SortedMergeNode : public ExecNode {
+class SortedMergeNode : public ExecNode, public TracedNode {
   static constexpr int64_t kTargetOutputBatchSize = 1024 * 1024;
 
  public:
@@ -262,6 +265,7 @@ class SortedMergeNode : public ExecNode {
                   std::shared_ptr<arrow::Schema> output_schema,
                   arrow::Ordering new_ordering)
       : ExecNode(plan, inputs, GetInputLabels(inputs), std::move(output_schema)),
+        TracedNode(this),
         ordering_(std::move(new_ordering)),
         input_counter(inputs_.size()),
         output_counter(inputs_.size())
@@ -351,6 +355,7 @@ class SortedMergeNode : public ExecNode {
 
   arrow::Status InputReceived(arrow::acero::ExecNode* input,
                               arrow::ExecBatch batch) override {
+    NoteInputReceived(input, batch);
     ARROW_DCHECK(std_has(inputs_, input));
     const size_t index = std_find(inputs_, input) - inputs_.begin();
     ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> rb,
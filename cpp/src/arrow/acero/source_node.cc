@@ -122,24 +122,23 @@ struct SourceNode : ExecNode, public TracedNode {
   void SliceAndDeliverMorsel(const ExecBatch& morsel) {
     bool use_legacy_batching = plan_->query_context()->options().use_legacy_batching;
     int64_t morsel_length = static_cast<int64_t>(morsel.length);
+    const int64_t batch_rows = plan_->query_context()->TargetBatchRows(morsel);
     int initial_batch_index = batch_count_;
     if (use_legacy_batching || morsel_length == 0) {
       // For various reasons (e.g. ARROW-13982) we pass empty batches
       // through
       batch_count_++;
     } else {
-      int num_batches =
-          static_cast<int>(bit_util::CeilDiv(morsel_length, ExecPlan::kMaxBatchSize));
+      int num_batches = static_cast<int>(bit_util::CeilDiv(morsel_length, batch_rows));
       batch_count_ += num_batches;
     }
     plan_->query_context()->ScheduleTask(
-        [this, morsel_length, use_legacy_batching, initial_batch_index, morsel,
-         has_ordering = !ordering_.is_unordered()]() {
+        [this, morsel_length, batch_rows, use_legacy_batching, initial_batch_index,
+         morsel, has_ordering = !ordering_.is_unordered()]() {
           int64_t offset = 0;
           int batch_index = initial_batch_index;
           do {
-            int64_t batch_size =
-                std::min<int64_t>(morsel_length - offset, ExecPlan::kMaxBatchSize);
+            int64_t batch_size = std::min<int64_t>(morsel_length - offset, batch_rows);
             // In order for the legacy batching model to work we must
             // not slice batches from the source
             if (use_legacy_batching) {
@@ -247,6 +246,9 @@ struct SourceNode : ExecNode, public TracedNode {
       return;
     }
     backpressure_future_ = Future<>::Make();
+    if (profile() != nullptr) {
+      profile()->RecordPause();
+    }
   }
 
   void ResumeProducing(ExecNode* output, int32_t counter) override {
@@ -262,6 +264,9 @@ struct SourceNode : ExecNode, public TracedNode {
       }
       to_finish = backpressure_future_;
       backpressure_future_ = Future<>::MakeFinished();
+      if (profile() != nullptr) {
+        profile()->RecordResume();
+      }
     }
     to_finish.MarkFinished();
   }
@@ -0,0 +1,373 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/acero/spilling_util.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "arrow/acero/query_context.h"
+#include "arrow/array/util.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/key_hash_internal.h"
+#include "arrow/compute/util_internal.h"
+#include "arrow/io/file.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging_internal.h"
+
+namespace arrow {
+
+using compute::Hashing32;
+using compute::KeyColumnArray;
+using internal::TemporaryDir;
+
+namespace acero {
+namespace util {
+
+SpillFile::SpillFile(std::string path, std::shared_ptr<Schema> schema, MemoryPool* pool)
+    : path_(std::move(path)), schema_(std::move(schema)), pool_(pool) {}
+
+SpillFile::~SpillFile() {
+  if (writer_ && !finished_) {
+    ARROW_WARN_NOT_OK(writer_->Close(), "Failed to close spill file");
+  }
+  reader_.reset();
+  // Release the disk space eagerly instead of waiting for the SpillStore to go away
+  auto maybe_path = ::arrow::internal::PlatformFilename::FromString(path_);
+  if (maybe_path.ok()) {
+    ARROW_WARN_NOT_OK(::arrow::internal::DeleteFile(*maybe_path).status(),
+                      "Failed to delete spill file");
+  }
+}
+
+Status SpillFile::OpenWriter() {
+  ARROW_ASSIGN_OR_RAISE(auto sink, io::FileOutputStream::Open(path_));
+  auto options = ipc::IpcWriteOptions::Defaults();
+  options.memory_pool = pool_;
+  ARROW_ASSIGN_OR_RAISE(writer_, ipc::MakeFileWriter(std::move(sink), schema_, options));
+  return Status::OK();
+}
+
+Status SpillFile::OpenReader() {
+  ARROW_ASSIGN_OR_RAISE(auto source, io::ReadableFile::Open(path_, pool_));
+  auto options = ipc::IpcReadOptions::Defaults();
+  options.memory_pool = pool_;
+  options.use_threads = false;
+  ARROW_ASSIGN_OR_RAISE(reader_,
+                        ipc::RecordBatchFileReader::Open(std::move(source), options));
+  return Status::OK();
+}
+
+Status SpillFile::Write(const ExecBatch& batch) {
+  if (finished_) {
+    return Status::Invalid("Cannot write to a spill file that has been finished");
+  }
+  if (!writer_) {
+    RETURN_NOT_OK(OpenWriter());
+  }
+  ARROW_ASSIGN_OR_RAISE(auto record_batch, batch.ToRecordBatch(schema_, pool_));
+  RETURN_NOT_OK(writer_->WriteRecordBatch(*record_batch));
+  ++num_batches_;
+  num_rows_ += batch.length;
+  bytes_written_ += batch.TotalBufferSize();
+  return Status::OK();
+}
+
+Status SpillFile::Finish() {
+  if (finished_) {
+    return Status::OK();
+  }
+  finished_ = true;
+  if (!writer_) {
+    // Nothing was written, still create a valid (empty) file so it can be read
+    RETURN_NOT_OK(OpenWriter());
+  }
+  return writer_->Close();
+}
+
+Result<ExecBatch> SpillFile::ReadBatch(int i) {
+  if (i < 0 || i >= num_batches_) {
+    return Status::IndexError("Spill file batch index ", i, " out of bounds");
+  }
+  RETURN_NOT_OK(Finish());
+  if (!reader_) {
+    RETURN_NOT_OK(OpenReader());
+  }
+  ARROW_ASSIGN_OR_RAISE(auto record_batch, reader_->ReadRecordBatch(i));
+  return ExecBatch(*record_batch);
+}
+
+Result<std::vector<ExecBatch>> SpillFile::ReadAll() {
+  std::vector<ExecBatch> batches;
+  batches.reserve(num_batches_);
+  for (int i = 0; i < num_batches_; ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, ReadBatch(i));
+    batches.push_back(std::move(batch));
+  }
+  return batches;
+}
+
+SpillStore::SpillStore(std::unique_ptr<TemporaryDir> dir, MemoryPool* pool)
+    : dir_(std::move(dir)), pool_(pool) {}
+
+SpillStore::~SpillStore() = default;
+
+Result<std::unique_ptr<SpillStore>> SpillStore::Make(MemoryPool* pool,
+                                                     const std::string& prefix) {
+  ARROW_ASSIGN_OR_RAISE(auto dir, TemporaryDir::Make(prefix));
+  return std::unique_ptr<SpillStore>(new SpillStore(std::move(dir), pool));
+}
+
+Result<std::unique_ptr<SpillFile>> SpillStore::CreateFile(
+    std::shared_ptr<Schema> schema) {
+  int64_t file_id = next_file_id_.fetch_add(1);
+  ARROW_ASSIGN_OR_RAISE(auto path,
+                        dir_->path().Join("spill-" + std::to_string(file_id) + ".arrow"));
+  return std::unique_ptr<SpillFile>(
+      new SpillFile(path.ToString(), std::move(schema), pool_));
+}
+
+std::string SpillStore::path() const { return dir_->path().ToString(); }
+
+Status SpillingAccumulationQueue::Init(QueryContext* ctx, SpillStore* store,
+                                       std::shared_ptr<Schema> schema,
+                                       std::vector<int> key_ids, int num_partitions,
+                                       int64_t memory_limit) {
+  if (num_partitions < 1 || num_partitions > (1 << 15) ||
+      !bit_util::IsPowerOf2(static_cast<int64_t>(num_partitions))) {
+    return Status::Invalid("Number of partitions must be a power of two, got ",
+                           num_partitions);
+  }
+  if (key_ids.empty()) {
+    return Status::Invalid("At least one key column is required to partition batches");
+  }
+  for (int key_id : key_ids) {
+    if (key_id < 0 || key_id >= schema->num_fields()) {
+      return Status::Invalid("Key column index ", key_id, " out of bounds");
+    }
+  }
+  ctx_ = ctx;
+  store_ = store;
+  schema_ = std::move(schema);
+  key_ids_ = std::move(key_ids);
+  num_partitions_ = num_partitions;
+  memory_limit_ = memory_limit;
+  partitions_.resize(num_partitions);
+  return Status::OK();
+}
+
+Status SpillingAccumulationQueue::PartitionIds(const ExecBatch& batch,
+                                               const std::vector<int>& key_ids,
+                                               int num_partitions,
+                                               int64_t hardware_flags, MemoryPool* pool,
+                                               std::vector<uint16_t>* partition_ids) {
+  partition_ids->assign(batch.length, 0);
+  if (num_partitions == 1 || batch.length == 0) {
+    return Status::OK();
+  }
+
+  std::vector<Datum> keys(key_ids.size());
+  for (size_t i = 0; i < key_ids.size(); ++i) {
+    keys[i] = batch[key_ids[i]];
+    if (keys[i].is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(keys[i],
+                            MakeArrayFromScalar(*keys[i].scalar(), batch.length, pool));
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(ExecBatch key_batch, ExecBatch::Make(std::move(keys)));
+
+  arrow::util::TempVectorStack stack;
+  RETURN_NOT_OK(stack.Init(pool, Hashing32::kHashBatchTempStackUsage));
+  std::vector<uint32_t> hashes(batch.length);
+  std::vector<KeyColumnArray> temp_column_arrays;
+  RETURN_NOT_OK(Hashing32::HashBatch(key_batch, hashes.data(), temp_column_arrays,
+                                     hardware_flags, &stack, 0, key_batch.length));
+
+  // Use the lowest bits of the hash: Swiss tables address blocks with the highest
+  // ones, so a table holding a single partition still spreads over all its blocks.
+  const uint32_t partition_mask = static_cast<uint32_t>(num_partitions - 1);
+  for (int64_t i = 0; i < batch.length; ++i) {
+    (*partition_ids)[i] = static_cast<uint16_t>(hashes[i] & partition_mask);
+  }
+  return Status::OK();
+}
+
+Result<std::vector<ExecBatch>> SpillingAccumulationQueue::PartitionBatch(
+    ExecBatch batch, const std::vector<int>& key_ids, int num_partitions,
+    QueryContext* ctx) {
+  std::vector<uint16_t> partition_ids;
+  RETURN_NOT_OK(PartitionIds(batch, key_ids, num_partitions, ctx->hardware_flags(),
+                             ctx->scratch_memory_pool(), &partition_ids));
+
+  // Bucket sort the row ids on partition ids
+  std::vector<int64_t> offsets(num_partitions + 1, 0);
+  for (uint16_t partition_id : partition_ids) {
+    ++offsets[partition_id + 1];
+  }
+  for (int i = 0; i < num_partitions; ++i) {
+    offsets[i + 1] += offsets[i];
+  }
+  ARROW_ASSIGN_OR_RAISE(
+      std::shared_ptr<Buffer> row_ids_buf,
+      AllocateBuffer(batch.length * sizeof(int64_t), ctx->scratch_memory_pool()));
+  auto row_ids = row_ids_buf->mutable_data_as<int64_t>();
+  {
+    std::vector<int64_t> positions(offsets.begin(), offsets.end() - 1);
+    for (int64_t i = 0; i < batch.length; ++i) {
+      row_ids[positions[partition_ids[i]]++] = i;
+    }
+  }
+
+  std::vector<ExecBatch> partitioned(num_partitions);
+  for (int i = 0; i < num_partitions; ++i) {
+    int64_t length = offsets[i + 1] - offsets[i];
+    if (length == 0) {
+      continue;
+    }
+    if (length == batch.length) {
+      partitioned[i] = std::move(batch);
+      break;
+    }
+    auto indices = std::make_shared<ArrayData>(
+        int64(), length,
+        BufferVector{nullptr, SliceBuffer(row_ids_buf, offsets[i] * sizeof(int64_t),
+                                          length * sizeof(int64_t))});
+    std::vector<Datum> values(batch.values.size());
+    for (size_t col = 0; col < values.size(); ++col) {
+      if (batch[col].is_scalar()) {
+        values[col] = batch[col];
+      } else {
+        ARROW_ASSIGN_OR_RAISE(
+            values[col], compute::Take(batch[col], indices,
+                                       compute::TakeOptions::NoBoundsCheck(),
+                                       ctx->exec_context()));
+      }
+    }
+    partitioned[i] = ExecBatch(std::move(values), length);
+  }
+
+  return partitioned;
+}
+
+Status SpillingAccumulationQueue::InsertBatch(ExecBatch batch) {
+  if (batch.length == 0) {
+    return Status::OK();
+  }
+  ARROW_ASSIGN_OR_RAISE(
+      std::vector<ExecBatch> partitioned,
+      PartitionBatch(std::move(batch), key_ids_, num_partitions_, ctx_));
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (int i = 0; i < num_partitions_; ++i) {
+    if (partitioned[i].length > 0) {
+      RETURN_NOT_OK(AddToPartition(&partitions_[i], std::move(partitioned[i])));
+    }
+  }
+
+  // Spill the largest resident partitions until we fit in the budget again.  If the
+  // memory pool is running out of room, spill at least one partition.
+  bool relieve_pressure = ctx_->under_memory_pressure();
+  while (bytes_in_memory_ > memory_limit_ || relieve_pressure) {
+    relieve_pressure = false;
+    auto largest = std::max_element(partitions_.begin(), partitions_.end(),
+                                    [](const Partition& l, const Partition& r) {
+                                      return l.resident_bytes < r.resident_bytes;
+                                    });
+    if (largest->resident_bytes == 0) {
+      break;
+    }
+    RETURN_NOT_OK(SpillPartition(&*largest));
+  }
+  return Status::OK();
+}
+
+Status SpillingAccumulationQueue::AddToPartition(Partition* partition, ExecBatch batch) {
+  partition->row_count += batch.length;
+  if (partition->spill_file) {
+    int64_t num_bytes = batch.TotalBufferSize();
+    auto mark = ctx_->ReportTempFileIO(static_cast<size_t>(num_bytes));
+    RETURN_NOT_OK(partition->spill_file->Write(batch));
+    bytes_spilled_ += num_bytes;
+    return Status::OK();
+  }
+  int64_t num_bytes = batch.TotalBufferSize();
+  partition->resident_bytes += num_bytes;
+  bytes_in_memory_ += num_bytes;
+  partition->resident.InsertBatch(std::move(batch));
+  return Status::OK();
+}
+
+Status SpillingAccumulationQueue::SpillPartition(Partition* partition) {
+  DCHECK_EQ(partition->spill_file, nullptr);
+  ARROW_ASSIGN_OR_RAISE(partition->spill_file, store_->CreateFile(schema_));
+  auto mark = ctx_->ReportTempFileIO(static_cast<size_t>(partition->resident_bytes));
+  for (size_t i = 0; i < partition->resident.batch_count(); ++i) {
+    RETURN_NOT_OK(partition->spill_file->Write(partition->resident[i]));
+  }
+  bytes_spilled_ += partition->resident_bytes;
+  bytes_in_memory_ -= partition->resident_bytes;
+  partition->resident_bytes = 0;
+  partition->resident.Clear();
+  return Status::OK();
+}
+
+Status SpillingAccumulationQueue::Finish() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto& partition : partitions_) {
+    if (partition.spill_file) {
+      RETURN_NOT_OK(partition.spill_file->Finish());
+    }
+  }
+  return Status::OK();
+}
+
+int SpillingAccumulationQueue::num_spilled_partitions() const {
+  return static_cast<int>(std::count_if(
+      partitions_.begin(), partitions_.end(),
+      [](const Partition& partition) { return partition.spill_file != nullptr; }));
+}
+
+Result<AccumulationQueue> SpillingAccumulationQueue::TakePartition(int partition_id) {
+  if (partition_id < 0 || partition_id >= num_partitions_) {
+    return Status::IndexError("Partition ", partition_id, " out of bounds");
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  Partition& partition = partitions_[partition_id];
+  AccumulationQueue out;
+  if (partition.spill_file) {
+    ARROW_ASSIGN_OR_RAISE(auto batches, partition.spill_file->ReadAll());
+    for (auto& batch : batches) {
+      out.InsertBatch(std::move(batch));
+    }
+    partition.spill_file.reset();
+  } else {
+    out = std::move(partition.resident);
+    bytes_in_memory_ -= partition.resident_bytes;
+    partition.resident_bytes = 0;
+  }
+  partition.row_count = 0;
+  return out;
+}
+
+}  // namespace util
+}  // namespace acero
+}  // namespace arrow
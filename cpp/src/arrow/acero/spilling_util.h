@@ -0,0 +1,246 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "arrow/acero/accumulation_queue.h"
+#include "arrow/acero/type_fwd.h"
+#include "arrow/acero/visibility.h"
+#include "arrow/compute/exec.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/type_fwd.h"
+
+namespace arrow {
+
+namespace internal {
+class TemporaryDir;
+}  // namespace internal
+
+namespace ipc {
+class RecordBatchFileReader;
+class RecordBatchWriter;
+}  // namespace ipc
+
+namespace acero {
+namespace util {
+
+/// \brief A temporary file holding a sequence of spilled batches
+///
+/// Batches are stored using the Arrow IPC file format so that they can be read
+/// back either all at once or one at a time by index.  A spill file is written
+/// once and then read any number of times; calling Write after Finish is an error.
+///
+/// Instances are created by a SpillStore, which must outlive them.  The file is
+/// deleted when the instance is destroyed.
+class ARROW_ACERO_EXPORT SpillFile {
+ public:
+  ~SpillFile();
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(SpillFile);
+
+  /// \brief Append a batch to the file
+  ///
+  /// Scalar values in the batch are broadcast to arrays before being written.
+  Status Write(const ExecBatch& batch);
+
+  /// \brief Finish writing, the file becomes readable afterwards
+  ///
+  /// Calling Finish more than once has no effect.
+  Status Finish();
+
+  /// \brief Read the i-th batch that was written to the file
+  ///
+  /// Finish will be called first if it has not been called yet.
+  Result<ExecBatch> ReadBatch(int i);
+
+  /// \brief Read all the batches that were written to the file, in order
+  Result<std::vector<ExecBatch>> ReadAll();
+
+  int num_batches() const { return num_batches_; }
+  int64_t num_rows() const { return num_rows_; }
+  /// The number of bytes of batch data handed to the file so far
+  int64_t bytes_written() const { return bytes_written_; }
+  const std::string& path() const { return path_; }
+  const std::shared_ptr<Schema>& schema() const { return schema_; }
+
+ private:
+  friend class SpillStore;
+
+  SpillFile(std::string path, std::shared_ptr<Schema> schema, MemoryPool* pool);
+
+  Status OpenWriter();
+  Status OpenReader();
+
+  std::string path_;
+  std::shared_ptr<Schema> schema_;
+  MemoryPool* pool_;
+
+  std::shared_ptr<ipc::RecordBatchWriter> writer_;
+  std::shared_ptr<ipc::RecordBatchFileReader> reader_;
+  bool finished_ = false;
+
+  int num_batches_ = 0;
+  int64_t num_rows_ = 0;
+  int64_t bytes_written_ = 0;
+};
+
+/// \brief A directory of temporary files used to spill data out of memory
+///
+/// The directory is created in the platform temporary directory (which can be
+/// controlled with the usual environment variables, e.g. TMPDIR) and it is
+/// removed, along with all of its files, when the store is destroyed.
+///
+/// This class is thread-safe.
+class ARROW_ACERO_EXPORT SpillStore {
+ public:
+  ~SpillStore();
+
+  /// \brief Create a new spill directory
+  ///
+  /// \param pool memory pool used when reading spilled batches back
+  /// \param prefix prefix of the name of the temporary directory
+  static Result<std::unique_ptr<SpillStore>> Make(
+      MemoryPool* pool, const std::string& prefix = "arrow-acero-spill-");
+
+  /// \brief Create a new, empty, spill file for batches of the given schema
+  Result<std::unique_ptr<SpillFile>> CreateFile(std::shared_ptr<Schema> schema);
+
+  /// The path of the spill directory
+  std::string path() const;
+
+ private:
+  SpillStore(std::unique_ptr<::arrow::internal::TemporaryDir> dir, MemoryPool* pool);
+
+  std::unique_ptr<::arrow::internal::TemporaryDir> dir_;
+  MemoryPool* pool_;
+  std::atomic<int64_t> next_file_id_{0};
+};
+
+/// \brief An accumulation queue that hash-partitions its input and spills
+///        partitions to disk once a memory budget is exceeded
+///
+/// Each row is assigned to one of `num_partitions` partitions based on the hash
+/// of its key columns.  As long as the total size of the buffered batches stays
+/// under the memory limit everything is kept in memory.  When the limit is
+/// exceeded the largest in-memory partition is written to a SpillFile and all
+/// later rows of that partition are appended to the file directly.  Partitions
+/// that fit in memory therefore never touch the disk and the spilled ones can be
+/// processed one at a time later on (this is the scheme used by hybrid hash
+/// joins and partitioned aggregations).
+///
+/// Two queues configured with the same key types and the same number of
+/// partitions assign equal keys to the same partition, so they can be used to
+/// co-partition both inputs of a join.
+///
+/// InsertBatch is thread-safe.
+class ARROW_ACERO_EXPORT SpillingAccumulationQueue {
+ public:
+  SpillingAccumulationQueue() = default;
+  ~SpillingAccumulationQueue() = default;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(SpillingAccumulationQueue);
+
+  /// \brief Initialize the queue, must be called before any other method
+  ///
+  /// \param ctx the query context, used for the memory pool, the hardware flags
+  ///            and temp file IO reporting
+  /// \param store where partitions are spilled to, must outlive the queue
+  /// \param schema the schema of the batches that will be inserted
+  /// \param key_ids the indices of the columns used to compute the partition
+  /// \param num_partitions the number of partitions, must be a power of two
+  /// \param memory_limit the number of bytes that can be kept in memory before
+  ///                     partitions start getting spilled
+  Status Init(QueryContext* ctx, SpillStore* store, std::shared_ptr<Schema> schema,
+              std::vector<int> key_ids, int num_partitions, int64_t memory_limit);
+
+  /// \brief Partition a batch and add its rows to the queue
+  Status InsertBatch(ExecBatch batch);
+
+  /// \brief Finish writing all the spill files
+  ///
+  /// Must be called once all batches have been inserted.
+  Status Finish();
+
+  int num_partitions() const { return num_partitions_; }
+  bool is_spilled(int partition) const {
+    return partitions_[partition].spill_file != NULLPTR;
+  }
+  int64_t row_count(int partition) const { return partitions_[partition].row_count; }
+  /// The number of bytes currently buffered in memory across all partitions
+  int64_t bytes_in_memory() const { return bytes_in_memory_; }
+  /// The number of bytes written to disk across all partitions
+  int64_t bytes_spilled() const { return bytes_spilled_; }
+  int num_spilled_partitions() const;
+
+  /// \brief Move the batches of a partition out of the queue
+  ///
+  /// Spilled batches are read back into memory.  The partition is empty after
+  /// this call.
+  Result<AccumulationQueue> TakePartition(int partition);
+
+  /// \brief Compute the partition of each row of a batch
+  ///
+  /// Exposed so that callers can partition related inputs consistently.
+  static Status PartitionIds(const ExecBatch& batch, const std::vector<int>& key_ids,
+                             int num_partitions, int64_t hardware_flags,
+                             MemoryPool* pool, std::vector<uint16_t>* partition_ids);
+
+  /// \brief Split a batch into one batch per partition
+  ///
+  /// Rows are assigned as by PartitionIds.  Partitions that receive no rows are left
+  /// as empty batches.
+  static Result<std::vector<ExecBatch>> PartitionBatch(ExecBatch batch,
+                                                       const std::vector<int>& key_ids,
+                                                       int num_partitions,
+                                                       QueryContext* ctx);
+
+ private:
+  struct Partition {
+    AccumulationQueue resident;
+    int64_t resident_bytes = 0;
+    int64_t row_count = 0;
+    std::unique_ptr<SpillFile> spill_file;
+  };
+
+  Status SpillPartition(Partition* partition);
+  Status AddToPartition(Partition* partition, ExecBatch batch);
+
+  QueryContext* ctx_ = NULLPTR;
+  SpillStore* store_ = NULLPTR;
+  std::shared_ptr<Schema> schema_;
+  std::vector<int> key_ids_;
+  int num_partitions_ = 0;
+  int64_t memory_limit_ = 0;
+
+  std::mutex mutex_;
+  std::vector<Partition> partitions_;
+  int64_t bytes_in_memory_ = 0;
+  int64_t bytes_spilled_ = 0;
+};
+
+}  // namespace util
+}  // namespace acero
+}  // namespace arrow
@@ -0,0 +1,230 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "arrow/acero/query_context.h"
+#include "arrow/acero/spilling_util.h"
+#include "arrow/acero/test_util_internal.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/test_util_internal.h"
+#include "arrow/memory_pool.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+
+using compute::ArgShape;
+using compute::ExecBatchFromJSON;
+
+namespace acero {
+namespace util {
+
+namespace {
+
+std::vector<ExecBatch> CollectPartitions(SpillingAccumulationQueue* queue) {
+  std::vector<ExecBatch> out;
+  for (int i = 0; i < queue->num_partitions(); ++i) {
+    EXPECT_OK_AND_ASSIGN(AccumulationQueue partition, queue->TakePartition(i));
+    for (size_t j = 0; j < partition.batch_count(); ++j) {
+      out.push_back(std::move(partition[j]));
+    }
+  }
+  return out;
+}
+
+}  // namespace
+
+TEST(SpillFile, RoundTrip) {
+  ASSERT_OK_AND_ASSIGN(auto store, SpillStore::Make(default_memory_pool()));
+  auto test_schema = schema({field("i", int32()), field("s", utf8())});
+  ASSERT_OK_AND_ASSIGN(auto file, store->CreateFile(test_schema));
+
+  std::vector<ExecBatch> batches = {
+      ExecBatchFromJSON({int32(), utf8()}, R"([[1, "a"], [2, null]])"),
+      ExecBatchFromJSON({int32(), utf8()}, R"([[null, "c"]])"),
+  };
+  for (const auto& batch : batches) {
+    ASSERT_OK(file->Write(batch));
+  }
+  ASSERT_OK(file->Finish());
+  ASSERT_RAISES(Invalid, file->Write(batches[0]));
+
+  ASSERT_EQ(2, file->num_batches());
+  ASSERT_EQ(3, file->num_rows());
+  ASSERT_OK_AND_ASSIGN(auto second, file->ReadBatch(1));
+  AssertExecBatchesEqual(test_schema, {batches[1]}, {second});
+  ASSERT_OK_AND_ASSIGN(auto all, file->ReadAll());
+  AssertExecBatchesEqual(test_schema, batches, all);
+  ASSERT_RAISES(IndexError, file->ReadBatch(2));
+
+  ASSERT_OK_AND_ASSIGN(auto path, ::arrow::internal::PlatformFilename::FromString(
+                                      file->path()));
+  ASSERT_OK_AND_EQ(true, ::arrow::internal::FileExists(path));
+  file.reset();
+  ASSERT_OK_AND_EQ(false, ::arrow::internal::FileExists(path));
+}
+
+TEST(SpillFile, ScalarsAreBroadcast) {
+  ASSERT_OK_AND_ASSIGN(auto store, SpillStore::Make(default_memory_pool()));
+  auto test_schema = schema({field("i", int32()), field("s", utf8())});
+  ASSERT_OK_AND_ASSIGN(auto file, store->CreateFile(test_schema));
+
+  auto batch = ExecBatchFromJSON({int32(), utf8()}, {ArgShape::ARRAY, ArgShape::SCALAR},
+                                 R"([[1, "x"], [2, "x"]])");
+  ASSERT_OK(file->Write(batch));
+  ASSERT_OK_AND_ASSIGN(auto read, file->ReadBatch(0));
+  ASSERT_TRUE(read[1].is_array());
+  AssertExecBatchesEqual(test_schema, {batch}, {read});
+}
+
+TEST(SpillingAccumulationQueue, InvalidOptions) {
+  QueryContext ctx;
+  ASSERT_OK_AND_ASSIGN(auto store, SpillStore::Make(default_memory_pool()));
+  auto test_schema = schema({field("i", int32())});
+  SpillingAccumulationQueue queue;
+  ASSERT_RAISES(Invalid, queue.Init(&ctx, store.get(), test_schema, {0},
+                                    /*num_partitions=*/3, /*memory_limit=*/0));
+  ASSERT_RAISES(Invalid, queue.Init(&ctx, store.get(), test_schema, {},
+                                    /*num_partitions=*/4, /*memory_limit=*/0));
+  ASSERT_RAISES(Invalid, queue.Init(&ctx, store.get(), test_schema, {1},
+                                    /*num_partitions=*/4, /*memory_limit=*/0));
+}
+
+TEST(SpillingAccumulationQueue, InMemory) {
+  QueryContext ctx;
+  ASSERT_OK_AND_ASSIGN(auto store, SpillStore::Make(default_memory_pool()));
+  BatchesWithSchema input =
+      MakeRandomBatches(schema({field("k", int32()), field("v", utf8())}),
+                        /*num_batches=*/8, /*batch_size=*/64);
+
+  SpillingAccumulationQueue queue;
+  ASSERT_OK(queue.Init(&ctx, store.get(), input.schema, {0}, /*num_partitions=*/8,
+                       /*memory_limit=*/std::numeric_limits<int64_t>::max()));
+  for (const auto& batch : input.batches) {
+    ASSERT_OK(queue.InsertBatch(batch));
+  }
+  ASSERT_OK(queue.Finish());
+  ASSERT_EQ(0, queue.num_spilled_partitions());
+  ASSERT_EQ(0, queue.bytes_spilled());
+  ASSERT_GT(queue.bytes_in_memory(), 0);
+
+  AssertExecBatchesEqualIgnoringOrder(input.schema, input.batches,
+                                      CollectPartitions(&queue));
+  ASSERT_EQ(0, queue.bytes_in_memory());
+}
+
+TEST(SpillingAccumulationQueue, Spills) {
+  QueryContext ctx;
+  ASSERT_OK_AND_ASSIGN(auto store, SpillStore::Make(default_memory_pool()));
+  BatchesWithSchema input =
+      MakeRandomBatches(schema({field("k", int64()), field("v", float64())}),
+                        /*num_batches=*/16, /*batch_size=*/128);
+
+  constexpr int64_t kMemoryLimit = 4096;
+  SpillingAccumulationQueue queue;
+  ASSERT_OK(queue.Init(&ctx, store.get(), input.schema, {0}, /*num_partitions=*/4,
+                       kMemoryLimit));
+  for (const auto& batch : input.batches) {
+    ASSERT_OK(queue.InsertBatch(batch));
+    ASSERT_LE(queue.bytes_in_memory(), kMemoryLimit);
+  }
+  ASSERT_OK(queue.Finish());
+  ASSERT_GT(queue.num_spilled_partitions(), 0);
+  ASSERT_GT(queue.bytes_spilled(), 0);
+
+  int64_t total_rows = 0;
+  for (int i = 0; i < queue.num_partitions(); ++i) {
+    total_rows += queue.row_count(i);
+  }
+  ASSERT_EQ(16 * 128, total_rows);
+
+  AssertExecBatchesEqualIgnoringOrder(input.schema, input.batches,
+                                      CollectPartitions(&queue));
+}
+
+TEST(SpillingAccumulationQueue, SpillsUnderMemoryPressure) {
+  constexpr int64_t kSoftLimit = 1 << 24;
+  CappedMemoryPool pool(default_memory_pool(), /*bytes_allocated_limit=*/1LL << 40,
+                        kSoftLimit);
+  QueryContext ctx({}, ExecContext(&pool));
+  ASSERT_FALSE(ctx.under_memory_pressure());
+  ASSERT_OK_AND_ASSIGN(auto store, SpillStore::Make(default_memory_pool()));
+  BatchesWithSchema input = MakeRandomBatches(schema({field("k", int32())}),
+                                              /*num_batches=*/4, /*batch_size=*/64);
+
+  SpillingAccumulationQueue queue;
+  ASSERT_OK(queue.Init(&ctx, store.get(), input.schema, {0}, /*num_partitions=*/4,
+                       /*memory_limit=*/std::numeric_limits<int64_t>::max()));
+  ASSERT_OK(queue.InsertBatch(input.batches[0]));
+  ASSERT_EQ(0, queue.num_spilled_partitions());
+
+  // Going above the soft limit makes the queue spill even though it is under its
+  // own memory limit
+  ASSERT_OK_AND_ASSIGN(auto buffer, AllocateBuffer(kSoftLimit, &pool));
+  ASSERT_TRUE(ctx.under_memory_pressure());
+  ASSERT_OK(queue.InsertBatch(input.batches[1]));
+  ASSERT_EQ(1, queue.num_spilled_partitions());
+
+  buffer.reset();
+  ASSERT_FALSE(ctx.under_memory_pressure());
+  for (size_t i = 2; i < input.batches.size(); ++i) {
+    ASSERT_OK(queue.InsertBatch(input.batches[i]));
+  }
+  ASSERT_OK(queue.Finish());
+  ASSERT_EQ(1, queue.num_spilled_partitions());
+  AssertExecBatchesEqualIgnoringOrder(input.schema, input.batches,
+                                      CollectPartitions(&queue));
+}
+
+TEST(SpillingAccumulationQueue, EqualKeysAreCoPartitioned) {
+  QueryContext ctx;
+  ASSERT_OK_AND_ASSIGN(auto store, SpillStore::Make(default_memory_pool()));
+  auto left_schema = schema({field("k", int32()), field("l", utf8())});
+  auto right_schema = schema({field("r", boolean()), field("k", int32())});
+
+  SpillingAccumulationQueue left, right;
+  ASSERT_OK(left.Init(&ctx, store.get(), left_schema, {0}, /*num_partitions=*/16,
+                      /*memory_limit=*/0));
+  ASSERT_OK(right.Init(&ctx, store.get(), right_schema, {1}, /*num_partitions=*/16,
+                       /*memory_limit=*/0));
+  ASSERT_OK(left.InsertBatch(ExecBatchFromJSON(
+      {int32(), utf8()}, R"([[1, "a"], [2, "b"], [3, "c"], [null, "d"], [5, "e"]])")));
+  ASSERT_OK(right.InsertBatch(ExecBatchFromJSON(
+      {boolean(), int32()},
+      R"([[true, 1], [false, 2], [true, 3], [false, null], [true, 5]])")));
+  ASSERT_OK(left.Finish());
+  ASSERT_OK(right.Finish());
+
+  for (int i = 0; i < 16; ++i) {
+    ASSERT_EQ(left.row_count(i), right.row_count(i));
+    ASSERT_OK_AND_ASSIGN(auto left_partition, left.TakePartition(i));
+    ASSERT_OK_AND_ASSIGN(auto right_partition, right.TakePartition(i));
+    ASSERT_EQ(left_partition.batch_count(), right_partition.batch_count());
+    for (size_t j = 0; j < left_partition.batch_count(); ++j) {
+      AssertDatumsEqual(left_partition[j][0], right_partition[j][1]);
+    }
+  }
+}
+
+}  // namespace util
+}  // namespace acero
+}  // namespace arrow
@@ -1109,12 +1109,18 @@ Status SwissTableForJoinBuild::Init(SwissTableForJoin* target, int dop, int64_t
   dop_ = dop;
   num_rows_ = num_rows;
 
-  // Make sure that we do not use many partitions if there are not enough rows.
+  // Use several partitions per thread, so that the build and merge tasks can be
+  // balanced across threads when some partitions take longer than others (skewed keys,
+  // slower cores, threads busy with other work), but make sure that we do not use many
+  // partitions if there are not enough rows.
   //
   constexpr int64_t min_num_rows_per_prtn = 1 << 12;
-  log_num_prtns_ =
-      std::min(bit_util::Log2(dop_),
-               bit_util::Log2(bit_util::CeilDiv(num_rows, min_num_rows_per_prtn)));
+  constexpr int num_prtns_per_thread = 4;
+  constexpr int max_log_num_prtns = 10;
+  log_num_prtns_ = std::min(
+      {bit_util::Log2(static_cast<uint64_t>(dop_) * num_prtns_per_thread),
+       bit_util::Log2(bit_util::CeilDiv(num_rows, min_num_rows_per_prtn)),
+       max_log_num_prtns});
   num_prtns_ = 1 << log_num_prtns_;
 
   reject_duplicate_keys_ = reject_duplicate_keys;
@@ -2461,7 +2467,8 @@ class SwissJoin : public HashJoinImpl {
 
     local_states_.resize(num_threads_);
     for (int i = 0; i < num_threads_; ++i) {
-      RETURN_NOT_OK(local_states_[i].stack.Init(pool_, kTempStackUsage));
+      RETURN_NOT_OK(
+          local_states_[i].stack.Init(ctx_->scratch_memory_pool(), kTempStackUsage));
       local_states_[i].num_output_batches = 0;
       local_states_[i].materialize.Init(pool_, proj_map_left, proj_map_right);
     }
@@ -77,7 +77,19 @@ class TaskSchedulerImpl : public TaskScheduler {
     AtomicWithPadding<int64_t> num_tasks_finished_;
   };
 
+  // Consecutive tasks of a group, executed one after the other by the same thread
+  struct TaskRun {
+    int group_id;
+    int64_t first_task;
+    int64_t num_tasks;
+  };
+
+  // Upper bound on the length of a TaskRun
+  static constexpr int64_t kMaxTasksPerRun = 16;
+
   std::vector<std::pair<int, int64_t>> PickTasks(int num_tasks, int start_task_group = 0);
+  std::vector<TaskRun> PickTaskRuns(int num_runs);
+  Status ExecuteTaskRun(size_t thread_id, const TaskRun& run);
   Status ExecuteTask(size_t thread_id, int group_id, int64_t task_id,
                      bool* task_group_finished);
   bool PostExecuteTask(size_t thread_id, int group_id);
@@ -206,6 +218,88 @@ std::vector<std::pair<int, int64_t>> TaskSchedulerImpl::PickTasks(int num_tasks,
   return result;
 }
 
+std::vector<TaskSchedulerImpl::TaskRun> TaskSchedulerImpl::PickTaskRuns(int num_runs) {
+  std::vector<TaskRun> result;
+  for (size_t i = 0; i < task_groups_.size(); ++i) {
+    int task_group_id = static_cast<int>(i);
+    TaskGroup& task_group = task_groups_[task_group_id];
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (task_group.state_ != TaskGroupState::READY) {
+        continue;
+      }
+    }
+
+    // Hand out long runs while many tasks remain, so that a thread keeps working on
+    // neighbouring tasks with its per-thread state hot in its cache, and single tasks
+    // towards the end so that all threads finish at about the same time.
+    int64_t num_tasks_left =
+        task_group.num_tasks_present_ - task_group.num_tasks_started_.value.load();
+    int64_t run_length = std::clamp<int64_t>(
+        num_tasks_left / (2 * std::max(1, num_concurrent_tasks_)), 1, kMaxTasksPerRun);
+
+    int num_runs_remaining = num_runs - static_cast<int>(result.size());
+    int64_t start_task =
+        task_group.num_tasks_started_.value.fetch_add(num_runs_remaining * run_length);
+    if (start_task >= task_group.num_tasks_present_) {
+      continue;
+    }
+
+    int64_t end_task = start_task + num_runs_remaining * run_length;
+    if (end_task >= task_group.num_tasks_present_) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (task_group.state_ == TaskGroupState::READY) {
+          task_group.state_ = TaskGroupState::ALL_TASKS_STARTED;
+        }
+      }
+      end_task = task_group.num_tasks_present_;
+    }
+
+    for (int64_t first_task = start_task; first_task < end_task;
+         first_task += run_length) {
+      result.push_back({task_group_id, first_task,
+                        std::min(run_length, end_task - first_task)});
+    }
+
+    if (static_cast<int>(result.size()) == num_runs) {
+      break;
+    }
+  }
+
+  return result;
+}
+
+Status TaskSchedulerImpl::ExecuteTaskRun(size_t thread_id, const TaskRun& run) {
+  bool task_group_finished = false;
+  // PostExecuteTask must be called for the tasks that were not executed if any error
+  // occurs (including in ScheduleMore), so we preserve the status.
+  Status status = ScheduleMore(thread_id, 1);
+  int64_t num_tasks_done = 0;
+  while (status.ok() && num_tasks_done < run.num_tasks) {
+    status = ExecuteTask(thread_id, run.group_id, run.first_task + num_tasks_done,
+                         &task_group_finished);
+    if (status.ok()) {
+      ++num_tasks_done;
+    }
+  }
+  if (!status.ok()) {
+    for (; num_tasks_done < run.num_tasks; ++num_tasks_done) {
+      task_group_finished = PostExecuteTask(thread_id, run.group_id);
+    }
+  }
+
+  // Only the last task of the run can be the last task of the group
+  if (task_group_finished) {
+    bool all_task_groups_finished = false;
+    RETURN_NOT_OK(
+        OnTaskGroupFinished(thread_id, run.group_id, &all_task_groups_finished));
+  }
+
+  return status;
+}
+
 Status TaskSchedulerImpl::ExecuteTask(size_t thread_id, int group_id, int64_t task_id,
                                       bool* task_group_finished) {
   if (!aborted_.value.load()) {
@@ -345,45 +439,24 @@ Status TaskSchedulerImpl::ScheduleMore(size_t thread_id, int num_tasks_finished)
     return Status::OK();
   }
 
-  const auto& tasks = PickTasks(num_new_tasks);
-  if (static_cast<int>(tasks.size()) < num_new_tasks) {
-    num_tasks_to_schedule_.value += num_new_tasks - static_cast<int>(tasks.size());
+  const auto& runs = PickTaskRuns(num_new_tasks);
+  if (static_cast<int>(runs.size()) < num_new_tasks) {
+    num_tasks_to_schedule_.value += num_new_tasks - static_cast<int>(runs.size());
   }
 
   bool expected_might_have_missed_tasks = true;
   if (tasks_added_recently_.value.compare_exchange_strong(
           expected_might_have_missed_tasks, false)) {
-    if (tasks.empty()) {
+    if (runs.empty()) {
       // num_tasks_finished has already been added to num_tasks_to_schedule so
       // pass 0 here.
       return ScheduleMore(thread_id);
     }
   }
 
-  for (size_t i = 0; i < tasks.size(); ++i) {
-    int group_id = tasks[i].first;
-    int64_t task_id = tasks[i].second;
-    RETURN_NOT_OK(schedule_impl_([this, group_id, task_id](size_t thread_id) -> Status {
-      bool task_group_finished = false;
-      // PostExecuteTask must be called later if any error ocurres during task execution
-      // (including ScheduleMore), so we preserve the status.
-      auto status = [&]() {
-        RETURN_NOT_OK(ScheduleMore(thread_id, 1));
-        return ExecuteTask(thread_id, group_id, task_id, &task_group_finished);
-      }();
-
-      if (!status.ok()) {
-        task_group_finished = PostExecuteTask(thread_id, group_id);
-      }
-
-      if (task_group_finished) {
-        bool all_task_groups_finished = false;
-        RETURN_NOT_OK(
-            OnTaskGroupFinished(thread_id, group_id, &all_task_groups_finished));
-      }
-
-      return status;
-    }));
+  for (const TaskRun& run : runs) {
+    RETURN_NOT_OK(schedule_impl_(
+        [this, run](size_t thread_id) { return ExecuteTaskRun(thread_id, run); }));
   }
 
   return Status::OK();
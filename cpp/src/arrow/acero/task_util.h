@@ -51,7 +51,10 @@ class AtomicWithPadding {
 //
 // Implements priorities between multiple such operations, called task groups.
 //
-// Allows to specify the maximum number of in-flight tasks at any moment.
+// Allows to specify the maximum number of in-flight tasks at any moment.  Each
+// scheduled task executes a run of consecutive tasks of a group, so that a thread
+// keeps working on neighbouring data instead of picking up unrelated tasks, the
+// runs getting shorter as the group nears completion to balance the load.
 //
 // Also allows for executing next pending tasks immediately using a caller thread.
 //
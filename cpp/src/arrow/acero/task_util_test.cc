@@ -231,6 +231,59 @@ TEST(TaskScheduler, StressTwo) {
   }
 }
 
+TEST(TaskScheduler, EachTaskRunsOnce) {
+#ifndef ARROW_ENABLE_THREADING
+  GTEST_SKIP() << "Test requires threading support";
+#endif
+  // Tasks are handed out in runs of consecutive tasks, make sure that the runs cover
+  // every task exactly once whatever the number of tasks and concurrency
+  constexpr int kNumThreads = 8;
+
+  ThreadIndexer thread_indexer;
+  int num_threads = std::min(static_cast<int>(thread_indexer.Capacity()), kNumThreads);
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<ThreadPool> thread_pool,
+                       MakePrimedThreadPool(num_threads));
+  TaskScheduler::ScheduleImpl schedule =
+      [&](TaskScheduler::TaskGroupContinuationImpl task) {
+        return thread_pool->Spawn([&, task] {
+          std::size_t thread_id = thread_indexer();
+          ASSERT_OK(task(thread_id));
+        });
+      };
+
+  for (int num_tasks : {1, 7, 100, 1000, 5000}) {
+    ARROW_SCOPED_TRACE("num_tasks = ", num_tasks);
+    for (int num_concurrent_tasks : {1, 3, 4 * num_threads}) {
+      ARROW_SCOPED_TRACE("num_concurrent_tasks = ", num_concurrent_tasks);
+      std::vector<std::atomic<int>> num_runs(num_tasks);
+      std::atomic<int> num_groups_finished(0);
+      auto scheduler = TaskScheduler::Make();
+      int task_group = scheduler->RegisterTaskGroup(
+          [&](std::size_t, int64_t task_id) {
+            num_runs[task_id].fetch_add(1);
+            return Status::OK();
+          },
+          [&](std::size_t) {
+            num_groups_finished.fetch_add(1);
+            return Status::OK();
+          });
+      scheduler->RegisterEnd();
+
+      ASSERT_OK(scheduler->StartScheduling(/*thread_id=*/0, schedule,
+                                           num_concurrent_tasks,
+                                           /*use_sync_execution=*/false));
+      ASSERT_OK(scheduler->StartTaskGroup(/*thread_id=*/0, task_group, num_tasks));
+      BusyWait(10, [&] { return num_groups_finished.load() == 1; });
+      thread_pool->WaitForIdle();
+
+      ASSERT_EQ(num_groups_finished.load(), 1);
+      for (int i = 0; i < num_tasks; ++i) {
+        ASSERT_EQ(num_runs[i].load(), 1) << "task " << i;
+      }
+    }
+  }
+}
+
 TEST(TaskScheduler, AbortContOnTaskErrorSerial) {
   constexpr int kNumTasks = 16;
 
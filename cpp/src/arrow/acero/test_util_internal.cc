@@ -67,8 +67,10 @@ using compute::Take;
 namespace acero {
 
 std::vector<int64_t> HardwareFlagsForTesting() {
-  // Acero currently only has AVX2 optimizations
-  return arrow::GetSupportedHardwareFlags({CpuInfo::AVX2});
+  // Acero currently has AVX2 optimizations, plus AVX-512 ones in key hashing and the
+  // Swiss table
+  return arrow::GetSupportedHardwareFlags(
+      {CpuInfo::AVX2, CpuInfo::AVX2 | CpuInfo::AVX512});
 }
 
 namespace {
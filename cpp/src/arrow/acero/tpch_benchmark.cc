@@ -17,39 +17,199 @@
 
 #include <benchmark/benchmark.h>
 
+#include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
-#include "arrow/acero/test_util_internal.h"
+#include "arrow/acero/profile.h"
 #include "arrow/acero/tpch_node.h"
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/compute/api_scalar.h"
 #include "arrow/compute/cast.h"
-#include "arrow/testing/future_util.h"
+#include "arrow/memory_pool.h"
+#include "arrow/table.h"
+#include "arrow/util/config.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string.h"
+#include "arrow/util/thread_pool.h"
 
+#if defined(ARROW_DATASET) && defined(ARROW_PARQUET)
+#  include "arrow/dataset/discovery.h"
+#  include "arrow/dataset/file_base.h"
+#  include "arrow/dataset/file_parquet.h"
+#  include "arrow/dataset/partition.h"
+#  include "arrow/dataset/plan.h"
+#  include "arrow/dataset/scanner.h"
+#  include "arrow/filesystem/localfs.h"
+#  include "arrow/util/io_util.h"
+#  ifdef ARROW_S3
+#    include "arrow/filesystem/s3_test_util.h"
+#    include "arrow/filesystem/s3fs.h"
+#  endif
+#endif
+
+#include <cstdlib>
+#include <functional>
+#include <map>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace arrow {
 
+using compute::and_;
 using compute::call;
 using compute::CountOptions;
 using compute::field_ref;
+using compute::not_;
+using compute::or_;
+using compute::Ordering;
 using compute::ScalarAggregateOptions;
+using compute::SelectKOptions;
 using compute::SortKey;
+using compute::SortOrder;
 
 namespace acero {
 namespace internal {
 
-std::shared_ptr<ExecPlan> Plan_Q1(AsyncGenerator<std::optional<ExecBatch>>* sink_gen,
-                                  int scale_factor) {
-  std::shared_ptr<ExecPlan> plan = *ExecPlan::Make();
-  std::unique_ptr<TpchGen> gen =
-      *TpchGen::Make(plan.get(), static_cast<double>(scale_factor));
+namespace {
+
+// Dates are expressed as days after January 1, 1970
+constexpr int32_t kJuly1_1993 = 8582;
+constexpr int32_t kOctober1_1993 = 8674;
+constexpr int32_t kJanuary1_1994 = 8766;
+constexpr int32_t kJanuary1_1995 = 9131;
+constexpr int32_t kMarch15_1995 = 9204;
+constexpr int32_t kSeptember1_1995 = 9374;
+constexpr int32_t kOctober1_1995 = 9404;
+constexpr int32_t kJanuary1_1996 = 9496;
+constexpr int32_t kApril1_1996 = 9587;
+constexpr int32_t kDecember31_1996 = 9861;
+constexpr int32_t kSeptember2_1998 = 10471;
+
+Expression DateLiteral(int32_t days) {
+  return literal(std::make_shared<Date32Scalar>(days));
+}
+
+// Money columns are decimal128(12, 2), so `hundredths` is the unscaled value
+Expression DecimalLiteral(int64_t hundredths) {
+  return literal(
+      std::make_shared<Decimal128Scalar>(Decimal128(hundredths), decimal128(12, 2)));
+}
+
+// The generator zero-pads text columns up to their fixed width, so the literals
+// compared against them must be padded the same way
+Expression FixedSizeBinaryLiteral(std::string_view value, int32_t byte_width) {
+  std::string padded(value);
+  padded.resize(byte_width, '\0');
+  return literal(std::make_shared<FixedSizeBinaryScalar>(
+      Buffer::FromString(std::move(padded)), fixed_size_binary(byte_width)));
+}
+
+// L_EXTENDEDPRICE * (1 - L_DISCOUNT)
+Expression DiscountedPrice() {
+  Expression discount_multiplier =
+      call("subtract", {DecimalLiteral(100), field_ref("L_DISCOUNT")});
+  return call("multiply", {field_ref("L_EXTENDEDPRICE"), discount_multiplier});
+}
+
+// Zero, typed like DiscountedPrice() as both branches of if_else must be
+Expression NoDiscountedPrice() {
+  return literal(std::make_shared<Decimal128Scalar>(Decimal128(0), decimal128(26, 4)));
+}
+
+// Sums of money are decimal128(38, _), which leaves no precision to divide or scale
+// them as decimals
+Expression ToDouble(Expression value) {
+  return call("cast", {std::move(value)}, compute::CastOptions::Safe(float64()));
+}
+
+std::shared_ptr<ScalarAggregateOptions> SumOptions() {
+  return std::make_shared<ScalarAggregateOptions>(ScalarAggregateOptions::Defaults());
+}
+
+// values IN (set), for a fixed width text column
+Expression IsIn(Expression values, const std::vector<std::string_view>& set,
+                int32_t byte_width) {
+  FixedSizeBinaryBuilder builder(fixed_size_binary(byte_width));
+  for (std::string_view value : set) {
+    std::string padded(value);
+    padded.resize(byte_width, '\0');
+    ARROW_CHECK_OK(builder.Append(padded));
+  }
+  return call("is_in", {std::move(values)},
+              compute::SetLookupOptions(*builder.Finish()));
+}
+
+Expression IsIn(Expression values, const std::vector<int32_t>& set) {
+  Int32Builder builder;
+  ARROW_CHECK_OK(builder.AppendValues(set));
+  return call("is_in", {std::move(values)},
+              compute::SetLookupOptions(*builder.Finish()));
+}
 
-  ExecNode* lineitem =
-      *gen->Lineitem({"L_QUANTITY", "L_EXTENDEDPRICE", "L_TAX", "L_DISCOUNT",
-                      "L_SHIPDATE", "L_RETURNFLAG", "L_LINESTATUS"});
+Expression Between(const Expression& value, Expression low, Expression high) {
+  return and_(greater_equal(value, std::move(low)), less_equal(value, std::move(high)));
+}
 
-  auto sept_2_1998 = std::make_shared<Date32Scalar>(
-      10471);  // September 2, 1998 is 10471 days after January 1, 1970
-  Expression filter =
-      less_equal(field_ref("L_SHIPDATE"), literal(std::move(sept_2_1998)));
+// `first` <= value < `last`
+Expression InRange(const Expression& value, Expression first, Expression last) {
+  return and_(greater_equal(value, std::move(first)), less(value, std::move(last)));
+}
+
+Expression StartsWith(Expression value, std::string pattern) {
+  return call("starts_with", {std::move(value)},
+              compute::MatchSubstringOptions(std::move(pattern)));
+}
+
+// Renames the columns of `input`, needed when a query reads a table twice since the
+// columns of both sides of a join must have distinct names
+Declaration Rename(Declaration input, const std::vector<std::string>& columns,
+                   std::vector<std::string> names) {
+  std::vector<Expression> exprs;
+  for (const std::string& column : columns) exprs.push_back(field_ref(column));
+  return Declaration::Sequence(
+      {std::move(input),
+       {"project", ProjectNodeOptions(std::move(exprs), std::move(names))}});
+}
+
+// Keeps `columns` of `input` and adds a constant column `key`, on which the relation
+// can be joined with the single row of a scalar aggregate
+Declaration WithConstantKey(Declaration input, std::vector<std::string> columns,
+                            std::string key) {
+  std::vector<Expression> exprs;
+  for (const std::string& column : columns) exprs.push_back(field_ref(column));
+  exprs.push_back(literal(0));
+  columns.push_back(std::move(key));
+  return Declaration::Sequence(
+      {std::move(input),
+       {"project", ProjectNodeOptions(std::move(exprs), std::move(columns))}});
+}
+
+// The tables the queries read.  Every call to Scan() creates a new source, so a
+// query may read the same table more than once, as its subqueries often do.
+class TpchTables {
+ public:
+  explicit TpchTables(double scale_factor) : scale_factor_(scale_factor) {}
+  virtual ~TpchTables() = default;
+
+  double scale_factor() const { return scale_factor_; }
+
+  // A source of the `columns` of the table `name` (e.g. "lineitem")
+  virtual Declaration Scan(const std::string& name,
+                           std::vector<std::string> columns) const = 0;
+
+ private:
+  const double scale_factor_;
+};
+
+Declaration Q1(const TpchTables& tables) {
+  Declaration lineitem =
+      tables.Scan("lineitem", {"L_QUANTITY", "L_EXTENDEDPRICE", "L_TAX", "L_DISCOUNT",
+                               "L_SHIPDATE", "L_RETURNFLAG", "L_LINESTATUS"});
+
+  Expression filter = less_equal(field_ref("L_SHIPDATE"), DateLiteral(kSeptember2_1998));
   FilterNodeOptions filter_opts(filter);
 
   Expression l_returnflag = field_ref("L_RETURNFLAG");
@@ -57,17 +217,11 @@ std::shared_ptr<ExecPlan> Plan_Q1(AsyncGenerator<std::optional<ExecBatch>>* sink
   Expression quantity = field_ref("L_QUANTITY");
   Expression base_price = field_ref("L_EXTENDEDPRICE");
 
-  std::shared_ptr<Decimal128Scalar> decimal_1 =
-      std::make_shared<Decimal128Scalar>(Decimal128{0, 100}, decimal128(12, 2));
-  Expression discount_multiplier =
-      call("subtract", {literal(decimal_1), field_ref("L_DISCOUNT")});
-  Expression tax_multiplier = call("add", {literal(decimal_1), field_ref("L_TAX")});
-  Expression disc_price =
-      call("multiply", {field_ref("L_EXTENDEDPRICE"), discount_multiplier});
+  Expression tax_multiplier = call("add", {DecimalLiteral(100), field_ref("L_TAX")});
+  Expression disc_price = DiscountedPrice();
   Expression charge =
       call("multiply",
-           {call("cast",
-                 {call("multiply", {field_ref("L_EXTENDEDPRICE"), discount_multiplier})},
+           {call("cast", {DiscountedPrice()},
                  compute::CastOptions::Unsafe(decimal128(12, 2))),
             tax_multiplier});
   Expression discount = field_ref("L_DISCOUNT");
@@ -80,8 +234,7 @@ std::shared_ptr<ExecPlan> Plan_Q1(AsyncGenerator<std::optional<ExecBatch>>* sink
       "sum_charge",   "avg_qty",      "avg_price", "avg_disc"};
   ProjectNodeOptions project_opts(std::move(projection_list), std::move(project_names));
 
-  auto sum_opts =
-      std::make_shared<ScalarAggregateOptions>(ScalarAggregateOptions::Defaults());
+  auto sum_opts = SumOptions();
   auto count_opts = std::make_shared<CountOptions>(CountOptions::CountMode::ALL);
   std::vector<arrow::compute::Aggregate> aggs = {
       {"hash_sum", sum_opts, "sum_qty", "sum_qty"},
@@ -96,34 +249,1283 @@ std::shared_ptr<ExecPlan> Plan_Q1(AsyncGenerator<std::optional<ExecBatch>>* sink
   std::vector<FieldRef> keys = {"l_returnflag", "l_linestatus"};
   AggregateNodeOptions agg_opts(aggs, keys);
 
-  SortKey l_returnflag_key("l_returnflag");
-  SortKey l_linestatus_key("l_linestatus");
-  SortOptions sort_opts({l_returnflag_key, l_linestatus_key});
-  OrderBySinkNodeOptions order_by_opts(sort_opts, sink_gen);
+  OrderByNodeOptions order_by_opts(
+      Ordering({SortKey("l_returnflag"), SortKey("l_linestatus")}));
+
+  return Declaration::Sequence(
+      {{"filter", {std::move(lineitem)}, filter_opts},
+       {"project", project_opts},
+       {"aggregate", agg_opts},
+       {"order_by", order_by_opts}});
+}
+
+Declaration Q2(const TpchTables& tables) {
+  // The suppliers in EUROPE and their partsupp rows, which both the query and its
+  // subquery read
+  auto european_partsupp = [&tables](std::vector<std::string> supplier_columns) {
+    Declaration region(
+        "filter", {tables.Scan("region", {"R_REGIONKEY", "R_NAME"})},
+        FilterNodeOptions(
+            equal(field_ref("R_NAME"), FixedSizeBinaryLiteral("EUROPE", 25))));
+    Declaration nation("hashjoin",
+                       {tables.Scan("nation", {"N_NATIONKEY", "N_NAME", "N_REGIONKEY"}),
+                        std::move(region)},
+                       HashJoinNodeOptions({"N_REGIONKEY"}, {"R_REGIONKEY"}));
+    Declaration supplier("hashjoin",
+                         {tables.Scan("supplier", std::move(supplier_columns)),
+                          std::move(nation)},
+                         HashJoinNodeOptions({"S_NATIONKEY"}, {"N_NATIONKEY"}));
+    return Declaration(
+        "hashjoin",
+        {tables.Scan("partsupp", {"PS_PARTKEY", "PS_SUPPKEY", "PS_SUPPLYCOST"}),
+         std::move(supplier)},
+        HashJoinNodeOptions({"PS_SUPPKEY"}, {"S_SUPPKEY"}));
+  };
+
+  // The lowest supply cost of each part in EUROPE
+  Declaration min_cost = Declaration::Sequence(
+      {european_partsupp({"S_SUPPKEY", "S_NATIONKEY"}),
+       {"project",
+        ProjectNodeOptions({field_ref("PS_PARTKEY"), field_ref("PS_SUPPLYCOST")},
+                           {"min_partkey", "supplycost"})},
+       {"aggregate",
+        AggregateNodeOptions({{"hash_min", nullptr, "supplycost", "min_supplycost"}},
+                             {"min_partkey"})}});
+
+  Declaration part(
+      "filter", {tables.Scan("part", {"P_PARTKEY", "P_MFGR", "P_TYPE", "P_SIZE"})},
+      FilterNodeOptions(and_(equal(field_ref("P_SIZE"), literal(15)),
+                             call("ends_with", {field_ref("P_TYPE")},
+                                  compute::MatchSubstringOptions("BRASS")))));
+  Declaration partsupp(
+      "hashjoin",
+      {european_partsupp({"S_SUPPKEY", "S_NAME", "S_ADDRESS", "S_NATIONKEY", "S_PHONE",
+                          "S_ACCTBAL", "S_COMMENT"}),
+       std::move(part)},
+      HashJoinNodeOptions({"PS_PARTKEY"}, {"P_PARTKEY"}));
+  Declaration join("hashjoin", {std::move(partsupp), std::move(min_cost)},
+                   HashJoinNodeOptions({"PS_PARTKEY", "PS_SUPPLYCOST"},
+                                       {"min_partkey", "min_supplycost"}));
+
+  ProjectNodeOptions project_opts(
+      {field_ref("S_ACCTBAL"), field_ref("S_NAME"), field_ref("N_NAME"),
+       field_ref("P_PARTKEY"), field_ref("P_MFGR"), field_ref("S_ADDRESS"),
+       field_ref("S_PHONE"), field_ref("S_COMMENT")},
+      {"s_acctbal", "s_name", "n_name", "p_partkey", "p_mfgr", "s_address", "s_phone",
+       "s_comment"});
+  SelectKNodeOptions select_k_opts(
+      SelectKOptions(100, {SortKey("s_acctbal", SortOrder::Descending),
+                           SortKey("n_name"), SortKey("s_name"), SortKey("p_partkey")}));
+
+  return Declaration::Sequence(
+      {std::move(join), {"project", project_opts}, {"select_k", select_k_opts}});
+}
+
+Declaration Q3(const TpchTables& tables) {
+  Declaration customer(
+      "filter", {tables.Scan("customer", {"C_CUSTKEY", "C_MKTSEGMENT"})},
+      FilterNodeOptions(equal(field_ref("C_MKTSEGMENT"),
+                              FixedSizeBinaryLiteral("BUILDING", 10))));
+  Declaration orders(
+      "filter",
+      {tables.Scan("orders",
+                   {"O_ORDERKEY", "O_CUSTKEY", "O_ORDERDATE", "O_SHIPPRIORITY"})},
+      FilterNodeOptions(less(field_ref("O_ORDERDATE"), DateLiteral(kMarch15_1995))));
+  Declaration lineitem(
+      "filter",
+      {tables.Scan("lineitem",
+                   {"L_ORDERKEY", "L_EXTENDEDPRICE", "L_DISCOUNT", "L_SHIPDATE"})},
+      FilterNodeOptions(greater(field_ref("L_SHIPDATE"), DateLiteral(kMarch15_1995))));
+
+  // The right input of a hash join is the build side, so the smaller relation
+  // always goes there
+  Declaration customer_orders(
+      "hashjoin", {std::move(orders), std::move(customer)},
+      HashJoinNodeOptions({"O_CUSTKEY"}, {"C_CUSTKEY"}));
+  Declaration join("hashjoin", {std::move(lineitem), std::move(customer_orders)},
+                   HashJoinNodeOptions({"L_ORDERKEY"}, {"O_ORDERKEY"}));
 
-  Declaration filter_decl("filter", {Declaration::Input(lineitem)}, filter_opts);
-  Declaration project_decl("project", project_opts);
-  Declaration aggregate_decl("aggregate", agg_opts);
-  Declaration orderby_decl("order_by_sink", order_by_opts);
+  ProjectNodeOptions project_opts(
+      {field_ref("L_ORDERKEY"), field_ref("O_ORDERDATE"), field_ref("O_SHIPPRIORITY"),
+       DiscountedPrice()},
+      {"l_orderkey", "o_orderdate", "o_shippriority", "revenue"});
+  AggregateNodeOptions agg_opts({{"hash_sum", SumOptions(), "revenue", "revenue"}},
+                                {"l_orderkey", "o_orderdate", "o_shippriority"});
+  SelectKNodeOptions select_k_opts(SelectKOptions(
+      10, {SortKey("revenue", SortOrder::Descending), SortKey("o_orderdate")}));
 
-  Declaration q1 =
-      Declaration::Sequence({filter_decl, project_decl, aggregate_decl, orderby_decl});
-  std::ignore = *q1.AddToPlan(plan.get());
-  return plan;
+  return Declaration::Sequence({std::move(join),
+                                {"project", project_opts},
+                                {"aggregate", agg_opts},
+                                {"select_k", select_k_opts}});
 }
 
-static void BM_Tpch_Q1(benchmark::State& st) {
+Declaration Q4(const TpchTables& tables) {
+  Declaration orders(
+      "filter",
+      {tables.Scan("orders", {"O_ORDERKEY", "O_ORDERDATE", "O_ORDERPRIORITY"})},
+      FilterNodeOptions(InRange(field_ref("O_ORDERDATE"), DateLiteral(kJuly1_1993),
+                                DateLiteral(kOctober1_1993))));
+  Declaration lineitem(
+      "filter",
+      {tables.Scan("lineitem", {"L_ORDERKEY", "L_COMMITDATE", "L_RECEIPTDATE"})},
+      FilterNodeOptions(less(field_ref("L_COMMITDATE"), field_ref("L_RECEIPTDATE"))));
+  // EXISTS (late lineitem): the few orders of the quarter are the build side, and
+  // are emitted once for any number of matches
+  Declaration join("hashjoin", {std::move(lineitem), std::move(orders)},
+                   HashJoinNodeOptions(JoinType::RIGHT_SEMI, {"L_ORDERKEY"},
+                                       {"O_ORDERKEY"}));
+
+  auto count_opts = std::make_shared<CountOptions>(CountOptions::CountMode::ALL);
+  AggregateNodeOptions agg_opts({{"hash_count", count_opts, "O_ORDERKEY", "order_count"}},
+                                {"O_ORDERPRIORITY"});
+  OrderByNodeOptions order_by_opts(Ordering({SortKey("O_ORDERPRIORITY")}));
+
+  return Declaration::Sequence(
+      {std::move(join), {"aggregate", agg_opts}, {"order_by", order_by_opts}});
+}
+
+Declaration Q5(const TpchTables& tables) {
+  Declaration region(
+      "filter", {tables.Scan("region", {"R_REGIONKEY", "R_NAME"})},
+      FilterNodeOptions(equal(field_ref("R_NAME"), FixedSizeBinaryLiteral("ASIA", 25))));
+  Declaration nation(
+      "hashjoin",
+      {tables.Scan("nation", {"N_NATIONKEY", "N_NAME", "N_REGIONKEY"}),
+       std::move(region)},
+      HashJoinNodeOptions({"N_REGIONKEY"}, {"R_REGIONKEY"}));
+  Declaration supplier(
+      "hashjoin",
+      {tables.Scan("supplier", {"S_SUPPKEY", "S_NATIONKEY"}),
+       std::move(nation)},
+      HashJoinNodeOptions({"S_NATIONKEY"}, {"N_NATIONKEY"}));
+
+  Declaration orders(
+      "filter",
+      {tables.Scan("orders", {"O_ORDERKEY", "O_CUSTKEY", "O_ORDERDATE"})},
+      FilterNodeOptions(
+          and_(greater_equal(field_ref("O_ORDERDATE"), DateLiteral(kJanuary1_1994)),
+               less(field_ref("O_ORDERDATE"), DateLiteral(kJanuary1_1995)))));
+  Declaration customer_orders(
+      "hashjoin",
+      {std::move(orders),
+       tables.Scan("customer", {"C_CUSTKEY", "C_NATIONKEY"})},
+      HashJoinNodeOptions({"O_CUSTKEY"}, {"C_CUSTKEY"}));
+  Declaration lineitem_orders(
+      "hashjoin",
+      {tables.Scan("lineitem",
+                   {"L_ORDERKEY", "L_SUPPKEY", "L_EXTENDEDPRICE", "L_DISCOUNT"}),
+       std::move(customer_orders)},
+      HashJoinNodeOptions({"L_ORDERKEY"}, {"O_ORDERKEY"}));
+  // The customer and the supplier must be from the same nation
+  Declaration join("hashjoin", {std::move(lineitem_orders), std::move(supplier)},
+                   HashJoinNodeOptions({"L_SUPPKEY", "C_NATIONKEY"},
+                                       {"S_SUPPKEY", "S_NATIONKEY"}));
+
+  ProjectNodeOptions project_opts({field_ref("N_NAME"), DiscountedPrice()},
+                                  {"n_name", "revenue"});
+  AggregateNodeOptions agg_opts({{"hash_sum", SumOptions(), "revenue", "revenue"}},
+                                {"n_name"});
+  OrderByNodeOptions order_by_opts(
+      Ordering({SortKey("revenue", SortOrder::Descending)}));
+
+  return Declaration::Sequence({std::move(join),
+                                {"project", project_opts},
+                                {"aggregate", agg_opts},
+                                {"order_by", order_by_opts}});
+}
+
+Declaration Q6(const TpchTables& tables) {
+  Declaration lineitem = tables.Scan(
+      "lineitem", {"L_SHIPDATE", "L_DISCOUNT", "L_QUANTITY", "L_EXTENDEDPRICE"});
+
+  FilterNodeOptions filter_opts(
+      and_({greater_equal(field_ref("L_SHIPDATE"), DateLiteral(kJanuary1_1994)),
+            less(field_ref("L_SHIPDATE"), DateLiteral(kJanuary1_1995)),
+            greater_equal(field_ref("L_DISCOUNT"), DecimalLiteral(5)),
+            less_equal(field_ref("L_DISCOUNT"), DecimalLiteral(7)),
+            less(field_ref("L_QUANTITY"), DecimalLiteral(2400))}));
+  ProjectNodeOptions project_opts(
+      {call("multiply", {field_ref("L_EXTENDEDPRICE"), field_ref("L_DISCOUNT")})},
+      {"revenue"});
+  AggregateNodeOptions agg_opts({{"sum", SumOptions(), "revenue", "revenue"}});
+
+  return Declaration::Sequence({{"filter", {std::move(lineitem)}, filter_opts},
+                                {"project", project_opts},
+                                {"aggregate", agg_opts}});
+}
+
+Declaration Q7(const TpchTables& tables) {
+  // The nation table is read once for the suppliers and once for the customers
+  auto nation = [&tables](std::string key, std::string name) {
+    return Declaration(
+        "filter",
+        {Rename(tables.Scan("nation", {"N_NATIONKEY", "N_NAME"}),
+                {"N_NATIONKEY", "N_NAME"}, {key, name})},
+        FilterNodeOptions(IsIn(field_ref(name), {"FRANCE", "GERMANY"}, 25)));
+  };
+  Declaration supplier("hashjoin",
+                       {tables.Scan("supplier", {"S_SUPPKEY", "S_NATIONKEY"}),
+                        nation("supp_nationkey", "supp_nation")},
+                       HashJoinNodeOptions({"S_NATIONKEY"}, {"supp_nationkey"}));
+  Declaration customer("hashjoin",
+                       {tables.Scan("customer", {"C_CUSTKEY", "C_NATIONKEY"}),
+                        nation("cust_nationkey", "cust_nation")},
+                       HashJoinNodeOptions({"C_NATIONKEY"}, {"cust_nationkey"}));
+  Declaration orders(
+      "hashjoin",
+      {tables.Scan("orders", {"O_ORDERKEY", "O_CUSTKEY"}), std::move(customer)},
+      HashJoinNodeOptions({"O_CUSTKEY"}, {"C_CUSTKEY"}));
+
+  Declaration lineitem(
+      "filter",
+      {tables.Scan("lineitem", {"L_ORDERKEY", "L_SUPPKEY", "L_SHIPDATE",
+                                "L_EXTENDEDPRICE", "L_DISCOUNT"})},
+      FilterNodeOptions(Between(field_ref("L_SHIPDATE"), DateLiteral(kJanuary1_1995),
+                                DateLiteral(kDecember31_1996))));
+  Declaration lineitem_supplier("hashjoin", {std::move(lineitem), std::move(supplier)},
+                                HashJoinNodeOptions({"L_SUPPKEY"}, {"S_SUPPKEY"}));
+  Declaration join("hashjoin", {std::move(lineitem_supplier), std::move(orders)},
+                   HashJoinNodeOptions({"L_ORDERKEY"}, {"O_ORDERKEY"}));
+
+  // Both nations are FRANCE or GERMANY, so this keeps the two pairs of the query
+  FilterNodeOptions filter_opts(
+      not_equal(field_ref("supp_nation"), field_ref("cust_nation")));
+  ProjectNodeOptions project_opts(
+      {field_ref("supp_nation"), field_ref("cust_nation"),
+       call("year", {field_ref("L_SHIPDATE")}), DiscountedPrice()},
+      {"supp_nation", "cust_nation", "l_year", "volume"});
+  AggregateNodeOptions agg_opts({{"hash_sum", SumOptions(), "volume", "revenue"}},
+                                {"supp_nation", "cust_nation", "l_year"});
+  OrderByNodeOptions order_by_opts(Ordering(
+      {SortKey("supp_nation"), SortKey("cust_nation"), SortKey("l_year")}));
+
+  return Declaration::Sequence({std::move(join),
+                                {"filter", filter_opts},
+                                {"project", project_opts},
+                                {"aggregate", agg_opts},
+                                {"order_by", order_by_opts}});
+}
+
+Declaration Q8(const TpchTables& tables) {
+  Declaration part(
+      "filter", {tables.Scan("part", {"P_PARTKEY", "P_TYPE"})},
+      FilterNodeOptions(equal(field_ref("P_TYPE"), literal("ECONOMY ANODIZED STEEL"))));
+  Declaration lineitem(
+      "hashjoin",
+      {tables.Scan("lineitem", {"L_ORDERKEY", "L_PARTKEY", "L_SUPPKEY",
+                                "L_EXTENDEDPRICE", "L_DISCOUNT"}),
+       std::move(part)},
+      HashJoinNodeOptions({"L_PARTKEY"}, {"P_PARTKEY"}));
+
+  // The customers in AMERICA
+  Declaration region(
+      "filter", {tables.Scan("region", {"R_REGIONKEY", "R_NAME"})},
+      FilterNodeOptions(
+          equal(field_ref("R_NAME"), FixedSizeBinaryLiteral("AMERICA", 25))));
+  Declaration customer_nation(
+      "hashjoin",
+      {tables.Scan("nation", {"N_NATIONKEY", "N_REGIONKEY"}), std::move(region)},
+      HashJoinNodeOptions({"N_REGIONKEY"}, {"R_REGIONKEY"}));
+  Declaration customer("hashjoin",
+                       {tables.Scan("customer", {"C_CUSTKEY", "C_NATIONKEY"}),
+                        std::move(customer_nation)},
+                       HashJoinNodeOptions({"C_NATIONKEY"}, {"N_NATIONKEY"}));
+  Declaration orders(
+      "filter", {tables.Scan("orders", {"O_ORDERKEY", "O_CUSTKEY", "O_ORDERDATE"})},
+      FilterNodeOptions(Between(field_ref("O_ORDERDATE"), DateLiteral(kJanuary1_1995),
+                                DateLiteral(kDecember31_1996))));
+  Declaration orders_customer("hashjoin", {std::move(orders), std::move(customer)},
+                              HashJoinNodeOptions({"O_CUSTKEY"}, {"C_CUSTKEY"}));
+
+  // The nation of the supplier, renamed since the nation table was read above
+  Declaration supplier(
+      "hashjoin",
+      {tables.Scan("supplier", {"S_SUPPKEY", "S_NATIONKEY"}),
+       Rename(tables.Scan("nation", {"N_NATIONKEY", "N_NAME"}),
+              {"N_NATIONKEY", "N_NAME"}, {"supp_nationkey", "supp_nation"})},
+      HashJoinNodeOptions({"S_NATIONKEY"}, {"supp_nationkey"}));
+
+  Declaration lineitem_orders("hashjoin",
+                              {std::move(lineitem), std::move(orders_customer)},
+                              HashJoinNodeOptions({"L_ORDERKEY"}, {"O_ORDERKEY"}));
+  Declaration join("hashjoin", {std::move(lineitem_orders), std::move(supplier)},
+                   HashJoinNodeOptions({"L_SUPPKEY"}, {"S_SUPPKEY"}));
+
+  Expression volume = DiscountedPrice();
+  ProjectNodeOptions project_opts(
+      {call("year", {field_ref("O_ORDERDATE")}), volume,
+       call("if_else", {equal(field_ref("supp_nation"),
+                              FixedSizeBinaryLiteral("BRAZIL", 25)),
+                        volume, NoDiscountedPrice()})},
+      {"o_year", "volume", "brazil_volume"});
+  AggregateNodeOptions agg_opts(
+      {{"hash_sum", SumOptions(), "brazil_volume", "brazil_volume"},
+       {"hash_sum", SumOptions(), "volume", "volume"}},
+      {"o_year"});
+  ProjectNodeOptions mkt_share_opts(
+      {field_ref("o_year"),
+       call("divide",
+            {ToDouble(field_ref("brazil_volume")), ToDouble(field_ref("volume"))})},
+      {"o_year", "mkt_share"});
+  OrderByNodeOptions order_by_opts(Ordering({SortKey("o_year")}));
+
+  return Declaration::Sequence({std::move(join),
+                                {"project", project_opts},
+                                {"aggregate", agg_opts},
+                                {"project", mkt_share_opts},
+                                {"order_by", order_by_opts}});
+}
+
+Declaration Q9(const TpchTables& tables) {
+  Declaration part(
+      "filter", {tables.Scan("part", {"P_PARTKEY", "P_NAME"})},
+      FilterNodeOptions(call("match_substring", {field_ref("P_NAME")},
+                             compute::MatchSubstringOptions("green"))));
+  Declaration partsupp(
+      "hashjoin",
+      {tables.Scan("partsupp", {"PS_PARTKEY", "PS_SUPPKEY", "PS_SUPPLYCOST"}),
+       std::move(part)},
+      HashJoinNodeOptions({"PS_PARTKEY"}, {"P_PARTKEY"}));
+  Declaration supplier(
+      "hashjoin",
+      {tables.Scan("supplier", {"S_SUPPKEY", "S_NATIONKEY"}),
+       tables.Scan("nation", {"N_NATIONKEY", "N_NAME"})},
+      HashJoinNodeOptions({"S_NATIONKEY"}, {"N_NATIONKEY"}));
+
+  Declaration lineitem_partsupp(
+      "hashjoin",
+      {tables.Scan("lineitem", {"L_ORDERKEY", "L_PARTKEY", "L_SUPPKEY", "L_QUANTITY",
+                                "L_EXTENDEDPRICE", "L_DISCOUNT"}),
+       std::move(partsupp)},
+      HashJoinNodeOptions({"L_PARTKEY", "L_SUPPKEY"}, {"PS_PARTKEY", "PS_SUPPKEY"}));
+  Declaration lineitem_supplier(
+      "hashjoin", {std::move(lineitem_partsupp), std::move(supplier)},
+      HashJoinNodeOptions({"L_SUPPKEY"}, {"S_SUPPKEY"}));
+  // The green lineitems are far fewer than the orders, so they are the build side
+  Declaration join("hashjoin",
+                   {tables.Scan("orders", {"O_ORDERKEY", "O_ORDERDATE"}),
+                    std::move(lineitem_supplier)},
+                   HashJoinNodeOptions({"O_ORDERKEY"}, {"L_ORDERKEY"}));
+
+  Expression amount = call(
+      "subtract", {DiscountedPrice(), call("multiply", {field_ref("PS_SUPPLYCOST"),
+                                                        field_ref("L_QUANTITY")})});
+  ProjectNodeOptions project_opts(
+      {field_ref("N_NAME"), call("year", {field_ref("O_ORDERDATE")}), amount},
+      {"nation", "o_year", "amount"});
+  AggregateNodeOptions agg_opts({{"hash_sum", SumOptions(), "amount", "sum_profit"}},
+                                {"nation", "o_year"});
+  OrderByNodeOptions order_by_opts(
+      Ordering({SortKey("nation"), SortKey("o_year", SortOrder::Descending)}));
+
+  return Declaration::Sequence({std::move(join),
+                                {"project", project_opts},
+                                {"aggregate", agg_opts},
+                                {"order_by", order_by_opts}});
+}
+
+Declaration Q10(const TpchTables& tables) {
+  Declaration orders(
+      "filter",
+      {tables.Scan("orders", {"O_ORDERKEY", "O_CUSTKEY", "O_ORDERDATE"})},
+      FilterNodeOptions(
+          and_(greater_equal(field_ref("O_ORDERDATE"), DateLiteral(kOctober1_1993)),
+               less(field_ref("O_ORDERDATE"), DateLiteral(kJanuary1_1994)))));
+  Declaration lineitem(
+      "filter",
+      {tables.Scan("lineitem",
+                   {"L_ORDERKEY", "L_EXTENDEDPRICE", "L_DISCOUNT", "L_RETURNFLAG"})},
+      FilterNodeOptions(
+          equal(field_ref("L_RETURNFLAG"), FixedSizeBinaryLiteral("R", 1))));
+  Declaration lineitem_orders("hashjoin", {std::move(lineitem), std::move(orders)},
+                              HashJoinNodeOptions({"L_ORDERKEY"}, {"O_ORDERKEY"}));
+  Declaration customer(
+      "hashjoin",
+      {tables.Scan("customer", {"C_CUSTKEY", "C_NAME", "C_ADDRESS", "C_NATIONKEY",
+                                "C_PHONE", "C_ACCTBAL", "C_COMMENT"}),
+       tables.Scan("nation", {"N_NATIONKEY", "N_NAME"})},
+      HashJoinNodeOptions({"C_NATIONKEY"}, {"N_NATIONKEY"}));
+  Declaration join("hashjoin", {std::move(lineitem_orders), std::move(customer)},
+                   HashJoinNodeOptions({"O_CUSTKEY"}, {"C_CUSTKEY"}));
+
+  ProjectNodeOptions project_opts(
+      {field_ref("C_CUSTKEY"), field_ref("C_NAME"), field_ref("C_ACCTBAL"),
+       field_ref("C_PHONE"), field_ref("N_NAME"), field_ref("C_ADDRESS"),
+       field_ref("C_COMMENT"), DiscountedPrice()},
+      {"c_custkey", "c_name", "c_acctbal", "c_phone", "n_name", "c_address",
+       "c_comment", "revenue"});
+  AggregateNodeOptions agg_opts({{"hash_sum", SumOptions(), "revenue", "revenue"}},
+                                {"c_custkey", "c_name", "c_acctbal", "c_phone",
+                                 "n_name", "c_address", "c_comment"});
+  SelectKNodeOptions select_k_opts(
+      SelectKOptions(20, {SortKey("revenue", SortOrder::Descending)}));
+
+  return Declaration::Sequence({std::move(join),
+                                {"project", project_opts},
+                                {"aggregate", agg_opts},
+                                {"select_k", select_k_opts}});
+}
+
+Declaration Q11(const TpchTables& tables) {
+  // The value of the stock of each part held by suppliers in GERMANY, which both the
+  // query and its subquery read
+  auto german_stock = [&tables]() {
+    Declaration nation(
+        "filter", {tables.Scan("nation", {"N_NATIONKEY", "N_NAME"})},
+        FilterNodeOptions(
+            equal(field_ref("N_NAME"), FixedSizeBinaryLiteral("GERMANY", 25))));
+    Declaration supplier(
+        "hashjoin",
+        {tables.Scan("supplier", {"S_SUPPKEY", "S_NATIONKEY"}), std::move(nation)},
+        HashJoinNodeOptions({"S_NATIONKEY"}, {"N_NATIONKEY"}));
+    Declaration partsupp(
+        "hashjoin",
+        {tables.Scan("partsupp",
+                     {"PS_PARTKEY", "PS_SUPPKEY", "PS_SUPPLYCOST", "PS_AVAILQTY"}),
+         std::move(supplier)},
+        HashJoinNodeOptions({"PS_SUPPKEY"}, {"S_SUPPKEY"}));
+    Expression value =
+        call("multiply", {field_ref("PS_SUPPLYCOST"),
+                          call("cast", {field_ref("PS_AVAILQTY")},
+                               compute::CastOptions::Safe(decimal128(10, 0)))});
+    return Declaration::Sequence(
+        {std::move(partsupp),
+         {"project", ProjectNodeOptions({field_ref("PS_PARTKEY"), value},
+                                        {"ps_partkey", "value"})}});
+  };
+
+  Declaration total = Declaration::Sequence(
+      {german_stock(),
+       {"aggregate", AggregateNodeOptions({{"sum", SumOptions(), "value", "total"}})}});
+  Declaration threshold = WithConstantKey(std::move(total), {"total"}, "total_key");
+  Declaration value = Declaration::Sequence(
+      {german_stock(),
+       {"aggregate",
+        AggregateNodeOptions({{"hash_sum", SumOptions(), "value", "value"}},
+                             {"ps_partkey"})}});
+  Declaration join(
+      "hashjoin",
+      {WithConstantKey(std::move(value), {"ps_partkey", "value"}, "value_key"),
+       std::move(threshold)},
+      HashJoinNodeOptions({"value_key"}, {"total_key"}));
+
+  FilterNodeOptions filter_opts(
+      greater(ToDouble(field_ref("value")),
+              call("multiply", {ToDouble(field_ref("total")),
+                                literal(0.0001 / tables.scale_factor())})));
+  ProjectNodeOptions project_opts({field_ref("ps_partkey"), field_ref("value")});
+  OrderByNodeOptions order_by_opts(
+      Ordering({SortKey("value", SortOrder::Descending)}));
+
+  return Declaration::Sequence({std::move(join),
+                                {"filter", filter_opts},
+                                {"project", project_opts},
+                                {"order_by", order_by_opts}});
+}
+
+Declaration Q12(const TpchTables& tables) {
+  Declaration lineitem(
+      "filter",
+      {tables.Scan("lineitem", {"L_ORDERKEY", "L_SHIPMODE", "L_SHIPDATE",
+                                "L_COMMITDATE", "L_RECEIPTDATE"})},
+      FilterNodeOptions(
+          and_({IsIn(field_ref("L_SHIPMODE"), {"MAIL", "SHIP"}, 10),
+                less(field_ref("L_COMMITDATE"), field_ref("L_RECEIPTDATE")),
+                less(field_ref("L_SHIPDATE"), field_ref("L_COMMITDATE")),
+                InRange(field_ref("L_RECEIPTDATE"), DateLiteral(kJanuary1_1994),
+                        DateLiteral(kJanuary1_1995))})));
+  Declaration join("hashjoin",
+                   {tables.Scan("orders", {"O_ORDERKEY", "O_ORDERPRIORITY"}),
+                    std::move(lineitem)},
+                   HashJoinNodeOptions({"O_ORDERKEY"}, {"L_ORDERKEY"}));
+
+  Expression high_priority =
+      IsIn(field_ref("O_ORDERPRIORITY"), {"1-URGENT", "2-HIGH"}, 15);
+  ProjectNodeOptions project_opts(
+      {field_ref("L_SHIPMODE"),
+       call("if_else", {high_priority, literal(int64_t{1}), literal(int64_t{0})}),
+       call("if_else", {high_priority, literal(int64_t{0}), literal(int64_t{1})})},
+      {"l_shipmode", "high_line_count", "low_line_count"});
+  AggregateNodeOptions agg_opts(
+      {{"hash_sum", SumOptions(), "high_line_count", "high_line_count"},
+       {"hash_sum", SumOptions(), "low_line_count", "low_line_count"}},
+      {"l_shipmode"});
+  OrderByNodeOptions order_by_opts(Ordering({SortKey("l_shipmode")}));
+
+  return Declaration::Sequence({std::move(join),
+                                {"project", project_opts},
+                                {"aggregate", agg_opts},
+                                {"order_by", order_by_opts}});
+}
+
+Declaration Q13(const TpchTables& tables) {
+  Declaration orders(
+      "filter", {tables.Scan("orders", {"O_ORDERKEY", "O_CUSTKEY", "O_COMMENT"})},
+      FilterNodeOptions(
+          not_(call("match_like", {field_ref("O_COMMENT")},
+                    compute::MatchSubstringOptions("%special%requests%")))));
+  // customer LEFT OUTER JOIN orders, with the customers as the build side
+  Declaration join("hashjoin",
+                   {std::move(orders), tables.Scan("customer", {"C_CUSTKEY"})},
+                   HashJoinNodeOptions(JoinType::RIGHT_OUTER, {"O_CUSTKEY"},
+                                       {"C_CUSTKEY"}));
+
+  // Counting the order keys leaves out the customers without orders, which are
+  // null-extended by the join
+  auto count_valid = std::make_shared<CountOptions>(CountOptions::CountMode::ONLY_VALID);
+  AggregateNodeOptions c_count_opts(
+      {{"hash_count", count_valid, "O_ORDERKEY", "c_count"}}, {"C_CUSTKEY"});
+  auto count_all = std::make_shared<CountOptions>(CountOptions::CountMode::ALL);
+  AggregateNodeOptions custdist_opts({{"hash_count", count_all, "C_CUSTKEY", "custdist"}},
+                                     {"c_count"});
+  OrderByNodeOptions order_by_opts(
+      Ordering({SortKey("custdist", SortOrder::Descending),
+                SortKey("c_count", SortOrder::Descending)}));
+
+  return Declaration::Sequence({std::move(join),
+                                {"aggregate", c_count_opts},
+                                {"aggregate", custdist_opts},
+                                {"order_by", order_by_opts}});
+}
+
+Declaration Q14(const TpchTables& tables) {
+  Declaration lineitem(
+      "filter",
+      {tables.Scan("lineitem",
+                   {"L_PARTKEY", "L_SHIPDATE", "L_EXTENDEDPRICE", "L_DISCOUNT"})},
+      FilterNodeOptions(InRange(field_ref("L_SHIPDATE"), DateLiteral(kSeptember1_1995),
+                                DateLiteral(kOctober1_1995))));
+  Declaration join("hashjoin",
+                   {tables.Scan("part", {"P_PARTKEY", "P_TYPE"}), std::move(lineitem)},
+                   HashJoinNodeOptions({"P_PARTKEY"}, {"L_PARTKEY"}));
+
+  Expression volume = DiscountedPrice();
+  ProjectNodeOptions project_opts(
+      {call("if_else", {StartsWith(field_ref("P_TYPE"), "PROMO"), volume,
+                        NoDiscountedPrice()}),
+       volume},
+      {"promo_volume", "volume"});
+  AggregateNodeOptions agg_opts({{"sum", SumOptions(), "promo_volume", "promo_volume"},
+                                 {"sum", SumOptions(), "volume", "volume"}});
+  ProjectNodeOptions promo_revenue_opts(
+      {call("divide",
+            {call("multiply", {literal(100.0), ToDouble(field_ref("promo_volume"))}),
+             ToDouble(field_ref("volume"))})},
+      {"promo_revenue"});
+
+  return Declaration::Sequence({std::move(join),
+                                {"project", project_opts},
+                                {"aggregate", agg_opts},
+                                {"project", promo_revenue_opts}});
+}
+
+Declaration Q15(const TpchTables& tables) {
+  // The revenue0 view, which both the query and its subquery read
+  auto revenue = [&tables]() {
+    Declaration lineitem(
+        "filter",
+        {tables.Scan("lineitem",
+                     {"L_SUPPKEY", "L_SHIPDATE", "L_EXTENDEDPRICE", "L_DISCOUNT"})},
+        FilterNodeOptions(InRange(field_ref("L_SHIPDATE"), DateLiteral(kJanuary1_1996),
+                                  DateLiteral(kApril1_1996))));
+    return Declaration::Sequence(
+        {std::move(lineitem),
+         {"project", ProjectNodeOptions({field_ref("L_SUPPKEY"), DiscountedPrice()},
+                                        {"supplier_no", "revenue"})},
+         {"aggregate",
+          AggregateNodeOptions({{"hash_sum", SumOptions(), "revenue", "total_revenue"}},
+                               {"supplier_no"})}});
+  };
+
+  Declaration max_revenue = Declaration::Sequence(
+      {revenue(),
+       {"aggregate",
+        AggregateNodeOptions({{"max", SumOptions(), "total_revenue", "max_revenue"}})}});
+  Declaration top_suppliers("hashjoin", {revenue(), std::move(max_revenue)},
+                            HashJoinNodeOptions({"total_revenue"}, {"max_revenue"}));
+  Declaration join(
+      "hashjoin",
+      {tables.Scan("supplier", {"S_SUPPKEY", "S_NAME", "S_ADDRESS", "S_PHONE"}),
+       std::move(top_suppliers)},
+      HashJoinNodeOptions({"S_SUPPKEY"}, {"supplier_no"}));
+
+  ProjectNodeOptions project_opts(
+      {field_ref("S_SUPPKEY"), field_ref("S_NAME"), field_ref("S_ADDRESS"),
+       field_ref("S_PHONE"), field_ref("total_revenue")},
+      {"s_suppkey", "s_name", "s_address", "s_phone", "total_revenue"});
+  OrderByNodeOptions order_by_opts(Ordering({SortKey("s_suppkey")}));
+
+  return Declaration::Sequence(
+      {std::move(join), {"project", project_opts}, {"order_by", order_by_opts}});
+}
+
+Declaration Q16(const TpchTables& tables) {
+  Declaration part(
+      "filter", {tables.Scan("part", {"P_PARTKEY", "P_BRAND", "P_TYPE", "P_SIZE"})},
+      FilterNodeOptions(
+          and_({not_equal(field_ref("P_BRAND"), FixedSizeBinaryLiteral("Brand#45", 10)),
+                not_(StartsWith(field_ref("P_TYPE"), "MEDIUM POLISHED")),
+                IsIn(field_ref("P_SIZE"), {49, 14, 23, 45, 19, 3, 36, 9})})));
+  Declaration supplier(
+      "filter", {tables.Scan("supplier", {"S_SUPPKEY", "S_COMMENT"})},
+      FilterNodeOptions(call("match_like", {field_ref("S_COMMENT")},
+                             compute::MatchSubstringOptions("%Customer%Complaints%"))));
+
+  Declaration partsupp(
+      "hashjoin",
+      {tables.Scan("partsupp", {"PS_PARTKEY", "PS_SUPPKEY"}), std::move(part)},
+      HashJoinNodeOptions({"PS_PARTKEY"}, {"P_PARTKEY"}));
+  // NOT IN (suppliers with complaints)
+  Declaration join("hashjoin", {std::move(partsupp), std::move(supplier)},
+                   HashJoinNodeOptions(JoinType::LEFT_ANTI, {"PS_SUPPKEY"},
+                                       {"S_SUPPKEY"}));
+
+  ProjectNodeOptions project_opts(
+      {field_ref("P_BRAND"), field_ref("P_TYPE"), field_ref("P_SIZE"),
+       field_ref("PS_SUPPKEY")},
+      {"p_brand", "p_type", "p_size", "ps_suppkey"});
+  auto count_opts = std::make_shared<CountOptions>(CountOptions::CountMode::ALL);
+  AggregateNodeOptions agg_opts(
+      {{"hash_count_distinct", count_opts, "ps_suppkey", "supplier_cnt"}},
+      {"p_brand", "p_type", "p_size"});
+  OrderByNodeOptions order_by_opts(
+      Ordering({SortKey("supplier_cnt", SortOrder::Descending), SortKey("p_brand"),
+                SortKey("p_type"), SortKey("p_size")}));
+
+  return Declaration::Sequence({std::move(join),
+                                {"project", project_opts},
+                                {"aggregate", agg_opts},
+                                {"order_by", order_by_opts}});
+}
+
+Declaration Q17(const TpchTables& tables) {
+  // The query and its subquery only look at the parts of brand 23 in a MED BOX
+  auto part = [&tables]() {
+    return Declaration(
+        "filter", {tables.Scan("part", {"P_PARTKEY", "P_BRAND", "P_CONTAINER"})},
+        FilterNodeOptions(
+            and_(equal(field_ref("P_BRAND"), FixedSizeBinaryLiteral("Brand#23", 10)),
+                 equal(field_ref("P_CONTAINER"),
+                       FixedSizeBinaryLiteral("MED BOX", 10)))));
+  };
+
+  // AVG(L_QUANTITY) of each of these parts
+  Declaration avg_quantity = Declaration::Sequence(
+      {{"hashjoin",
+        {Rename(tables.Scan("lineitem", {"L_PARTKEY", "L_QUANTITY"}),
+                {"L_PARTKEY", "L_QUANTITY"}, {"avg_partkey", "quantity"}),
+         part()},
+        HashJoinNodeOptions(JoinType::LEFT_SEMI, {"avg_partkey"}, {"P_PARTKEY"})},
+       {"aggregate",
+        AggregateNodeOptions({{"hash_mean", SumOptions(), "quantity", "avg_quantity"}},
+                             {"avg_partkey"})}});
+
+  Declaration lineitem(
+      "hashjoin",
+      {tables.Scan("lineitem", {"L_PARTKEY", "L_QUANTITY", "L_EXTENDEDPRICE"}), part()},
+      HashJoinNodeOptions({"L_PARTKEY"}, {"P_PARTKEY"}));
+  Declaration join("hashjoin", {std::move(lineitem), std::move(avg_quantity)},
+                   HashJoinNodeOptions({"L_PARTKEY"}, {"avg_partkey"}));
+
+  // L_QUANTITY < 0.2 * AVG(L_QUANTITY)
+  FilterNodeOptions filter_opts(
+      less(call("multiply", {field_ref("L_QUANTITY"), DecimalLiteral(500)}),
+           field_ref("avg_quantity")));
+  AggregateNodeOptions agg_opts(
+      {{"sum", SumOptions(), "L_EXTENDEDPRICE", "sum_extendedprice"}});
+  ProjectNodeOptions project_opts(
+      {call("divide", {ToDouble(field_ref("sum_extendedprice")), literal(7.0)})},
+      {"avg_yearly"});
+
+  return Declaration::Sequence({std::move(join),
+                                {"filter", filter_opts},
+                                {"aggregate", agg_opts},
+                                {"project", project_opts}});
+}
+
+Declaration Q18(const TpchTables& tables) {
+  // The orders of more than 300 items
+  Declaration large_orders = Declaration::Sequence(
+      {Rename(tables.Scan("lineitem", {"L_ORDERKEY", "L_QUANTITY"}),
+              {"L_ORDERKEY", "L_QUANTITY"}, {"large_orderkey", "quantity"}),
+       {"aggregate",
+        AggregateNodeOptions({{"hash_sum", SumOptions(), "quantity", "sum_quantity"}},
+                             {"large_orderkey"})},
+       {"filter",
+        FilterNodeOptions(greater(field_ref("sum_quantity"), DecimalLiteral(30000)))}});
+  Declaration orders(
+      "hashjoin",
+      {tables.Scan("orders", {"O_ORDERKEY", "O_CUSTKEY", "O_ORDERDATE", "O_TOTALPRICE"}),
+       std::move(large_orders)},
+      HashJoinNodeOptions(JoinType::LEFT_SEMI, {"O_ORDERKEY"}, {"large_orderkey"}));
+  Declaration customer(
+      "hashjoin", {tables.Scan("customer", {"C_CUSTKEY", "C_NAME"}), std::move(orders)},
+      HashJoinNodeOptions({"C_CUSTKEY"}, {"O_CUSTKEY"}));
+  Declaration join(
+      "hashjoin",
+      {tables.Scan("lineitem", {"L_ORDERKEY", "L_QUANTITY"}), std::move(customer)},
+      HashJoinNodeOptions({"L_ORDERKEY"}, {"O_ORDERKEY"}));
+
+  ProjectNodeOptions project_opts(
+      {field_ref("C_NAME"), field_ref("C_CUSTKEY"), field_ref("O_ORDERKEY"),
+       field_ref("O_ORDERDATE"), field_ref("O_TOTALPRICE"), field_ref("L_QUANTITY")},
+      {"c_name", "c_custkey", "o_orderkey", "o_orderdate", "o_totalprice",
+       "quantity"});
+  AggregateNodeOptions agg_opts(
+      {{"hash_sum", SumOptions(), "quantity", "sum_quantity"}},
+      {"c_name", "c_custkey", "o_orderkey", "o_orderdate", "o_totalprice"});
+  SelectKNodeOptions select_k_opts(SelectKOptions(
+      100, {SortKey("o_totalprice", SortOrder::Descending), SortKey("o_orderdate")}));
+
+  return Declaration::Sequence({std::move(join),
+                                {"project", project_opts},
+                                {"aggregate", agg_opts},
+                                {"select_k", select_k_opts}});
+}
+
+Declaration Q19(const TpchTables& tables) {
+  Declaration lineitem(
+      "filter",
+      {tables.Scan("lineitem", {"L_PARTKEY", "L_QUANTITY", "L_EXTENDEDPRICE",
+                                "L_DISCOUNT", "L_SHIPMODE", "L_SHIPINSTRUCT"})},
+      FilterNodeOptions(and_(IsIn(field_ref("L_SHIPMODE"), {"AIR", "AIR REG"}, 10),
+                             equal(field_ref("L_SHIPINSTRUCT"),
+                                   FixedSizeBinaryLiteral("DELIVER IN PERSON", 25)))));
+  Declaration join(
+      "hashjoin",
+      {std::move(lineitem),
+       tables.Scan("part", {"P_PARTKEY", "P_BRAND", "P_CONTAINER", "P_SIZE"})},
+      HashJoinNodeOptions({"L_PARTKEY"}, {"P_PARTKEY"}));
+
+  auto condition = [](std::string_view brand,
+                      const std::vector<std::string_view>& containers,
+                      int64_t min_quantity, int32_t max_size) {
+    return and_({equal(field_ref("P_BRAND"), FixedSizeBinaryLiteral(brand, 10)),
+                 IsIn(field_ref("P_CONTAINER"), containers, 10),
+                 Between(field_ref("L_QUANTITY"), DecimalLiteral(min_quantity * 100),
+                         DecimalLiteral((min_quantity + 10) * 100)),
+                 Between(field_ref("P_SIZE"), literal(1), literal(max_size))});
+  };
+  FilterNodeOptions filter_opts(
+      or_({condition("Brand#12", {"SM CASE", "SM BOX", "SM PACK", "SM PKG"}, 1, 5),
+           condition("Brand#23", {"MED BAG", "MED BOX", "MED PKG", "MED PACK"}, 10, 10),
+           condition("Brand#34", {"LG CASE", "LG BOX", "LG PACK", "LG PKG"}, 20, 15)}));
+  ProjectNodeOptions project_opts({DiscountedPrice()}, {"revenue"});
+  AggregateNodeOptions agg_opts({{"sum", SumOptions(), "revenue", "revenue"}});
+
+  return Declaration::Sequence({std::move(join),
+                                {"filter", filter_opts},
+                                {"project", project_opts},
+                                {"aggregate", agg_opts}});
+}
+
+Declaration Q20(const TpchTables& tables) {
+  auto forest_part = [&tables]() {
+    return Declaration("filter", {tables.Scan("part", {"P_PARTKEY", "P_NAME"})},
+                       FilterNodeOptions(StartsWith(field_ref("P_NAME"), "forest")));
+  };
+
+  // The quantity of each forest part shipped by each supplier in 1994
+  Declaration lineitem(
+      "filter",
+      {tables.Scan("lineitem", {"L_PARTKEY", "L_SUPPKEY", "L_QUANTITY", "L_SHIPDATE"})},
+      FilterNodeOptions(InRange(field_ref("L_SHIPDATE"), DateLiteral(kJanuary1_1994),
+                                DateLiteral(kJanuary1_1995))));
+  Declaration shipped = Declaration::Sequence(
+      {{"hashjoin",
+        {std::move(lineitem), forest_part()},
+        HashJoinNodeOptions(JoinType::LEFT_SEMI, {"L_PARTKEY"}, {"P_PARTKEY"})},
+       {"aggregate",
+        AggregateNodeOptions({{"hash_sum", SumOptions(), "L_QUANTITY", "sum_quantity"}},
+                             {"L_PARTKEY", "L_SUPPKEY"})}});
+
+  // The suppliers with an excess of some forest part
+  Declaration partsupp(
+      "hashjoin",
+      {tables.Scan("partsupp", {"PS_PARTKEY", "PS_SUPPKEY", "PS_AVAILQTY"}),
+       forest_part()},
+      HashJoinNodeOptions(JoinType::LEFT_SEMI, {"PS_PARTKEY"}, {"P_PARTKEY"}));
+  Declaration excess = Declaration::Sequence(
+      {{"hashjoin",
+        {std::move(partsupp), std::move(shipped)},
+        HashJoinNodeOptions({"PS_PARTKEY", "PS_SUPPKEY"}, {"L_PARTKEY", "L_SUPPKEY"})},
+       // PS_AVAILQTY > 0.5 * SUM(L_QUANTITY)
+       {"filter",
+        FilterNodeOptions(greater(
+            call("cast", {call("multiply", {field_ref("PS_AVAILQTY"), literal(2)})},
+                 compute::CastOptions::Safe(decimal128(12, 2))),
+            field_ref("sum_quantity")))}});
+
+  Declaration nation(
+      "filter", {tables.Scan("nation", {"N_NATIONKEY", "N_NAME"})},
+      FilterNodeOptions(
+          equal(field_ref("N_NAME"), FixedSizeBinaryLiteral("CANADA", 25))));
+  Declaration supplier(
+      "hashjoin",
+      {tables.Scan("supplier", {"S_SUPPKEY", "S_NAME", "S_ADDRESS", "S_NATIONKEY"}),
+       std::move(nation)},
+      HashJoinNodeOptions({"S_NATIONKEY"}, {"N_NATIONKEY"}));
+  Declaration join("hashjoin", {std::move(supplier), std::move(excess)},
+                   HashJoinNodeOptions(JoinType::LEFT_SEMI, {"S_SUPPKEY"},
+                                       {"PS_SUPPKEY"}));
+
+  ProjectNodeOptions project_opts({field_ref("S_NAME"), field_ref("S_ADDRESS")},
+                                  {"s_name", "s_address"});
+  OrderByNodeOptions order_by_opts(Ordering({SortKey("s_name")}));
+
+  return Declaration::Sequence(
+      {std::move(join), {"project", project_opts}, {"order_by", order_by_opts}});
+}
+
+Declaration Q21(const TpchTables& tables) {
+  // The lineitems received after their commit date
+  auto late_lineitem = [&tables](std::vector<std::string> columns) {
+    return Declaration(
+        "filter", {tables.Scan("lineitem", std::move(columns))},
+        FilterNodeOptions(
+            greater(field_ref("L_RECEIPTDATE"), field_ref("L_COMMITDATE"))));
+  };
+  // The number of distinct suppliers of the lineitems of each order
+  auto num_suppliers = [](Declaration lineitem, const std::string& orderkey,
+                          const std::string& count) {
+    auto count_opts = std::make_shared<CountOptions>(CountOptions::CountMode::ALL);
+    return Declaration::Sequence(
+        {Rename(std::move(lineitem), {"L_ORDERKEY", "L_SUPPKEY"}, {orderkey, "suppkey"}),
+         {"aggregate",
+          AggregateNodeOptions({{"hash_count_distinct", count_opts, "suppkey", count}},
+                               {orderkey})}});
+  };
+
+  Declaration nation(
+      "filter", {tables.Scan("nation", {"N_NATIONKEY", "N_NAME"})},
+      FilterNodeOptions(
+          equal(field_ref("N_NAME"), FixedSizeBinaryLiteral("SAUDI ARABIA", 25))));
+  Declaration supplier(
+      "hashjoin",
+      {tables.Scan("supplier", {"S_SUPPKEY", "S_NAME", "S_NATIONKEY"}),
+       std::move(nation)},
+      HashJoinNodeOptions({"S_NATIONKEY"}, {"N_NATIONKEY"}));
+  Declaration late_supplier(
+      "hashjoin",
+      {late_lineitem({"L_ORDERKEY", "L_SUPPKEY", "L_COMMITDATE", "L_RECEIPTDATE"}),
+       std::move(supplier)},
+      HashJoinNodeOptions({"L_SUPPKEY"}, {"S_SUPPKEY"}));
+  Declaration orders(
+      "filter", {tables.Scan("orders", {"O_ORDERKEY", "O_ORDERSTATUS"})},
+      FilterNodeOptions(
+          equal(field_ref("O_ORDERSTATUS"), FixedSizeBinaryLiteral("F", 1))));
+  Declaration l1("hashjoin", {std::move(orders), std::move(late_supplier)},
+                 HashJoinNodeOptions({"O_ORDERKEY"}, {"L_ORDERKEY"}));
+
+  // EXISTS (another supplier in the order) AND NOT EXISTS (another late supplier in
+  // the order): since l1 is late, the order has more than one supplier and a single
+  // late one
+  Declaration l2("hashjoin",
+                 {num_suppliers(tables.Scan("lineitem", {"L_ORDERKEY", "L_SUPPKEY"}),
+                                "l2_orderkey", "num_suppliers"),
+                  std::move(l1)},
+                 HashJoinNodeOptions({"l2_orderkey"}, {"L_ORDERKEY"}));
+  Declaration join(
+      "hashjoin",
+      {num_suppliers(late_lineitem({"L_ORDERKEY", "L_SUPPKEY", "L_COMMITDATE",
+                                    "L_RECEIPTDATE"}),
+                     "l3_orderkey", "num_late_suppliers"),
+       std::move(l2)},
+      HashJoinNodeOptions({"l3_orderkey"}, {"L_ORDERKEY"}));
+
+  FilterNodeOptions filter_opts(
+      and_(greater(field_ref("num_suppliers"), literal(int64_t{1})),
+           equal(field_ref("num_late_suppliers"), literal(int64_t{1}))));
+  auto count_opts = std::make_shared<CountOptions>(CountOptions::CountMode::ALL);
+  AggregateNodeOptions agg_opts({{"hash_count", count_opts, "S_NAME", "numwait"}},
+                                {"S_NAME"});
+  SelectKNodeOptions select_k_opts(
+      SelectKOptions(100, {SortKey("numwait", SortOrder::Descending),
+                           SortKey("S_NAME")}));
+
+  return Declaration::Sequence({std::move(join),
+                                {"filter", filter_opts},
+                                {"aggregate", agg_opts},
+                                {"select_k", select_k_opts}});
+}
+
+Declaration Q22(const TpchTables& tables) {
+  // SUBSTRING(C_PHONE, 1, 2) IN ('13', '31', '23', '29', '30', '18', '17')
+  Expression country_code =
+      call("binary_slice", {field_ref("C_PHONE")}, compute::SliceOptions(0, 2));
+  Expression in_countries =
+      IsIn(country_code, {"13", "31", "23", "29", "30", "18", "17"}, 2);
+
+  // The average positive account balance in these countries
+  Declaration avg_acctbal = Declaration::Sequence(
+      {{"filter",
+        {tables.Scan("customer", {"C_PHONE", "C_ACCTBAL"})},
+        FilterNodeOptions(
+            and_(greater(field_ref("C_ACCTBAL"), DecimalLiteral(0)), in_countries))},
+       {"aggregate",
+        AggregateNodeOptions({{"mean", SumOptions(), "C_ACCTBAL", "avg_acctbal"}})}});
+
+  Declaration customer(
+      "filter", {tables.Scan("customer", {"C_CUSTKEY", "C_PHONE", "C_ACCTBAL"})},
+      FilterNodeOptions(in_countries));
+  // NOT EXISTS (orders of the customer), with the customers as the build side
+  Declaration no_orders("hashjoin",
+                        {tables.Scan("orders", {"O_CUSTKEY"}), std::move(customer)},
+                        HashJoinNodeOptions(JoinType::RIGHT_ANTI, {"O_CUSTKEY"},
+                                            {"C_CUSTKEY"}));
+  Declaration join(
+      "hashjoin",
+      {WithConstantKey(std::move(no_orders), {"C_PHONE", "C_ACCTBAL"}, "customer_key"),
+       WithConstantKey(std::move(avg_acctbal), {"avg_acctbal"}, "avg_key")},
+      HashJoinNodeOptions({"customer_key"}, {"avg_key"}));
+
+  FilterNodeOptions filter_opts(
+      greater(field_ref("C_ACCTBAL"), field_ref("avg_acctbal")));
+  ProjectNodeOptions project_opts({country_code, field_ref("C_ACCTBAL")},
+                                  {"cntrycode", "c_acctbal"});
+  auto count_opts = std::make_shared<CountOptions>(CountOptions::CountMode::ALL);
+  AggregateNodeOptions agg_opts({{"hash_count", count_opts, "c_acctbal", "numcust"},
+                                 {"hash_sum", SumOptions(), "c_acctbal", "totacctbal"}},
+                                {"cntrycode"});
+  OrderByNodeOptions order_by_opts(Ordering({SortKey("cntrycode")}));
+
+  return Declaration::Sequence({std::move(join),
+                                {"filter", filter_opts},
+                                {"project", project_opts},
+                                {"aggregate", agg_opts},
+                                {"order_by", order_by_opts}});
+}
+
+constexpr std::string_view kTpchTableNames[] = {
+    "part", "supplier", "partsupp", "customer", "orders", "lineitem", "nation", "region"};
+
+Result<ExecNode*> MakeTpchGenSource(TpchGen* gen, std::string_view name) {
+  if (name == "part") return gen->Part();
+  if (name == "supplier") return gen->Supplier();
+  if (name == "partsupp") return gen->PartSupp();
+  if (name == "customer") return gen->Customer();
+  if (name == "orders") return gen->Orders();
+  if (name == "lineitem") return gen->Lineitem();
+  if (name == "nation") return gen->Nation();
+  if (name == "region") return gen->Region();
+  return Status::Invalid("Unknown TPC-H table ", name);
+}
+
+// The tables generated up front and kept in memory, so that the timings cover the
+// query alone
+class InMemoryTpchTables : public TpchTables {
+ public:
+  using TpchTables::TpchTables;
+
+  static Result<std::unique_ptr<InMemoryTpchTables>> Make(double scale_factor) {
+    auto tables = std::make_unique<InMemoryTpchTables>(scale_factor);
+    // A single generator produces all the tables so that their keys match
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ExecPlan> plan, ExecPlan::Make());
+    ARROW_ASSIGN_OR_RAISE(std::unique_ptr<TpchGen> gen,
+                          TpchGen::Make(plan.get(), scale_factor,
+                                        /*batch_size=*/ExecPlan::kMaxBatchSize));
+    for (std::string_view name : kTpchTableNames) {
+      ARROW_ASSIGN_OR_RAISE(ExecNode * source, MakeTpchGenSource(gen.get(), name));
+      std::shared_ptr<Table>* table = &tables->tables_[std::string(name)];
+      RETURN_NOT_OK(MakeExecNode("table_sink", plan.get(), {source},
+                                 TableSinkNodeOptions(table))
+                        .status());
+    }
+    plan->StartProducing();
+    RETURN_NOT_OK(plan->finished().status());
+    return tables;
+  }
+
+  Declaration Scan(const std::string& name,
+                   std::vector<std::string> columns) const override {
+    const std::shared_ptr<Table>& table = tables_.at(name);
+    std::vector<int> indices;
+    for (const std::string& column : columns) {
+      indices.push_back(table->schema()->GetFieldIndex(column));
+    }
+    return {"table_source", TableSourceNodeOptions(*table->SelectColumns(indices))};
+  }
+
+ private:
+  std::map<std::string, std::shared_ptr<Table>> tables_;
+};
+
+#if defined(ARROW_DATASET) && defined(ARROW_PARQUET)
+// The tables written once as Parquet datasets and scanned by every query, so that the
+// timings also cover reading and decoding them
+class ParquetTpchTables : public TpchTables {
+ public:
+  using TpchTables::TpchTables;
+
+  Declaration Scan(const std::string& name,
+                   std::vector<std::string> columns) const override {
+    const std::shared_ptr<dataset::Dataset>& dataset = datasets_.at(name);
+    auto scan_options = std::make_shared<dataset::ScanOptions>();
+    dataset::SetProjection(
+        scan_options.get(),
+        dataset::ProjectionDescr::FromNames(columns, *dataset->schema()).ValueOrDie());
+    // The scan node also emits the other columns (as nulls) and some fragment fields
+    std::vector<Expression> fields;
+    for (const std::string& column : columns) {
+      fields.push_back(field_ref(column));
+    }
+    return Declaration::Sequence(
+        {{"scan", dataset::ScanNodeOptions(dataset, std::move(scan_options))},
+         {"project", ProjectNodeOptions(std::move(fields), std::move(columns))}});
+  }
+
+ protected:
+  // Generates the tables into one directory each under `base_dir`
+  Status Write(const std::shared_ptr<fs::FileSystem>& filesystem,
+               const std::string& base_dir) {
+    dataset::internal::Initialize();
+    auto format = std::make_shared<dataset::ParquetFileFormat>();
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ExecPlan> plan, ExecPlan::Make());
+    ARROW_ASSIGN_OR_RAISE(std::unique_ptr<TpchGen> gen,
+                          TpchGen::Make(plan.get(), scale_factor(),
+                                        /*batch_size=*/ExecPlan::kMaxBatchSize));
+    for (std::string_view name : kTpchTableNames) {
+      ARROW_ASSIGN_OR_RAISE(ExecNode * source, MakeTpchGenSource(gen.get(), name));
+      dataset::FileSystemDatasetWriteOptions write_options;
+      write_options.file_write_options = format->DefaultWriteOptions();
+      write_options.filesystem = filesystem;
+      write_options.base_dir = base_dir + "/" + std::string(name);
+      write_options.partitioning = dataset::Partitioning::Default();
+      write_options.basename_template = "part-{i}.parquet";
+      // Several files per large table, so that they can be scanned in parallel
+      write_options.max_rows_per_file = 1 << 20;
+      RETURN_NOT_OK(MakeExecNode("write", plan.get(), {source},
+                                 dataset::WriteNodeOptions(std::move(write_options)))
+                        .status());
+    }
+    plan->StartProducing();
+    RETURN_NOT_OK(plan->finished().status());
+
+    for (std::string_view name : kTpchTableNames) {
+      fs::FileSelector selector;
+      selector.base_dir = base_dir + "/" + std::string(name);
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<dataset::DatasetFactory> factory,
+                            dataset::FileSystemDatasetFactory::Make(
+                                filesystem, std::move(selector), format, {}));
+      ARROW_ASSIGN_OR_RAISE(datasets_[std::string(name)], factory->Finish());
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::map<std::string, std::shared_ptr<dataset::Dataset>> datasets_;
+};
+
+// The Parquet tables in a temporary directory on the local disk
+class LocalParquetTpchTables : public ParquetTpchTables {
+ public:
+  using ParquetTpchTables::ParquetTpchTables;
+
+  static Result<std::unique_ptr<LocalParquetTpchTables>> Make(double scale_factor) {
+    auto tables = std::make_unique<LocalParquetTpchTables>(scale_factor);
+    ARROW_ASSIGN_OR_RAISE(tables->dir_,
+                          ::arrow::internal::TemporaryDir::Make("tpch-benchmark-"));
+    ARROW_ASSIGN_OR_RAISE(::arrow::internal::PlatformFilename base_dir,
+                          tables->dir_->path().Join("tpch"));
+    RETURN_NOT_OK(
+        tables->Write(std::make_shared<fs::LocalFileSystem>(), base_dir.ToString()));
+    return tables;
+  }
+
+ private:
+  std::unique_ptr<::arrow::internal::TemporaryDir> dir_;
+};
+
+#  ifdef ARROW_S3
+// The Parquet tables in a bucket of a MinIO server started for them.  S3 must have
+// been initialized.
+class S3ParquetTpchTables : public ParquetTpchTables {
+ public:
+  using ParquetTpchTables::ParquetTpchTables;
+
+  static Result<std::unique_ptr<S3ParquetTpchTables>> Make(double scale_factor) {
+    auto tables = std::make_unique<S3ParquetTpchTables>(scale_factor);
+    tables->minio_ = std::make_unique<fs::MinioTestServer>();
+    RETURN_NOT_OK(tables->minio_->Start());
+    auto options = fs::S3Options::FromAccessKey(tables->minio_->access_key(),
+                                                tables->minio_->secret_key());
+    options.scheme = tables->minio_->scheme();
+    options.endpoint_override = tables->minio_->connect_string();
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<fs::S3FileSystem> filesystem,
+                          fs::S3FileSystem::Make(options));
+    RETURN_NOT_OK(filesystem->CreateDir("tpch"));
+    RETURN_NOT_OK(tables->Write(filesystem, "tpch"));
+    return tables;
+  }
+
+ private:
+  std::unique_ptr<fs::MinioTestServer> minio_;
+};
+#  endif
+#endif
+
+enum class TpchSource {
+  kInMemory,
+#if defined(ARROW_DATASET) && defined(ARROW_PARQUET)
+  kParquetLocal,
+#  ifdef ARROW_S3
+  kParquetS3,
+#  endif
+#endif
+};
+
+// The tables of each source and scale factor, set up the first time a benchmark
+// needs them and kept until the process exits
+std::map<std::pair<TpchSource, double>, std::unique_ptr<TpchTables>>& TpchTablesCache() {
+  static std::map<std::pair<TpchSource, double>, std::unique_ptr<TpchTables>> cache;
+  return cache;
+}
+
+Result<const TpchTables*> GetTpchTables(TpchSource source, double scale_factor) {
+  std::unique_ptr<TpchTables>& tables = TpchTablesCache()[{source, scale_factor}];
+  if (tables == nullptr) {
+    switch (source) {
+      case TpchSource::kInMemory: {
+        ARROW_ASSIGN_OR_RAISE(tables, InMemoryTpchTables::Make(scale_factor));
+        break;
+      }
+#if defined(ARROW_DATASET) && defined(ARROW_PARQUET)
+      case TpchSource::kParquetLocal: {
+        ARROW_ASSIGN_OR_RAISE(tables, LocalParquetTpchTables::Make(scale_factor));
+        break;
+      }
+#  ifdef ARROW_S3
+      case TpchSource::kParquetS3: {
+        RETURN_NOT_OK(fs::EnsureS3Initialized());
+        // Registered after the AWS SDK's globals were created, so that it runs before
+        // they are destroyed at exit: the S3 tables and their MinIO server must be
+        // released before the SDK is shut down
+        static const bool registered = [] {
+          return std::atexit([] {
+                   auto& cache = TpchTablesCache();
+                   for (auto it = cache.begin(); it != cache.end();) {
+                     it = it->first.first == TpchSource::kParquetS3 ? cache.erase(it)
+                                                                    : std::next(it);
+                   }
+                   ARROW_WARN_NOT_OK(fs::EnsureS3Finalized(), "Failed to finalize S3");
+                 }) == 0;
+        }();
+        ARROW_UNUSED(registered);
+        ARROW_ASSIGN_OR_RAISE(tables, S3ParquetTpchTables::Make(scale_factor));
+        break;
+      }
+#  endif
+#endif
+    }
+  }
+  return tables.get();
+}
+
+// The scale factors to run, from the comma-separated ARROW_TPCH_BENCHMARK_SCALE_FACTORS
+// environment variable (e.g. "1,10,100").  SF 1 keeps the default run reasonably short.
+void SetScaleFactorArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"ScaleFactor"});
+  const char* scale_factors = std::getenv("ARROW_TPCH_BENCHMARK_SCALE_FACTORS");
+  for (std::string_view scale_factor : ::arrow::internal::SplitString(
+           scale_factors != nullptr ? scale_factors : "1", ',')) {
+    bench->Arg(std::stoll(std::string(scale_factor)));
+  }
+}
+
+}  // namespace
+
+// Runs `query` to completion on the CPU thread pool over the tables of `source`.
+// Setting up the tables is not part of the measured time.  The peak amount of memory
+// allocated by the plan is reported alongside the timings, as well as the average
+// time each node spent processing batches (<position in the plan>:<kind>_ns).
+static void BM_Tpch(benchmark::State& st, TpchSource source,
+                    const std::function<Declaration(const TpchTables&)>& query) {
+  const double scale_factor = static_cast<double>(st.range(0));
+  Result<const TpchTables*> tables = GetTpchTables(source, scale_factor);
+  if (!tables.ok()) {
+    st.SkipWithError(tables.status().ToString().c_str());
+    return;
+  }
+  ProxyMemoryPool pool(default_memory_pool());
+  int64_t num_rows = 0;
+  std::map<std::string, int64_t> node_nanos;
   for (auto _ : st) {
-    st.PauseTiming();
-    AsyncGenerator<std::optional<ExecBatch>> sink_gen;
-    std::shared_ptr<ExecPlan> plan = Plan_Q1(&sink_gen, static_cast<int>(st.range(0)));
-    st.ResumeTiming();
-    auto fut = StartAndCollect(plan.get(), sink_gen);
-    auto res = *fut.MoveResult();
+    QueryOptions query_options;
+    query_options.memory_pool = &pool;
+    query_options.profile = std::make_shared<PlanProfile>();
+    auto result = DeclarationToTable(query(**tables), query_options);
+    if (!result.ok()) {
+      // e.g. Q13 and Q16 need match_like, which is unavailable without RE2
+      st.SkipWithError(result.status().ToString().c_str());
+      break;
+    }
+    num_rows = (*result)->num_rows();
+    std::vector<const NodeProfile*> nodes = query_options.profile->nodes();
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      // Zero-padded so that the counters are listed in plan order
+      std::string position = (i < 10 ? "0" : "") + std::to_string(i);
+      node_nanos[position + ":" + nodes[i]->kind() + "_ns"] +=
+          nodes[i]->processing_nanos();
+    }
+  }
+  // The plan's last tasks may still be releasing memory after its result was
+  // delivered, and `pool` must outlive them
+  ::arrow::internal::GetCpuThreadPool()->WaitForIdle();
+  st.counters["peak_memory"] = static_cast<double>(pool.max_memory());
+  st.counters["result_rows"] = static_cast<double>(num_rows);
+  for (const auto& [name, nanos] : node_nanos) {
+    st.counters[name] = benchmark::Counter(static_cast<double>(nanos),
+                                           benchmark::Counter::kAvgIterations);
   }
 }
 
-BENCHMARK(BM_Tpch_Q1)->Args({1})->ArgNames({"ScaleFactor"});
+#define TPCH_SOURCE_BENCHMARK(QUERY, SOURCE)                             \
+  BENCHMARK_CAPTURE(BM_Tpch, QUERY/SOURCE, TpchSource::k##SOURCE, QUERY) \
+      ->Apply(SetScaleFactorArgs)                                        \
+      ->UseRealTime()
+
+// The Parquet sources are only available in builds with the dataset module (and S3)
+#if defined(ARROW_DATASET) && defined(ARROW_PARQUET)
+#  ifdef ARROW_S3
+#    define TPCH_PARQUET_BENCHMARKS(QUERY)        \
+      ;                                           \
+      TPCH_SOURCE_BENCHMARK(QUERY, ParquetLocal); \
+      TPCH_SOURCE_BENCHMARK(QUERY, ParquetS3)
+#  else
+#    define TPCH_PARQUET_BENCHMARKS(QUERY) ; TPCH_SOURCE_BENCHMARK(QUERY, ParquetLocal)
+#  endif
+#else
+#  define TPCH_PARQUET_BENCHMARKS(QUERY)
+#endif
+
+#define TPCH_BENCHMARK(QUERY)            \
+  TPCH_SOURCE_BENCHMARK(QUERY, InMemory) \
+  TPCH_PARQUET_BENCHMARKS(QUERY)
+
+TPCH_BENCHMARK(Q1);
+TPCH_BENCHMARK(Q2);
+TPCH_BENCHMARK(Q3);
+TPCH_BENCHMARK(Q4);
+TPCH_BENCHMARK(Q5);
+TPCH_BENCHMARK(Q6);
+TPCH_BENCHMARK(Q7);
+TPCH_BENCHMARK(Q8);
+TPCH_BENCHMARK(Q9);
+TPCH_BENCHMARK(Q10);
+TPCH_BENCHMARK(Q11);
+TPCH_BENCHMARK(Q12);
+TPCH_BENCHMARK(Q13);
+TPCH_BENCHMARK(Q14);
+TPCH_BENCHMARK(Q15);
+TPCH_BENCHMARK(Q16);
+TPCH_BENCHMARK(Q17);
+TPCH_BENCHMARK(Q18);
+TPCH_BENCHMARK(Q19);
+TPCH_BENCHMARK(Q20);
+TPCH_BENCHMARK(Q21);
+TPCH_BENCHMARK(Q22);
+
 }  // namespace internal
 }  // namespace acero
 }  // namespace arrow
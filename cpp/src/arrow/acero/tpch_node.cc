@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <bitset>
+#include <condition_variable>
 #include <cstring>
 #include <memory>
 #include <mutex>
@@ -66,6 +67,13 @@ applicable), and then call the necessary generator functions. To generate a colu
 first check if it's already been generated. If not, we allocate the batch and then fill it
 according to the spec.
 
+    The random generator of a thread is reseeded from the table's seed and the first row
+of every batch it generates, so a given batch always comes out the same no matter which
+thread generates it. A generator can also be restricted to one of several partitions of
+the rows of each table. Partition boundaries fall on batch boundaries, so the union of
+all partitions is exactly the data generated without partitioning, and partitions can be
+generated independently, e.g. by separate processes.
+
     There are a few types of columns that get generated:
     - Primary Keys: incrementing counters from 1 to N (with N being the number of rows).
 These are generated by incrementing a counter (this counter is gated under a lock).
@@ -116,7 +124,7 @@ const char* Types_3[] = {
 constexpr size_t kNumTypes_3 = sizeof(Types_3) / sizeof(Types_3[0]);
 
 const char* Containers_1[] = {
-    "SM ", "LG ", "MD ", "JUMBO ", "WRAP ",
+    "SM ", "LG ", "MED ", "JUMBO ", "WRAP ",
 };
 constexpr size_t kNumContainers_1 = sizeof(Containers_1) / sizeof(Containers_1[0]);
 
@@ -236,18 +244,27 @@ constexpr uint32_t kEndDate =
 
 std::uniform_int_distribution<int64_t> kSeedDist(std::numeric_limits<int64_t>::min(),
                                                  std::numeric_limits<int64_t>::max());
+// Derives a seed for the item at `index` of a sequence (a chunk of text, a batch of
+// rows...) from the seed of the whole sequence
+int64_t DeriveSeed(int64_t seed, int64_t index) {
+  random::pcg64_fast seed_rng(static_cast<uint64_t>(seed) ^
+                              (static_cast<uint64_t>(index) * 0x9E3779B97F4A7C15ULL));
+  return kSeedDist(seed_rng);
+}
+
 // The spec says to generate a 300 MB string according to a grammar. This is a
-// concurrent implementation of the generator. Each thread generates the text in
-// (up to) 8KB chunks of text. The generator maintains a cursor into the
-// 300 MB buffer. After generating the chunk, the cursor is incremented
-// to reserve space, and the chunk is memcpy-d in.
+// concurrent implementation of the generator. The text is split into 8KB chunks,
+// each of which is filled with as many sentences as fit and padded with spaces.
+// Every chunk is generated from its own seed, so the text is the same no matter how
+// many threads take part in generating it, just like dbgen's text does not depend
+// on the seed of the data.
 // This text is used to generate the COMMENT columns. To generate a comment, the spec
 // says to pick a random length and a random offset into the 300 MB buffer (it does
 // not specify it should be word/sentence aligned), and that slice of text becomes
 // the comment.
 class TpchPseudotext {
  public:
-  Status EnsureInitialized(random::pcg32_fast& rng);
+  Status EnsureInitialized();
   Result<Datum> GenerateComments(size_t num_comments, size_t min_length,
                                  size_t max_length, random::pcg32_fast& rng);
 
@@ -269,16 +286,20 @@ class TpchPseudotext {
   bool GenerateSentence(int64_t& offset, random::pcg32_fast& rng, char* arr);
 
   std::atomic<bool> done_ = {false};
-  int64_t generated_offset_{0};
+  std::atomic<int64_t> next_chunk_{0};
+  std::atomic<int64_t> chunks_generated_{0};
   std::mutex text_guard_;
+  std::condition_variable text_generated_;
   std::unique_ptr<Buffer> text_;
   static constexpr int64_t kChunkSize = 8192;
   static constexpr int64_t kTextBytes = 300 * 1024 * 1024;  // 300 MB
+  static constexpr int64_t kNumChunks = kTextBytes / kChunkSize;
+  static constexpr int64_t kTextSeed = 0x7470636874657874;
 };
 
 static TpchPseudotext g_text;
 
-Status TpchPseudotext::EnsureInitialized(random::pcg32_fast& rng) {
+Status TpchPseudotext::EnsureInitialized() {
   if (done_.load()) return Status::OK();
 
   {
@@ -288,35 +309,31 @@ Status TpchPseudotext::EnsureInitialized(random::pcg32_fast& rng) {
     }
   }
   char* out = reinterpret_cast<char*>(text_->mutable_data());
-  char temp_buff[kChunkSize];
 
-  while (!done_.load()) {
+  for (int64_t chunk = next_chunk_.fetch_add(1); chunk < kNumChunks;
+       chunk = next_chunk_.fetch_add(1)) {
+    random::pcg32_fast rng(DeriveSeed(kTextSeed, chunk));
+    char* chunk_out = out + chunk * kChunkSize;
     int64_t known_valid_offset = 0;
     int64_t try_offset = 0;
-    while (GenerateSentence(try_offset, rng, temp_buff)) known_valid_offset = try_offset;
-
-    bool last_one;
-    int64_t offset;
-    int64_t memcpy_size;
-    {
+    while (GenerateSentence(try_offset, rng, chunk_out)) known_valid_offset = try_offset;
+    std::memset(chunk_out + known_valid_offset, ' ', kChunkSize - known_valid_offset);
+    if (chunks_generated_.fetch_add(1) + 1 == kNumChunks) {
       std::lock_guard<std::mutex> lock(text_guard_);
-      if (done_.load()) return Status::OK();
-      int64_t bytes_remaining = kTextBytes - generated_offset_;
-      memcpy_size = std::min(known_valid_offset, bytes_remaining);
-      offset = generated_offset_;
-      generated_offset_ += memcpy_size;
-      last_one = generated_offset_ == kTextBytes;
+      done_.store(true);
+      text_generated_.notify_all();
     }
-    std::memcpy(out + offset, temp_buff, memcpy_size);
-    if (last_one) done_.store(true);
   }
+  // Every chunk is claimed, wait for the threads still filling theirs
+  std::unique_lock<std::mutex> lock(text_guard_);
+  text_generated_.wait(lock, [this] { return done_.load(); });
   return Status::OK();
 }
 
 Result<Datum> TpchPseudotext::GenerateComments(size_t num_comments, size_t min_length,
                                                size_t max_length,
                                                random::pcg32_fast& rng) {
-  RETURN_NOT_OK(EnsureInitialized(rng));
+  RETURN_NOT_OK(EnsureInitialized());
   std::uniform_int_distribution<size_t> length_dist(min_length, max_length);
   ARROW_ASSIGN_OR_RAISE(std::unique_ptr<Buffer> offset_buffer,
                         AllocateBuffer(sizeof(int32_t) * (num_comments + 1)));
@@ -497,6 +514,23 @@ bool TpchPseudotext::GenerateSentence(int64_t& offset, random::pcg32_fast& rng,
   return success;
 }
 
+// The rows [begin, end) of a table
+struct RowRange {
+  int64_t begin;
+  int64_t end;
+};
+
+// Returns the rows of a table of `num_rows` rows that belong to partition
+// `partition_index` out of `num_partitions`.  Boundaries are rounded to whole batches
+// so that the batches, and therefore their seeds, do not depend on the partitioning.
+RowRange PartitionRowRange(int64_t num_rows, int64_t batch_size, int64_t partition_index,
+                           int64_t num_partitions) {
+  int64_t num_batches = (num_rows + batch_size - 1) / batch_size;
+  int64_t begin = num_batches * partition_index / num_partitions * batch_size;
+  int64_t end = num_batches * (partition_index + 1) / num_partitions * batch_size;
+  return {std::min(begin, num_rows), std::min(end, num_rows)};
+}
+
 class TpchTableGenerator {
  public:
   using OutputBatchCallback = std::function<Status(ExecBatch)>;
@@ -519,10 +553,22 @@ class TpchTableGenerator {
 
   virtual std::shared_ptr<Schema> schema() const = 0;
 
+  // Must be called before Init
+  void SetPartition(int64_t partition_index, int64_t num_partitions) {
+    partition_index_ = partition_index;
+    num_partitions_ = num_partitions;
+  }
+
   virtual ~TpchTableGenerator() = default;
 
  protected:
+  RowRange PartitionRows(int64_t num_rows, int64_t batch_size) const {
+    return PartitionRowRange(num_rows, batch_size, partition_index_, num_partitions_);
+  }
+
   int64_t seed_ = {0};
+  int64_t partition_index_ = 0;
+  int64_t num_partitions_ = 1;
   std::atomic<bool> done_ = {false};
   std::atomic<int64_t> batches_outputted_ = {0};
 };
@@ -636,20 +682,24 @@ void GeneratePhoneNumber(char* out, random::pcg32_fast& rng, int32_t country) {
 using GenerateColumnFn = std::function<Status(size_t)>;
 class PartAndPartSupplierGenerator {
  public:
-  Status Init(size_t num_threads, int64_t batch_size, double scale_factor, int64_t seed) {
+  Status Init(size_t num_threads, int64_t batch_size, double scale_factor, int64_t seed,
+              int64_t partition_index, int64_t num_partitions) {
     if (!inited_) {
       inited_ = true;
       batch_size_ = batch_size;
       scale_factor_ = scale_factor;
+      seed_ = seed;
 
       thread_local_data_.resize(num_threads);
-      random::pcg64_fast seed_rng(seed);
       for (ThreadLocalData& tld : thread_local_data_) {
         constexpr int kMaxNumDistinctStrings = 5;
         tld.string_indices.resize(kMaxNumDistinctStrings * batch_size_);
-        tld.rng.seed(kSeedDist(seed_rng));
       }
-      part_rows_to_generate_ = static_cast<int64_t>(scale_factor_ * 200000);
+      RowRange rows =
+          PartitionRowRange(static_cast<int64_t>(scale_factor_ * 200000), batch_size_,
+                            partition_index, num_partitions);
+      part_rows_generated_ = rows.begin;
+      part_rows_to_generate_ = rows.end;
     }
     return Status::OK();
   }
@@ -685,6 +735,7 @@ class PartAndPartSupplierGenerator {
         tld.part_to_generate =
             std::min(batch_size_, part_rows_to_generate_ - part_rows_generated_);
         part_rows_generated_ += tld.part_to_generate;
+        tld.rng.seed(DeriveSeed(seed_, tld.partkey_start));
 
         int64_t num_ps_batches = PartsuppBatchesToGenerate(thread_index);
         part_batches_generated_.fetch_add(1);
@@ -744,6 +795,7 @@ class PartAndPartSupplierGenerator {
         tld.part_to_generate =
             std::min(batch_size_, part_rows_to_generate_ - part_rows_generated_);
         part_rows_generated_ += tld.part_to_generate;
+        tld.rng.seed(DeriveSeed(seed_, tld.partkey_start));
         int64_t num_ps_batches = PartsuppBatchesToGenerate(thread_index);
         part_batches_generated_.fetch_add(1);
         partsupp_batches_generated_.fetch_add(num_ps_batches);
@@ -1285,6 +1337,8 @@ class PartAndPartSupplierGenerator {
   std::queue<ExecBatch> partsupp_output_queue_;
   int64_t batch_size_{0};
   double scale_factor_{0};
+  int64_t seed_{0};
+  // The rows of PART this partition generates end at part_rows_to_generate_
   int64_t part_rows_to_generate_{0};
   int64_t part_rows_generated_{0};
   std::vector<int> part_cols_;
@@ -1297,19 +1351,22 @@ class PartAndPartSupplierGenerator {
 
 class OrdersAndLineItemGenerator {
  public:
-  Status Init(size_t num_threads, int64_t batch_size, double scale_factor, int64_t seed) {
+  Status Init(size_t num_threads, int64_t batch_size, double scale_factor, int64_t seed,
+              int64_t partition_index, int64_t num_partitions) {
     if (!inited_) {
       inited_ = true;
       batch_size_ = batch_size;
       scale_factor_ = scale_factor;
+      seed_ = seed;
 
       thread_local_data_.resize(num_threads);
-      random::pcg64_fast seed_rng(seed);
       for (ThreadLocalData& tld : thread_local_data_) {
         tld.items_per_order.resize(batch_size_);
-        tld.rng.seed(kSeedDist(seed_rng));
       }
-      orders_rows_to_generate_ = static_cast<int64_t>(scale_factor_ * 150000 * 10);
+      RowRange rows = PartitionRowRange(static_cast<int64_t>(scale_factor_ * 150000 * 10),
+                                        batch_size_, partition_index, num_partitions);
+      orders_rows_generated_ = rows.begin;
+      orders_rows_to_generate_ = rows.end;
     }
     return Status::OK();
   }
@@ -1345,6 +1402,7 @@ class OrdersAndLineItemGenerator {
         tld.orders_to_generate =
             std::min(batch_size_, orders_rows_to_generate_ - orders_rows_generated_);
         orders_rows_generated_ += tld.orders_to_generate;
+        tld.rng.seed(DeriveSeed(seed_, tld.orderkey_start));
         orders_batches_generated_.fetch_add(1);
         tld.first_batch_offset = 0;
         RETURN_NOT_OK(GenerateRowCounts(thread_index));
@@ -1414,6 +1472,7 @@ class OrdersAndLineItemGenerator {
       tld.orders_to_generate =
           std::min(batch_size_, orders_rows_to_generate_ - orders_rows_generated_);
       orders_rows_generated_ += tld.orders_to_generate;
+      tld.rng.seed(DeriveSeed(seed_, tld.orderkey_start));
       orders_batches_generated_.fetch_add(1);
       RETURN_NOT_OK(GenerateRowCounts(thread_index));
       lineitem_batches_generated_.fetch_add(
@@ -1638,6 +1697,8 @@ class OrdersAndLineItemGenerator {
               o_orderstatus[iorder] = 'O';
             else
               o_orderstatus[iorder] = 'P';
+            all_f = true;
+            all_o = true;
             iorder++;
           }
         }
@@ -2395,6 +2456,8 @@ class OrdersAndLineItemGenerator {
   std::queue<ExecBatch> lineitem_output_queue_;
   int64_t batch_size_;
   double scale_factor_;
+  int64_t seed_;
+  // The rows of ORDERS this partition generates end at orders_rows_to_generate_
   int64_t orders_rows_to_generate_;
   int64_t orders_rows_generated_;
   std::vector<int> orders_cols_;
@@ -2411,7 +2474,8 @@ class SupplierGenerator : public TpchTableGenerator {
     scale_factor_ = scale_factor;
     batch_size_ = batch_size;
     rows_to_generate_ = static_cast<int64_t>(scale_factor_ * 10000);
-    rows_generated_.store(0);
+    rows_ = PartitionRows(rows_to_generate_, batch_size_);
+    rows_generated_.store(rows_.begin);
     ARROW_ASSIGN_OR_RAISE(schema_,
                           SetOutputColumns(columns, kTypes, kNameMap, gen_list_));
 
@@ -2447,11 +2511,14 @@ class SupplierGenerator : public TpchTableGenerator {
                         FinishedCallback finished_callback,
                         ScheduleCallback schedule_callback) override {
     thread_local_data_.resize(num_threads);
-    for (ThreadLocalData& tld : thread_local_data_) tld.rng.seed(GetRandomSeed());
 
     output_callback_ = std::move(output_callback);
     finished_callback_ = std::move(finished_callback);
     schedule_callback_ = std::move(schedule_callback);
+    if (rows_.begin == rows_.end) {
+      done_.store(true);
+      return finished_callback_(0);
+    }
     for (size_t i = 0; i < num_threads; i++)
       RETURN_NOT_OK(schedule_callback_(
           [this](size_t thread_index) { return this->ProduceCallback(thread_index); }));
@@ -2497,9 +2564,10 @@ class SupplierGenerator : public TpchTableGenerator {
     if (done_.load()) return Status::OK();
     ThreadLocalData& tld = thread_local_data_[thread_index];
     tld.suppkey_start = rows_generated_.fetch_add(batch_size_);
-    if (tld.suppkey_start >= rows_to_generate_) return Status::OK();
+    if (tld.suppkey_start >= rows_.end) return Status::OK();
 
-    tld.to_generate = std::min(batch_size_, rows_to_generate_ - tld.suppkey_start);
+    tld.to_generate = std::min(batch_size_, rows_.end - tld.suppkey_start);
+    tld.rng.seed(DeriveSeed(seed_, tld.suppkey_start));
 
     tld.batch.resize(SUPPLIER::kNumCols);
     std::fill(tld.batch.begin(), tld.batch.end(), Datum());
@@ -2511,7 +2579,8 @@ class SupplierGenerator : public TpchTableGenerator {
       result[i] = tld.batch[col_idx];
     }
     ARROW_ASSIGN_OR_RAISE(ExecBatch eb, ExecBatch::Make(std::move(result)));
-    int64_t batches_to_generate = (rows_to_generate_ + batch_size_ - 1) / batch_size_;
+    int64_t batches_to_generate =
+        (rows_.end - rows_.begin + batch_size_ - 1) / batch_size_;
     int64_t batches_outputted_before_this_one = batches_outputted_.fetch_add(1);
     bool is_last_batch = batches_outputted_before_this_one == (batches_to_generate - 1);
     ARROW_RETURN_NOT_OK(output_callback_(std::move(eb)));
@@ -2675,6 +2744,7 @@ class SupplierGenerator : public TpchTableGenerator {
   FinishedCallback finished_callback_;
   ScheduleCallback schedule_callback_;
   int64_t rows_to_generate_;
+  RowRange rows_;
   std::atomic<int64_t> rows_generated_;
   double scale_factor_;
   int64_t batch_size_;
@@ -2699,7 +2769,8 @@ class PartGenerator : public TpchTableGenerator {
   Status StartProducing(size_t num_threads, OutputBatchCallback output_callback,
                         FinishedCallback finished_callback,
                         ScheduleCallback schedule_callback) override {
-    RETURN_NOT_OK(gen_->Init(num_threads, batch_size_, scale_factor_, seed_));
+    RETURN_NOT_OK(gen_->Init(num_threads, batch_size_, scale_factor_, seed_,
+                             partition_index_, num_partitions_));
     output_callback_ = std::move(output_callback);
     finished_callback_ = std::move(finished_callback);
     schedule_callback_ = std::move(schedule_callback);
@@ -2761,7 +2832,8 @@ class PartSuppGenerator : public TpchTableGenerator {
   Status StartProducing(size_t num_threads, OutputBatchCallback output_callback,
                         FinishedCallback finished_callback,
                         ScheduleCallback schedule_callback) override {
-    RETURN_NOT_OK(gen_->Init(num_threads, batch_size_, scale_factor_, seed_));
+    RETURN_NOT_OK(gen_->Init(num_threads, batch_size_, scale_factor_, seed_,
+                             partition_index_, num_partitions_));
     output_callback_ = std::move(output_callback);
     finished_callback_ = std::move(finished_callback);
     schedule_callback_ = std::move(schedule_callback);
@@ -2814,7 +2886,8 @@ class CustomerGenerator : public TpchTableGenerator {
     scale_factor_ = scale_factor;
     batch_size_ = batch_size;
     rows_to_generate_ = static_cast<int64_t>(scale_factor_ * 150000);
-    rows_generated_.store(0);
+    rows_ = PartitionRows(rows_to_generate_, batch_size_);
+    rows_generated_.store(rows_.begin);
     ARROW_ASSIGN_OR_RAISE(schema_,
                           SetOutputColumns(columns, kTypes, kNameMap, gen_list_));
     return Status::OK();
@@ -2824,12 +2897,14 @@ class CustomerGenerator : public TpchTableGenerator {
                         FinishedCallback finished_callback,
                         ScheduleCallback schedule_callback) override {
     thread_local_data_.resize(num_threads);
-    random::pcg64_fast seed_rng(seed_);
-    for (ThreadLocalData& tld : thread_local_data_) tld.rng.seed(kSeedDist(seed_rng));
 
     output_callback_ = std::move(output_callback);
     finished_callback_ = std::move(finished_callback);
     schedule_callback_ = std::move(schedule_callback);
+    if (rows_.begin == rows_.end) {
+      done_.store(true);
+      return finished_callback_(0);
+    }
     for (size_t i = 0; i < num_threads; i++)
       RETURN_NOT_OK(schedule_callback_(
           [this](size_t thread_index) { return this->ProduceCallback(thread_index); }));
@@ -2881,9 +2956,10 @@ class CustomerGenerator : public TpchTableGenerator {
     if (done_.load()) return Status::OK();
     ThreadLocalData& tld = thread_local_data_[thread_index];
     tld.custkey_start = rows_generated_.fetch_add(batch_size_);
-    if (tld.custkey_start >= rows_to_generate_) return Status::OK();
+    if (tld.custkey_start >= rows_.end) return Status::OK();
 
-    tld.to_generate = std::min(batch_size_, rows_to_generate_ - tld.custkey_start);
+    tld.to_generate = std::min(batch_size_, rows_.end - tld.custkey_start);
+    tld.rng.seed(DeriveSeed(seed_, tld.custkey_start));
 
     tld.batch.resize(CUSTOMER::kNumCols);
     std::fill(tld.batch.begin(), tld.batch.end(), Datum());
@@ -2895,7 +2971,8 @@ class CustomerGenerator : public TpchTableGenerator {
       result[i] = tld.batch[col_idx];
     }
     ARROW_ASSIGN_OR_RAISE(ExecBatch eb, ExecBatch::Make(std::move(result)));
-    int64_t batches_to_generate = (rows_to_generate_ + batch_size_ - 1) / batch_size_;
+    int64_t batches_to_generate =
+        (rows_.end - rows_.begin + batch_size_ - 1) / batch_size_;
     int64_t batches_generated_before_this_one = batches_outputted_.fetch_add(1);
     bool is_last_batch = batches_generated_before_this_one == (batches_to_generate - 1);
     ARROW_RETURN_NOT_OK(output_callback_(std::move(eb)));
@@ -3056,6 +3133,7 @@ class CustomerGenerator : public TpchTableGenerator {
   FinishedCallback finished_callback_;
   ScheduleCallback schedule_callback_;
   int64_t rows_to_generate_{0};
+  RowRange rows_{0, 0};
   std::atomic<int64_t> rows_generated_ = {0};
   double scale_factor_{0};
   int64_t batch_size_{0};
@@ -3080,7 +3158,8 @@ class OrdersGenerator : public TpchTableGenerator {
   Status StartProducing(size_t num_threads, OutputBatchCallback output_callback,
                         FinishedCallback finished_callback,
                         ScheduleCallback schedule_callback) override {
-    RETURN_NOT_OK(gen_->Init(num_threads, batch_size_, scale_factor_, seed_));
+    RETURN_NOT_OK(gen_->Init(num_threads, batch_size_, scale_factor_, seed_,
+                             partition_index_, num_partitions_));
     output_callback_ = std::move(output_callback);
     finished_callback_ = std::move(finished_callback);
     schedule_callback_ = std::move(schedule_callback);
@@ -3142,7 +3221,8 @@ class LineitemGenerator : public TpchTableGenerator {
   Status StartProducing(size_t num_threads, OutputBatchCallback output_callback,
                         FinishedCallback finished_callback,
                         ScheduleCallback schedule_callback) override {
-    RETURN_NOT_OK(gen_->Init(num_threads, batch_size_, scale_factor_, seed_));
+    RETURN_NOT_OK(gen_->Init(num_threads, batch_size_, scale_factor_, seed_,
+                             partition_index_, num_partitions_));
     output_callback_ = std::move(output_callback);
     finished_callback_ = std::move(finished_callback);
     schedule_callback_ = std::move(schedule_callback);
@@ -3202,6 +3282,8 @@ class NationGenerator : public TpchTableGenerator {
   Status StartProducing(size_t /*num_threads*/, OutputBatchCallback output_callback,
                         FinishedCallback finished_callback,
                         ScheduleCallback /*schedule_task_callback*/) override {
+    // The whole table is a single batch, which goes to the first partition
+    if (partition_index_ != 0) return finished_callback(0);
     std::shared_ptr<Buffer> N_NATIONKEY_buffer = Buffer::Wrap(kNationKey, kRowCount);
     ArrayData N_NATIONKEY_arraydata(int32(), kRowCount,
                                     {nullptr, std::move(N_NATIONKEY_buffer)});
@@ -3296,6 +3378,8 @@ class RegionGenerator : public TpchTableGenerator {
   Status StartProducing(size_t num_threads, OutputBatchCallback output_callback,
                         FinishedCallback finished_callback,
                         ScheduleCallback /*schedule_task_callback*/) override {
+    // The whole table is a single batch, which goes to the first partition
+    if (partition_index_ != 0) return finished_callback(0);
     std::shared_ptr<Buffer> R_REGIONKEY_buffer = Buffer::Wrap(kRegionKey, kRowCount);
     ArrayData R_REGIONKEY_arraydata(int32(), kRowCount,
                                     {nullptr, std::move(R_REGIONKEY_buffer)});
@@ -3442,19 +3526,37 @@ class TpchGenImpl : public TpchGen {
   Result<ExecNode*> Nation(std::vector<std::string> columns = {}) override;
   Result<ExecNode*> Region(std::vector<std::string> columns = {}) override;
 
-  TpchGenImpl(ExecPlan* plan, double scale_factor, int64_t batch_size, int64_t seed)
+  TpchGenImpl(ExecPlan* plan, double scale_factor, int64_t batch_size, int64_t seed,
+              int64_t partition_index, int64_t num_partitions)
       : plan_(plan),
         scale_factor_(scale_factor),
         batch_size_(batch_size),
-        seed_rng_(seed) {}
+        seed_(seed),
+        partition_index_(partition_index),
+        num_partitions_(num_partitions) {}
+
+  // The seed of each table only depends on the seed of the generator, not on which
+  // tables were created before, so that separate plans (e.g. generating different
+  // partitions) agree on the data.  Tables generated together share a seed.
+  enum SeedIndex {
+    kSupplier,
+    kPartAndPartSupp,
+    kCustomer,
+    kOrdersAndLineitem,
+    kNation,
+    kRegion,
+  };
 
   template <typename Generator>
-  Result<ExecNode*> CreateNode(const char* name, std::vector<std::string> columns);
+  Result<ExecNode*> CreateNode(const char* name, std::unique_ptr<Generator> generator,
+                               std::vector<std::string> columns, SeedIndex seed_index);
 
   ExecPlan* plan_;
   double scale_factor_;
   int64_t batch_size_;
-  random::pcg64_fast seed_rng_;
+  int64_t seed_;
+  int64_t partition_index_;
+  int64_t num_partitions_;
 
   std::shared_ptr<PartAndPartSupplierGenerator> part_and_part_supp_generator_{};
   std::shared_ptr<OrdersAndLineItemGenerator> orders_and_line_item_generator_{};
@@ -3462,80 +3564,86 @@ class TpchGenImpl : public TpchGen {
 
 template <typename Generator>
 Result<ExecNode*> TpchGenImpl::CreateNode(const char* name,
-                                          std::vector<std::string> columns) {
-  std::unique_ptr<Generator> generator = std::make_unique<Generator>();
+                                          std::unique_ptr<Generator> generator,
+                                          std::vector<std::string> columns,
+                                          SeedIndex seed_index) {
+  generator->SetPartition(partition_index_, num_partitions_);
   RETURN_NOT_OK(generator->Init(std::move(columns), scale_factor_, batch_size_,
-                                kSeedDist(seed_rng_)));
+                                DeriveSeed(seed_, seed_index)));
   return plan_->EmplaceNode<TpchNode>(plan_, name, std::move(generator));
 }
 
 Result<ExecNode*> TpchGenImpl::Supplier(std::vector<std::string> columns) {
-  return CreateNode<SupplierGenerator>("Supplier", std::move(columns));
+  return CreateNode("Supplier", std::make_unique<SupplierGenerator>(),
+                    std::move(columns), kSupplier);
 }
 
 Result<ExecNode*> TpchGenImpl::Part(std::vector<std::string> columns) {
   if (!part_and_part_supp_generator_) {
     part_and_part_supp_generator_ = std::make_shared<PartAndPartSupplierGenerator>();
   }
-  std::unique_ptr<PartGenerator> generator =
-      std::make_unique<PartGenerator>(part_and_part_supp_generator_);
-  RETURN_NOT_OK(generator->Init(std::move(columns), scale_factor_, batch_size_,
-                                kSeedDist(seed_rng_)));
-  return plan_->EmplaceNode<TpchNode>(plan_, "Part", std::move(generator));
+  return CreateNode("Part",
+                    std::make_unique<PartGenerator>(part_and_part_supp_generator_),
+                    std::move(columns), kPartAndPartSupp);
 }
 
 Result<ExecNode*> TpchGenImpl::PartSupp(std::vector<std::string> columns) {
   if (!part_and_part_supp_generator_) {
     part_and_part_supp_generator_ = std::make_shared<PartAndPartSupplierGenerator>();
   }
-  std::unique_ptr<PartSuppGenerator> generator =
-      std::make_unique<PartSuppGenerator>(part_and_part_supp_generator_);
-  RETURN_NOT_OK(generator->Init(std::move(columns), scale_factor_, batch_size_,
-                                kSeedDist(seed_rng_)));
-  return plan_->EmplaceNode<TpchNode>(plan_, "PartSupp", std::move(generator));
+  return CreateNode("PartSupp",
+                    std::make_unique<PartSuppGenerator>(part_and_part_supp_generator_),
+                    std::move(columns), kPartAndPartSupp);
 }
 
 Result<ExecNode*> TpchGenImpl::Customer(std::vector<std::string> columns) {
-  return CreateNode<CustomerGenerator>("Customer", std::move(columns));
+  return CreateNode("Customer", std::make_unique<CustomerGenerator>(),
+                    std::move(columns), kCustomer);
 }
 
 Result<ExecNode*> TpchGenImpl::Orders(std::vector<std::string> columns) {
   if (!orders_and_line_item_generator_) {
     orders_and_line_item_generator_ = std::make_shared<OrdersAndLineItemGenerator>();
   }
-  std::unique_ptr<OrdersGenerator> generator =
-      std::make_unique<OrdersGenerator>(orders_and_line_item_generator_);
-  RETURN_NOT_OK(generator->Init(std::move(columns), scale_factor_, batch_size_,
-                                kSeedDist(seed_rng_)));
-  return plan_->EmplaceNode<TpchNode>(plan_, "Orders", std::move(generator));
+  return CreateNode("Orders",
+                    std::make_unique<OrdersGenerator>(orders_and_line_item_generator_),
+                    std::move(columns), kOrdersAndLineitem);
 }
 
 Result<ExecNode*> TpchGenImpl::Lineitem(std::vector<std::string> columns) {
   if (!orders_and_line_item_generator_) {
     orders_and_line_item_generator_ = std::make_shared<OrdersAndLineItemGenerator>();
   }
-  std::unique_ptr<LineitemGenerator> generator =
-      std::make_unique<LineitemGenerator>(orders_and_line_item_generator_);
-  RETURN_NOT_OK(generator->Init(std::move(columns), scale_factor_, batch_size_,
-                                kSeedDist(seed_rng_)));
-  return plan_->EmplaceNode<TpchNode>(plan_, "Lineitem", std::move(generator));
+  return CreateNode("Lineitem",
+                    std::make_unique<LineitemGenerator>(orders_and_line_item_generator_),
+                    std::move(columns), kOrdersAndLineitem);
 }
 
 Result<ExecNode*> TpchGenImpl::Nation(std::vector<std::string> columns) {
-  return CreateNode<NationGenerator>("Nation", std::move(columns));
+  return CreateNode("Nation", std::make_unique<NationGenerator>(), std::move(columns),
+                    kNation);
 }
 
 Result<ExecNode*> TpchGenImpl::Region(std::vector<std::string> columns) {
-  return CreateNode<RegionGenerator>("Region", std::move(columns));
+  return CreateNode("Region", std::make_unique<RegionGenerator>(), std::move(columns),
+                    kRegion);
 }
 
 }  // namespace
 
 Result<std::unique_ptr<TpchGen>> TpchGen::Make(ExecPlan* plan, double scale_factor,
                                                int64_t batch_size,
-                                               std::optional<int64_t> seed) {
+                                               std::optional<int64_t> seed,
+                                               int64_t partition_index,
+                                               int64_t num_partitions) {
+  if (batch_size <= 0) return Status::Invalid("TPC-H batch size must be positive");
+  if (num_partitions <= 0 || partition_index < 0 || partition_index >= num_partitions) {
+    return Status::Invalid("Invalid TPC-H partition ", partition_index, " out of ",
+                           num_partitions);
+  }
   if (!seed.has_value()) seed = GetRandomSeed();
-  return std::make_unique<TpchGenImpl>(plan, scale_factor, batch_size, *seed);
+  return std::make_unique<TpchGenImpl>(plan, scale_factor, batch_size, *seed,
+                                       partition_index, num_partitions);
 }
 
 }  // namespace internal
@@ -42,10 +42,19 @@ class ARROW_ACERO_EXPORT TpchGen {
    * create a single TpchGen instance for each plan and then you can create nodes for each
    * table from that single TpchGen instance. Note: Every batch will be scheduled as a new
    * task using the ExecPlan's scheduler.
+   *
+   * For a given seed and batch size, the generated rows do not depend on the number of
+   * threads (only their order does).  Large scale factors can be split into
+   * `num_partitions` partitions by row ranges, of which this generator only produces
+   * the partition at `partition_index`.  Each partition can be generated by its own
+   * plan, e.g. in separate processes feeding a dataset "write" node each, and together
+   * the partitions hold exactly the rows of the unpartitioned data.  The NATION and
+   * REGION tables are only produced by the first partition.
    */
   static Result<std::unique_ptr<TpchGen>> Make(
       ExecPlan* plan, double scale_factor = 1.0, int64_t batch_size = 4096,
-      std::optional<int64_t> seed = std::nullopt);
+      std::optional<int64_t> seed = std::nullopt, int64_t partition_index = 0,
+      int64_t num_partitions = 1);
 
   // The below methods will create and add an ExecNode to the plan that generates
   // data for the desired table. If columns is empty, all columns will be generated.
@@ -21,6 +21,7 @@
 #include <memory>
 #include <regex>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "arrow/acero/options.h"
@@ -59,12 +60,15 @@ Status AddTableAndSinkToPlan(ExecPlan& plan, TpchGen& gen,
   return Status::OK();
 }
 
-Result<std::vector<ExecBatch>> GenerateTable(TableNodeFn table,
-                                             double scale_factor = kDefaultScaleFactor) {
+Result<std::vector<ExecBatch>> GenerateTable(
+    TableNodeFn table, double scale_factor = kDefaultScaleFactor,
+    std::optional<int64_t> seed = std::nullopt, int64_t partition_index = 0,
+    int64_t num_partitions = 1) {
   ExecContext ctx(default_memory_pool(), arrow::internal::GetCpuThreadPool());
   ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ExecPlan> plan, ExecPlan::Make(ctx));
   ARROW_ASSIGN_OR_RAISE(std::unique_ptr<TpchGen> gen,
-                        TpchGen::Make(plan.get(), scale_factor));
+                        TpchGen::Make(plan.get(), scale_factor, /*batch_size=*/4096,
+                                      seed, partition_index, num_partitions));
   AsyncGenerator<std::optional<ExecBatch>> sink_gen;
   ARROW_RETURN_NOT_OK(AddTableAndSinkToPlan(*plan, *gen, sink_gen, table));
   auto fut = StartAndCollect(plan.get(), sink_gen);
@@ -313,6 +317,21 @@ void VerifyOneOf(const Datum& d, int32_t byte_width,
   }
 }
 
+// Verifies that the first word of each fixed-width row is one of the possibilities
+void VerifyFirstWordOneOf(const Datum& d, int32_t byte_width,
+                          const std::unordered_set<std::string_view>& possibilities) {
+  int64_t length = d.length();
+  const char* col = reinterpret_cast<const char*>(d.array()->buffers[1]->data());
+  for (int64_t i = 0; i < length; i++) {
+    const char* row = col + i * byte_width;
+    int32_t word_len = 0;
+    while (word_len < byte_width && row[word_len] && row[word_len] != ' ') word_len++;
+    std::string_view word(row, word_len);
+    ASSERT_TRUE(possibilities.find(word) != possibilities.end())
+        << word << " is not a valid first word.";
+  }
+}
+
 // Counts the number of instances of each integer
 void CountInstances(std::unordered_map<int32_t, int32_t>* counts, const Datum& d) {
   int64_t length = d.length();
@@ -400,6 +419,8 @@ void VerifyPart(const std::vector<ExecBatch>& batches,
     VerifyCorrectNumberOfWords_FixedWidth(batch[6],
                                           /*num_words=*/2,
                                           /*byte_width=*/10);
+    VerifyFirstWordOneOf(batch[6], /*byte_width=*/10,
+                         {"SM", "LG", "MED", "JUMBO", "WRAP"});
     num_rows += batch.length;
   }
   ASSERT_EQ(seen_partkey.size(), kExpectedRows);
@@ -473,6 +494,7 @@ void VerifyOrders(const std::vector<ExecBatch>& batches,
   int64_t num_rows = 0;
 
   std::unordered_set<int32_t> seen_orderkey;
+  std::unordered_map<char, int64_t> status_counts;
   for (auto& batch : batches) {
     ValidateBatch(batch);
     VerifyUniqueKey(&seen_orderkey, batch[0],
@@ -481,6 +503,9 @@ void VerifyOrders(const std::vector<ExecBatch>& batches,
     VerifyAllBetween(batch[1], /*min=*/1, /*max=*/static_cast<int32_t>(kExpectedRows));
     VerifyModuloBetween(batch[1], /*min=*/1, /*max=*/2, /*mod=*/3);
     VerifyOneOf(batch[2], {'F', 'O', 'P'});
+    const char* status =
+        reinterpret_cast<const char*>(batch[2].array()->buffers[1]->data());
+    for (int64_t i = 0; i < batch.length; i++) status_counts[status[i]]++;
     VerifyAllBetween(batch[4], kStartDate, kEndDate - 151);
     VerifyOneOf(batch[5],
                 /*byte_width=*/15,
@@ -499,6 +524,11 @@ void VerifyOrders(const std::vector<ExecBatch>& batches,
   }
   ASSERT_EQ(seen_orderkey.size(), kExpectedRows);
   ASSERT_EQ(num_rows, kExpectedRows);
+  // The status follows from the status of the lineitems of the order: about half of
+  // the orders are entirely shipped (F), half not at all (O) and a few partially (P)
+  ASSERT_GT(status_counts['F'], kExpectedRows * 4 / 10);
+  ASSERT_GT(status_counts['O'], kExpectedRows * 4 / 10);
+  ASSERT_GT(status_counts['P'], 0);
 }
 
 TEST(TpchNode, Orders) {
@@ -639,6 +669,38 @@ TEST(TpchNode, AllTables) {
   }
 }
 
+TEST(TpchNode, PartitionsMatchUnpartitionedData) {
+  constexpr int64_t kSeed = 42;
+  constexpr int kNumPartitions = 3;
+  for (TableNodeFn table : {&TpchGen::Supplier, &TpchGen::PartSupp, &TpchGen::Customer,
+                            &TpchGen::Lineitem, &TpchGen::Region}) {
+    ASSERT_OK_AND_ASSIGN(auto expected,
+                         GenerateTable(table, kDefaultScaleFactor, kSeed));
+    ASSERT_FALSE(expected.empty());
+    std::vector<ExecBatch> actual;
+    for (int i = 0; i < kNumPartitions; i++) {
+      ASSERT_OK_AND_ASSIGN(auto partition, GenerateTable(table, kDefaultScaleFactor,
+                                                         kSeed, i, kNumPartitions));
+      for (ExecBatch& batch : partition) actual.push_back(std::move(batch));
+    }
+    FieldVector fields;
+    for (const Datum& value : expected[0].values) {
+      fields.push_back(field("f" + std::to_string(fields.size()), value.type()));
+    }
+    AssertExecBatchesEqualIgnoringOrder(schema(std::move(fields)), expected, actual);
+  }
+}
+
+TEST(TpchNode, InvalidPartition) {
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<ExecPlan> plan, ExecPlan::Make());
+  ASSERT_RAISES(Invalid, TpchGen::Make(plan.get(), kDefaultScaleFactor, 4096,
+                                       std::nullopt, /*partition_index=*/2,
+                                       /*num_partitions=*/2));
+  ASSERT_RAISES(Invalid, TpchGen::Make(plan.get(), kDefaultScaleFactor, 4096,
+                                       std::nullopt, /*partition_index=*/0,
+                                       /*num_partitions=*/0));
+}
+
 }  // namespace internal
 }  // namespace acero
 }  // namespace arrow
@@ -31,6 +31,9 @@ class QueryContext;
 struct QueryOptions;
 struct Declaration;
 class SinkNodeConsumer;
+class ExpressionCompiler;
+class PlanProfile;
+class NodeProfile;
 
 }  // namespace acero
 }  // namespace arrow
@@ -78,7 +78,7 @@ class UnionNode : public ExecNode, public TracedNode {
   }
 
   Status InputReceived(ExecNode* input, ExecBatch batch) override {
-    NoteInputReceived(batch);
+    NoteInputReceived(input, batch);
     ARROW_DCHECK(std::find(inputs_.begin(), inputs_.end(), input) != inputs_.end());
 
     if (inputs_.size() > 1) {
@@ -112,27 +112,65 @@ void TracedNode::NoteStartProducing(std::string extra_details) const {
                                                          {"node.label", node_->label()}});
 }
 
-[[nodiscard]] ::arrow::internal::tracing::Scope TracedNode::TraceInputReceived(
-    const ExecBatch& batch) const {
+TracedScope::TracedScope(std::unique_ptr<::arrow::internal::tracing::Scope> span,
+                         NodeProfile* profile)
+    : span_(std::move(span)), profile_(profile) {}
+
+TracedScope::~TracedScope() = default;
+
+const ExecNode* TracedNode::SoleInput() const {
+  return node_->inputs().size() == 1 ? node_->inputs()[0] : nullptr;
+}
+
+void TracedNode::RecordInputReceived(const ExecNode* input,
+                                     const ExecBatch& batch) const {
+  if (NodeProfile* profile = node_->profile()) {
+    profile->RecordInput(batch.length);
+  }
+  if (input != nullptr && input->profile() != nullptr) {
+    input->profile()->RecordOutput(batch.length);
+  }
+}
+
+[[nodiscard]] TracedScope TracedNode::TraceInputReceived(const ExecBatch& batch) const {
+  return TraceInputReceived(SoleInput(), batch);
+}
+
+[[nodiscard]] TracedScope TracedNode::TraceInputReceived(const ExecNode* input,
+                                                         const ExecBatch& batch) const {
+  RecordInputReceived(input, batch);
+  std::unique_ptr<::arrow::internal::tracing::Scope> span_scope;
+#ifdef ARROW_WITH_OPENTELEMETRY
   std::string node_kind(node_->kind_name());
   arrow::util::tracing::Span span;
-  return START_SCOPED_SPAN(
+  span_scope.reset(new ::arrow::internal::tracing::Scope(START_SCOPED_SPAN(
       span, node_kind + "::InputReceived",
-      {{"node.label", node_->label()}, {"node.batch_length", batch.length}});
+      {{"node.label", node_->label()}, {"node.batch_length", batch.length}})));
+#endif
+  return TracedScope(std::move(span_scope), node_->profile());
 }
 
 void TracedNode::NoteInputReceived(const ExecBatch& batch) const {
+  NoteInputReceived(SoleInput(), batch);
+}
+
+void TracedNode::NoteInputReceived(const ExecNode* input, const ExecBatch& batch) const {
+  RecordInputReceived(input, batch);
   std::string node_kind(node_->kind_name());
   EVENT_ON_CURRENT_SPAN(
       node_kind + "::InputReceived",
       {{"node.label", node_->label()}, {"node.batch_length", batch.length}});
 }
 
-[[nodiscard]] ::arrow::internal::tracing::Scope TracedNode::TraceFinish() const {
+[[nodiscard]] TracedScope TracedNode::TraceFinish() const {
+  std::unique_ptr<::arrow::internal::tracing::Scope> span_scope;
+#ifdef ARROW_WITH_OPENTELEMETRY
   std::string node_kind(node_->kind_name());
   arrow::util::tracing::Span span;
-  return START_SCOPED_SPAN(span, node_kind + "::Finish",
-                           {{"node.label", node_->label()}});
+  span_scope.reset(new ::arrow::internal::tracing::Scope(
+      START_SCOPED_SPAN(span, node_kind + "::Finish", {{"node.label", node_->label()}})));
+#endif
+  return TracedScope(std::move(span_scope), node_->profile());
 }
 
 }  // namespace acero
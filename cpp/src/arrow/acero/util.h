@@ -19,12 +19,14 @@
 
 #include <atomic>
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <thread>
 #include <unordered_map>
 #include <vector>
 
 #include "arrow/acero/options.h"
+#include "arrow/acero/profile.h"
 #include "arrow/acero/type_fwd.h"
 #include "arrow/buffer.h"
 #include "arrow/compute/expression.h"
@@ -141,6 +143,27 @@ class ARROW_ACERO_EXPORT NullSinkNodeConsumer : public SinkNodeConsumer {
   }
 };
 
+/// \brief The scope of a traced call of a node, see TracedNode
+///
+/// Ends the tracing span of the call, and records the time spent in it to the node's
+/// profile if the query is profiled.
+class ARROW_ACERO_EXPORT TracedScope {
+ public:
+  ~TracedScope();
+
+  TracedScope(const TracedScope&) = delete;
+  TracedScope& operator=(const TracedScope&) = delete;
+
+ private:
+  TracedScope(std::unique_ptr<::arrow::internal::tracing::Scope> span,
+              NodeProfile* profile);
+
+  std::unique_ptr<::arrow::internal::tracing::Scope> span_;
+  NodeProfileScope profile_;
+
+  friend class TracedNode;
+};
+
 /// CRTP helper for tracing helper functions
 
 class ARROW_ACERO_EXPORT TracedNode {
@@ -161,22 +184,30 @@ class ARROW_ACERO_EXPORT TracedNode {
   // All nodes should call TraceInputReceived for each batch they receive.  This call
   // should track the time spent processing the batch.  NoteInputReceived is available
   // but usually won't be used unless a node is simply adding batches to a trivial queue.
+  //
+  // When the query is profiled, the batch is also counted as input of this node and as
+  // output of `input`.  The overloads without `input` are for nodes with one input.
 
   // Create a span to record the InputReceived work
-  [[nodiscard]] ::arrow::internal::tracing::Scope TraceInputReceived(
-      const ExecBatch& batch) const;
+  [[nodiscard]] TracedScope TraceInputReceived(const ExecBatch& batch) const;
+  [[nodiscard]] TracedScope TraceInputReceived(const ExecNode* input,
+                                               const ExecBatch& batch) const;
 
   // Record a call to InputReceived without creating with a span
   void NoteInputReceived(const ExecBatch& batch) const;
+  void NoteInputReceived(const ExecNode* input, const ExecBatch& batch) const;
 
   // Create a span to record any "finish" work.  This should NOT be called as part of
   // InputFinished and many nodes may not need to call this at all.  This should be used
   // when a node has some extra work that has to be done once it has received all of its
   // data.  For example, an aggregation node calculating aggregations.  This will
   // typically be called as a result of InputFinished OR InputReceived.
-  [[nodiscard]] ::arrow::internal::tracing::Scope TraceFinish() const;
+  [[nodiscard]] TracedScope TraceFinish() const;
 
  private:
+  const ExecNode* SoleInput() const;
+  void RecordInputReceived(const ExecNode* input, const ExecBatch& batch) const;
+
   ExecNode* node_;
 };
 
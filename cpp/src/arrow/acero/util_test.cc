@@ -321,5 +321,44 @@ TEST(BackpressureConcurrentQueue, BackpressureTestStayUnpaused) {
   ASSERT_FALSE(dummy_node.paused);
 }
 
+TEST(BackpressureConcurrentQueue, BackpressureBytesTest) {
+  BackpressureTestExecNode dummy_node;
+  auto ctrl = std::make_unique<TestBackpressureControl>(&dummy_node);
+  ASSERT_OK_AND_ASSIGN(
+      auto handler,
+      BackpressureHandler::Make(/*low_threshold=*/2, /*high_threshold=*/100,
+                                std::move(ctrl), /*low_bytes_threshold=*/10,
+                                /*high_bytes_threshold=*/20));
+  // Each item weighs its value in bytes
+  BackpressureConcurrentQueue<int> queue(
+      std::move(handler), [](const int& item) { return static_cast<uint64_t>(item); });
+
+  queue.Push(15);
+  ASSERT_FALSE(dummy_node.paused);
+  queue.Push(6);
+  ASSERT_TRUE(dummy_node.paused);
+  queue.Push(1);
+  ASSERT_EQ(queue.TryPop(), std::make_optional(15));
+  // Back below both the low item and byte thresholds
+  ASSERT_FALSE(dummy_node.paused);
+  queue.Push(14);
+  ASSERT_TRUE(dummy_node.paused);
+  ASSERT_EQ(queue.TryPop(), std::make_optional(6));
+  // 2 items holding 15 bytes, still above the low byte threshold
+  ASSERT_TRUE(dummy_node.paused);
+  ASSERT_EQ(queue.TryPop(), std::make_optional(1));
+  ASSERT_TRUE(dummy_node.paused);
+  ASSERT_EQ(queue.TryPop(), std::make_optional(14));
+  ASSERT_FALSE(dummy_node.paused);
+  ASSERT_FALSE(dummy_node.stopped);
+}
+
+TEST(BackpressureHandler, InvalidBytesThresholds) {
+  BackpressureTestExecNode dummy_node;
+  ASSERT_RAISES(Invalid, BackpressureHandler::Make(
+                             2, 4, std::make_unique<TestBackpressureControl>(&dummy_node),
+                             /*low_bytes_threshold=*/20, /*high_bytes_threshold=*/10));
+}
+
 }  // namespace acero
 }  // namespace arrow
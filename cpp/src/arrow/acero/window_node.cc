@@ -0,0 +1,625 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "arrow/acero/accumulation_queue.h"
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/exec_plan_internal.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/order_by_impl.h"
+#include "arrow/acero/query_context.h"
+#include "arrow/acero/util.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/expression.h"
+#include "arrow/compute/row/grouper.h"
+#include "arrow/result.h"
+#include "arrow/table.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging_internal.h"
+#include "arrow/util/tracing_internal.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+using compute::ExecSpan;
+using compute::FunctionOptions;
+using compute::RowSegmenter;
+using compute::Segment;
+using compute::SortKey;
+using compute::TakeOptions;
+
+namespace acero {
+namespace {
+
+enum class WindowKind { kRowNumber, kRank, kDenseRank, kLag, kLead, kVector };
+
+// A WindowFunction resolved against the input schema
+struct BoundWindowFunction {
+  WindowKind kind;
+  std::string function;
+  std::shared_ptr<FunctionOptions> options;
+  // Index of the target field, -1 for the ranking functions
+  int target = -1;
+  int64_t offset = 1;
+  std::shared_ptr<DataType> type;
+};
+
+Result<BoundWindowFunction> BindWindowFunction(const WindowFunction& window_function,
+                                               const Schema& input_schema) {
+  BoundWindowFunction bound;
+  bound.function = window_function.function;
+  bound.options = window_function.options;
+  bound.offset = window_function.offset;
+  const std::string& name = window_function.function;
+  if (name == "row_number") {
+    bound.kind = WindowKind::kRowNumber;
+  } else if (name == "rank") {
+    bound.kind = WindowKind::kRank;
+  } else if (name == "dense_rank") {
+    bound.kind = WindowKind::kDenseRank;
+  } else if (name == "lag") {
+    bound.kind = WindowKind::kLag;
+  } else if (name == "lead") {
+    bound.kind = WindowKind::kLead;
+  } else {
+    bound.kind = WindowKind::kVector;
+  }
+
+  const bool is_ranking = bound.kind == WindowKind::kRowNumber ||
+                          bound.kind == WindowKind::kRank ||
+                          bound.kind == WindowKind::kDenseRank;
+  if (is_ranking) {
+    if (!window_function.target.empty()) {
+      return Status::Invalid("Window function '", name, "' does not take a target");
+    }
+    bound.type = int64();
+    return bound;
+  }
+
+  if (window_function.target.size() != 1) {
+    return Status::Invalid("Window function '", name, "' requires exactly one target");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto match, window_function.target[0].FindOne(input_schema));
+  bound.target = match[0];
+  const auto& target_type = input_schema.field(bound.target)->type();
+  if (bound.kind == WindowKind::kLag || bound.kind == WindowKind::kLead) {
+    if (bound.offset < 0) {
+      return Status::Invalid("Window function '", name,
+                             "' requires a non-negative offset, got ", bound.offset);
+    }
+    bound.type = target_type;
+    return bound;
+  }
+
+  // Resolve the output type of the vector function
+  ARROW_ASSIGN_OR_RAISE(
+      compute::Expression bound_call,
+      compute::call(name, {compute::field_ref(window_function.target[0])},
+                    window_function.options)
+          .Bind(input_schema));
+  bound.type = bound_call.type()->GetSharedPtr();
+  return bound;
+}
+
+// Resolve sort keys to field indices
+Result<std::vector<int>> SortKeyFieldIds(const std::vector<SortKey>& sort_keys,
+                                         const Schema& input_schema) {
+  std::vector<int> field_ids;
+  for (const auto& sort_key : sort_keys) {
+    ARROW_ASSIGN_OR_RAISE(auto match, sort_key.target.FindOne(input_schema));
+    field_ids.push_back(match[0]);
+  }
+  return field_ids;
+}
+
+// Whether `input_ordering` starts with the partition keys, in any order and direction,
+// followed by the keys of `ordering`.  If so, each partition is a contiguous run of
+// rows that is already in window order.
+bool IsOrderedForWindow(const Ordering& input_ordering, const Schema& input_schema,
+                        const std::vector<int>& partition_key_ids,
+                        const Ordering& ordering) {
+  if (input_ordering.is_unordered()) {
+    return false;
+  }
+  const std::vector<SortKey>& input_keys = input_ordering.sort_keys();
+  const std::vector<SortKey>& order_keys = ordering.sort_keys();
+  const size_t num_partition_keys = partition_key_ids.size();
+  if (input_keys.size() < num_partition_keys + order_keys.size()) {
+    return false;
+  }
+  std::unordered_set<int> remaining(partition_key_ids.begin(), partition_key_ids.end());
+  for (size_t i = 0; i < num_partition_keys; ++i) {
+    auto match = input_keys[i].target.FindOne(input_schema);
+    if (!match.ok() || remaining.erase((*match)[0]) == 0) {
+      return false;
+    }
+  }
+  if (!remaining.empty()) {
+    return false;
+  }
+  for (size_t i = 0; i < order_keys.size(); ++i) {
+    const SortKey& input_key = input_keys[num_partition_keys + i];
+    auto input_match = input_key.target.FindOne(input_schema);
+    auto match = order_keys[i].target.FindOne(input_schema);
+    if (!input_match.ok() || !match.ok() || !(*input_match == *match) ||
+        input_key.order != order_keys[i].order) {
+      return false;
+    }
+  }
+  return order_keys.empty() ||
+         input_ordering.null_placement() == ordering.null_placement();
+}
+
+// Split a batch into runs of equal keys
+Result<std::vector<Segment>> FindSegments(const ExecBatch& batch,
+                                          const std::vector<int>& key_ids,
+                                          ExecContext* ctx) {
+  std::vector<TypeHolder> key_types;
+  for (int key_id : key_ids) {
+    key_types.emplace_back(batch[key_id].type());
+  }
+  ARROW_ASSIGN_OR_RAISE(std::unique_ptr<RowSegmenter> segmenter,
+                        RowSegmenter::Make(key_types, /*nullable_keys=*/true, ctx));
+  ARROW_ASSIGN_OR_RAISE(ExecBatch key_batch, batch.SelectValues(key_ids));
+  return segmenter->GetSegments(ExecSpan(key_batch));
+}
+
+class WindowNode : public ExecNode,
+                   public TracedNode,
+                   public util::SerialSequencingQueue::Processor {
+ public:
+  WindowNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+             std::shared_ptr<Schema> output_schema, std::vector<int> partition_key_ids,
+             std::vector<int> peer_key_ids, std::vector<BoundWindowFunction> functions,
+             Ordering output_ordering, std::unique_ptr<OrderByImpl> sort_impl,
+             std::unique_ptr<RowSegmenter> partition_segmenter)
+      : ExecNode(plan, std::move(inputs), {"input"}, std::move(output_schema)),
+        TracedNode(this),
+        partition_key_ids_(std::move(partition_key_ids)),
+        peer_key_ids_(std::move(peer_key_ids)),
+        functions_(std::move(functions)),
+        output_ordering_(std::move(output_ordering)),
+        sort_impl_(std::move(sort_impl)),
+        partition_segmenter_(std::move(partition_segmenter)) {}
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "WindowNode"));
+
+    const auto& window_options = checked_cast<const WindowNodeOptions&>(options);
+    const auto& input_schema = inputs[0]->output_schema();
+    ExecContext* exec_ctx = plan->query_context()->exec_context();
+
+    std::vector<int> partition_key_ids;
+    std::vector<SortKey> sort_keys;
+    for (const auto& partition_key : window_options.partition_keys) {
+      ARROW_ASSIGN_OR_RAISE(auto match, partition_key.FindOne(*input_schema));
+      partition_key_ids.push_back(match[0]);
+      sort_keys.emplace_back(partition_key);
+    }
+    const Ordering& ordering = window_options.ordering;
+    ARROW_ASSIGN_OR_RAISE(std::vector<int> order_key_ids,
+                          SortKeyFieldIds(ordering.sort_keys(), *input_schema));
+    sort_keys.insert(sort_keys.end(), ordering.sort_keys().begin(),
+                     ordering.sort_keys().end());
+
+    // Rows are peers (for rank and dense_rank) if they agree on all of these
+    std::vector<int> peer_key_ids = partition_key_ids;
+    peer_key_ids.insert(peer_key_ids.end(), order_key_ids.begin(), order_key_ids.end());
+
+    FieldVector output_fields = input_schema->fields();
+    std::vector<BoundWindowFunction> functions;
+    for (const auto& window_function : window_options.functions) {
+      ARROW_ASSIGN_OR_RAISE(BoundWindowFunction bound,
+                            BindWindowFunction(window_function, *input_schema));
+      const std::string& name = window_function.name.empty() ? window_function.function
+                                                             : window_function.name;
+      output_fields.push_back(field(name, bound.type));
+      functions.push_back(std::move(bound));
+    }
+
+    const Ordering& input_ordering = inputs[0]->ordering();
+    Ordering output_ordering = input_ordering;
+    std::unique_ptr<OrderByImpl> sort_impl;
+    std::unique_ptr<RowSegmenter> partition_segmenter;
+    if (IsOrderedForWindow(input_ordering, *input_schema, partition_key_ids, ordering)) {
+      std::vector<TypeHolder> key_types;
+      for (int key_id : partition_key_ids) {
+        key_types.emplace_back(input_schema->field(key_id)->type().get());
+      }
+      ARROW_ASSIGN_OR_RAISE(partition_segmenter,
+                            RowSegmenter::Make(key_types, /*nullable_keys=*/true,
+                                               exec_ctx));
+    } else if (!sort_keys.empty()) {
+      SortOptions sort_options(sort_keys, ordering.null_placement());
+      ARROW_ASSIGN_OR_RAISE(sort_impl,
+                            OrderByImpl::MakeSort(exec_ctx, input_schema, sort_options));
+      output_ordering = Ordering(sort_keys, ordering.null_placement());
+    } else {
+      // Neither partitioned nor ordered, the rows are taken in arrival order
+      output_ordering = Ordering::Unordered();
+    }
+
+    return plan->EmplaceNode<WindowNode>(
+        plan, std::move(inputs), schema(std::move(output_fields)),
+        std::move(partition_key_ids), std::move(peer_key_ids), std::move(functions),
+        std::move(output_ordering), std::move(sort_impl),
+        std::move(partition_segmenter));
+  }
+
+  const char* kind_name() const override { return "WindowNode"; }
+
+  const Ordering& ordering() const override { return output_ordering_; }
+
+  Status StartProducing() override {
+    NoteStartProducing(ToStringExtra());
+    if (partition_segmenter_) {
+      sequencer_ = util::SerialSequencingQueue::Make(this);
+    }
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->PauseProducing(this, counter);
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->ResumeProducing(this, counter);
+  }
+
+  Status StopProducingImpl() override { return Status::OK(); }
+
+  Status InputReceived(ExecNode* input, ExecBatch batch) override {
+    auto scope = TraceInputReceived(batch);
+    DCHECK_EQ(input, inputs_[0]);
+
+    if (sequencer_) {
+      // Process counts the batch once it has been handled
+      return sequencer_->InsertBatch(std::move(batch));
+    }
+
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch,
+                          batch.ToRecordBatch(inputs_[0]->output_schema()));
+    if (sort_impl_) {
+      RETURN_NOT_OK(sort_impl_->InputReceived(record_batch));
+    } else {
+      std::lock_guard<std::mutex> lk(mutex_);
+      accumulated_.push_back(std::move(record_batch));
+    }
+    if (counter_.Increment()) {
+      return DoFinish();
+    }
+    return Status::OK();
+  }
+
+  Status InputFinished(ExecNode* input, int total_batches) override {
+    DCHECK_EQ(input, inputs_[0]);
+    EVENT_ON_CURRENT_SPAN("InputFinished", {{"batches.length", total_batches}});
+    if (counter_.SetTotal(total_batches)) {
+      return DoFinish();
+    }
+    return Status::OK();
+  }
+
+  // Streaming mode: the input arrives in window order, one batch at a time
+  Status Process(ExecBatch batch) override {
+    if (batch.length > 0) {
+      ARROW_ASSIGN_OR_RAISE(ExecBatch key_batch,
+                            batch.SelectValues(partition_key_ids_));
+      ARROW_ASSIGN_OR_RAISE(std::vector<Segment> segments,
+                            partition_segmenter_->GetSegments(ExecSpan(key_batch)));
+      // Every partition before the last one of this batch is complete, including the
+      // pending partition unless this batch continues it
+      const Segment& last = segments.back();
+      if (segments.size() > 1 || !last.extends) {
+        if (last.offset > 0) {
+          pending_.push_back(batch.Slice(0, last.offset));
+        }
+        RETURN_NOT_OK(FlushPending());
+      }
+      pending_.push_back(batch.Slice(last.offset, last.length));
+    }
+    if (counter_.Increment()) {
+      return DoFinish();
+    }
+    return Status::OK();
+  }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    std::stringstream ss;
+    const auto& input_schema = inputs_[0]->output_schema();
+    ss << "partition_keys=[";
+    for (size_t i = 0; i < partition_key_ids_.size(); ++i) {
+      if (i > 0) ss << ", ";
+      ss << '"' << input_schema->field(partition_key_ids_[i])->name() << '"';
+    }
+    ss << "], functions=[";
+    for (size_t i = 0; i < functions_.size(); ++i) {
+      if (i > 0) ss << ", ";
+      ss << functions_[i].function;
+    }
+    ss << "], streaming=" << (partition_segmenter_ != nullptr);
+    return ss.str();
+  }
+
+ private:
+  Status DoFinish() {
+    if (partition_segmenter_) {
+      RETURN_NOT_OK(FlushPending());
+    } else {
+      std::shared_ptr<Table> table;
+      if (sort_impl_) {
+        ARROW_ASSIGN_OR_RAISE(Datum sorted, sort_impl_->DoFinish());
+        table = sorted.table();
+      } else {
+        std::lock_guard<std::mutex> lk(mutex_);
+        ARROW_ASSIGN_OR_RAISE(table, Table::FromRecordBatches(inputs_[0]->output_schema(),
+                                                              std::move(accumulated_)));
+      }
+      if (table->num_rows() > 0) {
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> combined,
+                              table->CombineChunksToBatch(pool()));
+        table.reset();
+        RETURN_NOT_OK(EmitPartitions(ExecBatch(*combined)));
+      }
+    }
+    return output_->InputFinished(this, num_output_batches_);
+  }
+
+  // Compute and output the pending rows, which form complete partitions
+  Status FlushPending() {
+    if (pending_.empty()) {
+      return Status::OK();
+    }
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    for (const auto& batch : pending_) {
+      if (batch.length > 0) {
+        ARROW_ASSIGN_OR_RAISE(auto record_batch,
+                              batch.ToRecordBatch(inputs_[0]->output_schema(), pool()));
+        batches.push_back(std::move(record_batch));
+      }
+    }
+    pending_.clear();
+    if (batches.empty()) {
+      return Status::OK();
+    }
+    std::shared_ptr<RecordBatch> combined;
+    if (batches.size() == 1) {
+      combined = std::move(batches[0]);
+    } else {
+      ARROW_ASSIGN_OR_RAISE(
+          auto table, Table::FromRecordBatches(inputs_[0]->output_schema(), batches));
+      ARROW_ASSIGN_OR_RAISE(combined, table->CombineChunksToBatch(pool()));
+    }
+    return EmitPartitions(ExecBatch(*combined));
+  }
+
+  // Schedule the computation of `rows`, which are in window order and form complete
+  // partitions.  Partitions are grouped into tasks of at least one output batch worth
+  // of rows, which are computed in parallel.
+  Status EmitPartitions(ExecBatch rows) {
+    ARROW_ASSIGN_OR_RAISE(std::vector<Segment> partitions,
+                          FindSegments(rows, partition_key_ids_, exec_context()));
+    int64_t task_begin = 0;
+    std::vector<Segment> task_partitions;
+    for (const Segment& partition : partitions) {
+      task_partitions.push_back(Segment{partition.offset - task_begin, partition.length,
+                                        /*is_open=*/false, /*extends=*/false});
+      const int64_t task_end = partition.offset + partition.length;
+      if (task_end - task_begin >= ExecPlan::kMaxBatchSize || task_end == rows.length) {
+        ScheduleCompute(rows.Slice(task_begin, task_end - task_begin),
+                     std::move(task_partitions));
+        task_partitions.clear();
+        task_begin = task_end;
+      }
+    }
+    return Status::OK();
+  }
+
+  void ScheduleCompute(ExecBatch rows, std::vector<Segment> partitions) {
+    const int first_index = num_output_batches_;
+    num_output_batches_ +=
+        static_cast<int>(bit_util::CeilDiv(rows.length, ExecPlan::kMaxBatchSize));
+    plan_->query_context()->ScheduleTask(
+        [this, rows = std::move(rows), partitions = std::move(partitions),
+         first_index]() -> Status {
+          ARROW_ASSIGN_OR_RAISE(ExecBatch out, ComputeWindows(rows, partitions));
+          int index = first_index;
+          for (int64_t offset = 0; offset < out.length;
+               offset += ExecPlan::kMaxBatchSize) {
+            ExecBatch out_batch = out.Slice(offset, ExecPlan::kMaxBatchSize);
+            out_batch.index = index++;
+            RETURN_NOT_OK(output_->InputReceived(this, std::move(out_batch)));
+          }
+          return Status::OK();
+        },
+        "WindowNode::ComputeWindows");
+  }
+
+  Result<ExecBatch> ComputeWindows(const ExecBatch& rows,
+                                   const std::vector<Segment>& partitions) {
+    std::vector<Segment> peers;
+    for (const auto& function : functions_) {
+      if (function.kind == WindowKind::kRank || function.kind == WindowKind::kDenseRank) {
+        ARROW_ASSIGN_OR_RAISE(peers, FindSegments(rows, peer_key_ids_, exec_context()));
+        break;
+      }
+    }
+
+    ExecBatch out = rows;
+    for (const auto& function : functions_) {
+      Datum column;
+      switch (function.kind) {
+        case WindowKind::kRowNumber: {
+          ARROW_ASSIGN_OR_RAISE(column, RowNumber(rows.length, partitions));
+          break;
+        }
+        case WindowKind::kRank:
+        case WindowKind::kDenseRank: {
+          ARROW_ASSIGN_OR_RAISE(
+              column, Rank(rows.length, partitions, peers,
+                           /*dense=*/function.kind == WindowKind::kDenseRank));
+          break;
+        }
+        case WindowKind::kLag:
+        case WindowKind::kLead: {
+          ARROW_ASSIGN_OR_RAISE(column, Shift(rows, partitions, function));
+          break;
+        }
+        case WindowKind::kVector: {
+          ARROW_ASSIGN_OR_RAISE(column, CallPerPartition(rows, partitions, function));
+          break;
+        }
+      }
+      out.values.push_back(std::move(column));
+    }
+    return out;
+  }
+
+  Result<Datum> RowNumber(int64_t length, const std::vector<Segment>& partitions) {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer,
+                          AllocateBuffer(length * sizeof(int64_t), pool()));
+    auto* values = buffer->mutable_data_as<int64_t>();
+    for (const Segment& partition : partitions) {
+      for (int64_t i = 0; i < partition.length; ++i) {
+        values[partition.offset + i] = i + 1;
+      }
+    }
+    return ArrayData::Make(int64(), length, {nullptr, std::move(buffer)},
+                           /*null_count=*/0);
+  }
+
+  // Peers never straddle partitions since the peer keys include the partition keys
+  Result<Datum> Rank(int64_t length, const std::vector<Segment>& partitions,
+                     const std::vector<Segment>& peers, bool dense) {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer,
+                          AllocateBuffer(length * sizeof(int64_t), pool()));
+    auto* values = buffer->mutable_data_as<int64_t>();
+    size_t next_partition = 0;
+    int64_t partition_offset = 0;
+    int64_t dense_rank = 0;
+    for (const Segment& peer : peers) {
+      if (next_partition < partitions.size() &&
+          partitions[next_partition].offset <= peer.offset) {
+        partition_offset = partitions[next_partition].offset;
+        dense_rank = 0;
+        ++next_partition;
+      }
+      ++dense_rank;
+      const int64_t rank = dense ? dense_rank : peer.offset - partition_offset + 1;
+      std::fill(values + peer.offset, values + peer.offset + peer.length, rank);
+    }
+    return ArrayData::Make(int64(), length, {nullptr, std::move(buffer)},
+                           /*null_count=*/0);
+  }
+
+  // lag and lead are a take with indices that are null outside of the partition
+  Result<Datum> Shift(const ExecBatch& rows, const std::vector<Segment>& partitions,
+                      const BoundWindowFunction& function) {
+    const int64_t shift =
+        function.kind == WindowKind::kLag ? -function.offset : function.offset;
+    Int64Builder indices(pool());
+    RETURN_NOT_OK(indices.Reserve(rows.length));
+    for (const Segment& partition : partitions) {
+      const int64_t end = partition.offset + partition.length;
+      for (int64_t i = partition.offset; i < end; ++i) {
+        const int64_t source = i + shift;
+        if (source >= partition.offset && source < end) {
+          indices.UnsafeAppend(source);
+        } else {
+          indices.UnsafeAppendNull();
+        }
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> indices_array, indices.Finish());
+    return compute::Take(rows[function.target], indices_array,
+                         TakeOptions::NoBoundsCheck(), exec_context());
+  }
+
+  Result<Datum> CallPerPartition(const ExecBatch& rows,
+                                 const std::vector<Segment>& partitions,
+                                 const BoundWindowFunction& function) {
+    std::shared_ptr<Array> target = rows[function.target].make_array();
+    ArrayVector results;
+    for (const Segment& partition : partitions) {
+      ARROW_ASSIGN_OR_RAISE(
+          Datum result,
+          compute::CallFunction(function.function,
+                                {target->Slice(partition.offset, partition.length)},
+                                function.options.get(), exec_context()));
+      if (!result.is_array() || result.length() != partition.length) {
+        return Status::Invalid("Window function '", function.function,
+                               "' must return one value per row");
+      }
+      results.push_back(result.make_array());
+    }
+    if (results.size() == 1) {
+      return results[0];
+    }
+    return Concatenate(results, pool());
+  }
+
+  ExecContext* exec_context() const { return plan_->query_context()->exec_context(); }
+  MemoryPool* pool() const { return plan_->query_context()->memory_pool(); }
+
+  const std::vector<int> partition_key_ids_;
+  const std::vector<int> peer_key_ids_;
+  const std::vector<BoundWindowFunction> functions_;
+  const Ordering output_ordering_;
+
+  AtomicCounter counter_;
+  int num_output_batches_ = 0;
+
+  // Materializing mode: all input is accumulated (and sorted if there are keys)
+  std::unique_ptr<OrderByImpl> sort_impl_;
+  std::vector<std::shared_ptr<RecordBatch>> accumulated_;
+  std::mutex mutex_;
+
+  // Streaming mode: the input is delivered in order and split on the partition keys,
+  // only the rows of the last, possibly incomplete, partition are held
+  std::unique_ptr<RowSegmenter> partition_segmenter_;
+  std::unique_ptr<util::SerialSequencingQueue> sequencer_;
+  std::vector<ExecBatch> pending_;
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterWindowNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(
+      registry->AddFactory(std::string(WindowNodeOptions::kName), WindowNode::Make));
+}
+
+}  // namespace internal
+}  // namespace acero
+}  // namespace arrow
@@ -0,0 +1,139 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <gmock/gmock-matchers.h>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/test_util_internal.h"
+#include "arrow/compute/test_util_internal.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+
+using compute::ExecBatchFromJSON;
+using compute::SortKey;
+
+namespace acero {
+
+std::shared_ptr<Schema> InputSchema() {
+  return schema({field("part", utf8()), field("ord", int32()), field("val", int64())});
+}
+
+std::vector<WindowFunction> TestWindowFunctions() {
+  WindowFunction lead("lead", FieldRef("val"), "next2");
+  lead.offset = 2;
+  return {WindowFunction("row_number", "row_number"),
+          WindowFunction("rank", "rank"),
+          WindowFunction("dense_rank", "dense_rank"),
+          WindowFunction("lag", FieldRef("val"), "prev"),
+          lead,
+          WindowFunction("cumulative_sum", FieldRef("val"), "running_sum")};
+}
+
+// Tied rows are identical so that the expected output does not depend on the order in
+// which they are emitted
+std::shared_ptr<Table> ExpectedTable() {
+  auto out_schema = schema({field("part", utf8()), field("ord", int32()),
+                            field("val", int64()), field("row_number", int64()),
+                            field("rank", int64()), field("dense_rank", int64()),
+                            field("prev", int64()), field("next2", int64()),
+                            field("running_sum", int64())});
+  return TableFromJSON(out_schema, {R"([
+    ["a", 1, 10, 1, 1, 1, null, 20, 10],
+    ["a", 2, 20, 2, 2, 2, 10, 30, 30],
+    ["a", 2, 20, 3, 2, 2, 20, null, 50],
+    ["a", 3, 30, 4, 4, 3, 20, null, 80],
+    ["b", 1, 10, 1, 1, 1, null, 40, 10],
+    ["b", 1, 10, 2, 1, 1, 10, null, 20],
+    ["b", 2, 40, 3, 3, 2, 10, null, 60]
+  ])"});
+}
+
+void CheckWindow(const Declaration& plan) {
+  std::shared_ptr<Table> expected = ExpectedTable();
+  for (bool use_threads : {false, true}) {
+    SCOPED_TRACE(use_threads ? "parallel" : "serial");
+    QueryOptions query_options;
+    query_options.sequence_output = true;
+    query_options.use_threads = use_threads;
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                         DeclarationToTable(plan, query_options));
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+}
+
+TEST(WindowNode, Unsorted) {
+  std::shared_ptr<Table> input = TableFromJSON(InputSchema(), {R"([
+    ["a", 3, 30],
+    ["b", 1, 10],
+    ["a", 1, 10]
+  ])",
+                                                               R"([
+    ["a", 2, 20],
+    ["b", 1, 10],
+    ["a", 2, 20],
+    ["b", 2, 40]
+  ])"});
+  Declaration plan = Declaration::Sequence(
+      {{"table_source", TableSourceNodeOptions(input, /*max_batch_size=*/2)},
+       {"window", WindowNodeOptions(TestWindowFunctions(), /*partition_keys=*/{"part"},
+                                    Ordering({SortKey("ord")}))}});
+  CheckWindow(plan);
+}
+
+TEST(WindowNode, Streaming) {
+  // Partitions span batches
+  BatchesWithSchema input;
+  input.schema = InputSchema();
+  input.batches = {
+      ExecBatchFromJSON({utf8(), int32(), int64()},
+                        R"([["a", 1, 10], ["a", 2, 20], ["a", 2, 20]])"),
+      ExecBatchFromJSON({utf8(), int32(), int64()}, R"([["a", 3, 30], ["b", 1, 10]])"),
+      ExecBatchFromJSON({utf8(), int32(), int64()}, R"([["b", 1, 10], ["b", 2, 40]])")};
+  for (bool parallel : {false, true}) {
+    Declaration plan = Declaration::Sequence(
+        {{"source", SourceNodeOptions(input.schema, input.gen(parallel, /*slow=*/false),
+                                      Ordering({SortKey("part"), SortKey("ord")}))},
+         {"window", WindowNodeOptions(TestWindowFunctions(), /*partition_keys=*/{"part"},
+                                      Ordering({SortKey("ord")}))}});
+    CheckWindow(plan);
+  }
+}
+
+TEST(WindowNode, Invalid) {
+  std::shared_ptr<Table> input = TableFromJSON(InputSchema(), {R"([["a", 1, 10]])"});
+  auto check_invalid = [&](WindowFunction window_function, const std::string& message) {
+    Declaration plan = Declaration::Sequence(
+        {{"table_source", TableSourceNodeOptions(input)},
+         {"window", WindowNodeOptions({std::move(window_function)})}});
+    EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, testing::HasSubstr(message),
+                                    DeclarationToStatus(std::move(plan)));
+  };
+  check_invalid(WindowFunction("rank", FieldRef("val"), "rank"),
+                "does not take a target");
+  check_invalid(WindowFunction("lag", "lag"), "requires exactly one target");
+  WindowFunction lag("lag", FieldRef("val"), "lag");
+  lag.offset = -1;
+  check_invalid(lag, "requires a non-negative offset");
+}
+
+}  // namespace acero
+}  // namespace arrow
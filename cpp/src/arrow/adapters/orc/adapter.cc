@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <list>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -33,6 +34,7 @@
 #include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/table_builder.h"
@@ -211,9 +213,13 @@ class ORCFileReader::Impl {
   Impl() {}
   ~Impl() {}
 
-  Status Open(const std::shared_ptr<io::RandomAccessFile>& file, MemoryPool* pool) {
+  Status Open(const std::shared_ptr<io::RandomAccessFile>& file, MemoryPool* pool,
+              const std::string& serialized_file_tail = "") {
     std::unique_ptr<ArrowInputFile> io_wrapper(new ArrowInputFile(file));
     liborc::ReaderOptions options;
+    if (!serialized_file_tail.empty()) {
+      options.setSerializedFileTail(serialized_file_tail);
+    }
     std::unique_ptr<liborc::Reader> liborc_reader;
     ORC_CATCH_NOT_OK(liborc_reader = createReader(std::move(io_wrapper), options));
     pool_ = pool;
@@ -247,6 +253,82 @@ class ORCFileReader::Impl {
     return stripes_[static_cast<size_t>(stripe)];
   }
 
+  Result<std::optional<StripeColumnStatistics>> GetStripeColumnStatistics(
+      int64_t stripe, int field_index) {
+    ARROW_RETURN_IF(stripe < 0 || stripe >= NumberOfStripes(),
+                    Status::Invalid("Out of bounds stripe: ", stripe));
+    const liborc::Type& type = reader_->getType();
+    ARROW_RETURN_IF(
+        field_index < 0 || static_cast<uint64_t>(field_index) >= type.getSubtypeCount(),
+        Status::Invalid("Out of bounds field index: ", field_index));
+    if (stripe >= GetNumberOfStripeStatistics()) {
+      return std::nullopt;
+    }
+
+    const liborc::Type* field_type = type.getSubtype(field_index);
+    StripeColumnStatistics out{true, 0, nullptr, nullptr};
+    ORC_BEGIN_CATCH_NOT_OK
+    // Fetching stripe statistics also reads the stripe's row index, so keep them
+    // around while the fields of the same stripe are queried
+    if (stripe != stripe_statistics_index_) {
+      stripe_statistics_ = reader_->getStripeStatistics(static_cast<uint64_t>(stripe));
+      stripe_statistics_index_ = stripe;
+    }
+    const liborc::ColumnStatistics* stats = stripe_statistics_->getColumnStatistics(
+        static_cast<uint32_t>(field_type->getColumnId()));
+    out.has_null = stats->hasNull();
+    out.num_values = static_cast<int64_t>(stats->getNumberOfValues());
+
+    switch (field_type->getKind()) {
+      case liborc::BYTE:
+      case liborc::SHORT:
+      case liborc::INT:
+      case liborc::LONG: {
+        auto int_stats = dynamic_cast<const liborc::IntegerColumnStatistics*>(stats);
+        if (int_stats && int_stats->hasMinimum() && int_stats->hasMaximum()) {
+          out.min = std::make_shared<Int64Scalar>(int_stats->getMinimum());
+          out.max = std::make_shared<Int64Scalar>(int_stats->getMaximum());
+        }
+        break;
+      }
+      case liborc::FLOAT:
+      case liborc::DOUBLE: {
+        auto double_stats = dynamic_cast<const liborc::DoubleColumnStatistics*>(stats);
+        if (double_stats && double_stats->hasMinimum() && double_stats->hasMaximum()) {
+          out.min = std::make_shared<DoubleScalar>(double_stats->getMinimum());
+          out.max = std::make_shared<DoubleScalar>(double_stats->getMaximum());
+        }
+        break;
+      }
+      case liborc::STRING:
+      case liborc::VARCHAR: {
+        // Writers older than HIVE-8732 computed string minimums and maximums
+        // with a signed byte comparison
+        if (reader_->getWriterVersion() < liborc::WriterVersion_HIVE_8732) {
+          break;
+        }
+        auto string_stats = dynamic_cast<const liborc::StringColumnStatistics*>(stats);
+        if (string_stats && string_stats->hasMinimum() && string_stats->hasMaximum()) {
+          out.min = std::make_shared<StringScalar>(string_stats->getMinimum());
+          out.max = std::make_shared<StringScalar>(string_stats->getMaximum());
+        }
+        break;
+      }
+      case liborc::DATE: {
+        auto date_stats = dynamic_cast<const liborc::DateColumnStatistics*>(stats);
+        if (date_stats && date_stats->hasMinimum() && date_stats->hasMaximum()) {
+          out.min = std::make_shared<Date32Scalar>(date_stats->getMinimum());
+          out.max = std::make_shared<Date32Scalar>(date_stats->getMaximum());
+        }
+        break;
+      }
+      default:
+        break;
+    }
+    ORC_END_CATCH_NOT_OK
+    return out;
+  }
+
   FileVersion GetFileVersion() {
     liborc::FileVersion orc_file_version = reader_->getFormatVersion();
     return FileVersion(orc_file_version.getMajor(), orc_file_version.getMinor());
@@ -551,6 +633,8 @@ class ORCFileReader::Impl {
  private:
   MemoryPool* pool_;
   std::unique_ptr<liborc::Reader> reader_;
+  std::unique_ptr<liborc::StripeStatistics> stripe_statistics_;
+  int64_t stripe_statistics_index_ = -1;
   std::vector<StripeInformation> stripes_;
   int64_t current_row_;
 };
@@ -569,6 +653,17 @@ Result<std::unique_ptr<ORCFileReader>> ORCFileReader::Open(
   return result;
 }
 
+Result<std::unique_ptr<ORCFileReader>> ORCFileReader::Open(
+    const std::shared_ptr<io::RandomAccessFile>& file, MemoryPool* pool,
+    const std::string& serialized_file_tail) {
+#ifdef ARROW_ORC_NEED_TIME_ZONE_DATABASE_CHECK
+  RETURN_NOT_OK(CheckTimeZoneDatabaseAvailability());
+#endif
+  auto result = std::unique_ptr<ORCFileReader>(new ORCFileReader());
+  RETURN_NOT_OK(result->impl_->Open(file, pool, serialized_file_tail));
+  return result;
+}
+
 Result<std::shared_ptr<const KeyValueMetadata>> ORCFileReader::ReadMetadata() {
   return impl_->ReadMetadata();
 }
@@ -638,6 +733,11 @@ StripeInformation ORCFileReader::GetStripeInformation(int64_t stripe) {
   return impl_->GetStripeInformation(stripe);
 }
 
+Result<std::optional<StripeColumnStatistics>> ORCFileReader::GetStripeColumnStatistics(
+    int64_t stripe, int field_index) {
+  return impl_->GetStripeColumnStatistics(stripe, field_index);
+}
+
 FileVersion ORCFileReader::GetFileVersion() { return impl_->GetFileVersion(); }
 
 std::string ORCFileReader::GetSoftwareVersion() { return impl_->GetSoftwareVersion(); }
@@ -19,6 +19,8 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
+#include <string>
 #include <vector>
 
 #include "arrow/adapters/orc/options.h"
@@ -47,6 +49,18 @@ struct StripeInformation {
   int64_t first_row_id;
 };
 
+/// \brief Statistics of a column within an ORC stripe
+struct StripeColumnStatistics {
+  /// \brief Whether the column has nulls in the stripe
+  bool has_null;
+  /// \brief Number of non-null values in the stripe
+  int64_t num_values;
+  /// \brief Minimum value, or null if not available
+  std::shared_ptr<Scalar> min;
+  /// \brief Maximum value, or null if not available
+  std::shared_ptr<Scalar> max;
+};
+
 /// \class ORCFileReader
 /// \brief Read an Arrow Table or RecordBatch from an ORC file.
 class ARROW_EXPORT ORCFileReader {
@@ -61,6 +75,20 @@ class ARROW_EXPORT ORCFileReader {
   static Result<std::unique_ptr<ORCFileReader>> Open(
       const std::shared_ptr<io::RandomAccessFile>& file, MemoryPool* pool);
 
+  /// \brief Creates a new ORC reader without reading the file tail
+  ///
+  /// Useful to open several readers of the same file, e.g. to read stripes
+  /// in parallel.
+  ///
+  /// \param[in] file the data source
+  /// \param[in] pool a MemoryPool to use for buffer allocations
+  /// \param[in] serialized_file_tail the file tail, as returned by
+  /// GetSerializedFileTail() on another reader of the same file
+  /// \return the returned reader object
+  static Result<std::unique_ptr<ORCFileReader>> Open(
+      const std::shared_ptr<io::RandomAccessFile>& file, MemoryPool* pool,
+      const std::string& serialized_file_tail);
+
   /// \brief Return the schema read from the ORC file
   ///
   /// \return the returned Schema object
@@ -183,6 +211,18 @@ class ARROW_EXPORT ORCFileReader {
   /// \brief StripeInformation for each stripe.
   StripeInformation GetStripeInformation(int64_t stripe);
 
+  /// \brief Get the statistics of a top-level field within a stripe.
+  ///
+  /// Minimum and maximum values are only provided for integer, floating point,
+  /// string, varchar and date columns, as Int64, Double, String and Date32
+  /// scalars respectively.
+  ///
+  /// \param[in] stripe the stripe index
+  /// \param[in] field_index the index of the field in the file schema
+  /// \return the statistics, or std::nullopt if the file has no stripe statistics
+  Result<std::optional<StripeColumnStatistics>> GetStripeColumnStatistics(
+      int64_t stripe, int field_index);
+
   /// \brief Get the format version of the file.
   ///         Currently known values are 0.11 and 0.12.
   ///
@@ -663,6 +663,22 @@ class TestStringBuilder : public ::testing::Test {
     CheckStringArray(*result_, strings, valid_bytes, reps);
   }
 
+  void TestAppendArraySlice() {
+    auto type = TypeTraits<TypeClass>::type_singleton();
+    auto source = ArrayFromJSON(type, R"(["a", "bb", null, "ccc", "dddd", null])");
+    const ArraySpan span(*source->Slice(1)->data());
+
+    ASSERT_OK(builder_->Append("x"));
+    ASSERT_OK(builder_->AppendArraySlice(span, 1, 3));
+    ASSERT_OK(builder_->AppendArraySlice(span, 0, 2));
+    ASSERT_OK(builder_->AppendArraySlice(span, 4, 0));
+    Done();
+
+    ASSERT_EQ(2, result_->null_count());
+    AssertArraysEqual(*ArrayFromJSON(type, R"(["x", null, "ccc", "dddd", "bb", null])"),
+                      *result_);
+  }
+
   void TestAppendCStringsWithValidBytes() {
     const char* strings[] = {nullptr, "aaa", nullptr, "ignored", ""};
     std::vector<uint8_t> valid_bytes = {1, 1, 1, 0, 1};
@@ -788,6 +804,8 @@ TYPED_TEST(TestStringBuilder, TestExtendCurrentUnsafe) {
 
 TYPED_TEST(TestStringBuilder, TestVectorAppend) { this->TestVectorAppend(); }
 
+TYPED_TEST(TestStringBuilder, TestAppendArraySlice) { this->TestAppendArraySlice(); }
+
 TYPED_TEST(TestStringBuilder, TestAppendCStringsWithValidBytes) {
   this->TestAppendCStringsWithValidBytes();
 }
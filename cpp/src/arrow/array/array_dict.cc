@@ -420,6 +420,17 @@ class DictionaryUnifierImpl : public DictionaryUnifier {
     return Status::OK();
   }
 
+  Result<std::shared_ptr<Array>> GetDelta(int64_t start_offset) override {
+    if (start_offset < 0 || start_offset > memo_table_.size()) {
+      return Status::IndexError("Start offset ", start_offset,
+                                " out of bounds for a unified dictionary of length ",
+                                memo_table_.size());
+    }
+    ARROW_ASSIGN_OR_RAISE(auto data, DictTraits::GetDictionaryArrayData(
+                                         pool_, value_type_, memo_table_, start_offset));
+    return MakeArray(data);
+  }
+
  private:
   MemoryPool* pool_;
   std::shared_ptr<DataType> value_type_;
@@ -545,6 +556,57 @@ Result<std::shared_ptr<ChunkedArray>> DictionaryUnifier::UnifyChunkedArray(
   return std::make_shared<ChunkedArray>(std::move(chunks), array->type());
 }
 
+Result<DeferredDictionaryUnification> DictionaryUnifier::UnifyChunkedArrayDeferred(
+    const std::shared_ptr<ChunkedArray>& array, MemoryPool* pool) {
+  if (array->type()->id() != Type::DICTIONARY) {
+    return Status::TypeError("Expected dictionary type, got ", *array->type());
+  }
+  const auto& dict_type = checked_cast<const DictionaryType&>(*array->type());
+  ARROW_ASSIGN_OR_RAISE(auto unifier,
+                        DictionaryUnifier::Make(dict_type.value_type(), pool));
+  BufferVector transpose_maps(array->num_chunks());
+  for (int i = 0; i < array->num_chunks(); ++i) {
+    const auto& chunk = checked_cast<const DictionaryArray&>(*array->chunk(i));
+    RETURN_NOT_OK(unifier->Unify(*chunk.dictionary(), &transpose_maps[i]));
+  }
+  std::shared_ptr<Array> dictionary;
+  RETURN_NOT_OK(unifier->GetResultWithIndexType(dict_type.index_type(), &dictionary));
+  return DeferredDictionaryUnification(array, std::move(dictionary),
+                                       std::move(transpose_maps));
+}
+
+DeferredDictionaryUnification::DeferredDictionaryUnification(
+    std::shared_ptr<ChunkedArray> chunked_array, std::shared_ptr<Array> dictionary,
+    BufferVector transpose_maps)
+    : chunked_array_(std::move(chunked_array)),
+      dictionary_(std::move(dictionary)),
+      transpose_maps_(std::move(transpose_maps)),
+      is_identity_(transpose_maps_.size()) {
+  for (int i = 0; i < chunked_array_->num_chunks(); ++i) {
+    const auto& chunk = checked_cast<const DictionaryArray&>(*chunked_array_->chunk(i));
+    is_identity_[i] =
+        IsTrivialTransposition(transpose_map(i), chunk.dictionary()->length());
+  }
+}
+
+Result<std::shared_ptr<Array>> DeferredDictionaryUnification::RemapChunk(
+    int i, MemoryPool* pool) const {
+  const auto& data = chunked_array_->chunk(i)->data();
+  ARROW_ASSIGN_OR_RAISE(
+      auto remapped, TransposeDictIndices(data, data->type, data->type,
+                                          dictionary_->data(), transpose_map(i), pool));
+  return MakeArray(std::move(remapped));
+}
+
+Result<std::shared_ptr<ChunkedArray>> DeferredDictionaryUnification::Remap(
+    MemoryPool* pool) const {
+  ArrayVector chunks(chunked_array_->num_chunks());
+  for (int i = 0; i < chunked_array_->num_chunks(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(chunks[i], RemapChunk(i, pool));
+  }
+  return std::make_shared<ChunkedArray>(std::move(chunks), chunked_array_->type());
+}
+
 Result<std::shared_ptr<Table>> DictionaryUnifier::UnifyTable(const Table& table,
                                                              MemoryPool* pool) {
   ChunkedArrayVector columns = table.columns();
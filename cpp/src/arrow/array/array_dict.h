@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/array/array_base.h"
 #include "arrow/array/data.h"
@@ -123,6 +124,53 @@ class ARROW_EXPORT DictionaryArray : public Array {
 };
 
 /// \brief Helper class for incremental dictionary unification
+/// \brief Dictionaries of a ChunkedArray unified without rewriting its indices
+///
+/// Returned by DictionaryUnifier::UnifyChunkedArrayDeferred().  Each chunk keeps
+/// its own dictionary, and the transpose map of a chunk maps its dictionary
+/// indices to indices in the unified dictionary.  Chunk indices are only
+/// rewritten by RemapChunk() or Remap(), so consumers that can compose the
+/// transpose maps with their own lookups never pay for the rewrite.
+class ARROW_EXPORT DeferredDictionaryUnification {
+ public:
+  DeferredDictionaryUnification(std::shared_ptr<ChunkedArray> chunked_array,
+                                std::shared_ptr<Array> dictionary,
+                                BufferVector transpose_maps);
+
+  /// \brief The original chunks, each with its own dictionary
+  const std::shared_ptr<ChunkedArray>& chunked_array() const { return chunked_array_; }
+
+  /// \brief The unified dictionary
+  const std::shared_ptr<Array>& dictionary() const { return dictionary_; }
+
+  /// \brief The transpose map of chunk i
+  ///
+  /// The map holds int32_t values equal in length to the chunk's dictionary.
+  const int32_t* transpose_map(int i) const {
+    return reinterpret_cast<const int32_t*>(transpose_maps_[i]->data());
+  }
+
+  /// \brief Whether the indices of chunk i are already valid for the unified
+  /// dictionary, so that remapping it doesn't touch its indices
+  bool is_identity(int i) const { return is_identity_[i]; }
+
+  /// \brief Rewrite the indices of chunk i against the unified dictionary
+  Result<std::shared_ptr<Array>> RemapChunk(
+      int i, MemoryPool* pool = default_memory_pool()) const;
+
+  /// \brief Rewrite the indices of all chunks against the unified dictionary
+  ///
+  /// The result is the same as DictionaryUnifier::UnifyChunkedArray().
+  Result<std::shared_ptr<ChunkedArray>> Remap(
+      MemoryPool* pool = default_memory_pool()) const;
+
+ private:
+  std::shared_ptr<ChunkedArray> chunked_array_;
+  std::shared_ptr<Array> dictionary_;
+  BufferVector transpose_maps_;
+  std::vector<bool> is_identity_;
+};
+
 class ARROW_EXPORT DictionaryUnifier {
  public:
   virtual ~DictionaryUnifier() = default;
@@ -144,6 +192,18 @@ class ARROW_EXPORT DictionaryUnifier {
       const std::shared_ptr<ChunkedArray>& array,
       MemoryPool* pool = default_memory_pool());
 
+  /// \brief Unify dictionaries across array chunks, deferring index rewrites
+  ///
+  /// Unlike UnifyChunkedArray(), the chunk indices are left untouched: the
+  /// result holds the unified dictionary and one transpose map per chunk, and
+  /// chunks are only rewritten on request.
+  ///
+  /// Only a ChunkedArray of a dictionary type with a primitive value type is
+  /// supported.
+  static Result<DeferredDictionaryUnification> UnifyChunkedArrayDeferred(
+      const std::shared_ptr<ChunkedArray>& array,
+      MemoryPool* pool = default_memory_pool());
+
   /// \brief Unify dictionaries across the chunks of each table column
   ///
   /// The dictionaries in each table column will be unified, their indices
@@ -177,6 +237,14 @@ class ARROW_EXPORT DictionaryUnifier {
   /// The unifier cannot be used after this is called
   virtual Status GetResultWithIndexType(const std::shared_ptr<DataType>& index_type,
                                         std::shared_ptr<Array>* out_dict) = 0;
+
+  /// \brief Return the values of the unified dictionary from the given offset
+  ///
+  /// Unlike GetResult(), the unifier can still be used after this is called: this
+  /// lets dictionary deltas be computed as new dictionaries are unified.
+  /// \param[in] start_offset the length of the unified dictionary the values
+  /// are returned after, at most its current length
+  virtual Result<std::shared_ptr<Array>> GetDelta(int64_t start_offset) = 0;
 };
 
 }  // namespace arrow
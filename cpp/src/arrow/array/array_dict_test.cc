@@ -1572,6 +1572,26 @@ TEST(TestDictionaryUnifier, String) {
   CheckTransposeMap(*b2, {2, 0});
 }
 
+TEST(TestDictionaryUnifier, Delta) {
+  auto dict_ty = utf8();
+
+  ASSERT_OK_AND_ASSIGN(auto unifier, DictionaryUnifier::Make(dict_ty));
+  ASSERT_OK(unifier->Unify(*ArrayFromJSON(dict_ty, R"(["foo", "bar"])")));
+  ASSERT_OK_AND_ASSIGN(auto delta, unifier->GetDelta(0));
+  AssertArraysEqual(*ArrayFromJSON(dict_ty, R"(["foo", "bar"])"), *delta);
+
+  // The unifier can still be used
+  std::shared_ptr<Buffer> transpose;
+  ASSERT_OK(
+      unifier->Unify(*ArrayFromJSON(dict_ty, R"(["quux", "foo", "baz"])"), &transpose));
+  CheckTransposeMap(*transpose, {2, 0, 3});
+  ASSERT_OK_AND_ASSIGN(delta, unifier->GetDelta(2));
+  AssertArraysEqual(*ArrayFromJSON(dict_ty, R"(["quux", "baz"])"), *delta);
+  ASSERT_OK_AND_ASSIGN(delta, unifier->GetDelta(4));
+  ASSERT_EQ(delta->length(), 0);
+  ASSERT_RAISES(IndexError, unifier->GetDelta(5));
+}
+
 TEST(TestDictionaryUnifier, FixedSizeBinary) {
   auto type = fixed_size_binary(3);
 
@@ -1670,6 +1690,41 @@ TEST(TestDictionaryUnifier, ChunkedArraySimple) {
   CheckDictionaryArray(unified->chunk(3), expected_dict, ArrayFromJSON(int8(), "[]"));
 }
 
+TEST(TestDictionaryUnifier, ChunkedArrayDeferred) {
+  auto type = dictionary(int8(), utf8());
+  auto chunk1 = ArrayFromJSON(type, R"(["ab", "cd", null, "cd"])");
+  auto chunk2 = ArrayFromJSON(type, R"(["ef", "cd", "ef"])");
+  auto chunk3 = ArrayFromJSON(type, R"(["ef", "ab", null, "ab"])");
+  ASSERT_OK_AND_ASSIGN(auto chunked, ChunkedArray::Make({chunk1, chunk2, chunk3}));
+
+  ASSERT_OK_AND_ASSIGN(auto deferred,
+                       DictionaryUnifier::UnifyChunkedArrayDeferred(chunked));
+  // The chunks are left untouched until remapped
+  ASSERT_EQ(deferred.chunked_array(), chunked);
+  auto expected_dict = ArrayFromJSON(utf8(), R"(["ab", "cd", "ef"])");
+  AssertArraysEqual(*expected_dict, *deferred.dictionary());
+  ASSERT_TRUE(deferred.is_identity(0));
+  ASSERT_FALSE(deferred.is_identity(1));
+  ASSERT_FALSE(deferred.is_identity(2));
+  // chunk2's dictionary is ["ef", "cd"]
+  ASSERT_EQ(deferred.transpose_map(1)[0], 2);
+  ASSERT_EQ(deferred.transpose_map(1)[1], 1);
+
+  ASSERT_OK_AND_ASSIGN(auto remapped, deferred.RemapChunk(2));
+  CheckDictionaryArray(remapped, expected_dict,
+                       ArrayFromJSON(int8(), "[2, 0, null, 0]"));
+  // Identity chunks share their indices with the original
+  ASSERT_OK_AND_ASSIGN(remapped, deferred.RemapChunk(0));
+  ASSERT_EQ(remapped->data()->buffers[1], chunk1->data()->buffers[1]);
+
+  ASSERT_OK_AND_ASSIGN(auto all_remapped, deferred.Remap());
+  ASSERT_OK_AND_ASSIGN(auto unified, DictionaryUnifier::UnifyChunkedArray(chunked));
+  AssertChunkedEqual(*unified, *all_remapped);
+
+  ASSERT_OK_AND_ASSIGN(auto not_dict, ChunkedArray::Make({ArrayFromJSON(int8(), "[1]")}));
+  ASSERT_RAISES(TypeError, DictionaryUnifier::UnifyChunkedArrayDeferred(not_dict));
+}
+
 TEST(TestDictionaryUnifier, ChunkedArrayZeroChunk) {
   auto type = dictionary(int8(), utf8());
   ASSERT_OK_AND_ASSIGN(auto chunked, ChunkedArray::Make(ArrayVector{}, type));
@@ -1020,6 +1020,33 @@ TEST_F(TestArray, TestBinaryViewAppendArraySlice) {
   AssertArraysEqual(*src, *dst);
 }
 
+TEST_F(TestArray, TestBinaryViewAppendFromBuffer) {
+  auto first = Buffer::FromString("a long string, not inlined|short");
+  auto second = Buffer::FromString("another string that is not inlined");
+
+  StringViewBuilder builder(pool_);
+  ASSERT_OK(builder.AppendFromBuffer(first, first->data(), 26));
+  ASSERT_OK(builder.Append("copied into the heap of the builder"));
+  ASSERT_OK(builder.AppendFromBuffer(first, first->data() + 27, 5));
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK(builder.AppendFromBuffer(second, second->data(), second->size()));
+  ASSERT_OK(builder.AppendFromBuffer(first, first->data() + 2, 11));
+  ASSERT_RAISES(Invalid, builder.AppendFromBuffer(first, second->data(), 20));
+  ASSERT_OK_AND_ASSIGN(auto array, builder.Finish());
+  ASSERT_OK(array->ValidateFull());
+
+  AssertArraysEqual(*ArrayFromJSON(utf8_view(), R"([
+        "a long string, not inlined", "copied into the heap of the builder",
+        "short", null, "another string that is not inlined", "long string"])"),
+                    *array);
+  // Referenced buffers are not copied, and consecutive values share the buffer
+  const auto& buffers = array->data()->buffers;
+  ASSERT_EQ(6, buffers.size());
+  ASSERT_EQ(first, buffers[2]);
+  ASSERT_EQ(second, buffers[4]);
+  ASSERT_EQ(first, buffers[5]);
+}
+
 TEST_F(TestArray, ValidateBuffersPrimitive) {
   auto empty_buffer = std::make_shared<Buffer>("");
   auto null_buffer = Buffer::FromString("\xff");
@@ -24,6 +24,7 @@
 #include "arrow/array/array_base.h"
 #include "arrow/array/builder_dict.h"
 #include "arrow/array/data.h"
+#include "arrow/array/statistics.h"
 #include "arrow/array/util.h"
 #include "arrow/buffer.h"
 #include "arrow/builder.h"
@@ -361,6 +362,9 @@ Status ArrayBuilder::AppendScalars(const ScalarVector& scalars) {
 Status ArrayBuilder::Finish(std::shared_ptr<Array>* out) {
   std::shared_ptr<ArrayData> internal_data;
   RETURN_NOT_OK(FinishInternal(&internal_data));
+  if (collect_statistics_) {
+    internal_data->statistics = ComputeArrayStatistics(*internal_data);
+  }
   *out = MakeArray(internal_data);
   return Status::OK();
 }
@@ -383,9 +387,11 @@ Status ArrayBuilder::SetNotNull(int64_t length) {
 }
 
 void ArrayBuilder::UnsafeAppendToBitmap(const std::vector<bool>& is_valid) {
-  for (bool element_valid : is_valid) {
-    UnsafeAppendToBitmap(element_valid);
-  }
+  auto it = is_valid.begin();
+  null_bitmap_builder_.UnsafeAppend</*count_falses=*/true>(
+      static_cast<int64_t>(is_valid.size()), [&]() -> bool { return *it++; });
+  length_ += static_cast<int64_t>(is_valid.size());
+  null_count_ = null_bitmap_builder_.false_count();
 }
 
 void ArrayBuilder::UnsafeSetNotNull(int64_t length) {
@@ -206,6 +206,15 @@ class ARROW_EXPORT ArrayBuilder {
   /// \brief Return the type of the built Array
   virtual std::shared_ptr<DataType> type() const = 0;
 
+  /// \brief Whether Finish() attaches statistics to the finished Array
+  ///
+  /// When enabled, the row count, null count, minimum and maximum are computed
+  /// with ComputeArrayStatistics() as the Array is finished.  Disabled by default.
+  void set_collect_statistics(bool collect_statistics) {
+    collect_statistics_ = collect_statistics;
+  }
+  bool collect_statistics() const { return collect_statistics_; }
+
  protected:
   /// Append to null bitmap
   Status AppendToBitmap(bool is_valid);
@@ -312,6 +321,8 @@ class ARROW_EXPORT ArrayBuilder {
   int64_t length_ = 0;
   int64_t capacity_ = 0;
 
+  bool collect_statistics_ = false;
+
   // Child value array builders. These are owned by this class
   std::vector<std::shared_ptr<ArrayBuilder>> children_;
 
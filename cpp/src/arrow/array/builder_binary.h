@@ -190,9 +190,17 @@ class BaseBinaryBuilder
   /// \return Status
   Status AppendValues(const std::vector<std::string>& values,
                       const uint8_t* valid_bytes = NULLPTR) {
-    std::size_t total_length = std::accumulate(
-        values.begin(), values.end(), 0ULL,
-        [](uint64_t sum, const std::string& str) { return sum + str.size(); });
+    // First pass: size the value data exactly, skipping the nulls
+    uint64_t total_length = 0;
+    if (valid_bytes != NULLPTR) {
+      for (std::size_t i = 0; i < values.size(); ++i) {
+        total_length += valid_bytes[i] ? values[i].size() : 0;
+      }
+    } else {
+      for (const auto& value : values) {
+        total_length += value.size();
+      }
+    }
     ARROW_RETURN_NOT_OK(Reserve(values.size()));
     ARROW_RETURN_NOT_OK(ReserveData(total_length));
 
@@ -286,20 +294,21 @@ class BaseBinaryBuilder
   Status AppendArraySlice(const ArraySpan& array, int64_t offset,
                           int64_t length) override {
     auto bitmap = array.GetValues<uint8_t>(0, 0);
-    auto offsets = array.GetValues<offset_type>(1);
+    auto offsets = array.GetValues<offset_type>(1) + offset;
     auto data = array.GetValues<uint8_t>(2, 0);
-    auto total_length = offsets[offset + length] - offsets[offset];
+    const int64_t total_length = offsets[length] - offsets[0];
     ARROW_RETURN_NOT_OK(Reserve(length));
     ARROW_RETURN_NOT_OK(ReserveData(total_length));
+    // Copy the whole value range at once and rebase the offsets onto it.  Null
+    // slots keep the (usually empty) range they have in the input.
+    const int64_t rebase = value_data_builder_.length() - offsets[0];
     for (int64_t i = 0; i < length; i++) {
-      if (!bitmap || bit_util::GetBit(bitmap, array.offset + offset + i)) {
-        const offset_type start = offsets[offset + i];
-        const offset_type end = offsets[offset + i + 1];
-        UnsafeAppend(data + start, end - start);
-      } else {
-        UnsafeAppendNull();
-      }
+      offsets_builder_.UnsafeAppend(static_cast<offset_type>(offsets[i] + rebase));
+    }
+    if (total_length > 0) {
+      value_data_builder_.UnsafeAppend(data + offsets[0], total_length);
     }
+    UnsafeAppendToBitmap(bitmap, array.offset + offset, length);
     return Status::OK();
   }
 
@@ -501,8 +510,7 @@ class ARROW_EXPORT StringHeapBuilder {
     }
 
     auto v = util::ToNonInlineBinaryView(value, static_cast<int32_t>(length),
-                                         static_cast<int32_t>(blocks_.size() - 1),
-                                         current_offset_);
+                                         current_block_index_, current_offset_);
 
     memcpy(current_out_buffer_, value, static_cast<size_t>(length));
     current_out_buffer_ += length;
@@ -511,6 +519,40 @@ class ARROW_EXPORT StringHeapBuilder {
     return v;
   }
 
+  /// \brief Reference a value stored in `buffer` instead of copying it
+  ///
+  /// `value` must point into `buffer`. Unless the value is inlined, `buffer` becomes
+  /// one of the blocks of the heap (once for consecutive calls with the same buffer),
+  /// so its contents must not be modified afterwards.
+  template <bool Safe>
+  std::conditional_t<Safe, Result<c_type>, c_type> AppendFromBuffer(
+      const std::shared_ptr<Buffer>& buffer, const uint8_t* value, int64_t length) {
+    if (length <= BinaryViewType::kInlineSize) {
+      return util::ToInlineBinaryView(value, static_cast<int32_t>(length));
+    }
+
+    const int64_t offset = value - buffer->data();
+    if constexpr (Safe) {
+      if (ARROW_PREDICT_FALSE(offset < 0 || length > buffer->size() - offset)) {
+        return Status::Invalid("Value is not located in the given buffer");
+      }
+      if (ARROW_PREDICT_FALSE(offset + length > ValueSizeLimit())) {
+        return Status::CapacityError(
+            "BinaryView or StringView elements cannot reference "
+            "offsets larger than 2GB");
+      }
+    }
+
+    if (buffer.get() != last_external_block_) {
+      last_external_block_ = buffer.get();
+      last_external_block_index_ = static_cast<int32_t>(blocks_.size());
+      blocks_.push_back(buffer);
+    }
+    return util::ToNonInlineBinaryView(value, static_cast<int32_t>(length),
+                                       last_external_block_index_,
+                                       static_cast<int32_t>(offset));
+  }
+
   static constexpr int64_t ValueSizeLimit() {
     return std::numeric_limits<int32_t>::max();
   }
@@ -531,6 +573,8 @@ class ARROW_EXPORT StringHeapBuilder {
           AllocateResizableBuffer(current_remaining_bytes_, alignment_, pool_));
       current_offset_ = 0;
       current_out_buffer_ = new_block->mutable_data();
+      current_block_index_ = static_cast<int32_t>(blocks_.size());
+      current_block_ = new_block;
       blocks_.emplace_back(std::move(new_block));
     }
     return Status::OK();
@@ -540,19 +584,22 @@ class ARROW_EXPORT StringHeapBuilder {
     current_offset_ = 0;
     current_out_buffer_ = NULLPTR;
     current_remaining_bytes_ = 0;
+    current_block_.reset();
+    current_block_index_ = -1;
+    last_external_block_ = NULLPTR;
+    last_external_block_index_ = -1;
     blocks_.clear();
   }
 
   int64_t current_remaining_bytes() const { return current_remaining_bytes_; }
 
-  Result<std::vector<std::shared_ptr<ResizableBuffer>>> Finish() {
-    if (!blocks_.empty()) {
+  Result<std::vector<std::shared_ptr<Buffer>>> Finish() {
+    if (current_block_ != NULLPTR) {
       ARROW_RETURN_NOT_OK(FinishLastBlock());
     }
-    current_offset_ = 0;
-    current_out_buffer_ = NULLPTR;
-    current_remaining_bytes_ = 0;
-    return std::move(blocks_);
+    std::vector<std::shared_ptr<Buffer>> blocks = std::move(blocks_);
+    Reset();
+    return blocks;
   }
 
  private:
@@ -560,9 +607,9 @@ class ARROW_EXPORT StringHeapBuilder {
     if (current_remaining_bytes_ > 0) {
       // Avoid leaking uninitialized bytes from the allocator
       ARROW_RETURN_NOT_OK(
-          blocks_.back()->Resize(blocks_.back()->size() - current_remaining_bytes_,
+          current_block_->Resize(current_block_->size() - current_remaining_bytes_,
                                  /*shrink_to_fit=*/true));
-      blocks_.back()->ZeroPadding();
+      current_block_->ZeroPadding();
     }
     return Status::OK();
   }
@@ -570,11 +617,20 @@ class ARROW_EXPORT StringHeapBuilder {
   MemoryPool* pool_;
   int64_t alignment_;
   int64_t blocksize_ = kDefaultBlocksize;
-  std::vector<std::shared_ptr<ResizableBuffer>> blocks_;
+  // Blocks allocated by the heap, interleaved with the buffers referenced by
+  // AppendFromBuffer()
+  std::vector<std::shared_ptr<Buffer>> blocks_;
 
+  // The block currently being filled by Append()
+  std::shared_ptr<ResizableBuffer> current_block_;
+  int32_t current_block_index_ = -1;
   int32_t current_offset_ = 0;
   uint8_t* current_out_buffer_ = NULLPTR;
   int64_t current_remaining_bytes_ = 0;
+
+  // The buffer last referenced by AppendFromBuffer()
+  const Buffer* last_external_block_ = NULLPTR;
+  int32_t last_external_block_index_ = -1;
 };
 
 }  // namespace internal
@@ -645,6 +701,30 @@ class ARROW_EXPORT BinaryViewBuilder : public ArrayBuilder {
     UnsafeAppend(value.data(), static_cast<int64_t>(value.size()));
   }
 
+  /// \brief Append a value stored in `buffer` without copying it
+  ///
+  /// `value` must point into `buffer`. Values that are not inlined reference
+  /// `buffer`, which is added to the data buffers of the finished array, so its
+  /// contents must not be modified afterwards.
+  Status AppendFromBuffer(const std::shared_ptr<Buffer>& buffer, const uint8_t* value,
+                          int64_t length) {
+    ARROW_RETURN_NOT_OK(Reserve(1));
+    ARROW_ASSIGN_OR_RAISE(auto v, data_heap_builder_.AppendFromBuffer</*Safe=*/true>(
+                                      buffer, value, length));
+    UnsafeAppendToBitmap(true);
+    data_builder_.UnsafeAppend(v);
+    return Status::OK();
+  }
+
+  /// \brief Append a value stored in `buffer` without copying it, and without
+  /// checking capacity or the bounds of the value
+  void UnsafeAppendFromBuffer(const std::shared_ptr<Buffer>& buffer,
+                              const uint8_t* value, int64_t length) {
+    UnsafeAppendToBitmap(true);
+    auto v = data_heap_builder_.AppendFromBuffer</*Safe=*/false>(buffer, value, length);
+    data_builder_.UnsafeAppend(v);
+  }
+
   /// \brief Ensures there is enough allocated available capacity in the
   /// out-of-line data heap to append the indicated number of bytes without
   /// additional allocations
@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -44,6 +45,7 @@
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/list_util.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/ree_util.h"
 #include "arrow/util/slice_util_internal.h"
 #include "arrow/visit_data_inline.h"
@@ -51,6 +53,7 @@
 
 namespace arrow {
 
+using internal::Executor;
 using internal::SafeSignedAdd;
 
 namespace {
@@ -134,17 +137,124 @@ int64_t SumBufferSizesInBytes(const BufferVector& buffers) {
   return size;
 }
 
+// When concatenating on an executor, outputs of at least twice this many bytes are
+// written in blocks of this size, concurrently.
+constexpr int64_t kParallelBlockSize = 1 << 22;
+
+// Split the output of a concatenation into blocks of block_size elements and process
+// them concurrently.  starts[i] is the output position of the i-th input and
+// starts.back() the total output length.  For each part of an input falling in a
+// block, visit(input index, position in input, position in output, length) is called.
+template <typename Visit>
+Status ParallelForBlocks(const std::vector<int64_t>& starts, int64_t block_size,
+                         Executor* executor, Visit&& visit) {
+  const int64_t total_length = starts.back();
+  const auto num_blocks = static_cast<int>(bit_util::CeilDiv(total_length, block_size));
+  return internal::ParallelFor(
+      num_blocks,
+      [&](int block) {
+        const int64_t begin = block * block_size;
+        const int64_t end = std::min(begin + block_size, total_length);
+        // The last input starting at or before the beginning of the block
+        auto i = static_cast<size_t>(
+            std::upper_bound(starts.begin(), starts.end(), begin) - starts.begin() - 1);
+        for (int64_t position = begin; position < end; ++i) {
+          const int64_t length = std::min(end, starts[i + 1]) - position;
+          if (length > 0) {
+            visit(i, position - starts[i], position, length);
+            position += length;
+          }
+        }
+        return Status::OK();
+      },
+      executor);
+}
+
+// Like ConcatenateBuffers, but copying blocks concurrently on the executor if given
+// one and there is enough data.
+Result<std::shared_ptr<Buffer>> ConcatenateBuffersOn(const BufferVector& buffers,
+                                                     MemoryPool* pool,
+                                                     Executor* executor) {
+  const int64_t out_length = SumBufferSizesInBytes(buffers);
+  if (executor == nullptr || out_length < 2 * kParallelBlockSize) {
+    return ConcatenateBuffers(buffers, pool);
+  }
+  std::vector<int64_t> starts(buffers.size() + 1, 0);
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    starts[i + 1] = starts[i] + buffers[i]->size();
+  }
+  ARROW_ASSIGN_OR_RAISE(auto out, AllocateBuffer(out_length, pool));
+  uint8_t* out_data = out->mutable_data();
+  RETURN_NOT_OK(ParallelForBlocks(
+      starts, kParallelBlockSize, executor,
+      [&](size_t i, int64_t in_position, int64_t out_position, int64_t length) {
+        std::memcpy(out_data + out_position, buffers[i]->data() + in_position,
+                    static_cast<size_t>(length));
+      }));
+  return std::shared_ptr<Buffer>(std::move(out));
+}
+
 // Write offsets in src into dst, adjusting them such that first_offset
 // will be the first offset written.
 template <typename Offset>
 Result<OffsetBufferOpOutcome> PutOffsets(const Buffer& src, Offset first_offset,
                                          Offset* dst, Range* values_range);
 
+// Like ConcatenateOffsets, but rebasing blocks of offsets concurrently on the executor.
+// The ranges of values and the displacement of each buffer are found first, which only
+// needs the first and last offset of each.
+template <typename Offset>
+Result<OffsetBufferOpOutcome> ConcatenateOffsetsParallel(
+    const BufferVector& buffers, Executor* executor, Offset* out_data,
+    std::vector<Range>* values_ranges) {
+  std::vector<int64_t> starts(buffers.size() + 1, 0);
+  std::vector<Offset> displacements(buffers.size(), 0);
+  Offset values_length = 0;
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    const Buffer& src = *buffers[i];
+    Range* values_range = &(*values_ranges)[i];
+    starts[i + 1] = starts[i] + src.size() / static_cast<int64_t>(sizeof(Offset));
+    if (src.size() == 0) {
+      // It's allowed to have an empty offsets buffer for a 0-length array
+      // (see Array::Validate)
+      values_range->offset = 0;
+      values_range->length = 0;
+      continue;
+    }
+    auto src_begin = src.data_as<Offset>();
+    auto src_end = reinterpret_cast<const Offset*>(src.data() + src.size());
+    values_range->offset = src_begin[0];
+    values_range->length = *src_end - values_range->offset;
+    if (ARROW_PREDICT_FALSE(values_length >
+                            std::numeric_limits<Offset>::max() - values_range->length)) {
+      return OffsetBufferOpOutcome::kOffsetOverflow;
+    }
+    displacements[i] = values_length - src_begin[0];
+    values_length += static_cast<Offset>(values_range->length);
+  }
+
+  RETURN_NOT_OK(ParallelForBlocks(
+      starts, kParallelBlockSize / static_cast<int64_t>(sizeof(Offset)), executor,
+      [&](size_t i, int64_t in_position, int64_t out_position, int64_t length) {
+        auto src = buffers[i]->data_as<Offset>() + in_position;
+        const Offset displacement = displacements[i];
+        // See PutOffsets on why the addition is done in the unsigned domain
+        std::transform(src, src + length, out_data + out_position,
+                       [displacement](Offset offset) {
+                         return SafeSignedAdd(offset, displacement);
+                       });
+      }));
+
+  // the final element in out_data is the length of all values spanned by the offsets
+  out_data[starts.back()] = values_length;
+  return OffsetBufferOpOutcome::kOk;
+}
+
 // Concatenate buffers holding offsets into a single buffer of offsets,
 // also computing the ranges of values spanned by each buffer of offsets.
 template <typename Offset>
 Result<OffsetBufferOpOutcome> ConcatenateOffsets(const BufferVector& buffers,
-                                                 MemoryPool* pool,
+                                                 MemoryPool* pool, Executor* executor,
                                                  std::shared_ptr<Buffer>* out,
                                                  std::vector<Range>* values_ranges) {
   values_ranges->resize(buffers.size());
@@ -153,6 +263,9 @@ Result<OffsetBufferOpOutcome> ConcatenateOffsets(const BufferVector& buffers,
   const int64_t out_size_in_bytes = SumBufferSizesInBytes(buffers);
   ARROW_ASSIGN_OR_RAISE(*out, AllocateBuffer(sizeof(Offset) + out_size_in_bytes, pool));
   auto* out_data = (*out)->mutable_data_as<Offset>();
+  if (executor != nullptr && out_size_in_bytes >= 2 * kParallelBlockSize) {
+    return ConcatenateOffsetsParallel(buffers, executor, out_data, values_ranges);
+  }
 
   int64_t elements_length = 0;
   Offset values_length = 0;
@@ -335,8 +448,8 @@ Result<OffsetBufferOpOutcome> PutListViewOffsets(const ArrayData& input,
 
 class ConcatenateImpl {
  public:
-  ConcatenateImpl(const ArrayDataVector& in, MemoryPool* pool)
-      : in_(in), pool_(pool), out_(std::make_shared<ArrayData>()) {
+  ConcatenateImpl(const ArrayDataVector& in, MemoryPool* pool, Executor* executor)
+      : in_(in), pool_(pool), executor_(executor), out_(std::make_shared<ArrayData>()) {
     out_->type = in_[0]->type;
     for (const auto& in_array : in_) {
       out_->length = SafeSignedAdd(out_->length, in_array->length);
@@ -379,15 +492,15 @@ class ConcatenateImpl {
   Status Visit(const FixedWidthType& fixed) {
     // Handles numbers, decimal32, decimal64, decimal128, decimal256, fixed_size_binary
     ARROW_ASSIGN_OR_RAISE(auto buffers, Buffers(1, fixed));
-    return ConcatenateBuffers(buffers, pool_).Value(&out_->buffers[1]);
+    return ConcatenateValues(buffers).Value(&out_->buffers[1]);
   }
 
   Status Visit(const BinaryType& input_type) {
     std::vector<Range> value_ranges;
     ARROW_ASSIGN_OR_RAISE(auto index_buffers, Buffers(1, sizeof(int32_t)));
     ARROW_ASSIGN_OR_RAISE(
-        auto outcome, ConcatenateOffsets<int32_t>(index_buffers, pool_, &out_->buffers[1],
-                                                  &value_ranges));
+        auto outcome, ConcatenateOffsets<int32_t>(index_buffers, pool_, executor_,
+                                                  &out_->buffers[1], &value_ranges));
     switch (outcome) {
       case OffsetBufferOpOutcome::kOk:
         break;
@@ -406,18 +519,18 @@ class ConcatenateImpl {
         return OffsetOverflowStatus();
     }
     ARROW_ASSIGN_OR_RAISE(auto value_buffers, Buffers(2, value_ranges));
-    return ConcatenateBuffers(value_buffers, pool_).Value(&out_->buffers[2]);
+    return ConcatenateValues(value_buffers).Value(&out_->buffers[2]);
   }
 
   Status Visit(const LargeBinaryType&) {
     std::vector<Range> value_ranges;
     ARROW_ASSIGN_OR_RAISE(auto index_buffers, Buffers(1, sizeof(int64_t)));
     ARROW_ASSIGN_OR_RAISE(
-        auto outcome, ConcatenateOffsets<int64_t>(index_buffers, pool_, &out_->buffers[1],
-                                                  &value_ranges));
+        auto outcome, ConcatenateOffsets<int64_t>(index_buffers, pool_, executor_,
+                                                  &out_->buffers[1], &value_ranges));
     RETURN_IF_NOT_OK_OUTCOME(outcome);
     ARROW_ASSIGN_OR_RAISE(auto value_buffers, Buffers(2, value_ranges));
-    return ConcatenateBuffers(value_buffers, pool_).Value(&out_->buffers[2]);
+    return ConcatenateValues(value_buffers).Value(&out_->buffers[2]);
   }
 
   Status Visit(const BinaryViewType& type) {
@@ -430,7 +543,7 @@ class ConcatenateImpl {
     }
 
     ARROW_ASSIGN_OR_RAISE(auto view_buffers, Buffers(1, BinaryViewType::kSize));
-    ARROW_ASSIGN_OR_RAISE(auto view_buffer, ConcatenateBuffers(view_buffers, pool_));
+    ARROW_ASSIGN_OR_RAISE(auto view_buffer, ConcatenateValues(view_buffers));
 
     auto* views = view_buffer->mutable_data_as<BinaryViewType::c_type>();
     size_t preceding_buffer_count = 0;
@@ -463,7 +576,7 @@ class ConcatenateImpl {
     std::vector<Range> value_ranges;
     ARROW_ASSIGN_OR_RAISE(auto index_buffers, Buffers(1, sizeof(int32_t)));
     ARROW_ASSIGN_OR_RAISE(auto offsets_outcome,
-                          ConcatenateOffsets<int32_t>(index_buffers, pool_,
+                          ConcatenateOffsets<int32_t>(index_buffers, pool_, executor_,
                                                       &out_->buffers[1], &value_ranges));
     switch (offsets_outcome) {
       case OffsetBufferOpOutcome::kOk:
@@ -474,7 +587,7 @@ class ConcatenateImpl {
     }
     ARROW_ASSIGN_OR_RAISE(auto child_data, ChildData(0, value_ranges));
     ErrorHints child_error_hints;
-    auto status = ConcatenateImpl(child_data, pool_)
+    auto status = ConcatenateImpl(child_data, pool_, executor_)
                       .Concatenate(&out_->child_data[0], &child_error_hints);
     if (!status.ok() && child_error_hints.suggested_cast) {
       suggested_cast_ = list(std::move(child_error_hints.suggested_cast));
@@ -486,12 +599,12 @@ class ConcatenateImpl {
     std::vector<Range> value_ranges;
     ARROW_ASSIGN_OR_RAISE(auto index_buffers, Buffers(1, sizeof(int64_t)));
     ARROW_ASSIGN_OR_RAISE(
-        auto outcome, ConcatenateOffsets<int64_t>(index_buffers, pool_, &out_->buffers[1],
-                                                  &value_ranges));
+        auto outcome, ConcatenateOffsets<int64_t>(index_buffers, pool_, executor_,
+                                                  &out_->buffers[1], &value_ranges));
     RETURN_IF_NOT_OK_OUTCOME(outcome);
     ARROW_ASSIGN_OR_RAISE(auto child_data, ChildData(0, value_ranges));
     ErrorHints child_error_hints;
-    auto status = ConcatenateImpl(child_data, pool_)
+    auto status = ConcatenateImpl(child_data, pool_, executor_)
                       .Concatenate(&out_->child_data[0], &child_error_hints);
     if (!status.ok() && child_error_hints.suggested_cast) {
       suggested_cast_ = large_list(std::move(child_error_hints.suggested_cast));
@@ -519,7 +632,7 @@ class ConcatenateImpl {
     // Concatenate the values
     ErrorHints child_error_hints;
     ARROW_ASSIGN_OR_RAISE(ArrayDataVector value_data, ChildData(0, value_ranges));
-    auto values_status = ConcatenateImpl(value_data, pool_)
+    auto values_status = ConcatenateImpl(value_data, pool_, executor_)
                              .Concatenate(&out_->child_data[0], &child_error_hints);
     if (!values_status.ok()) {
       if (child_error_hints.suggested_cast) {
@@ -532,7 +645,7 @@ class ConcatenateImpl {
 
     // Concatenate the sizes first
     ARROW_ASSIGN_OR_RAISE(auto size_buffers, Buffers(2, sizeof(offset_type)));
-    RETURN_NOT_OK(ConcatenateBuffers(size_buffers, pool_).Value(&out_->buffers[2]));
+    RETURN_NOT_OK(ConcatenateValues(size_buffers).Value(&out_->buffers[2]));
 
     // Concatenate the offsets
     ARROW_ASSIGN_OR_RAISE(auto offset_buffers, Buffers(1, sizeof(offset_type)));
@@ -555,8 +668,8 @@ class ConcatenateImpl {
   Status Visit(const FixedSizeListType& fsl_type) {
     ARROW_ASSIGN_OR_RAISE(auto child_data, ChildData(0, fsl_type.list_size()));
     ErrorHints hints;
-    auto status =
-        ConcatenateImpl(child_data, pool_).Concatenate(&out_->child_data[0], &hints);
+    auto status = ConcatenateImpl(child_data, pool_, executor_)
+                      .Concatenate(&out_->child_data[0], &hints);
     if (!status.ok() && hints.suggested_cast) {
       suggested_cast_ =
           fixed_size_list(std::move(hints.suggested_cast), fsl_type.list_size());
@@ -567,7 +680,7 @@ class ConcatenateImpl {
   Status Visit(const StructType& s) {
     for (int i = 0; i < s.num_fields(); ++i) {
       ARROW_ASSIGN_OR_RAISE(auto child_data, ChildData(i));
-      RETURN_NOT_OK(ConcatenateImpl(child_data, pool_)
+      RETURN_NOT_OK(ConcatenateImpl(child_data, pool_, executor_)
                         .Concatenate(&out_->child_data[i], /*hints=*/nullptr));
     }
     return Status::OK();
@@ -656,7 +769,7 @@ class ConcatenateImpl {
     ARROW_ASSIGN_OR_RAISE(auto index_buffers, Buffers(1, *fixed));
     if (dictionaries_same) {
       out_->dictionary = in_[0]->dictionary;
-      return ConcatenateBuffers(index_buffers, pool_).Value(&out_->buffers[1]);
+      return ConcatenateValues(index_buffers).Value(&out_->buffers[1]);
     } else {
       ARROW_ASSIGN_OR_RAISE(auto index_lookup, UnifyDictionaries(d));
       ARROW_ASSIGN_OR_RAISE(out_->buffers[1],
@@ -671,7 +784,7 @@ class ConcatenateImpl {
 
     // Concatenate the type buffers.
     ARROW_ASSIGN_OR_RAISE(auto type_buffers, Buffers(1, sizeof(int8_t)));
-    RETURN_NOT_OK(ConcatenateBuffers(type_buffers, pool_).Value(&out_->buffers[1]));
+    RETURN_NOT_OK(ConcatenateValues(type_buffers).Value(&out_->buffers[1]));
 
     // Concatenate the child data. For sparse unions the child data is sliced
     // based on the offset and length of the array data. For dense unions the
@@ -683,7 +796,7 @@ class ConcatenateImpl {
       case UnionMode::SPARSE: {
         for (int i = 0; i < u.num_fields(); i++) {
           ARROW_ASSIGN_OR_RAISE(auto child_data, ChildData(i));
-          RETURN_NOT_OK(ConcatenateImpl(child_data, pool_)
+          RETURN_NOT_OK(ConcatenateImpl(child_data, pool_, executor_)
                             .Concatenate(&out_->child_data[i], /*hints=*/nullptr));
         }
         break;
@@ -694,7 +807,7 @@ class ConcatenateImpl {
           for (size_t j = 0; j < in_.size(); j++) {
             child_data[j] = in_[j]->child_data[i];
           }
-          RETURN_NOT_OK(ConcatenateImpl(child_data, pool_)
+          RETURN_NOT_OK(ConcatenateImpl(child_data, pool_, executor_)
                             .Concatenate(&out_->child_data[i], /*hints=*/nullptr));
         }
         break;
@@ -779,7 +892,7 @@ class ConcatenateImpl {
       storage_data[i]->type = e.storage_type();
     }
     std::shared_ptr<ArrayData> out_storage;
-    RETURN_NOT_OK(ConcatenateImpl(storage_data, pool_)
+    RETURN_NOT_OK(ConcatenateImpl(storage_data, pool_, executor_)
                       .Concatenate(&out_storage, /*hints=*/nullptr));
     out_storage->type = in_[0]->type;
     out_ = std::move(out_storage);
@@ -787,6 +900,10 @@ class ConcatenateImpl {
   }
 
  private:
+  Result<std::shared_ptr<Buffer>> ConcatenateValues(const BufferVector& buffers) {
+    return ConcatenateBuffersOn(buffers, pool_, executor_);
+  }
+
   // NOTE: Concatenate() can be called during IPC reads to append delta dictionaries
   // on non-validated input.  Therefore, the input-checking SliceBufferSafe and
   // ArrayData::SliceSafe are used below.
@@ -910,6 +1027,7 @@ class ConcatenateImpl {
 
   const ArrayDataVector& in_;
   MemoryPool* pool_;
+  Executor* executor_;
   std::shared_ptr<ArrayData> out_;
   std::shared_ptr<DataType> suggested_cast_;
 };
@@ -920,7 +1038,7 @@ namespace internal {
 
 Result<std::shared_ptr<Array>> Concatenate(
     const ArrayVector& arrays, MemoryPool* pool,
-    std::shared_ptr<DataType>* out_suggested_cast) {
+    std::shared_ptr<DataType>* out_suggested_cast, Executor* executor) {
   DCHECK(out_suggested_cast);
   *out_suggested_cast = nullptr;
   if (arrays.size() == 0) {
@@ -940,7 +1058,7 @@ Result<std::shared_ptr<Array>> Concatenate(
 
   std::shared_ptr<ArrayData> out_data;
   ErrorHints hints;
-  auto status = ConcatenateImpl(data, pool).Concatenate(&out_data, &hints);
+  auto status = ConcatenateImpl(data, pool, executor).Concatenate(&out_data, &hints);
   if (!status.ok()) {
     if (hints.suggested_cast) {
       DCHECK(status.IsInvalid());
@@ -954,8 +1072,13 @@ Result<std::shared_ptr<Array>> Concatenate(
 }  // namespace internal
 
 Result<std::shared_ptr<Array>> Concatenate(const ArrayVector& arrays, MemoryPool* pool) {
+  return Concatenate(arrays, pool, /*executor=*/nullptr);
+}
+
+Result<std::shared_ptr<Array>> Concatenate(const ArrayVector& arrays, MemoryPool* pool,
+                                           Executor* executor) {
   std::shared_ptr<DataType> suggested_cast;
-  auto result = internal::Concatenate(arrays, pool, &suggested_cast);
+  auto result = internal::Concatenate(arrays, pool, &suggested_cast, executor);
   if (!result.ok() && suggested_cast && arrays.size() > 0) {
     DCHECK(result.status().IsInvalid());
     return Status::Invalid(result.status().message(), ", consider casting input from `",
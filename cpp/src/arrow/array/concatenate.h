@@ -21,6 +21,7 @@
 
 #include "arrow/type_fwd.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -33,11 +34,13 @@ namespace internal {
 /// \param[out] out_suggested_cast if a non-OK Result is returned, the function might set
 ///   out_suggested_cast to a cast suggestion that would allow concatenating the arrays
 ///   without overflow of offsets (e.g. string to large_string)
+/// \param[in] executor if not null, large copies are split up and run on this executor
 ///
 /// \return the concatenated array
 ARROW_EXPORT
 Result<std::shared_ptr<Array>> Concatenate(const ArrayVector& arrays, MemoryPool* pool,
-                                           std::shared_ptr<DataType>* out_suggested_cast);
+                                           std::shared_ptr<DataType>* out_suggested_cast,
+                                           Executor* executor = NULLPTR);
 
 }  // namespace internal
 
@@ -50,4 +53,18 @@ ARROW_EXPORT
 Result<std::shared_ptr<Array>> Concatenate(const ArrayVector& arrays,
                                            MemoryPool* pool = default_memory_pool());
 
+/// \brief Concatenate arrays, copying data concurrently
+///
+/// Like Concatenate, but the values and offsets of large inputs are copied (and
+/// rebased) in blocks which run concurrently on the executor.  This must not be
+/// called from a task running on that executor.
+///
+/// \param[in] arrays a vector of arrays to be concatenated
+/// \param[in] pool memory to store the result will be allocated from this memory pool
+/// \param[in] executor the executor to copy data on
+/// \return the concatenated array
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> Concatenate(const ArrayVector& arrays, MemoryPool* pool,
+                                           internal::Executor* executor);
+
 }  // namespace arrow
@@ -43,6 +43,7 @@
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/util/list_util.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/unreachable.h"
 
 namespace arrow {
@@ -261,6 +262,23 @@ TYPED_TEST(PrimitiveConcatenateTest, Primitives) {
   });
 }
 
+TEST_F(ConcatenateTest, OnExecutor) {
+  // Large enough for the values and offsets to be copied in several blocks
+  constexpr int64_t kSize = 1 << 21;
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, internal::ThreadPool::Make(4));
+  for (auto array : {rag.PrimitiveArray<Int64Type>(kSize, 0.1),
+                     rag.StringArray(kSize, 0.1), rag.LargeStringArray(kSize, 0.1)}) {
+    ARROW_SCOPED_TRACE(*array->type());
+    auto offsets = rag.Offsets<int32_t>(kSize, 7);
+    auto slices = rag.Slices(array, offsets);
+    auto expected = array->Slice(offsets.front(), offsets.back() - offsets.front());
+    ASSERT_OK_AND_ASSIGN(auto actual,
+                         Concatenate(slices, default_memory_pool(), thread_pool.get()));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*expected, *actual);
+  }
+}
+
 TEST_F(ConcatenateTest, NullType) {
   Check([](int32_t size, double null_probability, std::shared_ptr<Array>* out) {
     *out = std::make_shared<NullArray>(size);
@@ -15,7 +15,106 @@
 // specific language governing permissions and limitations
 // under the License.
 
-// This empty .cc file is for embedding not inlined symbols in
-// arrow::ArrayStatistics into libarrow.
-
 #include "arrow/array/statistics.h"
+
+#include <cmath>
+#include <string_view>
+#include <type_traits>
+
+#include "arrow/array/data.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/logging_internal.h"
+#include "arrow/visit_data_inline.h"
+#include "arrow/visit_type_inline.h"
+
+namespace arrow {
+
+ArrayStatistics ArrayStatistics::ForSubset() const {
+  ArrayStatistics subset;
+  subset.min = min;
+  subset.max = max;
+  return subset;
+}
+
+namespace {
+
+// The ArrayStatistics::ValueType alternative used for a given C value type
+template <typename CType>
+using StatisticsValueType = std::conditional_t<
+    std::is_same_v<CType, bool>, bool,
+    std::conditional_t<std::is_floating_point_v<CType>, double,
+                       std::conditional_t<std::is_signed_v<CType>, int64_t, uint64_t>>>;
+
+struct MinMaxVisitor {
+  const ArraySpan& span;
+  ArrayStatistics* statistics;
+
+  template <typename ValueType>
+  void Update(const ValueType& value, std::optional<ValueType>* min,
+              std::optional<ValueType>* max) {
+    if (!min->has_value() || value < **min) {
+      *min = value;
+    }
+    if (!max->has_value() || **max < value) {
+      *max = value;
+    }
+  }
+
+  template <typename ValueType, typename OutputType>
+  void Store(const std::optional<ValueType>& min, const std::optional<ValueType>& max) {
+    if (min.has_value()) {
+      statistics->min = OutputType(*min);
+      statistics->is_min_exact = true;
+      statistics->max = OutputType(*max);
+      statistics->is_max_exact = true;
+    }
+  }
+
+  template <typename T>
+  enable_if_t<is_integer_type<T>::value || is_boolean_type<T>::value ||
+                  (is_floating_type<T>::value && !is_half_float_type<T>::value),
+              Status>
+  Visit(const T&) {
+    using CType = typename TypeTraits<T>::CType;
+    std::optional<CType> min, max;
+    VisitArraySpanInline<T>(
+        span,
+        [&](CType value) {
+          if constexpr (std::is_floating_point_v<CType>) {
+            if (std::isnan(value)) return;
+          }
+          Update(value, &min, &max);
+        },
+        [] {});
+    Store<CType, StatisticsValueType<CType>>(min, max);
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_t<is_base_binary_type<T>::value ||
+                  std::is_same_v<T, FixedSizeBinaryType>,
+              Status>
+  Visit(const T&) {
+    std::optional<std::string_view> min, max;
+    VisitArraySpanInline<T>(
+        span, [&](std::string_view value) { Update(value, &min, &max); }, [] {});
+    Store<std::string_view, std::string>(min, max);
+    return Status::OK();
+  }
+
+  Status Visit(const DataType&) { return Status::OK(); }
+};
+
+}  // namespace
+
+std::shared_ptr<ArrayStatistics> ComputeArrayStatistics(const ArrayData& data) {
+  auto statistics = std::make_shared<ArrayStatistics>();
+  statistics->row_count = data.length;
+  statistics->null_count = data.GetNullCount();
+  ArraySpan span(data);
+  MinMaxVisitor visitor{span, statistics.get()};
+  DCHECK_OK(VisitTypeInline(*data.type, &visitor));
+  return statistics;
+}
+
+}  // namespace arrow
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <variant>
@@ -152,6 +153,13 @@ struct ARROW_EXPORT ArrayStatistics {
   /// \brief Whether the maximum value is exact or not
   bool is_max_exact = false;
 
+  /// \brief Statistics that still hold for any subset of the rows
+  ///
+  /// Counts and byte widths are dropped, and the minimum and maximum are kept
+  /// as inexact bounds.  This is what a slice, filter or take can propagate
+  /// without looking at the selected values.
+  ArrayStatistics ForSubset() const;
+
   /// \brief Check two \ref arrow::ArrayStatistics for equality
   ///
   /// \param other The \ref arrow::ArrayStatistics instance to compare against.
@@ -172,4 +180,15 @@ struct ARROW_EXPORT ArrayStatistics {
   bool operator!=(const ArrayStatistics& other) const { return !Equals(other); }
 };
 
+/// \brief Compute exact statistics of the given data
+///
+/// The row count and null count are always set.  The minimum and maximum are
+/// set for integer, floating-point (ignoring NaNs), boolean, binary, string and
+/// fixed-size binary data that has at least one non-null value.
+///
+/// This is a single pass over the values: builders use it to attach
+/// statistics to the arrays they finish, see ArrayBuilder::set_collect_statistics().
+ARROW_EXPORT
+std::shared_ptr<ArrayStatistics> ComputeArrayStatistics(const ArrayData& data);
+
 }  // namespace arrow
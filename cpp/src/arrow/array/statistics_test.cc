@@ -20,8 +20,11 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_primitive.h"
 #include "arrow/array/statistics.h"
 #include "arrow/compare.h"
+#include "arrow/testing/gtest_util.h"
 
 namespace arrow {
 
@@ -259,4 +262,82 @@ TEST_F(TestArrayStatisticsEqualityDoubleValue, ApproximateEquals) {
   ASSERT_TRUE(statistics1_.Equals(statistics2_, options_.atol(1e-3).use_atol(true)));
 }
 
+TEST(TestArrayStatistics, ForSubset) {
+  ArrayStatistics statistics;
+  statistics.row_count = 10;
+  statistics.null_count = 2;
+  statistics.distinct_count = 5;
+  statistics.min = static_cast<int64_t>(-3);
+  statistics.is_min_exact = true;
+  statistics.max = static_cast<int64_t>(7);
+  statistics.is_max_exact = true;
+
+  ArrayStatistics expected;
+  expected.min = static_cast<int64_t>(-3);
+  expected.max = static_cast<int64_t>(7);
+  ASSERT_EQ(expected, statistics.ForSubset());
+}
+
+TEST(TestComputeArrayStatistics, Integer) {
+  auto array = ArrayFromJSON(int16(), "[3, null, -5, 12, null, 0]");
+  auto statistics = ComputeArrayStatistics(*array->data());
+
+  ArrayStatistics expected;
+  expected.row_count = static_cast<int64_t>(6);
+  expected.null_count = static_cast<int64_t>(2);
+  expected.min = static_cast<int64_t>(-5);
+  expected.is_min_exact = true;
+  expected.max = static_cast<int64_t>(12);
+  expected.is_max_exact = true;
+  ASSERT_EQ(expected, *statistics);
+
+  // Statistics of a slice only cover the sliced values
+  statistics = ComputeArrayStatistics(*array->data()->Slice(2, 2));
+  ASSERT_EQ(ArrayStatistics::ValueType{static_cast<int64_t>(-5)}, statistics->min);
+  ASSERT_EQ(ArrayStatistics::ValueType{static_cast<int64_t>(12)}, statistics->max);
+}
+
+TEST(TestComputeArrayStatistics, UnsignedAndFloating) {
+  auto array = ArrayFromJSON(uint8(), "[7, 250, 1]");
+  auto statistics = ComputeArrayStatistics(*array->data());
+  ASSERT_EQ(ArrayStatistics::ValueType{static_cast<uint64_t>(1)}, statistics->min);
+  ASSERT_EQ(ArrayStatistics::ValueType{static_cast<uint64_t>(250)}, statistics->max);
+
+  array = ArrayFromJSON(float32(), "[NaN, 2.5, -1]");
+  statistics = ComputeArrayStatistics(*array->data());
+  ASSERT_EQ(ArrayStatistics::ValueType{-1.0}, statistics->min);
+  ASSERT_EQ(ArrayStatistics::ValueType{2.5}, statistics->max);
+}
+
+TEST(TestComputeArrayStatistics, NoMinMax) {
+  auto array = ArrayFromJSON(int32(), "[null, null]");
+  auto statistics = ComputeArrayStatistics(*array->data());
+  ASSERT_EQ(ArrayStatistics::CountType{static_cast<int64_t>(2)}, statistics->null_count);
+  ASSERT_FALSE(statistics->min.has_value());
+  ASSERT_FALSE(statistics->max.has_value());
+
+  array = ArrayFromJSON(date32(), "[1, 2]");
+  statistics = ComputeArrayStatistics(*array->data());
+  ASSERT_FALSE(statistics->min.has_value());
+  ASSERT_FALSE(statistics->max.has_value());
+}
+
+TEST(TestComputeArrayStatistics, Builder) {
+  StringBuilder builder;
+  ASSERT_OK(builder.AppendValues({"b", "a", "c"}));
+  ASSERT_OK_AND_ASSIGN(auto array, builder.Finish());
+  ASSERT_EQ(array->statistics(), nullptr);
+
+  builder.set_collect_statistics(true);
+  ASSERT_OK(builder.AppendValues({"b", "a", "c"}));
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK_AND_ASSIGN(array, builder.Finish());
+  ASSERT_NE(array->statistics(), nullptr);
+  ASSERT_EQ(ArrayStatistics::CountType{static_cast<int64_t>(1)},
+            array->statistics()->null_count);
+  ASSERT_EQ(ArrayStatistics::ValueType{std::string("a")}, array->statistics()->min);
+  ASSERT_EQ(ArrayStatistics::ValueType{std::string("c")}, array->statistics()->max);
+  ASSERT_TRUE(array->statistics()->is_max_exact);
+}
+
 }  // namespace arrow
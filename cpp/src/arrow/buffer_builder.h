@@ -372,12 +372,8 @@ class TypedBufferBuilder<bool> {
   /// \brief Append bits from an array of bytes (one value per byte)
   void UnsafeAppend(const uint8_t* bytes, int64_t num_elements) {
     if (num_elements == 0) return;
-    int64_t i = 0;
-    internal::GenerateBitsUnrolled(mutable_data(), bit_length_, num_elements, [&] {
-      bool value = bytes[i++];
-      false_count_ += !value;
-      return value;
-    });
+    false_count_ +=
+        internal::GenerateBitsFromBytes(mutable_data(), bit_length_, num_elements, bytes);
     bit_length_ += num_elements;
   }
 
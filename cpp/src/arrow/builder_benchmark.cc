@@ -113,6 +113,76 @@ static void BuildAdaptiveIntNoNullsScalarAppend(
   state.SetItemsProcessed(state.iterations() * kItemsProcessed);
 }
 
+static std::vector<uint8_t> MakeValidBytes() {
+  std::vector<uint8_t> valid_bytes(kNumberOfElements);
+  for (int64_t i = 0; i < kNumberOfElements; ++i) {
+    valid_bytes[i] = (i % 7) != 0;
+  }
+  return valid_bytes;
+}
+
+static void BuildIntArrayValidBytes(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const auto valid_bytes = MakeValidBytes();
+  for (auto _ : state) {
+    Int64Builder builder(memory_tracker.memory_pool());
+
+    for (int i = 0; i < kRounds; i++) {
+      ABORT_NOT_OK(builder.AppendValues(kData.data(), kData.size(), valid_bytes.data()));
+    }
+
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+
+  state.SetBytesProcessed(state.iterations() * kBytesProcessed);
+  state.SetItemsProcessed(state.iterations() * kItemsProcessed);
+}
+
+static void BuildIntArrayValidVector(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const auto valid_bytes = MakeValidBytes();
+  const std::vector<bool> is_valid(valid_bytes.begin(), valid_bytes.end());
+  for (auto _ : state) {
+    Int64Builder builder(memory_tracker.memory_pool());
+
+    for (int i = 0; i < kRounds; i++) {
+      ABORT_NOT_OK(builder.AppendValues(kData, is_valid));
+    }
+
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+
+  state.SetBytesProcessed(state.iterations() * kBytesProcessed);
+  state.SetItemsProcessed(state.iterations() * kItemsProcessed);
+}
+
+static void BuildIntArrayFromSlices(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const auto valid_bytes = MakeValidBytes();
+  Int64Builder source_builder;
+  ABORT_NOT_OK(
+      source_builder.AppendValues(kData.data(), kData.size(), valid_bytes.data()));
+  std::shared_ptr<Array> source;
+  ABORT_NOT_OK(source_builder.Finish(&source));
+  const ArraySpan span(*source->data());
+
+  for (auto _ : state) {
+    Int64Builder builder(memory_tracker.memory_pool());
+
+    for (int i = 0; i < kRounds; i++) {
+      ABORT_NOT_OK(builder.AppendArraySlice(span, 1, kNumberOfElements - 1));
+    }
+
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+
+  state.SetBytesProcessed(state.iterations() * kBytesProcessed);
+  state.SetItemsProcessed(state.iterations() * kItemsProcessed);
+}
+
 static void BuildBooleanArrayNoNulls(
     benchmark::State& state) {  // NOLINT non-const reference
 
@@ -150,6 +220,50 @@ static void BuildBinaryArray(benchmark::State& state) {  // NOLINT non-const ref
   state.SetItemsProcessed(state.iterations() * kItemsProcessed);
 }
 
+static void BuildStringArrayFromVector(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const auto valid_bytes = MakeValidBytes();
+  const std::vector<std::string> values(kNumberOfElements, kBinaryString);
+  for (auto _ : state) {
+    StringBuilder builder(memory_tracker.memory_pool());
+
+    for (int i = 0; i < kRounds; i++) {
+      ABORT_NOT_OK(builder.AppendValues(values, valid_bytes.data()));
+    }
+
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+
+  state.SetBytesProcessed(state.iterations() * kBytesProcessed);
+  state.SetItemsProcessed(state.iterations() * kItemsProcessed);
+}
+
+static void BuildStringArrayFromSlices(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const auto valid_bytes = MakeValidBytes();
+  StringBuilder source_builder;
+  ABORT_NOT_OK(source_builder.AppendValues(
+      std::vector<std::string>(kNumberOfElements, kBinaryString), valid_bytes.data()));
+  std::shared_ptr<Array> source;
+  ABORT_NOT_OK(source_builder.Finish(&source));
+  const ArraySpan span(*source->data());
+
+  for (auto _ : state) {
+    StringBuilder builder(memory_tracker.memory_pool());
+
+    for (int i = 0; i < kRounds; i++) {
+      ABORT_NOT_OK(builder.AppendArraySlice(span, 1, kNumberOfElements - 1));
+    }
+
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+
+  state.SetBytesProcessed(state.iterations() * kBytesProcessed);
+  state.SetItemsProcessed(state.iterations() * kItemsProcessed);
+}
+
 static void BuildInlineBinaryViewArray(
     benchmark::State& state) {  // NOLINT non-const reference
   std::string_view kBinaryStrings[] = {"1",  "12345678", "12345", "123456789",
@@ -489,10 +603,15 @@ BENCHMARK(ReferenceBuildVectorNoNulls);
 BENCHMARK(BuildBooleanArrayNoNulls);
 
 BENCHMARK(BuildIntArrayNoNulls);
+BENCHMARK(BuildIntArrayValidBytes);
+BENCHMARK(BuildIntArrayValidVector);
+BENCHMARK(BuildIntArrayFromSlices);
 BENCHMARK(BuildAdaptiveIntNoNulls);
 BENCHMARK(BuildAdaptiveIntNoNullsScalarAppend);
 
 BENCHMARK(BuildBinaryArray);
+BENCHMARK(BuildStringArrayFromVector);
+BENCHMARK(BuildStringArrayFromSlices);
 BENCHMARK(BuildChunkedBinaryArray);
 BENCHMARK(BuildFixedSizeBinaryArray);
 BENCHMARK(BuildDecimalArray);
@@ -19,13 +19,14 @@
 
 #include <algorithm>
 #include <cerrno>
-#include <condition_variable>
 #include <cstring>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <queue>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -50,6 +51,7 @@
 #include "arrow/util/range.h"
 #include "arrow/util/small_vector.h"
 #include "arrow/util/string.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/value_parsing.h"
 #include "arrow/visit_type_inline.h"
 
@@ -1466,6 +1468,34 @@ Result<std::shared_ptr<Schema>> ImportSchema(struct ArrowSchema* schema) {
 
 namespace {
 
+struct ImportedArrayData;
+
+// A buffer wrapping an imported piece of data.
+//
+// Imported buffers are not allocated one by one: they live in an array
+// owned by their ImportedArrayData, and are handed out as aliasing shared
+// pointers that keep the whole import alive.
+class ImportedBuffer : public Buffer {
+ public:
+  ImportedBuffer() = default;
+  ~ImportedBuffer() override = default;
+
+  void Init(const uint8_t* data, int64_t size, std::shared_ptr<MemoryManager> mm,
+            DeviceAllocationType device_type, const ImportedArrayData* import) {
+    data_ = data;
+    size_ = capacity_ = size;
+    SetMemoryManager(std::move(mm));
+    device_type_ = device_type;
+    import_ = import;
+  }
+
+  std::shared_ptr<Device::SyncEvent> device_sync_event() const override;
+
+ protected:
+  // Not owning: the shared pointer handed out for this buffer owns the import
+  const ImportedArrayData* import_ = NULLPTR;
+};
+
 // A wrapper struct for an imported C ArrowArray.
 // The ArrowArray is released on destruction.
 struct ImportedArrayData {
@@ -1473,6 +1503,11 @@ struct ImportedArrayData {
   DeviceAllocationType device_type_;
   std::shared_ptr<Device::SyncEvent> device_sync_;
 
+  // Storage for all buffers of the import, sized from the ArrowArray tree
+  std::unique_ptr<ImportedBuffer[]> buffers_;
+  int64_t buffers_capacity_ = 0;
+  int64_t num_buffers_ = 0;
+
   ImportedArrayData() {
     ArrowArrayMarkReleased(&array_);  // Initially released
   }
@@ -1486,35 +1521,56 @@ struct ImportedArrayData {
 
   ~ImportedArrayData() { Release(); }
 
+  void ReserveBuffers(int64_t capacity) {
+    DCHECK_EQ(buffers_, nullptr);
+    buffers_.reset(new ImportedBuffer[capacity]);
+    buffers_capacity_ = capacity;
+  }
+
+  ImportedBuffer* NextBuffer() {
+    if (num_buffers_ >= buffers_capacity_) {
+      return NULLPTR;
+    }
+    return &buffers_[num_buffers_++];
+  }
+
  private:
   ARROW_DISALLOW_COPY_AND_ASSIGN(ImportedArrayData);
 };
 
-// A buffer wrapping an imported piece of data.
-class ImportedBuffer : public Buffer {
- public:
-  ImportedBuffer(const uint8_t* data, int64_t size,
-                 std::shared_ptr<ImportedArrayData> import)
-      : Buffer(data, size), import_(std::move(import)) {}
-
-  ImportedBuffer(const uint8_t* data, int64_t size, std::shared_ptr<MemoryManager> mm,
-                 DeviceAllocationType device_type,
-                 std::shared_ptr<ImportedArrayData> import)
-      : Buffer(data, size, mm, nullptr, device_type), import_(std::move(import)) {}
-
-  ~ImportedBuffer() override = default;
+std::shared_ptr<Device::SyncEvent> ImportedBuffer::device_sync_event() const {
+  return import_->device_sync_;
+}
 
-  std::shared_ptr<Device::SyncEvent> device_sync_event() const override {
-    return import_->device_sync_;
+// Count the buffers an ArrowArray tree may contribute to an import
+int64_t CountImportedBuffers(const struct ArrowArray* array, int64_t recursion_level) {
+  if (recursion_level >= kMaxImportRecursionLevel) {
+    // The import will fail anyway
+    return 0;
+  }
+  int64_t count = std::max<int64_t>(array->n_buffers, 0);
+  if (array->children != nullptr) {
+    for (int64_t i = 0; i < array->n_children; ++i) {
+      if (array->children[i] != nullptr) {
+        count += CountImportedBuffers(array->children[i], recursion_level + 1);
+      }
+    }
+  }
+  if (array->dictionary != nullptr) {
+    count += CountImportedBuffers(array->dictionary, recursion_level + 1);
   }
+  return count;
+}
 
- protected:
-  std::shared_ptr<ImportedArrayData> import_;
-};
+// Shared by all imports, for imported null buffer pointers
+const std::shared_ptr<Buffer>& ZeroSizeBuffer() {
+  static const auto buffer = std::make_shared<Buffer>(kZeroSizeArea, 0);
+  return buffer;
+}
 
 struct ArrayImporter {
   explicit ArrayImporter(const std::shared_ptr<DataType>& type)
-      : type_(type), zero_size_buffer_(std::make_shared<Buffer>(kZeroSizeArea, 0)) {}
+      : type_(type) {}
 
   Status Import(struct ArrowDeviceArray* src, const DeviceMemoryMapper& mapper) {
     ARROW_ASSIGN_OR_RAISE(memory_mgr_, mapper(src->device_type, src->device_id));
@@ -1539,6 +1595,7 @@ struct ArrayImporter {
     c_struct_ = &import_->array_;
     import_->device_type_ = device_type_;
     ArrowArrayMove(src, c_struct_);
+    import_->ReserveBuffers(CountImportedBuffers(c_struct_, /*recursion_level=*/0));
     return DoImport();
   }
 
@@ -1913,12 +1970,18 @@ struct ArrayImporter {
     std::shared_ptr<Buffer>* out = &data_->buffers[buffer_id];
     auto data = reinterpret_cast<const uint8_t*>(c_struct_->buffers[buffer_id]);
     if (data != nullptr) {
+      ImportedBuffer* buffer = import_->NextBuffer();
+      if (buffer == nullptr) {
+        // Should not happen, as the storage is sized from the same ArrowArray tree
+        return Status::Invalid("ArrowArray struct has more buffers than announced");
+      }
       if (memory_mgr_) {
-        *out = std::make_shared<ImportedBuffer>(data, buffer_size, memory_mgr_,
-                                                device_type_, import_);
+        buffer->Init(data, buffer_size, memory_mgr_, device_type_, import_.get());
       } else {
-        *out = std::make_shared<ImportedBuffer>(data, buffer_size, import_);
+        buffer->Init(data, buffer_size, default_cpu_memory_manager(),
+                     DeviceAllocationType::kCPU, import_.get());
       }
+      *out = std::shared_ptr<Buffer>(import_, buffer);
     } else if (is_null_bitmap) {
       out->reset();
     } else {
@@ -1928,7 +1991,7 @@ struct ArrayImporter {
             "ArrowArrayStruct contains null data pointer "
             "for a buffer with non-zero computed size");
       }
-      *out = zero_size_buffer_;
+      *out = ZeroSizeBuffer();
     }
     return Status::OK();
   }
@@ -1941,9 +2004,6 @@ struct ArrayImporter {
   std::shared_ptr<ArrayData> data_;
   std::vector<ArrayImporter> child_importers_;
 
-  // For imported null buffer pointers
-  std::shared_ptr<Buffer> zero_size_buffer_;
-
   std::shared_ptr<MemoryManager> memory_mgr_;
   DeviceAllocationType device_type_{DeviceAllocationType::kCPU};
 };
@@ -1985,6 +2045,168 @@ Result<std::shared_ptr<RecordBatch>> ImportRecordBatch(struct ArrowArray* array,
   return ImportRecordBatch(array, *maybe_schema);
 }
 
+namespace {
+
+void AppendFingerprintBytes(const char* data, int64_t length, std::string* out) {
+  out->append(reinterpret_cast<const char*>(&length), sizeof(length));
+  out->append(data, static_cast<size_t>(length));
+}
+
+void AppendFingerprintString(const char* str, std::string* out) {
+  if (str == nullptr) {
+    out->push_back('\0');
+  } else {
+    out->push_back('\1');
+    AppendFingerprintBytes(str, static_cast<int64_t>(std::strlen(str)), out);
+  }
+}
+
+// Append a description of an ArrowSchema tree to `out`, such that trees with
+// the same description import to the same schema.  Returns false if the tree
+// cannot be described (it is then left for ImportSchema to reject).
+bool AppendSchemaFingerprint(const struct ArrowSchema* schema, int64_t recursion_level,
+                             std::string* out) {
+  if (recursion_level >= kMaxImportRecursionLevel || ArrowSchemaIsReleased(schema) ||
+      schema->n_children < 0 || (schema->n_children > 0 && schema->children == nullptr)) {
+    return false;
+  }
+  AppendFingerprintString(schema->format, out);
+  AppendFingerprintString(schema->name, out);
+  out->append(reinterpret_cast<const char*>(&schema->flags), sizeof(schema->flags));
+
+  // Metadata is a count followed by length-prefixed keys and values
+  if (schema->metadata == nullptr) {
+    out->push_back('\0');
+  } else {
+    const char* metadata = schema->metadata;
+    int32_t n_pairs;
+    std::memcpy(&n_pairs, metadata, sizeof(n_pairs));
+    if (n_pairs < 0) {
+      return false;
+    }
+    int64_t length = sizeof(int32_t);
+    for (int32_t i = 0; i < 2 * n_pairs; ++i) {
+      int32_t item_length;
+      std::memcpy(&item_length, metadata + length, sizeof(item_length));
+      if (item_length < 0) {
+        return false;
+      }
+      length += sizeof(int32_t) + item_length;
+    }
+    out->push_back('\1');
+    AppendFingerprintBytes(metadata, length, out);
+  }
+
+  out->append(reinterpret_cast<const char*>(&schema->n_children),
+              sizeof(schema->n_children));
+  for (int64_t i = 0; i < schema->n_children; ++i) {
+    if (schema->children[i] == nullptr ||
+        !AppendSchemaFingerprint(schema->children[i], recursion_level + 1, out)) {
+      return false;
+    }
+  }
+  if (schema->dictionary == nullptr) {
+    out->push_back('\0');
+  } else {
+    out->push_back('\1');
+    return AppendSchemaFingerprint(schema->dictionary, recursion_level + 1, out);
+  }
+  return true;
+}
+
+}  // namespace
+
+class SchemaImportCache::Impl {
+ public:
+  struct Entry {
+    std::shared_ptr<Schema> schema;
+    // The type of the record batches' top-level struct array
+    std::shared_ptr<DataType> type;
+  };
+
+  explicit Impl(int64_t capacity) : capacity_(capacity) {}
+
+  Result<Entry> Import(struct ArrowSchema* c_schema) {
+    std::string key;
+    if (capacity_ <= 0 ||
+        !AppendSchemaFingerprint(c_schema, /*recursion_level=*/0, &key)) {
+      ARROW_ASSIGN_OR_RAISE(auto schema, ::arrow::ImportSchema(c_schema));
+      auto type = struct_(schema->fields());
+      return Entry{std::move(schema), std::move(type)};
+    }
+
+    std::optional<Entry> cached;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = entries_.find(key);
+      if (it != entries_.end()) {
+        ++hits_;
+        cached = it->second;
+      }
+    }
+    if (cached) {
+      ArrowSchemaRelease(c_schema);
+      return *std::move(cached);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto schema, ::arrow::ImportSchema(c_schema));
+    auto type = struct_(schema->fields());
+    Entry entry{std::move(schema), std::move(type)};
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (static_cast<int64_t>(entries_.size()) >= capacity_) {
+      // A producer whose schemas keep changing gains nothing from eviction order
+      entries_.clear();
+    }
+    entries_.emplace(std::move(key), entry);
+    return entry;
+  }
+
+  int64_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int64_t>(entries_.size());
+  }
+
+  int64_t hits() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hits_;
+  }
+
+ private:
+  const int64_t capacity_;
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, Entry> entries_;
+  int64_t hits_ = 0;
+};
+
+SchemaImportCache::SchemaImportCache(int64_t capacity)
+    : impl_(std::make_unique<Impl>(capacity)) {}
+
+SchemaImportCache::~SchemaImportCache() = default;
+
+Result<std::shared_ptr<Schema>> SchemaImportCache::ImportSchema(
+    struct ArrowSchema* schema) {
+  ARROW_ASSIGN_OR_RAISE(auto entry, impl_->Import(schema));
+  return std::move(entry.schema);
+}
+
+Result<std::shared_ptr<RecordBatch>> SchemaImportCache::ImportRecordBatch(
+    struct ArrowArray* array, struct ArrowSchema* schema) {
+  auto maybe_entry = impl_->Import(schema);
+  if (!maybe_entry.ok()) {
+    ArrowArrayRelease(array);
+    return maybe_entry.status();
+  }
+  const auto& entry = *maybe_entry;
+  ArrayImporter importer(entry.type);
+  RETURN_NOT_OK(importer.Import(array));
+  return importer.MakeRecordBatch(entry.schema);
+}
+
+int64_t SchemaImportCache::size() const { return impl_->size(); }
+
+int64_t SchemaImportCache::hits() const { return impl_->hits(); }
+
 Result<std::shared_ptr<MemoryManager>> DefaultDeviceMemoryMapper(
     ArrowDeviceType device_type, int64_t device_id) {
   ARROW_ASSIGN_OR_RAISE(auto mapper,
@@ -2522,7 +2744,7 @@ Result<std::shared_ptr<ChunkedArray>> ImportDeviceChunkedArray(
 
 namespace {
 
-class AsyncRecordBatchIterator {
+class AsyncRecordBatchImporter {
  public:
   struct TaskWithMetadata {
     ArrowAsyncTask task_;
@@ -2533,30 +2755,71 @@ class AsyncRecordBatchIterator {
     State(uint64_t queue_size, DeviceMemoryMapper mapper)
         : queue_size_{queue_size}, mapper_{std::move(mapper)} {}
 
-    Result<RecordBatchWithMetadata> next() {
-      TaskWithMetadata task;
+    /// Get the next task pushed by the producer, or std::nullopt at the end of the
+    /// stream. Rather than blocking, a pending future is returned if no task is queued.
+    Future<std::optional<TaskWithMetadata>> NextTask() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!error_.ok()) {
+        return Future<std::optional<TaskWithMetadata>>::MakeFinished(error_);
+      }
+      if (!tasks_.empty()) {
+        std::optional<TaskWithMetadata> task = std::move(tasks_.front());
+        tasks_.pop();
+        return Future<std::optional<TaskWithMetadata>>::MakeFinished(std::move(task));
+      }
+      if (end_of_stream_) {
+        return Future<std::optional<TaskWithMetadata>>::MakeFinished(std::nullopt);
+      }
+      auto waiter = Future<std::optional<TaskWithMetadata>>::Make();
+      waiters_.push(waiter);
+      return waiter;
+    }
+
+    void PushTask(TaskWithMetadata task) {
+      Future<std::optional<TaskWithMetadata>> waiter;
       {
-        std::unique_lock<std::mutex> lock(mutex_);
-        cv_.wait(lock,
-                 [&] { return !error_.ok() || !batches_.empty() || end_of_stream_; });
-        if (!error_.ok()) {
-          return error_;
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (waiters_.empty()) {
+          tasks_.push(std::move(task));
+          return;
         }
+        waiter = std::move(waiters_.front());
+        waiters_.pop();
+      }
+      waiter.MarkFinished(std::make_optional(std::move(task)));
+    }
 
-        if (batches_.empty() && end_of_stream_) {
-          return IterationEnd<RecordBatchWithMetadata>();
+    /// End the stream, successfully or not, and wake up pending consumers.
+    void Finish(Status error) {
+      std::queue<Future<std::optional<TaskWithMetadata>>> waiters;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (error.ok()) {
+          end_of_stream_ = true;
+        } else {
+          error_ = error;
         }
-
-        task = std::move(batches_.front());
-        batches_.pop();
+        waiters.swap(waiters_);
       }
+      for (; !waiters.empty(); waiters.pop()) {
+        if (error.ok()) {
+          waiters.front().MarkFinished(std::nullopt);
+        } else {
+          waiters.front().MarkFinished(error);
+        }
+      }
+    }
 
+    Result<RecordBatchWithMetadata> Import(TaskWithMetadata task) {
+      // Replace the consumed task in the producer's budget
       producer_->request(producer_, 1);
       ArrowDeviceArray out;
       if (task.task_.extract_data(&task.task_, &out) != 0) {
-        std::unique_lock<std::mutex> lock(mutex_);
-        cv_.wait(lock, [&] { return !error_.ok(); });
-        return error_;
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!error_.ok()) {
+          return error_;
+        }
+        return Status::UnknownError("Failed to extract data from ArrowAsyncTask");
       }
 
       ARROW_ASSIGN_OR_RAISE(auto batch, ImportDeviceRecordBatch(&out, schema_, mapper_));
@@ -2567,40 +2830,52 @@ class AsyncRecordBatchIterator {
     const DeviceMemoryMapper mapper_;
     ArrowAsyncProducer* producer_;
     DeviceAllocationType device_type_;
+    std::shared_ptr<Schema> schema_;
 
     std::mutex mutex_;
-    std::shared_ptr<Schema> schema_;
-    std::condition_variable cv_;
-    std::queue<TaskWithMetadata> batches_;
+    std::queue<TaskWithMetadata> tasks_;
+    std::queue<Future<std::optional<TaskWithMetadata>>> waiters_;
     bool end_of_stream_ = false;
     Status error_{Status::OK()};
   };
 
-  AsyncRecordBatchIterator(uint64_t queue_size, DeviceMemoryMapper mapper)
+  AsyncRecordBatchImporter(uint64_t queue_size, DeviceMemoryMapper mapper)
       : state_{std::make_shared<State>(queue_size, std::move(mapper))} {}
 
-  explicit AsyncRecordBatchIterator(std::shared_ptr<State> state)
-      : state_{std::move(state)} {}
-
-  const std::shared_ptr<Schema>& schema() const { return state_->schema_; }
+  static Future<std::shared_ptr<AsyncRecordBatchImporter::State>> Make(
+      AsyncRecordBatchImporter& importer, struct ArrowAsyncDeviceStreamHandler* handler) {
+    auto state_fut = Future<std::shared_ptr<AsyncRecordBatchImporter::State>>::Make();
 
-  DeviceAllocationType device_type() const { return state_->device_type_; }
-
-  Result<RecordBatchWithMetadata> Next() { return state_->next(); }
-
-  static Future<std::shared_ptr<AsyncRecordBatchIterator::State>> Make(
-      AsyncRecordBatchIterator& iterator, struct ArrowAsyncDeviceStreamHandler* handler) {
-    auto iterator_fut = Future<std::shared_ptr<AsyncRecordBatchIterator::State>>::Make();
-
-    auto private_data = new PrivateData{iterator.state_};
-    private_data->fut_iterator_ = iterator_fut;
+    auto private_data = new PrivateData{importer.state_};
+    private_data->fut_state_ = state_fut;
 
     handler->private_data = private_data;
     handler->on_schema = on_schema;
     handler->on_next_task = on_next_task;
     handler->on_error = on_error;
     handler->release = release;
-    return iterator_fut;
+    return state_fut;
+  }
+
+  /// Make a generator of the imported record batches.
+  ///
+  /// Batches are extracted and imported on the executor, if any, rather than on the
+  /// producer's thread.
+  static AsyncGenerator<RecordBatchWithMetadata> MakeGenerator(
+      std::shared_ptr<State> state, internal::Executor* executor) {
+    return [state = std::move(state), executor]() {
+      auto task = state->NextTask();
+      if (executor != nullptr) {
+        task = executor->Transfer(std::move(task));
+      }
+      return task.Then([state](const std::optional<TaskWithMetadata>& task)
+                           -> Result<RecordBatchWithMetadata> {
+        if (!task.has_value()) {
+          return IterationEnd<RecordBatchWithMetadata>();
+        }
+        return state->Import(*task);
+      });
+    };
   }
 
  private:
@@ -2608,7 +2883,7 @@ class AsyncRecordBatchIterator {
     explicit PrivateData(std::shared_ptr<State> state) : state_(std::move(state)) {}
 
     std::shared_ptr<State> state_;
-    Future<std::shared_ptr<AsyncRecordBatchIterator::State>> fut_iterator_;
+    Future<std::shared_ptr<AsyncRecordBatchImporter::State>> fut_state_;
     ARROW_DISALLOW_COPY_AND_ASSIGN(PrivateData);
   };
 
@@ -2623,12 +2898,12 @@ class AsyncRecordBatchIterator {
 
     auto maybe_schema = ImportSchema(stream_schema);
     if (!maybe_schema.ok()) {
-      private_data->fut_iterator_.MarkFinished(maybe_schema.status());
+      private_data->fut_state_.MarkFinished(maybe_schema.status());
       return EINVAL;
     }
 
     private_data->state_->schema_ = maybe_schema.MoveValueUnsafe();
-    private_data->fut_iterator_.MarkFinished(private_data->state_);
+    private_data->fut_state_.MarkFinished(private_data->state_);
     self->producer->request(self->producer,
                             static_cast<int64_t>(private_data->state_->queue_size_));
     return 0;
@@ -2639,10 +2914,7 @@ class AsyncRecordBatchIterator {
     auto* private_data = reinterpret_cast<PrivateData*>(self->private_data);
 
     if (task == nullptr) {
-      std::unique_lock<std::mutex> lock(private_data->state_->mutex_);
-      private_data->state_->end_of_stream_ = true;
-      lock.unlock();
-      private_data->state_->cv_.notify_one();
+      private_data->state_->Finish(Status::OK());
       return 0;
     }
 
@@ -2650,18 +2922,14 @@ class AsyncRecordBatchIterator {
     if (metadata != nullptr) {
       auto maybe_decoded = DecodeMetadata(metadata);
       if (!maybe_decoded.ok()) {
-        private_data->state_->error_ = std::move(maybe_decoded).status();
-        private_data->state_->cv_.notify_one();
+        private_data->state_->Finish(std::move(maybe_decoded).status());
         return EINVAL;
       }
 
       kvmetadata = std::move(maybe_decoded->metadata);
     }
 
-    std::unique_lock<std::mutex> lock(private_data->state_->mutex_);
-    private_data->state_->batches_.push({*task, std::move(kvmetadata)});
-    lock.unlock();
-    private_data->state_->cv_.notify_one();
+    private_data->state_->PushTask({*task, std::move(kvmetadata)});
     return 0;
   }
 
@@ -2681,15 +2949,12 @@ class AsyncRecordBatchIterator {
         std::make_shared<AsyncErrorDetail>(code, message_str, std::move(metadata_str)),
         std::move(message_str));
 
-    if (!private_data->fut_iterator_.is_finished()) {
-      private_data->fut_iterator_.MarkFinished(error);
+    if (!private_data->fut_state_.is_finished()) {
+      private_data->fut_state_.MarkFinished(error);
       return;
     }
 
-    std::unique_lock<std::mutex> lock(private_data->state_->mutex_);
-    private_data->state_->error_ = std::move(error);
-    lock.unlock();
-    private_data->state_->cv_.notify_one();
+    private_data->state_->Finish(std::move(error));
   }
 
   static void release(ArrowAsyncDeviceStreamHandler* self) {
@@ -2699,71 +2964,144 @@ class AsyncRecordBatchIterator {
   std::shared_ptr<State> state_;
 };
 
-struct AsyncProducer {
-  struct State {
-    struct ArrowAsyncProducer producer_;
-
-    std::mutex mutex_;
-    std::condition_variable cv_;
-    uint64_t pending_requests_{0};
-    Status error_{Status::OK()};
-  };
-
-  AsyncProducer(DeviceAllocationType device_type, struct ArrowSchema* schema,
+/// Drives an AsyncGenerator on behalf of a foreign consumer.
+///
+/// The generator is only pulled while the consumer has outstanding requests, one
+/// batch at a time, so a slow consumer pauses the producer without any thread waiting
+/// for it.
+class AsyncProducer : public std::enable_shared_from_this<AsyncProducer> {
+ public:
+  AsyncProducer(AsyncGenerator<std::shared_ptr<RecordBatch>> generator,
+                DeviceAllocationType device_type,
                 struct ArrowAsyncDeviceStreamHandler* handler)
-      : handler_{handler}, state_{std::make_shared<State>()} {
-    state_->producer_.device_type = static_cast<ArrowDeviceType>(device_type);
-    state_->producer_.private_data = reinterpret_cast<void*>(state_.get());
-    state_->producer_.request = AsyncProducer::request;
-    state_->producer_.cancel = AsyncProducer::cancel;
-    handler_->producer = &state_->producer_;
-
-    if (int status = handler_->on_schema(handler_, schema) != 0) {
-      state_->error_ =
-          Status::UnknownError("Received error from handler::on_schema ", status);
+      : generator_{std::move(generator)},
+        handler_{handler},
+        done_{Future<>::Make()} {
+    producer_.device_type = static_cast<ArrowDeviceType>(device_type);
+    producer_.private_data = reinterpret_cast<void*>(this);
+    producer_.request = AsyncProducer::request;
+    producer_.cancel = AsyncProducer::cancel;
+    producer_.additional_metadata = nullptr;
+    handler_->producer = &producer_;
+  }
+
+  Future<> Start(struct ArrowSchema* schema) {
+    // The handler usually requests batches from on_schema; they are only produced
+    // once it has returned.
+    const int status = handler_->on_schema(handler_, schema);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (status != 0 && error_.ok()) {
+        error_ = Status::UnknownError("Received error from handler::on_schema ", status);
+      }
+      started_ = true;
     }
+    auto done = done_;
+    Pump();
+    return done;
   }
 
+ private:
   struct PrivateTaskData {
-    PrivateTaskData(std::shared_ptr<State> producer, std::shared_ptr<RecordBatch> record)
+    PrivateTaskData(std::shared_ptr<AsyncProducer> producer,
+                    std::shared_ptr<RecordBatch> record)
         : producer_{std::move(producer)}, record_(std::move(record)) {}
 
-    std::shared_ptr<State> producer_;
+    std::shared_ptr<AsyncProducer> producer_;
     std::shared_ptr<RecordBatch> record_;
     ARROW_DISALLOW_COPY_AND_ASSIGN(PrivateTaskData);
   };
 
-  Status operator()(const std::shared_ptr<RecordBatch>& record) {
-    std::unique_lock<std::mutex> lock(state_->mutex_);
-    if (state_->pending_requests_ == 0) {
-      state_->cv_.wait(lock, [this]() -> bool {
-        return !state_->error_.ok() || state_->pending_requests_ > 0;
-      });
+  /// Pull from the generator while there is demand, or end the stream.
+  ///
+  /// Batches that are available immediately are handled in this loop rather than
+  /// recursively, and only one thread runs the loop at a time.
+  void Pump() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (pumping_) return;
+      pumping_ = true;
     }
+    while (true) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (!started_ || finished_ || pulling_) {
+        pumping_ = false;
+        return;
+      }
+      if (!error_.ok() || end_of_stream_) {
+        finished_ = true;
+        pumping_ = false;
+        Status status = error_;
+        lock.unlock();
+        Finish(status);
+        return;
+      }
+      if (pending_requests_ == 0) {
+        pumping_ = false;
+        return;
+      }
+      pending_requests_--;
+      pulling_ = true;
+      lock.unlock();
 
-    if (!state_->error_.ok()) {
-      return state_->error_;
+      generator_().AddCallback(
+          [self = shared_from_this()](
+              const Result<std::shared_ptr<RecordBatch>>& maybe_batch) {
+            self->OnBatch(maybe_batch);
+            self->Pump();
+          });
     }
+  }
 
-    if (state_->pending_requests_ > 0) {
-      state_->pending_requests_--;
-      lock.unlock();
+  void OnBatch(const Result<std::shared_ptr<RecordBatch>>& maybe_batch) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!maybe_batch.ok() || IsIterationEnd(*maybe_batch) || !error_.ok()) {
+        if (!maybe_batch.ok() && error_.ok()) {
+          error_ = maybe_batch.status();
+        } else if (maybe_batch.ok() && IsIterationEnd(*maybe_batch)) {
+          end_of_stream_ = true;
+        }
+        pulling_ = false;
+        return;
+      }
+    }
 
-      ArrowAsyncTask task;
-      task.private_data = new PrivateTaskData{state_, record};
-      task.extract_data = AsyncProducer::extract_data;
+    ArrowAsyncTask task;
+    task.private_data = new PrivateTaskData{shared_from_this(), *maybe_batch};
+    task.extract_data = AsyncProducer::extract_data;
+    // Still marked as pulling, so the stream cannot end concurrently
+    const int status = handler_->on_next_task(handler_, &task, nullptr);
 
-      if (int status = handler_->on_next_task(handler_, &task, nullptr) != 0) {
-        delete reinterpret_cast<PrivateTaskData*>(task.private_data);
-        return Status::UnknownError("Received error from handler::on_next_task ", status);
+    std::lock_guard<std::mutex> lock(mutex_);
+    pulling_ = false;
+    if (status != 0) {
+      delete reinterpret_cast<PrivateTaskData*>(task.private_data);
+      if (error_.ok()) {
+        error_ = Status::UnknownError("Received error from handler::on_next_task ", status);
       }
     }
+  }
 
-    return Status::OK();
+  void Finish(const Status& status) {
+    if (status.ok()) {
+      const int result = handler_->on_next_task(handler_, nullptr, nullptr);
+      handler_->release(handler_);
+      if (result != 0) {
+        done_.MarkFinished(
+            Status::UnknownError("Received error from handler::on_next_task ", result));
+      } else {
+        done_.MarkFinished();
+      }
+    } else {
+      handler_->on_error(handler_, EINVAL, status.message().c_str(), nullptr);
+      handler_->release(handler_);
+      done_.MarkFinished(status);
+    }
   }
 
   static void request(struct ArrowAsyncProducer* producer, int64_t n) {
-    auto* self = reinterpret_cast<State*>(producer->private_data);
+    auto* self = reinterpret_cast<AsyncProducer*>(producer->private_data);
     {
       std::lock_guard<std::mutex> lock(self->mutex_);
       if (!self->error_.ok()) {
@@ -2771,11 +3109,11 @@ struct AsyncProducer {
       }
       self->pending_requests_ += n;
     }
-    self->cv_.notify_all();
+    self->Pump();
   }
 
   static void cancel(struct ArrowAsyncProducer* producer) {
-    auto* self = reinterpret_cast<State*>(producer->private_data);
+    auto* self = reinterpret_cast<AsyncProducer*>(producer->private_data);
     {
       std::lock_guard<std::mutex> lock(self->mutex_);
       if (!self->error_.ok()) {
@@ -2783,7 +3121,7 @@ struct AsyncProducer {
       }
       self->error_ = Status::Cancelled("Consumer requested cancellation");
     }
-    self->cv_.notify_all();
+    self->Pump();
   }
 
   static int extract_data(struct ArrowAsyncTask* task, struct ArrowDeviceArray* out) {
@@ -2802,8 +3140,19 @@ struct AsyncProducer {
     return ret;
   }
 
+  AsyncGenerator<std::shared_ptr<RecordBatch>> generator_;
   struct ArrowAsyncDeviceStreamHandler* handler_;
-  std::shared_ptr<State> state_;
+  struct ArrowAsyncProducer producer_;
+  Future<> done_;
+
+  std::mutex mutex_;
+  uint64_t pending_requests_{0};
+  bool started_ = false;
+  bool pumping_ = false;
+  bool pulling_ = false;
+  bool end_of_stream_ = false;
+  bool finished_ = false;
+  Status error_{Status::OK()};
 };
 
 }  // namespace
@@ -2811,16 +3160,12 @@ struct AsyncProducer {
 Future<AsyncRecordBatchGenerator> CreateAsyncDeviceStreamHandler(
     struct ArrowAsyncDeviceStreamHandler* handler, internal::Executor* executor,
     uint64_t queue_size, DeviceMemoryMapper mapper) {
-  auto iterator =
-      std::make_shared<AsyncRecordBatchIterator>(queue_size, std::move(mapper));
-  return AsyncRecordBatchIterator::Make(*iterator, handler)
-      .Then([executor](std::shared_ptr<AsyncRecordBatchIterator::State> state)
+  AsyncRecordBatchImporter importer(queue_size, std::move(mapper));
+  return AsyncRecordBatchImporter::Make(importer, handler)
+      .Then([executor](std::shared_ptr<AsyncRecordBatchImporter::State> state)
                 -> Result<AsyncRecordBatchGenerator> {
         AsyncRecordBatchGenerator gen{state->schema_, state->device_type_, nullptr};
-        auto it =
-            Iterator<RecordBatchWithMetadata>(AsyncRecordBatchIterator{std::move(state)});
-        ARROW_ASSIGN_OR_RAISE(gen.generator,
-                              MakeBackgroundGenerator(std::move(it), executor));
+        gen.generator = AsyncRecordBatchImporter::MakeGenerator(std::move(state), executor);
         return gen;
       });
 }
@@ -2845,22 +3190,9 @@ Future<> ExportAsyncRecordBatchReader(
     return Future<>::MakeFinished(status);
   }
 
-  return VisitAsyncGenerator(generator, AsyncProducer{device_type, &c_schema, handler})
-      .Then(
-          [handler]() -> Status {
-            int status = handler->on_next_task(handler, nullptr, nullptr);
-            handler->release(handler);
-            if (status != 0) {
-              return Status::UnknownError("Received error from handler::on_next_task ",
-                                          status);
-            }
-            return Status::OK();
-          },
-          [handler](const Status status) -> Status {
-            handler->on_error(handler, EINVAL, status.message().c_str(), nullptr);
-            handler->release(handler);
-            return status;
-          });
+  auto producer =
+      std::make_shared<AsyncProducer>(std::move(generator), device_type, handler);
+  return producer->Start(&c_schema);
 }
 
 }  // namespace arrow
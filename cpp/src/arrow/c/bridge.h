@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -167,6 +168,46 @@ ARROW_EXPORT
 Result<std::shared_ptr<RecordBatch>> ImportRecordBatch(struct ArrowArray* array,
                                                        struct ArrowSchema* schema);
 
+/// \brief EXPERIMENTAL: A cache of imported schemas.
+///
+/// Producers usually export the same schema alongside every record batch.
+/// Importing it again rebuilds all its fields and types, which dominates the
+/// cost of importing batches of wide schemas. This cache recognizes ArrowSchema
+/// structs it has already imported (same formats, names, flags and metadata
+/// throughout the tree) and reuses the previously imported Schema.
+///
+/// Extension types are resolved when a schema is first imported; later
+/// changes to the extension type registry are not seen by cached schemas.
+///
+/// This class is thread-safe.
+class ARROW_EXPORT SchemaImportCache {
+ public:
+  /// \param[in] capacity the maximum number of distinct schemas to cache
+  explicit SchemaImportCache(int64_t capacity = 16);
+  ~SchemaImportCache();
+
+  /// \brief Import C++ Schema from the C data interface, or reuse a cached one.
+  ///
+  /// The given ArrowSchema struct is released, even if this function fails.
+  Result<std::shared_ptr<Schema>> ImportSchema(struct ArrowSchema* schema);
+
+  /// \brief Import C++ record batch and its schema from the C data interface,
+  /// reusing a cached schema if possible.
+  ///
+  /// Same as arrow::ImportRecordBatch(struct ArrowArray*, struct ArrowSchema*).
+  Result<std::shared_ptr<RecordBatch>> ImportRecordBatch(struct ArrowArray* array,
+                                                         struct ArrowSchema* schema);
+
+  /// \brief The number of schemas currently cached.
+  int64_t size() const;
+  /// \brief The number of imports that reused a cached schema.
+  int64_t hits() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 /// @}
 
 /// \defgroup c-data-device-interface Functions for working with the C data device
@@ -453,8 +494,13 @@ class Executor;
 /// AsyncRecordBatchGenerator to provide an interface for the consumer to retrieve data as
 /// it is pushed to the handler.
 ///
+/// No thread blocks waiting for the producer: the generator returns pending futures
+/// that complete as tasks are pushed. Each record batch consumed is replaced with a new
+/// request to the producer, so at most queue_size batches are queued.
+///
 /// \param[in,out] handler C struct to be populated
-/// \param[in] executor the executor to use for waiting and populating record batches
+/// \param[in] executor the executor to extract and import record batches on, rather
+/// than the producer's threads; may be null
 /// \param[in] queue_size initial number of record batches to request for queueing
 /// \param[in] mapper mapping from device type and ID to memory manager
 /// \return Future that resolves to either an error or AsyncRecordBatchGenerator once a
@@ -473,6 +519,10 @@ Future<AsyncRecordBatchGenerator> CreateAsyncDeviceStreamHandler(
 /// the generator, calling the on_next_task callback. If an error occurs, on_error will be
 /// called appropriately.
 ///
+/// The generator is only pulled while the consumer has outstanding requests (see
+/// ArrowAsyncProducer::request), so a slow consumer pauses it without blocking any
+/// thread.
+///
 /// \param[in] schema the schema of the stream being exported
 /// \param[in] generator a generator that asynchronously produces record batches
 /// \param[in] device_type the device type that the record batches will be located on
@@ -146,6 +146,33 @@ static void ExportImportRecordBatch(
   state.SetItemsProcessed(state.iterations());
 }
 
+static void ExportImportRecordBatchWithSchema(
+    benchmark::State& state) {  // NOLINT non-const reference
+  struct ArrowArray c_array;
+  struct ArrowSchema c_schema;
+  auto batch = ExampleRecordBatch();
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(::arrow::ExportRecordBatch(*batch, &c_array, &c_schema));
+    ImportRecordBatch(&c_array, &c_schema).ValueOrDie();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void ExportImportRecordBatchWithSchemaCache(
+    benchmark::State& state) {  // NOLINT non-const reference
+  struct ArrowArray c_array;
+  struct ArrowSchema c_schema;
+  auto batch = ExampleRecordBatch();
+  SchemaImportCache cache;
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(::arrow::ExportRecordBatch(*batch, &c_array, &c_schema));
+    cache.ImportRecordBatch(&c_array, &c_schema).ValueOrDie();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
 BENCHMARK(ExportType);
 BENCHMARK(ExportSchema);
 BENCHMARK(ExportArray);
@@ -155,5 +182,7 @@ BENCHMARK(ExportImportType);
 BENCHMARK(ExportImportSchema);
 BENCHMARK(ExportImportArray);
 BENCHMARK(ExportImportRecordBatch);
+BENCHMARK(ExportImportRecordBatchWithSchema);
+BENCHMARK(ExportImportRecordBatchWithSchemaCache);
 
 }  // namespace arrow::benchmarks
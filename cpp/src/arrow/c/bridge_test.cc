@@ -4231,6 +4231,57 @@ TEST_F(TestArrayRoundtrip, RecordBatch) {
   }
 }
 
+TEST_F(TestArrayRoundtrip, RecordBatchWithSchemaCache) {
+  auto schema = ::arrow::schema(
+      {field("ints", int16()), field("strs", utf8()),
+       field("dict", dictionary(int8(), utf8()))},
+      key_value_metadata(kMetadataKeys1, kMetadataValues1));
+  auto batch = RecordBatch::Make(
+      schema, 3,
+      {ArrayFromJSON(int16(), "[1, 2, null]"),
+       ArrayFromJSON(utf8(), R"(["a", null, "c"])"),
+       DictArrayFromJSON(dictionary(int8(), utf8()), "[0, 1, null]", R"(["x", "y"])")});
+  auto other_schema =
+      schema->WithMetadata(key_value_metadata(kMetadataKeys2, kMetadataValues2));
+  auto other_batch = batch->ReplaceSchema(other_schema).ValueOrDie();
+
+  SchemaImportCache cache;
+  std::shared_ptr<Schema> first_schema;
+  for (int i = 0; i < 3; ++i) {
+    struct ArrowArray c_array;
+    struct ArrowSchema c_schema;
+    ASSERT_OK(ExportRecordBatch(*batch, &c_array, &c_schema));
+    ASSERT_OK_AND_ASSIGN(auto imported, cache.ImportRecordBatch(&c_array, &c_schema));
+    ASSERT_TRUE(ArrowArrayIsReleased(&c_array));
+    ASSERT_TRUE(ArrowSchemaIsReleased(&c_schema));
+    ASSERT_OK(imported->ValidateFull());
+    AssertBatchesEqual(*batch, *imported, /*check_metadata=*/true);
+    if (first_schema == nullptr) {
+      first_schema = imported->schema();
+    }
+    // The imported schema is reused
+    ASSERT_EQ(first_schema, imported->schema());
+  }
+  ASSERT_EQ(cache.size(), 1);
+  ASSERT_EQ(cache.hits(), 2);
+
+  // A schema differing only by its metadata is not mistaken for the cached one
+  struct ArrowArray c_array;
+  struct ArrowSchema c_schema;
+  ASSERT_OK(ExportRecordBatch(*other_batch, &c_array, &c_schema));
+  ASSERT_OK_AND_ASSIGN(auto imported, cache.ImportRecordBatch(&c_array, &c_schema));
+  AssertBatchesEqual(*other_batch, *imported, /*check_metadata=*/true);
+  ASSERT_EQ(cache.size(), 2);
+  ASSERT_EQ(cache.hits(), 2);
+
+  // Errors release the C structs
+  ASSERT_OK(ExportSchema(*schema, &c_schema));
+  ASSERT_OK(ExportArray(*ArrayFromJSON(int16(), "[1]"), &c_array));
+  ASSERT_RAISES(Invalid, cache.ImportRecordBatch(&c_array, &c_schema));
+  ASSERT_TRUE(ArrowArrayIsReleased(&c_array));
+  ASSERT_TRUE(ArrowSchemaIsReleased(&c_schema));
+}
+
 class TestDeviceArrayRoundtrip : public ::testing::Test {
  public:
   using ArrayFactory = std::function<Result<std::shared_ptr<Array>>()>;
@@ -5429,6 +5480,43 @@ TEST_F(TestAsyncDeviceArrayStreamRoundTrip, Simple) {
   internal::GetCpuThreadPool()->WaitForIdle();
 }
 
+TEST_F(TestAsyncDeviceArrayStreamRoundTrip, Backpressure) {
+  auto orig_schema = arrow::schema({field("ints", int32())});
+  RecordBatchVector batches;
+  for (int i = 0; i < 5; ++i) {
+    batches.push_back(MakeBatches(orig_schema, {ArrayFromJSON(int32(), "[1, 2]")})[0]);
+  }
+  int pulls = 0;
+  auto vector_gen = MakeVectorGenerator(batches);
+  AsyncGenerator<std::shared_ptr<RecordBatch>> counting_gen = [&]() {
+    ++pulls;
+    return vector_gen();
+  };
+
+  struct ArrowAsyncDeviceStreamHandler handler;
+  auto fut_gen = CreateAsyncDeviceStreamHandler(&handler, internal::GetCpuThreadPool(), 2,
+                                                DefaultDeviceMemoryMapper);
+  // Exporting does not block, even though the consumer only requested two batches
+  auto fut = ExportAsyncRecordBatchReader(orig_schema, std::move(counting_gen),
+                                          DeviceAllocationType::kCPU, &handler);
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto generator, fut_gen);
+  ASSERT_EQ(pulls, 2);
+  ASSERT_FALSE(fut.is_finished());
+
+  // Each batch consumed requests another one
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto result, generator.generator());
+  AssertBatchesEqual(*result.batch, *batches[0]);
+  ASSERT_EQ(pulls, 3);
+
+  auto collect_fut = CollectAsyncGenerator(generator.generator);
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto results, collect_fut);
+  ASSERT_EQ(results.size(), 4);
+  ASSERT_FINISHES_OK(fut);
+  ASSERT_EQ(pulls, 6);
+
+  internal::GetCpuThreadPool()->WaitForIdle();
+}
+
 TEST_F(TestAsyncDeviceArrayStreamRoundTrip, NullSchema) {
   struct ArrowAsyncDeviceStreamHandler handler;
   auto fut_gen = CreateAsyncDeviceStreamHandler(&handler, internal::GetCpuThreadPool(), 1,
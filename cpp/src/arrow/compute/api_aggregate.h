@@ -194,6 +194,23 @@ class ARROW_EXPORT TDigestOptions : public FunctionOptions {
   uint32_t min_count;
 };
 
+/// \brief Control approximate distinct count kernel behavior
+///
+/// These options apply to the "approx_count_distinct" and
+/// "approx_count_distinct_sketch" functions and their "hash_" variants, which
+/// estimate the number of distinct non-null values with a HyperLogLog sketch.
+class ARROW_EXPORT ApproxCountDistinctOptions : public FunctionOptions {
+ public:
+  explicit ApproxCountDistinctOptions(int32_t precision = 14);
+  static constexpr const char kTypeName[] = "ApproxCountDistinctOptions";
+  static ApproxCountDistinctOptions Defaults() { return ApproxCountDistinctOptions{}; }
+
+  /// Precision of the sketch, between 4 and 18. The sketch uses up to
+  /// 2^precision bytes and the relative standard error of the estimate is
+  /// about 1.04 / sqrt(2^precision), i.e. 0.8% for the default of 14.
+  int32_t precision;
+};
+
 /// \brief Control Pivot kernel behavior
 ///
 /// These options apply to the "pivot_wider" and "hash_pivot_wider" functions.
@@ -579,6 +596,21 @@ Result<Datum> TDigest(const Datum& value,
                       const TDigestOptions& options = TDigestOptions::Defaults(),
                       ExecContext* ctx = NULLPTR);
 
+/// \brief Estimate the number of distinct non-null values with a HyperLogLog sketch
+///
+/// \param[in] value input datum, expecting Array or ChunkedArray
+/// \param[in] options see ApproxCountDistinctOptions for more information
+/// \param[in] ctx the function execution context, optional
+/// \return datum of the estimated count as an Int64Scalar
+///
+/// \since 24.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> ApproxCountDistinct(
+    const Datum& value,
+    const ApproxCountDistinctOptions& options = ApproxCountDistinctOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
 /// \brief Find the first index of a value in an array.
 ///
 /// \param[in] value The array to search.
@@ -200,6 +200,22 @@ class ARROW_EXPORT MatchSubstringOptions : public FunctionOptions {
   bool ignore_case;
 };
 
+/// \brief Options for the match_any_substring function
+///
+/// \since 24.0.0
+class ARROW_EXPORT MatchAnySubstringOptions : public FunctionOptions {
+ public:
+  explicit MatchAnySubstringOptions(std::vector<std::string> patterns,
+                                    bool ignore_case = false);
+  MatchAnySubstringOptions();
+  static constexpr const char kTypeName[] = "MatchAnySubstringOptions";
+
+  /// The exact substrings to look for inside input values.
+  std::vector<std::string> patterns;
+  /// Whether to perform a case-insensitive match, only ASCII letters are folded.
+  bool ignore_case;
+};
+
 class ARROW_EXPORT SplitOptions : public FunctionOptions {
  public:
   explicit SplitOptions(int64_t max_splits = -1, bool reverse = false);
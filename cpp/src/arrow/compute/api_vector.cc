@@ -25,6 +25,7 @@
 
 #include "arrow/array/array_nested.h"
 #include "arrow/array/builder_primitive.h"
+#include "arrow/array/statistics.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/function.h"
 #include "arrow/compute/function_internal.h"
@@ -406,18 +407,39 @@ Result<std::shared_ptr<Array>> PairwiseDiff(const Array& array,
 // ----------------------------------------------------------------------
 // Filter- and take-related selection functions
 
+namespace {
+
+// Carry the bounds from the statistics of `values` over to a selection of its rows
+Datum WithSubsetStatistics(const Datum& values, Datum selected) {
+  if (!values.is_array() || !selected.is_array() ||
+      values.array()->statistics == nullptr ||
+      selected.array()->statistics != nullptr) {
+    return selected;
+  }
+  auto data = std::make_shared<ArrayData>(*selected.array());
+  data->statistics =
+      std::make_shared<ArrayStatistics>(values.array()->statistics->ForSubset());
+  return data;
+}
+
+}  // namespace
+
 Result<Datum> Filter(const Datum& values, const Datum& filter,
                      const FilterOptions& options, ExecContext* ctx) {
   // Invoke metafunction which deals with Datum kinds other than just Array,
   // ChunkedArray.
-  return CallFunction("filter", {values, filter}, &options, ctx);
+  ARROW_ASSIGN_OR_RAISE(Datum result,
+                        CallFunction("filter", {values, filter}, &options, ctx));
+  return WithSubsetStatistics(values, std::move(result));
 }
 
 Result<Datum> Take(const Datum& values, const Datum& indices, const TakeOptions& options,
                    ExecContext* ctx) {
   // Invoke metafunction which deals with Datum kinds other than just Array,
   // ChunkedArray.
-  return CallFunction("take", {values, indices}, &options, ctx);
+  ARROW_ASSIGN_OR_RAISE(Datum result,
+                        CallFunction("take", {values, indices}, &options, ctx));
+  return WithSubsetStatistics(values, std::move(result));
 }
 
 Result<std::shared_ptr<Array>> Take(const Array& values, const Array& indices,
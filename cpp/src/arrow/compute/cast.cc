@@ -17,6 +17,8 @@
 
 #include "arrow/compute/cast.h"
 
+#include <algorithm>
+#include <limits>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -25,6 +27,9 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/array/statistics.h"
+#include "arrow/array/util.h"
+#include "arrow/chunked_array.h"
 #include "arrow/compute/cast_internal.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/function_internal.h"
@@ -33,6 +38,7 @@
 #include "arrow/compute/registry.h"
 #include "arrow/compute/registry_internal.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/ree_util.h"
 #include "arrow/util/reflection_internal.h"
 
 namespace arrow {
@@ -74,6 +80,33 @@ const FunctionDoc cast_doc{"Cast values to another data type",
                            {"input"},
                            "CastOptions"};
 
+// Cast a run-end encoded array to another run-end encoded type by casting its
+// run ends and only the values referenced by its logical range
+Result<std::shared_ptr<ArrayData>> CastRunEndEncodedArray(const ArrayData& data,
+                                                          const TypeHolder& to_type,
+                                                          const CastOptions& options,
+                                                          ExecContext* ctx) {
+  const auto& ree_type = checked_cast<const RunEndEncodedType&>(*to_type);
+  const ArraySpan span(data);
+  const auto [physical_offset, physical_length] =
+      ree_util::FindPhysicalRange(span, span.offset, span.length);
+
+  CastOptions values_options = options;
+  values_options.to_type = ree_type.value_type();
+  ARROW_ASSIGN_OR_RAISE(
+      Datum values,
+      Cast(data.child_data[1]->Slice(physical_offset, physical_length), values_options,
+           ctx));
+  // Run ends are always cast safely, they must not overflow
+  ARROW_ASSIGN_OR_RAISE(
+      Datum run_ends,
+      Cast(data.child_data[0]->Slice(physical_offset, physical_length),
+           CastOptions::Safe(ree_type.run_end_type()), ctx));
+  return ArrayData::Make(to_type.GetSharedPtr(), data.length, {nullptr},
+                         {run_ends.array(), values.array()}, /*null_count=*/0,
+                         data.offset);
+}
+
 // Metafunction for dispatching to appropriate CastFunction. This corresponds
 // to the standard SQL CAST(expr AS target_type)
 class CastMetaFunction : public MetaFunction {
@@ -116,6 +149,11 @@ class CastMetaFunction : public MetaFunction {
       }
     }
 
+    if (args[0].type() && args[0].type()->id() == Type::RUN_END_ENCODED &&
+        cast_options->to_type.id() == Type::RUN_END_ENCODED) {
+      return CastRunEndEncoded(args[0], *cast_options, ctx);
+    }
+
     Result<std::shared_ptr<CastFunction>> result =
         GetCastFunction(*cast_options->to_type);
     if (!result.ok()) {
@@ -124,6 +162,40 @@ class CastMetaFunction : public MetaFunction {
     }
     return (*result)->Execute(args, options, ctx);
   }
+
+ private:
+  Result<Datum> CastRunEndEncoded(const Datum& arg, const CastOptions& options,
+                                  ExecContext* ctx) const {
+    const TypeHolder& to_type = options.to_type;
+    switch (arg.kind()) {
+      case Datum::ARRAY: {
+        ARROW_ASSIGN_OR_RAISE(
+            auto out, CastRunEndEncodedArray(*arg.array(), to_type, options, ctx));
+        return Datum(std::move(out));
+      }
+      case Datum::CHUNKED_ARRAY: {
+        ArrayVector out_chunks;
+        for (const auto& chunk : arg.chunked_array()->chunks()) {
+          ARROW_ASSIGN_OR_RAISE(
+              auto out, CastRunEndEncodedArray(*chunk->data(), to_type, options, ctx));
+          out_chunks.push_back(MakeArray(std::move(out)));
+        }
+        return std::make_shared<ChunkedArray>(std::move(out_chunks),
+                                              to_type.GetSharedPtr());
+      }
+      case Datum::SCALAR: {
+        const auto& scalar = checked_cast<const RunEndEncodedScalar&>(*arg.scalar());
+        const auto& ree_type = checked_cast<const RunEndEncodedType&>(*to_type);
+        CastOptions values_options = options;
+        values_options.to_type = ree_type.value_type();
+        ARROW_ASSIGN_OR_RAISE(Datum value, Cast(scalar.value, values_options, ctx));
+        return std::make_shared<RunEndEncodedScalar>(value.scalar(),
+                                                     to_type.GetSharedPtr());
+      }
+      default:
+        return Status::NotImplemented("Casting run-end encoded ", arg.ToString());
+    }
+  }
 };
 
 static auto kCastOptionsType = GetFunctionOptionsType<CastOptions>(
@@ -236,8 +308,76 @@ bool CastOptions::is_unsafe() const {
 
 constexpr char CastOptions::kTypeName[];
 
+namespace {
+
+// Clamp an integer statistics bound to the range of the cast's output type.
+// Returns false if the bound was changed.
+bool ClampIntegerBound(bool to_signed, ArrayStatistics::ValueType* bound) {
+  if (to_signed) {
+    if (const auto* value = std::get_if<uint64_t>(bound)) {
+      const uint64_t clamped =
+          std::min<uint64_t>(*value, std::numeric_limits<int64_t>::max());
+      const bool unchanged = clamped == *value;
+      *bound = static_cast<int64_t>(clamped);
+      return unchanged;
+    }
+  } else if (const auto* value = std::get_if<int64_t>(bound)) {
+    const int64_t clamped = std::max<int64_t>(*value, 0);
+    const bool unchanged = clamped == *value;
+    *bound = static_cast<uint64_t>(clamped);
+    return unchanged;
+  }
+  return true;
+}
+
+// The statistics of an array that still hold after it was successfully cast.
+// The minimum and maximum survive value-preserving casts only: integer to
+// integer without overflow allowed, and floating point to double.
+std::shared_ptr<ArrayStatistics> CastStatistics(const ArrayStatistics& statistics,
+                                                const DataType& from_type,
+                                                const DataType& to_type,
+                                                const CastOptions& options) {
+  auto cast = std::make_shared<ArrayStatistics>();
+  cast->row_count = statistics.row_count;
+  if (from_type.id() != Type::NA && to_type.id() != Type::NA) {
+    cast->null_count = statistics.null_count;
+  }
+  const bool int_to_int = is_integer(from_type.id()) && is_integer(to_type.id()) &&
+                          !options.allow_int_overflow;
+  const bool float_to_double =
+      is_floating(from_type.id()) && to_type.id() == Type::DOUBLE;
+  if (!int_to_int && !float_to_double) {
+    return cast;
+  }
+  cast->distinct_count = statistics.distinct_count;
+  cast->min = statistics.min;
+  cast->is_min_exact = statistics.is_min_exact;
+  cast->max = statistics.max;
+  cast->is_max_exact = statistics.is_max_exact;
+  if (int_to_int) {
+    const bool to_signed = is_signed_integer(to_type.id());
+    if (cast->min.has_value() && !ClampIntegerBound(to_signed, &*cast->min)) {
+      cast->is_min_exact = false;
+    }
+    if (cast->max.has_value() && !ClampIntegerBound(to_signed, &*cast->max)) {
+      cast->is_max_exact = false;
+    }
+  }
+  return cast;
+}
+
+}  // namespace
+
 Result<Datum> Cast(const Datum& value, const CastOptions& options, ExecContext* ctx) {
-  return CallFunction("cast", {value}, &options, ctx);
+  ARROW_ASSIGN_OR_RAISE(Datum result, CallFunction("cast", {value}, &options, ctx));
+  if (value.is_array() && result.is_array() && value.array()->statistics != nullptr &&
+      result.array()->statistics == nullptr) {
+    auto data = std::make_shared<ArrayData>(*result.array());
+    data->statistics = CastStatistics(*value.array()->statistics, *value.type(),
+                                      *result.type(), options);
+    result = std::move(data);
+  }
+  return result;
 }
 
 Result<Datum> Cast(const Datum& value, const TypeHolder& to_type,
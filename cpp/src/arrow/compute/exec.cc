@@ -20,7 +20,9 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
+#include <numeric>
 #include <sstream>
 #include <utility>
 #include <vector>
@@ -31,6 +33,7 @@
 #include "arrow/array/util.h"
 #include "arrow/buffer.h"
 #include "arrow/chunked_array.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec_internal.h"
 #include "arrow/compute/function.h"
 #include "arrow/compute/function_internal.h"
@@ -43,11 +46,14 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/cpu_info.h"
+#include "arrow/util/hash_util.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/metrics.h"
 #include "arrow/util/thread_pool.h"
 #include "arrow/util/vector.h"
 
@@ -156,7 +162,44 @@ Result<ExecBatch> ExecBatch::SelectValues(const std::vector<int>& ids) const {
     }
     selected_values.push_back(values[id]);
   }
-  return ExecBatch(std::move(selected_values), length);
+  ExecBatch selected(std::move(selected_values), length);
+  selected.selection_vector = selection_vector;
+  return selected;
+}
+
+Result<ExecBatch> ExecBatch::ApplySelection(ExecContext* ctx) const {
+  std::vector<int> ids(values.size());
+  std::iota(ids.begin(), ids.end(), 0);
+  return ApplySelection(ids, ctx);
+}
+
+Result<ExecBatch> ExecBatch::ApplySelection(const std::vector<int>& ids,
+                                            ExecContext* ctx) const {
+  if (selection_vector == nullptr) return *this;
+
+  std::vector<bool> selected(values.size(), false);
+  for (int id : ids) {
+    if (id < 0 || static_cast<size_t>(id) >= values.size()) {
+      return Status::Invalid("ExecBatch invalid value selection: ", id);
+    }
+    selected[id] = true;
+  }
+
+  const Datum indices(selection_vector->data());
+  const auto take_options = TakeOptions::NoBoundsCheck();
+  ExecBatch out = *this;
+  out.selection_vector = nullptr;
+  out.length = selection_vector->length();
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (values[i].is_scalar()) continue;
+    if (!selected[i]) {
+      out.values[i] = MakeNullScalar(values[i].type());
+      continue;
+    }
+    ARROW_ASSIGN_OR_RAISE(out.values[i],
+                          CallFunction("take", {values[i], indices}, &take_options, ctx));
+  }
+  return out;
 }
 
 namespace {
@@ -472,6 +515,13 @@ bool ExecSpanIterator::Next(ExecSpan* span) {
 
 namespace {
 
+// Count the invocations of scalar and vector kernel exec functions
+void RecordKernelExecution() {
+  static util::Counter* counter =
+      util::MetricsRegistry::Global()->GetCounter("compute.kernel_executions");
+  counter->Add();
+}
+
 struct NullGeneralization {
   enum type { PERHAPS_NULL, ALL_VALID, ALL_NULL };
 
@@ -888,6 +938,7 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
     } else if (kernel_->null_handling == NullHandling::OUTPUT_NOT_NULL) {
       result_span->null_count = 0;
     }
+    RecordKernelExecution();
     RETURN_NOT_OK(kernel_->exec(kernel_ctx_, input, out));
     // Output type didn't change
     DCHECK(out->is_array_span());
@@ -917,6 +968,7 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
         out_arr->null_count = 0;
       }
 
+      RecordKernelExecution();
       RETURN_NOT_OK(kernel_->exec(kernel_ctx_, input, &output));
 
       // Output type didn't change
@@ -1106,6 +1158,7 @@ class VectorExecutor : public KernelExecutorImpl<VectorKernel> {
     if (kernel_->null_handling == NullHandling::INTERSECTION) {
       RETURN_NOT_OK(PropagateNulls(kernel_ctx_, span, out.array_data().get()));
     }
+    RecordKernelExecution();
     RETURN_NOT_OK(kernel_->exec(kernel_ctx_, span, &out));
     return EmitResult(out.array_data(), listener);
   }
@@ -1114,9 +1167,17 @@ class VectorExecutor : public KernelExecutorImpl<VectorKernel> {
     RETURN_NOT_OK(CheckCanExecuteChunked(kernel_));
     Datum out;
     ARROW_ASSIGN_OR_RAISE(out.value, PrepareOutput(batch.length));
+    RecordKernelExecution();
     RETURN_NOT_OK(kernel_->exec_chunked(kernel_ctx_, batch, &out));
     if (out.is_array()) {
       return EmitResult(out.array(), listener);
+    } else if (kernel_->output_chunked) {
+      // Emit the chunks as the results of a chunkwise execution would be, they are
+      // wrapped into a ChunkedArray again by WrapResults()
+      for (const auto& chunk : out.chunked_array()->chunks()) {
+        RETURN_NOT_OK(EmitResult(chunk->data(), listener));
+      }
+      return Status::OK();
     } else {
       DCHECK(out.is_chunked_array());
       return EmitResult(out.chunked_array(), listener);
@@ -1340,6 +1401,74 @@ ExecContext::ExecContext(MemoryPool* pool, ::arrow::internal::Executor* executor
 
 const CpuInfo* ExecContext::cpu_info() const { return CpuInfo::GetInstance(); }
 
+void ExecContext::set_use_dispatch_cache(bool use_dispatch_cache) {
+  if (!use_dispatch_cache) {
+    dispatch_cache_.reset();
+  } else if (dispatch_cache_ == nullptr) {
+    dispatch_cache_ = std::make_shared<detail::DispatchCache>();
+  }
+}
+
+namespace detail {
+
+size_t DispatchCache::KeyHash::operator()(const KeyRef& key) const {
+  // Only hash the type ids: types differing by their parameters are rarely passed to
+  // the same function
+  size_t hash = std::hash<std::string_view>{}(key.name);
+  for (const TypeHolder& type : key.in_types) {
+    ::arrow::internal::hash_combine(hash, static_cast<int>(type.id()));
+  }
+  ::arrow::internal::hash_combine(hash, static_cast<int>(key.device_type));
+  return hash;
+}
+
+Result<DispatchCache::Entry> DispatchCache::Get(FunctionRegistry* registry,
+                                                const std::string& name,
+                                                const std::vector<TypeHolder>& in_types,
+                                                DeviceAllocationType device_type) {
+  const KeyRef key{name, in_types, device_type};
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      return it->second;
+    }
+  }
+
+  Entry entry;
+  ARROW_ASSIGN_OR_RAISE(entry.function, registry->GetFunction(name));
+  if (entry.function->kind() != Function::META) {
+    entry.in_types = in_types;
+    auto maybe_kernel = entry.function->DispatchBest(&entry.in_types, device_type);
+    if (maybe_kernel.ok()) {
+      entry.kernel = *maybe_kernel;
+    } else if (entry.function->kind() != Function::SCALAR ||
+               std::none_of(in_types.begin(), in_types.end(), [](const TypeHolder& type) {
+                 return type.id() == Type::RUN_END_ENCODED ||
+                        type.id() == Type::DICTIONARY;
+               })) {
+      return maybe_kernel.status();
+    }
+    // Otherwise scalar functions are executed on the values of run-end encoded
+    // and dictionary arguments by Function::Execute()
+  }
+
+  // The types of the key must outlive the arguments they come from
+  std::vector<TypeHolder> owned_types;
+  owned_types.reserve(in_types.size());
+  for (const TypeHolder& type : in_types) {
+    owned_types.emplace_back(type.GetSharedPtr());
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (entries_.size() >= kMaxEntries) {
+    entries_.clear();
+  }
+  entries_.emplace(Key{name, std::move(owned_types), device_type}, entry);
+  return entry;
+}
+
+}  // namespace detail
+
 // ----------------------------------------------------------------------
 // SelectionVector
 
@@ -1355,15 +1484,70 @@ SelectionVector::SelectionVector(const Array& arr) : SelectionVector(arr.data())
 int32_t SelectionVector::length() const { return static_cast<int32_t>(data_->length); }
 
 Result<std::shared_ptr<SelectionVector>> SelectionVector::FromMask(
-    const BooleanArray& arr) {
-  return Status::NotImplemented("FromMask");
+    const BooleanArray& arr, MemoryPool* pool) {
+  if (arr.length() > std::numeric_limits<int32_t>::max()) {
+    return Status::Invalid("Mask of length ", arr.length(),
+                           " is too long for a SelectionVector");
+  }
+  const int64_t num_selected = arr.true_count();
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> indices,
+                        AllocateBuffer(num_selected * sizeof(int32_t), pool));
+  auto out = indices->mutable_data_as<int32_t>();
+  const uint8_t* validity = arr.null_count() > 0 ? arr.null_bitmap_data() : nullptr;
+  ::arrow::internal::VisitSetBitRunsVoid(
+      arr.values()->data(), arr.offset(), arr.length(),
+      [&](int64_t position, int64_t length) {
+        for (int64_t i = position; i < position + length; ++i) {
+          if (validity == nullptr || bit_util::GetBit(validity, arr.offset() + i)) {
+            *out++ = static_cast<int32_t>(i);
+          }
+        }
+      });
+  return std::make_shared<SelectionVector>(
+      ArrayData::Make(int32(), num_selected, {nullptr, std::move(indices)}));
 }
 
+namespace {
+
+// CallFunction() with the function and kernel from the context's dispatch cache
+Result<Datum> CallCachedFunction(const std::string& func_name,
+                                 const std::vector<Datum>& args, int64_t passed_length,
+                                 const FunctionOptions* options, ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(auto in_types, internal::GetFunctionArgumentTypes(args));
+  ARROW_ASSIGN_OR_RAISE(auto device_type, internal::GetFunctionArgumentDeviceType(args));
+  ARROW_ASSIGN_OR_RAISE(auto entry, ctx->dispatch_cache()->Get(ctx->func_registry(),
+                                                               func_name, in_types,
+                                                               device_type));
+  // Scalar functions may execute on the dictionary of a dictionary argument
+  // instead of the dispatched kernel, see Function::Execute()
+  const bool has_dictionary_arg =
+      entry.function->kind() == Function::SCALAR &&
+      std::any_of(in_types.begin(), in_types.end(), [](const TypeHolder& type) {
+        return type.id() == Type::DICTIONARY;
+      });
+  if (entry.kernel == nullptr || has_dictionary_arg) {
+    if (passed_length == -1) {
+      return entry.function->Execute(args, options, ctx);
+    }
+    return entry.function->Execute(ExecBatch(args, passed_length), options, ctx);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto func_exec,
+                        detail::MakeFunctionExecutor(*entry.function, entry.kernel,
+                                                     std::move(entry.in_types)));
+  RETURN_NOT_OK(func_exec->Init(options, ctx));
+  return func_exec->Execute(args, passed_length);
+}
+
+}  // namespace
+
 Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum>& args,
                            const FunctionOptions* options, ExecContext* ctx) {
   if (ctx == nullptr) {
     ctx = default_exec_context();
   }
+  if (ctx->dispatch_cache() != nullptr) {
+    return CallCachedFunction(func_name, args, /*passed_length=*/-1, options, ctx);
+  }
   ARROW_ASSIGN_OR_RAISE(std::shared_ptr<const Function> func,
                         ctx->func_registry()->GetFunction(func_name));
   return func->Execute(args, options, ctx);
@@ -1379,6 +1563,9 @@ Result<Datum> CallFunction(const std::string& func_name, const ExecBatch& batch,
   if (ctx == nullptr) {
     ctx = default_exec_context();
   }
+  if (ctx->dispatch_cache() != nullptr) {
+    return CallCachedFunction(func_name, batch.values, batch.length, options, ctx);
+  }
   ARROW_ASSIGN_OR_RAISE(std::shared_ptr<const Function> func,
                         ctx->func_registry()->GetFunction(func_name));
   return func->Execute(batch, options, ctx);
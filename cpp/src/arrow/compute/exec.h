@@ -48,6 +48,10 @@ namespace compute {
 // the future once parallel execution is implemented
 static constexpr int64_t kDefaultExecChunksize = UINT16_MAX;
 
+namespace detail {
+class DispatchCache;
+}  // namespace detail
+
 /// \brief Context for expression-global variables and options used by
 /// function evaluation
 class ARROW_EXPORT ExecContext {
@@ -110,6 +114,21 @@ class ARROW_EXPORT ExecContext {
   /// set_preallocate_contiguous() for more information.
   bool preallocate_contiguous() const { return preallocate_contiguous_; }
 
+  /// \brief Set whether CallFunction() caches the functions and kernels it selects
+  ///
+  /// When enabled, the function looked up in the registry and the kernel dispatched
+  /// for each function name and argument types are kept by this context, and its
+  /// copies, for further calls with the same argument types. This saves most of the
+  /// overhead of calling functions on small batches. The cache is thread-safe.
+  void set_use_dispatch_cache(bool use_dispatch_cache);
+
+  /// \brief If CallFunction() caches the kernels it selects. See
+  /// set_use_dispatch_cache() for more information.
+  bool use_dispatch_cache() const { return dispatch_cache_ != NULLPTR; }
+
+  /// \brief The dispatch cache, null if disabled
+  detail::DispatchCache* dispatch_cache() const { return dispatch_cache_.get(); }
+
  private:
   MemoryPool* pool_;
   ::arrow::internal::Executor* executor_;
@@ -117,6 +136,7 @@ class ARROW_EXPORT ExecContext {
   int64_t exec_chunksize_ = std::numeric_limits<int64_t>::max();
   bool preallocate_contiguous_ = true;
   bool use_threads_ = true;
+  std::shared_ptr<detail::DispatchCache> dispatch_cache_;
 };
 
 // TODO: Consider standardizing on uint16 selection vectors and only use them
@@ -141,9 +161,14 @@ class ARROW_EXPORT SelectionVector {
   explicit SelectionVector(const Array& arr);
 
   /// \brief Create SelectionVector from boolean mask
-  static Result<std::shared_ptr<SelectionVector>> FromMask(const BooleanArray& arr);
+  ///
+  /// The selection holds the positions of the mask which are true; null slots
+  /// are not selected, as with FilterOptions::DROP.
+  static Result<std::shared_ptr<SelectionVector>> FromMask(
+      const BooleanArray& arr, MemoryPool* pool = default_memory_pool());
 
   const int32_t* indices() const { return indices_; }
+  const std::shared_ptr<ArrayData>& data() const { return data_; }
   int32_t length() const;
 
  private:
@@ -248,6 +273,19 @@ struct ARROW_EXPORT ExecBatch {
 
   Result<ExecBatch> SelectValues(const std::vector<int>& ids) const;
 
+  /// \brief Materialize the selection vector, if any.
+  ///
+  /// Returns a batch without a selection vector whose array values hold only the
+  /// selected rows. Scalar values are left untouched.
+  Result<ExecBatch> ApplySelection(ExecContext* ctx = NULLPTR) const;
+
+  /// \brief Materialize the selection vector for the values at `ids` only.
+  ///
+  /// The other array values are replaced by null scalars of the same type; this is
+  /// meant for consumers which only reference a subset of the values.
+  Result<ExecBatch> ApplySelection(const std::vector<int>& ids,
+                                   ExecContext* ctx = NULLPTR) const;
+
   /// \brief A convenience for returning the types from the batch.
   std::vector<TypeHolder> GetTypes() const {
     std::vector<TypeHolder> result;
@@ -20,7 +20,10 @@
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "arrow/array.h"
@@ -150,6 +153,68 @@ class ARROW_EXPORT KernelExecutor {
 
 int64_t InferBatchLength(const std::vector<Datum>& values, bool* all_same);
 
+/// \brief Make an executor of `kernel`, dispatched from `func` for `in_types`
+ARROW_EXPORT
+Result<std::shared_ptr<FunctionExecutor>> MakeFunctionExecutor(
+    const Function& func, const Kernel* kernel, std::vector<TypeHolder> in_types);
+
+/// \brief A cache of the functions and kernels selected by CallFunction() for given
+/// argument types, see ExecContext::set_use_dispatch_cache()
+class ARROW_EXPORT DispatchCache {
+ public:
+  struct Entry {
+    std::shared_ptr<const Function> function;
+    /// The dispatched kernel, null for meta functions and for scalar functions
+    /// executed on the values of run-end encoded arguments
+    const Kernel* kernel = NULLPTR;
+    /// The argument types expected by the kernel, the arguments are cast to them
+    std::vector<TypeHolder> in_types;
+  };
+
+  /// \brief Look up function `name` in `registry` and dispatch its kernel for
+  /// `in_types` on `device_type`, unless already cached
+  Result<Entry> Get(FunctionRegistry* registry, const std::string& name,
+                    const std::vector<TypeHolder>& in_types,
+                    DeviceAllocationType device_type);
+
+  /// The cache is cleared when it reaches this number of entries
+  static constexpr size_t kMaxEntries = 1024;
+
+ private:
+  struct Key {
+    std::string name;
+    std::vector<TypeHolder> in_types;
+    DeviceAllocationType device_type;
+  };
+
+  // The arguments of Get(), to look up entries without copying them into a Key
+  struct KeyRef {
+    std::string_view name;
+    const std::vector<TypeHolder>& in_types;
+    DeviceAllocationType device_type;
+  };
+
+  struct KeyHash {
+    using is_transparent = void;
+    size_t operator()(const Key& key) const {
+      return (*this)(KeyRef{key.name, key.in_types, key.device_type});
+    }
+    size_t operator()(const KeyRef& key) const;
+  };
+
+  struct KeyEqual {
+    using is_transparent = void;
+    template <typename K1, typename K2>
+    bool operator()(const K1& left, const K2& right) const {
+      return left.name == right.name && left.device_type == right.device_type &&
+             left.in_types == right.in_types;
+    }
+  };
+
+  std::mutex mutex_;
+  std::unordered_map<Key, Entry, KeyHash, KeyEqual> entries_;
+};
+
 /// \brief Populate validity bitmap with the intersection of the nullity of the
 /// arguments. If a preallocated bitmap is not provided, then one will be
 /// allocated if needed (in some cases a bitmap can be zero-copied from the
@@ -25,9 +25,11 @@
 #include "arrow/testing/random.h"
 
 #include "arrow/array/array_base.h"
+#include "arrow/array/array_run_end.h"
 #include "arrow/array/data.h"
 #include "arrow/buffer.h"
 #include "arrow/chunked_array.h"
+#include "arrow/compute/cast.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec_internal.h"
 #include "arrow/compute/function.h"
@@ -153,6 +155,42 @@ TEST(SelectionVector, Basics) {
   ASSERT_EQ(3, sel_vector->indices()[1]);
 }
 
+TEST(SelectionVector, FromMask) {
+  auto mask = ArrayFromJSON(boolean(), "[true, false, null, true, true, false, true]");
+  const auto& bool_mask = checked_cast<const BooleanArray&>(*mask);
+  ASSERT_OK_AND_ASSIGN(auto sel_vector, SelectionVector::FromMask(bool_mask));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[0, 3, 4, 6]"),
+                    *MakeArray(sel_vector->data()));
+
+  // Offsets are relative to the sliced mask
+  auto sliced = mask->Slice(2);
+  ASSERT_OK_AND_ASSIGN(sel_vector, SelectionVector::FromMask(
+                                       checked_cast<const BooleanArray&>(*sliced)));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 2, 4]"), *MakeArray(sel_vector->data()));
+}
+
+TEST(ExecBatch, ApplySelection) {
+  auto indices = ArrayFromJSON(int32(), "[1, 3]");
+  ExecBatch batch({ArrayFromJSON(int32(), "[1, 2, 3, 4]"), Datum(int32_t(5)),
+                   ArrayFromJSON(utf8(), R"(["a", "b", "c", "d"])")},
+                  /*length=*/2);
+  batch.selection_vector = std::make_shared<SelectionVector>(*indices);
+
+  ASSERT_OK_AND_ASSIGN(auto materialized, batch.ApplySelection());
+  ASSERT_EQ(nullptr, materialized.selection_vector);
+  ASSERT_EQ(2, materialized.length);
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[2, 4]"), materialized[0]);
+  AssertDatumsEqual(Datum(int32_t(5)), materialized[1]);
+  AssertDatumsEqual(ArrayFromJSON(utf8(), R"(["b", "d"])"), materialized[2]);
+
+  // Values which are not requested are replaced by nulls
+  ASSERT_OK_AND_ASSIGN(materialized, batch.ApplySelection({2}));
+  AssertDatumsEqual(Datum(MakeNullScalar(int32())), materialized[0]);
+  AssertDatumsEqual(ArrayFromJSON(utf8(), R"(["b", "d"])"), materialized[2]);
+
+  ASSERT_RAISES(Invalid, batch.ApplySelection({3}));
+}
+
 void AssertValidityZeroExtraBits(const uint8_t* data, int64_t length, int64_t offset) {
   const int64_t bit_extent = ((offset + length + 7) / 8) * 8;
   for (int64_t i = offset + length; i < bit_extent; ++i) {
@@ -1396,6 +1434,180 @@ TEST_F(TestCallScalarFunctionScalarFunction, ExecCall) {
   TestCallScalarFunctionScalarFunction::DoTest(ExecFunctionCaller::Maker);
 }
 
+class TestCallScalarFunctionDispatchCache : public TestCallScalarFunction {};
+
+TEST_F(TestCallScalarFunctionDispatchCache, CallFunction) {
+  ExecContext ctx;
+  ASSERT_FALSE(ctx.use_dispatch_cache());
+  ctx.set_use_dispatch_cache(true);
+  ASSERT_TRUE(ctx.use_dispatch_cache());
+
+  for (int i = 0; i < 2; ++i) {
+    // The kernel is selected by the argument types
+    for (const auto& input : {ArrayFromJSON(uint8(), "[1, null, 3]"),
+                              ArrayFromJSON(int32(), "[1, 2, null]"),
+                              ArrayFromJSON(float64(), "[1.5]")}) {
+      ASSERT_OK_AND_ASSIGN(Datum result, CallFunction("test_copy", {input}, &ctx));
+      AssertArraysEqual(*input, *result.make_array());
+    }
+
+    // Kernels are still initialized with the options of each call
+    ExampleOptions options(std::make_shared<Int32Scalar>(i + 2));
+    ASSERT_OK_AND_ASSIGN(Datum result,
+                         CallFunction("test_stateful",
+                                      {ArrayFromJSON(int32(), "[1, 2, null]")}, &options,
+                                      &ctx));
+    AssertArraysEqual(*ArrayFromJSON(int32(), i == 0 ? "[2, 4, null]" : "[3, 6, null]"),
+                      *result.make_array());
+
+    ExecBatch batch({Datum(std::make_shared<Int32Scalar>(5)),
+                     Datum(std::make_shared<Int32Scalar>(7))},
+                    /*length=*/1);
+    ASSERT_OK_AND_ASSIGN(result, CallFunction("test_scalar_add_int32", batch, &ctx));
+    AssertScalarsEqual(Int32Scalar(12), *result.scalar());
+
+    // Meta functions
+    auto cast_options = CastOptions::Safe(int64());
+    ASSERT_OK_AND_ASSIGN(result, CallFunction("cast", {ArrayFromJSON(int32(), "[1]")},
+                                              &cast_options, &ctx));
+    AssertArraysEqual(*ArrayFromJSON(int64(), "[1]"), *result.make_array());
+
+    // Errors aren't cached
+    ASSERT_RAISES(NotImplemented,
+                  CallFunction("test_copy", {ArrayFromJSON(int64(), "[1]")}, &ctx));
+    ASSERT_RAISES(KeyError, CallFunction("no_such_function",
+                                         {ArrayFromJSON(int64(), "[1]")}, &ctx));
+  }
+
+  // Copies of the context share its cache
+  ExecContext copy = ctx;
+  ASSERT_EQ(copy.dispatch_cache(), ctx.dispatch_cache());
+  ctx.set_use_dispatch_cache(false);
+  ASSERT_EQ(ctx.dispatch_cache(), nullptr);
+  ASSERT_TRUE(copy.use_dispatch_cache());
+}
+
+class TestCallScalarFunctionRunEndEncoded : public TestCallScalarFunction {
+ protected:
+  static std::shared_ptr<Array> RunEndEncoded(
+      int64_t length, const std::shared_ptr<DataType>& run_end_type,
+      const std::string& run_ends_json, const std::string& values_json,
+      const std::shared_ptr<DataType>& value_type = int32()) {
+    return RunEndEncodedArray::Make(length, ArrayFromJSON(run_end_type, run_ends_json),
+                                    ArrayFromJSON(value_type, values_json))
+        .ValueOrDie();
+  }
+};
+
+TEST_F(TestCallScalarFunctionRunEndEncoded, Unary) {
+  // The kernel only accepts int32 arrays, it is applied to the values of the runs
+  auto input = RunEndEncoded(10, int16(), "[2, 5, 6, 10]", "[1, 2, null, 4]");
+  for (bool use_cache : {false, true}) {
+    ExecContext ctx;
+    ctx.set_use_dispatch_cache(use_cache);
+    for (const auto& [offset, length] :
+         std::vector<std::pair<int64_t, int64_t>>{{0, 10}, {1, 4}, {3, 7}, {5, 0}}) {
+      auto sliced = input->Slice(offset, length);
+      ASSERT_OK_AND_ASSIGN(Datum result, CallFunction("test_copy", {sliced}, &ctx));
+      ASSERT_OK(result.make_array()->ValidateFull());
+      AssertArraysEqual(*sliced, *result.make_array());
+    }
+
+    auto chunked = std::make_shared<ChunkedArray>(ArrayVector{input, input->Slice(4)});
+    ASSERT_OK_AND_ASSIGN(Datum result, CallFunction("test_copy", {chunked}, &ctx));
+    AssertChunkedEqual(*chunked, *result.chunked_array());
+
+    auto empty = std::make_shared<ChunkedArray>(ArrayVector{}, input->type());
+    ASSERT_OK_AND_ASSIGN(result, CallFunction("test_copy", {empty}, &ctx));
+    ASSERT_EQ(result.chunked_array()->num_chunks(), 0);
+    AssertTypeEqual(*input->type(), *result.type());
+
+    // The values must have a kernel
+    auto int64_input = RunEndEncoded(3, int32(), "[3]", "[1]", int64());
+    ASSERT_RAISES(NotImplemented, CallFunction("test_copy", {int64_input}, &ctx));
+  }
+}
+
+TEST_F(TestCallScalarFunctionRunEndEncoded, Binary) {
+  // Arguments with different runs are aligned on the union of their run ends
+  auto left = RunEndEncoded(10, int16(), "[2, 5, 6, 10]", "[1, 2, 3, null]");
+  auto right = RunEndEncoded(10, int64(), "[3, 4, 10]", "[10, 20, 30]");
+  auto expected = RunEndEncoded(10, int16(), "[2, 3, 4, 5, 6, 10]",
+                                "[11, 12, 22, 32, 33, null]");
+  for (bool use_cache : {false, true}) {
+    ExecContext ctx;
+    ctx.set_use_dispatch_cache(use_cache);
+    ASSERT_OK_AND_ASSIGN(Datum result,
+                         CallFunction("test_scalar_add_int32", {left, right}, &ctx));
+    ASSERT_OK(result.make_array()->ValidateFull());
+    AssertArraysEqual(*expected, *result.make_array(), /*verbose=*/true);
+
+    ASSERT_OK_AND_ASSIGN(result, CallFunction("test_scalar_add_int32",
+                                              {left->Slice(3, 5), right->Slice(3, 5)},
+                                              &ctx));
+    ASSERT_OK(result.make_array()->ValidateFull());
+    AssertArraysEqual(*expected->Slice(3, 5), *result.make_array(), /*verbose=*/true);
+
+    ASSERT_RAISES(Invalid, CallFunction("test_scalar_add_int32",
+                                        {left, right->Slice(1)}, &ctx));
+    // Mixing run-end encoded and plain arrays isn't supported
+    auto plain = ArrayFromJSON(int32(), "[1, 2, 3, 4, 5, 6, 7, 8, 9, 10]");
+    ASSERT_RAISES(NotImplemented,
+                  CallFunction("test_scalar_add_int32", {left, plain}, &ctx));
+  }
+}
+
+class TestCallScalarFunctionDictionary : public TestCallScalarFunction {
+ protected:
+  static std::shared_ptr<Array> Dictionary(const std::string& indices_json,
+                                           const std::string& dictionary_json) {
+    return DictArrayFromJSON(dictionary(int8(), int32()), indices_json, dictionary_json);
+  }
+};
+
+TEST_F(TestCallScalarFunctionDictionary, Unary) {
+  // The kernel only accepts int32 arrays, it is applied to the dictionary values
+  auto input = Dictionary("[0, 1, null, 2, 1, 1, 0, 3, null, 2]", "[10, 20, null, 40]");
+  auto expected =
+      ArrayFromJSON(int32(), "[10, 20, null, null, 20, 20, 10, 40, null, null]");
+  for (bool use_cache : {false, true}) {
+    ExecContext ctx;
+    ctx.set_use_dispatch_cache(use_cache);
+    for (const auto& [offset, length] :
+         std::vector<std::pair<int64_t, int64_t>>{{0, 10}, {1, 8}, {3, 7}, {5, 0}}) {
+      ASSERT_OK_AND_ASSIGN(
+          Datum result, CallFunction("test_copy", {input->Slice(offset, length)}, &ctx));
+      ASSERT_OK(result.make_array()->ValidateFull());
+      AssertArraysEqual(*expected->Slice(offset, length), *result.make_array(),
+                        /*verbose=*/true);
+    }
+
+    auto chunked = std::make_shared<ChunkedArray>(ArrayVector{input, input->Slice(4)});
+    ASSERT_OK_AND_ASSIGN(Datum result, CallFunction("test_copy", {chunked}, &ctx));
+    AssertChunkedEqual(ChunkedArray({expected, expected->Slice(4)}),
+                       *result.chunked_array());
+
+    // Dictionaries at least as long as the array are decoded instead
+    auto short_input = Dictionary("[3, null, 0]", "[10, 20, null, 40]");
+    ASSERT_OK_AND_ASSIGN(result, CallFunction("test_copy", {short_input}, &ctx));
+    AssertArraysEqual(*ArrayFromJSON(int32(), "[40, null, 10]"), *result.make_array());
+  }
+}
+
+TEST_F(TestCallScalarFunctionDictionary, ArrayArguments) {
+  // Only a dictionary array with scalar arguments is executed on its dictionary
+  auto input = Dictionary("[0, 1, null, 1, 0, 0]", "[1, 2]");
+  auto plain = ArrayFromJSON(int32(), "[1, 2, 3, 4, 5, 6]");
+  for (bool use_cache : {false, true}) {
+    ExecContext ctx;
+    ctx.set_use_dispatch_cache(use_cache);
+    ASSERT_RAISES(NotImplemented,
+                  CallFunction("test_scalar_add_int32", {input, plain}, &ctx));
+    ASSERT_RAISES(NotImplemented,
+                  CallFunction("test_scalar_add_int32", {input, input}, &ctx));
+  }
+}
+
 TEST(Ordering, IsSuborderOf) {
   Ordering a{{SortKey{3}, SortKey{1}, SortKey{7}}};
   Ordering b{{SortKey{3}, SortKey{1}}};
@@ -24,6 +24,7 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/api_vector.h"
@@ -36,6 +37,7 @@
 #  include "arrow/ipc/reader.h"
 #  include "arrow/ipc/writer.h"
 #endif
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/hash_util.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging_internal.h"
@@ -712,6 +714,45 @@ Result<ExecBatch> MakeExecBatch(const Schema& full_schema, const Datum& partial,
   return Status::NotImplemented("MakeExecBatch from ", PrintDatum(partial));
 }
 
+namespace {
+
+Result<Datum> ExecuteCall(const Expression::Call& call, std::vector<Datum> arguments,
+                          int64_t batch_length, compute::ExecContext* exec_context) {
+  bool all_scalar = true;
+  for (const Datum& argument : arguments) {
+    all_scalar &= argument.is_scalar();
+  }
+
+  int64_t input_length;
+  if (!arguments.empty() && all_scalar) {
+    // all inputs are scalar, so use a 1-long batch to avoid
+    // computing input.length equivalent outputs
+    input_length = 1;
+  } else {
+    input_length = batch_length;
+  }
+
+  auto executor = compute::detail::KernelExecutor::MakeScalar();
+
+  compute::KernelContext kernel_context(exec_context, call.kernel);
+  kernel_context.SetState(call.kernel_state.get());
+
+  const Kernel* kernel = call.kernel;
+  std::vector<TypeHolder> types = GetTypes(arguments);
+  auto options = call.options.get();
+  RETURN_NOT_OK(executor->Init(&kernel_context, {kernel, types, options}));
+
+  compute::detail::DatumAccumulator listener;
+  RETURN_NOT_OK(executor->Execute(ExecBatch(arguments, input_length), &listener));
+  const auto out = executor->WrapResults(arguments, listener.values());
+#ifndef NDEBUG
+  DCHECK_OK(executor->CheckResultType(out, call.function_name.c_str()));
+#endif
+  return out;
+}
+
+}  // namespace
+
 Result<Datum> ExecuteScalarExpression(const Expression& expr, const Schema& full_schema,
                                       const Datum& partial_input,
                                       compute::ExecContext* exec_context) {
@@ -719,13 +760,9 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const Schema& full
   return ExecuteScalarExpression(expr, input, exec_context);
 }
 
-Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& input,
-                                      compute::ExecContext* exec_context) {
-  if (exec_context == nullptr) {
-    compute::ExecContext exec_context;
-    return ExecuteScalarExpression(expr, input, &exec_context);
-  }
+namespace {
 
+Status CheckExecutable(const Expression& expr) {
   if (!expr.IsBound()) {
     return Status::Invalid("Cannot Execute unbound expression.");
   }
@@ -734,69 +771,276 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& i
     return Status::Invalid(
         "ExecuteScalarExpression cannot Execute non-scalar expression ", expr.ToString());
   }
+  return Status::OK();
+}
 
+// Evaluate a literal or a field reference
+Result<Datum> ExecuteLeaf(const Expression& expr, const ExecBatch& input,
+                          compute::ExecContext* exec_context) {
   if (auto lit = expr.literal()) return *lit;
 
-  if (auto param = expr.parameter()) {
-    if (param->type.id() == Type::NA) {
-      return MakeNullScalar(null());
-    }
+  auto param = expr.parameter();
+  DCHECK_NE(param, nullptr);
+  if (param->type.id() == Type::NA) {
+    return MakeNullScalar(null());
+  }
 
-    Datum field = input[param->indices[0]];
-    if (param->indices.size() > 1) {
-      std::vector<int> indices(param->indices.begin() + 1, param->indices.end());
-      compute::StructFieldOptions options(std::move(indices));
-      ARROW_ASSIGN_OR_RAISE(
-          field, compute::CallFunction("struct_field", {std::move(field)}, &options));
+  Datum field = input[param->indices[0]];
+  if (param->indices.size() > 1) {
+    std::vector<int> indices(param->indices.begin() + 1, param->indices.end());
+    compute::StructFieldOptions options(std::move(indices));
+    ARROW_ASSIGN_OR_RAISE(
+        field, compute::CallFunction("struct_field", {std::move(field)}, &options,
+                                     exec_context));
+  }
+  if (!field.type()->Equals(*param->type.type)) {
+    return Status::Invalid("Referenced field ", expr.ToString(), " was ",
+                           field.type()->ToString(), " but should have been ",
+                           param->type.ToString());
+  }
+
+  return field;
+}
+
+// A list of bound expressions flattened into a sequence of steps, where identical
+// (pure) subexpressions are shared. Every step's arguments precede it.
+struct ExpressionProgram {
+  struct Step {
+    const Expression* expr;
+    // The steps producing the arguments of a call
+    std::vector<int> arguments;
+    // The last step consuming this step's result, after which it can be released
+    int last_use = -1;
+    bool pure = true;
+  };
+
+  explicit ExpressionProgram(const std::vector<Expression>& exprs) {
+    for (const Expression& expr : exprs) {
+      outputs.push_back(Add(expr));
+    }
+    for (int output : outputs) {
+      steps[output].last_use = num_steps();
     }
-    if (!field.type()->Equals(*param->type.type)) {
-      return Status::Invalid("Referenced field ", expr.ToString(), " was ",
-                             field.type()->ToString(), " but should have been ",
-                             param->type.ToString());
+  }
+
+  int num_steps() const { return static_cast<int>(steps.size()); }
+
+  int Add(const Expression& expr) {
+    auto it = ids.find(expr);
+    if (it != ids.end()) return it->second;
+
+    Step step{&expr};
+    if (auto call = expr.call()) {
+      step.pure = call->function != nullptr && call->function->is_pure();
+      for (const Expression& arg : call->arguments) {
+        int arg_id = Add(arg);
+        step.arguments.push_back(arg_id);
+        step.pure &= steps[arg_id].pure;
+      }
     }
 
-    return field;
+    const int id = num_steps();
+    for (int arg_id : step.arguments) {
+      steps[arg_id].last_use = id;
+    }
+    // Impure calls such as "random" must be evaluated at each occurrence
+    if (step.pure) ids.emplace(expr, id);
+    steps.push_back(std::move(step));
+    return id;
+  }
+
+  // Evaluate the call at step `id` over `length` rows, given the results of the
+  // previous steps. Arguments are released after their last use.
+  Status ExecuteCallStep(int id, int64_t length, std::vector<Datum>* results,
+                         compute::ExecContext* exec_context) const {
+    const auto& step = steps[id];
+    std::vector<Datum> arguments;
+    arguments.reserve(step.arguments.size());
+    for (int arg_id : step.arguments) {
+      arguments.push_back((*results)[arg_id]);
+    }
+    for (int arg_id : step.arguments) {
+      if (steps[arg_id].last_use == id) (*results)[arg_id] = Datum();
+    }
+    ARROW_ASSIGN_OR_RAISE((*results)[id], ExecuteCall(*step.expr->call(),
+                                                      std::move(arguments), length,
+                                                      exec_context));
+    return Status::OK();
   }
 
-  auto call = CallNotNull(expr);
+  std::vector<Step> steps;
+  std::vector<int> outputs;
+  std::unordered_map<Expression, int, Expression::Hash> ids;
+};
 
-  std::vector<Datum> arguments(call->arguments.size());
+constexpr int64_t kMinFusedTileRows = 4096;
+
+// Chains of scalar kernels over primitive types are evaluated tile by tile, so that
+// the intermediates of a tile stay in cache rather than making a full pass through
+// memory per kernel. Returns the number of rows per tile, or 0 if the program should
+// not be fused.
+int64_t GetFusedTileRows(const ExpressionProgram& program, const ExecBatch& input) {
+  int num_calls = 0;
+  int64_t bytes_per_row = 0;
+  for (const auto& step : program.steps) {
+    const DataType* type = step.expr->type();
+    if (type == nullptr || !(is_primitive(type->id()) || is_decimal(type->id()))) {
+      return 0;
+    }
+    if (step.expr->call()) {
+      if (!step.pure) return 0;
+      ++num_calls;
+    } else if (auto param = step.expr->parameter()) {
+      if (input[param->indices[0]].is_chunked_array()) return 0;
+    }
+    bytes_per_row +=
+        std::max(1, checked_cast<const FixedWidthType&>(*type).bit_width() / 8);
+  }
+  if (num_calls < 2) return 0;
+
+  // Leave half of the L2 cache for the kernels' inputs from the previous level
+  const int64_t cache_size =
+      ::arrow::internal::CpuInfo::GetInstance()->CacheSize(
+          ::arrow::internal::CpuInfo::CacheLevel::L2) /
+      2;
+  int64_t tile_rows = cache_size / bytes_per_row;
+  // Keep boolean tiles byte aligned
+  tile_rows = std::max(kMinFusedTileRows, tile_rows - tile_rows % 64);
+  if (input.length < 2 * tile_rows) return 0;
+  return tile_rows;
+}
 
-  bool all_scalar = true;
-  for (size_t i = 0; i < arguments.size(); ++i) {
-    ARROW_ASSIGN_OR_RAISE(
-        arguments[i], ExecuteScalarExpression(call->arguments[i], input, exec_context));
-    all_scalar &= arguments[i].is_scalar();
+Result<std::vector<Datum>> ExecuteFusedProgram(const ExpressionProgram& program,
+                                               const ExecBatch& input, int64_t tile_rows,
+                                               compute::ExecContext* exec_context) {
+  const int num_steps = program.num_steps();
+
+  // Leaves are evaluated once over the whole batch and sliced for each tile
+  std::vector<Datum> leaves(num_steps);
+  for (int id = 0; id < num_steps; ++id) {
+    if (program.steps[id].expr->call() == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(leaves[id],
+                            ExecuteLeaf(*program.steps[id].expr, input, exec_context));
+    }
   }
 
-  int64_t input_length;
-  if (!arguments.empty() && all_scalar) {
-    // all inputs are scalar, so use a 1-long batch to avoid
-    // computing input.length equivalent outputs
-    input_length = 1;
-  } else {
-    input_length = input.length;
+  std::vector<std::vector<Datum>> tiles(program.outputs.size());
+  for (int64_t offset = 0; offset < input.length; offset += tile_rows) {
+    const int64_t length = std::min(tile_rows, input.length - offset);
+    std::vector<Datum> results(num_steps);
+    for (int id = 0; id < num_steps; ++id) {
+      if (program.steps[id].expr->call() != nullptr) {
+        RETURN_NOT_OK(program.ExecuteCallStep(id, length, &results, exec_context));
+      } else if (leaves[id].is_array()) {
+        results[id] = leaves[id].array()->Slice(offset, length);
+      } else {
+        results[id] = leaves[id];
+      }
+    }
+    for (size_t i = 0; i < program.outputs.size(); ++i) {
+      tiles[i].push_back(results[program.outputs[i]]);
+    }
   }
 
-  auto executor = compute::detail::KernelExecutor::MakeScalar();
+  std::vector<Datum> out(program.outputs.size());
+  for (size_t i = 0; i < program.outputs.size(); ++i) {
+    const int output = program.outputs[i];
+    if (program.steps[output].expr->call() == nullptr) {
+      out[i] = leaves[output];
+    } else if (tiles[i][0].is_scalar()) {
+      out[i] = tiles[i][0];
+    } else {
+      ArrayVector arrays;
+      arrays.reserve(tiles[i].size());
+      for (const Datum& tile : tiles[i]) {
+        arrays.push_back(tile.make_array());
+      }
+      ARROW_ASSIGN_OR_RAISE(out[i], Concatenate(arrays, exec_context->memory_pool()));
+    }
+  }
+  return out;
+}
 
-  compute::KernelContext kernel_context(exec_context, call->kernel);
-  kernel_context.SetState(call->kernel_state.get());
+Result<std::vector<Datum>> ExecuteProgram(const ExpressionProgram& program,
+                                          const ExecBatch& input,
+                                          compute::ExecContext* exec_context) {
+  if (int64_t tile_rows = GetFusedTileRows(program, input)) {
+    return ExecuteFusedProgram(program, input, tile_rows, exec_context);
+  }
 
-  const Kernel* kernel = call->kernel;
-  std::vector<TypeHolder> types = GetTypes(arguments);
-  auto options = call->options.get();
-  RETURN_NOT_OK(executor->Init(&kernel_context, {kernel, types, options}));
+  std::vector<Datum> results(program.num_steps());
+  for (int id = 0; id < program.num_steps(); ++id) {
+    if (program.steps[id].expr->call() == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(results[id],
+                            ExecuteLeaf(*program.steps[id].expr, input, exec_context));
+    } else {
+      RETURN_NOT_OK(program.ExecuteCallStep(id, input.length, &results, exec_context));
+    }
+  }
 
-  compute::detail::DatumAccumulator listener;
-  RETURN_NOT_OK(executor->Execute(ExecBatch(arguments, input_length), &listener));
-  const auto out = executor->WrapResults(arguments, listener.values());
-#ifndef NDEBUG
-  DCHECK_OK(executor->CheckResultType(out, call->function_name.c_str()));
-#endif
+  std::vector<Datum> out;
+  out.reserve(program.outputs.size());
+  for (int output : program.outputs) {
+    out.push_back(results[output]);
+  }
   return out;
 }
 
+}  // namespace
+
+Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& input,
+                                      compute::ExecContext* exec_context) {
+  if (exec_context == nullptr) {
+    compute::ExecContext exec_context;
+    return ExecuteScalarExpression(expr, input, &exec_context);
+  }
+
+  RETURN_NOT_OK(CheckExecutable(expr));
+
+  if (input.selection_vector) {
+    // Only the fields referenced by the expression need the deferred filter applied
+    ARROW_ASSIGN_OR_RAISE(
+        ExecBatch selected,
+        input.ApplySelection(FieldIndicesInExpression(expr), exec_context));
+    return ExecuteScalarExpression(expr, selected, exec_context);
+  }
+
+  if (expr.call() == nullptr) return ExecuteLeaf(expr, input, exec_context);
+
+  // The program refers to the expressions, so they must outlive it
+  const std::vector<Expression> exprs{expr};
+  ARROW_ASSIGN_OR_RAISE(auto out,
+                        ExecuteProgram(ExpressionProgram(exprs), input, exec_context));
+  return std::move(out[0]);
+}
+
+Result<std::vector<Datum>> ExecuteScalarExpressions(const std::vector<Expression>& exprs,
+                                                    const ExecBatch& input,
+                                                    compute::ExecContext* exec_context) {
+  if (exec_context == nullptr) {
+    compute::ExecContext exec_context;
+    return ExecuteScalarExpressions(exprs, input, &exec_context);
+  }
+
+  for (const Expression& expr : exprs) {
+    RETURN_NOT_OK(CheckExecutable(expr));
+  }
+
+  if (input.selection_vector) {
+    // Apply the deferred filter once to every field referenced by any expression
+    std::vector<int> referenced;
+    for (const Expression& expr : exprs) {
+      auto indices = FieldIndicesInExpression(expr);
+      referenced.insert(referenced.end(), indices.begin(), indices.end());
+    }
+    ARROW_ASSIGN_OR_RAISE(ExecBatch selected,
+                          input.ApplySelection(referenced, exec_context));
+    return ExecuteScalarExpressions(exprs, selected, exec_context);
+  }
+
+  return ExecuteProgram(ExpressionProgram(exprs), input, exec_context);
+}
+
 namespace {
 
 std::array<std::pair<const Expression&, const Expression&>, 2>
@@ -825,6 +1069,31 @@ std::vector<FieldRef> FieldsInExpression(const Expression& expr) {
   return fields;
 }
 
+namespace {
+
+void AddFieldIndices(const Expression& expr, std::vector<int>* indices) {
+  if (expr.literal()) return;
+
+  if (auto param = expr.parameter()) {
+    if (!param->indices.empty()) indices->push_back(param->indices[0]);
+    return;
+  }
+
+  for (const Expression& arg : CallNotNull(expr)->arguments) {
+    AddFieldIndices(arg, indices);
+  }
+}
+
+}  // namespace
+
+std::vector<int> FieldIndicesInExpression(const Expression& expr) {
+  std::vector<int> indices;
+  AddFieldIndices(expr, &indices);
+  std::sort(indices.begin(), indices.end());
+  indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+  return indices;
+}
+
 bool ExpressionHasFieldRefs(const Expression& expr) {
   if (expr.literal()) return false;
 
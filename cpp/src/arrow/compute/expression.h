@@ -173,6 +173,11 @@ Expression call(std::string function, std::vector<Expression> arguments,
 ARROW_EXPORT
 std::vector<FieldRef> FieldsInExpression(const Expression&);
 
+/// Assemble the sorted, unique indices of the top-level fields referenced by a bound
+/// Expression at any depth.
+ARROW_EXPORT
+std::vector<int> FieldIndicesInExpression(const Expression&);
+
 /// Check if the expression references any fields.
 ARROW_EXPORT
 bool ExpressionHasFieldRefs(const Expression&);
@@ -247,6 +252,16 @@ ARROW_EXPORT
 Result<Datum> ExecuteScalarExpression(const Expression&, const ExecBatch& input,
                                       ExecContext* = NULLPTR);
 
+/// Execute several bound scalar expressions against the same input ExecBatch.
+///
+/// Identical subexpressions are evaluated only once across the whole list, and each
+/// intermediate result is released right after its last use. Calls to impure
+/// functions (such as "random") are evaluated at every occurrence.
+ARROW_EXPORT
+Result<std::vector<Datum>> ExecuteScalarExpressions(const std::vector<Expression>&,
+                                                    const ExecBatch& input,
+                                                    ExecContext* = NULLPTR);
+
 /// Convenience function for invoking against a RecordBatch
 ARROW_EXPORT
 Result<Datum> ExecuteScalarExpression(const Expression&, const Schema& full_schema,
@@ -33,6 +33,7 @@
 #include "arrow/compute/registry.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/matchers.h"
+#include "arrow/testing/random.h"
 
 using testing::Eq;
 using testing::HasSubstr;
@@ -1148,6 +1149,71 @@ TEST(Expression, ExecuteCallWithNoArguments) {
   EXPECT_EQ(actual.length(), kCount);
 }
 
+TEST(Expression, ExecuteScalarExpressions) {
+  auto input_schema = schema({field("a", int32()), field("b", int32())});
+  auto product = call("multiply", {field_ref("a"), field_ref("b")});
+  std::vector<Expression> exprs{
+      add(product, literal(1)), call("subtract", {product, literal(1)}),
+      greater(product, literal(10)), product, field_ref("b"), literal(true)};
+  for (auto& expr : exprs) {
+    ASSERT_OK_AND_ASSIGN(expr, expr.Bind(*input_schema));
+  }
+
+  ExecBatch batch({ArrayFromJSON(int32(), "[1, 2, null, 4]"),
+                   ArrayFromJSON(int32(), "[5, 6, 7, 8]")},
+                  /*length=*/4);
+  ASSERT_OK_AND_ASSIGN(auto results, ExecuteScalarExpressions(exprs, batch));
+  ASSERT_EQ(results.size(), exprs.size());
+  for (size_t i = 0; i < exprs.size(); ++i) {
+    ASSERT_OK_AND_ASSIGN(Datum expected, ExecuteScalarExpression(exprs[i], batch));
+    AssertDatumsEqual(expected, results[i], /*verbose=*/true);
+  }
+
+  // The selection is honoured for all expressions
+  batch.length = 2;
+  batch.selection_vector =
+      std::make_shared<SelectionVector>(*ArrayFromJSON(int32(), "[1, 3]"));
+  ASSERT_OK_AND_ASSIGN(results, ExecuteScalarExpressions(exprs, batch));
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[13, 33]"), results[0]);
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[6, 8]"), results[4]);
+
+  // Impure calls are not shared
+  ASSERT_OK_AND_ASSIGN(
+      auto random_expr,
+      call("random", {}, RandomOptions::FromSystemRandom()).Bind(*input_schema));
+  ExecBatch no_args({}, 64);
+  ASSERT_OK_AND_ASSIGN(results, ExecuteScalarExpressions({random_expr, random_expr},
+                                                         no_args));
+  ASSERT_FALSE(results[0].Equals(results[1]));
+
+  ASSERT_RAISES(Invalid, ExecuteScalarExpressions({field_ref("a")}, batch));
+}
+
+TEST(Expression, ExecuteFusedChain) {
+  // Large enough to be evaluated tile by tile
+  constexpr int64_t kLength = 1 << 20;
+  auto input_schema =
+      schema({field("a", int32()), field("b", int32()), field("c", float64())});
+  ::arrow::random::RandomArrayGenerator rng(/*seed=*/0);
+  ExecBatch batch({rng.Int32(kLength + 3, -100, 100, /*null_probability=*/0.1)
+                       ->Slice(3),
+                   rng.Int32(kLength, -100, 100, /*null_probability=*/0.1),
+                   rng.Float64(kLength, -1e4, 1e4)},
+                  kLength);
+
+  auto product = call("multiply", {field_ref("a"), field_ref("b")});
+  ASSERT_OK_AND_ASSIGN(
+      auto expr, greater(call("add", {product, literal(1)}), field_ref("c"))
+                     .Bind(*input_schema));
+  ASSERT_OK_AND_ASSIGN(Datum actual, ExecuteScalarExpression(expr, batch));
+
+  ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction("multiply", {batch[0], batch[1]}));
+  ASSERT_OK_AND_ASSIGN(expected, CallFunction("add", {expected, Datum(1)}));
+  ASSERT_OK_AND_ASSIGN(expected, Cast(expected, float64()));
+  ASSERT_OK_AND_ASSIGN(expected, CallFunction("greater", {expected, batch[2]}));
+  AssertDatumsEqual(expected, actual);
+}
+
 TEST(Expression, ExecuteChunkedArray) {
   // GH-41923: compute should generate the right result if input
   // ExecBatch is `chunked_array`.
@@ -1183,6 +1249,26 @@ TEST(Expression, ExecuteChunkedArray) {
   ])"}));
 }
 
+TEST(Expression, ExecuteWithSelectionVector) {
+  auto input_schema = schema({field("a", int32()), field("b", int32())});
+  ASSERT_OK_AND_ASSIGN(auto expr, add(field_ref("a"), literal(10)).Bind(*input_schema));
+
+  ExecBatch batch({ArrayFromJSON(int32(), "[1, 2, 3, 4]"),
+                   ArrayFromJSON(int32(), "[5, 6, 7, 8]")},
+                  /*length=*/3);
+  batch.selection_vector =
+      std::make_shared<SelectionVector>(*ArrayFromJSON(int32(), "[0, 2, 3]"));
+
+  ASSERT_OK_AND_ASSIGN(Datum res, ExecuteScalarExpression(expr, batch));
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[11, 13, 14]"), res);
+
+  EXPECT_EQ(FieldIndicesInExpression(expr), std::vector<int>{0});
+  ASSERT_OK_AND_ASSIGN(
+      expr, and_(equal(field_ref("b"), field_ref("a")), is_valid(field_ref("b")))
+                .Bind(*input_schema));
+  EXPECT_EQ(FieldIndicesInExpression(expr), (std::vector<int>{0, 1}));
+}
+
 TEST(Expression, ExecuteDictionaryTransparent) {
   ExpectExecute(
       equal(field_ref("a"), field_ref("b")),
@@ -17,11 +17,16 @@
 
 #include "arrow/compute/function.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <sstream>
 
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
+#include "arrow/chunked_array.h"
 #include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/cast.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec_internal.h"
@@ -33,6 +38,7 @@
 #include "arrow/device_allocation_type_set.h"
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/ree_util.h"
 #include "arrow/util/tracing_internal.h"
 
 namespace arrow {
@@ -121,12 +127,14 @@ Status NoMatchingKernel(const Function* func, const std::vector<TypeHolder>& typ
 
 template <typename KernelType>
 const KernelType* DispatchExactImpl(const std::vector<KernelType*>& kernels,
-                                    const std::vector<TypeHolder>& values) {
+                                    const std::vector<TypeHolder>& values,
+                                    DeviceAllocationType device_type) {
   const KernelType* kernel_matches[SimdLevel::MAX] = {nullptr};
 
   // Validate arity
   for (const auto& kernel : kernels) {
-    if (kernel->signature->MatchesInputs(values)) {
+    if (kernel->device_types.contains(device_type) &&
+        kernel->signature->MatchesInputs(values)) {
       kernel_matches[kernel->simd_level] = kernel;
     }
   }
@@ -157,25 +165,27 @@ const KernelType* DispatchExactImpl(const std::vector<KernelType*>& kernels,
 }
 
 const Kernel* DispatchExactImpl(const Function* func,
-                                const std::vector<TypeHolder>& values) {
+                                const std::vector<TypeHolder>& values,
+                                DeviceAllocationType device_type) {
   if (func->kind() == Function::SCALAR) {
     return DispatchExactImpl(checked_cast<const ScalarFunction*>(func)->kernels(),
-                             values);
+                             values, device_type);
   }
 
   if (func->kind() == Function::VECTOR) {
     return DispatchExactImpl(checked_cast<const VectorFunction*>(func)->kernels(),
-                             values);
+                             values, device_type);
   }
 
   if (func->kind() == Function::SCALAR_AGGREGATE) {
     return DispatchExactImpl(
-        checked_cast<const ScalarAggregateFunction*>(func)->kernels(), values);
+        checked_cast<const ScalarAggregateFunction*>(func)->kernels(), values,
+        device_type);
   }
 
   if (func->kind() == Function::HASH_AGGREGATE) {
     return DispatchExactImpl(checked_cast<const HashAggregateFunction*>(func)->kernels(),
-                             values);
+                             values, device_type);
   }
 
   return nullptr;
@@ -237,6 +247,16 @@ struct FunctionExecutorImpl : public FunctionExecutor {
     if (!inited) {
       ARROW_RETURN_NOT_OK(Init(NULLPTR, default_exec_context()));
     }
+    // The kernel was chosen from the argument types only: make sure it can
+    // access the arguments' memory
+    ARROW_ASSIGN_OR_RAISE(auto device_type,
+                          internal::GetFunctionArgumentDeviceType(args));
+    if (!kernel->device_types.contains(device_type)) {
+      return Status::NotImplemented(
+          "Kernel of function '", func_name, "' cannot execute on arguments of device ",
+          "type ", DeviceAllocationTypeToCStr(device_type),
+          ", copy them to a supported device first");
+    }
     ExecContext* ctx = kernel_ctx.exec_context();
     // Cast arguments if necessary
     std::vector<Datum> args_with_cast(args.size());
@@ -313,36 +333,400 @@ Result<const Kernel*> Function::DispatchBest(std::vector<TypeHolder>* values) co
   return DispatchExact(*values);
 }
 
+Result<const Kernel*> Function::DispatchBest(std::vector<TypeHolder>* values,
+                                             DeviceAllocationType device_type) const {
+  auto maybe_kernel = DispatchBest(values);
+  if (maybe_kernel.ok() && (*maybe_kernel)->device_types.contains(device_type)) {
+    return maybe_kernel;
+  }
+  if (kind_ != Function::META) {
+    // Look for a kernel of the device, for the (possibly cast) argument types
+    if (auto kernel = detail::DispatchExactImpl(this, *values, device_type)) {
+      return kernel;
+    }
+  }
+  RETURN_NOT_OK(maybe_kernel);
+  return Status::NotImplemented(
+      "Function '", name(), "' has no kernel matching input types ",
+      TypeHolder::ToString(*values), " on device type ",
+      DeviceAllocationTypeToCStr(device_type));
+}
+
 Result<std::shared_ptr<FunctionExecutor>> Function::GetBestExecutor(
     std::vector<TypeHolder> inputs) const {
-  std::unique_ptr<detail::KernelExecutor> executor;
-  if (kind() == Function::SCALAR) {
-    executor = detail::KernelExecutor::MakeScalar();
-  } else if (kind() == Function::VECTOR) {
-    executor = detail::KernelExecutor::MakeVector();
-  } else if (kind() == Function::SCALAR_AGGREGATE) {
-    executor = detail::KernelExecutor::MakeScalarAggregate();
-  } else {
+  return GetBestExecutor(std::move(inputs), DeviceAllocationType::kCPU);
+}
+
+Result<std::shared_ptr<FunctionExecutor>> Function::GetBestExecutor(
+    std::vector<TypeHolder> inputs, DeviceAllocationType device_type) const {
+  if (kind() == Function::HASH_AGGREGATE) {
     return Status::NotImplemented("Direct execution of HASH_AGGREGATE functions");
   }
+  ARROW_ASSIGN_OR_RAISE(const Kernel* kernel, DispatchBest(&inputs, device_type));
+  return detail::MakeFunctionExecutor(*this, kernel, std::move(inputs));
+}
 
-  ARROW_ASSIGN_OR_RAISE(const Kernel* kernel, DispatchBest(&inputs));
+namespace detail {
 
-  return std::make_shared<detail::FunctionExecutorImpl>(std::move(inputs), kernel,
-                                                        std::move(executor), *this);
+Result<std::shared_ptr<FunctionExecutor>> MakeFunctionExecutor(
+    const Function& func, const Kernel* kernel, std::vector<TypeHolder> in_types) {
+  std::unique_ptr<KernelExecutor> executor;
+  if (func.kind() == Function::SCALAR) {
+    executor = KernelExecutor::MakeScalar();
+  } else if (func.kind() == Function::VECTOR) {
+    executor = KernelExecutor::MakeVector();
+  } else if (func.kind() == Function::SCALAR_AGGREGATE) {
+    executor = KernelExecutor::MakeScalarAggregate();
+  } else {
+    return Status::NotImplemented("Direct execution of HASH_AGGREGATE functions");
+  }
+  return std::make_shared<FunctionExecutorImpl>(std::move(in_types), kernel,
+                                                std::move(executor), func);
 }
 
+}  // namespace detail
+
 namespace {
 
-Result<Datum> ExecuteInternal(const Function& func, std::vector<Datum> args,
-                              int64_t passed_length, const FunctionOptions* options,
-                              ExecContext* ctx) {
+bool IsRunEndEncoded(const Datum& arg) {
+  return arg.type() != nullptr && arg.type()->id() == Type::RUN_END_ENCODED;
+}
+
+int64_t RunEndAt(const ArraySpan& run_ends, int64_t i) {
+  switch (run_ends.type->id()) {
+    case Type::INT16:
+      return run_ends.GetValues<int16_t>(1)[i];
+    case Type::INT32:
+      return run_ends.GetValues<int32_t>(1)[i];
+    default:
+      DCHECK_EQ(run_ends.type->id(), Type::INT64);
+      return run_ends.GetValues<int64_t>(1)[i];
+  }
+}
+
+template <typename RunEndCType>
+std::shared_ptr<ArrayData> MakeRunEnds(std::shared_ptr<DataType> type,
+                                       const std::vector<int64_t>& run_ends) {
+  std::vector<RunEndCType> values(run_ends.begin(), run_ends.end());
+  const auto length = static_cast<int64_t>(values.size());
+  return ArrayData::Make(std::move(type), length,
+                         {nullptr, Buffer::FromVector(std::move(values))},
+                         /*null_count=*/0);
+}
+
+// Execute a scalar function on run-end encoded arrays by applying it once per
+// run: the arguments are replaced by their values and the result is re-encoded
+// with the run ends of the input. Arguments with different run ends are first
+// aligned on the union of their run ends.
+Result<Datum> ExecuteOnRunEndEncodedArrays(const Function& func,
+                                           const std::vector<Datum>& args,
+                                           const FunctionOptions* options,
+                                           ExecContext* ctx) {
+  std::vector<int> ree_args;
+  for (int i = 0; i < static_cast<int>(args.size()); ++i) {
+    if (args[i].is_array()) {
+      ree_args.push_back(i);
+    }
+  }
+  const ArrayData& first = *args[ree_args[0]].array();
+  const auto& ree_type = checked_cast<const RunEndEncodedType&>(*first.type);
+  const int64_t length = first.length;
+
+  std::vector<Datum> values_args = args;
+  std::shared_ptr<ArrayData> run_ends;
+  int64_t offset = 0;
+  if (ree_args.size() == 1) {
+    // The run ends are reused as-is, only the referenced runs are computed
+    const ArraySpan span(first);
+    const auto [physical_offset, physical_length] =
+        ree_util::FindPhysicalRange(span, span.offset, span.length);
+    run_ends = first.child_data[0]->Slice(physical_offset, physical_length);
+    values_args[ree_args[0]] =
+        first.child_data[1]->Slice(physical_offset, physical_length);
+    offset = first.offset;
+  } else {
+    std::vector<ArraySpan> spans;
+    std::vector<int64_t> physical_indices;
+    for (int i : ree_args) {
+      const ArrayData& data = *args[i].array();
+      if (data.length != length) {
+        return Status::Invalid("Run-end encoded arguments to '", func.name(),
+                               "' must all be the same length");
+      }
+      spans.emplace_back(data);
+      physical_indices.push_back(
+          ree_util::FindPhysicalIndex(spans.back(), 0, spans.back().offset));
+    }
+
+    // Merge the runs of all arguments, recording the value index of each
+    // argument in every merged run
+    std::vector<int64_t> merged_run_ends;
+    std::vector<std::vector<int64_t>> take_indices(ree_args.size());
+    int64_t logical_index = 0;
+    while (logical_index < length) {
+      int64_t run_end = length;
+      for (size_t k = 0; k < spans.size(); ++k) {
+        run_end = std::min(run_end, RunEndAt(ree_util::RunEndsArray(spans[k]),
+                                             physical_indices[k]) -
+                                        spans[k].offset);
+      }
+      merged_run_ends.push_back(run_end);
+      for (size_t k = 0; k < spans.size(); ++k) {
+        take_indices[k].push_back(physical_indices[k]);
+        if (RunEndAt(ree_util::RunEndsArray(spans[k]), physical_indices[k]) -
+                spans[k].offset ==
+            run_end) {
+          ++physical_indices[k];
+        }
+      }
+      logical_index = run_end;
+    }
+
+    const auto take_options = TakeOptions::NoBoundsCheck();
+    for (size_t k = 0; k < ree_args.size(); ++k) {
+      const ArrayData& data = *args[ree_args[k]].array();
+      const auto num_runs = static_cast<int64_t>(take_indices[k].size());
+      auto indices =
+          ArrayData::Make(int64(), num_runs,
+                          {nullptr, Buffer::FromVector(std::move(take_indices[k]))},
+                          /*null_count=*/0);
+      ARROW_ASSIGN_OR_RAISE(
+          values_args[ree_args[k]],
+          CallFunction("take", {data.child_data[1], std::move(indices)}, &take_options,
+                       ctx));
+    }
+    switch (ree_type.run_end_type()->id()) {
+      case Type::INT16:
+        run_ends = MakeRunEnds<int16_t>(ree_type.run_end_type(), merged_run_ends);
+        break;
+      case Type::INT32:
+        run_ends = MakeRunEnds<int32_t>(ree_type.run_end_type(), merged_run_ends);
+        break;
+      default:
+        run_ends = MakeRunEnds<int64_t>(ree_type.run_end_type(), merged_run_ends);
+        break;
+    }
+  }
+
+  ARROW_ASSIGN_OR_RAISE(Datum out_values, func.Execute(values_args, options, ctx));
+  DCHECK(out_values.is_array());
+  auto out_type = run_end_encoded(ree_type.run_end_type(), out_values.type());
+  return ArrayData::Make(std::move(out_type), length, {nullptr},
+                         {std::move(run_ends), out_values.array()},
+                         /*null_count=*/0, offset);
+}
+
+// Execute a scalar function which has no kernel for run-end encoded arguments,
+// see ExecuteOnRunEndEncodedArrays.
+//
+// The arguments must be run-end encoded arrays and scalars, or a single run-end
+// encoded chunked array and scalars.
+Result<Datum> ExecuteOnRunEndEncoded(const Function& func, const std::vector<Datum>& args,
+                                     const FunctionOptions* options, ExecContext* ctx,
+                                     const Status& dispatch_status) {
+  int num_arrays = 0;
+  int chunked_arg = -1;
+  for (int i = 0; i < static_cast<int>(args.size()); ++i) {
+    if (args[i].is_scalar()) {
+      continue;
+    }
+    if (!IsRunEndEncoded(args[i]) ||
+        !(args[i].is_array() || args[i].is_chunked_array())) {
+      return dispatch_status;
+    }
+    if (args[i].is_chunked_array()) {
+      chunked_arg = i;
+    }
+    ++num_arrays;
+  }
+  if (num_arrays == 0 || (chunked_arg >= 0 && num_arrays > 1)) {
+    return dispatch_status;
+  }
+  if (chunked_arg < 0) {
+    return ExecuteOnRunEndEncodedArrays(func, args, options, ctx);
+  }
+
+  const ChunkedArray& chunked = *args[chunked_arg].chunked_array();
+  std::vector<Datum> chunk_args = args;
+  std::vector<std::shared_ptr<Array>> out_chunks;
+  if (chunked.num_chunks() == 0) {
+    // Execute on an empty array to find the output type
+    ARROW_ASSIGN_OR_RAISE(chunk_args[chunked_arg],
+                          MakeEmptyArray(chunked.type(), ctx->memory_pool()));
+    ARROW_ASSIGN_OR_RAISE(Datum out,
+                          ExecuteOnRunEndEncodedArrays(func, chunk_args, options, ctx));
+    return std::make_shared<ChunkedArray>(ArrayVector{}, out.type());
+  }
+  for (const auto& chunk : chunked.chunks()) {
+    chunk_args[chunked_arg] = chunk;
+    ARROW_ASSIGN_OR_RAISE(Datum out,
+                          ExecuteOnRunEndEncodedArrays(func, chunk_args, options, ctx));
+    out_chunks.push_back(out.make_array());
+  }
+  return std::make_shared<ChunkedArray>(std::move(out_chunks));
+}
+
+Result<Datum> ExecuteDispatched(const Function& func, std::vector<Datum> args,
+                                int64_t passed_length, const FunctionOptions* options,
+                                ExecContext* ctx) {
   ARROW_ASSIGN_OR_RAISE(auto inputs, internal::GetFunctionArgumentTypes(args));
-  ARROW_ASSIGN_OR_RAISE(auto func_exec, func.GetBestExecutor(inputs));
+  ARROW_ASSIGN_OR_RAISE(auto device_type, internal::GetFunctionArgumentDeviceType(args));
+  auto maybe_func_exec = func.GetBestExecutor(inputs, device_type);
+  if (!maybe_func_exec.ok() && func.kind() == Function::SCALAR &&
+      std::any_of(args.begin(), args.end(), IsRunEndEncoded)) {
+    if (ctx == nullptr) {
+      ctx = default_exec_context();
+    }
+    return ExecuteOnRunEndEncoded(func, args, options, ctx, maybe_func_exec.status());
+  }
+  ARROW_ASSIGN_OR_RAISE(auto func_exec, std::move(maybe_func_exec));
   ARROW_RETURN_NOT_OK(func_exec->Init(options, ctx));
   return func_exec->Execute(args, passed_length);
 }
 
+// The index of the only argument which is a dictionary array or chunked array,
+// if all the other arguments are scalars, or -1
+int GetDictionaryArgument(const std::vector<Datum>& args) {
+  int dictionary_arg = -1;
+  for (int i = 0; i < static_cast<int>(args.size()); ++i) {
+    if (args[i].is_scalar()) {
+      continue;
+    }
+    if (dictionary_arg >= 0 || args[i].type() == nullptr ||
+        args[i].type()->id() != Type::DICTIONARY ||
+        !(args[i].is_array() || args[i].is_chunked_array())) {
+      return -1;
+    }
+    dictionary_arg = i;
+  }
+  return dictionary_arg;
+}
+
+// The result of a function on the values of a dictionary, with one more result
+// for a null value
+struct DictionaryResult {
+  std::shared_ptr<ArrayData> dictionary;
+  std::shared_ptr<Array> results;
+};
+
+// Replace the null indices of a dictionary array by `null_index`
+Result<std::shared_ptr<ArrayData>> FillNullIndices(std::shared_ptr<ArrayData> indices,
+                                                   int64_t null_index,
+                                                   ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(Datum wide_indices,
+                        Cast(std::move(indices), int64(), CastOptions::Safe(), ctx));
+  const ArrayData& wide = *wide_indices.array();
+  ARROW_ASSIGN_OR_RAISE(
+      auto buffer, AllocateBuffer(wide.length * sizeof(int64_t), ctx->memory_pool()));
+  const int64_t* in = wide.GetValues<int64_t>(1);
+  auto* out = buffer->mutable_data_as<int64_t>();
+  for (int64_t i = 0; i < wide.length; ++i) {
+    out[i] = wide.IsValid(i) ? in[i] : null_index;
+  }
+  return ArrayData::Make(int64(), wide.length, {nullptr, std::move(buffer)},
+                         /*null_count=*/0);
+}
+
+// Execute a scalar function on the dictionary of a dictionary array instead of
+// its decoded values, and gather the results through the indices
+Result<std::shared_ptr<Array>> ExecuteOnDictionaryArray(
+    const Function& func, std::vector<Datum> args, int dictionary_arg,
+    const std::shared_ptr<ArrayData>& data, const FunctionOptions* options,
+    ExecContext* ctx, DictionaryResult* cached) {
+  const auto& dict_type = checked_cast<const DictionaryType&>(*data->type);
+  const int64_t dictionary_length = data->dictionary->length;
+  auto execute_decoded = [&]() -> Result<std::shared_ptr<Array>> {
+    ARROW_ASSIGN_OR_RAISE(args[dictionary_arg], Cast(data, dict_type.value_type(),
+                                                     CastOptions::Safe(), ctx));
+    ARROW_ASSIGN_OR_RAISE(Datum out,
+                          ExecuteDispatched(func, std::move(args), -1, options, ctx));
+    return out.make_array();
+  };
+  if (cached->dictionary != data->dictionary) {
+    if (dictionary_length >= data->length) {
+      // Not worth it, execute on the decoded values
+      return execute_decoded();
+    }
+    // The function is also executed on a null value for the null indices, since
+    // it doesn't necessarily output null for it
+    ARROW_ASSIGN_OR_RAISE(auto null_value,
+                          MakeArrayOfNull(dict_type.value_type(), 1, ctx->memory_pool()));
+    auto dictionary_args = args;
+    ARROW_ASSIGN_OR_RAISE(
+        dictionary_args[dictionary_arg],
+        Concatenate({MakeArray(data->dictionary), std::move(null_value)},
+                    ctx->memory_pool()));
+    auto maybe_results = func.Execute(dictionary_args, options, ctx);
+    if (!maybe_results.ok()) {
+      // The error may come from a dictionary value which isn't referenced by
+      // the indices, let the decoded values decide
+      return execute_decoded();
+    }
+    cached->dictionary = data->dictionary;
+    cached->results = maybe_results->make_array();
+  }
+
+  auto indices = data->Copy();
+  indices->type = dict_type.index_type();
+  indices->dictionary = nullptr;
+  if (indices->GetNullCount() > 0 && cached->results->IsValid(dictionary_length)) {
+    ARROW_ASSIGN_OR_RAISE(indices,
+                          FillNullIndices(std::move(indices), dictionary_length, ctx));
+  }
+  const auto take_options = TakeOptions::NoBoundsCheck();
+  ARROW_ASSIGN_OR_RAISE(
+      Datum out,
+      CallFunction("take", {cached->results, std::move(indices)}, &take_options, ctx));
+  return out.make_array();
+}
+
+// Execute a scalar function on the dictionary of its only array argument, see
+// ExecuteOnDictionaryArray
+Result<Datum> ExecuteOnDictionary(const Function& func, std::vector<Datum> args,
+                                  int dictionary_arg, const FunctionOptions* options,
+                                  ExecContext* ctx) {
+  DictionaryResult cached;
+  if (args[dictionary_arg].is_array()) {
+    const auto data = args[dictionary_arg].array();
+    ARROW_ASSIGN_OR_RAISE(auto out, ExecuteOnDictionaryArray(func, std::move(args),
+                                                             dictionary_arg, data,
+                                                             options, ctx, &cached));
+    return out;
+  }
+  const auto chunked = args[dictionary_arg].chunked_array();
+  if (chunked->num_chunks() == 0) {
+    return ExecuteDispatched(func, std::move(args), -1, options, ctx);
+  }
+  // Chunks usually share their dictionary, it is only evaluated once
+  ArrayVector out_chunks;
+  for (const auto& chunk : chunked->chunks()) {
+    ARROW_ASSIGN_OR_RAISE(auto out, ExecuteOnDictionaryArray(func, args, dictionary_arg,
+                                                             chunk->data(), options, ctx,
+                                                             &cached));
+    out_chunks.push_back(std::move(out));
+  }
+  return std::make_shared<ChunkedArray>(std::move(out_chunks));
+}
+
+Result<Datum> ExecuteInternal(const Function& func, std::vector<Datum> args,
+                              int64_t passed_length, const FunctionOptions* options,
+                              ExecContext* ctx) {
+  if (func.kind() == Function::SCALAR) {
+    // Functions without a kernel for dictionaries would decode them
+    const int dictionary_arg = GetDictionaryArgument(args);
+    if (dictionary_arg >= 0) {
+      ARROW_ASSIGN_OR_RAISE(auto inputs, internal::GetFunctionArgumentTypes(args));
+      if (!func.DispatchExact(inputs).ok()) {
+        if (ctx == nullptr) {
+          ctx = default_exec_context();
+        }
+        return ExecuteOnDictionary(func, std::move(args), dictionary_arg, options, ctx);
+      }
+    }
+  }
+  return ExecuteDispatched(func, std::move(args), passed_length, options, ctx);
+}
+
 }  // namespace
 
 Result<Datum> Function::Execute(const std::vector<Datum>& args,
@@ -201,6 +201,14 @@ class ARROW_EXPORT Function {
   /// required by the kernel.
   virtual Result<const Kernel*> DispatchBest(std::vector<TypeHolder>* values) const;
 
+  /// \brief Return a best-match kernel that can execute the function given the argument
+  /// types, on arguments allocated on the given device type.
+  ///
+  /// The kernel returned by DispatchBest(values) is used if it supports the device
+  /// type, otherwise a kernel registered for the device with the same signature.
+  Result<const Kernel*> DispatchBest(std::vector<TypeHolder>* values,
+                                     DeviceAllocationType device_type) const;
+
   /// \brief Get a function executor with a best-matching kernel
   ///
   /// The returned executor will by default work with the default FunctionOptions
@@ -208,6 +216,11 @@ class ARROW_EXPORT Function {
   virtual Result<std::shared_ptr<FunctionExecutor>> GetBestExecutor(
       std::vector<TypeHolder> inputs) const;
 
+  /// \brief Get a function executor with a best-matching kernel for arguments
+  /// allocated on the given device type.
+  Result<std::shared_ptr<FunctionExecutor>> GetBestExecutor(
+      std::vector<TypeHolder> inputs, DeviceAllocationType device_type) const;
+
   /// \brief Execute the function eagerly with the passed input arguments with
   /// kernel dispatch, batch iteration, and memory allocation details taken
   /// care of.
@@ -281,7 +294,9 @@ class FunctionImpl : public Function {
 
 /// \brief Look up a kernel in a function. If no Kernel is found, nullptr is returned.
 ARROW_EXPORT
-const Kernel* DispatchExactImpl(const Function* func, const std::vector<TypeHolder>&);
+const Kernel* DispatchExactImpl(
+    const Function* func, const std::vector<TypeHolder>&,
+    DeviceAllocationType device_type = DeviceAllocationType::kCPU);
 
 /// \brief Return an error message if no Kernel is found.
 ARROW_EXPORT
@@ -149,6 +149,26 @@ void BM_ExecuteScalarFunctionOnScalar(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * N);
 }
 
+void BM_CallFunctionOnScalar(benchmark::State& state) {
+  // Call a trivial function by name, optionally caching the dispatch results
+  const int64_t N = 10000;
+  const auto scalars = MakeScalarsForIsValid(N);
+
+  ExecContext exec_context;
+  exec_context.set_use_dispatch_cache(state.range(0) != 0);
+
+  for (auto _ : state) {
+    int64_t total = 0;
+    for (const auto& scalar : scalars) {
+      const Datum result = *CallFunction("is_valid", {Datum(scalar)}, &exec_context);
+      total += result.scalar()->is_valid;
+    }
+    benchmark::DoNotOptimize(total);
+  }
+
+  state.SetItemsProcessed(state.iterations() * N);
+}
+
 void BM_ExecuteScalarKernelOnScalar(benchmark::State& state) {
   // Execute a trivial function, with argument dispatch outside the hot path
   auto function = *GetFunctionRegistry()->GetFunction("is_valid");
@@ -214,6 +234,7 @@ BENCHMARK(BM_CastDispatch);
 BENCHMARK(BM_CastDispatchBaseline);
 BENCHMARK(BM_AddDispatch);
 BENCHMARK(BM_ExecuteScalarFunctionOnScalar);
+BENCHMARK(BM_CallFunctionOnScalar)->ArgName("dispatch_cache")->Arg(0)->Arg(1);
 BENCHMARK(BM_ExecuteScalarKernelOnScalar);
 BENCHMARK(BM_ExecSpanIterator)->RangeMultiplier(4)->Range(1024, 64 * 1024);
 
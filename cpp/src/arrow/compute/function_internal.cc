@@ -19,9 +19,12 @@
 
 #include "arrow/compute/function_internal.h"
 
+#include <optional>
+
 #include "arrow/array/util.h"
 #include "arrow/compute/function.h"
 #include "arrow/compute/registry.h"
+#include "arrow/device_allocation_type_set.h"
 #include "arrow/io/memory.h"
 #ifdef ARROW_IPC
 #  include "arrow/ipc/reader.h"
@@ -143,6 +146,36 @@ Result<std::vector<TypeHolder>> GetFunctionArgumentTypes(const std::vector<Datum
   return inputs;
 }
 
+Result<DeviceAllocationType> GetFunctionArgumentDeviceType(
+    const std::vector<Datum>& args) {
+  std::optional<DeviceAllocationType> device_type;
+  auto visit = [&](const ArrayData& data) -> Status {
+    auto array_device_type = data.device_type();
+    if (array_device_type == DeviceAllocationType::kCUDA_HOST ||
+        array_device_type == DeviceAllocationType::kROCM_HOST) {
+      // Pinned host memory is accessible to CPU kernels
+      array_device_type = DeviceAllocationType::kCPU;
+    }
+    if (device_type.has_value() && *device_type != array_device_type) {
+      return Status::Invalid("Function arguments are on different device types: ",
+                             DeviceAllocationTypeToCStr(*device_type), " and ",
+                             DeviceAllocationTypeToCStr(array_device_type));
+    }
+    device_type = array_device_type;
+    return Status::OK();
+  };
+  for (const auto& arg : args) {
+    if (arg.is_array()) {
+      RETURN_NOT_OK(visit(*arg.array()));
+    } else if (arg.is_chunked_array()) {
+      for (const auto& chunk : arg.chunked_array()->chunks()) {
+        RETURN_NOT_OK(visit(*chunk->data()));
+      }
+    }
+  }
+  return device_type.value_or(DeviceAllocationType::kCPU);
+}
+
 }  // namespace internal
 }  // namespace compute
 }  // namespace arrow
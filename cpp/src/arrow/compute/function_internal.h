@@ -705,6 +705,14 @@ Status CheckAllArrayOrScalar(const std::vector<Datum>& values);
 ARROW_EXPORT
 Result<std::vector<TypeHolder>> GetFunctionArgumentTypes(const std::vector<Datum>& args);
 
+/// \brief Return the device type of the arguments' memory.
+///
+/// Scalars are on the CPU, and so is pinned host memory. All array arguments
+/// must be on the same device type.
+ARROW_EXPORT
+Result<DeviceAllocationType> GetFunctionArgumentDeviceType(
+    const std::vector<Datum>& args);
+
 }  // namespace internal
 }  // namespace compute
 }  // namespace arrow
@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "arrow/array/builder_primitive.h"
+#include "arrow/array/util.h"
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/api_vector.h"
@@ -57,6 +58,8 @@ TEST(FunctionOptions, Equality) {
   options.emplace_back(new TDigestOptions());
   options.emplace_back(
       new TDigestOptions(/*q=*/0.75, /*delta=*/50, /*buffer_size=*/1024));
+  options.emplace_back(new ApproxCountDistinctOptions());
+  options.emplace_back(new ApproxCountDistinctOptions(/*precision=*/10));
   options.emplace_back(new IndexOptions(ScalarFromJSON(int64(), "16")));
   options.emplace_back(new IndexOptions(ScalarFromJSON(boolean(), "true")));
   options.emplace_back(new IndexOptions(ScalarFromJSON(boolean(), "null")));
@@ -78,6 +81,8 @@ TEST(FunctionOptions, Equality) {
   options.emplace_back(new JoinOptions(JoinOptions::REPLACE, "replacement"));
   options.emplace_back(new MatchSubstringOptions("pattern"));
   options.emplace_back(new MatchSubstringOptions("pattern", /*ignore_case=*/true));
+  options.emplace_back(new MatchAnySubstringOptions({"a", "bc"}));
+  options.emplace_back(new MatchAnySubstringOptions({}, /*ignore_case=*/true));
   options.emplace_back(new SplitOptions());
   options.emplace_back(new SplitOptions(/*max_splits=*/2, /*reverse=*/true));
   options.emplace_back(new SplitPatternOptions("pattern"));
@@ -280,6 +285,79 @@ TEST(ScalarVectorFunction, DispatchExact) {
   CheckAddDispatch(&func2, ExecNYI);
 }
 
+namespace {
+
+// Wrap the buffers of an array as if they were allocated on another device
+std::shared_ptr<Array> AsDeviceArray(const std::shared_ptr<Array>& array,
+                                     DeviceAllocationType device_type) {
+  auto data = array->data()->Copy();
+  for (auto& buffer : data->buffers) {
+    if (buffer) {
+      buffer = std::make_shared<Buffer>(buffer->data(), buffer->size(),
+                                        default_cpu_memory_manager(),
+                                        /*parent=*/buffer, device_type);
+    }
+  }
+  return MakeArray(data);
+}
+
+}  // namespace
+
+TEST(ScalarFunction, DispatchByDevice) {
+  ScalarFunction func("scalar_test", Arity::Binary(), /*doc=*/FunctionDoc::Empty());
+  auto exec_cpu = [](KernelContext*, const ExecSpan&, ExecResult*) {
+    return Status::NotImplemented("CPU kernel");
+  };
+  auto exec_cuda = [](KernelContext*, const ExecSpan&, ExecResult*) {
+    return Status::NotImplemented("CUDA kernel");
+  };
+  ASSERT_OK(func.AddKernel({int32(), int32()}, int32(), exec_cpu));
+  ScalarKernel cuda_kernel({int32(), int32()}, int32(), exec_cuda);
+  cuda_kernel.device_types = DeviceAllocationTypeSet(DeviceAllocationType::kCUDA);
+  ASSERT_OK(func.AddKernel(cuda_kernel));
+  // A CUDA-only kernel for a signature without a CPU kernel
+  ScalarKernel cuda_only_kernel({int8(), int8()}, int8(), exec_cuda);
+  cuda_only_kernel.device_types = DeviceAllocationTypeSet(DeviceAllocationType::kCUDA);
+  ASSERT_OK(func.AddKernel(cuda_only_kernel));
+
+  std::vector<TypeHolder> types = {int32(), int32()};
+  ASSERT_OK_AND_ASSIGN(const Kernel* kernel, func.DispatchExact(types));
+  ASSERT_EQ(exec_cpu, static_cast<const ScalarKernel*>(kernel)->exec);
+  ASSERT_OK_AND_ASSIGN(kernel, func.DispatchBest(&types, DeviceAllocationType::kCPU));
+  ASSERT_EQ(exec_cpu, static_cast<const ScalarKernel*>(kernel)->exec);
+  ASSERT_OK_AND_ASSIGN(kernel, func.DispatchBest(&types, DeviceAllocationType::kCUDA));
+  ASSERT_EQ(exec_cuda, static_cast<const ScalarKernel*>(kernel)->exec);
+  ASSERT_RAISES(NotImplemented, func.DispatchBest(&types, DeviceAllocationType::kROCM));
+
+  types = {int8(), int8()};
+  ASSERT_RAISES(NotImplemented, func.DispatchExact(types));
+  ASSERT_OK_AND_ASSIGN(kernel, func.DispatchBest(&types, DeviceAllocationType::kCUDA));
+  ASSERT_EQ(exec_cuda, static_cast<const ScalarKernel*>(kernel)->exec);
+
+  // Execution dispatches on the device of the arguments
+  auto execute = [&](const std::vector<Datum>& args) {
+    return func.Execute(args, /*options=*/nullptr, /*ctx=*/nullptr);
+  };
+  auto cpu_array = ArrayFromJSON(int32(), "[1, 2]");
+  auto cuda_array = AsDeviceArray(cpu_array, DeviceAllocationType::kCUDA);
+  EXPECT_RAISES_WITH_MESSAGE_THAT(NotImplemented, ::testing::HasSubstr("CPU kernel"),
+                                  execute({cpu_array, cpu_array}));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(NotImplemented, ::testing::HasSubstr("CUDA kernel"),
+                                  execute({cuda_array, cuda_array}));
+  // Scalars and pinned host memory are CPU-accessible
+  auto pinned_array = AsDeviceArray(cpu_array, DeviceAllocationType::kCUDA_HOST);
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      NotImplemented, ::testing::HasSubstr("CPU kernel"),
+      execute({pinned_array, ScalarFromJSON(int32(), "1")}));
+  ASSERT_RAISES(Invalid, execute({cpu_array, cuda_array}));
+
+  // An executor only accepts arguments its kernel can access
+  ASSERT_OK_AND_ASSIGN(auto func_exec, func.GetBestExecutor({int32(), int32()}));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(NotImplemented,
+                                  ::testing::HasSubstr("cannot execute on arguments"),
+                                  func_exec->Execute({cuda_array, cuda_array}));
+}
+
 TEST(ArrayFunction, VarArgs) {
   ScalarFunction va_func("va_test", Arity::VarArgs(1), /*doc=*/FunctionDoc::Empty());
 
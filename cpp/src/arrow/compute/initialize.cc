@@ -56,9 +56,11 @@ Status RegisterComputeKernels() {
   internal::RegisterVectorStatistics(registry);
 
   // Aggregate functions
+  internal::RegisterHashAggregateApproxCountDistinct(registry);
   internal::RegisterHashAggregateBasic(registry);
   internal::RegisterHashAggregateNumeric(registry);
   internal::RegisterHashAggregatePivot(registry);
+  internal::RegisterScalarAggregateApproxCountDistinct(registry);
   internal::RegisterScalarAggregateBasic(registry);
   internal::RegisterScalarAggregateMode(registry);
   internal::RegisterScalarAggregatePivot(registry);
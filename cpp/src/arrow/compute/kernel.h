@@ -542,6 +542,13 @@ struct ARROW_EXPORT Kernel {
   /// so that the most optimized kernel supported on a host's processor can be chosen.
   SimdLevel::type simd_level = SimdLevel::NONE;
 
+  /// \brief The device types whose memory the kernel can read and write.
+  ///
+  /// Functions dispatch to a kernel that supports the device of the input data.
+  /// Kernels with the same signature but different device types can be registered
+  /// side by side, e.g. a CPU kernel and a CUDA kernel.
+  DeviceAllocationTypeSet device_types = DeviceAllocationTypeSet::CpuOnly();
+
   // Additional kernel-specific data
   std::shared_ptr<KernelState> data;
 };
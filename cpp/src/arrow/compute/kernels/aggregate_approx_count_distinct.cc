@@ -0,0 +1,450 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/kernels/aggregate_internal.h"
+#include "arrow/compute/kernels/common_internal.h"
+#include "arrow/compute/kernels/hash_aggregate_internal.h"
+#include "arrow/compute/registry_internal.h"
+#include "arrow/util/bit_run_reader.h"
+#include "arrow/util/hyperloglog_internal.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+namespace {
+
+using arrow::internal::HyperLogLog;
+using arrow::internal::VisitSetBitRunsVoid;
+
+// ----------------------------------------------------------------------
+// Helpers
+
+// Call visit(i, hash) for each non-null value of the array, where i is the
+// position of the value in the array
+template <typename Visit>
+Status VisitValueHashes(const ArraySpan& data, Visit&& visit) {
+  auto visit_binary = [&](auto type_tag) {
+    using Type = decltype(type_tag);
+    int64_t i = 0;
+    VisitArraySpanInline<Type>(
+        data,
+        [&](std::string_view value) {
+          visit(i++, HyperLogLog::HashBytes(value.data(),
+                                            static_cast<int64_t>(value.size())));
+        },
+        [&]() { ++i; });
+    return Status::OK();
+  };
+
+  switch (data.type->id()) {
+    case Type::BOOL: {
+      const uint8_t* values = data.buffers[1].data;
+      VisitSetBitRunsVoid(data.buffers[0].data, data.offset, data.length,
+                          [&](int64_t pos, int64_t len) {
+                            for (int64_t i = pos; i < pos + len; ++i) {
+                              const uint8_t value =
+                                  bit_util::GetBit(values, data.offset + i);
+                              visit(i, HyperLogLog::HashBytes(&value, 1));
+                            }
+                          });
+      return Status::OK();
+    }
+    case Type::BINARY:
+    case Type::STRING:
+      return visit_binary(BinaryType{});
+    case Type::LARGE_BINARY:
+    case Type::LARGE_STRING:
+      return visit_binary(LargeBinaryType{});
+    case Type::BINARY_VIEW:
+    case Type::STRING_VIEW:
+      return visit_binary(BinaryViewType{});
+    default:
+      break;
+  }
+
+  if (!is_fixed_width(data.type->id())) {
+    return Status::NotImplemented("Approximate distinct count of type ",
+                                  data.type->ToString());
+  }
+  const int byte_width = data.type->byte_width();
+  const uint8_t* values = data.buffers[1].data + data.offset * byte_width;
+  VisitSetBitRunsVoid(data.buffers[0].data, data.offset, data.length,
+                      [&](int64_t pos, int64_t len) {
+                        for (int64_t i = pos; i < pos + len; ++i) {
+                          visit(i, HyperLogLog::HashBytes(values + i * byte_width,
+                                                          byte_width));
+                        }
+                      });
+  return Status::OK();
+}
+
+// The hash of a valid scalar value
+Result<uint64_t> HashScalar(const Scalar& scalar, MemoryPool* pool) {
+  DCHECK(scalar.is_valid);
+  ARROW_ASSIGN_OR_RAISE(auto array, MakeArrayFromScalar(scalar, 1, pool));
+  uint64_t hash = 0;
+  RETURN_NOT_OK(VisitValueHashes(ArraySpan(*array->data()),
+                                 [&](int64_t, uint64_t h) { hash = h; }));
+  return hash;
+}
+
+// Call visit(i, sketch) for each non-null sketch of a binary array
+template <typename Visit>
+Status VisitSketches(const ArraySpan& data, Visit&& visit) {
+  auto visit_sketches = [&](auto type_tag) {
+    using Type = decltype(type_tag);
+    int64_t i = 0;
+    return VisitArraySpanInline<Type>(
+        data,
+        [&](std::string_view value) {
+          ARROW_ASSIGN_OR_RAISE(auto sketch, HyperLogLog::Deserialize(value));
+          visit(i++, sketch);
+          return Status::OK();
+        },
+        [&]() {
+          ++i;
+          return Status::OK();
+        });
+  };
+  if (data.type->id() == Type::LARGE_BINARY) {
+    return visit_sketches(LargeBinaryType{});
+  }
+  return visit_sketches(BinaryType{});
+}
+
+Status ValidatePrecision(const ApproxCountDistinctOptions& options) {
+  if (options.precision < HyperLogLog::kMinPrecision ||
+      options.precision > HyperLogLog::kMaxPrecision) {
+    return Status::Invalid("Approximate distinct count precision must be between ",
+                           HyperLogLog::kMinPrecision, " and ",
+                           HyperLogLog::kMaxPrecision, ", got ", options.precision);
+  }
+  return Status::OK();
+}
+
+// Sketches being merged only have a known precision once they are read, start
+// at the highest one and reduce as needed
+HyperLogLog MakeMergeSketch() { return HyperLogLog(HyperLogLog::kMaxPrecision); }
+
+// Output kind of the aggregate functions
+enum class SketchOutput : bool { Estimate, Sketch };
+
+// ----------------------------------------------------------------------
+// Scalar aggregates
+
+template <SketchOutput Output>
+struct ApproxCountDistinctImpl : public ScalarAggregator {
+  explicit ApproxCountDistinctImpl(HyperLogLog sketch) : sketch(std::move(sketch)) {}
+
+  Status Consume(KernelContext* ctx, const ExecSpan& batch) override {
+    if (batch[0].is_array()) {
+      return VisitValueHashes(batch[0].array,
+                              [&](int64_t, uint64_t hash) { sketch.Add(hash); });
+    }
+    const Scalar& input = *batch[0].scalar;
+    if (input.is_valid) {
+      ARROW_ASSIGN_OR_RAISE(auto hash, HashScalar(input, ctx->memory_pool()));
+      sketch.Add(hash);
+    }
+    return Status::OK();
+  }
+
+  Status MergeFrom(KernelContext*, KernelState&& src) override {
+    const auto& other = checked_cast<const ApproxCountDistinctImpl&>(src);
+    sketch.Merge(other.sketch);
+    return Status::OK();
+  }
+
+  Status Finalize(KernelContext*, Datum* out) override {
+    if constexpr (Output == SketchOutput::Sketch) {
+      *out = std::make_shared<BinaryScalar>(Buffer::FromString(sketch.Serialize()));
+    } else {
+      *out = Datum(sketch.Estimate());
+    }
+    return Status::OK();
+  }
+
+  HyperLogLog sketch;
+};
+
+struct ApproxCountDistinctMergeImpl
+    : public ApproxCountDistinctImpl<SketchOutput::Estimate> {
+  ApproxCountDistinctMergeImpl() : ApproxCountDistinctImpl(MakeMergeSketch()) {}
+
+  Status Consume(KernelContext*, const ExecSpan& batch) override {
+    if (batch[0].is_array()) {
+      return VisitSketches(batch[0].array, [&](int64_t, const HyperLogLog& other) {
+        sketch.Merge(other);
+      });
+    }
+    const auto& input = checked_cast<const BaseBinaryScalar&>(*batch[0].scalar);
+    if (input.is_valid) {
+      ARROW_ASSIGN_OR_RAISE(auto other, HyperLogLog::Deserialize(input.view()));
+      sketch.Merge(other);
+    }
+    return Status::OK();
+  }
+};
+
+template <SketchOutput Output>
+Result<std::unique_ptr<KernelState>> ApproxCountDistinctInit(KernelContext*,
+                                                             const KernelInitArgs& args) {
+  const auto& options = checked_cast<const ApproxCountDistinctOptions&>(*args.options);
+  RETURN_NOT_OK(ValidatePrecision(options));
+  return std::make_unique<ApproxCountDistinctImpl<Output>>(
+      HyperLogLog(options.precision));
+}
+
+Result<std::unique_ptr<KernelState>> ApproxCountDistinctMergeInit(KernelContext*,
+                                                                  const KernelInitArgs&) {
+  return std::make_unique<ApproxCountDistinctMergeImpl>();
+}
+
+std::vector<InputType> ApproxCountDistinctInputTypes() {
+  return {match::Primitive(),
+          match::BinaryLike(),
+          match::LargeBinaryLike(),
+          match::FixedSizeBinaryLike(),
+          match::SameTypeId(Type::BINARY_VIEW),
+          match::SameTypeId(Type::STRING_VIEW)};
+}
+
+// ----------------------------------------------------------------------
+// Hash aggregates
+
+template <SketchOutput Output>
+struct GroupedApproxCountDistinctImpl : public GroupedAggregator {
+  Status Init(ExecContext* ctx, const KernelInitArgs& args) override {
+    pool_ = ctx->memory_pool();
+    const auto& options = checked_cast<const ApproxCountDistinctOptions&>(*args.options);
+    RETURN_NOT_OK(ValidatePrecision(options));
+    precision_ = options.precision;
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    sketches_.resize(new_num_groups, MakeSketch());
+    return Status::OK();
+  }
+
+  Status Consume(const ExecSpan& batch) override {
+    const auto* g = batch[1].array.GetValues<uint32_t>(1);
+    if (batch[0].is_array()) {
+      return VisitValueHashes(batch[0].array, [&](int64_t i, uint64_t hash) {
+        sketches_[g[i]].Add(hash);
+      });
+    }
+    const Scalar& input = *batch[0].scalar;
+    if (input.is_valid) {
+      ARROW_ASSIGN_OR_RAISE(auto hash, HashScalar(input, pool_));
+      for (int64_t i = 0; i < batch.length; ++i) {
+        sketches_[g[i]].Add(hash);
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedApproxCountDistinctImpl*>(&raw_other);
+    const auto* g = group_id_mapping.GetValues<uint32_t>(1);
+    for (size_t other_g = 0; other_g < other->sketches_.size(); ++other_g, ++g) {
+      sketches_[*g].Merge(other->sketches_[other_g]);
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    const auto num_groups = static_cast<int64_t>(sketches_.size());
+    if constexpr (Output == SketchOutput::Sketch) {
+      BinaryBuilder builder(pool_);
+      RETURN_NOT_OK(builder.Reserve(num_groups));
+      for (const auto& sketch : sketches_) {
+        RETURN_NOT_OK(builder.Append(sketch.Serialize()));
+      }
+      sketches_.clear();
+      ARROW_ASSIGN_OR_RAISE(auto sketches, builder.Finish());
+      return sketches->data();
+    } else {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> values,
+                            AllocateBuffer(num_groups * sizeof(int64_t), pool_));
+      auto* counts = values->mutable_data_as<int64_t>();
+      for (int64_t i = 0; i < num_groups; ++i) {
+        counts[i] = sketches_[i].Estimate();
+      }
+      sketches_.clear();
+      return ArrayData::Make(int64(), num_groups, {nullptr, std::move(values)},
+                             /*null_count=*/0);
+    }
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return Output == SketchOutput::Sketch ? binary() : int64();
+  }
+
+  virtual HyperLogLog MakeSketch() const { return HyperLogLog(precision_); }
+
+  MemoryPool* pool_;
+  int precision_ = HyperLogLog::kMaxPrecision;
+  std::vector<HyperLogLog> sketches_;
+};
+
+struct GroupedApproxCountDistinctMergeImpl
+    : public GroupedApproxCountDistinctImpl<SketchOutput::Estimate> {
+  Status Init(ExecContext* ctx, const KernelInitArgs&) override {
+    pool_ = ctx->memory_pool();
+    return Status::OK();
+  }
+
+  Status Consume(const ExecSpan& batch) override {
+    const auto* g = batch[1].array.GetValues<uint32_t>(1);
+    if (batch[0].is_array()) {
+      return VisitSketches(batch[0].array, [&](int64_t i, const HyperLogLog& other) {
+        sketches_[g[i]].Merge(other);
+      });
+    }
+    const auto& input = checked_cast<const BaseBinaryScalar&>(*batch[0].scalar);
+    if (input.is_valid) {
+      ARROW_ASSIGN_OR_RAISE(auto other, HyperLogLog::Deserialize(input.view()));
+      for (int64_t i = 0; i < batch.length; ++i) {
+        sketches_[g[i]].Merge(other);
+      }
+    }
+    return Status::OK();
+  }
+
+  HyperLogLog MakeSketch() const override { return MakeMergeSketch(); }
+};
+
+// ----------------------------------------------------------------------
+// Registration
+
+const FunctionDoc approx_count_distinct_doc{
+    "Approximate number of distinct values with a HyperLogLog sketch",
+    ("Nulls are ignored. The precision of the sketch, and therefore the\n"
+     "memory use and accuracy of the estimate, are controlled by\n"
+     "ApproxCountDistinctOptions."),
+    {"array"},
+    "ApproxCountDistinctOptions"};
+
+const FunctionDoc approx_count_distinct_sketch_doc{
+    "HyperLogLog sketch of the distinct values",
+    ("Nulls are ignored. The sketch is returned as a binary scalar that can\n"
+     "be persisted and combined later with \"approx_count_distinct_merge\"."),
+    {"array"},
+    "ApproxCountDistinctOptions"};
+
+const FunctionDoc approx_count_distinct_merge_doc{
+    "Approximate number of distinct values from HyperLogLog sketches",
+    ("The input is an array of binary sketches, as returned by\n"
+     "\"approx_count_distinct_sketch\". Nulls are ignored.\n"
+     "Sketches of different precisions can be merged, the estimate then has\n"
+     "the lowest of the precisions."),
+    {"sketches"}};
+
+const FunctionDoc hash_approx_count_distinct_doc{
+    "Approximate number of distinct values in each group",
+    ("Nulls are ignored. The precision of the sketches, and therefore the\n"
+     "memory use and accuracy of the estimates, are controlled by\n"
+     "ApproxCountDistinctOptions."),
+    {"array", "group_id_array"},
+    "ApproxCountDistinctOptions"};
+
+const FunctionDoc hash_approx_count_distinct_sketch_doc{
+    "HyperLogLog sketch of the distinct values in each group",
+    ("Nulls are ignored. The sketches are returned as binary values that can\n"
+     "be persisted and combined later with\n"
+     "\"hash_approx_count_distinct_merge\"."),
+    {"array", "group_id_array"},
+    "ApproxCountDistinctOptions"};
+
+const FunctionDoc hash_approx_count_distinct_merge_doc{
+    "Approximate number of distinct values in each group from sketches",
+    ("The input is an array of binary sketches, as returned by\n"
+     "\"hash_approx_count_distinct_sketch\". Nulls are ignored."),
+    {"sketches", "group_id_array"}};
+
+}  // namespace
+
+void RegisterScalarAggregateApproxCountDistinct(FunctionRegistry* registry) {
+  static const auto default_options = ApproxCountDistinctOptions::Defaults();
+
+  auto func = std::make_shared<ScalarAggregateFunction>(
+      "approx_count_distinct", Arity::Unary(), approx_count_distinct_doc,
+      &default_options);
+  for (const auto& ty : ApproxCountDistinctInputTypes()) {
+    AddAggKernel(KernelSignature::Make({ty}, int64()),
+                 ApproxCountDistinctInit<SketchOutput::Estimate>, func.get());
+  }
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+
+  func = std::make_shared<ScalarAggregateFunction>(
+      "approx_count_distinct_sketch", Arity::Unary(), approx_count_distinct_sketch_doc,
+      &default_options);
+  for (const auto& ty : ApproxCountDistinctInputTypes()) {
+    AddAggKernel(KernelSignature::Make({ty}, binary()),
+                 ApproxCountDistinctInit<SketchOutput::Sketch>, func.get());
+  }
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+
+  func = std::make_shared<ScalarAggregateFunction>(
+      "approx_count_distinct_merge", Arity::Unary(), approx_count_distinct_merge_doc);
+  for (const auto& ty : {binary(), large_binary()}) {
+    AddAggKernel(KernelSignature::Make({ty}, int64()), ApproxCountDistinctMergeInit,
+                 func.get());
+  }
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+}
+
+void RegisterHashAggregateApproxCountDistinct(FunctionRegistry* registry) {
+  static const auto default_options = ApproxCountDistinctOptions::Defaults();
+
+  auto func = std::make_shared<HashAggregateFunction>(
+      "hash_approx_count_distinct", Arity::Binary(), hash_approx_count_distinct_doc,
+      &default_options);
+  for (const auto& ty : ApproxCountDistinctInputTypes()) {
+    DCHECK_OK(func->AddKernel(MakeKernel(
+        ty, HashAggregateInit<GroupedApproxCountDistinctImpl<SketchOutput::Estimate>>)));
+  }
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+
+  func = std::make_shared<HashAggregateFunction>(
+      "hash_approx_count_distinct_sketch", Arity::Binary(),
+      hash_approx_count_distinct_sketch_doc, &default_options);
+  for (const auto& ty : ApproxCountDistinctInputTypes()) {
+    DCHECK_OK(func->AddKernel(MakeKernel(
+        ty, HashAggregateInit<GroupedApproxCountDistinctImpl<SketchOutput::Sketch>>)));
+  }
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+
+  func = std::make_shared<HashAggregateFunction>("hash_approx_count_distinct_merge",
+                                                 Arity::Binary(),
+                                                 hash_approx_count_distinct_merge_doc);
+  for (const auto& ty : {binary(), large_binary()}) {
+    DCHECK_OK(func->AddKernel(MakeKernel(
+        InputType(ty), HashAggregateInit<GroupedApproxCountDistinctMergeImpl>)));
+  }
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
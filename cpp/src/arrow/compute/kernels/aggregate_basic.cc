@@ -24,6 +24,7 @@
 #include "arrow/compute/registry_internal.h"
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/hashing.h"
+#include "arrow/util/ree_util.h"
 
 // Include templated definitions for aggregate kernels that must compiled here
 // with the SIMD level configured for this compilation unit in the build.
@@ -103,7 +104,10 @@ struct CountImpl : public ScalarAggregator {
       this->non_nulls += batch.length;
     } else if (batch[0].is_array()) {
       const ArraySpan& input = batch[0].array;
-      const int64_t nulls = input.GetNullCount();
+      // Run-end encoded arrays have no validity bitmap of their own
+      const int64_t nulls = input.type->id() == Type::RUN_END_ENCODED
+                                ? input.ComputeLogicalNullCount()
+                                : input.GetNullCount();
       this->nulls += nulls;
       this->non_nulls += input.length - nulls;
     } else {
@@ -499,11 +503,23 @@ Result<std::unique_ptr<KernelState>> MinMaxInitDefault(KernelContext* ctx,
   return visitor.Create();
 }
 
+// The type of the values of a run-end encoded type, or the type itself
+std::shared_ptr<DataType> DecodedType(const TypeHolder& type) {
+  if (type.id() == Type::RUN_END_ENCODED) {
+    return checked_cast<const RunEndEncodedType&>(*type).value_type();
+  }
+  return type.GetSharedPtr();
+}
+
+Result<TypeHolder> MinOrMaxType(KernelContext*, const std::vector<TypeHolder>& types) {
+  return DecodedType(types.front());
+}
+
 // For "min" and "max" functions: override finalize and return the actual value
 template <MinOrMax min_or_max>
 void AddMinOrMaxAggKernel(ScalarAggregateFunction* func,
                           ScalarAggregateFunction* min_max_func) {
-  auto sig = KernelSignature::Make({InputType::Any()}, FirstType);
+  auto sig = KernelSignature::Make({InputType::Any()}, MinOrMaxType);
   auto init = [min_max_func](
                   KernelContext* ctx,
                   const KernelInitArgs& args) -> Result<std::unique_ptr<KernelState>> {
@@ -876,10 +892,133 @@ void AddArrayScalarAggKernels(KernelInit init,
 
 Result<TypeHolder> MinMaxType(KernelContext*, const std::vector<TypeHolder>& types) {
   // T -> struct<min: T, max: T>
-  auto ty = types.front().GetSharedPtr();
+  auto ty = DecodedType(types.front());
   return struct_({field("min", ty), field("max", ty)});
 }
 
+// ----------------------------------------------------------------------
+// Run-end encoded inputs
+
+// Aggregates the values of a run-end encoded input without decoding it: the
+// aggregator for the value type consumes every run as its value broadcast to
+// the run length.
+template <typename ValueType>
+struct RunEndEncodedAggregator : public ScalarAggregator {
+  using ScalarType = typename TypeTraits<ValueType>::ScalarType;
+  using CType = typename TypeTraits<ValueType>::CType;
+
+  RunEndEncodedAggregator(const std::shared_ptr<DataType>& value_type,
+                          std::unique_ptr<KernelState> values_state)
+      : run_value(MakeNullScalar(value_type)), values_state(std::move(values_state)) {}
+
+  ScalarAggregator* values_aggregator() const {
+    return checked_cast<ScalarAggregator*>(values_state.get());
+  }
+
+  Status Consume(KernelContext* ctx, const ExecSpan& batch) override {
+    if (batch[0].is_scalar()) {
+      const auto& scalar = checked_cast<const RunEndEncodedScalar&>(*batch[0].scalar);
+      return values_aggregator()->Consume(
+          ctx, ExecSpan({ExecValue(scalar.value.get())}, batch.length));
+    }
+    const ArraySpan& input = batch[0].array;
+    switch (ree_util::RunEndsArray(input).type->id()) {
+      case Type::INT16:
+        return ConsumeRuns<int16_t>(ctx, input);
+      case Type::INT32:
+        return ConsumeRuns<int32_t>(ctx, input);
+      default:
+        DCHECK_EQ(ree_util::RunEndsArray(input).type->id(), Type::INT64);
+        return ConsumeRuns<int64_t>(ctx, input);
+    }
+  }
+
+  template <typename RunEndCType>
+  Status ConsumeRuns(KernelContext* ctx, const ArraySpan& input) {
+    const ArraySpan& values = ree_util::ValuesArray(input);
+    auto& value = checked_cast<ScalarType&>(*run_value);
+    ExecSpan run_batch({ExecValue(run_value.get())}, /*length=*/0);
+    const ree_util::RunEndEncodedArraySpan<RunEndCType> ree_span(input);
+    for (auto it = ree_span.begin(); !it.is_end(ree_span); ++it) {
+      const int64_t i = it.index_into_array();
+      value.is_valid = values.IsValid(i);
+      if constexpr (is_boolean_type<ValueType>::value) {
+        value.value = bit_util::GetBit(values.buffers[1].data, values.offset + i);
+      } else {
+        value.value = values.GetValues<CType>(1)[i];
+      }
+      run_batch.length = it.run_length();
+      RETURN_NOT_OK(values_aggregator()->Consume(ctx, run_batch));
+    }
+    return Status::OK();
+  }
+
+  Status MergeFrom(KernelContext* ctx, KernelState&& src) override {
+    auto& other = checked_cast<RunEndEncodedAggregator&>(src);
+    return values_aggregator()->MergeFrom(ctx, std::move(*other.values_state));
+  }
+
+  Status Finalize(KernelContext* ctx, Datum* out) override {
+    // Some aggregators finalize the state of the kernel context
+    ctx->SetState(values_state.get());
+    Status st = values_aggregator()->Finalize(ctx, out);
+    ctx->SetState(this);
+    return st;
+  }
+
+  // Reused for the value of every run
+  std::shared_ptr<Scalar> run_value;
+  std::unique_ptr<KernelState> values_state;
+};
+
+struct RunEndEncodedAggregatorInit {
+  const std::shared_ptr<DataType>& value_type;
+  std::unique_ptr<KernelState> values_state;
+  std::unique_ptr<KernelState> state;
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Aggregating run-end encoded ", type);
+  }
+
+  template <typename Type>
+  enable_if_t<has_c_type<Type>::value, Status> Visit(const Type&) {
+    state = std::make_unique<RunEndEncodedAggregator<Type>>(value_type,
+                                                           std::move(values_state));
+    return Status::OK();
+  }
+
+  Result<std::unique_ptr<KernelState>> Create() {
+    RETURN_NOT_OK(VisitTypeInline(*value_type, this));
+    return std::move(state);
+  }
+};
+
+// Wrap the init of a kernel for the value type of run-end encoded inputs
+KernelInit RunEndEncodedInit(KernelInit values_init) {
+  return [values_init](KernelContext* ctx, const KernelInitArgs& args)
+             -> Result<std::unique_ptr<KernelState>> {
+    const auto& value_type =
+        checked_cast<const RunEndEncodedType&>(*args.inputs[0]).value_type();
+    const std::vector<TypeHolder> inputs = {value_type};
+    ARROW_ASSIGN_OR_RAISE(auto values_state,
+                          values_init(ctx, KernelInitArgs{args.kernel, inputs,
+                                                          args.options}));
+    return RunEndEncodedAggregatorInit{value_type, std::move(values_state), nullptr}
+        .Create();
+  };
+}
+
+void AddRunEndEncodedAggKernels(KernelInit init,
+                                const std::vector<std::shared_ptr<DataType>>& types,
+                                OutputType out_type, ScalarAggregateFunction* func) {
+  auto ree_init = RunEndEncodedInit(std::move(init));
+  for (const auto& ty : types) {
+    auto sig = KernelSignature::Make({InputType(match::RunEndEncoded(ty->id()))},
+                                     out_type);
+    AddAggKernel(std::move(sig), ree_init, func, SimdLevel::NONE);
+  }
+}
+
 Result<TypeHolder> FirstLastType(KernelContext*, const std::vector<TypeHolder>& types) {
   auto ty = types.front().GetSharedPtr();
   return struct_({field("first", ty), field("last", ty)});
@@ -1058,6 +1197,10 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   AddArrayScalarAggKernels(SumInit, UnsignedIntTypes(), uint64(), func.get());
   AddArrayScalarAggKernels(SumInit, FloatingPointTypes(), float64(), func.get());
   AddArrayScalarAggKernels(SumInit, {null()}, int64(), func.get());
+  AddRunEndEncodedAggKernels(SumInit, {boolean()}, uint64(), func.get());
+  AddRunEndEncodedAggKernels(SumInit, SignedIntTypes(), int64(), func.get());
+  AddRunEndEncodedAggKernels(SumInit, UnsignedIntTypes(), uint64(), func.get());
+  AddRunEndEncodedAggKernels(SumInit, FloatingPointTypes(), float64(), func.get());
   // Add the SIMD variants for sum
 #if defined(ARROW_HAVE_RUNTIME_AVX2) || defined(ARROW_HAVE_RUNTIME_AVX512)
   auto cpu_info = arrow::internal::CpuInfo::GetInstance();
@@ -1083,6 +1226,8 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   AddAggKernel(KernelSignature::Make({Type::DECIMAL256}, FirstType), MeanInit, func.get(),
                SimdLevel::NONE);
   AddArrayScalarAggKernels(MeanInit, {null()}, float64(), func.get());
+  AddRunEndEncodedAggKernels(MeanInit, {boolean()}, float64(), func.get());
+  AddRunEndEncodedAggKernels(MeanInit, NumericTypes(), float64(), func.get());
   // Add the SIMD variants for mean
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
   if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX2)) {
@@ -1129,6 +1274,9 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   AddMinMaxKernel(MinMaxInitDefault, Type::INTERVAL_MONTHS, func.get());
   AddMinMaxKernel(MinMaxInitDefault, Type::DECIMAL128, func.get());
   AddMinMaxKernel(MinMaxInitDefault, Type::DECIMAL256, func.get());
+  AddRunEndEncodedAggKernels(MinMaxInitDefault, {boolean()}, MinMaxType, func.get());
+  AddRunEndEncodedAggKernels(MinMaxInitDefault, NumericTypes(), MinMaxType, func.get());
+  AddRunEndEncodedAggKernels(MinMaxInitDefault, TemporalTypes(), MinMaxType, func.get());
   // Add the SIMD variants for min max
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
   if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX2)) {
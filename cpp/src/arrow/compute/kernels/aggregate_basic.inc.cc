@@ -787,15 +787,15 @@ struct MinMaxImpl : public ScalarAggregator {
     if (batch[0].is_array()) {
       return ConsumeArray(batch[0].array);
     }
-    return ConsumeScalar(*batch[0].scalar);
+    return ConsumeScalar(*batch[0].scalar, batch.length);
   }
 
-  Status ConsumeScalar(const Scalar& scalar) {
+  Status ConsumeScalar(const Scalar& scalar, int64_t length) {
     StateType local;
     local.has_nulls = !scalar.is_valid;
-    this->count += scalar.is_valid;
+    this->count += scalar.is_valid * length;
 
-    if (!local.has_nulls || options.skip_nulls) {
+    if (scalar.is_valid) {
       local.MergeOne(internal::UnboxScalar<ArrowType>::Unbox(scalar));
     }
 
@@ -925,7 +925,8 @@ struct BooleanMinMaxImpl : public MinMaxImpl<BooleanType, SimdLevel> {
 
   Status Consume(KernelContext*, const ExecSpan& batch) override {
     if (ARROW_PREDICT_FALSE(batch[0].is_scalar())) {
-      return ConsumeScalar(checked_cast<const BooleanScalar&>(*batch[0].scalar));
+      return ConsumeScalar(checked_cast<const BooleanScalar&>(*batch[0].scalar),
+                           batch.length);
     }
     StateType local;
     ArrayType arr(batch[0].array.ToArrayData());
@@ -947,11 +948,11 @@ struct BooleanMinMaxImpl : public MinMaxImpl<BooleanType, SimdLevel> {
     return Status::OK();
   }
 
-  Status ConsumeScalar(const BooleanScalar& scalar) {
+  Status ConsumeScalar(const BooleanScalar& scalar, int64_t length) {
     StateType local;
 
     local.has_nulls = !scalar.is_valid;
-    this->count += scalar.is_valid;
+    this->count += scalar.is_valid * length;
     if (!local.has_nulls || options.skip_nulls) {
       const int true_count = scalar.is_valid && scalar.value;
       const int false_count = scalar.is_valid && !scalar.value;
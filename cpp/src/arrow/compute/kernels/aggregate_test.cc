@@ -1172,6 +1172,109 @@ TEST_F(TestCountDistinctKernel, Random) {
   Check(input, memo.size(), false);
 }
 
+//
+// Approximate Count Distinct
+//
+
+class TestApproxCountDistinctKernel : public ::testing::Test {
+ protected:
+  void Check(const Datum& input, int64_t expected) {
+    EXPECT_THAT(ApproxCountDistinct(input), ResultWith(Datum(expected)));
+    // The sketch of the input gives the same estimate once merged
+    ASSERT_OK_AND_ASSIGN(Datum sketch,
+                         CallFunction("approx_count_distinct_sketch", {input}));
+    ASSERT_EQ(sketch.scalar()->type->id(), Type::BINARY);
+    ASSERT_OK_AND_ASSIGN(auto sketches, MakeArrayFromScalar(*sketch.scalar(), 2));
+    EXPECT_THAT(CallFunction("approx_count_distinct_merge", {sketches}),
+                ResultWith(Datum(expected)));
+  }
+
+  void Check(const std::shared_ptr<DataType>& type, std::string_view json,
+             int64_t expected) {
+    Check(ArrayFromJSON(type, json), expected);
+  }
+};
+
+TEST_F(TestApproxCountDistinctKernel, SmallCardinalities) {
+  // Small cardinalities are exact in practice
+  Check(boolean(), "[]", 0);
+  Check(boolean(), "[null, null]", 0);
+  Check(boolean(), "[true, null, false, true]", 2);
+  for (const auto& type : NumericTypes()) {
+    Check(type, "[1, 2, null, 3, 2, 1, 0]", 4);
+  }
+  Check(date32(), "[0, 11016, null, 0]", 2);
+  Check(timestamp(TimeUnit::SECOND), "[1, 2, null, 1]", 2);
+  Check(month_day_nano_interval(), "[[1, 2, 3], null, [1, 2, 3], [1, 2, 4]]", 2);
+  for (const auto& type : BaseBinaryTypes()) {
+    Check(type, R"(["foo", null, "bar", "", "foo"])", 3);
+  }
+  Check(utf8_view(), R"(["a string longer than twelve", null, "foo", "foo"])", 2);
+  Check(fixed_size_binary(3), R"(["abc", null, "abd", "abc"])", 2);
+  Check(decimal128(10, 2), R"(["1.23", "1.24", null, "1.23"])", 2);
+  Check(ChunkedArrayFromJSON(int32(), {"[1, 2]", "[]", "[2, 3, null]"}), 3);
+}
+
+TEST_F(TestApproxCountDistinctKernel, Scalar) {
+  Check(ScalarFromJSON(int64(), "42"), 1);
+  Check(ScalarFromJSON(utf8(), R"("foo")"), 1);
+  Check(MakeNullScalar(int64()), 0);
+}
+
+TEST_F(TestApproxCountDistinctKernel, LargeCardinality) {
+  auto rand = random::RandomArrayGenerator(0x5487656);
+  auto values = rand.Int64(200000, 0, 1000000, /*null_probability=*/0.1);
+  ASSERT_OK_AND_ASSIGN(auto unique_values, Unique(values));
+  const int64_t expected = unique_values->length() - 1;  // null
+
+  for (int precision : {10, 14, 18}) {
+    ApproxCountDistinctOptions options(precision);
+    ASSERT_OK_AND_ASSIGN(Datum estimate, ApproxCountDistinct(values, options));
+    const double error = 1.04 / std::sqrt(static_cast<double>(1 << precision));
+    EXPECT_NEAR(static_cast<double>(estimate.scalar_as<Int64Scalar>().value),
+                static_cast<double>(expected), 4 * error * expected);
+  }
+}
+
+TEST_F(TestApproxCountDistinctKernel, MergeSketches) {
+  auto first = ArrayFromJSON(int64(), "[1, 2, 3, 4]");
+  auto second = ArrayFromJSON(int64(), "[3, 4, 5, null]");
+  ApproxCountDistinctOptions low_precision(/*precision=*/8);
+  ASSERT_OK_AND_ASSIGN(Datum first_sketch,
+                       CallFunction("approx_count_distinct_sketch", {first}));
+  ASSERT_OK_AND_ASSIGN(
+      Datum second_sketch,
+      CallFunction("approx_count_distinct_sketch", {second}, &low_precision));
+
+  BinaryBuilder builder;
+  ASSERT_OK(builder.Append(first_sketch.scalar_as<BinaryScalar>().view()));
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK(builder.Append(second_sketch.scalar_as<BinaryScalar>().view()));
+  ASSERT_OK_AND_ASSIGN(auto sketches, builder.Finish());
+  EXPECT_THAT(CallFunction("approx_count_distinct_merge", {sketches}),
+              ResultWith(Datum(int64_t{5})));
+
+  ASSERT_OK_AND_ASSIGN(auto large_sketches, Cast(sketches, large_binary()));
+  EXPECT_THAT(CallFunction("approx_count_distinct_merge", {large_sketches}),
+              ResultWith(Datum(int64_t{5})));
+
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("Invalid HyperLogLog sketch"),
+      CallFunction("approx_count_distinct_merge",
+                   {ArrayFromJSON(binary(), R"(["not a sketch"])")}));
+}
+
+TEST_F(TestApproxCountDistinctKernel, Options) {
+  auto input = ArrayFromJSON(int64(), "[1, 2, 3]");
+  for (int precision : {3, 19}) {
+    ApproxCountDistinctOptions options(precision);
+    EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, ::testing::HasSubstr("precision"),
+                                    ApproxCountDistinct(input, options));
+  }
+  ApproxCountDistinctOptions options(/*precision=*/4);
+  EXPECT_THAT(ApproxCountDistinct(input, options), ResultWith(Datum(int64_t{3})));
+}
+
 //
 // Mean
 //
@@ -2382,6 +2485,102 @@ TYPED_TEST(TestRandomNumericMinMaxKernel, RandomArrayMinMax) {
   }
 }
 
+//
+// Run-end encoded inputs
+//
+
+class TestRunEndEncodedAggregation : public ::testing::Test {
+ protected:
+  // Check that aggregating `values` run-end encoded, including slices of it,
+  // gives the same result as aggregating the decoded values
+  void CheckAggregate(const std::string& func_name, const std::shared_ptr<Array>& values,
+                      const FunctionOptions* options = nullptr) {
+    for (const auto& run_end_type : {int16(), int32(), int64()}) {
+      ARROW_SCOPED_TRACE(func_name, " ", *values->type(), " run ends ", *run_end_type);
+      ASSERT_OK_AND_ASSIGN(Datum encoded,
+                           RunEndEncode(values, RunEndEncodeOptions(run_end_type)));
+      const auto length = values->length();
+      for (const auto& [offset, slice_length] :
+           std::vector<std::pair<int64_t, int64_t>>{
+               {0, length}, {1, length - 1}, {2, length - 3}, {length / 2, 0}}) {
+        ARROW_SCOPED_TRACE("offset ", offset, " length ", slice_length);
+        ASSERT_OK_AND_ASSIGN(
+            Datum expected,
+            CallFunction(func_name, {values->Slice(offset, slice_length)}, options));
+        ASSERT_OK_AND_ASSIGN(
+            Datum actual,
+            CallFunction(func_name, {encoded.make_array()->Slice(offset, slice_length)},
+                         options));
+        AssertDatumsEqual(expected, actual, /*verbose=*/true);
+      }
+      auto chunked = std::make_shared<ChunkedArray>(
+          ArrayVector{encoded.make_array(), encoded.make_array()->Slice(3)});
+      auto decoded_chunked =
+          std::make_shared<ChunkedArray>(ArrayVector{values, values->Slice(3)});
+      ASSERT_OK_AND_ASSIGN(Datum expected,
+                           CallFunction(func_name, {decoded_chunked}, options));
+      ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction(func_name, {chunked}, options));
+      AssertDatumsEqual(expected, actual, /*verbose=*/true);
+    }
+  }
+
+  void CheckAggregates(const std::vector<std::string>& func_names,
+                       const std::shared_ptr<Array>& values) {
+    const ScalarAggregateOptions keep_nulls(/*skip_nulls=*/false);
+    const ScalarAggregateOptions min_count(/*skip_nulls=*/true, /*min_count=*/7);
+    for (const auto& func_name : func_names) {
+      CheckAggregate(func_name, values);
+      CheckAggregate(func_name, values, &keep_nulls);
+      CheckAggregate(func_name, values, &min_count);
+    }
+  }
+};
+
+TEST_F(TestRunEndEncodedAggregation, Numeric) {
+  for (const auto& ty : {int8(), uint16(), int32(), uint64(), float32(), float64()}) {
+    CheckAggregates({"sum", "mean", "min_max", "min", "max"},
+                    ArrayFromJSON(ty, "[1, 1, 1, 5, 5, null, null, 2, 3, 3, 3, 3]"));
+    CheckAggregates({"sum", "mean", "min_max", "min", "max"},
+                    ArrayFromJSON(ty, "[null, null, 4, 4, 4, 4, 4, 4, 4, null]"));
+  }
+}
+
+TEST_F(TestRunEndEncodedAggregation, Boolean) {
+  CheckAggregates(
+      {"sum", "mean", "min_max", "min", "max"},
+      ArrayFromJSON(boolean(), "[true, true, false, null, true, true, true, false]"));
+  CheckAggregates({"sum", "mean", "min_max"},
+                  ArrayFromJSON(boolean(), "[true, true, true, true, true, null]"));
+}
+
+TEST_F(TestRunEndEncodedAggregation, Temporal) {
+  for (const auto& ty : {date32(), timestamp(TimeUnit::MILLI, "UTC"),
+                         time64(TimeUnit::NANO), time32(TimeUnit::SECOND)}) {
+    CheckAggregates({"min_max", "min", "max"},
+                    ArrayFromJSON(ty, "[5, 5, 1, 1, 1, null, 7, 7, 7, 2, 2, 2]"));
+  }
+}
+
+TEST_F(TestRunEndEncodedAggregation, Count) {
+  const auto values = ArrayFromJSON(utf8(), R"(["a", "a", null, null, "b", "a", null])");
+  for (auto mode :
+       {CountOptions::ONLY_VALID, CountOptions::ONLY_NULL, CountOptions::ALL}) {
+    const CountOptions options(mode);
+    CheckAggregate("count", values, &options);
+  }
+}
+
+TEST_F(TestRunEndEncodedAggregation, Scalar) {
+  auto type = run_end_encoded(int32(), int64());
+  auto scalar = std::make_shared<RunEndEncodedScalar>(MakeScalar(int64_t(3)), type);
+  EXPECT_THAT(Sum(scalar), ResultWith(Datum(int64_t(3))));
+  EXPECT_THAT(MinMax(scalar), ResultWith(ScalarFromJSON(
+                                  struct_({field("min", int64()), field("max", int64())}),
+                                  "[3, 3]")));
+  EXPECT_THAT(Sum(std::make_shared<RunEndEncodedScalar>(type)),
+              ResultWith(Datum(MakeNullScalar(int64()))));
+}
+
 //
 // Any
 //
@@ -41,6 +41,35 @@ using util::Float16;
 namespace compute {
 namespace internal {
 
+// Decimal128 addition and subtraction spelled out on the two 64-bit words, so that
+// the kernels do not pay for a call into the out-of-line BasicDecimal128 operators
+// for each value.
+template <typename T>
+T DecimalAdd(const T& left, const T& right) {
+  return left + right;
+}
+
+template <typename T>
+T DecimalSubtract(const T& left, const T& right) {
+  return left + (-right);
+}
+
+inline Decimal128 DecimalAdd(const Decimal128& left, const Decimal128& right) {
+  const uint64_t low = left.low_bits() + right.low_bits();
+  const uint64_t carry = low < left.low_bits() ? 1 : 0;
+  const uint64_t high = static_cast<uint64_t>(left.high_bits()) +
+                        static_cast<uint64_t>(right.high_bits()) + carry;
+  return Decimal128(static_cast<int64_t>(high), low);
+}
+
+inline Decimal128 DecimalSubtract(const Decimal128& left, const Decimal128& right) {
+  const uint64_t low = left.low_bits() - right.low_bits();
+  const uint64_t borrow = left.low_bits() < right.low_bits() ? 1 : 0;
+  const uint64_t high = static_cast<uint64_t>(left.high_bits()) -
+                        static_cast<uint64_t>(right.high_bits()) - borrow;
+  return Decimal128(static_cast<int64_t>(high), low);
+}
+
 struct Add {
   template <typename T, typename Arg0, typename Arg1>
   static constexpr enable_if_floating_value<T> Call(KernelContext*, Arg0 left, Arg1 right,
@@ -62,7 +91,7 @@ struct Add {
 
   template <typename T, typename Arg0, typename Arg1>
   static enable_if_decimal_value<T> Call(KernelContext*, Arg0 left, Arg1 right, Status*) {
-    return left + right;
+    return DecimalAdd(left, right);
   }
 };
 
@@ -87,7 +116,7 @@ struct AddChecked {
 
   template <typename T, typename Arg0, typename Arg1>
   static enable_if_decimal_value<T> Call(KernelContext*, Arg0 left, Arg1 right, Status*) {
-    return left + right;
+    return DecimalAdd(left, right);
   }
 };
 
@@ -204,7 +233,7 @@ struct Subtract {
 
   template <typename T, typename Arg0, typename Arg1>
   static enable_if_decimal_value<T> Call(KernelContext*, Arg0 left, Arg1 right, Status*) {
-    return left + (-right);
+    return DecimalSubtract(left, right);
   }
 };
 
@@ -228,7 +257,7 @@ struct SubtractChecked {
 
   template <typename T, typename Arg0, typename Arg1>
   static enable_if_decimal_value<T> Call(KernelContext*, Arg0 left, Arg1 right, Status*) {
-    return left + (-right);
+    return DecimalSubtract(left, right);
   }
 };
 
@@ -26,6 +26,7 @@
 #include "arrow/compute/api_vector.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace compute {
@@ -575,6 +576,16 @@ bool HasDecimal(const std::vector<TypeHolder>& types) {
   return false;
 }
 
+bool HaveSameScaleNarrowDecimals(const std::vector<TypeHolder>& types) {
+  if (types.size() != 2 || types[0].id() != types[1].id() ||
+      (types[0].id() != Type::DECIMAL32 && types[0].id() != Type::DECIMAL64)) {
+    return false;
+  }
+  const auto& left_type = checked_cast<const DecimalType&>(*types[0]);
+  const auto& right_type = checked_cast<const DecimalType&>(*types[1]);
+  return left_type.scale() >= 0 && left_type.scale() == right_type.scale();
+}
+
 void PromoteIntegerForDurationArithmetic(std::vector<TypeHolder>* types) {
   bool has_duration = std::any_of(types->begin(), types->end(), [](const TypeHolder& t) {
     return t.id() == Type::DURATION;
@@ -590,6 +601,24 @@ void PromoteIntegerForDurationArithmetic(std::vector<TypeHolder>* types) {
   }
 }
 
+::arrow::internal::Executor* GetParallelExecutor(ExecContext* ctx, int64_t length,
+                                                 int64_t min_length) {
+  if (!ctx->use_threads() || length < min_length) {
+    return nullptr;
+  }
+  auto executor =
+      ctx->executor() ? ctx->executor() : ::arrow::internal::GetCpuThreadPool();
+  if (executor->GetCapacity() < 2 || executor->OwnsThisThread()) {
+    return nullptr;
+  }
+  return executor;
+}
+
+::arrow::internal::Executor* GetParallelExecutor(KernelContext* ctx, int64_t length,
+                                                 int64_t min_length) {
+  return GetParallelExecutor(ctx->exec_context(), length, min_length);
+}
+
 }  // namespace internal
 }  // namespace compute
 }  // namespace arrow
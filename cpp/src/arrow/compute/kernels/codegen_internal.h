@@ -1493,11 +1493,31 @@ Result<std::shared_ptr<DataType>> WidenDecimalToMaxPrecision(
 ARROW_EXPORT
 bool HasDecimal(const std::vector<TypeHolder>& types);
 
+/// Whether both arguments are Decimal32, or both are Decimal64, with the same
+/// non-negative scale. Such arguments can be added, subtracted or compared on their
+/// narrow storage without being promoted to Decimal128 by CastBinaryDecimalArgs.
+ARROW_EXPORT
+bool HaveSameScaleNarrowDecimals(const std::vector<TypeHolder>& types);
+
 ARROW_EXPORT
 void PromoteIntegerForDurationArithmetic(std::vector<TypeHolder>* types);
 
 // END of DispatchBest helpers
 // ----------------------------------------------------------------------
+
+/// \brief Return the executor to process an input of the given length with in
+/// parallel, or null if it should be processed serially
+///
+/// Inputs shorter than `min_length` are processed serially.  Parallel tasks block
+/// until they are done, so they are not used from one of the executor's own
+/// threads, where waiting could starve the executor.
+ARROW_EXPORT
+::arrow::internal::Executor* GetParallelExecutor(ExecContext* ctx, int64_t length,
+                                                 int64_t min_length);
+ARROW_EXPORT
+::arrow::internal::Executor* GetParallelExecutor(KernelContext* ctx, int64_t length,
+                                                 int64_t min_length);
+
 }  // namespace internal
 }  // namespace compute
 }  // namespace arrow
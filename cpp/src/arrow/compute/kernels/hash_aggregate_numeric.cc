@@ -15,12 +15,16 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "arrow/array/builder_binary.h"
 #include "arrow/array/concatenate.h"
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/kernel.h"
@@ -32,8 +36,10 @@
 #include "arrow/compute/row/grouper.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/int128_internal.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/span.h"
 #include "arrow/util/tdigest_internal.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visit_type_inline.h"
 
 namespace arrow::compute::internal {
@@ -919,6 +925,11 @@ Status AddHashAggregateStatisticKernels(HashAggregateFunction* func,
 
 using arrow::internal::TDigest;
 
+// Number of tdigests combined by a single k-way merge when reducing pending merges
+constexpr size_t kTDigestMergeFanIn = 8;
+// Minimum number of k-way merges in a reduction round to run them in parallel
+constexpr int64_t kMinParallelTDigestMerges = 16;
+
 template <typename Type>
 struct GroupedTDigestImpl : public GroupedAggregator {
   using CType = typename TypeTraits<Type>::CType;
@@ -974,6 +985,9 @@ struct GroupedTDigestImpl : public GroupedAggregator {
     return Status::OK();
   }
 
+  // The tdigests of `other` are not merged right away: merging them one state at a
+  // time would compress each group's tdigest once per state. They are kept aside
+  // and reduced by MergePending() when finalizing.
   Status Merge(GroupedAggregator&& raw_other,
                const ArrayData& group_id_mapping) override {
     auto other = checked_cast<GroupedTDigestImpl*>(&raw_other);
@@ -982,21 +996,115 @@ struct GroupedTDigestImpl : public GroupedAggregator {
     uint8_t* no_nulls = no_nulls_.mutable_data();
 
     const int64_t* other_counts = other->counts_.data();
-    const uint8_t* other_no_nulls = no_nulls_.mutable_data();
+    const uint8_t* other_no_nulls = other->no_nulls_.data();
 
-    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    const uint32_t* mapping = group_id_mapping.GetValues<uint32_t>(1);
+    auto g = mapping;
     for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g, ++g) {
-      tdigests_[*g].Merge(other->tdigests_[other_g]);
+      if (!other->tdigests_[other_g].is_empty()) {
+        pending_.emplace_back(*g, std::move(other->tdigests_[other_g]));
+      }
       counts[*g] += other_counts[other_g];
       bit_util::SetBitTo(
           no_nulls, *g,
           bit_util::GetBit(no_nulls, *g) && bit_util::GetBit(other_no_nulls, other_g));
     }
+    for (auto& [other_g, tdigest] : other->pending_) {
+      pending_.emplace_back(mapping[other_g], std::move(tdigest));
+    }
+    other->pending_.clear();
 
     return Status::OK();
   }
 
+  // Merge the pending tdigests into their groups.
+  //
+  // The tdigests of each group are reduced as a tree: every round replaces runs of
+  // up to kTDigestMergeFanIn tdigests by their k-way merge, until one tdigest is
+  // left per group. The merges of a round are independent, they run in parallel
+  // when the executor allows it.
+  Status MergePending() {
+    if (pending_.empty()) {
+      return Status::OK();
+    }
+    std::stable_sort(pending_.begin(), pending_.end(),
+                     [](const auto& l, const auto& r) { return l.first < r.first; });
+    // The group's own tdigest comes first so that it receives the final merge
+    std::vector<std::pair<uint32_t, std::vector<TDigest>>> runs;
+    for (auto& [g, tdigest] : pending_) {
+      if (runs.empty() || runs.back().first != g) {
+        runs.emplace_back(g, std::vector<TDigest>{});
+        runs.back().second.push_back(std::move(tdigests_[g]));
+      }
+      runs.back().second.push_back(std::move(tdigest));
+    }
+    pending_.clear();
+
+    while (true) {
+      // (run index, offset of the first tdigest to merge into)
+      std::vector<std::pair<size_t, size_t>> merges;
+      for (size_t i = 0; i < runs.size(); ++i) {
+        const size_t run_length = runs[i].second.size();
+        for (size_t j = 0; run_length > 1 && j < run_length; j += kTDigestMergeFanIn) {
+          merges.emplace_back(i, j);
+        }
+      }
+      if (merges.empty()) {
+        break;
+      }
+      const auto num_merges = static_cast<int>(merges.size());
+      auto executor = GetParallelMergeExecutor(num_merges);
+      RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+          executor != nullptr, num_merges,
+          [&](int i) {
+            auto& tdigests = runs[merges[i].first].second;
+            const size_t begin = merges[i].second;
+            const size_t end = std::min(begin + kTDigestMergeFanIn, tdigests.size());
+            std::vector<TDigest> others(
+                std::make_move_iterator(tdigests.begin() + begin + 1),
+                std::make_move_iterator(tdigests.begin() + end));
+            tdigests[begin].Merge(others);
+            return Status::OK();
+          },
+          executor));
+      for (auto& [g, tdigests] : runs) {
+        size_t num_merged = 0;
+        for (size_t j = 0; j < tdigests.size(); j += kTDigestMergeFanIn) {
+          if (j != num_merged) {
+            tdigests[num_merged] = std::move(tdigests[j]);
+          }
+          ++num_merged;
+        }
+        tdigests.erase(tdigests.begin() + num_merged, tdigests.end());
+      }
+    }
+    for (auto& [g, tdigests] : runs) {
+      tdigests_[g] = std::move(tdigests[0]);
+    }
+    return Status::OK();
+  }
+
+  // Return the executor to run `num_merges` merges with, or null if they should run
+  // serially. As for parallel sorting, blocking on the executor from one of its own
+  // threads could starve it.
+  ::arrow::internal::Executor* GetParallelMergeExecutor(int64_t num_merges) const {
+    if (!ctx_->use_threads() || num_merges < kMinParallelTDigestMerges) {
+      return nullptr;
+    }
+    auto executor =
+        ctx_->executor() ? ctx_->executor() : ::arrow::internal::GetCpuThreadPool();
+    if (executor->GetCapacity() < 2 || executor->OwnsThisThread()) {
+      return nullptr;
+    }
+    return executor;
+  }
+
+  bool IsGroupValid(int64_t g) const {
+    return options_.skip_nulls || bit_util::GetBit(no_nulls_.data(), g);
+  }
+
   Result<Datum> Finalize() override {
+    RETURN_NOT_OK(MergePending());
     const int64_t slot_length = options_.q.size();
     const int64_t num_values = tdigests_.size() * slot_length;
     const int64_t* counts = counts_.data();
@@ -1008,7 +1116,7 @@ struct GroupedTDigestImpl : public GroupedAggregator {
     auto* results = values->mutable_data_as<double>();
     for (int64_t i = 0; static_cast<size_t>(i) < tdigests_.size(); ++i) {
       if (!tdigests_[i].is_empty() && counts[i] >= options_.min_count &&
-          (options_.skip_nulls || bit_util::GetBit(no_nulls_.data(), i))) {
+          IsGroupValid(i)) {
         for (int64_t j = 0; j < slot_length; j++) {
           results[i * slot_length + j] = tdigests_[i].Quantile(options_.q[j]);
         }
@@ -1038,24 +1146,70 @@ struct GroupedTDigestImpl : public GroupedAggregator {
   TDigestOptions options_;
   int32_t decimal_scale_;
   std::vector<TDigest> tdigests_;
+  // tdigests merged from other states, along with their group
+  std::vector<std::pair<uint32_t, TDigest>> pending_;
   TypedBufferBuilder<int64_t> counts_;
   TypedBufferBuilder<bool> no_nulls_;
   ExecContext* ctx_;
   MemoryPool* pool_;
 };
 
+// Emit the serialized tdigest of each group, to be merged by hash_tdigest_merge
+template <typename Type>
+struct GroupedTDigestSketchImpl : public GroupedTDigestImpl<Type> {
+  Result<Datum> Finalize() override {
+    RETURN_NOT_OK(this->MergePending());
+    BinaryBuilder builder(this->pool_);
+    RETURN_NOT_OK(builder.Reserve(this->tdigests_.size()));
+    for (int64_t i = 0; static_cast<size_t>(i) < this->tdigests_.size(); ++i) {
+      if (this->IsGroupValid(i)) {
+        RETURN_NOT_OK(builder.Append(this->tdigests_[i].Serialize()));
+      } else {
+        builder.UnsafeAppendNull();
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto sketches, builder.Finish());
+    return sketches->data();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return binary(); }
+};
+
+// Compute quantiles from serialized tdigests, as emitted by hash_tdigest_sketch
+template <typename Type>
+struct GroupedTDigestMergeImpl : public GroupedTDigestImpl<DoubleType> {
+  Status Consume(const ExecSpan& batch) override {
+    int64_t* counts = counts_.mutable_data();
+    uint8_t* no_nulls = no_nulls_.mutable_data();
+    return VisitGroupedValues<Type>(
+        batch,
+        [&](uint32_t g, std::string_view sketch) {
+          ARROW_ASSIGN_OR_RAISE(auto tdigest,
+                                TDigest::Deserialize(sketch, options_.buffer_size));
+          counts[g] += static_cast<int64_t>(tdigest.total_weight());
+          if (!tdigest.is_empty()) {
+            pending_.emplace_back(g, std::move(tdigest));
+          }
+          return Status::OK();
+        },
+        [&](uint32_t g) {
+          bit_util::SetBitTo(no_nulls, g, false);
+          return Status::OK();
+        });
+  }
+};
+
+template <template <typename> class Impl>
 struct GroupedTDigestFactory {
   template <typename T>
   enable_if_number<T, Status> Visit(const T&) {
-    kernel =
-        MakeKernel(std::move(argument_type), HashAggregateInit<GroupedTDigestImpl<T>>);
+    kernel = MakeKernel(std::move(argument_type), HashAggregateInit<Impl<T>>);
     return Status::OK();
   }
 
   template <typename T>
   enable_if_decimal<T, Status> Visit(const T&) {
-    kernel =
-        MakeKernel(std::move(argument_type), HashAggregateInit<GroupedTDigestImpl<T>>);
+    kernel = MakeKernel(std::move(argument_type), HashAggregateInit<Impl<T>>);
     return Status::OK();
   }
 
@@ -1078,6 +1232,15 @@ struct GroupedTDigestFactory {
   InputType argument_type;
 };
 
+Status AddHashAggregateTDigestKernels(HashAggregateFunction* func,
+                                      HashAggregateKernelFactory make_kernel) {
+  RETURN_NOT_OK(AddHashAggKernels(SignedIntTypes(), make_kernel, func));
+  RETURN_NOT_OK(AddHashAggKernels(UnsignedIntTypes(), make_kernel, func));
+  RETURN_NOT_OK(AddHashAggKernels(FloatingPointTypes(), make_kernel, func));
+  // Type parameters are ignored
+  return AddHashAggKernels({decimal128(1, 1), decimal256(1, 1)}, make_kernel, func);
+}
+
 HashAggregateKernel MakeApproximateMedianKernel(HashAggregateFunction* tdigest_func) {
   HashAggregateKernel kernel;
   kernel.init = [tdigest_func](
@@ -1171,6 +1334,26 @@ const FunctionDoc hash_tdigest_doc{
     {"array", "group_id_array"},
     "TDigestOptions"};
 
+const FunctionDoc hash_tdigest_sketch_doc{
+    "Compute a serialized T-Digest of the values in each group",
+    ("The returned binary values can be stored, and later be merged by\n"
+     "\"hash_tdigest_merge\" to compute approximate quantiles.\n"
+     "Nulls and NaNs are ignored.\n"
+     "If `skip_nulls` is false, null is emitted for groups containing nulls.\n"
+     "`q` and `min_count` are not used."),
+    {"array", "group_id_array"},
+    "TDigestOptions"};
+
+const FunctionDoc hash_tdigest_merge_doc{
+    "Compute approximate quantiles from serialized T-Digests in each group",
+    ("The input values must have been produced by \"hash_tdigest_sketch\".\n"
+     "By default, the 0.5 quantile (i.e. median) is emitted.\n"
+     "Null sketches are ignored, unless `skip_nulls` is false.\n"
+     "`min_count` applies to the number of data points in the merged digests.\n"
+     "Nulls are returned if there are no valid data points."),
+    {"sketches", "group_id_array"},
+    "TDigestOptions"};
+
 const FunctionDoc hash_approximate_median_doc{
     "Compute approximate medians of values in each group",
     ("The T-Digest algorithm is used for a fast approximation.\n"
@@ -1266,18 +1449,31 @@ void RegisterHashAggregateNumeric(FunctionRegistry* registry) {
   {
     auto func = std::make_shared<HashAggregateFunction>(
         "hash_tdigest", Arity::Binary(), hash_tdigest_doc, &default_tdigest_options);
-    DCHECK_OK(
-        AddHashAggKernels(SignedIntTypes(), GroupedTDigestFactory::Make, func.get()));
-    DCHECK_OK(
-        AddHashAggKernels(UnsignedIntTypes(), GroupedTDigestFactory::Make, func.get()));
-    DCHECK_OK(
-        AddHashAggKernels(FloatingPointTypes(), GroupedTDigestFactory::Make, func.get()));
-    // Type parameters are ignored
-    DCHECK_OK(AddHashAggKernels({decimal128(1, 1), decimal256(1, 1)},
-                                GroupedTDigestFactory::Make, func.get()));
+    DCHECK_OK(AddHashAggregateTDigestKernels(
+        func.get(), GroupedTDigestFactory<GroupedTDigestImpl>::Make));
     tdigest_func = func.get();
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
+  {
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_tdigest_sketch", Arity::Binary(), hash_tdigest_sketch_doc,
+        &default_tdigest_options);
+    DCHECK_OK(AddHashAggregateTDigestKernels(
+        func.get(), GroupedTDigestFactory<GroupedTDigestSketchImpl>::Make));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+  {
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_tdigest_merge", Arity::Binary(), hash_tdigest_merge_doc,
+        &default_tdigest_options);
+    DCHECK_OK(func->AddKernel(
+        MakeKernel(InputType(Type::BINARY),
+                   HashAggregateInit<GroupedTDigestMergeImpl<BinaryType>>)));
+    DCHECK_OK(func->AddKernel(
+        MakeKernel(InputType(Type::LARGE_BINARY),
+                   HashAggregateInit<GroupedTDigestMergeImpl<LargeBinaryType>>)));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
   {
     auto func = std::make_shared<HashAggregateFunction>(
         "hash_approximate_median", Arity::Binary(), hash_approximate_median_doc,
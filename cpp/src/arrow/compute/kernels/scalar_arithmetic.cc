@@ -605,6 +605,20 @@ Result<TypeHolder> ResolveDecimalAdditionOrSubtractionOutput(
       });
 }
 
+// Same-scale Decimal32 and Decimal64 arguments are not promoted before addition and
+// subtraction, but the result is the Decimal128 they would have been promoted to.
+Result<TypeHolder> ResolveNarrowDecimalAdditionOrSubtractionOutput(
+    KernelContext*, const std::vector<TypeHolder>& types) {
+  const auto& left_type = checked_cast<const DecimalType&>(*types[0]);
+  const auto& right_type = checked_cast<const DecimalType&>(*types[1]);
+  DCHECK_EQ(left_type.scale(), right_type.scale());
+  const int32_t scale = left_type.scale();
+  const int32_t precision = std::max(left_type.precision() - scale,
+                                     right_type.precision() - scale) +
+                            scale + 1;
+  return decimal128(precision, scale);
+}
+
 Result<TypeHolder> ResolveDecimalMultiplicationOutput(
     KernelContext*, const std::vector<TypeHolder>& types) {
   return ResolveDecimalBinaryOperationOutput(
@@ -658,6 +672,15 @@ void AddDecimalUnaryKernels(ScalarFunction* func) {
   DCHECK_OK(func->AddKernel({in_type256}, out_type, exec256));
 }
 
+// Apply a Decimal128 operator to Decimal32 or Decimal64 values widened on the fly
+template <typename Op>
+struct WidenToDecimal128 {
+  template <typename T, typename Arg0, typename Arg1>
+  static T Call(KernelContext* ctx, Arg0 left, Arg1 right, Status* st) {
+    return Op::template Call<T, T, T>(ctx, T(left.value()), T(right.value()), st);
+  }
+};
+
 template <typename Op>
 void AddDecimalBinaryKernels(const std::string& name, ScalarFunction* func) {
   OutputType out_type(null());
@@ -682,6 +705,23 @@ void AddDecimalBinaryKernels(const std::string& name, ScalarFunction* func) {
                             constraint));
   DCHECK_OK(func->AddKernel({in_type256, in_type256}, out_type, exec256, /*init=*/nullptr,
                             constraint));
+
+  if (op == "add" || op == "subtract") {
+    // Kernels for the arguments left unpromoted by ArithmeticFunction::CheckDecimals
+    out_type = OutputType(ResolveNarrowDecimalAdditionOrSubtractionOutput);
+    auto in_type32 = InputType(Type::DECIMAL32);
+    auto in_type64 = InputType(Type::DECIMAL64);
+    auto exec32 =
+        ScalarBinaryNotNullEqualTypes<Decimal128Type, Decimal32Type,
+                                      WidenToDecimal128<Op>>::Exec;
+    auto exec64 =
+        ScalarBinaryNotNullEqualTypes<Decimal128Type, Decimal64Type,
+                                      WidenToDecimal128<Op>>::Exec;
+    DCHECK_OK(func->AddKernel({in_type32, in_type32}, out_type, exec32,
+                              /*init=*/nullptr, constraint));
+    DCHECK_OK(func->AddKernel({in_type64, in_type64}, out_type, exec64,
+                              /*init=*/nullptr, constraint));
+  }
 }
 
 template <typename Op>
@@ -777,6 +817,8 @@ struct ArithmeticFunction : ScalarFunction {
       const auto func_name = name();
       const std::string op = func_name.substr(0, func_name.find("_"));
       if (op == "add" || op == "subtract") {
+        // Same-scale Decimal32/Decimal64 arguments have their own kernels
+        if (HaveSameScaleNarrowDecimals(*types)) return Status::OK();
         return CastBinaryDecimalArgs(DecimalPromotion::kAdd, types);
       } else if (op == "multiply") {
         return CastBinaryDecimalArgs(DecimalPromotion::kMultiply, types);
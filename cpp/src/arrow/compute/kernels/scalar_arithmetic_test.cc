@@ -1921,6 +1921,12 @@ TEST_F(TestBinaryArithmeticDecimal, DispatchExact) {
       CheckDispatchExact(name, {decimal256(3, 1), decimal256(2, 1)});
       CheckDispatchExactFails(name, {decimal256(2, 0), decimal256(2, 1)});
       CheckDispatchExactFails(name, {decimal256(2, 1), decimal256(2, 0)});
+
+      CheckDispatchExact(name, {decimal32(2, 1), decimal32(2, 1)});
+      CheckDispatchExact(name, {decimal64(3, 1), decimal64(2, 1)});
+      CheckDispatchExactFails(name, {decimal32(2, 0), decimal32(2, 1)});
+      CheckDispatchExactFails(name, {decimal64(2, 1), decimal64(2, 0)});
+      CheckDispatchExactFails(name, {decimal32(2, 1), decimal64(2, 1)});
     }
   }
 
@@ -1998,6 +2004,16 @@ TEST_F(TestBinaryArithmeticDecimal, DispatchBest) {
                         {decimal128(3, 1), decimal128(2, 1)});
       CheckDispatchBest(name, {decimal128(2, 1), decimal128(2, 0)},
                         {decimal128(2, 1), decimal128(3, 1)});
+
+      // Same-scale narrow decimals are not promoted
+      CheckDispatchBest(name, {decimal32(2, 1), decimal32(3, 1)},
+                        {decimal32(2, 1), decimal32(3, 1)});
+      CheckDispatchBest(name, {decimal64(2, 1), decimal64(2, 1)},
+                        {decimal64(2, 1), decimal64(2, 1)});
+      CheckDispatchBest(name, {decimal32(2, 1), decimal64(2, 1)},
+                        {decimal128(2, 1), decimal128(2, 1)});
+      CheckDispatchBest(name, {decimal64(2, 0), decimal64(2, 1)},
+                        {decimal128(3, 1), decimal128(2, 1)});
     }
   }
   {
@@ -2197,6 +2213,58 @@ TEST_F(TestBinaryArithmeticDecimal, AddSubtract) {
                       ScalarFromJSON(decimal128(20, 0), R"("-222")"));
   }
 
+  // decimal32 and decimal64 produce decimal128
+  {
+    auto left = ArrayFromJSON(decimal32(9, 2),
+                              R"(["1.00", "-9999999.99", "9999999.99", null, "0.01"])");
+    auto right = ArrayFromJSON(decimal32(5, 2),
+                               R"(["-1.00", "-999.99", "999.99", "1.00", null])");
+    auto added = ArrayFromJSON(
+        decimal128(10, 2), R"(["0.00", "-10000999.98", "10000999.98", null, null])");
+    auto subtracted = ArrayFromJSON(
+        decimal128(10, 2), R"(["2.00", "-9999000.00", "9999000.00", null, null])");
+    CheckScalarBinary("add", left, right, added);
+    CheckScalarBinary("subtract", left, right, subtracted);
+  }
+  {
+    auto left = ArrayFromJSON(decimal64(18, 0),
+                              R"(["999999999999999999", "-999999999999999999", "0"])");
+    auto right = ScalarFromJSON(decimal64(18, 0), R"("999999999999999999")");
+    auto added = ArrayFromJSON(
+        decimal128(19, 0),
+        R"(["1999999999999999998", "0", "999999999999999999"])");
+    auto subtracted = ArrayFromJSON(
+        decimal128(19, 0),
+        R"(["0", "-1999999999999999998", "-999999999999999999"])");
+    CheckScalarBinary("add", left, right, added);
+    CheckScalarBinary("subtract", left, right, subtracted);
+  }
+
+  // decimal128 carry and borrow between the 64-bit words
+  {
+    auto left = ArrayFromJSON(decimal128(37, 0), R"([
+        "18446744073709551615",
+        "-18446744073709551616",
+        "-1",
+        "18446744073709551616"
+      ])");
+    auto right = ArrayFromJSON(decimal128(37, 0), R"(["1", "-1", "1", "-1"])");
+    auto added = ArrayFromJSON(decimal128(38, 0), R"([
+        "18446744073709551616",
+        "-18446744073709551617",
+        "0",
+        "18446744073709551615"
+      ])");
+    auto subtracted = ArrayFromJSON(decimal128(38, 0), R"([
+        "18446744073709551614",
+        "-18446744073709551615",
+        "-2",
+        "18446744073709551617"
+      ])");
+    CheckScalarBinary("add", left, right, added);
+    CheckScalarBinary("subtract", left, right, subtracted);
+  }
+
   // failed case: result maybe overflow
   {
     std::shared_ptr<Scalar> left, right;
@@ -17,6 +17,8 @@
 
 #include "benchmark/benchmark.h"
 
+#include <limits>
+#include <memory>
 #include <vector>
 
 #include "arrow/compute/cast.h"
@@ -58,6 +60,34 @@ static void BenchmarkFloatingToIntegerCast(benchmark::State& state,
   }
 }
 
+template <typename InputType, typename CType = typename InputType::c_type>
+static void BenchmarkToStringCast(benchmark::State& state,
+                                  std::shared_ptr<DataType> from_type, CType min,
+                                  CType max) {
+  GenericItemsArgs args(state);
+  random::RandomArrayGenerator rand(kSeed);
+  auto array = rand.Numeric<InputType>(args.size, min, max, args.null_proportion);
+  auto values = *array->View(from_type);
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(Cast(values, utf8()));
+  }
+}
+
+template <typename InputType, typename CType = typename InputType::c_type>
+static void BenchmarkFromStringCast(benchmark::State& state,
+                                    std::shared_ptr<DataType> to_type, CType min,
+                                    CType max) {
+  GenericItemsArgs args(state);
+  random::RandomArrayGenerator rand(kSeed);
+  auto array = rand.Numeric<InputType>(args.size, min, max, args.null_proportion);
+  std::shared_ptr<Array> values_as_string = *Cast(**array->View(to_type), utf8());
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(Cast(values_as_string, to_type));
+  }
+}
+
 std::vector<int64_t> g_data_sizes = {kL2Size};
 
 void CastSetArgs(benchmark::internal::Benchmark* bench) {
@@ -103,6 +133,46 @@ static void CastDoubleToInt32Unsafe(benchmark::State& state) {
                                             CastOptions::Unsafe(), -1000, 1000);
 }
 
+static void CastInt32ToString(benchmark::State& state) {
+  BenchmarkToStringCast<Int32Type>(state, int32(), kInt32Min, kInt32Max);
+}
+
+static void CastInt64ToString(benchmark::State& state) {
+  BenchmarkToStringCast<Int64Type>(state, int64(), std::numeric_limits<int64_t>::min(),
+                                   std::numeric_limits<int64_t>::max());
+}
+
+static void CastDoubleToString(benchmark::State& state) {
+  BenchmarkToStringCast<DoubleType>(state, float64(), -1e6, 1e6);
+}
+
+// Microseconds since the epoch at 2100-01-01
+static constexpr int64_t kMicros2100 = 4102444800000000;
+
+static void CastTimestampToString(benchmark::State& state) {
+  BenchmarkToStringCast<Int64Type>(state, timestamp(TimeUnit::MICRO), int64_t{0},
+                                   kMicros2100);
+}
+
+static void CastTimestampUtcToString(benchmark::State& state) {
+  BenchmarkToStringCast<Int64Type>(state, timestamp(TimeUnit::MICRO, "UTC"),
+                                   int64_t{0}, kMicros2100);
+}
+
+static void CastStringToInt64(benchmark::State& state) {
+  BenchmarkFromStringCast<Int64Type>(state, int64(), std::numeric_limits<int64_t>::min(),
+                                     std::numeric_limits<int64_t>::max());
+}
+
+static void CastStringToDouble(benchmark::State& state) {
+  BenchmarkFromStringCast<DoubleType>(state, float64(), -1e6, 1e6);
+}
+
+static void CastStringToTimestamp(benchmark::State& state) {
+  BenchmarkFromStringCast<Int64Type>(state, timestamp(TimeUnit::MICRO), int64_t{0},
+                                     kMicros2100);
+}
+
 BENCHMARK(CastInt64ToInt32Safe)->Apply(CastSetArgs);
 BENCHMARK(CastInt64ToInt32Unsafe)->Apply(CastSetArgs);
 BENCHMARK(CastUInt32ToInt32Safe)->Apply(CastSetArgs);
@@ -112,5 +182,14 @@ BENCHMARK(CastInt64ToDoubleUnsafe)->Apply(CastSetArgs);
 BENCHMARK(CastDoubleToInt32Safe)->Apply(CastSetArgs);
 BENCHMARK(CastDoubleToInt32Unsafe)->Apply(CastSetArgs);
 
+BENCHMARK(CastInt32ToString)->Apply(CastSetArgs);
+BENCHMARK(CastInt64ToString)->Apply(CastSetArgs);
+BENCHMARK(CastDoubleToString)->Apply(CastSetArgs);
+BENCHMARK(CastTimestampToString)->Apply(CastSetArgs);
+BENCHMARK(CastTimestampUtcToString)->Apply(CastSetArgs);
+BENCHMARK(CastStringToInt64)->Apply(CastSetArgs);
+BENCHMARK(CastStringToDouble)->Apply(CastSetArgs);
+BENCHMARK(CastStringToTimestamp)->Apply(CastSetArgs);
+
 }  // namespace compute
 }  // namespace arrow
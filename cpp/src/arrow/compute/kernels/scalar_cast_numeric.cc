@@ -551,6 +551,14 @@ struct DecimalConversions<Decimal128, Decimal32> {
   static Decimal128 ConvertOutput(Decimal128&& val) { return val; }
 };
 
+struct WidenDecimal {
+  template <typename OutValue, typename Arg0Value>
+  OutValue Call(KernelContext*, Arg0Value val, Status*) const {
+    using Conv = DecimalConversions<OutValue, Arg0Value>;
+    return Conv::ConvertOutput(Conv::ConvertInput(std::move(val)));
+  }
+};
+
 struct UnsafeUpscaleDecimal {
   template <typename OutValue, typename Arg0Value>
   OutValue Call(KernelContext*, Arg0Value val, Status*) const {
@@ -617,6 +625,21 @@ struct CastFunctor<O, I,
       }
     }
 
+    if (out_scale >= in_scale &&
+        out_type.precision() - out_scale >= in_type.precision() - in_scale &&
+        out_type.byte_width() >= in_type.byte_width()) {
+      // Every value of the input type is representable in the output type, so the
+      // per-value overflow and precision checks of the safe rescale can be skipped
+      if (in_scale == out_scale) {
+        applicator::ScalarUnaryNotNullStateful<O, I, WidenDecimal> kernel(
+            WidenDecimal{});
+        return kernel.Exec(ctx, batch, out);
+      }
+      applicator::ScalarUnaryNotNullStateful<O, I, UnsafeUpscaleDecimal> kernel(
+          UnsafeUpscaleDecimal{out_scale - in_scale});
+      return kernel.Exec(ctx, batch, out);
+    }
+
     // Safe rescale
     applicator::ScalarUnaryNotNullStateful<O, I, SafeRescaleDecimal> kernel(
         SafeRescaleDecimal{out_scale, out_type.precision(), in_scale});
@@ -15,8 +15,10 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cstring>
 #include <limits>
 #include <optional>
+#include <type_traits>
 
 #include "arrow/array/array_base.h"
 #include "arrow/array/builder_binary.h"
@@ -38,6 +40,7 @@
 
 namespace arrow {
 
+using internal::IntToStringFormatterMixin;
 using internal::StringFormatter;
 using internal::VisitSetBitRunsVoid;
 using util::InitializeUTF8;
@@ -51,6 +54,70 @@ namespace {
 // ----------------------------------------------------------------------
 // Number / Boolean to String
 
+// Whether I is formatted as a plain integer
+template <typename I>
+constexpr bool kFormatsAsInteger =
+    std::is_base_of_v<IntToStringFormatterMixin<I>, StringFormatter<I>>;
+
+// The size of a formatted integer is known without formatting it, so the
+// output is sized exactly in a first pass, and the digits are then written
+// directly into it instead of going through a builder.
+template <typename O, typename I>
+Status IntegerToStringCastExec(KernelContext* ctx, const ArraySpan& input,
+                               ExecResult* out) {
+  using value_type = typename TypeTraits<I>::CType;
+  using offset_type = typename O::offset_type;
+  using FormatterType = StringFormatter<I>;
+
+  ArrayData* output = out->array_data().get();
+  const value_type* values = input.GetValues<value_type>(1);
+  const uint8_t* validity = input.MayHaveNulls() ? input.buffers[0].data : nullptr;
+
+  ARROW_ASSIGN_OR_RAISE(output->buffers[1],
+                        ctx->Allocate((input.length + 1) * sizeof(offset_type)));
+  auto* offsets = output->GetMutableValues<offset_type>(1);
+  std::memset(offsets, 0, (input.length + 1) * sizeof(offset_type));
+  VisitSetBitRunsVoid(validity, input.offset, input.length,
+                      [&](int64_t position, int64_t length) {
+                        for (int64_t i = position; i < position + length; ++i) {
+                          offsets[i + 1] = static_cast<offset_type>(
+                              FormatterType::FormattedSize(values[i]));
+                        }
+                      });
+  int64_t data_length = 0;
+  for (int64_t i = 0; i <= input.length; ++i) {
+    data_length += offsets[i];
+    offsets[i] = static_cast<offset_type>(data_length);
+  }
+  if (data_length > std::numeric_limits<offset_type>::max()) {
+    return Status::Invalid("Failed casting from ", input.type->ToString(), " to ",
+                           output->type->ToString(), ": output array too large");
+  }
+
+  ARROW_ASSIGN_OR_RAISE(output->buffers[2], ctx->Allocate(data_length));
+  auto* data = reinterpret_cast<char*>(output->buffers[2]->mutable_data());
+  VisitSetBitRunsVoid(validity, input.offset, input.length,
+                      [&](int64_t position, int64_t length) {
+                        for (int64_t i = position; i < position + length; ++i) {
+                          FormatterType::FormatBackward(values[i], data + offsets[i + 1]);
+                        }
+                      });
+
+  if (validity == nullptr) {
+    output->buffers[0] = nullptr;
+    output->null_count = 0;
+  } else if (input.offset == 0) {
+    output->buffers[0] = input.GetBuffer(0);
+    output->null_count = input.null_count;
+  } else {
+    ARROW_ASSIGN_OR_RAISE(output->buffers[0],
+                          arrow::internal::CopyBitmap(ctx->memory_pool(), validity,
+                                                      input.offset, input.length));
+    output->null_count = input.null_count;
+  }
+  return Status::OK();
+}
+
 template <typename O, typename I>
 struct NumericToStringCastFunctor {
   using value_type = typename TypeTraits<I>::CType;
@@ -59,8 +126,12 @@ struct NumericToStringCastFunctor {
 
   static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
     const ArraySpan& input = batch[0].array;
+    if constexpr (kFormatsAsInteger<I> && is_base_binary_type<O>::value) {
+      return IntegerToStringCastExec<O, I>(ctx, input, out);
+    }
     FormatterType formatter(input.type);
     BuilderType builder(input.type->GetSharedPtr(), ctx->memory_pool());
+    RETURN_NOT_OK(builder.Reserve(input.length));
     RETURN_NOT_OK(VisitArraySpanInline<I>(
         input,
         [&](value_type v) {
@@ -111,8 +182,12 @@ struct TemporalToStringCastFunctor {
 
   static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
     const ArraySpan& input = batch[0].array;
+    if constexpr (kFormatsAsInteger<I> && is_base_binary_type<O>::value) {
+      return IntegerToStringCastExec<O, I>(ctx, input, out);
+    }
     FormatterType formatter(input.type);
     BuilderType builder(input.type->GetSharedPtr(), ctx->memory_pool());
+    RETURN_NOT_OK(builder.Reserve(input.length));
     RETURN_NOT_OK(VisitArraySpanInline<I>(
         input,
         [&](value_type v) {
@@ -153,7 +228,9 @@ struct TemporalToStringCastFunctor<O, TimestampType> {
     RETURN_NOT_OK(
         builder.ReserveData((input.length - input.GetNullCount()) * string_length));
 
-    if (timezone.empty()) {
+    // UTC timestamps are formatted like naive ones with a "Z" suffix, which
+    // doesn't need a time zone lookup per value
+    if (timezone.empty() || timezone == "UTC") {
       FormatterType formatter(input.type);
       RETURN_NOT_OK(VisitArraySpanInline<TimestampType>(
           input,
@@ -196,12 +273,10 @@ struct TemporalToStringCastFunctor<O, TimestampType> {
   static Status ConvertZoned(const ArraySpan& input, const std::string& timezone,
                              BuilderType* builder) {
     static const std::string kFormatString = "%Y-%m-%d %H:%M:%S%z";
-    static const std::string kUtcFormatString = "%Y-%m-%d %H:%M:%SZ";
     DCHECK(!timezone.empty());
     ARROW_ASSIGN_OR_RAISE(auto tz, LocateZone(timezone));
     ARROW_ASSIGN_OR_RAISE(auto locale, GetLocale("C"));
-    TimestampFormatter<Duration> formatter{
-        timezone == "UTC" ? kUtcFormatString : kFormatString, tz, locale};
+    TimestampFormatter<Duration> formatter{kFormatString, tz, locale};
     return VisitArraySpanInline<TimestampType>(
         input,
         [&](value_type v) {
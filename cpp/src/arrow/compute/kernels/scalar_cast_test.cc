@@ -252,6 +252,23 @@ TEST(Cast, SameTypeZeroCopy) {
   AssertBufferSame(*arr, *result, 1);
 }
 
+TEST(Cast, Statistics) {
+  std::shared_ptr<Array> arr = ArrayFromJSON(int8(), "[-3, null, 100]");
+  arr->data()->statistics = ComputeArrayStatistics(*arr->data());
+
+  // Widening integer casts keep every statistic
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Array> result, Cast(*arr, int64()));
+  ASSERT_NE(result->statistics(), nullptr);
+  ASSERT_EQ(*arr->statistics(), *result->statistics());
+
+  // Casts that don't preserve values only keep the counts
+  ASSERT_OK_AND_ASSIGN(result, Cast(*arr, utf8()));
+  ASSERT_NE(result->statistics(), nullptr);
+  ASSERT_EQ(arr->statistics()->null_count, result->statistics()->null_count);
+  ASSERT_FALSE(result->statistics()->min.has_value());
+  ASSERT_FALSE(result->statistics()->max.has_value());
+}
+
 TEST(Cast, ZeroChunks) {
   auto chunked_i32 = std::make_shared<ChunkedArray>(ArrayVector{}, int32());
   ASSERT_OK_AND_ASSIGN(Datum result, Cast(chunked_i32, utf8()));
@@ -4518,6 +4535,38 @@ TEST(Cast, DictTypeToAnotherDict) {
       Cast(arr, dictionary(int8(), int8()), CastOptions::Safe()));
 }
 
+TEST(Cast, RunEndEncodedToRunEndEncoded) {
+  auto run_end_encode = [](const std::shared_ptr<Array>& values,
+                           const std::shared_ptr<DataType>& run_end_type) {
+    return RunEndEncode(values, RunEndEncodeOptions(run_end_type))
+        .ValueOrDie()
+        .make_array();
+  };
+
+  const std::string json = "[1, 1, 2, null, null, 3, 3, 3]";
+  for (const auto& run_end_type : {int16(), int32(), int64()}) {
+    auto input = run_end_encode(ArrayFromJSON(int32(), json), run_end_type);
+    for (const auto& to_run_end_type : {int16(), int32(), int64()}) {
+      // this checks for scalars and slices as well
+      CheckCast(input, run_end_encode(ArrayFromJSON(float64(), json), to_run_end_type));
+      CheckCast(input, run_end_encode(ArrayFromJSON(int8(), json), to_run_end_type));
+    }
+  }
+
+  // Casting the values follows the options
+  auto input = run_end_encode(ArrayFromJSON(int32(), "[1, 1, 1000]"), int32());
+  CheckCastFails(input, CastOptions::Safe(run_end_encoded(int32(), int8())));
+  ASSERT_OK_AND_ASSIGN(auto casted, Cast(input, run_end_encoded(int32(), int8()),
+                                         CastOptions::Unsafe()));
+  ValidateOutput(casted);
+
+  // Run ends must fit in the new run end type
+  ASSERT_OK_AND_ASSIGN(auto long_input,
+                       MakeArrayFromScalar(Int32Scalar(1), /*length=*/40000));
+  input = run_end_encode(long_input, int32());
+  ASSERT_RAISES(Invalid, Cast(input, run_end_encoded(int16(), int32())));
+}
+
 TEST(Cast, NoOutBitmapIfInIsAllValid) {
   auto a = ArrayFromJSON(int8(), "[1]");
   CastOptions options;
@@ -59,7 +59,14 @@ struct Greater {
   template <typename T, typename Arg0, typename Arg1>
   static constexpr T Call(KernelContext*, const Arg0& left, const Arg1& right, Status*) {
     static_assert(std::is_same<T, bool>::value && std::is_same<Arg0, Arg1>::value, "");
-    return left > right;
+    if constexpr (std::is_same<Arg0, Decimal128>::value) {
+      // Compare the words inline rather than calling the out-of-line operator
+      return left.high_bits() > right.high_bits() ||
+             (left.high_bits() == right.high_bits() &&
+              left.low_bits() > right.low_bits());
+    } else {
+      return left > right;
+    }
   }
 };
 
@@ -67,7 +74,14 @@ struct GreaterEqual {
   template <typename T, typename Arg0, typename Arg1>
   static constexpr T Call(KernelContext*, const Arg0& left, const Arg1& right, Status*) {
     static_assert(std::is_same<T, bool>::value && std::is_same<Arg0, Arg1>::value, "");
-    return left >= right;
+    if constexpr (std::is_same<Arg0, Decimal128>::value) {
+      // Compare the words inline rather than calling the out-of-line operator
+      return left.high_bits() > right.high_bits() ||
+             (left.high_bits() == right.high_bits() &&
+              left.low_bits() >= right.low_bits());
+    } else {
+      return left >= right;
+    }
   }
 };
 
@@ -342,7 +356,7 @@ struct CompareFunction : ScalarFunction {
 
   Result<const Kernel*> DispatchBest(std::vector<TypeHolder>* types) const override {
     RETURN_NOT_OK(CheckArity(types->size()));
-    if (HasDecimal(*types)) {
+    if (HasDecimal(*types) && !HaveSameScaleNarrowDecimals(*types)) {
       RETURN_NOT_OK(CastBinaryDecimalArgs(DecimalPromotion::kAdd, types));
     }
 
@@ -434,6 +448,17 @@ std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name, FunctionDo
     DCHECK_OK(func->AddKernel({ty, ty}, boolean(), std::move(exec)));
   }
 
+  // Decimal32 and Decimal64 values of the same scale compare like their storage
+  for (const auto& storage_type : {int32(), int64()}) {
+    InputType in_type(storage_type->id() == Type::INT32 ? Type::DECIMAL32
+                                                        : Type::DECIMAL64);
+    ArrayKernelExec exec = GeneratePhysicalNumeric<CompareKernel>(storage_type);
+    ScalarKernel kernel = GetCompareKernel<Op>(in_type, storage_type->id(), exec);
+    kernel.signature = KernelSignature::Make(
+        {in_type, in_type}, boolean(), /*is_varargs=*/false, DecimalsHaveSameScale());
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
+  }
+
   for (const auto id : {Type::DECIMAL128, Type::DECIMAL256}) {
     auto exec = GenerateDecimal<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(id);
     DCHECK_OK(func->AddKernel({InputType(id), InputType(id)}, boolean(), std::move(exec),
@@ -681,6 +681,39 @@ TYPED_TEST(TestCompareDecimal, DifferentParameters) {
   }
 }
 
+TYPED_TEST(TestCompareDecimal, AcrossWords) {
+  // Values on both sides of the 64-bit word boundary
+  auto ty = std::make_shared<TypeParam>(25, 0);
+
+  std::vector<std::pair<std::string, std::string>> cases = {
+      {"equal", "[0, 0, 0, 0, 1]"},   {"not_equal", "[1, 1, 1, 1, 0]"},
+      {"less", "[1, 0, 1, 0, 0]"},    {"less_equal", "[1, 0, 1, 0, 1]"},
+      {"greater", "[0, 1, 0, 1, 0]"}, {"greater_equal", "[0, 1, 0, 1, 1]"},
+  };
+
+  auto lhs = ArrayFromJSON(ty, R"([
+      "18446744073709551615",
+      "18446744073709551616",
+      "-18446744073709551616",
+      "-1",
+      "-18446744073709551617"
+    ])");
+  auto rhs = ArrayFromJSON(ty, R"([
+      "18446744073709551616",
+      "18446744073709551615",
+      "-18446744073709551615",
+      "-18446744073709551616",
+      "-18446744073709551617"
+    ])");
+  for (const auto& op : cases) {
+    const auto& function = op.first;
+    const auto& expected = op.second;
+
+    SCOPED_TRACE(function);
+    CheckScalarBinary(function, lhs, rhs, ArrayFromJSON(boolean(), expected));
+  }
+}
+
 TYPED_TEST(TestCompareDecimal, ErrorOnNonCastable) {
   auto dec_ty = std::make_shared<TypeParam>(3, 2);
   auto dec_arr = ArrayFromJSON(dec_ty, R"([])");
@@ -701,6 +734,51 @@ TYPED_TEST(TestCompareDecimal, ErrorOnNonCastable) {
   }
 }
 
+// Decimal32 and Decimal64 compare on their storage when the scales match
+template <typename ArrowType>
+class TestCompareNarrowDecimal : public ::testing::Test {};
+using NarrowDecimalArrowTypes = ::testing::Types<Decimal32Type, Decimal64Type>;
+TYPED_TEST_SUITE(TestCompareNarrowDecimal, NarrowDecimalArrowTypes);
+
+TYPED_TEST(TestCompareNarrowDecimal, SameScale) {
+  auto ty1 = std::make_shared<TypeParam>(3, 2);
+  auto ty2 = std::make_shared<TypeParam>(5, 2);
+
+  std::vector<std::pair<std::string, std::string>> cases = {
+      {"equal", "[1, 0, 0, 1, 0, 0, null]"},
+      {"not_equal", "[0, 1, 1, 0, 1, 1, null]"},
+      {"less", "[0, 1, 0, 0, 1, 0, null]"},
+      {"less_equal", "[1, 1, 0, 1, 1, 0, null]"},
+      {"greater", "[0, 0, 1, 0, 0, 1, null]"},
+      {"greater_equal", "[1, 0, 1, 1, 0, 1, null]"},
+  };
+
+  auto lhs =
+      ArrayFromJSON(ty1, R"(["1.23", "1.23", "2.34", "-1.23", "-1.23", "1.23", null])");
+  auto rhs = ArrayFromJSON(
+      ty2, R"(["1.23", "234.00", "1.23", "-1.23", "1.23", "-123.00", "1.23"])");
+  for (const auto& op : cases) {
+    const auto& function = op.first;
+    const auto& expected = op.second;
+
+    SCOPED_TRACE(function);
+    CheckScalarBinary(function, lhs, rhs, ArrayFromJSON(boolean(), expected));
+  }
+
+  auto scalar = ScalarFromJSON(ty2, R"("1.23")");
+  CheckScalarBinary("less", lhs, scalar,
+                    ArrayFromJSON(boolean(), "[0, 0, 0, 1, 1, 0, null]"));
+  CheckScalarBinary("less", scalar, lhs,
+                    ArrayFromJSON(boolean(), "[0, 0, 1, 0, 0, 0, null]"));
+
+  // Different scales are promoted to decimal128
+  auto rhs_scaled = ArrayFromJSON(std::make_shared<TypeParam>(4, 3),
+                                  R"(["1.230", "2.340", "1.230", "-1.230", "1.230",
+                                      "-1.230", "1.230"])");
+  CheckScalarBinary("less", lhs, rhs_scaled,
+                    ArrayFromJSON(boolean(), "[0, 1, 0, 0, 1, 0, null]"));
+}
+
 // Helper to organize tests for fixed size binary comparisons
 struct CompareCase {
   std::shared_ptr<DataType> lhs_type;
@@ -38,6 +38,7 @@ namespace arrow {
 using internal::BitBlockCount;
 using internal::BitBlockCounter;
 using internal::Bitmap;
+using internal::BitmapUInt64Reader;
 using internal::BitmapWordReader;
 using internal::BitRunReader;
 
@@ -1397,6 +1398,84 @@ void CopyOneValue(const ExecValue& in_values, const int64_t in_offset, uint8_t*
   }
 }
 
+// The rows of a batch which haven't been matched yet by a 'case when' condition
+// or a 'coalesce' argument, as a bitmap of words shrinking with each argument.
+// Matched rows are visited as runs so that values are copied in bulk.
+class UnmatchedRows {
+ public:
+  static Result<UnmatchedRows> Make(KernelContext* ctx, int64_t length) {
+    const int64_t num_words = bit_util::CeilDiv(length, 64);
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ctx->Allocate(num_words * sizeof(uint64_t)));
+    auto* words = buffer->mutable_data_as<uint64_t>();
+    std::fill(words, words + num_words, ~uint64_t{0});
+    if (length % 64 != 0) {
+      words[num_words - 1] = bit_util::LeastSignificantBitMask<uint64_t>(length % 64);
+    }
+    return UnmatchedRows(std::move(buffer), length);
+  }
+
+  int64_t remaining() const { return remaining_; }
+
+  // Visit the runs (offset, length) of the unmatched rows set in `bitmap` and in
+  // `validity` (if not null), and mark them as matched
+  template <typename Visit>
+  void Match(const uint8_t* bitmap, const uint8_t* validity, int64_t bitmap_offset,
+             Visit&& visit) {
+    auto* words = buffer_->mutable_data_as<uint64_t>();
+    BitmapUInt64Reader bits(bitmap, bitmap_offset, length_);
+    std::optional<BitmapUInt64Reader> valid_bits;
+    if (validity != nullptr) {
+      valid_bits.emplace(validity, bitmap_offset, length_);
+    }
+    const int64_t num_words = bit_util::CeilDiv(length_, 64);
+    for (int64_t i = 0; i < num_words && remaining_ > 0; ++i) {
+      uint64_t word = bits.NextWord() & words[i];
+      if (valid_bits) {
+        word &= valid_bits->NextWord();
+      }
+      if (word != 0) {
+        words[i] &= ~word;
+        remaining_ -= bit_util::PopCount(word);
+        VisitRuns(word, i * 64, visit);
+      }
+    }
+  }
+
+  // Visit the runs (offset, length) of all the unmatched rows, and mark them as
+  // matched
+  template <typename Visit>
+  void MatchAll(Visit&& visit) {
+    auto* words = buffer_->mutable_data_as<uint64_t>();
+    const int64_t num_words = bit_util::CeilDiv(length_, 64);
+    for (int64_t i = 0; i < num_words && remaining_ > 0; ++i) {
+      if (words[i] != 0) {
+        VisitRuns(words[i], i * 64, visit);
+        words[i] = 0;
+      }
+    }
+    remaining_ = 0;
+  }
+
+ private:
+  UnmatchedRows(std::shared_ptr<Buffer> buffer, int64_t length)
+      : buffer_(std::move(buffer)), length_(length), remaining_(length) {}
+
+  template <typename Visit>
+  static void VisitRuns(uint64_t word, int64_t word_offset, Visit&& visit) {
+    while (word != 0) {
+      const int start = bit_util::CountTrailingZeros(word);
+      const uint64_t shifted = ~(word >> start);
+      const int length = shifted == 0 ? 64 : bit_util::CountTrailingZeros(shifted);
+      visit(word_offset + start, static_cast<int64_t>(length));
+      word = start + length == 64 ? 0 : word & (~uint64_t{0} << (start + length));
+    }
+  }
+
+  std::shared_ptr<Buffer> buffer_;
+  int64_t length_;
+  int64_t remaining_;
+};
+
 struct CaseWhenFunction : ScalarFunction {
   using ScalarFunction::ScalarFunction;
 
@@ -1541,106 +1620,44 @@ Status ExecArrayCaseWhen(KernelContext* ctx, const ExecSpan& batch, ExecResult*
   uint8_t* out_valid = output->buffers[0].data;
   uint8_t* out_values = output->buffers[1].data;
 
-  if (have_else_arg) {
-    // Copy 'else' value into output
-    CopyValues<Type>(batch.values.back(), /*in_offset=*/0, batch.length, out_valid,
-                     out_values, out_offset);
-  } else {
+  if (!have_else_arg) {
     // There's no 'else' argument, so we should have an all-null validity bitmap
     bit_util::SetBitsTo(out_valid, out_offset, batch.length, false);
   }
 
-  // Allocate a temporary bitmap to determine which elements still need setting.
-  ARROW_ASSIGN_OR_RAISE(auto mask_buffer, ctx->AllocateBitmap(batch.length));
-  uint8_t* mask = mask_buffer->mutable_data();
-  std::memset(mask, 0xFF, mask_buffer->size());
-
-  // Then iterate through each argument in turn and set elements.
-  for (int i = 0; i < batch.num_values() - (have_else_arg ? 2 : 1); i++) {
+  // Each condition is only evaluated for the rows not matched by the previous
+  // ones, and the values are copied into the output as runs of matched rows
+  ARROW_ASSIGN_OR_RAISE(auto unmatched, UnmatchedRows::Make(ctx, batch.length));
+  const int num_conds = batch.num_values() - (have_else_arg ? 2 : 1);
+  for (int i = 0; i < num_conds && unmatched.remaining() > 0; i++) {
     const ArraySpan& cond_array = conds_array.child_data[i];
-    const int64_t cond_offset = conds_array.offset + cond_array.offset;
-    const uint8_t* cond_values = cond_array.buffers[1].data;
     const ExecValue& value = batch[i + 1];
-    int64_t offset = 0;
-
-    if (cond_array.GetNullCount() == 0) {
-      // If no valid buffer, visit mask & cond bitmap simultaneously
-      BinaryBitBlockCounter counter(mask, /*start_offset=*/0, cond_values, cond_offset,
-                                    batch.length);
-      while (offset < batch.length) {
-        const auto block = counter.NextAndWord();
-        if (block.AllSet()) {
-          CopyValues<Type>(value, offset, block.length, out_valid, out_values,
-                           out_offset + offset);
-          bit_util::SetBitsTo(mask, offset, block.length, false);
-        } else if (block.popcount) {
-          for (int64_t j = 0; j < block.length; ++j) {
-            if (bit_util::GetBit(mask, offset + j) &&
-                bit_util::GetBit(cond_values, cond_offset + offset + j)) {
-              CopyValues<Type>(value, offset + j, /*length=*/1, out_valid, out_values,
-                               out_offset + offset + j);
-              bit_util::SetBitTo(mask, offset + j, false);
-            }
-          }
-        }
-        offset += block.length;
-      }
-    } else {
-      // Visit mask & cond bitmap & cond validity
-      const uint8_t* cond_valid = cond_array.buffers[0].data;
-      Bitmap bitmaps[3] = {{mask, /*offset=*/0, batch.length},
-                           {cond_values, cond_offset, batch.length},
-                           {cond_valid, cond_offset, batch.length}};
-      Bitmap::VisitWords(bitmaps, [&](std::array<uint64_t, 3> words) {
-        const uint64_t word = words[0] & words[1] & words[2];
-        const int64_t block_length = std::min<int64_t>(64, batch.length - offset);
-        if (word == std::numeric_limits<uint64_t>::max()) {
-          CopyValues<Type>(value, offset, block_length, out_valid, out_values,
-                           out_offset + offset);
-          bit_util::SetBitsTo(mask, offset, block_length, false);
-        } else if (word) {
-          for (int64_t j = 0; j < block_length; ++j) {
-            if (bit_util::GetBit(mask, offset + j) &&
-                bit_util::GetBit(cond_valid, cond_offset + offset + j) &&
-                bit_util::GetBit(cond_values, cond_offset + offset + j)) {
-              CopyValues<Type>(value, offset + j, /*length=*/1, out_valid, out_values,
-                               out_offset + offset + j);
-              bit_util::SetBitTo(mask, offset + j, false);
-            }
-          }
-        }
-        offset += block_length;
-      });
-    }
+    unmatched.Match(cond_array.buffers[1].data,
+                    cond_array.GetNullCount() > 0 ? cond_array.buffers[0].data : nullptr,
+                    conds_array.offset + cond_array.offset,
+                    [&](int64_t offset, int64_t length) {
+                      CopyValues<Type>(value, offset, length, out_valid, out_values,
+                                       out_offset + offset);
+                    });
   }
-  if (!have_else_arg) {
+  if (have_else_arg) {
+    // Copy 'else' value into the remaining slots
+    unmatched.MatchAll([&](int64_t offset, int64_t length) {
+      CopyValues<Type>(batch.values.back(), offset, length, out_valid, out_values,
+                       out_offset + offset);
+    });
+  } else {
     // Need to initialize any remaining null slots (uninitialized memory)
-    BitBlockCounter counter(mask, /*offset=*/0, batch.length);
-    int64_t offset = 0;
     auto bit_width = checked_cast<const FixedWidthType&>(*out->type()).bit_width();
     auto byte_width = bit_util::BytesForBits(bit_width);
-    while (offset < batch.length) {
-      const auto block = counter.NextWord();
-      if (block.AllSet()) {
-        if (bit_width == 1) {
-          bit_util::SetBitsTo(out_values, out_offset + offset, block.length, false);
-        } else {
-          std::memset(out_values + (out_offset + offset) * byte_width, 0x00,
-                      byte_width * block.length);
-        }
-      } else if (!block.NoneSet()) {
-        for (int64_t j = 0; j < block.length; ++j) {
-          if (bit_util::GetBit(out_valid, out_offset + offset + j)) continue;
-          if (bit_width == 1) {
-            bit_util::ClearBit(out_values, out_offset + offset + j);
-          } else {
-            std::memset(out_values + (out_offset + offset + j) * byte_width, 0x00,
-                        byte_width);
-          }
-        }
+    unmatched.MatchAll([&](int64_t offset, int64_t length) {
+      if (bit_width == 1) {
+        bit_util::SetBitsTo(out_values, out_offset + offset, length, false);
+      } else {
+        std::memset(out_values + (out_offset + offset) * byte_width, 0x00,
+                    byte_width * length);
       }
-      offset += block.length;
-    }
+    });
   }
   return Status::OK();
 }
@@ -1698,6 +1715,34 @@ Status ExecVarWidthScalarCaseWhen(KernelContext* ctx, const ExecSpan& batch,
   return Status::OK();
 }
 
+// Append the value of the argument selected for each row (or a null for -1),
+// as runs of consecutive rows selecting the same argument
+template <typename AppendScalar>
+Status AppendSelectedValues(const ExecSpan& batch, const std::vector<int>& selected,
+                            ArrayBuilder* builder, AppendScalar&& append_scalar) {
+  const int64_t length = static_cast<int64_t>(selected.size());
+  int64_t row = 0;
+  while (row < length) {
+    const int arg = selected[row];
+    int64_t run_end = row + 1;
+    while (run_end < length && selected[run_end] == arg) {
+      ++run_end;
+    }
+    const int64_t run_length = run_end - row;
+    if (arg < 0 || (batch[arg].is_scalar() && !batch[arg].scalar->is_valid)) {
+      RETURN_NOT_OK(builder->AppendNulls(run_length));
+    } else if (batch[arg].is_scalar()) {
+      for (int64_t i = 0; i < run_length; ++i) {
+        RETURN_NOT_OK(append_scalar(builder, *batch[arg].scalar));
+      }
+    } else {
+      RETURN_NOT_OK(builder->AppendArraySlice(batch[arg].array, row, run_length));
+    }
+    row = run_end;
+  }
+  return Status::OK();
+}
+
 // Use std::function for reserve_data to avoid instantiating as many templates
 template <typename AppendScalar>
 static Status ExecVarWidthArrayCaseWhenImpl(
@@ -1711,42 +1756,25 @@ static Status ExecVarWidthArrayCaseWhenImpl(
   RETURN_NOT_OK(raw_builder->Reserve(batch.length));
   RETURN_NOT_OK(reserve_data(raw_builder.get()));
 
-  for (int64_t row = 0; row < batch.length; row++) {
-    int64_t selected = have_else_arg ? (batch.num_values() - 1) : -1;
-    for (int64_t arg = 0; static_cast<size_t>(arg) < conds_array.child_data.size();
-         arg++) {
-      const ArraySpan& cond_array = conds_array.child_data[arg];
-      if ((cond_array.buffers[0].data == nullptr ||
-           bit_util::GetBit(cond_array.buffers[0].data,
-                            conds_array.offset + cond_array.offset + row)) &&
-          bit_util::GetBit(cond_array.buffers[1].data,
-                           conds_array.offset + cond_array.offset + row)) {
-        selected = arg + 1;
-        break;
-      }
-    }
-    if (selected < 0) {
-      RETURN_NOT_OK(raw_builder->AppendNull());
-      continue;
-    }
-    const ExecValue& source = batch[selected];
-    if (source.is_scalar()) {
-      const Scalar& scalar = *source.scalar;
-      if (!scalar.is_valid) {
-        RETURN_NOT_OK(raw_builder->AppendNull());
-      } else {
-        RETURN_NOT_OK(append_scalar(raw_builder.get(), scalar));
-      }
-    } else {
-      const ArraySpan& array = source.array;
-      if (array.buffers[0].data == nullptr ||
-          bit_util::GetBit(array.buffers[0].data, array.offset + row)) {
-        RETURN_NOT_OK(raw_builder->AppendArraySlice(array, row, /*length=*/1));
-      } else {
-        RETURN_NOT_OK(raw_builder->AppendNull());
-      }
-    }
+  // The index of the argument selected for each row, or -1 for null
+  std::vector<int> selected(batch.length, -1);
+  ARROW_ASSIGN_OR_RAISE(auto unmatched, UnmatchedRows::Make(ctx, batch.length));
+  for (int arg = 0;
+       arg < static_cast<int>(conds_array.child_data.size()) && unmatched.remaining() > 0;
+       arg++) {
+    const ArraySpan& cond_array = conds_array.child_data[arg];
+    unmatched.Match(cond_array.buffers[1].data, cond_array.buffers[0].data,
+                    conds_array.offset + cond_array.offset,
+                    [&](int64_t offset, int64_t length) {
+                      std::fill_n(selected.begin() + offset, length, arg + 1);
+                    });
+  }
+  if (have_else_arg) {
+    unmatched.MatchAll([&](int64_t offset, int64_t length) {
+      std::fill_n(selected.begin() + offset, length, batch.num_values() - 1);
+    });
   }
+  RETURN_NOT_OK(AppendSelectedValues(batch, selected, raw_builder.get(), append_scalar));
   ARROW_ASSIGN_OR_RAISE(auto temp_output, raw_builder->Finish());
   out->value = std::move(temp_output->data());
   return Status::OK();
@@ -2135,6 +2163,11 @@ Status ExecArrayCoalesce(KernelContext* ctx, const ExecSpan& batch, ExecResult*
           offset += block.length;
         }
       }
+      if (arrow::internal::CountSetBits(out_valid, out_offset, batch.length) ==
+          batch.length) {
+        // All slots are set, the remaining arguments aren't needed
+        break;
+      }
     }
   }
 
@@ -2300,27 +2333,26 @@ static Status ExecVarWidthCoalesceImpl(KernelContext* ctx, const ExecSpan& batch
   RETURN_NOT_OK(raw_builder->Reserve(batch.length));
   RETURN_NOT_OK(reserve_data(raw_builder.get()));
 
-  for (int64_t i = 0; i < batch.length; i++) {
-    bool set = false;
-    for (const auto& value : batch.values) {
-      if (value.is_scalar()) {
-        if (value.scalar->is_valid) {
-          RETURN_NOT_OK(append_scalar(raw_builder.get(), *value.scalar));
-          set = true;
-          break;
-        }
-      } else {
-        const ArraySpan& source = value.array;
-        if (!source.MayHaveNulls() ||
-            bit_util::GetBit(source.buffers[0].data, source.offset + i)) {
-          RETURN_NOT_OK(raw_builder->AppendArraySlice(source, i, /*length=*/1));
-          set = true;
-          break;
-        }
+  // The index of the first valid argument for each row, or -1 for null
+  std::vector<int> selected(batch.length, -1);
+  ARROW_ASSIGN_OR_RAISE(auto unmatched, UnmatchedRows::Make(ctx, batch.length));
+  for (int arg = 0; arg < batch.num_values() && unmatched.remaining() > 0; arg++) {
+    auto select = [&](int64_t offset, int64_t length) {
+      std::fill_n(selected.begin() + offset, length, arg);
+    };
+    const ExecValue& value = batch[arg];
+    if (value.is_scalar()) {
+      if (value.scalar->is_valid) {
+        unmatched.MatchAll(select);
       }
+    } else if (!value.array.MayHaveNulls()) {
+      unmatched.MatchAll(select);
+    } else {
+      unmatched.Match(value.array.buffers[0].data, /*validity=*/nullptr,
+                      value.array.offset, select);
     }
-    if (!set) RETURN_NOT_OK(raw_builder->AppendNull());
   }
+  RETURN_NOT_OK(AppendSelectedValues(batch, selected, raw_builder.get(), append_scalar));
   ARROW_ASSIGN_OR_RAISE(auto temp_output, raw_builder->Finish());
   out->value = std::move(temp_output->data());
   out->array_data()->type = batch[0].type()->GetSharedPtr();
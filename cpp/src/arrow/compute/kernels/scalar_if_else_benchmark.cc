@@ -359,6 +359,40 @@ static void CaseWhenBenchContiguous(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * (len - offset));
 }
 
+// A 'case when' with many branches, each matching a fraction of the rows left by
+// the previous ones
+template <typename Type>
+static void CaseWhenBenchManyBranches(benchmark::State& state) {
+  constexpr int kNumBranches = 10;
+  auto type = TypeTraits<Type>::type_singleton();
+
+  int64_t len = state.range(0);
+  int64_t offset = state.range(1);
+
+  random::RandomArrayGenerator rand(/*seed=*/0);
+
+  auto cond_field = field(
+      "cond", boolean(),
+      key_value_metadata({"null_probability", "true_probability"}, {"0.01", "0.2"}));
+  auto cond = rand.ArrayOf(*field("", struct_(FieldVector(kNumBranches, cond_field)),
+                                  key_value_metadata({{"null_probability", "0.0"}})),
+                           len)
+                  ->Slice(offset);
+  std::vector<Datum> values;
+  for (int i = 0; i <= kNumBranches; ++i) {
+    values.emplace_back(
+        rand.ArrayOf(type, len, /*null_probability=*/0.01)->Slice(offset));
+  }
+  for (auto _ : state) {
+    ABORT_NOT_OK(CaseWhen(cond, values));
+  }
+
+  // Set bytes processed to ~length of output
+  state.SetBytesProcessed(state.iterations() *
+                          GetBytesProcessed(*values[0].make_array()));
+  state.SetItemsProcessed(state.iterations() * (len - offset));
+}
+
 static void CaseWhenBench64(benchmark::State& state) {
   return CaseWhenBench<UInt64Type>(state);
 }
@@ -367,6 +401,10 @@ static void CaseWhenBench64Contiguous(benchmark::State& state) {
   return CaseWhenBenchContiguous<UInt64Type>(state);
 }
 
+static void CaseWhenBench64ManyBranches(benchmark::State& state) {
+  return CaseWhenBenchManyBranches<UInt64Type>(state);
+}
+
 static void CaseWhenBenchString(benchmark::State& state) {
   return CaseWhenBench<StringType>(state);
 }
@@ -375,6 +413,10 @@ static void CaseWhenBenchStringContiguous(benchmark::State& state) {
   return CaseWhenBenchContiguous<StringType>(state);
 }
 
+static void CaseWhenBenchStringManyBranches(benchmark::State& state) {
+  return CaseWhenBenchManyBranches<StringType>(state);
+}
+
 template <typename ListType, typename ValueType>
 static void CaseWhenBenchVarLengthListLike(benchmark::State& state) {
   auto value_type = TypeTraits<ValueType>::type_singleton();
@@ -550,6 +592,8 @@ BENCHMARK(CaseWhenBench64)->Args({kNumItems, 0});
 BENCHMARK(CaseWhenBench64)->Args({kNumItems, 99});
 BENCHMARK(CaseWhenBench64Contiguous)->Args({kNumItems, 0});
 BENCHMARK(CaseWhenBench64Contiguous)->Args({kNumItems, 99});
+BENCHMARK(CaseWhenBench64ManyBranches)->Args({kNumItems, 0});
+BENCHMARK(CaseWhenBench64ManyBranches)->Args({kNumItems, 99});
 
 // CaseWhen: List-like types
 BENCHMARK(CaseWhenBenchListInt64)->Args({kFewItems, 0});
@@ -562,6 +606,8 @@ BENCHMARK(CaseWhenBenchString)->Args({kFewItems, 0});
 BENCHMARK(CaseWhenBenchString)->Args({kFewItems, 99});
 BENCHMARK(CaseWhenBenchStringContiguous)->Args({kFewItems, 0});
 BENCHMARK(CaseWhenBenchStringContiguous)->Args({kFewItems, 99});
+BENCHMARK(CaseWhenBenchStringManyBranches)->Args({kFewItems, 0});
+BENCHMARK(CaseWhenBenchStringManyBranches)->Args({kFewItems, 99});
 
 void CoalesceSetArgs(benchmark::internal::Benchmark* bench) {
   for (size_t i = 0; i < g_coalesce_params.size(); i++) {
@@ -31,11 +31,66 @@
 namespace arrow {
 
 using internal::checked_cast;
+using internal::hash_t;
 using internal::HashTraits;
+using internal::ScalarHelper;
 
 namespace compute::internal {
 namespace {
 
+// Value sets with at least this many distinct values get a Bloom filter in front of
+// their hash table.  Past this size, the hash table outgrows the CPU caches and
+// probing it is dominated by cache misses, which a much smaller filter avoids for
+// most values that are absent from the set.
+constexpr int32_t kBloomFilterMinValueSetSize = 1 << 16;
+
+// Integer value sets spanning a range of at most this many times their number of
+// distinct values (or kDenseTableMinSize) are stored in a direct-address table.
+constexpr uint64_t kDenseTableMaxSizeFactor = 4;
+constexpr uint64_t kDenseTableMinSize = 1024;
+
+// A blocked Bloom filter where each value sets kNumBitsPerValue bits in a single
+// 64-bit word, so that probing it costs a single memory access.  With 16 bits per
+// value, its false positive rate is about 1%.
+class SetLookupBloomFilter {
+ public:
+  explicit SetLookupBloomFilter(int64_t num_values) {
+    const int64_t num_blocks =
+        bit_util::NextPower2(std::max<int64_t>(1, num_values * kBitsPerValue / 64));
+    log_num_blocks_ = bit_util::Log2(static_cast<uint64_t>(num_blocks));
+    blocks_.resize(num_blocks, 0);
+  }
+
+  void Insert(hash_t hash) { blocks_[BlockIndex(hash)] |= Mask(hash); }
+
+  bool MayContain(hash_t hash) const {
+    const uint64_t mask = Mask(hash);
+    return (blocks_[BlockIndex(hash)] & mask) == mask;
+  }
+
+ private:
+  static constexpr int64_t kBitsPerValue = 16;
+  static constexpr int kNumBitsPerValue = 5;
+
+  uint64_t BlockIndex(hash_t hash) const {
+    // Remix the hash so that the block index is independent from the bit positions
+    return log_num_blocks_ == 0
+               ? 0
+               : (hash * 0x9E3779B97F4A7C15ULL) >> (64 - log_num_blocks_);
+  }
+
+  static uint64_t Mask(hash_t hash) {
+    uint64_t mask = 0;
+    for (int i = 0; i < kNumBitsPerValue; ++i) {
+      mask |= uint64_t{1} << ((hash >> (6 * i)) & 63);
+    }
+    return mask;
+  }
+
+  int log_num_blocks_;
+  std::vector<uint64_t> blocks_;
+};
+
 // This base class enables non-templated access to the value set type
 struct SetLookupStateBase : public KernelState {
   std::shared_ptr<DataType> value_set_type;
@@ -43,10 +98,26 @@ struct SetLookupStateBase : public KernelState {
 
 template <typename Type>
 struct SetLookupState : public SetLookupStateBase {
+  using T = typename GetViewType<Type>::T;
+
+  // Integers wider than 16 bits can be stored in a direct-address table when dense
+  // enough (narrower ones already use a direct-address memo table)
+  static constexpr bool kCanUseDenseTable =
+      is_integer_type<Type>::value && sizeof(T) >= 4;
+  static constexpr bool kCanUseBloomFilter =
+      !is_boolean_type<Type>::value &&
+      !(is_integer_type<Type>::value && sizeof(T) < 4);
+
   explicit SetLookupState(MemoryPool* pool) : memory_pool(pool) {}
 
   Status Init(const SetLookupOptions& options) {
     this->null_matching_behavior = options.GetNullMatchingBehavior();
+    if constexpr (kCanUseDenseTable) {
+      // Signed values are mapped to keys that preserve their ordering
+      if (!is_unsigned_integer(options.value_set.type()->id())) {
+        dense_key_flip = uint64_t{1} << (sizeof(T) * 8 - 1);
+      }
+    }
     if (options.value_set.is_array()) {
       const ArrayData& value_set = *options.value_set.array();
       memo_index_to_value_index.reserve(value_set.length);
@@ -74,14 +145,87 @@ struct SetLookupState : public SetLookupStateBase {
       null_index = memo_index_to_value_index[lookup_table->GetNull()];
     }
     value_set_type = options.value_set.type();
+
+    const int32_t num_values =
+        lookup_table->size() - (lookup_table->GetNull() >= 0 ? 1 : 0);
+    if constexpr (kCanUseDenseTable) {
+      if (num_values > 0) {
+        const uint64_t range = dense_key_max - dense_key_min;
+        const uint64_t max_size =
+            std::max(kDenseTableMinSize,
+                     kDenseTableMaxSizeFactor * static_cast<uint64_t>(num_values));
+        if (range < max_size) {
+          dense_index.assign(range + 1, -1);
+          VisitValueSet(options, [&](T v, int32_t index) {
+            int32_t& slot = dense_index[DenseKey(v) - dense_key_min];
+            if (slot == -1) {
+              slot = index;
+            }
+          });
+          return Status::OK();
+        }
+      }
+    }
+    if constexpr (kCanUseBloomFilter) {
+      if (num_values >= kBloomFilterMinValueSetSize) {
+        bloom_filter.emplace(num_values);
+        VisitValueSet(options,
+                      [&](T v, int32_t) { bloom_filter->Insert(BloomFilterHash(v)); });
+      }
+    }
     return Status::OK();
   }
 
+  // Return the index of the first occurrence of `v` in the value set, or -1
+  int32_t Lookup(T v) const {
+    if constexpr (kCanUseDenseTable) {
+      if (!dense_index.empty()) {
+        const uint64_t slot = DenseKey(v) - dense_key_min;
+        return slot < dense_index.size() ? dense_index[slot] : -1;
+      }
+    }
+    if constexpr (kCanUseBloomFilter) {
+      if (bloom_filter.has_value() && !bloom_filter->MayContain(BloomFilterHash(v))) {
+        return -1;
+      }
+    }
+    const int32_t memo_index = lookup_table->Get(v);
+    return memo_index == -1 ? -1 : memo_index_to_value_index[memo_index];
+  }
+
+  uint64_t DenseKey(T v) const { return static_cast<uint64_t>(v) ^ dense_key_flip; }
+
+  static hash_t BloomFilterHash(T v) {
+    // Use a different hash than the memo table's
+    return ScalarHelper<T, 1>::ComputeHash(v);
+  }
+
+  // Call `visit` on each valid value of the value set along with its index, in order
+  template <typename Visit>
+  static void VisitValueSet(const SetLookupOptions& options, Visit&& visit) {
+    int32_t index = 0;
+    auto visit_array = [&](const ArraySpan& data) {
+      VisitArrayValuesInline<Type>(
+          data, [&](T v) { visit(v, index++); }, [&] { ++index; });
+    };
+    if (options.value_set.is_array()) {
+      visit_array(ArraySpan(*options.value_set.array()));
+    } else {
+      for (const auto& chunk : options.value_set.chunked_array()->chunks()) {
+        visit_array(ArraySpan(*chunk->data()));
+      }
+    }
+  }
+
   Status AddArrayValueSet(const SetLookupOptions& options, const ArrayData& data,
                           int64_t start_index = 0) {
-    using T = typename GetViewType<Type>::T;
     int32_t index = static_cast<int32_t>(start_index);
     auto visit_valid = [&](T v) {
+      if constexpr (kCanUseDenseTable) {
+        const uint64_t key = DenseKey(v);
+        dense_key_min = std::min(dense_key_min, key);
+        dense_key_max = std::max(dense_key_max, key);
+      }
       const auto memo_size = static_cast<int32_t>(memo_index_to_value_index.size());
       int32_t unused_memo_index;
       // (capture `memo_size` by value because of ARROW-17567)
@@ -122,6 +266,13 @@ struct SetLookupState : public SetLookupStateBase {
   std::vector<int32_t> memo_index_to_value_index;
   int32_t null_index = -1;
   SetLookupOptions::NullMatchingBehavior null_matching_behavior;
+  // Value set index of each key between dense_key_min and dense_key_max, or -1,
+  // if the value set is dense enough.  Otherwise empty.
+  std::vector<int32_t> dense_index;
+  uint64_t dense_key_flip = 0;
+  uint64_t dense_key_min = std::numeric_limits<uint64_t>::max();
+  uint64_t dense_key_max = 0;
+  std::optional<SetLookupBloomFilter> bloom_filter;
 };
 
 template <>
@@ -305,12 +456,12 @@ struct IndexInVisitor {
     VisitArraySpanInline<Type>(
         input,
         [&](T v) {
-          int32_t index = state.lookup_table->Get(v);
+          int32_t index = state.Lookup(v);
           if (index != -1) {
             bitmap_writer.Set();
 
             // matching needle; output index from value_set
-            *out_data++ = state.memo_index_to_value_index[index];
+            *out_data++ = index;
           } else {
             // no matching needle; output null
             bitmap_writer.Clear();
@@ -441,7 +592,7 @@ struct IsInVisitor {
     VisitArraySpanInline<Type>(
         input,
         [&](T v) {
-          if (state.lookup_table->Get(v) != -1) {  // true
+          if (state.Lookup(v) != -1) {  // true
             writer_boolean.Set();
             writer_null.Set();
           } else if (state.null_matching_behavior == SetLookupOptions::INCONCLUSIVE &&
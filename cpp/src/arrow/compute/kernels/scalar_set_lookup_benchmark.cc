@@ -54,12 +54,11 @@ static void SetLookupBenchmarkString(benchmark::State& state,
 }
 
 template <typename Type>
-static void SetLookupBenchmarkNumeric(benchmark::State& state,
-                                      const std::string& func_name,
-                                      const int64_t value_set_length,
-                                      const int64_t array_length) {
+static void SetLookupBenchmarkNumeric(
+    benchmark::State& state, const std::string& func_name,
+    const int64_t value_set_length, const int64_t array_length,
+    const int64_t value_max = std::numeric_limits<typename Type::c_type>::max()) {
   const int64_t value_min = 0;
-  const int64_t value_max = std::numeric_limits<typename Type::c_type>::max();
   const double null_probability = 0.1 / value_set_length;
   random::RandomArrayGenerator rng(kSeed);
 
@@ -144,6 +143,22 @@ static void IsInInt32LargeSet(benchmark::State& state) {
                                        kArrayLengthWithLargeSet);
 }
 
+// Value sets large enough to be probed through a Bloom filter
+static void IsInInt64HugeSet(benchmark::State& state) {
+  SetLookupBenchmarkNumeric<Int64Type>(state, "is_in_meta_binary", state.range(0),
+                                       kArrayLengthWithSmallSet);
+}
+
+static void IsInStringHugeSet(benchmark::State& state) {
+  SetLookupBenchmarkString(state, "is_in_meta_binary", state.range(0));
+}
+
+// Value sets dense enough to be stored in a direct-address table
+static void IndexInInt64DenseSet(benchmark::State& state) {
+  SetLookupBenchmarkNumeric<Int64Type>(state, "index_in_meta_binary", state.range(0),
+                                       kArrayLengthWithSmallSet, 2 * state.range(0));
+}
+
 BENCHMARK(IndexInStringSmallSet)->RangeMultiplier(4)->Range(2, 64);
 BENCHMARK(IsInStringSmallSet)->RangeMultiplier(4)->Range(2, 64);
 
@@ -162,6 +177,9 @@ BENCHMARK(IsInInt16SmallSet)->RangeMultiplier(4)->Range(2, 64);
 BENCHMARK(IsInInt32SmallSet)->RangeMultiplier(4)->Range(2, 64);
 BENCHMARK(IsInInt64SmallSet)->RangeMultiplier(4)->Range(2, 64);
 BENCHMARK(IsInInt32LargeSet)->RangeMultiplier(100)->Range(1000, 1000000);
+BENCHMARK(IsInInt64HugeSet)->RangeMultiplier(16)->Range(1 << 16, 1 << 24);
+BENCHMARK(IsInStringHugeSet)->RangeMultiplier(16)->Range(1 << 16, 1 << 20);
+BENCHMARK(IndexInInt64DenseSet)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
 
 }  // namespace compute
 }  // namespace arrow
@@ -1559,6 +1559,81 @@ TEST_F(TestIndexInKernel, BinaryResizeTable) {
   ASSERT_ARRAYS_EQUAL(*expected, *actual);
 }
 
+TEST_F(TestIndexInKernel, DenseIntegerValueSet) {
+  // Small ranges of wide integers are looked up in a direct-address table
+  for (const auto& type : {int32(), int64()}) {
+    const std::string input = "[-6, -5, 0, 3, 4, 7, 8, null]";
+    const std::string value_set = "[-5, 3, null, -5, 7, 3, 0]";
+    this->CheckIndexIn(type, input, value_set, "[null, 0, 6, 1, null, 4, null, 2]");
+    this->CheckIndexIn(type, input, value_set, "[null, 0, 6, 1, null, 4, null, null]",
+                       SetLookupOptions::SKIP);
+  }
+  this->CheckIndexIn(int32(), "[-2147483648, 2147483647, -2147483647, 0]",
+                     "[2147483647, -2147483648]", "[1, 0, null, null]");
+  this->CheckIndexIn(int64(),
+                     "[-9223372036854775808, 9223372036854775807, -1, 0]",
+                     "[-1, 9223372036854775807]", "[null, 1, 0, null]");
+  this->CheckIndexIn(uint32(), "[4294967295, 4294967294, 0, 1]",
+                     "[4294967294, 4294967295, 4294967295]", "[1, 0, null, null]");
+  this->CheckIndexIn(uint64(), "[18446744073709551615, 18446744073709551614, 0]",
+                     "[18446744073709551615, 18446744073709551613]", "[0, null, null]");
+  this->CheckIndexIn(date32(), "[1, 2, 3, null]", "[3, null, 1]", "[2, null, 0, 1]");
+}
+
+TEST_F(TestIndexInKernel, LargeValueSet) {
+  // Large value sets are probed through a Bloom filter
+  const int32_t kNumDistinct = 100000;
+  const int64_t kStep = 7919;
+
+  // Sparse values, each repeated twice, with nulls in the first repetition
+  Int64Builder value_set_builder;
+  StringBuilder string_value_set_builder;
+  for (int32_t i = 0; i < 2 * kNumDistinct; ++i) {
+    if (i < kNumDistinct && i % 1000 == 999) {
+      ASSERT_OK(value_set_builder.AppendNull());
+      ASSERT_OK(string_value_set_builder.AppendNull());
+    } else {
+      const int64_t value = (i % kNumDistinct) * kStep;
+      ASSERT_OK(value_set_builder.Append(value));
+      ASSERT_OK(string_value_set_builder.Append(std::to_string(value)));
+    }
+  }
+  Int64Builder input_builder;
+  StringBuilder string_input_builder;
+  Int32Builder expected_builder;
+  for (int32_t i = 0; i < 4 * kNumDistinct; ++i) {
+    const int64_t value = i * kStep / 2;
+    ASSERT_OK(input_builder.Append(value));
+    ASSERT_OK(string_input_builder.Append(std::to_string(value)));
+    const int64_t index = value / kStep;
+    if (value % kStep != 0 || index >= kNumDistinct) {
+      ASSERT_OK(expected_builder.AppendNull());
+    } else if (index % 1000 == 999) {
+      ASSERT_OK(expected_builder.Append(static_cast<int32_t>(index + kNumDistinct)));
+    } else {
+      ASSERT_OK(expected_builder.Append(static_cast<int32_t>(index)));
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto value_set, value_set_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto string_value_set, string_value_set_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto input, input_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto string_input, string_input_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto expected, expected_builder.Finish());
+
+  for (const auto& pair : {std::make_pair(input, value_set),
+                           std::make_pair(string_input, string_value_set)}) {
+    ASSERT_OK_AND_ASSIGN(Datum actual, IndexIn(pair.first, pair.second));
+    ValidateOutput(actual);
+    AssertArraysEqual(*expected, *actual.make_array(), /*verbose=*/true);
+
+    ASSERT_OK_AND_ASSIGN(actual, IsIn(pair.first, pair.second));
+    ValidateOutput(actual);
+    ASSERT_OK_AND_ASSIGN(Datum expected_is_in, IsValid(expected));
+    AssertArraysEqual(*expected_is_in.make_array(), *actual.make_array(),
+                      /*verbose=*/true);
+  }
+}
+
 TEST_F(TestIndexInKernel, FixedSizeBinary) {
   CheckIndexIn(fixed_size_binary(3),
                /*input=*/R"(["bbb", null, "ddd", "aaa", "ccc", "aaa"])",
@@ -16,9 +16,13 @@
 // under the License.
 
 #include <algorithm>
+#include <array>
 #include <cctype>
+#include <deque>
 #include <iterator>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 
 #include "arrow/array/builder_nested.h"
@@ -26,10 +30,12 @@
 #include "arrow/compute/kernels/scalar_string_internal.h"
 #include "arrow/compute/registry_internal.h"
 #include "arrow/result.h"
+#include "arrow/util/cache_internal.h"
 #include "arrow/util/config.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/string.h"
+#include "arrow/util/utf8_internal.h"
 #include "arrow/util/value_parsing.h"
 
 #ifdef ARROW_WITH_RE2
@@ -77,6 +83,50 @@ template <typename T>
 RE2::Options MakeRE2Options(bool ignore_case = false, bool literal = false) {
   return MakeRE2Options(T::is_utf8, ignore_case, literal);
 }
+
+constexpr int32_t kRE2CacheCapacity = 128;
+
+std::string RE2CacheKey(const std::string& pattern, const RE2::Options& options) {
+  const bool flags[] = {options.posix_syntax(), options.longest_match(),
+                        options.log_errors(),   options.literal(),
+                        options.never_nl(),     options.dot_nl(),
+                        options.never_capture(), options.case_sensitive(),
+                        options.perl_classes(), options.word_boundary(),
+                        options.one_line()};
+  std::string key = std::to_string(options.encoding()) + ":" +
+                    std::to_string(options.max_mem()) + ":";
+  for (const bool flag : flags) {
+    key.push_back(flag ? '1' : '0');
+  }
+  key.push_back(':');
+  key += pattern;
+  return key;
+}
+
+// Get a compiled regex from a process-wide cache.  Compiling a regex is often more
+// expensive than running it on a batch, and kernels are typically initialized with
+// the same options over and over (for example when evaluating an expression on each
+// batch).  RE2 objects are thread-safe once constructed, so they can be shared.
+// Invalid patterns are cached as well, callers must check RegexStatus().
+std::shared_ptr<const RE2> GetCachedRE2(const std::string& pattern,
+                                        const RE2::Options& options) {
+  static std::mutex mutex;
+  static ::arrow::internal::LruCache<std::string, std::shared_ptr<const RE2>> cache(
+      kRE2CacheCapacity);
+
+  std::string key = RE2CacheKey(pattern, options);
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (auto cached = cache.Find(key)) {
+      return *cached;
+    }
+  }
+  // Compile without holding the lock, compiling the same pattern concurrently
+  // is harmless
+  auto regex = std::make_shared<const RE2>(pattern, options);
+  std::lock_guard<std::mutex> lock(mutex);
+  return *cache.Replace(std::move(key), std::move(regex)).second;
+}
 #endif
 
 // ----------------------------------------------------------------------
@@ -502,8 +552,6 @@ Status StringDataTransform(KernelContext* ctx, const ExecSpan& batch,
 
 // IsAlpha/Digit etc
 
-static inline bool IsAsciiCharacter(uint8_t character) { return character < 128; }
-
 static inline bool IsLowerCaseCharacterAscii(uint8_t ascii_character) {
   return (ascii_character >= 'a') && (ascii_character <= 'z');
 }
@@ -543,7 +591,8 @@ static inline bool IsPrintableCharacterAscii(uint8_t ascii_character) {
 struct IsAscii {
   static bool Call(KernelContext*, const uint8_t* input,
                    size_t input_string_nascii_characters, Status*) {
-    return std::all_of(input, input + input_string_nascii_characters, IsAsciiCharacter);
+    return util::ValidateAscii(input,
+                               static_cast<int64_t>(input_string_nascii_characters));
   }
 };
 
@@ -726,7 +775,7 @@ static inline uint8_t ascii_swapcase(uint8_t utf8_code_unit) {
 }
 
 void TransformAsciiUpper(const uint8_t* input, int64_t length, uint8_t* output) {
-  std::transform(input, input + length, output, ascii_toupper);
+  util::AsciiToUpper(input, length, output);
 }
 
 template <typename Type>
@@ -737,7 +786,7 @@ struct AsciiUpper {
 };
 
 void TransformAsciiLower(const uint8_t* input, int64_t length, uint8_t* output) {
-  std::transform(input, input + length, output, ascii_tolower);
+  util::AsciiToLower(input, length, output);
 }
 
 template <typename Type>
@@ -748,7 +797,7 @@ struct AsciiLower {
 };
 
 void TransformAsciiSwapCase(const uint8_t* input, int64_t length, uint8_t* output) {
-  std::transform(input, input + length, output, ascii_swapcase);
+  util::AsciiSwapCase(input, length, output);
 }
 
 template <typename Type>
@@ -1313,24 +1362,34 @@ struct PlainEndsWithMatcher {
 #ifdef ARROW_WITH_RE2
 struct RegexSubstringMatcher {
   const MatchSubstringOptions& options_;
-  const RE2 regex_match_;
+  const std::shared_ptr<const RE2> regex_match_;
+  // A literal that any matching input must contain, checked before running the regex
+  const std::string required_literal_;
 
   static Result<std::unique_ptr<RegexSubstringMatcher>> Make(
-      const MatchSubstringOptions& options, bool is_utf8 = true, bool literal = false) {
-    auto matcher = std::make_unique<RegexSubstringMatcher>(options, is_utf8, literal);
-    RETURN_NOT_OK(RegexStatus(matcher->regex_match_));
+      const MatchSubstringOptions& options, bool is_utf8 = true, bool literal = false,
+      std::string required_literal = "") {
+    auto matcher = std::make_unique<RegexSubstringMatcher>(options, is_utf8, literal,
+                                                           std::move(required_literal));
+    RETURN_NOT_OK(RegexStatus(*matcher->regex_match_));
     return matcher;
   }
 
   explicit RegexSubstringMatcher(const MatchSubstringOptions& options,
-                                 bool is_utf8 = true, bool literal = false)
+                                 bool is_utf8 = true, bool literal = false,
+                                 std::string required_literal = "")
       : options_(options),
-        regex_match_(options_.pattern,
-                     MakeRE2Options(is_utf8, options.ignore_case, literal)) {}
+        regex_match_(GetCachedRE2(options_.pattern,
+                                  MakeRE2Options(is_utf8, options.ignore_case, literal))),
+        required_literal_(std::move(required_literal)) {}
 
   bool Match(std::string_view current) const {
+    if (!required_literal_.empty() &&
+        current.find(required_literal_) == std::string_view::npos) {
+      return false;
+    }
     auto piece = re2::StringPiece(current.data(), current.length());
-    return RE2::PartialMatch(piece, regex_match_);
+    return RE2::PartialMatch(piece, *regex_match_);
   }
 };
 #endif
@@ -1500,71 +1559,261 @@ std::string MakeLikeRegex(const MatchSubstringOptions& options) {
   return like_pattern;
 }
 
+/// Split a SQL-style LIKE pattern into literal segments delimited by wildcards.
+/// `has_any_char` is set if the pattern contains a '_' wildcard.
+std::vector<std::string> SplitLikePattern(const std::string& pattern,
+                                          bool* has_any_char) {
+  std::vector<std::string> segments(1);
+  *has_any_char = false;
+  bool escaped = false;
+  for (const char c : pattern) {
+    if (!escaped && (c == '%' || c == '_')) {
+      *has_any_char |= c == '_';
+      segments.emplace_back();
+    } else if (!escaped && c == '\\') {
+      escaped = true;
+    } else {
+      segments.back().push_back(c);
+      escaped = false;
+    }
+  }
+  return segments;
+}
+
+// A LIKE pattern with only '%' wildcards is matched by looking for its literal
+// segments in turn, the first and last segments being anchored at the start and
+// end of the input.  Leftmost matching of the intermediate segments is optimal.
+struct LikeSegmentsMatcher {
+  std::vector<std::string> segments_;
+
+  explicit LikeSegmentsMatcher(std::vector<std::string> segments)
+      : segments_(std::move(segments)) {
+    DCHECK(!segments_.empty());
+  }
+
+  bool Match(std::string_view current) const {
+    if (segments_.size() == 1) {
+      return current == segments_[0];
+    }
+    const auto& first = segments_.front();
+    const auto& last = segments_.back();
+    if (current.size() < first.size() + last.size() || !current.starts_with(first) ||
+        !current.ends_with(last)) {
+      return false;
+    }
+    current = current.substr(first.size(), current.size() - first.size() - last.size());
+    for (size_t i = 1; i + 1 < segments_.size(); ++i) {
+      const auto& segment = segments_[i];
+      const auto pos = current.find(segment);
+      if (pos == std::string_view::npos) {
+        return false;
+      }
+      current.remove_prefix(pos + segment.size());
+    }
+    return true;
+  }
+};
+
 // Evaluate a SQL-like LIKE pattern by translating it to a regexp or
 // substring search as appropriate. See what Apache Impala does:
 // https://github.com/apache/impala/blob/9c38568657d62b6f6d7b10aa1c721ba843374dd8/be/src/exprs/like-predicate.cc
 template <typename StringType>
 struct MatchLike {
   static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
-    // NOTE: avoid making those constants global to avoid compiling regexes at startup
-    static const RE2::Options kRE2Options = MakeRE2Options<StringType>();
-    // A LIKE pattern matching this regex can be translated into a substring search.
-    static const RE2 kLikePatternIsSubstringMatch(R"(%+([^%_]*[^\\%_])?%+)", kRE2Options);
-    // A LIKE pattern matching this regex can be translated into a prefix search.
-    static const RE2 kLikePatternIsStartsWith(R"(([^%_]*[^\\%_])?%+)", kRE2Options);
-    // A LIKE pattern matching this regex can be translated into a suffix search.
-    static const RE2 kLikePatternIsEndsWith(R"(%+([^%_]*))", kRE2Options);
-    static bool global_checked = false;
-    if (ARROW_PREDICT_FALSE(!global_checked)) {
-      RETURN_NOT_OK(RegexStatus(kLikePatternIsSubstringMatch));
-      RETURN_NOT_OK(RegexStatus(kLikePatternIsStartsWith));
-      RETURN_NOT_OK(RegexStatus(kLikePatternIsEndsWith));
-      global_checked = true;
-    }
-
-    auto original_options = MatchSubstringState::Get(ctx);
-    auto original_state = ctx->state();
-
-    Status status;
-    std::string pattern;
-    bool matched = false;
-    if (!original_options.ignore_case) {
-      if ((matched = RE2::FullMatch(original_options.pattern,
-                                    kLikePatternIsSubstringMatch, &pattern))) {
-        MatchSubstringOptions converted_options{pattern, original_options.ignore_case};
-        MatchSubstringState converted_state(converted_options);
-        ctx->SetState(&converted_state);
-        status = MatchSubstring<StringType, PlainSubstringMatcher>::Exec(ctx, batch, out);
-      } else if ((matched = RE2::FullMatch(original_options.pattern,
-                                           kLikePatternIsStartsWith, &pattern))) {
-        MatchSubstringOptions converted_options{pattern, original_options.ignore_case};
-        MatchSubstringState converted_state(converted_options);
-        ctx->SetState(&converted_state);
-        status =
-            MatchSubstring<StringType, PlainStartsWithMatcher>::Exec(ctx, batch, out);
-      } else if ((matched = RE2::FullMatch(original_options.pattern,
-                                           kLikePatternIsEndsWith, &pattern))) {
-        MatchSubstringOptions converted_options{pattern, original_options.ignore_case};
-        MatchSubstringState converted_state(converted_options);
-        ctx->SetState(&converted_state);
-        status = MatchSubstring<StringType, PlainEndsWithMatcher>::Exec(ctx, batch, out);
+    const auto& options = MatchSubstringState::Get(ctx);
+
+    bool has_any_char;
+    auto segments = SplitLikePattern(options.pattern, &has_any_char);
+    std::string required_literal;
+    if (!options.ignore_case) {
+      if (!has_any_char) {
+        // Only '%' wildcards: translate into literal searches
+        if (segments.size() >= 2) {
+          const auto& first = segments.front();
+          const auto& last = segments.back();
+          std::vector<std::string> inner;
+          std::copy_if(segments.begin() + 1, segments.end() - 1,
+                       std::back_inserter(inner),
+                       [](const std::string& segment) { return !segment.empty(); });
+          if (first.empty() && last.empty() && inner.size() == 1) {
+            MatchSubstringOptions converted_options{inner[0]};
+            return MatchWith<PlainSubstringMatcher>(ctx, batch, out, converted_options);
+          } else if (inner.empty() && last.empty()) {
+            MatchSubstringOptions converted_options{first};
+            return MatchWith<PlainStartsWithMatcher>(ctx, batch, out, converted_options);
+          } else if (inner.empty() && first.empty()) {
+            MatchSubstringOptions converted_options{last};
+            return MatchWith<PlainEndsWithMatcher>(ctx, batch, out, converted_options);
+          }
+        }
+        // General case, e.g. '%foo%bar%'
+        LikeSegmentsMatcher matcher(std::move(segments));
+        return MatchSubstringImpl<StringType, LikeSegmentsMatcher>::Exec(ctx, batch, out,
+                                                                         &matcher);
+      }
+      // The longest literal segment must appear in any match, look for it
+      // before running the regex
+      for (auto& segment : segments) {
+        if (segment.size() > required_literal.size()) {
+          required_literal = std::move(segment);
+        }
       }
     }
 
-    if (!matched) {
-      MatchSubstringOptions converted_options{MakeLikeRegex(original_options),
-                                              original_options.ignore_case};
-      MatchSubstringState converted_state(converted_options);
-      ctx->SetState(&converted_state);
-      status = MatchSubstring<StringType, RegexSubstringMatcher>::Exec(ctx, batch, out);
-    }
-    ctx->SetState(original_state);
-    return status;
+    MatchSubstringOptions converted_options{MakeLikeRegex(options), options.ignore_case};
+    ARROW_ASSIGN_OR_RAISE(
+        auto matcher,
+        RegexSubstringMatcher::Make(converted_options, StringType::is_utf8,
+                                    /*literal=*/false, std::move(required_literal)));
+    return MatchSubstringImpl<StringType, RegexSubstringMatcher>::Exec(ctx, batch, out,
+                                                                       matcher.get());
+  }
+
+  template <typename Matcher>
+  static Status MatchWith(KernelContext* ctx, const ExecSpan& batch, ExecResult* out,
+                          const MatchSubstringOptions& options) {
+    ARROW_ASSIGN_OR_RAISE(auto matcher, Matcher::Make(options));
+    return MatchSubstringImpl<StringType, Matcher>::Exec(ctx, batch, out,
+                                                         matcher.get());
   }
 };
 
 #endif
 
+// Aho-Corasick automaton looking for any of a set of literal patterns in a single
+// pass over the input.  The automaton is compiled to a DFA so that each input byte
+// costs a single table lookup.  To keep the transition table compact with many
+// patterns, bytes are first mapped to equivalence classes: one class per distinct
+// byte appearing in the patterns, and a class for all other bytes.
+class MultiSubstringMatcher {
+ public:
+  static Result<std::unique_ptr<MultiSubstringMatcher>> Make(
+      const MatchAnySubstringOptions& options) {
+    auto matcher = std::make_unique<MultiSubstringMatcher>();
+    matcher->Compile(options);
+    return matcher;
+  }
+
+  bool Match(std::string_view current) const {
+    int32_t state = 0;
+    if (accepting_[state]) return true;
+    for (const auto c : current) {
+      state = transitions_[state * num_classes_ + byte_classes_[static_cast<uint8_t>(c)]];
+      if (accepting_[state]) return true;
+    }
+    return false;
+  }
+
+ private:
+  static constexpr int32_t kNoState = -1;
+
+  void Compile(const MatchAnySubstringOptions& options) {
+    auto fold = [&](uint8_t c) -> uint8_t {
+      return options.ignore_case && IsUpperCaseCharacterAscii(c) ? c + 32 : c;
+    };
+
+    // Assign byte classes, class 0 being any byte absent from the patterns
+    byte_classes_.fill(0);
+    num_classes_ = 1;
+    for (const auto& pattern : options.patterns) {
+      for (const auto c : pattern) {
+        const uint8_t byte = fold(static_cast<uint8_t>(c));
+        if (byte_classes_[byte] == 0) {
+          byte_classes_[byte] = static_cast<uint16_t>(num_classes_++);
+        }
+      }
+    }
+    if (options.ignore_case) {
+      for (uint8_t c = 'A'; c <= 'Z'; ++c) {
+        byte_classes_[c] = byte_classes_[fold(c)];
+      }
+    }
+
+    // Build the trie of patterns
+    AddState();
+    for (const auto& pattern : options.patterns) {
+      int32_t state = 0;
+      for (const auto c : pattern) {
+        const int64_t index =
+            state * num_classes_ + byte_classes_[fold(static_cast<uint8_t>(c))];
+        if (transitions_[index] == kNoState) {
+          const int32_t next = AddState();
+          transitions_[index] = next;
+        }
+        state = transitions_[index];
+      }
+      accepting_[state] = true;
+    }
+
+    // Turn the trie into a DFA breadth-first, following failure links for
+    // missing transitions.  A state accepts as soon as any of its suffixes does.
+    std::vector<int32_t> failure(accepting_.size(), 0);
+    std::deque<int32_t> queue;
+    for (int64_t cls = 0; cls < num_classes_; ++cls) {
+      int32_t& next = transitions_[cls];
+      if (next == kNoState) {
+        next = 0;
+      } else {
+        queue.push_back(next);
+      }
+    }
+    while (!queue.empty()) {
+      const int32_t state = queue.front();
+      queue.pop_front();
+      accepting_[state] = accepting_[state] || accepting_[failure[state]];
+      for (int64_t cls = 0; cls < num_classes_; ++cls) {
+        const int32_t fallback = transitions_[failure[state] * num_classes_ + cls];
+        int32_t& next = transitions_[state * num_classes_ + cls];
+        if (next == kNoState) {
+          next = fallback;
+        } else {
+          failure[next] = fallback;
+          queue.push_back(next);
+        }
+      }
+    }
+  }
+
+  int32_t AddState() {
+    transitions_.resize(transitions_.size() + num_classes_, kNoState);
+    accepting_.push_back(false);
+    return static_cast<int32_t>(accepting_.size() - 1);
+  }
+
+  std::array<uint16_t, 256> byte_classes_;
+  int64_t num_classes_ = 0;
+  // Next state for each (state, byte class) pair
+  std::vector<int32_t> transitions_;
+  std::vector<uint8_t> accepting_;
+};
+
+// The automaton is compiled once when the kernel is initialized
+struct MatchAnySubstringState : public KernelState {
+  explicit MatchAnySubstringState(std::unique_ptr<MultiSubstringMatcher> matcher)
+      : matcher(std::move(matcher)) {}
+
+  static Result<std::unique_ptr<KernelState>> Init(KernelContext* ctx,
+                                                   const KernelInitArgs& args) {
+    if (auto options = static_cast<const MatchAnySubstringOptions*>(args.options)) {
+      ARROW_ASSIGN_OR_RAISE(auto matcher, MultiSubstringMatcher::Make(*options));
+      return std::make_unique<MatchAnySubstringState>(std::move(matcher));
+    }
+    return Status::Invalid(
+        "Attempted to initialize KernelState from null FunctionOptions");
+  }
+
+  std::unique_ptr<MultiSubstringMatcher> matcher;
+};
+
+template <typename Type>
+struct MatchAnySubstring {
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    const auto& state = checked_cast<const MatchAnySubstringState&>(*ctx->state());
+    return MatchSubstringImpl<Type, MultiSubstringMatcher>::Exec(ctx, batch, out,
+                                                                 state.matcher.get());
+  }
+};
+
 const FunctionDoc match_substring_doc(
     "Match strings against literal pattern",
     ("For each string in `strings`, emit true iff it contains a given pattern.\n"
@@ -1611,6 +1860,15 @@ const FunctionDoc match_like_doc(
     {"strings"}, "MatchSubstringOptions", /*options_required=*/true);
 #endif
 
+const FunctionDoc match_any_substring_doc(
+    "Match strings against a set of literal patterns",
+    ("For each string in `strings`, emit true iff it contains any of the given\n"
+     "patterns. The patterns are searched in a single pass over each string.\n"
+     "Null inputs emit null.\n"
+     "The patterns must be given in MatchAnySubstringOptions.\n"
+     "If ignore_case is set, only ASCII letters are case folded."),
+    {"strings"}, "MatchAnySubstringOptions", /*options_required=*/true);
+
 void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
   {
     auto func = std::make_shared<ScalarFunction>("match_substring", Arity::Unary(),
@@ -1622,6 +1880,16 @@ void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
     }
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
+  {
+    auto func = std::make_shared<ScalarFunction>("match_any_substring", Arity::Unary(),
+                                                 match_any_substring_doc);
+    for (const auto& ty : BaseBinaryTypes()) {
+      auto exec = GenerateVarBinaryToVarBinary<MatchAnySubstring>(ty);
+      DCHECK_OK(func->AddKernel({ty}, boolean(), std::move(exec),
+                                MatchAnySubstringState::Init));
+    }
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
   {
     auto func =
         std::make_shared<ScalarFunction>("starts_with", Arity::Unary(), starts_with_doc);
@@ -1683,7 +1951,7 @@ struct FindSubstring {
 
 #ifdef ARROW_WITH_RE2
 struct FindSubstringRegex {
-  std::unique_ptr<RE2> regex_match_;
+  std::shared_ptr<const RE2> regex_match_;
 
   static Result<FindSubstringRegex> Make(const MatchSubstringOptions& options,
                                          bool is_utf8 = true, bool literal = false) {
@@ -1698,7 +1966,7 @@ struct FindSubstringRegex {
     regex.reserve(options.pattern.length() + 2);
     regex += literal ? RE2::QuoteMeta(options.pattern) : options.pattern;
     regex += ")";
-    regex_match_ = std::make_unique<RE2>(
+    regex_match_ = GetCachedRE2(
         regex, MakeRE2Options(is_utf8, options.ignore_case, /*literal=*/false));
   }
 
@@ -1825,12 +2093,12 @@ struct CountSubstring {
 
 #ifdef ARROW_WITH_RE2
 struct CountSubstringRegex {
-  std::unique_ptr<RE2> regex_match_;
+  std::shared_ptr<const RE2> regex_match_;
 
   explicit CountSubstringRegex(const MatchSubstringOptions& options, bool is_utf8 = true,
                                bool literal = false)
-      : regex_match_(new RE2(options.pattern,
-                             MakeRE2Options(is_utf8, options.ignore_case, literal))) {}
+      : regex_match_(GetCachedRE2(
+            options.pattern, MakeRE2Options(is_utf8, options.ignore_case, literal))) {}
 
   static Result<CountSubstringRegex> Make(const MatchSubstringOptions& options,
                                           bool is_utf8 = true, bool literal = false) {
@@ -2042,18 +2310,18 @@ struct PlainSubstringReplacer {
 template <typename Type>
 struct RegexSubstringReplacer {
   const ReplaceSubstringOptions& options_;
-  const RE2 regex_find_;
-  const RE2 regex_replacement_;
+  const std::shared_ptr<const RE2> regex_find_;
+  const std::shared_ptr<const RE2> regex_replacement_;
 
   static Result<std::unique_ptr<RegexSubstringReplacer>> Make(
       const ReplaceSubstringOptions& options) {
     auto replacer = std::make_unique<RegexSubstringReplacer>(options);
 
-    RETURN_NOT_OK(RegexStatus(replacer->regex_find_));
-    RETURN_NOT_OK(RegexStatus(replacer->regex_replacement_));
+    RETURN_NOT_OK(RegexStatus(*replacer->regex_find_));
+    RETURN_NOT_OK(RegexStatus(*replacer->regex_replacement_));
 
     std::string replacement_error;
-    if (!replacer->regex_replacement_.CheckRewriteString(replacer->options_.replacement,
+    if (!replacer->regex_replacement_->CheckRewriteString(replacer->options_.replacement,
                                                          &replacement_error)) {
       return Status::Invalid("Invalid replacement string: ",
                              std::move(replacement_error));
@@ -2066,8 +2334,8 @@ struct RegexSubstringReplacer {
   // we have 2 regexes, one with () around it, one without.
   explicit RegexSubstringReplacer(const ReplaceSubstringOptions& options)
       : options_(options),
-        regex_find_("(" + options_.pattern + ")", MakeRE2Options<Type>()),
-        regex_replacement_(options_.pattern, MakeRE2Options<Type>()) {}
+        regex_find_(GetCachedRE2("(" + options_.pattern + ")", MakeRE2Options<Type>())),
+        regex_replacement_(GetCachedRE2(options_.pattern, MakeRE2Options<Type>())) {}
 
   Status ReplaceString(std::string_view s, TypedBufferBuilder<uint8_t>* builder) const {
     re2::StringPiece piece(s.data(), s.length());
@@ -2081,7 +2349,7 @@ struct RegexSubstringReplacer {
     // If s is empty, then it's essentially global
     if (options_.max_replacements == -1 || s.empty()) {
       std::string s_copy{s.data(), s.length()};
-      RE2::GlobalReplace(&s_copy, regex_replacement_, replacement);
+      RE2::GlobalReplace(&s_copy, *regex_replacement_, replacement);
       return builder->Append(reinterpret_cast<const uint8_t*>(s_copy.data()),
                              s_copy.length());
     }
@@ -2096,7 +2364,7 @@ struct RegexSubstringReplacer {
     int64_t max_replacements = options_.max_replacements;
     while ((i < end) && (max_replacements != 0)) {
       std::string found;
-      if (!RE2::FindAndConsume(&mutable_s, regex_find_, &found)) {
+      if (!RE2::FindAndConsume(&mutable_s, *regex_find_, &found)) {
         RETURN_NOT_OK(builder->Append(reinterpret_cast<const uint8_t*>(i),
                                       static_cast<int64_t>(end - i)));
         i = end;
@@ -2107,7 +2375,7 @@ struct RegexSubstringReplacer {
         RETURN_NOT_OK(builder->Append(reinterpret_cast<const uint8_t*>(i),
                                       static_cast<int64_t>(pos - i)));
         // replace the pattern in what we found
-        if (!RE2::Replace(&found, regex_replacement_, replacement)) {
+        if (!RE2::Replace(&found, *regex_replacement_, replacement)) {
           return Status::Invalid("Regex found, but replacement failed");
         }
         RETURN_NOT_OK(builder->Append(reinterpret_cast<const uint8_t*>(found.data()),
@@ -2204,15 +2472,14 @@ struct BaseExtractRegexData {
 
   int64_t num_groups() const { return static_cast<int64_t>(group_names.size()); }
 
-  std::unique_ptr<RE2> regex;
+  std::shared_ptr<const RE2> regex;
   std::vector<std::string> group_names;
 
  protected:
   explicit BaseExtractRegexData(const std::string& pattern, bool is_utf8)
-      : regex(new RE2(pattern, MakeRE2Options(is_utf8))) {}
+      : regex(GetCachedRE2(pattern, MakeRE2Options(is_utf8))) {}
 };
 
-// TODO cache this once per ExtractRegexOptions
 struct ExtractRegexData : public BaseExtractRegexData {
   static Result<ExtractRegexData> Make(const ExtractRegexOptions& options, bool is_utf8) {
     ExtractRegexData data(options.pattern, is_utf8);
@@ -2961,7 +3228,7 @@ template <typename Type>
 struct SplitRegexFinder : public StringSplitFinderBase<SplitPatternOptions> {
   using Options = SplitPatternOptions;
 
-  std::unique_ptr<RE2> regex_split;
+  std::shared_ptr<const RE2> regex_split;
 
   Status PreExec(const SplitPatternOptions& options) override {
     if (options.reverse) {
@@ -2973,7 +3240,7 @@ struct SplitRegexFinder : public StringSplitFinderBase<SplitPatternOptions> {
     pattern.reserve(options.pattern.size() + 2);
     pattern += options.pattern;
     pattern += ')';
-    regex_split = std::make_unique<RE2>(pattern, MakeRE2Options<Type>());
+    regex_split = GetCachedRE2(pattern, MakeRE2Options<Type>());
     return RegexStatus(*regex_split);
   }
 
@@ -60,6 +60,31 @@ static void UnaryStringBenchmark(benchmark::State& state, const std::string& fun
   state.SetBytesProcessed(state.iterations() * values->data()->buffers[2]->size());
 }
 
+// Same as UnaryStringBenchmark, but with a non-ASCII character in most strings
+static void UnaryMixedUtf8Benchmark(benchmark::State& state,
+                                    const std::string& func_name) {
+  const int64_t array_length = 1 << 20;
+  const int64_t value_min_size = 0;
+  const int64_t value_max_size = 32;
+  const double null_probability = 0.01;
+  random::RandomArrayGenerator rng(kSeed);
+
+  auto ascii_values =
+      rng.String(array_length, value_min_size, value_max_size, null_probability);
+  ReplaceSubstringOptions replace_options("a", "\xc3\xa6", /*max_replacements=*/1);
+  auto values = CallFunction("replace_substring", {ascii_values}, &replace_options)
+                    .ValueOrDie()
+                    .make_array();
+  // Make sure lookup tables are initialized before measuring
+  ABORT_NOT_OK(CallFunction(func_name, {values}));
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(CallFunction(func_name, {values}));
+  }
+  state.SetItemsProcessed(state.iterations() * array_length);
+  state.SetBytesProcessed(state.iterations() * values->data()->buffers[2]->size());
+}
+
 static void AsciiLower(benchmark::State& state) {
   UnaryStringBenchmark(state, "ascii_lower");
 }
@@ -68,6 +93,22 @@ static void AsciiUpper(benchmark::State& state) {
   UnaryStringBenchmark(state, "ascii_upper");
 }
 
+static void AsciiSwapCase(benchmark::State& state) {
+  UnaryStringBenchmark(state, "ascii_swapcase");
+}
+
+static void IsAscii(benchmark::State& state) {
+  UnaryStringBenchmark(state, "string_is_ascii");
+}
+
+static void Utf8Length(benchmark::State& state) {
+  UnaryStringBenchmark(state, "utf8_length");
+}
+
+static void Utf8LengthMixed(benchmark::State& state) {
+  UnaryMixedUtf8Benchmark(state, "utf8_length");
+}
+
 static void IsAlphaNumericAscii(benchmark::State& state) {
   UnaryStringBenchmark(state, "ascii_is_alnum");
 }
@@ -77,6 +118,15 @@ static void MatchSubstring(benchmark::State& state) {
   UnaryStringBenchmark(state, "match_substring", &options);
 }
 
+static void MatchAnySubstring(benchmark::State& state) {
+  std::vector<std::string> patterns;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    patterns.push_back("ab" + std::to_string(i));
+  }
+  MatchAnySubstringOptions options(std::move(patterns));
+  UnaryStringBenchmark(state, "match_any_substring", &options);
+}
+
 static void SplitPattern(benchmark::State& state) {
   SplitPatternOptions options("a");
   UnaryStringBenchmark(state, "split_pattern", &options);
@@ -105,6 +155,16 @@ static void MatchLikeSubstring(benchmark::State& state) {
   UnaryStringBenchmark(state, "match_like", &options);
 }
 
+static void MatchLikeSegments(benchmark::State& state) {
+  MatchSubstringOptions options("%ab%ac%");
+  UnaryStringBenchmark(state, "match_like", &options);
+}
+
+static void MatchLikeWildcard(benchmark::State& state) {
+  MatchSubstringOptions options("%ab_ac%");
+  UnaryStringBenchmark(state, "match_like", &options);
+}
+
 static void MatchLikePrefix(benchmark::State& state) {
   MatchSubstringOptions options("%abac");
   UnaryStringBenchmark(state, "match_like", &options);
@@ -125,6 +185,22 @@ static void Utf8Lower(benchmark::State& state) {
   UnaryStringBenchmark(state, "utf8_lower");
 }
 
+static void Utf8UpperMixed(benchmark::State& state) {
+  UnaryMixedUtf8Benchmark(state, "utf8_upper");
+}
+
+static void Utf8LowerMixed(benchmark::State& state) {
+  UnaryMixedUtf8Benchmark(state, "utf8_lower");
+}
+
+static void IsLowerUnicode(benchmark::State& state) {
+  UnaryStringBenchmark(state, "utf8_is_lower");
+}
+
+static void IsLowerUnicodeMixed(benchmark::State& state) {
+  UnaryMixedUtf8Benchmark(state, "utf8_is_lower");
+}
+
 static void IsAlphaNumericUnicode(benchmark::State& state) {
   UnaryStringBenchmark(state, "utf8_is_alnum");
 }
@@ -240,21 +316,32 @@ static void BinaryRepeat(benchmark::State& state) {
 
 BENCHMARK(AsciiLower);
 BENCHMARK(AsciiUpper);
+BENCHMARK(AsciiSwapCase);
+BENCHMARK(IsAscii);
+BENCHMARK(Utf8Length);
+BENCHMARK(Utf8LengthMixed);
 BENCHMARK(IsAlphaNumericAscii);
 BENCHMARK(MatchSubstring);
+BENCHMARK(MatchAnySubstring)->RangeMultiplier(8)->Range(1, 512);
 BENCHMARK(SplitPattern);
 BENCHMARK(TrimSingleAscii);
 BENCHMARK(TrimManyAscii);
 #ifdef ARROW_WITH_RE2
 BENCHMARK(MatchLike);
 BENCHMARK(MatchLikeSubstring);
+BENCHMARK(MatchLikeSegments);
+BENCHMARK(MatchLikeWildcard);
 BENCHMARK(MatchLikePrefix);
 BENCHMARK(MatchLikeSuffix);
 #endif
 #ifdef ARROW_WITH_UTF8PROC
 BENCHMARK(Utf8Lower);
 BENCHMARK(Utf8Upper);
+BENCHMARK(Utf8LowerMixed);
+BENCHMARK(Utf8UpperMixed);
 BENCHMARK(IsAlphaNumericUnicode);
+BENCHMARK(IsLowerUnicode);
+BENCHMARK(IsLowerUnicodeMixed);
 BENCHMARK(TrimSingleUtf8);
 BENCHMARK(TrimManyUtf8);
 #endif
@@ -1224,6 +1224,15 @@ TYPED_TEST(TestStringKernels, Utf8Upper) {
   // test maximum buffer growth
   this->CheckUnary("utf8_upper", "[\"ɑɑɑɑ\"]", this->type(), "[\"ⱭⱭⱭⱭ\"]");
 
+  // test ASCII runs longer than a SIMD register mixed with non-ASCII characters
+  this->CheckUnary(
+      "utf8_upper",
+      "[\"the quick brown fox jumps over the lazy dog, æ the quick brown fox jumps "
+      "over the lazy dog ɑ\"]",
+      this->type(),
+      "[\"THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG, Æ THE QUICK BROWN FOX JUMPS "
+      "OVER THE LAZY DOG Ɑ\"]");
+
   // Test invalid data
   auto invalid_input = ArrayFromJSON(this->type(), "[\"ɑa\xFFɑ\", \"ɽ\xe1\xbdɽaa\"]");
   EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, testing::HasSubstr("Invalid UTF8 sequence"),
@@ -1246,6 +1255,15 @@ TYPED_TEST(TestStringKernels, Utf8Lower) {
   // test maximum buffer growth
   this->CheckUnary("utf8_lower", "[\"ȺȺȺȺ\"]", this->type(), "[\"ⱥⱥⱥⱥ\"]");
 
+  // test ASCII runs longer than a SIMD register mixed with non-ASCII characters
+  this->CheckUnary(
+      "utf8_lower",
+      "[\"THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG, Æ THE QUICK BROWN FOX JUMPS "
+      "OVER THE LAZY DOG Ɑ\"]",
+      this->type(),
+      "[\"the quick brown fox jumps over the lazy dog, æ the quick brown fox jumps "
+      "over the lazy dog ɑ\"]");
+
   // Test invalid data
   auto invalid_input = ArrayFromJSON(this->type(), "[\"Ⱥa\xFFⱭ\", \"Ɽ\xe1\xbdⱤaA\"]");
   EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, testing::HasSubstr("Invalid UTF8 sequence"),
@@ -1572,6 +1590,60 @@ TYPED_TEST(TestBaseBinaryKernels, MatchSubstringIgnoreCase) {
 }
 #endif
 
+TYPED_TEST(TestBaseBinaryKernels, MatchAnySubstring) {
+  MatchAnySubstringOptions options{{"he", "she", "his", "hers"}};
+  this->CheckUnary("match_any_substring", "[]", boolean(), "[]", &options);
+  this->CheckUnary("match_any_substring",
+                   R"(["ushers", "this", "sh", null, "", "HE", "ahishe", "hrs"])",
+                   boolean(), "[true, true, false, null, false, false, true, false]",
+                   &options);
+
+  // Matches found through failure links
+  MatchAnySubstringOptions options_overlapping{{"abcd", "bc", "aab"}};
+  this->CheckUnary("match_any_substring", R"(["abc", "abd", "aaab", "aacd", "ab"])",
+                   boolean(), "[true, false, true, false, false]",
+                   &options_overlapping);
+
+  MatchAnySubstringOptions options_ignore_case{{"Error", "wArN"}, /*ignore_case=*/true};
+  this->CheckUnary("match_any_substring",
+                   R"(["ERROR: x", "warning", "info", "errr", "[Warn]"])", boolean(),
+                   "[true, true, false, false, true]", &options_ignore_case);
+
+  MatchAnySubstringOptions options_none{{}};
+  this->CheckUnary("match_any_substring", R"(["abc", null, ""])", boolean(),
+                   "[false, null, false]", &options_none);
+
+  MatchAnySubstringOptions options_empty{{"xyz", ""}};
+  this->CheckUnary("match_any_substring", R"(["abc", null, ""])", boolean(),
+                   "[true, null, true]", &options_empty);
+}
+
+TYPED_TEST(TestBaseBinaryKernels, MatchAnySubstringMany) {
+  // Compare with searching each pattern separately
+  std::vector<std::string> patterns;
+  for (int i = 0; i < 200; ++i) {
+    patterns.push_back("p" + std::to_string(i * 7) + "q");
+  }
+  std::vector<std::string> values = {"", "p0", "p0q", "xxp7qxx", "p14p21q", "p1399q",
+                                     "p1400q", "pp49qq", "p7p7p7", "aaaaap693q"};
+  std::string values_json = "[";
+  std::string expected_json = "[";
+  for (const auto& value : values) {
+    bool expected = false;
+    for (const auto& pattern : patterns) {
+      expected |= value.find(pattern) != std::string::npos;
+    }
+    values_json += (values_json.size() > 1 ? ", \"" : "\"") + value + "\"";
+    expected_json += std::string(expected_json.size() > 1 ? ", " : "") +
+                     (expected ? "true" : "false");
+  }
+  values_json += "]";
+  expected_json += "]";
+  MatchAnySubstringOptions options{patterns};
+  this->CheckUnary("match_any_substring", values_json, boolean(), expected_json,
+                   &options);
+}
+
 TYPED_TEST(TestBaseBinaryKernels, MatchStartsWith) {
   MatchSubstringOptions options{"abab"};
   this->CheckUnary("starts_with", "[]", boolean(), "[]", &options);
@@ -1696,6 +1768,28 @@ TYPED_TEST(TestStringKernels, MatchLike) {
                    "[false, false, true, false, false, false, false, null]",
                    &regex_match);
 
+  // Patterns with several '%' wildcards are matched by searching for each segment
+  MatchSubstringOptions segments_match{"%foo%bar%"};
+  this->CheckUnary("match_like", R"(["foobar", "barfoo", "xfooybarz", "foobafoobar"])",
+                   boolean(), "[true, false, true, true]", &segments_match);
+
+  MatchSubstringOptions anchored_segments_match{"fo%o%ar"};
+  this->CheckUnary("match_like", R"(["foobar", "foar", "fooar", "foo\nbar", "fobar"])",
+                   boolean(), "[true, false, true, true, false]",
+                   &anchored_segments_match);
+
+  MatchSubstringOptions exact_match{"foo"};
+  this->CheckUnary("match_like", inputs, boolean(),
+                   "[true, false, false, false, false, false, false, null]",
+                   &exact_match);
+
+  // Input that doesn't contain the literal part of the pattern is skipped before
+  // running the regex
+  MatchSubstringOptions prefiltered_match{"%o_b%"};
+  this->CheckUnary("match_like", inputs, boolean(),
+                   "[false, false, true, false, false, false, false, null]",
+                   &prefiltered_match);
+
   // ignore_case means this still gets mapped to a regex search
   MatchSubstringOptions insensitive_substring{"%é%", /*ignore_case=*/true};
   this->CheckUnary("match_like", R"(["é", "fooÉbar", "e"])", boolean(),
@@ -1730,6 +1824,10 @@ TYPED_TEST(TestBaseBinaryKernels, MatchLikeEscaping) {
   this->CheckUnary("match_like", inputs, boolean(), "[false, false, false, true]",
                    &escape_escape);
 
+  MatchSubstringOptions escape_literal{"%\\b"};
+  this->CheckUnary("match_like", R"(["ab", "a\\b", "a\\"])", boolean(),
+                   "[true, true, false]", &escape_literal);
+
   MatchSubstringOptions special_chars{"!@#$^&*()[]{}.?"};
   this->CheckUnary("match_like", R"(["!@#$^&*()[]{}.?"])", boolean(), "[true]",
                    &special_chars);
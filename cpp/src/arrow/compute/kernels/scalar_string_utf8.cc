@@ -180,8 +180,20 @@ struct CharacterPredicateUnicode {
     if (allow_empty && input_string_ncodeunits == 0) {
       return true;
     }
-    bool all;
     bool any = false;
+    // ASCII characters are their own codepoints, test them without decoding
+    const int64_t ascii_length =
+        arrow::util::AsciiPrefixLength(input, input_string_ncodeunits);
+    for (int64_t i = 0; i < ascii_length; ++i) {
+      if (!Derived::PredicateCharacterAll(input[i])) {
+        return false;
+      }
+      any |= Derived::PredicateCharacterAny(input[i]);
+    }
+    input += ascii_length;
+    input_string_ncodeunits -= ascii_length;
+
+    bool all;
     if (!ARROW_PREDICT_TRUE(arrow::util::UTF8AllOf(
             input, input + input_string_ncodeunits, &all, [&any](uint32_t codepoint) {
               any |= Derived::PredicateCharacterAny(codepoint);
@@ -369,16 +381,32 @@ struct StringTransformCodepoint : public FunctionalCaseMappingTransform {
   int64_t Transform(const uint8_t* input, int64_t input_string_ncodeunits,
                     uint8_t* output) {
     uint8_t* output_start = output;
-    if (ARROW_PREDICT_FALSE(
-            !arrow::util::UTF8Transform(input, input + input_string_ncodeunits, &output,
-                                        CodepointTransform::TransformCodepoint))) {
-      return kStringTransformError;
+    const uint8_t* end = input + input_string_ncodeunits;
+    while (input < end) {
+      // Convert runs of ASCII characters in bulk, they map to ASCII characters
+      const int64_t ascii_length = arrow::util::AsciiPrefixLength(input, end - input);
+      CodepointTransform::TransformAscii(input, ascii_length, output);
+      input += ascii_length;
+      output += ascii_length;
+      // Then decode other characters up to the next ASCII character
+      while (input < end && *input >= 0x80) {
+        uint32_t codepoint = 0;
+        if (ARROW_PREDICT_FALSE(!arrow::util::UTF8Decode(&input, &codepoint))) {
+          return kStringTransformError;
+        }
+        output = arrow::util::UTF8Encode(
+            output, CodepointTransform::TransformCodepoint(codepoint));
+      }
     }
     return output - output_start;
   }
 };
 
 struct UTF8UpperTransform : public FunctionalCaseMappingTransform {
+  static void TransformAscii(const uint8_t* input, int64_t length, uint8_t* output) {
+    arrow::util::AsciiToUpper(input, length, output);
+  }
+
   static uint32_t TransformCodepoint(uint32_t codepoint) {
     return codepoint <= kMaxCodepointLookup ? lut_upper_codepoint[codepoint]
                                             : utf8proc_toupper(codepoint);
@@ -389,6 +417,10 @@ template <typename Type>
 using UTF8Upper = StringTransformExec<Type, StringTransformCodepoint<UTF8UpperTransform>>;
 
 struct UTF8LowerTransform : public FunctionalCaseMappingTransform {
+  static void TransformAscii(const uint8_t* input, int64_t length, uint8_t* output) {
+    arrow::util::AsciiToLower(input, length, output);
+  }
+
   static uint32_t TransformCodepoint(uint32_t codepoint) {
     return codepoint <= kMaxCodepointLookup ? lut_lower_codepoint[codepoint]
                                             : utf8proc_tolower(codepoint);
@@ -399,6 +431,10 @@ template <typename Type>
 using UTF8Lower = StringTransformExec<Type, StringTransformCodepoint<UTF8LowerTransform>>;
 
 struct UTF8SwapCaseTransform : public FunctionalCaseMappingTransform {
+  static void TransformAscii(const uint8_t* input, int64_t length, uint8_t* output) {
+    arrow::util::AsciiSwapCase(input, length, output);
+  }
+
   static uint32_t TransformCodepoint(uint32_t codepoint) {
     if (codepoint <= kMaxCodepointLookup) {
       return lut_swapcase_codepoint[codepoint];
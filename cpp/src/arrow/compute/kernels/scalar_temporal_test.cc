@@ -935,6 +935,62 @@ TEST_F(ScalarTemporalTest, TestNonexistentTimezone) {
   }
 }
 
+TEST_F(ScalarTemporalTest, TestZonedAcrossTransitions) {
+  // Consecutive values of a batch reuse the time zone interval found for the
+  // previous value, check against converting each value on its own
+  auto check_elementwise = [](const std::string& func, const Datum& input,
+                              const FunctionOptions* options) {
+    ARROW_SCOPED_TRACE(func);
+    ASSERT_OK_AND_ASSIGN(Datum result, CallFunction(func, {input}, options));
+    const auto values = input.make_array();
+    const auto results = result.make_array();
+    for (int64_t i = 0; i < values->length(); ++i) {
+      ASSERT_OK_AND_ASSIGN(auto value, values->GetScalar(i));
+      ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(func, {value}, options));
+      ASSERT_OK_AND_ASSIGN(auto actual, results->GetScalar(i));
+      AssertScalarsEqual(*expected.scalar(), *actual, /*verbose=*/true);
+    }
+  };
+
+  // Every 15 minutes around the 2021 DST transitions of both time zones
+  Int64Builder builder;
+  for (int64_t start : {1615593600, 1635552000}) {
+    for (int64_t i = 0; i < 10 * 24 * 4; ++i) {
+      ASSERT_OK(builder.Append(start + i * 15 * 60));
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto seconds, builder.Finish());
+
+  const StrftimeOptions strftime_options("%Y-%m-%dT%H:%M:%S %Z");
+  const RoundTemporalOptions round_options(1, CalendarUnit::DAY);
+  for (auto timezone : {"America/New_York", "Europe/London", "-03:30"}) {
+    for (auto u : {TimeUnit::SECOND, TimeUnit::NANO}) {
+      ARROW_SCOPED_TRACE(timezone, " ", u);
+      ASSERT_OK_AND_ASSIGN(Datum values, Cast(seconds, timestamp(TimeUnit::SECOND)));
+      ASSERT_OK_AND_ASSIGN(values, Cast(values, timestamp(u)));
+      ASSERT_OK_AND_ASSIGN(auto zoned, values.make_array()->View(timestamp(u, timezone)));
+
+      check_elementwise("hour", zoned, nullptr);
+      check_elementwise("day", zoned, nullptr);
+      check_elementwise("local_timestamp", zoned, nullptr);
+      check_elementwise("year_month_day", zoned, nullptr);
+      check_elementwise("iso_calendar", zoned, nullptr);
+      check_elementwise("strftime", zoned, &strftime_options);
+      check_elementwise("floor_temporal", zoned, &round_options);
+      check_elementwise("ceil_temporal", zoned, &round_options);
+      if (timezone[0] != '-') {
+        check_elementwise("is_dst", zoned, nullptr);
+
+        const AssumeTimezoneOptions assume_options(
+            timezone, AssumeTimezoneOptions::AMBIGUOUS_EARLIEST,
+            AssumeTimezoneOptions::NONEXISTENT_EARLIEST);
+        ASSERT_OK_AND_ASSIGN(Datum local, CallFunction("local_timestamp", {zoned}));
+        check_elementwise("assume_timezone", local, &assume_options);
+      }
+    }
+  }
+}
+
 TEST_F(ScalarTemporalTest, Week) {
   auto unit = timestamp(TimeUnit::NANO);
   std::string week_100 =
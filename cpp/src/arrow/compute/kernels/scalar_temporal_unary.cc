@@ -322,8 +322,9 @@ struct YearMonthDayVisitValueFunction<Duration, TimestampType, BuilderType> {
       };
     }
     ARROW_ASSIGN_OR_RAISE(auto tz, LocateZone(timezone));
+    const ZonedLocalizer localizer{tz};
     return [=](TimestampType::c_type arg) {
-      const auto ymd = GetYearMonthDay<Duration>(arg, ZonedLocalizer{tz});
+      const auto ymd = GetYearMonthDay<Duration>(arg, localizer);
       field_builders[0]->UnsafeAppend(static_cast<const int32_t>(ymd[0]));
       field_builders[1]->UnsafeAppend(static_cast<const uint32_t>(ymd[1]));
       field_builders[2]->UnsafeAppend(static_cast<const uint32_t>(ymd[2]));
@@ -348,7 +349,7 @@ struct YearMonthDay {
     for (int i = 0; i < 3; i++) {
       field_builders.push_back(
           checked_cast<BuilderType*>(struct_builder->field_builder(i)));
-      RETURN_NOT_OK(field_builders[i]->Reserve(1));
+      RETURN_NOT_OK(field_builders[i]->Reserve(in.length));
     }
     auto visit_null = [&]() { return struct_builder->AppendNull(); };
     std::function<Status(typename InType::c_type arg)> visit_value;
@@ -663,18 +664,14 @@ struct Nanosecond {
 template <typename Duration>
 struct IsDaylightSavings {
   explicit IsDaylightSavings(const FunctionOptions* options, const ArrowTimeZone tz)
-      : tz_(tz) {}
+      : zone_info_(tz) {}
 
   template <typename T, typename Arg0>
   T Call(KernelContext*, Arg0 arg, Status*) const {
-    return std::visit(
-        [&arg](const auto& tz) -> bool {
-          return tz->get_info(sys_time<Duration>{Duration{arg}}).save.count() != 0;
-        },
-        tz_);
+    return zone_info_.Get(sys_time<Duration>{Duration{arg}}).save.count() != 0;
   }
 
-  const ArrowTimeZone tz_;
+  mutable ZoneInfoCache zone_info_;
 };
 
 // ----------------------------------------------------------------------
@@ -699,7 +696,8 @@ struct LocalTimestamp {
 
 template <typename Duration, typename Localizer>
 year_month_day GetFlooredYmd(int64_t arg, const int multiple,
-                             const RoundTemporalOptions& options, Localizer localizer_) {
+                             const RoundTemporalOptions& options,
+                             const Localizer& localizer_) {
   year_month_day ymd{floor<days>(localizer_.template ConvertTimePoint<Duration>(arg))};
 
   if (multiple == 1) {
@@ -744,7 +742,7 @@ year_month_day GetFlooredYmd(int64_t arg, const int multiple,
 
 template <typename Duration, typename Unit, typename Localizer>
 const Duration FloorTimePoint(const int64_t arg, const RoundTemporalOptions& options,
-                              Localizer localizer_, Status* st) {
+                              const Localizer& localizer_, Status* st) {
   const auto t = localizer_.template ConvertTimePoint<Duration>(arg);
 
   if (options.multiple == 1) {
@@ -812,8 +810,8 @@ const Duration FloorTimePoint(const int64_t arg, const RoundTemporalOptions& opt
 
 template <typename Duration, typename Localizer>
 const Duration FloorWeekTimePoint(const int64_t arg, const RoundTemporalOptions& options,
-                                  Localizer localizer_, const Duration weekday_offset,
-                                  Status* st) {
+                                  const Localizer& localizer_,
+                                  const Duration weekday_offset, Status* st) {
   const auto t = localizer_.template ConvertTimePoint<Duration>(arg) + weekday_offset;
   const weeks d = floor<weeks>(t).time_since_epoch();
 
@@ -850,7 +848,7 @@ const Duration FloorWeekTimePoint(const int64_t arg, const RoundTemporalOptions&
 
 template <typename Duration, typename Unit, typename Localizer>
 Duration CeilTimePoint(const int64_t arg, const RoundTemporalOptions& options,
-                       Localizer localizer_, Status* st) {
+                       const Localizer& localizer_, Status* st) {
   const Duration f =
       FloorTimePoint<Duration, Unit, Localizer>(arg, options, localizer_, st);
   const auto cl =
@@ -868,7 +866,7 @@ Duration CeilTimePoint(const int64_t arg, const RoundTemporalOptions& options,
 
 template <typename Duration, typename Localizer>
 Duration CeilWeekTimePoint(const int64_t arg, const RoundTemporalOptions& options,
-                           Localizer localizer_, const Duration weekday_offset,
+                           const Localizer& localizer_, const Duration weekday_offset,
                            Status* st) {
   const Duration f = FloorWeekTimePoint<Duration, Localizer>(arg, options, localizer_,
                                                              weekday_offset, st);
@@ -886,7 +884,7 @@ Duration CeilWeekTimePoint(const int64_t arg, const RoundTemporalOptions& option
 
 template <typename Duration, typename Unit, typename Localizer>
 Duration RoundTimePoint(const int64_t arg, const RoundTemporalOptions& options,
-                        Localizer localizer_, Status* st) {
+                        const Localizer& localizer_, Status* st) {
   const Duration f =
       FloorTimePoint<Duration, Unit, Localizer>(arg, options, localizer_, st);
   const Duration c =
@@ -896,7 +894,7 @@ Duration RoundTimePoint(const int64_t arg, const RoundTemporalOptions& options,
 
 template <typename Duration, typename Localizer>
 Duration RoundWeekTimePoint(const int64_t arg, const RoundTemporalOptions& options,
-                            Localizer localizer_, const Duration weekday_offset,
+                            const Localizer& localizer_, const Duration weekday_offset,
                             Status* st) {
   const Duration f = FloorWeekTimePoint<Duration, Localizer>(arg, options, localizer_,
                                                              weekday_offset, st);
@@ -1355,7 +1353,7 @@ Result<TypeHolder> ResolveLocalTimestampOutput(KernelContext* ctx,
 template <typename Duration>
 struct AssumeTimezone {
   explicit AssumeTimezone(const AssumeTimezoneOptions* options, const ArrowTimeZone tz)
-      : options(*options), tz_(tz) {}
+      : options(*options), tz_(tz), zone_info_(tz) {}
 
   template <typename T, typename Arg0>
   T get_local_time(Arg0 arg, const ArrowTimeZone* tz) const {
@@ -1377,6 +1375,19 @@ struct AssumeTimezone {
 
   template <typename T, typename Arg0>
   T Call(KernelContext*, Arg0 arg, Status* st) const {
+    // Local times well within the interval of the previous value can be neither
+    // ambiguous nor nonexistent, and don't need a time zone lookup
+    sys_time<Duration> sys;
+    if (ARROW_PREDICT_TRUE(zone_info_.ToSys(local_time<Duration>(Duration{arg}), &sys))) {
+      return static_cast<T>(sys.time_since_epoch().count());
+    }
+    const T result = Convert<T>(arg, st);
+    zone_info_.Get(sys_time<Duration>(Duration{result}));
+    return result;
+  }
+
+  template <typename T, typename Arg0>
+  T Convert(Arg0 arg, Status* st) const {
     try {
       return get_local_time<T, Arg0>(arg, &tz_);
     } catch (const arrow_vendored::date::nonexistent_local_time& e) {
@@ -1415,6 +1426,7 @@ struct AssumeTimezone {
   }
   AssumeTimezoneOptions options;
   const ArrowTimeZone tz_;
+  mutable ZoneInfoCache zone_info_;
 };
 
 // ----------------------------------------------------------------------
@@ -1488,8 +1500,9 @@ struct ISOCalendarVisitValueFunction<Duration, TimestampType, BuilderType> {
       };
     }
     ARROW_ASSIGN_OR_RAISE(auto tz, LocateZone(timezone));
+    const ZonedLocalizer localizer{tz};
     return [=](TimestampType::c_type arg) {
-      const auto iso_calendar = GetIsoCalendar<Duration>(arg, ZonedLocalizer{tz});
+      const auto iso_calendar = GetIsoCalendar<Duration>(arg, localizer);
       field_builders[0]->UnsafeAppend(iso_calendar[0]);
       field_builders[1]->UnsafeAppend(iso_calendar[1]);
       field_builders[2]->UnsafeAppend(iso_calendar[2]);
@@ -32,6 +32,7 @@
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -711,5 +712,65 @@ TEST_F(TestSelectKWithTable, BottomKMultipleColumnKeys) {
   Check(schema, input, options, expected);
 }
 
+// Large inputs are selected from in parallel; since selection is unstable, check
+// that the selected rows are the same as with serial execution once sorted.
+class TestSelectKParallel : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(thread_pool_, ::arrow::internal::ThreadPool::Make(4));
+    serial_ctx_.set_use_threads(false);
+  }
+
+  Result<Datum> SortedSelection(const Datum& values, const SelectKOptions& options,
+                                ExecContext* ctx) {
+    ARROW_ASSIGN_OR_RAISE(auto indices, CallFunction("select_k_unstable", {values},
+                                                     &options, ctx));
+    ARROW_ASSIGN_OR_RAISE(auto selected, Take(values, indices));
+    SortOptions sort_options(options.sort_keys);
+    ARROW_ASSIGN_OR_RAISE(auto sort_indices, SortIndices(selected, sort_options));
+    return Take(selected, sort_indices);
+  }
+
+  void Check(const Datum& values, const SelectKOptions& options) {
+    ARROW_SCOPED_TRACE("k = ", options.k);
+    ASSERT_OK_AND_ASSIGN(auto expected, SortedSelection(values, options, &serial_ctx_));
+    ExecContext parallel_ctx(default_memory_pool(), thread_pool_.get());
+    ASSERT_OK_AND_ASSIGN(auto actual, SortedSelection(values, options, &parallel_ctx));
+    AssertDatumsEqual(expected, actual);
+  }
+
+  std::shared_ptr<::arrow::internal::ThreadPool> thread_pool_;
+  ExecContext serial_ctx_;
+};
+
+TEST_F(TestSelectKParallel, ChunkedArray) {
+  random::RandomArrayGenerator rng(0x7e57);
+  ArrayVector chunks;
+  for (int64_t length : {30000, 0, 1, 70000, 5000, 90000}) {
+    chunks.push_back(rng.Int64(length, -1000000, 1000000, /*null_probability=*/0.1));
+  }
+  const Datum chunked_array = std::make_shared<ChunkedArray>(chunks);
+  for (int64_t k : {0, 1, 100, 10000, 1000000}) {
+    Check(chunked_array, SelectKOptions::TopKDefault(k));
+    Check(chunked_array, SelectKOptions::BottomKDefault(k));
+  }
+}
+
+TEST_F(TestSelectKParallel, Table) {
+  random::RandomArrayGenerator rng(0x7e57);
+  ArrayVector chunks_a, chunks_b;
+  for (int64_t length : {30000, 70000, 5000, 90000}) {
+    chunks_a.push_back(rng.Int32(length, 0, 100, /*null_probability=*/0.1));
+    chunks_b.push_back(rng.String(length, 0, 4, /*null_probability=*/0.1));
+  }
+  const Datum table = Table::Make(schema({field("a", int32()), field("b", utf8())}),
+                                  {std::make_shared<ChunkedArray>(chunks_a),
+                                   std::make_shared<ChunkedArray>(chunks_b)});
+  for (int64_t k : {0, 1, 100, 10000, 1000000}) {
+    Check(table, SelectKOptions::TopKDefault(k, {"a", "b"}));
+    Check(table, SelectKOptions::BottomKDefault(k, {"a", "b"}));
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -19,6 +19,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <utility>
 
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/kernels/codegen_internal.h"
@@ -35,6 +36,8 @@ using arrow_vendored::date::local_days;
 using arrow_vendored::date::local_time;
 using arrow_vendored::date::locate_zone;
 using arrow_vendored::date::sys_days;
+using arrow_vendored::date::sys_info;
+using arrow_vendored::date::sys_seconds;
 using arrow_vendored::date::sys_time;
 using arrow_vendored::date::time_zone;
 using arrow_vendored::date::year_month_day;
@@ -76,6 +79,66 @@ auto ApplyTimeZone(const ArrowTimeZone& tz, local_time<Duration> lt,
       tz);
 }
 
+// Looks up the time zone interval (the period between two UTC offset transitions)
+// containing a time point. The last interval found is kept, so that runs of time
+// points within the same interval, e.g. the values of a batch not crossing a DST
+// transition, skip the time zone database lookup.
+class ZoneInfoCache {
+ public:
+  explicit ZoneInfoCache(ArrowTimeZone tz) : tz_(std::move(tz)) {}
+
+  const ArrowTimeZone& tz() const { return tz_; }
+
+  template <typename Duration>
+  const sys_info& Get(sys_time<Duration> st) {
+    const auto s = floor<std::chrono::seconds>(st);
+    if (ARROW_PREDICT_FALSE(s < info_.begin || s >= info_.end)) {
+      Lookup(s);
+    }
+    return info_;
+  }
+
+  template <typename Duration>
+  local_time<Duration> ToLocal(sys_time<Duration> st) {
+    return local_time<Duration>{st.time_since_epoch() + Get(st).offset};
+  }
+
+  // Convert a local time to UTC if it lies within the last interval found, far
+  // enough from its ends that it can be neither ambiguous nor nonexistent.
+  template <typename Duration>
+  bool ToSys(local_time<Duration> lt, sys_time<Duration>* out) const {
+    const auto st = sys_time<Duration>{lt.time_since_epoch() - info_.offset};
+    const auto s = floor<std::chrono::seconds>(st);
+    if (s < unambiguous_begin_ || s >= unambiguous_end_) {
+      return false;
+    }
+    *out = st;
+    return true;
+  }
+
+ private:
+  // UTC offsets of neighbouring intervals never differ by more than a day, so a
+  // local time this far within an interval can't also map to another one.
+  static constexpr std::chrono::seconds kUnambiguousMargin = days{2};
+
+  void Lookup(sys_seconds s) {
+    info_ = std::visit([s](const auto& tz) { return tz->get_info(s); }, tz_);
+    unambiguous_begin_ = info_.begin > sys_seconds::min() + kUnambiguousMargin
+                             ? info_.begin + kUnambiguousMargin
+                             : sys_seconds::min();
+    unambiguous_end_ = info_.end < sys_seconds::max() - kUnambiguousMargin
+                           ? info_.end - kUnambiguousMargin
+                           : sys_seconds::max();
+  }
+
+  ArrowTimeZone tz_;
+  // Empty until the first lookup
+  sys_info info_{sys_seconds::max(), sys_seconds::min(), std::chrono::seconds{0},
+                 std::chrono::minutes{0}, ""};
+  sys_seconds unambiguous_begin_ = sys_seconds::max();
+  sys_seconds unambiguous_end_ = sys_seconds::min();
+};
+
 inline int64_t GetQuarter(const year_month_day& ymd) {
   return static_cast<int64_t>((static_cast<uint32_t>(ymd.month()) - 1) / 3);
 }
@@ -129,25 +192,31 @@ struct NonZonedLocalizer {
 struct ZonedLocalizer {
   using days_t = local_days;
 
+  explicit ZonedLocalizer(ArrowTimeZone tz) : zone_info_(std::move(tz)) {}
+
   // Timezone-localizing conversions: UTC -> local time
-  const ArrowTimeZone tz_;
+  mutable ZoneInfoCache zone_info_;
 
   template <typename Duration>
   local_time<Duration> ConvertTimePoint(int64_t t) const {
-    const auto st = sys_time<Duration>(Duration{t});
-    return std::visit(
-        [st](const auto& tz) -> local_time<Duration> { return tz->to_local(st); }, tz_);
+    return zone_info_.ToLocal(sys_time<Duration>(Duration{t}));
   }
 
   template <typename Duration>
   Duration ConvertLocalToSys(Duration t, Status* st) const {
     const auto lt = local_time<Duration>(t);
+    // Local times are usually derived from a time point just converted by
+    // ConvertTimePoint, and thus within the interval it was found in
+    sys_time<Duration> sys;
+    if (ARROW_PREDICT_TRUE(zone_info_.ToSys(lt, &sys))) {
+      return sys.time_since_epoch();
+    }
     auto local_to_sys_time = [&](auto&& t) {
       return t.get_sys_time().time_since_epoch();
     };
 
     try {
-      return ApplyTimeZone(tz_, lt, std::nullopt, local_to_sys_time);
+      return ApplyTimeZone(zone_info_.tz(), lt, std::nullopt, local_to_sys_time);
     } catch (const arrow_vendored::date::nonexistent_local_time& e) {
       *st = Status::Invalid("Local time does not exist: ", e.what());
       return Duration{0};
@@ -163,12 +232,12 @@ struct ZonedLocalizer {
 template <typename Duration>
 struct TimestampFormatter {
   const char* format;
-  const ArrowTimeZone tz;
+  ZoneInfoCache zone_info;
   std::ostringstream bufstream;
 
   explicit TimestampFormatter(const std::string& format, const ArrowTimeZone time_zone,
                               const std::locale& locale)
-      : format(format.c_str()), tz(time_zone) {
+      : format(format.c_str()), zone_info(time_zone) {
     bufstream.imbue(locale);
     // Propagate errors as C++ exceptions (to get an actual error message)
     bufstream.exceptions(std::ios::failbit | std::ios::badbit);
@@ -177,16 +246,17 @@ struct TimestampFormatter {
   Result<std::string> operator()(int64_t arg) {
     bufstream.str("");
     const auto timepoint = sys_time<Duration>(Duration{arg});
-    auto format_zoned_time = [&](auto&& zt) {
-      try {
-        arrow_vendored::date::to_stream(bufstream, format, zt);
-        return Status::OK();
-      } catch (const std::runtime_error& ex) {
-        bufstream.clear();
-        return Status::Invalid("Failed formatting timestamp: ", ex.what());
-      }
-    };
-    RETURN_NOT_OK(ApplyTimeZone(tz, timepoint, format_zoned_time));
+    // Same as formatting a zoned_time, without looking up the time zone for each value
+    const sys_info& info = zone_info.Get(timepoint);
+    const auto local = local_time<std::common_type_t<Duration, std::chrono::seconds>>{
+        timepoint.time_since_epoch() + info.offset};
+    try {
+      arrow_vendored::date::to_stream(bufstream, format, local, &info.abbrev,
+                                      &info.offset);
+    } catch (const std::runtime_error& ex) {
+      bufstream.clear();
+      return Status::Invalid("Failed formatting timestamp: ", ex.what());
+    }
     return std::move(bufstream).str();
   }
 };
@@ -16,12 +16,14 @@
 // under the License.
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <iterator>
 #include <limits>
 #include <numeric>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "arrow/array/data.h"
 #include "arrow/compute/api_vector.h"
@@ -33,8 +35,10 @@
 #include "arrow/util/bit_block_counter.h"
 #include "arrow/util/bitmap.h"
 #include "arrow/util/bitmap_ops.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/ubsan.h"
 #include "arrow/visit_type_inline.h"
 
 namespace arrow {
@@ -175,6 +179,55 @@ class ArrayCompareSorter {
   }
 };
 
+// Sort binary views by comparing their 4-byte inline prefixes first, only
+// dereferencing the data buffers when the prefixes are equal.  Since the spec
+// mandates zero-padding of short values, the big-endian prefix order agrees with
+// the lexicographic order of the full values whenever the prefixes differ.
+template <>
+class ArrayCompareSorter<BinaryViewType> {
+  using c_type = BinaryViewType::c_type;
+
+ public:
+  Result<NullPartitionResult> operator()(uint64_t* indices_begin, uint64_t* indices_end,
+                                         const Array& array, int64_t offset,
+                                         const ArraySortOptions& options, ExecContext*) {
+    const auto& values = checked_cast<const BinaryViewArray&>(array);
+    const c_type* views = values.raw_values();
+
+    const auto p = PartitionNulls<BinaryViewArray, StablePartitioner>(
+        indices_begin, indices_end, values, offset, options.null_placement);
+    if (options.order == SortOrder::Ascending) {
+      std::stable_sort(p.non_nulls_begin, p.non_nulls_end,
+                       [&](uint64_t left, uint64_t right) {
+                         return Compare(values, views, left - offset, right - offset) < 0;
+                       });
+    } else {
+      std::stable_sort(p.non_nulls_begin, p.non_nulls_end,
+                       [&](uint64_t left, uint64_t right) {
+                         return Compare(values, views, right - offset, left - offset) < 0;
+                       });
+    }
+    return p;
+  }
+
+ private:
+  static uint32_t Prefix(const c_type& view) {
+    uint32_t prefix;
+    memcpy(&prefix, view.inlined.data.data(), sizeof(prefix));
+    return bit_util::FromBigEndian(prefix);
+  }
+
+  static int Compare(const BinaryViewArray& values, const c_type* views, int64_t left,
+                     int64_t right) {
+    const uint32_t lhs = Prefix(views[left]);
+    const uint32_t rhs = Prefix(views[right]);
+    if (lhs != rhs) {
+      return lhs < rhs ? -1 : 1;
+    }
+    return values.GetView(left).compare(values.GetView(right));
+  }
+};
+
 template <>
 class ArrayCompareSorter<DictionaryType> {
  public:
@@ -412,10 +465,139 @@ class ArrayCountSorter<BooleanType> {
   }
 };
 
-// Sort integers with counting sort or comparison based sorting algorithm
-// - Use O(n) counting sort if values are in a small range
+// Sort fixed-width numbers with a LSD radix sort
+//
+// Values are first mapped to unsigned keys whose natural order is the requested
+// sort order, then the (key, index) pairs are distributed one byte at a time.  All
+// byte histograms are computed in a single pass over the input and the passes over
+// bytes that are the same for all values are skipped (e.g. most passes for small
+// int64 values).  Like std::stable_sort, the sort is stable.
+template <typename ArrowType>
+class ArrayRadixSorter {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using c_type = typename ArrowType::c_type;
+  using KeyType = std::conditional_t<sizeof(c_type) <= 4, uint32_t, uint64_t>;
+
+  static constexpr int kRadixBits = 8;
+  static constexpr int kNumBuckets = 1 << kRadixBits;
+  static constexpr int kNumPasses = sizeof(c_type);
+
+ public:
+  Result<NullPartitionResult> operator()(uint64_t* indices_begin, uint64_t* indices_end,
+                                         const Array& array, int64_t offset,
+                                         const ArraySortOptions& options,
+                                         ExecContext*) const {
+    const auto& values = checked_cast<const ArrayType&>(array);
+
+    const auto p = PartitionNulls<ArrayType, StablePartitioner>(
+        indices_begin, indices_end, values, offset, options.null_placement);
+    const int64_t length = p.non_nulls_end - p.non_nulls_begin;
+    if (length < 2) {
+      return p;
+    }
+
+    const c_type* raw_values = values.raw_values();
+    const bool descending = options.order == SortOrder::Descending;
+    std::vector<KeyType> keys(length), keys_scratch(length);
+    std::vector<uint64_t> indices_scratch(length);
+    std::vector<std::array<int64_t, kNumBuckets>> histograms(kNumPasses);
+    for (auto& histogram : histograms) {
+      histogram.fill(0);
+    }
+    for (int64_t i = 0; i < length; ++i) {
+      const KeyType key = ToKey(raw_values[p.non_nulls_begin[i] - offset], descending);
+      keys[i] = key;
+      for (int pass = 0; pass < kNumPasses; ++pass) {
+        ++histograms[pass][(key >> (pass * kRadixBits)) & (kNumBuckets - 1)];
+      }
+    }
+
+    KeyType* keys_in = keys.data();
+    KeyType* keys_out = keys_scratch.data();
+    uint64_t* indices_in = p.non_nulls_begin;
+    uint64_t* indices_out = indices_scratch.data();
+    for (int pass = 0; pass < kNumPasses; ++pass) {
+      auto& histogram = histograms[pass];
+      const int shift = pass * kRadixBits;
+      if (histogram[(keys_in[0] >> shift) & (kNumBuckets - 1)] == length) {
+        // All keys share this byte, the pass wouldn't change anything
+        continue;
+      }
+      // Turn the histogram into the output position of each bucket
+      int64_t position = 0;
+      for (auto& count : histogram) {
+        const int64_t bucket_count = count;
+        count = position;
+        position += bucket_count;
+      }
+      for (int64_t i = 0; i < length; ++i) {
+        const KeyType key = keys_in[i];
+        const int64_t out_pos = histogram[(key >> shift) & (kNumBuckets - 1)]++;
+        keys_out[out_pos] = key;
+        indices_out[out_pos] = indices_in[i];
+      }
+      std::swap(keys_in, keys_out);
+      std::swap(indices_in, indices_out);
+    }
+    if (indices_in != p.non_nulls_begin) {
+      std::copy(indices_in, indices_in + length, p.non_nulls_begin);
+    }
+    return p;
+  }
+
+ private:
+  static KeyType ToKey(c_type value, bool descending) {
+    KeyType key;
+    if constexpr (std::is_floating_point_v<c_type>) {
+      using BitsType = std::conditional_t<sizeof(c_type) == 4, uint32_t, uint64_t>;
+      constexpr BitsType kSignBit = BitsType{1} << (sizeof(c_type) * 8 - 1);
+      // -0.0 and 0.0 compare equal and must keep their relative order
+      if (value == 0) {
+        value = 0;
+      }
+      auto bits = ::arrow::util::SafeCopy<BitsType>(value);
+      // Negative values are ordered backwards by their bit pattern
+      key = (bits & kSignBit) ? ~bits : (bits | kSignBit);
+    } else if constexpr (std::is_signed_v<c_type>) {
+      using UnsignedType = std::make_unsigned_t<c_type>;
+      constexpr UnsignedType kSignBit = UnsignedType{1} << (sizeof(c_type) * 8 - 1);
+      key = static_cast<UnsignedType>(static_cast<UnsignedType>(value) ^ kSignBit);
+    } else {
+      key = value;
+    }
+    return descending ? ~key : key;
+  }
+};
+
+// Sort fixed-width numbers with radix sort or comparison based sorting algorithm
+// - Use O(n) radix sort for long arrays
 // - Use O(nlogn) std::stable_sort otherwise
 template <typename ArrowType>
+class ArrayRadixOrCompareSorter {
+ public:
+  Result<NullPartitionResult> operator()(uint64_t* indices_begin, uint64_t* indices_end,
+                                         const Array& array, int64_t offset,
+                                         const ArraySortOptions& options,
+                                         ExecContext* ctx) {
+    if (array.length() - array.null_count() >= radixsort_min_len_) {
+      return radix_sorter_(indices_begin, indices_end, array, offset, options, ctx);
+    }
+    return compare_sorter_(indices_begin, indices_end, array, offset, options, ctx);
+  }
+
+ private:
+  ArrayCompareSorter<ArrowType> compare_sorter_;
+  ArrayRadixSorter<ArrowType> radix_sorter_;
+
+  // Radix sort does a fixed number of passes over the data, which only pays off
+  // against the O(nlogn) comparisons of std::stable_sort for long enough arrays.
+  static const int64_t radixsort_min_len_ = 4096;
+};
+
+// Sort integers with counting sort, radix sort or comparison based sorting algorithm
+// - Use O(n) counting sort if values are in a small range
+// - Use radix sort or std::stable_sort otherwise, depending on the length
+template <typename ArrowType>
 class ArrayCountOrCompareSorter {
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
   using c_type = typename ArrowType::c_type;
@@ -444,7 +626,7 @@ class ArrayCountOrCompareSorter {
   }
 
  private:
-  ArrayCompareSorter<ArrowType> compare_sorter_;
+  ArrayRadixOrCompareSorter<ArrowType> compare_sorter_;
   ArrayCountSorter<ArrowType> count_sorter_;
 
   // Cross point to prefer counting sort than stl::stable_sort(merge sort)
@@ -507,10 +689,18 @@ struct ArraySorter<Type, enable_if_t<is_integer_type<Type>::value &&
 };
 
 template <typename Type>
-struct ArraySorter<
-    Type, enable_if_t<is_floating_type<Type>::value || is_base_binary_type<Type>::value ||
-                      is_fixed_size_binary_type<Type>::value ||
-                      is_dictionary_type<Type>::value || is_struct_type<Type>::value>> {
+struct ArraySorter<Type, enable_if_t<std::is_same_v<Type, FloatType> ||
+                                     std::is_same_v<Type, DoubleType>>> {
+  ArrayRadixOrCompareSorter<Type> impl;
+};
+
+template <typename Type>
+struct ArraySorter<Type, enable_if_t<is_half_float_type<Type>::value ||
+                                     is_base_binary_type<Type>::value ||
+                                     is_binary_view_like_type<Type>::value ||
+                                     is_fixed_size_binary_type<Type>::value ||
+                                     is_dictionary_type<Type>::value ||
+                                     is_struct_type<Type>::value>> {
   ArrayCompareSorter<Type> impl;
 };
 
@@ -607,6 +797,11 @@ void AddArraySortingKernels(VectorKernel base, VectorFunction* func) {
     base.exec = GenerateVarBinaryBase<ExecTemplate, UInt64Type>(*physical_type);
     DCHECK_OK(func->AddKernel(base));
   }
+  for (const auto& ty : BinaryViewTypes()) {
+    base.signature = KernelSignature::Make({ty}, uint64());
+    base.exec = GenerateVarBinaryViewBase<ExecTemplate, UInt64Type>(*ty);
+    DCHECK_OK(func->AddKernel(base));
+  }
   base.signature = KernelSignature::Make({Type::FIXED_SIZE_BINARY}, uint64());
   base.exec = ExecTemplate<UInt64Type, FixedSizeBinaryType>::Exec;
   DCHECK_OK(func->AddKernel(base));
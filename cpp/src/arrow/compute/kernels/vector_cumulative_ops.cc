@@ -15,7 +15,11 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <optional>
 #include <type_traits>
+#include <vector>
+
 #include "arrow/array/array_base.h"
 #include "arrow/array/builder_primitive.h"
 #include "arrow/compute/api_scalar.h"
@@ -28,7 +32,10 @@
 #include "arrow/result.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visit_type_inline.h"
 
 namespace arrow::compute::internal {
@@ -64,6 +71,31 @@ struct CumulativeOptionsWrapper : public OptionsWrapper<OptionsType> {
   }
 };
 
+// The op used to combine partial results in parallel scans.  Overflow is only
+// checked when computing the final results.
+template <typename Op>
+struct UncheckedOp {
+  using type = Op;
+};
+
+template <>
+struct UncheckedOp<AddChecked> {
+  using type = Add;
+};
+
+template <>
+struct UncheckedOp<MultiplyChecked> {
+  using type = Multiply;
+};
+
+// Cumulative states provide the following to be scanned in parallel, in addition
+// to Call():
+// - kCanScanInParallel: whether partial results can be combined in any grouping
+//   without changing the final results
+// - FromValue(): the partial result of a single value
+// - Reduce(): fold a value into a partial result
+// - Merge(): fold a partial result into the state
+
 // The cumulative value is computed based on a simple arithmetic binary op
 // such as Add, Mul, Min, Max, etc.
 template <typename Op, typename ArgType>
@@ -72,6 +104,12 @@ struct CumulativeBinaryOp {
   using OutValue = typename GetOutputType<OutType>::T;
   using ArgValue = typename GetViewType<ArgType>::T;
 
+  // Integer arithmetic wraps around, so it is associative, unlike floating-point
+  // arithmetic which would round differently
+  static constexpr bool kCanScanInParallel = is_integer_type<ArgType>::value ||
+                                             std::is_same_v<Op, Min> ||
+                                             std::is_same_v<Op, Max>;
+
   OutValue current_value;
 
   CumulativeBinaryOp() { current_value = Identity<Op>::template value<OutValue>(); }
@@ -80,11 +118,27 @@ struct CumulativeBinaryOp {
     current_value = UnboxScalar<OutType>::Unbox(*start);
   }
 
+  static CumulativeBinaryOp FromValue(ArgValue arg) {
+    CumulativeBinaryOp state;
+    state.current_value = arg;
+    return state;
+  }
+
   OutValue Call(KernelContext* ctx, ArgValue arg, Status* st) {
     current_value =
         Op::template Call<OutValue, ArgValue, ArgValue>(ctx, arg, current_value, st);
     return current_value;
   }
+
+  void Reduce(KernelContext* ctx, ArgValue arg) {
+    Status st;
+    current_value = UncheckedOp<Op>::type::template Call<OutValue, ArgValue, ArgValue>(
+        ctx, arg, current_value, &st);
+  }
+
+  void Merge(KernelContext* ctx, const CumulativeBinaryOp& partial) {
+    Reduce(ctx, partial.current_value);
+  }
 };
 
 template <typename ArgType>
@@ -96,14 +150,34 @@ struct CumulativeMean {
 
   CumulativeMean() = default;
 
+  // Sums of integers are exact as long as they fit in a double's mantissa
+  static constexpr bool kCanScanInParallel = is_integer_type<ArgType>::value;
+
   // start value is ignored for CumulativeMean
   explicit CumulativeMean(const std::shared_ptr<Scalar> start) {}
 
+  static CumulativeMean FromValue(ArgValue arg) {
+    CumulativeMean state;
+    state.sum = static_cast<double>(arg);
+    state.count = 1;
+    return state;
+  }
+
   double Call(KernelContext* ctx, ArgValue arg, Status* st) {
     sum += static_cast<double>(arg);
     ++count;
     return sum / count;
   }
+
+  void Reduce(KernelContext*, ArgValue arg) {
+    sum += static_cast<double>(arg);
+    ++count;
+  }
+
+  void Merge(KernelContext*, const CumulativeMean& partial) {
+    sum += partial.sum;
+    count += partial.count;
+  }
 };
 
 // The driver kernel for all cumulative compute functions.
@@ -151,6 +225,172 @@ struct Accumulator {
   }
 };
 
+// Minimum number of values for scanning an input in parallel
+constexpr int64_t kMinParallelScanLength = 1 << 16;
+
+// Minimum number of values scanned by each task of a parallel scan
+constexpr int64_t kMinParallelScanTaskLength = 1 << 14;
+
+// A two-pass parallel scan.  The input is split into tasks of consecutive values,
+// regardless of chunk boundaries.  The tasks first compute their partial results
+// concurrently, which are combined serially into the state at the start of each
+// task.  The tasks then compute their final results concurrently from that state.
+template <typename ArgType, typename CumulativeState>
+struct ParallelCumulativeScan {
+  using OutType = typename CumulativeState::OutType;
+  using OutValue = typename GetOutputType<OutType>::T;
+  using ArgValue = typename GetViewType<ArgType>::T;
+
+  struct Task {
+    std::vector<ArraySpan> pieces;
+    int64_t out_offset = 0;
+    int64_t length = 0;
+    // The partial result of the task's valid values, before its first null unless
+    // nulls are skipped
+    std::optional<CumulativeState> partial;
+    // The index of the task's first null if nulls are not skipped, or -1
+    int64_t first_null = -1;
+    CumulativeState start_state;
+  };
+
+  static Result<std::shared_ptr<ArrayData>> Scan(KernelContext* ctx,
+                                                 ::arrow::internal::Executor* executor,
+                                                 const std::vector<ArraySpan>& inputs,
+                                                 int64_t length,
+                                                 CumulativeState initial_state,
+                                                 bool skip_nulls) {
+    const int64_t task_length = std::max(
+        kMinParallelScanTaskLength,
+        bit_util::CeilDiv(length, 4 * static_cast<int64_t>(executor->GetCapacity())));
+    std::vector<Task> tasks(1);
+    for (const ArraySpan& input : inputs) {
+      for (int64_t offset = 0; offset < input.length;) {
+        if (tasks.back().length == task_length) {
+          const int64_t out_offset = tasks.back().out_offset + task_length;
+          tasks.emplace_back().out_offset = out_offset;
+        }
+        Task& task = tasks.back();
+        const int64_t piece_length =
+            std::min(input.length - offset, task_length - task.length);
+        ArraySpan piece = input;
+        piece.SetSlice(input.offset + offset, piece_length);
+        task.pieces.push_back(std::move(piece));
+        task.length += piece_length;
+        offset += piece_length;
+      }
+    }
+    const int num_tasks = static_cast<int>(tasks.size());
+
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(
+        num_tasks,
+        [&](int i) {
+          Task& task = tasks[i];
+          int64_t index = 0;
+          for (const ArraySpan& piece : task.pieces) {
+            if (task.first_null >= 0) {
+              break;
+            }
+            VisitArrayValuesInline<ArgType>(
+                piece,
+                [&](ArgValue v) {
+                  if (task.first_null < 0) {
+                    if (task.partial.has_value()) {
+                      task.partial->Reduce(ctx, v);
+                    } else {
+                      task.partial = CumulativeState::FromValue(v);
+                    }
+                  }
+                  ++index;
+                },
+                [&]() {
+                  if (!skip_nulls && task.first_null < 0) {
+                    task.first_null = index;
+                  }
+                  ++index;
+                });
+          }
+          return Status::OK();
+        },
+        executor));
+
+    // Values after the first null are null, unless nulls are skipped
+    CumulativeState state = std::move(initial_state);
+    int64_t first_null = -1;
+    for (Task& task : tasks) {
+      task.start_state = state;
+      if (first_null >= 0) {
+        continue;
+      }
+      if (task.partial.has_value()) {
+        state.Merge(ctx, *task.partial);
+      }
+      if (task.first_null >= 0) {
+        first_null = task.out_offset + task.first_null;
+      }
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto values, AllocateBuffer(length * sizeof(OutValue),
+                                                      ctx->memory_pool()));
+    auto out_values = values->mutable_data_as<OutValue>();
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(
+        num_tasks,
+        [&](int i) {
+          const Task& task = tasks[i];
+          OutValue* out = out_values + task.out_offset;
+          const int64_t num_non_null =
+              first_null < 0
+                  ? task.length
+                  : std::clamp<int64_t>(first_null - task.out_offset, 0, task.length);
+          CumulativeState state = task.start_state;
+          Status st;
+          int64_t index = 0;
+          for (const ArraySpan& piece : task.pieces) {
+            if (index == num_non_null) {
+              break;
+            }
+            ArraySpan valid_piece = piece;
+            valid_piece.SetSlice(piece.offset,
+                                 std::min(piece.length, num_non_null - index));
+            VisitArrayValuesInline<ArgType>(
+                valid_piece, [&](ArgValue v) { out[index++] = state.Call(ctx, v, &st); },
+                [&]() { out[index++] = OutValue{}; });
+          }
+          std::fill(out + num_non_null, out + task.length, OutValue{});
+          return st;
+        },
+        executor));
+
+    std::shared_ptr<Buffer> validity;
+    int64_t null_count = 0;
+    if (skip_nulls) {
+      for (const ArraySpan& input : inputs) {
+        null_count += input.GetNullCount();
+      }
+      if (null_count > 0) {
+        ARROW_ASSIGN_OR_RAISE(validity, AllocateBitmap(length, ctx->memory_pool()));
+        int64_t offset = 0;
+        for (const ArraySpan& input : inputs) {
+          if (input.MayHaveNulls()) {
+            ::arrow::internal::CopyBitmap(input.buffers[0].data, input.offset,
+                                          input.length, validity->mutable_data(),
+                                          offset);
+          } else {
+            bit_util::SetBitsTo(validity->mutable_data(), offset, input.length, true);
+          }
+          offset += input.length;
+        }
+      }
+    } else if (first_null >= 0) {
+      null_count = length - first_null;
+      ARROW_ASSIGN_OR_RAISE(validity, AllocateBitmap(length, ctx->memory_pool()));
+      bit_util::SetBitsTo(validity->mutable_data(), 0, first_null, true);
+      bit_util::SetBitsTo(validity->mutable_data(), first_null, null_count, false);
+    }
+    return ArrayData::Make(TypeTraits<OutType>::type_singleton(), length,
+                           {std::move(validity), std::move(values)}, null_count);
+  }
+};
+
 template <typename ArgType, typename CumulativeState, typename OptionsType>
 struct CumulativeKernel {
   using OutType = typename CumulativeState::OutType;
@@ -165,6 +405,18 @@ struct CumulativeKernel {
     }
     accumulator.skip_nulls = options.skip_nulls;
 
+    if constexpr (CumulativeState::kCanScanInParallel) {
+      if (auto executor =
+              GetParallelExecutor(ctx, batch.length, kMinParallelScanLength)) {
+        ARROW_ASSIGN_OR_RAISE(
+            out->value,
+            (ParallelCumulativeScan<ArgType, CumulativeState>::Scan(
+                ctx, executor, {batch[0].array}, batch.length,
+                std::move(accumulator.current_state), options.skip_nulls)));
+        return Status::OK();
+      }
+    }
+
     RETURN_NOT_OK(accumulator.builder.Reserve(batch.length));
     RETURN_NOT_OK(accumulator.Accumulate(batch[0].array));
 
@@ -190,6 +442,23 @@ struct CumulativeKernelChunked {
     accumulator.skip_nulls = options.skip_nulls;
 
     const ChunkedArray& chunked_input = *batch[0].chunked_array();
+    if constexpr (CumulativeState::kCanScanInParallel) {
+      if (auto executor = GetParallelExecutor(ctx, chunked_input.length(),
+                                              kMinParallelScanLength)) {
+        std::vector<ArraySpan> inputs;
+        inputs.reserve(chunked_input.num_chunks());
+        for (const auto& chunk : chunked_input.chunks()) {
+          inputs.emplace_back(*chunk->data());
+        }
+        std::shared_ptr<ArrayData> result;
+        ARROW_ASSIGN_OR_RAISE(
+            result, (ParallelCumulativeScan<ArgType, CumulativeState>::Scan(
+                        ctx, executor, inputs, chunked_input.length(),
+                        std::move(accumulator.current_state), options.skip_nulls)));
+        out->value = std::move(result);
+        return Status::OK();
+      }
+    }
     RETURN_NOT_OK(accumulator.builder.Reserve(chunked_input.length()));
     std::vector<std::shared_ptr<Array>> out_chunks;
     for (const auto& chunk : chunked_input.chunks()) {
@@ -26,6 +26,7 @@
 #include "arrow/compute/api_vector.h"
 #include "arrow/scalar.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 
@@ -33,6 +34,7 @@
 #include "arrow/compute/api.h"
 #include "arrow/compute/kernels/test_util_internal.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace compute {
@@ -949,5 +951,78 @@ TEST(TestCumulative, NaN) {
   CheckVectorUnary("cumulative_mean", ArrayFromJSON(float64(), "[5, 4, NaN, 2, 1]"),
                    ArrayFromJSON(float64(), "[5, 4.5, NaN, NaN, NaN]"));
 }
+
+TEST(TestCumulative, ParallelScan) {
+  // Inputs large enough to be scanned in parallel, in chunks of uneven sizes
+  const int64_t length = 300000;
+  auto rng = random::RandomArrayGenerator(0x3c9a12f4);
+  auto slice_into_chunks = [](const std::shared_ptr<Array>& array) {
+    ArrayVector chunks;
+    for (int64_t offset = 0, chunk_size = 1; offset < array->length();
+         offset += chunk_size, chunk_size = (chunk_size * 7 + 3) % 70000) {
+      chunks.push_back(array->Slice(offset, chunk_size));
+    }
+    return std::make_shared<ChunkedArray>(std::move(chunks));
+  };
+
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, ::arrow::internal::ThreadPool::Make(4));
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+  ExecContext parallel_ctx(default_memory_pool(), thread_pool.get());
+
+  auto check = [&](const std::string& func_name, const Datum& input,
+                   const CumulativeOptions& options) {
+    ARROW_SCOPED_TRACE(func_name, " ", input.type()->ToString(), " ",
+                       options.ToString());
+    auto expected = CallFunction(func_name, {input}, &options, &serial_ctx);
+    auto actual = CallFunction(func_name, {input}, &options, &parallel_ctx);
+    if (!expected.ok()) {
+      ASSERT_RAISES(Invalid, actual);
+      return;
+    }
+    ASSERT_OK(actual);
+    ValidateOutput(*actual);
+    AssertDatumsEqual(*expected, *actual, /*verbose=*/true);
+  };
+
+  for (double null_probability : {0.0, 0.0001, 0.1}) {
+    const std::vector<std::shared_ptr<Array>> arrays = {
+        rng.Int8(length, -1, 1, null_probability),
+        rng.Int32(length, -100, 100, null_probability),
+        rng.Int64(length, -1000000, 1000000, null_probability),
+        rng.UInt16(length, 0, 3, null_probability),
+        rng.Float64(length, -10, 10, null_probability),
+    };
+    for (const auto& array : arrays) {
+      for (const auto& func_name : kCumulativeFunctionNames) {
+        for (bool skip_nulls : {false, true}) {
+          for (const auto& options :
+               {CumulativeOptions(skip_nulls), CumulativeOptions(2.0, skip_nulls)}) {
+            check(func_name, array, options);
+            check(func_name, slice_into_chunks(array), options);
+          }
+        }
+      }
+    }
+  }
+
+  // Overflow is checked on the running sums, not on the partial sums of the tasks
+  Int8Builder builder;
+  for (int64_t i = 0; i < length; ++i) {
+    ASSERT_OK(builder.Append(i % 2 == 0 ? 1 : -1));
+  }
+  ASSERT_OK_AND_ASSIGN(auto neutral, builder.Finish());
+  auto input = std::make_shared<ChunkedArray>(
+      ArrayVector{neutral, ArrayFromJSON(int8(), "[100, 100]"), neutral});
+  const CumulativeOptions negative_start(-100.0);
+  ASSERT_OK(CallFunction("cumulative_sum_checked", {input}, &negative_start,
+                         &parallel_ctx));
+  ASSERT_RAISES(Invalid, CallFunction("cumulative_sum_checked", {input},
+                                      /*options=*/nullptr, &parallel_ctx));
+  for (const auto& options : {CumulativeOptions(), negative_start}) {
+    check("cumulative_sum_checked", input, options);
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
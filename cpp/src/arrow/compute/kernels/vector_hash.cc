@@ -36,6 +36,7 @@
 #include "arrow/util/hashing.h"
 #include "arrow/util/int_util.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/unreachable.h"
 
 namespace arrow {
@@ -93,6 +94,10 @@ class UniqueAction final : public ActionBase {
   Status Flush(ExecResult* out) { return Status::OK(); }
 
   Status FlushFinal(ExecResult* out) { return Status::OK(); }
+
+  Status Merge(const UniqueAction& other, const std::vector<int32_t>& memo_indices) {
+    return Status::OK();
+  }
 };
 
 // ----------------------------------------------------------------------
@@ -163,6 +168,22 @@ class ValueCountsAction final : ActionBase {
 
   bool ShouldEncodeNulls() const { return true; }
 
+  // Add the counts of another action, whose memo indices map to `memo_indices`
+  Status Merge(const ValueCountsAction& other,
+               const std::vector<int32_t>& memo_indices) {
+    for (size_t i = 0; i < memo_indices.size(); ++i) {
+      const int64_t count = other.count_builder_.GetValue(static_cast<int64_t>(i));
+      if (memo_indices[i] < count_builder_.length()) {
+        count_builder_[memo_indices[i]] += count;
+      } else {
+        // New values are inserted in order at the end of the memo table
+        DCHECK_EQ(memo_indices[i], count_builder_.length());
+        RETURN_NOT_OK(count_builder_.Append(count));
+      }
+    }
+    return Status::OK();
+  }
+
  private:
   Int64Builder count_builder_;
 };
@@ -228,6 +249,11 @@ class DictEncodeAction final : public ActionBase {
 
   Status FlushFinal(ExecResult* out) { return Status::OK(); }
 
+  // The indices already output are transposed by the caller
+  Status Merge(const DictEncodeAction& other, const std::vector<int32_t>& memo_indices) {
+    return Status::OK();
+  }
+
  private:
   Int32Builder indices_builder_;
   DictionaryEncodeOptions encode_options_;
@@ -260,6 +286,19 @@ class HashKernel : public KernelState {
   // data structures) and visit the given input with Action.
   virtual Status Append(const ArraySpan& arr) = 0;
 
+  // Make a kernel of the same kind with an empty memo table, to hash part of the
+  // input in parallel, or return null if the kernel doesn't support it.
+  virtual Result<std::unique_ptr<HashKernel>> MakePartial() const {
+    return std::unique_ptr<HashKernel>();
+  }
+
+  // Insert the values of a kernel made by MakePartial() into this kernel's memo
+  // table, in their order of insertion there, and merge its results.  Outputs the
+  // index in this memo table of each value of the partial one.
+  virtual Status Merge(HashKernel* partial, std::vector<int32_t>* memo_indices) {
+    return Status::NotImplemented("Merging hash kernels");
+  }
+
  protected:
   const FunctionOptions* options_;
   std::mutex lock_;
@@ -299,6 +338,33 @@ class RegularHashKernel : public HashKernel {
 
   std::shared_ptr<DataType> value_type() const override { return type_; }
 
+  Result<std::unique_ptr<HashKernel>> MakePartial() const override {
+    auto partial = std::make_unique<RegularHashKernel>(type_, options_, pool_);
+    RETURN_NOT_OK(partial->Reset());
+    return std::unique_ptr<HashKernel>(std::move(partial));
+  }
+
+  Status Merge(HashKernel* partial, std::vector<int32_t>* memo_indices) override {
+    auto other = checked_cast<RegularHashKernel*>(partial);
+    std::shared_ptr<ArrayData> values;
+    RETURN_NOT_OK(other->GetDictionary(&values));
+    memo_indices->clear();
+    memo_indices->reserve(values->length);
+    RETURN_NOT_OK(VisitArraySpanInline<Type>(
+        ArraySpan(*values),
+        [&](Scalar v) {
+          int32_t memo_index;
+          RETURN_NOT_OK(memo_table_->GetOrInsert(v, &memo_index));
+          memo_indices->push_back(memo_index);
+          return Status::OK();
+        },
+        [&]() {
+          memo_indices->push_back(memo_table_->GetOrInsertNull());
+          return Status::OK();
+        }));
+    return action_.Merge(other->action_, *memo_indices);
+  }
+
   template <bool HasError = with_error_status>
   enable_if_t<!HasError, Status> DoAppend(const ArraySpan& arr) {
     return VisitArraySpanInline<Type>(
@@ -601,13 +667,202 @@ Result<std::unique_ptr<KernelState>> DictionaryHashInit(KernelContext* ctx,
       dict_type.value_type());
 }
 
+// Minimum number of values for hashing an input in parallel
+constexpr int64_t kMinParallelHashLength = 1 << 16;
+
+// Minimum number of values hashed by each task of a parallel hash
+constexpr int64_t kMinParallelHashTaskLength = 1 << 14;
+
+// Number of values hashed to decide whether to hash an input in parallel
+constexpr int64_t kParallelHashProbeLength = 1 << 14;
+
+// Hash inputs in parallel.  The inputs are split into tasks of consecutive values,
+// regardless of their boundaries, which are hashed concurrently by partial kernels.
+// The partial kernels are then merged in order into the kernel of the context,
+// whose memo table thus ends up identical to the one of a serial execution.
+//
+// Returns the output of each input (the dictionary_encode indices, transposed into
+// the merged memo table, or null for the other functions), or nothing if the
+// inputs should be hashed serially instead.
+Result<std::vector<std::shared_ptr<ArrayData>>> ParallelHash(
+    KernelContext* ctx, ::arrow::internal::Executor* executor,
+    const std::vector<ArraySpan>& inputs, int64_t length) {
+  auto hash_impl = checked_cast<HashKernel*>(ctx->state());
+
+  struct Piece {
+    size_t input;
+    ArraySpan values;
+    std::shared_ptr<ArrayData> out;
+  };
+  struct Task {
+    std::vector<Piece> pieces;
+    int64_t length = 0;
+    std::unique_ptr<HashKernel> partial;
+    std::vector<int32_t> memo_indices;
+  };
+
+  const int64_t task_length = std::max(
+      kMinParallelHashTaskLength,
+      bit_util::CeilDiv(length, 4 * static_cast<int64_t>(executor->GetCapacity())));
+  std::vector<Task> tasks(1);
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    const ArraySpan& input = inputs[i];
+    for (int64_t offset = 0; offset < input.length;) {
+      if (tasks.back().length == task_length) {
+        tasks.emplace_back();
+      }
+      Task& task = tasks.back();
+      const int64_t piece_length =
+          std::min(input.length - offset, task_length - task.length);
+      ArraySpan piece = input;
+      piece.SetSlice(input.offset + offset, piece_length);
+      task.pieces.push_back({i, std::move(piece), nullptr});
+      task.length += piece_length;
+      offset += piece_length;
+    }
+  }
+  const int num_tasks = static_cast<int>(tasks.size());
+
+  // The partial memo tables are merged serially, which only pays off if they are
+  // much smaller than the input.  Their size is estimated from the number of
+  // distinct values in a prefix of the input.
+  ARROW_ASSIGN_OR_RAISE(auto probe, hash_impl->MakePartial());
+  if (probe == nullptr) {
+    return std::vector<std::shared_ptr<ArrayData>>();
+  }
+  int64_t probe_length = 0;
+  for (const Piece& piece : tasks[0].pieces) {
+    ArraySpan values = piece.values;
+    values.SetSlice(values.offset, std::min(values.length,
+                                            kParallelHashProbeLength - probe_length));
+    RETURN_NOT_OK(probe->Append(values));
+    probe_length += values.length;
+    if (probe_length == kParallelHashProbeLength) {
+      break;
+    }
+  }
+  std::shared_ptr<ArrayData> probe_values;
+  RETURN_NOT_OK(probe->GetDictionary(&probe_values));
+  if (probe_values->length > probe_length / 4 ||
+      num_tasks * probe_values->length > length / 8) {
+    return std::vector<std::shared_ptr<ArrayData>>();
+  }
+
+  for (Task& task : tasks) {
+    ARROW_ASSIGN_OR_RAISE(task.partial, hash_impl->MakePartial());
+  }
+
+  RETURN_NOT_OK(::arrow::internal::ParallelFor(
+      num_tasks,
+      [&](int i) {
+        Task& task = tasks[i];
+        for (Piece& piece : task.pieces) {
+          RETURN_NOT_OK(task.partial->Append(piece.values));
+          ExecResult out;
+          RETURN_NOT_OK(task.partial->Flush(&out));
+          if (out.is_array_data()) {
+            piece.out = out.array_data();
+          }
+        }
+        return Status::OK();
+      },
+      executor));
+
+  for (Task& task : tasks) {
+    RETURN_NOT_OK(hash_impl->Merge(task.partial.get(), &task.memo_indices));
+  }
+  if (tasks[0].pieces.empty() || tasks[0].pieces[0].out == nullptr) {
+    return std::vector<std::shared_ptr<ArrayData>>(inputs.size());
+  }
+
+  // Transpose the indices output by each task into the merged memo table
+  RETURN_NOT_OK(::arrow::internal::ParallelFor(
+      num_tasks,
+      [&](int i) {
+        Task& task = tasks[i];
+        if (task.memo_indices.empty()) {
+          // All values are null and masked
+          return Status::OK();
+        }
+        for (Piece& piece : task.pieces) {
+          auto indices = piece.out->GetMutableValues<int32_t>(1);
+          TransposeInts(indices, indices, piece.out->length, task.memo_indices.data());
+        }
+        return Status::OK();
+      },
+      executor));
+
+  std::vector<ArrayVector> pieces_out(inputs.size());
+  for (Task& task : tasks) {
+    for (Piece& piece : task.pieces) {
+      pieces_out[piece.input].push_back(MakeArray(std::move(piece.out)));
+    }
+  }
+  std::vector<std::shared_ptr<ArrayData>> out(inputs.size());
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    if (pieces_out[i].size() == 1) {
+      out[i] = pieces_out[i][0]->data();
+    } else if (pieces_out[i].size() > 1) {
+      ARROW_ASSIGN_OR_RAISE(auto concatenated,
+                            Concatenate(pieces_out[i], ctx->memory_pool()));
+      out[i] = concatenated->data();
+    }
+  }
+  return out;
+}
+
 Status HashExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
   auto hash_impl = checked_cast<HashKernel*>(ctx->state());
+  if (auto executor = GetParallelExecutor(ctx, batch.length, kMinParallelHashLength)) {
+    ARROW_ASSIGN_OR_RAISE(auto outputs,
+                          ParallelHash(ctx, executor, {batch[0].array}, batch.length));
+    if (!outputs.empty()) {
+      if (outputs[0] != nullptr) {
+        out->value = std::move(outputs[0]);
+      }
+      return Status::OK();
+    }
+  }
   RETURN_NOT_OK(hash_impl->Append(ctx, batch[0].array));
   RETURN_NOT_OK(hash_impl->Flush(out));
   return Status::OK();
 }
 
+// Hash all the chunks of a chunked array at once, so that they can be hashed in
+// parallel regardless of their size
+Status HashExecChunked(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  auto hash_impl = checked_cast<HashKernel*>(ctx->state());
+  const ChunkedArray& input = *batch[0].chunked_array();
+  std::vector<std::shared_ptr<ArrayData>> outputs;
+  if (auto executor = GetParallelExecutor(ctx, input.length(), kMinParallelHashLength)) {
+    std::vector<ArraySpan> inputs;
+    inputs.reserve(input.num_chunks());
+    for (const auto& chunk : input.chunks()) {
+      inputs.emplace_back(*chunk->data());
+    }
+    ARROW_ASSIGN_OR_RAISE(outputs, ParallelHash(ctx, executor, inputs, input.length()));
+  }
+  if (outputs.empty()) {
+    for (const auto& chunk : input.chunks()) {
+      RETURN_NOT_OK(hash_impl->Append(ctx, *chunk->data()));
+      ExecResult chunk_out;
+      RETURN_NOT_OK(hash_impl->Flush(&chunk_out));
+      outputs.push_back(chunk_out.is_array_data() ? chunk_out.array_data() : nullptr);
+    }
+  }
+  if (static_cast<const VectorKernel*>(ctx->kernel())->output_chunked) {
+    // dictionary_encode outputs the indices of each chunk, see DictEncodeFinalize()
+    ArrayVector out_chunks;
+    for (auto& chunk_out : outputs) {
+      if (chunk_out != nullptr) {
+        out_chunks.push_back(MakeArray(std::move(chunk_out)));
+      }
+    }
+    *out = std::make_shared<ChunkedArray>(std::move(out_chunks), int32());
+  }
+  return Status::OK();
+}
+
 Status UniqueFinalize(KernelContext* ctx, std::vector<Datum>* out) {
   auto hash_impl = checked_cast<HashKernel*>(ctx->state());
   std::shared_ptr<ArrayData> uniques;
@@ -695,6 +950,8 @@ Result<TypeHolder> ValueCountsOutput(KernelContext*,
 
 template <typename Action>
 void AddHashKernels(VectorFunction* func, VectorKernel base, OutputType out_ty) {
+  base.can_execute_chunkwise = false;
+  base.exec_chunked = HashExecChunked;
   for (const auto& ty : PrimitiveTypes()) {
     base.init = GetHashInit<Action>(ty->id());
     base.signature = KernelSignature::Make({ty}, out_ty);
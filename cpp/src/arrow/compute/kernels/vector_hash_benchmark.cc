@@ -17,6 +17,8 @@
 
 #include "benchmark/benchmark.h"
 
+#include <algorithm>
+#include <string>
 #include <vector>
 
 #include "arrow/array/builder_binary.h"
@@ -26,6 +28,7 @@
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 #include "arrow/compute/api.h"
 
@@ -226,6 +229,52 @@ static void ValueCountsDictionaryChunks(benchmark::State& state) {
       state, HashParams<StringType>{general_bench_cases[state.range(0)], 10});
 }
 
+// Hash a chunked array of 64 chunks, either serially or on a thread pool
+// of state.range(1) threads
+template <typename ParamType>
+void BenchChunkedHash(benchmark::State& state, const std::string& func_name,
+                      const ParamType& params) {
+  std::shared_ptr<Array> arr;
+  params.GenerateTestData(&arr);
+  std::vector<std::shared_ptr<Array>> chunks;
+  const int64_t chunk_size = arr->length() / 64;
+  for (int64_t i = 0; i < 64; ++i) {
+    chunks.push_back(arr->Slice(i * chunk_size, chunk_size));
+  }
+  const Datum chunked_array = std::make_shared<ChunkedArray>(chunks);
+
+  const int num_threads = static_cast<int>(state.range(1));
+  auto thread_pool = *::arrow::internal::ThreadPool::Make(std::max(num_threads, 1));
+  ExecContext ctx(default_memory_pool(), thread_pool.get());
+  ctx.set_use_threads(num_threads > 0);
+
+  while (state.KeepRunning()) {
+    ABORT_NOT_OK(CallFunction(func_name, {chunked_array}, &ctx));
+  }
+  state.counters["threads"] = num_threads;
+  params.SetMetadata(state);
+}
+
+static void UniqueInt64Chunked(benchmark::State& state) {
+  BenchChunkedHash(state, "unique",
+                   HashParams<Int64Type>{general_bench_cases[state.range(0)]});
+}
+
+static void ValueCountsInt64Chunked(benchmark::State& state) {
+  BenchChunkedHash(state, "value_counts",
+                   HashParams<Int64Type>{general_bench_cases[state.range(0)]});
+}
+
+static void DictionaryEncodeInt64Chunked(benchmark::State& state) {
+  BenchChunkedHash(state, "dictionary_encode",
+                   HashParams<Int64Type>{general_bench_cases[state.range(0)]});
+}
+
+static void UniqueString10bytesChunked(benchmark::State& state) {
+  BenchChunkedHash(state, "unique",
+                   HashParams<StringType>{general_bench_cases[state.range(0)], 10});
+}
+
 void HashSetArgs(benchmark::internal::Benchmark* bench) {
   for (int i = 0; i < static_cast<int>(general_bench_cases.size()); ++i) {
     bench->Arg(i);
@@ -239,6 +288,21 @@ BENCHMARK(UniqueInt64)->Apply(HashSetArgs);
 BENCHMARK(UniqueString10bytes)->Apply(HashSetArgs);
 BENCHMARK(UniqueString100bytes)->Apply(HashSetArgs);
 
+void ChunkedHashSetArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"case", "threads"});
+  // Low cardinality without and with nulls, and high cardinality
+  for (int i : {0, 3, 7}) {
+    for (int64_t num_threads : {0, 1, 4, 8}) {
+      bench->Args({i, num_threads});
+    }
+  }
+}
+
+BENCHMARK(UniqueInt64Chunked)->Apply(ChunkedHashSetArgs)->UseRealTime();
+BENCHMARK(ValueCountsInt64Chunked)->Apply(ChunkedHashSetArgs)->UseRealTime();
+BENCHMARK(DictionaryEncodeInt64Chunked)->Apply(ChunkedHashSetArgs)->UseRealTime();
+BENCHMARK(UniqueString10bytesChunked)->Apply(ChunkedHashSetArgs)->UseRealTime();
+
 void DictionaryChunksHashSetArgs(benchmark::internal::Benchmark* bench) {
   for (int i = 0; i < static_cast<int>(general_bench_cases.size()); ++i) {
     bench->Arg(i);
@@ -33,12 +33,14 @@
 #include "arrow/buffer.h"
 #include "arrow/chunked_array.h"
 #include "arrow/status.h"
+#include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/thread_pool.h"
 
 #include "arrow/compute/api.h"
 #include "arrow/compute/kernels/test_util_internal.h"
@@ -877,5 +879,47 @@ TEST_F(TestHashKernel, ChunkedArrayZeroChunk) {
                      *result_datum.chunked_array());
 }
 
+TEST_F(TestHashKernel, ParallelChunkedArray) {
+  // Large inputs are hashed in parallel; the results must match serial execution
+  random::RandomArrayGenerator rng(42);
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, ::arrow::internal::ThreadPool::Make(4));
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+  ExecContext parallel_ctx(default_memory_pool(), thread_pool.get());
+
+  auto encode_nulls = DictionaryEncodeOptions::Defaults();
+  encode_nulls.null_encoding_behavior = DictionaryEncodeOptions::ENCODE;
+
+  for (double null_probability : {0.0, 0.1, 1.0}) {
+    ArrayVector chunks;
+    for (int64_t length : {70000, 0, 12345, 100000, 1, 30000}) {
+      chunks.push_back(rng.Int64(length, 0, 500, null_probability));
+    }
+    const Datum chunked = std::make_shared<ChunkedArray>(chunks, int64());
+    const Datum sliced = chunks[3]->Slice(17, 90000);
+
+    for (const Datum& input : {chunked, sliced}) {
+      ARROW_SCOPED_TRACE("null_probability = ", null_probability,
+                         ", kind = ", input.kind());
+      for (const std::string func_name : {"unique", "value_counts"}) {
+        ASSERT_OK_AND_ASSIGN(Datum expected,
+                             CallFunction(func_name, {input}, &serial_ctx));
+        ASSERT_OK_AND_ASSIGN(Datum actual,
+                             CallFunction(func_name, {input}, &parallel_ctx));
+        ValidateOutput(actual);
+        AssertDatumsEqual(expected, actual, /*verbose=*/true);
+      }
+      for (const auto& options : {DictionaryEncodeOptions::Defaults(), encode_nulls}) {
+        ASSERT_OK_AND_ASSIGN(Datum expected,
+                             DictionaryEncode(input, options, &serial_ctx));
+        ASSERT_OK_AND_ASSIGN(Datum actual,
+                             DictionaryEncode(input, options, &parallel_ctx));
+        ValidateOutput(actual);
+        AssertDatumsEqual(expected, actual, /*verbose=*/true);
+      }
+    }
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
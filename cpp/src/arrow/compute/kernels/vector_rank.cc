@@ -17,13 +17,16 @@
 
 #include <functional>
 #include <memory>
+#include <optional>
 
 #include "arrow/compute/function.h"
+#include "arrow/compute/kernels/codegen_internal.h"
 #include "arrow/compute/kernels/vector_sort_internal.h"
 #include "arrow/compute/registry.h"
 #include "arrow/compute/registry_internal.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/math_internal.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow::compute::internal {
 
@@ -65,6 +68,33 @@ void MarkDuplicates(const NullPartitionResult& sorted, ValueSelector&& value_sel
   }
 }
 
+// Minimum number of values for sorting an array to rank in parallel slices
+constexpr int64_t kMinParallelRankLength = 1 << 16;
+
+// Sort a large array as a chunked array of slices, which are sorted and merged
+// in parallel, or return null if the array should be sorted serially
+Result<std::optional<NullPartitionResult>> SortArrayInSlices(
+    ExecContext* ctx, uint64_t* indices_begin, uint64_t* indices_end, const Array& input,
+    const std::shared_ptr<DataType>& physical_type, const SortOrder order,
+    const NullPlacement null_placement) {
+  const int64_t length = input.length();
+  auto executor = GetParallelExecutor(ctx, length, kMinParallelRankLength);
+  if (executor == nullptr) {
+    return std::nullopt;
+  }
+  const int64_t num_slices =
+      std::min<int64_t>(executor->GetCapacity(), length / (kMinParallelRankLength / 2));
+  const auto physical_array = GetPhysicalArray(input, physical_type);
+  ArrayVector slices;
+  for (int64_t i = 0; i < num_slices; ++i) {
+    const int64_t begin = length * i / num_slices;
+    const int64_t end = length * (i + 1) / num_slices;
+    slices.push_back(physical_array->Slice(begin, end - begin));
+  }
+  return SortChunkedArray(ctx, indices_begin, indices_end, physical_type, slices, order,
+                          null_placement);
+}
+
 template <typename ArrowType>
 Result<NullPartitionResult> DoSortAndMarkDuplicate(
     ExecContext* ctx, uint64_t* indices_begin, uint64_t* indices_end, const Array& input,
@@ -73,12 +103,19 @@ Result<NullPartitionResult> DoSortAndMarkDuplicate(
   using GetView = GetViewType<ArrowType>;
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
 
-  ARROW_ASSIGN_OR_RAISE(auto array_sorter, GetArraySorter(*physical_type));
-
   ArrayType array(input.data());
-  ARROW_ASSIGN_OR_RAISE(auto sorted,
-                        array_sorter(indices_begin, indices_end, array, 0,
-                                     ArraySortOptions(order, null_placement), ctx));
+  ARROW_ASSIGN_OR_RAISE(auto maybe_sorted,
+                        SortArrayInSlices(ctx, indices_begin, indices_end, input,
+                                          physical_type, order, null_placement));
+  NullPartitionResult sorted;
+  if (maybe_sorted.has_value()) {
+    sorted = *maybe_sorted;
+  } else {
+    ARROW_ASSIGN_OR_RAISE(auto array_sorter, GetArraySorter(*physical_type));
+    ARROW_ASSIGN_OR_RAISE(sorted,
+                          array_sorter(indices_begin, indices_end, array, 0,
+                                       ArraySortOptions(order, null_placement), ctx));
+  }
 
   if (needs_duplicates) {
     auto value_selector = [&array](int64_t index) {
@@ -18,10 +18,13 @@
 #include <queue>
 
 #include "arrow/compute/function.h"
+#include "arrow/compute/kernels/codegen_internal.h"
 #include "arrow/compute/kernels/vector_sort_internal.h"
 #include "arrow/compute/registry.h"
 #include "arrow/compute/registry_internal.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -49,6 +52,47 @@ const FunctionDoc select_k_unstable_doc(
      "greater than any other non-null value, but smaller than null values."),
     {"input"}, "SelectKOptions", /*options_required=*/true);
 
+// Minimum number of rows for selecting from a chunked array or table in parallel
+constexpr int64_t kMinParallelSelectKLength = 1 << 16;
+
+// Return the number of tasks to select the first `k` of `length` rows with, and
+// set `*executor` to the executor to run them on (null if there is a single task).
+//
+// Each task selects up to `k` candidates, which are then merged serially, so the
+// input is only split as long as the candidates are a small part of it.
+int GetSelectKTasks(ExecContext* ctx, int64_t length, int64_t k, int64_t max_tasks,
+                    ::arrow::internal::Executor** executor) {
+  *executor = GetParallelExecutor(ctx, length, kMinParallelSelectKLength);
+  if (*executor == nullptr) {
+    return 1;
+  }
+  const int64_t num_tasks =
+      std::min({max_tasks, static_cast<int64_t>((*executor)->GetCapacity()),
+                length / (4 * std::max<int64_t>(k, 1))});
+  if (num_tasks < 2) {
+    *executor = nullptr;
+    return 1;
+  }
+  return static_cast<int>(num_tasks);
+}
+
+// Merge the heaps of first `k` elements selected by each task into the first one
+template <typename HeapContainer, typename Compare>
+void MergeHeaps(int64_t k, Compare&& cmp, std::vector<HeapContainer>* heaps) {
+  auto& heap = heaps->front();
+  for (size_t i = 1; i < heaps->size(); ++i) {
+    for (auto& partial_heap = (*heaps)[i]; !partial_heap.empty(); partial_heap.pop()) {
+      const auto& item = partial_heap.top();
+      if (heap.size() < static_cast<size_t>(k)) {
+        heap.push(item);
+      } else if (!heap.empty() && cmp(item, heap.top())) {
+        heap.pop();
+        heap.push(item);
+      }
+    }
+  }
+}
+
 template <SortOrder order>
 class SelectKComparator {
  public:
@@ -216,14 +260,17 @@ class ChunkedArraySelector : public TypeVisitor {
     using HeapContainer =
         std::priority_queue<HeapItem, std::vector<HeapItem>, decltype(cmp)>;
 
-    HeapContainer heap(cmp);
     std::vector<std::shared_ptr<ArrayType>> chunks_holder;
+    std::vector<uint64_t> chunk_offsets;
     uint64_t offset = 0;
     for (const auto& chunk : physical_chunks_) {
       if (chunk->length() == 0) continue;
       chunks_holder.emplace_back(std::make_shared<ArrayType>(chunk->data()));
-      ArrayType& arr = *chunks_holder[chunks_holder.size() - 1];
+      chunk_offsets.push_back(offset);
+      offset += chunk->length();
+    }
 
+    auto select_chunk = [&](ArrayType& arr, uint64_t chunk_offset, HeapContainer& heap) {
       std::vector<uint64_t> indices(arr.length());
       uint64_t* indices_begin = indices.data();
       uint64_t* indices_end = indices_begin + indices.size();
@@ -236,7 +283,7 @@ class ChunkedArraySelector : public TypeVisitor {
       auto kth_begin = std::min(indices_begin + k_, end_iter);
       uint64_t* iter = indices_begin;
       for (; iter != kth_begin && heap.size() < static_cast<size_t>(k_); ++iter) {
-        heap.push(HeapItem{*iter, offset, &arr});
+        heap.push(HeapItem{*iter, chunk_offset, &arr});
       }
       for (; iter != end_iter && !heap.empty(); ++iter) {
         uint64_t x_index = *iter;
@@ -246,11 +293,36 @@ class ChunkedArraySelector : public TypeVisitor {
             GetView::LogicalValue(top_item.array->GetView(top_item.index));
         if (comparator(xval, top_value)) {
           heap.pop();
-          heap.push(HeapItem{x_index, offset, &arr});
+          heap.push(HeapItem{x_index, chunk_offset, &arr});
         }
       }
-      offset += chunk->length();
+    };
+
+    // Each task selects from a run of consecutive chunks of about the same
+    // total length into its own heap, the heaps are merged at the end
+    const auto num_nonempty_chunks = static_cast<int64_t>(chunks_holder.size());
+    ::arrow::internal::Executor* executor;
+    const int num_tasks = GetSelectKTasks(ctx_, chunked_array_.length(), k_,
+                                          num_nonempty_chunks, &executor);
+    std::vector<int64_t> task_chunks(num_tasks + 1, num_nonempty_chunks);
+    task_chunks[0] = 0;
+    for (int64_t i = 0, task = 1; i < num_nonempty_chunks && task < num_tasks; ++i) {
+      if (chunk_offsets[i] * num_tasks >= task * offset) {
+        task_chunks[task++] = i;
+      }
     }
+    std::vector<HeapContainer> heaps(num_tasks, HeapContainer(cmp));
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        executor != nullptr, num_tasks,
+        [&](int task) {
+          for (int64_t i = task_chunks[task]; i < task_chunks[task + 1]; ++i) {
+            select_chunk(*chunks_holder[i], chunk_offsets[i], heaps[task]);
+          }
+          return Status::OK();
+        },
+        executor));
+    MergeHeaps(k_, cmp, &heaps);
+    auto& heap = heaps.front();
 
     auto out_size = static_cast<int64_t>(heap.size());
     ARROW_ASSIGN_OR_RAISE(auto take_indices,
@@ -524,20 +596,52 @@ class TableSelector : public TypeVisitor {
     uint64_t* indices_end = indices_begin + indices.size();
     std::iota(indices_begin, indices_end, 0);
 
-    const auto p =
-        this->PartitionNullsInternal<InType>(indices_begin, indices_end, first_sort_key);
-    const auto end_iter = p.non_nulls_end;
-    auto kth_begin = std::min(indices_begin + k_, end_iter);
-
-    HeapContainer heap(indices_begin, kth_begin, cmp);
-    for (auto iter = kth_begin; iter != end_iter && !heap.empty(); ++iter) {
-      uint64_t x_index = *iter;
-      uint64_t top_item = heap.top();
-      if (cmp(x_index, top_item)) {
-        heap.pop();
-        heap.push(x_index);
+    auto select_rows = [&](uint64_t* rows_begin, uint64_t* rows_end,
+                           HeapContainer& heap) {
+      auto kth_begin = std::min(rows_begin + k_, rows_end);
+      for (auto iter = rows_begin; iter != kth_begin; ++iter) {
+        heap.push(*iter);
+      }
+      for (auto iter = kth_begin; iter != rows_end && !heap.empty(); ++iter) {
+        uint64_t x_index = *iter;
+        uint64_t top_item = heap.top();
+        if (cmp(x_index, top_item)) {
+          heap.pop();
+          heap.push(x_index);
+        }
       }
+    };
+
+    ::arrow::internal::Executor* executor;
+    const int num_tasks = GetSelectKTasks(ctx_, num_rows, k_, num_rows, &executor);
+    std::vector<HeapContainer> heaps(num_tasks, HeapContainer(cmp));
+    if (num_tasks == 1) {
+      const auto p = this->PartitionNullsInternal<InType>(indices_begin, indices_end,
+                                                          first_sort_key);
+      select_rows(indices_begin, p.non_nulls_end, heaps[0]);
+    } else {
+      // Each task selects from a range of rows into its own heap, the heaps are
+      // merged at the end.  Rows with a null in the first sort key are never
+      // selected, so they don't need to be ordered.
+      using ArrayType = typename TypeTraits<InType>::ArrayType;
+      RETURN_NOT_OK(::arrow::internal::ParallelFor(
+          num_tasks,
+          [&](int task) {
+            uint64_t* rows_begin = indices_begin + num_rows * task / num_tasks;
+            uint64_t* rows_end = indices_begin + num_rows * (task + 1) / num_tasks;
+            const auto p = PartitionNullsOnly<NonStablePartitioner>(
+                rows_begin, rows_end, first_sort_key.resolver, first_sort_key.null_count,
+                NullPlacement::AtEnd);
+            const auto q = PartitionNullLikes<ArrayType, NonStablePartitioner>(
+                p.non_nulls_begin, p.non_nulls_end, first_sort_key.resolver,
+                NullPlacement::AtEnd);
+            select_rows(q.non_nulls_begin, q.non_nulls_end, heaps[task]);
+            return Status::OK();
+          },
+          executor));
+      MergeHeaps(k_, cmp, &heaps);
     }
+    auto& heap = heaps.front();
     auto out_size = static_cast<int64_t>(heap.size());
     ARROW_ASSIGN_OR_RAISE(auto take_indices,
                           MakeMutableUInt64Array(out_size, ctx_->memory_pool()));
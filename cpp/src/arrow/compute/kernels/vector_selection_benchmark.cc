@@ -20,6 +20,8 @@
 #include <cmath>
 #include <cstdint>
 #include <sstream>
+#include <string>
+#include <vector>
 
 #include "arrow/array.h"
 #include "arrow/chunked_array.h"
@@ -174,6 +176,22 @@ struct TakeBenchmark {
     Bench(values);
   }
 
+  void ListInt64(int64_t mean_list_length) {
+    auto list_values = rand.Int64(args.size * mean_list_length, -100, 100, 0);
+    auto values = rand.List(*list_values, args.size, args.null_proportion);
+    Bench(values);
+    state.counters["mean_list_length"] = static_cast<double>(mean_list_length);
+  }
+
+  void Struct() {
+    auto int_field = rand.Int64(args.size, -100, 100, args.null_proportion);
+    auto string_field =
+        rand.String(args.size, kStringMinLength, kStringMaxLength, args.null_proportion);
+    auto values = *StructArray::Make({int_field, string_field},
+                                     std::vector<std::string>{"ints", "strings"});
+    Bench(values);
+  }
+
   void ChunkedInt64(int64_t num_chunks, bool chunk_indices_too) {
     auto chunked_array = GenChunkedArray(num_chunks, [this](int64_t chunk_length) {
       return rand.Int64(chunk_length, -100, 100, args.null_proportion);
@@ -317,6 +335,23 @@ struct FilterBenchmark {
     Bench(values);
   }
 
+  void ListInt64(int64_t mean_list_length) {
+    const int64_t array_size = args.size / sizeof(int64_t) / mean_list_length;
+    auto list_values = rand.Int64(array_size * mean_list_length, -100, 100, 0);
+    auto values = rand.List(*list_values, array_size, args.values_null_proportion);
+    Bench(values);
+    state.counters["mean_list_length"] = static_cast<double>(mean_list_length);
+  }
+
+  void Struct() {
+    const int64_t array_size = args.size / sizeof(int64_t);
+    auto int_field = rand.Int64(array_size, -100, 100, args.values_null_proportion);
+    auto double_field = rand.Float64(array_size, -100, 100, args.values_null_proportion);
+    auto values = *StructArray::Make({int_field, double_field},
+                                     std::vector<std::string>{"ints", "doubles"});
+    Bench(values);
+  }
+
   void Bench(const std::shared_ptr<Array>& values) {
     auto filter = rand.Boolean(values->length(), args.selected_proportion,
                                args.filter_null_proportion);
@@ -394,6 +429,26 @@ static void FilterStringFilterWithNulls(benchmark::State& state) {
   FilterBenchmark(state, true).String();
 }
 
+static void FilterListInt64FilterNoNulls(benchmark::State& state) {
+  FilterBenchmark(state, false).ListInt64(/*mean_list_length=*/4);
+}
+
+static void FilterListInt64FilterWithNulls(benchmark::State& state) {
+  FilterBenchmark(state, true).ListInt64(/*mean_list_length=*/4);
+}
+
+static void FilterLongListInt64FilterNoNulls(benchmark::State& state) {
+  FilterBenchmark(state, false).ListInt64(/*mean_list_length=*/64);
+}
+
+static void FilterStructFilterNoNulls(benchmark::State& state) {
+  FilterBenchmark(state, false).Struct();
+}
+
+static void FilterStructFilterWithNulls(benchmark::State& state) {
+  FilterBenchmark(state, true).Struct();
+}
+
 static void FilterRecordBatchNoNulls(benchmark::State& state) {
   FilterBenchmark(state, false).BenchRecordBatch();
 }
@@ -451,6 +506,31 @@ static void TakeStringMonotonicIndices(benchmark::State& state) {
   TakeBenchmark(state, /*indices_with_nulls=*/false, /*monotonic=*/true).FSLInt64();
 }
 
+static void TakeListInt64RandomIndicesNoNulls(benchmark::State& state) {
+  TakeBenchmark(state, /*indices_with_nulls=*/false).ListInt64(/*mean_list_length=*/4);
+}
+
+static void TakeListInt64RandomIndicesWithNulls(benchmark::State& state) {
+  TakeBenchmark(state, /*indices_with_nulls=*/true).ListInt64(/*mean_list_length=*/4);
+}
+
+static void TakeListInt64MonotonicIndices(benchmark::State& state) {
+  TakeBenchmark(state, /*indices_with_nulls=*/false, /*monotonic=*/true)
+      .ListInt64(/*mean_list_length=*/4);
+}
+
+static void TakeLongListInt64RandomIndicesNoNulls(benchmark::State& state) {
+  TakeBenchmark(state, /*indices_with_nulls=*/false).ListInt64(/*mean_list_length=*/64);
+}
+
+static void TakeStructRandomIndicesNoNulls(benchmark::State& state) {
+  TakeBenchmark(state, /*indices_with_nulls=*/false).Struct();
+}
+
+static void TakeStructRandomIndicesWithNulls(benchmark::State& state) {
+  TakeBenchmark(state, /*indices_with_nulls=*/true).Struct();
+}
+
 static void TakeChunkedChunkedInt64RandomIndicesNoNulls(benchmark::State& state) {
   TakeBenchmark(state, /*indices_with_nulls=*/false)
       .ChunkedInt64(/*num_chunks=*/100, /*chunk_indices_too=*/true);
@@ -579,6 +659,11 @@ BENCHMARK(FilterFSLInt64FilterNoNulls)->Apply(FilterSetArgs);
 BENCHMARK(FilterFSLInt64FilterWithNulls)->Apply(FilterSetArgs);
 BENCHMARK(FilterStringFilterNoNulls)->Apply(FilterSetArgs);
 BENCHMARK(FilterStringFilterWithNulls)->Apply(FilterSetArgs);
+BENCHMARK(FilterListInt64FilterNoNulls)->Apply(FilterSetArgs);
+BENCHMARK(FilterListInt64FilterWithNulls)->Apply(FilterSetArgs);
+BENCHMARK(FilterLongListInt64FilterNoNulls)->Apply(FilterSetArgs);
+BENCHMARK(FilterStructFilterNoNulls)->Apply(FilterSetArgs);
+BENCHMARK(FilterStructFilterWithNulls)->Apply(FilterSetArgs);
 
 void FilterRecordBatchSetArgs(benchmark::internal::Benchmark* bench) {
   for (auto num_cols : std::vector<int>({10, 50, 100})) {
@@ -623,6 +708,12 @@ BENCHMARK(TakeFSLInt64MonotonicIndices)->Apply(TakeSetArgs);
 BENCHMARK(TakeStringRandomIndicesNoNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeStringRandomIndicesWithNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeStringMonotonicIndices)->Apply(TakeSetArgs);
+BENCHMARK(TakeListInt64RandomIndicesNoNulls)->Apply(TakeSetArgs);
+BENCHMARK(TakeListInt64RandomIndicesWithNulls)->Apply(TakeSetArgs);
+BENCHMARK(TakeListInt64MonotonicIndices)->Apply(TakeSetArgs);
+BENCHMARK(TakeLongListInt64RandomIndicesNoNulls)->Apply(TakeSetArgs);
+BENCHMARK(TakeStructRandomIndicesNoNulls)->Apply(TakeSetArgs);
+BENCHMARK(TakeStructRandomIndicesWithNulls)->Apply(TakeSetArgs);
 
 // Chunked values x Chunked indices
 BENCHMARK(TakeChunkedChunkedInt64RandomIndicesNoNulls)->Apply(TakeSetArgs);
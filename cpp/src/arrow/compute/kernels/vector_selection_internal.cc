@@ -16,14 +16,18 @@
 // under the License.
 
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "arrow/array/array_binary.h"
 #include "arrow/array/array_nested.h"
 #include "arrow/array/builder_primitive.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/buffer_builder.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_vector.h"
@@ -471,6 +475,11 @@ inline Status VisitNoop() { return Status::OK(); }
 // A selection implementation for 32-bit and 64-bit variable binary
 // types. Common generated kernels are shared between Binary/String and
 // LargeBinary/LargeString
+//
+// The output is built in two passes: the first computes the output offsets
+// (and thus the exact data size) and remembers where each selected value
+// starts in the input, the second copies the value data, issuing one memcpy
+// per run of values that are contiguous in the input.
 template <typename Type>
 struct VarBinarySelectionImpl : public Selection<VarBinarySelectionImpl<Type>, Type> {
   using offset_type = typename Type::offset_type;
@@ -479,7 +488,9 @@ struct VarBinarySelectionImpl : public Selection<VarBinarySelectionImpl<Type>, T
   LIFT_BASE_MEMBERS();
 
   TypedBufferBuilder<offset_type> offset_builder;
-  TypedBufferBuilder<uint8_t> data_builder;
+  // Input data offset of each output value (unused for empty and null values)
+  TypedBufferBuilder<offset_type> value_start_builder;
+  std::shared_ptr<Buffer> data_buffer;
 
   static constexpr int64_t kOffsetLimit = std::numeric_limits<offset_type>::max() - 1;
 
@@ -487,26 +498,13 @@ struct VarBinarySelectionImpl : public Selection<VarBinarySelectionImpl<Type>, T
                          ExecResult* out)
       : Base(ctx, batch, output_length, out),
         offset_builder(ctx->memory_pool()),
-        data_builder(ctx->memory_pool()) {}
+        value_start_builder(ctx->memory_pool()) {}
 
   template <typename Adapter>
   Status GenerateOutput() {
     const auto raw_offsets = this->values.template GetValues<offset_type>(1);
     const uint8_t* raw_data = this->values.buffers[2].data;
 
-    // Presize the data builder with a rough estimate of the required data size
-    if (this->values.length > 0) {
-      int64_t data_length = raw_offsets[this->values.length] - raw_offsets[0];
-      const double mean_value_length =
-          data_length / static_cast<double>(this->values.length);
-
-      // TODO: See if possible to reduce output_length for take/filter cases
-      // where there are nulls in the selection array
-      RETURN_NOT_OK(
-          data_builder.Reserve(static_cast<int64_t>(mean_value_length * output_length)));
-    }
-    int64_t space_available = data_builder.capacity();
-
     offset_type offset = 0;
     Adapter adapter(this);
     RETURN_NOT_OK(adapter.Generate(
@@ -523,52 +521,92 @@ struct VarBinarySelectionImpl : public Selection<VarBinarySelectionImpl<Type>, T
             return Status::Invalid("Take operation overflowed binary array capacity");
           }
           offset += val_size;
-          if (ARROW_PREDICT_FALSE(val_size > space_available)) {
-            RETURN_NOT_OK(data_builder.Reserve(val_size));
-            space_available = data_builder.capacity() - data_builder.length();
-          }
-          data_builder.UnsafeAppend(raw_data + val_offset, val_size);
-          space_available -= val_size;
+          value_start_builder.UnsafeAppend(val_offset);
           return Status::OK();
         },
         [&]() {
           offset_builder.UnsafeAppend(offset);
+          value_start_builder.UnsafeAppend(0);
           return Status::OK();
         }));
     offset_builder.UnsafeAppend(offset);
+
+    ARROW_ASSIGN_OR_RAISE(data_buffer, AllocateBuffer(offset, ctx->memory_pool()));
+    CopyValueRuns(raw_data, data_buffer->mutable_data());
     return Status::OK();
   }
 
-  Status Init() override { return offset_builder.Reserve(output_length + 1); }
+  void CopyValueRuns(const uint8_t* raw_data, uint8_t* out_data) const {
+    const offset_type* out_offsets = offset_builder.data();
+    const offset_type* value_starts = value_start_builder.data();
+    const int64_t length = offset_builder.length() - 1;
+
+    // The current run of contiguous input data, to be copied at out_offsets[run_begin]
+    int64_t run_begin = 0;
+    int64_t run_start = 0;
+    int64_t run_length = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      const offset_type val_size = out_offsets[i + 1] - out_offsets[i];
+      if (val_size == 0) {
+        continue;
+      }
+      if (value_starts[i] != run_start + run_length) {
+        if (run_length > 0) {
+          std::memcpy(out_data + out_offsets[run_begin], raw_data + run_start,
+                      run_length);
+        }
+        run_begin = i;
+        run_start = value_starts[i];
+        run_length = 0;
+      }
+      run_length += val_size;
+    }
+    if (run_length > 0) {
+      std::memcpy(out_data + out_offsets[run_begin], raw_data + run_start, run_length);
+    }
+  }
+
+  Status Init() override {
+    RETURN_NOT_OK(offset_builder.Reserve(output_length + 1));
+    return value_start_builder.Reserve(output_length);
+  }
 
   Status Finish() override {
     RETURN_NOT_OK(offset_builder.Finish(&out->buffers[1]));
-    return data_builder.Finish(&out->buffers[2]);
+    out->buffers[2] = std::move(data_buffer);
+    return Status::OK();
   }
 };
 
+// A selection implementation for List, LargeList and Map types.
+//
+// Rather than gathering the child values one index at a time, the selected
+// child ranges are recorded (merging ranges that are adjacent in the input)
+// and gathered in bulk once the output offsets are known.
 template <typename Type>
 struct ListSelectionImpl : public Selection<ListSelectionImpl<Type>, Type> {
   using offset_type = typename Type::offset_type;
+  using OffsetArrayType = typename TypeTraits<Type>::OffsetArrayType;
 
   using Base = Selection<ListSelectionImpl<Type>, Type>;
   LIFT_BASE_MEMBERS();
 
+  // Above this mean length, the child ranges are copied as whole slices
+  // instead of being expanded into child indices
+  static constexpr int64_t kMinSliceCopyLength = 32;
+
   TypedBufferBuilder<offset_type> offset_builder;
-  typename TypeTraits<Type>::OffsetBuilderType child_index_builder;
+  // (offset, length) of each selected run of child values
+  std::vector<std::pair<offset_type, offset_type>> child_ranges;
 
   ListSelectionImpl(KernelContext* ctx, const ExecSpan& batch, int64_t output_length,
                     ExecResult* out)
-      : Base(ctx, batch, output_length, out),
-        offset_builder(ctx->memory_pool()),
-        child_index_builder(ctx->memory_pool()) {}
+      : Base(ctx, batch, output_length, out), offset_builder(ctx->memory_pool()) {}
 
   template <typename Adapter>
   Status GenerateOutput() {
     ValuesArrayType typed_values(this->values.ToArrayData());
 
-    // TODO presize child_index_builder with a similar heuristic as VarBinarySelectionImpl
-
     offset_type offset = 0;
     Adapter adapter(this);
     RETURN_NOT_OK(adapter.Generate(
@@ -577,9 +615,13 @@ struct ListSelectionImpl : public Selection<ListSelectionImpl<Type>, Type> {
           offset_type value_offset = typed_values.value_offset(index);
           offset_type value_length = typed_values.value_length(index);
           offset += value_length;
-          RETURN_NOT_OK(child_index_builder.Reserve(value_length));
-          for (offset_type j = value_offset; j < value_offset + value_length; ++j) {
-            child_index_builder.UnsafeAppend(j);
+          if (value_length > 0) {
+            if (!child_ranges.empty() &&
+                child_ranges.back().first + child_ranges.back().second == value_offset) {
+              child_ranges.back().second += value_length;
+            } else {
+              child_ranges.emplace_back(value_offset, value_length);
+            }
           }
           return Status::OK();
         },
@@ -596,16 +638,40 @@ struct ListSelectionImpl : public Selection<ListSelectionImpl<Type>, Type> {
     return Status::OK();
   }
 
-  Status Finish() override {
-    std::shared_ptr<Array> child_indices;
-    RETURN_NOT_OK(child_index_builder.Finish(&child_indices));
+  Result<std::shared_ptr<Array>> SelectChildValues(const std::shared_ptr<Array>& values,
+                                                   int64_t child_length) {
+    const auto num_ranges = static_cast<int64_t>(child_ranges.size());
+    if (num_ranges > 0 && child_length / num_ranges >= kMinSliceCopyLength) {
+      ArrayVector slices;
+      slices.reserve(child_ranges.size());
+      for (const auto& [range_offset, range_length] : child_ranges) {
+        slices.push_back(values->Slice(range_offset, range_length));
+      }
+      return Concatenate(slices, ctx->memory_pool());
+    }
 
-    ValuesArrayType typed_values(this->values.ToArrayData());
+    TypedBufferBuilder<offset_type> child_index_builder(ctx->memory_pool());
+    RETURN_NOT_OK(child_index_builder.Reserve(child_length));
+    for (const auto& [range_offset, range_length] : child_ranges) {
+      offset_type* out_indices = child_index_builder.mutable_data() +
+                                 child_index_builder.length();
+      std::iota(out_indices, out_indices + range_length, range_offset);
+      child_index_builder.UnsafeAdvance(range_length);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto child_indices_buffer, child_index_builder.Finish());
+    OffsetArrayType child_indices(child_length, std::move(child_indices_buffer));
 
     // No need to boundscheck the child values indices
+    return Take(*values, child_indices, TakeOptions::NoBoundsCheck(),
+                ctx->exec_context());
+  }
+
+  Status Finish() override {
+    ValuesArrayType typed_values(this->values.ToArrayData());
+
+    const int64_t child_length = offset_builder.data()[offset_builder.length() - 1];
     ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> taken_child,
-                          Take(*typed_values.values(), *child_indices,
-                               TakeOptions::NoBoundsCheck(), ctx->exec_context()));
+                          SelectChildValues(typed_values.values(), child_length));
     RETURN_NOT_OK(offset_builder.Finish(&out->buffers[1]));
     out->child_data = {taken_child->data()};
     return Status::OK();
@@ -796,9 +862,10 @@ struct SparseUnionSelectionImpl
     BufferVector buffers{nullptr, std::move(child_ids_buffer)};
     *out = ArrayData(typed_values.type(), num_rows, std::move(buffers), 0);
     out->child_data.reserve(num_fields);
+    // All children are taken with the same indices
+    const Datum indices(this->selection.ToArrayData());
     for (auto i = 0; i < num_fields; i++) {
-      ARROW_ASSIGN_OR_RAISE(auto child_datum,
-                            Take(*typed_values.field(i), *this->selection.ToArrayData()));
+      ARROW_ASSIGN_OR_RAISE(auto child_datum, Take(typed_values.field(i), indices));
       out->child_data.emplace_back(std::move(child_datum).array());
     }
     return Status::OK();
@@ -879,13 +946,13 @@ struct StructSelectionImpl : public Selection<StructSelectionImpl, StructType> {
   Status Finish() override {
     StructArray typed_values(this->values.ToArrayData());
 
-    // Select from children without boundschecking
+    // Select from children without boundschecking, sharing the same indices
+    const Datum indices(this->selection.ToArrayData());
     out->child_data.resize(this->values.type->num_fields());
     for (int field_index = 0; field_index < this->values.type->num_fields();
          ++field_index) {
       ARROW_ASSIGN_OR_RAISE(Datum taken_field,
-                            Take(Datum(typed_values.field(field_index)),
-                                 Datum(this->selection.ToArrayData()),
+                            Take(Datum(typed_values.field(field_index)), indices,
                                  TakeOptions::NoBoundsCheck(), ctx->exec_context()));
       out->child_data[field_index] = taken_field.array();
     }
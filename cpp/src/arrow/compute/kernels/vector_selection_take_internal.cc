@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <limits>
@@ -25,6 +26,7 @@
 #include "arrow/array/builder_primitive.h"
 #include "arrow/array/concatenate.h"
 #include "arrow/buffer_builder.h"
+#include "arrow/chunk_resolver.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/codegen_internal.h"
@@ -43,6 +45,7 @@
 #include "arrow/util/fixed_width_internal.h"
 #include "arrow/util/int_util.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/prefetch.h"
 #include "arrow/util/ree_util.h"
 
 namespace arrow {
@@ -529,6 +532,189 @@ Status ExtensionTake(KernelContext* ctx, const ExecSpan& batch, ExecResult* out)
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Take from chunked values without concatenating them first
+//
+// The indices are resolved to (chunk, index in chunk) locations in batches with
+// ChunkResolver::ResolveMany and the values are copied straight from their chunk.
+// This is only done for types with a fixed byte width, the other types still
+// concatenate the chunks and take from the result.
+
+bool CanTakeChunkedDirectly(const ChunkedArray& values, const DataType& index_type) {
+  if (values.num_chunks() <= 1 || !is_integer(index_type.id())) {
+    return false;
+  }
+  const DataType& type = *values.type();
+  if (type.id() == Type::FIXED_SIZE_BINARY || is_decimal(type.id())) {
+    return true;
+  }
+  return is_primitive(type.id()) && type.id() != Type::BOOL &&
+         type.id() != Type::NA && type.byte_width() > 0;
+}
+
+template <int kByteWidth>
+void GatherFromChunks(const std::vector<const uint8_t*>& chunk_values,
+                      const std::vector<const uint8_t*>& chunk_validity,
+                      const std::vector<int64_t>& chunk_offsets,
+                      const TypedChunkLocation<uint64_t>* locations, int64_t length,
+                      int64_t byte_width, const uint8_t* idx_validity, int64_t idx_offset,
+                      uint8_t* out, uint8_t* out_is_valid, int64_t out_position,
+                      int64_t* valid_count) {
+  // How many positions ahead the source values are prefetched
+  constexpr int64_t kPrefetchDistance = 16;
+  const int64_t width = kByteWidth > 0 ? kByteWidth : byte_width;
+  for (int64_t i = 0; i < length; ++i) {
+    if (i + kPrefetchDistance < length) {
+      const auto& ahead = locations[i + kPrefetchDistance];
+      ARROW_PREFETCH(chunk_values[ahead.chunk_index] + ahead.index_in_chunk * width);
+    }
+    const int64_t position = out_position + i;
+    uint8_t* dest = out + position * width;
+    const auto& location = locations[i];
+    const uint8_t* validity = chunk_validity[location.chunk_index];
+    const bool is_valid =
+        (idx_validity == nullptr || bit_util::GetBit(idx_validity, idx_offset + i)) &&
+        (validity == nullptr ||
+         bit_util::GetBit(validity, chunk_offsets[location.chunk_index] +
+                                        static_cast<int64_t>(location.index_in_chunk)));
+    if (is_valid) {
+      const uint8_t* src =
+          chunk_values[location.chunk_index] + location.index_in_chunk * width;
+      std::memcpy(dest, src, width);
+      if (out_is_valid != nullptr) {
+        bit_util::SetBit(out_is_valid, position);
+      }
+      ++*valid_count;
+    } else {
+      std::memset(dest, 0, width);
+    }
+  }
+}
+
+template <typename IndexCType>
+void ChunkedFixedWidthTakeImpl(const ChunkResolver& resolver,
+                               const std::vector<const uint8_t*>& chunk_values,
+                               const std::vector<const uint8_t*>& chunk_validity,
+                               const std::vector<int64_t>& chunk_offsets,
+                               int64_t byte_width, const ArraySpan& indices,
+                               uint8_t* out, uint8_t* out_is_valid,
+                               int64_t* valid_count) {
+  constexpr int64_t kBatchSize = 1024;
+  uint64_t logical[kBatchSize];
+  TypedChunkLocation<uint64_t> locations[kBatchSize];
+  const auto* idx = indices.GetValues<IndexCType>(1);
+  const uint8_t* idx_validity =
+      indices.MayHaveNulls() ? indices.buffers[0].data : nullptr;
+  uint64_t chunk_hint = 0;
+  for (int64_t start = 0; start < indices.length; start += kBatchSize) {
+    const int64_t length = std::min(kBatchSize, indices.length - start);
+    for (int64_t i = 0; i < length; ++i) {
+      // Null slots may hold any value, point them at a valid location
+      const bool is_null = idx_validity != nullptr &&
+                           !bit_util::GetBit(idx_validity, indices.offset + start + i);
+      logical[i] = is_null ? 0 : static_cast<uint64_t>(idx[start + i]);
+    }
+    const bool resolved = resolver.ResolveMany<uint64_t>(length, logical, locations,
+                                                         chunk_hint);
+    DCHECK(resolved);
+    chunk_hint = locations[length - 1].chunk_index;
+    auto gather = [&](auto width_constant) {
+      GatherFromChunks<decltype(width_constant)::value>(
+          chunk_values, chunk_validity, chunk_offsets, locations, length, byte_width,
+          idx_validity, indices.offset + start, out, out_is_valid, start, valid_count);
+    };
+    switch (byte_width) {
+      case 1:
+        gather(std::integral_constant<int, 1>{});
+        break;
+      case 2:
+        gather(std::integral_constant<int, 2>{});
+        break;
+      case 4:
+        gather(std::integral_constant<int, 4>{});
+        break;
+      case 8:
+        gather(std::integral_constant<int, 8>{});
+        break;
+      case 16:
+        gather(std::integral_constant<int, 16>{});
+        break;
+      default:
+        gather(std::integral_constant<int, 0>{});
+        break;
+    }
+  }
+}
+
+/// \pre CanTakeChunkedDirectly(values, *indices.type)
+Result<std::shared_ptr<ArrayData>> ChunkedFixedWidthTake(const ChunkedArray& values,
+                                                         const ArraySpan& indices,
+                                                         const TakeOptions& options,
+                                                         MemoryPool* pool) {
+  if (options.boundscheck) {
+    RETURN_NOT_OK(CheckIndexBounds(indices, static_cast<uint64_t>(values.length())));
+  }
+  const int64_t byte_width = values.type()->byte_width();
+  const int num_chunks = values.num_chunks();
+  std::vector<const uint8_t*> chunk_values(num_chunks);
+  std::vector<const uint8_t*> chunk_validity(num_chunks);
+  std::vector<int64_t> chunk_offsets(num_chunks);
+  bool values_have_nulls = false;
+  for (int i = 0; i < num_chunks; ++i) {
+    const ArrayData& chunk = *values.chunk(i)->data();
+    if (chunk.buffers[1]) {
+      chunk_values[i] = chunk.buffers[1]->data() + chunk.offset * byte_width;
+    }
+    if (chunk.MayHaveNulls()) {
+      chunk_validity[i] = chunk.buffers[0]->data();
+      values_have_nulls = true;
+    }
+    chunk_offsets[i] = chunk.offset;
+  }
+
+  const int64_t length = indices.length;
+  ARROW_ASSIGN_OR_RAISE(auto out_values, AllocateBuffer(length * byte_width, pool));
+  std::shared_ptr<Buffer> out_validity;
+  uint8_t* out_is_valid = nullptr;
+  if (values_have_nulls || indices.MayHaveNulls()) {
+    ARROW_ASSIGN_OR_RAISE(out_validity, AllocateEmptyBitmap(length, pool));
+    out_is_valid = out_validity->mutable_data();
+  }
+
+  ChunkResolver resolver(values.chunks());
+  int64_t valid_count = 0;
+  switch (indices.type->byte_width()) {
+    case 1:
+      ChunkedFixedWidthTakeImpl<uint8_t>(resolver, chunk_values, chunk_validity,
+                                         chunk_offsets, byte_width, indices,
+                                         out_values->mutable_data(), out_is_valid,
+                                         &valid_count);
+      break;
+    case 2:
+      ChunkedFixedWidthTakeImpl<uint16_t>(resolver, chunk_values, chunk_validity,
+                                          chunk_offsets, byte_width, indices,
+                                          out_values->mutable_data(), out_is_valid,
+                                          &valid_count);
+      break;
+    case 4:
+      ChunkedFixedWidthTakeImpl<uint32_t>(resolver, chunk_values, chunk_validity,
+                                          chunk_offsets, byte_width, indices,
+                                          out_values->mutable_data(), out_is_valid,
+                                          &valid_count);
+      break;
+    default:
+      DCHECK_EQ(indices.type->byte_width(), 8);
+      ChunkedFixedWidthTakeImpl<uint64_t>(resolver, chunk_values, chunk_validity,
+                                          chunk_offsets, byte_width, indices,
+                                          out_values->mutable_data(), out_is_valid,
+                                          &valid_count);
+      break;
+  }
+  return ArrayData::Make(values.type(), length,
+                         {std::move(out_validity), std::move(out_values)},
+                         /*null_count=*/length - valid_count);
+}
+
 // ----------------------------------------------------------------------
 // Take metafunction implementation
 
@@ -583,6 +769,10 @@ class TakeMetaFunction : public MetaFunction {
   static Result<std::shared_ptr<ArrayData>> TakeCAA(
       const std::shared_ptr<ChunkedArray>& values, const Array& indices,
       const TakeOptions& options, ExecContext* ctx) {
+    if (CanTakeChunkedDirectly(*values, *indices.type())) {
+      return ChunkedFixedWidthTake(*values, ArraySpan(*indices.data()), options,
+                                   ctx->memory_pool());
+    }
     ARROW_ASSIGN_OR_RAISE(auto values_array,
                           ChunkedArrayAsArray(values, ctx->memory_pool()));
     std::vector<Datum> args = {std::move(values_array), indices};
@@ -600,6 +790,15 @@ class TakeMetaFunction : public MetaFunction {
       const std::shared_ptr<ChunkedArray>& values,
       const std::shared_ptr<ChunkedArray>& indices, const TakeOptions& options,
       ExecContext* ctx) {
+    if (CanTakeChunkedDirectly(*values, *indices->type())) {
+      std::vector<std::shared_ptr<Array>> new_chunks(indices->num_chunks());
+      for (int i = 0; i < indices->num_chunks(); i++) {
+        ARROW_ASSIGN_OR_RAISE(auto chunk,
+                              TakeCAA(values, *indices->chunk(i), options, ctx));
+        new_chunks[i] = MakeArray(std::move(chunk));
+      }
+      return std::make_shared<ChunkedArray>(std::move(new_chunks), values->type());
+    }
     // XXX: for every chunk in indices, values are gathered from all chunks in values to
     // form a new chunk in the result. Performing this concatenation is not ideal, but
     // greatly simplifies the implementation before something more efficient is
@@ -1096,6 +1096,24 @@ TEST_F(TestFilterKernelWithTable, FilterTable) {
                             expected_drop);
 }
 
+TEST(TestFilterMetaFunction, StatisticsBounds) {
+  auto values = ArrayFromJSON(int32(), "[5, null, -2, 9]");
+  values->data()->statistics = ComputeArrayStatistics(*values->data());
+  auto filter = ArrayFromJSON(boolean(), "[true, false, false, true]");
+
+  ASSERT_OK_AND_ASSIGN(Datum filtered, Filter(values, filter));
+  const auto& statistics = filtered.array()->statistics;
+  ASSERT_NE(statistics, nullptr);
+  // The input's extremes bound the output, but are no longer exact
+  ASSERT_FALSE(statistics->null_count.has_value());
+  ASSERT_EQ(ArrayStatistics::ValueType{static_cast<int64_t>(-2)}, statistics->min);
+  ASSERT_FALSE(statistics->is_min_exact);
+  ASSERT_EQ(ArrayStatistics::ValueType{static_cast<int64_t>(9)}, statistics->max);
+  ASSERT_FALSE(statistics->is_max_exact);
+  // The input is left untouched
+  ASSERT_TRUE(values->statistics()->is_min_exact);
+}
+
 TEST(TestFilterMetaFunction, ArityChecking) {
   ASSERT_RAISES(Invalid, CallFunction("filter", ExecBatch({}, 0)));
 }
@@ -2192,6 +2210,44 @@ TEST(TestTakeKernelWithChunkedIndices, TakeChunkedArray) {
   }
 }
 
+TEST(TestTakeKernelWithChunkedIndices, TakeChunkedArrayRandom) {
+  // Fixed-width values are gathered from their chunks without concatenating them,
+  // compare with taking from the concatenated values
+  auto rand = random::RandomArrayGenerator(kRandomSeed);
+  for (const auto& type :
+       {int8(), int32(), float64(), timestamp(TimeUnit::MILLI), fixed_size_binary(3),
+        decimal128(12, 2), month_day_nano_interval()}) {
+    ARROW_SCOPED_TRACE("type = ", *type);
+    for (double null_probability : {0.0, 0.2}) {
+      ArrayVector chunks;
+      for (int64_t length : {0, 7, 100, 1, 300}) {
+        // Slice the chunks to exercise their offsets
+        chunks.push_back(rand.ArrayOf(type, length + 3, null_probability)->Slice(3));
+      }
+      auto values = std::make_shared<ChunkedArray>(chunks, type);
+      ASSERT_OK_AND_ASSIGN(auto concatenated, Concatenate(chunks));
+      auto int32_indices = rand.Int32(500, 0, 407, null_probability);
+      for (const auto& index_type : {int16(), int32(), uint64()}) {
+        ASSERT_OK_AND_ASSIGN(auto indices, Cast(*int32_indices, index_type));
+        ASSERT_OK_AND_ASSIGN(Datum expected, Take(concatenated, indices));
+        ASSERT_OK_AND_ASSIGN(Datum actual, Take(values, indices));
+        ValidateOutput(actual);
+        AssertChunkedEquivalent(ChunkedArray(expected.make_array()),
+                                *actual.chunked_array());
+
+        auto chunked_indices =
+            std::make_shared<ChunkedArray>(ArrayVector{indices->Slice(0, 200),
+                                                       indices->Slice(200)});
+        ASSERT_OK_AND_ASSIGN(actual, Take(values, chunked_indices));
+        ValidateOutput(actual);
+        AssertChunkedEquivalent(ChunkedArray(expected.make_array()),
+                                *actual.chunked_array());
+      }
+      ASSERT_RAISES(IndexError, Take(values, ArrayFromJSON(int32(), "[0, 408]")));
+    }
+  }
+}
+
 TEST(TestTakeKernelWithTable, TakeTable) {
   std::vector<std::shared_ptr<Field>> fields = {field("a", int32()), field("b", utf8())};
   auto schm = schema(fields);
@@ -2323,6 +2379,52 @@ TEST(TestTake, RandomFixedSizeBinary) {
   }
 }
 
+void CheckTakeList(const std::shared_ptr<Array>& values,
+                   const std::shared_ptr<Array>& indices) {
+  ASSERT_OK_AND_ASSIGN(auto taken, TakeAAA(*values, *indices));
+  ValidateOutput(taken);
+  ASSERT_EQ(indices->length(), taken->length());
+  const auto& typed_indices = checked_cast<const Int32Array&>(*indices);
+  for (int64_t i = 0; i < indices->length(); ++i) {
+    if (typed_indices.IsNull(i) || values->IsNull(typed_indices.Value(i))) {
+      ASSERT_TRUE(taken->IsNull(i)) << i;
+    } else {
+      ASSERT_OK_AND_ASSIGN(auto expected, values->GetScalar(typed_indices.Value(i)));
+      ASSERT_OK_AND_ASSIGN(auto actual, taken->GetScalar(i));
+      AssertScalarsEqual(*expected, *actual, /*verbose=*/true);
+    }
+  }
+}
+
+TEST(TestTake, RandomList) {
+  auto rand = random::RandomArrayGenerator(kRandomSeed);
+  const int32_t length = 200;
+  // Short lists are gathered through child indices, long lists by copying
+  // contiguous child ranges
+  for (const int64_t mean_list_length : {2, 64}) {
+    ARROW_SCOPED_TRACE("mean_list_length = ", mean_list_length);
+    auto list_values = rand.Int64(length * mean_list_length, -100, 100, 0.1);
+    for (const auto null_probability : {0.0, 0.1, 1.0}) {
+      auto values = rand.List(*list_values, length, null_probability);
+      ASSERT_OK_AND_ASSIGN(auto large_values, Cast(*values, large_list(int64())));
+      // Indices are valid for the sliced values too
+      auto indices = rand.Int32(length, 0, length - 4, null_probability);
+      ASSERT_OK_AND_ASSIGN(auto sort_indices, SortIndices(*indices));
+      ASSERT_OK_AND_ASSIGN(auto monotonic_indices, Take(*indices, *sort_indices));
+      for (const auto& list_array : {values, large_values, values->Slice(3)}) {
+        CheckTakeList(list_array, indices);
+        CheckTakeList(list_array, monotonic_indices);
+      }
+
+      for (const auto true_probability : {0.1, 0.999}) {
+        auto filter = rand.Boolean(length, true_probability, null_probability);
+        ValidateFilter(values, filter);
+        ValidateFilter(large_values, filter);
+      }
+    }
+  }
+}
+
 // ----------------------------------------------------------------------
 // DropNull tests
 
@@ -18,10 +18,14 @@
 #include <unordered_set>
 
 #include "arrow/compute/function.h"
+#include "arrow/compute/kernels/codegen_internal.h"
 #include "arrow/compute/kernels/vector_sort_internal.h"
 #include "arrow/compute/registry.h"
 #include "arrow/compute/registry_internal.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -37,6 +41,45 @@ Result<RecordBatchVector> BatchesFromTable(const Table& table) {
   return TableBatchReader(table).ToRecordBatches();
 }
 
+// Minimum number of rows for sorting an input in parallel
+constexpr int64_t kMinParallelSortLength = 1 << 16;
+
+// Return the executor to sort an input of the given length with, or null if the
+// input should be sorted serially.
+::arrow::internal::Executor* GetParallelSortExecutor(ExecContext* ctx, int64_t length) {
+  return GetParallelExecutor(ctx, length, kMinParallelSortLength);
+}
+
+// Merge sorted runs by pairs, recursively, until a single run remains.
+//
+// The merges of a round work on disjoint ranges, they are run concurrently if
+// `executor` is not null (`merge_impl` must then have been initialized with
+// InitConcurrent).
+template <typename MergeImplType, typename NullPartitionResultType>
+Status MergeRuns(const MergeImplType& merge_impl, int64_t null_count,
+                 ::arrow::internal::Executor* executor,
+                 std::vector<NullPartitionResultType>* runs) {
+  while (runs->size() > 1) {
+    const int num_merges = static_cast<int>(runs->size() / 2);
+    std::vector<NullPartitionResultType> merged(num_merges);
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        executor != nullptr && num_merges > 1, num_merges,
+        [&](int i) {
+          const auto& left = (*runs)[2 * i];
+          const auto& right = (*runs)[2 * i + 1];
+          DCHECK_EQ(left.overall_end(), right.overall_begin());
+          merged[i] = merge_impl.Merge(left, right, null_count);
+          return Status::OK();
+        },
+        executor));
+    if (runs->size() % 2 != 0) {
+      merged.push_back(runs->back());
+    }
+    *runs = std::move(merged);
+  }
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // ChunkedArray sorting implementation
 
@@ -89,23 +132,31 @@ class ChunkedArraySorter : public TypeVisitor {
     const auto arrays = GetArrayPointers(physical_chunks_);
 
     // Sort each chunk independently and merge to sorted indices.
-    // This is a serial implementation.
+    // Chunks are sorted, then merged, in parallel if the executor allows it.
     std::vector<NullPartitionResult> sorted(num_chunks);
+    auto executor = num_chunks > 1 ? GetParallelSortExecutor(ctx_, num_indices) : nullptr;
 
     // First sort all individual chunks
-    int64_t begin_offset = 0;
-    int64_t end_offset = 0;
+    std::vector<int64_t> chunk_offsets(num_chunks + 1, 0);
     int64_t null_count = 0;
     for (int i = 0; i < num_chunks; ++i) {
-      const auto array = checked_cast<const ArrayType*>(arrays[i]);
-      end_offset += array->length();
-      null_count += array->null_count();
-      ARROW_ASSIGN_OR_RAISE(sorted[i], array_sorter_(indices_begin_ + begin_offset,
-                                                     indices_begin_ + end_offset, *array,
-                                                     begin_offset, options, ctx_));
-      begin_offset = end_offset;
+      chunk_offsets[i + 1] = chunk_offsets[i] + arrays[i]->length();
+      null_count += arrays[i]->null_count();
     }
-    DCHECK_EQ(end_offset, num_indices);
+    DCHECK_EQ(chunk_offsets[num_chunks], num_indices);
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        executor != nullptr, num_chunks,
+        [&](int i) -> Status {
+          const auto array = checked_cast<const ArrayType*>(arrays[i]);
+          // Array sorters may keep state between calls, use a copy for each task
+          ArraySortFunc array_sorter = array_sorter_;
+          ARROW_ASSIGN_OR_RAISE(
+              sorted[i], array_sorter(indices_begin_ + chunk_offsets[i],
+                                      indices_begin_ + chunk_offsets[i + 1], *array,
+                                      chunk_offsets[i], options, ctx_));
+          return Status::OK();
+        },
+        executor));
 
     // Then merge them by pairs, recursively
     if (sorted.size() > 1) {
@@ -137,25 +188,15 @@ class ChunkedArraySorter : public TypeVisitor {
 
       ChunkedMergeImpl merge_impl{null_placement_, std::move(merge_nulls),
                                   std::move(merge_non_nulls)};
-      // std::merge is only called on non-null values, so size temp indices accordingly
-      RETURN_NOT_OK(merge_impl.Init(ctx_, num_indices - null_count));
-
-      while (chunk_sorted.size() > 1) {
-        // Merge all pairs of chunks
-        auto out_it = chunk_sorted.begin();
-        auto it = chunk_sorted.begin();
-        while (it < chunk_sorted.end() - 1) {
-          const auto& left = *it++;
-          const auto& right = *it++;
-          DCHECK_EQ(left.overall_end(), right.overall_begin());
-          const auto merged = merge_impl.Merge(left, right, null_count);
-          *out_it++ = merged;
-        }
-        if (it < chunk_sorted.end()) {
-          *out_it++ = *it++;
-        }
-        chunk_sorted.erase(out_it, chunk_sorted.end());
+      if (executor) {
+        RETURN_NOT_OK(
+            merge_impl.InitConcurrent(ctx_, chunked_indices_begin, num_indices));
+      } else {
+        // std::merge is only called on non-null values, so size temp indices
+        // accordingly
+        RETURN_NOT_OK(merge_impl.Init(ctx_, num_indices - null_count));
       }
+      RETURN_NOT_OK(MergeRuns(merge_impl, null_count, executor, &chunk_sorted));
 
       // Reverse everything
       sorted.resize(1);
@@ -634,7 +675,8 @@ class TableSorter {
               const Table& table, const SortOptions& options)
       : ctx_(ctx),
         table_(table),
-        batches_(MakeBatches(table, &status_)),
+        parallel_executor_(GetParallelSortExecutor(ctx, table.num_rows())),
+        batches_(MakeBatches(table, parallel_executor_, &status_)),
         options_(options),
         null_placement_(options.null_placement),
         sort_keys_(ResolveSortKeys(table, batches_, options.sort_keys, &status_)),
@@ -650,13 +692,29 @@ class TableSorter {
   }
 
  private:
-  static RecordBatchVector MakeBatches(const Table& table, Status* status) {
-    const auto maybe_batches = BatchesFromTable(table);
+  static RecordBatchVector MakeBatches(const Table& table,
+                                       ::arrow::internal::Executor* parallel_executor,
+                                       Status* status) {
+    auto maybe_batches = BatchesFromTable(table);
     if (!maybe_batches.ok()) {
       *status = maybe_batches.status();
       return {};
     }
-    return *std::move(maybe_batches);
+    if (!parallel_executor) {
+      return *std::move(maybe_batches);
+    }
+    // Slice large batches so that there is enough work for all threads
+    const int64_t capacity = parallel_executor->GetCapacity();
+    const int64_t max_batch_rows =
+        std::max<int64_t>(bit_util::CeilDiv(table.num_rows(), capacity),
+                          kMinParallelSortLength / 4);
+    RecordBatchVector batches;
+    for (const auto& batch : *maybe_batches) {
+      for (int64_t offset = 0; offset < batch->num_rows(); offset += max_batch_rows) {
+        batches.push_back(batch->Slice(offset, max_batch_rows));
+      }
+    }
+    return batches;
   }
 
   static std::vector<ResolvedSortKey> ResolveSortKeys(
@@ -677,25 +735,36 @@ class TableSorter {
       return Status::OK();
     }
     std::vector<NullPartitionResult> sorted(num_batches);
+    // Batches are sorted, then merged, in parallel if the executor allows it
+    auto executor = num_batches > 1 ? parallel_executor_ : nullptr;
 
     // First sort all individual batches
-    int64_t begin_offset = 0;
-    int64_t end_offset = 0;
-    int64_t null_count = 0;
+    std::vector<int64_t> batch_offsets(num_batches + 1, 0);
     for (int64_t i = 0; i < num_batches; ++i) {
-      const auto& batch = *batches_[i];
-      end_offset += batch.num_rows();
-      RadixRecordBatchSorter sorter(indices_begin_ + begin_offset,
-                                    indices_begin_ + end_offset, batch, options_);
-      ARROW_ASSIGN_OR_RAISE(sorted[i], sorter.Sort(begin_offset));
-      DCHECK_EQ(sorted[i].overall_begin(), indices_begin_ + begin_offset);
-      DCHECK_EQ(sorted[i].overall_end(), indices_begin_ + end_offset);
-      DCHECK_EQ(sorted[i].non_null_count() + sorted[i].null_count(), batch.num_rows());
-      begin_offset = end_offset;
+      batch_offsets[i + 1] = batch_offsets[i] + batches_[i]->num_rows();
+    }
+    DCHECK_EQ(batch_offsets[num_batches], indices_end_ - indices_begin_);
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        executor != nullptr, static_cast<int>(num_batches),
+        [&](int i) -> Status {
+          const auto& batch = *batches_[i];
+          const int64_t begin_offset = batch_offsets[i];
+          const int64_t end_offset = batch_offsets[i + 1];
+          RadixRecordBatchSorter sorter(indices_begin_ + begin_offset,
+                                        indices_begin_ + end_offset, batch, options_);
+          ARROW_ASSIGN_OR_RAISE(sorted[i], sorter.Sort(begin_offset));
+          DCHECK_EQ(sorted[i].overall_begin(), indices_begin_ + begin_offset);
+          DCHECK_EQ(sorted[i].overall_end(), indices_begin_ + end_offset);
+          DCHECK_EQ(sorted[i].non_null_count() + sorted[i].null_count(),
+                    batch.num_rows());
+          return Status::OK();
+        },
+        executor));
+    int64_t null_count = 0;
+    for (const auto& p : sorted) {
       // XXX this is an upper bound on the true null count
-      null_count += sorted[i].null_count();
+      null_count += p.null_count();
     }
-    DCHECK_EQ(end_offset, indices_end_ - indices_begin_);
 
     // Then merge them by pairs, recursively
     if (sorted.size() > 1) {
@@ -713,10 +782,11 @@ class TableSorter {
         TableSorter* sorter;
         std::vector<ChunkedNullPartitionResult>* chunk_sorted;
         int64_t null_count;
+        ::arrow::internal::Executor* executor;
 
-#define VISIT(TYPE)                                               \
-  Status Visit(const TYPE& type) {                                \
-    return sorter->MergeInternal<TYPE>(chunk_sorted, null_count); \
+#define VISIT(TYPE)                                                         \
+  Status Visit(const TYPE& type) {                                          \
+    return sorter->MergeInternal<TYPE>(chunk_sorted, null_count, executor); \
   }
 
         VISIT_SORTABLE_PHYSICAL_TYPES(VISIT)
@@ -728,7 +798,7 @@ class TableSorter {
                                         type.ToString());
         }
       };
-      Visitor visitor{this, &chunk_sorted, null_count};
+      Visitor visitor{this, &chunk_sorted, null_count, executor};
       RETURN_NOT_OK(VisitTypeInline(*sort_keys_[0].type, &visitor));
 
       DCHECK_EQ(chunk_sorted.size(), 1);
@@ -743,7 +813,7 @@ class TableSorter {
   // Recursive merge routine, typed on the first sort key
   template <typename ArrowType>
   Status MergeInternal(std::vector<ChunkedNullPartitionResult>* sorted,
-                       int64_t null_count) {
+                       int64_t null_count, ::arrow::internal::Executor* executor) {
     auto merge_nulls = [&](CompressedChunkLocation* nulls_begin,
                            CompressedChunkLocation* nulls_middle,
                            CompressedChunkLocation* nulls_end,
@@ -759,22 +829,13 @@ class TableSorter {
 
     ChunkedMergeImpl merge_impl(options_.null_placement, std::move(merge_nulls),
                                 std::move(merge_non_nulls));
-    RETURN_NOT_OK(merge_impl.Init(ctx_, table_.num_rows()));
-
-    while (sorted->size() > 1) {
-      auto out_it = sorted->begin();
-      auto it = sorted->begin();
-      while (it < sorted->end() - 1) {
-        const auto& left = *it++;
-        const auto& right = *it++;
-        DCHECK_EQ(left.overall_end(), right.overall_begin());
-        *out_it++ = merge_impl.Merge(left, right, null_count);
-      }
-      if (it < sorted->end()) {
-        *out_it++ = *it++;
-      }
-      sorted->erase(out_it, sorted->end());
+    if (executor) {
+      RETURN_NOT_OK(merge_impl.InitConcurrent(ctx_, sorted->front().overall_begin(),
+                                              table_.num_rows()));
+    } else {
+      RETURN_NOT_OK(merge_impl.Init(ctx_, table_.num_rows()));
     }
+    RETURN_NOT_OK(MergeRuns(merge_impl, null_count, executor, sorted));
     return comparator_.status();
   }
 
@@ -880,6 +941,7 @@ class TableSorter {
   Status status_;
   ExecContext* ctx_;
   const Table& table_;
+  ::arrow::internal::Executor* const parallel_executor_;
   const RecordBatchVector batches_;
   const SortOptions& options_;
   const NullPlacement null_placement_;
@@ -103,6 +103,30 @@ static void ArraySortFuncInt64Benchmark(benchmark::State& state, const Runner& r
   ArraySortFuncBenchmark(state, runner, values);
 }
 
+template <typename Runner>
+static void ArraySortFuncInt32Benchmark(benchmark::State& state, const Runner& runner,
+                                        int32_t min, int32_t max) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(int32_t);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Int32(array_size, min, max, args.null_proportion);
+
+  ArraySortFuncBenchmark(state, runner, values);
+}
+
+template <typename Runner>
+static void ArraySortFuncDoubleBenchmark(benchmark::State& state, const Runner& runner,
+                                         double min, double max) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(double);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Float64(array_size, min, max, args.null_proportion);
+
+  ArraySortFuncBenchmark(state, runner, values);
+}
+
 template <typename Runner>
 static void ArraySortFuncInt64DictBenchmark(benchmark::State& state, const Runner& runner,
                                             int64_t min, int64_t max, int32_t dict_size) {
@@ -231,6 +255,16 @@ static void ArraySortIndicesInt64Wide(benchmark::State& state) {
   ArraySortFuncInt64Benchmark(state, SortRunner(state), min, max);
 }
 
+static void ArraySortIndicesInt32Wide(benchmark::State& state) {
+  const auto min = std::numeric_limits<int32_t>::min();
+  const auto max = std::numeric_limits<int32_t>::max();
+  ArraySortFuncInt32Benchmark(state, SortRunner(state), min, max);
+}
+
+static void ArraySortIndicesDoubleWide(benchmark::State& state) {
+  ArraySortFuncDoubleBenchmark(state, SortRunner(state), -1e12, 1e12);
+}
+
 static void ArraySortIndicesInt64WideDict(benchmark::State& state) {
   const auto dict_size = kDictionarySize;
   const auto min = std::numeric_limits<int64_t>::min();
@@ -442,6 +476,70 @@ static void TableSortIndicesInt64Wide(benchmark::State& state) {
                         std::numeric_limits<int64_t>::max());
 }
 
+//
+// Select-k and quantile rank benchmark helpers
+//
+
+static void DatumFunctionBenchmark(benchmark::State& state, const std::string& func_name,
+                                   const Datum& datum, const FunctionOptions& options,
+                                   bool use_threads) {
+  ExecContext ctx;
+  ctx.set_use_threads(use_threads);
+  for (auto _ : state) {
+    ABORT_NOT_OK(CallFunction(func_name, {datum}, &options, &ctx));
+  }
+  state.counters["use_threads"] = use_threads;
+  state.SetItemsProcessed(state.iterations() * datum.length());
+}
+
+static void ChunkedArraySelectKInt64(benchmark::State& state) {
+  const int64_t num_records = state.range(0);
+  const int64_t num_chunks = 32;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  ArrayVector chunks;
+  for (int64_t i = 0; i < num_chunks; ++i) {
+    chunks.push_back(rand.Int64(num_records / num_chunks,
+                                std::numeric_limits<int64_t>::min(),
+                                std::numeric_limits<int64_t>::max(),
+                                /*null_probability=*/0.01));
+  }
+  DatumFunctionBenchmark(state, "select_k_unstable",
+                         std::make_shared<ChunkedArray>(std::move(chunks)),
+                         SelectKOptions::TopKDefault(state.range(1)),
+                         /*use_threads=*/state.range(2) != 0);
+}
+
+static void TableSelectKInt64(benchmark::State& state) {
+  const int64_t num_records = state.range(0);
+  const int64_t num_chunks = 32;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  // Two sort keys, the first one with many ties
+  ChunkedArrayVector columns;
+  for (const int64_t max_value : {int64_t{100}, std::numeric_limits<int64_t>::max()}) {
+    ArrayVector chunks;
+    for (int64_t i = 0; i < num_chunks; ++i) {
+      chunks.push_back(rand.Int64(num_records / num_chunks, 0, max_value,
+                                  /*null_probability=*/0.01));
+    }
+    columns.push_back(std::make_shared<ChunkedArray>(std::move(chunks)));
+  }
+  auto table = Table::Make(schema({field("a", int64()), field("b", int64())}),
+                           std::move(columns));
+  DatumFunctionBenchmark(state, "select_k_unstable", table,
+                         SelectKOptions::TopKDefault(state.range(1), {"a", "b"}),
+                         /*use_threads=*/state.range(2) != 0);
+}
+
+static void ArrayRankQuantileInt64Wide(benchmark::State& state) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Int64(state.range(0), std::numeric_limits<int64_t>::min(),
+                           std::numeric_limits<int64_t>::max(),
+                           /*null_probability=*/0.01);
+  DatumFunctionBenchmark(state, "rank_quantile", values,
+                         RankQuantileOptions::Defaults(),
+                         /*use_threads=*/state.range(1) != 0);
+}
+
 //
 // Sort benchmark declarations
 //
@@ -456,6 +554,8 @@ void ArraySortIndicesSetArgs(benchmark::internal::Benchmark* bench) {
 
 BENCHMARK(ArraySortIndicesInt64Narrow)->Apply(ArraySortIndicesSetArgs);
 BENCHMARK(ArraySortIndicesInt64Wide)->Apply(ArraySortIndicesSetArgs);
+BENCHMARK(ArraySortIndicesInt32Wide)->Apply(ArraySortIndicesSetArgs);
+BENCHMARK(ArraySortIndicesDoubleWide)->Apply(ArraySortIndicesSetArgs);
 BENCHMARK(ArraySortIndicesInt64WideDict)->Apply(ArraySortIndicesSetArgs);
 BENCHMARK(ArraySortIndicesBool)->Apply(ArraySortIndicesSetArgs);
 BENCHMARK(ArraySortIndicesStringNarrow)->Apply(ArraySortIndicesSetArgs);
@@ -537,5 +637,38 @@ BENCHMARK(ArrayRankStringWide)->Apply(ArrayRankSetArgs);
 BENCHMARK(ChunkedArrayRankInt64Narrow)->Apply(ArrayRankSetArgs);
 BENCHMARK(ChunkedArrayRankInt64Wide)->Apply(ArrayRankSetArgs);
 
+BENCHMARK(ArrayRankQuantileInt64Wide)
+    ->ArgNames({"", "use_threads"})
+    ->ArgsProduct({
+        {1 << 20, 1 << 23},  // the number of values
+        {0, 1},              // use threads
+    })
+    ->Unit(benchmark::TimeUnit::kNanosecond)
+    ->UseRealTime();
+
+//
+// Select-k benchmark declarations
+//
+
+BENCHMARK(ChunkedArraySelectKInt64)
+    ->ArgNames({"", "k", "use_threads"})
+    ->ArgsProduct({
+        {1 << 20, 1 << 23},  // the number of records
+        {10, 1000},          // k
+        {0, 1},              // use threads
+    })
+    ->Unit(benchmark::TimeUnit::kNanosecond)
+    ->UseRealTime();
+
+BENCHMARK(TableSelectKInt64)
+    ->ArgNames({"", "k", "use_threads"})
+    ->ArgsProduct({
+        {1 << 20, 1 << 23},  // the number of records
+        {10, 1000},          // k
+        {0, 1},              // use threads
+    })
+    ->Unit(benchmark::TimeUnit::kNanosecond)
+    ->UseRealTime();
+
 }  // namespace compute
 }  // namespace arrow
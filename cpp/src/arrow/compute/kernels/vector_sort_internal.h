@@ -46,6 +46,7 @@ namespace arrow::compute::internal {
   VISIT(DoubleType)                          \
   VISIT(BinaryType)                          \
   VISIT(LargeBinaryType)                     \
+  VISIT(BinaryViewType)                      \
   VISIT(FixedSizeBinaryType)                 \
   VISIT(Decimal128Type)                      \
   VISIT(Decimal256Type)
@@ -364,6 +365,16 @@ struct GenericMergeImpl {
     return Status::OK();
   }
 
+  // Like Init, but allow Merge to be called concurrently on disjoint ranges of
+  // [indices_begin, indices_begin + indices_length): each merge then uses the part
+  // of the temp area that mirrors its own range.
+  Status InitConcurrent(ExecContext* ctx, IndexType* indices_begin,
+                        int64_t indices_length) {
+    RETURN_NOT_OK(Init(ctx, indices_length));
+    indices_base_ = indices_begin;
+    return Status::OK();
+  }
+
   NullPartitionResultType Merge(const NullPartitionResultType& left,
                                 const NullPartitionResultType& right,
                                 int64_t null_count) const {
@@ -396,7 +407,7 @@ struct GenericMergeImpl {
     // null-like values (e.g. NaN) are ordered equally.
     if (p.null_count()) {
       merge_nulls_(p.nulls_begin, p.nulls_begin + left.null_count(), p.nulls_end,
-                   temp_indices_, null_count);
+                   TempIndicesFor(p.nulls_begin), null_count);
     }
 
     // Merge the non-null values into temp area
@@ -404,7 +415,7 @@ struct GenericMergeImpl {
     ARROW_DCHECK_EQ(p.non_nulls_end - right.non_nulls_begin, right.non_null_count());
     if (p.non_null_count()) {
       merge_non_nulls_(p.non_nulls_begin, right.non_nulls_begin, p.non_nulls_end,
-                       temp_indices_);
+                       TempIndicesFor(p.non_nulls_begin));
     }
     return p;
   }
@@ -431,7 +442,7 @@ struct GenericMergeImpl {
     // null-like values (e.g. NaN) are ordered equally.
     if (p.null_count()) {
       merge_nulls_(p.nulls_begin, p.nulls_begin + left.null_count(), p.nulls_end,
-                   temp_indices_, null_count);
+                   TempIndicesFor(p.nulls_begin), null_count);
     }
 
     // Merge the non-null values into temp area
@@ -439,7 +450,7 @@ struct GenericMergeImpl {
     ARROW_DCHECK_EQ(p.non_nulls_end - left.non_nulls_end, right.non_null_count());
     if (p.non_null_count()) {
       merge_non_nulls_(p.non_nulls_begin, left.non_nulls_end, p.non_nulls_end,
-                       temp_indices_);
+                       TempIndicesFor(p.non_nulls_begin));
     }
     return p;
   }
@@ -448,8 +459,13 @@ struct GenericMergeImpl {
   NullPlacement null_placement_;
   MergeNullsFunc merge_nulls_;
   MergeNonNullsFunc merge_non_nulls_;
+  IndexType* TempIndicesFor(IndexType* range_begin) const {
+    return indices_base_ ? temp_indices_ + (range_begin - indices_base_) : temp_indices_;
+  }
+
   std::unique_ptr<Buffer> temp_buffer_;
   IndexType* temp_indices_ = nullptr;
+  IndexType* indices_base_ = nullptr;
 };
 
 using MergeImpl = GenericMergeImpl<uint64_t, NullPartitionResult>;
@@ -20,6 +20,7 @@
 #include <limits>
 #include <memory>
 #include <ostream>
+#include <random>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -33,10 +34,12 @@
 #include "arrow/compute/registry.h"
 #include "arrow/result.h"
 #include "arrow/table.h"
+#include "arrow/testing/builder.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/logging_internal.h"
 
 namespace arrow {
@@ -592,7 +595,7 @@ template <typename ArrowType>
 class TestArraySortIndicesForTemporal : public TestArraySortIndices<ArrowType> {};
 TYPED_TEST_SUITE(TestArraySortIndicesForTemporal, TemporalArrowTypes);
 
-using StringSortTestTypes = testing::Types<StringType, LargeStringType>;
+using StringSortTestTypes = testing::Types<StringType, LargeStringType, StringViewType>;
 
 template <typename ArrowType>
 class TestArraySortIndicesForStrings : public TestArraySortIndices<ArrowType> {};
@@ -769,6 +772,13 @@ TYPED_TEST(TestArraySortIndicesForStrings, SortStrings) {
                           "[1, 2, 5, 4, 0, 3]");
   this->AssertSortIndices(input, SortOrder::Descending, NullPlacement::AtStart,
                           "[0, 3, 1, 2, 5, 4]");
+
+  // Values sharing (or shorter than) a 4-byte prefix, inline and out-of-line
+  input = R"(["abcdefghijklmnop", "abc", "abcd", "abcdefghijklmnoa", "ab", "abcdefgh"])";
+  this->AssertSortIndices(input, SortOrder::Ascending, NullPlacement::AtEnd,
+                          "[4, 1, 2, 5, 3, 0]");
+  this->AssertSortIndices(input, SortOrder::Descending, NullPlacement::AtEnd,
+                          "[0, 3, 5, 2, 1, 4]");
 }
 
 TEST_F(TestArraySortIndicesForFixedSizeBinary, SortFixedSizeBinary) {
@@ -924,6 +934,12 @@ class TestArraySortIndicesRandomCount : public ::testing::Test {};
 template <typename ArrowType>
 class TestArraySortIndicesRandomCompare : public ::testing::Test {};
 
+template <typename ArrowType>
+class TestArraySortIndicesRandomRadix : public ::testing::Test {};
+
+template <typename ArrowType>
+class TestArraySortIndicesRandomRadixReal : public ::testing::Test {};
+
 #ifdef ARROW_VALGRIND
 using SortIndicesableTypes = ::testing::Types<UInt32Type, FloatType, DoubleType,
                                               StringType, Decimal128Type, BooleanType>;
@@ -1026,6 +1042,81 @@ TYPED_TEST(TestArraySortIndicesRandomCompare, SortRandomValuesCompare) {
   }
 }
 
+// Long array with big value range: radix sort
+// - length >= 4096(RadixOrCompareSorter::radixsort_min_len_)
+// - range  > 4096(CountCompareSorter::countsort_max_range_)
+TYPED_TEST_SUITE(TestArraySortIndicesRandomRadix, IntegralArrowTypes);
+
+TYPED_TEST(TestArraySortIndicesRandomRadix, SortRandomValuesRadix) {
+  using ArrayType = typename TypeTraits<TypeParam>::ArrayType;
+
+  RandomRange<TypeParam> rand(0x5487658);
+  int times = 3;
+  int length = 10000;
+  int range = 100000;
+  for (int test = 0; test < times; test++) {
+    for (auto null_probability : {0.0, 0.1, 0.5}) {
+      auto array = rand.Generate(length, range, null_probability);
+      for (auto order : AllOrders()) {
+        for (auto null_placement : AllNullPlacements()) {
+          ArraySortOptions options(order, null_placement);
+          ASSERT_OK_AND_ASSIGN(std::shared_ptr<Array> offsets,
+                               SortIndices(*array, options));
+          ValidateSorted<ArrayType>(*checked_pointer_cast<ArrayType>(array),
+                                    *checked_pointer_cast<UInt64Array>(offsets), order,
+                                    null_placement);
+        }
+      }
+    }
+  }
+}
+
+using RadixSortRealTypes = ::testing::Types<FloatType, DoubleType>;
+TYPED_TEST_SUITE(TestArraySortIndicesRandomRadixReal, RadixSortRealTypes);
+
+TYPED_TEST(TestArraySortIndicesRandomRadixReal, SortRandomValuesRadix) {
+  using ArrayType = typename TypeTraits<TypeParam>::ArrayType;
+  using CType = typename TypeParam::c_type;
+
+  // Include values whose bit patterns need care: signed zeros, infinities,
+  // subnormals and NaNs
+  const std::vector<CType> special_values = {
+      -0.0,
+      0.0,
+      -1.5,
+      3.25,
+      std::numeric_limits<CType>::max(),
+      std::numeric_limits<CType>::lowest(),
+      std::numeric_limits<CType>::denorm_min(),
+      -std::numeric_limits<CType>::denorm_min(),
+      std::numeric_limits<CType>::infinity(),
+      -std::numeric_limits<CType>::infinity(),
+      std::numeric_limits<CType>::quiet_NaN()};
+  std::default_random_engine engine(0x5487659);
+  std::uniform_int_distribution<size_t> pick(0, special_values.size() - 1);
+  std::bernoulli_distribution is_valid(0.9);
+
+  int length = 10000;
+  std::vector<CType> values(length);
+  std::vector<bool> validity(length);
+  for (int i = 0; i < length; ++i) {
+    values[i] = special_values[pick(engine)];
+    validity[i] = is_valid(engine);
+  }
+  std::shared_ptr<Array> array;
+  ArrayFromVector<TypeParam>(validity, values, &array);
+
+  for (auto order : AllOrders()) {
+    for (auto null_placement : AllNullPlacements()) {
+      ArraySortOptions options(order, null_placement);
+      ASSERT_OK_AND_ASSIGN(std::shared_ptr<Array> offsets, SortIndices(*array, options));
+      ValidateSorted<ArrayType>(*checked_pointer_cast<ArrayType>(array),
+                                *checked_pointer_cast<UInt64Array>(offsets), order,
+                                null_placement);
+    }
+  }
+}
+
 // Test basic cases for chunked array.
 class TestChunkedArraySortIndices : public ::testing::Test {};
 
@@ -1763,6 +1854,49 @@ TEST_F(TestTableSortIndices, HeterogenousChunking) {
   AssertSortIndices(table, options, "[3, 4, 2, 5, 1, 0, 6, 7]");
 }
 
+TEST_F(TestTableSortIndices, Parallel) {
+  // Large enough to be sorted in parallel
+  const int64_t length = 150000;
+  ::arrow::random::RandomArrayGenerator rng(0x61549226);
+  auto slice_into_chunks = [](const std::shared_ptr<Array>& array, int64_t chunk_size) {
+    ArrayVector chunks;
+    for (int64_t offset = 0; offset < array->length(); offset += chunk_size) {
+      chunks.push_back(array->Slice(offset, chunk_size));
+    }
+    return std::make_shared<ChunkedArray>(std::move(chunks));
+  };
+  auto col_a = slice_into_chunks(rng.Int32(length, -100, 100, /*null_probability=*/0.1),
+                                 /*chunk_size=*/20000);
+  auto col_b = slice_into_chunks(rng.Float32(length, -10, 10, /*null_probability=*/0.05,
+                                             /*nan_probability=*/0.05),
+                                 /*chunk_size=*/35000);
+  auto col_c = slice_into_chunks(rng.String(length, 0, 3, /*null_probability=*/0.1),
+                                 /*chunk_size=*/length);
+  auto table = Table::Make(
+      schema({field("a", int32()), field("b", float32()), field("c", utf8())}),
+      {col_a, col_b, col_c});
+
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, ::arrow::internal::ThreadPool::Make(4));
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+  ExecContext parallel_ctx(default_memory_pool(), thread_pool.get());
+
+  for (auto null_placement : AllNullPlacements()) {
+    SortOptions options({SortKey("a", SortOrder::Ascending),
+                         SortKey("b", SortOrder::Descending), SortKey("c")},
+                        null_placement);
+    ASSERT_OK_AND_ASSIGN(auto expected, SortIndices(Datum(table), options, &serial_ctx));
+    ASSERT_OK_AND_ASSIGN(auto actual, SortIndices(Datum(table), options, &parallel_ctx));
+    AssertArraysEqual(*expected, *actual);
+
+    // Chunked arrays go through a separate sorter
+    ArraySortOptions array_options(SortOrder::Descending, null_placement);
+    ASSERT_OK_AND_ASSIGN(expected, SortIndices(*col_b, array_options, &serial_ctx));
+    ASSERT_OK_AND_ASSIGN(actual, SortIndices(*col_b, array_options, &parallel_ctx));
+    AssertArraysEqual(*expected, *actual);
+  }
+}
+
 // Tests for temporal types
 template <typename ArrowType>
 class TestTableSortIndicesForTemporal : public TestTableSortIndices {
@@ -2475,6 +2609,42 @@ TEST_F(TestRank, EmptyChunks) {
   }
 }
 
+TEST_F(TestRank, Parallel) {
+  // Large enough to be sorted in parallel slices
+  ::arrow::random::RandomArrayGenerator rng(0x5ca1ab1e);
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, ::arrow::internal::ThreadPool::Make(4));
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+  ExecContext parallel_ctx(default_memory_pool(), thread_pool.get());
+
+  for (const auto& values :
+       {rng.Int32(150000, -100, 100, /*null_probability=*/0.1),
+        rng.Float64(150001, -10, 10, /*null_probability=*/0.05,
+                    /*nan_probability=*/0.05),
+        rng.String(150000, 0, 2, /*null_probability=*/0.1)}) {
+    ARROW_SCOPED_TRACE("type = ", values->type()->ToString());
+    for (auto order : AllOrders()) {
+      for (auto null_placement : AllNullPlacements()) {
+        for (auto tiebreaker : AllTiebreakers()) {
+          RankOptions options({SortKey("foo", order)}, null_placement, tiebreaker);
+          ARROW_SCOPED_TRACE("options = ", options.ToString());
+          ASSERT_OK_AND_ASSIGN(auto expected,
+                               CallFunction("rank", {values}, &options, &serial_ctx));
+          ASSERT_OK_AND_ASSIGN(auto actual,
+                               CallFunction("rank", {values}, &options, &parallel_ctx));
+          AssertDatumsEqual(expected, actual);
+        }
+        RankQuantileOptions options({SortKey("foo", order)}, null_placement);
+        ASSERT_OK_AND_ASSIGN(
+            auto expected, CallFunction("rank_quantile", {values}, &options, &serial_ctx));
+        ASSERT_OK_AND_ASSIGN(auto actual, CallFunction("rank_quantile", {values},
+                                                       &options, &parallel_ctx));
+        AssertDatumsEqual(expected, actual);
+      }
+    }
+  }
+}
+
 class TestRankQuantile : public BaseTestRank {
  public:
   void AssertRankQuantileGeneric(const std::string& function_name,
@@ -238,8 +238,15 @@ void Hashing32::HashVarLen(int64_t hardware_flags, bool combine_hashes, uint32_t
                            const uint32_t* offsets, const uint8_t* concatenated_keys,
                            uint32_t* hashes, uint32_t* hashes_temp_for_combine) {
   uint32_t num_processed = 0;
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if ((hardware_flags & arrow::internal::CpuInfo::AVX512) ==
+      arrow::internal::CpuInfo::AVX512) {
+    num_processed = HashVarLen_avx512(combine_hashes, num_rows, offsets,
+                                      concatenated_keys, hashes, hashes_temp_for_combine);
+  }
+#endif
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
-  if (hardware_flags & arrow::internal::CpuInfo::AVX2) {
+  if (num_processed == 0 && (hardware_flags & arrow::internal::CpuInfo::AVX2)) {
     num_processed = HashVarLen_avx2(combine_hashes, num_rows, offsets, concatenated_keys,
                                     hashes, hashes_temp_for_combine);
   }
@@ -257,8 +264,15 @@ void Hashing32::HashVarLen(int64_t hardware_flags, bool combine_hashes, uint32_t
                            const uint64_t* offsets, const uint8_t* concatenated_keys,
                            uint32_t* hashes, uint32_t* hashes_temp_for_combine) {
   uint32_t num_processed = 0;
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if ((hardware_flags & arrow::internal::CpuInfo::AVX512) ==
+      arrow::internal::CpuInfo::AVX512) {
+    num_processed = HashVarLen_avx512(combine_hashes, num_rows, offsets,
+                                      concatenated_keys, hashes, hashes_temp_for_combine);
+  }
+#endif
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
-  if (hardware_flags & arrow::internal::CpuInfo::AVX2) {
+  if (num_processed == 0 && (hardware_flags & arrow::internal::CpuInfo::AVX2)) {
     num_processed = HashVarLen_avx2(combine_hashes, num_rows, offsets, concatenated_keys,
                                     hashes, hashes_temp_for_combine);
   }
@@ -358,13 +372,28 @@ void Hashing32::HashFixed(int64_t hardware_flags, bool combine_hashes, uint32_t
                           uint64_t key_length, const uint8_t* keys, uint32_t* hashes,
                           uint32_t* temp_hashes_for_combine) {
   if (ARROW_POPCOUNT64(key_length) == 1 && key_length <= sizeof(uint64_t)) {
-    HashInt(combine_hashes, num_keys, key_length, keys, hashes);
+    uint32_t num_processed = 0;
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+    if ((hardware_flags & arrow::internal::CpuInfo::AVX512) ==
+        arrow::internal::CpuInfo::AVX512) {
+      num_processed = HashInt_avx512(combine_hashes, num_keys, key_length, keys, hashes);
+    }
+#endif
+    HashInt(combine_hashes, num_keys - num_processed, key_length,
+            keys + key_length * num_processed, hashes + num_processed);
     return;
   }
 
   uint32_t num_processed = 0;
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if ((hardware_flags & arrow::internal::CpuInfo::AVX512) ==
+      arrow::internal::CpuInfo::AVX512) {
+    num_processed = HashFixedLen_avx512(combine_hashes, num_keys, key_length, keys,
+                                        hashes, temp_hashes_for_combine);
+  }
+#endif
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
-  if (hardware_flags & arrow::internal::CpuInfo::AVX2) {
+  if (num_processed == 0 && (hardware_flags & arrow::internal::CpuInfo::AVX2)) {
     num_processed = HashFixedLen_avx2(combine_hashes, num_keys, key_length, keys, hashes,
                                       temp_hashes_for_combine);
   }
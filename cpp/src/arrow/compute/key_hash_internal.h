@@ -156,6 +156,42 @@ class ARROW_COMPUTE_EXPORT Hashing32 {
                                   const uint8_t* concatenated_keys, uint32_t* hashes,
                                   uint32_t* hashes_temp_for_combine);
 #endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  static inline __m512i Avalanche_avx512(__m512i hash);
+  static inline __m512i CombineHashesImp_avx512(__m512i previous_hash, __m512i hash);
+  template <bool T_COMBINE_HASHES>
+  static void AvalancheAll_avx512(uint32_t num_rows, uint32_t* hashes,
+                                  const uint32_t* hashes_temp_for_combine);
+  static inline __m512i Round_avx512(__m512i acc, __m512i input);
+  static inline __m128i CombineAccumulators_avx512(__m512i acc);
+  template <bool T_COMBINE_HASHES, typename KeyOffsetFn>
+  static void HashKeysImp_avx512(uint32_t num_rows, KeyOffsetFn&& key_offset,
+                                 const uint8_t* keys, uint32_t* hashes,
+                                 uint32_t* hashes_temp_for_combine);
+  static uint32_t HashFixedLen_avx512(bool combine_hashes, uint32_t num_rows,
+                                      uint64_t key_length, const uint8_t* keys,
+                                      uint32_t* hashes,
+                                      uint32_t* hashes_temp_for_combine);
+  template <typename T>
+  static uint32_t HashVarLenImp_avx512(bool combine_hashes, uint32_t num_rows,
+                                       const T* offsets, const uint8_t* concatenated_keys,
+                                       uint32_t* hashes,
+                                       uint32_t* hashes_temp_for_combine);
+  static uint32_t HashVarLen_avx512(bool combine_hashes, uint32_t num_rows,
+                                    const uint32_t* offsets,
+                                    const uint8_t* concatenated_keys, uint32_t* hashes,
+                                    uint32_t* hashes_temp_for_combine);
+  static uint32_t HashVarLen_avx512(bool combine_hashes, uint32_t num_rows,
+                                    const uint64_t* offsets,
+                                    const uint8_t* concatenated_keys, uint32_t* hashes,
+                                    uint32_t* hashes_temp_for_combine);
+  template <bool T_COMBINE_HASHES, typename T>
+  static uint32_t HashIntImp_avx512(uint32_t num_keys, const T* keys, uint32_t* hashes);
+  static uint32_t HashInt_avx512(bool combine_hashes, uint32_t num_keys,
+                                 uint64_t key_length, const uint8_t* keys,
+                                 uint32_t* hashes);
+#endif
 };
 
 class ARROW_COMPUTE_EXPORT Hashing64 {
@@ -0,0 +1,297 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+
+#include "arrow/compute/key_hash_internal.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/simd.h"
+
+namespace arrow {
+namespace compute {
+
+inline __m512i Hashing32::Avalanche_avx512(__m512i hash) {
+  hash = _mm512_xor_si512(hash, _mm512_srli_epi32(hash, 15));
+  hash = _mm512_mullo_epi32(hash, _mm512_set1_epi32(PRIME32_2));
+  hash = _mm512_xor_si512(hash, _mm512_srli_epi32(hash, 13));
+  hash = _mm512_mullo_epi32(hash, _mm512_set1_epi32(PRIME32_3));
+  hash = _mm512_xor_si512(hash, _mm512_srli_epi32(hash, 16));
+  return hash;
+}
+
+inline __m512i Hashing32::CombineHashesImp_avx512(__m512i previous_hash, __m512i hash) {
+  // previous_hash ^= acc + kCombineConst + (previous_hash << 6) +
+  // (previous_hash >> 2);
+  //
+  __m512i x = _mm512_add_epi32(_mm512_slli_epi32(previous_hash, 6),
+                               _mm512_srli_epi32(previous_hash, 2));
+  __m512i y = _mm512_add_epi32(hash, _mm512_set1_epi32(kCombineConst));
+  return _mm512_xor_si512(previous_hash, _mm512_add_epi32(x, y));
+}
+
+template <bool T_COMBINE_HASHES>
+void Hashing32::AvalancheAll_avx512(uint32_t num_rows_to_process, uint32_t* hashes,
+                                    const uint32_t* hashes_temp_for_combine) {
+  constexpr uint32_t unroll = 16;
+  // Masked loads and stores take care of the last, partial, batch of hashes
+  for (uint32_t i = 0; i < num_rows_to_process; i += unroll) {
+    const __mmask16 mask =
+        num_rows_to_process - i >= unroll
+            ? static_cast<__mmask16>(0xffff)
+            : static_cast<__mmask16>((1U << (num_rows_to_process - i)) - 1);
+    __m512i acc = _mm512_maskz_loadu_epi32(
+        mask, T_COMBINE_HASHES ? hashes_temp_for_combine + i : hashes + i);
+    acc = Avalanche_avx512(acc);
+    if (T_COMBINE_HASHES) {
+      acc = CombineHashesImp_avx512(_mm512_maskz_loadu_epi32(mask, hashes + i), acc);
+    }
+    _mm512_mask_storeu_epi32(hashes + i, mask, acc);
+  }
+}
+
+inline __m512i Hashing32::Round_avx512(__m512i acc, __m512i input) {
+  acc = _mm512_add_epi32(acc, _mm512_mullo_epi32(input, _mm512_set1_epi32(PRIME32_2)));
+  acc = _mm512_rol_epi32(acc, 13);
+  acc = _mm512_mullo_epi32(acc, _mm512_set1_epi32(PRIME32_1));
+  return acc;
+}
+
+inline __m128i Hashing32::CombineAccumulators_avx512(__m512i acc) {
+  // Each 128-bit lane of input represents a set of 4 accumulators related to
+  // a single hash (we process here four hashes together).
+  //
+  acc = _mm512_rolv_epi32(acc, _mm512_set4_epi32(18, 12, 7, 1));
+  acc = _mm512_add_epi32(acc,
+                         _mm512_shuffle_epi32(acc, static_cast<_MM_PERM_ENUM>(0xee)));
+  acc = _mm512_add_epi32(acc, _mm512_srli_epi64(acc, 32));
+  return _mm512_castsi512_si128(
+      _mm512_permutexvar_epi32(_mm512_setr_epi32(0, 4, 8, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                                 0, 0, 0),
+                               acc));
+}
+
+// Return a mask selecting the bytes of the `istripe`-th stripe of a key of the given
+// length
+static inline __mmask16 StripeMask_avx512(uint64_t length, int64_t istripe) {
+  constexpr int64_t kStripeSize = 16;
+  const int64_t num_bytes =
+      std::clamp(static_cast<int64_t>(length) - istripe * kStripeSize, int64_t{0},
+                 kStripeSize);
+  return static_cast<__mmask16>((1U << num_bytes) - 1);
+}
+
+template <bool T_COMBINE_HASHES, typename KeyOffsetFn>
+void Hashing32::HashKeysImp_avx512(uint32_t num_rows, KeyOffsetFn&& key_offset,
+                                   const uint8_t* keys, uint32_t* hashes,
+                                   uint32_t* hashes_temp_for_combine) {
+  constexpr uint32_t unroll = 4;
+  ARROW_DCHECK_EQ(num_rows % unroll, 0);
+
+  const __m512i acc_init = _mm512_broadcast_i32x4(_mm_setr_epi32(
+      static_cast<uint32_t>((static_cast<uint64_t>(PRIME32_1) + PRIME32_2) & 0xffffffff),
+      PRIME32_2, 0, static_cast<uint32_t>(-static_cast<int32_t>(PRIME32_1))));
+
+  for (uint32_t i = 0; i < num_rows; i += unroll) {
+    // Each 128-bit lane hashes one of the keys.  Keys are read with masked loads,
+    // which never access the bytes they leave out, so that the last keys of a buffer
+    // can be processed as well.
+    const uint8_t* key[unroll];
+    uint64_t length[unroll];
+    int64_t num_stripes[unroll];
+    int64_t max_num_stripes = 1;
+    for (uint32_t k = 0; k < unroll; ++k) {
+      uint64_t offset;
+      key_offset(i + k, &offset, &length[k]);
+      key[k] = keys + offset;
+      // Empty keys are hashed as a single stripe of zeros
+      num_stripes[k] = std::max<int64_t>(
+          1, static_cast<int64_t>(bit_util::CeilDiv(length[k], kStripeSize)));
+      max_num_stripes = std::max(max_num_stripes, num_stripes[k]);
+    }
+    const __m512i vnum_stripes = _mm512_setr_epi32(
+        static_cast<int>(num_stripes[0]), 0, 0, 0, static_cast<int>(num_stripes[1]), 0,
+        0, 0, static_cast<int>(num_stripes[2]), 0, 0, 0,
+        static_cast<int>(num_stripes[3]), 0, 0, 0);
+    // Broadcast the number of stripes of each key to all 4 accumulators of its lane
+    const __m512i vlane_num_stripes = _mm512_shuffle_epi32(vnum_stripes, _MM_PERM_AAAA);
+
+    __m512i acc = acc_init;
+    for (int64_t istripe = 0; istripe < max_num_stripes; ++istripe) {
+      const int64_t stripe_offset = istripe * kStripeSize;
+      __m512i stripe = _mm512_castsi128_si512(_mm_maskz_loadu_epi8(
+          StripeMask_avx512(length[0], istripe), key[0] + stripe_offset));
+      stripe = _mm512_inserti32x4(
+          stripe,
+          _mm_maskz_loadu_epi8(StripeMask_avx512(length[1], istripe),
+                               key[1] + stripe_offset),
+          1);
+      stripe = _mm512_inserti32x4(
+          stripe,
+          _mm_maskz_loadu_epi8(StripeMask_avx512(length[2], istripe),
+                               key[2] + stripe_offset),
+          2);
+      stripe = _mm512_inserti32x4(
+          stripe,
+          _mm_maskz_loadu_epi8(StripeMask_avx512(length[3], istripe),
+                               key[3] + stripe_offset),
+          3);
+      // Only update the accumulators of keys that have this stripe
+      const __mmask16 active = _mm512_cmpgt_epi32_mask(
+          vlane_num_stripes, _mm512_set1_epi32(static_cast<int>(istripe)));
+      acc = _mm512_mask_mov_epi32(acc, active, Round_avx512(acc, stripe));
+    }
+
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(T_COMBINE_HASHES ? hashes_temp_for_combine + i
+                                                    : hashes + i),
+        CombineAccumulators_avx512(acc));
+  }
+
+  AvalancheAll_avx512<T_COMBINE_HASHES>(num_rows, hashes, hashes_temp_for_combine);
+}
+
+uint32_t Hashing32::HashFixedLen_avx512(bool combine_hashes, uint32_t num_rows,
+                                        uint64_t length, const uint8_t* keys,
+                                        uint32_t* hashes,
+                                        uint32_t* hashes_temp_for_combine) {
+  if (length == 0) {
+    return 0;
+  }
+  const uint32_t num_rows_to_process = num_rows - num_rows % 4;
+  auto key_offset = [length](uint32_t i, uint64_t* offset, uint64_t* key_length) {
+    *offset = i * length;
+    *key_length = length;
+  };
+  if (combine_hashes) {
+    HashKeysImp_avx512<true>(num_rows_to_process, key_offset, keys, hashes,
+                             hashes_temp_for_combine);
+  } else {
+    HashKeysImp_avx512<false>(num_rows_to_process, key_offset, keys, hashes,
+                              hashes_temp_for_combine);
+  }
+  return num_rows_to_process;
+}
+
+template <typename T>
+uint32_t Hashing32::HashVarLenImp_avx512(bool combine_hashes, uint32_t num_rows,
+                                         const T* offsets,
+                                         const uint8_t* concatenated_keys,
+                                         uint32_t* hashes,
+                                         uint32_t* hashes_temp_for_combine) {
+  const uint32_t num_rows_to_process = num_rows - num_rows % 4;
+  auto key_offset = [offsets](uint32_t i, uint64_t* offset, uint64_t* key_length) {
+    *offset = offsets[i];
+    *key_length = offsets[i + 1] - offsets[i];
+  };
+  if (combine_hashes) {
+    HashKeysImp_avx512<true>(num_rows_to_process, key_offset, concatenated_keys, hashes,
+                             hashes_temp_for_combine);
+  } else {
+    HashKeysImp_avx512<false>(num_rows_to_process, key_offset, concatenated_keys,
+                              hashes, hashes_temp_for_combine);
+  }
+  return num_rows_to_process;
+}
+
+uint32_t Hashing32::HashVarLen_avx512(bool combine_hashes, uint32_t num_rows,
+                                      const uint32_t* offsets,
+                                      const uint8_t* concatenated_keys, uint32_t* hashes,
+                                      uint32_t* hashes_temp_for_combine) {
+  return HashVarLenImp_avx512(combine_hashes, num_rows, offsets, concatenated_keys,
+                              hashes, hashes_temp_for_combine);
+}
+
+uint32_t Hashing32::HashVarLen_avx512(bool combine_hashes, uint32_t num_rows,
+                                      const uint64_t* offsets,
+                                      const uint8_t* concatenated_keys, uint32_t* hashes,
+                                      uint32_t* hashes_temp_for_combine) {
+  return HashVarLenImp_avx512(combine_hashes, num_rows, offsets, concatenated_keys,
+                              hashes, hashes_temp_for_combine);
+}
+
+template <bool T_COMBINE_HASHES, typename T>
+uint32_t Hashing32::HashIntImp_avx512(uint32_t num_keys, const T* keys,
+                                      uint32_t* hashes) {
+  constexpr uint32_t unroll = 8;
+  constexpr uint64_t multiplier = 11400714785074694791ULL;
+  // Byte-swap each 32-bit element
+  const __m256i byte_swap = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15,
+                                             14, 13, 12, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10,
+                                             9, 8, 15, 14, 13, 12);
+
+  const uint32_t num_keys_to_process = num_keys - num_keys % unroll;
+  for (uint32_t i = 0; i < num_keys_to_process; i += unroll) {
+    __m512i x;
+    if constexpr (sizeof(T) == sizeof(uint8_t)) {
+      x = _mm512_cvtepu8_epi64(
+          _mm_loadl_epi64(reinterpret_cast<const __m128i*>(keys + i)));
+    } else if constexpr (sizeof(T) == sizeof(uint16_t)) {
+      x = _mm512_cvtepu16_epi64(
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i)));
+    } else if constexpr (sizeof(T) == sizeof(uint32_t)) {
+      x = _mm512_cvtepu32_epi64(
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)));
+    } else {
+      x = _mm512_loadu_si512(keys + i);
+    }
+    // The 32-bit hash is the lower half of the byte-swapped 64-bit product, that is
+    // the byte-swapped upper half of the product
+    x = _mm512_srli_epi64(_mm512_mullo_epi64(x, _mm512_set1_epi64(multiplier)), 32);
+    __m256i hash = _mm256_shuffle_epi8(_mm512_cvtepi64_epi32(x), byte_swap);
+    if (T_COMBINE_HASHES) {
+      __m256i previous_hash = _mm256_loadu_si256(reinterpret_cast<__m256i*>(hashes + i));
+      hash = _mm512_castsi512_si256(CombineHashesImp_avx512(
+          _mm512_castsi256_si512(previous_hash), _mm512_castsi256_si512(hash)));
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(hashes + i), hash);
+  }
+  return num_keys_to_process;
+}
+
+uint32_t Hashing32::HashInt_avx512(bool combine_hashes, uint32_t num_keys,
+                                   uint64_t key_length, const uint8_t* keys,
+                                   uint32_t* hashes) {
+  switch (key_length) {
+    case sizeof(uint8_t):
+      return combine_hashes ? HashIntImp_avx512<true, uint8_t>(num_keys, keys, hashes)
+                            : HashIntImp_avx512<false, uint8_t>(num_keys, keys, hashes);
+    case sizeof(uint16_t):
+      return combine_hashes
+                 ? HashIntImp_avx512<true, uint16_t>(
+                       num_keys, reinterpret_cast<const uint16_t*>(keys), hashes)
+                 : HashIntImp_avx512<false, uint16_t>(
+                       num_keys, reinterpret_cast<const uint16_t*>(keys), hashes);
+    case sizeof(uint32_t):
+      return combine_hashes
+                 ? HashIntImp_avx512<true, uint32_t>(
+                       num_keys, reinterpret_cast<const uint32_t*>(keys), hashes)
+                 : HashIntImp_avx512<false, uint32_t>(
+                       num_keys, reinterpret_cast<const uint32_t*>(keys), hashes);
+    case sizeof(uint64_t):
+      return combine_hashes
+                 ? HashIntImp_avx512<true, uint64_t>(
+                       num_keys, reinterpret_cast<const uint64_t*>(keys), hashes)
+                 : HashIntImp_avx512<false, uint64_t>(
+                       num_keys, reinterpret_cast<const uint64_t*>(keys), hashes);
+    default:
+      ARROW_DCHECK(false);
+      return 0;
+  }
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -41,8 +41,8 @@ using internal::CpuInfo;
 namespace compute {
 
 std::vector<int64_t> HardwareFlagsForTesting() {
-  // Our key-hash and key-map routines currently only have AVX2 optimizations
-  return GetSupportedHardwareFlags({CpuInfo::AVX2});
+  // Our key-hash and key-map routines have AVX2 and AVX-512 optimizations
+  return GetSupportedHardwareFlags({CpuInfo::AVX2, CpuInfo::AVX2 | CpuInfo::AVX512});
 }
 
 class TestVectorHash {
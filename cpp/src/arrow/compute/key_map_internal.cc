@@ -301,8 +301,17 @@ void SwissTable::early_filter(const int num_keys, const uint32_t* hashes,
   // Optimistically use simplified lookup involving only a start block to find
   // a single group id candidate for every input.
   int num_processed = 0;
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  // Tables of up to 16 blocks are better served by the AVX2 x32 version below, which
+  // keeps all the blocks in registers instead of gathering them.
+  if ((hardware_flags_ & CpuInfo::AVX512) == CpuInfo::AVX512 && log_blocks_ > 4) {
+    num_processed = early_filter_imp_avx512_x16(num_keys, hashes, out_match_bitvector,
+                                                out_local_slots);
+  }
+#endif
 #if defined(ARROW_HAVE_RUNTIME_AVX2) && defined(ARROW_HAVE_RUNTIME_BMI2)
-  if ((hardware_flags_ & CpuInfo::AVX2) && CpuInfo::GetInstance()->HasEfficientBmi2()) {
+  if (num_processed == 0 && (hardware_flags_ & CpuInfo::AVX2) &&
+      CpuInfo::GetInstance()->HasEfficientBmi2()) {
     if (log_blocks_ <= 4) {
       num_processed = early_filter_imp_avx2_x32(num_keys, hashes, out_match_bitvector,
                                                 out_local_slots);
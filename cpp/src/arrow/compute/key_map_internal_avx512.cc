@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/key_map_internal.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/simd.h"
+
+namespace arrow {
+namespace compute {
+
+// Translation of the scalar early_filter_imp working on byte masks: status bytes of a
+// block are compared with the stamp in one instruction and the leading zero count
+// instruction gives the local slot directly.
+//
+// Returns the number of hashes actually processed, which may be less than
+// requested due to alignment required by SIMD.
+//
+int SwissTable::early_filter_imp_avx512_x16(const int num_hashes, const uint32_t* hashes,
+                                            uint8_t* out_match_bitvector,
+                                            uint8_t* out_local_slots) const {
+  // Number of inputs processed together in a loop
+  constexpr int unroll = 16;
+  constexpr uint64_t kEachByteIs1 = 0x0101010101010101ULL;
+
+  const int num_group_id_bits = num_groupid_bits_from_log_blocks(log_blocks_);
+  const int num_block_bytes = num_block_bytes_from_num_groupid_bits(num_group_id_bits);
+  const __m512i vstamp_mask = _mm512_set1_epi32((1 << bits_stamp_) - 1);
+  const auto blocks_i64 = reinterpret_cast<const int64_t*>(blocks_->data());
+
+  for (int i = 0; i < num_hashes / unroll; ++i) {
+    // Calculate block index and hash stamp for a byte in a block
+    //
+    __m512i vhash = _mm512_loadu_si512(hashes + i * unroll);
+    __m512i vblock_id = _mm512_srli_epi32(vhash, bits_shift_for_block_and_stamp_);
+    __m512i vstamp = _mm512_and_si512(vblock_id, vstamp_mask);
+    vblock_id = _mm512_srli_epi32(vblock_id, bits_shift_for_block_);
+    __m512i vblock_offset =
+        _mm512_mullo_epi32(vblock_id, _mm512_set1_epi32(num_block_bytes));
+
+    // Process the two halves of 8 inputs each, in order to work with 64-bit blocks
+    //
+    for (int half = 0; half < 2; ++half) {
+      const __m256i vblock_offset_half = half == 0
+                                            ? _mm512_castsi512_si256(vblock_offset)
+                                            : _mm512_extracti64x4_epi64(vblock_offset, 1);
+      const __m256i vstamp_half = half == 0 ? _mm512_castsi512_si256(vstamp)
+                                            : _mm512_extracti64x4_epi64(vstamp, 1);
+      __m512i vblock = _mm512_i64gather_epi64(_mm512_cvtepu32_epi64(vblock_offset_half),
+                                              blocks_i64, 1);
+      // Replicate the stamp to all bytes of the corresponding block
+      __m512i vstamp_bytes = _mm512_mullo_epi64(_mm512_cvtepu32_epi64(vstamp_half),
+                                                _mm512_set1_epi64(kEachByteIs1));
+
+      // Empty slots have the highest bit set and can never match a 7-bit stamp.
+      __mmask64 block_high_bits = _mm512_movepi8_mask(vblock);
+      __mmask64 matches = _mm512_cmpeq_epi8_mask(vblock, vstamp_bytes);
+
+      // In case when there are no matches in slots and the block is full (no empty
+      // slots), pretend that there is a match in the last slot.
+      //
+      matches |= ~block_high_bits & kEachByteIs1;
+
+      __mmask8 match_found =
+          _mm512_test_epi64_mask(_mm512_movm_epi8(matches), _mm512_movm_epi8(matches));
+      // The highest byte corresponds to the first slot
+      __m512i vlocal_slot = _mm512_srli_epi64(
+          _mm512_lzcnt_epi64(_mm512_movm_epi8(matches | block_high_bits)), 3);
+
+      out_match_bitvector[i * 2 + half] = match_found;
+      _mm_storel_epi64(
+          reinterpret_cast<__m128i*>(out_local_slots + i * unroll + half * 8),
+          _mm512_cvtepi64_epi8(vlocal_slot));
+    }
+  }
+
+  return num_hashes - (num_hashes % unroll);
+}
+
+}  // namespace compute
+}  // namespace arrow
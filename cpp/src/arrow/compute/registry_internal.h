@@ -61,9 +61,11 @@ void RegisterVectorSwizzle(FunctionRegistry* registry);
 void RegisterVectorOptions(FunctionRegistry* registry);
 
 // Aggregate functions
+void RegisterHashAggregateApproxCountDistinct(FunctionRegistry* registry);
 void RegisterHashAggregateBasic(FunctionRegistry* registry);
 void RegisterHashAggregateNumeric(FunctionRegistry* registry);
 void RegisterHashAggregatePivot(FunctionRegistry* registry);
+void RegisterScalarAggregateApproxCountDistinct(FunctionRegistry* registry);
 void RegisterScalarAggregateBasic(FunctionRegistry* registry);
 void RegisterScalarAggregateMode(FunctionRegistry* registry);
 void RegisterScalarAggregatePivot(FunctionRegistry* registry);
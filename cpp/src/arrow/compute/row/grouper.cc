@@ -17,8 +17,10 @@
 
 #include "arrow/compute/row/grouper.h"
 
+#include <array>
 #include <cstring>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <type_traits>
@@ -35,6 +37,7 @@
 #include "arrow/compute/row/row_encoder_internal.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/cpu_info.h"
@@ -372,6 +375,12 @@ struct GrouperImpl : public Grouper {
         continue;
       }
 
+      if (is_binary_view_like(key->id())) {
+        impl->encoders_[i] =
+            std::make_unique<internal::VarLengthKeyEncoder<BinaryViewType>>(key);
+        continue;
+      }
+
       if (key->id() == Type::NA) {
         impl->encoders_[i] = std::make_unique<internal::NullKeyEncoder>();
         continue;
@@ -555,7 +564,8 @@ struct GrouperFastImpl : public Grouper {
     }
 #if ARROW_LITTLE_ENDIAN
     for (size_t i = 0; i < key_types.size(); ++i) {
-      if (is_large_binary_like(key_types[i].id())) {
+      if (is_large_binary_like(key_types[i].id()) ||
+          is_binary_view_like(key_types[i].id())) {
         return false;
       }
     }
@@ -952,10 +962,456 @@ struct GrouperFastImpl : public Grouper {
   SwissTable::AppendImpl map_append_impl_;
 };
 
+// Grouper for a single integer-like key (integer, temporal or dictionary).
+//
+// Keys are mapped to group ids without any row encoding: through an array indexed by
+// the key while the keys seen so far cover a small range, and through an
+// open-addressing hash table with linear probing once they don't.
+template <typename CType>
+struct GrouperIntegerKeyImpl : public Grouper {
+  using UnsignedType = std::make_unsigned_t<CType>;
+
+  // Keys are biased so that their unsigned order matches the order of the values
+  static constexpr UnsignedType kSignBit =
+      std::is_signed_v<CType> ? static_cast<UnsignedType>(UnsignedType{1}
+                                                          << (8 * sizeof(CType) - 1))
+                              : UnsignedType{0};
+  static constexpr uint64_t kMaxKey = std::numeric_limits<UnsignedType>::max();
+  // The direct map may span up to this many keys, or a small multiple of the number of
+  // keys processed so far if larger
+  static constexpr uint64_t kMinDirectMapRange = 1 << 16;
+  static constexpr int kMinLogHashCapacity = 10;
+  static constexpr int64_t kMiniBatchLength = arrow::util::MiniBatch::kMiniBatchLength;
+
+  static Result<std::unique_ptr<Grouper>> Make(const TypeHolder& key_type,
+                                               ExecContext* ctx) {
+    auto impl = std::make_unique<GrouperIntegerKeyImpl>();
+    impl->ctx_ = ctx;
+    impl->key_type_ = key_type;
+    return impl;
+  }
+
+  Status Reset() override {
+    group_keys_.clear();
+    null_group_id_ = kNoGroupId;
+    use_direct_map_ = true;
+    direct_map_.clear();
+    direct_map_base_ = 0;
+    hash_keys_.clear();
+    hash_group_ids_.clear();
+    log_hash_capacity_ = 0;
+    // As in GrouperFastImpl, the dictionary is assumed to be identical throughout the
+    // grouper's lifespan.
+    return Status::OK();
+  }
+
+  Status Populate(const ExecSpan& batch, int64_t offset, int64_t length) override {
+    return ConsumeImpl(batch, offset, length, GrouperMode::kPopulate).status();
+  }
+
+  Result<Datum> Consume(const ExecSpan& batch, int64_t offset, int64_t length) override {
+    return ConsumeImpl(batch, offset, length, GrouperMode::kConsume);
+  }
+
+  Result<Datum> Lookup(const ExecSpan& batch, int64_t offset, int64_t length) override {
+    return ConsumeImpl(batch, offset, length, GrouperMode::kLookup);
+  }
+
+  uint32_t num_groups() const override {
+    return static_cast<uint32_t>(group_keys_.size());
+  }
+
+  Result<ExecBatch> GetUniques() override {
+    const int64_t num_groups = static_cast<int64_t>(group_keys_.size());
+    ARROW_ASSIGN_OR_RAISE(
+        std::shared_ptr<Buffer> values,
+        AllocateBuffer(num_groups * sizeof(CType), ctx_->memory_pool()));
+    if (num_groups > 0) {
+      memcpy(values->mutable_data(), group_keys_.data(), num_groups * sizeof(CType));
+    }
+    std::shared_ptr<Buffer> validity;
+    int64_t null_count = 0;
+    if (null_group_id_ != kNoGroupId) {
+      ARROW_ASSIGN_OR_RAISE(validity, AllocateBitmap(num_groups, ctx_->memory_pool()));
+      bit_util::SetBitsTo(validity->mutable_data(), 0, num_groups, true);
+      bit_util::ClearBit(validity->mutable_data(), null_group_id_);
+      null_count = 1;
+    }
+    auto uniques =
+        ArrayData::Make(key_type_.GetSharedPtr(), num_groups,
+                        {std::move(validity), std::move(values)}, null_count);
+    if (key_type_.id() == Type::DICTIONARY) {
+      if (dictionary_) {
+        uniques->dictionary = dictionary_->data();
+      } else {
+        ARROW_ASSIGN_OR_RAISE(auto dict, MakeArrayOfNull(key_type_.GetSharedPtr(), 0));
+        uniques->dictionary = dict->data();
+      }
+    }
+    return ExecBatch({Datum(std::move(uniques))}, num_groups);
+  }
+
+ private:
+  static uint64_t ToKey(CType value) {
+    return static_cast<UnsignedType>(static_cast<UnsignedType>(value) ^ kSignBit);
+  }
+
+  uint32_t HashSlot(uint64_t key) const {
+    return static_cast<uint32_t>((key * 0x9E3779B97F4A7C15ULL) >>
+                                 (64 - log_hash_capacity_));
+  }
+
+  uint32_t AddGroup(CType value) {
+    const auto group_id = static_cast<uint32_t>(group_keys_.size());
+    group_keys_.push_back(value);
+    return group_id;
+  }
+
+  uint32_t NullGroupId() {
+    if (null_group_id_ == kNoGroupId) {
+      null_group_id_ = AddGroup(CType{});
+    }
+    return null_group_id_;
+  }
+
+  Result<Datum> ConsumeImpl(const ExecSpan& batch, int64_t offset, int64_t length,
+                            GrouperMode mode) {
+    ARROW_RETURN_NOT_OK(CheckAndCapLengthForConsume(batch.length, offset, &length));
+    if (offset != 0 || length != batch.length) {
+      auto batch_slice = batch.ToExecBatch().Slice(offset, length);
+      return ConsumeImpl(ExecSpan(batch_slice), 0, -1, mode);
+    }
+    if (batch[0].is_scalar()) {
+      ExecBatch expanded = batch.ToExecBatch();
+      ARROW_ASSIGN_OR_RAISE(expanded.values[0],
+                            MakeArrayFromScalar(*expanded.values[0].scalar(),
+                                                expanded.length, ctx_->memory_pool()));
+      return ConsumeImpl(ExecSpan(expanded), mode);
+    }
+    return ConsumeImpl(batch, mode);
+  }
+
+  Result<Datum> ConsumeImpl(const ExecSpan& batch, GrouperMode mode) {
+    const ArraySpan& keys = batch[0].array;
+    if (key_type_.id() == Type::DICTIONARY) {
+      auto dict = MakeArray(keys.dictionary().ToArrayData());
+      if (dictionary_) {
+        if (!dictionary_->Equals(dict)) {
+          // See GrouperFastImpl
+          return Status::NotImplemented("Unifying differing dictionaries");
+        }
+      } else {
+        dictionary_ = std::move(dict);
+      }
+    }
+
+    const int64_t num_rows = batch.length;
+    const CType* values = keys.GetValues<CType>(1);
+    const uint8_t* validity = keys.MayHaveNulls() ? keys.buffers[0].data : NULLPTR;
+
+    std::shared_ptr<Buffer> group_ids, null_bitmap;
+    // As in GrouperFastImpl, populating reuses a single mini-batch of group ids
+    const int64_t group_ids_size = (mode == GrouperMode::kPopulate)
+                                       ? std::min(num_rows, kMiniBatchLength)
+                                       : num_rows;
+    ARROW_ASSIGN_OR_RAISE(group_ids, AllocateBuffer(sizeof(uint32_t) * group_ids_size,
+                                                    ctx_->memory_pool()));
+    if (mode == GrouperMode::kLookup) {
+      ARROW_ASSIGN_OR_RAISE(null_bitmap, AllocateBitmap(num_rows, ctx_->memory_pool()));
+    } else {
+      PrepareDirectMap(values, validity, keys.offset, num_rows);
+    }
+
+    for (int64_t start_row = 0; start_row < num_rows; start_row += kMiniBatchLength) {
+      const int64_t batch_size_next = std::min(kMiniBatchLength, num_rows - start_row);
+      uint32_t* batch_group_ids = group_ids->mutable_data_as<uint32_t>() +
+                                  ((mode == GrouperMode::kPopulate) ? 0 : start_row);
+      const CType* batch_values = values + start_row;
+      const int64_t validity_offset = keys.offset + start_row;
+      if (mode == GrouperMode::kLookup) {
+        uint8_t* found = null_bitmap->mutable_data();
+        if (use_direct_map_) {
+          FindDirect(batch_values, validity, validity_offset, batch_size_next,
+                     batch_group_ids, found, start_row);
+        } else {
+          FindHashed(batch_values, validity, validity_offset, batch_size_next,
+                     batch_group_ids, found, start_row);
+        }
+      } else if (use_direct_map_) {
+        InsertDirect(batch_values, validity, validity_offset, batch_size_next,
+                     batch_group_ids);
+      } else {
+        ReserveHashTable(batch_size_next);
+        InsertHashed(batch_values, validity, validity_offset, batch_size_next,
+                     batch_group_ids);
+      }
+    }
+
+    if (mode == GrouperMode::kPopulate) {
+      return Datum{};
+    }
+    return Datum(UInt32Array(num_rows, std::move(group_ids), std::move(null_bitmap)));
+  }
+
+  // Make sure the direct map covers all non-null keys of the batch, switching to the
+  // hash table if the keys span too wide a range.
+  void PrepareDirectMap(const CType* values, const uint8_t* validity,
+                        int64_t validity_offset, int64_t num_rows) {
+    if (!use_direct_map_) {
+      return;
+    }
+    uint64_t min_key = kMaxKey;
+    uint64_t max_key = 0;
+    if (validity == NULLPTR) {
+      for (int64_t i = 0; i < num_rows; ++i) {
+        const uint64_t key = ToKey(values[i]);
+        min_key = std::min(min_key, key);
+        max_key = std::max(max_key, key);
+      }
+    } else {
+      arrow::internal::VisitSetBitRunsVoid(
+          validity, validity_offset, num_rows, [&](int64_t pos, int64_t len) {
+            for (int64_t i = pos; i < pos + len; ++i) {
+              const uint64_t key = ToKey(values[i]);
+              min_key = std::min(min_key, key);
+              max_key = std::max(max_key, key);
+            }
+          });
+    }
+    if (min_key > max_key) {
+      // No non-null keys
+      return;
+    }
+    const uint64_t map_size = direct_map_.size();
+    if (map_size > 0) {
+      if (min_key >= direct_map_base_ && max_key - direct_map_base_ < map_size) {
+        return;
+      }
+      min_key = std::min(min_key, direct_map_base_);
+      max_key = std::max(max_key, direct_map_base_ + map_size - 1);
+    }
+
+    const uint64_t max_range = std::max<uint64_t>(
+        kMinDirectMapRange, 4 * (group_keys_.size() + static_cast<uint64_t>(num_rows)));
+    const uint64_t range = max_key - min_key;
+    if (range >= max_range) {
+      SwitchToHashTable();
+      return;
+    }
+
+    // Leave room for the keys of the following batches
+    uint64_t new_size = std::max(range + 1, std::min(2 * map_size, max_range));
+    if (new_size - 1 > kMaxKey) {
+      new_size = kMaxKey + 1;
+    }
+    uint64_t new_base = min_key;
+    if (map_size > 0 && min_key < direct_map_base_) {
+      // Grow towards the lower keys
+      new_base = max_key + 1 >= new_size ? max_key + 1 - new_size : 0;
+    }
+    if (new_base > kMaxKey - (new_size - 1)) {
+      new_base = kMaxKey - (new_size - 1);
+    }
+
+    direct_map_.assign(new_size, kNoGroupId);
+    direct_map_base_ = new_base;
+    for (uint32_t group_id = 0; group_id < group_keys_.size(); ++group_id) {
+      if (group_id != null_group_id_) {
+        direct_map_[ToKey(group_keys_[group_id]) - direct_map_base_] = group_id;
+      }
+    }
+  }
+
+  void SwitchToHashTable() {
+    use_direct_map_ = false;
+    direct_map_.clear();
+    direct_map_.shrink_to_fit();
+    ReserveHashTable(0);
+  }
+
+  // Make sure the hash table stays at most half full after inserting
+  // `num_new_keys` keys.
+  void ReserveHashTable(int64_t num_new_keys) {
+    const uint64_t num_keys = group_keys_.size() + static_cast<uint64_t>(num_new_keys);
+    if (log_hash_capacity_ > 0 && 2 * num_keys <= (uint64_t{1} << log_hash_capacity_)) {
+      return;
+    }
+    int log_capacity = std::max(kMinLogHashCapacity, log_hash_capacity_);
+    while ((uint64_t{1} << log_capacity) < 2 * num_keys) {
+      ++log_capacity;
+    }
+    log_hash_capacity_ = log_capacity;
+    hash_keys_.assign(size_t{1} << log_capacity, UnsignedType{0});
+    hash_group_ids_.assign(size_t{1} << log_capacity, kNoGroupId);
+    const uint32_t slot_mask = (uint32_t{1} << log_capacity) - 1;
+    for (uint32_t group_id = 0; group_id < group_keys_.size(); ++group_id) {
+      if (group_id == null_group_id_) {
+        continue;
+      }
+      const uint64_t key = ToKey(group_keys_[group_id]);
+      uint32_t slot = HashSlot(key);
+      while (hash_group_ids_[slot] != kNoGroupId) {
+        slot = (slot + 1) & slot_mask;
+      }
+      hash_keys_[slot] = static_cast<UnsignedType>(key);
+      hash_group_ids_[slot] = group_id;
+    }
+  }
+
+  void InsertDirect(const CType* values, const uint8_t* validity,
+                    int64_t validity_offset, int64_t num_rows, uint32_t* out_group_ids) {
+    for (int64_t i = 0; i < num_rows; ++i) {
+      if (validity && !bit_util::GetBit(validity, validity_offset + i)) {
+        out_group_ids[i] = NullGroupId();
+        continue;
+      }
+      uint32_t& group_id = direct_map_[ToKey(values[i]) - direct_map_base_];
+      if (group_id == kNoGroupId) {
+        group_id = AddGroup(values[i]);
+      }
+      out_group_ids[i] = group_id;
+    }
+  }
+
+  void FindDirect(const CType* values, const uint8_t* validity, int64_t validity_offset,
+                  int64_t num_rows, uint32_t* out_group_ids, uint8_t* out_found,
+                  int64_t out_found_offset) const {
+    for (int64_t i = 0; i < num_rows; ++i) {
+      uint32_t group_id;
+      if (validity && !bit_util::GetBit(validity, validity_offset + i)) {
+        group_id = null_group_id_;
+      } else {
+        const uint64_t index = ToKey(values[i]) - direct_map_base_;
+        group_id = index < direct_map_.size() ? direct_map_[index] : kNoGroupId;
+      }
+      const bool found = group_id != kNoGroupId;
+      out_group_ids[i] = found ? group_id : 0;
+      bit_util::SetBitTo(out_found, out_found_offset + i, found);
+    }
+  }
+
+  // Hash slots are computed for the whole mini-batch in a separate pass, which the
+  // compiler can vectorize, before probing the table.
+  void ComputeHashSlots(const CType* values, int64_t num_rows) {
+    for (int64_t i = 0; i < num_rows; ++i) {
+      minibatch_slots_[i] = HashSlot(ToKey(values[i]));
+    }
+  }
+
+  void InsertHashed(const CType* values, const uint8_t* validity,
+                    int64_t validity_offset, int64_t num_rows, uint32_t* out_group_ids) {
+    ComputeHashSlots(values, num_rows);
+    const uint32_t slot_mask = (uint32_t{1} << log_hash_capacity_) - 1;
+    for (int64_t i = 0; i < num_rows; ++i) {
+      if (validity && !bit_util::GetBit(validity, validity_offset + i)) {
+        out_group_ids[i] = NullGroupId();
+        continue;
+      }
+      const auto key = static_cast<UnsignedType>(ToKey(values[i]));
+      uint32_t slot = minibatch_slots_[i];
+      while (true) {
+        const uint32_t group_id = hash_group_ids_[slot];
+        if (group_id == kNoGroupId) {
+          hash_keys_[slot] = key;
+          hash_group_ids_[slot] = out_group_ids[i] = AddGroup(values[i]);
+          break;
+        }
+        if (hash_keys_[slot] == key) {
+          out_group_ids[i] = group_id;
+          break;
+        }
+        slot = (slot + 1) & slot_mask;
+      }
+    }
+  }
+
+  void FindHashed(const CType* values, const uint8_t* validity, int64_t validity_offset,
+                  int64_t num_rows, uint32_t* out_group_ids, uint8_t* out_found,
+                  int64_t out_found_offset) {
+    ComputeHashSlots(values, num_rows);
+    const uint32_t slot_mask = (uint32_t{1} << log_hash_capacity_) - 1;
+    for (int64_t i = 0; i < num_rows; ++i) {
+      uint32_t group_id;
+      if (validity && !bit_util::GetBit(validity, validity_offset + i)) {
+        group_id = null_group_id_;
+      } else {
+        const auto key = static_cast<UnsignedType>(ToKey(values[i]));
+        uint32_t slot = minibatch_slots_[i];
+        while (true) {
+          group_id = hash_group_ids_[slot];
+          if (group_id == kNoGroupId || hash_keys_[slot] == key) {
+            break;
+          }
+          slot = (slot + 1) & slot_mask;
+        }
+      }
+      const bool found = group_id != kNoGroupId;
+      out_group_ids[i] = found ? group_id : 0;
+      bit_util::SetBitTo(out_found, out_found_offset + i, found);
+    }
+  }
+
+  ExecContext* ctx_;
+  TypeHolder key_type_;
+  std::shared_ptr<Array> dictionary_;
+
+  // Key of each group, in group id order (the null group, if any, holds a zero)
+  std::vector<CType> group_keys_;
+  uint32_t null_group_id_ = kNoGroupId;
+
+  bool use_direct_map_ = true;
+  // Group id of each key from direct_map_base_ on, or kNoGroupId
+  std::vector<uint32_t> direct_map_;
+  uint64_t direct_map_base_ = 0;
+
+  // Open-addressing hash table, an empty slot has a kNoGroupId group id
+  std::vector<UnsignedType> hash_keys_;
+  std::vector<uint32_t> hash_group_ids_;
+  int log_hash_capacity_ = 0;
+  std::array<uint32_t, kMiniBatchLength> minibatch_slots_;
+};
+
+bool CanUseIntegerKeyGrouper(const std::vector<TypeHolder>& key_types) {
+  if (key_types.size() != 1) {
+    return false;
+  }
+  const Type::type id = key_types[0].id();
+  return is_integer(id) || is_temporal(id) || id == Type::DURATION ||
+         id == Type::DICTIONARY;
+}
+
+Result<std::unique_ptr<Grouper>> MakeIntegerKeyGrouper(const TypeHolder& key_type,
+                                                       ExecContext* ctx) {
+  const DataType* physical_type = key_type.type;
+  if (key_type.id() == Type::DICTIONARY) {
+    physical_type = checked_cast<const DictionaryType&>(*key_type).index_type().get();
+  }
+  const bool is_signed = !is_unsigned_integer(physical_type->id());
+  switch (checked_cast<const FixedWidthType&>(*physical_type).bit_width()) {
+    case 8:
+      return is_signed ? GrouperIntegerKeyImpl<int8_t>::Make(key_type, ctx)
+                       : GrouperIntegerKeyImpl<uint8_t>::Make(key_type, ctx);
+    case 16:
+      return is_signed ? GrouperIntegerKeyImpl<int16_t>::Make(key_type, ctx)
+                       : GrouperIntegerKeyImpl<uint16_t>::Make(key_type, ctx);
+    case 32:
+      return is_signed ? GrouperIntegerKeyImpl<int32_t>::Make(key_type, ctx)
+                       : GrouperIntegerKeyImpl<uint32_t>::Make(key_type, ctx);
+    case 64:
+      return is_signed ? GrouperIntegerKeyImpl<int64_t>::Make(key_type, ctx)
+                       : GrouperIntegerKeyImpl<uint64_t>::Make(key_type, ctx);
+    default:
+      return Status::NotImplemented("Keys of type ", *key_type);
+  }
+}
+
 }  // namespace
 
 Result<std::unique_ptr<Grouper>> Grouper::Make(const std::vector<TypeHolder>& key_types,
                                                ExecContext* ctx) {
+  if (CanUseIntegerKeyGrouper(key_types)) {
+    return MakeIntegerKeyGrouper(key_types[0], ctx);
+  }
   if (GrouperFastImpl::CanUse(key_types)) {
     return GrouperFastImpl::Make(key_types, ctx);
   }
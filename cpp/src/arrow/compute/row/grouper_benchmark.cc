@@ -20,6 +20,7 @@
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/string.h"
 
+#include "arrow/array/array_dict.h"
 #include "arrow/compute/row/grouper.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -103,6 +104,44 @@ void SetArgs(benchmark::internal::Benchmark* bench) {
   BenchmarkSetArgsWithSizes(bench, {1 << 10, 1 << 12});
 }
 
+// Single integer keys drawn from [0, num_distinct), which are looked up through a
+// direct-mapped array when the range is small and through a hash table otherwise.
+static void GrouperWithIntegerKey(benchmark::State& state,
+                                  const std::shared_ptr<DataType>& type,
+                                  int64_t num_distinct) {
+  auto ctx = default_exec_context();
+
+  RegressionArgs args(state, false);
+  const int64_t num_rows = args.size;
+  const double null_proportion = args.null_proportion;
+
+  random::RandomArrayGenerator rng(kSeed);
+  auto field = ::arrow::field(
+      "", type,
+      key_value_metadata({"min", "max", "null_probability"},
+                         {"0", internal::ToChars(num_distinct - 1),
+                          internal::ToChars(null_proportion)}));
+  ExecBatch exec_batch({rng.ArrayOf(*field, num_rows, kDefaultBufferAlignment,
+                                    ctx->memory_pool())},
+                       num_rows);
+  GrouperBenchmark(state, ExecSpan(exec_batch), ctx);
+}
+
+static void GrouperWithDictionaryKey(benchmark::State& state) {
+  auto ctx = default_exec_context();
+
+  RegressionArgs args(state, false);
+  const int64_t num_rows = args.size;
+  const double null_proportion = args.null_proportion;
+
+  random::RandomArrayGenerator rng(kSeed);
+  auto dict = rng.String(/*size=*/100, /*min_length=*/4, /*max_length=*/16);
+  auto indices = rng.Int32(num_rows, 0, 99, null_proportion);
+  ASSIGN_OR_ABORT(auto keys, DictionaryArray::FromArrays(indices, dict));
+  ExecBatch exec_batch({keys}, num_rows);
+  GrouperBenchmark(state, ExecSpan(exec_batch), ctx);
+}
+
 // This benchmark is mainly to ensure that the construction of our underlying
 // RowTable and the performance of the comparison operations in the lower-level
 // compare_internal can be tracked (we have not systematically tested these
@@ -129,6 +168,17 @@ BENCHMARK_CAPTURE(GrouperWithMultiTypes, "{fixed_size_binary(32)}",
                   {fixed_size_binary(32)})
     ->Apply(SetArgs);
 
+// single integer keys
+BENCHMARK_CAPTURE(GrouperWithIntegerKey, "int32 dense", int32(), 1 << 10)
+    ->Apply(SetArgs);
+BENCHMARK_CAPTURE(GrouperWithIntegerKey, "int32 sparse", int32(), 1 << 30)
+    ->Apply(SetArgs);
+BENCHMARK_CAPTURE(GrouperWithIntegerKey, "int64 dense", int64(), 1 << 10)
+    ->Apply(SetArgs);
+BENCHMARK_CAPTURE(GrouperWithIntegerKey, "int64 sparse", int64(), int64_t{1} << 40)
+    ->Apply(SetArgs);
+BENCHMARK(GrouperWithDictionaryKey)->Apply(SetArgs);
+
 // combination types
 BENCHMARK_CAPTURE(GrouperWithMultiTypes, "{boolean, utf8}", {boolean(), utf8()})
     ->Apply(SetArgs);
@@ -120,6 +120,8 @@ void TestGroupClassSupportedKeys(
 
   ASSERT_OK(make_func({utf8(), binary(), large_utf8(), large_binary()}));
 
+  ASSERT_OK(make_func({utf8_view(), binary_view()}));
+
   ASSERT_OK(make_func({fixed_size_binary(16), fixed_size_binary(32)}));
 
   ASSERT_OK(make_func({decimal128(32, 10), decimal256(76, 20)}));
@@ -881,6 +883,41 @@ TEST(Grouper, NumericKey) {
   }
 }
 
+// Single integer keys are first mapped through an array indexed by the key, then
+// through a hash table once the keys spread too far apart.
+TEST(Grouper, IntegerKeyRanges) {
+  for (auto ty : {int8(), uint16(), int32(), uint32(), int64(), uint64()}) {
+    SCOPED_TRACE("key type: " + ty->ToString());
+
+    TestGrouper g({ty});
+    g.ExpectConsume("[[5], [7], [5], [null]]", "[0, 1, 0, 2]");
+    // Extends the range of keys below and above the first ones
+    g.ExpectConsume("[[1], [7], [100], [null], [2]]", "[3, 1, 4, 2, 5]");
+    g.ExpectUniques("[[5], [7], [null], [1], [100], [2]]");
+    g.ExpectLookup("[[100], [6], [null], [1], [0]]", "[4, null, 2, 3, null]");
+
+    if (bit_width(ty->id()) < 32) {
+      continue;
+    }
+    const auto max = (ty->id() == Type::INT32)    ? "2147483647"
+                     : (ty->id() == Type::UINT32) ? "4294967295"
+                     : (ty->id() == Type::INT64)  ? "9223372036854775807"
+                                                  : "18446744073709551615";
+    // Far away keys switch to the hash table
+    g.ExpectConsume(std::string("[[") + max + "], [7], [" + max + "], [0]]",
+                    "[6, 1, 6, 7]");
+    g.ExpectUniques(std::string("[[5], [7], [null], [1], [100], [2], [") + max +
+                    "], [0]]");
+    g.ExpectLookup(std::string("[[2], [") + max + "], [null], [3]]", "[5, 6, 2, null]");
+
+    ASSERT_OK(g.grouper_->Reset());
+    ASSERT_EQ(g.grouper_->num_groups(), 0);
+    g.uniques_ = ExecBatch({}, -1);
+    g.ExpectConsume(std::string("[[") + max + "], [1], [1]]", "[0, 1, 1]");
+    g.ExpectUniques(std::string("[[") + max + "], [1]]");
+  }
+}
+
 TEST(Grouper, FloatingPointKey) {
   TestGrouper g({float32()});
 
@@ -896,7 +933,7 @@ TEST(Grouper, FloatingPointKey) {
 }
 
 TEST(Grouper, StringKey) {
-  for (auto ty : {utf8(), large_utf8(), fixed_size_binary(2)}) {
+  for (auto ty : {utf8(), large_utf8(), utf8_view(), fixed_size_binary(2)}) {
     ARROW_SCOPED_TRACE("key type = ", *ty);
     {
       TestGrouper g({ty});
@@ -913,6 +950,20 @@ TEST(Grouper, StringKey) {
   }
 }
 
+TEST(Grouper, StringViewKey) {
+  // Mix inline and out-of-line views, including ones that share a prefix
+  for (auto ty : {utf8_view(), binary_view()}) {
+    ARROW_SCOPED_TRACE("key type = ", *ty);
+    TestGrouper g({ty});
+    g.ExpectConsume(R"([["a long string value"], ["short"], ["a long string value"]])",
+                    "[0, 1, 0]");
+    g.ExpectConsume(R"([["a long string other"], [null], ["short"], [""]])",
+                    "[2, 3, 1, 4]");
+    g.ExpectUniques(
+        R"([["a long string value"], ["short"], ["a long string other"], [null], [""]])");
+  }
+}
+
 TEST(Grouper, DictKey) {
   // For dictionary keys, all batches must share a single dictionary.
   // Eventually, differing dictionaries will be unified and indices transposed
@@ -1003,7 +1054,7 @@ TEST(Grouper, MultipleIntKeys) {
 }
 
 TEST(Grouper, StringInt64Key) {
-  for (auto string_type : {utf8(), large_utf8()}) {
+  for (auto string_type : {utf8(), large_utf8(), utf8_view()}) {
     ARROW_SCOPED_TRACE("string_type = ", *string_type);
     {
       TestGrouper g({string_type, int64()});
@@ -1109,6 +1160,22 @@ TEST(Grouper, RandomInt64Keys) {
   TestRandomLookup(TestGrouper({int64()}));
 }
 
+TEST(Grouper, RandomWideInt32Keys) {
+  // Too many distinct keys for the direct-mapped array
+  auto fields = FieldVector{
+      field("", int32(),
+            key_value_metadata({"min", "max", "null_probability"},
+                               {"-100000000", "100000000", "0.1"}))};
+  TestGrouper g({int32()});
+  for (int i = 0; i < 4; ++i) {
+    SCOPED_TRACE(ToChars(i) + "th key batch");
+
+    ExecBatch key_batch{*random::GenerateBatch(fields, 1 << 12, /*seed=*/i + 1)};
+    g.ConsumeAndValidate(key_batch);
+    g.LookupAndValidate(key_batch);
+  }
+}
+
 TEST(Grouper, RandomStringKeys) {
   for (auto string_type : {utf8(), large_utf8()}) {
     ARROW_SCOPED_TRACE("string_type = ", *string_type);
@@ -0,0 +1,355 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/row/row_converter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/data.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/compute/light_array_internal.h"
+#include "arrow/compute/row/encode_internal.h"
+#include "arrow/compute/row/row_internal.h"
+#include "arrow/compute/util.h"
+#include "arrow/compute/util_internal.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bitmap_ops.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/endian.h"
+#include "arrow/util/logging_internal.h"
+#include "arrow/util/ubsan.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+class RowConverter::Impl {
+ public:
+  static constexpr int kMiniBatchLength = util::MiniBatch::kMiniBatchLength;
+  // Same padding as the grouper's decoded buffers, for the SIMD decoders
+  static constexpr int kPaddingForSIMD = 64;
+
+  Impl(std::shared_ptr<Schema> schema, MemoryPool* pool)
+      : schema_(std::move(schema)), pool_(pool) {}
+
+  Status Init() {
+#if !ARROW_LITTLE_ENDIAN
+    return Status::NotImplemented("RowConverter on big-endian platforms");
+#endif
+    const int num_columns = schema_->num_fields();
+    col_metadata_.resize(num_columns);
+    for (int i = 0; i < num_columns; ++i) {
+      const auto& type = schema_->field(i)->type();
+      if (type->id() == Type::BOOL) {
+        col_metadata_[i] = KeyColumnMetadata(true, 0);
+      } else if (type->id() == Type::NA) {
+        col_metadata_[i] = KeyColumnMetadata(true, 0, /*is_null_type_in=*/true);
+      } else if (is_fixed_width(type->id()) && type->id() != Type::DICTIONARY) {
+        const int byte_width = checked_cast<const FixedWidthType&>(*type).byte_width();
+        col_metadata_[i] = KeyColumnMetadata(true, byte_width);
+      } else if (is_binary_like(type->id())) {
+        col_metadata_[i] = KeyColumnMetadata(false, sizeof(uint32_t));
+      } else {
+        return Status::NotImplemented("Converting columns of type ", *type, " to rows");
+      }
+    }
+    encoder_.Init(col_metadata_, /*row_alignment=*/sizeof(uint64_t),
+                  /*string_alignment=*/sizeof(uint64_t));
+    RETURN_NOT_OK(rows_minibatch_.Init(pool_, encoder_.row_metadata()));
+    RETURN_NOT_OK(temp_stack_.Init(pool_, 64 * kMiniBatchLength));
+    hardware_flags_ = arrow::internal::CpuInfo::GetInstance()->hardware_flags();
+    selection_.resize(kMiniBatchLength);
+    std::iota(selection_.begin(), selection_.end(), static_cast<uint16_t>(0));
+    return Status::OK();
+  }
+
+  const std::shared_ptr<Schema>& schema() const { return schema_; }
+
+  Result<EncodedRows> Encode(const RecordBatch& batch) {
+    if (!batch.schema()->Equals(*schema_, /*check_metadata=*/false)) {
+      return Status::TypeError("Expected a record batch of schema ", *schema_,
+                               ", got ", *batch.schema());
+    }
+    const RowTableMetadata& metadata = encoder_.row_metadata();
+    const int64_t num_rows = batch.num_rows();
+    std::vector<KeyColumnArray> cols(col_metadata_.size());
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      const std::shared_ptr<ArrayData>& data = batch.column_data(i);
+      if (col_metadata_[i].is_null_type) {
+        const uint8_t* no_buffer = nullptr;
+        cols[i] = KeyColumnArray(col_metadata_[i], num_rows, no_buffer, no_buffer,
+                                 no_buffer);
+      } else {
+        cols[i] = ColumnArrayFromArrayDataAndMetadata(data, col_metadata_[i],
+                                                      /*start_row=*/0, num_rows);
+      }
+    }
+
+    EncodedRows out;
+    out.num_rows = num_rows;
+    out.null_mask_width = metadata.null_masks_bytes_per_row;
+    ARROW_ASSIGN_OR_RAISE(out.null_masks,
+                          AllocateBuffer(num_rows * out.null_mask_width, pool_));
+    uint8_t* out_null_masks = out.null_masks->mutable_data();
+    uint8_t* out_rows = nullptr;
+    int64_t* out_offsets = nullptr;
+    TypedBufferBuilder<uint8_t> rows_builder(pool_);
+    if (metadata.is_fixed_length) {
+      out.row_width = metadata.fixed_length;
+      ARROW_ASSIGN_OR_RAISE(out.rows, AllocateBuffer(num_rows * out.row_width, pool_));
+      out_rows = out.rows->mutable_data();
+    } else {
+      ARROW_ASSIGN_OR_RAISE(out.offsets,
+                            AllocateBuffer((num_rows + 1) * sizeof(int64_t), pool_));
+      out_offsets = out.offsets->mutable_data_as<int64_t>();
+      out_offsets[0] = 0;
+    }
+
+    // Encode a minibatch at a time and append it to the output buffers
+    for (int64_t start = 0; start < num_rows; start += kMiniBatchLength) {
+      const auto length =
+          static_cast<uint32_t>(std::min<int64_t>(kMiniBatchLength, num_rows - start));
+      encoder_.PrepareEncodeSelected(start, length, cols);
+      RETURN_NOT_OK(encoder_.EncodeSelected(&rows_minibatch_, length, selection_.data()));
+      std::memcpy(out_null_masks + start * out.null_mask_width,
+                  rows_minibatch_.null_masks(0), length * out.null_mask_width);
+      if (metadata.is_fixed_length) {
+        std::memcpy(out_rows + start * out.row_width,
+                    rows_minibatch_.fixed_length_rows(0), length * out.row_width);
+        continue;
+      }
+      const int64_t* offsets = rows_minibatch_.offsets();
+      const int64_t base = rows_builder.length();
+      RETURN_NOT_OK(
+          rows_builder.Append(rows_minibatch_.var_length_rows(), offsets[length]));
+      for (uint32_t i = 1; i <= length; ++i) {
+        out_offsets[start + i] = base + offsets[i];
+      }
+    }
+    if (!metadata.is_fixed_length) {
+      ARROW_ASSIGN_OR_RAISE(out.rows, rows_builder.Finish());
+    }
+    return out;
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Decode(const EncodedRows& rows) {
+    RETURN_NOT_OK(Validate(rows));
+    const RowTableMetadata& metadata = encoder_.row_metadata();
+    const int64_t num_rows = rows.num_rows;
+    const int num_columns = static_cast<int>(col_metadata_.size());
+
+    // Copy the rows to a row table, which pads them for the decoders
+    RowTableImpl table;
+    RETURN_NOT_OK(table.Init(pool_, metadata));
+    int64_t rows_begin = 0;
+    int64_t rows_size = num_rows * rows.row_width;
+    if (!metadata.is_fixed_length) {
+      const int64_t* offsets = rows.offsets->data_as<int64_t>();
+      rows_begin = offsets[0];
+      rows_size = offsets[num_rows] - offsets[0];
+    }
+    RETURN_NOT_OK(table.AppendEmpty(static_cast<uint32_t>(num_rows), rows_size));
+    std::memcpy(table.mutable_null_masks(0), rows.null_masks->data(),
+                num_rows * rows.null_mask_width);
+    if (metadata.is_fixed_length) {
+      std::memcpy(table.mutable_fixed_length_rows(0), rows.rows->data(), rows_size);
+    } else {
+      const int64_t* offsets = rows.offsets->data_as<int64_t>();
+      int64_t* table_offsets = table.mutable_offsets();
+      for (int64_t i = 0; i <= num_rows; ++i) {
+        table_offsets[i] = offsets[i] - rows_begin;
+      }
+      std::memcpy(table.mutable_var_length_rows(), rows.rows->data() + rows_begin,
+                  rows_size);
+    }
+
+    std::vector<std::shared_ptr<Buffer>> validity_bufs(num_columns);
+    std::vector<std::shared_ptr<Buffer>> fixed_bufs(num_columns);
+    std::vector<std::shared_ptr<Buffer>> var_bufs(num_columns);
+    std::vector<KeyColumnArray> cols(num_columns);
+    for (int i = 0; i < num_columns; ++i) {
+      const KeyColumnMetadata& col = col_metadata_[i];
+      if (col.is_null_type) {
+        uint8_t* no_buffer = nullptr;
+        cols[i] = KeyColumnArray(col, num_rows, no_buffer, no_buffer, no_buffer);
+        continue;
+      }
+      ARROW_ASSIGN_OR_RAISE(validity_bufs[i],
+                            AllocatePadded(bit_util::BytesForBits(num_rows)));
+      if (!col.is_fixed_length) {
+        ARROW_ASSIGN_OR_RAISE(fixed_bufs[i],
+                              AllocatePadded((num_rows + 1) * sizeof(uint32_t)));
+        fixed_bufs[i]->mutable_data_as<uint32_t>()[0] = 0;
+      } else if (col.fixed_length == 0) {
+        ARROW_ASSIGN_OR_RAISE(fixed_bufs[i],
+                              AllocatePadded(bit_util::BytesForBits(num_rows)));
+      } else {
+        ARROW_ASSIGN_OR_RAISE(fixed_bufs[i], AllocatePadded(num_rows * col.fixed_length));
+      }
+      cols[i] = KeyColumnArray(col, num_rows, validity_bufs[i]->mutable_data(),
+                               fixed_bufs[i]->mutable_data(), nullptr);
+    }
+
+    for (int64_t start = 0; start < num_rows; start += kMiniBatchLength) {
+      const int64_t length = std::min<int64_t>(kMiniBatchLength, num_rows - start);
+      encoder_.DecodeFixedLengthBuffers(start, start, length, table, &cols,
+                                        hardware_flags_, &temp_stack_);
+    }
+    if (!metadata.is_fixed_length) {
+      for (int i = 0; i < num_columns; ++i) {
+        if (col_metadata_[i].is_fixed_length) continue;
+        const uint32_t data_size = fixed_bufs[i]->data_as<uint32_t>()[num_rows];
+        ARROW_ASSIGN_OR_RAISE(var_bufs[i], AllocatePadded(data_size));
+        cols[i] = KeyColumnArray(
+            col_metadata_[i], num_rows, validity_bufs[i]->mutable_data(),
+            fixed_bufs[i]->mutable_data(), var_bufs[i]->mutable_data());
+      }
+      for (int64_t start = 0; start < num_rows; start += kMiniBatchLength) {
+        const int64_t length = std::min<int64_t>(kMiniBatchLength, num_rows - start);
+        encoder_.DecodeVaryingLengthBuffers(start, start, length, table, &cols,
+                                            hardware_flags_, &temp_stack_);
+      }
+    }
+
+    std::vector<std::shared_ptr<ArrayData>> columns(num_columns);
+    for (int i = 0; i < num_columns; ++i) {
+      const auto& type = schema_->field(i)->type();
+      if (col_metadata_[i].is_null_type) {
+        columns[i] = ArrayData::Make(type, num_rows, {nullptr}, num_rows);
+        continue;
+      }
+      const int64_t null_count =
+          num_rows - arrow::internal::CountSetBits(validity_bufs[i]->data(), 0, num_rows);
+      std::vector<std::shared_ptr<Buffer>> buffers = {
+          null_count > 0 ? std::move(validity_bufs[i]) : nullptr,
+          std::move(fixed_bufs[i])};
+      if (!col_metadata_[i].is_fixed_length) {
+        buffers.push_back(std::move(var_bufs[i]));
+      }
+      columns[i] = ArrayData::Make(type, num_rows, std::move(buffers), null_count);
+    }
+    return RecordBatch::Make(schema_, num_rows, std::move(columns));
+  }
+
+ private:
+  Result<std::shared_ptr<Buffer>> AllocatePadded(int64_t size) {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buf,
+                          AllocateBuffer(size + kPaddingForSIMD, pool_));
+    return SliceMutableBuffer(std::move(buf), 0, size);
+  }
+
+  // Check that decoding `rows` stays within their buffers, as they may come
+  // from another process
+  Status Validate(const EncodedRows& rows) {
+    const RowTableMetadata& metadata = encoder_.row_metadata();
+    const int64_t num_rows = rows.num_rows;
+    if (num_rows < 0 || num_rows > std::numeric_limits<uint32_t>::max()) {
+      return Status::Invalid("Cannot decode ", num_rows, " rows");
+    }
+    if (rows.null_mask_width != metadata.null_masks_bytes_per_row ||
+        (metadata.is_fixed_length && rows.row_width != metadata.fixed_length)) {
+      return Status::Invalid("Rows were not encoded for schema ", *schema_);
+    }
+    if (!rows.null_masks || !rows.rows ||
+        rows.null_masks->size() < num_rows * rows.null_mask_width) {
+      return Status::Invalid("Missing null masks or rows");
+    }
+    if (metadata.is_fixed_length) {
+      if (rows.rows->size() < num_rows * rows.row_width) {
+        return Status::Invalid("Rows buffer too small for ", num_rows, " rows");
+      }
+      return Status::OK();
+    }
+    if (!rows.offsets ||
+        rows.offsets->size() < (num_rows + 1) * static_cast<int64_t>(sizeof(int64_t))) {
+      return Status::Invalid("Variable-length rows need ", num_rows + 1, " offsets");
+    }
+    const int64_t* offsets = rows.offsets->data_as<int64_t>();
+    const int num_varbinary = static_cast<int>(std::count_if(
+        col_metadata_.begin(), col_metadata_.end(),
+        [](const KeyColumnMetadata& col) { return !col.is_fixed_length; }));
+    if (offsets[0] < 0 || offsets[num_rows] > rows.rows->size()) {
+      return Status::Invalid("Row offsets out of bounds");
+    }
+    for (int64_t i = 0; i < num_rows; ++i) {
+      const int64_t row_length = offsets[i + 1] - offsets[i];
+      if (offsets[i] % metadata.row_alignment != 0 ||
+          row_length < metadata.fixed_length ||
+          row_length > std::numeric_limits<uint32_t>::max()) {
+        return Status::Invalid("Invalid offsets for row ", i);
+      }
+      uint32_t begin = metadata.fixed_length;
+      for (int k = 0; k < num_varbinary; ++k) {
+        if (k > 0) {
+          begin += RowTableMetadata::padding_for_alignment_within_row(
+              begin, metadata.string_alignment);
+        }
+        const uint32_t end = util::SafeLoadAs<uint32_t>(
+            rows.rows->data() + offsets[i] + metadata.varbinary_end_array_offset +
+            k * sizeof(uint32_t));
+        if (end < begin || end > row_length) {
+          return Status::Invalid("Invalid value offsets in row ", i);
+        }
+        begin = end;
+      }
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema_;
+  MemoryPool* pool_;
+  std::vector<KeyColumnMetadata> col_metadata_;
+  RowTableEncoder encoder_;
+  RowTableImpl rows_minibatch_;
+  util::TempVectorStack temp_stack_;
+  int64_t hardware_flags_ = 0;
+  // The identity selection of a minibatch
+  std::vector<uint16_t> selection_;
+};
+
+RowConverter::RowConverter(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+RowConverter::~RowConverter() = default;
+
+Result<std::unique_ptr<RowConverter>> RowConverter::Make(std::shared_ptr<Schema> schema,
+                                                         MemoryPool* pool) {
+  auto impl = std::make_unique<Impl>(std::move(schema), pool);
+  RETURN_NOT_OK(impl->Init());
+  return std::unique_ptr<RowConverter>(new RowConverter(std::move(impl)));
+}
+
+const std::shared_ptr<Schema>& RowConverter::schema() const { return impl_->schema(); }
+
+Result<EncodedRows> RowConverter::Encode(const RecordBatch& batch) {
+  return impl_->Encode(batch);
+}
+
+Result<std::shared_ptr<RecordBatch>> RowConverter::Decode(const EncodedRows& rows) {
+  return impl_->Decode(rows);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+#include "arrow/buffer.h"
+#include "arrow/compute/visibility.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace compute {
+
+/// \brief Rows encoded by a RowConverter
+///
+/// Each row stores a bitmask of the null values of the columns followed
+/// by their values. The rows of a schema made only of fixed-width columns
+/// all have the same length and are stored back to back in `rows`. When
+/// the schema has binary or string columns, `offsets` holds the
+/// `num_rows + 1` int64 offsets of the rows into `rows`.
+///
+/// The layout of a row is an implementation detail of the RowConverter
+/// of a given schema and may change between Arrow versions; rows are meant
+/// to be decoded by the same version of Arrow, not persisted.
+struct ARROW_COMPUTE_EXPORT EncodedRows {
+  int64_t num_rows = 0;
+  /// \brief The length of the fixed-length rows, 0 if `offsets` is used
+  int64_t row_width = 0;
+  /// \brief The number of bytes of a row's null bitmask
+  int64_t null_mask_width = 0;
+  /// \brief The null bitmasks of the rows, `null_mask_width` bytes each
+  std::shared_ptr<Buffer> null_masks;
+  /// \brief The data of the rows
+  std::shared_ptr<Buffer> rows;
+  /// \brief The offsets of the rows into `rows`, null if fixed-length
+  std::shared_ptr<Buffer> offsets;
+
+  /// \brief The encoded values of row `i`, without its null bitmask
+  std::string_view row(int64_t i) const {
+    if (offsets) {
+      const auto* row_offsets = offsets->data_as<int64_t>();
+      return std::string_view(rows->data_as<char>() + row_offsets[i],
+                              row_offsets[i + 1] - row_offsets[i]);
+    }
+    return std::string_view(rows->data_as<char>() + i * row_width, row_width);
+  }
+
+  /// \brief The null bitmask of row `i`
+  std::string_view null_mask(int64_t i) const {
+    return std::string_view(null_masks->data_as<char>() + i * null_mask_width,
+                            null_mask_width);
+  }
+};
+
+/// \brief Convert record batches of a schema to rows and back
+///
+/// This uses the row format of the hash join and of the grouper, which
+/// encodes and decodes a column at a time in batches of rows rather than
+/// visiting every value of a row. Supported are the columns of fixed-width
+/// (including boolean and decimal), null, binary and string types; large
+/// binary, views, dictionaries and nested types are not.
+///
+/// A RowConverter keeps scratch space between calls and is not thread-safe;
+/// use one per thread.
+///
+/// This API is EXPERIMENTAL.
+class ARROW_COMPUTE_EXPORT RowConverter {
+ public:
+  ~RowConverter();
+
+  /// \brief Make a converter for the record batches of `schema`
+  ///
+  /// Returns NotImplemented if a field of `schema` has an unsupported type.
+  static Result<std::unique_ptr<RowConverter>> Make(
+      std::shared_ptr<Schema> schema, MemoryPool* pool = default_memory_pool());
+
+  const std::shared_ptr<Schema>& schema() const;
+
+  /// \brief Encode the rows of a record batch of the converter's schema
+  Result<EncodedRows> Encode(const RecordBatch& batch);
+
+  /// \brief Decode rows encoded by a converter of the same schema
+  ///
+  /// The rows may have been reassembled from several EncodedRows, e.g. after
+  /// storing them individually; the offsets of variable-length rows must
+  /// then stay multiples of 8 bytes.
+  Result<std::shared_ptr<RecordBatch>> Decode(const EncodedRows& rows);
+
+ private:
+  class Impl;
+  explicit RowConverter(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace compute
+}  // namespace arrow
@@ -21,6 +21,7 @@
 
 #include "arrow/compute/kernels/codegen_internal.h"
 #include "arrow/compute/visibility.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/visit_data_inline.h"
 
 namespace arrow {
@@ -139,7 +140,9 @@ struct ARROW_COMPUTE_EXPORT DictionaryKeyEncoder : FixedWidthKeyEncoder {
 
 template <typename T>
 struct VarLengthKeyEncoder : KeyEncoder {
-  using Offset = typename T::offset_type;
+  // Binary views have no offsets: their lengths are encoded as int32, like in a view
+  using Offset = typename std::conditional_t<is_binary_view_like_type<T>::value,
+                                             BinaryType, T>::offset_type;
 
   void AddLength(const ExecValue& data, int64_t batch_length, int32_t* lengths) override {
     if (data.is_array()) {
@@ -215,6 +218,9 @@ struct VarLengthKeyEncoder : KeyEncoder {
     std::shared_ptr<Buffer> null_buf;
     int32_t null_count;
     ARROW_RETURN_NOT_OK(DecodeNulls(pool, length, encoded_bytes, &null_buf, &null_count));
+    if constexpr (is_binary_view_like_type<T>::value) {
+      return DecodeViews(encoded_bytes, length, std::move(null_buf), null_count, pool);
+    }
 
     Offset length_sum = 0;
     for (int32_t i = 0; i < length; ++i) {
@@ -247,6 +253,47 @@ struct VarLengthKeyEncoder : KeyEncoder {
         null_count);
   }
 
+  // Decode into views, with all out-of-line values in a single data buffer
+  Result<std::shared_ptr<ArrayData>> DecodeViews(uint8_t** encoded_bytes, int32_t length,
+                                                 std::shared_ptr<Buffer> null_buf,
+                                                 int32_t null_count, MemoryPool* pool) {
+    int64_t out_of_line_sum = 0;
+    for (int32_t i = 0; i < length; ++i) {
+      const auto key_length = util::SafeLoadAs<Offset>(encoded_bytes[i]);
+      if (key_length > BinaryViewType::kInlineSize) {
+        out_of_line_sum += key_length;
+      }
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto views_buf,
+                          AllocateBuffer(sizeof(BinaryViewType::c_type) * length, pool));
+    ARROW_ASSIGN_OR_RAISE(auto key_buf, AllocateBuffer(out_of_line_sum, pool));
+
+    auto raw_views = views_buf->mutable_data_as<BinaryViewType::c_type>();
+    auto raw_keys = key_buf->mutable_data();
+
+    int32_t current_offset = 0;
+    for (int32_t i = 0; i < length; ++i) {
+      const auto key_length = util::SafeLoadAs<Offset>(encoded_bytes[i]);
+      encoded_bytes[i] += sizeof(Offset);
+
+      if (key_length <= BinaryViewType::kInlineSize) {
+        raw_views[i] = util::ToInlineBinaryView(encoded_bytes[i], key_length);
+      } else {
+        memcpy(raw_keys + current_offset, encoded_bytes[i], key_length);
+        raw_views[i] =
+            util::ToNonInlineBinaryView(raw_keys + current_offset, key_length,
+                                        /*buffer_index=*/0, current_offset);
+        current_offset += key_length;
+      }
+      encoded_bytes[i] += key_length;
+    }
+
+    return ArrayData::Make(
+        type_, length, {std::move(null_buf), std::move(views_buf), std::move(key_buf)},
+        null_count);
+  }
+
   explicit VarLengthKeyEncoder(std::shared_ptr<DataType> type) : type_(std::move(type)) {}
 
   std::shared_ptr<DataType> type_;
@@ -18,9 +18,12 @@
 #include <numeric>
 
 #include "arrow/compute/row/encode_internal.h"
+#include "arrow/compute/row/row_converter.h"
 #include "arrow/compute/row/row_internal.h"
+#include "arrow/record_batch.h"
 #include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/util/logging_internal.h"
 
 namespace arrow {
@@ -239,5 +242,90 @@ TEST(RowTableLarge, LARGE_MEMORY_TEST(AppendFrom)) {
   ASSERT_EQ(row_table.offsets()[num_rows], encoded_row_length * num_rows);
 }
 
+void AssertRowConverterRoundTrip(const RecordBatch& batch) {
+  ASSERT_OK_AND_ASSIGN(auto converter, RowConverter::Make(batch.schema()));
+  ASSERT_OK_AND_ASSIGN(EncodedRows rows, converter->Encode(batch));
+  ASSERT_EQ(rows.num_rows, batch.num_rows());
+  ASSERT_OK_AND_ASSIGN(auto decoded, converter->Decode(rows));
+  ASSERT_OK(decoded->ValidateFull());
+  AssertBatchesEqual(batch, *decoded);
+}
+
+TEST(RowConverter, RoundTrip) {
+  random::RandomArrayGenerator rng(42);
+  FieldVector fixed_fields = {field("i8", int8()),
+                              field("i32", int32()),
+                              field("f64", float64()),
+                              field("b", boolean()),
+                              field("dec", decimal128(20, 4)),
+                              field("fsb", fixed_size_binary(3)),
+                              field("n", null())};
+  FieldVector varying_fields = fixed_fields;
+  varying_fields.push_back(field("s", utf8()));
+  varying_fields.push_back(field("bin", binary()));
+
+  for (const auto& fields : {fixed_fields, varying_fields}) {
+    // Several minibatches and a partial one
+    for (int64_t length : {0, 1, 1000, 3333}) {
+      ARROW_SCOPED_TRACE("length = ", length);
+      auto batch = rng.BatchOf(fields, length);
+      AssertRowConverterRoundTrip(*batch);
+      if (length > 16) {
+        AssertRowConverterRoundTrip(*batch->Slice(3, length - 16));
+      }
+    }
+  }
+}
+
+TEST(RowConverter, ReassembleRows) {
+  auto batch = RecordBatchFromJSON(schema({field("a", int64()), field("s", utf8())}),
+                                   R"([[1, "foo"], [null, ""], [3, null],
+                                       [4, "a longer string value"]])");
+  ASSERT_OK_AND_ASSIGN(auto converter, RowConverter::Make(batch->schema()));
+  ASSERT_OK_AND_ASSIGN(EncodedRows rows, converter->Encode(*batch));
+  ASSERT_NE(rows.offsets, nullptr);
+
+  // Store the rows one by one in reverse order, then decode them together
+  std::string data, null_masks;
+  std::vector<int64_t> offsets = {0};
+  for (int64_t i = rows.num_rows - 1; i >= 0; --i) {
+    data += rows.row(i);
+    null_masks += rows.null_mask(i);
+    offsets.push_back(static_cast<int64_t>(data.size()));
+  }
+  EncodedRows reassembled = rows;
+  reassembled.rows = Buffer::FromString(data);
+  reassembled.null_masks = Buffer::FromString(null_masks);
+  reassembled.offsets = Buffer::FromVector(offsets);
+  ASSERT_OK_AND_ASSIGN(auto decoded, converter->Decode(reassembled));
+  ASSERT_OK(decoded->ValidateFull());
+  auto expected = RecordBatchFromJSON(batch->schema(),
+                                      R"([[4, "a longer string value"], [3, null],
+                                          [null, ""], [1, "foo"]])");
+  AssertBatchesEqual(*expected, *decoded);
+}
+
+TEST(RowConverter, Errors) {
+  ASSERT_RAISES(NotImplemented,
+                RowConverter::Make(schema({field("l", list(int32()))})));
+  ASSERT_RAISES(NotImplemented, RowConverter::Make(schema({field("s", large_utf8())})));
+
+  auto batch = RecordBatchFromJSON(schema({field("s", utf8())}), R"([["a"], ["bc"]])");
+  ASSERT_OK_AND_ASSIGN(auto converter, RowConverter::Make(batch->schema()));
+  auto other = RecordBatchFromJSON(schema({field("i", int32())}), "[[1]]");
+  ASSERT_RAISES(TypeError, converter->Encode(*other));
+
+  ASSERT_OK_AND_ASSIGN(EncodedRows rows, converter->Encode(*batch));
+  EncodedRows truncated = rows;
+  truncated.rows = SliceBuffer(rows.rows, 0, rows.rows->size() - 1);
+  ASSERT_RAISES(Invalid, converter->Decode(truncated));
+  EncodedRows no_offsets = rows;
+  no_offsets.offsets = nullptr;
+  ASSERT_RAISES(Invalid, converter->Decode(no_offsets));
+  EncodedRows too_many = rows;
+  too_many.num_rows = 3;
+  ASSERT_RAISES(Invalid, converter->Decode(too_many));
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -19,12 +19,14 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <string_view>
 #include <utility>
 
 #include "arrow/csv/lexing_internal.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging_internal.h"
 
 namespace arrow {
@@ -47,12 +49,15 @@ class Lexer {
   };
 
   explicit Lexer(const ParseOptions& options)
-      : options_(options), bulk_filter_(options_) {
+      : options_(options), bulk_filter_(options_), structural_index_(options_) {
     DCHECK_EQ(SpecializedOptions::quoting, options_.quoting);
     DCHECK_EQ(SpecializedOptions::escaping, options_.escaping);
   }
 
-  void Reset() { state_ = FIELD_START; }
+  void Reset() {
+    state_ = FIELD_START;
+    structural_index_.Reset();
+  }
 
   // Decide whether it's worth using a bulk filter over the given data area
   bool ShouldUseBulkFilter(const char* data, const char* data_end) {
@@ -237,6 +242,13 @@ class Lexer {
   using BulkWordType = typename BulkFilterType::WordType;
 
   const char* RunBulkFilter(const char* data, const char* data_end) {
+    // Skip whole blocks of plain characters using the structural bitmasks,
+    // then finish with the bulk filter on the trailing bytes.
+    bool found;
+    data = structural_index_.FindNext(data, data_end, &found);
+    if (found) {
+      return data;
+    }
     while (true) {
       if (ARROW_PREDICT_FALSE(static_cast<size_t>(data_end - data) <
                               sizeof(BulkWordType))) {
@@ -257,6 +269,7 @@ class Lexer {
 
   const ParseOptions& options_;
   const BulkFilterType bulk_filter_;
+  internal::StructuralIndex<SpecializedOptions> structural_index_;
   State state_ = FIELD_START;
 };
 
@@ -266,7 +279,7 @@ template <typename SpecializedOptions>
 class LexingBoundaryFinder : public BoundaryFinder {
  public:
   explicit LexingBoundaryFinder(ParseOptions options)
-      : options_(std::move(options)), lexer_(options_) {}
+      : options_(std::move(options)), lexer_(options_), scanner_(options_) {}
 
   Status FindFirst(std::string_view partial, std::string_view block,
                    int64_t* out_pos) override {
@@ -298,6 +311,9 @@ class LexingBoundaryFinder : public BoundaryFinder {
   }
 
   Status FindLast(std::string_view block, int64_t* out_pos) override {
+    if (FindLastStructural(block, out_pos)) {
+      return Status::OK();
+    }
     lexer_.Reset();
     if (lexer_.ShouldUseBulkFilter(block.data(), block.data() + block.size())) {
       return FindLastInternal<true>(block, out_pos);
@@ -330,6 +346,89 @@ class LexingBoundaryFinder : public BoundaryFinder {
     return Status::OK();
   }
 
+  // Find the last line end using structural bitmasks, simdjson-style.
+  //
+  // Whether a byte is inside a quoted cell is given by the parity of the
+  // number of quotes before it (a doubled quote toggles the parity twice).
+  // This only matches the lexer when all quotes are at cell boundaries, which
+  // is checked as we go; false is returned when the lexer must be used instead
+  // (escaping is enabled, or a quote appears in the middle of a cell).
+  bool FindLastStructural(std::string_view block, int64_t* out_pos) {
+    if constexpr (SpecializedOptions::escaping || !internal::kUseStructuralScan) {
+      return false;
+    } else {
+      constexpr int64_t kBlockSize = internal::kStructuralBlockSize;
+      const int64_t size = static_cast<int64_t>(block.size());
+      if (size < kBlockSize) {
+        // Not worth it
+        return false;
+      }
+      const bool double_quote = options_.double_quote;
+      // Carried over from the previous block: all ones if its last byte was
+      // inside quotes, and whether its last byte was a separator or a closing quote
+      uint64_t prev_in_quotes = 0;
+      uint64_t prev_separator = 1;  // the block starts on a line start
+      uint64_t prev_closing = 0;
+      // Closing quote at the end of the previous block, whose next byte is unchecked
+      bool pending_closing = false;
+      int64_t last_line_end = -1;
+
+      char tail[kBlockSize];
+      for (int64_t offset = 0; offset < size; offset += kBlockSize) {
+        const char* data = block.data() + offset;
+        const int64_t nbytes = std::min(kBlockSize, size - offset);
+        uint64_t valid = ~static_cast<uint64_t>(0);
+        if (nbytes < kBlockSize) {
+          memset(tail, 0, kBlockSize);
+          memcpy(tail, data, nbytes);
+          data = tail;
+          valid = (static_cast<uint64_t>(1) << nbytes) - 1;
+        }
+        const internal::StructuralMasks masks = scanner_.Scan(data);
+        const uint64_t separators = (masks.newlines | masks.delimiters) & valid;
+        const uint64_t quotes = masks.quotes & valid;
+
+        const uint64_t in_quotes = internal::PrefixXor(quotes) ^ prev_in_quotes;
+        const uint64_t opening = quotes & in_quotes;
+        const uint64_t closing = quotes & ~in_quotes;
+
+        // An opening quote must start a cell, or follow a closing quote
+        // (doubled quote inside a quoted cell)
+        uint64_t can_open = (separators << 1) | prev_separator;
+        if (double_quote) {
+          can_open |= (closing << 1) | prev_closing;
+        }
+        // A closing quote must end a cell, or precede an opening quote
+        uint64_t can_close = separators;
+        if (double_quote) {
+          can_close |= opening;
+        }
+        if (pending_closing && !(can_close & 1)) {
+          return false;
+        }
+        // The last valid byte's successor is checked with the next block
+        const int64_t last_bit = nbytes - 1;
+        const uint64_t checked = valid >> 1;
+        if ((opening & ~can_open) != 0 || (closing & checked & ~(can_close >> 1)) != 0) {
+          return false;
+        }
+        pending_closing = (closing >> last_bit) & 1;
+
+        const uint64_t line_ends = masks.newlines & valid & ~in_quotes;
+        if (line_ends != 0) {
+          last_line_end = offset + 63 - bit_util::CountLeadingZeros(line_ends);
+        }
+
+        prev_in_quotes = ((in_quotes >> last_bit) & 1) ? ~static_cast<uint64_t>(0) : 0;
+        prev_separator = (separators >> last_bit) & 1;
+        prev_closing = (closing >> last_bit) & 1;
+      }
+      // A line end is the position just after a newline character
+      *out_pos = (last_line_end < 0) ? -1 : last_line_end + 1;
+      return true;
+    }
+  }
+
   Status FindNth(std::string_view partial, std::string_view block, int64_t count,
                  int64_t* out_pos, int64_t* num_found) override {
     lexer_.Reset();
@@ -367,6 +466,7 @@ class LexingBoundaryFinder : public BoundaryFinder {
  protected:
   ParseOptions options_;
   Lexer<SpecializedOptions> lexer_;
+  const internal::StructuralScanner<SpecializedOptions> scanner_;
 };
 
 }  // namespace
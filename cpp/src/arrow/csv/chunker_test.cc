@@ -254,6 +254,26 @@ TEST_P(BaseChunkerTest, QuotesSpecial) {
   }
 }
 
+TEST_P(BaseChunkerTest, QuotingLongValues) {
+  // Values spanning several 64-byte blocks, to exercise the vectorized scan
+  const std::string quoted_value = "\"" + std::string(70, 'x') + "\"\"\n" +
+                                   std::string(60, 'y') + "\r\n\"\"z\"";
+  const std::string plain_value(100, 'w');
+  if (options_.newlines_in_values) {
+    MakeChunker();
+    auto csv = MakeCSVData({quoted_value + ",a\n", plain_value + "\n", "b,c\n"});
+    auto lengths = {quoted_value.size() + 3, plain_value.size() + 1, size_t(4)};
+    AssertChunking(*chunker_, csv, lengths);
+  }
+  {
+    // A quote in the middle of a value is not special
+    MakeChunker();
+    auto csv = MakeCSVData({"a,b\"" + plain_value + "\",\"d\"\n", plain_value + "\n"});
+    auto lengths = {plain_value.size() + 10, plain_value.size() + 1};
+    AssertChunking(*chunker_, csv, lengths);
+  }
+}
+
 TEST_P(BaseChunkerTest, Escaping) {
   {
     auto csv = MakeCSVData({"a\\b,c\n", "d\n"});
@@ -56,6 +56,14 @@ static std::shared_ptr<BlockParser> BuildInt64Data(int32_t num_rows) {
   return BuildFromExamples(base_rows, num_rows);
 }
 
+// Identifier-like values, with many digits
+static std::shared_ptr<BlockParser> BuildWideInt64Data(int32_t num_rows) {
+  const std::vector<std::string> base_rows = {
+      "1234567890123456\n", "20181113171110\n", "-9223372036854775807\n",
+      "\n", "4611686018427387904\n", "31415926535\n"};
+  return BuildFromExamples(base_rows, num_rows);
+}
+
 static std::shared_ptr<BlockParser> BuildFloatData(int32_t num_rows) {
   const std::vector<std::string> base_rows = {"0\n", "123.456\n", "-3170.55766\n", "\n",
                                               "N/A\n"};
@@ -111,6 +119,14 @@ static void Int64Conversion(benchmark::State& state) {  // NOLINT non-const refe
   BenchmarkConversion(state, *parser, int64(), options);
 }
 
+static void WideInt64Conversion(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto parser = BuildWideInt64Data(num_rows);
+  auto options = ConvertOptions::Defaults();
+
+  BenchmarkConversion(state, *parser, int64(), options);
+}
+
 static void FloatConversion(benchmark::State& state) {  // NOLINT non-const reference
   auto parser = BuildFloatData(num_rows);
   auto options = ConvertOptions::Defaults();
@@ -148,6 +164,7 @@ static void TimestampConversionStrptime(
 }
 
 BENCHMARK(Int64Conversion);
+BENCHMARK(WideInt64Conversion);
 BENCHMARK(FloatConversion);
 BENCHMARK(Decimal128Conversion);
 BENCHMARK(StringConversion);
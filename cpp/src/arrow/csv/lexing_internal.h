@@ -20,8 +20,13 @@
 #include <cstdint>
 
 #include "arrow/csv/options.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/simd.h"
 
+#if defined(__PCLMUL__) && (defined(__x86_64__) || defined(_M_X64))
+#  include <wmmintrin.h>
+#endif
+
 namespace arrow {
 namespace csv {
 namespace internal {
@@ -208,6 +213,232 @@ template <typename SpecializedOptions>
 using PreferredBulkFilterType = BloomFilter4B<SpecializedOptions>;
 #endif
 
+//
+// Structural indexing: classify 64 bytes at a time into bitmasks with one
+// bit per input byte (bit i set if byte i is a structural character).
+// The bitmasks can then be consumed with bit tricks instead of looking at
+// each byte.
+//
+
+static constexpr int64_t kStructuralBlockSize = 64;
+
+#if defined(ARROW_HAVE_AVX2) ||                                                 \
+    (defined(ARROW_HAVE_SSE4_2) && (defined(__x86_64__) || defined(_M_X64))) || \
+    defined(ARROW_HAVE_NEON)
+#  define ARROW_CSV_VECTORIZED_STRUCTURAL_SCAN 1
+#else
+#  define ARROW_CSV_VECTORIZED_STRUCTURAL_SCAN 0
+#endif
+
+// Without SIMD, building the bitmasks is slower than running the bulk filters
+static constexpr bool kUseStructuralScan = ARROW_CSV_VECTORIZED_STRUCTURAL_SCAN;
+
+struct StructuralMasks {
+  // '\r' or '\n'
+  uint64_t newlines;
+  uint64_t delimiters;
+  // Zero if quoting is disabled
+  uint64_t quotes;
+  // Zero if escaping is disabled
+  uint64_t escapes;
+
+  uint64_t any() const { return newlines | delimiters | quotes | escapes; }
+};
+
+// Compute the inclusive prefix XOR of `mask`: bit i of the result is the
+// parity of the bits 0..i of `mask`.  Applied to a quote bitmask, this gives
+// the bytes between an opening quote (included) and its closing quote (excluded).
+static inline uint64_t PrefixXor(uint64_t mask) {
+#if defined(__PCLMUL__) && (defined(__x86_64__) || defined(_M_X64))
+  // Carry-less multiplication by all ones
+  const __m128i v = _mm_clmulepi64_si128(_mm_set_epi64x(0, static_cast<int64_t>(mask)),
+                                         _mm_set1_epi8(-1), 0);
+  return static_cast<uint64_t>(_mm_cvtsi128_si64(v));
+#else
+  mask ^= mask << 1;
+  mask ^= mask << 2;
+  mask ^= mask << 4;
+  mask ^= mask << 8;
+  mask ^= mask << 16;
+  mask ^= mask << 32;
+  return mask;
+#endif
+}
+
+template <typename SpecializedOptions>
+class StructuralScanner {
+ public:
+  explicit StructuralScanner(const ParseOptions& options)
+      : delimiter_(static_cast<uint8_t>(options.delimiter)),
+        quote_(static_cast<uint8_t>(options.quote_char)),
+        escape_(static_cast<uint8_t>(options.escape_char)) {}
+
+  // Classify the kStructuralBlockSize bytes starting at `data`
+  StructuralMasks Scan(const char* data) const {
+    StructuralMasks masks;
+#if ARROW_CSV_VECTORIZED_STRUCTURAL_SCAN
+    masks.newlines =
+        MatchMask(data, [](Vector v) { return Or(Eq(v, '\n'), Eq(v, '\r')); });
+    masks.delimiters = MatchMask(data, [&](Vector v) { return Eq(v, delimiter_); });
+    masks.quotes = SpecializedOptions::quoting
+                       ? MatchMask(data, [&](Vector v) { return Eq(v, quote_); })
+                       : 0;
+    masks.escapes = SpecializedOptions::escaping
+                        ? MatchMask(data, [&](Vector v) { return Eq(v, escape_); })
+                        : 0;
+#else
+    masks.newlines = masks.delimiters = masks.quotes = masks.escapes = 0;
+    for (int i = 0; i < kStructuralBlockSize; ++i) {
+      const uint8_t c = static_cast<uint8_t>(data[i]);
+      masks.newlines |= static_cast<uint64_t>((c == '\n') | (c == '\r')) << i;
+      masks.delimiters |= static_cast<uint64_t>(c == delimiter_) << i;
+      if (SpecializedOptions::quoting) {
+        masks.quotes |= static_cast<uint64_t>(c == quote_) << i;
+      }
+      if (SpecializedOptions::escaping) {
+        masks.escapes |= static_cast<uint64_t>(c == escape_) << i;
+      }
+    }
+#endif
+    return masks;
+  }
+
+  // Same as Scan(data).any(), but cheaper
+  uint64_t ScanAny(const char* data) const {
+#if ARROW_CSV_VECTORIZED_STRUCTURAL_SCAN
+    return MatchMask(data, [&](Vector v) {
+      Vector m = Or(Or(Eq(v, '\n'), Eq(v, '\r')), Eq(v, delimiter_));
+      if (SpecializedOptions::quoting) {
+        m = Or(m, Eq(v, quote_));
+      }
+      if (SpecializedOptions::escaping) {
+        m = Or(m, Eq(v, escape_));
+      }
+      return m;
+    });
+#else
+    return Scan(data).any();
+#endif
+  }
+
+ private:
+#if defined(ARROW_HAVE_AVX2)
+  using Vector = __m256i;
+
+  static Vector Eq(Vector v, uint8_t c) {
+    return _mm256_cmpeq_epi8(v, _mm256_set1_epi8(static_cast<char>(c)));
+  }
+  static Vector Or(Vector a, Vector b) { return _mm256_or_si256(a, b); }
+
+  // Compute `match` over the block and gather its result into one bit per byte
+  template <typename Match>
+  static uint64_t MatchMask(const char* data, Match&& match) {
+    const auto words = reinterpret_cast<const __m256i*>(data);
+    const auto lo = static_cast<uint32_t>(
+        _mm256_movemask_epi8(match(_mm256_loadu_si256(words))));
+    const auto hi = static_cast<uint32_t>(
+        _mm256_movemask_epi8(match(_mm256_loadu_si256(words + 1))));
+    return static_cast<uint64_t>(lo) | (static_cast<uint64_t>(hi) << 32);
+  }
+#elif defined(ARROW_HAVE_SSE4_2) && (defined(__x86_64__) || defined(_M_X64))
+  using Vector = __m128i;
+
+  static Vector Eq(Vector v, uint8_t c) {
+    return _mm_cmpeq_epi8(v, _mm_set1_epi8(static_cast<char>(c)));
+  }
+  static Vector Or(Vector a, Vector b) { return _mm_or_si128(a, b); }
+
+  template <typename Match>
+  static uint64_t MatchMask(const char* data, Match&& match) {
+    const auto words = reinterpret_cast<const __m128i*>(data);
+    uint64_t mask = 0;
+    for (int i = 0; i < 4; ++i) {
+      const auto m =
+          static_cast<uint16_t>(_mm_movemask_epi8(match(_mm_loadu_si128(words + i))));
+      mask |= static_cast<uint64_t>(m) << (16 * i);
+    }
+    return mask;
+  }
+#elif defined(ARROW_HAVE_NEON)
+  using Vector = uint8x16_t;
+
+  static Vector Eq(Vector v, uint8_t c) { return vceqq_u8(v, vdupq_n_u8(c)); }
+  static Vector Or(Vector a, Vector b) { return vorrq_u8(a, b); }
+
+  template <typename Match>
+  static uint64_t MatchMask(const char* data, Match&& match) {
+    // NEON has no movemask, so weigh each matching byte by its bit position
+    // and add adjacent lanes pairwise until 64 bits remain.
+    static const uint8_t kBitWeights[16] = {1, 2, 4, 8, 16, 32, 64, 128,
+                                            1, 2, 4, 8, 16, 32, 64, 128};
+    const uint8x16_t weights = vld1q_u8(kBitWeights);
+    const auto bytes = reinterpret_cast<const uint8_t*>(data);
+    uint8x16_t t[4];
+    for (int i = 0; i < 4; ++i) {
+      t[i] = vandq_u8(match(vld1q_u8(bytes + 16 * i)), weights);
+    }
+    uint8x16_t sum = vpaddq_u8(vpaddq_u8(t[0], t[1]), vpaddq_u8(t[2], t[3]));
+    sum = vpaddq_u8(sum, sum);
+    return vgetq_lane_u64(vreinterpretq_u64_u8(sum), 0);
+  }
+#endif
+
+  const uint8_t delimiter_, quote_, escape_;
+};
+
+// Find structural characters using bitmasks computed over
+// kStructuralBlockSize-byte blocks.
+//
+// The bitmask of the last scanned block is kept, so that successive lookups
+// in the same block (e.g. for consecutive short cells) don't rescan it.
+// An index must not outlive the data it is looking at.
+template <typename SpecializedOptions>
+class StructuralIndex {
+ public:
+  explicit StructuralIndex(const ParseOptions& options) : scanner_(options) {}
+
+  void Reset() {
+    block_start_ = 0;
+    block_mask_ = 0;
+  }
+
+  // Skip over non-structural characters starting from `data`.
+  //
+  // Returns the position of the next structural character, if any is found
+  // in the kStructuralBlockSize-byte blocks that fit before `data_end`.
+  // Otherwise, returns the start of the trailing bytes that are too short
+  // to be scanned (`*found` is then false).
+  const char* FindNext(const char* data, const char* data_end, bool* found) {
+    if constexpr (!kUseStructuralScan) {
+      *found = false;
+      return data;
+    }
+    while (true) {
+      const auto pos = reinterpret_cast<uintptr_t>(data);
+      if (pos - block_start_ < static_cast<uintptr_t>(kStructuralBlockSize)) {
+        const uint64_t mask = block_mask_ >> (pos - block_start_);
+        if (mask != 0) {
+          *found = true;
+          return data + bit_util::CountTrailingZeros(mask);
+        }
+        data += block_start_ + kStructuralBlockSize - pos;
+      }
+      if (data_end - data < kStructuralBlockSize) {
+        *found = false;
+        return data;
+      }
+      block_start_ = reinterpret_cast<uintptr_t>(data);
+      block_mask_ = scanner_.ScanAny(data);
+    }
+  }
+
+ private:
+  const StructuralScanner<SpecializedOptions> scanner_;
+  // Address of the last scanned block (0 if none) and its structural mask
+  uintptr_t block_start_ = 0;
+  uint64_t block_mask_ = 0;
+};
+
 }  // namespace internal
 }  // namespace csv
 }  // namespace arrow
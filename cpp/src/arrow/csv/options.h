@@ -163,6 +163,13 @@ struct ARROW_EXPORT ReadOptions {
   /// If false, column names will be read from the first CSV row after `skip_rows`.
   bool autogenerate_column_names = false;
 
+  /// \brief Whether the streaming reader emits batches in file order.
+  ///
+  /// When using threads, the streaming reader parses and converts several blocks
+  /// in parallel.  If false, each batch is emitted as soon as it is ready, which
+  /// may be out of file order.  This has no effect on the table reader.
+  bool preserve_order = true;
+
   /// Create read options with default values
   static ReadOptions Defaults();
 
@@ -215,6 +222,12 @@ struct ARROW_EXPORT WriteOptions {
   /// effect of quoting all column names.
   QuotingStyle quoting_header = QuotingStyle::Needed;
 
+  /// \brief Whether to use the global CPU thread pool
+  ///
+  /// If true, batches of `batch_size` rows are converted to CSV in parallel,
+  /// while already converted batches are written out in order.
+  bool use_threads = false;
+
   /// Create write options with default values
   static WriteOptions Defaults();
 
@@ -26,6 +26,7 @@
 #include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/buffer_pool.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/simd.h"
 
@@ -59,18 +60,27 @@ Status MismatchingColumns(const InvalidRow& row) {
 
 inline bool IsControlChar(uint8_t c) { return c < ' '; }
 
+// Allocate a buffer for parsed data, recycled through `buffer_pool` if not null
+Result<std::shared_ptr<ResizableBuffer>> AllocateParsedBuffer(
+    MemoryPool* pool, util::BufferPool* buffer_pool, int64_t size) {
+  if (buffer_pool != nullptr) {
+    return buffer_pool->Acquire(size);
+  }
+  return AllocateResizableBuffer(size, pool);
+}
+
 // A helper class allocating the buffer for parsed values and writing into it
 // without any further resizes, except at the end.
 class PresizedDataWriter {
  public:
-  PresizedDataWriter(MemoryPool* pool, uint32_t size)
-      : parsed_size_(0), parsed_capacity_(size) {
-    parsed_buffer_ = *AllocateResizableBuffer(parsed_capacity_, pool);
+  PresizedDataWriter(MemoryPool* pool, util::BufferPool* buffer_pool, uint32_t size)
+      : parsed_size_(0), parsed_capacity_(size), shrink_to_fit_(buffer_pool == nullptr) {
+    parsed_buffer_ = *AllocateParsedBuffer(pool, buffer_pool, parsed_capacity_);
     parsed_ = parsed_buffer_->mutable_data();
   }
 
   void Finish(std::shared_ptr<Buffer>* out_parsed) {
-    ARROW_CHECK_OK(parsed_buffer_->Resize(parsed_size_));
+    ARROW_CHECK_OK(parsed_buffer_->Resize(parsed_size_, shrink_to_fit_));
     *out_parsed = parsed_buffer_;
   }
 
@@ -88,6 +98,12 @@ class PresizedDataWriter {
     parsed_size_ += sizeof(w);
   }
 
+  void PushFieldBytes(const char* data, int64_t nbytes) {
+    DCHECK_GE(parsed_capacity_ - parsed_size_, nbytes);
+    memcpy(parsed_ + parsed_size_, data, static_cast<size_t>(nbytes));
+    parsed_size_ += nbytes;
+  }
+
   // Rollback the state that was saved in BeginLine()
   void RollbackLine() { parsed_size_ = saved_parsed_size_; }
 
@@ -98,6 +114,8 @@ class PresizedDataWriter {
   uint8_t* parsed_;
   int64_t parsed_size_;
   int64_t parsed_capacity_;
+  // Recycled buffers keep their capacity
+  bool shrink_to_fit_;
   // Checkpointing, for when an incomplete line is encountered at end of block
   int64_t saved_parsed_size_;
 };
@@ -127,7 +145,8 @@ class ValueDescWriter {
   }
 
   Result<std::shared_ptr<Buffer>> Finish() {
-    RETURN_NOT_OK(values_buffer_->Resize(values_size_ * sizeof(*values_)));
+    RETURN_NOT_OK(
+        values_buffer_->Resize(values_size_ * sizeof(*values_), shrink_to_fit_));
     return std::move(values_buffer_);
   }
 
@@ -143,14 +162,17 @@ class ValueDescWriter {
   }
 
  protected:
-  ValueDescWriter(MemoryPool* pool, int64_t values_capacity)
+  ValueDescWriter(MemoryPool* pool, util::BufferPool* buffer_pool,
+                  int64_t values_capacity)
       : values_size_(0),
         values_capacity_(values_capacity),
         quoted_(false),
         saved_values_size_(0),
+        shrink_to_fit_(buffer_pool == nullptr),
         status_(Status::OK()) {
-    status_ &= AllocateResizableBuffer(values_capacity_ * sizeof(*values_), pool)
-                   .Value(&values_buffer_);
+    status_ &=
+        AllocateParsedBuffer(pool, buffer_pool, values_capacity_ * sizeof(*values_))
+            .Value(&values_buffer_);
     if (status_.ok()) {
       values_ = reinterpret_cast<ParsedValueDesc*>(values_buffer_->mutable_data());
     }
@@ -163,6 +185,8 @@ class ValueDescWriter {
   bool quoted_;
   // Checkpointing, for when an incomplete line is encountered at end of block
   int64_t saved_values_size_;
+  // Recycled buffers keep their capacity
+  bool shrink_to_fit_;
   Status status_;
 };
 
@@ -171,8 +195,8 @@ class ValueDescWriter {
 // efficiently presize the target area for a given number of rows.
 class ResizableValueDescWriter : public ValueDescWriter<ResizableValueDescWriter> {
  public:
-  explicit ResizableValueDescWriter(MemoryPool* pool)
-      : ValueDescWriter(pool, /*values_capacity=*/256) {}
+  ResizableValueDescWriter(MemoryPool* pool, util::BufferPool* buffer_pool)
+      : ValueDescWriter(pool, buffer_pool, /*values_capacity=*/256) {}
 
   void PushValue(ParsedValueDesc v) {
     if (ARROW_PREDICT_FALSE(values_size_ == values_capacity_)) {
@@ -203,8 +227,9 @@ class PresizedValueDescWriter : public ValueDescWriter<PresizedValueDescWriter>
   // The number of offsets being written will be `1 + num_rows * num_cols`,
   // however we allow for one extraneous write in case of excessive columns,
   // hence `2 + num_rows * num_cols` (see explanation in PushValue below).
-  PresizedValueDescWriter(MemoryPool* pool, int32_t num_rows, int32_t num_cols)
-      : ValueDescWriter(pool, /*values_capacity=*/2 + num_rows * num_cols) {}
+  PresizedValueDescWriter(MemoryPool* pool, util::BufferPool* buffer_pool,
+                          int32_t num_rows, int32_t num_cols)
+      : ValueDescWriter(pool, buffer_pool, /*values_capacity=*/2 + num_rows * num_cols) {}
 
   void PushValue(ParsedValueDesc v) {
     DCHECK_LT(values_size_, values_capacity_);
@@ -227,9 +252,11 @@ class PresizedValueDescWriter : public ValueDescWriter<PresizedValueDescWriter>
 
 class BlockParserImpl {
  public:
-  BlockParserImpl(MemoryPool* pool, ParseOptions options, int32_t num_cols,
-                  int64_t first_row, int32_t max_num_rows)
+  BlockParserImpl(MemoryPool* pool, std::shared_ptr<util::BufferPool> buffer_pool,
+                  ParseOptions options, int32_t num_cols, int64_t first_row,
+                  int32_t max_num_rows)
       : pool_(pool),
+        buffer_pool_(std::move(buffer_pool)),
         options_(std::move(options)),
         first_row_(first_row),
         max_num_rows_(max_num_rows),
@@ -279,7 +306,8 @@ class BlockParserImpl {
             typename DataWriter, typename BulkFilter>
   Status ParseLine(ValueDescWriter* values_writer, DataWriter* parsed_writer,
                    const char* data, const char* data_end, bool is_final,
-                   const char** out_data, const BulkFilter& bulk_filter) {
+                   const char** out_data, const BulkFilter& bulk_filter,
+                   internal::StructuralIndex<SpecializedOptions>* structural_index) {
     int32_t num_cols = 0;
     char c;
     const auto start = data;
@@ -337,7 +365,8 @@ class BlockParserImpl {
   InField:
     // Inside a non-quoted part of a field
     if (UseBulkFilter) {
-      const char* bulk_end = RunBulkFilter(parsed_writer, data, data_end, bulk_filter);
+      const char* bulk_end =
+          RunBulkFilter(parsed_writer, data, data_end, bulk_filter, structural_index);
       if (ARROW_PREDICT_FALSE(bulk_end == nullptr)) {
         if (is_final) {
           data = data_end;
@@ -381,7 +410,8 @@ class BlockParserImpl {
   InQuotedField:
     // Inside a quoted part of a field
     if (UseBulkFilter) {
-      const char* bulk_end = RunBulkFilter(parsed_writer, data, data_end, bulk_filter);
+      const char* bulk_end =
+          RunBulkFilter(parsed_writer, data, data_end, bulk_filter, structural_index);
       if (ARROW_PREDICT_FALSE(bulk_end == nullptr)) {
         if (is_final) {
           data = data_end;
@@ -468,10 +498,21 @@ class BlockParserImpl {
     return Status::OK();
   }
 
-  template <typename DataWriter, typename SpecializedBulkFilter>
+  template <typename DataWriter, typename SpecializedBulkFilter,
+            typename SpecializedStructuralIndex>
   const char* RunBulkFilter(DataWriter* data_writer, const char* data,
                             const char* data_end,
-                            const SpecializedBulkFilter& bulk_filter) {
+                            const SpecializedBulkFilter& bulk_filter,
+                            SpecializedStructuralIndex* structural_index) {
+    // Skip whole blocks of plain characters using the structural bitmasks,
+    // then finish with the bulk filter on the trailing bytes.
+    bool found;
+    const char* next = structural_index->FindNext(data, data_end, &found);
+    data_writer->PushFieldBytes(data, next - data);
+    if (found) {
+      return next;
+    }
+    data = next;
     while (true) {
       using WordType = typename SpecializedBulkFilter::WordType;
 
@@ -497,7 +538,8 @@ class BlockParserImpl {
   Status ParseChunk(ValueDescWriter* values_writer, DataWriter* parsed_writer,
                     const char* data, const char* data_end, bool is_final,
                     int32_t rows_in_chunk, const char** out_data, bool* finished_parsing,
-                    const BulkFilter& bulk_filter) {
+                    const BulkFilter& bulk_filter,
+                    internal::StructuralIndex<SpecializedOptions>* structural_index) {
     const int32_t start_num_rows = batch_.num_rows_;
     const int32_t num_rows_deadline = batch_.num_rows_ + rows_in_chunk;
 
@@ -506,7 +548,8 @@ class BlockParserImpl {
         const char* line_end = data;
         RETURN_NOT_OK((ParseLine<SpecializedOptions, true>(values_writer, parsed_writer,
                                                            data, data_end, is_final,
-                                                           &line_end, bulk_filter)));
+                                                           &line_end, bulk_filter,
+                                                           structural_index)));
         RETURN_NOT_OK(values_writer->status());
         if (line_end == data) {
           // Cannot parse any further
@@ -520,7 +563,8 @@ class BlockParserImpl {
         const char* line_end = data;
         RETURN_NOT_OK((ParseLine<SpecializedOptions, false>(values_writer, parsed_writer,
                                                             data, data_end, is_final,
-                                                            &line_end, bulk_filter)));
+                                                            &line_end, bulk_filter,
+                                                            structural_index)));
         RETURN_NOT_OK(values_writer->status());
         if (line_end == data) {
           // Cannot parse any further
@@ -555,6 +599,7 @@ class BlockParserImpl {
   Status ParseSpecialized(const std::vector<std::string_view>& views, bool is_final,
                           uint32_t* out_size) {
     internal::PreferredBulkFilterType<SpecializedOptions> bulk_filter(options_);
+    internal::StructuralIndex<SpecializedOptions> structural_index(options_);
 
     batch_ = DataBatch{batch_.num_cols_};
     values_size_ = 0;
@@ -567,7 +612,8 @@ class BlockParserImpl {
       return Status::Invalid("CSV block too large");
     }
 
-    PresizedDataWriter parsed_writer(pool_, static_cast<uint32_t>(total_view_length));
+    PresizedDataWriter parsed_writer(pool_, buffer_pool_.get(),
+                                     static_cast<uint32_t>(total_view_length));
     uint32_t total_parsed_length = 0;
 
     for (const auto& view : views) {
@@ -579,12 +625,13 @@ class BlockParserImpl {
         // Can't presize values when the number of columns is not known, first parse
         // a single line
         const int32_t rows_in_chunk = 1;
-        ARROW_ASSIGN_OR_RAISE(auto values_writer, ResizableValueDescWriter::Make(pool_));
+        ARROW_ASSIGN_OR_RAISE(auto values_writer,
+                              ResizableValueDescWriter::Make(pool_, buffer_pool_.get()));
         values_writer.Start(parsed_writer);
 
         RETURN_NOT_OK(ParseChunk<SpecializedOptions>(
             &values_writer, &parsed_writer, data, data_end, is_final, rows_in_chunk,
-            &data, &finished_parsing, bulk_filter));
+            &data, &finished_parsing, bulk_filter, &structural_index));
         if (batch_.num_cols_ == -1) {
           return ParseError("Empty CSV file or block: cannot infer number of columns");
         }
@@ -606,12 +653,13 @@ class BlockParserImpl {
 
         ARROW_ASSIGN_OR_RAISE(
             auto values_writer,
-            PresizedValueDescWriter::Make(pool_, rows_in_chunk, batch_.num_cols_));
+            PresizedValueDescWriter::Make(pool_, buffer_pool_.get(), rows_in_chunk,
+                                          batch_.num_cols_));
         values_writer.Start(parsed_writer);
 
         RETURN_NOT_OK(ParseChunk<SpecializedOptions>(
             &values_writer, &parsed_writer, data, data_end, is_final, rows_in_chunk,
-            &data, &finished_parsing, bulk_filter));
+            &data, &finished_parsing, bulk_filter, &structural_index));
       }
       DCHECK_GE(data, view.data());
       DCHECK_LE(data, data_end);
@@ -673,6 +721,7 @@ class BlockParserImpl {
 
  protected:
   MemoryPool* pool_;
+  std::shared_ptr<util::BufferPool> buffer_pool_;
   const ParseOptions options_;
   const int64_t first_row_;
   // The maximum number of rows to parse from a block
@@ -692,8 +741,16 @@ BlockParser::BlockParser(ParseOptions options, int32_t num_cols, int64_t first_r
 
 BlockParser::BlockParser(MemoryPool* pool, ParseOptions options, int32_t num_cols,
                          int64_t first_row, int32_t max_num_rows)
-    : impl_(new BlockParserImpl(pool, std::move(options), num_cols, first_row,
-                                max_num_rows)) {}
+    : impl_(new BlockParserImpl(pool, /*buffer_pool=*/nullptr, std::move(options),
+                                num_cols, first_row, max_num_rows)) {}
+
+BlockParser::BlockParser(std::shared_ptr<util::BufferPool> buffer_pool,
+                         ParseOptions options, int32_t num_cols, int64_t first_row,
+                         int32_t max_num_rows) {
+  MemoryPool* pool = buffer_pool->memory_pool();
+  impl_.reset(new BlockParserImpl(pool, std::move(buffer_pool), std::move(options),
+                                  num_cols, first_row, max_num_rows));
+}
 
 BlockParser::~BlockParser() {}
 
@@ -29,6 +29,7 @@
 #include "arrow/csv/type_fwd.h"
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -164,6 +165,13 @@ class ARROW_EXPORT BlockParser {
                        int64_t first_row = -1, int32_t max_num_rows = kMaxParserNumRows);
   explicit BlockParser(MemoryPool* pool, ParseOptions options, int32_t num_cols = -1,
                        int64_t first_row = -1, int32_t max_num_rows = kMaxParserNumRows);
+  /// \brief Create a parser allocating parsed data from `buffer_pool`
+  ///
+  /// The buffers of the parsed data are recycled once they are released, which
+  /// avoids allocating fresh memory for each block when parsing many blocks.
+  explicit BlockParser(std::shared_ptr<util::BufferPool> buffer_pool,
+                       ParseOptions options, int32_t num_cols = -1,
+                       int64_t first_row = -1, int32_t max_num_rows = kMaxParserNumRows);
   ~BlockParser();
 
   /// \brief Parse a block of data
@@ -64,6 +64,17 @@ const Example stocks_example{
 4,2010-01-04 00:00:00,600289,亿阳信通,602926.359,602926.359,16393247.138998777,167754890.0,10.381817699665978,9.960037526145015,10.092597009251604,10.321563389162982,,10.233170315655089,4.436963485334562,0.6025431050299465
 )"};
 
+// NOTE: quoted, with newlines and quotes in long values
+const Example text_example{
+    2,
+    R"(1,"Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt
+ut labore et dolore magna aliqua. Ut enim ad minim veniam, quis nostrud ""exercitation"" ullamco
+laboris nisi ut aliquip ex ea commodo consequat.",2020-01-01,"en"
+2,"Duis aute irure dolor in reprehenderit in voluptate velit esse cillum dolore eu fugiat nulla
+pariatur. Excepteur sint occaecat cupidatat non proident, sunt in culpa qui officia deserunt
+mollit anim id est laborum.",2020-01-02,"la"
+)"};
+
 static constexpr int32_t kNumRows = 10000;
 
 static std::string BuildCSVData(const Example& example) {
@@ -155,6 +166,13 @@ static void ChunkCSVStocksExample(
   BenchmarkCSVChunking(state, stocks_example, options);
 }
 
+static void ChunkCSVTextExample(benchmark::State& state) {  // NOLINT non-const reference
+  auto options = ParseOptions::Defaults();
+  options.newlines_in_values = true;
+
+  BenchmarkCSVChunking(state, text_example, options);
+}
+
 static void BenchmarkCSVParsing(benchmark::State& state,  // NOLINT non-const reference
                                 const std::string& csv, int32_t num_rows,
                                 ParseOptions options) {
@@ -224,18 +242,24 @@ static void ParseCSVStocksExample(
   BenchmarkCSVParsing(state, stocks_example, ParseOptions::Defaults());
 }
 
+static void ParseCSVTextExample(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkCSVParsing(state, text_example, ParseOptions::Defaults());
+}
+
 BENCHMARK(ChunkCSVQuotedBlock);
 BENCHMARK(ChunkCSVEscapedBlock);
 BENCHMARK(ChunkCSVNoNewlinesBlock);
 BENCHMARK(ChunkCSVFlightsExample);
 BENCHMARK(ChunkCSVVehiclesExample);
 BENCHMARK(ChunkCSVStocksExample);
+BENCHMARK(ChunkCSVTextExample);
 
 BENCHMARK(ParseCSVQuotedBlock);
 BENCHMARK(ParseCSVEscapedBlock);
 BENCHMARK(ParseCSVFlightsExample);
 BENCHMARK(ParseCSVVehiclesExample);
 BENCHMARK(ParseCSVStocksExample);
+BENCHMARK(ParseCSVTextExample);
 
 }  // namespace csv
 }  // namespace arrow
@@ -31,6 +31,7 @@
 #include "arrow/csv/test_common.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/buffer_pool.h"
 
 namespace arrow {
 namespace csv {
@@ -326,6 +327,23 @@ TEST(BlockParser, MaxNumRows) {
   AssertColumnsEq(parser, {{}});
 }
 
+TEST(BlockParser, BufferPool) {
+  auto buffer_pool = util::BufferPool::Make(default_memory_pool());
+  BlockParser parser(buffer_pool, ParseOptions::Defaults());
+
+  auto csv = MakeCSVData({"ab,cd\n", "ef,gh\n"});
+  AssertParseOk(parser, csv);
+  AssertColumnsEq(parser, {{"ab", "ef"}, {"cd", "gh"}});
+  const int64_t num_acquired = buffer_pool->num_acquired();
+  ASSERT_GT(num_acquired, 0);
+
+  // The buffers of the previous block are recycled
+  AssertParseOk(parser, csv);
+  AssertColumnsEq(parser, {{"ab", "ef"}, {"cd", "gh"}});
+  ASSERT_GT(buffer_pool->num_acquired(), num_acquired);
+  ASSERT_GT(buffer_pool->num_reused(), 0);
+}
+
 TEST(BlockParser, EmptyLinesWithOneColumn) {
   auto csv = MakeCSVData({"a\n", "\n", "b\r", "\r", "c\r\n", "\r\n", "d\n"});
   {
@@ -43,6 +43,7 @@
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/async_generator.h"
+#include "arrow/util/buffer_pool.h"
 #include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging_internal.h"
@@ -388,12 +389,14 @@ namespace {
 // The parsed batch contains a list of offsets for each of the columns so that columns
 // can be individually scanned
 //
-// This operator is not reentrant
+// This operator is not reentrant, unless rows are not counted and blocks don't
+// need consume_bytes (i.e. they come from a ThreadedBlockReader)
 class BlockParsingOperator {
  public:
   BlockParsingOperator(io::IOContext io_context, ParseOptions parse_options,
                        int num_csv_cols, int64_t first_row)
       : io_context_(io_context),
+        buffer_pool_(util::BufferPool::Make(io_context_.pool())),
         parse_options_(parse_options),
         num_csv_cols_(num_csv_cols),
         count_rows_(first_row >= 0),
@@ -402,8 +405,9 @@ class BlockParsingOperator {
   // TODO: this is almost entirely the same as ReaderMixin::Parse(). Refactor?
   Result<ParsedBlock> operator()(const CSVBlock& block) {
     constexpr int32_t max_num_rows = std::numeric_limits<int32_t>::max();
-    auto parser = std::make_shared<BlockParser>(
-        io_context_.pool(), parse_options_, num_csv_cols_, num_rows_seen_, max_num_rows);
+    auto parser = std::make_shared<BlockParser>(buffer_pool_, parse_options_,
+                                                num_csv_cols_, num_rows_seen_,
+                                                max_num_rows);
 
     std::shared_ptr<Buffer> straddling;
     std::vector<std::string_view> views;
@@ -456,6 +460,8 @@ class BlockParsingOperator {
 
  private:
   io::IOContext io_context_;
+  // Recycles the parsed data buffers once the decoded batches no longer need them
+  std::shared_ptr<util::BufferPool> buffer_pool_;
   const ParseOptions parse_options_;
   const int num_csv_cols_;
   const bool count_rows_;
@@ -851,6 +857,7 @@ class StreamingReaderImpl : public ReaderMixin,
 
     auto buffer_generator = CSVBufferIterator::MakeAsync(std::move(transferred_it));
 
+    cpu_executor_ = cpu_executor;
     int max_readahead = cpu_executor->GetCapacity();
     auto self = shared_from_this();
 
@@ -875,6 +882,13 @@ class StreamingReaderImpl : public ReaderMixin,
   }
 
  protected:
+  // Whether blocks are parsed and decoded in parallel on the CPU executor.
+  // Rows are not counted in that case, since blocks may be parsed out of order.
+  bool parallel() const { return !count_rows_; }
+
+  template <typename Block>
+  using BlockDecoder = std::function<Future<DecodedBlock>(const Block&)>;
+
   Future<> InitAfterFirstBuffer(const std::shared_ptr<Buffer>& first_buffer,
                                 AsyncGenerator<std::shared_ptr<Buffer>> buffer_generator,
                                 int max_readahead) {
@@ -891,20 +905,57 @@ class StreamingReaderImpl : public ReaderMixin,
         auto decoder_op,
         BlockDecodingOperator::Make(io_context_, convert_options_, conversion_schema_));
 
-    auto block_gen = SerialBlockReader::MakeAsyncIterator(
-        std::move(buffer_generator), MakeChunker(parse_options_), std::move(after_header),
-        read_options_.skip_rows_after_names);
-    auto parsed_block_gen = MakeMappedGenerator(std::move(block_gen), *parsing_operator_);
-    auto rb_gen = MakeMappedGenerator(std::move(parsed_block_gen), std::move(decoder_op));
+    if (!parallel()) {
+      auto block_gen = SerialBlockReader::MakeAsyncIterator(
+          std::move(buffer_generator), MakeChunker(parse_options_),
+          std::move(after_header), read_options_.skip_rows_after_names);
+      // Parsing must be done before the next block is read, so it is mapped
+      // separately from decoding
+      auto parsed_block_gen =
+          MakeMappedGenerator(std::move(block_gen), *parsing_operator_);
+      return InitFromBlockGenerator<ParsedBlock>(std::move(parsed_block_gen),
+                                                 std::move(decoder_op), max_readahead,
+                                                 /*prev_bytes_processed=*/0);
+    }
+
+    // Blocks are self-contained and rows are not counted, so blocks can be parsed
+    // concurrently (the parsing operator is not mutated).
+    auto block_gen = ThreadedBlockReader::MakeAsyncIterator(
+        std::move(buffer_generator), MakeChunker(parse_options_),
+        std::move(after_header), read_options_.skip_rows_after_names);
+    auto parsing_op = std::make_shared<BlockParsingOperator>(*parsing_operator_);
+    auto cpu_executor = cpu_executor_;
+    auto stop_token = io_context_.stop_token();
+    auto parse_and_decode = [parsing_op, decoder_op, cpu_executor,
+                             stop_token](const CSVBlock& block) -> Future<DecodedBlock> {
+      auto parsed_fut = DeferNotOk(cpu_executor->Submit(
+          stop_token, [parsing_op, block] { return (*parsing_op)(block); }));
+      return parsed_fut.Then(decoder_op);
+    };
+    return InitFromBlockGenerator<CSVBlock>(std::move(block_gen),
+                                            std::move(parse_and_decode), max_readahead,
+                                            /*prev_bytes_processed=*/0);
+  }
 
+  // Decode blocks one at a time until the first non-empty one, which determines
+  // the schema (and freezes inferred column types).
+  template <typename Block>
+  Future<> InitFromBlockGenerator(AsyncGenerator<Block> block_gen,
+                                  BlockDecoder<Block> decode, int max_readahead,
+                                  int64_t prev_bytes_processed) {
+    auto rb_gen = MakeMappedGenerator(block_gen, decode);
     auto self = shared_from_this();
-    return rb_gen().Then([self, rb_gen, max_readahead](const DecodedBlock& first_block) {
-      return self->InitFromBlock(first_block, std::move(rb_gen), max_readahead, 0);
+    return rb_gen().Then([self, block_gen, decode, max_readahead,
+                          prev_bytes_processed](const DecodedBlock& first_block) {
+      return self->InitFromBlock<Block>(first_block, std::move(block_gen),
+                                        std::move(decode), max_readahead,
+                                        prev_bytes_processed);
     });
   }
 
-  Future<> InitFromBlock(const DecodedBlock& block,
-                         AsyncGenerator<DecodedBlock> batch_gen, int max_readahead,
+  template <typename Block>
+  Future<> InitFromBlock(const DecodedBlock& block, AsyncGenerator<Block> block_gen,
+                         BlockDecoder<Block> decode, int max_readahead,
                          int64_t prev_bytes_processed) {
     if (!block.record_batch) {
       // End of file just return null batches
@@ -916,20 +967,29 @@ class StreamingReaderImpl : public ReaderMixin,
 
     if (block.record_batch->num_rows() == 0) {
       // Keep consuming blocks until the first non empty block is found
-      auto self = shared_from_this();
-      prev_bytes_processed += block.bytes_processed;
-      return batch_gen().Then([self, batch_gen, max_readahead,
-                               prev_bytes_processed](const DecodedBlock& next_block) {
-        return self->InitFromBlock(next_block, std::move(batch_gen), max_readahead,
-                                   prev_bytes_processed);
-      });
+      return InitFromBlockGenerator<Block>(std::move(block_gen), std::move(decode),
+                                           max_readahead,
+                                           prev_bytes_processed + block.bytes_processed);
     }
 
+    // The remaining blocks are parsed and decoded up to `max_readahead` at a time
     AsyncGenerator<DecodedBlock> readahead_gen;
-    if (read_options_.use_threads) {
-      readahead_gen = MakeReadaheadGenerator(std::move(batch_gen), max_readahead);
+    if (parallel() && !read_options_.preserve_order) {
+      // Deliver each block as soon as it is decoded
+      auto block_subscriptions =
+          MakeMappedGenerator(std::move(block_gen), [decode](const Block& block) {
+            return MakeFromFuture(decode(block).Then([](const DecodedBlock& decoded) {
+              return MakeVectorGenerator<DecodedBlock>({decoded});
+            }));
+          });
+      readahead_gen = MakeMergedGenerator(std::move(block_subscriptions), max_readahead);
     } else {
-      readahead_gen = std::move(batch_gen);
+      auto batch_gen = MakeMappedGenerator(std::move(block_gen), std::move(decode));
+      if (read_options_.use_threads) {
+        readahead_gen = MakeReadaheadGenerator(std::move(batch_gen), max_readahead);
+      } else {
+        readahead_gen = std::move(batch_gen);
+      }
     }
 
     AsyncGenerator<DecodedBlock> restarted_gen =
@@ -951,6 +1011,7 @@ class StreamingReaderImpl : public ReaderMixin,
     return Status::OK();
   }
 
+  Executor* cpu_executor_ = nullptr;
   std::shared_ptr<Schema> schema_;
   AsyncGenerator<std::shared_ptr<RecordBatch>> record_batch_gen_;
   // bytes which have been decoded and asked for by the caller
@@ -57,7 +57,10 @@ class ARROW_EXPORT TableReader {
 /// \brief A class that reads a CSV file incrementally
 ///
 /// Caveats:
-/// - For now, this is always single-threaded (regardless of `ReadOptions::use_threads`.
+/// - If `ReadOptions::use_threads` is true, up to one block per CPU thread is
+///   parsed and converted in parallel ahead of the consumer.  Batches are emitted
+///   in file order unless `ReadOptions::preserve_order` is false.  Row numbers are
+///   not reported in parse errors in that mode.
 /// - Type inference is done on the first block and types are frozen afterwards;
 ///   to make sure the right data types are inferred, either set
 ///   `ReadOptions::block_size` to a large enough value, or use
@@ -88,8 +91,7 @@ class ARROW_EXPORT StreamingReader : public RecordBatchReader {
   /// This involves some I/O as the first batch must be loaded during the creation process
   /// so it is returned as a future
   ///
-  /// Currently, the StreamingReader is not async-reentrant and does not do any fan-out
-  /// parsing (see ARROW-11889)
+  /// Currently, the StreamingReader is not async-reentrant
   static Future<std::shared_ptr<StreamingReader>> MakeAsync(
       io::IOContext io_context, std::shared_ptr<io::InputStream> input,
       arrow::internal::Executor* cpu_executor, const ReadOptions&, const ParseOptions&,
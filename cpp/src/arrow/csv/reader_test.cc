@@ -314,13 +314,15 @@ TEST(AsyncReaderTests, InvalidRowsSkipped) {
   TestInvalidRowsSkipped(table_factory, /*async=*/true);
 }
 
-TableReaderFactory MakeStreamingFactory(bool use_threads = true) {
-  return [use_threads](
+TableReaderFactory MakeStreamingFactory(bool use_threads = true,
+                                        bool preserve_order = true) {
+  return [use_threads, preserve_order](
              std::shared_ptr<io::InputStream> input_stream, ParseOptions parse_options,
              std::optional<int32_t> block_size) -> Result<std::shared_ptr<TableReader>> {
     auto read_options = ReadOptions::Defaults();
     read_options.block_size = block_size.value_or(1 << 10);
     read_options.use_threads = use_threads;
+    read_options.preserve_order = preserve_order;
     ARROW_ASSIGN_OR_RAISE(
         auto streaming_reader,
         StreamingReader::Make(io::default_io_context(), input_stream, read_options,
@@ -364,6 +366,33 @@ TEST(StreamingReaderTests, InvalidRowsSkippedAsync) {
   TestInvalidRowsSkipped(MakeStreamingFactory(), /*async=*/true);
 }
 
+TEST(StreamingReaderTests, StressUnordered) {
+  StressTableReader(MakeStreamingFactory(/*use_threads=*/true, /*preserve_order=*/false));
+}
+
+TEST(StreamingReaderTests, ParallelPreservesOrder) {
+  const int NROWS = 5000;
+  ASSERT_OK_AND_ASSIGN(auto table_buffer, MakeSampleCsvBuffer(NROWS));
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, internal::ThreadPool::Make(4));
+
+  auto read_table = [&](bool use_threads) -> Result<std::shared_ptr<Table>> {
+    auto read_options = ReadOptions::Defaults();
+    read_options.block_size = 1 << 10;
+    read_options.use_threads = use_threads;
+    auto input = std::make_shared<io::BufferReader>(table_buffer);
+    auto reader_fut = StreamingReader::MakeAsync(
+        io::default_io_context(), input, thread_pool.get(), read_options,
+        ParseOptions::Defaults(), ConvertOptions::Defaults());
+    ARROW_ASSIGN_OR_RAISE(auto reader, reader_fut.result());
+    return reader->ToTable();
+  };
+
+  ASSERT_OK_AND_ASSIGN(auto expected, read_table(/*use_threads=*/false));
+  ASSERT_OK_AND_ASSIGN(auto actual, read_table(/*use_threads=*/true));
+  ASSERT_EQ(NROWS, actual->num_rows());
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
 TEST(StreamingReaderTests, BytesRead) {
   ASSERT_OK_AND_ASSIGN(auto thread_pool, internal::ThreadPool::Make(1));
   auto table_buffer =
@@ -23,8 +23,10 @@
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/stl_allocator.h"
+#include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visit_data_inline.h"
 #include "arrow/visit_type_inline.h"
 
@@ -501,6 +503,97 @@ Result<std::unique_ptr<ColumnPopulator>> MakePopulator(
                        pool);
 }
 
+// Converts record batches to CSV data in an internal buffer.
+//
+// Column populators keep per-batch state, so each formatter owns its own
+// populators and distinct formatters can be used concurrently.
+class BatchFormatter {
+ public:
+  static Result<std::unique_ptr<BatchFormatter>> Make(
+      const Schema& schema, const WriteOptions& options,
+      const std::shared_ptr<Buffer>& null_string) {
+    std::vector<std::unique_ptr<ColumnPopulator>> populators(schema.num_fields());
+    std::string delimiter(1, options.delimiter);
+    for (int col = 0; col < schema.num_fields(); col++) {
+      const std::string& end_chars =
+          col < schema.num_fields() - 1 ? delimiter : options.eol;
+      ARROW_ASSIGN_OR_RAISE(
+          populators[col],
+          MakePopulator(*schema.field(col), end_chars, options.delimiter, null_string,
+                        options.quoting_style, options.io_context.pool()));
+    }
+    const int64_t initial_size =
+        options.batch_size * schema.num_fields() * kColumnSizeGuess;
+    ARROW_ASSIGN_OR_RAISE(auto data_buffer, AllocateResizableBuffer(
+                                                initial_size, options.io_context.pool()));
+    return std::make_unique<BatchFormatter>(std::move(populators), std::move(data_buffer),
+                                            options);
+  }
+
+  BatchFormatter(std::vector<std::unique_ptr<ColumnPopulator>> populators,
+                 std::shared_ptr<ResizableBuffer> data_buffer,
+                 const WriteOptions& options)
+      : column_populators_(std::move(populators)),
+        offsets_(0, 0, ::arrow::stl::allocator<char*>(options.io_context.pool())),
+        data_buffer_(std::move(data_buffer)),
+        eol_size_(static_cast<int32_t>(options.eol.size())) {}
+
+  // Replace the buffer contents with the CSV rendering of `batch`.
+  Status TranslateMinimalBatch(const RecordBatch& batch) {
+    if (batch.num_rows() == 0) {
+      return Status::OK();
+    }
+    offsets_.resize(batch.num_rows());
+    std::fill(offsets_.begin(), offsets_.end(), 0);
+
+    // Calculate relative offsets for each row (excluding delimiters)
+    for (int32_t col = 0; col < static_cast<int32_t>(column_populators_.size()); col++) {
+      RETURN_NOT_OK(
+          column_populators_[col]->UpdateRowLengths(*batch.column(col), offsets_.data()));
+    }
+    // Calculate cumulative offsets for each row (including delimiters).
+    // - before conversion: offsets_[i] = length of i-th row
+    // - after conversion:  offsets_[i] = offset to the starting of i-th row buffer
+    //   - offsets_[0] = 0
+    //   - offsets_[i] = offsets_[i-1] + len(i-1-th row) + len(delimiters)
+    // Delimiters: ',' * (num_columns - 1) + eol
+    const int32_t delimiters_length = batch.num_columns() - 1 + eol_size_;
+    int64_t last_row_length = offsets_[0] + delimiters_length;
+    offsets_[0] = 0;
+    for (size_t row = 1; row < offsets_.size(); ++row) {
+      const int64_t this_row_length = offsets_[row] + delimiters_length;
+      offsets_[row] = offsets_[row - 1] + last_row_length;
+      last_row_length = this_row_length;
+    }
+    // Resize the target buffer to required size. We assume batch to batch sizes
+    // should be pretty close so don't shrink the buffer to avoid allocation churn.
+    RETURN_NOT_OK(
+        data_buffer_->Resize(offsets_.back() + last_row_length, /*shrink_to_fit=*/false));
+
+    // Use the offsets to populate contents.
+    for (auto& populator : column_populators_) {
+      RETURN_NOT_OK(populator->PopulateRows(
+          reinterpret_cast<char*>(data_buffer_->mutable_data()), offsets_.data()));
+    }
+    DCHECK_EQ(data_buffer_->size(), offsets_.back());
+    return Status::OK();
+  }
+
+  // GH-36889: Flush buffer to sink and clear it to avoid stale content
+  // being written again if the next batch is empty.
+  Status FlushToSink(io::OutputStream* sink) {
+    RETURN_NOT_OK(sink->Write(data_buffer_));
+    return data_buffer_->Resize(0, /*shrink_to_fit=*/false);
+  }
+
+ private:
+  static constexpr int64_t kColumnSizeGuess = 8;
+  std::vector<std::unique_ptr<ColumnPopulator>> column_populators_;
+  std::vector<int64_t, arrow::stl::allocator<int64_t>> offsets_;
+  std::shared_ptr<ResizableBuffer> data_buffer_;
+  const int32_t eol_size_;
+};
+
 class CSVWriterImpl : public ipc::RecordBatchWriter {
  public:
   static Result<std::shared_ptr<CSVWriterImpl>> Make(
@@ -517,19 +610,20 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
     memcpy(null_string->mutable_data(), options.null_string.data(),
            options.null_string.length());
 
-    std::vector<std::unique_ptr<ColumnPopulator>> populators(schema->num_fields());
-    std::string delimiter(1, options.delimiter);
-    for (int col = 0; col < schema->num_fields(); col++) {
-      const std::string& end_chars =
-          col < schema->num_fields() - 1 ? delimiter : options.eol;
-      ARROW_ASSIGN_OR_RAISE(
-          populators[col],
-          MakePopulator(*schema->field(col), end_chars, options.delimiter, null_string,
-                        options.quoting_style, options.io_context.pool()));
+    // When using threads, one batch is written while up to one batch per CPU
+    // thread is being formatted.
+    int num_formatters = 1;
+    const int capacity = ::arrow::internal::GetCpuThreadPool()->GetCapacity();
+    if (options.use_threads && capacity >= 2) {
+      num_formatters = capacity + 1;
+    }
+    std::vector<std::unique_ptr<BatchFormatter>> formatters(num_formatters);
+    for (auto& formatter : formatters) {
+      ARROW_ASSIGN_OR_RAISE(formatter,
+                            BatchFormatter::Make(*schema, options, null_string));
     }
     auto writer = std::make_shared<CSVWriterImpl>(
-        sink, std::move(owned_sink), std::move(schema), std::move(populators), options);
-    RETURN_NOT_OK(writer->PrepareForContentsWrite());
+        sink, std::move(owned_sink), std::move(schema), std::move(formatters), options);
     if (options.include_header) {
       RETURN_NOT_OK(writer->WriteHeader());
     }
@@ -537,29 +631,13 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
   }
 
   Status WriteRecordBatch(const RecordBatch& batch) override {
-    RecordBatchIterator iterator = RecordBatchSliceIterator(batch, options_.batch_size);
-    for (auto maybe_slice : iterator) {
-      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> slice, maybe_slice);
-      RETURN_NOT_OK(TranslateMinimalBatch(*slice));
-      RETURN_NOT_OK(FlushToSink());
-      stats_.num_record_batches++;
-    }
-    return Status::OK();
+    return WriteBatches(RecordBatchSliceIterator(batch, options_.batch_size));
   }
 
   Status WriteTable(const Table& table, int64_t max_chunksize) override {
     TableBatchReader reader(table);
     reader.set_chunksize(max_chunksize > 0 ? max_chunksize : options_.batch_size);
-    std::shared_ptr<RecordBatch> batch;
-    RETURN_NOT_OK(reader.ReadNext(&batch));
-    while (batch != nullptr) {
-      RETURN_NOT_OK(TranslateMinimalBatch(*batch));
-      RETURN_NOT_OK(FlushToSink());
-      RETURN_NOT_OK(reader.ReadNext(&batch));
-      stats_.num_record_batches++;
-    }
-
-    return Status::OK();
+    return WriteBatches(MakeFunctionIterator([&reader] { return reader.Next(); }));
   }
 
   Status Close() override { return Status::OK(); }
@@ -568,33 +646,84 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
 
   CSVWriterImpl(io::OutputStream* sink, std::shared_ptr<io::OutputStream> owned_sink,
                 std::shared_ptr<Schema> schema,
-                std::vector<std::unique_ptr<ColumnPopulator>> populators,
+                std::vector<std::unique_ptr<BatchFormatter>> formatters,
                 const WriteOptions& options)
       : sink_(sink),
         owned_sink_(std::move(owned_sink)),
-        column_populators_(std::move(populators)),
-        offsets_(0, 0, ::arrow::stl::allocator<char*>(options.io_context.pool())),
+        formatters_(std::move(formatters)),
         schema_(std::move(schema)),
         options_(options) {}
 
  private:
-  Status PrepareForContentsWrite() {
-    // Only called once, as part of initialization
-    if (data_buffer_ == nullptr) {
-      ARROW_ASSIGN_OR_RAISE(
-          data_buffer_,
-          AllocateResizableBuffer(
-              options_.batch_size * schema_->num_fields() * kColumnSizeGuess,
-              options_.io_context.pool()));
+  // Format each batch and write it to the sink, in order.
+  Status WriteBatches(RecordBatchIterator batches) {
+    auto* executor = ::arrow::internal::GetCpuThreadPool();
+    // Avoid waiting on the thread pool from one of its own threads
+    if (formatters_.size() == 1 || executor->OwnsThisThread()) {
+      BatchFormatter* formatter = formatters_[0].get();
+      for (auto maybe_batch : batches) {
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> batch, maybe_batch);
+        RETURN_NOT_OK(formatter->TranslateMinimalBatch(*batch));
+        RETURN_NOT_OK(formatter->FlushToSink(sink_));
+        stats_.num_record_batches++;
+      }
+      return Status::OK();
     }
-    return Status::OK();
-  }
 
-  // GH-36889: Flush buffer to sink and clear it to avoid stale content
-  // being written again if the next batch is empty.
-  Status FlushToSink() {
-    RETURN_NOT_OK(sink_->Write(data_buffer_));
-    return data_buffer_->Resize(0, /*shrink_to_fit=*/false);
+    // Batches are formatted on the CPU thread pool, each with its own formatter,
+    // while the formatted batches are written from this thread in order.
+    const int64_t num_formatters = static_cast<int64_t>(formatters_.size());
+    std::vector<Future<>> formatted(num_formatters);
+    int64_t num_submitted = 0;
+    int64_t num_written = 0;
+    Status status;
+
+    // Wait for the oldest submitted batch and write it out.  After an error,
+    // only wait for it, since the task still references its formatter.
+    auto write_oldest = [&]() {
+      const int64_t index = num_written++ % num_formatters;
+      Status formatted_status = formatted[index].status();
+      if (status.ok()) {
+        status = formatted_status;
+      }
+      if (status.ok()) {
+        status = formatters_[index]->FlushToSink(sink_);
+        stats_.num_record_batches++;
+      }
+    };
+
+    while (status.ok()) {
+      auto maybe_batch = batches.Next();
+      if (!maybe_batch.ok()) {
+        status = maybe_batch.status();
+        break;
+      }
+      std::shared_ptr<RecordBatch> batch = maybe_batch.MoveValueUnsafe();
+      if (IsIterationEnd(batch)) {
+        break;
+      }
+      if (num_submitted - num_written == num_formatters) {
+        write_oldest();
+        if (!status.ok()) {
+          break;
+        }
+      }
+      const int64_t index = num_submitted % num_formatters;
+      BatchFormatter* formatter = formatters_[index].get();
+      auto maybe_future = executor->Submit([formatter, batch = std::move(batch)] {
+        return formatter->TranslateMinimalBatch(*batch);
+      });
+      if (!maybe_future.ok()) {
+        status = maybe_future.status();
+        break;
+      }
+      formatted[index] = maybe_future.MoveValueUnsafe();
+      ++num_submitted;
+    }
+    while (num_written < num_submitted) {
+      write_oldest();
+    }
+    return status;
   }
 
   int64_t CalculateHeaderSize(QuotingStyle quoting_style) const {
@@ -625,9 +754,10 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
 
   Status WriteHeader() {
     // Only called once, as part of initialization
-    RETURN_NOT_OK(data_buffer_->Resize(CalculateHeaderSize(options_.quoting_header),
-                                       /*shrink_to_fit=*/false));
-    char* next = reinterpret_cast<char*>(data_buffer_->mutable_data());
+    ARROW_ASSIGN_OR_RAISE(auto header,
+                          AllocateBuffer(CalculateHeaderSize(options_.quoting_header),
+                                         options_.io_context.pool()));
+    char* next = reinterpret_cast<char*>(header->mutable_data());
     for (int col = 0; col < schema_->num_fields(); ++col) {
       const std::string& col_name = schema_->field(col)->name();
       switch (options_.quoting_header) {
@@ -659,58 +789,13 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
     }
     memcpy(next, options_.eol.data(), options_.eol.size());
     next += options_.eol.size();
-    DCHECK_EQ(reinterpret_cast<uint8_t*>(next),
-              data_buffer_->data() + data_buffer_->size());
-    return FlushToSink();
-  }
-
-  Status TranslateMinimalBatch(const RecordBatch& batch) {
-    if (batch.num_rows() == 0) {
-      return Status::OK();
-    }
-    offsets_.resize(batch.num_rows());
-    std::fill(offsets_.begin(), offsets_.end(), 0);
-
-    // Calculate relative offsets for each row (excluding delimiters)
-    for (int32_t col = 0; col < static_cast<int32_t>(column_populators_.size()); col++) {
-      RETURN_NOT_OK(
-          column_populators_[col]->UpdateRowLengths(*batch.column(col), offsets_.data()));
-    }
-    // Calculate cumulative offsets for each row (including delimiters).
-    // - before conversion: offsets_[i] = length of i-th row
-    // - after conversion:  offsets_[i] = offset to the starting of i-th row buffer
-    //   - offsets_[0] = 0
-    //   - offsets_[i] = offsets_[i-1] + len(i-1-th row) + len(delimiters)
-    // Delimiters: ',' * (num_columns - 1) + eol
-    const int32_t delimiters_length =
-        static_cast<int32_t>(batch.num_columns() - 1 + options_.eol.size());
-    int64_t last_row_length = offsets_[0] + delimiters_length;
-    offsets_[0] = 0;
-    for (size_t row = 1; row < offsets_.size(); ++row) {
-      const int64_t this_row_length = offsets_[row] + delimiters_length;
-      offsets_[row] = offsets_[row - 1] + last_row_length;
-      last_row_length = this_row_length;
-    }
-    // Resize the target buffer to required size. We assume batch to batch sizes
-    // should be pretty close so don't shrink the buffer to avoid allocation churn.
-    RETURN_NOT_OK(
-        data_buffer_->Resize(offsets_.back() + last_row_length, /*shrink_to_fit=*/false));
-
-    // Use the offsets to populate contents.
-    for (auto& populator : column_populators_) {
-      RETURN_NOT_OK(populator->PopulateRows(
-          reinterpret_cast<char*>(data_buffer_->mutable_data()), offsets_.data()));
-    }
-    DCHECK_EQ(data_buffer_->size(), offsets_.back());
-    return Status::OK();
+    DCHECK_EQ(reinterpret_cast<uint8_t*>(next), header->data() + header->size());
+    return sink_->Write(std::move(header));
   }
 
-  static constexpr int64_t kColumnSizeGuess = 8;
   io::OutputStream* sink_;
   std::shared_ptr<io::OutputStream> owned_sink_;
-  std::vector<std::unique_ptr<ColumnPopulator>> column_populators_;
-  std::vector<int64_t, arrow::stl::allocator<int64_t>> offsets_;
-  std::shared_ptr<ResizableBuffer> data_buffer_;
+  std::vector<std::unique_ptr<BatchFormatter>> formatters_;
   const std::shared_ptr<Schema> schema_;
   const WriteOptions options_;
   ipc::WriteStats stats_;
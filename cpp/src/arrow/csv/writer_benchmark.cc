@@ -29,6 +29,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace csv {
@@ -146,6 +147,23 @@ void WriteCsvNumericCheckQuote(benchmark::State& state) {
   BenchmarkWriteCsv(state, options, *batch);
 }
 
+// Exercise parallel conversion with a larger batch, using the given number
+// of CPU threads
+void WriteCsvNumericThreaded(benchmark::State& state) {
+  constexpr int kRows = 200000;
+  const int num_threads = static_cast<int>(state.range(1));
+  auto batch = MakeIntTestBatch(kRows, kCsvCols, state.range(0));
+  auto options = WriteOptions::Defaults();
+  options.use_threads = true;
+
+  auto thread_pool = ::arrow::internal::GetCpuThreadPool();
+  const int old_capacity = thread_pool->GetCapacity();
+  ABORT_NOT_OK(thread_pool->SetCapacity(num_threads));
+  BenchmarkWriteCsv(state, options, *batch);
+  ABORT_NOT_OK(thread_pool->SetCapacity(old_capacity));
+  state.counters["threads"] = num_threads;
+}
+
 void NullPercents(benchmark::internal::Benchmark* bench) {
   std::vector<int> null_percents = {0, 1, 10, 50};
   for (int null_percent : null_percents) {
@@ -160,6 +178,9 @@ BENCHMARK(WriteCsvStringNoQuote)->Apply(NullPercents);
 BENCHMARK(WriteCsvStringWithQuote)->Apply(NullPercents);
 BENCHMARK(WriteCsvStringRejectQuote)->Apply(NullPercents);
 BENCHMARK(WriteCsvNumericCheckQuote)->Apply(NullPercents);
+BENCHMARK(WriteCsvNumericThreaded)
+    ->ArgsProduct({{0, 10}, {1, 2, 4, 8}})
+    ->UseRealTime();
 
 }  // namespace csv
 }  // namespace arrow
@@ -354,6 +354,10 @@ TEST_P(TestWriteCSV, TestWrite) {
     EXPECT_RAISES_WITH_MESSAGE_THAT(
         Invalid, ::testing::HasSubstr(GetParam().expected_status.message()),
         ToCsvString(*record_batch, options));
+    options.use_threads = true;
+    EXPECT_RAISES_WITH_MESSAGE_THAT(
+        Invalid, ::testing::HasSubstr(GetParam().expected_status.message()),
+        ToCsvString(*record_batch, options));
   } else {
     ASSERT_OK_AND_ASSIGN(csv, ToCsvString(*record_batch, options));
     EXPECT_EQ(csv, GetParam().expected_output);
@@ -363,6 +367,13 @@ TEST_P(TestWriteCSV, TestWrite) {
     ASSERT_OK_AND_ASSIGN(csv, ToCsvString(*record_batch, options));
     EXPECT_EQ(csv, GetParam().expected_output);
 
+    // Converting batches in parallel shouldn't matter either.
+    auto threaded_options = options;
+    threaded_options.use_threads = true;
+    threaded_options.batch_size = 1;
+    ASSERT_OK_AND_ASSIGN(csv, ToCsvString(*record_batch, threaded_options));
+    EXPECT_EQ(csv, GetParam().expected_output);
+
     // Table and Record batch should work identically.
     ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> table,
                          Table::FromRecordBatches({record_batch}));
@@ -30,6 +30,7 @@
 #  include "arrow/dataset/file_json.h"
 #endif
 #include "arrow/dataset/file_ipc.h"
+#include "arrow/dataset/manifest.h"
 #ifdef ARROW_ORC
 #  include "arrow/dataset/file_orc.h"
 #endif
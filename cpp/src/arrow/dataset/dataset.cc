@@ -76,12 +76,35 @@ Future<std::optional<int64_t>> Fragment::CountRows(compute::Expression,
   return Future<std::optional<int64_t>>::MakeFinished(std::nullopt);
 }
 
+Future<FragmentMetadataAggregates> Fragment::AggregateFromMetadata(
+    compute::Expression predicate, std::optional<FieldRef> min_max_target,
+    const std::shared_ptr<ScanOptions>& options) {
+  auto self = shared_from_this();
+  if (min_max_target.has_value()) {
+    FragmentMetadataAggregates aggregates;
+    aggregates.remainder = std::move(self);
+    return Future<FragmentMetadataAggregates>::MakeFinished(std::move(aggregates));
+  }
+  return CountRows(std::move(predicate), options)
+      .Then([self](const std::optional<int64_t>& count) {
+        FragmentMetadataAggregates aggregates;
+        if (count.has_value()) {
+          aggregates.count = *count;
+        } else {
+          aggregates.remainder = self;
+        }
+        return aggregates;
+      });
+}
+
 Status Fragment::ClearCachedMetadata() {
   auto lock = physical_schema_mutex_.Lock();
   physical_schema_.reset();
   return Status::OK();
 }
 
+std::optional<int64_t> Fragment::EstimateScanBytes() { return std::nullopt; }
+
 Result<std::shared_ptr<Schema>> InMemoryFragment::ReadPhysicalSchemaImpl() {
   return given_physical_schema_;
 }
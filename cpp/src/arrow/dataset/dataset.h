@@ -145,6 +145,19 @@ struct ARROW_DS_EXPORT InspectedFragment {
   std::vector<std::string> column_names;
 };
 
+/// \brief Aggregates over the rows of a fragment matching a predicate, as far as the
+/// fragment's metadata can answer them.
+struct ARROW_DS_EXPORT FragmentMetadataAggregates {
+  /// Number of matching rows accounted for by metadata
+  int64_t count = 0;
+  /// Minimum and maximum of the requested column over those rows, null if no column
+  /// was requested or none of those rows have a non-null value
+  std::shared_ptr<Scalar> min, max;
+  /// A fragment holding the matching rows metadata could not account for, which must
+  /// still be scanned, or null if there are none
+  std::shared_ptr<Fragment> remainder;
+};
+
 /// \brief A granular piece of a Dataset, such as an individual file.
 ///
 /// A Fragment can be read/scanned separately from other fragments. It yields a
@@ -190,6 +203,17 @@ class ARROW_DS_EXPORT Fragment : public std::enable_shared_from_this<Fragment> {
   virtual Future<std::optional<int64_t>> CountRows(
       compute::Expression predicate, const std::shared_ptr<ScanOptions>& options);
 
+  /// \brief Count the rows matching the filter, and optionally find the minimum and
+  /// maximum of a column over them, using metadata where possible.
+  ///
+  /// Unlike CountRows this need not be all or nothing: the result accounts for the rows
+  /// metadata can answer for and leaves the others to a remainder fragment, so only
+  /// those must be scanned.  The default implementation counts through CountRows and
+  /// never answers for a minimum or maximum.
+  virtual Future<FragmentMetadataAggregates> AggregateFromMetadata(
+      compute::Expression predicate, std::optional<FieldRef> min_max_target,
+      const std::shared_ptr<ScanOptions>& options);
+
   /// \brief Clear any metadata that may have been cached by this object.
   ///
   /// A fragment may typically cache metadata to speed up repeated accesses.
@@ -197,6 +221,14 @@ class ARROW_DS_EXPORT Fragment : public std::enable_shared_from_this<Fragment> {
   /// this function can help reclaim memory.
   virtual Status ClearCachedMetadata();
 
+  /// \brief Estimate the bytes read and materialized by a scan of this fragment
+  ///
+  /// The estimate only uses what is known without I/O, such as the file size or
+  /// cached metadata.  The scanner uses it to budget readahead, see
+  /// ScanOptions::readahead_bytes.  Return an empty optional (the default) if
+  /// nothing is known.
+  virtual std::optional<int64_t> EstimateScanBytes();
+
   virtual std::string type_name() const = 0;
   virtual std::string ToString() const { return type_name(); }
 
@@ -22,6 +22,8 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/array/builder_base.h"
+#include "arrow/compute/api_aggregate.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/type_fwd.h"
@@ -67,6 +69,25 @@ inline std::shared_ptr<Schema> SchemaFromColumnNames(
   return schema(std::move(columns))->WithMetadata(input->metadata());
 }
 
+/// Reduce partial minimums and maximums of a column (for example one per row group) to
+/// the overall minimum and maximum.  The partials must all be of the given type.  Null
+/// partials are ignored, so the results are null if every partial is.
+inline Result<std::pair<std::shared_ptr<Scalar>, std::shared_ptr<Scalar>>> ReduceMinMax(
+    const std::shared_ptr<DataType>& type, const ScalarVector& mins,
+    const ScalarVector& maxes) {
+  auto reduce = [&](const ScalarVector& partials,
+                    int field_index) -> Result<std::shared_ptr<Scalar>> {
+    ARROW_ASSIGN_OR_RAISE(std::unique_ptr<ArrayBuilder> builder, MakeBuilder(type));
+    RETURN_NOT_OK(builder->AppendScalars(partials));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> array, builder->Finish());
+    ARROW_ASSIGN_OR_RAISE(Datum min_max, compute::MinMax(array));
+    return min_max.scalar_as<StructScalar>().value[field_index];
+  };
+  ARROW_ASSIGN_OR_RAISE(auto min, reduce(mins, 0));
+  ARROW_ASSIGN_OR_RAISE(auto max, reduce(maxes, 1));
+  return std::make_pair(std::move(min), std::move(max));
+}
+
 /// Get fragment scan options of the expected type.
 /// \return Fragment scan options if provided on the scan options, else the default
 ///     options if set, else a default-constructed value. If options are provided
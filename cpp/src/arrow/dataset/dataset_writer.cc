@@ -23,10 +23,14 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include "arrow/array/array_primitive.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/table.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/byte_size.h"
 #include "arrow/util/future.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/map_internal.h"
@@ -95,18 +99,28 @@ class Throttle {
 };
 
 struct DatasetWriterState {
-  DatasetWriterState(uint64_t rows_in_flight, uint64_t max_open_files,
-                     uint64_t max_rows_staged)
+  DatasetWriterState(uint64_t rows_in_flight, uint64_t bytes_in_flight,
+                     uint64_t max_open_files, uint64_t max_rows_staged,
+                     uint64_t max_bytes_staged)
       : rows_in_flight_throttle(rows_in_flight),
+        bytes_in_flight_throttle(bytes_in_flight),
         open_files_throttle(max_open_files),
         staged_rows_count(0),
-        max_rows_staged(max_rows_staged) {}
+        staged_bytes_count(0),
+        max_rows_staged(max_rows_staged),
+        max_bytes_staged(max_bytes_staged) {}
 
-  bool StagingFull() const { return staged_rows_count.load() >= max_rows_staged; }
+  bool StagingFull() const {
+    return staged_rows_count.load() >= max_rows_staged ||
+           (max_bytes_staged > 0 && staged_bytes_count.load() >= max_bytes_staged);
+  }
 
   // Throttle for how many rows the dataset writer will allow to be in process memory
   // When this is exceeded the dataset writer will pause / apply backpressure
   Throttle rows_in_flight_throttle;
+  // Same as rows_in_flight_throttle but measured in bytes, so that wide rows cannot
+  // exhaust memory before the row limit is reached
+  Throttle bytes_in_flight_throttle;
   // Control for how many files the dataset writer will open.  When this is exceeded
   // the dataset writer will pause and it will also close the largest open file.
   Throttle open_files_throttle;
@@ -114,10 +128,14 @@ struct DatasetWriterState {
   // staged if it is waiting for more rows to reach minimum_batch_size.  If this is
   // exceeded then the largest staged batch is unstaged (no backpressure is applied)
   std::atomic<uint64_t> staged_rows_count;
+  std::atomic<uint64_t> staged_bytes_count;
   // If too many rows get staged we will end up with poor performance and, if more rows
   // are staged than max_rows_queued we will end up with deadlock.  To avoid this, once
   // we have too many staged rows we just ignore min_rows_per_group
   const uint64_t max_rows_staged;
+  // The same limit for the bytes held by staged rows, which would otherwise deadlock
+  // against bytes_in_flight_throttle
+  const uint64_t max_bytes_staged;
   // Mutex to guard access to the file visitors in the writer options
   std::mutex visitors_mutex;
 };
@@ -132,6 +150,59 @@ Result<std::shared_ptr<FileWriter>> OpenWriter(
                                             {write_options.filesystem, filename});
 }
 
+// Computes the position of each row along a Z-order curve through the clustering keys.
+// Each key is replaced by its dense rank, truncated to the most significant bits that
+// fit in its share of a 64-bit code, and the bits of all keys are interleaved.
+Result<std::shared_ptr<Array>> ZOrderCodes(const RecordBatch& batch,
+                                           const compute::Ordering& ordering) {
+  const std::vector<compute::SortKey>& sort_keys = ordering.sort_keys();
+  const int num_keys = static_cast<int>(sort_keys.size());
+  const int bits_per_key = 64 / num_keys;
+  std::vector<uint64_t> codes(static_cast<size_t>(batch.num_rows()), 0);
+  for (int k = 0; k < num_keys; ++k) {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> column,
+                          sort_keys[k].target.GetOne(batch));
+    compute::RankOptions rank_options(sort_keys[k].order, ordering.null_placement(),
+                                      compute::RankOptions::Dense);
+    ARROW_ASSIGN_OR_RAISE(Datum ranks,
+                          compute::CallFunction("rank", {column}, &rank_options));
+    auto rank_values = ranks.array_as<UInt64Array>();
+    uint64_t max_rank = 1;
+    for (int64_t i = 0; i < rank_values->length(); ++i) {
+      max_rank = std::max(max_rank, rank_values->Value(i));
+    }
+    const int shift = std::max(0, bit_util::NumRequiredBits(max_rank - 1) - bits_per_key);
+    // Earlier keys take the more significant bit of each interleaved group
+    const int offset = num_keys - 1 - k;
+    for (int64_t i = 0; i < rank_values->length(); ++i) {
+      const uint64_t value = (rank_values->Value(i) - 1) >> shift;
+      uint64_t& code = codes[static_cast<size_t>(i)];
+      for (int bit = 0; bit < bits_per_key; ++bit) {
+        code |= ((value >> bit) & 1) << (bit * num_keys + offset);
+      }
+    }
+  }
+  return std::make_shared<UInt64Array>(static_cast<int64_t>(codes.size()),
+                                       Buffer::FromVector(std::move(codes)));
+}
+
+// Sorts a batch by the writer's clustering keys
+Result<std::shared_ptr<RecordBatch>> ClusterBatch(
+    std::shared_ptr<RecordBatch> batch, const FileSystemDatasetWriteOptions& options) {
+  std::shared_ptr<Array> indices;
+  if (options.clustering_order == ClusteringOrder::kZOrder) {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> codes,
+                          ZOrderCodes(*batch, options.clustering_keys));
+    ARROW_ASSIGN_OR_RAISE(indices, compute::SortIndices(*codes));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(
+        indices,
+        compute::SortIndices(batch, compute::SortOptions(options.clustering_keys)));
+  }
+  ARROW_ASSIGN_OR_RAISE(Datum sorted, compute::Take(batch, indices));
+  return sorted.record_batch();
+}
+
 class DatasetWriterFileQueue
     : public std::enable_shared_from_this<DatasetWriterFileQueue> {
  public:
@@ -164,20 +235,60 @@ class DatasetWriterFileQueue
     file_tasks_.reset();
   }
 
+  // The most rows a row group may hold: max_rows_per_group, further limited by
+  // max_bytes_per_group at the average size of the staged rows
+  uint64_t MaxRowsPerGroup() const {
+    uint64_t max_rows = options_.max_rows_per_group;
+    if (options_.max_bytes_per_group > 0 && bytes_currently_staged_ > 0) {
+      const double row_bytes =
+          static_cast<double>(bytes_currently_staged_) / rows_currently_staged_;
+      max_rows = std::min(
+          max_rows, std::max<uint64_t>(1, static_cast<uint64_t>(
+                                              options_.max_bytes_per_group / row_bytes)));
+    }
+    return max_rows;
+  }
+
+  bool EnoughStagedForGroup() const {
+    return rows_currently_staged_ >= options_.min_rows_per_group &&
+           bytes_currently_staged_ >= options_.min_bytes_per_group;
+  }
+
+  // Merges everything staged into a single batch sorted by the clustering keys so that
+  // the row groups cut from it each cover a narrow range of the keys
+  Status ClusterStaged() {
+    if (options_.clustering_keys.sort_keys().empty() || staged_batches_.empty() ||
+        (staged_batches_.size() == 1 && staged_clustered_)) {
+      return Status::OK();
+    }
+    RecordBatchVector batches(staged_batches_.begin(), staged_batches_.end());
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> table,
+                          Table::FromRecordBatches(schema_, std::move(batches)));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> combined,
+                          table->CombineChunksToBatch());
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> clustered,
+                          ClusterBatch(std::move(combined), options_));
+    staged_batches_.clear();
+    staged_batches_.push_back(std::move(clustered));
+    staged_clustered_ = true;
+    return Status::OK();
+  }
+
   Result<std::shared_ptr<RecordBatch>> PopStagedBatch() {
     std::vector<std::shared_ptr<RecordBatch>> batches_to_write;
+    const uint64_t max_rows = MaxRowsPerGroup();
     uint64_t num_rows = 0;
     while (!staged_batches_.empty()) {
       std::shared_ptr<RecordBatch> next = std::move(staged_batches_.front());
       staged_batches_.pop_front();
-      if (num_rows + next->num_rows() <= options_.max_rows_per_group) {
+      if (num_rows + next->num_rows() <= max_rows) {
         num_rows += next->num_rows();
         batches_to_write.push_back(std::move(next));
-        if (num_rows == options_.max_rows_per_group) {
+        if (num_rows == max_rows) {
           break;
         }
       } else {
-        uint64_t remaining = options_.max_rows_per_group - num_rows;
+        uint64_t remaining = max_rows - num_rows;
         std::shared_ptr<RecordBatch> next_partial =
             next->Slice(0, static_cast<int64_t>(remaining));
         batches_to_write.push_back(std::move(next_partial));
@@ -193,10 +304,10 @@ class DatasetWriterFileQueue
     return table->CombineChunksToBatch();
   }
 
-  void ScheduleBatch(std::shared_ptr<RecordBatch> batch) {
+  void ScheduleBatch(std::shared_ptr<RecordBatch> batch, uint64_t num_bytes) {
     file_tasks_->AddSimpleTask(
-        [self = shared_from_this(), batch = std::move(batch)]() {
-          return self->WriteNext(std::move(batch));
+        [self = shared_from_this(), batch = std::move(batch), num_bytes]() {
+          return self->WriteNext(std::move(batch), num_bytes);
         },
         "DatasetWriter::WriteBatch"sv);
   }
@@ -204,29 +315,47 @@ class DatasetWriterFileQueue
   Result<int64_t> PopAndDeliverStagedBatch() {
     ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> next_batch, PopStagedBatch());
     int64_t rows_popped = next_batch->num_rows();
+    // Staged batches are merged and split on row boundaries, so the bytes acquired for
+    // them are handed back in proportion to the rows written.  The last batch popped
+    // takes whatever remains so that everything acquired is eventually released.
+    uint64_t bytes_popped = bytes_currently_staged_;
+    if (static_cast<uint64_t>(rows_popped) < rows_currently_staged_) {
+      bytes_popped = static_cast<uint64_t>(
+          static_cast<double>(bytes_currently_staged_) * rows_popped /
+          rows_currently_staged_);
+    }
     rows_currently_staged_ -= next_batch->num_rows();
-    ScheduleBatch(std::move(next_batch));
+    bytes_currently_staged_ -= bytes_popped;
+    ScheduleBatch(std::move(next_batch), bytes_popped);
     return rows_popped;
   }
 
   // Stage batches, popping and delivering batches if enough data has arrived
-  Status Push(std::shared_ptr<RecordBatch> batch) {
+  Status Push(std::shared_ptr<RecordBatch> batch, uint64_t num_bytes) {
     uint64_t delta_staged = batch->num_rows();
+    const uint64_t bytes_staged_before = bytes_currently_staged_;
     rows_currently_staged_ += delta_staged;
+    bytes_currently_staged_ += num_bytes;
     staged_batches_.push_back(std::move(batch));
+    staged_clustered_ = false;
+    if (writer_state_->StagingFull() || EnoughStagedForGroup()) {
+      RETURN_NOT_OK(ClusterStaged());
+    }
     while (!staged_batches_.empty() &&
-           (writer_state_->StagingFull() ||
-            rows_currently_staged_ >= options_.min_rows_per_group)) {
+           (writer_state_->StagingFull() || EnoughStagedForGroup())) {
       ARROW_ASSIGN_OR_RAISE(int64_t rows_popped, PopAndDeliverStagedBatch());
       delta_staged -= rows_popped;
     }
     // Note, delta_staged may be negative if we were able to deliver some data
     writer_state_->staged_rows_count += delta_staged;
+    writer_state_->staged_bytes_count += bytes_currently_staged_ - bytes_staged_before;
     return Status::OK();
   }
 
   Status Finish() {
     writer_state_->staged_rows_count -= rows_currently_staged_;
+    writer_state_->staged_bytes_count -= bytes_currently_staged_;
+    RETURN_NOT_OK(ClusterStaged().OrElse([&](auto&&) { file_tasks_.reset(); }));
     while (!staged_batches_.empty()) {
       RETURN_NOT_OK(PopAndDeliverStagedBatch().status().OrElse(
           [&](auto&&) { file_tasks_.reset(); }));
@@ -241,13 +370,14 @@ class DatasetWriterFileQueue
   }
 
  private:
-  Future<> WriteNext(std::shared_ptr<RecordBatch> next) {
+  Future<> WriteNext(std::shared_ptr<RecordBatch> next, uint64_t num_bytes) {
     // May want to prototype / measure someday pushing the async write down further
     return DeferNotOk(options_.filesystem->io_context().executor()->Submit(
-        [self = shared_from_this(), batch = std::move(next)]() {
+        [self = shared_from_this(), batch = std::move(next), num_bytes]() {
           int64_t rows_to_release = batch->num_rows();
           Status status = self->writer_->Write(batch);
           self->writer_state_->rows_in_flight_throttle.Release(rows_to_release);
+          self->writer_state_->bytes_in_flight_throttle.Release(num_bytes);
           return status;
         }));
   }
@@ -272,6 +402,10 @@ class DatasetWriterFileQueue
   // point they are merged together and added to write_queue_
   std::deque<std::shared_ptr<RecordBatch>> staged_batches_;
   uint64_t rows_currently_staged_ = 0;
+  uint64_t bytes_currently_staged_ = 0;
+  // Whether the single staged batch left over from the last delivery is already sorted
+  // by the clustering keys
+  bool staged_clustered_ = false;
   std::unique_ptr<util::ThrottledAsyncTaskScheduler> file_tasks_;
 };
 
@@ -320,13 +454,13 @@ class DatasetWriterDirectoryQueue
     return to_queue;
   }
 
-  Status StartWrite(const std::shared_ptr<RecordBatch>& batch) {
+  Status StartWrite(const std::shared_ptr<RecordBatch>& batch, uint64_t num_bytes) {
     rows_written_ += batch->num_rows();
     WriteTask task{current_filename_, static_cast<uint64_t>(batch->num_rows())};
     if (!latest_open_file_) {
       ARROW_RETURN_NOT_OK(OpenFileQueue(current_filename_));
     }
-    return latest_open_file_->Push(batch);
+    return latest_open_file_->Push(batch, num_bytes);
   }
 
   Result<std::string> GetNextFilename() {
@@ -489,6 +623,15 @@ Status ValidateOptions(const FileSystemDatasetWriteOptions& options) {
     return Status::Invalid(
         "min_rows_per_group must be less than or equal to max_rows_per_group");
   }
+  if (options.max_bytes_per_group > 0 &&
+      options.max_bytes_per_group < options.min_bytes_per_group) {
+    return Status::Invalid(
+        "min_bytes_per_group must be less than or equal to max_bytes_per_group");
+  }
+  if (options.clustering_order == ClusteringOrder::kZOrder &&
+      options.clustering_keys.sort_keys().size() > 64) {
+    return Status::Invalid("Z-order clustering supports at most 64 clustering keys");
+  }
   if (options.max_rows_per_file > 0 &&
       options.max_rows_per_file < options.max_rows_per_group) {
     return Status::Invalid(
@@ -524,6 +667,12 @@ uint64_t CalculateMaxRowsStaged(uint64_t max_rows_queued) {
   return std::min(static_cast<uint64_t>(1 << 23), max_rows_queued / 4);
 }
 
+// The memory held by a chunk, which is usually a slice of a larger batch
+uint64_t ChunkBytes(const RecordBatch& chunk) {
+  return static_cast<uint64_t>(
+      util::ReferencedBufferSize(chunk).ValueOr(util::TotalBufferSize(chunk)));
+}
+
 }  // namespace
 
 class DatasetWriter::DatasetWriterImpl {
@@ -532,7 +681,8 @@ class DatasetWriter::DatasetWriterImpl {
                     util::AsyncTaskScheduler* scheduler,
                     std::function<void()> pause_callback,
                     std::function<void()> resume_callback,
-                    std::function<void()> finish_callback, uint64_t max_rows_queued)
+                    std::function<void()> finish_callback, uint64_t max_rows_queued,
+                    uint64_t max_bytes_queued)
       : scheduler_(scheduler),
         write_tasks_(util::MakeThrottledAsyncTaskGroup(
             scheduler_, /*max_concurrent_cost=*/1, /*queue=*/nullptr,
@@ -542,8 +692,8 @@ class DatasetWriter::DatasetWriterImpl {
             })),
         write_options_(std::move(write_options)),
         writer_state_(std::make_shared<DatasetWriterState>(
-            max_rows_queued, write_options_.max_open_files,
-            CalculateMaxRowsStaged(max_rows_queued))),
+            max_rows_queued, max_bytes_queued, write_options_.max_open_files,
+            CalculateMaxRowsStaged(max_rows_queued), max_bytes_queued / 4)),
         pause_callback_(std::move(pause_callback)),
         resume_callback_(std::move(resume_callback)) {}
 
@@ -686,23 +836,32 @@ class DatasetWriter::DatasetWriterImpl {
         EVENT_ON_CURRENT_SPAN("DatasetWriter::Backpressure::TooManyRowsQueued");
         break;
       }
+      const uint64_t chunk_bytes = ChunkBytes(*next_chunk);
+      backpressure = writer_state_->bytes_in_flight_throttle.Acquire(chunk_bytes);
+      if (backpressure) {
+        EVENT_ON_CURRENT_SPAN("DatasetWriter::Backpressure::TooManyBytesQueued");
+        writer_state_->rows_in_flight_throttle.Release(next_chunk->num_rows());
+        break;
+      }
       if (will_open_file) {
         backpressure = writer_state_->open_files_throttle.Acquire(1);
         if (backpressure) {
           EVENT_ON_CURRENT_SPAN("DatasetWriter::Backpressure::TooManyOpenFiles");
           writer_state_->rows_in_flight_throttle.Release(next_chunk->num_rows());
+          writer_state_->bytes_in_flight_throttle.Release(chunk_bytes);
           RETURN_NOT_OK(TryCloseLargestFile());
           break;
         }
       }
-      auto s = dir_queue->StartWrite(next_chunk);
+      auto s = dir_queue->StartWrite(next_chunk, chunk_bytes);
       if (!s.ok()) {
-        // If `StartWrite` succeeded, it will Release the
-        // `rows_in_flight_throttle` when the write task is finished.
+        // If `StartWrite` succeeded, it will Release the `rows_in_flight_throttle`
+        // and `bytes_in_flight_throttle` when the write task is finished.
         //
         // `open_files_throttle` will be handed by `DatasetWriterDirectoryQueue`
         // so we don't need to release it here.
         writer_state_->rows_in_flight_throttle.Release(next_chunk->num_rows());
+        writer_state_->bytes_in_flight_throttle.Release(chunk_bytes);
         return s;
       }
       batch = std::move(remainder);
@@ -740,20 +899,23 @@ DatasetWriter::DatasetWriter(FileSystemDatasetWriteOptions write_options,
                              std::function<void()> pause_callback,
                              std::function<void()> resume_callback,
                              std::function<void()> finish_callback,
-                             uint64_t max_rows_queued)
+                             uint64_t max_rows_queued, uint64_t max_bytes_queued)
     : impl_(std::make_unique<DatasetWriterImpl>(
           std::move(write_options), scheduler, std::move(pause_callback),
-          std::move(resume_callback), std::move(finish_callback), max_rows_queued)) {}
+          std::move(resume_callback), std::move(finish_callback), max_rows_queued,
+          max_bytes_queued)) {}
 
 Result<std::unique_ptr<DatasetWriter>> DatasetWriter::Make(
     FileSystemDatasetWriteOptions write_options, util::AsyncTaskScheduler* scheduler,
     std::function<void()> pause_callback, std::function<void()> resume_callback,
-    std::function<void()> finish_callback, uint64_t max_rows_queued) {
+    std::function<void()> finish_callback, uint64_t max_rows_queued,
+    uint64_t max_bytes_queued) {
   RETURN_NOT_OK(ValidateOptions(write_options));
   RETURN_NOT_OK(EnsureDestinationValid(write_options));
   return std::unique_ptr<DatasetWriter>(new DatasetWriter(
       std::move(write_options), scheduler, std::move(pause_callback),
-      std::move(resume_callback), std::move(finish_callback), max_rows_queued));
+      std::move(resume_callback), std::move(finish_callback), max_rows_queued,
+      max_bytes_queued));
 }
 
 DatasetWriter::~DatasetWriter() = default;
@@ -31,14 +31,16 @@ namespace internal {
 
 // This lines up with our other defaults in the scanner and execution plan
 constexpr uint64_t kDefaultDatasetWriterMaxRowsQueued = 8 * 1024 * 1024;
+constexpr uint64_t kDefaultDatasetWriterMaxBytesQueued = 1ULL << 30;
 
 /// \brief Utility class that manages a set of writers to different paths
 ///
 /// Writers may be closed and reopened (and a new file created) based on the dataset
 /// write options (for example, max_rows_per_file or max_open_files)
 ///
-/// The dataset writer enforces its own back pressure based on the # of rows (as opposed
-/// to # of batches which is how it is typically enforced elsewhere) and # of files.
+/// The dataset writer enforces its own back pressure based on the # of rows and bytes
+/// (as opposed to # of batches which is how it is typically enforced elsewhere) and #
+/// of files.
 class ARROW_DS_EXPORT DatasetWriter {
  public:
   /// \brief Create a dataset writer
@@ -49,11 +51,14 @@ class ARROW_DS_EXPORT DatasetWriter {
   /// \param write_options options to control how the data should be written
   /// \param max_rows_queued max # of rows allowed to be queued before the dataset_writer
   ///                        will ask for backpressure
+  /// \param max_bytes_queued max # of bytes allowed to be queued before the
+  ///                         dataset_writer will ask for backpressure, 0 for no limit
   static Result<std::unique_ptr<DatasetWriter>> Make(
       FileSystemDatasetWriteOptions write_options, util::AsyncTaskScheduler* scheduler,
       std::function<void()> pause_callback, std::function<void()> resume_callback,
       std::function<void()> finish_callback,
-      uint64_t max_rows_queued = kDefaultDatasetWriterMaxRowsQueued);
+      uint64_t max_rows_queued = kDefaultDatasetWriterMaxRowsQueued,
+      uint64_t max_bytes_queued = kDefaultDatasetWriterMaxBytesQueued);
 
   ~DatasetWriter();
 
@@ -92,7 +97,8 @@ class ARROW_DS_EXPORT DatasetWriter {
                 util::AsyncTaskScheduler* scheduler, std::function<void()> pause_callback,
                 std::function<void()> resume_callback,
                 std::function<void()> finish_callback,
-                uint64_t max_rows_queued = kDefaultDatasetWriterMaxRowsQueued);
+                uint64_t max_rows_queued = kDefaultDatasetWriterMaxRowsQueued,
+                uint64_t max_bytes_queued = kDefaultDatasetWriterMaxBytesQueued);
 
   class DatasetWriterImpl;
   std::unique_ptr<DatasetWriterImpl> impl_;
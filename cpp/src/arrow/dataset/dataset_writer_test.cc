@@ -103,11 +103,13 @@ class DatasetWriterTestFixture : public testing::Test {
   }
 
   std::unique_ptr<DatasetWriter> MakeDatasetWriter(
-      uint64_t max_rows = kDefaultDatasetWriterMaxRowsQueued) {
-    EXPECT_OK_AND_ASSIGN(auto dataset_writer,
-                         DatasetWriter::Make(
-                             write_options_, scheduler_, [this] { paused_ = true; },
-                             [this] { paused_ = false; }, [] {}, max_rows));
+      uint64_t max_rows = kDefaultDatasetWriterMaxRowsQueued,
+      uint64_t max_bytes = kDefaultDatasetWriterMaxBytesQueued) {
+    EXPECT_OK_AND_ASSIGN(
+        auto dataset_writer,
+        DatasetWriter::Make(
+            write_options_, scheduler_, [this] { paused_ = true; },
+            [this] { paused_ = false; }, [] {}, max_rows, max_bytes));
     return dataset_writer;
   }
 
@@ -225,6 +227,35 @@ class DatasetWriterTestFixture : public testing::Test {
     }
   }
 
+  void CheckClusteredDescending(ClusteringOrder clustering_order) {
+    write_options_.clustering_keys =
+        compute::Ordering({compute::SortKey("int64", compute::SortOrder::Descending)});
+    write_options_.clustering_order = clustering_order;
+    write_options_.min_rows_per_group = 20;
+    write_options_.max_rows_per_group = 20;
+    auto dataset_writer = MakeDatasetWriter();
+    for (int i = 0; i < 6; i++) {
+      dataset_writer->WriteRecordBatch(MakeBatch(5), "");
+    }
+    EndWriterChecked(dataset_writer.get());
+    // The first 20 rows are staged together and sorted into one row group, the last
+    // 10 rows are sorted on their own when the file is finished
+    std::optional<MockFileInfo> written_file = FindFile("testdir/chunk-0.arrow");
+    AssertFileCreated(written_file, "testdir/chunk-0.arrow");
+    int num_batches = 0;
+    std::shared_ptr<RecordBatch> written = ReadAsBatch(written_file->data, &num_batches);
+    ASSERT_EQ(2, num_batches);
+    Int64Builder builder;
+    for (int64_t i = 19; i >= 0; i--) {
+      ASSERT_OK(builder.Append(i));
+    }
+    for (int64_t i = 29; i >= 20; i--) {
+      ASSERT_OK(builder.Append(i));
+    }
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Array> expected, builder.Finish());
+    AssertArraysEqual(*expected, *written->column(0));
+  }
+
   std::shared_ptr<MockFileSystem> filesystem_;
   std::shared_ptr<Schema> schema_;
   std::vector<std::string> pre_finish_visited_;
@@ -276,6 +307,15 @@ TEST_F(DatasetWriterTestFixture, BatchGreaterThanMaxRowsQueued) {
   ASSERT_EQ(paused_, false);
 }
 
+TEST_F(DatasetWriterTestFixture, BatchGreaterThanMaxBytesQueued) {
+  auto dataset_writer = MakeDatasetWriter(kDefaultDatasetWriterMaxRowsQueued,
+                                          /*max_bytes=*/16);
+  dataset_writer->WriteRecordBatch(MakeBatch(35), "");
+  EndWriterChecked(dataset_writer.get());
+  AssertCreatedData({{"testdir/chunk-0.arrow", 0, 35}});
+  ASSERT_EQ(paused_, false);
+}
+
 TEST_F(DatasetWriterTestFixture, BatchWriteConcurrent) {
 #ifndef ARROW_ENABLE_THREADING
   GTEST_SKIP() << "Test requires threading support";
@@ -346,6 +386,28 @@ TEST_F(DatasetWriterTestFixture, MaxRowsOneWriteBackpresure) {
   AssertCreatedData(expected_files);
 }
 
+TEST_F(DatasetWriterTestFixture, MaxBytesOneWriteBackpressure) {
+  // Same as above, but with the byte throttle being the one applying backpressure.
+  // Staged rows must not hold on to more bytes than can ever be released.
+  constexpr auto kFileSizeLimit = static_cast<uint64_t>(10);
+  write_options_.max_rows_per_file = kFileSizeLimit;
+  write_options_.max_rows_per_group = kFileSizeLimit;
+  write_options_.max_open_files = 2;
+  write_options_.min_rows_per_group = kFileSizeLimit - 1;
+  auto dataset_writer = MakeDatasetWriter(kDefaultDatasetWriterMaxRowsQueued,
+                                          /*max_bytes=*/kFileSizeLimit * 8);
+  for (int i = 0; i < 5; ++i) {
+    dataset_writer->WriteRecordBatch(MakeBatch(kFileSizeLimit * 2), "");
+  }
+  EndWriterChecked(dataset_writer.get());
+  std::vector<ExpectedFile> expected_files;
+  for (int i = 0; i < 10; ++i) {
+    expected_files.emplace_back("testdir/chunk-" + std::to_string(i) + ".arrow",
+                                kFileSizeLimit * i, kFileSizeLimit);
+  }
+  AssertCreatedData(expected_files);
+}
+
 TEST_F(DatasetWriterTestFixture, MaxRowsOneWriteWithFunctor) {
   // Left padding with up to four zeros
   write_options_.max_rows_per_group = 10;
@@ -450,6 +512,41 @@ TEST_F(DatasetWriterTestFixture, MinAndMaxRowGroup) {
   AssertCreatedData({{"testdir/chunk-0.arrow", 0, 60, 6}});
 }
 
+TEST_F(DatasetWriterTestFixture, MinBytesRowGroup) {
+  // 8 bytes per row, so the same groups as MinRowGroup
+  write_options_.min_bytes_per_group = 20 * sizeof(int64_t);
+  auto dataset_writer = MakeDatasetWriter();
+  for (int i = 0; i < 6; i++) {
+    dataset_writer->WriteRecordBatch(MakeBatch(5), "");
+  }
+  for (int i = 0; i < 4; i++) {
+    dataset_writer->WriteRecordBatch(MakeBatch(4), "");
+  }
+  EndWriterChecked(dataset_writer.get());
+  AssertCreatedData({{"testdir/chunk-0.arrow", 0, 46, 3}});
+}
+
+TEST_F(DatasetWriterTestFixture, MaxBytesRowGroup) {
+  // 8 bytes per row, so the same groups as MaxRowGroup
+  write_options_.max_bytes_per_group = 10 * sizeof(int64_t);
+  auto dataset_writer = MakeDatasetWriter();
+  dataset_writer->WriteRecordBatch(MakeBatch(10), "");
+  dataset_writer->WriteRecordBatch(MakeBatch(15), "");
+  dataset_writer->WriteRecordBatch(MakeBatch(15), "");
+  dataset_writer->WriteRecordBatch(MakeBatch(20), "");
+  EndWriterChecked(dataset_writer.get());
+  AssertCreatedData({{"testdir/chunk-0.arrow", 0, 60, 7}});
+}
+
+TEST_F(DatasetWriterTestFixture, ClusteringKeysLinear) {
+  CheckClusteredDescending(ClusteringOrder::kLinear);
+}
+
+TEST_F(DatasetWriterTestFixture, ClusteringKeysZOrder) {
+  // With a single key a Z-order curve is just the order of that key
+  CheckClusteredDescending(ClusteringOrder::kZOrder);
+}
+
 TEST_F(DatasetWriterTestFixture, MinRowGroupBackpressure) {
   // This tests the case where we end up queuing too much data because we're waiting for
   // enough data to form a min row group and we fill up the dataset writer (it should
@@ -30,6 +30,7 @@
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/record_batch.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string.h"
 
@@ -182,29 +183,36 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
   }
 
   ARROW_ASSIGN_OR_RAISE(selector.base_dir, filesystem->NormalizePath(selector.base_dir));
-  ARROW_ASSIGN_OR_RAISE(auto files, filesystem->GetFileInfo(selector));
 
   // Filter out anything that's not a file or that's explicitly ignored
-  Status st;
-  auto files_end =
-      std::remove_if(files.begin(), files.end(), [&](const fs::FileInfo& info) {
-        if (!info.IsFile()) return true;
-
-        auto relative = fs::internal::RemoveAncestor(selector.base_dir, info.path());
-        if (!relative.has_value()) {
-          st = Status::Invalid("GetFileInfo() yielded path '", info.path(),
-                               "', which is outside base dir '", selector.base_dir, "'");
-          return false;
-        }
+  auto keep_file = [&](const fs::FileInfo& info) -> Result<bool> {
+    if (!info.IsFile()) return false;
 
-        if (StartsWithAnyOf(std::string(*relative), options.selector_ignore_prefixes)) {
-          return true;
-        }
+    auto relative = fs::internal::RemoveAncestor(selector.base_dir, info.path());
+    if (!relative.has_value()) {
+      return Status::Invalid("GetFileInfo() yielded path '", info.path(),
+                             "', which is outside base dir '", selector.base_dir, "'");
+    }
 
-        return false;
+    return !StartsWithAnyOf(std::string(*relative), options.selector_ignore_prefixes);
+  };
+
+  // Consume the listing as it is produced rather than waiting for the full result of
+  // GetFileInfo(), so that filesystems which list directories concurrently can do so
+  // and filtering overlaps with the listing of large trees.
+  std::vector<fs::FileInfo> files;
+  auto listed = VisitAsyncGenerator(
+      filesystem->GetFileInfoGenerator(selector),
+      [&](std::vector<fs::FileInfo> batch) -> Status {
+        for (auto& info : batch) {
+          ARROW_ASSIGN_OR_RAISE(bool keep, keep_file(info));
+          if (keep) {
+            files.push_back(std::move(info));
+          }
+        }
+        return Status::OK();
       });
-  RETURN_NOT_OK(st);
-  files.erase(files_end, files.end());
+  RETURN_NOT_OK(listed.status());
 
   // Sorting by path guarantees a stability sometimes needed by unit tests.
   std::sort(files.begin(), files.end(), fs::FileInfo::ByPath());
@@ -33,6 +33,7 @@
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/dataset_writer.h"
 #include "arrow/dataset/forest_internal.h"
+#include "arrow/dataset/partition_index_internal.h"
 #include "arrow/dataset/projector.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/dataset/subtree_internal.h"
@@ -180,6 +181,22 @@ Result<std::shared_ptr<FileFragment>> FileFormat::MakeFragment(
                        std::move(partition_expression), std::move(physical_schema)));
 }
 
+Result<std::shared_ptr<Buffer>> FileFormat::SerializeFragmentMetadata(
+    const std::shared_ptr<FileFragment>& fragment) const {
+  return nullptr;
+}
+
+Result<std::shared_ptr<FileFragment>> FileFormat::MakeFragmentFromManifest(
+    FileSource source, compute::Expression partition_expression,
+    std::shared_ptr<Schema> physical_schema, std::shared_ptr<Buffer> metadata) {
+  ARROW_ASSIGN_OR_RAISE(auto fragment, MakeFragment(std::move(source),
+                                                    std::move(partition_expression),
+                                                    physical_schema));
+  // Cache the recorded physical schema so that the file needn't be inspected
+  fragment->physical_schema_ = std::move(physical_schema);
+  return fragment;
+}
+
 Result<std::shared_ptr<Schema>> FileFragment::ReadPhysicalSchemaImpl() {
   return format_->Inspect(source_);
 }
@@ -221,6 +238,14 @@ Future<std::optional<int64_t>> FileFragment::CountRows(
   return format()->CountRows(self, std::move(predicate), options);
 }
 
+std::optional<int64_t> FileFragment::EstimateScanBytes() {
+  const int64_t size = source_.Size();
+  if (size < 0) {
+    return std::nullopt;
+  }
+  return size;
+}
+
 bool FileFragment::Equals(const FileFragment& other) const {
   return source_.Equals(other.source_) && format_->Equals(*other.format_);
 }
@@ -230,6 +255,8 @@ struct FileSystemDataset::FragmentSubtrees {
   Forest forest;
   // fragment indices and subtree expressions in forest order
   std::vector<std::variant<int, compute::Expression>> fragments_and_subtrees;
+  // Index of the partition key values of the fragments
+  PartitionIndex index;
 };
 
 Result<std::shared_ptr<FileSystemDataset>> FileSystemDataset::Make(
@@ -302,6 +329,12 @@ void FileSystemDataset::SetupSubtreePruning() {
 
   subtrees_->forest =
       Forest(static_cast<int>(encoded.size()), SubtreeImpl::IsAncestor{encoded});
+
+  subtrees_->index = PartitionIndex::Make(
+      [&](int index) -> const compute::Expression& {
+        return fragments_[index]->partition_expression();
+      },
+      static_cast<int>(fragments_.size()));
 }
 
 Result<FragmentIterator> FileSystemDataset::GetFragmentsImpl(
@@ -311,6 +344,23 @@ Result<FragmentIterator> FileSystemDataset::GetFragmentsImpl(
     return MakeVectorIterator(FragmentVector(fragments_.begin(), fragments_.end()));
   }
 
+  // Comparisons of partition fields with literals select the candidate fragments in
+  // logarithmic time. Visiting the forest is cheaper when most fragments are
+  // candidates, as it simplifies the predicate once per subtree.
+  auto candidates = subtrees_->index.Candidates(predicate);
+  if (candidates && candidates->size() * 2 < fragments_.size()) {
+    FragmentVector fragments;
+    for (int i : *candidates) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto simplified,
+          SimplifyWithGuarantee(predicate, fragments_[i]->partition_expression()));
+      if (simplified.IsSatisfiable()) {
+        fragments.push_back(fragments_[i]);
+      }
+    }
+    return MakeVectorIterator(std::move(fragments));
+  }
+
   std::vector<int> fragment_indices;
 
   std::vector<compute::Expression> predicates{predicate};
@@ -390,12 +440,20 @@ Status WriteBatch(
                            write_options.max_partitions);
   }
 
+  // The guarantee may hold values of partition fields missing from the batch, in
+  // which case the paths must be formatted from the full expressions
+  const bool use_paths =
+      !groups.paths.empty() && guarantee.Equals(compute::literal(true));
   for (std::size_t index = 0; index < groups.batches.size(); index++) {
-    auto partition_expression = and_(groups.expressions[index], guarantee);
     auto next_batch = groups.batches[index];
     PartitionPathFormat destination;
-    ARROW_ASSIGN_OR_RAISE(destination,
-                          write_options.partitioning->Format(partition_expression));
+    if (use_paths) {
+      destination = groups.paths[index];
+    } else {
+      auto partition_expression = and_(groups.expressions[index], guarantee);
+      ARROW_ASSIGN_OR_RAISE(destination,
+                            write_options.partitioning->Format(partition_expression));
+    }
     RETURN_NOT_OK(write(next_batch, destination));
   }
   return Status::OK();
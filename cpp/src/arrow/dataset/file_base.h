@@ -26,6 +26,7 @@
 #include <vector>
 
 #include "arrow/buffer.h"
+#include "arrow/compute/ordering.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/scanner.h"
@@ -110,6 +111,9 @@ class ARROW_DS_EXPORT FileSource : public util::EqualityComparable<FileSource> {
   /// \brief Return the filesystem, if any. Otherwise returns nullptr
   const std::shared_ptr<fs::FileSystem>& filesystem() const { return filesystem_; }
 
+  /// \brief Return the file info. Only valid when file source wraps a path.
+  const fs::FileInfo& file_info() const { return file_info_; }
+
   /// \brief Return the buffer containing the file, if any. Otherwise returns nullptr
   const std::shared_ptr<Buffer>& buffer() const { return buffer_; }
 
@@ -195,6 +199,21 @@ class ARROW_DS_EXPORT FileFormat : public std::enable_shared_from_this<FileForma
   Result<std::shared_ptr<FileFragment>> MakeFragment(
       FileSource source, std::shared_ptr<Schema> physical_schema = NULLPTR);
 
+  /// \brief Serialize the format-specific metadata of a fragment of this format.
+  ///
+  /// This is stored in dataset manifests (see WriteDatasetManifest) and passed back
+  /// to MakeFragmentFromManifest, so that the fragment needn't be inspected again.
+  /// Returns nullptr if the format has no such metadata.
+  virtual Result<std::shared_ptr<Buffer>> SerializeFragmentMetadata(
+      const std::shared_ptr<FileFragment>& fragment) const;
+
+  /// \brief Create a FileFragment from an entry of a dataset manifest.
+  ///
+  /// \param[in] metadata the result of SerializeFragmentMetadata, may be nullptr
+  virtual Result<std::shared_ptr<FileFragment>> MakeFragmentFromManifest(
+      FileSource source, compute::Expression partition_expression,
+      std::shared_ptr<Schema> physical_schema, std::shared_ptr<Buffer> metadata);
+
   /// \brief Create a writer for this format.
   virtual Result<std::shared_ptr<FileWriter>> MakeWriter(
       std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
@@ -229,6 +248,9 @@ class ARROW_DS_EXPORT FileFragment : public Fragment,
       const FragmentScanOptions* format_options,
       compute::ExecContext* exec_context) override;
 
+  /// \brief The size of the file, if known
+  std::optional<int64_t> EstimateScanBytes() override;
+
   std::string type_name() const override { return format_->type_name(); }
   std::string ToString() const override { return source_.path(); };
 
@@ -442,6 +464,26 @@ struct ARROW_DS_EXPORT FileSystemDatasetWriteOptions {
   /// group size is just barely larger than this value).
   uint64_t max_rows_per_group = 1 << 20;
 
+  /// If greater than 0 then, like min_rows_per_group, the dataset writer will only
+  /// write a row group once this many bytes of data have accumulated.  Bytes are
+  /// measured in memory, before encoding.  Both minimums must be met.
+  uint64_t min_bytes_per_group = 0;
+
+  /// If greater than 0 then, like max_rows_per_group, the dataset writer will split
+  /// data into row groups of about this many bytes at most.  The number of rows this
+  /// allows is estimated from the average in-memory size of the rows being written.
+  uint64_t max_bytes_per_group = 0;
+
+  /// If not unordered then the dataset writer sorts the data it has staged for a file
+  /// by these keys before cutting it into row groups.  This keeps the min/max
+  /// statistics of each row group tight, which makes them more useful for pruning,
+  /// without a separate sort of the whole dataset.  Only data staged together is
+  /// sorted, so min_rows_per_group (or min_bytes_per_group) bounds the clustering.
+  compute::Ordering clustering_keys = compute::Ordering::Unordered();
+
+  /// How multiple clustering_keys are combined
+  ClusteringOrder clustering_order = ClusteringOrder::kLinear;
+
   /// Controls what happens if an output directory already exists.
   ExistingDataBehavior existing_data_behavior = ExistingDataBehavior::kError;
 
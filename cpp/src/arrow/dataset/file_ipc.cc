@@ -25,6 +25,8 @@
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/io/file.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/util/checked_cast.h"
@@ -44,10 +46,19 @@ static inline ipc::IpcReadOptions default_read_options() {
   return options;
 }
 
+// Memory-map the files of a LocalFileSystem, see IpcFragmentScanOptions::use_mmap
+static inline Result<std::shared_ptr<io::RandomAccessFile>> OpenInput(
+    const FileSource& source, bool use_mmap) {
+  if (use_mmap && source.filesystem() && source.filesystem()->type_name() == "local") {
+    return io::MemoryMappedFile::Open(source.path(), io::FileMode::READ);
+  }
+  return source.Open();
+}
+
 static inline Result<std::shared_ptr<ipc::RecordBatchFileReader>> OpenReader(
     const FileSource& source,
-    const ipc::IpcReadOptions& options = default_read_options()) {
-  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+    const ipc::IpcReadOptions& options = default_read_options(), bool use_mmap = false) {
+  ARROW_ASSIGN_OR_RAISE(auto input, OpenInput(source, use_mmap));
 
   std::shared_ptr<ipc::RecordBatchFileReader> reader;
 
@@ -62,12 +73,12 @@ static inline Result<std::shared_ptr<ipc::RecordBatchFileReader>> OpenReader(
 
 static inline Future<std::shared_ptr<ipc::RecordBatchFileReader>> OpenReaderAsync(
     const FileSource& source,
-    const ipc::IpcReadOptions& options = default_read_options()) {
+    const ipc::IpcReadOptions& options = default_read_options(), bool use_mmap = false) {
 #ifdef ARROW_WITH_OPENTELEMETRY
   auto tracer = arrow::internal::tracing::GetTracer();
   auto span = tracer->StartSpan("arrow::dataset::IpcFileFormat::OpenReaderAsync");
 #endif
-  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+  ARROW_ASSIGN_OR_RAISE(auto input, OpenInput(source, use_mmap));
   auto path = source.path();
   return ipc::RecordBatchFileReader::OpenAsync(std::move(input), options)
       .Then(
@@ -113,6 +124,11 @@ static inline Result<ipc::IpcReadOptions> GetReadOptions(
   auto options =
       ipc_scan_options->options ? *ipc_scan_options->options : default_read_options();
   options.memory_pool = scan_options.pool;
+  if (options.batch_readahead == 0) {
+    // Read the batches ahead of the async scanner, which decodes them on the CPU
+    // thread pool
+    options.batch_readahead = scan_options.batch_readahead;
+  }
   if (!options.included_fields.empty()) {
     // Cannot set them here
     ARROW_LOG(WARNING) << "IpcFragmentScanOptions.options->included_fields was set "
@@ -141,23 +157,22 @@ Result<RecordBatchGenerator> IpcFileFormat::ScanBatchesAsync(
     const std::shared_ptr<FileFragment>& file) const {
   auto self = shared_from_this();
   auto source = file->source();
-  auto open_reader = OpenReaderAsync(source);
-  auto reopen_reader = [self, options,
-                        source](std::shared_ptr<ipc::RecordBatchFileReader> reader)
+  ARROW_ASSIGN_OR_RAISE(
+      auto ipc_scan_options,
+      GetFragmentScanOptions<IpcFragmentScanOptions>(kIpcTypeName, options.get(),
+                                                     default_fragment_scan_options));
+  const bool use_mmap = ipc_scan_options->use_mmap;
+  auto open_reader = OpenReaderAsync(source, default_read_options(), use_mmap);
+  auto reopen_reader = [self, options, source,
+                        use_mmap](std::shared_ptr<ipc::RecordBatchFileReader> reader)
       -> Future<std::shared_ptr<ipc::RecordBatchFileReader>> {
     ARROW_ASSIGN_OR_RAISE(auto options,
                           GetReadOptions(*reader->schema(), *self, *options));
-    return OpenReader(source, options);
+    return OpenReader(source, options, use_mmap);
   };
   auto readahead_level = options->batch_readahead;
-  auto default_fragment_scan_options = this->default_fragment_scan_options;
   auto open_generator = [=](const std::shared_ptr<ipc::RecordBatchFileReader>& reader)
       -> Result<RecordBatchGenerator> {
-    ARROW_ASSIGN_OR_RAISE(
-        auto ipc_scan_options,
-        GetFragmentScanOptions<IpcFragmentScanOptions>(kIpcTypeName, options.get(),
-                                                       default_fragment_scan_options));
-
     RecordBatchGenerator generator;
     if (ipc_scan_options->cache_options) {
       // Transferring helps performance when coalescing
@@ -165,6 +180,11 @@ Result<RecordBatchGenerator> IpcFileFormat::ScanBatchesAsync(
                                            /*coalesce=*/true, options->io_context,
                                            *ipc_scan_options->cache_options,
                                            ::arrow::internal::GetCpuThreadPool()));
+    } else if (use_mmap) {
+      // Coalescing the mapped file only restricts the pages advised to the OS to
+      // the projected fields, the zero-copy reads themselves need no transfer
+      ARROW_ASSIGN_OR_RAISE(generator, reader->GetRecordBatchGenerator(
+                                           /*coalesce=*/true, options->io_context));
     } else {
       ARROW_ASSIGN_OR_RAISE(generator, reader->GetRecordBatchGenerator(
                                            /*coalesce=*/false, options->io_context));
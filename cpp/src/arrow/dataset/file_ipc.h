@@ -76,11 +76,17 @@ class ARROW_DS_EXPORT IpcFragmentScanOptions : public FragmentScanOptions {
   std::string type_name() const override { return kIpcTypeName; }
 
   /// Options passed to the IPC file reader.
-  /// included_fields, memory_pool, and use_threads are ignored.
+  /// included_fields, memory_pool, and use_threads are ignored.  batch_readahead
+  /// defaults to the batch_readahead of the scan options.
   std::shared_ptr<ipc::IpcReadOptions> options;
   /// If present, the async scanner will enable I/O coalescing.
   /// This is ignored by the sync scanner.
   std::shared_ptr<io::CacheOptions> cache_options;
+  /// If true, the files of a LocalFileSystem are memory-mapped, as with
+  /// fs::LocalFileSystemOptions::use_mmap, and the batches of uncompressed files
+  /// reference the mapped memory instead of copies of it.  The async scanner
+  /// then only advises the OS to page in the ranges of the projected fields.
+  bool use_mmap = false;
 };
 
 class ARROW_DS_EXPORT IpcFileWriteOptions : public FileWriteOptions {
@@ -26,6 +26,7 @@
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/test_util_internal.h"
+#include "arrow/filesystem/localfs.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
@@ -33,11 +34,13 @@
 #include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/key_value_metadata.h"
 
 namespace arrow {
 
 using internal::checked_pointer_cast;
+using internal::TemporaryDir;
 
 namespace dataset {
 
@@ -172,6 +175,51 @@ TEST_P(TestIpcFileFormatScan, FragmentScanOptions) {
   ASSERT_OK_AND_ASSIGN(auto batch_gen, fragment->ScanBatchesAsync(opts_));
   ASSERT_FINISHES_AND_RAISES(Invalid, CollectAsyncGenerator(batch_gen));
 }
+TEST_P(TestIpcFileFormatScan, ScanMemoryMapped) {
+  auto reader = GetRecordBatchReader(
+      schema({field("f64", float64()), field("i32", int32()), field("i64", int64())}));
+  ASSERT_OK_AND_ASSIGN(auto buffer, IpcFormatHelper::Write(reader.get()));
+  ASSERT_OK_AND_ASSIGN(auto temp_dir, TemporaryDir::Make("ipc-mmap-test-"));
+  ASSERT_OK_AND_ASSIGN(auto path, temp_dir->path().Join("data.arrow"));
+  // The regular reads of the files allocate from this pool
+  ProxyMemoryPool pool(default_memory_pool());
+  auto local_fs = std::make_shared<fs::LocalFileSystem>(
+      fs::LocalFileSystemOptions::Defaults(), io::IOContext(&pool));
+  ASSERT_OK_AND_ASSIGN(auto sink, local_fs->OpenOutputStream(path.ToString()));
+  ASSERT_OK(sink->Write(buffer));
+  ASSERT_OK(sink->Close());
+
+  SetSchema(reader->schema()->fields());
+  auto scan = [&](bool use_mmap) -> std::shared_ptr<Table> {
+    auto fragment_scan_options = std::make_shared<IpcFragmentScanOptions>();
+    fragment_scan_options->use_mmap = use_mmap;
+    opts_->fragment_scan_options = fragment_scan_options;
+    auto fragment = MakeFragment(FileSource(path.ToString(), local_fs));
+    RecordBatchVector batches;
+    for (auto maybe_batch : PhysicalBatches(fragment)) {
+      EXPECT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      batches.push_back(std::move(batch));
+    }
+    EXPECT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(batches));
+    return table;
+  };
+
+  for (bool projected : {false, true}) {
+    ARROW_SCOPED_TRACE("projected = ", projected);
+    if (projected) {
+      Project({"i32"});
+    }
+    auto expected = scan(/*use_mmap=*/false);
+    ASSERT_EQ(expected->num_rows(), expected_rows());
+    ASSERT_GT(pool.total_bytes_allocated(), 0);
+
+    const int64_t allocated = pool.total_bytes_allocated();
+    auto actual = scan(/*use_mmap=*/true);
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+    // The batches reference the mapped file
+    ASSERT_EQ(pool.total_bytes_allocated(), allocated);
+  }
+}
 INSTANTIATE_TEST_SUITE_P(TestScan, TestIpcFileFormatScan,
                          ::testing::ValuesIn(TestFormatParams::Values()),
                          TestFormatParams::ToTestNameString);
@@ -17,12 +17,21 @@
 
 #include "arrow/dataset/file_orc.h"
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 
 #include "arrow/adapters/orc/adapter.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/cast.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/scalar.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
@@ -31,12 +40,25 @@
 
 namespace arrow {
 
+using internal::checked_cast;
 using internal::checked_pointer_cast;
 
 namespace dataset {
 
 namespace {
 
+Result<std::unique_ptr<arrow::adapters::orc::ORCFileReader>> OpenORCReader(
+    const FileSource& source, std::shared_ptr<io::RandomAccessFile> input,
+    MemoryPool* pool) {
+  auto reader = arrow::adapters::orc::ORCFileReader::Open(std::move(input), pool);
+  auto status = reader.status();
+  if (!status.ok()) {
+    return status.WithMessage("Could not open ORC input source '", source.path(),
+                              "': ", status.message());
+  }
+  return reader;
+}
+
 Result<std::unique_ptr<arrow::adapters::orc::ORCFileReader>> OpenORCReader(
     const FileSource& source,
     const std::shared_ptr<ScanOptions>& scan_options = nullptr) {
@@ -49,95 +71,169 @@ Result<std::unique_ptr<arrow::adapters::orc::ORCFileReader>> OpenORCReader(
     pool = default_memory_pool();
   }
 
-  auto reader = arrow::adapters::orc::ORCFileReader::Open(std::move(input), pool);
-  auto status = reader.status();
-  if (!status.ok()) {
-    return status.WithMessage("Could not open ORC input source '", source.path(),
-                              "': ", status.message());
-  }
-  return reader;
+  return OpenORCReader(source, std::move(input), pool);
 }
 
-/// \brief A ScanTask backed by an ORC file.
-class OrcScanTask {
- public:
-  OrcScanTask(std::shared_ptr<FileFragment> fragment,
-              std::shared_ptr<ScanOptions> options)
-      : fragment_(std::move(fragment)), options_(std::move(options)) {}
-
-  Result<RecordBatchIterator> Execute() {
-    struct Impl {
-      static Result<RecordBatchIterator> Make(const FileSource& source,
-                                              const FileFormat& format,
-                                              const ScanOptions& scan_options) {
-        ARROW_ASSIGN_OR_RAISE(
-            auto reader,
-            OpenORCReader(source, std::make_shared<ScanOptions>(scan_options)));
-
-        auto materialized_fields = scan_options.MaterializedFields();
-        // filter out virtual columns
-        std::vector<std::string> included_fields;
-        ARROW_ASSIGN_OR_RAISE(auto schema, reader->ReadSchema());
-        for (const auto& ref : materialized_fields) {
-          ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*schema));
-          if (match.indices().empty()) continue;
-
-          included_fields.push_back(schema->field(match.indices()[0])->name());
-        }
-
-        std::shared_ptr<RecordBatchReader> record_batch_reader;
-        ARROW_ASSIGN_OR_RAISE(
-            record_batch_reader,
-            reader->GetRecordBatchReader(scan_options.batch_size, included_fields));
-
-        return RecordBatchIterator(Impl{std::move(record_batch_reader)});
-      }
+std::optional<compute::Expression> StatisticsAsExpression(
+    const Field& field, const adapters::orc::StripeColumnStatistics& statistics) {
+  auto field_expr = compute::field_ref(field.name());
 
-      Result<std::shared_ptr<RecordBatch>> Next() {
-        std::shared_ptr<RecordBatch> batch;
-        RETURN_NOT_OK(record_batch_reader_->ReadNext(&batch));
-        return batch;
-      }
+  // The column is empty or all values are null
+  if (statistics.num_values == 0) {
+    return compute::is_null(std::move(field_expr));
+  }
+  if (statistics.min == nullptr || statistics.max == nullptr) {
+    return std::nullopt;
+  }
+  auto is_nan = [](const Scalar& scalar) {
+    return scalar.type->id() == Type::DOUBLE &&
+           std::isnan(checked_cast<const DoubleScalar&>(scalar).value);
+  };
+  if (is_nan(*statistics.min) || is_nan(*statistics.max)) {
+    return std::nullopt;
+  }
 
-      std::shared_ptr<RecordBatchReader> record_batch_reader_;
-    };
+  auto maybe_min = compute::Cast(statistics.min, field.type());
+  auto maybe_max = compute::Cast(statistics.max, field.type());
+  if (!maybe_min.ok() || !maybe_max.ok()) {
+    return std::nullopt;
+  }
+  auto min = maybe_min.MoveValueUnsafe().scalar();
+  auto max = maybe_max.MoveValueUnsafe().scalar();
 
-    return Impl::Make(fragment_->source(),
-                      *checked_pointer_cast<FileFragment>(fragment_)->format(),
-                      *options_);
+  std::vector<compute::Expression> bounds;
+  if (min->Equals(*max)) {
+    bounds.push_back(compute::equal(field_expr, compute::literal(std::move(min))));
+  } else {
+    bounds.push_back(compute::greater_equal(field_expr, compute::literal(min)));
+    bounds.push_back(compute::less_equal(field_expr, compute::literal(max)));
+  }
+  // Each bound is disjuncted with is_null separately, since SimplifyWithGuarantee
+  // only uses guarantees of the form `cmp(field, value) [or is_null(field)]`
+  if (statistics.has_null) {
+    for (auto& bound : bounds) {
+      bound = compute::or_(std::move(bound), compute::is_null(field_expr));
+    }
   }
+  return compute::and_(std::move(bounds));
+}
 
- private:
-  std::shared_ptr<FileFragment> fragment_;
-  std::shared_ptr<ScanOptions> options_;
-};
+// Return the stripes of the file that may contain rows satisfying the predicate,
+// according to the statistics of the top-level fields it references.
+Result<std::vector<int>> SelectStripes(adapters::orc::ORCFileReader* reader,
+                                       const Schema& physical_schema,
+                                       const compute::Expression& predicate) {
+  const auto num_stripes = static_cast<int>(reader->NumberOfStripes());
+  std::vector<int> stripes;
+  stripes.reserve(num_stripes);
+
+  std::vector<int> field_indices;
+  if (predicate.IsBound()) {
+    for (const auto& ref : compute::FieldsInExpression(predicate)) {
+      ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(physical_schema));
+      if (match.indices().size() == 1) {
+        field_indices.push_back(match.indices()[0]);
+      }
+    }
+  }
 
-class OrcScanTaskIterator {
- public:
-  static Result<Iterator<std::shared_ptr<OrcScanTask>>> Make(
-      std::shared_ptr<ScanOptions> options, std::shared_ptr<FileFragment> fragment) {
-    return Iterator<std::shared_ptr<OrcScanTask>>(
-        OrcScanTaskIterator(std::move(options), std::move(fragment)));
+  for (int stripe = 0; stripe < num_stripes; ++stripe) {
+    std::vector<compute::Expression> guarantees;
+    for (int field_index : field_indices) {
+      ARROW_ASSIGN_OR_RAISE(auto statistics,
+                            reader->GetStripeColumnStatistics(stripe, field_index));
+      if (!statistics) break;
+      auto guarantee =
+          StatisticsAsExpression(*physical_schema.field(field_index), *statistics);
+      if (guarantee) guarantees.push_back(std::move(*guarantee));
+    }
+    if (!guarantees.empty()) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto bound, compute::and_(std::move(guarantees)).Bind(physical_schema));
+      ARROW_ASSIGN_OR_RAISE(auto stripe_predicate,
+                            compute::SimplifyWithGuarantee(predicate, bound));
+      if (!stripe_predicate.IsSatisfiable()) continue;
+    }
+    stripes.push_back(stripe);
   }
+  return stripes;
+}
 
-  Result<std::shared_ptr<OrcScanTask>> Next() {
-    if (once_) {
-      // Iteration is done.
-      return nullptr;
+/// \brief Reads the selected stripes of an ORC file.
+///
+/// Each stripe is read by its own ORCFileReader, opened from the file tail of the
+/// first one, so that several stripes can be read at once.
+struct OrcStripeScanner {
+  std::shared_ptr<io::RandomAccessFile> input;
+  std::string file_tail;
+  std::vector<std::string> included_fields;
+  MemoryPool* pool;
+  int64_t batch_size;
+
+  static Result<RecordBatchGenerator> Make(const FileSource& source,
+                                           const std::shared_ptr<ScanOptions>& options,
+                                           compute::Expression predicate) {
+    auto scanner = std::make_shared<OrcStripeScanner>();
+    ARROW_ASSIGN_OR_RAISE(scanner->input, source.Open());
+    ARROW_ASSIGN_OR_RAISE(auto reader,
+                          OpenORCReader(source, scanner->input, options->pool));
+    ARROW_ASSIGN_OR_RAISE(auto schema, reader->ReadSchema());
+
+    // filter out virtual columns
+    for (const auto& ref : options->MaterializedFields()) {
+      ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*schema));
+      if (match.indices().empty()) continue;
+
+      scanner->included_fields.push_back(schema->field(match.indices()[0])->name());
+    }
+    ARROW_ASSIGN_OR_RAISE(auto stripes,
+                          SelectStripes(reader.get(), *schema, predicate));
+    scanner->file_tail = reader->GetSerializedFileTail();
+    scanner->pool = options->pool;
+    scanner->batch_size = options->batch_size;
+
+    // Read enough stripes ahead to cover about batch_readahead batches
+    int stripe_readahead = 0;
+    if (options->use_threads && options->batch_readahead > 0 && !stripes.empty()) {
+      const int64_t rows_per_stripe =
+          std::max<int64_t>(1, reader->NumberOfRows() / reader->NumberOfStripes());
+      const int64_t rows_to_readahead = options->batch_readahead * options->batch_size;
+      stripe_readahead = static_cast<int>(std::clamp<int64_t>(
+          rows_to_readahead / rows_per_stripe, 1, options->batch_readahead));
     }
 
-    once_ = true;
-    return std::make_shared<OrcScanTask>(fragment_, options_);
+    // Wrapped in std::optional, which provides the end-of-iteration marker
+    std::vector<std::optional<int>> stripe_indices(stripes.begin(), stripes.end());
+    auto io_executor = options->io_context.executor();
+    AsyncGenerator<RecordBatchGenerator> stripe_generator = MakeMappedGenerator(
+        MakeVectorGenerator(std::move(stripe_indices)),
+        [scanner, io_executor](const std::optional<int>& stripe) {
+          return DeferNotOk(io_executor->Submit(
+              [scanner, stripe = *stripe] { return scanner->ReadStripe(stripe); }));
+        });
+    if (stripe_readahead > 0) {
+      stripe_generator =
+          MakeReadaheadGenerator(std::move(stripe_generator), stripe_readahead);
+    }
+    return MakeConcatenatedGenerator(std::move(stripe_generator));
   }
 
- private:
-  OrcScanTaskIterator(std::shared_ptr<ScanOptions> options,
-                      std::shared_ptr<FileFragment> fragment)
-      : options_(std::move(options)), fragment_(std::move(fragment)) {}
+  Result<RecordBatchGenerator> ReadStripe(int stripe) const {
+    ARROW_ASSIGN_OR_RAISE(auto reader,
+                          adapters::orc::ORCFileReader::Open(input, pool, file_tail));
+    std::shared_ptr<RecordBatch> batch;
+    if (included_fields.empty()) {
+      ARROW_ASSIGN_OR_RAISE(batch, reader->ReadStripe(stripe));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(batch, reader->ReadStripe(stripe, included_fields));
+    }
 
-  bool once_ = false;
-  std::shared_ptr<ScanOptions> options_;
-  std::shared_ptr<FileFragment> fragment_;
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    for (int64_t offset = 0; offset < batch->num_rows(); offset += batch_size) {
+      batches.push_back(batch->Slice(offset, batch_size));
+    }
+    return MakeVectorGenerator(std::move(batches));
+  }
 };
 
 }  // namespace
@@ -157,45 +253,16 @@ Result<std::shared_ptr<Schema>> OrcFileFormat::Inspect(const FileSource& source)
 Result<RecordBatchGenerator> OrcFileFormat::ScanBatchesAsync(
     const std::shared_ptr<ScanOptions>& options,
     const std::shared_ptr<FileFragment>& file) const {
-  // TODO investigate "true" async version
-  // (https://issues.apache.org/jira/browse/ARROW-13795)
-  ARROW_ASSIGN_OR_RAISE(auto task_iter, OrcScanTaskIterator::Make(options, file));
-  struct IterState {
-    Iterator<std::shared_ptr<OrcScanTask>> iter;
-    RecordBatchIterator curr_iter;
-    bool first;
-    ::arrow::internal::Executor* io_executor;
-  };
-  struct {
-    Future<std::shared_ptr<RecordBatch>> operator()() {
-      auto state = state_;
-      return ::arrow::DeferNotOk(
-          state->io_executor->Submit([state]() -> Result<std::shared_ptr<RecordBatch>> {
-            if (state->first) {
-              ARROW_ASSIGN_OR_RAISE(auto task, state->iter.Next());
-              ARROW_ASSIGN_OR_RAISE(state->curr_iter, task->Execute());
-              state->first = false;
-            }
-            while (!IsIterationEnd(state->curr_iter)) {
-              ARROW_ASSIGN_OR_RAISE(auto next_batch, state->curr_iter.Next());
-              if (IsIterationEnd(next_batch)) {
-                ARROW_ASSIGN_OR_RAISE(auto task, state->iter.Next());
-                if (IsIterationEnd(task)) {
-                  state->curr_iter = IterationEnd<RecordBatchIterator>();
-                } else {
-                  ARROW_ASSIGN_OR_RAISE(state->curr_iter, task->Execute());
-                }
-              } else {
-                return next_batch;
-              }
-            }
-            return IterationEnd<std::shared_ptr<RecordBatch>>();
-          }));
-    }
-    std::shared_ptr<IterState> state_;
-  } iter_to_gen{std::shared_ptr<IterState>(
-      new IterState{std::move(task_iter), {}, true, options->io_context.executor()})};
-  return iter_to_gen;
+  ARROW_ASSIGN_OR_RAISE(
+      auto predicate,
+      compute::SimplifyWithGuarantee(options->filter, file->partition_expression()));
+  // Opening the file and reading its statistics may block, so do it on the I/O pool
+  auto maybe_generator = options->io_context.executor()->Submit(
+      [options, file, predicate = std::move(predicate)] {
+        return OrcStripeScanner::Make(file->source(), options, predicate);
+      });
+  ARROW_ASSIGN_OR_RAISE(auto generator, maybe_generator);
+  return MakeFromFuture(std::move(generator));
 }
 
 Future<std::optional<int64_t>> OrcFileFormat::CountRows(
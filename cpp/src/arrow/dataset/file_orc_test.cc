@@ -88,6 +88,35 @@ TEST_P(TestOrcFileFormatScan, ScanRecordBatchReaderWithDuplicateColumnError) {
   TestScanWithDuplicateColumnError();
 }
 TEST_P(TestOrcFileFormatScan, ScanWithPushdownNulls) { TestScanWithPushdownNulls(); }
+TEST_P(TestOrcFileFormatScan, PredicatePushdownStripes) {
+  auto i64 = field("i64", int64());
+  auto str = field("str", utf8());
+  SetSchema({i64, str});
+
+  auto rb = RecordBatchFromJSON(schema({i64, str}), R"([
+      [1, "a"], [2, "b"], [3, "c"], [4, null], [5, "e"]
+    ])");
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchReader::Make({rb}));
+  auto source = GetFileSource(reader.get());
+  auto fragment = MakeFragment(*source);
+
+  auto count_physical_rows = [&](compute::Expression filter) {
+    SetFilter(std::move(filter));
+    int64_t row_count = 0;
+    for (auto maybe_batch : PhysicalBatches(fragment)) {
+      EXPECT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      row_count += batch->num_rows();
+    }
+    return row_count;
+  };
+
+  // The stripe is skipped when its statistics rule out the filter
+  ASSERT_EQ(count_physical_rows(greater(field_ref("i64"), literal(int64_t{5}))), 0);
+  ASSERT_EQ(count_physical_rows(equal(field_ref("str"), literal("z"))), 0);
+  // ... and read whole otherwise
+  ASSERT_EQ(count_physical_rows(greater(field_ref("i64"), literal(int64_t{4}))), 5);
+  ASSERT_EQ(count_physical_rows(is_null(field_ref("str"))), 5);
+}
 INSTANTIATE_TEST_SUITE_P(TestScan, TestOrcFileFormatScan,
                          ::testing::ValuesIn(TestFormatParams::Values()),
                          TestFormatParams::ToTestNameString);
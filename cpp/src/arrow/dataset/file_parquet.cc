@@ -17,6 +17,10 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -24,27 +28,38 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/cast.h"
 #include "arrow/compute/exec.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/parquet_encryption_config.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/filesystem/path_util.h"
+#include "arrow/io/memory.h"
 #include "arrow/table.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/range.h"
 #include "arrow/util/thread_pool.h"
 #include "arrow/util/tracing_internal.h"
+#include "arrow/util/ubsan.h"
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
+#include "parquet/bloom_filter_reader.h"
 #include "parquet/encryption/crypto_factory.h"
 #include "parquet/encryption/encryption.h"
 #include "parquet/encryption/kms_client.h"
 #include "parquet/file_reader.h"
+#include "parquet/geospatial/statistics.h"
+#include "parquet/metadata_cache.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
 #include "parquet/statistics.h"
 
@@ -105,9 +120,28 @@ parquet::ReaderProperties MakeReaderProperties(
   properties.set_page_checksum_verification(
       parquet_scan_options->reader_properties->page_checksum_verification());
 
+  properties.set_metadata_cache(
+      parquet_scan_options->reader_properties->metadata_cache());
+
   return properties;
 }
 
+// Identify the version of a file for the metadata cache. Only files on a filesystem
+// whose size and modification time are known can be cached.
+std::optional<parquet::FileMetaDataCache::Key> MetaDataCacheKey(
+    const FileSource& source, const parquet::ReaderProperties& properties) {
+  const fs::FileInfo& info = source.file_info();
+  if (properties.metadata_cache() == nullptr || source.filesystem() == nullptr ||
+      info.size() == fs::kNoSize || info.mtime() == fs::kNoTime) {
+    return std::nullopt;
+  }
+  auto mtime = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      info.mtime().time_since_epoch());
+  return parquet::FileMetaDataCache::Key{
+      source.filesystem()->type_name() + "://" + info.path(), info.size(),
+      std::to_string(mtime.count())};
+}
+
 parquet::ArrowReaderProperties MakeArrowReaderProperties(
     const ParquetFileFormat& format, const parquet::FileMetaData& metadata) {
   parquet::ArrowReaderProperties properties(/* use_threads = */ false);
@@ -151,6 +185,15 @@ Result<std::shared_ptr<SchemaManifest>> GetSchemaManifest(
   return manifest;
 }
 
+Result<std::shared_ptr<Schema>> GetSchema(
+    const parquet::FileMetaData& metadata,
+    const parquet::ArrowReaderProperties& properties) {
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(parquet::arrow::FromParquetSchema(
+      metadata.schema(), properties, metadata.key_value_metadata(), &schema));
+  return schema;
+}
+
 bool IsNan(const Scalar& value) {
   if (value.is_valid) {
     if (value.type->id() == Type::FLOAT) {
@@ -189,6 +232,46 @@ std::optional<compute::Expression> ColumnChunkStatisticsAsExpression(
                                                              *statistics);
 }
 
+// Append the minimum and maximum of a column chunk to `mins` and `maxes`, cast to the
+// field's type, or return false if its statistics cannot answer for them exactly.
+// Floating point statistics are skipped because of NaN, and binary ones because
+// writers may truncate them.
+bool ColumnChunkMinMax(const SchemaField& schema_field,
+                       const parquet::RowGroupMetaData& metadata, ScalarVector* mins,
+                       ScalarVector* maxes) {
+  if (!schema_field.is_leaf()) {
+    return false;
+  }
+  const auto& type = schema_field.field->type();
+  if (!is_integer(type->id()) && type->id() != Type::DATE32 &&
+      type->id() != Type::DATE64 && type->id() != Type::TIMESTAMP) {
+    return false;
+  }
+
+  auto column_metadata = metadata.ColumnChunk(schema_field.column_index);
+  auto statistics = column_metadata->statistics();
+  if (statistics == nullptr) {
+    return false;
+  }
+  // All values are null, so the chunk does not contribute
+  if (statistics->num_values() == 0) {
+    return true;
+  }
+
+  std::shared_ptr<Scalar> min, max;
+  if (!statistics->HasMinMax() || !StatisticsAsScalars(*statistics, &min, &max).ok()) {
+    return false;
+  }
+  auto maybe_min = Cast(min, type);
+  auto maybe_max = Cast(max, type);
+  if (!maybe_min.ok() || !maybe_max.ok()) {
+    return false;
+  }
+  mins->push_back(maybe_min.MoveValueUnsafe().scalar());
+  maxes->push_back(maybe_max.MoveValueUnsafe().scalar());
+  return true;
+}
+
 void AddColumnIndices(const SchemaField& schema_field,
                       std::vector<int>* column_projection) {
   if (schema_field.is_leaf()) {
@@ -363,6 +446,421 @@ Result<bool> IsSupportedParquetFile(const ParquetFileFormat& format,
   END_PARQUET_CATCH_EXCEPTIONS
 }
 
+// Resolve a field referenced by a predicate to the leaf column it reads, if any.
+Result<const SchemaField*> ResolveLeafField(const Schema& physical_schema,
+                                            const SchemaManifest& manifest,
+                                            const FieldRef& ref) {
+  ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(physical_schema));
+
+  if (match.empty()) return nullptr;
+  const SchemaField* schema_field = &manifest.schema_fields[match[0]];
+
+  for (size_t i = 1; i < match.indices().size(); ++i) {
+    if (schema_field->field->type()->id() != Type::STRUCT) {
+      return Status::Invalid("nested paths only supported for structs");
+    }
+    schema_field = &schema_field->children[match[i]];
+  }
+
+  if (!schema_field->is_leaf()) return nullptr;
+  return schema_field;
+}
+
+// Whether the X intervals [min0, max0] and [min1, max1] intersect, where an interval
+// with min > max wraps around the antimeridian.
+bool XIntervalsIntersect(double min0, double max0, double min1, double max1) {
+  const bool wraps0 = min0 > max0;
+  const bool wraps1 = min1 > max1;
+  // Both contain the antimeridian
+  if (wraps0 && wraps1) return true;
+  if (wraps0) return max1 >= min0 || min1 <= max0;
+  if (wraps1) return max0 >= min1 || min0 <= max1;
+  return min0 <= max1 && min1 <= max0;
+}
+
+// Whether the geometries summarized by `statistics` may intersect `bbox`.
+bool MayIntersect(const parquet::geospatial::GeoStatistics& statistics,
+                  const ParquetBoundingBox& bbox) {
+  if (!statistics.is_valid()) return true;
+  const auto valid = statistics.dimension_valid();
+  const auto empty = statistics.dimension_empty();
+  const auto lower = statistics.lower_bound();
+  const auto upper = statistics.upper_bound();
+  // No coordinates at all
+  if ((valid[0] && empty[0]) || (valid[1] && empty[1])) return false;
+  if (valid[0] && !XIntervalsIntersect(lower[0], upper[0], bbox.xmin, bbox.xmax)) {
+    return false;
+  }
+  if (valid[1] && (lower[1] > bbox.ymax || upper[1] < bbox.ymin)) return false;
+  return true;
+}
+
+bool IsBooleanConnective(const std::string& function_name) {
+  return function_name == "and" || function_name == "and_kleene" ||
+         function_name == "or" || function_name == "or_kleene" ||
+         function_name == "invert";
+}
+
+// Replace the terms at the leaves of the boolean connectives at the root of `expr`
+// with the result of `visit`.
+//
+// Replacing a term which is false or null for every row by literal(false) never
+// makes the predicate false for a row where it was true, whereas this wouldn't
+// hold for terms nested in other functions (e.g. is_null).
+Result<compute::Expression> ModifyBooleanTerms(
+    compute::Expression expr,
+    const std::function<Result<compute::Expression>(compute::Expression)>& visit) {
+  auto call = expr.call();
+  if (call == nullptr || !IsBooleanConnective(call->function_name)) {
+    return visit(std::move(expr));
+  }
+  auto modified_call = *call;
+  for (auto& argument : modified_call.arguments) {
+    ARROW_ASSIGN_OR_RAISE(argument, ModifyBooleanTerms(std::move(argument), visit));
+  }
+  return compute::Expression(std::move(modified_call));
+}
+
+// A predicate term which can only be true for rows whose `field_ref` column is
+// equal to one of `values`: `equal(field_ref, value)` or `is_in(field_ref, values)`.
+struct EqualityTerm {
+  FieldRef field_ref;
+  ScalarVector values;
+};
+
+std::optional<EqualityTerm> GetEqualityTerm(const compute::Expression& expr) {
+  auto call = expr.call();
+  if (call == nullptr) return std::nullopt;
+
+  if (call->function_name == "equal") {
+    const FieldRef* ref = call->arguments[0].field_ref();
+    const Datum* value = call->arguments[1].literal();
+    if (ref == nullptr) {
+      ref = call->arguments[1].field_ref();
+      value = call->arguments[0].literal();
+    }
+    if (ref == nullptr || value == nullptr || !value->is_scalar() ||
+        !value->scalar()->is_valid) {
+      return std::nullopt;
+    }
+    return EqualityTerm{*ref, {value->scalar()}};
+  }
+
+  if (call->function_name == "is_in") {
+    const FieldRef* ref = call->arguments[0].field_ref();
+    auto options = checked_cast<const compute::SetLookupOptions*>(call->options.get());
+    if (ref == nullptr || options == nullptr || !options->value_set.is_array()) {
+      return std::nullopt;
+    }
+    auto value_set = options->value_set.make_array();
+    // Null values are not recorded in bloom filters
+    if (value_set->null_count() != 0) return std::nullopt;
+    EqualityTerm term{*ref, {}};
+    for (int64_t i = 0; i < value_set->length(); ++i) {
+      auto maybe_value = value_set->GetScalar(i);
+      if (!maybe_value.ok()) return std::nullopt;
+      term.values.push_back(maybe_value.MoveValueUnsafe());
+    }
+    return term;
+  }
+
+  return std::nullopt;
+}
+
+template <typename ArrowType>
+int64_t IntegerScalarValue(const Scalar& value) {
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+  return static_cast<int64_t>(checked_cast<const ScalarType&>(value).value);
+}
+
+// Compute the bloom filter hash of `value` as written to a column of the given
+// physical type. std::nullopt is returned when the Parquet writer might not store the
+// value verbatim (e.g. timestamps whose unit is converted), or when equal values may
+// have different encodings (e.g. -0.0 and 0.0).
+std::optional<uint64_t> BloomFilterHash(const parquet::BloomFilter& bloom_filter,
+                                        const parquet::ColumnDescriptor& descr,
+                                        const Scalar& value) {
+  std::optional<int64_t> integer;
+  switch (value.type->id()) {
+    case Type::INT8:
+      integer = IntegerScalarValue<Int8Type>(value);
+      break;
+    case Type::INT16:
+      integer = IntegerScalarValue<Int16Type>(value);
+      break;
+    case Type::INT32:
+      integer = IntegerScalarValue<Int32Type>(value);
+      break;
+    case Type::INT64:
+      integer = IntegerScalarValue<Int64Type>(value);
+      break;
+    case Type::UINT8:
+      integer = IntegerScalarValue<UInt8Type>(value);
+      break;
+    case Type::UINT16:
+      integer = IntegerScalarValue<UInt16Type>(value);
+      break;
+    case Type::UINT32:
+      integer = IntegerScalarValue<UInt32Type>(value);
+      break;
+    case Type::UINT64:
+      integer = IntegerScalarValue<UInt64Type>(value);
+      break;
+    case Type::DATE32:
+      integer = IntegerScalarValue<Date32Type>(value);
+      break;
+    case Type::STRING:
+    case Type::BINARY:
+    case Type::LARGE_STRING:
+    case Type::LARGE_BINARY:
+    case Type::STRING_VIEW:
+    case Type::BINARY_VIEW:
+      if (descr.physical_type() != parquet::Type::BYTE_ARRAY) return std::nullopt;
+      return bloom_filter.Hash(checked_cast<const BaseBinaryScalar&>(value).view());
+    case Type::FIXED_SIZE_BINARY:
+      if (descr.physical_type() != parquet::Type::FIXED_LEN_BYTE_ARRAY ||
+          descr.type_length() != value.type->byte_width()) {
+        return std::nullopt;
+      }
+      return bloom_filter.Hash(checked_cast<const BaseBinaryScalar&>(value).view());
+    default:
+      return std::nullopt;
+  }
+  // Unsigned integers are stored reinterpreted as signed integers
+  switch (descr.physical_type()) {
+    case parquet::Type::INT32:
+      return bloom_filter.Hash(static_cast<int32_t>(*integer));
+    case parquet::Type::INT64:
+      return bloom_filter.Hash(*integer);
+    default:
+      return std::nullopt;
+  }
+}
+
+void CollectLeafColumns(const SchemaField& schema_field, std::vector<int>* out) {
+  if (schema_field.is_leaf()) {
+    out->push_back(schema_field.column_index);
+    return;
+  }
+  for (const auto& child : schema_field.children) {
+    CollectLeafColumns(child, out);
+  }
+}
+
+// The columns to read in each phase of a late materialized scan. Fields are top level
+// field indices in the file, sorted.
+struct LateMaterializationPlan {
+  std::vector<int> filter_columns;
+  std::vector<int> filter_fields;
+  std::vector<int> other_columns;
+  std::vector<int> other_fields;
+};
+
+// Split the projected columns into the columns needed to evaluate the filter and
+// the others. std::nullopt is returned when the scan can't benefit from late
+// materialization, or the filter references nested fields (reading part of a struct
+// in each phase would produce two different struct columns).
+Result<std::optional<LateMaterializationPlan>> PlanLateMaterialization(
+    const parquet::arrow::FileReader& reader, const ScanOptions& options,
+    const std::vector<int>& column_projection) {
+  if (options.dataset_schema == nullptr) return std::nullopt;
+  const auto& schema_fields = reader.manifest().schema_fields;
+
+  LateMaterializationPlan plan;
+  for (FieldRef ref : FieldsInExpression(options.filter)) {
+    ARROW_ASSIGN_OR_RAISE(ref,
+                          MaybeConvertFieldRef(std::move(ref), *options.dataset_schema));
+    if (ref.name() == nullptr) return std::nullopt;
+    int field_index = -1;
+    for (int i = 0; i < static_cast<int>(schema_fields.size()); ++i) {
+      if (schema_fields[i].field->name() != *ref.name()) continue;
+      if (field_index != -1) return std::nullopt;
+      field_index = i;
+    }
+    // Fields missing from the file (e.g. partition fields) don't need to be read
+    if (field_index != -1) plan.filter_fields.push_back(field_index);
+  }
+  std::sort(plan.filter_fields.begin(), plan.filter_fields.end());
+  plan.filter_fields.erase(
+      std::unique(plan.filter_fields.begin(), plan.filter_fields.end()),
+      plan.filter_fields.end());
+  if (plan.filter_fields.empty()) return std::nullopt;
+
+  for (int field_index : plan.filter_fields) {
+    CollectLeafColumns(schema_fields[field_index], &plan.filter_columns);
+  }
+  std::unordered_set<int> filter_columns(plan.filter_columns.begin(),
+                                         plan.filter_columns.end());
+  std::unordered_set<int> other_columns;
+  for (int column : column_projection) {
+    if (filter_columns.count(column) == 0 && other_columns.insert(column).second) {
+      plan.other_columns.push_back(column);
+    }
+  }
+  if (plan.other_columns.empty()) return std::nullopt;
+
+  for (int i = 0; i < static_cast<int>(schema_fields.size()); ++i) {
+    std::vector<int> leaves;
+    CollectLeafColumns(schema_fields[i], &leaves);
+    if (std::any_of(leaves.begin(), leaves.end(),
+                    [&](int column) { return other_columns.count(column) != 0; })) {
+      plan.other_fields.push_back(i);
+    }
+  }
+  return plan;
+}
+
+// Return the rows at the given positions in `rows`.
+Result<parquet::RowRanges> RowsAtPositions(const parquet::RowRanges& rows,
+                                           const parquet::RowRanges& positions) {
+  if (!positions.empty() && positions.ranges().back().end > rows.row_count()) {
+    return Status::Invalid("Read more rows than selected in row group");
+  }
+  std::vector<parquet::RowRanges::Range> out;
+  auto row_range = rows.ranges().begin();
+  // The position of the first row of `row_range`
+  int64_t range_position = 0;
+  for (auto position : positions.ranges()) {
+    while (position.start < position.end) {
+      while (range_position + row_range->length() <= position.start) {
+        range_position += row_range->length();
+        ++row_range;
+      }
+      const int64_t offset = position.start - range_position;
+      const int64_t length =
+          std::min(position.end - position.start, row_range->length() - offset);
+      out.push_back({row_range->start + offset, row_range->start + offset + length});
+      position.start += length;
+    }
+  }
+  return parquet::RowRanges(std::move(out));
+}
+
+// Append the positions of the rows selected by `mask` to `out`, offset by `offset`.
+Status AppendSelectedPositions(const Datum& mask, int64_t length, int64_t offset,
+                               MemoryPool* pool,
+                               std::vector<parquet::RowRanges::Range>* out) {
+  if (mask.is_scalar()) {
+    const auto& scalar = mask.scalar_as<BooleanScalar>();
+    if (scalar.is_valid && scalar.value && length > 0) {
+      out->push_back({offset, offset + length});
+    }
+    return Status::OK();
+  }
+  const ArrayData& data = *mask.array();
+  const uint8_t* bitmap = data.buffers[1]->data();
+  int64_t bitmap_offset = data.offset;
+  std::shared_ptr<Buffer> selected;
+  if (data.MayHaveNulls()) {
+    // Null is not selected
+    ARROW_ASSIGN_OR_RAISE(selected, ::arrow::internal::BitmapAnd(
+                                        pool, data.buffers[0]->data(), data.offset,
+                                        bitmap, data.offset, data.length, 0));
+    bitmap = selected->data();
+    bitmap_offset = 0;
+  }
+  for (const auto& range :
+       parquet::RowRanges::FromBitmap(bitmap, bitmap_offset, data.length).ranges()) {
+    out->push_back({offset + range.start, offset + range.end});
+  }
+  return Status::OK();
+}
+
+// Read one row group in two phases: first the columns the filter needs, which are
+// used to evaluate the filter, then the other columns, skipping the rows which didn't
+// pass the filter. `rows` are the rows to read from the row group, if not all.
+Future<RecordBatchVector> ReadRowGroupLateMaterialized(
+    std::shared_ptr<parquet::arrow::FileReader> reader, int row_group,
+    std::optional<parquet::RowRanges> rows,
+    std::shared_ptr<const LateMaterializationPlan> plan,
+    std::shared_ptr<ScanOptions> options, compute::Expression guarantee,
+    ::arrow::internal::Executor* cpu_executor) {
+  RecordBatchGenerator filter_generator;
+  if (rows) {
+    ARROW_ASSIGN_OR_RAISE(filter_generator,
+                          reader->GetRecordBatchGenerator(
+                              reader, {row_group}, plan->filter_columns, {*rows},
+                              cpu_executor));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(filter_generator,
+                          reader->GetRecordBatchGenerator(
+                              reader, {row_group}, plan->filter_columns, cpu_executor));
+  }
+
+  auto read_other_columns = [=](const RecordBatchVector& filter_batches)
+      -> Future<RecordBatchVector> {
+    compute::ExecContext exec_context(options->pool);
+    const auto filter_options = compute::FilterOptions::Defaults();
+    std::vector<parquet::RowRanges::Range> selected;
+    RecordBatchVector filtered_batches;
+    int64_t offset = 0;
+    for (const auto& batch : filter_batches) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto exec_batch,
+          compute::MakeExecBatch(*options->dataset_schema, batch, guarantee));
+      ARROW_ASSIGN_OR_RAISE(auto mask, compute::ExecuteScalarExpression(
+                                           options->filter, exec_batch, &exec_context));
+      RETURN_NOT_OK(AppendSelectedPositions(mask, batch->num_rows(), offset,
+                                            options->pool, &selected));
+      ARROW_ASSIGN_OR_RAISE(auto filtered,
+                            compute::Filter(batch, mask, filter_options, &exec_context));
+      filtered_batches.push_back(filtered.record_batch());
+      offset += batch->num_rows();
+    }
+    parquet::RowRanges positions(std::move(selected));
+    if (positions.empty()) {
+      return RecordBatchVector{};
+    }
+    parquet::RowRanges selected_rows = positions;
+    if (rows) {
+      ARROW_ASSIGN_OR_RAISE(selected_rows, RowsAtPositions(*rows, positions));
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto other_generator,
+                          reader->GetRecordBatchGenerator(
+                              reader, {row_group}, plan->other_columns,
+                              {std::move(selected_rows)}, cpu_executor));
+    auto merge_columns =
+        [plan, filtered_batches = std::move(filtered_batches),
+         schema = filter_batches.front()->schema()](
+            const RecordBatchVector& other_batches) -> Result<RecordBatchVector> {
+      ARROW_ASSIGN_OR_RAISE(auto filter_table,
+                            Table::FromRecordBatches(schema, filtered_batches));
+      ARROW_ASSIGN_OR_RAISE(auto other_table, Table::FromRecordBatches(other_batches));
+      if (filter_table->num_rows() != other_table->num_rows() ||
+          filter_table->num_columns() != static_cast<int>(plan->filter_fields.size()) ||
+          other_table->num_columns() != static_cast<int>(plan->other_fields.size())) {
+        return Status::Invalid("Late materialized columns don't line up");
+      }
+      // Restore the order of the fields in the file
+      FieldVector fields;
+      ChunkedArrayVector columns;
+      size_t filter_i = 0, other_i = 0;
+      while (filter_i < plan->filter_fields.size() ||
+             other_i < plan->other_fields.size()) {
+        if (other_i == plan->other_fields.size() ||
+            (filter_i < plan->filter_fields.size() &&
+             plan->filter_fields[filter_i] < plan->other_fields[other_i])) {
+          fields.push_back(filter_table->schema()->field(static_cast<int>(filter_i)));
+          columns.push_back(filter_table->column(static_cast<int>(filter_i)));
+          ++filter_i;
+        } else {
+          fields.push_back(other_table->schema()->field(static_cast<int>(other_i)));
+          columns.push_back(other_table->column(static_cast<int>(other_i)));
+          ++other_i;
+        }
+      }
+      auto table = Table::Make(::arrow::schema(std::move(fields)), std::move(columns),
+                               filter_table->num_rows());
+      return TableBatchReader(*table).ToRecordBatches();
+    };
+    return CollectAsyncGenerator(std::move(other_generator))
+        .Then(std::move(merge_columns));
+  };
+  return CollectAsyncGenerator(std::move(filter_generator))
+      .Then(std::move(read_other_columns));
+}
+
 }  // namespace
 
 std::optional<compute::Expression> ParquetFileFragment::EvaluateStatisticsAsExpression(
@@ -489,11 +987,15 @@ Result<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
                                                          default_fragment_scan_options));
   auto properties =
       MakeReaderProperties(*this, parquet_scan_options.get(), "", nullptr, options->pool);
+  auto cache_key = metadata ? std::nullopt : MetaDataCacheKey(source, properties);
   ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
   // `parquet::ParquetFileReader::Open` will not wrap the exception as status,
   // so using `open_parquet_file` to wrap it.
   auto open_parquet_file = [&]() -> Result<std::unique_ptr<parquet::ParquetFileReader>> {
     BEGIN_PARQUET_CATCH_EXCEPTIONS
+    if (cache_key) {
+      return parquet::ParquetFileReader::Open(std::move(input), properties, *cache_key);
+    }
     auto reader = parquet::ParquetFileReader::Open(std::move(input),
                                                    std::move(properties), metadata);
     return reader;
@@ -530,15 +1032,19 @@ Future<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
                                                          default_fragment_scan_options));
   auto properties = MakeReaderProperties(*this, parquet_scan_options.get(), source.path(),
                                          source.filesystem(), options->pool);
+  auto cache_key = metadata ? std::nullopt : MetaDataCacheKey(source, properties);
   auto self = checked_pointer_cast<const ParquetFileFormat>(shared_from_this());
 
   return source.OpenAsync().Then([self = self, properties = std::move(properties),
                                   source = source, options = options, metadata = metadata,
+                                  cache_key = std::move(cache_key),
                                   parquet_scan_options = parquet_scan_options](
                                      const std::shared_ptr<io::RandomAccessFile>&
                                          input) mutable {
-    return parquet::ParquetFileReader::OpenAsync(input, properties, metadata)
-        .Then(
+    auto open = cache_key
+                    ? parquet::ParquetFileReader::OpenAsync(input, properties, *cache_key)
+                    : parquet::ParquetFileReader::OpenAsync(input, properties, metadata);
+    return open.Then(
             [=](const std::unique_ptr<parquet::ParquetFileReader>& reader) mutable
             -> Result<std::shared_ptr<parquet::arrow::FileReader>> {
               auto arrow_properties = MakeArrowReaderProperties(
@@ -646,9 +1152,68 @@ Result<RecordBatchGenerator> ParquetFileFormat::ScanBatchesAsync(
     // Use the executor from scan options if provided.
     auto cpu_executor = options->cpu_executor ? options->cpu_executor
                                               : ::arrow::internal::GetCpuThreadPool();
-    ARROW_ASSIGN_OR_RAISE(auto generator, reader->GetRecordBatchGenerator(
-                                              reader, row_groups, column_projection,
-                                              cpu_executor, rows_to_readahead));
+    if (parquet_scan_options->use_bloom_filter &&
+        ExpressionHasFieldRefs(options->filter)) {
+      ARROW_ASSIGN_OR_RAISE(row_groups,
+                            parquet_fragment->FilterRowGroupsByBloomFilter(
+                                reader.get(), std::move(row_groups), options->filter));
+      if (row_groups.empty()) return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+    }
+    std::optional<LateMaterializationPlan> late_materialization;
+    if (parquet_scan_options->late_materialization &&
+        ExpressionHasFieldRefs(options->filter)) {
+      ARROW_ASSIGN_OR_RAISE(
+          late_materialization,
+          PlanLateMaterialization(*reader, *options, column_projection));
+    }
+    RecordBatchGenerator generator;
+    std::vector<parquet::RowRanges> row_ranges;
+    if (parquet_scan_options->use_page_index &&
+        ExpressionHasFieldRefs(options->filter)) {
+      ARROW_ASSIGN_OR_RAISE(row_ranges, parquet_fragment->FilterPages(
+                                            reader.get(), row_groups, options->filter));
+    }
+    // Only use the row selection when it actually excludes some rows
+    const auto& file_metadata = reader->parquet_reader()->metadata();
+    bool pages_pruned = false;
+    for (size_t i = 0; i < row_ranges.size() && !pages_pruned; ++i) {
+      pages_pruned =
+          row_ranges[i].row_count() != file_metadata->RowGroup(row_groups[i])->num_rows();
+    }
+    if (late_materialization) {
+      auto plan = std::make_shared<const LateMaterializationPlan>(
+          std::move(*late_materialization));
+      if (!pages_pruned) row_ranges.clear();
+      // Row groups are read one after the other, as the generators of the FileReader
+      // must not be used concurrently
+      auto next_row_group = std::make_shared<size_t>(0);
+      AsyncGenerator<RecordBatchGenerator> row_group_generator =
+          [reader, row_groups, row_ranges = std::move(row_ranges), plan, options,
+           guarantee = parquet_fragment->partition_expression(), cpu_executor,
+           next_row_group]() -> Future<RecordBatchGenerator> {
+        if (*next_row_group == row_groups.size()) {
+          return AsyncGeneratorEnd<RecordBatchGenerator>();
+        }
+        const size_t i = (*next_row_group)++;
+        std::optional<parquet::RowRanges> rows;
+        if (!row_ranges.empty()) rows = row_ranges[i];
+        return ReadRowGroupLateMaterialized(reader, row_groups[i], std::move(rows), plan,
+                                            options, guarantee, cpu_executor)
+            .Then([](const RecordBatchVector& batches) -> RecordBatchGenerator {
+              return MakeVectorGenerator(batches);
+            });
+      };
+      generator = MakeConcatenatedGenerator(std::move(row_group_generator));
+    } else if (pages_pruned) {
+      ARROW_ASSIGN_OR_RAISE(generator, reader->GetRecordBatchGenerator(
+                                           reader, row_groups, column_projection,
+                                           std::move(row_ranges), cpu_executor,
+                                           rows_to_readahead));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(generator, reader->GetRecordBatchGenerator(
+                                           reader, row_groups, column_projection,
+                                           cpu_executor, rows_to_readahead));
+    }
     RecordBatchGenerator sliced =
         SlicingGenerator(std::move(generator), options->batch_size);
     if (batch_readahead == 0) {
@@ -699,6 +1264,88 @@ Result<std::shared_ptr<FileFragment>> ParquetFileFormat::MakeFragment(
       std::move(physical_schema), std::nullopt));
 }
 
+Result<std::shared_ptr<Buffer>> ParquetFileFormat::SerializeFragmentMetadata(
+    const std::shared_ptr<FileFragment>& fragment) const {
+  ARROW_ASSIGN_OR_RAISE(auto parquet_scan_options,
+                        GetFragmentScanOptions<ParquetFragmentScanOptions>(
+                            kParquetTypeName, nullptr, default_fragment_scan_options));
+  if (parquet_scan_options->parquet_decryption_config != nullptr ||
+      parquet_scan_options->reader_properties->file_decryption_properties() != nullptr) {
+    return nullptr;
+  }
+
+  auto parquet_fragment = checked_pointer_cast<ParquetFileFragment>(fragment);
+  RETURN_NOT_OK(parquet_fragment->EnsureCompleteMetadata());
+  auto metadata = parquet_fragment->metadata();
+  if (metadata->is_encryption_algorithm_set()) {
+    return nullptr;
+  }
+
+  // The selected row groups followed by the Thrift-serialized FileMetaData
+  const std::vector<int>& row_groups = parquet_fragment->row_groups();
+  ARROW_ASSIGN_OR_RAISE(auto stream, io::BufferOutputStream::Create());
+  auto write_int32 = [&](int32_t value) {
+    value = bit_util::ToLittleEndian(value);
+    return stream->Write(&value, sizeof(value));
+  };
+  RETURN_NOT_OK(write_int32(static_cast<int32_t>(row_groups.size())));
+  for (int row_group : row_groups) {
+    RETURN_NOT_OK(write_int32(row_group));
+  }
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  RETURN_NOT_OK(stream->Write(metadata->SerializeToString()));
+  END_PARQUET_CATCH_EXCEPTIONS
+  return stream->Finish();
+}
+
+Result<std::shared_ptr<FileFragment>> ParquetFileFormat::MakeFragmentFromManifest(
+    FileSource source, compute::Expression partition_expression,
+    std::shared_ptr<Schema> physical_schema, std::shared_ptr<Buffer> metadata) {
+  if (metadata == nullptr) {
+    return MakeFragment(std::move(source), std::move(partition_expression),
+                        std::move(physical_schema));
+  }
+
+  const uint8_t* data = metadata->data();
+  int64_t remaining = metadata->size();
+  auto read_int32 = [&]() -> Result<int32_t> {
+    if (remaining < static_cast<int64_t>(sizeof(int32_t))) {
+      return Status::Invalid("Truncated Parquet fragment metadata for ",
+                             source.path());
+    }
+    auto value = bit_util::FromLittleEndian(util::SafeLoadAs<int32_t>(data));
+    data += sizeof(int32_t);
+    remaining -= sizeof(int32_t);
+    return value;
+  };
+  ARROW_ASSIGN_OR_RAISE(int32_t num_row_groups, read_int32());
+  if (num_row_groups < 0) {
+    return Status::Invalid("Invalid Parquet fragment metadata for ", source.path());
+  }
+  std::vector<int> row_groups(num_row_groups);
+  for (int& row_group : row_groups) {
+    ARROW_ASSIGN_OR_RAISE(row_group, read_int32());
+  }
+
+  std::shared_ptr<parquet::FileMetaData> file_metadata;
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  auto metadata_len = static_cast<uint32_t>(remaining);
+  file_metadata = parquet::FileMetaData::Make(data, &metadata_len);
+  END_PARQUET_CATCH_EXCEPTIONS
+
+  auto properties = MakeArrowReaderProperties(*this, *file_metadata);
+  ARROW_ASSIGN_OR_RAISE(auto manifest, GetSchemaManifest(*file_metadata, properties));
+  if (physical_schema == nullptr) {
+    ARROW_ASSIGN_OR_RAISE(physical_schema, GetSchema(*file_metadata, properties));
+  }
+
+  ARROW_ASSIGN_OR_RAISE(
+      auto fragment, MakeFragment(std::move(source), std::move(partition_expression),
+                                  std::move(physical_schema), std::move(row_groups)));
+  RETURN_NOT_OK(fragment->SetMetadata(std::move(file_metadata), std::move(manifest)));
+  return fragment;
+}
+
 //
 // ParquetFileWriter, ParquetFileWriteOptions
 //
@@ -869,6 +1516,20 @@ Status ParquetFileFragment::ClearCachedMetadata() {
   return FileFragment::ClearCachedMetadata();
 }
 
+std::optional<int64_t> ParquetFileFragment::EstimateScanBytes() {
+  {
+    auto lock = physical_schema_mutex_.Lock();
+    if (metadata_ != nullptr) {
+      int64_t total_byte_size = 0;
+      for (int row_group : *row_groups_) {
+        total_byte_size += metadata_->RowGroup(row_group)->total_byte_size();
+      }
+      return total_byte_size;
+    }
+  }
+  return FileFragment::EstimateScanBytes();
+}
+
 Result<FragmentVector> ParquetFileFragment::SplitByRowGroup(
     compute::Expression predicate) {
   RETURN_NOT_OK(EnsureCompleteMetadata());
@@ -907,6 +1568,13 @@ Result<std::shared_ptr<Fragment>> ParquetFileFragment::Subset(
   return new_fragment;
 }
 
+Result<std::shared_ptr<Fragment>> ParquetFileFragment::SubsetByBoundingBox(
+    const FieldRef& field_ref, const ParquetBoundingBox& bbox) {
+  RETURN_NOT_OK(EnsureCompleteMetadata());
+  ARROW_ASSIGN_OR_RAISE(auto row_groups, FilterRowGroupsByBoundingBox(field_ref, bbox));
+  return Subset(std::move(row_groups));
+}
+
 inline void FoldingAnd(compute::Expression* l, compute::Expression r) {
   if (*l == compute::literal(true)) {
     *l = std::move(r);
@@ -943,19 +1611,9 @@ Result<std::vector<compute::Expression>> ParquetFileFragment::TestRowGroups(
   }
 
   for (const FieldRef& ref : FieldsInExpression(predicate)) {
-    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*physical_schema_));
-
-    if (match.empty()) continue;
-    const SchemaField* schema_field = &manifest_->schema_fields[match[0]];
-
-    for (size_t i = 1; i < match.indices().size(); ++i) {
-      if (schema_field->field->type()->id() != Type::STRUCT) {
-        return Status::Invalid("nested paths only supported for structs");
-      }
-      schema_field = &schema_field->children[match[i]];
-    }
-
-    if (!schema_field->is_leaf()) continue;
+    ARROW_ASSIGN_OR_RAISE(auto schema_field,
+                          ResolveLeafField(*physical_schema_, *manifest_, ref));
+    if (schema_field == nullptr) continue;
     if (statistics_expressions_complete_[schema_field->column_index]) continue;
     statistics_expressions_complete_[schema_field->column_index] = true;
 
@@ -983,6 +1641,239 @@ Result<std::vector<compute::Expression>> ParquetFileFragment::TestRowGroups(
   return row_groups;
 }
 
+Result<std::vector<parquet::RowRanges>> ParquetFileFragment::FilterPages(
+    parquet::arrow::FileReader* reader, const std::vector<int>& row_groups,
+    compute::Expression predicate) {
+  auto lock = physical_schema_mutex_.Lock();
+
+  const auto& file_metadata = reader->parquet_reader()->metadata();
+  std::vector<parquet::RowRanges> row_ranges;
+  row_ranges.reserve(row_groups.size());
+  for (int row_group : row_groups) {
+    row_ranges.push_back(
+        parquet::RowRanges::All(file_metadata->RowGroup(row_group)->num_rows()));
+  }
+
+  ARROW_ASSIGN_OR_RAISE(
+      predicate, SimplifyWithGuarantee(std::move(predicate), partition_expression_));
+  if (!predicate.IsSatisfiable()) {
+    return std::vector<parquet::RowRanges>(row_groups.size());
+  }
+
+  std::vector<std::pair<FieldRef, const SchemaField*>> leaves;
+  for (const FieldRef& ref : FieldsInExpression(predicate)) {
+    ARROW_ASSIGN_OR_RAISE(auto schema_field,
+                          ResolveLeafField(*physical_schema_, *manifest_, ref));
+    if (schema_field == nullptr) continue;
+    leaves.emplace_back(ref, schema_field);
+  }
+  if (leaves.empty()) {
+    return row_ranges;
+  }
+
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  auto page_index_reader = reader->parquet_reader()->GetPageIndexReader();
+  if (page_index_reader == nullptr) {
+    return row_ranges;
+  }
+  for (size_t i = 0; i < row_groups.size(); ++i) {
+    auto row_group_index_reader = page_index_reader->RowGroup(row_groups[i]);
+    if (row_group_index_reader == nullptr) continue;
+    const int64_t num_rows = file_metadata->RowGroup(row_groups[i])->num_rows();
+
+    for (const auto& [ref, schema_field] : leaves) {
+      const int column = schema_field->column_index;
+      const parquet::ColumnDescriptor* descr = file_metadata->schema()->Column(column);
+      if (descr->max_repetition_level() > 0) continue;
+      auto column_index = row_group_index_reader->GetColumnIndex(column);
+      auto offset_index = row_group_index_reader->GetOffsetIndex(column);
+      if (column_index == nullptr || offset_index == nullptr) continue;
+      const auto& pages = offset_index->page_locations();
+      const auto& null_pages = column_index->null_pages();
+      if (pages.empty() || pages.size() != null_pages.size()) continue;
+
+      // Each page is tested independently against its own statistics; a page is
+      // skipped only when the predicate can't be satisfied by any of its rows.
+      std::vector<parquet::RowRanges::Range> selected;
+      for (size_t page = 0; page < pages.size(); ++page) {
+        const int64_t first_row = pages[page].first_row_index;
+        const int64_t end_row =
+            page + 1 < pages.size() ? pages[page + 1].first_row_index : num_rows;
+
+        std::optional<compute::Expression> guarantee;
+        if (null_pages[page]) {
+          guarantee = is_null(compute::field_ref(ref));
+        } else {
+          const bool has_null_count = column_index->has_null_counts();
+          const int64_t null_count =
+              has_null_count ? column_index->null_counts()[page] : 0;
+          auto statistics = parquet::Statistics::Make(
+              descr, column_index->encoded_min_values()[page],
+              column_index->encoded_max_values()[page],
+              /*num_values=*/std::max<int64_t>(1, end_row - first_row - null_count),
+              null_count, /*distinct_count=*/0, /*has_min_max=*/true, has_null_count,
+              /*has_distinct_count=*/false);
+          guarantee = EvaluateStatisticsAsExpression(*schema_field->field, ref,
+                                                     *statistics);
+        }
+
+        bool may_match = true;
+        if (guarantee) {
+          ARROW_ASSIGN_OR_RAISE(auto bound, guarantee->Bind(*physical_schema_));
+          ARROW_ASSIGN_OR_RAISE(auto page_predicate,
+                                SimplifyWithGuarantee(predicate, bound));
+          may_match = page_predicate.IsSatisfiable();
+        }
+        if (may_match) {
+          selected.push_back({first_row, end_row});
+        }
+      }
+      row_ranges[i] = row_ranges[i].Intersect(parquet::RowRanges(std::move(selected)));
+    }
+  }
+  END_PARQUET_CATCH_EXCEPTIONS
+  return row_ranges;
+}
+
+Result<std::vector<int>> ParquetFileFragment::FilterRowGroupsByBloomFilter(
+    parquet::arrow::FileReader* reader, std::vector<int> row_groups,
+    compute::Expression predicate) {
+  auto lock = physical_schema_mutex_.Lock();
+
+  ARROW_ASSIGN_OR_RAISE(
+      predicate, SimplifyWithGuarantee(std::move(predicate), partition_expression_));
+
+  // The equality terms of the predicate, in visiting order, with the leaf column
+  // they test. Other terms are std::nullopt.
+  std::vector<std::optional<std::pair<EqualityTerm, const SchemaField*>>> terms;
+  std::vector<int> columns;
+  auto collect_term = [&](compute::Expression term) -> Result<compute::Expression> {
+    terms.emplace_back();
+    auto equality_term = GetEqualityTerm(term);
+    if (!equality_term) return term;
+    ARROW_ASSIGN_OR_RAISE(
+        auto schema_field,
+        ResolveLeafField(*physical_schema_, *manifest_, equality_term->field_ref));
+    if (schema_field == nullptr) return term;
+    // Values must be hashed as the type of the column
+    const auto& type = schema_field->field->type();
+    for (auto& value : equality_term->values) {
+      if (value->type->Equals(*type)) continue;
+      auto maybe_value = Cast(value, type);
+      if (!maybe_value.ok()) return term;
+      value = maybe_value.MoveValueUnsafe().scalar();
+    }
+    terms.back().emplace(std::move(*equality_term), schema_field);
+    columns.push_back(schema_field->column_index);
+    return term;
+  };
+  RETURN_NOT_OK(ModifyBooleanTerms(predicate, collect_term).status());
+  if (columns.empty()) {
+    return row_groups;
+  }
+  std::sort(columns.begin(), columns.end());
+  columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+
+  const auto& file_metadata = reader->parquet_reader()->metadata();
+  std::vector<int> selected_row_groups;
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  parquet::BloomFilterReader* bloom_filter_reader;
+  try {
+    bloom_filter_reader = &reader->parquet_reader()->GetBloomFilterReader();
+  } catch (const ::parquet::ParquetException& e) {
+    // e.g. bloom filters of encrypted files can't be read yet
+    ARROW_UNUSED(e);
+    return row_groups;
+  }
+  // Coalesce the reads of all the bloom filters that may be needed, but only fetch
+  // them once one is accessed
+  auto cache_options = reader->properties().cache_options();
+  cache_options.lazy = true;
+  bloom_filter_reader->WillNeed(row_groups, columns, reader->properties().io_context(),
+                                cache_options);
+
+  for (int row_group : row_groups) {
+    auto row_group_metadata = file_metadata->RowGroup(row_group);
+    auto row_group_reader = bloom_filter_reader->RowGroup(row_group);
+    std::unordered_map<int, std::unique_ptr<parquet::BloomFilter>> bloom_filters;
+    auto get_bloom_filter = [&](int column) -> const parquet::BloomFilter* {
+      auto it = bloom_filters.find(column);
+      if (it == bloom_filters.end()) {
+        std::unique_ptr<parquet::BloomFilter> bloom_filter;
+        if (row_group_reader != nullptr &&
+            row_group_metadata->ColumnChunk(column)->crypto_metadata() == nullptr) {
+          bloom_filter = row_group_reader->GetColumnBloomFilter(column);
+        }
+        it = bloom_filters.emplace(column, std::move(bloom_filter)).first;
+      }
+      return it->second.get();
+    };
+
+    size_t term_index = 0;
+    auto test_term = [&](compute::Expression term) -> Result<compute::Expression> {
+      const auto& equality_term = terms[term_index++];
+      if (!equality_term) return term;
+      const int column = equality_term->second->column_index;
+      const parquet::BloomFilter* bloom_filter = get_bloom_filter(column);
+      if (bloom_filter == nullptr) return term;
+      const auto* descr = file_metadata->schema()->Column(column);
+      for (const auto& value : equality_term->first.values) {
+        auto hash = BloomFilterHash(*bloom_filter, *descr, *value);
+        if (!hash || bloom_filter->FindHash(*hash)) return term;
+      }
+      // None of the values is in the row group
+      return compute::literal(false);
+    };
+    ARROW_ASSIGN_OR_RAISE(auto row_group_predicate,
+                          ModifyBooleanTerms(predicate, test_term));
+    ARROW_ASSIGN_OR_RAISE(row_group_predicate,
+                          SimplifyWithGuarantee(std::move(row_group_predicate),
+                                                compute::literal(true)));
+    if (row_group_predicate.IsSatisfiable()) {
+      selected_row_groups.push_back(row_group);
+    }
+  }
+  END_PARQUET_CATCH_EXCEPTIONS
+  return selected_row_groups;
+}
+
+Result<std::vector<int>> ParquetFileFragment::FilterRowGroupsByBoundingBox(
+    const FieldRef& field_ref, const ParquetBoundingBox& bbox) {
+  if (std::isnan(bbox.xmin) || std::isnan(bbox.ymin) || std::isnan(bbox.xmax) ||
+      std::isnan(bbox.ymax) || bbox.ymin > bbox.ymax) {
+    return Status::Invalid("Invalid bounding box: x in [", bbox.xmin, ", ", bbox.xmax,
+                           "], y in [", bbox.ymin, ", ", bbox.ymax, "]");
+  }
+  auto lock = physical_schema_mutex_.Lock();
+  DCHECK_NE(metadata_, nullptr);
+
+  ARROW_ASSIGN_OR_RAISE(auto schema_field,
+                        ResolveLeafField(*physical_schema_, *manifest_, field_ref));
+  if (schema_field == nullptr) {
+    return Status::Invalid("No leaf column matching ", field_ref.ToString());
+  }
+  const int column = schema_field->column_index;
+  const auto& logical_type = metadata_->schema()->Column(column)->logical_type();
+  if (logical_type == nullptr ||
+      !(logical_type->is_geometry() || logical_type->is_geography())) {
+    return Status::TypeError("Column ", field_ref.ToString(),
+                             " is not a GEOMETRY or GEOGRAPHY column");
+  }
+
+  std::vector<int> row_groups;
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  for (int row_group : *row_groups_) {
+    auto column_metadata = metadata_->RowGroup(row_group)->ColumnChunk(column);
+    if (column_metadata->is_geo_stats_set()) {
+      auto statistics = column_metadata->geo_statistics();
+      if (statistics != nullptr && !MayIntersect(*statistics, bbox)) continue;
+    }
+    row_groups.push_back(row_group);
+  }
+  END_PARQUET_CATCH_EXCEPTIONS
+  return row_groups;
+}
+
 Result<std::optional<int64_t>> ParquetFileFragment::TryCountRows(
     compute::Expression predicate) {
   DCHECK_NE(metadata_, nullptr);
@@ -1003,6 +1894,75 @@ Result<std::optional<int64_t>> ParquetFileFragment::TryCountRows(
   return metadata()->num_rows();
 }
 
+Future<FragmentMetadataAggregates> ParquetFileFragment::AggregateFromMetadata(
+    compute::Expression predicate, std::optional<FieldRef> min_max_target,
+    const std::shared_ptr<ScanOptions>& options) {
+  if (metadata()) {
+    return Future<FragmentMetadataAggregates>::MakeFinished(
+        TryAggregate(std::move(predicate), min_max_target));
+  }
+  auto self = checked_pointer_cast<ParquetFileFragment>(shared_from_this());
+  return DeferNotOk(options->io_context.executor()->Submit(
+      [self, predicate = std::move(predicate), min_max_target = std::move(
+                                                   min_max_target)]()
+          -> Result<FragmentMetadataAggregates> {
+        RETURN_NOT_OK(self->EnsureCompleteMetadata());
+        return self->TryAggregate(predicate, min_max_target);
+      }));
+}
+
+Result<FragmentMetadataAggregates> ParquetFileFragment::TryAggregate(
+    compute::Expression predicate, const std::optional<FieldRef>& min_max_target) {
+  DCHECK_NE(metadata_, nullptr);
+  // One simplified predicate per row group; empty if no row group can match
+  std::vector<compute::Expression> expressions;
+  if (ExpressionHasFieldRefs(predicate)) {
+    ARROW_ASSIGN_OR_RAISE(expressions, TestRowGroups(std::move(predicate)));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(predicate, SimplifyWithGuarantee(std::move(predicate),
+                                                           partition_expression_));
+    if (predicate.IsSatisfiable()) {
+      expressions.assign(row_groups_->size(), compute::literal(true));
+    }
+  }
+
+  const SchemaField* target = nullptr;
+  if (min_max_target.has_value()) {
+    auto lock = physical_schema_mutex_.Lock();
+    ARROW_ASSIGN_OR_RAISE(
+        target, ResolveLeafField(*physical_schema_, *manifest_, *min_max_target));
+  }
+
+  FragmentMetadataAggregates aggregates;
+  std::vector<int> remainder;
+  ScalarVector mins, maxes;
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  for (size_t i = 0; i < expressions.size(); ++i) {
+    if (!expressions[i].IsSatisfiable()) continue;
+    const int row_group = (*row_groups_)[i];
+    auto row_group_metadata = metadata_->RowGroup(row_group);
+    // Only row groups which match entirely can be answered for from metadata
+    if (expressions[i] != compute::literal(true) ||
+        (min_max_target.has_value() &&
+         (target == nullptr ||
+          !ColumnChunkMinMax(*target, *row_group_metadata, &mins, &maxes)))) {
+      remainder.push_back(row_group);
+      continue;
+    }
+    aggregates.count += row_group_metadata->num_rows();
+  }
+  END_PARQUET_CATCH_EXCEPTIONS
+
+  if (target != nullptr) {
+    ARROW_ASSIGN_OR_RAISE(std::tie(aggregates.min, aggregates.max),
+                          ReduceMinMax(target->field->type(), mins, maxes));
+  }
+  if (!remainder.empty()) {
+    ARROW_ASSIGN_OR_RAISE(aggregates.remainder, Subset(std::move(remainder)));
+  }
+  return aggregates;
+}
+
 //
 // ParquetFragmentScanOptions
 //
@@ -1051,19 +2011,6 @@ static inline Result<std::string> FileFromRowGroup(
   return filesystem->NormalizePath(std::move(path));
 }
 
-namespace {
-
-Result<std::shared_ptr<Schema>> GetSchema(
-    const parquet::FileMetaData& metadata,
-    const parquet::ArrowReaderProperties& properties) {
-  std::shared_ptr<Schema> schema;
-  RETURN_NOT_OK(parquet::arrow::FromParquetSchema(
-      metadata.schema(), properties, metadata.key_value_metadata(), &schema));
-  return schema;
-}
-
-}  // namespace
-
 Result<std::shared_ptr<DatasetFactory>> ParquetDatasetFactory::Make(
     const std::string& metadata_path, std::shared_ptr<fs::FileSystem> filesystem,
     std::shared_ptr<ParquetFileFormat> format, ParquetFactoryOptions options) {
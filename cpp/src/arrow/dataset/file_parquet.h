@@ -38,6 +38,7 @@ class Statistics;
 class ColumnChunkMetaData;
 class RowGroupMetaData;
 class FileMetaData;
+class RowRanges;
 class FileDecryptionProperties;
 class FileEncryptionProperties;
 
@@ -120,6 +121,19 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
       FileSource source, compute::Expression partition_expression,
       std::shared_ptr<Schema> physical_schema, std::vector<int> row_groups);
 
+  /// \brief Serialize the selected row groups and the FileMetaData of a fragment.
+  ///
+  /// The FileMetaData is read if not cached yet. Returns nullptr for files with
+  /// encrypted footers, whose metadata must not be stored in plaintext.
+  Result<std::shared_ptr<Buffer>> SerializeFragmentMetadata(
+      const std::shared_ptr<FileFragment>& fragment) const override;
+
+  /// \brief Create a fragment with the row groups and FileMetaData deserialized from
+  /// `metadata`, so that no IO is necessary to filter its row groups.
+  Result<std::shared_ptr<FileFragment>> MakeFragmentFromManifest(
+      FileSource source, compute::Expression partition_expression,
+      std::shared_ptr<Schema> physical_schema, std::shared_ptr<Buffer> metadata) override;
+
   /// \brief Return a FileReader on the given source.
   Result<std::shared_ptr<parquet::arrow::FileReader>> GetReader(
       const FileSource& source, const std::shared_ptr<ScanOptions>& options) const;
@@ -143,6 +157,17 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
   std::shared_ptr<FileWriteOptions> DefaultWriteOptions() override;
 };
 
+/// \brief A rectangle in the X/Y coordinates of a GEOMETRY or GEOGRAPHY column
+///
+/// As for the bounding boxes of Parquet geospatial statistics, a box where
+/// xmin > xmax wraps around the antimeridian and covers both x >= xmin and x <= xmax.
+struct ARROW_DS_EXPORT ParquetBoundingBox {
+  double xmin;
+  double ymin;
+  double xmax;
+  double ymax;
+};
+
 /// \brief A FileFragment with parquet logic.
 ///
 /// ParquetFileFragment provides a lazy (with respect to IO) interface to
@@ -177,10 +202,30 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
 
   Status ClearCachedMetadata() override;
 
+  /// \brief The uncompressed size of the selected RowGroups if the metadata is
+  /// cached, else the size of the file
+  std::optional<int64_t> EstimateScanBytes() override;
+
+  /// Row groups known from their statistics to match the predicate entirely are
+  /// answered for from metadata, the others are left to the remainder.  A minimum and
+  /// maximum are only answered for integer, date and timestamp columns, whose
+  /// statistics are exact.
+  Future<FragmentMetadataAggregates> AggregateFromMetadata(
+      compute::Expression predicate, std::optional<FieldRef> min_max_target,
+      const std::shared_ptr<ScanOptions>& options) override;
+
   /// \brief Return fragment which selects a filtered subset of this fragment's RowGroups.
   Result<std::shared_ptr<Fragment>> Subset(compute::Expression predicate);
   Result<std::shared_ptr<Fragment>> Subset(std::vector<int> row_group_ids);
 
+  /// \brief Return fragment which selects the RowGroups of this fragment whose
+  /// geometries in the GEOMETRY or GEOGRAPHY column `field_ref` may intersect `bbox`.
+  ///
+  /// RowGroups are pruned using the geospatial statistics of the column; RowGroups
+  /// without X/Y bounds are kept. The rows of the selected RowGroups are not filtered.
+  Result<std::shared_ptr<Fragment>> SubsetByBoundingBox(const FieldRef& field_ref,
+                                                        const ParquetBoundingBox& bbox);
+
   static std::optional<compute::Expression> EvaluateStatisticsAsExpression(
       const Field& field, const parquet::Statistics& statistics);
 
@@ -208,10 +253,30 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
   Result<std::vector<int>> FilterRowGroups(compute::Expression predicate);
   /// Simplify the predicate against the statistics of each row group.
   Result<std::vector<compute::Expression>> TestRowGroups(compute::Expression predicate);
+  /// Return the subset of the given row groups which may match the predicate
+  /// according to the bloom filters of `reader`, for the `equal` and `is_in` terms
+  /// of the predicate.
+  Result<std::vector<int>> FilterRowGroupsByBloomFilter(
+      parquet::arrow::FileReader* reader, std::vector<int> row_groups,
+      compute::Expression predicate);
+  /// Return the selected row groups whose geospatial statistics for `field_ref` may
+  /// intersect `bbox`.
+  Result<std::vector<int>> FilterRowGroupsByBoundingBox(const FieldRef& field_ref,
+                                                        const ParquetBoundingBox& bbox);
+  /// Return the rows of each of the given row groups which may match the predicate
+  /// according to the page index of `reader`. All rows are returned for columns
+  /// without a page index.
+  Result<std::vector<parquet::RowRanges>> FilterPages(
+      parquet::arrow::FileReader* reader, const std::vector<int>& row_groups,
+      compute::Expression predicate);
   /// Try to count rows matching the predicate using metadata. Expects
   /// metadata to be present, and expects the predicate to have been
   /// simplified against the partition expression already.
   Result<std::optional<int64_t>> TryCountRows(compute::Expression predicate);
+  /// Answer what metadata can for AggregateFromMetadata. Expects metadata to be
+  /// present.
+  Result<FragmentMetadataAggregates> TryAggregate(
+      compute::Expression predicate, const std::optional<FieldRef>& min_max_target);
 
   ParquetFileFormat& parquet_format_;
 
@@ -241,13 +306,29 @@ class ARROW_DS_EXPORT ParquetFragmentScanOptions : public FragmentScanOptions {
   std::string type_name() const override { return kParquetTypeName; }
 
   /// Reader properties. Not all properties are respected: memory_pool comes from
-  /// ScanOptions.
+  /// ScanOptions. If a metadata_cache is set, the footers of files on a filesystem
+  /// with a known size and modification time are cached across fragments and scans.
   std::shared_ptr<parquet::ReaderProperties> reader_properties;
   /// Arrow reader properties. Not all properties are respected: batch_size comes from
   /// ScanOptions. Additionally, other options come from ParquetFileFormat::ReaderOptions.
   std::shared_ptr<parquet::ArrowReaderProperties> arrow_reader_properties;
   /// A configuration structure that provides decryption properties for a dataset
   std::shared_ptr<ParquetDecryptionConfig> parquet_decryption_config = NULLPTR;
+  /// If true, the scan filter is also evaluated against the page index (the per-page
+  /// min/max statistics) of the row groups surviving row group filtering, and pages
+  /// which cannot match it are not read. Files without a page index are read as usual.
+  bool use_page_index = false;
+  /// If true, the row groups surviving row group filtering are also tested against
+  /// the bloom filters of the columns the scan filter compares for equality (through
+  /// `equal` or `is_in`), and row groups which cannot contain any of the values are
+  /// not read. The bloom filters are fetched lazily, with coalesced reads.
+  bool use_bloom_filter = true;
+  /// If true, scans with a filter first read only the columns the filter references
+  /// and evaluate the filter on them, then read the other projected columns only for
+  /// the rows which passed the filter, skipping the pages and values of the other
+  /// rows without decoding them into Arrow arrays. This pays off for selective
+  /// filters on wide tables. Filters on nested fields are read as usual.
+  bool late_materialization = false;
 };
 
 class ARROW_DS_EXPORT ParquetFileWriteOptions : public FileWriteOptions {
@@ -17,14 +17,17 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <cstring>
 #include <functional>
 #include <memory>
+#include <string>
 #include <thread>
 #include <utility>
 #include <vector>
 
 #include "arrow/compute/api_scalar.h"
 #include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/manifest.h"
 #include "arrow/dataset/parquet_encryption_config.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/dataset/test_util_internal.h"
@@ -34,6 +37,7 @@
 #include "arrow/io/util_internal.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
+#include "arrow/testing/builder.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
@@ -43,8 +47,12 @@
 #include "arrow/util/range.h"
 
 #include "parquet/arrow/writer.h"
+#include "parquet/column_writer.h"
 #include "parquet/file_reader.h"
+#include "parquet/file_writer.h"
 #include "parquet/metadata.h"
+#include "parquet/metadata_cache.h"
+#include "parquet/schema.h"
 #include "parquet/statistics.h"
 #include "parquet/types.h"
 
@@ -375,6 +383,46 @@ TEST_F(TestParquetFileFormat, CountRowsPredicatePushdown) {
   }
 }
 
+TEST_F(TestParquetFileFormat, AggregateFromMetadata) {
+  constexpr int64_t kNumRowGroups = 16;
+
+  // See PredicatePushdown test below for a description of the generated data
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups);
+  auto source = GetFileSource(reader.get());
+  auto options = std::make_shared<ScanOptions>();
+
+  auto fragment = MakeFragment(*source);
+
+  for (int i = 1; i <= kNumRowGroups; i++) {
+    SCOPED_TRACE(i);
+    // Row groups 1 to i match entirely and the others not at all
+    ASSERT_OK_AND_ASSIGN(
+        auto predicate,
+        less_equal(field_ref("i64"), literal(i)).Bind(*reader->schema()));
+    ASSERT_FINISHES_OK_AND_ASSIGN(
+        auto aggregates,
+        fragment->AggregateFromMetadata(predicate, FieldRef("i64"), options));
+    ASSERT_EQ(i * (i + 1) / 2, aggregates.count);
+    AssertScalarsEqual(Int64Scalar(1), *aggregates.min, /*verbose=*/true);
+    AssertScalarsEqual(Int64Scalar(i), *aggregates.max, /*verbose=*/true);
+    ASSERT_EQ(nullptr, aggregates.remainder);
+  }
+
+  // Statistics cannot decide this predicate, so every row group is left to be scanned
+  ASSERT_OK_AND_ASSIGN(
+      auto predicate,
+      equal(call("add", {field_ref("i64"), literal(int64_t{1})}), literal(int64_t{2}))
+          .Bind(*reader->schema()));
+  ASSERT_FINISHES_OK_AND_ASSIGN(
+      auto aggregates, fragment->AggregateFromMetadata(predicate, std::nullopt, options));
+  ASSERT_EQ(0, aggregates.count);
+  ASSERT_NE(nullptr, aggregates.remainder);
+  ASSERT_EQ(kNumRowGroups,
+            checked_pointer_cast<ParquetFileFragment>(aggregates.remainder)
+                ->row_groups()
+                .size());
+}
+
 TEST_F(TestParquetFileFormat, CachedMetadata) {
   // Create a test file
   auto mock_fs = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
@@ -433,6 +481,157 @@ TEST_F(TestParquetFileFormat, CachedMetadata) {
   ASSERT_NE(nullptr, pq_fragment->metadata());
 }
 
+TEST_F(TestParquetFileFormat, SharedMetadataCache) {
+  auto mock_fs = std::make_shared<fs::internal::MockFileSystem>(
+      fs::TimePoint(fs::TimePoint::duration(42)));
+  std::shared_ptr<Schema> test_schema = schema({field("x", int32())});
+  std::shared_ptr<RecordBatch> batch = RecordBatchFromJSON(test_schema, "[[0]]");
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<io::OutputStream> out_stream,
+                       mock_fs->OpenOutputStream("/foo.parquet"));
+  ASSERT_OK_AND_ASSIGN(
+      std::shared_ptr<FileWriter> writer,
+      format_->MakeWriter(out_stream, test_schema, format_->DefaultWriteOptions(),
+                          {mock_fs, "/foo.parquet"}));
+  ASSERT_OK(writer->Write(batch));
+  ASSERT_FINISHES_OK(writer->Finish());
+
+  auto cache = std::make_shared<parquet::FileMetaDataCache>();
+  auto parquet_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  parquet_scan_options->reader_properties->set_metadata_cache(cache);
+  format_->default_fragment_scan_options = parquet_scan_options;
+
+  ASSERT_OK_AND_ASSIGN(auto info, mock_fs->GetFileInfo("/foo.parquet"));
+  FileSource source(info, mock_fs);
+  ASSERT_OK_AND_ASSIGN(auto first_schema, format_->Inspect(source));
+  ASSERT_EQ(1, cache->misses());
+  ASSERT_EQ(0, cache->hits());
+  ASSERT_OK_AND_ASSIGN(auto second_schema, format_->Inspect(source));
+  ASSERT_EQ(1, cache->misses());
+  ASSERT_EQ(1, cache->hits());
+  AssertSchemaEqual(first_schema, second_schema);
+
+  // Sources without a known size or modification time bypass the cache
+  FileSource path_source("/foo.parquet", mock_fs);
+  ASSERT_OK(format_->Inspect(path_source));
+  ASSERT_EQ(1, cache->misses());
+  ASSERT_EQ(1, cache->hits());
+}
+
+TEST_F(TestParquetFileFormat, DatasetManifest) {
+  constexpr int64_t kNumRowGroups = 4;
+  auto mock_fs = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups);
+  auto dataset_schema = reader->schema();
+  ASSERT_OK_AND_ASSIGN(auto buffer, ParquetFormatHelper::Write(reader.get()));
+  ASSERT_OK_AND_ASSIGN(auto out_stream, mock_fs->OpenOutputStream("/foo.parquet"));
+  ASSERT_OK(out_stream->Write(buffer));
+  ASSERT_OK(out_stream->Close());
+
+  // Record a fragment of a subset of the row groups
+  ASSERT_OK_AND_ASSIGN(auto info, mock_fs->GetFileInfo("/foo.parquet"));
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment({info, mock_fs}));
+  ASSERT_OK_AND_ASSIGN(auto subset,
+                       checked_pointer_cast<ParquetFileFragment>(fragment)->Subset(
+                           std::vector<int>{1, 2, 3}));
+  ASSERT_OK_AND_ASSIGN(
+      auto dataset,
+      FileSystemDataset::Make(dataset_schema, literal(true), format_, mock_fs,
+                              {checked_pointer_cast<FileFragment>(subset)}));
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK(WriteDatasetManifest(dataset, sink));
+  ASSERT_OK_AND_ASSIGN(auto manifest, sink->Finish());
+  auto manifest_file = std::make_shared<io::BufferReader>(manifest);
+
+  // The row groups can be filtered without accessing the file
+  auto empty_fs = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+  ASSERT_OK_AND_ASSIGN(dataset, ReadDatasetManifest(manifest_file, format_, empty_fs));
+  ASSERT_OK_AND_ASSIGN(auto fragments, dataset->GetFragments());
+  ASSERT_OK_AND_ASSIGN(auto fragment_vector, fragments.ToVector());
+  ASSERT_EQ(fragment_vector.size(), 1);
+  auto parquet_fragment = checked_pointer_cast<ParquetFileFragment>(fragment_vector[0]);
+  ASSERT_NE(parquet_fragment->metadata(), nullptr);
+  ASSERT_EQ(parquet_fragment->row_groups(), std::vector<int>({1, 2, 3}));
+  ASSERT_EQ(parquet_fragment->source().file_info().size(), buffer->size());
+  ASSERT_OK_AND_ASSIGN(auto physical_schema, parquet_fragment->ReadPhysicalSchema());
+  AssertSchemaEqual(*dataset_schema, *physical_schema, /*check_metadata=*/false);
+
+  // Row group i holds the value i + 1 in all its rows
+  auto filter = greater_equal(field_ref("i64"), literal<int64_t>(3));
+  ASSERT_OK_AND_ASSIGN(filter, filter.Bind(*dataset_schema));
+  ASSERT_OK_AND_ASSIGN(auto row_group_fragments,
+                       parquet_fragment->SplitByRowGroup(filter));
+  ASSERT_EQ(row_group_fragments.size(), 2);
+
+  // Scans read the selected row groups from the given filesystem
+  ASSERT_OK_AND_ASSIGN(dataset, ReadDatasetManifest(manifest_file, format_, mock_fs));
+  ASSERT_OK_AND_ASSIGN(auto builder, dataset->NewScan());
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder->Finish());
+  ASSERT_OK_AND_ASSIGN(auto table, scanner->ToTable());
+  ASSERT_EQ(table->num_rows(), 2 + 3 + 4);
+}
+
+// WKB of a 2D point, in the byte order of the host
+std::string MakeWkbPoint(double x, double y) {
+  std::string wkb(21, '\0');
+  wkb[0] = ARROW_LITTLE_ENDIAN ? 0x01 : 0x00;
+  const uint32_t geometry_type = 1;
+  std::memcpy(&wkb[1], &geometry_type, sizeof(geometry_type));
+  std::memcpy(&wkb[5], &x, sizeof(x));
+  std::memcpy(&wkb[13], &y, sizeof(y));
+  return wkb;
+}
+
+TEST_F(TestParquetFileFormat, SubsetByBoundingBox) {
+  // 4 row groups of points, where row group `i` covers x in [10 * i, 10 * i + 4] and
+  // y in [0, 4]
+  constexpr int kNumRowGroups = 4;
+  constexpr int kRowGroupSize = 5;
+  auto geom = parquet::schema::PrimitiveNode::Make(
+      "geom", parquet::Repetition::OPTIONAL, parquet::LogicalType::Geometry(),
+      parquet::Type::BYTE_ARRAY);
+  auto parquet_schema = std::static_pointer_cast<parquet::schema::GroupNode>(
+      parquet::schema::GroupNode::Make("schema", parquet::Repetition::REQUIRED, {geom}));
+  auto sink = CreateOutputStream();
+  auto file_writer = parquet::ParquetFileWriter::Open(sink, parquet_schema);
+  for (int i = 0; i < kNumRowGroups; ++i) {
+    auto row_group_writer = file_writer->AppendRowGroup();
+    auto column_writer =
+        static_cast<parquet::ByteArrayWriter*>(row_group_writer->NextColumn());
+    std::vector<std::string> wkbs;
+    std::vector<parquet::ByteArray> values;
+    for (int j = 0; j < kRowGroupSize; ++j) {
+      wkbs.push_back(MakeWkbPoint(10 * i + j, j));
+    }
+    for (const auto& wkb : wkbs) values.emplace_back(wkb);
+    std::vector<int16_t> def_levels(kRowGroupSize, 1);
+    column_writer->WriteBatch(kRowGroupSize, def_levels.data(), nullptr, values.data());
+  }
+  file_writer->Close();
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(buffer)));
+  auto parquet_fragment = checked_pointer_cast<ParquetFileFragment>(fragment);
+  auto selected_row_groups = [&](const ParquetBoundingBox& bbox) {
+    EXPECT_OK_AND_ASSIGN(auto subset,
+                         parquet_fragment->SubsetByBoundingBox(FieldRef("geom"), bbox));
+    return checked_pointer_cast<ParquetFileFragment>(subset)->row_groups();
+  };
+
+  ASSERT_EQ(selected_row_groups({0, 0, 100, 100}), std::vector<int>({0, 1, 2, 3}));
+  ASSERT_EQ(selected_row_groups({12, 1, 13, 2}), std::vector<int>({1}));
+  ASSERT_EQ(selected_row_groups({4, 4, 10, 10}), std::vector<int>({0, 1}));
+  // Between the row groups
+  ASSERT_EQ(selected_row_groups({5, 0, 9, 10}), std::vector<int>());
+  ASSERT_EQ(selected_row_groups({0, 5, 100, 10}), std::vector<int>());
+  // Wraps around: x >= 25 or x <= 3
+  ASSERT_EQ(selected_row_groups({25, 0, 3, 10}), std::vector<int>({0, 3}));
+
+  ASSERT_RAISES(Invalid, parquet_fragment->SubsetByBoundingBox(FieldRef("geom"),
+                                                               {0, 10, 100, 0}));
+  ASSERT_RAISES(Invalid, parquet_fragment->SubsetByBoundingBox(FieldRef("missing"),
+                                                               {0, 0, 100, 100}));
+}
+
 TEST_F(TestParquetFileFormat, MultithreadedScan) {
   constexpr int64_t kNumRowGroups = 16;
 
@@ -872,6 +1071,193 @@ TEST_P(TestParquetFileFormatScan,
   }
 }
 
+TEST_P(TestParquetFileFormatScan, PredicatePushdownPages) {
+  // A single row group of 1000 rows split into pages of 100 rows
+  std::shared_ptr<Array> values;
+  ArrayFromVector<Int64Type>(::arrow::internal::Iota<int64_t>(1000), &values);
+  auto table = Table::Make(schema({field("i64", int64())}), {values});
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, /*chunk_size=*/1000,
+                       WriterProperties::Builder()
+                           .enable_write_page_index()
+                           ->disable_dictionary()
+                           ->write_batch_size(100)
+                           ->data_pagesize(1)
+                           ->build()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  FileSource source(buffer);
+
+  SetSchema(table->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source));
+
+  auto count_rows = [&](compute::Expression filter) {
+    SetFilter(std::move(filter));
+    int64_t row_count = 0;
+    for (auto maybe_batch : PhysicalBatches(fragment)) {
+      EXPECT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      row_count += batch->num_rows();
+    }
+    return row_count;
+  };
+
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  opts_->fragment_scan_options = fragment_scan_options;
+  auto filter = greater_equal(field_ref("i64"), literal(int64_t{950}));
+  // Disabled by default
+  ASSERT_EQ(1000, count_rows(filter));
+
+  fragment_scan_options->use_page_index = true;
+  for (bool pre_buffer : {false, true}) {
+    ARROW_SCOPED_TRACE("pre_buffer=", pre_buffer);
+    fragment_scan_options->arrow_reader_properties->set_pre_buffer(pre_buffer);
+    ASSERT_EQ(100, count_rows(filter));
+    ASSERT_EQ(200, count_rows(or_(equal(field_ref("i64"), literal(int64_t{150})),
+                                  equal(field_ref("i64"), literal(int64_t{720})))));
+    ASSERT_EQ(300, count_rows(and_(greater_equal(field_ref("i64"), literal(int64_t{250})),
+                                   less(field_ref("i64"), literal(int64_t{510})))));
+    ASSERT_EQ(0, count_rows(less(field_ref("i64"), literal(int64_t{0}))));
+    ASSERT_EQ(1000, count_rows(literal(true)));
+  }
+}
+
+TEST_P(TestParquetFileFormatScan, PredicatePushdownBloomFilter) {
+  // 4 row groups of 100 rows, where row group `i` holds the values `i + 4 * j`, so
+  // that min/max statistics can't tell row groups apart.
+  constexpr int kNumRowGroups = 4;
+  constexpr int kRowGroupSize = 100;
+  std::vector<int64_t> i64_values;
+  std::vector<std::string> id_values;
+  for (int i = 0; i < kNumRowGroups; ++i) {
+    for (int j = 0; j < kRowGroupSize; ++j) {
+      i64_values.push_back(i + kNumRowGroups * j);
+      id_values.push_back("id_" + std::to_string(i64_values.back()));
+    }
+  }
+  std::shared_ptr<Array> i64, id;
+  ArrayFromVector<Int64Type>(i64_values, &i64);
+  ArrayFromVector<StringType, std::string>(id_values, &id);
+  auto table =
+      Table::Make(schema({field("i64", int64()), field("id", utf8())}), {i64, id});
+
+  parquet::BloomFilterOptions bloom_filter_options;
+  bloom_filter_options.ndv = kRowGroupSize;
+  bloom_filter_options.fpp = 1e-6;
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, kRowGroupSize,
+                       WriterProperties::Builder()
+                           .enable_bloom_filter("i64", bloom_filter_options)
+                           ->enable_bloom_filter("id", bloom_filter_options)
+                           ->build()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  FileSource source(buffer);
+
+  SetSchema(table->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source));
+
+  auto count_rows = [&](compute::Expression filter) {
+    SetFilter(std::move(filter));
+    int64_t row_count = 0;
+    for (auto maybe_batch : PhysicalBatches(fragment)) {
+      EXPECT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      row_count += batch->num_rows();
+    }
+    return row_count;
+  };
+
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  opts_->fragment_scan_options = fragment_scan_options;
+  ASSERT_EQ(100, count_rows(equal(field_ref("id"), literal("id_5"))));
+  ASSERT_EQ(0, count_rows(equal(field_ref("id"), literal("id_1000"))));
+  ASSERT_EQ(200, count_rows(call("is_in", {field_ref("i64")},
+                                 compute::SetLookupOptions{
+                                     ArrayFromJSON(int64(), "[5, 10, 13]")})));
+  ASSERT_EQ(200, count_rows(or_(equal(field_ref("id"), literal("id_5")),
+                                equal(field_ref("i64"), literal(int64_t{8})))));
+  ASSERT_EQ(0, count_rows(and_(equal(field_ref("id"), literal("id_5")),
+                               equal(field_ref("i64"), literal(int64_t{8})))));
+  // Terms which are not direct equality comparisons are kept as is
+  ASSERT_EQ(400, count_rows(is_null(equal(field_ref("id"), literal("id_1000")))));
+  ASSERT_EQ(400, count_rows(not_(equal(field_ref("id"), literal("id_5")))));
+  ASSERT_EQ(400, count_rows(literal(true)));
+
+  fragment_scan_options->use_bloom_filter = false;
+  ASSERT_EQ(400, count_rows(equal(field_ref("id"), literal("id_5"))));
+}
+
+TEST_P(TestParquetFileFormatScan, LateMaterialization) {
+  // 3 row groups of 400, 400 and 200 rows, split into pages of 50 rows
+  constexpr int kNumRows = 1000;
+  std::vector<int64_t> i64_values;
+  std::vector<std::string> s_values;
+  for (int i = 0; i < kNumRows; ++i) {
+    i64_values.push_back(i);
+    s_values.push_back("v" + std::to_string(i));
+  }
+  std::shared_ptr<Array> i64, s;
+  ArrayFromVector<Int64Type>(i64_values, &i64);
+  ArrayFromVector<StringType, std::string>(s_values, &s);
+  auto table =
+      Table::Make(schema({field("s", utf8()), field("i64", int64())}), {s, i64});
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, /*chunk_size=*/400,
+                       WriterProperties::Builder()
+                           .enable_write_page_index()
+                           ->write_batch_size(50)
+                           ->data_pagesize(1)
+                           ->build()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  FileSource source(buffer);
+
+  SetSchema(table->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source));
+
+  // Count the rows read, checking that the columns read in each phase line up
+  auto count_rows = [&](compute::Expression filter) {
+    SetFilter(std::move(filter));
+    int64_t row_count = 0;
+    for (auto maybe_batch : PhysicalBatches(fragment)) {
+      EXPECT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      AssertSchemaEqual(*table->schema(), *batch->schema(), /*check_metadata=*/false);
+      const auto& s_column = checked_cast<const StringArray&>(*batch->column(0));
+      const auto& i64_column = checked_cast<const Int64Array&>(*batch->column(1));
+      for (int64_t i = 0; i < batch->num_rows(); ++i) {
+        EXPECT_EQ("v" + std::to_string(i64_column.Value(i)), s_column.GetView(i));
+      }
+      row_count += batch->num_rows();
+    }
+    return row_count;
+  };
+
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  opts_->fragment_scan_options = fragment_scan_options;
+  auto filter = greater_equal(field_ref("i64"), literal(int64_t{990}));
+  // Only the last row group is read according to its statistics
+  ASSERT_EQ(200, count_rows(filter));
+
+  fragment_scan_options->late_materialization = true;
+  for (bool use_page_index : {false, true}) {
+    ARROW_SCOPED_TRACE("use_page_index=", use_page_index);
+    fragment_scan_options->use_page_index = use_page_index;
+    ASSERT_EQ(10, count_rows(filter));
+    auto around_boundary = and_(greater_equal(field_ref("i64"), literal(int64_t{395})),
+                                less(field_ref("i64"), literal(int64_t{405})));
+    ASSERT_EQ(11, count_rows(or_(equal(field_ref("i64"), literal(int64_t{5})),
+                                 std::move(around_boundary))));
+    ASSERT_EQ(0, count_rows(equal(field_ref("i64"), literal(int64_t{-1}))));
+  }
+
+  // Nothing is left to read after the filter columns, so the scan is done as usual
+  fragment_scan_options->use_page_index = false;
+  Project({"i64"});
+  SetFilter(filter);
+  int64_t row_count = 0;
+  for (auto maybe_batch : PhysicalBatches(fragment)) {
+    ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+    row_count += batch->num_rows();
+  }
+  ASSERT_EQ(200, row_count);
+}
+
 // Tests projection with nested/indexed FieldRefs.
 // https://github.com/apache/arrow/issues/35579
 TEST_P(TestParquetFileFormatScan, ProjectWithNonNamedFieldRefs) {
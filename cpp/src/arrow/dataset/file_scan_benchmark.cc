@@ -0,0 +1,445 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// A matrix of end-to-end scan benchmarks: file format x filesystem x projection
+// width x filter selectivity x Parquet pre-buffering x thread count.
+//
+// Files are written to a temporary local directory, or to the directory given by
+// the ARROW_SCAN_BENCHMARK_URI environment variable (e.g.
+// "s3://bucket/scan-benchmark?endpoint_override=localhost:9000&scheme=http" for
+// a MinIO server).  The "slow" filesystem adds a fixed latency to every request
+// made to the underlying one, to mimic object stores.
+//
+// Besides the throughput of the bytes read, each benchmark reports the number
+// of read requests issued, the ratio of the bytes read to the bytes of the
+// projected columns, and the process CPU time spent per byte read.
+
+#include <atomic>
+#include <cstdlib>
+#include <ctime>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/file_ipc.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/config.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/thread_pool.h"
+
+#ifdef ARROW_CSV
+#include "arrow/csv/writer.h"
+#include "arrow/dataset/file_csv.h"
+#endif
+#ifdef ARROW_ORC
+#include "arrow/adapters/orc/adapter.h"
+#include "arrow/dataset/file_orc.h"
+#endif
+#ifdef ARROW_PARQUET
+#include "arrow/dataset/file_parquet.h"
+#include "parquet/arrow/writer.h"
+#include "parquet/properties.h"
+#endif
+
+namespace arrow {
+namespace dataset {
+
+namespace {
+
+constexpr int kNumColumns = 16;
+constexpr int kNumFiles = 4;
+constexpr int64_t kRowsPerFile = 1 << 16;
+constexpr int64_t kRowGroupSize = 1 << 14;
+constexpr double kSlowFileSystemLatency = 0.005;  // 5 ms per request
+
+enum FormatIndex { kIpc, kParquet, kCsv, kOrc };
+enum StorageIndex { kLocal, kSlow };
+
+struct ReadStats {
+  std::atomic<int64_t> num_requests{0};
+  std::atomic<int64_t> bytes_read{0};
+
+  void Record(int64_t nbytes) {
+    num_requests.fetch_add(1);
+    bytes_read.fetch_add(nbytes);
+  }
+};
+
+// Forwards to another file, counting the read requests and the bytes they return
+class CountingRandomAccessFile : public io::RandomAccessFile {
+ public:
+  CountingRandomAccessFile(std::shared_ptr<io::RandomAccessFile> file, ReadStats* stats)
+      : file_(std::move(file)), stats_(stats) {}
+
+  Status Close() override { return file_->Close(); }
+  bool closed() const override { return file_->closed(); }
+  Result<int64_t> Tell() const override { return file_->Tell(); }
+  Status Seek(int64_t position) override { return file_->Seek(position); }
+  Result<int64_t> GetSize() override { return file_->GetSize(); }
+  bool supports_zero_copy() const override { return file_->supports_zero_copy(); }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, file_->Read(nbytes, out));
+    stats_->Record(bytes_read);
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer, file_->Read(nbytes));
+    stats_->Record(buffer->size());
+    return buffer;
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, file_->ReadAt(position, nbytes, out));
+    stats_->Record(bytes_read);
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer,
+                          file_->ReadAt(position, nbytes));
+    stats_->Record(buffer->size());
+    return buffer;
+  }
+
+  Future<std::shared_ptr<Buffer>> ReadAsync(const io::IOContext& io_context,
+                                            int64_t position, int64_t nbytes) override {
+    ReadStats* stats = stats_;
+    return file_->ReadAsync(io_context, position, nbytes)
+        .Then([stats](const std::shared_ptr<Buffer>& buffer) {
+          stats->Record(buffer->size());
+          return buffer;
+        });
+  }
+
+  Status WillNeed(const std::vector<io::ReadRange>& ranges) override {
+    return file_->WillNeed(ranges);
+  }
+
+ private:
+  std::shared_ptr<io::RandomAccessFile> file_;
+  ReadStats* stats_;
+};
+
+std::shared_ptr<Schema> GetSchema() {
+  static std::shared_ptr<Schema> schema = [] {
+    // The first column drives the filter, the other ones are only projected
+    FieldVector fields = {field("filter", int32())};
+    for (int i = 1; i < kNumColumns; i++) {
+      fields.push_back(
+          field("c" + std::to_string(i), i % 2 == 0 ? float64() : int64()));
+    }
+    return ::arrow::schema(std::move(fields));
+  }();
+  return schema;
+}
+
+std::shared_ptr<Table> MakeFileData(int64_t seed) {
+  random::RandomArrayGenerator rng(seed);
+  ArrayVector columns = {rng.Int32(kRowsPerFile, 0, 99, /*null_probability=*/0)};
+  for (int i = 1; i < kNumColumns; i++) {
+    if (i % 2 == 0) {
+      columns.push_back(rng.Float64(kRowsPerFile, -1e6, 1e6, /*null_probability=*/0));
+    } else {
+      columns.push_back(rng.Int64(kRowsPerFile, 0, int64_t{1} << 40,
+                                  /*null_probability=*/0));
+    }
+  }
+  return Table::Make(GetSchema(), std::move(columns));
+}
+
+Status WriteFile(FormatIndex format, const Table& table,
+                 const std::shared_ptr<io::OutputStream>& out) {
+  switch (format) {
+    case kIpc: {
+      ARROW_ASSIGN_OR_RAISE(auto writer, ipc::MakeFileWriter(out, table.schema()));
+      RETURN_NOT_OK(writer->WriteTable(table, kRowGroupSize));
+      return writer->Close();
+    }
+    case kParquet:
+#ifdef ARROW_PARQUET
+      return parquet::arrow::WriteTable(table, default_memory_pool(), out,
+                                        kRowGroupSize);
+#else
+      break;
+#endif
+    case kCsv:
+#ifdef ARROW_CSV
+      return csv::WriteCSV(table, csv::WriteOptions::Defaults(), out.get());
+#else
+      break;
+#endif
+    case kOrc: {
+#ifdef ARROW_ORC
+      ARROW_ASSIGN_OR_RAISE(auto writer, adapters::orc::ORCFileWriter::Open(out.get()));
+      RETURN_NOT_OK(writer->Write(table));
+      return writer->Close();
+#else
+      break;
+#endif
+    }
+  }
+  return Status::NotImplemented("File format not built");
+}
+
+std::shared_ptr<FileFormat> MakeFormat(FormatIndex format) {
+  switch (format) {
+    case kIpc:
+      return std::make_shared<IpcFileFormat>();
+#ifdef ARROW_PARQUET
+    case kParquet:
+      return std::make_shared<ParquetFileFormat>();
+#endif
+#ifdef ARROW_CSV
+    case kCsv:
+      return std::make_shared<CsvFileFormat>();
+#endif
+#ifdef ARROW_ORC
+    case kOrc:
+      return std::make_shared<OrcFileFormat>();
+#endif
+    default:
+      return nullptr;
+  }
+}
+
+const char* FormatName(FormatIndex format) {
+  switch (format) {
+    case kIpc:
+      return "arrow";
+    case kParquet:
+      return "parquet";
+    case kCsv:
+      return "csv";
+    case kOrc:
+      return "orc";
+  }
+  return "";
+}
+
+// The filesystem and directory all files are written to, and the files of each
+// format written so far
+struct BenchmarkFiles {
+  std::unique_ptr<arrow::internal::TemporaryDir> temp_dir;
+  std::shared_ptr<fs::FileSystem> filesystem;
+  std::string base_dir;
+  std::map<FormatIndex, std::vector<fs::FileInfo>> files;
+};
+
+Result<BenchmarkFiles*> GetBenchmarkFiles() {
+  static BenchmarkFiles benchmark_files;
+  if (benchmark_files.filesystem == nullptr) {
+    const char* uri = std::getenv("ARROW_SCAN_BENCHMARK_URI");
+    if (uri != nullptr) {
+      ARROW_ASSIGN_OR_RAISE(benchmark_files.filesystem,
+                            fs::FileSystemFromUri(uri, &benchmark_files.base_dir));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(benchmark_files.temp_dir,
+                            arrow::internal::TemporaryDir::Make("scan-benchmark-"));
+      benchmark_files.filesystem = std::make_shared<fs::LocalFileSystem>();
+      benchmark_files.base_dir = benchmark_files.temp_dir->path().ToString();
+    }
+  }
+  return &benchmark_files;
+}
+
+// Writes the files of `format` the first time they are needed
+Result<std::vector<fs::FileInfo>> GetFiles(FormatIndex format) {
+  ARROW_ASSIGN_OR_RAISE(BenchmarkFiles * benchmark_files, GetBenchmarkFiles());
+  auto it = benchmark_files->files.find(format);
+  if (it != benchmark_files->files.end()) return it->second;
+
+  const std::shared_ptr<fs::FileSystem>& filesystem = benchmark_files->filesystem;
+  std::string dir = fs::internal::ConcatAbstractPath(benchmark_files->base_dir,
+                                                     FormatName(format));
+  RETURN_NOT_OK(filesystem->CreateDir(dir));
+  std::vector<std::string> paths;
+  for (int i = 0; i < kNumFiles; i++) {
+    std::string path = fs::internal::ConcatAbstractPath(
+        dir, "part-" + std::to_string(i) + "." + FormatName(format));
+    ARROW_ASSIGN_OR_RAISE(auto out, filesystem->OpenOutputStream(path));
+    RETURN_NOT_OK(WriteFile(format, *MakeFileData(/*seed=*/i), out));
+    RETURN_NOT_OK(out->Close());
+    paths.push_back(std::move(path));
+  }
+  ARROW_ASSIGN_OR_RAISE(std::vector<fs::FileInfo> infos, filesystem->GetFileInfo(paths));
+  benchmark_files->files[format] = infos;
+  return infos;
+}
+
+Result<std::shared_ptr<Dataset>> MakeDataset(FormatIndex format, StorageIndex storage,
+                                             ReadStats* stats) {
+  std::shared_ptr<FileFormat> file_format = MakeFormat(format);
+  if (file_format == nullptr) return Status::NotImplemented("File format not built");
+  ARROW_ASSIGN_OR_RAISE(std::vector<fs::FileInfo> infos, GetFiles(format));
+  ARROW_ASSIGN_OR_RAISE(BenchmarkFiles * benchmark_files, GetBenchmarkFiles());
+  std::shared_ptr<fs::FileSystem> filesystem = benchmark_files->filesystem;
+  if (storage == kSlow) {
+    filesystem = std::make_shared<fs::SlowFileSystem>(filesystem, kSlowFileSystemLatency,
+                                                      /*seed=*/42);
+  }
+
+  std::vector<std::shared_ptr<FileFragment>> fragments;
+  for (const fs::FileInfo& info : infos) {
+    FileSource::CustomOpen open =
+        [filesystem, info, stats]() -> Result<std::shared_ptr<io::RandomAccessFile>> {
+      ARROW_ASSIGN_OR_RAISE(auto file, filesystem->OpenInputFile(info));
+      return std::make_shared<CountingRandomAccessFile>(std::move(file), stats);
+    };
+    ARROW_ASSIGN_OR_RAISE(auto fragment,
+                          file_format->MakeFragment(FileSource(open, info.size())));
+    fragments.push_back(std::move(fragment));
+  }
+  return FileSystemDataset::Make(GetSchema(), compute::literal(true),
+                                 std::move(file_format), std::move(filesystem),
+                                 std::move(fragments));
+}
+
+int64_t TotalFileSize(FormatIndex format) {
+  std::vector<fs::FileInfo> infos = *GetFiles(format);
+  int64_t total = 0;
+  for (const fs::FileInfo& info : infos) total += info.size();
+  return total;
+}
+
+// Restores the capacity of the CPU thread pool when going out of scope
+struct CpuThreadPoolCapacityGuard {
+  CpuThreadPoolCapacityGuard()
+      : capacity(arrow::internal::GetCpuThreadPool()->GetCapacity()) {}
+  ~CpuThreadPoolCapacityGuard() {
+    ABORT_NOT_OK(arrow::internal::GetCpuThreadPool()->SetCapacity(capacity));
+  }
+  int capacity;
+};
+
+}  // namespace
+
+static void FileScan(benchmark::State& state) {
+  const auto format = static_cast<FormatIndex>(state.range(0));
+  const auto storage = static_cast<StorageIndex>(state.range(1));
+  const int num_projected = static_cast<int>(state.range(2));
+  const int selectivity_percent = static_cast<int>(state.range(3));
+  const int64_t pre_buffer = state.range(4);
+  const int num_threads = static_cast<int>(state.range(5));
+
+  ReadStats stats;
+  auto maybe_dataset = MakeDataset(format, storage, &stats);
+  if (!maybe_dataset.ok()) {
+    state.SkipWithError(maybe_dataset.status().ToString().c_str());
+    return;
+  }
+  std::shared_ptr<Dataset> dataset = maybe_dataset.MoveValueUnsafe();
+
+  CpuThreadPoolCapacityGuard capacity_guard;
+  if (num_threads > 0) {
+    ABORT_NOT_OK(arrow::internal::GetCpuThreadPool()->SetCapacity(num_threads));
+  }
+
+  std::vector<std::string> columns;
+  for (int i = 0; i < num_projected; i++) {
+    columns.push_back(GetSchema()->field(i)->name());
+  }
+  ScannerBuilder builder(dataset);
+  ABORT_NOT_OK(builder.Project(columns));
+  if (selectivity_percent < 100) {
+    ABORT_NOT_OK(builder.Filter(compute::less(compute::field_ref("filter"),
+                                              compute::literal(selectivity_percent))));
+  }
+  ABORT_NOT_OK(builder.UseThreads(num_threads > 0));
+#ifdef ARROW_PARQUET
+  if (format == kParquet) {
+    auto scan_options = std::make_shared<ParquetFragmentScanOptions>();
+    scan_options->arrow_reader_properties->set_pre_buffer(pre_buffer != 0);
+    scan_options->arrow_reader_properties->set_cache_options(
+        pre_buffer == 2 ? io::CacheOptions::Defaults()
+                        : io::CacheOptions::LazyDefaults());
+    ABORT_NOT_OK(builder.FragmentScanOptions(std::move(scan_options)));
+  }
+#endif
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Scanner> scanner, builder.Finish());
+
+  int64_t num_rows = 0;
+  const std::clock_t cpu_start = std::clock();
+  for (auto _ : state) {
+    ASSERT_OK_AND_ASSIGN(auto batches, scanner->ScanBatches());
+    for (auto maybe_batch : batches) {
+      ASSERT_OK_AND_ASSIGN(TaggedRecordBatch batch, maybe_batch);
+      num_rows += batch.record_batch->num_rows();
+    }
+  }
+  const double cpu_seconds =
+      static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+
+  const int64_t bytes_read = stats.bytes_read.load();
+  // The share of the files taken by the projected columns, assuming that all
+  // columns take about as much space
+  const double bytes_needed = static_cast<double>(state.iterations()) *
+                              TotalFileSize(format) * num_projected / kNumColumns;
+  state.SetBytesProcessed(bytes_read);
+  state.counters["rows"] = benchmark::Counter(static_cast<double>(num_rows),
+                                              benchmark::Counter::kAvgIterations);
+  state.counters["requests"] = benchmark::Counter(static_cast<double>(stats.num_requests),
+                                                  benchmark::Counter::kAvgIterations);
+  state.counters["read_amplification"] = bytes_read / bytes_needed;
+  state.counters["cpu_ns_per_byte"] =
+      bytes_read == 0 ? 0.0 : cpu_seconds * 1e9 / static_cast<double>(bytes_read);
+}
+
+static void FileScanArgs(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"format", "storage", "columns", "selectivity", "pre_buffer", "threads"});
+  for (int format : {kIpc, kParquet, kCsv, kOrc}) {
+    for (int storage : {kLocal, kSlow}) {
+      for (int threads : {0, 4}) {
+        // Projection width, without filter
+        for (int columns : {1, 4, kNumColumns}) {
+          b->Args({format, storage, columns, 100, 1, threads});
+        }
+        // Filter selectivity, with a narrow projection
+        for (int selectivity : {1, 10}) {
+          b->Args({format, storage, 4, selectivity, 1, threads});
+        }
+        // Parquet pre-buffering: off, lazy (the default) or eager coalescing
+        if (format == kParquet) {
+          for (int pre_buffer : {0, 2}) {
+            b->Args({format, storage, 4, 100, pre_buffer, threads});
+          }
+        }
+      }
+    }
+  }
+  b->UseRealTime();
+  b->MeasureProcessCPUTime();
+}
+
+BENCHMARK(FileScan)->Apply(FileScanArgs);
+
+}  // namespace dataset
+}  // namespace arrow
@@ -36,12 +36,15 @@
 #include "arrow/array/array_primitive.h"
 #include "arrow/compute/test_util_internal.h"
 #include "arrow/dataset/api.h"
+#include "arrow/dataset/manifest.h"
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/plan.h"
 #include "arrow/dataset/projector.h"
 #include "arrow/dataset/test_util_internal.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/test_util.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/writer.h"
 #include "arrow/status.h"
 #include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
@@ -52,6 +55,7 @@ namespace cp = arrow::compute;
 namespace arrow {
 
 using compute::ExecBatchFromJSON;
+using internal::checked_pointer_cast;
 using internal::TemporaryDir;
 
 namespace dataset {
@@ -318,6 +322,55 @@ TEST_F(TestFileSystemDataset, FragmentPartitions) {
                 });
 }
 
+TEST_F(TestFileSystemDataset, Manifest) {
+  auto root_partition = equal(field_ref("country"), literal("US"));
+  std::vector<fs::FileInfo> files = {fs::File("NY/New York"), fs::File("CA/Franklin")};
+  std::vector<compute::Expression> partitions = {
+      equal(field_ref("state"), literal("NY")),
+      equal(field_ref("state"), literal("CA")),
+  };
+  auto dataset_schema = schema({field("country", utf8()), field("state", utf8())});
+  MakeDataset(files, root_partition, partitions, dataset_schema);
+
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK(
+      WriteDatasetManifest(checked_pointer_cast<FileSystemDataset>(dataset_), sink));
+  ASSERT_OK_AND_ASSIGN(auto manifest, sink->Finish());
+
+  // The fragments are recreated from the manifest only
+  auto format = std::make_shared<DummyFileFormat>();
+  ASSERT_OK_AND_ASSIGN(
+      std::shared_ptr<Dataset> dataset,
+      ReadDatasetManifest(std::make_shared<io::BufferReader>(manifest), format, fs_));
+  AssertDatasetHasSchema(dataset, dataset_schema);
+  ASSERT_EQ(dataset->partition_expression(), root_partition);
+  AssertFilesAre(dataset, {"NY/New York", "CA/Franklin"});
+  AssertFragmentsHavePartitionExpressions(dataset, partitions);
+  ASSERT_OK_AND_ASSIGN(auto fragments, dataset->GetFragments());
+  for (auto maybe_fragment : fragments) {
+    ASSERT_OK_AND_ASSIGN(auto fragment, maybe_fragment);
+    ASSERT_OK_AND_ASSIGN(auto physical_schema, fragment->ReadPhysicalSchema());
+    AssertSchemaEqual(*dataset_schema, *physical_schema);
+  }
+
+  auto filter = equal(field_ref("state"), literal("CA"));
+  ASSERT_OK_AND_ASSIGN(filter, filter.Bind(*dataset_schema));
+  AssertFragmentsAreFromPath(*dataset->GetFragments(filter), {"CA/Franklin"});
+
+  // The format must match
+  ASSERT_RAISES(Invalid, ReadDatasetManifest(std::make_shared<io::BufferReader>(manifest),
+                                             std::make_shared<IpcFileFormat>(), fs_));
+
+  // Not a manifest
+  ASSERT_OK_AND_ASSIGN(sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, ipc::MakeFileWriter(sink, dataset_schema));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto not_manifest, sink->Finish());
+  ASSERT_RAISES(Invalid,
+                ReadDatasetManifest(std::make_shared<io::BufferReader>(not_manifest),
+                                    format, fs_));
+}
+
 TEST_F(TestFileSystemDataset, WriteProjected) {
   // Regression test for ARROW-12620
   auto format = std::make_shared<IpcFileFormat>();
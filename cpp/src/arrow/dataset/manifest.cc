@@ -0,0 +1,256 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/manifest.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/array_binary.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/expression.h"
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/dictionary.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/type.h"
+#include "arrow/util/base64.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/key_value_metadata.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::checked_pointer_cast;
+
+namespace dataset {
+
+namespace {
+
+constexpr char kManifestVersionKey[] = "arrow_dataset_manifest_version";
+constexpr char kManifestVersion[] = "1";
+constexpr char kFormatKey[] = "format";
+constexpr char kSchemaKey[] = "schema";
+constexpr char kPartitionExpressionKey[] = "partition_expression";
+
+// The number of fragments per record batch of the manifest
+constexpr int64_t kManifestBatchSize = 64 * 1024;
+
+std::shared_ptr<Schema> ManifestSchema(
+    std::shared_ptr<const KeyValueMetadata> metadata = NULLPTR) {
+  return schema({field("path", utf8(), /*nullable=*/false), field("size", int64()),
+                 field("partition_expression", binary(), /*nullable=*/false),
+                 field("physical_schema", binary()),
+                 field("format_metadata", large_binary())},
+                std::move(metadata));
+}
+
+Result<std::shared_ptr<Schema>> DeserializeSchema(std::shared_ptr<Buffer> buffer) {
+  io::BufferReader reader(std::move(buffer));
+  ipc::DictionaryMemo dictionary_memo;
+  return ipc::ReadSchema(&reader, &dictionary_memo);
+}
+
+Result<std::shared_ptr<Buffer>> DecodeMetadataValue(const KeyValueMetadata& metadata,
+                                                    const std::string& key) {
+  ARROW_ASSIGN_OR_RAISE(auto value, metadata.Get(key));
+  return Buffer::FromString(util::base64_decode(value));
+}
+
+// Return a slice of a binary value, which keeps the manifest data alive
+template <typename ArrayType>
+std::shared_ptr<Buffer> ValueBuffer(const ArrayType& array, int64_t i) {
+  return SliceBuffer(array.value_data(), array.value_offset(i), array.value_length(i));
+}
+
+class ManifestBuilder {
+ public:
+  Status Append(const std::shared_ptr<FileFragment>& fragment) {
+    const FileSource& source = fragment->source();
+    if (source.filesystem() == nullptr) {
+      return Status::Invalid("Dataset manifests can only record fragments of files, got ",
+                             fragment->ToString());
+    }
+    ARROW_ASSIGN_OR_RAISE(auto metadata,
+                          fragment->format()->SerializeFragmentMetadata(fragment));
+    ARROW_ASSIGN_OR_RAISE(auto physical_schema, fragment->ReadPhysicalSchema());
+    ARROW_ASSIGN_OR_RAISE(auto partition_expression,
+                          compute::Serialize(fragment->partition_expression()));
+
+    RETURN_NOT_OK(paths_.Append(source.path()));
+    if (source.file_info().size() == fs::kNoSize) {
+      RETURN_NOT_OK(sizes_.AppendNull());
+    } else {
+      RETURN_NOT_OK(sizes_.Append(source.file_info().size()));
+    }
+    RETURN_NOT_OK(partition_expressions_.Append(partition_expression->data(),
+                                                partition_expression->size()));
+    if (physical_schema == nullptr) {
+      RETURN_NOT_OK(physical_schemas_.AppendNull());
+    } else {
+      ARROW_ASSIGN_OR_RAISE(auto serialized, ipc::SerializeSchema(*physical_schema));
+      RETURN_NOT_OK(physical_schemas_.Append(serialized->data(), serialized->size()));
+    }
+    if (metadata == nullptr) {
+      RETURN_NOT_OK(format_metadata_.AppendNull());
+    } else {
+      RETURN_NOT_OK(format_metadata_.Append(metadata->data(), metadata->size()));
+    }
+    return Status::OK();
+  }
+
+  int64_t length() const { return paths_.length(); }
+
+  Result<std::shared_ptr<RecordBatch>> Flush(const std::shared_ptr<Schema>& schema) {
+    const int64_t num_rows = length();
+    ArrayVector columns(5);
+    RETURN_NOT_OK(paths_.Finish(&columns[0]));
+    RETURN_NOT_OK(sizes_.Finish(&columns[1]));
+    RETURN_NOT_OK(partition_expressions_.Finish(&columns[2]));
+    RETURN_NOT_OK(physical_schemas_.Finish(&columns[3]));
+    RETURN_NOT_OK(format_metadata_.Finish(&columns[4]));
+    return RecordBatch::Make(schema, num_rows, std::move(columns));
+  }
+
+ private:
+  StringBuilder paths_;
+  Int64Builder sizes_;
+  BinaryBuilder partition_expressions_;
+  BinaryBuilder physical_schemas_;
+  LargeBinaryBuilder format_metadata_;
+};
+
+}  // namespace
+
+Status WriteDatasetManifest(const std::shared_ptr<FileSystemDataset>& dataset,
+                            const std::shared_ptr<io::OutputStream>& sink) {
+  const auto& format = dataset->format();
+  ARROW_ASSIGN_OR_RAISE(auto serialized_schema, ipc::SerializeSchema(*dataset->schema()));
+  ARROW_ASSIGN_OR_RAISE(auto serialized_partition_expression,
+                        compute::Serialize(dataset->partition_expression()));
+  auto metadata = key_value_metadata(
+      {kManifestVersionKey, kFormatKey, kSchemaKey, kPartitionExpressionKey},
+      {kManifestVersion, format->type_name(),
+       util::base64_encode(serialized_schema->ToString()),
+       util::base64_encode(serialized_partition_expression->ToString())});
+  auto manifest_schema = ManifestSchema(std::move(metadata));
+
+  ARROW_ASSIGN_OR_RAISE(auto writer, ipc::MakeFileWriter(sink, manifest_schema));
+  ManifestBuilder builder;
+  ARROW_ASSIGN_OR_RAISE(auto fragments, dataset->GetFragments());
+  for (auto maybe_fragment : fragments) {
+    ARROW_ASSIGN_OR_RAISE(auto fragment, std::move(maybe_fragment));
+    auto file_fragment = checked_pointer_cast<FileFragment>(std::move(fragment));
+    if (file_fragment->format()->type_name() != format->type_name()) {
+      return Status::Invalid("Dataset manifests can only record fragments of format ",
+                             format->type_name(), ", got fragment ",
+                             file_fragment->ToString(), " of format ",
+                             file_fragment->format()->type_name());
+    }
+    RETURN_NOT_OK(builder.Append(file_fragment));
+    if (builder.length() == kManifestBatchSize) {
+      ARROW_ASSIGN_OR_RAISE(auto batch, builder.Flush(manifest_schema));
+      RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+    }
+  }
+  if (builder.length() > 0) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, builder.Flush(manifest_schema));
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  }
+  return writer->Close();
+}
+
+Result<std::shared_ptr<FileSystemDataset>> ReadDatasetManifest(
+    const std::shared_ptr<io::RandomAccessFile>& source,
+    std::shared_ptr<FileFormat> format, std::shared_ptr<fs::FileSystem> filesystem) {
+  ARROW_ASSIGN_OR_RAISE(auto reader, ipc::RecordBatchFileReader::Open(source));
+  const auto& manifest_schema = reader->schema();
+  const auto& metadata = manifest_schema->metadata();
+  if (!manifest_schema->Equals(*ManifestSchema(), /*check_metadata=*/false) ||
+      metadata == nullptr || !metadata->Contains(kManifestVersionKey)) {
+    return Status::Invalid("Not a dataset manifest: unexpected schema ",
+                           manifest_schema->ToString());
+  }
+  ARROW_ASSIGN_OR_RAISE(auto version, metadata->Get(kManifestVersionKey));
+  if (version != kManifestVersion) {
+    return Status::NotImplemented("Unsupported dataset manifest version ", version);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto format_name, metadata->Get(kFormatKey));
+  if (format_name != format->type_name()) {
+    return Status::Invalid("Dataset manifest was written for format ", format_name,
+                           ", cannot read it with format ", format->type_name());
+  }
+  ARROW_ASSIGN_OR_RAISE(auto serialized_schema,
+                        DecodeMetadataValue(*metadata, kSchemaKey));
+  ARROW_ASSIGN_OR_RAISE(auto dataset_schema, DeserializeSchema(serialized_schema));
+  ARROW_ASSIGN_OR_RAISE(auto serialized_partition_expression,
+                        DecodeMetadataValue(*metadata, kPartitionExpressionKey));
+  ARROW_ASSIGN_OR_RAISE(auto root_partition,
+                        compute::Deserialize(serialized_partition_expression));
+
+  std::vector<std::shared_ptr<FileFragment>> fragments;
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, reader->ReadRecordBatch(i));
+    RETURN_NOT_OK(batch->ValidateFull());
+    const auto& paths = checked_cast<const StringArray&>(*batch->column(0));
+    const auto& sizes = checked_cast<const Int64Array&>(*batch->column(1));
+    const auto& partition_expressions =
+        checked_cast<const BinaryArray&>(*batch->column(2));
+    const auto& physical_schemas = checked_cast<const BinaryArray&>(*batch->column(3));
+    const auto& format_metadata =
+        checked_cast<const LargeBinaryArray&>(*batch->column(4));
+
+    for (int64_t j = 0; j < batch->num_rows(); ++j) {
+      fs::FileInfo info(paths.GetString(j), fs::FileType::File);
+      if (sizes.IsValid(j)) {
+        info.set_size(sizes.Value(j));
+      }
+      ARROW_ASSIGN_OR_RAISE(auto partition_expression,
+                            compute::Deserialize(ValueBuffer(partition_expressions, j)));
+      std::shared_ptr<Schema> physical_schema;
+      if (physical_schemas.IsValid(j)) {
+        ARROW_ASSIGN_OR_RAISE(physical_schema,
+                              DeserializeSchema(ValueBuffer(physical_schemas, j)));
+      }
+      std::shared_ptr<Buffer> fragment_metadata;
+      if (format_metadata.IsValid(j)) {
+        fragment_metadata = ValueBuffer(format_metadata, j);
+      }
+      ARROW_ASSIGN_OR_RAISE(
+          auto fragment,
+          format->MakeFragmentFromManifest(
+              FileSource(std::move(info), filesystem), std::move(partition_expression),
+              std::move(physical_schema), std::move(fragment_metadata)));
+      fragments.push_back(std::move(fragment));
+    }
+  }
+
+  return FileSystemDataset::Make(std::move(dataset_schema), std::move(root_partition),
+                                 std::move(format), std::move(filesystem),
+                                 std::move(fragments));
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,73 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This API is EXPERIMENTAL.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/filesystem/type_fwd.h"
+#include "arrow/io/type_fwd.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \addtogroup dataset-filesystem
+///
+/// @{
+
+/// \brief Write a manifest of a FileSystemDataset.
+///
+/// The manifest is an Arrow IPC file recording the dataset schema and partition
+/// expression and, for each fragment, its path, size, partition expression,
+/// physical schema and format-specific metadata (see
+/// FileFormat::SerializeFragmentMetadata). For Parquet, the latter includes the
+/// FileMetaData and thus the statistics of each row group.
+///
+/// Fragments whose physical schema or metadata isn't cached are inspected, which
+/// may require opening the files.
+///
+/// \param[in] dataset the dataset, whose fragments must all be files of the
+///            dataset format
+/// \param[in] sink the stream to write the manifest to
+ARROW_DS_EXPORT Status WriteDatasetManifest(
+    const std::shared_ptr<FileSystemDataset>& dataset,
+    const std::shared_ptr<io::OutputStream>& sink);
+
+/// \brief Recreate a FileSystemDataset from a manifest written by WriteDatasetManifest.
+///
+/// No filesystem access is necessary: the fragments are created from the contents
+/// of the manifest, so that they can be filtered against their partition
+/// expressions and statistics without opening the files.
+///
+/// \param[in] source the manifest file
+/// \param[in] format the format of the fragments, which must have the same type
+///            as the format the manifest was written with
+/// \param[in] filesystem the filesystem the fragments are read from
+ARROW_DS_EXPORT Result<std::shared_ptr<FileSystemDataset>> ReadDatasetManifest(
+    const std::shared_ptr<io::RandomAccessFile>& source,
+    std::shared_ptr<FileFormat> format, std::shared_ptr<fs::FileSystem> filesystem);
+
+/// @}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -19,7 +19,10 @@
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -35,6 +38,7 @@
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/scalar.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/uri.h"
@@ -115,24 +119,104 @@ bool KeyValuePartitioning::Equals(const Partitioning& other) const {
          Partitioning::Equals(other);
 }
 
+struct KeyValuePartitioning::PartitionMemo {
+  // Bound the memory held for writes with many distinct keys
+  static constexpr size_t kMaxEntries = 1 << 16;
+
+  struct Entry {
+    compute::Expression expression;
+    // Unset if the expression cannot be formatted on its own
+    std::optional<PartitionPathFormat> path;
+  };
+
+  std::mutex mutex;
+  std::unordered_map<std::string, Entry> entries;
+};
+
+KeyValuePartitioning::KeyValuePartitioning(std::shared_ptr<Schema> schema,
+                                           ArrayVector dictionaries,
+                                           KeyValuePartitioningOptions options)
+    : Partitioning(std::move(schema)),
+      dictionaries_(std::move(dictionaries)),
+      options_(options),
+      memo_(std::make_shared<PartitionMemo>()) {
+  if (dictionaries_.empty()) {
+    dictionaries_.resize(schema_->num_fields());
+  }
+}
+
+namespace {
+
+// Whether AppendMemoKey() supports the key type
+bool IsMemoizableKeyType(const DataType& type) {
+  return type.id() == Type::BOOL || is_base_binary_like(type.id()) ||
+         (is_fixed_width(type.id()) && type.id() != Type::NA &&
+          type.id() != Type::DICTIONARY && !type.fingerprint().empty());
+}
+
+template <typename OffsetType>
+std::string_view GetBinaryView(const ArrayData& array, int64_t index) {
+  const auto* offsets = array.GetValues<OffsetType>(1);
+  return std::string_view(
+      reinterpret_cast<const char*>(array.buffers[2]->data()) + offsets[index],
+      static_cast<size_t>(offsets[index + 1] - offsets[index]));
+}
+
+// Append the value of a partition key to the memo key of its partition
+void AppendMemoKey(const ArrayData& array, int64_t index, std::string* out) {
+  if (array.IsNull(index)) {
+    out->push_back('\0');
+    return;
+  }
+  out->push_back('\1');
+  std::string_view value;
+  const auto id = array.type->id();
+  if (id == Type::BOOL) {
+    value = bit_util::GetBit(array.buffers[1]->data(), array.offset + index) ? "\1"
+                                                                              : "\0";
+  } else if (is_binary_like(id)) {
+    value = GetBinaryView<int32_t>(array, index);
+  } else if (is_large_binary_like(id)) {
+    value = GetBinaryView<int64_t>(array, index);
+  } else {
+    const int byte_width = array.type->byte_width();
+    value = std::string_view(reinterpret_cast<const char*>(array.buffers[1]->data()) +
+                                 (array.offset + index) * byte_width,
+                             byte_width);
+  }
+  const auto length = static_cast<int64_t>(value.size());
+  out->append(reinterpret_cast<const char*>(&length), sizeof(length));
+  out->append(value);
+}
+
+}  // namespace
+
 Result<Partitioning::PartitionedBatches> KeyValuePartitioning::Partition(
     const std::shared_ptr<RecordBatch>& batch) const {
   std::vector<int> key_indices;
   int num_keys = 0;
+  // The partitions of batches with the same key fields are memoized, keyed by their
+  // key values prefixed by the key fields.
+  std::string memo_prefix;
+  bool memoize = true;
 
   // assemble vector of indices of fields in batch on which we'll partition
-  for (const auto& partition_field : schema_->fields()) {
+  for (int i = 0; i < schema_->num_fields(); ++i) {
     ARROW_ASSIGN_OR_RAISE(
-        auto match, FieldRef(partition_field->name()).FindOneOrNone(*batch->schema()))
+        auto match, FieldRef(schema_->field(i)->name()).FindOneOrNone(*batch->schema()))
 
     if (match.empty()) continue;
     key_indices.push_back(match[0]);
     ++num_keys;
+
+    const auto& key_type = *batch->schema()->field(match[0])->type();
+    memoize = memoize && IsMemoizableKeyType(key_type);
+    memo_prefix += std::to_string(i) + ":" + key_type.fingerprint() + ";";
   }
 
   if (key_indices.empty()) {
     // no fields to group by; return the whole batch
-    return PartitionedBatches{{batch}, {compute::literal(true)}};
+    return PartitionedBatches{{batch}, {compute::literal(true)}, {}};
   }
 
   // assemble an ExecSpan of the key columns
@@ -145,21 +229,40 @@ Result<Partitioning::PartitionedBatches> KeyValuePartitioning::Partition(
 
   ARROW_ASSIGN_OR_RAISE(Datum id_batch, grouper->Consume(key_batch));
 
-  auto ids = id_batch.array_as<UInt32Array>();
-  ARROW_ASSIGN_OR_RAISE(auto groupings,
-                        compute::Grouper::MakeGroupings(*ids, grouper->num_groups()));
-
   ARROW_ASSIGN_OR_RAISE(auto uniques, grouper->GetUniques());
+  const uint32_t num_groups = grouper->num_groups();
+
+  PartitionedBatches out;
+  out.expressions.resize(num_groups);
+
+  // look up the partitions met by earlier batches
+  std::vector<std::string> memo_keys;
+  std::vector<std::optional<PartitionPathFormat>> paths(num_groups);
+  std::vector<bool> memoized(num_groups, false);
+  if (memoize) {
+    memo_keys.resize(num_groups, memo_prefix);
+    for (uint32_t group = 0; group < num_groups; ++group) {
+      for (int i = 0; i < num_keys; ++i) {
+        AppendMemoKey(*uniques.values[i].array(), group, &memo_keys[group]);
+      }
+    }
+    std::lock_guard<std::mutex> lock(memo_->mutex);
+    for (uint32_t group = 0; group < num_groups; ++group) {
+      auto it = memo_->entries.find(memo_keys[group]);
+      if (it == memo_->entries.end()) continue;
+      out.expressions[group] = it->second.expression;
+      paths[group] = it->second.path;
+      memoized[group] = true;
+    }
+  }
+
+  // assemble partition expressions from the unique keys of the other partitions
   ArrayVector unique_arrays(num_keys);
   for (int i = 0; i < num_keys; ++i) {
     unique_arrays[i] = uniques.values[i].make_array();
   }
-
-  PartitionedBatches out;
-
-  // assemble partition expressions from the unique keys
-  out.expressions.resize(grouper->num_groups());
-  for (uint32_t group = 0; group < grouper->num_groups(); ++group) {
+  for (uint32_t group = 0; group < num_groups; ++group) {
+    if (memoized[group]) continue;
     std::vector<compute::Expression> exprs(num_keys);
 
     for (int i = 0; i < num_keys; ++i) {
@@ -171,6 +274,32 @@ Result<Partitioning::PartitionedBatches> KeyValuePartitioning::Partition(
                                : compute::is_null(compute::field_ref(name));
     }
     out.expressions[group] = and_(std::move(exprs));
+
+    if (memoize) {
+      auto maybe_path = Format(out.expressions[group]);
+      if (maybe_path.ok()) {
+        paths[group] = *std::move(maybe_path);
+      }
+    }
+  }
+
+  if (memoize) {
+    std::lock_guard<std::mutex> lock(memo_->mutex);
+    for (uint32_t group = 0; group < num_groups; ++group) {
+      if (memoized[group]) continue;
+      if (memo_->entries.size() >= PartitionMemo::kMaxEntries) {
+        memo_->entries.clear();
+      }
+      memo_->entries.emplace(std::move(memo_keys[group]),
+                             PartitionMemo::Entry{out.expressions[group], paths[group]});
+    }
+  }
+  if (memoize && std::all_of(paths.begin(), paths.end(),
+                             [](const auto& path) { return path.has_value(); })) {
+    out.paths.reserve(num_groups);
+    for (auto& path : paths) {
+      out.paths.push_back(*std::move(path));
+    }
   }
 
   // remove key columns from batch to which we'll be applying the groupings
@@ -181,6 +310,16 @@ Result<Partitioning::PartitionedBatches> KeyValuePartitioning::Partition(
     // here) have already been handled
     ARROW_ASSIGN_OR_RAISE(rest, rest->RemoveColumn(i));
   }
+
+  if (num_groups == 1) {
+    // all rows belong to the same partition, no need to reorder them
+    out.batches = {std::move(rest)};
+    return out;
+  }
+
+  auto ids = id_batch.array_as<UInt32Array>();
+  ARROW_ASSIGN_OR_RAISE(auto groupings,
+                        compute::Grouper::MakeGroupings(*ids, num_groups));
   ARROW_ASSIGN_OR_RAISE(out.batches, ApplyGroupings(*groupings, rest));
 
   return out;
@@ -81,6 +81,9 @@ class ARROW_DS_EXPORT Partitioning : public util::EqualityComparable<Partitionin
   struct PartitionedBatches {
     RecordBatchVector batches;
     std::vector<compute::Expression> expressions;
+    /// The result of Format() for each of the expressions, if the partitioning
+    /// already knows them. Empty otherwise.
+    std::vector<PartitionPathFormat> paths;
   };
   virtual Result<PartitionedBatches> Partition(
       const std::shared_ptr<RecordBatch>& batch) const = 0;
@@ -193,14 +196,7 @@ class ARROW_DS_EXPORT KeyValuePartitioning : public Partitioning {
 
  protected:
   KeyValuePartitioning(std::shared_ptr<Schema> schema, ArrayVector dictionaries,
-                       KeyValuePartitioningOptions options)
-      : Partitioning(std::move(schema)),
-        dictionaries_(std::move(dictionaries)),
-        options_(options) {
-    if (dictionaries_.empty()) {
-      dictionaries_.resize(schema_->num_fields());
-    }
-  }
+                       KeyValuePartitioningOptions options);
 
   virtual Result<std::vector<Key>> ParseKeys(const std::string& path) const = 0;
 
@@ -216,6 +212,11 @@ class ARROW_DS_EXPORT KeyValuePartitioning : public Partitioning {
 
   ArrayVector dictionaries_;
   KeyValuePartitioningOptions options_;
+
+ private:
+  // The expressions and paths of the partition keys met by Partition()
+  struct PartitionMemo;
+  std::shared_ptr<PartitionMemo> memo_;
 };
 
 /// \brief DirectoryPartitioning parses one segment of a path for each field in its
@@ -0,0 +1,272 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/partition_index_internal.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <unordered_map>
+
+#include "arrow/compute/expression_internal.h"
+#include "arrow/scalar.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace dataset {
+
+namespace {
+
+std::vector<compute::Expression> ConjunctionMembers(const compute::Expression& expr) {
+  auto call = expr.call();
+  if (!call || call->function_name != "and_kleene") {
+    return {expr};
+  }
+  return compute::FlattenedAssociativeChain(expr).fringe;
+}
+
+template <typename ScalarType>
+int64_t IntegerValue(const Scalar& value) {
+  return static_cast<int64_t>(checked_cast<const ScalarType&>(value).value);
+}
+
+// A comparison of a field with a literal, normalized as `ref op value`
+struct Comparison {
+  enum Op { kEqual, kLess, kLessEqual, kGreater, kGreaterEqual };
+
+  FieldRef ref;
+  Op op;
+  std::shared_ptr<Scalar> value;
+};
+
+std::optional<Comparison> ExtractComparison(const compute::Expression& expr) {
+  static const std::unordered_map<std::string, std::pair<Comparison::Op, Comparison::Op>>
+      kOps = {
+          // the op, and the op once the arguments are swapped
+          {"equal", {Comparison::kEqual, Comparison::kEqual}},
+          {"less", {Comparison::kLess, Comparison::kGreater}},
+          {"less_equal", {Comparison::kLessEqual, Comparison::kGreaterEqual}},
+          {"greater", {Comparison::kGreater, Comparison::kLess}},
+          {"greater_equal", {Comparison::kGreaterEqual, Comparison::kLessEqual}},
+      };
+  auto call = expr.call();
+  if (!call || call->arguments.size() != 2) return std::nullopt;
+  auto op = kOps.find(call->function_name);
+  if (op == kOps.end()) return std::nullopt;
+
+  bool swapped = false;
+  const FieldRef* ref = call->arguments[0].field_ref();
+  const Datum* literal = call->arguments[1].literal();
+  if (!ref) {
+    swapped = true;
+    ref = call->arguments[1].field_ref();
+    literal = call->arguments[0].literal();
+  }
+  if (!ref || !literal || !literal->is_scalar() || !literal->scalar()->is_valid) {
+    return std::nullopt;
+  }
+  return Comparison{*ref, swapped ? op->second.second : op->second.first,
+                    literal->scalar()};
+}
+
+}  // namespace
+
+std::optional<PartitionIndex::Key> PartitionIndex::MakeKey(const Scalar& value) {
+  if (!value.is_valid) return std::nullopt;
+  switch (value.type->id()) {
+    case Type::INT8:
+      return IntegerValue<Int8Scalar>(value);
+    case Type::INT16:
+      return IntegerValue<Int16Scalar>(value);
+    case Type::INT32:
+      return IntegerValue<Int32Scalar>(value);
+    case Type::INT64:
+      return IntegerValue<Int64Scalar>(value);
+    case Type::UINT8:
+      return IntegerValue<UInt8Scalar>(value);
+    case Type::UINT16:
+      return IntegerValue<UInt16Scalar>(value);
+    case Type::UINT32:
+      return IntegerValue<UInt32Scalar>(value);
+    case Type::DATE32:
+      return IntegerValue<Date32Scalar>(value);
+    case Type::DATE64:
+      return IntegerValue<Date64Scalar>(value);
+    case Type::TIME32:
+      return IntegerValue<Time32Scalar>(value);
+    case Type::TIME64:
+      return IntegerValue<Time64Scalar>(value);
+    case Type::TIMESTAMP:
+      return IntegerValue<TimestampScalar>(value);
+    case Type::DURATION:
+      return IntegerValue<DurationScalar>(value);
+    case Type::FLOAT:
+    case Type::DOUBLE: {
+      const double double_value =
+          value.type->id() == Type::FLOAT
+              ? static_cast<double>(checked_cast<const FloatScalar&>(value).value)
+              : checked_cast<const DoubleScalar&>(value).value;
+      // NaN is not ordered
+      if (std::isnan(double_value)) return std::nullopt;
+      return double_value;
+    }
+    case Type::STRING:
+    case Type::LARGE_STRING:
+    case Type::BINARY:
+    case Type::LARGE_BINARY:
+      return std::string(checked_cast<const BaseBinaryScalar&>(value).view());
+    default:
+      return std::nullopt;
+  }
+}
+
+PartitionIndex PartitionIndex::Make(
+    const std::function<const compute::Expression&(int)>& get_expression, int count) {
+  PartitionIndex index;
+  std::unordered_map<FieldRef, size_t, FieldRef::Hash> field_ids;
+  // Fields whose values can't all be indexed
+  std::vector<bool> invalid;
+  // The expressions fixing each field, to find the unconstrained ones
+  std::vector<std::vector<bool>> constrained;
+
+  for (int i = 0; i < count; ++i) {
+    for (const auto& member : ConjunctionMembers(get_expression(i))) {
+      auto call = member.call();
+      if (!call || call->arguments.empty()) continue;
+      const FieldRef* ref = call->arguments[0].field_ref();
+      if (!ref) continue;
+
+      const Datum* literal = nullptr;
+      if (call->function_name == "equal" && call->arguments.size() == 2) {
+        literal = call->arguments[1].literal();
+        if (!literal || !literal->is_scalar()) continue;
+      } else if (call->function_name != "is_null") {
+        continue;
+      }
+
+      auto inserted = field_ids.emplace(*ref, index.fields_.size());
+      if (inserted.second) {
+        index.fields_.push_back(FieldIndex{*ref, nullptr, {}, {}});
+        invalid.push_back(false);
+        constrained.emplace_back(count, false);
+      }
+      const size_t field_id = inserted.first->second;
+      constrained[field_id][i] = true;
+      // A null value (is_null) never compares true, the expression is never a
+      // candidate for a comparison on the field
+      if (!literal) continue;
+
+      FieldIndex& field = index.fields_[field_id];
+      const Scalar& value = *literal->scalar();
+      auto key = MakeKey(value);
+      if (!key) {
+        invalid[field_id] = invalid[field_id] || value.is_valid;
+        continue;
+      }
+      if (field.type == nullptr) {
+        field.type = value.type;
+      } else if (!field.type->Equals(*value.type)) {
+        invalid[field_id] = true;
+        continue;
+      }
+      field.values.emplace_back(std::move(*key), i);
+    }
+  }
+
+  std::vector<FieldIndex> fields;
+  for (size_t field_id = 0; field_id < index.fields_.size(); ++field_id) {
+    FieldIndex& field = index.fields_[field_id];
+    if (invalid[field_id] || field.type == nullptr) continue;
+    for (int i = 0; i < count; ++i) {
+      if (!constrained[field_id][i]) field.unconstrained.push_back(i);
+    }
+    std::sort(field.values.begin(), field.values.end());
+    fields.push_back(std::move(field));
+  }
+  index.fields_ = std::move(fields);
+  return index;
+}
+
+std::optional<std::vector<int>> PartitionIndex::Candidates(
+    const compute::Expression& predicate) const {
+  std::optional<std::vector<int>> candidates;
+
+  for (const auto& member : ConjunctionMembers(predicate)) {
+    auto comparison = ExtractComparison(member);
+    if (!comparison) continue;
+
+    auto field = std::find_if(
+        fields_.begin(), fields_.end(),
+        [&](const FieldIndex& field) { return field.ref == comparison->ref; });
+    if (field == fields_.end() || !field->type->Equals(*comparison->value->type)) {
+      continue;
+    }
+    auto key = MakeKey(*comparison->value);
+    if (!key) continue;
+
+    auto key_less = [](const std::pair<Key, int>& l, const Key& r) {
+      return l.first < r;
+    };
+    auto less_key = [](const Key& l, const std::pair<Key, int>& r) {
+      return l < r.first;
+    };
+    auto begin = field->values.begin();
+    auto end = field->values.end();
+    switch (comparison->op) {
+      case Comparison::kEqual:
+        begin = std::lower_bound(begin, end, *key, key_less);
+        end = std::upper_bound(begin, end, *key, less_key);
+        break;
+      case Comparison::kLess:
+        end = std::lower_bound(begin, end, *key, key_less);
+        break;
+      case Comparison::kLessEqual:
+        end = std::upper_bound(begin, end, *key, less_key);
+        break;
+      case Comparison::kGreater:
+        begin = std::upper_bound(begin, end, *key, less_key);
+        break;
+      case Comparison::kGreaterEqual:
+        begin = std::lower_bound(begin, end, *key, key_less);
+        break;
+    }
+
+    std::vector<int> matches = field->unconstrained;
+    matches.reserve(matches.size() + (end - begin));
+    for (auto it = begin; it != end; ++it) {
+      matches.push_back(it->second);
+    }
+    std::sort(matches.begin(), matches.end());
+
+    if (!candidates) {
+      candidates = std::move(matches);
+    } else {
+      std::vector<int> intersection;
+      std::set_intersection(candidates->begin(), candidates->end(), matches.begin(),
+                            matches.end(), std::back_inserter(intersection));
+      candidates = std::move(intersection);
+    }
+  }
+  return candidates;
+}
+
+}  // namespace dataset
+}  // namespace arrow
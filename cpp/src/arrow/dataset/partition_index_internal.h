@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "arrow/compute/expression.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace dataset {
+
+// Index of the partition key values fixed by a set of partition expressions.
+//
+// For each field which the expressions fix to a value (equal(field, literal)), the
+// expressions are sorted by that value. The conjunction members of a predicate
+// which compare an indexed field with a literal (equal, less, less_equal, greater,
+// greater_equal) then select the candidate expressions with binary searches instead
+// of simplifying the predicate against every expression. Expressions which don't fix
+// an indexed field are candidates for every comparison on that field.
+//
+// Only integer, floating point, temporal and string-like values are indexed.
+class ARROW_DS_EXPORT PartitionIndex {
+ public:
+  PartitionIndex() = default;
+
+  // Index the expressions get_expression(0), ..., get_expression(count - 1)
+  static PartitionIndex Make(
+      const std::function<const compute::Expression&(int)>& get_expression, int count);
+
+  // The sorted indices of the expressions which may satisfy `predicate`. This is a
+  // superset of the satisfiable expressions, to be refined with
+  // SimplifyWithGuarantee. Returns nullopt if no conjunction member of the predicate
+  // compares an indexed field with a literal.
+  std::optional<std::vector<int>> Candidates(const compute::Expression& predicate) const;
+
+  int num_indexed_fields() const { return static_cast<int>(fields_.size()); }
+
+ private:
+  // A partition key value, ordered like the value it was made from
+  using Key = std::variant<int64_t, double, std::string>;
+
+  struct FieldIndex {
+    FieldRef ref;
+    std::shared_ptr<DataType> type;
+    // The expressions fixing the field to a non-null value, sorted by that value
+    std::vector<std::pair<Key, int>> values;
+    // The expressions which don't fix the field
+    std::vector<int> unconstrained;
+  };
+
+  static std::optional<Key> MakeKey(const Scalar& value);
+
+  std::vector<FieldIndex> fields_;
+};
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,133 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <optional>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/dataset/partition_index_internal.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+
+using compute::and_;
+using compute::equal;
+using compute::field_ref;
+using compute::greater;
+using compute::greater_equal;
+using compute::is_null;
+using compute::less;
+using compute::less_equal;
+using compute::literal;
+using compute::or_;
+
+namespace dataset {
+
+class TestPartitionIndex : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // year=2020/day=1 ... year=2022/day=3, then year=2023 and a fragment without keys
+    for (int year = 2020; year <= 2022; ++year) {
+      for (int day = 1; day <= 3; ++day) {
+        expressions_.push_back(and_(equal(field_ref("year"), literal(year)),
+                                    equal(field_ref("day"), literal(day))));
+      }
+    }
+    expressions_.push_back(equal(field_ref("year"), literal(2023)));
+    expressions_.push_back(literal(true));
+    expressions_.push_back(is_null(field_ref("year")));
+    index_ = PartitionIndex::Make(
+        [this](int i) -> const compute::Expression& { return expressions_[i]; },
+        static_cast<int>(expressions_.size()));
+  }
+
+  std::optional<std::vector<int>> Candidates(const compute::Expression& predicate) {
+    return index_.Candidates(predicate);
+  }
+
+  std::vector<compute::Expression> expressions_;
+  PartitionIndex index_;
+};
+
+TEST_F(TestPartitionIndex, Equality) {
+  ASSERT_EQ(index_.num_indexed_fields(), 2);
+
+  // Fragments which don't fix a field are always candidates
+  ASSERT_EQ(Candidates(equal(field_ref("year"), literal(2021))),
+            (std::vector<int>{3, 4, 5, 10}));
+  ASSERT_EQ(Candidates(equal(literal(2023), field_ref("year"))),
+            (std::vector<int>{9, 10}));
+  ASSERT_EQ(Candidates(equal(field_ref("year"), literal(1999))), std::vector<int>{10});
+  ASSERT_EQ(Candidates(equal(field_ref("day"), literal(2))),
+            (std::vector<int>{1, 4, 7, 9, 10, 11}));
+}
+
+TEST_F(TestPartitionIndex, Ranges) {
+  ASSERT_EQ(Candidates(less(field_ref("year"), literal(2021))),
+            (std::vector<int>{0, 1, 2, 10}));
+  ASSERT_EQ(Candidates(less_equal(field_ref("year"), literal(2020))),
+            (std::vector<int>{0, 1, 2, 10}));
+  ASSERT_EQ(Candidates(greater(field_ref("year"), literal(2021))),
+            (std::vector<int>{6, 7, 8, 9, 10}));
+  ASSERT_EQ(Candidates(greater_equal(field_ref("year"), literal(2023))),
+            (std::vector<int>{9, 10}));
+  ASSERT_EQ(Candidates(greater(literal(2021), field_ref("year"))),
+            (std::vector<int>{0, 1, 2, 10}));
+}
+
+TEST_F(TestPartitionIndex, Conjunctions) {
+  ASSERT_EQ(Candidates(and_({greater_equal(field_ref("year"), literal(2021)),
+                             less(field_ref("year"), literal(2022)),
+                             equal(field_ref("day"), literal(3))})),
+            (std::vector<int>{5, 10}));
+  // Members which don't compare an indexed field to a literal are ignored
+  ASSERT_EQ(Candidates(and_(equal(field_ref("year"), literal(2022)),
+                            equal(field_ref("other"), literal(1)))),
+            (std::vector<int>{6, 7, 8, 10}));
+}
+
+TEST_F(TestPartitionIndex, NotIndexed) {
+  ASSERT_EQ(Candidates(literal(true)), std::nullopt);
+  ASSERT_EQ(Candidates(equal(field_ref("other"), literal(1))), std::nullopt);
+  ASSERT_EQ(Candidates(or_(equal(field_ref("year"), literal(2020)),
+                           equal(field_ref("year"), literal(2021)))),
+            std::nullopt);
+  // The literal must have the type of the partition values
+  ASSERT_EQ(Candidates(equal(field_ref("year"), literal(int64_t{2020}))), std::nullopt);
+
+  // Fields with values of several types are not indexed
+  std::vector<compute::Expression> mixed = {equal(field_ref("a"), literal(1)),
+                                            equal(field_ref("a"), literal("1"))};
+  auto index = PartitionIndex::Make(
+      [&](int i) -> const compute::Expression& { return mixed[i]; }, 2);
+  ASSERT_EQ(index.num_indexed_fields(), 0);
+}
+
+TEST_F(TestPartitionIndex, Strings) {
+  std::vector<compute::Expression> expressions = {
+      equal(field_ref("s"), literal("b")), equal(field_ref("s"), literal("a")),
+      equal(field_ref("s"), literal("c"))};
+  auto index = PartitionIndex::Make(
+      [&](int i) -> const compute::Expression& { return expressions[i]; }, 3);
+  ASSERT_EQ(index.Candidates(greater(field_ref("s"), literal("a"))),
+            (std::vector<int>{0, 2}));
+  ASSERT_EQ(index.Candidates(equal(field_ref("s"), literal("a"))), std::vector<int>{1});
+}
+
+}  // namespace dataset
+}  // namespace arrow
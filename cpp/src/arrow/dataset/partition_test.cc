@@ -113,6 +113,21 @@ class TestPartitioning : public ::testing::Test {
 
       SCOPED_TRACE("Batch for " + expected_expression->ToString());
       AssertBatchesEqual(*expected_batch, *actual_batch);
+
+      if (!partition_results.paths.empty()) {
+        ASSERT_OK_AND_ASSIGN(auto expected_path,
+                             partitioning->Format(actual_expression));
+        ASSERT_EQ(expected_path.directory, partition_results.paths[i].directory);
+        ASSERT_EQ(expected_path.filename, partition_results.paths[i].filename);
+      }
+    }
+
+    // The partitions of the first call are memoized, a second call must agree
+    ASSERT_OK_AND_ASSIGN(auto memoized_results, partitioning->Partition(full_batch));
+    ASSERT_EQ(memoized_results.expressions, partition_results.expressions);
+    ASSERT_EQ(memoized_results.paths.size(), partition_results.paths.size());
+    for (size_t i = 0; i < memoized_results.batches.size(); i++) {
+      AssertBatchesEqual(*partition_results.batches[i], *memoized_results.batches[i]);
     }
   }
 
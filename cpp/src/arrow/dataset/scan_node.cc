@@ -33,6 +33,7 @@
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/string.h"
@@ -262,9 +263,26 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
           scan_->fragment_evolution->EvolveBatch(
               batch, node_->options_.columns, *scan_->scan_request.fragment_selection));
       compute::ExecBatch with_known_values = AddKnownValues(std::move(evolved_batch));
-      node_->plan_->query_context()->ScheduleTask(
-          [node = node_, output_batch = std::move(with_known_values)] {
-            return node->output_->InputReceived(node, output_batch);
+      acero::QueryContext* ctx = node_->plan_->query_context();
+      const int64_t batch_rows = ctx->options().target_batch_bytes.has_value()
+                                     ? ctx->TargetBatchRows(with_known_values)
+                                     : with_known_values.length;
+      if (batch_rows < with_known_values.length) {
+        // Slice the batch to the target size, the scan completes (and reads the
+        // number of batches) only after this task
+        node_->num_batches_.fetch_add(static_cast<int>(
+            bit_util::CeilDiv(with_known_values.length, batch_rows) - 1));
+      }
+      ctx->ScheduleTask(
+          [node = node_, output_batch = std::move(with_known_values), batch_rows] {
+            if (batch_rows >= output_batch.length) {
+              return node->output_->InputReceived(node, output_batch);
+            }
+            for (int64_t offset = 0; offset < output_batch.length; offset += batch_rows) {
+              ARROW_RETURN_NOT_OK(node->output_->InputReceived(
+                  node, output_batch.Slice(offset, batch_rows)));
+            }
+            return Status::OK();
           },
           "ScanNode::ProcessMorsel");
       return Status::OK();
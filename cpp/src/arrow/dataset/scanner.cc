@@ -19,15 +19,21 @@
 
 #include <algorithm>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <numeric>
 #include <set>
 #include <sstream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "arrow/acero/exec_plan.h"
+#include "arrow/acero/join_planning.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/runtime_filter.h"
 #include "arrow/array/array_primitive.h"
 #include "arrow/array/util.h"
 #include "arrow/compute/api_aggregate.h"
@@ -38,6 +44,7 @@
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/plan.h"
 #include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/table.h"
 #include "arrow/util/async_generator.h"
 #include "arrow/util/config.h"
@@ -255,6 +262,59 @@ Status NormalizeScanOptions(const std::shared_ptr<ScanOptions>& scan_options,
 
 namespace {
 
+// The runtime filters published for a scan node by joins consuming its output, see
+// acero::RuntimeFilter.  They are added to the filter of the fragments that are scanned
+// after they arrive, so that formats can skip the data that cannot find a match.
+class ScanRuntimeFilters {
+ public:
+  ScanRuntimeFilters(std::shared_ptr<ScanOptions> options,
+                     compute::ExecContext* exec_context)
+      : options_(std::move(options)), exec_context_(exec_context) {}
+
+  Status Add(const acero::RuntimeFilter& runtime_filter) {
+    const Schema& dataset_schema = *options_->dataset_schema;
+    // Keys may also refer to the augmented fields, which are not in the dataset
+    acero::RuntimeFilter filter;
+    for (const auto& key : runtime_filter.keys) {
+      if (key.column < dataset_schema.num_fields()) {
+        filter.keys.push_back(key);
+      }
+    }
+    std::lock_guard<std::mutex> lk(mutex_);
+    auto options = std::make_shared<ScanOptions>(*options_);
+    ARROW_ASSIGN_OR_RAISE(
+        options->filter,
+        compute::and_(options_->filter, filter.ToExpression(dataset_schema))
+            .Bind(dataset_schema, exec_context_));
+    options_ = std::move(options);
+    has_filters_ = true;
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<ScanOptions>> OptionsFor(const Fragment& fragment) {
+    std::shared_ptr<ScanOptions> options;
+    {
+      std::lock_guard<std::mutex> lk(mutex_);
+      if (!has_filters_) {
+        return options_;
+      }
+      options = options_;
+    }
+    // Simplifying against the partition lets fragments be skipped altogether
+    auto fragment_options = std::make_shared<ScanOptions>(*options);
+    ARROW_ASSIGN_OR_RAISE(
+        fragment_options->filter,
+        compute::SimplifyWithGuarantee(options->filter, fragment.partition_expression()));
+    return fragment_options;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::shared_ptr<ScanOptions> options_;
+  bool has_filters_ = false;
+  compute::ExecContext* exec_context_;
+};
+
 class AsyncScanner : public Scanner, public std::enable_shared_from_this<AsyncScanner> {
  public:
   AsyncScanner(std::shared_ptr<Dataset> dataset,
@@ -276,6 +336,8 @@ class AsyncScanner : public Scanner, public std::enable_shared_from_this<AsyncSc
   Result<std::shared_ptr<Table>> ToTable() override;
   Result<int64_t> CountRows() override;
   Future<int64_t> CountRowsAsync() override;
+  Result<std::shared_ptr<Scalar>> MinMax(const FieldRef& field) override;
+  Future<std::shared_ptr<Scalar>> MinMaxAsync(const FieldRef& field) override;
   Result<std::shared_ptr<RecordBatchReader>> ToRecordBatchReader() override;
   const std::shared_ptr<Dataset>& dataset() const override;
 
@@ -286,6 +348,7 @@ class AsyncScanner : public Scanner, public std::enable_shared_from_this<AsyncSc
       Executor* executor, bool sequence_fragments, bool use_legacy_batching = false);
   Future<std::shared_ptr<Table>> ToTableAsync(Executor* executor);
   Future<int64_t> CountRowsAsync(Executor* executor);
+  Future<std::shared_ptr<Scalar>> MinMaxAsync(const FieldRef& field, Executor* executor);
 
   Result<FragmentGenerator> GetFragments() const;
 
@@ -305,7 +368,12 @@ Result<EnumeratedRecordBatchGenerator> FragmentToBatches(
                  {"arrow.dataset.fragment.type_name", fragment.value->type_name()},
              });
 #endif
-  ARROW_ASSIGN_OR_RAISE(auto batch_gen, fragment.value->ScanBatchesAsync(options));
+  RecordBatchGenerator batch_gen;
+  if (options->filter.IsSatisfiable()) {
+    ARROW_ASSIGN_OR_RAISE(batch_gen, fragment.value->ScanBatchesAsync(options));
+  } else {
+    batch_gen = MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+  }
   ArrayVector columns;
   for (const auto& field : options->dataset_schema->fields()) {
     // TODO(ARROW-7051): use helper to make empty batch
@@ -332,13 +400,20 @@ Result<EnumeratedRecordBatchGenerator> FragmentToBatches(
 }
 
 Result<AsyncGenerator<EnumeratedRecordBatchGenerator>> FragmentsToBatches(
-    FragmentGenerator fragment_gen, const std::shared_ptr<ScanOptions>& options) {
+    FragmentGenerator fragment_gen, const std::shared_ptr<ScanOptions>& options,
+    std::shared_ptr<ScanRuntimeFilters> runtime_filters = NULLPTR) {
   auto enumerated_fragment_gen = MakeEnumeratedGenerator(std::move(fragment_gen));
-  auto batch_gen_gen =
-      MakeMappedGenerator(std::move(enumerated_fragment_gen),
-                          [=](const Enumerated<std::shared_ptr<Fragment>>& fragment) {
-                            return FragmentToBatches(fragment, options);
-                          });
+  auto batch_gen_gen = MakeMappedGenerator(
+      std::move(enumerated_fragment_gen),
+      [=](const Enumerated<std::shared_ptr<Fragment>>& fragment)
+          -> Result<EnumeratedRecordBatchGenerator> {
+        if (!runtime_filters) {
+          return FragmentToBatches(fragment, options);
+        }
+        ARROW_ASSIGN_OR_RAISE(auto fragment_options,
+                              runtime_filters->OptionsFor(*fragment.value));
+        return FragmentToBatches(fragment, fragment_options);
+      });
   PROPAGATE_SPAN_TO_GENERATOR(std::move(batch_gen_gen));
   return batch_gen_gen;
 }
@@ -417,9 +492,58 @@ Result<EnumeratedRecordBatchGenerator> AsyncScanner::ScanBatchesUnorderedAsync(
   return ScanBatchesUnorderedAsync(cpu_thread_pool, /*sequence_fragments=*/false);
 }
 
+// Converts the scalar columns of scanned batches to arrays, reusing the array built
+// for a previous batch when the value did not change.
+//
+// Partition fields reach the end of the plan as scalars (see MakeExecBatch) and
+// would otherwise be broadcast anew in every batch of every fragment.  Arrays are
+// immutable, so the batches of a partition can share slices of a single broadcast.
+class ConstantColumnCache {
+ public:
+  Result<std::shared_ptr<RecordBatch>> ToRecordBatch(const compute::ExecBatch& batch,
+                                                     std::shared_ptr<Schema> schema,
+                                                     MemoryPool* pool) {
+    const int num_fields = schema->num_fields();
+    if (static_cast<size_t>(num_fields) > batch.values.size()) {
+      return Status::Invalid("ExecBatch::ToRecordBatch mismatching schema size");
+    }
+    ArrayVector columns(num_fields);
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.resize(num_fields);
+    for (int i = 0; i < num_fields; ++i) {
+      const Datum& value = batch.values[i];
+      if (!value.is_scalar()) {
+        columns[i] = value.make_array();
+        continue;
+      }
+      Entry& entry = entries_[i];
+      if (entry.array == nullptr || entry.array->length() < batch.length ||
+          !entry.scalar->Equals(*value.scalar())) {
+        entry.scalar = value.scalar();
+        ARROW_ASSIGN_OR_RAISE(entry.array,
+                              MakeArrayFromScalar(*entry.scalar, batch.length, pool));
+      }
+      columns[i] = entry.array->length() == batch.length
+                       ? entry.array
+                       : entry.array->Slice(0, batch.length);
+    }
+    return RecordBatch::Make(std::move(schema), batch.length, std::move(columns));
+  }
+
+ private:
+  struct Entry {
+    std::shared_ptr<Scalar> scalar;
+    std::shared_ptr<Array> array;
+  };
+
+  std::mutex mutex_;
+  // The last broadcast of each column
+  std::vector<Entry> entries_;
+};
+
 Result<EnumeratedRecordBatch> ToEnumeratedRecordBatch(
     const std::optional<compute::ExecBatch>& batch, const ScanOptions& options,
-    const FragmentVector& fragments) {
+    const FragmentVector& fragments, ConstantColumnCache* constant_columns) {
   int num_fields = options.projected_schema->num_fields();
 
   EnumeratedRecordBatch out;
@@ -430,7 +554,8 @@ Result<EnumeratedRecordBatch> ToEnumeratedRecordBatch(
   out.record_batch.index = batch->values[num_fields + 1].scalar_as<Int32Scalar>().value;
   out.record_batch.last = batch->values[num_fields + 2].scalar_as<BooleanScalar>().value;
   ARROW_ASSIGN_OR_RAISE(out.record_batch.value,
-                        batch->ToRecordBatch(options.projected_schema, options.pool));
+                        constant_columns->ToRecordBatch(
+                            *batch, options.projected_schema, options.pool));
   return out;
 }
 
@@ -443,6 +568,7 @@ Result<EnumeratedRecordBatchGenerator> AsyncScanner::ScanBatchesUnorderedAsync(
 
   acero::QueryOptions query_options;
   query_options.use_legacy_batching = use_legacy_batching;
+  query_options.task_priority = scan_options_->task_priority;
 
   ARROW_ASSIGN_OR_RAISE(auto plan,
                         acero::ExecPlan::Make(query_options, *exec_context.get()));
@@ -483,12 +609,14 @@ Result<EnumeratedRecordBatchGenerator> AsyncScanner::ScanBatchesUnorderedAsync(
         }
       }};
 
+  auto constant_columns = std::make_shared<ConstantColumnCache>();
   EnumeratedRecordBatchGenerator mapped_gen = MakeMappedGenerator(
       std::move(sink_gen),
-      [sink_gen, options,
-       shared_fragments](const std::optional<compute::ExecBatch>& batch)
+      [sink_gen, options, shared_fragments,
+       constant_columns](const std::optional<compute::ExecBatch>& batch)
           -> Future<EnumeratedRecordBatch> {
-        return ToEnumeratedRecordBatch(batch, *options, *shared_fragments);
+        return ToEnumeratedRecordBatch(batch, *options, *shared_fragments,
+                                       constant_columns.get());
       });
 
   return [mapped_gen = std::move(mapped_gen), plan = std::move(plan),
@@ -751,18 +879,17 @@ Future<int64_t> AsyncScanner::CountRowsAsync(Executor* executor) {
   fragment_gen = MakeMappedGenerator(
       std::move(fragment_gen),
       [options, total](const std::shared_ptr<Fragment>& fragment) {
-        return fragment->CountRows(options->filter, options)
-            .Then([options, total, fragment](std::optional<int64_t> fast_count) mutable
-                  -> std::shared_ptr<Fragment> {
-              if (fast_count) {
-                // fast path: got row count directly; skip scanning this fragment
-                (*total) += *fast_count;
-                return std::make_shared<InMemoryFragment>(options->dataset_schema,
-                                                          RecordBatchVector{});
+        return fragment->AggregateFromMetadata(options->filter, std::nullopt, options)
+            .Then([options, total](const FragmentMetadataAggregates& aggregates)
+                      -> std::shared_ptr<Fragment> {
+              // fast path: count the rows metadata accounts for without scanning them
+              (*total) += aggregates.count;
+              if (aggregates.remainder) {
+                // slow path: actually filter the rest of this fragment's batches
+                return aggregates.remainder;
               }
-
-              // slow path: actually filter this fragment's batches
-              return std::move(fragment);
+              return std::make_shared<InMemoryFragment>(options->dataset_schema,
+                                                        RecordBatchVector{});
             });
       });
 
@@ -799,6 +926,105 @@ Result<int64_t> AsyncScanner::CountRows() {
       scan_options_->use_threads);
 }
 
+Future<std::shared_ptr<Scalar>> AsyncScanner::MinMaxAsync(const FieldRef& field,
+                                                          Executor* executor) {
+  ARROW_ASSIGN_OR_RAISE(auto fragment_gen, GetFragments());
+  const std::shared_ptr<Schema>& dataset_schema = scan_options_->dataset_schema;
+
+  // Fragments resolve references against their own physical schema, so refer to the
+  // column by name rather than by position in the dataset schema
+  ARROW_ASSIGN_OR_RAISE(FieldPath path, field.FindOne(*dataset_schema));
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Field> target, path.Get(*dataset_schema));
+  std::vector<FieldRef> names;
+  const FieldVector* fields = &dataset_schema->fields();
+  for (int index : path.indices()) {
+    names.emplace_back((*fields)[index]->name());
+    fields = &(*fields)[index]->type()->fields();
+  }
+  FieldRef target_ref(std::move(names));
+
+  compute::ExecContext exec_context(scan_options_->pool, executor);
+
+  // Only the target column needs to be scanned
+  const auto options = std::make_shared<ScanOptions>(*scan_options_);
+  ARROW_ASSIGN_OR_RAISE(
+      auto target_projection,
+      ProjectionDescr::FromExpressions({compute::field_ref(target_ref)},
+                                       {target->name()}, *dataset_schema));
+  SetProjection(options.get(), target_projection);
+
+  // Minimums and maximums answered from fragment metadata
+  struct Partials {
+    std::mutex mutex;
+    ScalarVector mins, maxes;
+  };
+  auto partials = std::make_shared<Partials>();
+
+  fragment_gen = MakeMappedGenerator(
+      std::move(fragment_gen),
+      [options, target, target_ref, partials](const std::shared_ptr<Fragment>& fragment) {
+        return fragment->AggregateFromMetadata(options->filter, target_ref, options)
+            .Then([options, target,
+                   partials](const FragmentMetadataAggregates& aggregates)
+                      -> Result<std::shared_ptr<Fragment>> {
+              if (aggregates.min != nullptr) {
+                ARROW_ASSIGN_OR_RAISE(Datum min,
+                                      compute::Cast(aggregates.min, target->type()));
+                ARROW_ASSIGN_OR_RAISE(Datum max,
+                                      compute::Cast(aggregates.max, target->type()));
+                std::lock_guard<std::mutex> lock(partials->mutex);
+                partials->mins.push_back(min.scalar());
+                partials->maxes.push_back(max.scalar());
+              }
+              if (aggregates.remainder) {
+                return aggregates.remainder;
+              }
+              return std::make_shared<InMemoryFragment>(options->dataset_schema,
+                                                        RecordBatchVector{});
+            });
+      });
+
+  acero::Declaration min_max_plan = acero::Declaration::Sequence(
+      {{"scan", ScanNodeOptions{std::make_shared<FragmentDataset>(
+                                    dataset_schema, std::move(fragment_gen)),
+                                options}},
+       {"filter", acero::FilterNodeOptions{options->filter}},
+       {"project",
+        acero::ProjectNodeOptions{{compute::field_ref(target_ref)}, {"value"}}},
+       {"aggregate", acero::AggregateNodeOptions{{compute::Aggregate{
+                         "min_max", nullptr, "value", "min_max"}}}}});
+
+  return acero::DeclarationToBatchesAsync(std::move(min_max_plan), exec_context)
+      .Then([target, partials](
+                const RecordBatchVector& batches) -> Result<std::shared_ptr<Scalar>> {
+        DCHECK_EQ(1, batches.size());
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Scalar> scanned,
+                              batches[0]->column(0)->GetScalar(0));
+        const auto& scanned_min_max =
+            ::arrow::internal::checked_cast<const StructScalar&>(*scanned);
+        std::lock_guard<std::mutex> lock(partials->mutex);
+        partials->mins.push_back(scanned_min_max.value[0]);
+        partials->maxes.push_back(scanned_min_max.value[1]);
+        ARROW_ASSIGN_OR_RAISE(
+            auto min_max, ReduceMinMax(target->type(), partials->mins, partials->maxes));
+        return std::make_shared<StructScalar>(
+            ScalarVector{std::move(min_max.first), std::move(min_max.second)},
+            scanned->type);
+      });
+}
+
+Future<std::shared_ptr<Scalar>> AsyncScanner::MinMaxAsync(const FieldRef& field) {
+  return MinMaxAsync(field, scan_options_->cpu_executor
+                                ? scan_options_->cpu_executor
+                                : ::arrow::internal::GetCpuThreadPool());
+}
+
+Result<std::shared_ptr<Scalar>> AsyncScanner::MinMax(const FieldRef& field) {
+  return ::arrow::internal::RunSynchronously<Future<std::shared_ptr<Scalar>>>(
+      [this, &field](Executor* executor) { return MinMaxAsync(field, executor); },
+      scan_options_->use_threads);
+}
+
 Result<std::shared_ptr<RecordBatchReader>> AsyncScanner::ToRecordBatchReader() {
   ARROW_ASSIGN_OR_RAISE(auto it, ScanBatches());
   return std::make_shared<ScannerRecordBatchReader>(options()->projected_schema,
@@ -979,6 +1205,24 @@ Status ScannerBuilder::FragmentReadahead(int32_t fragment_readahead) {
   return Status::OK();
 }
 
+Status ScannerBuilder::ReadaheadBytes(int64_t readahead_bytes) {
+  if (readahead_bytes < 0) {
+    return Status::Invalid("ReadaheadBytes must be greater than or equal 0, got ",
+                           readahead_bytes);
+  }
+  scan_options_->readahead_bytes = readahead_bytes;
+  return Status::OK();
+}
+
+Status ScannerBuilder::CoalesceFragments(int64_t coalesce_fragments_bytes) {
+  if (coalesce_fragments_bytes < 0) {
+    return Status::Invalid("CoalesceFragments must be greater than or equal 0, got ",
+                           coalesce_fragments_bytes);
+  }
+  scan_options_->coalesce_fragments_bytes = coalesce_fragments_bytes;
+  return Status::OK();
+}
+
 Status ScannerBuilder::Pool(MemoryPool* pool) {
   scan_options_->pool = pool;
   return Status::OK();
@@ -1010,6 +1254,259 @@ Result<std::shared_ptr<Scanner>> ScannerBuilder::Finish() {
 
 namespace {
 
+// Lets a fragment read up to `credits` batches ahead of the consumer, so that reading
+// goes on while the fragments before it are being yielded
+EnumeratedRecordBatchGenerator WithReadaheadCredits(EnumeratedRecordBatchGenerator gen,
+                                                  int credits) {
+  if (credits <= 0) {
+    return gen;
+  }
+  return MakeSerialReadaheadGenerator(std::move(gen), credits);
+}
+
+// Admits fragments to a scan while the estimated bytes of the fragments being read fit
+// in ScanOptions::readahead_bytes.  Fragments are admitted in order; one that does not
+// fit waits until enough fragments are done, or until it is the only one left if it is
+// larger than the whole budget.
+class ReadaheadBudget {
+ public:
+  explicit ReadaheadBudget(const ScanOptions& options)
+      : budget_(options.readahead_bytes),
+        default_cost_(options.readahead_bytes /
+                      std::max(options.fragment_readahead, 1)) {}
+
+  // Resolves once `fragment` may be read
+  Future<> Acquire(const Fragment& fragment, int64_t cost) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    costs_.emplace(&fragment, cost);
+    if (waiters_.empty() && Fits(cost)) {
+      in_flight_ += cost;
+      return Future<>::MakeFinished();
+    }
+    auto waiter = Future<>::Make();
+    waiters_.emplace_back(cost, waiter);
+    return waiter;
+  }
+
+  Future<std::shared_ptr<Fragment>> Acquire(std::shared_ptr<Fragment> fragment) {
+    int64_t cost = fragment->EstimateScanBytes().value_or(default_cost_);
+    return Acquire(*fragment, cost).Then([fragment]() { return fragment; });
+  }
+
+  // Give back the budget of a fragment that was read entirely
+  void Release(const Fragment& fragment) {
+    std::vector<Future<>> admitted;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      auto it = costs_.find(&fragment);
+      if (it == costs_.end()) {
+        return;
+      }
+      in_flight_ -= it->second;
+      costs_.erase(it);
+      while (!waiters_.empty() && Fits(waiters_.front().first)) {
+        in_flight_ += waiters_.front().first;
+        admitted.push_back(std::move(waiters_.front().second));
+        waiters_.pop_front();
+      }
+    }
+    for (auto& waiter : admitted) {
+      waiter.MarkFinished();
+    }
+  }
+
+ private:
+  bool Fits(int64_t cost) const {
+    return in_flight_ == 0 || in_flight_ + cost <= budget_;
+  }
+
+  const int64_t budget_;
+  const int64_t default_cost_;
+  std::mutex mutex_;
+  int64_t in_flight_ = 0;
+  // The cost of each fragment admitted or waiting, released at its last batch
+  std::unordered_multimap<const Fragment*, int64_t> costs_;
+  std::deque<std::pair<int64_t, Future<>>> waiters_;
+};
+
+// Concatenates consecutive batches of the same schema until they reach `batch_size`
+// rows
+class BatchCoalescer {
+ public:
+  BatchCoalescer(int64_t batch_size, MemoryPool* pool)
+      : batch_size_(batch_size), pool_(pool) {}
+
+  Result<TransformFlow<std::shared_ptr<RecordBatch>>> operator()(
+      const std::shared_ptr<RecordBatch>& batch) {
+    if (IsIterationEnd(batch)) {
+      if (pending_.empty()) {
+        return TransformFinish();
+      }
+      ARROW_ASSIGN_OR_RAISE(auto coalesced, Flush());
+      return TransformYield(std::move(coalesced));
+    }
+    if (!pending_.empty() && !pending_[0]->schema()->Equals(*batch->schema())) {
+      // Batches of fragments with different physical schemas can't be concatenated,
+      // `batch` is seen again once the pending ones are out
+      ARROW_ASSIGN_OR_RAISE(auto coalesced, Flush());
+      return TransformYield(std::move(coalesced), /*ready_for_next=*/false);
+    }
+    pending_.push_back(batch);
+    pending_rows_ += batch->num_rows();
+    if (pending_rows_ < batch_size_) {
+      return TransformSkip();
+    }
+    ARROW_ASSIGN_OR_RAISE(auto coalesced, Flush());
+    return TransformYield(std::move(coalesced));
+  }
+
+ private:
+  Result<std::shared_ptr<RecordBatch>> Flush() {
+    RecordBatchVector batches = std::move(pending_);
+    pending_.clear();
+    pending_rows_ = 0;
+    if (batches.size() == 1) {
+      return std::move(batches[0]);
+    }
+    return ConcatenateRecordBatches(batches, pool_);
+  }
+
+  int64_t batch_size_;
+  MemoryPool* pool_;
+  RecordBatchVector pending_;
+  int64_t pending_rows_ = 0;
+};
+
+// A group of small fragments with the same partition expression, scanned as one,
+// see ScanOptions::coalesce_fragments_bytes
+class CoalescedFragment : public Fragment {
+ public:
+  explicit CoalescedFragment(FragmentVector fragments)
+      : Fragment(fragments[0]->partition_expression(), /*physical_schema=*/NULLPTR),
+        fragments_(std::move(fragments)) {}
+
+  Result<RecordBatchGenerator> ScanBatchesAsync(
+      const std::shared_ptr<ScanOptions>& options) override {
+    // Fragments may start reading (e.g. the footer of a Parquet file) as soon as they
+    // are asked for a generator, so only ask once a fragment is about to be read
+    auto next_fragment = std::make_shared<size_t>(0);
+    AsyncGenerator<RecordBatchGenerator> fragment_batch_gen =
+        [fragments = fragments_, options,
+         next_fragment]() -> Future<RecordBatchGenerator> {
+      if (*next_fragment == fragments.size()) {
+        return AsyncGeneratorEnd<RecordBatchGenerator>();
+      }
+      return fragments[(*next_fragment)++]->ScanBatchesAsync(options);
+    };
+    // The fragments are opened concurrently, but their batches still come in order
+    const int readahead =
+        std::min(kCoalescedFragmentReadahead, static_cast<int>(fragments_.size()));
+    ARROW_ASSIGN_OR_RAISE(
+        auto batch_gen,
+        MakeSequencedMergedGenerator(std::move(fragment_batch_gen), readahead));
+    Transformer<std::shared_ptr<RecordBatch>, std::shared_ptr<RecordBatch>> coalescer =
+        BatchCoalescer(options->batch_size, options->pool);
+    return MakeTransformedGenerator(std::move(batch_gen), std::move(coalescer));
+  }
+
+  Status ClearCachedMetadata() override {
+    for (const auto& fragment : fragments_) {
+      RETURN_NOT_OK(fragment->ClearCachedMetadata());
+    }
+    return Fragment::ClearCachedMetadata();
+  }
+
+  std::optional<int64_t> EstimateScanBytes() override {
+    int64_t total = 0;
+    for (const auto& fragment : fragments_) {
+      total += fragment->EstimateScanBytes().value_or(0);
+    }
+    return total;
+  }
+
+  std::string type_name() const override { return "coalesced"; }
+
+  std::string ToString() const override {
+    std::stringstream ss;
+    ss << "coalesced[";
+    for (size_t i = 0; i < fragments_.size(); i++) {
+      ss << (i > 0 ? ", " : "") << fragments_[i]->ToString();
+    }
+    ss << "]";
+    return ss.str();
+  }
+
+ protected:
+  Result<std::shared_ptr<Schema>> ReadPhysicalSchemaImpl() override {
+    return fragments_[0]->ReadPhysicalSchema();
+  }
+
+  FragmentVector fragments_;
+};
+
+// Group the consecutive small fragments that can be scanned together
+Result<FragmentVector> CoalesceSmallFragments(FragmentVector fragments,
+                                              const ScanOptions& options) {
+  const int64_t max_bytes = options.coalesce_fragments_bytes;
+  if (max_bytes <= 0 || fragments.size() < 2) {
+    return fragments;
+  }
+  for (const FieldRef& ref : options.MaterializedFields()) {
+    for (const auto& aug_field : kAugmentedFields) {
+      if (ref.name() != nullptr && *ref.name() == aug_field->name()) {
+        return fragments;
+      }
+    }
+  }
+
+  FragmentVector coalesced;
+  FragmentVector group;
+  int64_t group_bytes = 0;
+  auto close_group = [&]() {
+    if (group.size() == 1) {
+      coalesced.push_back(std::move(group[0]));
+    } else if (group.size() > 1) {
+      coalesced.push_back(std::make_shared<CoalescedFragment>(std::move(group)));
+    }
+    group.clear();
+    group_bytes = 0;
+  };
+  for (auto& fragment : fragments) {
+    const std::optional<int64_t> bytes = fragment->EstimateScanBytes();
+    if (!bytes.has_value() || *bytes >= max_bytes) {
+      close_group();
+      coalesced.push_back(std::move(fragment));
+      continue;
+    }
+    if (!group.empty() &&
+        (group_bytes + *bytes > max_bytes ||
+         group[0]->partition_expression() != fragment->partition_expression())) {
+      close_group();
+    }
+    group_bytes += *bytes;
+    group.push_back(std::move(fragment));
+  }
+  close_group();
+  return coalesced;
+}
+
+// Starts reading a fragment and yields, once its first batch is ready, a generator of
+// all of its batches
+AsyncGenerator<EnumeratedRecordBatchGenerator> WhenFirstBatchReady(
+    EnumeratedRecordBatchGenerator gen) {
+  Future<EnumeratedRecordBatch> first = gen();
+  return MakeSingleFutureGenerator(first.Then(
+      [gen = std::move(gen)](
+          const EnumeratedRecordBatch& first_batch) -> EnumeratedRecordBatchGenerator {
+        if (IsIterationEnd(first_batch)) {
+          return MakeEmptyGenerator<EnumeratedRecordBatch>();
+        }
+        std::vector<EnumeratedRecordBatchGenerator> parts = {
+            MakeVectorGenerator<EnumeratedRecordBatch>({first_batch}), gen};
+        return MakeConcatenatedGenerator(MakeVectorGenerator(std::move(parts)));
+      }));
+}
+
 Result<acero::ExecNode*> MakeScanNode(acero::ExecPlan* plan,
                                       std::vector<acero::ExecNode*> inputs,
                                       const acero::ExecNodeOptions& options) {
@@ -1024,23 +1521,68 @@ Result<acero::ExecNode*> MakeScanNode(acero::ExecPlan* plan,
   // using a generator for speculative forward compatibility with async fragment discovery
   ARROW_ASSIGN_OR_RAISE(auto fragments_it, dataset->GetFragments(scan_options->filter));
   ARROW_ASSIGN_OR_RAISE(auto fragments_vec, fragments_it.ToVector());
-  auto fragment_gen = MakeVectorGenerator(std::move(fragments_vec));
+  ARROW_ASSIGN_OR_RAISE(fragments_vec,
+                        CoalesceSmallFragments(std::move(fragments_vec), *scan_options));
+  FragmentGenerator fragment_gen = MakeVectorGenerator(std::move(fragments_vec));
+
+  // With a byte budget, fragments are started as the budget allows and the merge below
+  // only caps their number
+  std::shared_ptr<ReadaheadBudget> budget;
+  int32_t fragment_readahead = scan_options->fragment_readahead;
+  if (scan_options->readahead_bytes > 0) {
+    budget = std::make_shared<ReadaheadBudget>(*scan_options);
+    fragment_readahead = kMaxBudgetedFragmentReadahead;
+    fragment_gen = MakeMappedGenerator(
+        std::move(fragment_gen), [budget](const std::shared_ptr<Fragment>& fragment) {
+          return budget->Acquire(fragment);
+        });
+  }
 
-  ARROW_ASSIGN_OR_RAISE(auto batch_gen_gen,
-                        FragmentsToBatches(std::move(fragment_gen), scan_options));
+  auto runtime_filters = std::make_shared<ScanRuntimeFilters>(
+      scan_options, plan->query_context()->exec_context());
+  ARROW_ASSIGN_OR_RAISE(
+      auto batch_gen_gen,
+      FragmentsToBatches(std::move(fragment_gen), scan_options, runtime_filters));
+  if (budget) {
+    batch_gen_gen = MakeMappedGenerator(
+        std::move(batch_gen_gen),
+        [budget](const EnumeratedRecordBatchGenerator& batch_gen)
+            -> EnumeratedRecordBatchGenerator {
+          return MakeMappedGenerator(
+              batch_gen, [budget](const EnumeratedRecordBatch& batch) {
+                if (batch.record_batch.last) {
+                  budget->Release(*batch.fragment.value);
+                }
+                return batch;
+              });
+        });
+  }
 
   AsyncGenerator<EnumeratedRecordBatch> merged_batch_gen;
   if (require_sequenced_output) {
-    if (scan_options->fragment_readahead > 1) {
-      ARROW_ASSIGN_OR_RAISE(merged_batch_gen, MakeSequencedMergedGenerator(
-                                                  std::move(batch_gen_gen),
-                                                  scan_options->fragment_readahead));
+    if (fragment_readahead > 1 && scan_node_options.yield_fragments_when_ready) {
+      auto ready_gen_gen = MakeMappedGenerator(
+          std::move(batch_gen_gen),
+          [scan_options](const EnumeratedRecordBatchGenerator& batch_gen) {
+            return WhenFirstBatchReady(
+                WithReadaheadCredits(batch_gen, scan_options->batch_readahead));
+          });
+      merged_batch_gen = MakeConcatenatedGenerator(
+          MakeMergedGenerator(std::move(ready_gen_gen), fragment_readahead));
+    } else if (fragment_readahead > 1) {
+      auto credited_gen_gen = MakeMappedGenerator(
+          std::move(batch_gen_gen),
+          [scan_options](const EnumeratedRecordBatchGenerator& batch_gen) {
+            return WithReadaheadCredits(batch_gen, scan_options->batch_readahead);
+          });
+      ARROW_ASSIGN_OR_RAISE(
+          merged_batch_gen,
+          MakeSequencedMergedGenerator(std::move(credited_gen_gen), fragment_readahead));
     } else {
       merged_batch_gen = MakeConcatenatedGenerator(std::move(batch_gen_gen));
     }
   } else {
-    merged_batch_gen =
-        MakeMergedGenerator(std::move(batch_gen_gen), scan_options->fragment_readahead);
+    merged_batch_gen = MakeMergedGenerator(std::move(batch_gen_gen), fragment_readahead);
   }
 
   AsyncGenerator<EnumeratedRecordBatch> batch_gen;
@@ -1087,9 +1629,16 @@ Result<acero::ExecNode*> MakeScanNode(acero::ExecPlan* plan,
     }
   }
 
-  return acero::MakeExecNode(
-      "source", plan, {},
-      acero::SourceNodeOptions{schema(std::move(fields)), std::move(gen), ordering});
+  ARROW_ASSIGN_OR_RAISE(
+      acero::ExecNode * node,
+      acero::MakeExecNode(
+          "source", plan, {},
+          acero::SourceNodeOptions{schema(std::move(fields)), std::move(gen), ordering}));
+  plan->query_context()->SubscribeRuntimeFilters(
+      node, [runtime_filters](const acero::RuntimeFilter& filter) {
+        return runtime_filters->Add(filter);
+      });
+  return node;
 }
 
 Result<acero::ExecNode*> MakeAugmentedProjectNode(acero::ExecPlan* plan,
@@ -1195,10 +1744,55 @@ Result<acero::ExecNode*> MakeOrderedSinkNode(acero::ExecPlan* plan,
   return node;
 }
 
+// Sums the row counts of the fragments of the scanned dataset, which only reads metadata
+// for the formats which store them (e.g. Parquet).  Fragment datasets are not counted
+// since getting their fragments consumes them.
+std::optional<int64_t> EstimateScanRowCount(const acero::Declaration& declaration,
+                                            const std::vector<std::optional<int64_t>>&) {
+  const auto* options = dynamic_cast<const ScanNodeOptions*>(declaration.options.get());
+  if (options == nullptr || options->dataset == nullptr ||
+      options->scan_options == nullptr || options->dataset->type_name() == "fragment") {
+    return std::nullopt;
+  }
+  compute::Expression filter = options->scan_options->filter;
+  if (!filter.IsBound()) {
+    auto maybe_filter = filter.Bind(*options->dataset->schema());
+    if (!maybe_filter.ok()) {
+      return std::nullopt;
+    }
+    filter = *std::move(maybe_filter);
+  }
+  auto maybe_fragments = options->dataset->GetFragments(filter);
+  if (!maybe_fragments.ok()) {
+    return std::nullopt;
+  }
+  int64_t total = 0;
+  for (auto maybe_fragment : *maybe_fragments) {
+    if (!maybe_fragment.ok()) {
+      return std::nullopt;
+    }
+    const std::shared_ptr<Fragment>& fragment = *maybe_fragment;
+    auto maybe_count = fragment->CountRows(filter, options->scan_options).result();
+    if (maybe_count.ok() && maybe_count->has_value()) {
+      total += **maybe_count;
+      continue;
+    }
+    // The filter could not be resolved from the metadata, assume it keeps half the rows
+    maybe_count =
+        fragment->CountRows(compute::literal(true), options->scan_options).result();
+    if (!maybe_count.ok() || !maybe_count->has_value()) {
+      return std::nullopt;
+    }
+    total += **maybe_count / 2;
+  }
+  return total;
+}
+
 }  // namespace
 
 namespace internal {
 void InitializeScanner(arrow::acero::ExecFactoryRegistry* registry) {
+  acero::RegisterRowCountEstimator("scan", EstimateScanRowCount);
   DCHECK_OK(registry->AddFactory("scan", MakeScanNode));
   DCHECK_OK(registry->AddFactory("ordered_sink", MakeOrderedSinkNode));
   DCHECK_OK(registry->AddFactory("augmented_project", MakeAugmentedProjectNode));
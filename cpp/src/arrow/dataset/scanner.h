@@ -52,6 +52,8 @@ constexpr int64_t kDefaultBatchSize = 1 << 17;  // 128Ki rows
 // This will yield 64 batches ~ 8Mi rows
 constexpr int32_t kDefaultBatchReadahead = 16;
 constexpr int32_t kDefaultFragmentReadahead = 4;
+constexpr int32_t kMaxBudgetedFragmentReadahead = 64;
+constexpr int32_t kCoalescedFragmentReadahead = 8;
 constexpr int32_t kDefaultBytesReadahead = 1 << 25;  // 32MiB
 
 /// Scan-specific options, which can be changed between scans of the same dataset.
@@ -97,6 +99,34 @@ struct ARROW_DS_EXPORT ScanOptions {
   /// Note: Will be ignored if use_threads is set to false
   int32_t fragment_readahead = kDefaultFragmentReadahead;
 
+  /// A budget, in bytes, for the fragments being read at once
+  ///
+  /// If greater than 0, the number of fragments read at once is no longer fixed by
+  /// fragment_readahead.  Instead, fragments are started as long as the sum of their
+  /// estimated sizes (see Fragment::EstimateScanBytes) stays within the budget, so
+  /// that many small files but only a few large ones are read at once.  A fragment
+  /// larger than the budget is read on its own.  A fragment without an estimate counts
+  /// for readahead_bytes / fragment_readahead.  At most kMaxBudgetedFragmentReadahead
+  /// fragments are read at once.
+  ///
+  /// Set to 0 to only limit the readahead with fragment_readahead.
+  int64_t readahead_bytes = 0;
+
+  /// Scan small fragments together, in groups of up to this many bytes
+  ///
+  /// If greater than 0, consecutive fragments estimated (see
+  /// Fragment::EstimateScanBytes) below this size and with the same partition
+  /// expression are scanned as a single fragment.  Up to kCoalescedFragmentReadahead
+  /// fragments of a group are opened at once, so that for instance the footers of
+  /// small Parquet files are fetched concurrently, and their batches are concatenated
+  /// into batches of about batch_size rows instead of many tiny ones.
+  ///
+  /// Fragments are not coalesced when the augmented fields (such as __filename) are
+  /// materialized, as these would then describe a group rather than a single file.
+  ///
+  /// Set to 0 to scan every fragment on its own.
+  int64_t coalesce_fragments_bytes = 0;
+
   /// A pool from which materialized and scanned arrays will be allocated.
   MemoryPool* pool = arrow::default_memory_pool();
 
@@ -119,6 +149,11 @@ struct ARROW_DS_EXPORT ScanOptions {
   /// Note: This  must be true in order for any readahead to happen
   bool use_threads = false;
 
+  /// Priority of the tasks the scan plan submits to its executors
+  ///
+  /// Forwarded to acero::QueryOptions::task_priority.  The lower, the more urgent.
+  int32_t task_priority = 0;
+
   /// If true the scanner will add augmented fields to the output schema.
   bool add_augmented_fields = true;
 
@@ -450,6 +485,14 @@ class ARROW_DS_EXPORT Scanner {
   /// metadata if possible.
   virtual Result<int64_t> CountRows() = 0;
   virtual Future<int64_t> CountRowsAsync() = 0;
+  /// \brief Compute the minimum and maximum of a column over the rows matching the
+  /// filter, skipping nulls.
+  ///
+  /// The result is a struct scalar with "min" and "max" fields, like the result of the
+  /// "min_max" function.  As with CountRows, fragment metadata is used where possible
+  /// and only the rows it cannot answer for are scanned.
+  virtual Result<std::shared_ptr<Scalar>> MinMax(const FieldRef& field) = 0;
+  virtual Future<std::shared_ptr<Scalar>> MinMaxAsync(const FieldRef& field) = 0;
   /// \brief Convert the Scanner to a RecordBatchReader so it can be
   /// easily used with APIs that expect a reader.
   virtual Result<std::shared_ptr<RecordBatchReader>> ToRecordBatchReader() = 0;
@@ -564,6 +607,22 @@ class ARROW_DS_EXPORT ScannerBuilder {
   /// This option provides a control on the RAM vs I/O tradeoff.
   Status FragmentReadahead(int32_t fragment_readahead);
 
+  /// \brief Set the byte budget of the fragments read at once
+  ///
+  /// \param[in] readahead_bytes The budget, or 0 to disable it
+  /// \returns an error if this number is less than 0.
+  ///
+  /// \see ScanOptions::readahead_bytes
+  Status ReadaheadBytes(int64_t readahead_bytes);
+
+  /// \brief Set the size of the groups small fragments are scanned in
+  ///
+  /// \param[in] coalesce_fragments_bytes The group size, or 0 to disable coalescing
+  /// \returns an error if this number is less than 0.
+  ///
+  /// \see ScanOptions::coalesce_fragments_bytes
+  Status CoalesceFragments(int64_t coalesce_fragments_bytes);
+
   /// \brief Set the pool from which materialized and scanned arrays will be allocated.
   Status Pool(MemoryPool* pool);
 
@@ -596,21 +655,37 @@ class ARROW_DS_EXPORT ScannerBuilder {
 ///
 /// Yielded batches will be augmented with fragment/batch indices when
 /// implicit_ordering=true to enable stable ordering for simple ExecPlans.
+///
+/// When yielding sequenced output, the fragments read ahead of the one being yielded
+/// (up to ScanOptions::fragment_readahead of them) each keep reading up to
+/// ScanOptions::batch_readahead batches, so that their I/O overlaps with a slow
+/// fragment instead of waiting behind it.
 class ARROW_DS_EXPORT ScanNodeOptions : public acero::ExecNodeOptions {
  public:
   explicit ScanNodeOptions(std::shared_ptr<Dataset> dataset,
                            std::shared_ptr<ScanOptions> scan_options,
                            bool require_sequenced_output = false,
-                           bool implicit_ordering = false)
+                           bool implicit_ordering = false,
+                           bool yield_fragments_when_ready = false)
       : dataset(std::move(dataset)),
         scan_options(std::move(scan_options)),
         require_sequenced_output(require_sequenced_output),
-        implicit_ordering(implicit_ordering) {}
+        implicit_ordering(implicit_ordering),
+        yield_fragments_when_ready(yield_fragments_when_ready) {}
 
   std::shared_ptr<Dataset> dataset;
   std::shared_ptr<ScanOptions> scan_options;
   bool require_sequenced_output;
   bool implicit_ordering;
+  /// \brief Yield the fragments in the order in which they become ready
+  ///
+  /// Only used with require_sequenced_output.  The batches of each fragment are still
+  /// yielded together and in order, but rather than waiting for the next fragment of
+  /// the dataset the scan moves on to the first of the fragments being read ahead whose
+  /// first batch is ready.  A straggling fragment then delays only itself, at the cost
+  /// of the order of the fragments varying from one scan to the next (the
+  /// __fragment_index field still tells the fragment of each batch).
+  bool yield_fragments_when_ready;
 };
 
 /// @}
@@ -20,11 +20,14 @@
 #include <atomic>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <utility>
 
 #include <gmock/gmock.h>
 
 #include "arrow/acero/exec_plan.h"
+#include "arrow/acero/query_context.h"
+#include "arrow/acero/runtime_filter.h"
 #include "arrow/compute/api.h"
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/api_vector.h"
@@ -51,6 +54,7 @@
 #include "arrow/ipc/writer.h"
 
 using testing::ElementsAre;
+using testing::ElementsAreArray;
 using testing::UnorderedElementsAreArray;
 
 namespace arrow {
@@ -1234,6 +1238,29 @@ TEST_P(TestScanner, MaterializeMissingColumn) {
   AssertScanBatchesEqualRepetitionsOf(scanner, batch_with_f64);
 }
 
+TEST_P(TestScanner, MaterializedPartitionColumnIsShared) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch_missing_f64 = ConstantArrayGenerator::Zeroes(
+      GetParam().items_per_batch, schema({field("i32", int32())}));
+  auto fragment_missing_f64 = std::make_shared<InMemoryFragment>(
+      RecordBatchVector{
+          static_cast<size_t>(GetParam().num_child_datasets * GetParam().num_batches),
+          batch_missing_f64},
+      equal(field_ref("f64"), literal(2.5)));
+  auto dataset = std::make_shared<FragmentDataset>(
+      schema_, FragmentVector{fragment_missing_f64});
+  auto scanner = MakeScanner(std::move(dataset));
+
+  ASSERT_OK_AND_ASSIGN(auto table, scanner->ToTable());
+  ASSERT_EQ(table->num_rows(), GetParam().num_child_datasets *
+                                  GetParam().num_batches * GetParam().items_per_batch);
+  // The batches of the fragment share a single broadcast of the partition value
+  const auto& first = table->column(1)->chunk(0);
+  for (const auto& chunk : table->column(1)->chunks()) {
+    ASSERT_EQ(chunk->data()->buffers[1]->data(), first->data()->buffers[1]->data());
+  }
+}
+
 TEST_P(TestScanner, ToTable) {
   SetSchema({field("i32", int32()), field("f64", float64())});
   auto batch = ConstantArrayGenerator::Zeroes(GetParam().items_per_batch, schema_);
@@ -1351,6 +1378,31 @@ TEST_P(TestScanner, CountRows) {
   ASSERT_EQ(rows, num_datasets * num_batches * (items_per_batch - 64));
 }
 
+TEST_P(TestScanner, MinMax) {
+  const auto items_per_batch = GetParam().items_per_batch;
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  ArrayVector arrays(2);
+  ArrayFromVector<Int32Type>(Iota<int32_t>(static_cast<int32_t>(items_per_batch)),
+                             &arrays[0]);
+  ArrayFromVector<DoubleType>(Iota<double>(static_cast<double>(items_per_batch)),
+                              &arrays[1]);
+  auto batch = RecordBatch::Make(schema_, items_per_batch, arrays);
+  auto scanner = MakeScanner(batch);
+
+  auto assert_min_max = [&](int32_t expected_min, int32_t expected_max) {
+    ASSERT_OK_AND_ASSIGN(auto min_max, scanner->MinMax(FieldRef("i32")));
+    const auto& fields =
+        ::arrow::internal::checked_cast<const StructScalar&>(*min_max).value;
+    AssertScalarsEqual(Int32Scalar(expected_min), *fields[0], /*verbose=*/true);
+    AssertScalarsEqual(Int32Scalar(expected_max), *fields[1], /*verbose=*/true);
+  };
+  assert_min_max(0, static_cast<int32_t>(items_per_batch) - 1);
+
+  ASSERT_OK_AND_ASSIGN(options_->filter,
+                       greater_equal(field_ref("i32"), literal(64)).Bind(*schema_));
+  assert_min_max(64, static_cast<int32_t>(items_per_batch) - 1);
+}
+
 TEST_P(TestScanner, EmptyFragment) {
   // Regression test for ARROW-13982
   SetSchema({field("i32", int32()), field("f64", float64())});
@@ -1720,8 +1772,14 @@ class ControlledFragment : public Fragment {
     return tracking_generator_;
   };
 
+  std::optional<int64_t> EstimateScanBytes() override { return estimated_bytes_; }
+
   int NumBatchesRead() { return tracking_generator_.num_read(); }
 
+  void set_estimated_bytes(int64_t estimated_bytes) {
+    estimated_bytes_ = estimated_bytes;
+  }
+
   void Finish() { ARROW_UNUSED(record_batch_generator_.producer().Close()); }
   void DeliverBatch(uint32_t num_rows) {
     auto batch = ConstantArrayGenerator::Zeroes(num_rows, given_physical_schema_);
@@ -1731,6 +1789,7 @@ class ControlledFragment : public Fragment {
  private:
   PushGenerator<std::shared_ptr<RecordBatch>> record_batch_generator_;
   util::TrackingGenerator<std::shared_ptr<RecordBatch>> tracking_generator_;
+  std::optional<int64_t> estimated_bytes_;
 };
 
 // TODO(ARROW-8163) Add testing for fragments arriving out of order
@@ -1755,6 +1814,12 @@ class ControlledDataset : public Dataset {
 
   void FinishFragment(int fragment_index) { fragments_[fragment_index]->Finish(); }
 
+  void SetEstimatedBytes(int64_t estimated_bytes) {
+    for (const auto& fragment : fragments_) {
+      fragment->set_estimated_bytes(estimated_bytes);
+    }
+  }
+
  protected:
   Result<FragmentIterator> GetFragmentsImpl(compute::Expression predicate) override {
     std::vector<std::shared_ptr<Fragment>> casted_fragments(fragments_.begin(),
@@ -1884,11 +1949,13 @@ class TestReordering : public ::testing::Test {
     return collected;
   }
 
-  std::shared_ptr<Scanner> MakeScanner(int fragment_readahead = 0) {
+  std::shared_ptr<Scanner> MakeScanner(int fragment_readahead = 0,
+                                       int64_t readahead_bytes = 0) {
     ScannerBuilder builder(dataset_);
     if (fragment_readahead != 0) {
       ARROW_EXPECT_OK(builder.FragmentReadahead(fragment_readahead));
     }
+    ARROW_EXPECT_OK(builder.ReadaheadBytes(readahead_bytes));
     EXPECT_OK_AND_ASSIGN(auto scanner, builder.Finish());
     return scanner;
   }
@@ -2096,6 +2163,75 @@ TEST_F(TestReordering, FileReadahead) {
   consumer.AssertFinished();
 }
 
+TEST_F(TestReordering, ReadaheadBytes) {
+  // The two fragments do not fit in the budget together
+  dataset_->SetEstimatedBytes(100);
+  auto scanner = MakeScanner(/*fragment_readahead=*/0, /*readahead_bytes=*/150);
+  ASSERT_OK_AND_ASSIGN(auto batch_gen, scanner->ScanBatchesUnorderedAsync());
+  BatchConsumer consumer(std::move(batch_gen));
+  dataset_->DeliverBatch(0, 0);
+  dataset_->DeliverBatch(0, 1);
+  consumer.AssertCanConsume();
+  dataset_->DeliverBatch(1, 0);
+  dataset_->FinishFragment(1);
+  // Fragment 1 only starts once fragment 0 gives back its budget
+  consumer.AssertCannotConsume();
+  dataset_->FinishFragment(0);
+  consumer.AssertCanConsume();
+  consumer.AssertCanConsume();
+  consumer.AssertFinished();
+}
+
+TEST_F(TestReordering, ReadaheadBytesFitting) {
+  // Both fragments fit in the budget, even with a fragment_readahead of 1
+  dataset_->SetEstimatedBytes(100);
+  auto scanner = MakeScanner(/*fragment_readahead=*/1, /*readahead_bytes=*/200);
+  ASSERT_OK_AND_ASSIGN(auto batch_gen, scanner->ScanBatchesUnorderedAsync());
+  BatchConsumer consumer(std::move(batch_gen));
+  dataset_->DeliverBatch(0, 0);
+  dataset_->DeliverBatch(0, 1);
+  consumer.AssertCanConsume();
+  dataset_->DeliverBatch(1, 0);
+  dataset_->FinishFragment(1);
+  consumer.AssertCanConsume();
+  dataset_->FinishFragment(0);
+  consumer.AssertCanConsume();
+  consumer.AssertFinished();
+}
+
+TEST_F(TestReordering, CoalesceFragments) {
+  dataset_->SetEstimatedBytes(10);
+  dataset_->DeliverBatch(0, 1);
+  dataset_->DeliverBatch(0, 2);
+  dataset_->DeliverBatch(1, 3);
+  dataset_->FinishFragment(0);
+  dataset_->FinishFragment(1);
+
+  ScannerBuilder builder(dataset_);
+  ASSERT_OK(builder.CoalesceFragments(100));
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto table, scanner->ToTable());
+  ASSERT_EQ(6, table->num_rows());
+  // The batches of both fragments are concatenated
+  ASSERT_EQ(1, table->column(0)->num_chunks());
+}
+
+TEST_F(TestReordering, CoalesceFragmentsTooLarge) {
+  dataset_->SetEstimatedBytes(100);
+  dataset_->DeliverBatch(0, 1);
+  dataset_->DeliverBatch(1, 2);
+  dataset_->FinishFragment(0);
+  dataset_->FinishFragment(1);
+
+  ScannerBuilder builder(dataset_);
+  ASSERT_OK(builder.CoalesceFragments(100));
+  ASSERT_RAISES(Invalid, builder.CoalesceFragments(-1));
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto table, scanner->ToTable());
+  ASSERT_EQ(3, table->num_rows());
+  ASSERT_EQ(2, table->column(0)->num_chunks());
+}
+
 class TestScannerBuilder : public ::testing::Test {
   void SetUp() override {
     DatasetVector sources;
@@ -2491,6 +2627,47 @@ TEST(ScanNode, Trivial) {
   ASSERT_THAT(plan.Run(), Finishes(ResultWith(UnorderedElementsAreArray(expected))));
 }
 
+TEST(ScanNode, SequencedOutput) {
+  for (bool when_ready : {false, true}) {
+    ARROW_SCOPED_TRACE("yield_fragments_when_ready=", when_ready);
+    TestPlan plan;
+    auto basic = MakeBasicDataset();
+    auto options = std::make_shared<ScanOptions>();
+    options->projection = Materialize({"a", "b", "c"}, /*include_aug_fields=*/true);
+    options->fragment_readahead = 4;
+    options->batch_readahead = 1;
+
+    ASSERT_OK(acero::Declaration::Sequence(
+                  {
+                      {"scan", ScanNodeOptions{basic.dataset, options,
+                                               /*require_sequenced_output=*/true,
+                                               /*implicit_ordering=*/true, when_ready}},
+                      {"sink", acero::SinkNodeOptions{&plan.sink_gen}},
+                  })
+                  .AddToPlan(plan.get()));
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, plan.Run());
+    if (!when_ready) {
+      ASSERT_THAT(batches, ElementsAreArray(basic.batches));
+      continue;
+    }
+    ASSERT_THAT(batches, UnorderedElementsAreArray(basic.batches));
+    // The batches of each fragment are still yielded together and in order
+    std::vector<std::pair<int, int>> fragment_and_batch;
+    for (const auto& batch : batches) {
+      fragment_and_batch.emplace_back(batch.values[3].scalar_as<Int32Scalar>().value,
+                                      batch.values[4].scalar_as<Int32Scalar>().value);
+    }
+    for (size_t i = 1; i < fragment_and_batch.size(); ++i) {
+      const auto& [fragment, batch] = fragment_and_batch[i];
+      if (batch == 0) {
+        ASSERT_NE(fragment, fragment_and_batch[i - 1].first);
+      } else {
+        ASSERT_EQ(fragment_and_batch[i - 1], std::make_pair(fragment, batch - 1));
+      }
+    }
+  }
+}
+
 TEST(ScanNode, FilteredOnVirtualColumn) {
   TestPlan plan;
 
@@ -2517,6 +2694,41 @@ TEST(ScanNode, FilteredOnVirtualColumn) {
   ASSERT_THAT(plan.Run(), Finishes(ResultWith(UnorderedElementsAreArray(expected))));
 }
 
+TEST(ScanNode, RuntimeFilterSkipsFragments) {
+  TestPlan plan;
+
+  auto basic = MakeBasicDataset();
+
+  auto options = std::make_shared<ScanOptions>();
+  // ensure all fields are materialized
+  options->projection = Materialize({"a", "b", "c"}, /*include_aug_fields=*/true);
+
+  ASSERT_OK_AND_ASSIGN(auto scan,
+                       acero::MakeExecNode("scan", plan.get(), {},
+                                           ScanNodeOptions{basic.dataset, options}));
+  ASSERT_OK(acero::MakeExecNode("sink", plan.get(), {scan},
+                                acero::SinkNodeOptions{&plan.sink_gen})
+                .status());
+
+  // As published by a join on "c" whose build side only holds 47
+  acero::RuntimeFilter filter;
+  filter.keys.push_back({/*column=*/2, MakeScalar(47), MakeScalar(47), nullptr});
+  ASSERT_OK(plan.get()->query_context()->PublishRuntimeFilter(scan, filter));
+
+  // The first fragment is guaranteed to have c == 23 so it is not scanned at all
+  auto expected = basic.batches;
+  expected.erase(expected.begin(), expected.begin() + 2);
+
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, plan.Run());
+  std::vector<compute::ExecBatch> non_empty;
+  for (auto& batch : batches) {
+    if (batch.length > 0) {
+      non_empty.push_back(std::move(batch));
+    }
+  }
+  ASSERT_THAT(non_empty, UnorderedElementsAreArray(expected));
+}
+
 TEST(ScanNode, DeferredFilterOnPhysicalColumn) {
   TestPlan plan;
 
@@ -65,6 +65,15 @@ enum class ExistingDataBehavior : int8_t {
   kError,
 };
 
+/// \brief Controls how the dataset writer orders rows by its clustering keys
+enum class ClusteringOrder : int8_t {
+  /// Sort by the first key, then by the second key, and so on
+  kLinear,
+  /// Sort along a Z-order (Morton) curve by interleaving the bits of each key's rank,
+  /// so that rows which are close in every key end up close together
+  kZOrder,
+};
+
 class InMemoryDataset;
 
 class CsvFileFormat;
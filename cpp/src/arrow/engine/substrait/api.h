@@ -22,5 +22,6 @@
 #include "arrow/engine/substrait/extension_set.h"
 #include "arrow/engine/substrait/extension_types.h"
 #include "arrow/engine/substrait/options.h"
+#include "arrow/engine/substrait/prepared_plan.h"
 #include "arrow/engine/substrait/relation.h"
 #include "arrow/engine/substrait/serde.h"
@@ -0,0 +1,271 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/engine/substrait/prepared_plan.h"
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+
+#include "arrow/acero/options.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/expression.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/engine/substrait/serde.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::ComputeStringHash;
+
+namespace engine {
+
+namespace {
+
+// Walk the parameters of a declaration tree, see PreparedPlan.  The same
+// traversal collects the literal values of a template and replaces them when
+// binding.
+class ParameterVisitor {
+ public:
+  // Collect the parameters without changing them
+  ParameterVisitor() = default;
+
+  // Replace the parameters with `values`
+  explicit ParameterVisitor(const std::vector<Datum>* values) : values_(values) {}
+
+  std::vector<Datum> collected() && { return std::move(collected_); }
+
+  Result<acero::Declaration> Visit(const acero::Declaration& declaration) {
+    acero::Declaration out = declaration;
+    for (auto& input : out.inputs) {
+      if (auto* input_declaration = std::get_if<acero::Declaration>(&input)) {
+        ARROW_ASSIGN_OR_RAISE(*input_declaration, Visit(*input_declaration));
+      }
+    }
+    if (declaration.factory_name == "filter") {
+      auto options =
+          checked_cast<const acero::FilterNodeOptions&>(*declaration.options);
+      ARROW_ASSIGN_OR_RAISE(options.filter_expression,
+                            Visit(options.filter_expression));
+      out.options = std::make_shared<acero::FilterNodeOptions>(std::move(options));
+    } else if (declaration.factory_name == "project") {
+      auto options =
+          checked_cast<const acero::ProjectNodeOptions&>(*declaration.options);
+      for (auto& expression : options.expressions) {
+        ARROW_ASSIGN_OR_RAISE(expression, Visit(expression));
+      }
+      out.options = std::make_shared<acero::ProjectNodeOptions>(std::move(options));
+    } else if (declaration.factory_name == "hashjoin") {
+      auto options =
+          checked_cast<const acero::HashJoinNodeOptions&>(*declaration.options);
+      ARROW_ASSIGN_OR_RAISE(options.filter, Visit(options.filter));
+      out.options = std::make_shared<acero::HashJoinNodeOptions>(std::move(options));
+    } else if (declaration.factory_name == "scan") {
+      auto options =
+          checked_cast<const dataset::ScanNodeOptions&>(*declaration.options);
+      if (options.scan_options) {
+        auto scan_options = std::make_shared<dataset::ScanOptions>(*options.scan_options);
+        ARROW_ASSIGN_OR_RAISE(scan_options->filter, Visit(scan_options->filter));
+        options.scan_options = std::move(scan_options);
+      }
+      out.options = std::make_shared<dataset::ScanNodeOptions>(std::move(options));
+    }
+    return out;
+  }
+
+ private:
+  Result<compute::Expression> Visit(const compute::Expression& expression) {
+    if (const Datum* literal = expression.literal()) {
+      const int64_t index = num_visited_++;
+      if (values_ == nullptr) {
+        collected_.push_back(*literal);
+        return expression;
+      }
+      if (index >= static_cast<int64_t>(values_->size())) {
+        return Status::Invalid("Not enough parameters: the plan has more than ",
+                               values_->size());
+      }
+      const Datum& value = (*values_)[index];
+      if (value.kind() != literal->kind() || !value.type()->Equals(*literal->type())) {
+        return Status::TypeError("Parameter ", index, " must be a ", literal->ToString(),
+                                 " of type ", literal->type()->ToString(), ", got ",
+                                 value.ToString(), " of type ",
+                                 value.type() ? value.type()->ToString() : "null");
+      }
+      return compute::literal(value);
+    }
+    if (const compute::Expression::Call* call = expression.call()) {
+      std::vector<compute::Expression> arguments;
+      arguments.reserve(call->arguments.size());
+      for (const auto& argument : call->arguments) {
+        ARROW_ASSIGN_OR_RAISE(auto bound_argument, Visit(argument));
+        arguments.push_back(std::move(bound_argument));
+      }
+      return compute::call(call->function_name, std::move(arguments), call->options);
+    }
+    return expression;
+  }
+
+  const std::vector<Datum>* values_ = nullptr;
+  std::vector<Datum> collected_;
+  int64_t num_visited_ = 0;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<PreparedPlan>> PreparedPlan::Make(
+    const Buffer& buf, const ExtensionIdRegistry* registry,
+    const ConversionOptions& conversion_options) {
+  ARROW_ASSIGN_OR_RAISE(PlanInfo plan,
+                        DeserializePlan(buf, registry, /*ext_set_out=*/NULLPTR,
+                                        conversion_options));
+  ParameterVisitor visitor;
+  ARROW_RETURN_NOT_OK(visitor.Visit(plan.root.declaration));
+  return std::shared_ptr<PreparedPlan>(
+      new PreparedPlan(std::move(plan), std::move(visitor).collected()));
+}
+
+Result<PlanInfo> PreparedPlan::Bind(const std::vector<Datum>& parameters) const {
+  if (parameters.size() != parameters_.size()) {
+    return Status::Invalid("Expected ", parameters_.size(), " parameters, got ",
+                           parameters.size());
+  }
+  ParameterVisitor visitor(&parameters);
+  PlanInfo bound = plan_;
+  ARROW_ASSIGN_OR_RAISE(bound.root.declaration, visitor.Visit(plan_.root.declaration));
+  return bound;
+}
+
+class PreparedPlanCache::Impl {
+ public:
+  Impl(int64_t capacity, const ExtensionIdRegistry* registry,
+       ConversionOptions conversion_options)
+      : capacity_(capacity),
+        registry_(registry),
+        conversion_options_(std::move(conversion_options)) {}
+
+  Result<std::shared_ptr<PreparedPlan>> GetOrPrepare(const Buffer& buf) {
+    std::string key = buf.ToString();
+    const uint64_t hash = ComputeStringHash<0>(key.data(), key.size());
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (auto entry = Find(hash, key)) {
+        ++hits_;
+        return entry->plan;
+      }
+      ++misses_;
+    }
+    // Prepare without holding the lock; concurrent misses on the same plan
+    // prepare it several times, but only the first one is kept.
+    ARROW_ASSIGN_OR_RAISE(auto plan,
+                          PreparedPlan::Make(buf, registry_, conversion_options_));
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (auto entry = Find(hash, key)) {
+      return entry->plan;
+    }
+    lru_.push_front(Entry{hash, std::move(key), plan});
+    index_.emplace(hash, lru_.begin());
+    if (static_cast<int64_t>(lru_.size()) > capacity_) {
+      Evict();
+    }
+    return plan;
+  }
+
+  int64_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int64_t>(lru_.size());
+  }
+
+  int64_t hits() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hits_;
+  }
+
+  int64_t misses() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return misses_;
+  }
+
+ private:
+  struct Entry {
+    uint64_t hash;
+    // The serialized plan, compared on lookup to rule out hash collisions
+    std::string message;
+    std::shared_ptr<PreparedPlan> plan;
+  };
+
+  // Find the entry of a plan and make it the most recently used one
+  Entry* Find(uint64_t hash, const std::string& message) {
+    auto [begin, end] = index_.equal_range(hash);
+    for (auto it = begin; it != end; ++it) {
+      if (it->second->message == message) {
+        lru_.splice(lru_.begin(), lru_, it->second);
+        return &lru_.front();
+      }
+    }
+    return nullptr;
+  }
+
+  void Evict() {
+    const Entry& oldest = lru_.back();
+    auto [begin, end] = index_.equal_range(oldest.hash);
+    for (auto it = begin; it != end; ++it) {
+      if (&*it->second == &oldest) {
+        index_.erase(it);
+        break;
+      }
+    }
+    lru_.pop_back();
+  }
+
+  const int64_t capacity_;
+  const ExtensionIdRegistry* registry_;
+  const ConversionOptions conversion_options_;
+
+  mutable std::mutex mutex_;
+  // Most recently used first
+  std::list<Entry> lru_;
+  std::unordered_multimap<uint64_t, std::list<Entry>::iterator> index_;
+  int64_t hits_ = 0;
+  int64_t misses_ = 0;
+};
+
+PreparedPlanCache::PreparedPlanCache(int64_t capacity,
+                                     const ExtensionIdRegistry* registry,
+                                     ConversionOptions conversion_options)
+    : impl_(std::make_unique<Impl>(capacity, registry, std::move(conversion_options))) {}
+
+PreparedPlanCache::~PreparedPlanCache() = default;
+
+Result<std::shared_ptr<PreparedPlan>> PreparedPlanCache::GetOrPrepare(
+    const Buffer& buf) {
+  return impl_->GetOrPrepare(buf);
+}
+
+int64_t PreparedPlanCache::size() const { return impl_->size(); }
+
+int64_t PreparedPlanCache::hits() const { return impl_->hits(); }
+
+int64_t PreparedPlanCache::misses() const { return impl_->misses(); }
+
+}  // namespace engine
+}  // namespace arrow
@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This API is EXPERIMENTAL.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/datum.h"
+#include "arrow/engine/substrait/options.h"
+#include "arrow/engine/substrait/relation.h"
+#include "arrow/engine/substrait/type_fwd.h"
+#include "arrow/engine/substrait/visibility.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+namespace engine {
+
+/// \brief A Substrait plan deserialized once and instantiated many times
+///
+/// Deserializing a plan parses the protobuf message, resolves its extension
+/// functions and types and builds the Acero declarations, which dominates the
+/// planning time of short queries.  Services that run the same plan template
+/// with different literal values can prepare the template once and Bind() new
+/// values, which only copies the declarations.
+///
+/// The parameters of a prepared plan are the literals of the expressions of its
+/// filter, project and hash join nodes and of the filters of its scans, in the
+/// order of a depth-first traversal of the declarations (inputs before the node
+/// that consumes them, then arguments from left to right).  parameters() returns
+/// the values found in the template.
+class ARROW_ENGINE_EXPORT PreparedPlan {
+ public:
+  /// \brief Deserialize a single-relation Substrait Plan message
+  ///
+  /// \see DeserializePlan
+  static Result<std::shared_ptr<PreparedPlan>> Make(
+      const Buffer& buf, const ExtensionIdRegistry* registry = NULLPTR,
+      const ConversionOptions& conversion_options = {});
+
+  /// \brief The plan with the literal values of the template
+  const PlanInfo& plan() const { return plan_; }
+
+  /// \brief The literal values of the template, in parameter order
+  const std::vector<Datum>& parameters() const { return parameters_; }
+
+  /// \brief Instantiate the plan with other values for its parameters
+  ///
+  /// `parameters` must have one value per parameter, of the same type as the value
+  /// it replaces.
+  Result<PlanInfo> Bind(const std::vector<Datum>& parameters) const;
+
+ private:
+  PreparedPlan(PlanInfo plan, std::vector<Datum> parameters)
+      : plan_(std::move(plan)), parameters_(std::move(parameters)) {}
+
+  PlanInfo plan_;
+  std::vector<Datum> parameters_;
+};
+
+/// \brief A bounded cache of prepared plans, keyed by their serialized message
+///
+/// The cache is thread-safe.  When full, the least recently used plan is evicted.
+class ARROW_ENGINE_EXPORT PreparedPlanCache {
+ public:
+  explicit PreparedPlanCache(int64_t capacity = 128,
+                             const ExtensionIdRegistry* registry = NULLPTR,
+                             ConversionOptions conversion_options = {});
+  ~PreparedPlanCache();
+
+  /// \brief Return the prepared plan of the message in `buf`, preparing it on a miss
+  Result<std::shared_ptr<PreparedPlan>> GetOrPrepare(const Buffer& buf);
+
+  /// \brief The number of plans currently cached
+  int64_t size() const;
+
+  /// \brief The number of GetOrPrepare() calls served from the cache
+  int64_t hits() const;
+
+  /// \brief The number of GetOrPrepare() calls that had to prepare the plan
+  int64_t misses() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace engine
+}  // namespace arrow
@@ -0,0 +1,164 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/buffer.h"
+#include "arrow/engine/substrait/extension_set.h"
+#include "arrow/engine/substrait/prepared_plan.h"
+#include "arrow/engine/substrait/serde.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace engine {
+
+namespace {
+
+// SELECT * FROM t WHERE A > <threshold>
+Result<std::shared_ptr<Buffer>> FilterPlan(int threshold) {
+  std::string substrait_json = R"({
+  "version": { "major_number": 9999, "minor_number": 9999, "patch_number": 9999 },
+  "relations": [{
+    "rel": {
+      "filter": {
+        "condition": {
+          "scalarFunction": {
+            "functionReference": 0,
+            "arguments": [{
+              "value": {
+                "selection": {
+                  "directReference": { "structField": { "field": 0 } },
+                  "rootReference": {}
+                }
+              }
+            }, {
+              "value": { "literal": { "i32": )" +
+                               std::to_string(threshold) + R"( } }
+            }],
+            "output_type": { "bool": {} }
+          }
+        },
+        "input": {
+          "read": {
+            "base_schema": {
+              "names": ["A", "B"],
+              "struct": { "types": [{ "i32": {} }, { "i32": {} }] }
+            },
+            "namedTable": { "names": ["t"] }
+          }
+        }
+      }
+    }
+  }],
+  "extension_uris": [{
+    "extension_uri_anchor": 0,
+    "uri": ")" + std::string(kSubstraitComparisonFunctionsUri) +
+                               R"("
+  }],
+  "extensions": [{
+    "extension_function": {
+      "extension_uri_reference": 0,
+      "function_anchor": 0,
+      "name": "gt"
+    }
+  }]
+  })";
+  return internal::SubstraitFromJSON("Plan", substrait_json,
+                                     /*ignore_unknown_fields=*/false);
+}
+
+std::shared_ptr<Table> InputTable() {
+  return TableFromJSON(schema({field("A", int32()), field("B", int32())}), {R"([
+      [10, 1],
+      [20, 2],
+      [30, 3],
+      [40, 4]
+  ])"});
+}
+
+ConversionOptions ProvideInputTable() {
+  ConversionOptions conversion_options;
+  conversion_options.named_table_provider = [](const std::vector<std::string>&,
+                                               const Schema&) {
+    return acero::Declaration("table_source",
+                              acero::TableSourceNodeOptions(InputTable()));
+  };
+  return conversion_options;
+}
+
+void AssertPlanOutput(const PlanInfo& plan, const std::string& expected_json) {
+  ASSERT_OK_AND_ASSIGN(auto table, acero::DeclarationToTable(plan.root.declaration,
+                                                             /*use_threads=*/false));
+  auto expected = TableFromJSON(InputTable()->schema(), {expected_json});
+  AssertTablesEqual(*expected, *table, /*same_chunk_layout=*/false);
+}
+
+}  // namespace
+
+TEST(PreparedPlan, Bind) {
+  ASSERT_OK_AND_ASSIGN(auto buf, FilterPlan(20));
+  ASSERT_OK_AND_ASSIGN(
+      auto prepared, PreparedPlan::Make(*buf, /*registry=*/NULLPTR, ProvideInputTable()));
+  ASSERT_EQ(1, prepared->parameters().size());
+  AssertDatumsEqual(Datum(std::make_shared<Int32Scalar>(20)), prepared->parameters()[0]);
+  AssertPlanOutput(prepared->plan(), "[[30, 3], [40, 4]]");
+
+  ASSERT_OK_AND_ASSIGN(auto bound,
+                       prepared->Bind({Datum(std::make_shared<Int32Scalar>(15))}));
+  AssertPlanOutput(bound, "[[20, 2], [30, 3], [40, 4]]");
+  // Binding leaves the prepared plan untouched
+  AssertPlanOutput(prepared->plan(), "[[30, 3], [40, 4]]");
+
+  ASSERT_RAISES(Invalid, prepared->Bind({}));
+  ASSERT_RAISES(TypeError, prepared->Bind({Datum(std::make_shared<Int64Scalar>(15))}));
+}
+
+TEST(PreparedPlanCache, GetOrPrepare) {
+  PreparedPlanCache cache(/*capacity=*/1, /*registry=*/NULLPTR, ProvideInputTable());
+  ASSERT_OK_AND_ASSIGN(auto buf, FilterPlan(20));
+  ASSERT_OK_AND_ASSIGN(auto other_buf, FilterPlan(30));
+
+  ASSERT_OK_AND_ASSIGN(auto prepared, cache.GetOrPrepare(*buf));
+  ASSERT_OK_AND_ASSIGN(auto cached, cache.GetOrPrepare(*buf));
+  ASSERT_EQ(prepared, cached);
+  ASSERT_EQ(1, cache.size());
+  ASSERT_EQ(1, cache.hits());
+  ASSERT_EQ(1, cache.misses());
+
+  // Evicts the first plan
+  ASSERT_OK_AND_ASSIGN(auto other, cache.GetOrPrepare(*other_buf));
+  ASSERT_NE(prepared, other);
+  AssertPlanOutput(other->plan(), "[[40, 4]]");
+  ASSERT_EQ(1, cache.size());
+  ASSERT_OK_AND_ASSIGN(cached, cache.GetOrPrepare(*buf));
+  ASSERT_NE(prepared, cached);
+  ASSERT_EQ(1, cache.hits());
+  ASSERT_EQ(3, cache.misses());
+
+  ASSERT_RAISES(Invalid, cache.GetOrPrepare(Buffer("not a plan")));
+}
+
+}  // namespace engine
+}  // namespace arrow
@@ -17,6 +17,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <functional>
 #include <memory>
 #include <optional>
 
@@ -48,6 +49,7 @@
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/string.h"
+#include "arrow/util/value_parsing.h"
 
 namespace arrow::fs {
 
@@ -159,6 +161,14 @@ Status AzureOptions::ExtractFromUriQuery(const Uri& uri) {
     } else if (kv.first == "background_writes") {
       ARROW_ASSIGN_OR_RAISE(background_writes,
                             ::arrow::internal::ParseBoolean(kv.second));
+    } else if (kv.first == "parallel_read_part_size") {
+      if (!::arrow::internal::ParseValue<Int64Type>(kv.second.data(), kv.second.size(),
+                                                    &parallel_read_part_size) ||
+          parallel_read_part_size < 0) {
+        return Status::Invalid(
+            "parallel_read_part_size must be a non-negative integer, got '", kv.second,
+            "'");
+      }
     } else if (sas_token_query_parameters.find(kv.first) !=
                sas_token_query_parameters.end()) {
       credential_kind = CredentialKind::kSASToken;
@@ -252,6 +262,9 @@ bool AzureOptions::Equals(const AzureOptions& other) const {
                       blob_storage_scheme == other.blob_storage_scheme &&
                       dfs_storage_scheme == other.dfs_storage_scheme &&
                       default_metadata == other.default_metadata &&
+                      parallel_read_part_size == other.parallel_read_part_size &&
+                      read_hedging == other.read_hedging &&
+                      file_info_cache == other.file_info_cache &&
                       account_name == other.account_name &&
                       credential_kind_ == other.credential_kind_;
   if (!equals) {
@@ -759,11 +772,14 @@ class ObjectInputFile final : public io::RandomAccessFile {
  public:
   ObjectInputFile(std::shared_ptr<Blobs::BlobClient> blob_client,
                   const io::IOContext& io_context, AzureLocation location,
-                  int64_t size = kNoSize)
+                  int64_t size = kNoSize, int64_t parallel_read_part_size = 0,
+                  std::shared_ptr<internal::RequestHedger> read_hedger = nullptr)
       : blob_client_(std::move(blob_client)),
         io_context_(io_context),
         location_(std::move(location)),
-        content_length_(size) {}
+        content_length_(size),
+        parallel_read_part_size_(parallel_read_part_size),
+        read_hedger_(std::move(read_hedger)) {}
 
   Status Init() {
     if (content_length_ != kNoSize) {
@@ -855,21 +871,15 @@ class ObjectInputFile final : public io::RandomAccessFile {
     if (nbytes == 0) {
       return 0;
     }
-
-    // Read the desired range of bytes
-    Http::HttpRange range{position, nbytes};
-    Storage::Blobs::DownloadBlobToOptions download_options;
-    download_options.Range = range;
-    try {
-      return blob_client_
-          ->DownloadTo(reinterpret_cast<uint8_t*>(out), nbytes, download_options)
-          .Value.ContentRange.Length.Value();
-    } catch (const Core::RequestFailedException& exception) {
-      return ExceptionToStatus(
-          exception, "DownloadTo from '", blob_client_->GetUrl(), "' at position ",
-          position, " for ", nbytes,
-          " bytes failed. ReadAt failed to read the required byte range.");
+    if (parallel_read_part_size_ > 0 && nbytes > parallel_read_part_size_) {
+      return internal::ReadRangeInParts(io_context_, position, nbytes,
+                                        parallel_read_part_size_,
+                                        static_cast<uint8_t*>(out), MakeRangeReader());
+    }
+    if (read_hedger_) {
+      return MakeRangeReader()(position, nbytes, static_cast<uint8_t*>(out));
     }
+    return DownloadRange(*blob_client_, position, nbytes, static_cast<uint8_t*>(out));
   }
 
   Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
@@ -902,7 +912,48 @@ class ObjectInputFile final : public io::RandomAccessFile {
     return buffer;
   }
 
+  Future<std::shared_ptr<Buffer>> ReadAsync(const io::IOContext& io_context,
+                                            int64_t position, int64_t nbytes) override {
+    RETURN_NOT_OK(CheckClosed("read"));
+    RETURN_NOT_OK(CheckPosition(position, "read"));
+
+    nbytes = std::min(nbytes, content_length_ - position);
+    if (parallel_read_part_size_ > 0 && nbytes > parallel_read_part_size_) {
+      // Read the parts as separate IO tasks rather than blocking an IO thread
+      // until all of them are done
+      return internal::ReadRangeInPartsAsync(io_context, position, nbytes,
+                                             parallel_read_part_size_, MakeRangeReader());
+    }
+    return RandomAccessFile::ReadAsync(io_context, position, nbytes);
+  }
+
  private:
+  // Read the desired range of bytes with a single download
+  static Result<int64_t> DownloadRange(const Blobs::BlobClient& blob_client,
+                                       int64_t position, int64_t nbytes, uint8_t* out) {
+    Http::HttpRange range{position, nbytes};
+    Storage::Blobs::DownloadBlobToOptions download_options;
+    download_options.Range = range;
+    try {
+      return blob_client.DownloadTo(out, nbytes, download_options)
+          .Value.ContentRange.Length.Value();
+    } catch (const Core::RequestFailedException& exception) {
+      return ExceptionToStatus(
+          exception, "DownloadTo from '", blob_client.GetUrl(), "' at position ",
+          position, " for ", nbytes,
+          " bytes failed. ReadAt failed to read the required byte range.");
+    }
+  }
+
+  // A function downloading a range, reissued when slow if hedging is enabled
+  internal::RequestHedger::ReadFunction MakeRangeReader() const {
+    return internal::RequestHedger::Wrap(
+        read_hedger_, io_context_,
+        [blob_client = blob_client_](int64_t position, int64_t nbytes, uint8_t* out) {
+          return DownloadRange(*blob_client, position, nbytes, out);
+        });
+  }
+
   std::shared_ptr<Blobs::BlobClient> blob_client_;
   const io::IOContext io_context_;
   AzureLocation location_;
@@ -911,6 +962,8 @@ class ObjectInputFile final : public io::RandomAccessFile {
   int64_t pos_ = 0;
   int64_t content_length_ = kNoSize;
   std::shared_ptr<const KeyValueMetadata> metadata_;
+  const int64_t parallel_read_part_size_;
+  const std::shared_ptr<internal::RequestHedger> read_hedger_;
 };
 
 Status CreateEmptyBlockBlob(const Blobs::BlockBlobClient& block_blob_client) {
@@ -1673,9 +1726,19 @@ class AzureFileSystem::Impl {
   std::unique_ptr<DataLake::DataLakeServiceClient> datalake_service_client_;
   std::unique_ptr<Blobs::BlobServiceClient> blob_service_client_;
   HNSSupport cached_hns_support_ = HNSSupport::kUnknown;
+  // Shared by all the input files, null unless read hedging is enabled
+  std::shared_ptr<internal::RequestHedger> read_hedger_;
+  // Null unless FileInfo caching is enabled
+  std::shared_ptr<internal::FileInfoCache> file_info_cache_;
 
   Impl(AzureOptions options, io::IOContext io_context)
-      : io_context_(std::move(io_context)), options_(std::move(options)) {}
+      : io_context_(std::move(io_context)),
+        options_(std::move(options)),
+        file_info_cache_(internal::FileInfoCache::Make(options_.file_info_cache)) {
+    if (options_.read_hedging.enabled) {
+      read_hedger_ = std::make_shared<internal::RequestHedger>(options_.read_hedging);
+    }
+  }
 
  public:
   static Result<std::unique_ptr<AzureFileSystem::Impl>> Make(AzureOptions options,
@@ -1691,6 +1754,9 @@ class AzureFileSystem::Impl {
 
   io::IOContext& io_context() { return io_context_; }
   const AzureOptions& options() const { return options_; }
+  const std::shared_ptr<internal::FileInfoCache>& file_info_cache() const {
+    return file_info_cache_;
+  }
 
   Blobs::BlobContainerClient GetBlobContainerClient(const std::string& container_name) {
     return blob_service_client_->GetBlobContainerClient(container_name);
@@ -1865,6 +1931,21 @@ class AzureFileSystem::Impl {
     }
   }
 
+  Result<FileInfo> GetFileInfo(const AzureLocation& location) {
+    if (location.container.empty()) {
+      DCHECK(location.path.empty());
+      // Root directory of the storage account.
+      return FileInfo{"", FileType::Directory};
+    }
+    if (location.path.empty()) {
+      // We have a container, but no path within the container.
+      // The container itself represents a directory.
+      auto container_client = GetBlobContainerClient(location.container);
+      return GetContainerPropsAsFileInfo(location, container_client);
+    }
+    return GetFileInfoOfPathWithinContainer(location);
+  }
+
   Result<FileInfo> GetFileInfoOfPathWithinContainer(const AzureLocation& location) {
     DCHECK(!location.container.empty() && !location.path.empty());
     // There is a path to search within the container. Check HNS support to proceed.
@@ -2160,8 +2241,9 @@ class AzureFileSystem::Impl {
     auto blob_client = std::make_shared<Blobs::BlobClient>(
         GetBlobClient(location.container, location.path));
 
-    auto ptr = std::make_shared<ObjectInputFile>(blob_client, fs->io_context(),
-                                                 std::move(location));
+    auto ptr = std::make_shared<ObjectInputFile>(
+        blob_client, fs->io_context(), std::move(location), kNoSize,
+        options_.parallel_read_part_size, read_hedger_);
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -2179,8 +2261,9 @@ class AzureFileSystem::Impl {
     auto blob_client = std::make_shared<Blobs::BlobClient>(
         GetBlobClient(location.container, location.path));
 
-    auto ptr = std::make_shared<ObjectInputFile>(blob_client, fs->io_context(),
-                                                 std::move(location), info.size());
+    auto ptr = std::make_shared<ObjectInputFile>(
+        blob_client, fs->io_context(), std::move(location), info.size(),
+        options_.parallel_read_part_size, read_hedger_);
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -3247,19 +3330,18 @@ bool AzureFileSystem::Equals(const FileSystem& other) const {
 }
 
 Result<FileInfo> AzureFileSystem::GetFileInfo(const std::string& path) {
-  ARROW_ASSIGN_OR_RAISE(auto location, AzureLocation::FromString(path));
-  if (location.container.empty()) {
-    DCHECK(location.path.empty());
-    // Root directory of the storage account.
-    return FileInfo{"", FileType::Directory};
+  const auto& cache = impl_->file_info_cache();
+  if (cache) {
+    if (auto info = cache->Get(path)) {
+      return *std::move(info);
+    }
   }
-  if (location.path.empty()) {
-    // We have a container, but no path within the container.
-    // The container itself represents a directory.
-    auto container_client = impl_->GetBlobContainerClient(location.container);
-    return GetContainerPropsAsFileInfo(location, container_client);
+  ARROW_ASSIGN_OR_RAISE(auto location, AzureLocation::FromString(path));
+  ARROW_ASSIGN_OR_RAISE(auto info, impl_->GetFileInfo(location));
+  if (cache) {
+    cache->Put(info);
   }
-  return impl_->GetFileInfoOfPathWithinContainer(location);
+  return info;
 }
 
 Result<FileInfoVector> AzureFileSystem::GetFileInfo(const FileSelector& select) {
@@ -3268,10 +3350,14 @@ Result<FileInfoVector> AzureFileSystem::GetFileInfo(const FileSelector& select)
   FileInfoVector results;
   RETURN_NOT_OK(
       impl_->GetFileInfoWithSelector(context, page_size_hint, select, &results));
+  if (const auto& cache = impl_->file_info_cache()) {
+    cache->Put(results);
+  }
   return {std::move(results)};
 }
 
 Status AzureFileSystem::CreateDir(const std::string& path, bool recursive) {
+  internal::FileInfoCacheInvalidator invalidate(impl_->file_info_cache().get(), path);
   ARROW_ASSIGN_OR_RAISE(auto location, AzureLocation::FromString(path));
   if (location.container.empty()) {
     return Status::Invalid("CreateDir requires a non-empty path.");
@@ -3315,6 +3401,8 @@ Status AzureFileSystem::CreateDir(const std::string& path, bool recursive) {
 }
 
 Status AzureFileSystem::DeleteDir(const std::string& path) {
+  internal::FileInfoCacheInvalidator invalidate(impl_->file_info_cache().get(), path,
+                                                /*tree=*/true);
   ARROW_ASSIGN_OR_RAISE(auto location, AzureLocation::FromString(path));
   if (location.container.empty()) {
     return Status::Invalid("DeleteDir requires a non-empty path.");
@@ -3343,6 +3431,8 @@ Status AzureFileSystem::DeleteDir(const std::string& path) {
 }
 
 Status AzureFileSystem::DeleteDirContents(const std::string& path, bool missing_dir_ok) {
+  internal::FileInfoCacheInvalidator invalidate(impl_->file_info_cache().get(), path,
+                                                /*tree=*/true);
   ARROW_ASSIGN_OR_RAISE(auto location, AzureLocation::FromString(path));
   if (location.container.empty()) {
     return internal::InvalidDeleteDirContents(location.all);
@@ -3370,6 +3460,7 @@ Status AzureFileSystem::DeleteRootDirContents() {
 }
 
 Status AzureFileSystem::DeleteFile(const std::string& path) {
+  internal::FileInfoCacheInvalidator invalidate(impl_->file_info_cache().get(), path);
   ARROW_ASSIGN_OR_RAISE(auto location, AzureLocation::FromString(path));
   if (location.container.empty()) {
     return Status::Invalid("DeleteFile requires a non-empty path.");
@@ -3397,6 +3488,11 @@ Status AzureFileSystem::DeleteFile(const std::string& path) {
 }
 
 Status AzureFileSystem::Move(const std::string& src, const std::string& dest) {
+  // Directories and containers can be moved too
+  internal::FileInfoCacheInvalidator invalidate_src(impl_->file_info_cache().get(), src,
+                                                    /*tree=*/true);
+  internal::FileInfoCacheInvalidator invalidate_dest(impl_->file_info_cache().get(), dest,
+                                                     /*tree=*/true);
   ARROW_ASSIGN_OR_RAISE(auto src_location, AzureLocation::FromString(src));
   ARROW_ASSIGN_OR_RAISE(auto dest_location, AzureLocation::FromString(dest));
   if (src_location.container.empty()) {
@@ -3418,6 +3514,7 @@ Status AzureFileSystem::Move(const std::string& src, const std::string& dest) {
 }
 
 Status AzureFileSystem::CopyFile(const std::string& src, const std::string& dest) {
+  internal::FileInfoCacheInvalidator invalidate(impl_->file_info_cache().get(), dest);
   ARROW_ASSIGN_OR_RAISE(auto src_location, AzureLocation::FromString(src));
   ARROW_ASSIGN_OR_RAISE(auto dest_location, AzureLocation::FromString(dest));
   return impl_->CopyFile(src_location, dest_location);
@@ -3448,13 +3545,25 @@ Result<std::shared_ptr<io::RandomAccessFile>> AzureFileSystem::OpenInputFile(
 Result<std::shared_ptr<io::OutputStream>> AzureFileSystem::OpenOutputStream(
     const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
   ARROW_ASSIGN_OR_RAISE(auto location, AzureLocation::FromString(path));
-  return impl_->OpenAppendStream(location, metadata, true, this);
+  ARROW_ASSIGN_OR_RAISE(auto stream,
+                        impl_->OpenAppendStream(location, metadata, true, this));
+  if (const auto& cache = impl_->file_info_cache()) {
+    cache->Invalidate(path);
+    return internal::FileInfoCache::InvalidateOnClose(cache, path, std::move(stream));
+  }
+  return stream;
 }
 
 Result<std::shared_ptr<io::OutputStream>> AzureFileSystem::OpenAppendStream(
     const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
   ARROW_ASSIGN_OR_RAISE(auto location, AzureLocation::FromString(path));
-  return impl_->OpenAppendStream(location, metadata, false, this);
+  ARROW_ASSIGN_OR_RAISE(auto stream,
+                        impl_->OpenAppendStream(location, metadata, false, this));
+  if (const auto& cache = impl_->file_info_cache()) {
+    cache->Invalidate(path);
+    return internal::FileInfoCache::InvalidateOnClose(cache, path, std::move(stream));
+  }
+  return stream;
 }
 
 Result<std::string> AzureFileSystem::PathFromUri(const std::string& uri_string) const {
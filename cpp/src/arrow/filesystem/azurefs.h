@@ -111,6 +111,26 @@ struct ARROW_EXPORT AzureOptions {
   /// Whether OutputStream writes will be issued in the background, without blocking.
   bool background_writes = true;
 
+  /// \brief Size of the ranged downloads a large read is split into.
+  ///
+  /// If positive, a `ReadAt` or `ReadAsync` call larger than this size is served by
+  /// several concurrent downloads of this size, issued on the IOContext executor and
+  /// written directly into the destination buffer.  This can raise the throughput
+  /// of large reads, such as the coalesced ranges of a Parquet scan, when the
+  /// bandwidth of a single connection is the bottleneck.  If zero (the default),
+  /// each read is a single download.
+  int64_t parallel_read_part_size = 0;
+
+  /// \brief Whether and how slow downloads are reissued.
+  ///
+  /// See ReadHedgingOptions.  Disabled by default.
+  ReadHedgingOptions read_hedging;
+
+  /// \brief Whether and how the FileInfo of blobs and listings is cached.
+  ///
+  /// See FileInfoCacheOptions.  Disabled by default.
+  FileInfoCacheOptions file_info_cache;
+
  private:
   enum class CredentialKind {
     kDefault,
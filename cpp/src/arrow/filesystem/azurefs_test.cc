@@ -21,6 +21,7 @@
 #include <memory>
 #include <random>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <gmock/gmock-matchers.h>
@@ -649,6 +650,21 @@ class TestAzureOptions : public ::testing::Test {
     ASSERT_EQ(options.background_writes, false);
   }
 
+  void TestFromUriParallelReadPartSize() {
+    std::string path;
+    ASSERT_OK_AND_ASSIGN(
+        auto options,
+        AzureOptions::FromUri("abfs://account@127.0.0.1:10000/container/dir/blob?"
+                              "parallel_read_part_size=1048576",
+                              &path));
+    ASSERT_EQ(options.parallel_read_part_size, 1048576);
+    ASSERT_FALSE(options.Equals(AzureOptions()));
+    ASSERT_RAISES(Invalid,
+                  AzureOptions::FromUri("abfs://account@127.0.0.1:10000/container?"
+                                        "parallel_read_part_size=-1",
+                                        &path));
+  }
+
   void TestFromUriCredentialDefault() {
     ASSERT_OK_AND_ASSIGN(
         auto options,
@@ -816,6 +832,9 @@ TEST_F(TestAzureOptions, FromUriEnableTls) { TestFromUriEnableTls(); }
 TEST_F(TestAzureOptions, FromUriDisableBackgroundWrites) {
   TestFromUriDisableBackgroundWrites();
 }
+TEST_F(TestAzureOptions, FromUriParallelReadPartSize) {
+  TestFromUriParallelReadPartSize();
+}
 TEST_F(TestAzureOptions, FromUriCredentialDefault) { TestFromUriCredentialDefault(); }
 TEST_F(TestAzureOptions, FromUriCredentialAnonymous) { TestFromUriCredentialAnonymous(); }
 TEST_F(TestAzureOptions, FromUriCredentialClientSecret) {
@@ -3138,6 +3157,45 @@ TEST_F(TestAzuriteFileSystem, OpenInputFileMixedReadVsReadAt) {
   }
 }
 
+TEST_F(TestAzuriteFileSystem, OpenInputFileParallelRead) {
+  auto data = SetUpPreexistingData();
+  auto constexpr kLineWidth = 100;
+  auto constexpr kLineCount = 256;
+  std::vector<std::string> lines(kLineCount);
+  int lineno = 0;
+  std::generate_n(lines.begin(), lines.size(), [&] {
+    return PreexistingData::RandomLine(++lineno, kLineWidth, rng_);
+  });
+  std::string contents;
+  for (const auto& line : lines) {
+    contents += line;
+  }
+  const auto path = data.ContainerPath("OpenInputFileParallelRead/object-name");
+  UploadLines(lines, path, kLineCount * kLineWidth);
+
+  auto options = options_;
+  options.parallel_read_part_size = 1000;
+  ASSERT_OK_AND_ASSIGN(auto fs, AzureFileSystem::Make(options));
+  ASSERT_OK_AND_ASSIGN(auto file, fs->OpenInputFile(path));
+  // Reads spanning several parts, ending at a part boundary, past the end of the
+  // file and within a single part
+  for (auto [position, nbytes] : std::vector<std::pair<int64_t, int64_t>>{
+           {0, 25600}, {150, 3850}, {20000, 10000}, {10, 500}}) {
+    SCOPED_TRACE("ReadAt(" + std::to_string(position) + ", " + std::to_string(nbytes) +
+                 ")");
+    const auto expected = contents.substr(position, nbytes);
+    ASSERT_OK_AND_ASSIGN(auto buffer, file->ReadAt(position, nbytes));
+    EXPECT_EQ(expected, buffer->ToString());
+    std::vector<char> out(nbytes);
+    ASSERT_OK_AND_ASSIGN(auto size, file->ReadAt(position, nbytes, out.data()));
+    EXPECT_EQ(expected, std::string(out.data(), size));
+    ASSERT_OK_AND_ASSIGN(buffer, file->ReadAsync(io::default_io_context(), position,
+                                                 nbytes)
+                                     .result());
+    EXPECT_EQ(expected, buffer->ToString());
+  }
+}
+
 TEST_F(TestAzuriteFileSystem, OpenInputFileRandomSeek) {
   auto data = SetUpPreexistingData();
   // Create a file large enough to make the random access tests non-trivial.
@@ -0,0 +1,579 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/filesystem/block_cache.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/io/concurrency.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/key_value_metadata.h"
+#include "arrow/util/logging_internal.h"
+#include "arrow/util/string.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace fs {
+
+bool BlockCacheOptions::Equals(const BlockCacheOptions& other) const {
+  return cache_dir == other.cache_dir && block_size == other.block_size &&
+         capacity == other.capacity;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// BlockCache implementation
+
+// The blocks stored in the cache directory, indexed by file name and evicted
+// in LRU order.
+class BlockCacheFileSystem::BlockCache {
+ public:
+  static constexpr const char* kBlockExtension = "block";
+  static constexpr const char* kTempExtension = "tmp";
+
+  explicit BlockCache(BlockCacheOptions options)
+      : options_(std::move(options)), local_fs_(std::make_shared<LocalFileSystem>()) {}
+
+  const BlockCacheOptions& options() const { return options_; }
+
+  Status Init() {
+    RETURN_NOT_OK(local_fs_->CreateDir(options_.cache_dir));
+    FileSelector selector;
+    selector.base_dir = options_.cache_dir;
+    ARROW_ASSIGN_OR_RAISE(auto infos, local_fs_->GetFileInfo(selector));
+    // Blocks left by a previous run are reused, the oldest ones being evicted first
+    std::sort(infos.begin(), infos.end(),
+              [](const FileInfo& left, const FileInfo& right) {
+                return left.mtime() < right.mtime();
+              });
+    std::vector<std::string> evicted;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto& info : infos) {
+        if (!info.IsFile()) {
+          continue;
+        }
+        if (info.extension() == kBlockExtension) {
+          lru_.push_front(info.base_name());
+          entries_[info.base_name()] = {info.size(), lru_.begin()};
+          cached_bytes_ += info.size();
+        } else if (info.extension() == kTempExtension) {
+          // Interrupted write
+          evicted.push_back(info.base_name());
+        }
+      }
+      EvictLocked(&evicted, /*count_evictions=*/false);
+    }
+    DeleteBlocks(evicted);
+    return Status::OK();
+  }
+
+  // Return the given block, or null if it is not cached
+  std::shared_ptr<Buffer> Get(const std::string& name, int64_t size) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = entries_.find(name);
+      if (it == entries_.end()) {
+        return nullptr;
+      }
+      lru_.splice(lru_.begin(), lru_, it->second.lru_it);
+    }
+    auto maybe_block = ReadBlock(name);
+    if (!maybe_block.ok() || (*maybe_block)->size() != size) {
+      // Truncated by an interrupted write, or evicted concurrently
+      Remove(name);
+      return nullptr;
+    }
+    hits_.fetch_add(1);
+    bytes_read_from_cache_.fetch_add(size);
+    return maybe_block.MoveValueUnsafe();
+  }
+
+  // Store the given block, unless it is already cached or being cached
+  void Put(const std::string& name, const Buffer& block) {
+    if (block.size() > options_.capacity) {
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (entries_.count(name) > 0 || !writing_.insert(name).second) {
+        return;
+      }
+    }
+    Status st = WriteBlock(name, block);
+    std::vector<std::string> evicted;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      writing_.erase(name);
+      if (st.ok()) {
+        lru_.push_front(name);
+        entries_[name] = {block.size(), lru_.begin()};
+        cached_bytes_ += block.size();
+        EvictLocked(&evicted);
+      }
+    }
+    if (!st.ok()) {
+      ARROW_LOG(WARNING) << "Failed to cache block in '" << options_.cache_dir
+                         << "': " << st.ToString();
+    }
+    DeleteBlocks(evicted);
+  }
+
+  void RecordMisses(int64_t num_blocks, int64_t nbytes) {
+    misses_.fetch_add(num_blocks);
+    bytes_read_from_base_.fetch_add(nbytes);
+  }
+
+  BlockCacheStats stats() const {
+    BlockCacheStats stats;
+    stats.hits = hits_.load();
+    stats.misses = misses_.load();
+    stats.bytes_read_from_cache = bytes_read_from_cache_.load();
+    stats.bytes_read_from_base = bytes_read_from_base_.load();
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats.evictions = evictions_;
+    stats.cached_bytes = cached_bytes_;
+    return stats;
+  }
+
+ private:
+  struct Entry {
+    int64_t size;
+    std::list<std::string>::iterator lru_it;
+  };
+
+  std::string BlockPath(const std::string& name) const {
+    return internal::ConcatAbstractPath(options_.cache_dir, name);
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadBlock(const std::string& name) {
+    ARROW_ASSIGN_OR_RAISE(auto file, local_fs_->OpenInputFile(BlockPath(name)));
+    ARROW_ASSIGN_OR_RAISE(int64_t size, file->GetSize());
+    ARROW_ASSIGN_OR_RAISE(auto block, file->ReadAt(0, size));
+    RETURN_NOT_OK(file->Close());
+    return block;
+  }
+
+  Status WriteBlock(const std::string& name, const Buffer& block) {
+    // Write to a temporary file first so that a block is never read partially written
+    const std::string path = BlockPath(name);
+    const std::string temp_path = path + "." + kTempExtension;
+    ARROW_ASSIGN_OR_RAISE(auto stream, local_fs_->OpenOutputStream(temp_path));
+    RETURN_NOT_OK(stream->Write(block.data(), block.size()));
+    RETURN_NOT_OK(stream->Close());
+    return local_fs_->Move(temp_path, path);
+  }
+
+  void Remove(const std::string& name) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = entries_.find(name);
+      if (it == entries_.end()) {
+        return;
+      }
+      cached_bytes_ -= it->second.size;
+      lru_.erase(it->second.lru_it);
+      entries_.erase(it);
+    }
+    DeleteBlocks({name});
+  }
+
+  // Evict the least recently used blocks until the capacity is honored, appending
+  // their names to `evicted` so that they are deleted without holding the lock
+  void EvictLocked(std::vector<std::string>* evicted, bool count_evictions = true) {
+    while (cached_bytes_ > options_.capacity && !lru_.empty()) {
+      auto it = entries_.find(lru_.back());
+      cached_bytes_ -= it->second.size;
+      if (count_evictions) {
+        ++evictions_;
+      }
+      evicted->push_back(std::move(lru_.back()));
+      entries_.erase(it);
+      lru_.pop_back();
+    }
+  }
+
+  void DeleteBlocks(const std::vector<std::string>& names) {
+    for (const auto& name : names) {
+      // Errors are ignored, the block is not indexed anymore
+      ARROW_UNUSED(local_fs_->DeleteFile(BlockPath(name)));
+    }
+  }
+
+  const BlockCacheOptions options_;
+  const std::shared_ptr<LocalFileSystem> local_fs_;
+
+  mutable std::mutex mutex_;
+  // Most recently used first
+  std::list<std::string> lru_;
+  std::unordered_map<std::string, Entry> entries_;
+  std::unordered_set<std::string> writing_;
+  int64_t cached_bytes_ = 0;
+  int64_t evictions_ = 0;
+
+  std::atomic<int64_t> hits_{0};
+  std::atomic<int64_t> misses_{0};
+  std::atomic<int64_t> bytes_read_from_cache_{0};
+  std::atomic<int64_t> bytes_read_from_base_{0};
+};
+
+namespace {
+
+// Identify a version of a file of a given filesystem. The hash is used in block file
+// names, so that blocks of modified files are never read again.
+std::string MakeBlockPrefix(const std::string& fs_type, const std::string& path,
+                            const std::string& version, int64_t block_size) {
+  std::string key = fs_type;
+  for (const auto& part : {path, version, std::to_string(block_size)}) {
+    key.push_back('\0');
+    key += part;
+  }
+  const uint64_t hashes[2] = {
+      ::arrow::internal::ComputeStringHash<0>(key.data(),
+                                              static_cast<int64_t>(key.size())),
+      ::arrow::internal::ComputeStringHash<1>(key.data(),
+                                              static_cast<int64_t>(key.size()))};
+  return HexEncode(reinterpret_cast<const uint8_t*>(hashes), sizeof(hashes));
+}
+
+}  // namespace
+
+// A file of the base filesystem read by blocks through the cache
+class BlockCacheFileSystem::CachedFile
+    : public io::internal::RandomAccessFileConcurrencyWrapper<CachedFile> {
+ public:
+  CachedFile(std::shared_ptr<io::RandomAccessFile> base_file,
+             std::shared_ptr<BlockCache> cache, std::string block_prefix, int64_t size,
+             MemoryPool* pool)
+      : base_file_(std::move(base_file)),
+        cache_(std::move(cache)),
+        block_prefix_(std::move(block_prefix)),
+        size_(size),
+        pool_(pool) {}
+
+  bool closed() const override { return base_file_->closed(); }
+
+  Result<std::shared_ptr<const KeyValueMetadata>> ReadMetadata() override {
+    return base_file_->ReadMetadata();
+  }
+
+ protected:
+  friend RandomAccessFileConcurrencyWrapper<CachedFile>;
+
+  Status DoClose() { return base_file_->Close(); }
+
+  Result<int64_t> DoTell() const {
+    RETURN_NOT_OK(CheckClosed());
+    return position_;
+  }
+
+  Status DoSeek(int64_t position) {
+    RETURN_NOT_OK(CheckClosed());
+    if (position < 0) {
+      return Status::Invalid("Cannot seek to negative position");
+    }
+    position_ = position;
+    return Status::OK();
+  }
+
+  Result<int64_t> DoGetSize() {
+    RETURN_NOT_OK(CheckClosed());
+    return size_;
+  }
+
+  Result<std::shared_ptr<Buffer>> DoRead(int64_t nbytes) {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, DoReadAt(position_, nbytes));
+    position_ += buffer->size();
+    return buffer;
+  }
+
+  Result<int64_t> DoRead(int64_t nbytes, void* out) {
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, DoReadAt(position_, nbytes, out));
+    position_ += bytes_read;
+    return bytes_read;
+  }
+
+  Result<int64_t> DoReadAt(int64_t position, int64_t nbytes, void* out) {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, DoReadAt(position, nbytes));
+    if (buffer->size() > 0) {
+      std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+    }
+    return buffer->size();
+  }
+
+  Result<std::shared_ptr<Buffer>> DoReadAt(int64_t position, int64_t nbytes) {
+    RETURN_NOT_OK(CheckClosed());
+    ARROW_ASSIGN_OR_RAISE(nbytes,
+                          io::internal::ValidateReadRange(position, nbytes, size_));
+    if (nbytes == 0) {
+      return std::make_shared<Buffer>(nullptr, 0);
+    }
+    const int64_t block_size = cache_->options().block_size;
+    const int64_t first_block = position / block_size;
+    const int64_t num_blocks = (position + nbytes - 1) / block_size - first_block + 1;
+
+    std::vector<std::shared_ptr<Buffer>> blocks(static_cast<size_t>(num_blocks));
+    for (int64_t i = 0; i < num_blocks; ++i) {
+      blocks[i] = cache_->Get(BlockName(first_block + i), BlockLength(first_block + i));
+    }
+    // Read the missing blocks from the base file, a single request for each run of
+    // consecutive missing blocks
+    for (int64_t i = 0; i < num_blocks;) {
+      if (blocks[i] != nullptr) {
+        ++i;
+        continue;
+      }
+      int64_t end = i + 1;
+      while (end < num_blocks && blocks[end] == nullptr) {
+        ++end;
+      }
+      const int64_t offset = (first_block + i) * block_size;
+      const int64_t length = std::min((end - i) * block_size, size_ - offset);
+      ARROW_ASSIGN_OR_RAISE(auto data, base_file_->ReadAt(offset, length));
+      if (data->size() != length) {
+        return Status::IOError("File was truncated while reading: expected ", length,
+                               " bytes at offset ", offset, ", got ", data->size());
+      }
+      cache_->RecordMisses(end - i, length);
+      for (int64_t j = i; j < end; ++j) {
+        blocks[j] = SliceBuffer(data, (j - i) * block_size, BlockLength(first_block + j));
+        cache_->Put(BlockName(first_block + j), *blocks[j]);
+      }
+      i = end;
+    }
+
+    const int64_t offset_in_first_block = position - first_block * block_size;
+    if (num_blocks == 1) {
+      return SliceBuffer(std::move(blocks[0]), offset_in_first_block, nbytes);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto out, AllocateBuffer(nbytes, pool_));
+    int64_t copied = 0;
+    for (int64_t i = 0; i < num_blocks; ++i) {
+      const int64_t start = i == 0 ? offset_in_first_block : 0;
+      const int64_t length = std::min(blocks[i]->size() - start, nbytes - copied);
+      std::memcpy(out->mutable_data() + copied, blocks[i]->data() + start,
+                  static_cast<size_t>(length));
+      copied += length;
+    }
+    return std::shared_ptr<Buffer>(std::move(out));
+  }
+
+ private:
+  Status CheckClosed() const {
+    if (closed()) {
+      return Status::Invalid("Operation on closed file");
+    }
+    return Status::OK();
+  }
+
+  std::string BlockName(int64_t block_index) const {
+    return block_prefix_ + "-" + std::to_string(block_index) + "." +
+           BlockCache::kBlockExtension;
+  }
+
+  int64_t BlockLength(int64_t block_index) const {
+    const int64_t block_size = cache_->options().block_size;
+    return std::min(block_size, size_ - block_index * block_size);
+  }
+
+  const std::shared_ptr<io::RandomAccessFile> base_file_;
+  const std::shared_ptr<BlockCache> cache_;
+  const std::string block_prefix_;
+  const int64_t size_;
+  MemoryPool* pool_;
+  int64_t position_ = 0;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// BlockCacheFileSystem implementation
+
+BlockCacheFileSystem::BlockCacheFileSystem(std::shared_ptr<FileSystem> base_fs,
+                                           std::shared_ptr<BlockCache> cache)
+    : FileSystem(base_fs->io_context()),
+      base_fs_(std::move(base_fs)),
+      cache_(std::move(cache)) {}
+
+BlockCacheFileSystem::~BlockCacheFileSystem() = default;
+
+Result<std::shared_ptr<BlockCacheFileSystem>> BlockCacheFileSystem::Make(
+    std::shared_ptr<FileSystem> base_fs, const BlockCacheOptions& options) {
+  if (options.cache_dir.empty()) {
+    return Status::Invalid("BlockCacheOptions::cache_dir must be set");
+  }
+  if (options.block_size <= 0) {
+    return Status::Invalid("BlockCacheOptions::block_size must be positive");
+  }
+  if (options.capacity < 0) {
+    return Status::Invalid("BlockCacheOptions::capacity must not be negative");
+  }
+  auto cache = std::make_shared<BlockCache>(options);
+  RETURN_NOT_OK(cache->Init());
+  return std::shared_ptr<BlockCacheFileSystem>(
+      new BlockCacheFileSystem(std::move(base_fs), std::move(cache)));
+}
+
+const BlockCacheOptions& BlockCacheFileSystem::options() const {
+  return cache_->options();
+}
+
+BlockCacheStats BlockCacheFileSystem::stats() const { return cache_->stats(); }
+
+bool BlockCacheFileSystem::Equals(const FileSystem& other) const {
+  if (this == &other) {
+    return true;
+  }
+  if (other.type_name() != type_name()) {
+    return false;
+  }
+  const auto& fs = checked_cast<const BlockCacheFileSystem&>(other);
+  return base_fs_->Equals(fs.base_fs_) && options().Equals(fs.options());
+}
+
+Result<std::string> BlockCacheFileSystem::NormalizePath(std::string path) {
+  return base_fs_->NormalizePath(std::move(path));
+}
+
+Result<std::string> BlockCacheFileSystem::PathFromUri(
+    const std::string& uri_string) const {
+  return base_fs_->PathFromUri(uri_string);
+}
+
+Result<FileInfo> BlockCacheFileSystem::GetFileInfo(const std::string& path) {
+  return base_fs_->GetFileInfo(path);
+}
+
+Result<FileInfoVector> BlockCacheFileSystem::GetFileInfo(const FileSelector& select) {
+  return base_fs_->GetFileInfo(select);
+}
+
+FileInfoGenerator BlockCacheFileSystem::GetFileInfoGenerator(
+    const FileSelector& select) {
+  return base_fs_->GetFileInfoGenerator(select);
+}
+
+Status BlockCacheFileSystem::CreateDir(const std::string& path, bool recursive) {
+  return base_fs_->CreateDir(path, recursive);
+}
+
+Status BlockCacheFileSystem::DeleteDir(const std::string& path) {
+  return base_fs_->DeleteDir(path);
+}
+
+Status BlockCacheFileSystem::DeleteDirContents(const std::string& path,
+                                               bool missing_dir_ok) {
+  return base_fs_->DeleteDirContents(path, missing_dir_ok);
+}
+
+Status BlockCacheFileSystem::DeleteRootDirContents() {
+  return base_fs_->DeleteRootDirContents();
+}
+
+Status BlockCacheFileSystem::DeleteFile(const std::string& path) {
+  return base_fs_->DeleteFile(path);
+}
+
+Status BlockCacheFileSystem::Move(const std::string& src, const std::string& dest) {
+  return base_fs_->Move(src, dest);
+}
+
+Status BlockCacheFileSystem::CopyFile(const std::string& src, const std::string& dest) {
+  return base_fs_->CopyFile(src, dest);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> BlockCacheFileSystem::WrapFile(
+    std::shared_ptr<io::RandomAccessFile> file, const FileInfo& info) {
+  ARROW_ASSIGN_OR_RAISE(int64_t size, file->GetSize());
+  std::string version;
+  auto maybe_metadata = file->ReadMetadata();
+  if (maybe_metadata.ok() && *maybe_metadata != nullptr) {
+    auto maybe_etag = (*maybe_metadata)->Get("ETag");
+    if (maybe_etag.ok() && !maybe_etag->empty()) {
+      version = "etag:" + *maybe_etag;
+    }
+  }
+  if (version.empty()) {
+    TimePoint mtime = info.mtime();
+    if (mtime == kNoTime) {
+      ARROW_ASSIGN_OR_RAISE(auto base_info, base_fs_->GetFileInfo(info.path()));
+      mtime = base_info.mtime();
+    }
+    if (mtime == kNoTime) {
+      // Changes to the file couldn't be detected
+      return file;
+    }
+    version = "mtime:" + std::to_string(mtime.time_since_epoch().count());
+  }
+  version += ":size:" + std::to_string(size);
+  auto block_prefix =
+      MakeBlockPrefix(base_fs_->type_name(), info.path(), version, options().block_size);
+  return std::make_shared<CachedFile>(std::move(file), cache_, std::move(block_prefix),
+                                      size, io_context().pool());
+}
+
+Result<std::shared_ptr<io::InputStream>> BlockCacheFileSystem::OpenInputStream(
+    const std::string& path) {
+  return OpenInputStream(FileInfo(path));
+}
+
+Result<std::shared_ptr<io::InputStream>> BlockCacheFileSystem::OpenInputStream(
+    const FileInfo& info) {
+  ARROW_ASSIGN_OR_RAISE(auto file, OpenInputFile(info));
+  ARROW_ASSIGN_OR_RAISE(int64_t size, file->GetSize());
+  return io::RandomAccessFile::GetStream(std::move(file), 0, size);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> BlockCacheFileSystem::OpenInputFile(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto file, base_fs_->OpenInputFile(path));
+  return WrapFile(std::move(file), FileInfo(path));
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> BlockCacheFileSystem::OpenInputFile(
+    const FileInfo& info) {
+  ARROW_ASSIGN_OR_RAISE(auto file, base_fs_->OpenInputFile(info));
+  return WrapFile(std::move(file), info);
+}
+
+Result<std::shared_ptr<io::OutputStream>> BlockCacheFileSystem::OpenOutputStream(
+    const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  return base_fs_->OpenOutputStream(path, metadata);
+}
+
+Result<std::shared_ptr<io::OutputStream>> BlockCacheFileSystem::OpenAppendStream(
+    const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  return base_fs_->OpenAppendStream(path, metadata);
+}
+
+}  // namespace fs
+}  // namespace arrow
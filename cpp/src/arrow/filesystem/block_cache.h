@@ -0,0 +1,161 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "arrow/filesystem/filesystem.h"
+
+namespace arrow {
+namespace fs {
+
+/// Options for the BlockCacheFileSystem
+struct ARROW_EXPORT BlockCacheOptions {
+  static constexpr int64_t kDefaultBlockSize = int64_t{1} << 20;
+  static constexpr int64_t kDefaultCapacity = int64_t{1} << 30;
+
+  /// \brief The local directory the cached blocks are stored in
+  ///
+  /// It is created if it doesn't exist. Blocks left there by a previous
+  /// BlockCacheFileSystem with the same block size are reused.
+  std::string cache_dir;
+  /// The size of the blocks files are cached by
+  int64_t block_size = kDefaultBlockSize;
+  /// \brief The maximum total size of the cached blocks
+  ///
+  /// The least recently used blocks are evicted beyond it.
+  int64_t capacity = kDefaultCapacity;
+
+  bool Equals(const BlockCacheOptions& other) const;
+};
+
+/// Statistics of a BlockCacheFileSystem
+struct ARROW_EXPORT BlockCacheStats {
+  /// The number of blocks read from the cache
+  int64_t hits = 0;
+  /// The number of blocks read from the base filesystem
+  int64_t misses = 0;
+  /// The number of bytes read from the cache
+  int64_t bytes_read_from_cache = 0;
+  /// The number of bytes read from the base filesystem
+  int64_t bytes_read_from_base = 0;
+  /// The number of blocks evicted from the cache
+  int64_t evictions = 0;
+  /// The total size of the blocks currently cached
+  int64_t cached_bytes = 0;
+
+  /// The fraction of the blocks read from the cache
+  double hit_rate() const {
+    return hits + misses == 0 ? 0.0 : static_cast<double>(hits) / (hits + misses);
+  }
+};
+
+/// \brief A FileSystem implementation that caches the contents of files of
+/// another implementation in a local directory.
+///
+/// This is meant to avoid reading the same data repeatedly from remote
+/// filesystems (such as S3, GCS or Azure Blob Storage), e.g. the footers and
+/// hot column chunks of Parquet files. The files opened through
+/// OpenInputFile() and OpenInputStream() are read by fixed-size blocks, each
+/// of them stored in a file of the cache directory when read from the base
+/// filesystem.
+///
+/// The cached blocks of a file are tied to its version: its ETag if the base
+/// filesystem exposes one in the file metadata, otherwise its modification
+/// time and size. Files whose version is unknown are not cached. If a file
+/// is modified, the blocks of the previous version are not used anymore and
+/// eventually get evicted.
+///
+/// All other operations are forwarded to the base filesystem.
+class ARROW_EXPORT BlockCacheFileSystem : public FileSystem {
+ public:
+  ~BlockCacheFileSystem() override;
+
+  /// Create a BlockCacheFileSystem caching the files of `base_fs`
+  static Result<std::shared_ptr<BlockCacheFileSystem>> Make(
+      std::shared_ptr<FileSystem> base_fs, const BlockCacheOptions& options);
+
+  std::string type_name() const override { return "blockcache"; }
+  std::shared_ptr<FileSystem> base_fs() const { return base_fs_; }
+  const BlockCacheOptions& options() const;
+
+  /// Return the statistics gathered since this filesystem was created
+  BlockCacheStats stats() const;
+
+  bool Equals(const FileSystem& other) const override;
+  Result<std::string> NormalizePath(std::string path) override;
+  Result<std::string> PathFromUri(const std::string& uri_string) const override;
+
+  /// \cond FALSE
+  using FileSystem::CreateDir;
+  using FileSystem::DeleteDirContents;
+  using FileSystem::GetFileInfo;
+  using FileSystem::OpenAppendStream;
+  using FileSystem::OpenOutputStream;
+  /// \endcond
+
+  Result<FileInfo> GetFileInfo(const std::string& path) override;
+  Result<FileInfoVector> GetFileInfo(const FileSelector& select) override;
+
+  FileInfoGenerator GetFileInfoGenerator(const FileSelector& select) override;
+
+  Status CreateDir(const std::string& path, bool recursive) override;
+
+  Status DeleteDir(const std::string& path) override;
+  Status DeleteDirContents(const std::string& path, bool missing_dir_ok) override;
+  Status DeleteRootDirContents() override;
+
+  Status DeleteFile(const std::string& path) override;
+
+  Status Move(const std::string& src, const std::string& dest) override;
+
+  Status CopyFile(const std::string& src, const std::string& dest) override;
+
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(const FileInfo& info) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const FileInfo& info) override;
+
+  Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
+      const std::string& path,
+      const std::shared_ptr<const KeyValueMetadata>& metadata) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenAppendStream(
+      const std::string& path,
+      const std::shared_ptr<const KeyValueMetadata>& metadata) override;
+
+ private:
+  class BlockCache;
+  class CachedFile;
+
+  BlockCacheFileSystem(std::shared_ptr<FileSystem> base_fs,
+                       std::shared_ptr<BlockCache> cache);
+
+  Result<std::shared_ptr<io::RandomAccessFile>> WrapFile(
+      std::shared_ptr<io::RandomAccessFile> file, const FileInfo& info);
+
+  std::shared_ptr<FileSystem> base_fs_;
+  std::shared_ptr<BlockCache> cache_;
+};
+
+}  // namespace fs
+}  // namespace arrow
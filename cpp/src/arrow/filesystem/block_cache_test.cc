@@ -0,0 +1,199 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/block_cache.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/filesystem/test_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/key_value_metadata.h"
+
+namespace arrow::fs {
+
+using ::arrow::internal::TemporaryDir;
+
+class TestBlockCacheFileSystem : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(temp_dir_, TemporaryDir::Make("block-cache-test-"));
+    base_fs_ = std::make_shared<internal::MockFileSystem>(
+        TimePoint(TimePoint::duration(42)));
+    options_.cache_dir = temp_dir_->path().ToString() + "cache";
+    options_.block_size = 10;
+    MakeFileSystem();
+  }
+
+  void MakeFileSystem() {
+    ASSERT_OK_AND_ASSIGN(fs_, BlockCacheFileSystem::Make(base_fs_, options_));
+  }
+
+  void WriteFile(const std::string& path, const std::string& data,
+                 const std::shared_ptr<const KeyValueMetadata>& metadata = nullptr) {
+    ASSERT_OK_AND_ASSIGN(auto stream, base_fs_->OpenOutputStream(path, metadata));
+    ASSERT_OK(stream->Write(data));
+    ASSERT_OK(stream->Close());
+  }
+
+  void AssertReadAt(const std::string& path, int64_t position, int64_t nbytes,
+                    const std::string& expected) {
+    ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile(path));
+    ASSERT_OK_AND_ASSIGN(auto buffer, file->ReadAt(position, nbytes));
+    AssertBufferEqual(*buffer, expected);
+    ASSERT_OK(file->Close());
+  }
+
+  void AssertStats(int64_t hits, int64_t misses) {
+    auto stats = fs_->stats();
+    ASSERT_EQ(stats.hits, hits);
+    ASSERT_EQ(stats.misses, misses);
+  }
+
+ protected:
+  std::unique_ptr<TemporaryDir> temp_dir_;
+  std::shared_ptr<FileSystem> base_fs_;
+  BlockCacheOptions options_;
+  std::shared_ptr<BlockCacheFileSystem> fs_;
+};
+
+TEST_F(TestBlockCacheFileSystem, Basics) {
+  ASSERT_EQ(fs_->type_name(), "blockcache");
+  ASSERT_TRUE(fs_->Equals(*fs_));
+  ASSERT_OK_AND_ASSIGN(auto other, BlockCacheFileSystem::Make(base_fs_, options_));
+  ASSERT_TRUE(fs_->Equals(*other));
+  options_.block_size = 20;
+  ASSERT_OK_AND_ASSIGN(other, BlockCacheFileSystem::Make(base_fs_, options_));
+  ASSERT_FALSE(fs_->Equals(*other));
+
+  options_.block_size = 0;
+  ASSERT_RAISES(Invalid, BlockCacheFileSystem::Make(base_fs_, options_));
+  options_.block_size = 10;
+  options_.cache_dir = "";
+  ASSERT_RAISES(Invalid, BlockCacheFileSystem::Make(base_fs_, options_));
+
+  // Other operations are forwarded to the base filesystem
+  ASSERT_OK(fs_->CreateDir("AB/CD"));
+  CreateFile(fs_.get(), "AB/CD/ghi", "some data");
+  AssertFileInfo(base_fs_.get(), "AB/CD/ghi", FileType::File, 9);
+  ASSERT_OK(fs_->Move("AB/CD/ghi", "AB/jkl"));
+  AssertFileInfo(fs_.get(), "AB/jkl", FileType::File, 9);
+  AssertFileInfo(base_fs_.get(), "AB/CD/ghi", FileType::NotFound);
+}
+
+TEST_F(TestBlockCacheFileSystem, ReadAt) {
+  WriteFile("abc", "0123456789abcdefghijKLMNO");
+
+  // The blocks covering the range are read from the base filesystem at once
+  AssertReadAt("abc", 5, 10, "56789abcde");
+  AssertStats(/*hits=*/0, /*misses=*/2);
+  ASSERT_EQ(fs_->stats().bytes_read_from_base, 20);
+  ASSERT_EQ(fs_->stats().cached_bytes, 20);
+
+  AssertReadAt("abc", 12, 3, "cde");
+  AssertStats(/*hits=*/1, /*misses=*/2);
+  AssertReadAt("abc", 0, 100, "0123456789abcdefghijKLMNO");
+  AssertStats(/*hits=*/3, /*misses=*/3);
+  ASSERT_EQ(fs_->stats().cached_bytes, 25);
+  ASSERT_EQ(fs_->stats().bytes_read_from_cache, 30);
+  ASSERT_DOUBLE_EQ(fs_->stats().hit_rate(), 0.5);
+
+  AssertReadAt("abc", 25, 10, "");
+  AssertStats(/*hits=*/3, /*misses=*/3);
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("abc"));
+  ASSERT_RAISES(IOError, file->ReadAt(26, 1));
+}
+
+TEST_F(TestBlockCacheFileSystem, InputStream) {
+  WriteFile("abc", "0123456789abcdefghijKLMNO");
+  ASSERT_OK_AND_ASSIGN(auto stream, fs_->OpenInputStream("abc"));
+  ASSERT_OK_AND_ASSIGN(auto buffer, stream->Read(15));
+  AssertBufferEqual(*buffer, "0123456789abcde");
+  ASSERT_OK_AND_ASSIGN(buffer, stream->Read(15));
+  AssertBufferEqual(*buffer, "fghijKLMNO");
+  ASSERT_OK(stream->Close());
+  AssertStats(/*hits=*/1, /*misses=*/3);
+}
+
+TEST_F(TestBlockCacheFileSystem, Invalidation) {
+  // Changes are detected through the ETag when the base filesystem reports one
+  WriteFile("abc", "0123456789", key_value_metadata({"ETag"}, {"1"}));
+  AssertReadAt("abc", 0, 10, "0123456789");
+  AssertReadAt("abc", 0, 10, "0123456789");
+  AssertStats(/*hits=*/1, /*misses=*/1);
+
+  WriteFile("abc", "9876543210", key_value_metadata({"ETag"}, {"2"}));
+  AssertReadAt("abc", 0, 10, "9876543210");
+  AssertStats(/*hits=*/1, /*misses=*/2);
+
+  // Otherwise through the modification time and size
+  WriteFile("def", "0123456789");
+  AssertReadAt("def", 0, 10, "0123456789");
+  WriteFile("def", "0123456789abc");
+  AssertReadAt("def", 0, 13, "0123456789abc");
+  AssertStats(/*hits=*/1, /*misses=*/5);
+}
+
+TEST_F(TestBlockCacheFileSystem, Eviction) {
+  options_.capacity = 25;
+  MakeFileSystem();
+  WriteFile("abc", "0123456789abcdefghijKLMNO");
+
+  AssertReadAt("abc", 0, 25, "0123456789abcdefghijKLMNO");
+  ASSERT_EQ(fs_->stats().evictions, 0);
+  AssertReadAt("abc", 0, 10, "0123456789");
+  AssertStats(/*hits=*/1, /*misses=*/3);
+
+  // The least recently used block is evicted
+  WriteFile("def", "ABCDEFGHIJ");
+  AssertReadAt("def", 0, 10, "ABCDEFGHIJ");
+  ASSERT_EQ(fs_->stats().evictions, 1);
+  ASSERT_LE(fs_->stats().cached_bytes, 25);
+  AssertReadAt("abc", 0, 10, "0123456789");
+  AssertStats(/*hits=*/2, /*misses=*/4);
+  AssertReadAt("abc", 10, 10, "abcdefghij");
+  AssertStats(/*hits=*/2, /*misses=*/5);
+
+  // Blocks larger than the capacity are not cached
+  options_.capacity = 5;
+  MakeFileSystem();
+  ASSERT_EQ(fs_->stats().cached_bytes, 0);
+  AssertReadAt("def", 0, 10, "ABCDEFGHIJ");
+  AssertReadAt("def", 0, 10, "ABCDEFGHIJ");
+  AssertStats(/*hits=*/0, /*misses=*/2);
+}
+
+TEST_F(TestBlockCacheFileSystem, Persistence) {
+  WriteFile("abc", "0123456789abcdefghijKLMNO");
+  AssertReadAt("abc", 0, 25, "0123456789abcdefghijKLMNO");
+  AssertStats(/*hits=*/0, /*misses=*/3);
+
+  // Blocks are reused by another filesystem instance using the same directory
+  MakeFileSystem();
+  ASSERT_EQ(fs_->stats().cached_bytes, 25);
+  AssertReadAt("abc", 0, 25, "0123456789abcdefghijKLMNO");
+  AssertStats(/*hits=*/3, /*misses=*/0);
+}
+
+}  // namespace arrow::fs
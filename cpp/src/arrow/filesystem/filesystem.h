@@ -144,6 +144,43 @@ struct ARROW_EXPORT FileLocator {
   std::string path;
 };
 
+/// \brief Options for reissuing slow read requests to an object store
+///
+/// Object store latencies have a long tail, and a scan waits for its slowest read.
+/// When enabled, a read request still running after the `latency_quantile` of the
+/// recent request latencies is issued a second time and the first response wins.
+struct ARROW_EXPORT ReadHedgingOptions {
+  /// Whether slow read requests are reissued
+  bool enabled = false;
+  /// The quantile of the recent request latencies after which a request is reissued
+  double latency_quantile = 0.95;
+  /// The maximum number of reissued requests, as a fraction of the read requests
+  double budget = 0.05;
+  /// The number of requests to time before reissuing any
+  int32_t min_samples = 32;
+
+  bool operator==(const ReadHedgingOptions& other) const = default;
+};
+
+/// \brief Options for caching the FileInfo of object store paths
+///
+/// Object stores answer GetFileInfo with a HEAD or list request, which dataset
+/// discovery and file opening issue repeatedly for the same paths.  When enabled,
+/// the results of GetFileInfo and of listings are cached by the filesystem instance
+/// for `ttl_seconds`.  Modifications made through the same instance invalidate the
+/// affected entries; modifications made by other clients are only seen after the
+/// entries expire.
+struct ARROW_EXPORT FileInfoCacheOptions {
+  /// Whether FileInfo is cached
+  bool enabled = false;
+  /// The maximum number of cached entries, the least recently used are evicted
+  int64_t capacity = 10000;
+  /// How long an entry is kept, in seconds
+  double ttl_seconds = 60;
+
+  bool operator==(const FileInfoCacheOptions& other) const = default;
+};
+
 using FileInfoVector = std::vector<FileInfo>;
 using FileInfoGenerator = std::function<Future<FileInfoVector>()>;
 
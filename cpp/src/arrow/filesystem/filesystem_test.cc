@@ -15,21 +15,32 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "arrow/buffer.h"
 #include "arrow/filesystem/filesystem.h"
 #include "arrow/filesystem/mockfs.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/test_util.h"
 #include "arrow/filesystem/util_internal.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/io/memory.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/key_value_metadata.h"
 
 namespace arrow {
@@ -383,6 +394,215 @@ TEST(InternalUtil, GlobFilesWithoutLeadingSlash) { TestGlobFiles(""); }
 
 TEST(InternalUtil, GlobFilesWithLeadingSlash) { TestGlobFiles("/"); }
 
+// Read parts from `contents`, as a store with a maximum response size would
+std::function<Result<int64_t>(int64_t, int64_t, uint8_t*)> MakePartReader(
+    const std::string& contents, std::atomic<int>* num_requests,
+    int64_t max_response_size = std::numeric_limits<int64_t>::max()) {
+  return [=](int64_t position, int64_t nbytes, uint8_t* out) -> Result<int64_t> {
+    num_requests->fetch_add(1);
+    if (position > static_cast<int64_t>(contents.size())) {
+      return Status::IOError("Invalid range");
+    }
+    const auto part = std::string_view(contents).substr(
+        position, std::min(nbytes, max_response_size));
+    std::memcpy(out, part.data(), part.size());
+    return static_cast<int64_t>(part.size());
+  };
+}
+
+TEST(InternalUtil, ReadRangeInParts) {
+  std::string contents(10000, 'x');
+  for (size_t i = 0; i < contents.size(); ++i) {
+    contents[i] = static_cast<char>('a' + i % 26);
+  }
+  for (int64_t nbytes : {1, 1000, 1001, 3999, 4000, 9900}) {
+    ARROW_SCOPED_TRACE("nbytes = ", nbytes);
+    const auto expected = contents.substr(100, nbytes);
+    std::atomic<int> num_requests{0};
+    std::string out(nbytes, '\0');
+    ASSERT_OK_AND_EQ(nbytes,
+                     ReadRangeInParts(io::default_io_context(), 100, nbytes, 1000,
+                                      reinterpret_cast<uint8_t*>(out.data()),
+                                      MakePartReader(contents, &num_requests)));
+    ASSERT_EQ(expected, out);
+    ASSERT_EQ(bit_util::CeilDiv(nbytes, 1000), num_requests.load());
+
+    num_requests = 0;
+    ASSERT_FINISHES_OK_AND_ASSIGN(
+        auto buffer,
+        ReadRangeInPartsAsync(io::default_io_context(), 100, nbytes, 1000,
+                              MakePartReader(contents, &num_requests)));
+    ASSERT_EQ(expected, buffer->ToString());
+    ASSERT_EQ(bit_util::CeilDiv(nbytes, 1000), num_requests.load());
+  }
+}
+
+TEST(InternalUtil, ReadRangeInPartsShortRead) {
+  std::string contents(10000, 'x');
+  std::atomic<int> num_requests{0};
+  // The bytes read stop at the first short part
+  std::string out(3000, '\0');
+  ASSERT_OK_AND_EQ(500, ReadRangeInParts(io::default_io_context(), 0, 3000, 1000,
+                                         reinterpret_cast<uint8_t*>(out.data()),
+                                         MakePartReader(contents, &num_requests, 500)));
+  ASSERT_FINISHES_OK_AND_ASSIGN(
+      auto buffer, ReadRangeInPartsAsync(io::default_io_context(), 0, 3000, 1000,
+                                         MakePartReader(contents, &num_requests, 500)));
+  ASSERT_EQ(500, buffer->size());
+
+  // Errors of any part are reported
+  ASSERT_RAISES(IOError, ReadRangeInParts(io::default_io_context(), 8000, 4000, 1000,
+                                          reinterpret_cast<uint8_t*>(out.data()),
+                                          MakePartReader(contents, &num_requests)));
+  ASSERT_FINISHES_AND_RAISES(
+      IOError, ReadRangeInPartsAsync(io::default_io_context(), 8000, 4000, 1000,
+                                     MakePartReader(contents, &num_requests)));
+}
+
+// A reader whose request number `slow_request` takes a long time.  The counter is
+// shared with the reader, since the losing requests outlive the reads.
+RequestHedger::ReadFunction MakeSlowReader(const std::string& contents,
+                                           std::shared_ptr<std::atomic<int>> num_requests,
+                                           int slow_request) {
+  return [=](int64_t position, int64_t nbytes, uint8_t* out) -> Result<int64_t> {
+    SleepFor(num_requests->fetch_add(1) == slow_request ? 1 : 0.01);
+    if (position > static_cast<int64_t>(contents.size())) {
+      return Status::IOError("Invalid range");
+    }
+    const auto part = std::string_view(contents).substr(position, nbytes);
+    std::memcpy(out, part.data(), part.size());
+    return static_cast<int64_t>(part.size());
+  };
+}
+
+TEST(InternalUtil, RequestHedger) {
+  const std::string contents = "some data to read";
+  ReadHedgingOptions options;
+  options.enabled = true;
+  options.budget = 1;
+  options.min_samples = 4;
+  auto hedger = std::make_shared<RequestHedger>(options);
+  auto num_requests = std::make_shared<std::atomic<int>>(0);
+  auto read = RequestHedger::Wrap(hedger, io::default_io_context(),
+                                  MakeSlowReader(contents, num_requests, 4));
+
+  std::string out(4, '\0');
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_EQ(-1, hedger->threshold_us());
+    ASSERT_OK_AND_EQ(4, read(5, 4, reinterpret_cast<uint8_t*>(out.data())));
+    ASSERT_EQ("data", out);
+  }
+  ASSERT_GE(hedger->threshold_us(), 0);
+  ASSERT_EQ(0, hedger->num_hedged());
+
+  // The fifth request is slow, the hedged one wins
+  const auto start = std::chrono::steady_clock::now();
+  ASSERT_OK_AND_EQ(4, read(0, 4, reinterpret_cast<uint8_t*>(out.data())));
+  ASSERT_EQ("some", out);
+  ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+  ASSERT_EQ(1, hedger->num_hedged());
+  ASSERT_EQ(6, num_requests->load());
+
+  // No more hedged requests than the budget allows
+  options.budget = 0;
+  hedger = std::make_shared<RequestHedger>(options);
+  num_requests->store(0);
+  read = RequestHedger::Wrap(hedger, io::default_io_context(),
+                             MakeSlowReader(contents, num_requests, 4));
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_OK_AND_EQ(4, read(13, 10, reinterpret_cast<uint8_t*>(out.data())));
+    ASSERT_EQ("read", out);
+  }
+  ASSERT_EQ(0, hedger->num_hedged());
+  ASSERT_EQ(5, num_requests->load());
+
+  // Errors are reported
+  ASSERT_RAISES(IOError, read(100, 4, reinterpret_cast<uint8_t*>(out.data())));
+}
+
+TEST(InternalUtil, FileInfoCache) {
+  ASSERT_EQ(nullptr, FileInfoCache::Make(FileInfoCacheOptions{}));
+  FileInfoCacheOptions options;
+  options.enabled = true;
+  options.capacity = 3;
+  auto cache = FileInfoCache::Make(options);
+  ASSERT_NE(nullptr, cache);
+
+  ASSERT_EQ(std::nullopt, cache->Get("bucket/a"));
+  cache->Put({File("bucket/a"), Dir("bucket/dir"), File("bucket/dir/b")});
+  ASSERT_EQ(3, cache->size());
+  auto info = cache->Get("bucket/a");
+  ASSERT_TRUE(info.has_value());
+  AssertFileInfo(*info, "bucket/a", FileType::File);
+  // Trailing slashes don't matter, the path is the one asked for
+  info = cache->Get("bucket/dir/");
+  ASSERT_TRUE(info.has_value());
+  AssertFileInfo(*info, "bucket/dir/", FileType::Directory);
+  ASSERT_EQ(2, cache->hits());
+  ASSERT_EQ(1, cache->misses());
+
+  // The least recently used entry is evicted
+  cache->Put(FileInfo("bucket/c", FileType::NotFound));
+  ASSERT_EQ(3, cache->size());
+  ASSERT_EQ(std::nullopt, cache->Get("bucket/dir/b"));
+  info = cache->Get("bucket/c");
+  ASSERT_TRUE(info.has_value());
+  AssertFileInfo(*info, "bucket/c", FileType::NotFound);
+
+  // Invalidating a path invalidates its ancestors
+  cache->Put({File("bucket/dir/b"), Dir("bucket")});
+  cache->Invalidate("bucket/dir/b");
+  ASSERT_EQ(std::nullopt, cache->Get("bucket/dir/b"));
+  ASSERT_EQ(std::nullopt, cache->Get("bucket/dir"));
+  ASSERT_EQ(std::nullopt, cache->Get("bucket"));
+
+  // Invalidating a tree invalidates its descendants
+  cache->Put({Dir("bucket/dir"), File("bucket/dir/b"), File("bucket/a")});
+  cache->InvalidateTree("bucket/dir/");
+  ASSERT_EQ(std::nullopt, cache->Get("bucket/dir"));
+  ASSERT_EQ(std::nullopt, cache->Get("bucket/dir/b"));
+  ASSERT_TRUE(cache->Get("bucket/a").has_value());
+
+  {
+    FileInfoCacheInvalidator invalidate(cache.get(), "bucket/a");
+    ASSERT_TRUE(cache->Get("bucket/a").has_value());
+  }
+  ASSERT_EQ(std::nullopt, cache->Get("bucket/a"));
+
+  cache->Put(File("bucket/a"));
+  cache->Clear();
+  ASSERT_EQ(0, cache->size());
+}
+
+TEST(InternalUtil, FileInfoCacheExpiry) {
+  FileInfoCacheOptions options;
+  options.enabled = true;
+  options.ttl_seconds = 0.05;
+  auto cache = FileInfoCache::Make(options);
+  cache->Put(File("bucket/a"));
+  ASSERT_TRUE(cache->Get("bucket/a").has_value());
+  SleepFor(0.1);
+  ASSERT_EQ(std::nullopt, cache->Get("bucket/a"));
+  ASSERT_EQ(0, cache->size());
+}
+
+TEST(InternalUtil, FileInfoCacheInvalidateOnClose) {
+  FileInfoCacheOptions options;
+  options.enabled = true;
+  auto cache = FileInfoCache::Make(options);
+  ASSERT_OK_AND_ASSIGN(auto buffer_stream, io::BufferOutputStream::Create());
+  auto stream = FileInfoCache::InvalidateOnClose(cache, "bucket/a", buffer_stream);
+  ASSERT_OK(stream->Write("data"));
+  ASSERT_OK_AND_EQ(4, stream->Tell());
+  cache->Put(File("bucket/a"));
+  ASSERT_OK(stream->Close());
+  ASSERT_TRUE(buffer_stream->closed());
+  ASSERT_EQ(std::nullopt, cache->Get("bucket/a"));
+
+  ASSERT_EQ(buffer_stream,
+            FileInfoCache::InvalidateOnClose(nullptr, "bucket/a", buffer_stream));
+}
+
 ////////////////////////////////////////////////////////////////////////////
 // Generic MockFileSystem tests
 
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <functional>
 
 #include <google/cloud/storage/client.h>
 
@@ -30,6 +31,7 @@
 #include "arrow/result.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/thread_pool.h"
+#include "arrow/util/value_parsing.h"
 
 #define ARROW_GCS_RETURN_NOT_OK(expr) \
   if (!expr.ok()) return internal::ToArrowStatus(expr)
@@ -243,8 +245,15 @@ using InputStreamFactory = std::function<Result<std::shared_ptr<GcsInputStream>>
 
 class GcsRandomAccessFile : public arrow::io::RandomAccessFile {
  public:
-  GcsRandomAccessFile(InputStreamFactory factory, gcs::ObjectMetadata metadata)
-      : factory_(std::move(factory)), metadata_(std::move(metadata)) {}
+  GcsRandomAccessFile(InputStreamFactory factory, gcs::ObjectMetadata metadata,
+                      const io::IOContext& io_context,
+                      int64_t parallel_read_part_size = 0,
+                      std::shared_ptr<internal::RequestHedger> read_hedger = nullptr)
+      : factory_(std::move(factory)),
+        metadata_(std::move(metadata)),
+        io_context_(io_context),
+        parallel_read_part_size_(parallel_read_part_size),
+        read_hedger_(std::move(read_hedger)) {}
   ~GcsRandomAccessFile() override = default;
 
   //@{
@@ -292,6 +301,15 @@ class GcsRandomAccessFile : public arrow::io::RandomAccessFile {
   Result<int64_t> GetSize() override { return metadata_.size(); }
   Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
     if (closed()) return Status::Invalid("Cannot read from closed file");
+    if (IsParallelRead(position, nbytes)) {
+      nbytes = std::min(nbytes, static_cast<int64_t>(metadata_.size()) - position);
+      return internal::ReadRangeInParts(io_context_, position, nbytes,
+                                        parallel_read_part_size_,
+                                        static_cast<uint8_t*>(out), MakeRangeReader());
+    }
+    if (read_hedger_) {
+      return MakeRangeReader()(position, nbytes, static_cast<uint8_t*>(out));
+    }
     std::shared_ptr<io::InputStream> stream;
     ARROW_ASSIGN_OR_RAISE(stream, factory_(gcs::Generation(metadata_.generation()),
                                            gcs::ReadRange(position, position + nbytes),
@@ -300,12 +318,34 @@ class GcsRandomAccessFile : public arrow::io::RandomAccessFile {
   }
   Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
     if (closed()) return Status::Invalid("Cannot read from closed file");
+    if (IsParallelRead(position, nbytes) || (read_hedger_ && position >= 0)) {
+      nbytes = std::max<int64_t>(
+          0, std::min(nbytes, static_cast<int64_t>(metadata_.size()) - position));
+      ARROW_ASSIGN_OR_RAISE(auto buffer,
+                            AllocateResizableBuffer(nbytes, io_context_.pool()));
+      ARROW_ASSIGN_OR_RAISE(auto bytes_read,
+                            ReadAt(position, nbytes, buffer->mutable_data()));
+      RETURN_NOT_OK(buffer->Resize(bytes_read));
+      return std::shared_ptr<Buffer>(std::move(buffer));
+    }
     std::shared_ptr<io::InputStream> stream;
     ARROW_ASSIGN_OR_RAISE(stream, factory_(gcs::Generation(metadata_.generation()),
                                            gcs::ReadRange(position, position + nbytes),
                                            gcs::ReadFromOffset()));
     return stream->Read(nbytes);
   }
+  Future<std::shared_ptr<Buffer>> ReadAsync(const io::IOContext& io_context,
+                                            int64_t position, int64_t nbytes) override {
+    if (closed()) return Status::Invalid("Cannot read from closed file");
+    if (IsParallelRead(position, nbytes)) {
+      // Read the parts as separate IO tasks rather than blocking an IO thread
+      // until all of them are done
+      nbytes = std::min(nbytes, static_cast<int64_t>(metadata_.size()) - position);
+      return internal::ReadRangeInPartsAsync(io_context, position, nbytes,
+                                             parallel_read_part_size_, MakeRangeReader());
+    }
+    return RandomAccessFile::ReadAsync(io_context, position, nbytes);
+  }
   //@}
 
   // from Seekable
@@ -325,8 +365,33 @@ class GcsRandomAccessFile : public arrow::io::RandomAccessFile {
     }
     return Status::OK();
   }
+
+  bool IsParallelRead(int64_t position, int64_t nbytes) const {
+    return parallel_read_part_size_ > 0 && position >= 0 &&
+           std::min(nbytes, static_cast<int64_t>(metadata_.size()) - position) >
+               parallel_read_part_size_;
+  }
+
+  // Read a range with its own ranged request, reissued when slow if hedging is
+  // enabled
+  internal::RequestHedger::ReadFunction MakeRangeReader() const {
+    return internal::RequestHedger::Wrap(
+        read_hedger_, io_context_,
+        [factory = factory_, generation = metadata_.generation()](
+            int64_t position, int64_t nbytes, uint8_t* out) -> Result<int64_t> {
+          ARROW_ASSIGN_OR_RAISE(auto stream,
+                                factory(gcs::Generation(generation),
+                                        gcs::ReadRange(position, position + nbytes),
+                                        gcs::ReadFromOffset()));
+          return stream->Read(nbytes, out);
+        });
+  }
+
   InputStreamFactory factory_;
   gcs::ObjectMetadata metadata_;
+  const io::IOContext io_context_;
+  const int64_t parallel_read_part_size_;
+  const std::shared_ptr<internal::RequestHedger> read_hedger_;
   std::shared_ptr<GcsInputStream> mutable stream_;
 };
 
@@ -335,10 +400,26 @@ class GcsRandomAccessFile : public arrow::io::RandomAccessFile {
 class GcsFileSystem::Impl {
  public:
   explicit Impl(GcsOptions o)
-      : options_(std::move(o)), client_(internal::AsGoogleCloudOptions(options_)) {}
+      : options_(std::move(o)),
+        client_(internal::AsGoogleCloudOptions(options_)),
+        file_info_cache_(internal::FileInfoCache::Make(options_.file_info_cache)) {
+    if (options_.read_hedging.enabled) {
+      read_hedger_ = std::make_shared<internal::RequestHedger>(options_.read_hedging);
+    }
+  }
 
   const GcsOptions& options() const { return options_; }
 
+  // Shared by all the input files, null unless read hedging is enabled
+  const std::shared_ptr<internal::RequestHedger>& read_hedger() const {
+    return read_hedger_;
+  }
+
+  // Null unless FileInfo caching is enabled
+  const std::shared_ptr<internal::FileInfoCache>& file_info_cache() const {
+    return file_info_cache_;
+  }
+
   Result<FileInfo> GetFileInfo(const GcsPath& path) {
     if (path.object.empty()) {
       auto meta = client_.GetBucketMetadata(path.bucket);
@@ -700,6 +781,8 @@ class GcsFileSystem::Impl {
 
   GcsOptions options_;
   gcs::Client client_;
+  std::shared_ptr<internal::RequestHedger> read_hedger_;
+  std::shared_ptr<internal::FileInfoCache> file_info_cache_;
 };
 
 GcsOptions::GcsOptions() {
@@ -713,7 +796,11 @@ bool GcsOptions::Equals(const GcsOptions& other) const {
          endpoint_override == other.endpoint_override && scheme == other.scheme &&
          default_bucket_location == other.default_bucket_location &&
          retry_limit_seconds == other.retry_limit_seconds &&
-         project_id == other.project_id;
+         project_id == other.project_id &&
+         parallel_read_part_size == other.parallel_read_part_size &&
+         read_hedging == other.read_hedging &&
+         file_info_cache == other.file_info_cache &&
+         connection_pool_size == other.connection_pool_size;
 }
 
 GcsOptions GcsOptions::Defaults() {
@@ -819,6 +906,25 @@ Result<GcsOptions> GcsOptions::FromUri(const arrow::util::Uri& uri,
       options.retry_limit_seconds = parsed_seconds;
     } else if (kv.first == "project_id") {
       options.project_id = kv.second;
+    } else if (kv.first == "parallel_read_part_size") {
+      int64_t part_size;
+      if (!::arrow::internal::ParseValue<Int64Type>(kv.second.data(), kv.second.size(),
+                                                    &part_size) ||
+          part_size < 0) {
+        return Status::Invalid(
+            "parallel_read_part_size must be a non-negative integer, got '", kv.second,
+            "'");
+      }
+      options.parallel_read_part_size = part_size;
+    } else if (kv.first == "connection_pool_size") {
+      int pool_size;
+      if (!::arrow::internal::ParseValue<Int32Type>(kv.second.data(), kv.second.size(),
+                                                    &pool_size) ||
+          pool_size <= 0) {
+        return Status::Invalid("connection_pool_size must be a positive integer, got '",
+                               kv.second, "'");
+      }
+      options.connection_pool_size = pool_size;
     } else {
       return Status::Invalid("Unexpected query parameter in GCS URI: '", kv.first, "'");
     }
@@ -855,26 +961,45 @@ Result<std::string> GcsFileSystem::PathFromUri(const std::string& uri_string) co
 }
 
 Result<FileInfo> GcsFileSystem::GetFileInfo(const std::string& path) {
+  const auto& cache = impl_->file_info_cache();
+  if (cache) {
+    if (auto info = cache->Get(path)) {
+      return *std::move(info);
+    }
+  }
   ARROW_ASSIGN_OR_RAISE(auto p, GcsPath::FromString(path));
-  return impl_->GetFileInfo(p);
+  ARROW_ASSIGN_OR_RAISE(auto info, impl_->GetFileInfo(p));
+  if (cache) {
+    cache->Put(info);
+  }
+  return info;
 }
 
 Result<FileInfoVector> GcsFileSystem::GetFileInfo(const FileSelector& select) {
-  return impl_->GetFileInfo(select);
+  ARROW_ASSIGN_OR_RAISE(auto infos, impl_->GetFileInfo(select));
+  if (const auto& cache = impl_->file_info_cache()) {
+    cache->Put(infos);
+  }
+  return infos;
 }
 
 Status GcsFileSystem::CreateDir(const std::string& path, bool recursive) {
+  internal::FileInfoCacheInvalidator invalidate(impl_->file_info_cache().get(), path);
   ARROW_ASSIGN_OR_RAISE(auto p, GcsPath::FromString(path));
   if (!recursive) return impl_->CreateDir(p);
   return impl_->CreateDirRecursive(p);
 }
 
 Status GcsFileSystem::DeleteDir(const std::string& path) {
+  internal::FileInfoCacheInvalidator invalidate(impl_->file_info_cache().get(), path,
+                                                /*tree=*/true);
   ARROW_ASSIGN_OR_RAISE(auto p, GcsPath::FromString(path));
   return impl_->DeleteDir(p, io_context());
 }
 
 Status GcsFileSystem::DeleteDirContents(const std::string& path, bool missing_dir_ok) {
+  internal::FileInfoCacheInvalidator invalidate(impl_->file_info_cache().get(), path,
+                                                /*tree=*/true);
   ARROW_ASSIGN_OR_RAISE(auto p, GcsPath::FromString(path));
   return impl_->DeleteDirContents(p, missing_dir_ok, io_context());
 }
@@ -886,17 +1011,22 @@ Status GcsFileSystem::DeleteRootDirContents() {
 }
 
 Status GcsFileSystem::DeleteFile(const std::string& path) {
+  internal::FileInfoCacheInvalidator invalidate(impl_->file_info_cache().get(), path);
   ARROW_ASSIGN_OR_RAISE(auto p, GcsPath::FromString(path));
   return impl_->DeleteFile(p);
 }
 
 Status GcsFileSystem::Move(const std::string& src, const std::string& dest) {
+  internal::FileInfoCacheInvalidator invalidate_src(impl_->file_info_cache().get(), src);
+  internal::FileInfoCacheInvalidator invalidate_dest(impl_->file_info_cache().get(),
+                                                     dest);
   ARROW_ASSIGN_OR_RAISE(auto s, GcsPath::FromString(src));
   ARROW_ASSIGN_OR_RAISE(auto d, GcsPath::FromString(dest));
   return impl_->Move(s, d);
 }
 
 Status GcsFileSystem::CopyFile(const std::string& src, const std::string& dest) {
+  internal::FileInfoCacheInvalidator invalidate(impl_->file_info_cache().get(), dest);
   ARROW_ASSIGN_OR_RAISE(auto s, GcsPath::FromString(src));
   ARROW_ASSIGN_OR_RAISE(auto d, GcsPath::FromString(dest));
   return impl_->CopyFile(s, d);
@@ -934,7 +1064,9 @@ Result<std::shared_ptr<io::RandomAccessFile>> GcsFileSystem::OpenInputFile(
   };
 
   return std::make_shared<GcsRandomAccessFile>(std::move(open_stream),
-                                               *std::move(metadata));
+                                               *std::move(metadata), io_context(),
+                                               impl_->options().parallel_read_part_size,
+                                               impl_->read_hedger());
 }
 
 Result<std::shared_ptr<io::RandomAccessFile>> GcsFileSystem::OpenInputFile(
@@ -952,14 +1084,21 @@ Result<std::shared_ptr<io::RandomAccessFile>> GcsFileSystem::OpenInputFile(
     return impl->OpenInputStream(p, g, range, offset);
   };
   return std::make_shared<GcsRandomAccessFile>(std::move(open_stream),
-                                               *std::move(metadata));
+                                               *std::move(metadata), io_context(),
+                                               impl_->options().parallel_read_part_size,
+                                               impl_->read_hedger());
 }
 
 Result<std::shared_ptr<io::OutputStream>> GcsFileSystem::OpenOutputStream(
     const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
   ARROW_RETURN_NOT_OK(internal::AssertNoTrailingSlash(path));
   ARROW_ASSIGN_OR_RAISE(auto p, GcsPath::FromString(path));
-  return impl_->OpenOutputStream(p, metadata);
+  ARROW_ASSIGN_OR_RAISE(auto stream, impl_->OpenOutputStream(p, metadata));
+  if (const auto& cache = impl_->file_info_cache()) {
+    cache->Invalidate(path);
+    return internal::FileInfoCache::InvalidateOnClose(cache, path, std::move(stream));
+  }
+  return stream;
 }
 
 Result<std::shared_ptr<io::OutputStream>> GcsFileSystem::OpenAppendStream(
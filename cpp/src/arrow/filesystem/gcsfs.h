@@ -90,6 +90,33 @@ struct ARROW_EXPORT GcsOptions {
   /// that create new buckets need a project id.
   std::optional<std::string> project_id;
 
+  /// \brief Size of the ranged requests a large read is split into.
+  ///
+  /// If positive, a `ReadAt` or `ReadAsync` call larger than this size is served by
+  /// several concurrent requests of this size, issued on the IOContext executor and
+  /// written directly into the destination buffer.  This can raise the throughput
+  /// of large reads, such as the coalesced ranges of a Parquet scan, when the
+  /// bandwidth of a single connection is the bottleneck.  If zero (the default),
+  /// each read is a single request.
+  int64_t parallel_read_part_size = 0;
+
+  /// \brief Whether and how slow read requests are reissued.
+  ///
+  /// See ReadHedgingOptions.  Disabled by default.
+  ReadHedgingOptions read_hedging;
+
+  /// \brief Whether and how the FileInfo of objects and listings is cached.
+  ///
+  /// See FileInfoCacheOptions.  Disabled by default.
+  FileInfoCacheOptions file_info_cache;
+
+  /// \brief The maximum number of idle connections the client keeps open.
+  ///
+  /// Concurrent reads beyond this number open new connections for each request.
+  /// Raise it along with the IOContext executor capacity when issuing many
+  /// concurrent reads.  If not set, the client library default is used.
+  std::optional<int> connection_pool_size;
+
   bool Equals(const GcsOptions& other) const;
 
   /// \brief Initialize with Google Default Credentials
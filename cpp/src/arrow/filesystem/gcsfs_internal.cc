@@ -342,6 +342,10 @@ google::cloud::Options AsGoogleCloudOptions(const GcsOptions& o) {
   if (o.project_id.has_value()) {
     options.set<gcs::ProjectIdOption>(*o.project_id);
   }
+  if (o.connection_pool_size.has_value()) {
+    options.set<gcs::ConnectionPoolSizeOption>(
+        static_cast<std::size_t>(*o.connection_pool_size));
+  }
   return options;
 }
 
@@ -27,6 +27,8 @@
 
 #include <random>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "arrow/filesystem/gcsfs_internal.h"
 #include "arrow/filesystem/path_util.h"
@@ -345,7 +347,9 @@ TEST(GcsFileSystem, OptionsFromUri) {
       GcsOptions::FromUri("gs://mybucket/foo/bar/"
                           "?endpoint_override=localhost&scheme=http&location=us-west2"
                           "&retry_limit_seconds=40.5"
-                          "&project_id=test-project-id",
+                          "&project_id=test-project-id"
+                          "&parallel_read_part_size=1048576"
+                          "&connection_pool_size=64",
                           &path));
   EXPECT_EQ(options.default_bucket_location, "us-west2");
   EXPECT_EQ(options.scheme, "http");
@@ -355,6 +359,9 @@ TEST(GcsFileSystem, OptionsFromUri) {
   EXPECT_EQ(*options.retry_limit_seconds, 40.5);
   ASSERT_TRUE(options.project_id.has_value());
   EXPECT_EQ(*options.project_id, "test-project-id");
+  EXPECT_EQ(options.parallel_read_part_size, 1048576);
+  ASSERT_TRUE(options.connection_pool_size.has_value());
+  EXPECT_EQ(*options.connection_pool_size, 64);
 
   // Missing bucket name
   ASSERT_RAISES(Invalid, GcsOptions::FromUri("gs:///foo/bar/", &path));
@@ -367,6 +374,12 @@ TEST(GcsFileSystem, OptionsFromUri) {
                 GcsOptions::FromUri("gs://foo/bar/?retry_limit_seconds=0", &path));
   ASSERT_RAISES(Invalid,
                 GcsOptions::FromUri("gs://foo/bar/?retry_limit_seconds=-1", &path));
+
+  // Invalid parallel read options
+  ASSERT_RAISES(Invalid,
+                GcsOptions::FromUri("gs://foo/bar/?parallel_read_part_size=-1", &path));
+  ASSERT_RAISES(Invalid,
+                GcsOptions::FromUri("gs://foo/bar/?connection_pool_size=0", &path));
 }
 
 TEST(GcsFileSystem, OptionsAccessToken) {
@@ -1333,6 +1346,42 @@ TEST_F(GcsIntegrationTest, OpenInputFileMixedReadVsReadAt) {
   }
 }
 
+TEST_F(GcsIntegrationTest, OpenInputFileParallelRead) {
+  auto options = TestGcsOptions();
+  options.parallel_read_part_size = 1000;
+  ASSERT_OK_AND_ASSIGN(auto fs, GcsFileSystem::Make(options));
+
+  auto constexpr kLineWidth = 100;
+  auto constexpr kLineCount = 256;
+  std::string contents;
+  for (int lineno = 1; lineno <= kLineCount; ++lineno) {
+    contents += RandomLine(lineno, kLineWidth);
+  }
+  const auto path = PreexistingBucketPath() + "OpenInputFileParallelRead/object-name";
+  ASSERT_OK_AND_ASSIGN(auto output, fs->OpenOutputStream(path, {}));
+  ASSERT_OK(output->Write(contents.data(), contents.size()));
+  ASSERT_OK(output->Close());
+
+  ASSERT_OK_AND_ASSIGN(auto file, fs->OpenInputFile(path));
+  // Reads spanning several parts, ending at a part boundary, past the end of the
+  // file and within a single part
+  for (auto [position, nbytes] : std::vector<std::pair<int64_t, int64_t>>{
+           {0, 25600}, {150, 3850}, {20000, 10000}, {10, 500}}) {
+    SCOPED_TRACE("ReadAt(" + std::to_string(position) + ", " + std::to_string(nbytes) +
+                 ")");
+    const auto expected = contents.substr(position, nbytes);
+    ASSERT_OK_AND_ASSIGN(auto buffer, file->ReadAt(position, nbytes));
+    EXPECT_EQ(expected, buffer->ToString());
+    std::vector<char> out(nbytes);
+    ASSERT_OK_AND_ASSIGN(auto size, file->ReadAt(position, nbytes, out.data()));
+    EXPECT_EQ(expected, std::string(out.data(), size));
+    ASSERT_OK_AND_ASSIGN(buffer, file->ReadAsync(io::default_io_context(), position,
+                                                 nbytes)
+                                     .result());
+    EXPECT_EQ(expected, buffer->ToString());
+  }
+}
+
 TEST_F(GcsIntegrationTest, OpenInputFileRandomSeek) {
   ASSERT_OK_AND_ASSIGN(auto fs, GcsFileSystem::Make(TestGcsOptions()));
 
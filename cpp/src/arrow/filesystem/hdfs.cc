@@ -344,6 +344,16 @@ void HdfsOptions::ConfigureExtraConf(std::string key, std::string val) {
   connection_config.extra_conf.emplace(std::move(key), std::move(val));
 }
 
+void HdfsOptions::ConfigureShortCircuitRead(std::string domain_socket_path) {
+  connection_config.extra_conf["dfs.client.read.shortcircuit"] = "true";
+  connection_config.extra_conf["dfs.domain.socket.path"] = std::move(domain_socket_path);
+}
+
+void HdfsOptions::ConfigureZeroCopyRead(bool skip_checksum) {
+  connection_config.zero_copy_read = true;
+  connection_config.zero_copy_skip_checksum = skip_checksum;
+}
+
 bool HdfsOptions::Equals(const HdfsOptions& other) const {
   return (buffer_size == other.buffer_size && replication == other.replication &&
           default_block_size == other.default_block_size &&
@@ -351,7 +361,10 @@ bool HdfsOptions::Equals(const HdfsOptions& other) const {
           connection_config.port == other.connection_config.port &&
           connection_config.user == other.connection_config.user &&
           connection_config.kerb_ticket == other.connection_config.kerb_ticket &&
-          connection_config.extra_conf == other.connection_config.extra_conf);
+          connection_config.extra_conf == other.connection_config.extra_conf &&
+          connection_config.zero_copy_read == other.connection_config.zero_copy_read &&
+          connection_config.zero_copy_skip_checksum ==
+              other.connection_config.zero_copy_skip_checksum);
 }
 
 Result<HdfsOptions> HdfsOptions::FromUri(const Uri& uri) {
@@ -433,6 +446,29 @@ Result<HdfsOptions> HdfsOptions::FromUri(const Uri& uri) {
     options_map.erase(it);
   }
 
+  // configure zero-copy reads
+  it = options_map.find("zero_copy_read");
+  if (it != options_map.end()) {
+    const auto& v = it->second;
+    bool zero_copy_read;
+    if (!ParseValue<BooleanType>(v.data(), v.size(), &zero_copy_read)) {
+      return Status::Invalid("Invalid value for option 'zero_copy_read': '", v, "'");
+    }
+    options.connection_config.zero_copy_read = zero_copy_read;
+    options_map.erase(it);
+  }
+  it = options_map.find("zero_copy_skip_checksum");
+  if (it != options_map.end()) {
+    const auto& v = it->second;
+    bool skip_checksum;
+    if (!ParseValue<BooleanType>(v.data(), v.size(), &skip_checksum)) {
+      return Status::Invalid("Invalid value for option 'zero_copy_skip_checksum': '", v,
+                             "'");
+    }
+    options.connection_config.zero_copy_skip_checksum = skip_checksum;
+    options_map.erase(it);
+  }
+
   // configure other options
   for (const auto& it : options_map) {
     options.ConfigureExtraConf(it.first, it.second);
@@ -47,6 +47,12 @@ struct ARROW_EXPORT HdfsOptions {
   void ConfigureBlockSize(int64_t default_block_size);
   void ConfigureKerberosTicketCachePath(std::string path);
   void ConfigureExtraConf(std::string key, std::string val);
+  /// Read local blocks from the DataNode's files, passed over a UNIX domain
+  /// socket, rather than through the DataNode.
+  void ConfigureShortCircuitRead(std::string domain_socket_path);
+  /// Return memory-mapped block data from reads when possible, see
+  /// io::HdfsReadableFile. This requires short-circuit reads.
+  void ConfigureZeroCopyRead(bool skip_checksum = false);
 
   bool Equals(const HdfsOptions& other) const;
 
@@ -63,6 +63,18 @@ TEST(TestHdfsOptions, FromUri) {
   ASSERT_EQ(options.connection_config.port, 9999);
   ASSERT_EQ(options.connection_config.extra_conf["hdfs_token"], "hdfs_token_ticket");
 
+  ASSERT_OK(uri.Parse(
+      "hdfs://otherhost:9999/?zero_copy_read=true&dfs.client.read.shortcircuit=true"));
+  ASSERT_OK_AND_ASSIGN(options, HdfsOptions::FromUri(uri));
+  ASSERT_TRUE(options.connection_config.zero_copy_read);
+  ASSERT_FALSE(options.connection_config.zero_copy_skip_checksum);
+  ASSERT_EQ(options.connection_config.extra_conf["dfs.client.read.shortcircuit"], "true");
+  ASSERT_EQ(options.connection_config.extra_conf.count("zero_copy_read"), 0U);
+  HdfsOptions skip_checksum = options;
+  skip_checksum.ConfigureZeroCopyRead(/*skip_checksum=*/true);
+  ASSERT_FALSE(options.Equals(skip_checksum));
+  ASSERT_RAISES(Invalid, HdfsOptions::FromUri("hdfs://otherhost/?zero_copy_read=maybe"));
+
   ASSERT_OK(uri.Parse("viewfs://other-nn/mypath/myfile"));
   ASSERT_OK_AND_ASSIGN(options, HdfsOptions::FromUri(uri));
   ASSERT_EQ(options.connection_config.host, "viewfs://other-nn");
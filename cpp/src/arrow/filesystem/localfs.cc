@@ -37,8 +37,10 @@
 #include "arrow/filesystem/util_internal.h"
 #include "arrow/io/file.h"
 #include "arrow/io/type_fwd.h"
+#include "arrow/io/uring_internal.h"
 #include "arrow/util/async_generator.h"
 #include "arrow/util/io_util.h"
+#include "arrow/util/logging_internal.h"
 #include "arrow/util/string.h"
 #include "arrow/util/uri.h"
 #include "arrow/util/windows_fixup.h"
@@ -226,7 +228,10 @@ Status StatSelector(const PlatformFilename& dir_fn, const FileSelector& select,
 LocalFileSystemOptions LocalFileSystemOptions::Defaults() { return {}; }
 
 bool LocalFileSystemOptions::Equals(const LocalFileSystemOptions& other) const {
-  return use_mmap == other.use_mmap && directory_readahead == other.directory_readahead &&
+  return use_mmap == other.use_mmap && use_direct_io == other.use_direct_io &&
+         use_io_uring == other.use_io_uring &&
+         io_uring_queue_depth == other.io_uring_queue_depth &&
+         directory_readahead == other.directory_readahead &&
          file_info_batch_size == other.file_info_batch_size;
 }
 
@@ -274,7 +279,17 @@ LocalFileSystem::LocalFileSystem(const io::IOContext& io_context)
 
 LocalFileSystem::LocalFileSystem(const LocalFileSystemOptions& options,
                                  const io::IOContext& io_context)
-    : FileSystem(io_context), options_(options) {}
+    : FileSystem(io_context), options_(options) {
+  if (options_.use_io_uring && !options_.use_mmap) {
+    auto maybe_io_uring = io::internal::IoUring::Make(options_.io_uring_queue_depth);
+    if (maybe_io_uring.ok()) {
+      io_uring_ = *std::move(maybe_io_uring);
+    } else {
+      ARROW_LOG(WARNING) << "Failed creating io_uring, using regular reads: "
+                         << maybe_io_uring.status().ToString();
+    }
+  }
+}
 
 LocalFileSystem::~LocalFileSystem() = default;
 
@@ -662,12 +677,16 @@ namespace {
 template <typename InputStreamType>
 Result<std::shared_ptr<InputStreamType>> OpenInputStreamGeneric(
     const std::string& path, const LocalFileSystemOptions& options,
-    const io::IOContext& io_context) {
+    const io::IOContext& io_context,
+    const std::shared_ptr<io::internal::IoUring>& io_uring) {
   RETURN_NOT_OK(ValidatePath(path));
   if (options.use_mmap) {
     return io::MemoryMappedFile::Open(path, io::FileMode::READ);
   } else {
-    return io::ReadableFile::Open(path, io_context.pool());
+    io::ReadableFileOptions file_options;
+    file_options.direct_io = options.use_direct_io;
+    file_options.io_uring = io_uring;
+    return io::ReadableFile::Open(path, io_context.pool(), file_options);
   }
 }
 
@@ -675,12 +694,14 @@ Result<std::shared_ptr<InputStreamType>> OpenInputStreamGeneric(
 
 Result<std::shared_ptr<io::InputStream>> LocalFileSystem::OpenInputStream(
     const std::string& path) {
-  return OpenInputStreamGeneric<io::InputStream>(path, options_, io_context());
+  return OpenInputStreamGeneric<io::InputStream>(path, options_, io_context(),
+                                                 io_uring_);
 }
 
 Result<std::shared_ptr<io::RandomAccessFile>> LocalFileSystem::OpenInputFile(
     const std::string& path) {
-  return OpenInputStreamGeneric<io::RandomAccessFile>(path, options_, io_context());
+  return OpenInputStreamGeneric<io::RandomAccessFile>(path, options_, io_context(),
+                                                      io_uring_);
 }
 
 namespace {
@@ -30,17 +30,43 @@ class Uri;
 
 }
 
+namespace io::internal {
+
+class IoUring;
+
+}  // namespace io::internal
+
 namespace fs {
 
 /// Options for the LocalFileSystem implementation.
 struct ARROW_EXPORT LocalFileSystemOptions {
   static constexpr int32_t kDefaultDirectoryReadahead = 16;
   static constexpr int32_t kDefaultFileInfoBatchSize = 1000;
+  static constexpr int32_t kDefaultIoUringQueueDepth = 128;
 
   /// Whether OpenInputStream and OpenInputFile return a mmap'ed file,
   /// or a regular one.
   bool use_mmap = false;
 
+  /// EXPERIMENTAL: Whether the regular files returned by OpenInputStream and
+  /// OpenInputFile bypass the OS page cache, so that large one-shot scans do
+  /// not evict the working set of other processes.
+  ///
+  /// See io::ReadableFileOptions::direct_io.  Ignored if `use_mmap` is true.
+  bool use_direct_io = false;
+
+  /// EXPERIMENTAL: Whether the regular files returned by OpenInputStream and
+  /// OpenInputFile serve ReadAsync() and ReadManyAsync() through an io_uring
+  /// shared by the filesystem, instead of blocking reads on the IO thread pool.
+  ///
+  /// Only available on Linux.  If the io_uring cannot be created, regular reads
+  /// are used.  Ignored if `use_mmap` is true.
+  bool use_io_uring = false;
+
+  /// EXPERIMENTAL: The submission queue depth of the io_uring used if
+  /// `use_io_uring` is true.
+  int32_t io_uring_queue_depth = kDefaultIoUringQueueDepth;
+
   /// Options related to `GetFileInfoGenerator` interface.
 
   /// EXPERIMENTAL: The maximum number of directories processed in parallel
@@ -126,6 +152,7 @@ class ARROW_EXPORT LocalFileSystem : public FileSystem {
 
  protected:
   LocalFileSystemOptions options_;
+  std::shared_ptr<io::internal::IoUring> io_uring_;
 };
 
 }  // namespace fs
@@ -16,7 +16,9 @@
 // under the License.
 
 #include <memory>
+#include <random>
 #include <string_view>
+#include <vector>
 
 #include "benchmark/benchmark.h"
 
@@ -27,6 +29,7 @@
 #include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
+#include "arrow/testing/util.h"
 #include "arrow/util/async_generator.h"
 #include "arrow/util/io_util.h"
 
@@ -131,6 +134,66 @@ BENCHMARK_REGISTER_F(LocalFSFixture, AsyncFileDiscovery)
     ->UseRealTime()
     ->Unit(benchmark::kMillisecond);
 
+/// Benchmark random reads through `RandomAccessFile::ReadManyAsync()`, as issued by
+/// ReadRangeCache, with and without io_uring.
+///
+/// Each iteration reads `batch_size` blocks of `block_size` bytes at random offsets
+/// of a file in a single ReadManyAsync() call.  The items processed are the reads,
+/// so the items per second are the IOPS.  Note that the file is likely in the page
+/// cache, so this mostly measures the per-read overhead.
+class LocalFSReadFixture : public benchmark::Fixture {
+ public:
+  void SetUp(const benchmark::State& state) override {
+    ASSERT_OK_AND_ASSIGN(tmp_dir_, TemporaryDir::Make("localfs-bench-"));
+    ASSERT_OK_AND_ASSIGN(auto path, tmp_dir_->path().Join("data"));
+    path_ = path.ToString();
+
+    ASSERT_OK_AND_ASSIGN(auto stream, io::FileOutputStream::Open(path_));
+    std::vector<uint8_t> chunk(1 << 20);
+    random_bytes(chunk.size(), /*seed=*/42, chunk.data());
+    for (int64_t i = 0; i < kFileSize / static_cast<int64_t>(chunk.size()); ++i) {
+      ASSERT_OK(stream->Write(chunk.data(), static_cast<int64_t>(chunk.size())));
+    }
+    ASSERT_OK(stream->Close());
+  }
+
+  void TearDown(const benchmark::State& state) override { tmp_dir_.reset(); }
+
+ protected:
+  static constexpr int64_t kFileSize = 64 << 20;
+
+  std::unique_ptr<TemporaryDir> tmp_dir_;
+  std::string path_;
+};
+
+BENCHMARK_DEFINE_F(LocalFSReadFixture, RandomReadManyAsync)
+(benchmark::State& st) {
+  auto options = LocalFileSystemOptions::Defaults();
+  options.use_io_uring = st.range(0) != 0;
+  const int64_t block_size = st.range(1);
+  const int64_t batch_size = st.range(2);
+  auto local_fs = std::make_unique<LocalFileSystem>(options);
+  ASSERT_OK_AND_ASSIGN(auto file, local_fs->OpenInputFile(path_));
+
+  std::default_random_engine engine(42);
+  std::uniform_int_distribution<int64_t> block_dist(0, kFileSize / block_size - 1);
+  std::vector<io::ReadRange> ranges(batch_size);
+  for (auto _ : st) {
+    for (auto& range : ranges) {
+      range = {block_dist(engine) * block_size, block_size};
+    }
+    for (auto& future : file->ReadManyAsync(ranges)) {
+      ASSERT_FINISHES_OK(future);
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * batch_size);
+  st.SetBytesProcessed(st.iterations() * batch_size * block_size);
+}
+BENCHMARK_REGISTER_F(LocalFSReadFixture, RandomReadManyAsync)
+    ->ArgNames({"use_io_uring", "block_size", "batch_size"})
+    ->ArgsProduct({{0, 1}, {4096, 65536}, {1, 64}})
+    ->UseRealTime();
+
 }  // namespace fs
 
 }  // namespace arrow
@@ -111,11 +111,13 @@
 #include "arrow/status.h"
 #include "arrow/util/async_generator.h"
 #include "arrow/util/async_util.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/metrics.h"
 #include "arrow/util/string.h"
 #include "arrow/util/task_group.h"
 #include "arrow/util/thread_pool.h"
@@ -435,7 +437,15 @@ bool S3Options::Equals(const S3Options& other) const {
           proxy_options.Equals(other.proxy_options) &&
           credentials_kind == other.credentials_kind &&
           background_writes == other.background_writes &&
+          part_upload_size == other.part_upload_size &&
+          adaptive_part_upload_size == other.adaptive_part_upload_size &&
+          max_concurrent_part_uploads == other.max_concurrent_part_uploads &&
+          max_upload_buffer_size == other.max_upload_buffer_size &&
           allow_delayed_open == other.allow_delayed_open &&
+          parallel_read_part_size == other.parallel_read_part_size &&
+          read_hedging == other.read_hedging &&
+          file_info_cache == other.file_info_cache &&
+          parallel_listing == other.parallel_listing &&
           allow_bucket_creation == other.allow_bucket_creation &&
           allow_bucket_deletion == other.allow_bucket_deletion &&
           tls_ca_file_path == other.tls_ca_file_path &&
@@ -1418,12 +1428,16 @@ class ObjectInputFile final : public io::RandomAccessFile {
  public:
   ObjectInputFile(std::shared_ptr<S3ClientHolder> holder, const io::IOContext& io_context,
                   const S3Path& path, int64_t size = kNoSize,
-                  const std::string& sse_customer_key = "")
+                  const std::string& sse_customer_key = "",
+                  int64_t parallel_read_part_size = 0,
+                  std::shared_ptr<internal::RequestHedger> read_hedger = nullptr)
       : holder_(std::move(holder)),
         io_context_(io_context),
         path_(path),
         content_length_(size),
-        sse_customer_key_(sse_customer_key) {}
+        sse_customer_key_(sse_customer_key),
+        parallel_read_part_size_(parallel_read_part_size),
+        read_hedger_(std::move(read_hedger)) {}
 
   Status Init() {
     // Issue a HEAD Object to get the content-length and ensure any
@@ -1518,18 +1532,13 @@ class ObjectInputFile final : public io::RandomAccessFile {
     if (nbytes == 0) {
       return 0;
     }
-
-    // Read the desired range of bytes
-    ARROW_ASSIGN_OR_RAISE(auto client_lock, holder_->Lock());
-    ARROW_ASSIGN_OR_RAISE(S3Model::GetObjectResult result,
-                          GetObjectRange(client_lock.get(), path_, sse_customer_key_,
-                                         position, nbytes, out));
-
-    auto& stream = result.GetBody();
-    stream.ignore(nbytes);
-    // NOTE: the stream is a stringstream by default, there is no actual error
-    // to check for.  However, stream.fail() may return true if EOF is reached.
-    return stream.gcount();
+    if (parallel_read_part_size_ > 0 && nbytes > parallel_read_part_size_) {
+      return ReadAtParallel(position, nbytes, static_cast<uint8_t*>(out));
+    }
+    if (read_hedger_) {
+      return MakeRangeReader()(position, nbytes, static_cast<uint8_t*>(out));
+    }
+    return ReadRange(holder_, path_, sse_customer_key_, position, nbytes, out);
   }
 
   Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
@@ -1563,6 +1572,51 @@ class ObjectInputFile final : public io::RandomAccessFile {
   }
 
  protected:
+  // Read the desired range of bytes with a single GET request
+  static Result<int64_t> ReadRange(const std::shared_ptr<S3ClientHolder>& holder,
+                                   const S3Path& path,
+                                   const std::string& sse_customer_key,
+                                   int64_t position, int64_t nbytes, void* out) {
+    static util::Counter* requests =
+        util::MetricsRegistry::Global()->GetCounter("fs.s3.requests");
+    static util::Counter* bytes_read =
+        util::MetricsRegistry::Global()->GetCounter("fs.s3.bytes_read");
+    static util::Histogram* latency =
+        util::MetricsRegistry::Global()->GetHistogram("fs.s3.request_latency_us");
+
+    const auto start = std::chrono::steady_clock::now();
+    ARROW_ASSIGN_OR_RAISE(auto client_lock, holder->Lock());
+    ARROW_ASSIGN_OR_RAISE(S3Model::GetObjectResult result,
+                          GetObjectRange(client_lock.get(), path, sse_customer_key,
+                                         position, nbytes, out));
+
+    auto& stream = result.GetBody();
+    stream.ignore(nbytes);
+    requests->Add();
+    bytes_read->Add(stream.gcount());
+    latency->Record(std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - start)
+                        .count());
+    // NOTE: the stream is a stringstream by default, there is no actual error
+    // to check for.  However, stream.fail() may return true if EOF is reached.
+    return stream.gcount();
+  }
+
+  // A function issuing a GET request, reissued when slow if hedging is enabled
+  internal::RequestHedger::ReadFunction MakeRangeReader() const {
+    return internal::RequestHedger::Wrap(
+        read_hedger_, io_context_,
+        [holder = holder_, path = path_, sse_customer_key = sse_customer_key_](
+            int64_t position, int64_t nbytes, uint8_t* out) {
+          return ReadRange(holder, path, sse_customer_key, position, nbytes, out);
+        });
+  }
+
+  Result<int64_t> ReadAtParallel(int64_t position, int64_t nbytes, uint8_t* out) {
+    return internal::ReadRangeInParts(io_context_, position, nbytes,
+                                      parallel_read_part_size_, out, MakeRangeReader());
+  }
+
   std::shared_ptr<S3ClientHolder> holder_;
   const io::IOContext io_context_;
   S3Path path_;
@@ -1572,25 +1626,65 @@ class ObjectInputFile final : public io::RandomAccessFile {
   int64_t content_length_ = kNoSize;
   std::shared_ptr<const KeyValueMetadata> metadata_;
   std::string sse_customer_key_;
+  const int64_t parallel_read_part_size_;
+  const std::shared_ptr<internal::RequestHedger> read_hedger_;
 };
 
-// Upload size per part. While AWS and Minio support different sizes for each
-// part (only requiring a minimum of 5MB), Cloudflare R2 requires that every
-// part be exactly equal (except for the last part). We set this to 10 MB, so
-// that in combination with the maximum number of parts of 10,000, this gives a
-// file limit of 100k MB (or about 98 GB).
+// Upload size per part is given by S3Options::part_upload_size. While AWS and Minio
+// support different sizes for each part (only requiring a minimum of 5MB), Cloudflare
+// R2 requires that every part be exactly equal (except for the last part), so the part
+// size only varies with S3Options::adaptive_part_upload_size. The default of 10 MB,
+// in combination with the maximum number of parts of 10,000, gives a file limit of
+// 100k MB (or about 98 GB).
 // (see https://docs.aws.amazon.com/AmazonS3/latest/userguide/qfacts.html)
 // (for rational, see: https://github.com/apache/arrow/issues/34363)
-static constexpr int64_t kPartUploadSize = 10 * 1024 * 1024;
+//
+// The maximum part size allowed by S3.
+static constexpr int64_t kMaxPartUploadSize = int64_t(5) * 1024 * 1024 * 1024;
+
+// With S3Options::adaptive_part_upload_size, the part size doubles every this many parts
+static constexpr int32_t kPartsPerUploadSizeDoubling = 1000;
+
+// Limit the parts uploaded in the background by the output streams of a filesystem,
+// see S3Options::max_concurrent_part_uploads and S3Options::max_upload_buffer_size.
+class UploadThrottle {
+ public:
+  UploadThrottle(int32_t max_uploads, int64_t max_bytes)
+      : max_uploads_(max_uploads), max_bytes_(max_bytes) {}
+
+  // Reserve room for a background upload of `nbytes` bytes, return false if the
+  // upload would exceed the limits
+  bool TryAcquire(int64_t nbytes) {
+    if (max_uploads_ <= 0 && max_bytes_ <= 0) {
+      return true;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if ((max_uploads_ > 0 && uploads_ >= max_uploads_) ||
+        (max_bytes_ > 0 && bytes_ + nbytes > max_bytes_)) {
+      return false;
+    }
+    ++uploads_;
+    bytes_ += nbytes;
+    return true;
+  }
 
-// Above this threshold, use a multi-part upload instead of a single request upload. Only
-// relevant if early sanitization of writing to the bucket is disabled (see
-// `allow_delayed_open`).
-static constexpr int64_t kMultiPartUploadThresholdSize = kPartUploadSize - 1;
+  void Release(int64_t nbytes) {
+    if (max_uploads_ <= 0 && max_bytes_ <= 0) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    --uploads_;
+    bytes_ -= nbytes;
+  }
+
+ private:
+  const int32_t max_uploads_;
+  const int64_t max_bytes_;
 
-static_assert(kMultiPartUploadThresholdSize < kPartUploadSize,
-              "Multi part upload threshold size must be stricly less than the actual "
-              "multi part upload part size.");
+  std::mutex mutex_;
+  int32_t uploads_ = 0;
+  int64_t bytes_ = 0;
+};
 
 // An OutputStream that writes to a S3 object
 class ObjectOutputStream final : public io::OutputStream {
@@ -1601,7 +1695,8 @@ class ObjectOutputStream final : public io::OutputStream {
   ObjectOutputStream(std::shared_ptr<S3ClientHolder> holder,
                      const io::IOContext& io_context, const S3Path& path,
                      const S3Options& options,
-                     const std::shared_ptr<const KeyValueMetadata>& metadata)
+                     const std::shared_ptr<const KeyValueMetadata>& metadata,
+                     std::shared_ptr<UploadThrottle> upload_throttle)
       : holder_(std::move(holder)),
         io_context_(io_context),
         path_(path),
@@ -1609,6 +1704,9 @@ class ObjectOutputStream final : public io::OutputStream {
         default_metadata_(options.default_metadata),
         background_writes_(options.background_writes),
         allow_delayed_open_(options.allow_delayed_open),
+        part_upload_size_(options.part_upload_size),
+        adaptive_part_upload_size_(options.adaptive_part_upload_size),
+        upload_throttle_(std::move(upload_throttle)),
         sse_customer_key_(options.sse_customer_key) {}
 
   ~ObjectOutputStream() override {
@@ -1717,7 +1815,24 @@ class ObjectOutputStream final : public io::OutputStream {
   // OutputStream interface
 
   bool ShouldBeMultipartUpload() const {
-    return pos_ > kMultiPartUploadThresholdSize || !allow_delayed_open_;
+    // Above the part size, use a multi-part upload instead of a single request upload.
+    // Only relevant if early sanitization of writing to the bucket is disabled (see
+    // `allow_delayed_open`).
+    return pos_ >= part_upload_size_ || !allow_delayed_open_;
+  }
+
+  // The size of the part to be uploaded next
+  int64_t NextPartSize() const {
+    int64_t part_size = part_upload_size_;
+    if (adaptive_part_upload_size_) {
+      for (int32_t n = part_number_ - 1;
+           n >= kPartsPerUploadSizeDoubling && part_size < kMaxPartUploadSize;
+           n -= kPartsPerUploadSizeDoubling) {
+        part_size *= 2;
+      }
+      part_size = std::min(part_size, std::max(part_upload_size_, kMaxPartUploadSize));
+    }
+    return part_size;
   }
 
   bool IsMultipartCreated() const { return !multipart_upload_id_.empty(); }
@@ -1843,14 +1958,15 @@ class ObjectOutputStream final : public io::OutputStream {
     // Handle case where we have some bytes buffered from prior calls.
     if (current_part_size_ > 0) {
       // Try to fill current buffer
-      const int64_t to_copy = std::min(nbytes, kPartUploadSize - current_part_size_);
+      const int64_t part_size = NextPartSize();
+      const int64_t to_copy = std::min(nbytes, part_size - current_part_size_);
       RETURN_NOT_OK(current_part_->Write(data_ptr, to_copy));
       current_part_size_ += to_copy;
       advance_ptr(to_copy);
       pos_ += to_copy;
 
       // If buffer isn't full, break
-      if (current_part_size_ < kPartUploadSize) {
+      if (current_part_size_ < part_size) {
         return Status::OK();
       }
 
@@ -1860,17 +1976,18 @@ class ObjectOutputStream final : public io::OutputStream {
     }
 
     // We can upload chunks without copying them into a buffer
-    while (nbytes >= kPartUploadSize) {
-      RETURN_NOT_OK(UploadPart(data_ptr, kPartUploadSize));
-      advance_ptr(kPartUploadSize);
-      pos_ += kPartUploadSize;
+    for (int64_t part_size = NextPartSize(); nbytes >= part_size;
+         part_size = NextPartSize()) {
+      RETURN_NOT_OK(UploadPart(data_ptr, part_size));
+      advance_ptr(part_size);
+      pos_ += part_size;
     }
 
     // Buffer remaining bytes
     if (nbytes > 0) {
       current_part_size_ = nbytes;
       ARROW_ASSIGN_OR_RAISE(current_part_, io::BufferOutputStream::Create(
-                                               kPartUploadSize, io_context_.pool()));
+                                               NextPartSize(), io_context_.pool()));
       RETURN_NOT_OK(current_part_->Write(data_ptr, current_part_size_));
       pos_ += current_part_size_;
     }
@@ -1950,7 +2067,9 @@ class ObjectOutputStream final : public io::OutputStream {
     req.SetContentLength(nbytes);
     RETURN_NOT_OK(SetSSECustomerKey(&req, sse_customer_key_));
 
-    if (!background_writes_) {
+    // If the background uploads are throttled, upload from this thread instead,
+    // which also holds back the writer.
+    if (!background_writes_ || !upload_throttle_->TryAcquire(nbytes)) {
       // GH-45304: avoid setting a body stream if length is 0.
       // This workaround can be removed once we require AWS SDK 1.11.489 or later.
       if (nbytes != 0) {
@@ -1965,7 +2084,12 @@ class ObjectOutputStream final : public io::OutputStream {
       if (nbytes != 0) {
         // If the data isn't owned, make an immutable copy for the lifetime of the closure
         if (owned_buffer == nullptr) {
-          ARROW_ASSIGN_OR_RAISE(owned_buffer, AllocateBuffer(nbytes, io_context_.pool()));
+          auto maybe_buffer = AllocateBuffer(nbytes, io_context_.pool());
+          if (!maybe_buffer.ok()) {
+            upload_throttle_->Release(nbytes);
+            return maybe_buffer.status();
+          }
+          owned_buffer = *std::move(maybe_buffer);
           memcpy(owned_buffer->mutable_data(), data, nbytes);
         } else {
           DCHECK_EQ(data, owned_buffer->data());
@@ -1985,12 +2109,20 @@ class ObjectOutputStream final : public io::OutputStream {
       // The closure keeps the buffer and the upload state alive
       auto deferred = [owned_buffer, holder = holder_, req = std::move(req),
                        state = upload_state_, async_result_callback,
-                       part_number = part_number_]() mutable -> Status {
-        ARROW_ASSIGN_OR_RAISE(auto outcome, TriggerUploadRequest(req, holder));
-
-        return async_result_callback(req, state, part_number, outcome);
+                       part_number = part_number_, throttle = upload_throttle_,
+                       nbytes]() mutable -> Status {
+        auto maybe_outcome = TriggerUploadRequest(req, holder);
+        Status st = maybe_outcome.ok()
+                        ? async_result_callback(req, state, part_number, *maybe_outcome)
+                        : maybe_outcome.status();
+        throttle->Release(nbytes);
+        return st;
       };
-      RETURN_NOT_OK(SubmitIO(io_context_, std::move(deferred)));
+      auto maybe_future = SubmitIO(io_context_, std::move(deferred));
+      if (!maybe_future.ok()) {
+        upload_throttle_->Release(nbytes);
+        return maybe_future.status();
+      }
     }
 
     ++part_number_;
@@ -2068,6 +2200,8 @@ class ObjectOutputStream final : public io::OutputStream {
       if (!outcome.IsSuccess()) {
         return UploadPartError(request, outcome);
       } else {
+        // Other parts may be completing in the background
+        std::unique_lock<std::mutex> lock(state->mutex);
         AddCompletedPart(state, part_number, outcome.GetResult());
       }
 
@@ -2150,6 +2284,9 @@ class ObjectOutputStream final : public io::OutputStream {
   const std::shared_ptr<const KeyValueMetadata> default_metadata_;
   const bool background_writes_;
   const bool allow_delayed_open_;
+  const int64_t part_upload_size_;
+  const bool adaptive_part_upload_size_;
+  const std::shared_ptr<UploadThrottle> upload_throttle_;
 
   Aws::String multipart_upload_id_;
   bool closed_ = true;
@@ -2206,8 +2343,26 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
   // At most 1000 keys per multiple-delete request
   static constexpr int32_t kMultipleDeleteMaxKeys = 1000;
 
+  // Shared by all the output streams
+  std::shared_ptr<UploadThrottle> upload_throttle_;
+  // Shared by all the input files, null unless read hedging is enabled
+  std::shared_ptr<internal::RequestHedger> read_hedger_;
+  // Null unless FileInfo caching is enabled
+  std::shared_ptr<internal::FileInfoCache> file_info_cache_;
+
   explicit Impl(S3Options options, io::IOContext io_context)
-      : builder_(std::move(options)), io_context_(io_context) {}
+      : builder_(std::move(options)),
+        io_context_(io_context),
+        upload_throttle_(std::make_shared<UploadThrottle>(
+            this->options().max_concurrent_part_uploads,
+            this->options().max_upload_buffer_size)),
+        file_info_cache_(
+            internal::FileInfoCache::Make(this->options().file_info_cache)) {
+    if (this->options().read_hedging.enabled) {
+      read_hedger_ =
+          std::make_shared<internal::RequestHedger>(this->options().read_hedging);
+    }
+  }
 
   Status Init() { return builder_.BuildClient(io_context_).Value(&holder_); }
 
@@ -2455,6 +2610,10 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
     const bool allow_not_found;
     const int max_recursion;
     const bool include_implicit_dirs;
+    // Whether to list each directory separately (see S3Options::parallel_listing)
+    const bool walk_tree;
+    // The recursion depth of the entries returned by this listing
+    const int depth;
     const io::IOContext io_context;
     S3ClientHolder* const holder;
 
@@ -2465,11 +2624,14 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
     FileListerState(PushGenerator<std::vector<FileInfo>>::Producer files_queue,
                     FileSelector select, const std::string& bucket,
                     const std::string& key, bool include_implicit_dirs,
-                    io::IOContext io_context, S3ClientHolder* holder)
+                    io::IOContext io_context, S3ClientHolder* holder,
+                    bool parallel_listing, int depth = 0)
         : files_queue(std::move(files_queue)),
           allow_not_found(select.allow_not_found),
           max_recursion(select.max_recursion),
           include_implicit_dirs(include_implicit_dirs),
+          walk_tree(select.recursive && parallel_listing),
+          depth(depth),
           io_context(std::move(io_context)),
           holder(holder) {
       req.SetBucket(bucket);
@@ -2477,11 +2639,27 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
       if (!key.empty()) {
         req.SetPrefix(key + kSep);
       }
-      if (!select.recursive) {
+      if (!select.recursive || walk_tree) {
         req.SetDelimiter(Aws::String() + kSep);
       }
     }
 
+    // Whether the subdirectories found by this listing should be listed as well
+    bool ShouldListSubdirectories() const { return walk_tree && depth < max_recursion; }
+
+    // Create the state of the listing of a subdirectory found by this listing
+    std::shared_ptr<FileListerState> MakeChild(std::string_view child_key) const {
+      FileSelector select;
+      // The subdirectory may have been removed since it was listed
+      select.allow_not_found = true;
+      select.recursive = true;
+      select.max_recursion = max_recursion;
+      return std::make_shared<FileListerState>(
+          files_queue, select, std::string(FromAwsString(req.GetBucket())),
+          std::string(child_key), include_implicit_dirs, io_context, holder,
+          /*parallel_listing=*/true, depth + 1);
+    }
+
     void Finish() {
       // `empty` means that we didn't get a single file info back from S3.  This may be
       // a situation that we should consider as PathNotFound.
@@ -2552,6 +2730,11 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
         info.set_path(child_path_ss.str());
         info.set_type(FileType::Directory);
         file_infos.push_back(std::move(info));
+        if (state->ShouldListSubdirectories()) {
+          // Sibling directories are listed concurrently, each with its own state
+          scheduler->AddTask(
+              std::make_unique<FileListerTask>(state->MakeChild(child_key), scheduler));
+        }
       }
       // S3 doesn't have any concept of "max depth" and so we emulate it by counting the
       // number of '/' characters.  E.g. if the user is searching bucket/subdirA/subdirB
@@ -2696,10 +2879,11 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
     // scheduler and schedule a task to grab the first batch.  Once that's done we
     // schedule a new task for the next batch.  All of these tasks share the same
     // FileListerState object but none of these tasks run in parallel so there is
-    // no need to worry about mutexes
-    auto state = std::make_shared<FileListerState>(sink, select, bucket, key,
-                                                   include_implicit_dirs, io_context_,
-                                                   this->holder_.get());
+    // no need to worry about mutexes.  With S3Options::parallel_listing, each
+    // subdirectory gets its own FileListerState and is listed concurrently.
+    auto state = std::make_shared<FileListerState>(
+        sink, select, bucket, key, include_implicit_dirs, io_context_,
+        this->holder_.get(), options().parallel_listing);
 
     // Create the first file lister task (it may spawn more)
     auto file_lister_task = std::make_unique<FileListerTask>(state, scheduler);
@@ -2906,6 +3090,71 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
         });
   }
 
+  Result<FileInfo> GetFileInfo(const std::string& s) {
+    ARROW_ASSIGN_OR_RAISE(auto client_lock, holder_->Lock());
+
+    ARROW_ASSIGN_OR_RAISE(auto path, S3Path::FromString(s));
+    FileInfo info;
+    info.set_path(s);
+
+    if (path.empty()) {
+      // It's the root path ""
+      info.set_type(FileType::Directory);
+      return info;
+    } else if (path.key.empty()) {
+      // It's a bucket
+      S3Model::HeadBucketRequest req;
+      req.SetBucket(ToAwsString(path.bucket));
+
+      auto outcome = client_lock.Move()->HeadBucket(req);
+      if (!outcome.IsSuccess()) {
+        GetOrSetBackend(outcome.GetError());
+        if (!IsNotFound(outcome.GetError())) {
+          const auto msg = "When getting information for bucket '" + path.bucket + "': ";
+          return ErrorToStatus(msg, "HeadBucket", outcome.GetError(), options().region);
+        }
+        info.set_type(FileType::NotFound);
+        return info;
+      }
+      // NOTE: S3 doesn't have a bucket modification time.  Only a creation
+      // time is available, and you have to list all buckets to get it.
+      info.set_type(FileType::Directory);
+      return info;
+    } else {
+      // It's an object
+      S3Model::HeadObjectRequest req;
+      req.SetBucket(ToAwsString(path.bucket));
+      req.SetKey(ToAwsString(path.key));
+
+      auto outcome = client_lock.Move()->HeadObject(req);
+      if (outcome.IsSuccess()) {
+        // "File" object found
+        FileObjectToInfo(path.key, outcome.GetResult(), &info);
+        return info;
+      }
+      GetOrSetBackend(outcome.GetError());
+      if (!IsNotFound(outcome.GetError())) {
+        const auto msg = "When getting information for key '" + path.key +
+                         "' in bucket '" + path.bucket + "': ";
+        return ErrorToStatus(msg, "HeadObject", outcome.GetError(), options().region);
+      }
+      // Not found => perhaps it's an empty "directory"
+      ARROW_ASSIGN_OR_RAISE(bool is_dir, IsEmptyDirectory(path, &outcome));
+      if (is_dir) {
+        info.set_type(FileType::Directory);
+        return info;
+      }
+      // Not found => perhaps it's a non-empty "directory"
+      ARROW_ASSIGN_OR_RAISE(is_dir, IsNonEmptyDirectory(path));
+      if (is_dir) {
+        info.set_type(FileType::Directory);
+      } else {
+        info.set_type(FileType::NotFound);
+      }
+      return info;
+    }
+  }
+
   FileInfoGenerator GetFileInfoGenerator(const FileSelector& select) {
     auto maybe_base_path = S3Path::FromString(select.base_dir);
     if (!maybe_base_path.ok()) {
@@ -2989,8 +3238,9 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
 
     RETURN_NOT_OK(CheckS3Initialized());
 
-    auto ptr = std::make_shared<ObjectInputFile>(holder_, fs->io_context(), path, kNoSize,
-                                                 fs->options().sse_customer_key);
+    auto ptr = std::make_shared<ObjectInputFile>(
+        holder_, fs->io_context(), path, kNoSize, fs->options().sse_customer_key,
+        fs->options().parallel_read_part_size, read_hedger_);
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -3011,7 +3261,8 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
     RETURN_NOT_OK(CheckS3Initialized());
 
     auto ptr = std::make_shared<ObjectInputFile>(
-        holder_, fs->io_context(), path, info.size(), fs->options().sse_customer_key);
+        holder_, fs->io_context(), path, info.size(), fs->options().sse_customer_key,
+        fs->options().parallel_read_part_size, read_hedger_);
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -3027,6 +3278,9 @@ S3FileSystem::~S3FileSystem() {}
 Result<std::shared_ptr<S3FileSystem>> S3FileSystem::Make(
     const S3Options& options, const io::IOContext& io_context) {
   RETURN_NOT_OK(CheckS3Initialized());
+  if (options.part_upload_size <= 0) {
+    return Status::Invalid("S3Options::part_upload_size must be positive");
+  }
 
   std::shared_ptr<S3FileSystem> ptr(new S3FileSystem(options, io_context));
   RETURN_NOT_OK(ptr->impl_->Init());
@@ -3078,70 +3332,17 @@ S3Options S3FileSystem::options() const { return impl_->options(); }
 std::string S3FileSystem::region() const { return impl_->region(); }
 
 Result<FileInfo> S3FileSystem::GetFileInfo(const std::string& s) {
-  ARROW_ASSIGN_OR_RAISE(auto client_lock, impl_->holder_->Lock());
-
-  ARROW_ASSIGN_OR_RAISE(auto path, S3Path::FromString(s));
-  FileInfo info;
-  info.set_path(s);
-
-  if (path.empty()) {
-    // It's the root path ""
-    info.set_type(FileType::Directory);
-    return info;
-  } else if (path.key.empty()) {
-    // It's a bucket
-    S3Model::HeadBucketRequest req;
-    req.SetBucket(ToAwsString(path.bucket));
-
-    auto outcome = client_lock.Move()->HeadBucket(req);
-    if (!outcome.IsSuccess()) {
-      impl_->GetOrSetBackend(outcome.GetError());
-      if (!IsNotFound(outcome.GetError())) {
-        const auto msg = "When getting information for bucket '" + path.bucket + "': ";
-        return ErrorToStatus(msg, "HeadBucket", outcome.GetError(),
-                             impl_->options().region);
-      }
-      info.set_type(FileType::NotFound);
-      return info;
+  const auto& cache = impl_->file_info_cache_;
+  if (cache) {
+    if (auto info = cache->Get(s)) {
+      return *std::move(info);
     }
-    // NOTE: S3 doesn't have a bucket modification time.  Only a creation
-    // time is available, and you have to list all buckets to get it.
-    info.set_type(FileType::Directory);
-    return info;
-  } else {
-    // It's an object
-    S3Model::HeadObjectRequest req;
-    req.SetBucket(ToAwsString(path.bucket));
-    req.SetKey(ToAwsString(path.key));
-
-    auto outcome = client_lock.Move()->HeadObject(req);
-    if (outcome.IsSuccess()) {
-      // "File" object found
-      FileObjectToInfo(path.key, outcome.GetResult(), &info);
-      return info;
-    }
-    impl_->GetOrSetBackend(outcome.GetError());
-    if (!IsNotFound(outcome.GetError())) {
-      const auto msg = "When getting information for key '" + path.key + "' in bucket '" +
-                       path.bucket + "': ";
-      return ErrorToStatus(msg, "HeadObject", outcome.GetError(),
-                           impl_->options().region);
-    }
-    // Not found => perhaps it's an empty "directory"
-    ARROW_ASSIGN_OR_RAISE(bool is_dir, impl_->IsEmptyDirectory(path, &outcome));
-    if (is_dir) {
-      info.set_type(FileType::Directory);
-      return info;
-    }
-    // Not found => perhaps it's a non-empty "directory"
-    ARROW_ASSIGN_OR_RAISE(is_dir, impl_->IsNonEmptyDirectory(path));
-    if (is_dir) {
-      info.set_type(FileType::Directory);
-    } else {
-      info.set_type(FileType::NotFound);
-    }
-    return info;
   }
+  ARROW_ASSIGN_OR_RAISE(auto info, impl_->GetFileInfo(s));
+  if (cache) {
+    cache->Put(info);
+  }
+  return info;
 }
 
 Result<FileInfoVector> S3FileSystem::GetFileInfo(const FileSelector& select) {
@@ -3157,10 +3358,20 @@ Result<FileInfoVector> S3FileSystem::GetFileInfo(const FileSelector& select) {
 }
 
 FileInfoGenerator S3FileSystem::GetFileInfoGenerator(const FileSelector& select) {
-  return impl_->GetFileInfoGenerator(select);
+  auto generator = impl_->GetFileInfoGenerator(select);
+  if (auto cache = impl_->file_info_cache_) {
+    // Keep the listed entries for later lookups
+    return MakeMappedGenerator(std::move(generator),
+                               [cache](const FileInfoVector& infos) {
+                                 cache->Put(infos);
+                                 return infos;
+                               });
+  }
+  return generator;
 }
 
 Status S3FileSystem::CreateDir(const std::string& s, bool recursive) {
+  internal::FileInfoCacheInvalidator invalidate(impl_->file_info_cache_.get(), s);
   ARROW_ASSIGN_OR_RAISE(auto path, S3Path::FromString(s));
 
   if (path.key.empty()) {
@@ -3249,6 +3460,8 @@ Status S3FileSystem::CreateDir(const std::string& s, bool recursive) {
 }
 
 Status S3FileSystem::DeleteDir(const std::string& s) {
+  internal::FileInfoCacheInvalidator invalidate(impl_->file_info_cache_.get(), s,
+                                                /*tree=*/true);
   ARROW_ASSIGN_OR_RAISE(auto path, S3Path::FromString(s));
   if (path.empty()) {
     return Status::NotImplemented("Cannot delete all S3 buckets");
@@ -3284,18 +3497,23 @@ Future<> S3FileSystem::DeleteDirContentsAsync(const std::string& s, bool missing
     return Status::NotImplemented("Cannot delete all S3 buckets");
   }
   auto self = impl_;
-  return impl_->DeleteDirContentsAsync(path.bucket, path.key)
-      .Then(
-          [path, self]() {
-            // Directory may be implicitly deleted, recreate it
-            return self->EnsureDirectoryExists(path);
-          },
-          [missing_dir_ok](const Status& err) {
-            if (missing_dir_ok && ::arrow::internal::ErrnoFromStatus(err) == ENOENT) {
-              return Status::OK();
-            }
-            return err;
-          });
+  auto fut = impl_->DeleteDirContentsAsync(path.bucket, path.key)
+                 .Then(
+                     [path, self]() {
+                       // Directory may be implicitly deleted, recreate it
+                       return self->EnsureDirectoryExists(path);
+                     },
+                     [missing_dir_ok](const Status& err) {
+                       if (missing_dir_ok &&
+                           ::arrow::internal::ErrnoFromStatus(err) == ENOENT) {
+                         return Status::OK();
+                       }
+                       return err;
+                     });
+  if (auto cache = impl_->file_info_cache_) {
+    fut.AddCallback([cache, s](const Status&) { cache->InvalidateTree(s); });
+  }
+  return fut;
 }
 
 Status S3FileSystem::DeleteRootDirContents() {
@@ -3303,6 +3521,7 @@ Status S3FileSystem::DeleteRootDirContents() {
 }
 
 Status S3FileSystem::DeleteFile(const std::string& s) {
+  internal::FileInfoCacheInvalidator invalidate(impl_->file_info_cache_.get(), s);
   ARROW_ASSIGN_OR_RAISE(auto client_lock, impl_->holder_->Lock());
 
   ARROW_ASSIGN_OR_RAISE(auto path, S3Path::FromString(s));
@@ -3334,6 +3553,8 @@ Status S3FileSystem::Move(const std::string& src, const std::string& dest) {
   // XXX We don't implement moving directories as it would be too expensive:
   // one must copy all directory contents one by one (including object data),
   // then delete the original contents.
+  internal::FileInfoCacheInvalidator invalidate_src(impl_->file_info_cache_.get(), src);
+  internal::FileInfoCacheInvalidator invalidate_dest(impl_->file_info_cache_.get(), dest);
 
   ARROW_ASSIGN_OR_RAISE(auto src_path, S3Path::FromString(src));
   RETURN_NOT_OK(ValidateFilePath(src_path));
@@ -3350,6 +3571,7 @@ Status S3FileSystem::Move(const std::string& src, const std::string& dest) {
 }
 
 Status S3FileSystem::CopyFile(const std::string& src, const std::string& dest) {
+  internal::FileInfoCacheInvalidator invalidate(impl_->file_info_cache_.get(), dest);
   ARROW_ASSIGN_OR_RAISE(auto src_path, S3Path::FromString(src));
   RETURN_NOT_OK(ValidateFilePath(src_path));
   ARROW_ASSIGN_OR_RAISE(auto dest_path, S3Path::FromString(dest));
@@ -3390,8 +3612,13 @@ Result<std::shared_ptr<io::OutputStream>> S3FileSystem::OpenOutputStream(
   RETURN_NOT_OK(CheckS3Initialized());
 
   auto ptr = std::make_shared<ObjectOutputStream>(impl_->holder_, io_context(), path,
-                                                  impl_->options(), metadata);
+                                                  impl_->options(), metadata,
+                                                  impl_->upload_throttle_);
   RETURN_NOT_OK(ptr->Init());
+  if (const auto& cache = impl_->file_info_cache_) {
+    cache->Invalidate(s);
+    return internal::FileInfoCache::InvalidateOnClose(cache, s, std::move(ptr));
+  }
   return ptr;
 }
 
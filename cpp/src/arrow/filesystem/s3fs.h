@@ -157,6 +157,38 @@ struct ARROW_EXPORT S3Options {
   /// Whether OutputStream writes will be issued in the background, without blocking.
   bool background_writes = true;
 
+  /// Size of the parts of multipart uploads.
+  ///
+  /// S3 requires at least 5 MiB per part, except for the last one. Together with the
+  /// limit of 10,000 parts per upload, the default allows objects of about 98 GB,
+  /// unless `adaptive_part_upload_size` is enabled.
+  int64_t part_upload_size = 10 * 1024 * 1024;
+
+  /// Whether to grow the part size of large multipart uploads.
+  ///
+  /// If true, the part size is doubled every 1,000 parts (up to the maximum of 5 GiB
+  /// allowed by S3), so that the uploaded objects can reach the 5 TiB limit of S3 with
+  /// the default part size. Some backends, such as Cloudflare R2, require all parts but
+  /// the last to have the same size and don't support this.
+  bool adaptive_part_upload_size = false;
+
+  /// Maximum number of parts uploaded in the background at once by all the output
+  /// streams of the filesystem, or 0 for no limit.
+  ///
+  /// When the limit is reached, further parts are uploaded synchronously by the writing
+  /// thread, which slows the writers down until background uploads complete.
+  /// Only relevant with `background_writes`.
+  int32_t max_concurrent_part_uploads = 0;
+
+  /// Maximum number of bytes uploaded in the background at once by all the output
+  /// streams of the filesystem, or 0 for no limit.
+  ///
+  /// As with `max_concurrent_part_uploads`, uploads exceeding the limit are done
+  /// synchronously by the writing thread. This bounds the memory held by background
+  /// uploads; each output stream also buffers up to one part being filled.
+  /// Only relevant with `background_writes`.
+  int64_t max_upload_buffer_size = 0;
+
   /// Whether to allow creation of buckets
   ///
   /// When S3FileSystem creates new buckets, it does not pass any non-default settings.
@@ -189,6 +221,36 @@ struct ARROW_EXPORT S3Options {
   /// when attempting to close the file).
   bool allow_delayed_open = false;
 
+  /// Size of the ranged GET requests a large read is split into.
+  ///
+  /// If positive, a `ReadAt` call larger than this size is served by several
+  /// concurrent GET requests of this size, issued on the IOContext executor and
+  /// written directly into the destination buffer. This can raise the throughput
+  /// of large reads when the bandwidth of a single connection is the bottleneck.
+  /// If zero (the default), each read is a single GET request.
+  int64_t parallel_read_part_size = 0;
+
+  /// Whether and how slow GET requests are reissued, see ReadHedgingOptions.
+  ///
+  /// This trades a few extra requests for a shorter tail latency of the reads, which
+  /// can help interactive queries.  It is disabled by default.
+  ReadHedgingOptions read_hedging;
+
+  /// Whether and how the results of HEAD and list requests are cached, see
+  /// FileInfoCacheOptions.  Disabled by default.
+  FileInfoCacheOptions file_info_cache;
+
+  /// Whether recursive listings walk the directory tree in parallel.
+  ///
+  /// By default, a recursive `GetFileInfo` or `GetFileInfoGenerator` call lists all
+  /// the objects under the base directory with a single paginated request sequence,
+  /// which can take a long time on trees with millions of objects. If true, each
+  /// directory is listed separately, and the listings of sibling directories (for
+  /// example the partitions of a Hive-style dataset) are issued concurrently on the
+  /// IOContext executor. This needs more requests on trees with few objects per
+  /// directory.
+  bool parallel_listing = false;
+
   /// \brief Default metadata for OpenOutputStream.
   ///
   /// This will be ignored if non-empty metadata is passed to OpenOutputStream.
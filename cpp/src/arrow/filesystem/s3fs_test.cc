@@ -962,6 +962,41 @@ TEST_F(TestS3FS, GetFileInfoGenerator) {
   // Non-root dir case is tested by generic tests
 }
 
+TEST_F(TestS3FS, GetFileInfoParallelListing) {
+  options_.parallel_listing = true;
+  ASSERT_OK_AND_ASSIGN(auto parallel_fs, MakeNewFileSystem());
+
+  FileSelector select;
+  std::vector<FileInfo> expected, infos;
+  select.recursive = true;
+  for (const std::string base_dir :
+       {"", "empty-bucket", "bucket", "bucket/emptydir", "bucket/otherdir"}) {
+    ARROW_SCOPED_TRACE("base_dir = ", base_dir);
+    select.base_dir = base_dir;
+    for (const int32_t max_recursion : {0, 1, 2, INT32_MAX}) {
+      ARROW_SCOPED_TRACE("max_recursion = ", max_recursion);
+      select.max_recursion = max_recursion;
+      ASSERT_OK_AND_ASSIGN(expected, fs_->GetFileInfo(select));
+      ASSERT_OK_AND_ASSIGN(infos, parallel_fs->GetFileInfo(select));
+      SortInfos(&expected);
+      SortInfos(&infos);
+      ASSERT_EQ(infos, expected);
+
+      CollectFileInfoGenerator(parallel_fs->GetFileInfoGenerator(select), &infos);
+      SortInfos(&infos);
+      ASSERT_EQ(infos, expected);
+    }
+  }
+
+  // Nonexistent
+  select.base_dir = "bucket/whatever";
+  select.max_recursion = INT32_MAX;
+  ASSERT_RAISES(IOError, parallel_fs->GetFileInfo(select));
+  select.allow_not_found = true;
+  ASSERT_OK_AND_ASSIGN(infos, parallel_fs->GetFileInfo(select));
+  ASSERT_EQ(infos.size(), 0);
+}
+
 TEST_F(TestS3FS, GetFileInfoGeneratorStress) {
   // This test is slow because it needs to create a bunch of seed files.  However, it is
   // the only test that stresses listing and deleting when there are more than 1000
@@ -1363,6 +1398,34 @@ TEST_F(TestS3FS, OpenInputFile) {
   ASSERT_RAISES(IOError, file->Seek(10));
 }
 
+TEST_F(TestS3FS, OpenInputFileParallelRead) {
+  std::string data;
+  for (int i = 0; i < 100; ++i) {
+    data += std::to_string(i % 10);
+  }
+  ASSERT_OK_AND_ASSIGN(auto stream, fs_->OpenOutputStream("bucket/parallel"));
+  ASSERT_OK(stream->Write(data));
+  ASSERT_OK(stream->Close());
+
+  options_.parallel_read_part_size = 7;
+  MakeFileSystem();
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("bucket/parallel"));
+  ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(0, 100));
+  AssertBufferEqual(*buf, data);
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(3, 50));
+  AssertBufferEqual(*buf, data.substr(3, 50));
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(90, 50));
+  AssertBufferEqual(*buf, data.substr(90));
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(95, 5));
+  AssertBufferEqual(*buf, data.substr(95));
+
+  std::string result(30, '\0');
+  ASSERT_OK_AND_EQ(30, file->ReadAt(20, 30, result.data()));
+  ASSERT_EQ(result, data.substr(20, 30));
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAsync({}, 10, 80).result());
+  AssertBufferEqual(*buf, data.substr(10, 80));
+}
+
 // Minio only allows Server Side Encryption on HTTPS client connections.
 #ifdef ENABLE_TLS_TESTS
 class TestS3FSHTTPS : public TestS3FS {
@@ -1506,6 +1569,23 @@ TEST_F(TestS3FS, OpenOutputStreamAsync) {
   }
 }
 
+TEST_F(TestS3FS, OpenOutputStreamThrottledUploads) {
+  // Parts beyond the limits are uploaded synchronously
+  options_.part_upload_size = 5 * 1024 * 1024;
+  options_.max_concurrent_part_uploads = 1;
+  options_.max_upload_buffer_size = 6 * 1024 * 1024;
+  for (bool allow_delayed_open : {false, true}) {
+    ARROW_SCOPED_TRACE("allow_delayed_open = ", allow_delayed_open);
+    options_.allow_delayed_open = allow_delayed_open;
+    MakeFileSystem();
+    TestOpenOutputStream(allow_delayed_open);
+    ASSERT_OK(RestoreTestBucket());
+  }
+
+  options_.part_upload_size = 0;
+  ASSERT_RAISES(Invalid, MakeNewFileSystem());
+}
+
 TEST_F(TestS3FS, OpenOutputStreamCloseAsyncFutureDeadlockBackgroundWrites) {
   TestOpenOutputStreamCloseAsyncFutureDeadlock();
   ASSERT_OK(RestoreTestBucket());
@@ -18,13 +18,25 @@
 #include "arrow/filesystem/util_internal.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/filesystem/path_util.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/future.h"
 #include "arrow/util/io_util.h"
+#include "arrow/util/logging_internal.h"
 #include "arrow/util/string.h"
 #include "arrow/util/uri.h"
 
@@ -58,6 +70,489 @@ Status CopyStream(const std::shared_ptr<io::InputStream>& src,
   return Status::OK();
 }
 
+namespace {
+
+struct PartedRead {
+  struct Part {
+    std::atomic<bool> claimed{false};
+    Future<> done = Future<>::Make();
+    int64_t bytes_read = 0;
+  };
+
+  PartedRead(int64_t position, int64_t nbytes, int64_t part_size, uint8_t* out,
+             std::function<Result<int64_t>(int64_t, int64_t, uint8_t*)> read_part)
+      : position(position),
+        nbytes(nbytes),
+        part_size(part_size),
+        out(out),
+        read_part(std::move(read_part)),
+        parts(static_cast<size_t>(bit_util::CeilDiv(nbytes, part_size))) {}
+
+  // Read the given part, unless another thread already took it
+  void RunPart(size_t i) {
+    Part& part = parts[i];
+    if (part.claimed.exchange(true)) {
+      return;
+    }
+    const int64_t offset = static_cast<int64_t>(i) * part_size;
+    const int64_t length = std::min(part_size, nbytes - offset);
+    auto result = read_part(position + offset, length, out + offset);
+    if (result.ok()) {
+      part.bytes_read = *result;
+      part.done.MarkFinished();
+    } else {
+      part.done.MarkFinished(result.status());
+    }
+  }
+
+  const int64_t position;
+  const int64_t nbytes;
+  const int64_t part_size;
+  uint8_t* const out;
+  const std::function<Result<int64_t>(int64_t, int64_t, uint8_t*)> read_part;
+  std::vector<Part> parts;
+};
+
+int64_t MicrosSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+// A read request that may be issued twice.  Each attempt reads into a buffer of its
+// own, since the losing one keeps running after the read returns.
+struct HedgedRead {
+  struct Attempt {
+    std::atomic<bool> claimed{false};
+    std::unique_ptr<Buffer> buffer;
+    int64_t bytes_read = 0;
+  };
+
+  HedgedRead(std::shared_ptr<RequestHedger> hedger, RequestHedger::ReadFunction read,
+             MemoryPool* pool, int64_t position, int64_t nbytes)
+      : hedger(std::move(hedger)),
+        read(std::move(read)),
+        pool(pool),
+        position(position),
+        nbytes(nbytes) {}
+
+  // Account for a new attempt, unless the read is already done
+  bool Issue() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (finished) return false;
+    ++num_issued;
+    return true;
+  }
+
+  // Run the given attempt, unless another thread already took it
+  void Run(int i) {
+    Attempt& attempt = attempts[i];
+    if (attempt.claimed.exchange(true) || done.is_finished()) {
+      return;
+    }
+    const auto start = std::chrono::steady_clock::now();
+    auto result = [&]() -> Result<int64_t> {
+      ARROW_ASSIGN_OR_RAISE(attempt.buffer, AllocateBuffer(nbytes, pool));
+      return read(position, nbytes, attempt.buffer->mutable_data());
+    }();
+    if (result.ok()) {
+      hedger->Record(MicrosSince(start));
+    }
+    Finish(i, std::move(result));
+  }
+
+  void Finish(int i, Result<int64_t> result) {
+    bool run_other = false;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (finished) return;
+      if (!result.ok() && ++num_failed < num_issued) {
+        run_other = true;
+      } else {
+        finished = true;
+        if (result.ok()) attempts[i].bytes_read = *result;
+      }
+    }
+    if (run_other) {
+      // Fall back on the other attempt, which may not have started yet
+      Run(1 - i);
+    } else if (result.ok()) {
+      done.MarkFinished(i);
+    } else {
+      done.MarkFinished(result.status());
+    }
+  }
+
+  const std::shared_ptr<RequestHedger> hedger;
+  const RequestHedger::ReadFunction read;
+  MemoryPool* const pool;
+  const int64_t position;
+  const int64_t nbytes;
+  Attempt attempts[2];
+  // The index of the first attempt to succeed
+  Future<int> done = Future<int>::Make();
+
+  std::mutex mutex;
+  bool finished = false;
+  int num_issued = 0;
+  int num_failed = 0;
+};
+
+}  // namespace
+
+Result<int64_t> ReadRangeInParts(
+    const io::IOContext& io_context, int64_t position, int64_t nbytes,
+    int64_t part_size, uint8_t* out,
+    std::function<Result<int64_t>(int64_t position, int64_t nbytes, uint8_t* out)>
+        read_part) {
+  DCHECK_GT(part_size, 0);
+  if (nbytes <= part_size) {
+    return read_part(position, nbytes, out);
+  }
+  auto read = std::make_shared<PartedRead>(position, nbytes, part_size, out,
+                                           std::move(read_part));
+  const size_t num_parts = read->parts.size();
+  for (size_t i = 1; i < num_parts; ++i) {
+    // If submission fails, the part is read below by the calling thread
+    ARROW_UNUSED(io::internal::SubmitIO(io_context, [read, i]() { read->RunPart(i); }));
+  }
+  // Once this loop is done, `out` is not written to by parts that IO threads pick
+  // up later
+  for (size_t i = 0; i < num_parts; ++i) {
+    read->RunPart(i);
+  }
+  Status st;
+  for (auto& part : read->parts) {
+    st &= part.done.status();
+  }
+  RETURN_NOT_OK(st);
+  // The bytes read are contiguous up to the first short part
+  int64_t bytes_read = 0;
+  for (const auto& part : read->parts) {
+    const int64_t expected = std::min(part_size, nbytes - bytes_read);
+    bytes_read += part.bytes_read;
+    if (part.bytes_read < expected) {
+      break;
+    }
+  }
+  return bytes_read;
+}
+
+Future<std::shared_ptr<Buffer>> ReadRangeInPartsAsync(
+    const io::IOContext& io_context, int64_t position, int64_t nbytes,
+    int64_t part_size,
+    std::function<Result<int64_t>(int64_t position, int64_t nbytes, uint8_t* out)>
+        read_part) {
+  DCHECK_GT(part_size, 0);
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ResizableBuffer> buffer,
+                        AllocateResizableBuffer(nbytes, io_context.pool()));
+  auto shared_read_part =
+      std::make_shared<std::function<Result<int64_t>(int64_t, int64_t, uint8_t*)>>(
+          std::move(read_part));
+  std::vector<Future<int64_t>> parts;
+  for (int64_t offset = 0; offset < nbytes; offset += part_size) {
+    const int64_t length = std::min(part_size, nbytes - offset);
+    parts.push_back(DeferNotOk(io::internal::SubmitIO(
+        io_context, [buffer, shared_read_part, position, offset, length]() {
+          return (*shared_read_part)(position + offset, length,
+                                     buffer->mutable_data() + offset);
+        })));
+  }
+  return All(std::move(parts))
+      .Then([buffer, nbytes, part_size](const std::vector<Result<int64_t>>& results)
+                -> Result<std::shared_ptr<Buffer>> {
+        // The bytes read are contiguous up to the first short part
+        int64_t bytes_read = 0;
+        bool short_read = false;
+        for (const auto& result : results) {
+          RETURN_NOT_OK(result);
+          if (short_read) continue;
+          const int64_t expected = std::min(part_size, nbytes - bytes_read);
+          bytes_read += *result;
+          short_read = *result < expected;
+        }
+        RETURN_NOT_OK(buffer->Resize(bytes_read));
+        return buffer;
+      });
+}
+
+RequestHedger::RequestHedger(ReadHedgingOptions options)
+    : options_(std::move(options)) {}
+
+Result<int64_t> RequestHedger::Read(const io::IOContext& io_context, int64_t position,
+                                    int64_t nbytes, uint8_t* out,
+                                    const ReadFunction& read) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tokens_ = std::min(tokens_ + options_.budget, kMaxTokens);
+  }
+  const int64_t threshold = threshold_us();
+  if (threshold < 0 || nbytes == 0) {
+    const auto start = std::chrono::steady_clock::now();
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, read(position, nbytes, out));
+    Record(MicrosSince(start));
+    return bytes_read;
+  }
+
+  auto state = std::make_shared<HedgedRead>(shared_from_this(), read, io_context.pool(),
+                                            position, nbytes);
+  auto submit = [&](int i) {
+    return io::internal::SubmitIO(io_context, [state, i] { state->Run(i); });
+  };
+  state->Issue();
+  if (submit(0).ok() && !state->done.Wait(static_cast<double>(threshold) * 1e-6)) {
+    // Only hedge a request that is running: if no IO thread has started it yet, the
+    // executor is busy and this thread runs it below.
+    if (state->attempts[0].claimed.load() && TryHedge() && state->Issue()) {
+      ARROW_UNUSED(submit(1));
+    }
+  }
+  state->Run(0);
+  ARROW_ASSIGN_OR_RAISE(int winner, state->done.result());
+  const HedgedRead::Attempt& attempt = state->attempts[winner];
+  std::memcpy(out, attempt.buffer->data(), static_cast<size_t>(attempt.bytes_read));
+  return attempt.bytes_read;
+}
+
+RequestHedger::ReadFunction RequestHedger::Wrap(std::shared_ptr<RequestHedger> hedger,
+                                                const io::IOContext& io_context,
+                                                ReadFunction read) {
+  if (!hedger) {
+    return read;
+  }
+  return [hedger = std::move(hedger), io_context, read = std::move(read)](
+             int64_t position, int64_t nbytes, uint8_t* out) {
+    return hedger->Read(io_context, position, nbytes, out, read);
+  };
+}
+
+int64_t RequestHedger::threshold_us() const {
+  std::vector<int64_t> latencies;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (latencies_us_.empty() ||
+        static_cast<int64_t>(latencies_us_.size()) < options_.min_samples) {
+      return -1;
+    }
+    latencies = latencies_us_;
+  }
+  const double rank = std::ceil(std::clamp(options_.latency_quantile, 0.0, 1.0) *
+                                static_cast<double>(latencies.size()));
+  const auto it = latencies.begin() +
+                  std::clamp<int64_t>(static_cast<int64_t>(rank) - 1, 0,
+                                      static_cast<int64_t>(latencies.size()) - 1);
+  std::nth_element(latencies.begin(), it, latencies.end());
+  return *it;
+}
+
+int64_t RequestHedger::num_hedged() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return num_hedged_;
+}
+
+void RequestHedger::Record(int64_t latency_us) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (latencies_us_.size() < kMaxSamples) {
+    latencies_us_.push_back(latency_us);
+  } else {
+    latencies_us_[next_sample_] = latency_us;
+  }
+  next_sample_ = (next_sample_ + 1) % kMaxSamples;
+}
+
+bool RequestHedger::TryHedge() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (tokens_ < 1) {
+    return false;
+  }
+  tokens_ -= 1;
+  ++num_hedged_;
+  return true;
+}
+
+namespace {
+
+std::string CacheKey(std::string_view path) {
+  return std::string(RemoveTrailingSlash(path));
+}
+
+class InvalidatingOutputStream : public io::OutputStream {
+ public:
+  InvalidatingOutputStream(std::shared_ptr<FileInfoCache> cache, std::string path,
+                           std::shared_ptr<io::OutputStream> stream)
+      : cache_(std::move(cache)), path_(std::move(path)), stream_(std::move(stream)) {}
+
+  ~InvalidatingOutputStream() override {
+    // Destroying the stream may close it implicitly
+    stream_.reset();
+    cache_->Invalidate(path_);
+  }
+
+  Status Close() override {
+    auto status = stream_->Close();
+    cache_->Invalidate(path_);
+    return status;
+  }
+
+  Future<> CloseAsync() override {
+    return stream_->CloseAsync().Then(
+        [cache = cache_, path = path_]() { cache->Invalidate(path); },
+        [cache = cache_, path = path_](const Status& status) {
+          cache->Invalidate(path);
+          return status;
+        });
+  }
+
+  Status Abort() override { return stream_->Abort(); }
+  Result<int64_t> Tell() const override { return stream_->Tell(); }
+  bool closed() const override { return stream_->closed(); }
+  Status Write(const void* data, int64_t nbytes) override {
+    return stream_->Write(data, nbytes);
+  }
+  Status Write(const std::shared_ptr<Buffer>& data) override {
+    return stream_->Write(data);
+  }
+  Status Flush() override { return stream_->Flush(); }
+
+ private:
+  const std::shared_ptr<FileInfoCache> cache_;
+  const std::string path_;
+  std::shared_ptr<io::OutputStream> stream_;
+};
+
+}  // namespace
+
+FileInfoCache::FileInfoCache(FileInfoCacheOptions options)
+    : options_(std::move(options)) {}
+
+std::shared_ptr<FileInfoCache> FileInfoCache::Make(const FileInfoCacheOptions& options) {
+  if (!options.enabled || options.capacity <= 0) {
+    return nullptr;
+  }
+  return std::make_shared<FileInfoCache>(options);
+}
+
+std::optional<FileInfo> FileInfoCache::Get(const std::string& path) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = index_.find(CacheKey(path));
+  if (it == index_.end()) {
+    ++misses_;
+    return std::nullopt;
+  }
+  if (it->second->expiry <= std::chrono::steady_clock::now()) {
+    EraseUnlocked(it->second);
+    ++misses_;
+    return std::nullopt;
+  }
+  ++hits_;
+  lru_.splice(lru_.begin(), lru_, it->second);
+  FileInfo info = lru_.front().info;
+  // Answer with the spelling of the caller, which may differ by a trailing slash
+  info.set_path(path);
+  return info;
+}
+
+void FileInfoCache::Put(const FileInfo& info) { Put(std::vector<FileInfo>{info}); }
+
+void FileInfoCache::Put(const std::vector<FileInfo>& infos) {
+  const auto expiry = std::chrono::steady_clock::now() +
+                      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                          std::chrono::duration<double>(options_.ttl_seconds));
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto& info : infos) {
+    std::string key = CacheKey(info.path());
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+      it->second->info = info;
+      it->second->expiry = expiry;
+      lru_.splice(lru_.begin(), lru_, it->second);
+      continue;
+    }
+    lru_.push_front(Entry{key, info, expiry});
+    index_.emplace(std::move(key), lru_.begin());
+    if (static_cast<int64_t>(lru_.size()) > options_.capacity) {
+      EraseUnlocked(std::prev(lru_.end()));
+    }
+  }
+}
+
+void FileInfoCache::Invalidate(std::string_view path) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const std::string key = CacheKey(path);
+  if (auto it = index_.find(key); it != index_.end()) {
+    EraseUnlocked(it->second);
+  }
+  InvalidateAncestorsUnlocked(key);
+}
+
+void FileInfoCache::InvalidateTree(std::string_view path) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const std::string key = CacheKey(path);
+  for (auto it = lru_.begin(); it != lru_.end();) {
+    auto next = std::next(it);
+    if (IsAncestorOf(key, it->key)) {
+      EraseUnlocked(it);
+    }
+    it = next;
+  }
+  InvalidateAncestorsUnlocked(key);
+}
+
+void FileInfoCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  lru_.clear();
+  index_.clear();
+}
+
+std::shared_ptr<io::OutputStream> FileInfoCache::InvalidateOnClose(
+    std::shared_ptr<FileInfoCache> cache, std::string path,
+    std::shared_ptr<io::OutputStream> stream) {
+  if (!cache) {
+    return stream;
+  }
+  return std::make_shared<InvalidatingOutputStream>(std::move(cache), std::move(path),
+                                                    std::move(stream));
+}
+
+int64_t FileInfoCache::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return static_cast<int64_t>(lru_.size());
+}
+
+int64_t FileInfoCache::hits() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return hits_;
+}
+
+int64_t FileInfoCache::misses() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return misses_;
+}
+
+void FileInfoCache::EraseUnlocked(std::list<Entry>::iterator it) {
+  index_.erase(it->key);
+  lru_.erase(it);
+}
+
+void FileInfoCache::InvalidateAncestorsUnlocked(std::string_view key) {
+  std::string parent(key);
+  while (!parent.empty()) {
+    parent = GetAbstractPathParent(parent).first;
+    if (auto it = index_.find(parent); it != index_.end()) {
+      EraseUnlocked(it->second);
+    }
+  }
+}
+
+FileInfoCacheInvalidator::~FileInfoCacheInvalidator() {
+  if (cache_ == nullptr) return;
+  if (tree_) {
+    cache_->InvalidateTree(path_);
+  } else {
+    cache_->Invalidate(path_);
+  }
+}
+
 Status PathNotFound(std::string_view path) {
   return Status::IOError("Path does not exist '", path, "'")
       .WithDetail(StatusDetailFromErrno(ENOENT));
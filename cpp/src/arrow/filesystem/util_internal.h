@@ -17,13 +17,23 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
+#include <functional>
+#include <list>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
 #include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "arrow/filesystem/filesystem.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/status.h"
+#include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow::fs::internal {
@@ -36,6 +46,163 @@ Status CopyStream(const std::shared_ptr<io::InputStream>& src,
                   const std::shared_ptr<io::OutputStream>& dest, int64_t chunk_size,
                   const io::IOContext& io_context);
 
+/// \brief Read a range of bytes as several requests of at most `part_size` bytes
+///
+/// `read_part(position, nbytes, out)` reads one part and returns the number of bytes
+/// it read.  The parts after the first are submitted to the IO executor of
+/// `io_context`; the calling thread then reads every part that no IO thread has
+/// started yet, so that this cannot deadlock when called from an IO thread.
+/// Returns the number of contiguous bytes read from `position`, which is less than
+/// `nbytes` if a part reads less than requested.
+ARROW_EXPORT
+Result<int64_t> ReadRangeInParts(
+    const io::IOContext& io_context, int64_t position, int64_t nbytes,
+    int64_t part_size, uint8_t* out,
+    std::function<Result<int64_t>(int64_t position, int64_t nbytes, uint8_t* out)>
+        read_part);
+
+/// \brief Asynchronous version of ReadRangeInParts
+///
+/// Each part is read by its own IO task into a buffer allocated from the pool of
+/// `io_context`, so that no IO thread waits for the others.  The buffer is shrunk to
+/// the number of contiguous bytes read.
+ARROW_EXPORT
+Future<std::shared_ptr<Buffer>> ReadRangeInPartsAsync(
+    const io::IOContext& io_context, int64_t position, int64_t nbytes,
+    int64_t part_size,
+    std::function<Result<int64_t>(int64_t position, int64_t nbytes, uint8_t* out)>
+        read_part);
+
+/// \brief Reissue slow read requests, see ReadHedgingOptions
+///
+/// The latencies of the last requests are kept to compute the hedging threshold.
+/// Each read request earns `budget` of a hedged request, so that at most that fraction
+/// of the requests are duplicated.  A single instance is shared by the files of a
+/// filesystem, and is thread-safe.
+class ARROW_EXPORT RequestHedger : public std::enable_shared_from_this<RequestHedger> {
+ public:
+  using ReadFunction =
+      std::function<Result<int64_t>(int64_t position, int64_t nbytes, uint8_t* out)>;
+
+  explicit RequestHedger(ReadHedgingOptions options);
+
+  /// \brief Call `read(position, nbytes, out)`, reissuing it if it is slow
+  ///
+  /// Once enough requests were timed, the request is submitted to the IO executor of
+  /// `io_context` and reads into a buffer of its own.  If it is still running after
+  /// the threshold, a second request is submitted, and the result of the first one
+  /// to succeed is copied to `out`.  The calling thread runs the request itself if no
+  /// IO thread has started it by then, so that this cannot deadlock.
+  Result<int64_t> Read(const io::IOContext& io_context, int64_t position,
+                       int64_t nbytes, uint8_t* out, const ReadFunction& read);
+
+  /// \brief Wrap `read` with Read(), or return it unchanged if `hedger` is null
+  static ReadFunction Wrap(std::shared_ptr<RequestHedger> hedger,
+                           const io::IOContext& io_context, ReadFunction read);
+
+  /// \brief The current hedging threshold, or -1 while too few requests were timed
+  int64_t threshold_us() const;
+
+  /// \brief The number of requests reissued so far
+  int64_t num_hedged() const;
+
+  /// Record the latency of a completed request
+  void Record(int64_t latency_us);
+
+ private:
+  bool TryHedge();
+
+  static constexpr size_t kMaxSamples = 256;
+  // At most this many hedged requests in a burst
+  static constexpr double kMaxTokens = 10;
+
+  const ReadHedgingOptions options_;
+  mutable std::mutex mutex_;
+  // Ring buffer of the latest request latencies
+  std::vector<int64_t> latencies_us_;
+  size_t next_sample_ = 0;
+  double tokens_ = 0;
+  int64_t num_hedged_ = 0;
+};
+
+/// \brief A size-bounded cache of FileInfo with a time to live
+///
+/// See FileInfoCacheOptions.  Invalidating a path also invalidates its ancestors, whose
+/// existence as directories may depend on it.  Thread-safe.
+class ARROW_EXPORT FileInfoCache {
+ public:
+  explicit FileInfoCache(FileInfoCacheOptions options);
+
+  /// \brief Make a cache, or return null if `options` disable caching
+  static std::shared_ptr<FileInfoCache> Make(const FileInfoCacheOptions& options);
+
+  /// \brief The cached FileInfo of `path`, if any and not expired
+  std::optional<FileInfo> Get(const std::string& path);
+
+  void Put(const FileInfo& info);
+  void Put(const std::vector<FileInfo>& infos);
+
+  /// \brief Invalidate a path and its ancestors
+  void Invalidate(std::string_view path);
+
+  /// \brief Invalidate a path, everything under it, and its ancestors
+  void InvalidateTree(std::string_view path);
+
+  void Clear();
+
+  /// \brief Wrap `stream` so that closing it invalidates `path`
+  ///
+  /// The size and modification time of a file change when it is closed.
+  static std::shared_ptr<io::OutputStream> InvalidateOnClose(
+      std::shared_ptr<FileInfoCache> cache, std::string path,
+      std::shared_ptr<io::OutputStream> stream);
+
+  /// \brief The number of cached entries, including expired ones
+  int64_t size() const;
+
+  /// \brief The number of Get() calls that found an entry
+  int64_t hits() const;
+
+  /// \brief The number of Get() calls that found no entry
+  int64_t misses() const;
+
+ private:
+  struct Entry {
+    std::string key;
+    FileInfo info;
+    std::chrono::steady_clock::time_point expiry;
+  };
+
+  void EraseUnlocked(std::list<Entry>::iterator it);
+  void InvalidateAncestorsUnlocked(std::string_view key);
+
+  const FileInfoCacheOptions options_;
+  mutable std::mutex mutex_;
+  // Most recently used first
+  std::list<Entry> lru_;
+  std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+  int64_t hits_ = 0;
+  int64_t misses_ = 0;
+};
+
+/// \brief Invalidate a path of a FileInfoCache when leaving the scope
+///
+/// Modifying operations invalidate the paths they touch once they are done, so that
+/// the lookups they make along the way are not kept.  `cache` may be null.
+class ARROW_EXPORT FileInfoCacheInvalidator {
+ public:
+  FileInfoCacheInvalidator(FileInfoCache* cache, std::string path, bool tree = false)
+      : cache_(cache), path_(std::move(path)), tree_(tree) {}
+  ~FileInfoCacheInvalidator();
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(FileInfoCacheInvalidator);
+
+ private:
+  FileInfoCache* cache_;
+  std::string path_;
+  bool tree_;
+};
+
 ARROW_EXPORT
 Status PathNotFound(std::string_view path);
 
@@ -0,0 +1,264 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/acero_nodes.h"
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/compute/exec.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/record_batch.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/logging_internal.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace flight {
+
+namespace {
+
+arrow::Result<acero::ExecNode*> MakeFlightSourceNode(
+    acero::ExecPlan* plan, std::vector<acero::ExecNode*> inputs,
+    const acero::ExecNodeOptions& options) {
+  const auto& source_options = checked_cast<const FlightSourceNodeOptions&>(options);
+  if (source_options.max_readahead < 1) {
+    return Status::Invalid("max_readahead must be positive, got ",
+                           source_options.max_readahead);
+  }
+  std::shared_ptr<MetadataRecordBatchReader> reader = source_options.reader;
+  if (!reader) {
+    if (!source_options.client) {
+      return Status::Invalid("FlightSourceNodeOptions needs a client or a reader");
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        reader, source_options.client->DoGet(source_options.call_options,
+                                             source_options.ticket));
+  }
+  ARROW_ASSIGN_OR_RAISE(auto schema, reader->GetSchema());
+
+  // Messages carrying only application metadata are skipped
+  auto read_next = [reader]() -> arrow::Result<std::optional<compute::ExecBatch>> {
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(FlightStreamChunk chunk, reader->Next());
+      if (chunk.data) {
+        return std::optional<compute::ExecBatch>(compute::ExecBatch(*chunk.data));
+      }
+      if (!chunk.app_metadata) {
+        return std::nullopt;
+      }
+    }
+  };
+  const int max_q = source_options.max_readahead;
+  ARROW_ASSIGN_OR_RAISE(
+      auto generator,
+      MakeBackgroundGenerator(MakeFunctionIterator(std::move(read_next)),
+                              io::default_io_context().executor(), max_q,
+                              std::max(1, max_q / 2)));
+  return acero::MakeExecNode(
+      "source", plan, std::move(inputs),
+      acero::SourceNodeOptions(std::move(schema), std::move(generator),
+                               compute::Ordering::Implicit()));
+}
+
+// Writes the batches of a consuming sink one at a time on the I/O
+// executor, so that the plan's threads never wait for the transport
+class FlightWriterConsumer : public acero::SinkNodeConsumer,
+                             public std::enable_shared_from_this<FlightWriterConsumer> {
+ public:
+  explicit FlightWriterConsumer(const FlightSinkNodeOptions& options)
+      : options_(options), finished_(Future<>::Make()) {}
+
+  Status Init(const std::shared_ptr<Schema>& schema,
+              acero::BackpressureControl* backpressure_control,
+              acero::ExecPlan* plan) override {
+    schema_ = schema;
+    backpressure_control_ = backpressure_control;
+    if (options_.writer) {
+      writer_ = options_.writer;
+      RETURN_NOT_OK(writer_->Begin(schema));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(auto result,
+                            options_.client->DoPut(options_.call_options,
+                                                   options_.descriptor, schema));
+      writer_ = std::move(result.writer);
+      metadata_reader_ = std::move(result.reader);
+    }
+    return Status::OK();
+  }
+
+  Status Consume(compute::ExecBatch batch) override {
+    ARROW_ASSIGN_OR_RAISE(auto record_batch, batch.ToRecordBatch(schema_));
+    std::lock_guard<std::mutex> lock(mutex_);
+    RETURN_NOT_OK(status_);
+    pending_.push_back(std::move(record_batch));
+    if (!paused_ &&
+        static_cast<int64_t>(pending_.size()) > options_.max_buffered_batches) {
+      paused_ = true;
+      backpressure_control_->Pause();
+    }
+    return StartWritingUnlocked();
+  }
+
+  Future<> Finish() override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    finishing_ = true;
+    Status st = StartWritingUnlocked();
+    if (!st.ok()) {
+      return st;
+    }
+    return finished_;
+  }
+
+ private:
+  Status StartWritingUnlocked() {
+    if (writing_) {
+      return Status::OK();
+    }
+    writing_ = true;
+    auto self = shared_from_this();
+    return io::default_io_context().executor()->Spawn([self] { self->WriteLoop(); });
+  }
+
+  void WriteLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!pending_.empty()) {
+      auto batch = std::move(pending_.front());
+      pending_.pop_front();
+      if (paused_ &&
+          static_cast<int64_t>(pending_.size()) <= options_.max_buffered_batches / 2) {
+        paused_ = false;
+        backpressure_control_->Resume();
+      }
+      lock.unlock();
+      Status st = writer_->WriteRecordBatch(*batch);
+      lock.lock();
+      if (!st.ok()) {
+        status_ = std::move(st);
+        pending_.clear();
+        if (paused_) {
+          paused_ = false;
+          backpressure_control_->Resume();
+        }
+      }
+    }
+    writing_ = false;
+    if (!finishing_) {
+      return;
+    }
+    // Finish() was called and every batch is written
+    Status st = status_;
+    lock.unlock();
+    if (st.ok()) {
+      st = Close();
+    }
+    finished_.MarkFinished(std::move(st));
+  }
+
+  Status Close() {
+    if (auto client_writer = std::dynamic_pointer_cast<FlightStreamWriter>(writer_)) {
+      RETURN_NOT_OK(client_writer->DoneWriting());
+    }
+    if (!options_.writer) {
+      // Our own DoPut, wait for the server to accept the upload
+      return writer_->Close();
+    }
+    return Status::OK();
+  }
+
+  const FlightSinkNodeOptions options_;
+  std::shared_ptr<Schema> schema_;
+  acero::BackpressureControl* backpressure_control_ = nullptr;
+  std::shared_ptr<MetadataRecordBatchWriter> writer_;
+  std::unique_ptr<FlightMetadataReader> metadata_reader_;
+
+  std::mutex mutex_;
+  std::deque<std::shared_ptr<RecordBatch>> pending_;
+  Status status_;
+  bool paused_ = false;
+  bool writing_ = false;
+  bool finishing_ = false;
+  Future<> finished_;
+};
+
+arrow::Result<acero::ExecNode*> MakeFlightSinkNode(
+    acero::ExecPlan* plan, std::vector<acero::ExecNode*> inputs,
+    const acero::ExecNodeOptions& options) {
+  const auto& sink_options = checked_cast<const FlightSinkNodeOptions&>(options);
+  if (!sink_options.writer && !sink_options.client) {
+    return Status::Invalid("FlightSinkNodeOptions needs a client or a writer");
+  }
+  if (sink_options.max_buffered_batches < 1) {
+    return Status::Invalid("max_buffered_batches must be positive, got ",
+                           sink_options.max_buffered_batches);
+  }
+  auto consumer = std::make_shared<FlightWriterConsumer>(sink_options);
+  return acero::MakeExecNode("consuming_sink", plan, std::move(inputs),
+                             acero::ConsumingSinkNodeOptions(
+                                 std::move(consumer), /*names=*/{},
+                                 sink_options.sequence_output));
+}
+
+}  // namespace
+
+void RegisterAceroNodes() {
+  static std::once_flag flag;
+  std::call_once(flag, [] {
+    auto registry = acero::default_exec_factory_registry();
+    DCHECK_OK(registry->AddFactory(std::string(FlightSourceNodeOptions::kName),
+                                   MakeFlightSourceNode));
+    DCHECK_OK(registry->AddFactory(std::string(FlightSinkNodeOptions::kName),
+                                   MakeFlightSinkNode));
+  });
+}
+
+arrow::Result<std::unique_ptr<FlightDataStream>> DeclarationToFlightDataStream(
+    acero::Declaration declaration, bool use_threads,
+    const ipc::IpcWriteOptions& options) {
+  RegisterAceroNodes();
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatchReader> reader,
+                        acero::DeclarationToReader(std::move(declaration), use_threads));
+  return std::make_unique<RecordBatchStream>(reader, options);
+}
+
+Status ExecuteExchange(
+    std::unique_ptr<FlightMessageReader> reader,
+    std::unique_ptr<FlightMessageWriter> writer,
+    std::function<arrow::Result<acero::Declaration>(acero::Declaration)> make_plan,
+    bool use_threads) {
+  RegisterAceroNodes();
+  acero::Declaration source{std::string(FlightSourceNodeOptions::kName),
+                            FlightSourceNodeOptions(std::move(reader))};
+  ARROW_ASSIGN_OR_RAISE(acero::Declaration plan, make_plan(std::move(source)));
+  acero::Declaration sink{std::string(FlightSinkNodeOptions::kName),
+                          {std::move(plan)},
+                          FlightSinkNodeOptions(std::move(writer))};
+  return acero::DeclarationToStatus(std::move(sink), use_threads);
+}
+
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,151 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Acero nodes reading and writing Flight streams, to run the parts of a
+// plan in different processes. Only available when Arrow is built with
+// ARROW_ACERO.
+//
+// This API is EXPERIMENTAL.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/flight/client.h"
+#include "arrow/flight/server.h"
+#include "arrow/flight/type_fwd.h"
+#include "arrow/flight/types.h"
+#include "arrow/flight/visibility.h"
+#include "arrow/ipc/options.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+
+namespace arrow {
+namespace flight {
+
+/// \brief Options for a "flight_source" node, which reads a Flight stream
+///     into a plan.
+///
+/// The node either issues a DoGet for `ticket` with `client`, or reads
+/// an already open `reader`: the client data of a DoPut or DoExchange
+/// handler on a server, or the server data of a DoExchange on a client.
+///
+/// The stream is read on the I/O executor, at most `max_readahead`
+/// batches ahead of the plan. When the plan stops consuming, reading
+/// stops too and the transport's flow control holds back the peer.
+/// Batches are numbered in stream order, so the output of the node has
+/// the implicit ordering of the stream.
+class ARROW_FLIGHT_EXPORT FlightSourceNodeOptions : public acero::ExecNodeOptions {
+ public:
+  static constexpr std::string_view kName = "flight_source";
+
+  /// \brief Read the stream of a ticket.
+  FlightSourceNodeOptions(std::shared_ptr<FlightClient> client, Ticket ticket,
+                          FlightCallOptions call_options = {})
+      : client(std::move(client)),
+        ticket(std::move(ticket)),
+        call_options(std::move(call_options)) {}
+
+  /// \brief Read an already open stream.
+  explicit FlightSourceNodeOptions(std::shared_ptr<MetadataRecordBatchReader> reader)
+      : reader(std::move(reader)) {}
+
+  std::shared_ptr<FlightClient> client;
+  Ticket ticket;
+  FlightCallOptions call_options;
+  /// \brief The stream to read, instead of a DoGet of `ticket`.
+  std::shared_ptr<MetadataRecordBatchReader> reader;
+  /// \brief The maximum number of batches read ahead of the plan.
+  int max_readahead = 8;
+};
+
+/// \brief Options for a "flight_sink" node, which writes the output of a
+///     plan to a Flight stream.
+///
+/// The node either uploads its input to `descriptor` with a DoPut of
+/// `client`, or writes to an already open `writer`: the server data of
+/// a DoExchange handler, or the client data of a DoExchange on a client.
+/// An open writer is begun with the schema of the input, and is not
+/// closed by the node; a client writer is only marked as done writing.
+///
+/// Batches are written one at a time on the I/O executor. When more
+/// than `max_buffered_batches` wait for the transport, the plan is
+/// paused until half of them are written.
+class ARROW_FLIGHT_EXPORT FlightSinkNodeOptions : public acero::ExecNodeOptions {
+ public:
+  static constexpr std::string_view kName = "flight_sink";
+
+  /// \brief Upload to a descriptor with DoPut.
+  FlightSinkNodeOptions(std::shared_ptr<FlightClient> client,
+                        FlightDescriptor descriptor,
+                        FlightCallOptions call_options = {})
+      : client(std::move(client)),
+        descriptor(std::move(descriptor)),
+        call_options(std::move(call_options)) {}
+
+  /// \brief Write to an already open stream.
+  explicit FlightSinkNodeOptions(std::shared_ptr<MetadataRecordBatchWriter> writer)
+      : writer(std::move(writer)) {}
+
+  std::shared_ptr<FlightClient> client;
+  FlightDescriptor descriptor;
+  FlightCallOptions call_options;
+  /// \brief The stream to write, instead of a DoPut to `descriptor`.
+  std::shared_ptr<MetadataRecordBatchWriter> writer;
+  /// \brief The maximum number of batches waiting to be written.
+  int max_buffered_batches = 8;
+  /// \brief Whether batches are written in the order of the plan.
+  ///
+  /// \see acero::QueryOptions::sequence_output
+  std::optional<bool> sequence_output;
+};
+
+/// \brief Register the "flight_source" and "flight_sink" nodes with the
+///     default exec factory registry.
+///
+/// This function must be called before declaring these nodes. It is
+/// safe to call it several times.
+ARROW_FLIGHT_EXPORT void RegisterAceroNodes();
+
+/// \brief Serve the output of a plan as the stream of a DoGet.
+///
+/// The plan starts running when the stream is created and is paused
+/// while the client does not keep up.
+ARROW_FLIGHT_EXPORT arrow::Result<std::unique_ptr<FlightDataStream>>
+DeclarationToFlightDataStream(
+    acero::Declaration declaration, bool use_threads = true,
+    const ipc::IpcWriteOptions& options = ipc::IpcWriteOptions::Defaults());
+
+/// \brief Run a plan over the client data of a DoExchange and send its
+///     output back to the client.
+///
+/// `make_plan` receives the "flight_source" declaration of the client
+/// data and returns the plan to run on it; its output is written to
+/// `writer`. This blocks until the plan has finished.
+ARROW_FLIGHT_EXPORT Status ExecuteExchange(
+    std::unique_ptr<FlightMessageReader> reader,
+    std::unique_ptr<FlightMessageWriter> writer,
+    std::function<arrow::Result<acero::Declaration>(acero::Declaration)> make_plan,
+    bool use_threads = true);
+
+}  // namespace flight
+}  // namespace arrow
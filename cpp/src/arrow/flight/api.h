@@ -20,6 +20,7 @@
 #include "arrow/flight/client.h"
 #include "arrow/flight/client_auth.h"
 #include "arrow/flight/client_middleware.h"
+#include "arrow/flight/client_pool.h"
 #include "arrow/flight/client_tracing_middleware.h"
 #include "arrow/flight/middleware.h"
 #include "arrow/flight/server.h"
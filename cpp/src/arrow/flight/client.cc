@@ -20,25 +20,40 @@
 // Platform-specific defines
 #include "arrow/flight/platform.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/ipc/options.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/util/byte_size.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/config.h"
 #include "arrow/util/future.h"
 #include "arrow/util/logging_internal.h"
 
 #include "arrow/flight/client_auth.h"
+#include "arrow/flight/client_pool.h"
 #include "arrow/flight/serialization_internal.h"
 #include "arrow/flight/transport.h"
 #include "arrow/flight/transport/grpc/grpc_client.h"
+#ifdef ARROW_WITH_UCX
+#  include "arrow/flight/transport/ucx/ucx.h"
+#endif
 #include "arrow/flight/types.h"
 #include "arrow/flight/types_async.h"
 
@@ -80,6 +95,20 @@ class UnaryUnaryAsyncListener : public AsyncListener<T> {
   arrow::Result<T> result_;
   arrow::Future<T> future_;
 };
+
+/// \brief Add the accepted compression header to the options of a call, if needed.
+const FlightCallOptions& WithAcceptedCompression(const FlightCallOptions& options,
+                                                 FlightCallOptions* storage) {
+  if (options.accepted_compression.empty()) return options;
+  std::string codecs;
+  for (const auto codec : options.accepted_compression) {
+    if (!codecs.empty()) codecs += ",";
+    codecs += util::Codec::GetCodecAsString(codec);
+  }
+  *storage = options;
+  storage->headers.emplace_back(kAcceptCompressionHeader, std::move(codecs));
+  return *storage;
+}
 }  // namespace
 
 const char* kWriteSizeDetailTypeId = "flight::FlightWriteSizeStatusDetail";
@@ -110,6 +139,10 @@ std::shared_ptr<FlightWriteSizeStatusDetail> FlightWriteSizeStatusDetail::Unwrap
 
 FlightClientOptions FlightClientOptions::Defaults() { return FlightClientOptions(); }
 
+FlightEndpointFetchOptions FlightEndpointFetchOptions::Defaults() {
+  return FlightEndpointFetchOptions();
+}
+
 arrow::Result<std::shared_ptr<Table>> FlightStreamReader::ToTable(
     const StopToken& stop_token) {
   ARROW_ASSIGN_OR_RAISE(auto batches, ToRecordBatches(stop_token));
@@ -185,7 +218,9 @@ class ClientStreamReader : public FlightStreamReader {
         stop_token_(std::move(stop_token)),
         memory_manager_(std::move(memory_manager)),
         peekable_reader_(new internal::PeekableFlightDataReader(stream_.get())),
-        app_metadata_(nullptr) {}
+        app_metadata_(nullptr) {
+    options_.memory_pool = ChildMemoryPool(options_.memory_pool, "flight");
+  }
 
   Status EnsureDataStarted() {
     if (!batch_reader_) {
@@ -545,6 +580,266 @@ class ClientStreamWriter : public FlightStreamWriter {
   FlightDescriptor descriptor_;
 };
 
+/// \brief Reads all endpoints of a flight with a set of worker threads.
+class EndpointFetchReader : public RecordBatchReader {
+ public:
+  EndpointFetchReader(FlightClient* client, FlightCallOptions call_options,
+                      std::vector<FlightEndpoint> endpoints,
+                      FlightEndpointFetchOptions fetch_options)
+      : client_(client),
+        call_options_(std::move(call_options)),
+        endpoints_(std::move(endpoints)),
+        fetch_options_(std::move(fetch_options)),
+        client_pool_(fetch_options_.client_pool),
+        queues_(fetch_options_.ordered ? endpoints_.size() : 1),
+        finished_(endpoints_.size(), false) {
+    if (!client_pool_) {
+      // Connections are private to this call
+      FlightClientPoolOptions pool_options;
+      pool_options.client_options = fetch_options_.client_options;
+      pool_options.idle_timeout = std::chrono::seconds(0);
+      client_pool_ = std::make_shared<FlightClientPool>(std::move(pool_options));
+      owns_client_pool_ = true;
+    }
+  }
+
+  ~EndpointFetchReader() override {
+    ARROW_WARN_NOT_OK(Close(), "EndpointFetchReader::~EndpointFetchReader(): Close() failed");
+  }
+
+  Status Init(std::shared_ptr<Schema> schema) {
+    if (!schema) {
+      if (endpoints_.empty()) {
+        return Status::Invalid("FlightInfo has neither a schema nor endpoints");
+      }
+      // Open the first endpoint to learn the schema; the stream is
+      // then read by whichever worker picks up that endpoint
+      ARROW_ASSIGN_OR_RAISE(first_stream_, OpenEndpoint(endpoints_[0], 0));
+      ARROW_ASSIGN_OR_RAISE(schema, first_stream_.stream->GetSchema());
+    }
+    schema_ = std::move(schema);
+
+    const size_t num_workers =
+        std::min(endpoints_.size(), static_cast<size_t>(fetch_options_.max_concurrency));
+    for (size_t i = 0; i < num_workers; i++) {
+      workers_.emplace_back([this] { RunWorker(); });
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      if (!error_.ok()) return error_;
+      if (closed_) {
+        return Status::Invalid("Reader is closed");
+      }
+      if (fetch_options_.ordered && current_ == endpoints_.size()) {
+        break;
+      }
+      auto& queue = queues_[fetch_options_.ordered ? current_ : 0];
+      if (!queue.empty()) {
+        buffered_bytes_ -= queue.front().second;
+        *out = std::move(queue.front().first);
+        queue.pop_front();
+        producer_cv_.notify_all();
+        return Status::OK();
+      }
+      if (fetch_options_.ordered && finished_[current_]) {
+        current_++;
+        producer_cv_.notify_all();
+        continue;
+      }
+      if (!fetch_options_.ordered && num_finished_ == endpoints_.size()) {
+        break;
+      }
+      consumer_cv_.wait(lock);
+    }
+    out->reset();
+    return Status::OK();
+  }
+
+  Status Close() override {
+    std::vector<std::thread> workers;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!closed_) {
+        closed_ = true;
+        for (auto* stream : active_streams_) stream->Cancel();
+      }
+      workers = std::move(workers_);
+    }
+    producer_cv_.notify_all();
+    consumer_cv_.notify_all();
+    for (auto& worker : workers) worker.join();
+
+    if (first_stream_.stream) {
+      first_stream_.stream->Cancel();
+      first_stream_ = {};
+    }
+    queues_.clear();
+    return owns_client_pool_ ? client_pool_->Close() : Status::OK();
+  }
+
+ private:
+  /// \brief A DoGet in progress, with the client it was made on.
+  struct EndpointStream {
+    // Declared first so that the stream is destroyed before the
+    // client is released
+    std::shared_ptr<FlightClient> client;
+    std::unique_ptr<FlightStreamReader> stream;
+    size_t location = 0;
+  };
+
+  void RunWorker() {
+    while (true) {
+      size_t index;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (closed_ || !error_.ok() || next_endpoint_ == endpoints_.size()) return;
+        index = next_endpoint_++;
+      }
+      Status status = FetchEndpoint(index);
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!status.ok() && error_.ok() && !closed_) {
+        error_ = std::move(status);
+        producer_cv_.notify_all();
+      }
+      finished_[index] = true;
+      num_finished_++;
+      consumer_cv_.notify_one();
+    }
+  }
+
+  /// \brief Read an endpoint, failing over to its next location if the
+  ///     current one fails before producing any data.
+  Status FetchEndpoint(size_t index) {
+    const FlightEndpoint& endpoint = endpoints_[index];
+    const size_t num_locations = std::max<size_t>(endpoint.locations.size(), 1);
+    size_t start = 0;
+    EndpointStream stream;
+    if (index == 0 && first_stream_.stream) {
+      stream = std::move(first_stream_);
+    }
+    while (true) {
+      if (!stream.stream) {
+        ARROW_ASSIGN_OR_RAISE(stream, OpenEndpoint(endpoint, start));
+      }
+      bool produced = false;
+      Status status = ReadEndpoint(index, stream.stream.get(), &produced);
+      start = stream.location + 1;
+      stream = {};
+      if (status.ok() || produced || start == num_locations) {
+        return status;
+      }
+    }
+  }
+
+  /// \brief Start a DoGet on the first location, from start, that accepts it.
+  arrow::Result<EndpointStream> OpenEndpoint(const FlightEndpoint& endpoint,
+                                             size_t start) {
+    const size_t num_locations = std::max<size_t>(endpoint.locations.size(), 1);
+    Status status;
+    for (size_t i = start; i < num_locations; i++) {
+      auto maybe_client = GetClient(endpoint, i);
+      if (!maybe_client.ok()) {
+        status = maybe_client.status();
+        continue;
+      }
+      auto maybe_stream = (*maybe_client)->DoGet(call_options_, endpoint.ticket);
+      if (!maybe_stream.ok()) {
+        status = maybe_stream.status();
+        continue;
+      }
+      return EndpointStream{maybe_client.MoveValueUnsafe(), maybe_stream.MoveValueUnsafe(),
+                            i};
+    }
+    return status;
+  }
+
+  arrow::Result<std::shared_ptr<FlightClient>> GetClient(const FlightEndpoint& endpoint,
+                                                         size_t i) {
+    if (endpoint.locations.empty() ||
+        endpoint.locations[i].Equals(Location::ReuseConnection())) {
+      // Not owned: the reader must not outlive the client
+      return std::shared_ptr<FlightClient>(std::shared_ptr<FlightClient>(), client_);
+    }
+    return client_pool_->GetClient(endpoint.locations[i]);
+  }
+
+  Status ReadEndpoint(size_t index, FlightStreamReader* stream, bool* produced) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (closed_) return Status::Cancelled("Endpoint fetch was closed");
+      active_streams_.insert(stream);
+    }
+    Status status = DrainStream(index, stream, produced);
+    std::lock_guard<std::mutex> lock(mutex_);
+    active_streams_.erase(stream);
+    return status;
+  }
+
+  Status DrainStream(size_t index, FlightStreamReader* stream, bool* produced) {
+    ARROW_ASSIGN_OR_RAISE(auto schema, stream->GetSchema());
+    if (!schema->Equals(*schema_)) {
+      return Status::Invalid("Endpoint ", index, " returned schema ", schema->ToString(),
+                             " but expected ", schema_->ToString());
+    }
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(FlightStreamChunk chunk, stream->Next());
+      if (!chunk.data) return Status::OK();
+      RETURN_NOT_OK(Push(index, std::move(chunk.data)));
+      *produced = true;
+    }
+  }
+
+  /// \brief Queue a batch, waiting for room in the byte budget.
+  Status Push(size_t index, std::shared_ptr<RecordBatch> batch) {
+    const int64_t size = util::TotalBufferSize(*batch);
+    std::unique_lock<std::mutex> lock(mutex_);
+    producer_cv_.wait(lock, [&] {
+      // The endpoint being consumed may always make progress, or later
+      // endpoints could use up the budget and stall the reader
+      return closed_ || !error_.ok() || buffered_bytes_ == 0 ||
+             buffered_bytes_ + size <= fetch_options_.max_buffered_bytes ||
+             (fetch_options_.ordered && index == current_ && queues_[index].empty());
+    });
+    if (closed_ || !error_.ok()) {
+      return Status::Cancelled("Endpoint fetch was stopped");
+    }
+    buffered_bytes_ += size;
+    queues_[fetch_options_.ordered ? index : 0].emplace_back(std::move(batch), size);
+    consumer_cv_.notify_one();
+    return Status::OK();
+  }
+
+  FlightClient* client_;
+  const FlightCallOptions call_options_;
+  const std::vector<FlightEndpoint> endpoints_;
+  const FlightEndpointFetchOptions fetch_options_;
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<FlightClientPool> client_pool_;
+  bool owns_client_pool_ = false;
+  EndpointStream first_stream_;
+  std::vector<std::thread> workers_;
+
+  std::mutex mutex_;
+  std::condition_variable producer_cv_;
+  std::condition_variable consumer_cv_;
+  // Per-endpoint queues if ordered, else a single queue
+  std::vector<std::deque<std::pair<std::shared_ptr<RecordBatch>, int64_t>>> queues_;
+  std::vector<bool> finished_;
+  std::unordered_set<FlightStreamReader*> active_streams_;
+  size_t next_endpoint_ = 0;
+  size_t current_ = 0;
+  size_t num_finished_ = 0;
+  int64_t buffered_bytes_ = 0;
+  bool closed_ = false;
+  Status error_;
+};
+
 FlightClient::FlightClient() : closed_(false), write_size_limit_bytes_(0) {}
 
 FlightClient::~FlightClient() {
@@ -559,6 +854,9 @@ arrow::Result<std::unique_ptr<FlightClient>> FlightClient::Connect(
 arrow::Result<std::unique_ptr<FlightClient>> FlightClient::Connect(
     const Location& location, const FlightClientOptions& options) {
   flight::transport::grpc::InitializeFlightGrpcClient();
+#ifdef ARROW_WITH_UCX
+  flight::transport::ucx::InitializeFlightUcx();
+#endif
 
   std::unique_ptr<FlightClient> client(new FlightClient());
   client->write_size_limit_bytes_ = options.write_size_limit_bytes;
@@ -678,7 +976,9 @@ arrow::Result<std::unique_ptr<FlightStreamReader>> FlightClient::DoGet(
     const FlightCallOptions& options, const Ticket& ticket) {
   RETURN_NOT_OK(CheckOpen());
   std::unique_ptr<internal::ClientDataStream> remote_stream;
-  RETURN_NOT_OK(transport_->DoGet(options, ticket, &remote_stream));
+  FlightCallOptions with_compression;
+  RETURN_NOT_OK(transport_->DoGet(WithAcceptedCompression(options, &with_compression),
+                                  ticket, &remote_stream));
   std::unique_ptr<FlightStreamReader> stream_reader =
       std::make_unique<ClientStreamReader>(std::move(remote_stream), options.read_options,
                                            options.stop_token, options.memory_manager);
@@ -688,6 +988,22 @@ arrow::Result<std::unique_ptr<FlightStreamReader>> FlightClient::DoGet(
   return stream_reader;
 }
 
+arrow::Result<std::shared_ptr<RecordBatchReader>> FlightClient::DoGetEndpoints(
+    const FlightCallOptions& options, const FlightInfo& info,
+    const FlightEndpointFetchOptions& fetch_options) {
+  RETURN_NOT_OK(CheckOpen());
+  if (fetch_options.max_concurrency < 1) {
+    return Status::Invalid("max_concurrency must be positive, got ",
+                           fetch_options.max_concurrency);
+  }
+  ipc::DictionaryMemo dictionary_memo;
+  ARROW_ASSIGN_OR_RAISE(auto schema, info.GetSchema(&dictionary_memo));
+  auto reader = std::make_shared<EndpointFetchReader>(this, options, info.endpoints(),
+                                                      fetch_options);
+  RETURN_NOT_OK(reader->Init(std::move(schema)));
+  return reader;
+}
+
 arrow::Result<FlightClient::DoPutResult> FlightClient::DoPut(
     const FlightCallOptions& options, const FlightDescriptor& descriptor,
     const std::shared_ptr<Schema>& schema) {
@@ -708,7 +1024,9 @@ arrow::Result<FlightClient::DoExchangeResult> FlightClient::DoExchange(
     const FlightCallOptions& options, const FlightDescriptor& descriptor) {
   RETURN_NOT_OK(CheckOpen());
   std::unique_ptr<internal::ClientDataStream> remote_stream;
-  RETURN_NOT_OK(transport_->DoExchange(options, &remote_stream));
+  FlightCallOptions with_compression;
+  RETURN_NOT_OK(transport_->DoExchange(WithAcceptedCompression(options, &with_compression),
+                                       &remote_stream));
   std::shared_ptr<internal::ClientDataStream> shared_stream = std::move(remote_stream);
   DoExchangeResult result;
   result.reader = std::make_unique<ClientStreamReader>(
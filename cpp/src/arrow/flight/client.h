@@ -72,6 +72,13 @@ class ARROW_FLIGHT_EXPORT FlightCallOptions {
 
   /// \brief An optional memory manager to control where to allocate incoming data.
   std::shared_ptr<MemoryManager> memory_manager;
+
+  /// \brief The codecs the server may compress the data it sends with.
+  ///
+  /// Sent with DoGet and DoExchange calls; the server picks one with
+  /// NegotiateStreamCompression. Compressed data is decompressed
+  /// transparently.
+  std::vector<Compression::type> accepted_compression;
 };
 
 /// \brief Indicate that the client attempted to write a message
@@ -126,6 +133,37 @@ struct ARROW_FLIGHT_EXPORT FlightClientOptions {
   static FlightClientOptions Defaults();
 };
 
+/// \brief Options for FlightClient::DoGetEndpoints.
+struct ARROW_FLIGHT_EXPORT FlightEndpointFetchOptions {
+  /// \brief The maximum number of endpoints to read from at once.
+  int max_concurrency = 8;
+  /// \brief A soft limit on the number of bytes of fetched record
+  ///     batches not yet consumed by the reader.
+  ///
+  /// Fetching an endpoint pauses while the limit is exceeded. A batch
+  /// is always accepted when nothing is buffered, and in ordered mode
+  /// the endpoint being consumed may always make progress, so a single
+  /// batch larger than the limit does not stall the fetch.
+  int64_t max_buffered_bytes = 256 * 1024 * 1024;
+  /// \brief Whether to return the batches in endpoint order.
+  ///
+  /// If false, batches are returned as soon as they arrive, from
+  /// whichever endpoint produced them. This is appropriate when
+  /// FlightInfo::ordered() is false.
+  bool ordered = true;
+  /// \brief Options used to connect to endpoint locations other than
+  ///     the one of the client doing the fetch, if client_pool is null.
+  FlightClientOptions client_options = FlightClientOptions::Defaults();
+  /// \brief A pool to take the clients for other locations from.
+  ///
+  /// If null, the clients are private to the call, connected with
+  /// client_options, and closed with the reader.
+  std::shared_ptr<FlightClientPool> client_pool;
+
+  /// \brief Get default options.
+  static FlightEndpointFetchOptions Defaults();
+};
+
 /// \brief A RecordBatchReader exposing Flight metadata and cancel
 /// operations.
 class ARROW_FLIGHT_EXPORT FlightStreamReader : public MetadataRecordBatchReader {
@@ -343,6 +381,32 @@ class ARROW_FLIGHT_EXPORT FlightClient {
     return DoGet({}, ticket);
   }
 
+  /// \brief Fetch the data of all endpoints of a flight concurrently.
+  ///
+  /// The endpoints are read by up to fetch_options.max_concurrency
+  /// background threads. The locations of an endpoint are tried in
+  /// order until one of them returns data; an endpoint without
+  /// locations, or whose location is Location::ReuseConnection(), is
+  /// read through this client. Other locations are read through
+  /// clients from fetch_options.client_pool.
+  ///
+  /// A location is only abandoned for the next one if it fails before
+  /// producing a batch; afterwards the error is returned by the reader.
+  ///
+  /// If the FlightInfo carries no schema, the first endpoint is opened
+  /// synchronously to learn it.
+  ///
+  /// The returned reader must be closed or destroyed before this client.
+  ///
+  /// \param[in] options Per-RPC options, used for every DoGet
+  /// \param[in] info The flight to fetch
+  /// \param[in] fetch_options Concurrency and buffering options
+  /// \return Arrow result with a RecordBatchReader over all endpoints
+  arrow::Result<std::shared_ptr<RecordBatchReader>> DoGetEndpoints(
+      const FlightCallOptions& options, const FlightInfo& info,
+      const FlightEndpointFetchOptions& fetch_options =
+          FlightEndpointFetchOptions::Defaults());
+
   /// \brief DoPut return value
   struct DoPutResult {
     /// \brief a writer to write record batches to
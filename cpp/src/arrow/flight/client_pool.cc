@@ -0,0 +1,136 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/client_pool.h"
+
+#include <utility>
+
+#include "arrow/flight/types.h"
+#include "arrow/util/logging_internal.h"
+
+namespace arrow {
+namespace flight {
+
+FlightClientPoolOptions FlightClientPoolOptions::Defaults() {
+  return FlightClientPoolOptions();
+}
+
+FlightClientPool::FlightClientPool(FlightClientPoolOptions options)
+    : options_(std::move(options)) {}
+
+FlightClientPool::~FlightClientPool() {
+  ARROW_WARN_NOT_OK(Close(), "FlightClientPool::~FlightClientPool(): Close() failed");
+}
+
+arrow::Result<std::shared_ptr<FlightClient>> FlightClientPool::GetClient(
+    const Location& location) {
+  if (options_.max_clients_per_location < 1) {
+    return Status::Invalid("max_clients_per_location must be positive, got ",
+                           options_.max_clients_per_location);
+  }
+  const auto now = std::chrono::steady_clock::now();
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (closed_) {
+    return Status::Invalid("FlightClientPool is closed");
+  }
+  RETURN_NOT_OK(CloseIdleClientsUnlocked(now));
+
+  auto& clients = clients_[location.ToString()];
+  // Only the pool holds a reference to an unused client, and no
+  // other reference can be made without the lock, so use_count() is
+  // reliable for finding one
+  PooledClient* least_used = nullptr;
+  for (auto& pooled : clients) {
+    if (!least_used || pooled.client.use_count() < least_used->client.use_count()) {
+      least_used = &pooled;
+    }
+  }
+  if (!least_used || (least_used->client.use_count() > 1 &&
+                      clients.size() <
+                          static_cast<size_t>(options_.max_clients_per_location))) {
+    auto maybe_client = FlightClient::Connect(location, options_.client_options);
+    if (!maybe_client.ok()) {
+      if (clients.empty()) clients_.erase(location.ToString());
+      return maybe_client.status();
+    }
+    clients.push_back({std::move(maybe_client).ValueUnsafe(), now});
+    least_used = &clients.back();
+  }
+  least_used->last_used = now;
+  return least_used->client;
+}
+
+Status FlightClientPool::CloseIdleClients() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return CloseIdleClientsUnlocked(std::chrono::steady_clock::now());
+}
+
+Status FlightClientPool::CloseIdleClientsUnlocked(
+    std::chrono::steady_clock::time_point now) {
+  if (options_.idle_timeout.count() <= 0) return Status::OK();
+  Status status;
+  for (auto it = clients_.begin(); it != clients_.end();) {
+    auto& clients = it->second;
+    for (size_t i = 0; i < clients.size();) {
+      auto& pooled = clients[i];
+      if (pooled.client.use_count() > 1) {
+        // Still in use, so not idle yet
+        pooled.last_used = now;
+      } else if (now - pooled.last_used > options_.idle_timeout) {
+        status &= pooled.client->Close();
+        clients.erase(clients.begin() + i);
+        continue;
+      }
+      i++;
+    }
+    if (clients.empty()) {
+      it = clients_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  return status;
+}
+
+int64_t FlightClientPool::num_clients() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  int64_t count = 0;
+  for (const auto& entry : clients_) {
+    count += static_cast<int64_t>(entry.second.size());
+  }
+  return count;
+}
+
+Status FlightClientPool::Close() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (closed_) return Status::OK();
+  closed_ = true;
+  Status status;
+  for (auto& entry : clients_) {
+    for (auto& pooled : entry.second) {
+      // Clients still in use are closed by their destructor once released
+      if (pooled.client.use_count() == 1) {
+        status &= pooled.client->Close();
+      }
+    }
+  }
+  clients_.clear();
+  return status;
+}
+
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,112 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// A pool of FlightClients shared by calls to many locations.
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "arrow/flight/client.h"
+#include "arrow/flight/type_fwd.h"
+#include "arrow/flight/visibility.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+
+namespace arrow {
+namespace flight {
+
+/// \brief Options for a FlightClientPool.
+struct ARROW_FLIGHT_EXPORT FlightClientPoolOptions {
+  /// \brief The options every client of the pool is connected with.
+  ///
+  /// Middleware factories are shared by all clients of the pool, and
+  /// are called for each call made with any of them.
+  FlightClientOptions client_options = FlightClientOptions::Defaults();
+  /// \brief The maximum number of clients connected to one location.
+  ///
+  /// Each client has its own connection. A new one is only made when
+  /// all clients of the location are in use.
+  int max_clients_per_location = 4;
+  /// \brief How long an unused client is kept before it is closed.
+  ///
+  /// Zero or negative values keep unused clients until the pool is
+  /// closed.
+  std::chrono::duration<double> idle_timeout = std::chrono::seconds(60);
+
+  /// \brief Get default options.
+  static FlightClientPoolOptions Defaults();
+};
+
+/// \brief A thread-safe pool of FlightClients keyed by Location.
+///
+/// Connecting a FlightClient sets up a new channel, which with TLS
+/// and HTTP/2 can dominate the latency of short calls. A pool hands
+/// out already connected clients instead, spreading concurrent users
+/// of a location over up to max_clients_per_location connections.
+///
+/// A client is in use while a shared_ptr returned by GetClient() is
+/// alive. Clients that have been unused for longer than the idle
+/// timeout are closed the next time the pool is accessed, or by
+/// CloseIdleClients().
+class ARROW_FLIGHT_EXPORT FlightClientPool {
+ public:
+  explicit FlightClientPool(
+      FlightClientPoolOptions options = FlightClientPoolOptions::Defaults());
+  ~FlightClientPool();
+
+  /// \brief Get a client connected to a location.
+  ///
+  /// An unused client of the location is preferred; otherwise a new
+  /// one is connected if the location has fewer than
+  /// max_clients_per_location clients, else the least used client is
+  /// shared.
+  arrow::Result<std::shared_ptr<FlightClient>> GetClient(const Location& location);
+
+  /// \brief Close the clients that exceeded the idle timeout.
+  Status CloseIdleClients();
+
+  /// \brief The number of clients currently connected.
+  int64_t num_clients() const;
+
+  /// \brief Close all clients and invalidate the pool.
+  ///
+  /// Clients still in use are closed when their last user releases
+  /// them.
+  Status Close();
+
+ private:
+  struct PooledClient {
+    std::shared_ptr<FlightClient> client;
+    std::chrono::steady_clock::time_point last_used;
+  };
+
+  Status CloseIdleClientsUnlocked(std::chrono::steady_clock::time_point now);
+
+  const FlightClientPoolOptions options_;
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, std::vector<PooledClient>> clients_;
+  bool closed_ = false;
+};
+
+}  // namespace flight
+}  // namespace arrow
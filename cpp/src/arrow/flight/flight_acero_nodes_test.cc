@@ -0,0 +1,179 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/compute/expression.h"
+#include "arrow/flight/acero_nodes.h"
+#include "arrow/flight/client.h"
+#include "arrow/flight/server.h"
+#include "arrow/flight/types.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace flight {
+
+namespace {
+
+std::shared_ptr<Table> ExampleTable() {
+  return TableFromJSON(schema({field("a", int64())}),
+                       {R"([{"a": 1}, {"a": 2}, {"a": 3}])",
+                        R"([{"a": 4}, {"a": null}, {"a": 6}, {"a": 7}])"});
+}
+
+// Serves ExampleTable() with DoGet, keeps the data uploaded with DoPut
+// and doubles the data of a DoExchange
+class AceroTestServer : public FlightServerBase {
+ public:
+  Status DoGet(const ServerCallContext& context, const Ticket& request,
+               std::unique_ptr<FlightDataStream>* stream) override {
+    acero::Declaration plan{"table_source",
+                            acero::TableSourceNodeOptions(ExampleTable(),
+                                                          /*max_batch_size=*/2)};
+    return DeclarationToFlightDataStream(std::move(plan)).Value(stream);
+  }
+
+  Status DoPut(const ServerCallContext& context,
+               std::unique_ptr<FlightMessageReader> reader,
+               std::unique_ptr<FlightMetadataWriter> writer) override {
+    ARROW_ASSIGN_OR_RAISE(auto table, reader->ToTable());
+    std::lock_guard<std::mutex> lock(mutex_);
+    uploaded_ = std::move(table);
+    return Status::OK();
+  }
+
+  Status DoExchange(const ServerCallContext& context,
+                    std::unique_ptr<FlightMessageReader> reader,
+                    std::unique_ptr<FlightMessageWriter> writer) override {
+    return ExecuteExchange(
+        std::move(reader), std::move(writer),
+        [](acero::Declaration source) -> arrow::Result<acero::Declaration> {
+          compute::Expression doubled =
+              compute::call("multiply", {compute::field_ref("a"), compute::literal(2)});
+          return acero::Declaration{"project",
+                                    {std::move(source)},
+                                    acero::ProjectNodeOptions({doubled}, {"a"})};
+        });
+  }
+
+  std::shared_ptr<Table> uploaded() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return uploaded_;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::shared_ptr<Table> uploaded_;
+};
+
+}  // namespace
+
+class TestAceroNodes : public ::testing::Test {
+ public:
+  void SetUp() override {
+    RegisterAceroNodes();
+    server_ = std::make_unique<AceroTestServer>();
+    ASSERT_OK_AND_ASSIGN(auto location, Location::ForGrpcTcp("localhost", 0));
+    ASSERT_OK(server_->Init(FlightServerOptions(location)));
+    ASSERT_OK_AND_ASSIGN(location, Location::ForGrpcTcp("localhost", server_->port()));
+    ASSERT_OK_AND_ASSIGN(client_, FlightClient::Connect(location));
+  }
+
+  void TearDown() override {
+    ASSERT_OK(client_->Close());
+    ASSERT_OK(server_->Shutdown());
+  }
+
+ protected:
+  std::unique_ptr<AceroTestServer> server_;
+  std::shared_ptr<FlightClient> client_;
+};
+
+TEST_F(TestAceroNodes, SourceDoGet) {
+  for (bool use_threads : {false, true}) {
+    acero::Declaration plan{"flight_source",
+                            FlightSourceNodeOptions(client_, Ticket{""})};
+    ASSERT_OK_AND_ASSIGN(auto table, acero::DeclarationToTable(plan, use_threads));
+    // The batches keep the order of the stream
+    AssertTablesEqual(*ExampleTable(), *table, /*same_chunk_layout=*/false);
+  }
+}
+
+TEST_F(TestAceroNodes, SinkDoPut) {
+  for (int max_buffered_batches : {1, 8}) {
+    FlightSinkNodeOptions sink_options(client_, FlightDescriptor::Path({"upload"}));
+    sink_options.max_buffered_batches = max_buffered_batches;
+    auto plan = acero::Declaration::Sequence(
+        {{"table_source",
+          acero::TableSourceNodeOptions(ExampleTable(), /*max_batch_size=*/1)},
+         {"flight_sink", std::move(sink_options)}});
+    ASSERT_OK(acero::DeclarationToStatus(std::move(plan)));
+    ASSERT_NE(server_->uploaded(), nullptr);
+    AssertTablesEqual(*ExampleTable(), *server_->uploaded(), /*same_chunk_layout=*/false);
+  }
+}
+
+TEST_F(TestAceroNodes, Exchange) {
+  ASSERT_OK_AND_ASSIGN(auto exchange,
+                       client_->DoExchange(FlightDescriptor::Command("double")));
+  std::shared_ptr<FlightStreamWriter> writer = std::move(exchange.writer);
+  std::shared_ptr<FlightStreamReader> reader = std::move(exchange.reader);
+
+  // Send the data with one plan and read the result with another
+  auto send = acero::Declaration::Sequence(
+      {{"table_source", acero::TableSourceNodeOptions(ExampleTable(),
+                                                      /*max_batch_size=*/2)},
+       {"flight_sink", FlightSinkNodeOptions(writer)}});
+  ASSERT_OK(acero::DeclarationToStatus(std::move(send)));
+  acero::Declaration receive{"flight_source", FlightSourceNodeOptions(reader)};
+  ASSERT_OK_AND_ASSIGN(auto table, acero::DeclarationToTable(std::move(receive)));
+  ASSERT_OK(writer->Close());
+
+  auto expected =
+      TableFromJSON(schema({field("a", int64())}),
+                    {R"([{"a": 2}, {"a": 4}, {"a": 6}, {"a": 8}, {"a": null},
+                         {"a": 12}, {"a": 14}])"});
+  AssertTablesEqual(*expected, *table, /*same_chunk_layout=*/false);
+}
+
+TEST_F(TestAceroNodes, InvalidOptions) {
+  acero::Declaration source{"flight_source",
+                            FlightSourceNodeOptions(std::shared_ptr<FlightClient>(),
+                                                    Ticket{""})};
+  ASSERT_RAISES(Invalid, acero::DeclarationToTable(source));
+
+  FlightSourceNodeOptions no_readahead(client_, Ticket{""});
+  no_readahead.max_readahead = 0;
+  ASSERT_RAISES(Invalid, acero::DeclarationToTable({"flight_source", no_readahead}));
+
+  auto sink = acero::Declaration::Sequence(
+      {{"table_source", acero::TableSourceNodeOptions(ExampleTable())},
+       {"flight_sink",
+        FlightSinkNodeOptions(std::shared_ptr<MetadataRecordBatchWriter>())}});
+  ASSERT_RAISES(Invalid, acero::DeclarationToStatus(std::move(sink)));
+}
+
+}  // namespace flight
+}  // namespace arrow
@@ -46,7 +46,8 @@
 
 DEFINE_bool(cuda, false, "Allocate results in CUDA memory");
 DEFINE_string(transport, "grpc",
-              "The network transport to use. Supported: \"grpc\" (default).");
+              "The network transport to use. Supported: \"grpc\" (default), "
+              "\"ucx\" (if built with ARROW_WITH_UCX).");
 DEFINE_string(server_host, "",
               "An existing performance server to benchmark against (leave blank to spawn "
               "one automatically)");
@@ -499,6 +500,27 @@ int main(int argc, char** argv) {
         options.disable_server_verification = true;
       }
     }
+  } else if (FLAGS_transport == "ucx") {
+#ifdef ARROW_WITH_UCX
+    if (FLAGS_server_host == "") {
+      // The spawned server listens on IPv4 only
+      FLAGS_server_host = "127.0.0.1";
+      std::cout << "Using spawned UCX server" << std::endl;
+      server.reset(
+          new arrow::flight::TestServer("arrow-flight-perf-server", FLAGS_server_port));
+      ABORT_NOT_OK(server->Start(server_args));
+    } else {
+      std::cout << "Using standalone UCX server" << std::endl;
+    }
+    std::cout << "Server host: " << FLAGS_server_host << std::endl
+              << "Server port: " << FLAGS_server_port << std::endl;
+    ABORT_NOT_OK(
+        arrow::flight::Location::ForScheme("ucx", FLAGS_server_host, FLAGS_server_port)
+            .Value(&location));
+#else
+    std::cerr << "Not built with transport: " << FLAGS_transport << std::endl;
+    return EXIT_FAILURE;
+#endif
   } else {
     std::cerr << "Unknown transport: " << FLAGS_transport << std::endl;
     return EXIT_FAILURE;
@@ -730,6 +730,45 @@ TEST(GrpcTransport, FlightDataDeserialize) {
 #endif
 }
 
+TEST(GrpcTransport, FlightDataDeserializeSlices) {
+#ifndef _WIN32
+  const std::string metadata(64, 'm');
+  const std::string body(1024, 'b');
+  pb::FlightData raw;
+  raw.set_data_header(metadata);
+  raw.set_data_body(body);
+  auto serialized = raw.SerializeAsString();
+
+  // gRPC hands over large messages as several slices. Split the message
+  // so that the metadata lies in the first slice and the body spans the
+  // other two.
+  const size_t first = serialized.size() - 1000;
+  const size_t second = serialized.size() - 500;
+  grpc_slice slices[3] = {
+      grpc_slice_from_copied_buffer(serialized.data(), first),
+      grpc_slice_from_copied_buffer(serialized.data() + first, second - first),
+      grpc_slice_from_copied_buffer(serialized.data() + second,
+                                    serialized.size() - second)};
+  const uint8_t* first_begin = GRPC_SLICE_START_PTR(slices[0]);
+  const uint8_t* first_end = GRPC_SLICE_END_PTR(slices[0]);
+  grpc::ByteBuffer buffer(reinterpret_cast<const grpc::Slice*>(slices), /*nslices=*/3);
+  for (auto& slice : slices) {
+    grpc_slice_unref(slice);
+  }
+
+  flight::internal::FlightData out;
+  auto status = flight::transport::grpc::FlightDataDeserialize(&buffer, &out);
+  ASSERT_TRUE(status.ok());
+  ASSERT_EQ(body, out.body->ToString());
+  // The metadata references the first slice, which it keeps alive
+  ASSERT_EQ(metadata, out.metadata->ToString());
+  ASSERT_GE(out.metadata->data(), first_begin);
+  ASSERT_LE(out.metadata->data() + out.metadata->size(), first_end);
+#else
+  GTEST_SKIP() << "Can't use Protobuf symbols on Windows";
+#endif
+}
+
 // ----------------------------------------------------------------------
 // Transport abstraction tests
 
@@ -1131,6 +1131,113 @@ TEST_F(TestFlightClient, NoTimeout) {
   ASSERT_NE(nullptr, info);
 }
 
+TEST_F(TestFlightClient, ClientPool) {
+  ASSERT_OK_AND_ASSIGN(auto location,
+                       Location::ForGrpcTcp("localhost", server_->port()));
+  FlightClientPoolOptions options;
+  options.max_clients_per_location = 2;
+  options.idle_timeout = std::chrono::milliseconds(10);
+  FlightClientPool pool(options);
+
+  ASSERT_OK_AND_ASSIGN(auto client1, pool.GetClient(location));
+  ASSERT_OK_AND_ASSIGN(auto client2, pool.GetClient(location));
+  ASSERT_NE(client1, client2);
+  // Both clients are in use and the location is at its limit
+  ASSERT_OK_AND_ASSIGN(auto client3, pool.GetClient(location));
+  ASSERT_TRUE(client3 == client1 || client3 == client2);
+  ASSERT_EQ(2, pool.num_clients());
+  ASSERT_OK_AND_ASSIGN(auto listing, client3->ListFlights());
+
+  // Released clients are reused, then closed once idle
+  client1.reset();
+  client3.reset();
+  ASSERT_OK_AND_ASSIGN(client1, pool.GetClient(location));
+  ASSERT_NE(client1, client2);
+  ASSERT_EQ(2, pool.num_clients());
+  client1.reset();
+  client2.reset();
+  SleepFor(0.05);
+  ASSERT_OK(pool.CloseIdleClients());
+  ASSERT_EQ(0, pool.num_clients());
+
+  ASSERT_OK(pool.Close());
+  ASSERT_RAISES(Invalid, pool.GetClient(location));
+}
+
+TEST_F(TestFlightClient, DoGetEndpoints) {
+  ASSERT_OK_AND_ASSIGN(auto location,
+                       Location::ForGrpcTcp("localhost", server_->port()));
+  std::vector<FlightEndpoint> endpoints = {
+      {Ticket{"ticket-ints-1"}, {}, std::nullopt, ""},
+      {Ticket{"ticket-ints-1"}, {Location::ReuseConnection()}, std::nullopt, ""},
+      {Ticket{"ticket-ints-1"}, {location}, std::nullopt, ""},
+  };
+  ASSERT_OK_AND_ASSIGN(auto info, FlightInfo::Make(*ExampleIntSchema(), {}, endpoints,
+                                                   -1, -1, /*ordered=*/true));
+  RecordBatchVector expected;
+  ASSERT_OK(ExampleIntBatches(&expected));
+
+  FlightEndpointFetchOptions fetch_options;
+  fetch_options.max_concurrency = 2;
+  // Force the later endpoints to wait for the reader
+  fetch_options.max_buffered_bytes = 1;
+  fetch_options.client_pool = std::make_shared<FlightClientPool>();
+  ASSERT_OK_AND_ASSIGN(auto reader, client_->DoGetEndpoints({}, info, fetch_options));
+  AssertSchemaEqual(*ExampleIntSchema(), *reader->schema());
+  ASSERT_OK_AND_ASSIGN(auto batches, reader->ToRecordBatches());
+  ASSERT_EQ(expected.size() * endpoints.size(), batches.size());
+  for (size_t i = 0; i < batches.size(); i++) {
+    AssertBatchesEqual(*expected[i % expected.size()], *batches[i]);
+  }
+  ASSERT_OK(reader->Close());
+  ASSERT_EQ(1, fetch_options.client_pool->num_clients());
+}
+
+TEST_F(TestFlightClient, DoGetEndpointsUnordered) {
+  std::vector<FlightEndpoint> endpoints(4, {Ticket{"ticket-ints-1"}, {}, std::nullopt, ""});
+  ASSERT_OK_AND_ASSIGN(auto info,
+                       FlightInfo::Make(*ExampleIntSchema(), {}, endpoints, -1, -1));
+  RecordBatchVector expected;
+  ASSERT_OK(ExampleIntBatches(&expected));
+  int64_t expected_rows = 0;
+  for (const auto& batch : expected) expected_rows += batch->num_rows();
+
+  FlightEndpointFetchOptions fetch_options;
+  fetch_options.ordered = false;
+  ASSERT_OK_AND_ASSIGN(auto reader, client_->DoGetEndpoints({}, info, fetch_options));
+  ASSERT_OK_AND_ASSIGN(auto batches, reader->ToRecordBatches());
+  int64_t rows = 0;
+  for (const auto& batch : batches) rows += batch->num_rows();
+  ASSERT_EQ(expected_rows * 4, rows);
+}
+
+TEST_F(TestFlightClient, DoGetEndpointsFailover) {
+  // No server on the first location, so the second one should be used
+  ASSERT_OK_AND_ASSIGN(auto bad_location, Location::ForGrpcTcp("localhost", 30001));
+  ASSERT_OK_AND_ASSIGN(auto location,
+                       Location::ForGrpcTcp("localhost", server_->port()));
+  std::vector<FlightEndpoint> endpoints = {
+      {Ticket{"ticket-ints-1"}, {bad_location, location}, std::nullopt, ""},
+  };
+  // Without a schema, the first endpoint is opened to learn it
+  ASSERT_OK_AND_ASSIGN(auto info, FlightInfo::Make(nullptr, {}, endpoints, -1, -1));
+  RecordBatchVector expected;
+  ASSERT_OK(ExampleIntBatches(&expected));
+
+  ASSERT_OK_AND_ASSIGN(auto reader, client_->DoGetEndpoints({}, info));
+  AssertSchemaEqual(*ExampleIntSchema(), *reader->schema());
+  ASSERT_OK_AND_ASSIGN(auto batches, reader->ToRecordBatches());
+  ASSERT_EQ(expected.size(), batches.size());
+  for (size_t i = 0; i < batches.size(); i++) {
+    AssertBatchesEqual(*expected[i], *batches[i]);
+  }
+
+  endpoints[0].locations = {bad_location};
+  ASSERT_OK_AND_ASSIGN(info, FlightInfo::Make(*ExampleIntSchema(), {}, endpoints, -1, -1));
+  ASSERT_OK_AND_ASSIGN(reader, client_->DoGetEndpoints({}, info));
+  ASSERT_RAISES(IOError, reader->ToRecordBatches());
+}
+
 TEST_F(TestFlightClient, Close) {
   // For gRPC, this is always effectively a no-op
   ASSERT_OK(client_->Close());
@@ -1678,6 +1785,129 @@ TEST_F(TestCancel, DoExchange) {
   ARROW_UNUSED(do_exchange_result.writer->Close());
 }
 
+class CompressionTestServer : public FlightServerBase {
+ public:
+  Status DoGet(const ServerCallContext& context, const Ticket&,
+               std::unique_ptr<FlightDataStream>* data_stream) override {
+    StreamCompressionOptions compression;
+    compression.probe_interval = 2;
+    ARROW_ASSIGN_OR_RAISE(auto options, NegotiateStreamCompression(context, compression));
+    last_codec_ =
+        options.codec ? options.codec->compression_type() : Compression::UNCOMPRESSED;
+    RecordBatchVector batches;
+    RETURN_NOT_OK(ExampleIntBatches(&batches));
+    ARROW_ASSIGN_OR_RAISE(auto reader, RecordBatchReader::Make(batches));
+    *data_stream = std::make_unique<RecordBatchStream>(reader, options, compression);
+    return Status::OK();
+  }
+
+  Compression::type last_codec() const { return last_codec_; }
+
+ private:
+  std::atomic<Compression::type> last_codec_ = Compression::UNCOMPRESSED;
+};
+
+class TestStreamCompression : public ::testing::Test {
+ public:
+  void SetUp() {
+    ASSERT_OK(MakeServer<CompressionTestServer>(
+        &server_, &client_, [](FlightServerOptions* options) { return Status::OK(); },
+        [](FlightClientOptions* options) { return Status::OK(); }));
+  }
+  void TearDown() {
+    ASSERT_OK(client_->Close());
+    ASSERT_OK(server_->Shutdown());
+  }
+  CompressionTestServer* Server() const {
+    return static_cast<CompressionTestServer*>(server_.get());
+  }
+
+  void CheckDoGet(const FlightCallOptions& options, Compression::type expected_codec) {
+    RecordBatchVector expected;
+    ASSERT_OK(ExampleIntBatches(&expected));
+    ASSERT_OK_AND_ASSIGN(auto stream, client_->DoGet(options, Ticket{""}));
+    ASSERT_OK_AND_ASSIGN(auto batches, stream->ToRecordBatches());
+    ASSERT_EQ(expected.size(), batches.size());
+    for (size_t i = 0; i < batches.size(); i++) {
+      AssertBatchesEqual(*expected[i], *batches[i]);
+    }
+    ASSERT_EQ(expected_codec, Server()->last_codec());
+  }
+
+ protected:
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<FlightServerBase> server_;
+};
+
+TEST_F(TestStreamCompression, NotAccepted) {
+  CheckDoGet(FlightCallOptions{}, Compression::UNCOMPRESSED);
+}
+
+TEST_F(TestStreamCompression, Negotiated) {
+  for (auto codec : {Compression::LZ4_FRAME, Compression::ZSTD}) {
+    if (!util::Codec::IsAvailable(codec)) continue;
+    ARROW_SCOPED_TRACE("codec = ", util::Codec::GetCodecAsString(codec));
+    FlightCallOptions options;
+    // Codecs the server does not offer are skipped
+    options.accepted_compression = {Compression::UNCOMPRESSED, codec};
+    CheckDoGet(options, codec);
+  }
+}
+
+AsyncGenerator<std::shared_ptr<RecordBatch>> MakeCountingGenerator(
+    RecordBatchVector batches, std::atomic<int>* pulls, Status error = Status::OK()) {
+  auto index = std::make_shared<size_t>(0);
+  return [=]() {
+    (*pulls)++;
+    if (*index == batches.size()) {
+      if (!error.ok()) return Future<std::shared_ptr<RecordBatch>>::MakeFinished(error);
+      return Future<std::shared_ptr<RecordBatch>>::MakeFinished(nullptr);
+    }
+    return Future<std::shared_ptr<RecordBatch>>::MakeFinished(batches[(*index)++]);
+  };
+}
+
+TEST(TestRecordBatchGeneratorStream, Backpressure) {
+  RecordBatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  std::atomic<int> pulls{0};
+  StreamBackpressureOptions backpressure;
+  backpressure.max_buffered_batches = 2;
+  RecordBatchGeneratorStream stream(batches[0]->schema(),
+                                    MakeCountingGenerator(batches, &pulls),
+                                    ipc::IpcWriteOptions::Defaults(), backpressure);
+
+  ASSERT_OK(stream.GetSchemaPayload());
+  // The producer is paused once the buffer is full
+  ASSERT_EQ(2, pulls.load());
+  ASSERT_GT(stream.buffered_bytes(), 0);
+  for (size_t i = 0; i < batches.size(); i++) {
+    ASSERT_OK_AND_ASSIGN(auto payload, stream.NextAsync().result());
+    ASSERT_NE(nullptr, payload.ipc_message.metadata);
+    ASSERT_LE(pulls.load(), static_cast<int>(i) + 3);
+  }
+  ASSERT_OK_AND_ASSIGN(auto payload, stream.Next());
+  ASSERT_EQ(nullptr, payload.ipc_message.metadata);
+  ASSERT_EQ(0, stream.buffered_bytes());
+  ASSERT_OK(stream.Close());
+}
+
+TEST(TestRecordBatchGeneratorStream, Error) {
+  RecordBatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  std::atomic<int> pulls{0};
+  RecordBatchGeneratorStream stream(
+      batches[0]->schema(),
+      MakeCountingGenerator({batches[0]}, &pulls, Status::IOError("Scan failed")));
+
+  ASSERT_OK(stream.GetSchemaPayload());
+  // Buffered batches are sent before the error
+  ASSERT_OK_AND_ASSIGN(auto payload, stream.Next());
+  ASSERT_NE(nullptr, payload.ipc_message.metadata);
+  EXPECT_RAISES_WITH_MESSAGE_THAT(IOError, ::testing::HasSubstr("Scan failed"),
+                                  stream.Next());
+}
+
 class TracingTestServer : public FlightServerBase {
  public:
   Status DoAction(const ServerCallContext& call_context, const Action&,
@@ -47,7 +47,8 @@
 
 DEFINE_bool(cuda, false, "Allocate results in CUDA memory");
 DEFINE_string(transport, "grpc",
-              "The network transport to use. Supported: \"grpc\" (default).");
+              "The network transport to use. Supported: \"grpc\" (default), "
+              "\"ucx\" (if built with ARROW_WITH_UCX).");
 DEFINE_string(server_host, "localhost", "Host where the server is running on");
 DEFINE_int32(port, 31337, "Server port to listen on");
 DEFINE_string(server_unix, "", "Unix socket path where the server is running on");
@@ -273,6 +274,17 @@ int main(int argc, char** argv) {
       ARROW_CHECK_OK(arrow::flight::Location::ForGrpcUnix(FLAGS_server_unix)
                          .Value(&connect_location));
     }
+  } else if (FLAGS_transport == "ucx") {
+#ifdef ARROW_WITH_UCX
+    ARROW_CHECK_OK(arrow::flight::Location::ForScheme("ucx", "0.0.0.0", FLAGS_port)
+                       .Value(&bind_location));
+    ARROW_CHECK_OK(
+        arrow::flight::Location::ForScheme("ucx", FLAGS_server_host, FLAGS_port)
+            .Value(&connect_location));
+#else
+    std::cerr << "Not built with transport: " << FLAGS_transport << std::endl;
+    return EXIT_FAILURE;
+#endif
   } else {
     std::cerr << "Unknown transport: " << FLAGS_transport << std::endl;
     return EXIT_FAILURE;
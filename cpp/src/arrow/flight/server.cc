@@ -23,25 +23,36 @@
 
 #include "arrow/flight/server.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cerrno>
 #include <chrono>
 #include <cstdint>
 #include <deque>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <string_view>
 #include <thread>
 #include <utility>
+#include <vector>
 
 #include "arrow/device.h"
 #include "arrow/flight/transport.h"
 #include "arrow/flight/transport/grpc/grpc_server.h"
+#ifdef ARROW_WITH_UCX
+#  include "arrow/flight/transport/ucx/ucx.h"
+#endif
 #include "arrow/flight/transport_server.h"
 #include "arrow/flight/types.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/byte_size.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/config.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/string.h"
 #include "arrow/util/uri.h"
 
 namespace arrow {
@@ -154,6 +165,9 @@ FlightServerBase::~FlightServerBase() {}
 
 Status FlightServerBase::Init(const FlightServerOptions& options) {
   flight::transport::grpc::InitializeFlightGrpcServer();
+#ifdef ARROW_WITH_UCX
+  flight::transport::ucx::InitializeFlightUcx();
+#endif
 
   const auto scheme = options.location.scheme();
   ARROW_ASSIGN_OR_RAISE(impl_->transport_,
@@ -275,11 +289,42 @@ Status FlightServerBase::GetSchema(const ServerCallContext& context,
 // ----------------------------------------------------------------------
 // Implement RecordBatchStream
 
+namespace {
+
+// Simple payload writer that uses a deque to store generated payloads.
+class ServerRecordBatchPayloadWriter : public ipc::internal::IpcPayloadWriter {
+ public:
+  explicit ServerRecordBatchPayloadWriter(std::deque<FlightPayload>* payload_deque)
+      : payload_deque_(payload_deque) {}
+
+  Status Start() override { return Status::OK(); }
+
+  Status WritePayload(const ipc::IpcPayload& ipc_payload) override {
+    FlightPayload payload;
+    payload.ipc_message = ipc_payload;
+
+    payload_deque_->push_back(std::move(payload));
+    return Status::OK();
+  }
+
+  Status Close() override { return Status::OK(); }
+
+ private:
+  std::deque<FlightPayload>* payload_deque_;
+};
+
+}  // namespace
+
 class RecordBatchStream::RecordBatchStreamImpl {
  public:
   RecordBatchStreamImpl(const std::shared_ptr<RecordBatchReader>& reader,
-                        const ipc::IpcWriteOptions& options)
-      : reader_(reader), options_(options) {}
+                        const ipc::IpcWriteOptions& options,
+                        const StreamCompressionOptions& compression)
+      : reader_(reader),
+        options_(options),
+        compression_(compression),
+        adaptive_(options.codec != nullptr && compression.adaptive),
+        compressing_(options.codec != nullptr) {}
 
   std::shared_ptr<Schema> schema() { return reader_->schema(); }
 
@@ -298,6 +343,11 @@ class RecordBatchStream::RecordBatchStreamImpl {
   }
 
   Status Next(FlightPayload* payload) {
+    if (adaptive_ && sent_payload_) {
+      // The transport calls Next() again once it has sent the previous
+      // payload, so the time in between is the time it took to send
+      send_time_[compressing_] += Clock::now() - payload_returned_;
+    }
     // If we have previous payloads (dictionary messages or previous record batches)
     // we will return them before reading the next record batch.
     if (payload_deque_.empty()) {
@@ -324,7 +374,7 @@ class RecordBatchStream::RecordBatchStreamImpl {
       }
       // One WriteRecordBatch call might generate multiple payloads, so we
       // need to collect them in a deque.
-      RETURN_NOT_OK(writer_->WriteRecordBatch(*batch));
+      RETURN_NOT_OK(WriteRecordBatch(*batch));
     }
 
     // There must be at least one payload generated after WriteRecordBatch or
@@ -335,9 +385,22 @@ class RecordBatchStream::RecordBatchStreamImpl {
 
     *payload = std::move(payload_deque_.front());
     payload_deque_.pop_front();
+    if (adaptive_) {
+      sent_bytes_[compressing_] += payload->ipc_message.body_length;
+      sent_payload_ = true;
+      payload_returned_ = Clock::now();
+    }
     return Status::OK();
   }
 
+  RecordBatchStreamStats stats() const {
+    RecordBatchStreamStats stats;
+    if (writer_) stats.write_stats = writer_->stats();
+    stats.num_compressed_batches = num_compressed_batches_;
+    stats.compression_time = compression_time_;
+    return stats;
+  }
+
   Status Close() {
     if (writer_) {
       RETURN_NOT_OK(writer_->Close());
@@ -346,33 +409,79 @@ class RecordBatchStream::RecordBatchStreamImpl {
   }
 
  private:
-  // Simple payload writer that uses a deque to store generated payloads.
-  class ServerRecordBatchPayloadWriter : public ipc::internal::IpcPayloadWriter {
-   public:
-    explicit ServerRecordBatchPayloadWriter(std::deque<FlightPayload>* payload_deque)
-        : payload_deque_(payload_deque) {}
-
-    Status Start() override { return Status::OK(); }
-
-    Status WritePayload(const ipc::IpcPayload& ipc_payload) override {
-      FlightPayload payload;
-      payload.ipc_message = ipc_payload;
-
-      payload_deque_->push_back(std::move(payload));
-      return Status::OK();
+  using Clock = std::chrono::steady_clock;
+
+  Status WriteRecordBatch(const RecordBatch& batch) {
+    if (adaptive_) {
+      const bool compress = ShouldCompress();
+      if (compress != compressing_) {
+        RETURN_NOT_OK(ipc::internal::SetCompressionEnabled(writer_.get(), compress));
+        compressing_ = compress;
+        batches_in_mode_ = 0;
+      }
+      batches_in_mode_++;
     }
+    if (!compressing_) {
+      return writer_->WriteRecordBatch(batch);
+    }
+    const auto stats_before = writer_->stats();
+    const auto start = Clock::now();
+    RETURN_NOT_OK(writer_->WriteRecordBatch(batch));
+    compression_time_ += Clock::now() - start;
+    num_compressed_batches_++;
+    const auto stats_after = writer_->stats();
+    compressed_raw_bytes_ +=
+        stats_after.total_raw_body_size - stats_before.total_raw_body_size;
+    compressed_bytes_ +=
+        stats_after.total_serialized_body_size - stats_before.total_serialized_body_size;
+    return Status::OK();
+  }
 
-    Status Close() override { return Status::OK(); }
-
-   private:
-    std::deque<FlightPayload>* payload_deque_;
-  };
+  /// \brief Whether the next batch should be compressed, from the time
+  ///     compression takes and the time sending the bytes it saves takes.
+  bool ShouldCompress() const {
+    // Try both modes first, then the other mode periodically
+    if (num_compressed_batches_ == 0) return true;
+    if (sent_bytes_[false] == 0) return false;
+    if (batches_in_mode_ >= compression_.probe_interval) return !compressing_;
+
+    const double ratio =
+        compressed_raw_bytes_ == 0
+            ? 1.0
+            : static_cast<double>(compressed_bytes_) / compressed_raw_bytes_;
+    if (options_.min_space_savings.has_value() &&
+        1.0 - ratio < *options_.min_space_savings) {
+      return false;
+    }
+    const int64_t sent_bytes = sent_bytes_[false] + sent_bytes_[true];
+    if (sent_bytes == 0 || compressed_raw_bytes_ == 0) return compressing_;
+    const double send_ns_per_byte =
+        static_cast<double>((send_time_[false] + send_time_[true]).count()) / sent_bytes;
+    const double compress_ns_per_byte =
+        static_cast<double>(compression_time_.count()) / compressed_raw_bytes_;
+    return compress_ns_per_byte + ratio * send_ns_per_byte < send_ns_per_byte;
+  }
 
   std::shared_ptr<RecordBatchReader> reader_;
   ipc::IpcWriteOptions options_;
+  const StreamCompressionOptions compression_;
   std::unique_ptr<ipc::RecordBatchWriter> writer_;
   std::deque<FlightPayload> payload_deque_;
 
+  // Adaptive compression state, indexed by whether data was compressed
+  const bool adaptive_;
+  bool compressing_;
+  int64_t batches_in_mode_ = 0;
+  int64_t sent_bytes_[2] = {0, 0};
+  std::chrono::nanoseconds send_time_[2] = {};
+  bool sent_payload_ = false;
+  Clock::time_point payload_returned_;
+
+  int64_t num_compressed_batches_ = 0;
+  int64_t compressed_raw_bytes_ = 0;
+  int64_t compressed_bytes_ = 0;
+  std::chrono::nanoseconds compression_time_{0};
+
   Status InitializeWriter() {
     auto payload_writer =
         std::make_unique<ServerRecordBatchPayloadWriter>(&payload_deque_);
@@ -383,6 +492,190 @@ class RecordBatchStream::RecordBatchStreamImpl {
   }
 };
 
+class RecordBatchGeneratorStream::RecordBatchGeneratorStreamImpl
+    : public std::enable_shared_from_this<RecordBatchGeneratorStreamImpl> {
+ public:
+  RecordBatchGeneratorStreamImpl(std::shared_ptr<Schema> schema,
+                                 AsyncGenerator<std::shared_ptr<RecordBatch>> generator,
+                                 const ipc::IpcWriteOptions& options,
+                                 const StreamBackpressureOptions& backpressure)
+      : schema_(std::move(schema)),
+        generator_(std::move(generator)),
+        options_(options),
+        backpressure_(backpressure) {}
+
+  std::shared_ptr<Schema> schema() { return schema_; }
+
+  arrow::Result<FlightPayload> GetSchemaPayload() {
+    // Start producing while the schema is sent
+    Pump();
+    if (!writer_) {
+      RETURN_NOT_OK(InitializeWriter());
+    }
+    if (payload_deque_.empty()) {
+      return Status::UnknownError("No schema payload generated");
+    }
+    return PopPayload();
+  }
+
+  Future<FlightPayload> NextAsync() {
+    if (!payload_deque_.empty()) {
+      return PopPayload();
+    }
+    Pump();
+    auto self = shared_from_this();
+    return WaitForBatch().Then(
+        [self]() -> arrow::Result<FlightPayload> { return self->WriteNextBatch(); });
+  }
+
+  Status Close() {
+    Future<> waiter;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (closed_) return Status::OK();
+      closed_ = true;
+      finished_ = true;
+      batches_.clear();
+      buffered_bytes_ = 0;
+      waiter = std::move(waiter_);
+    }
+    if (waiter.is_valid()) waiter.MarkFinished();
+    if (writer_) {
+      RETURN_NOT_OK(writer_->Close());
+    }
+    return Status::OK();
+  }
+
+  int64_t buffered_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return buffered_bytes_;
+  }
+
+ private:
+  /// \brief Pull from the generator until the buffer is full.
+  ///
+  /// At most one pull is outstanding. Batches that are already
+  /// available are handled in a loop rather than recursively.
+  void Pump() {
+    while (true) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (pulling_ || finished_ || IsFull()) return;
+        pulling_ = true;
+      }
+      auto next = generator_();
+      if (!next.is_finished()) {
+        auto self = shared_from_this();
+        next.AddCallback([self](const arrow::Result<std::shared_ptr<RecordBatch>>& batch) {
+          self->OnBatch(batch);
+          self->Pump();
+        });
+        return;
+      }
+      OnBatch(next.result());
+    }
+  }
+
+  bool IsFull() const {
+    if (batches_.empty()) return false;
+    return buffered_bytes_ >= backpressure_.max_buffered_bytes ||
+           static_cast<int64_t>(batches_.size()) >= backpressure_.max_buffered_batches;
+  }
+
+  void OnBatch(const arrow::Result<std::shared_ptr<RecordBatch>>& batch) {
+    Future<> waiter;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      pulling_ = false;
+      if (closed_) return;
+      if (!batch.ok()) {
+        status_ = batch.status();
+        finished_ = true;
+      } else if (IsIterationEnd(*batch)) {
+        finished_ = true;
+      } else {
+        buffered_bytes_ += util::TotalBufferSize(**batch);
+        batches_.push_back(*batch);
+      }
+      waiter = std::move(waiter_);
+    }
+    if (waiter.is_valid()) waiter.MarkFinished();
+  }
+
+  /// \brief Wait until a batch is buffered or the generator is done.
+  Future<> WaitForBatch() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!batches_.empty() || finished_) return Future<>::MakeFinished();
+    waiter_ = Future<>::Make();
+    return waiter_;
+  }
+
+  arrow::Result<FlightPayload> WriteNextBatch() {
+    std::shared_ptr<RecordBatch> batch;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (batches_.empty()) {
+        RETURN_NOT_OK(status_);
+        if (closed_) return Status::Invalid("Stream was closed");
+        // End of stream
+        if (writer_) {
+          RETURN_NOT_OK(writer_->Close());
+        }
+        return FlightPayload{};
+      }
+      batch = std::move(batches_.front());
+      batches_.pop_front();
+      buffered_bytes_ -= util::TotalBufferSize(*batch);
+    }
+    // Resume the producer if it was paused
+    Pump();
+    if (!writer_) {
+      RETURN_NOT_OK(InitializeWriter());
+      // Drop the schema payload, as in RecordBatchStream
+      if (payload_deque_.front().ipc_message.type == ipc::MessageType::SCHEMA) {
+        payload_deque_.pop_front();
+      }
+    }
+    RETURN_NOT_OK(writer_->WriteRecordBatch(*batch));
+    if (payload_deque_.empty()) {
+      return Status::UnknownError("IPC writer didn't produce any payloads");
+    }
+    return PopPayload();
+  }
+
+  FlightPayload PopPayload() {
+    FlightPayload payload = std::move(payload_deque_.front());
+    payload_deque_.pop_front();
+    return payload;
+  }
+
+  Status InitializeWriter() {
+    auto payload_writer = std::make_unique<ServerRecordBatchPayloadWriter>(&payload_deque_);
+    ARROW_ASSIGN_OR_RAISE(writer_, ipc::internal::OpenRecordBatchWriter(
+                                       std::move(payload_writer), schema_, options_));
+    return Status::OK();
+  }
+
+  const std::shared_ptr<Schema> schema_;
+  AsyncGenerator<std::shared_ptr<RecordBatch>> generator_;
+  const ipc::IpcWriteOptions options_;
+  const StreamBackpressureOptions backpressure_;
+
+  // Only used by the consumer
+  std::unique_ptr<ipc::RecordBatchWriter> writer_;
+  std::deque<FlightPayload> payload_deque_;
+
+  // Shared with the producer
+  mutable std::mutex mutex_;
+  std::deque<std::shared_ptr<RecordBatch>> batches_;
+  int64_t buffered_bytes_ = 0;
+  bool pulling_ = false;
+  bool finished_ = false;
+  bool closed_ = false;
+  Status status_;
+  Future<> waiter_;
+};
+
 FlightMetadataWriter::~FlightMetadataWriter() = default;
 
 FlightDataStream::~FlightDataStream() {}
@@ -390,7 +683,15 @@ Status FlightDataStream::Close() { return Status::OK(); }
 
 RecordBatchStream::RecordBatchStream(const std::shared_ptr<RecordBatchReader>& reader,
                                      const ipc::IpcWriteOptions& options) {
-  impl_.reset(new RecordBatchStreamImpl(reader, options));
+  StreamCompressionOptions compression;
+  compression.adaptive = false;
+  impl_.reset(new RecordBatchStreamImpl(reader, options, compression));
+}
+
+RecordBatchStream::RecordBatchStream(const std::shared_ptr<RecordBatchReader>& reader,
+                                     const ipc::IpcWriteOptions& options,
+                                     const StreamCompressionOptions& compression) {
+  impl_.reset(new RecordBatchStreamImpl(reader, options, compression));
 }
 
 RecordBatchStream::~RecordBatchStream() {
@@ -413,5 +714,68 @@ arrow::Result<FlightPayload> RecordBatchStream::Next() {
   return payload;
 }
 
+RecordBatchStreamStats RecordBatchStream::stats() const { return impl_->stats(); }
+
+StreamCompressionOptions StreamCompressionOptions::Defaults() {
+  return StreamCompressionOptions();
+}
+
+arrow::Result<FlightPayload> AsyncFlightDataStream::Next() { return NextAsync().result(); }
+
+StreamBackpressureOptions StreamBackpressureOptions::Defaults() {
+  return StreamBackpressureOptions();
+}
+
+RecordBatchGeneratorStream::RecordBatchGeneratorStream(
+    std::shared_ptr<Schema> schema, AsyncGenerator<std::shared_ptr<RecordBatch>> generator,
+    const ipc::IpcWriteOptions& options, const StreamBackpressureOptions& backpressure)
+    : impl_(std::make_shared<RecordBatchGeneratorStreamImpl>(
+          std::move(schema), std::move(generator), options, backpressure)) {}
+
+RecordBatchGeneratorStream::~RecordBatchGeneratorStream() {
+  ARROW_WARN_NOT_OK(impl_->Close(), "Failed to close FlightDataStream");
+}
+
+std::shared_ptr<Schema> RecordBatchGeneratorStream::schema() { return impl_->schema(); }
+
+arrow::Result<FlightPayload> RecordBatchGeneratorStream::GetSchemaPayload() {
+  return impl_->GetSchemaPayload();
+}
+
+Future<FlightPayload> RecordBatchGeneratorStream::NextAsync() {
+  return impl_->NextAsync();
+}
+
+Status RecordBatchGeneratorStream::Close() { return impl_->Close(); }
+
+int64_t RecordBatchGeneratorStream::buffered_bytes() const {
+  return impl_->buffered_bytes();
+}
+
+arrow::Result<ipc::IpcWriteOptions> NegotiateStreamCompression(
+    const ServerCallContext& context, const StreamCompressionOptions& compression,
+    ipc::IpcWriteOptions options) {
+  options.codec.reset();
+  std::vector<Compression::type> accepted;
+  const auto headers = context.incoming_headers().equal_range(kAcceptCompressionHeader);
+  for (auto it = headers.first; it != headers.second; ++it) {
+    for (const auto name : ::arrow::internal::SplitString(it->second, ',')) {
+      // Ignore codecs this version doesn't know about
+      auto maybe_type = util::Codec::GetCompressionType(
+          ::arrow::internal::TrimString(std::string(name)));
+      if (maybe_type.ok()) accepted.push_back(*maybe_type);
+    }
+  }
+  for (const auto codec : compression.codecs) {
+    if (std::find(accepted.begin(), accepted.end(), codec) != accepted.end() &&
+        util::Codec::IsAvailable(codec)) {
+      ARROW_ASSIGN_OR_RAISE(options.codec,
+                            util::Codec::Create(codec, compression.compression_level));
+      break;
+    }
+  }
+  return options;
+}
+
 }  // namespace flight
 }  // namespace arrow
@@ -32,7 +32,11 @@
 #include "arrow/flight/visibility.h"  // IWYU pragma: keep
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/options.h"
+#include "arrow/ipc/writer.h"
 #include "arrow/record_batch.h"
+#include "arrow/util/async_generator_fwd.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/future.h"
 
 namespace arrow {
 
@@ -59,6 +63,52 @@ class ARROW_FLIGHT_EXPORT FlightDataStream {
   virtual Status Close();
 };
 
+/// \brief Options for compressing the data sent to a client.
+struct ARROW_FLIGHT_EXPORT StreamCompressionOptions {
+  /// \brief The codecs the server may use, in order of preference.
+  ///
+  /// The first one the client accepts (see
+  /// FlightCallOptions::accepted_compression) is used.
+  std::vector<Compression::type> codecs = {Compression::ZSTD, Compression::LZ4_FRAME};
+  /// \brief The compression level of the codec.
+  int compression_level = ::arrow::util::kUseDefaultCompressionLevel;
+  /// \brief Only compress while it pays off.
+  ///
+  /// If true, a RecordBatchStream measures how long batches take to
+  /// compress and to send, and stops compressing when compression
+  /// takes more time than it saves on the wire, or saves less space
+  /// than IpcWriteOptions::min_space_savings. The other mode is
+  /// tried again every probe_interval batches.
+  bool adaptive = true;
+  /// \brief How many batches to send between two trials of the other mode.
+  int64_t probe_interval = 32;
+
+  /// \brief Get default options.
+  static StreamCompressionOptions Defaults();
+};
+
+/// \brief Statistics of a RecordBatchStream.
+struct ARROW_FLIGHT_EXPORT RecordBatchStreamStats {
+  /// \brief Statistics of the IPC writer, including the raw and
+  ///     serialized sizes of the record batches.
+  ipc::WriteStats write_stats;
+  /// \brief Number of record batches sent compressed.
+  int64_t num_compressed_batches = 0;
+  /// \brief Time spent serializing compressed record batches.
+  ///
+  /// Serialization itself is cheap, so this is mostly compression time.
+  std::chrono::nanoseconds compression_time{0};
+
+  /// \brief The size of the serialized record batch bodies relative to
+  ///     their raw size.
+  double compression_ratio() const {
+    return write_stats.total_raw_body_size == 0
+               ? 1.0
+               : static_cast<double>(write_stats.total_serialized_body_size) /
+                     static_cast<double>(write_stats.total_raw_body_size);
+  }
+};
+
 /// \brief A basic implementation of FlightDataStream that will provide
 /// a sequence of FlightData messages to be written to a stream
 class ARROW_FLIGHT_EXPORT RecordBatchStream : public FlightDataStream {
@@ -68,6 +118,13 @@ class ARROW_FLIGHT_EXPORT RecordBatchStream : public FlightDataStream {
   explicit RecordBatchStream(
       const std::shared_ptr<RecordBatchReader>& reader,
       const ipc::IpcWriteOptions& options = ipc::IpcWriteOptions::Defaults());
+  /// \param[in] reader produces a sequence of record batches
+  /// \param[in] options IPC options for writing, usually from
+  ///     NegotiateStreamCompression
+  /// \param[in] compression how to apply the codec of the options, if any
+  RecordBatchStream(const std::shared_ptr<RecordBatchReader>& reader,
+                    const ipc::IpcWriteOptions& options,
+                    const StreamCompressionOptions& compression);
   ~RecordBatchStream() override;
 
   // inherit deprecated API
@@ -80,11 +137,83 @@ class ARROW_FLIGHT_EXPORT RecordBatchStream : public FlightDataStream {
   arrow::Result<FlightPayload> Next() override;
   Status Close() override;
 
+  /// \brief Get statistics of the data sent so far.
+  RecordBatchStreamStats stats() const;
+
  private:
   class RecordBatchStreamImpl;
   std::unique_ptr<RecordBatchStreamImpl> impl_;
 };
 
+/// \brief A FlightDataStream whose payloads are produced asynchronously.
+///
+/// The transport calls Next(), which waits for NextAsync() by default,
+/// after each payload has been written. Since writes block while the
+/// client's flow-control window is full, a slow client delays calls to
+/// NextAsync(); implementations should use that to pause their
+/// producer instead of buffering without bound.
+class ARROW_FLIGHT_EXPORT AsyncFlightDataStream : public FlightDataStream {
+ public:
+  /// \brief Get the next payload.
+  ///
+  /// When the stream is completed, the payload has null metadata.
+  virtual Future<FlightPayload> NextAsync() = 0;
+
+  arrow::Result<FlightPayload> Next() override;
+};
+
+/// \brief Options for buffering the data of an asynchronous stream.
+struct ARROW_FLIGHT_EXPORT StreamBackpressureOptions {
+  /// \brief Pause the producer while this many bytes of record batches
+  ///     are buffered.
+  ///
+  /// One batch is always allowed, so a batch larger than this does not
+  /// stall the stream.
+  int64_t max_buffered_bytes = 64 * 1024 * 1024;
+  /// \brief Pause the producer while this many record batches are buffered.
+  int64_t max_buffered_batches = 16;
+
+  /// \brief Get default options.
+  static StreamBackpressureOptions Defaults();
+};
+
+/// \brief An AsyncFlightDataStream that sends the record batches of an
+/// asynchronous generator, e.g. an Acero plan or a dataset scan.
+///
+/// Batches are pulled from the generator ahead of the client, one at a
+/// time, until the limits of the backpressure options are reached;
+/// pulling resumes as the client consumes them. The generator is never
+/// pulled from concurrently.
+class ARROW_FLIGHT_EXPORT RecordBatchGeneratorStream : public AsyncFlightDataStream {
+ public:
+  /// \param[in] schema the schema of the record batches
+  /// \param[in] generator produces the record batches, then an end
+  ///     marker (a null batch)
+  /// \param[in] options IPC options for writing
+  /// \param[in] backpressure limits of the data buffered ahead of the client
+  RecordBatchGeneratorStream(
+      std::shared_ptr<Schema> schema,
+      AsyncGenerator<std::shared_ptr<RecordBatch>> generator,
+      const ipc::IpcWriteOptions& options = ipc::IpcWriteOptions::Defaults(),
+      const StreamBackpressureOptions& backpressure =
+          StreamBackpressureOptions::Defaults());
+  ~RecordBatchGeneratorStream() override;
+
+  std::shared_ptr<Schema> schema() override;
+  arrow::Result<FlightPayload> GetSchemaPayload() override;
+  Future<FlightPayload> NextAsync() override;
+  /// \brief Stop pulling from the generator and drop buffered batches.
+  Status Close() override;
+
+  /// \brief Get the size of the record batches buffered ahead of the
+  ///     client, in bytes.
+  int64_t buffered_bytes() const;
+
+ private:
+  class RecordBatchGeneratorStreamImpl;
+  std::shared_ptr<RecordBatchGeneratorStreamImpl> impl_;
+};
+
 /// \brief A reader for IPC payloads uploaded by a client. Also allows
 /// reading application-defined metadata via the Flight protocol.
 class ARROW_FLIGHT_EXPORT FlightMessageReader : public MetadataRecordBatchReader {
@@ -141,6 +270,20 @@ class ARROW_FLIGHT_EXPORT ServerCallContext {
   virtual const CallHeaders& incoming_headers() const = 0;
 };
 
+/// \brief Choose the compression of the data sent to the client of a call.
+///
+/// Returns options with the codec set to the first of
+/// compression.codecs that the client accepts and this build
+/// supports, or unset if there is none.
+///
+/// \param[in] context the context of the call
+/// \param[in] compression the codecs the server may use
+/// \param[in] options the IPC options to set the codec of
+ARROW_FLIGHT_EXPORT
+arrow::Result<ipc::IpcWriteOptions> NegotiateStreamCompression(
+    const ServerCallContext& context, const StreamCompressionOptions& compression,
+    ipc::IpcWriteOptions options = ipc::IpcWriteOptions::Defaults());
+
 class ARROW_FLIGHT_EXPORT FlightServerOptions {
  public:
   explicit FlightServerOptions(const Location& location_);
@@ -32,16 +32,22 @@ inline size_t CopyFromArrayValuesToBinding(ARRAY_TYPE* array, ColumnBinding* bin
                                            int64_t starting_row, int64_t cells) {
   constexpr ssize_t element_size = sizeof(typename ARRAY_TYPE::value_type);
 
+  // Without nulls, the indicators are all the same and no row needs checking.
+  const bool has_nulls = array->null_count() != 0;
   if (binding->str_len_buffer) {
-    for (int64_t i = 0; i < cells; ++i) {
-      int64_t current_row = starting_row + i;
-      if (array->IsNull(current_row)) {
-        binding->str_len_buffer[i] = NULL_DATA;
-      } else {
-        binding->str_len_buffer[i] = element_size;
+    if (!has_nulls) {
+      std::fill(binding->str_len_buffer, binding->str_len_buffer + cells, element_size);
+    } else {
+      for (int64_t i = 0; i < cells; ++i) {
+        int64_t current_row = starting_row + i;
+        if (array->IsNull(current_row)) {
+          binding->str_len_buffer[i] = NULL_DATA;
+        } else {
+          binding->str_len_buffer[i] = element_size;
+        }
       }
     }
-  } else {
+  } else if (has_nulls) {
     // Duplicate this loop to avoid null checks within the loop.
     for (int64_t i = starting_row; i < starting_row + cells; ++i) {
       if (array->IsNull(i)) {
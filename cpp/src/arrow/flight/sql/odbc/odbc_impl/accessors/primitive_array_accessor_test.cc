@@ -92,4 +92,34 @@ TEST(PrimitiveArrayFlightSqlAccessor, Test_DoubleArray_CDataType_DOUBLE) {
   TestPrimitiveArraySqlAccessor<DoubleArray, CDataType_DOUBLE>();
 }
 
+TEST(PrimitiveArrayFlightSqlAccessor, Test_Int64Array_WithNulls) {
+  std::vector<int64_t> values = {1, 2, 3};
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int64Type>({true, false, true}, values, &array);
+
+  PrimitiveArrayFlightSqlAccessor<Int64Array, CDataType_SBIGINT> accessor(array.get());
+
+  std::vector<int64_t> buffer(values.size());
+  std::vector<ssize_t> str_len_buffer(values.size());
+  ColumnBinding binding(CDataType_SBIGINT, 0, 0, buffer.data(), values.size(),
+                        str_len_buffer.data());
+
+  int64_t value_offset = 0;
+  Diagnostics diagnostics("Dummy", "Dummy", OdbcVersion::V_3);
+  ASSERT_EQ(values.size(),
+            accessor.GetColumnarData(&binding, 0, values.size(), value_offset, false,
+                                     diagnostics, nullptr));
+  ASSERT_EQ(sizeof(int64_t), str_len_buffer[0]);
+  ASSERT_EQ(NULL_DATA, str_len_buffer[1]);
+  ASSERT_EQ(sizeof(int64_t), str_len_buffer[2]);
+  ASSERT_EQ(1, buffer[0]);
+  ASSERT_EQ(3, buffer[2]);
+
+  // Nulls need an indicator buffer
+  binding.str_len_buffer = nullptr;
+  ASSERT_THROW(accessor.GetColumnarData(&binding, 0, values.size(), value_offset, false,
+                                        diagnostics, nullptr),
+               NullWithoutIndicatorException);
+}
+
 }  // namespace arrow::flight::sql::odbc
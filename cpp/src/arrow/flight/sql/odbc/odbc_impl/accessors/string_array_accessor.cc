@@ -26,9 +26,11 @@ namespace {
 
 #if defined _WIN32
 std::string Utf8ToCLocale(const char* utf8_str, int len) {
-  thread_local boost::locale::generator g;
-  g.locale_cache_enabled(true);
-  std::locale loc = g(boost::locale::util::get_system_locale());
+  // Generating the locale is expensive, and this is called for every cell
+  thread_local const std::locale loc = [] {
+    boost::locale::generator g;
+    return g(boost::locale::util::get_system_locale());
+  }();
   return boost::locale::conv::from_utf<char>(utf8_str, utf8_str + len, loc);
 }
 #endif
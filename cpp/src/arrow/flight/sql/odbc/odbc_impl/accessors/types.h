@@ -93,9 +93,11 @@ class FlightSqlAccessor : public Accessor {
   size_t GetColumnarDataImpl(ColumnBinding* binding, int64_t starting_row, int64_t cells,
                              int64_t& value_offset, bool update_value_offset,
                              Diagnostics& diagnostics, uint16_t* row_status_array) {
+    // Checked once per call, as most columns have no nulls.
+    const bool has_nulls = array_->null_count() != 0;
     for (int64_t i = 0; i < cells; ++i) {
       int64_t current_arrow_row = starting_row + i;
-      if (array_->IsNull(current_arrow_row)) {
+      if (has_nulls && array_->IsNull(current_arrow_row)) {
         if (binding->str_len_buffer) {
           binding->str_len_buffer[i] = NULL_DATA;
         } else {
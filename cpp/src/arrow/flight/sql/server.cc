@@ -22,6 +22,13 @@
 
 #include "arrow/flight/sql/server.h"
 
+#include <chrono>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include <google/protobuf/any.pb.h>
 
 #include "arrow/buffer.h"
@@ -29,6 +36,9 @@
 #include "arrow/flight/serialization_internal.h"
 #include "arrow/flight/sql/protocol_internal.h"
 #include "arrow/flight/sql/sql_info_internal.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/macros.h"
@@ -516,6 +526,316 @@ arrow::Result<Result> PackActionResult(ActionCreatePreparedStatementResult resul
 
 }  // namespace
 
+/// \brief The results of prepared statements, as the payloads sent to clients.
+class PreparedStatementCache {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Entry {
+    std::string handle;
+    std::shared_ptr<Schema> schema;
+    FlightPayload schema_payload;
+    std::vector<FlightPayload> payloads;
+    int64_t num_bytes = 0;
+    Clock::time_point inserted;
+  };
+
+  explicit PreparedStatementCache(PreparedStatementCacheOptions options)
+      : options_(std::move(options)) {}
+
+  const PreparedStatementCacheOptions& options() const { return options_; }
+
+  /// \brief Get the key of the results of a statement with its bound parameters.
+  std::string MakeKey(const std::string& handle) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::string key = std::to_string(handle.size()) + ":" + handle;
+    auto it = bound_parameters_.find(handle);
+    if (it != bound_parameters_.end()) key += it->second;
+    return key;
+  }
+
+  /// \brief Record the parameters bound to a statement, serialized.
+  void SetParameters(const std::string& handle, std::string parameters) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    bound_parameters_[handle] = std::move(parameters);
+  }
+
+  std::shared_ptr<const Entry> Lookup(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+      misses_++;
+      return nullptr;
+    }
+    if (IsExpired(*it->second.entry)) {
+      Erase(it);
+      misses_++;
+      return nullptr;
+    }
+    lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+    hits_++;
+    return it->second.entry;
+  }
+
+  /// \brief The generation of the cache, to insert with.
+  ///
+  /// Results computed before an invalidation must not be inserted
+  /// after it.
+  int64_t generation() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return generation_;
+  }
+
+  void Insert(const std::string& key, int64_t generation,
+              std::shared_ptr<const Entry> entry) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (generation != generation_ || entry->num_bytes > options_.max_bytes) return;
+    auto it = entries_.find(key);
+    if (it != entries_.end()) Erase(it);
+    while (num_bytes_ + entry->num_bytes > options_.max_bytes) {
+      Erase(entries_.find(lru_.back()));
+    }
+    lru_.push_front(key);
+    num_bytes_ += entry->num_bytes;
+    entries_.emplace(key, Slot{std::move(entry), lru_.begin()});
+  }
+
+  /// \brief Forget a closed statement.
+  void Remove(const std::string& handle) {
+    Invalidate(handle);
+    std::lock_guard<std::mutex> lock(mutex_);
+    bound_parameters_.erase(handle);
+  }
+
+  void Invalidate(const std::string& handle) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    generation_++;
+    for (auto it = entries_.begin(); it != entries_.end();) {
+      if (it->second.entry->handle == handle) {
+        it = Erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  void InvalidateAll() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    generation_++;
+    entries_.clear();
+    lru_.clear();
+    num_bytes_ = 0;
+  }
+
+  PreparedStatementCacheStats stats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    PreparedStatementCacheStats stats;
+    stats.hits = hits_;
+    stats.misses = misses_;
+    stats.num_entries = static_cast<int64_t>(entries_.size());
+    stats.num_bytes = num_bytes_;
+    return stats;
+  }
+
+ private:
+  struct Slot {
+    std::shared_ptr<const Entry> entry;
+    std::list<std::string>::iterator lru_position;
+  };
+  using SlotMap = std::unordered_map<std::string, Slot>;
+
+  bool IsExpired(const Entry& entry) const {
+    return options_.ttl.count() > 0 && Clock::now() - entry.inserted > options_.ttl;
+  }
+
+  SlotMap::iterator Erase(SlotMap::iterator it) {
+    num_bytes_ -= it->second.entry->num_bytes;
+    lru_.erase(it->second.lru_position);
+    return entries_.erase(it);
+  }
+
+  const PreparedStatementCacheOptions options_;
+  std::mutex mutex_;
+  SlotMap entries_;
+  // Keys, most recently used first
+  std::list<std::string> lru_;
+  std::unordered_map<std::string, std::string> bound_parameters_;
+  int64_t num_bytes_ = 0;
+  int64_t generation_ = 0;
+  int64_t hits_ = 0;
+  int64_t misses_ = 0;
+};
+
+namespace {
+
+int64_t PayloadSize(const FlightPayload& payload) {
+  int64_t size = payload.ipc_message.body_length;
+  if (payload.ipc_message.metadata) size += payload.ipc_message.metadata->size();
+  if (payload.app_metadata) size += payload.app_metadata->size();
+  if (payload.descriptor) size += payload.descriptor->size();
+  return size;
+}
+
+/// \brief Serves a cached result, without copying its payloads.
+class CachedResultStream : public FlightDataStream {
+ public:
+  explicit CachedResultStream(std::shared_ptr<const PreparedStatementCache::Entry> entry)
+      : entry_(std::move(entry)) {}
+
+  std::shared_ptr<Schema> schema() override { return entry_->schema; }
+
+  arrow::Result<FlightPayload> GetSchemaPayload() override {
+    return entry_->schema_payload;
+  }
+
+  arrow::Result<FlightPayload> Next() override {
+    if (position_ == entry_->payloads.size()) {
+      // End of stream
+      return FlightPayload{};
+    }
+    return entry_->payloads[position_++];
+  }
+
+ private:
+  std::shared_ptr<const PreparedStatementCache::Entry> entry_;
+  size_t position_ = 0;
+};
+
+/// \brief Passes a result through, and caches it once it is complete.
+class CachingResultStream : public FlightDataStream {
+ public:
+  CachingResultStream(std::shared_ptr<PreparedStatementCache> cache, std::string key,
+                      std::string handle, std::unique_ptr<FlightDataStream> stream)
+      : cache_(std::move(cache)),
+        key_(std::move(key)),
+        generation_(cache_->generation()),
+        stream_(std::move(stream)),
+        entry_(std::make_shared<PreparedStatementCache::Entry>()) {
+    entry_->handle = std::move(handle);
+  }
+
+  std::shared_ptr<Schema> schema() override { return stream_->schema(); }
+
+  arrow::Result<FlightPayload> GetSchemaPayload() override {
+    ARROW_ASSIGN_OR_RAISE(auto payload, stream_->GetSchemaPayload());
+    if (entry_) {
+      entry_->schema = stream_->schema();
+      entry_->schema_payload = payload;
+      Record(payload);
+    }
+    return payload;
+  }
+
+  arrow::Result<FlightPayload> Next() override {
+    ARROW_ASSIGN_OR_RAISE(auto payload, stream_->Next());
+    if (!entry_) return payload;
+    if (!payload.ipc_message.metadata) {
+      // The result is complete
+      if (entry_->schema) {
+        entry_->inserted = PreparedStatementCache::Clock::now();
+        cache_->Insert(key_, generation_, std::move(entry_));
+      }
+      entry_.reset();
+      return payload;
+    }
+    entry_->payloads.push_back(payload);
+    Record(payload);
+    return payload;
+  }
+
+  Status Close() override { return stream_->Close(); }
+
+ private:
+  void Record(const FlightPayload& payload) {
+    entry_->num_bytes += PayloadSize(payload);
+    if (entry_->num_bytes > cache_->options().max_bytes) {
+      // Too large to cache; stop holding on to the payloads
+      entry_.reset();
+    }
+  }
+
+  std::shared_ptr<PreparedStatementCache> cache_;
+  const std::string key_;
+  const int64_t generation_;
+  std::unique_ptr<FlightDataStream> stream_;
+  std::shared_ptr<PreparedStatementCache::Entry> entry_;
+};
+
+/// \brief Invalidates cached results once a command that may change
+///     data is done, whether or not it succeeded.
+///
+/// This also drops results that were being computed concurrently.
+class InvalidateOnUpdate {
+ public:
+  explicit InvalidateOnUpdate(PreparedStatementCache* cache)
+      : cache_(cache && cache->options().invalidate_on_update ? cache : nullptr) {}
+  ~InvalidateOnUpdate() {
+    if (cache_) cache_->InvalidateAll();
+  }
+
+ private:
+  PreparedStatementCache* cache_;
+};
+
+/// \brief Replays buffered parameters to DoPutPreparedStatementQuery.
+class BufferedFlightMessageReader : public FlightMessageReader {
+ public:
+  BufferedFlightMessageReader(FlightDescriptor descriptor, std::shared_ptr<Schema> schema,
+                              std::vector<FlightStreamChunk> chunks,
+                              ipc::ReadStats stats)
+      : descriptor_(std::move(descriptor)),
+        schema_(std::move(schema)),
+        chunks_(std::move(chunks)),
+        stats_(stats) {}
+
+  const FlightDescriptor& descriptor() const override { return descriptor_; }
+
+  arrow::Result<std::shared_ptr<Schema>> GetSchema() override { return schema_; }
+
+  arrow::Result<FlightStreamChunk> Next() override {
+    if (position_ == chunks_.size()) return FlightStreamChunk{};
+    return std::move(chunks_[position_++]);
+  }
+
+  ipc::ReadStats stats() const override { return stats_; }
+
+ private:
+  FlightDescriptor descriptor_;
+  std::shared_ptr<Schema> schema_;
+  std::vector<FlightStreamChunk> chunks_;
+  size_t position_ = 0;
+  ipc::ReadStats stats_;
+};
+
+/// \brief Read the parameters uploaded by a client, and serialize them
+///     to key cached results with.
+arrow::Result<std::unique_ptr<FlightMessageReader>> BufferParameters(
+    FlightMessageReader* reader, std::string* serialized) {
+  ARROW_ASSIGN_OR_RAISE(auto schema, reader->GetSchema());
+  ARROW_ASSIGN_OR_RAISE(auto sink, io::BufferOutputStream::Create());
+  ARROW_ASSIGN_OR_RAISE(auto writer, ipc::MakeStreamWriter(sink, schema));
+  std::vector<FlightStreamChunk> chunks;
+  while (true) {
+    ARROW_ASSIGN_OR_RAISE(FlightStreamChunk chunk, reader->Next());
+    if (!chunk.data && !chunk.app_metadata) break;
+    if (chunk.data) RETURN_NOT_OK(writer->WriteRecordBatch(*chunk.data));
+    if (chunk.app_metadata) {
+      // Application metadata can affect how parameters are bound
+      RETURN_NOT_OK(writer->Close());
+      ARROW_ASSIGN_OR_RAISE(writer, ipc::MakeStreamWriter(sink, schema));
+      RETURN_NOT_OK(sink->Write(chunk.app_metadata));
+    }
+    chunks.push_back(std::move(chunk));
+  }
+  RETURN_NOT_OK(writer->Close());
+  ARROW_ASSIGN_OR_RAISE(auto buffer, sink->Finish());
+  *serialized = buffer->ToString();
+  return std::make_unique<BufferedFlightMessageReader>(
+      reader->descriptor(), std::move(schema), std::move(chunks), reader->stats());
+}
+
+}  // namespace
+
 arrow::Result<StatementQueryTicket> StatementQueryTicket::Deserialize(
     std::string_view serialized) {
   pb::sql::TicketStatementQuery command;
@@ -721,6 +1041,19 @@ Status FlightSqlServerBase::DoGet(const ServerCallContext& context, const Ticket
   } else if (any.Is<pb::sql::CommandPreparedStatementQuery>()) {
     ARROW_ASSIGN_OR_RAISE(PreparedStatementQuery internal_command,
                           ParseCommandPreparedStatementQuery(any));
+    if (prepared_statement_cache_) {
+      const std::string& handle = internal_command.prepared_statement_handle;
+      std::string key = prepared_statement_cache_->MakeKey(handle);
+      if (auto entry = prepared_statement_cache_->Lookup(key)) {
+        *stream = std::make_unique<CachedResultStream>(std::move(entry));
+        return Status::OK();
+      }
+      ARROW_ASSIGN_OR_RAISE(auto result,
+                            DoGetPreparedStatement(context, internal_command));
+      *stream = std::make_unique<CachingResultStream>(
+          prepared_statement_cache_, std::move(key), handle, std::move(result));
+      return Status::OK();
+    }
     ARROW_ASSIGN_OR_RAISE(*stream, DoGetPreparedStatement(context, internal_command));
     return Status::OK();
   } else if (any.Is<pb::sql::CommandGetCatalogs>()) {
@@ -784,6 +1117,7 @@ Status FlightSqlServerBase::DoPut(const ServerCallContext& context,
   if (any.Is<pb::sql::CommandStatementUpdate>()) {
     ARROW_ASSIGN_OR_RAISE(StatementUpdate internal_command,
                           ParseCommandStatementUpdate(any));
+    InvalidateOnUpdate invalidate(prepared_statement_cache_.get());
     ARROW_ASSIGN_OR_RAISE(auto record_count,
                           DoPutCommandStatementUpdate(context, internal_command))
 
@@ -797,6 +1131,7 @@ Status FlightSqlServerBase::DoPut(const ServerCallContext& context,
   } else if (any.Is<pb::sql::CommandStatementSubstraitPlan>()) {
     ARROW_ASSIGN_OR_RAISE(StatementSubstraitPlan internal_command,
                           ParseCommandStatementSubstraitPlan(any));
+    InvalidateOnUpdate invalidate(prepared_statement_cache_.get());
     ARROW_ASSIGN_OR_RAISE(auto record_count,
                           DoPutCommandSubstraitPlan(context, internal_command));
 
@@ -809,11 +1144,22 @@ Status FlightSqlServerBase::DoPut(const ServerCallContext& context,
   } else if (any.Is<pb::sql::CommandPreparedStatementQuery>()) {
     ARROW_ASSIGN_OR_RAISE(PreparedStatementQuery internal_command,
                           ParseCommandPreparedStatementQuery(any));
+    if (prepared_statement_cache_) {
+      // Keep the parameters, to look up the results of later DoGets with
+      std::string parameters;
+      ARROW_ASSIGN_OR_RAISE(auto buffered, BufferParameters(reader.get(), &parameters));
+      ARROW_RETURN_NOT_OK(DoPutPreparedStatementQuery(context, internal_command,
+                                                      buffered.get(), writer.get()));
+      prepared_statement_cache_->SetParameters(
+          internal_command.prepared_statement_handle, std::move(parameters));
+      return Status::OK();
+    }
     return DoPutPreparedStatementQuery(context, internal_command, reader.get(),
                                        writer.get());
   } else if (any.Is<pb::sql::CommandPreparedStatementUpdate>()) {
     ARROW_ASSIGN_OR_RAISE(PreparedStatementUpdate internal_command,
                           ParseCommandPreparedStatementUpdate(any));
+    InvalidateOnUpdate invalidate(prepared_statement_cache_.get());
     ARROW_ASSIGN_OR_RAISE(
         auto record_count,
         DoPutPreparedStatementUpdate(context, internal_command, reader.get()));
@@ -827,6 +1173,7 @@ Status FlightSqlServerBase::DoPut(const ServerCallContext& context,
   } else if (any.Is<pb::sql::CommandStatementIngest>()) {
     ARROW_ASSIGN_OR_RAISE(StatementIngest internal_command,
                           ParseCommandStatementIngest(any));
+    InvalidateOnUpdate invalidate(prepared_statement_cache_.get());
     ARROW_ASSIGN_OR_RAISE(
         auto record_count,
         DoPutCommandStatementIngest(context, internal_command, reader.get()));
@@ -947,14 +1294,19 @@ Status FlightSqlServerBase::DoAction(const ServerCallContext& context,
                FlightSqlServerBase::kClosePreparedStatementActionType.type) {
       ARROW_ASSIGN_OR_RAISE(ActionClosePreparedStatementRequest internal_command,
                             ParseActionClosePreparedStatementRequest(action));
+      if (prepared_statement_cache_) {
+        prepared_statement_cache_->Remove(internal_command.prepared_statement_handle);
+      }
       ARROW_RETURN_NOT_OK(ClosePreparedStatement(context, internal_command));
     } else if (action.type == FlightSqlServerBase::kEndSavepointActionType.type) {
       ARROW_ASSIGN_OR_RAISE(ActionEndSavepointRequest internal_command,
                             ParseActionEndSavepointRequest(action));
+      InvalidateOnUpdate invalidate(prepared_statement_cache_.get());
       ARROW_RETURN_NOT_OK(EndSavepoint(context, internal_command));
     } else if (action.type == FlightSqlServerBase::kEndTransactionActionType.type) {
       ARROW_ASSIGN_OR_RAISE(ActionEndTransactionRequest internal_command,
                             ParseActionEndTransactionRequest(action));
+      InvalidateOnUpdate invalidate(prepared_statement_cache_.get());
       ARROW_RETURN_NOT_OK(EndTransaction(context, internal_command));
     } else {
       return Status::NotImplemented("Action not implemented: ", action.type);
@@ -1055,6 +1407,27 @@ void FlightSqlServerBase::RegisterSqlInfo(int32_t id, const SqlInfoResult& resul
   sql_info_id_to_result_[id] = result;
 }
 
+void FlightSqlServerBase::EnablePreparedStatementCache(
+    const PreparedStatementCacheOptions& options) {
+  prepared_statement_cache_ = std::make_shared<PreparedStatementCache>(options);
+}
+
+void FlightSqlServerBase::InvalidatePreparedStatementCache(
+    const std::string& prepared_statement_handle) {
+  if (prepared_statement_cache_) {
+    prepared_statement_cache_->Invalidate(prepared_statement_handle);
+  }
+}
+
+void FlightSqlServerBase::InvalidatePreparedStatementCache() {
+  if (prepared_statement_cache_) prepared_statement_cache_->InvalidateAll();
+}
+
+PreparedStatementCacheStats FlightSqlServerBase::prepared_statement_cache_stats() const {
+  if (!prepared_statement_cache_) return {};
+  return prepared_statement_cache_->stats();
+}
+
 arrow::Result<std::unique_ptr<FlightDataStream>> FlightSqlServerBase::DoGetSqlInfo(
     const ServerCallContext& context, const GetSqlInfo& command) {
   MemoryPool* memory_pool = default_memory_pool();
@@ -19,6 +19,8 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <optional>
@@ -255,6 +257,35 @@ ARROW_FLIGHT_SQL_EXPORT
 arrow::Result<std::string> CreateStatementQueryTicket(
     const std::string& statement_handle);
 
+/// \brief Options for caching the results of prepared statements.
+struct ARROW_FLIGHT_SQL_EXPORT PreparedStatementCacheOptions {
+  /// \brief The maximum total size of the cached results, in bytes.
+  ///
+  /// The least recently used results are evicted to make room for new
+  /// ones; a result larger than this is not cached.
+  int64_t max_bytes = 256 * 1024 * 1024;
+  /// \brief How long a result stays valid. Zero or negative values keep
+  ///     results until they are evicted or invalidated.
+  std::chrono::duration<double> ttl = std::chrono::seconds(60);
+  /// \brief Whether to invalidate all results after an update, an ingest
+  ///     or the end of a transaction or savepoint.
+  bool invalidate_on_update = true;
+};
+
+/// \brief Statistics of the prepared statement result cache.
+struct ARROW_FLIGHT_SQL_EXPORT PreparedStatementCacheStats {
+  /// \brief Number of DoGets served from the cache.
+  int64_t hits = 0;
+  /// \brief Number of DoGets that executed the statement.
+  int64_t misses = 0;
+  /// \brief Number of results currently cached.
+  int64_t num_entries = 0;
+  /// \brief Total size of the results currently cached, in bytes.
+  int64_t num_bytes = 0;
+};
+
+class PreparedStatementCache;
+
 /// \brief The base class for Flight SQL servers.
 ///
 /// Applications should subclass this class and override the virtual
@@ -262,6 +293,7 @@ arrow::Result<std::string> CreateStatementQueryTicket(
 class ARROW_FLIGHT_SQL_EXPORT FlightSqlServerBase : public FlightServerBase {
  private:
   SqlInfoResultMap sql_info_id_to_result_;
+  std::shared_ptr<PreparedStatementCache> prepared_statement_cache_;
 
  public:
   /// \name Flight SQL methods
@@ -676,6 +708,32 @@ class ARROW_FLIGHT_SQL_EXPORT FlightSqlServerBase : public FlightServerBase {
   /// \param[in] result the result.
   void RegisterSqlInfo(int32_t id, const SqlInfoResult& result);
 
+  /// \brief Cache the results of prepared statement queries.
+  ///
+  /// Results of DoGetPreparedStatement are kept as the IPC payloads
+  /// that were sent, keyed by the prepared statement handle and the
+  /// parameters last bound to it with DoPutPreparedStatementQuery.
+  /// Later DoGets with the same key are served from memory, without
+  /// calling DoGetPreparedStatement or copying the payloads.
+  ///
+  /// Results are shared by all callers, so only enable this if they
+  /// do not depend on who runs the statement. Must be called before
+  /// the server starts serving.
+  /// \param[in] options the cache options.
+  void EnablePreparedStatementCache(const PreparedStatementCacheOptions& options);
+
+  /// \brief Drop the cached results of a prepared statement.
+  ///
+  /// Results are dropped automatically when the statement is closed.
+  /// \param[in] prepared_statement_handle the handle of the statement.
+  void InvalidatePreparedStatementCache(const std::string& prepared_statement_handle);
+
+  /// \brief Drop all cached results, e.g. after the underlying data changed.
+  void InvalidatePreparedStatementCache();
+
+  /// \brief Get statistics of the prepared statement result cache.
+  PreparedStatementCacheStats prepared_statement_cache_stats() const;
+
   /// @}
 
   /// \name Flight RPC handlers
@@ -166,7 +166,6 @@ class TestFlightSqlServer : public ::testing::Test {
     ASSERT_OK(server->Shutdown());
   }
 
- private:
   std::shared_ptr<arrow::flight::sql::example::SQLiteFlightSqlServer> server;
 };
 
@@ -542,6 +541,54 @@ TEST_F(TestFlightSqlServer, TestCommandPreparedStatementQueryWithParameterBindin
   ASSERT_NO_FATAL_FAILURE(AssertTablesEqual(*expected_table, *table, /*verbose=*/true));
 }
 
+TEST_F(TestFlightSqlServer, TestCommandPreparedStatementQueryCache) {
+  server->EnablePreparedStatementCache(PreparedStatementCacheOptions{});
+
+  ASSERT_OK_AND_ASSIGN(
+      auto prepared_statement,
+      sql_client->Prepare({}, "SELECT * FROM intTable WHERE keyName LIKE ?"));
+  const std::shared_ptr<Schema>& parameter_schema =
+      prepared_statement->parameter_schema();
+
+  auto execute = [&](const std::string& parameters) -> arrow::Result<int64_t> {
+    ARROW_RETURN_NOT_OK(prepared_statement->SetParameters(
+        RecordBatchFromJSON(parameter_schema, parameters)));
+    ARROW_ASSIGN_OR_RAISE(auto flight_info, prepared_statement->Execute());
+    ARROW_ASSIGN_OR_RAISE(auto stream,
+                          sql_client->DoGet({}, flight_info->endpoints()[0].ticket));
+    ARROW_ASSIGN_OR_RAISE(auto table, stream->ToTable());
+    return table->num_rows();
+  };
+
+  ASSERT_OK_AND_EQ(2, execute(R"([ [[0, "%one"]] ])"));
+  ASSERT_OK_AND_EQ(2, execute(R"([ [[0, "%one"]] ])"));
+  auto stats = server->prepared_statement_cache_stats();
+  ASSERT_EQ(1, stats.hits);
+  ASSERT_EQ(1, stats.misses);
+  ASSERT_EQ(1, stats.num_entries);
+  ASSERT_GT(stats.num_bytes, 0);
+
+  // Different parameters are a different result
+  ASSERT_OK_AND_EQ(1, execute(R"([ [[0, "%zero"]] ])"));
+  stats = server->prepared_statement_cache_stats();
+  ASSERT_EQ(1, stats.hits);
+  ASSERT_EQ(2, stats.misses);
+  ASSERT_EQ(2, stats.num_entries);
+
+  // Updates invalidate the cached results
+  ASSERT_OK_AND_EQ(1, sql_client->ExecuteUpdate(
+                          {}, "INSERT INTO intTable (keyName) VALUES ('new one')"));
+  ASSERT_EQ(0, server->prepared_statement_cache_stats().num_entries);
+  ASSERT_OK_AND_EQ(3, execute(R"([ [[0, "%one"]] ])"));
+  ASSERT_OK_AND_EQ(3, execute(R"([ [[0, "%one"]] ])"));
+  stats = server->prepared_statement_cache_stats();
+  ASSERT_EQ(2, stats.hits);
+  ASSERT_EQ(3, stats.misses);
+
+  ASSERT_OK(prepared_statement->Close());
+  ASSERT_EQ(0, server->prepared_statement_cache_stats().num_entries);
+}
+
 TEST_F(TestFlightSqlServer, TestCommandPreparedStatementUpdateWithParameterBinding) {
   ASSERT_OK_AND_ASSIGN(
       auto prepared_statement,
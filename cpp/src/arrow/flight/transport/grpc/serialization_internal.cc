@@ -71,19 +71,7 @@ using ::grpc::ByteBuffer;
 
 namespace {
 
-bool ReadBytesZeroCopy(const std::shared_ptr<Buffer>& source_data,
-                       CodedInputStream* input, std::shared_ptr<Buffer>* out) {
-  uint32_t length;
-  if (!input->ReadVarint32(&length)) {
-    return false;
-  }
-  auto buf =
-      SliceBuffer(source_data, input->CurrentPosition(), static_cast<int64_t>(length));
-  *out = buf;
-  return input->Skip(static_cast<int>(length));
-}
-
-// Internal wrapper for gRPC ByteBuffer so its memory can be exposed to Arrow
+// Internal wrapper for a gRPC slice so its memory can be exposed to Arrow
 // consumers with zero-copy
 class GrpcBuffer : public MutableBuffer {
  public:
@@ -97,61 +85,143 @@ class GrpcBuffer : public MutableBuffer {
     grpc_slice_unref(slice_);
   }
 
-  static Status Wrap(ByteBuffer* cpp_buf, std::shared_ptr<Buffer>* out) {
+ private:
+  grpc_slice slice_;
+};
+
+// A Protobuf input stream over the slices of a gRPC ByteBuffer.
+//
+// gRPC usually hands over large messages as many slices. Rather than
+// concatenating them, fields are exposed as Arrow buffers sharing the
+// slice memory when they lie within a single slice, and only fields
+// spanning several slices are gathered into a new allocation.
+class GrpcSliceInputStream : public google::protobuf::io::ZeroCopyInputStream {
+ public:
+  ~GrpcSliceInputStream() override {
+    if (owns_slices_) {
+      for (grpc_slice& slice : slices_) grpc_slice_unref(slice);
+    }
+  }
+
+  Status Init(ByteBuffer* cpp_buf) {
     // These types are guaranteed by static assertions in gRPC to have the same
     // in-memory representation
-
     auto buffer = *reinterpret_cast<grpc_byte_buffer**>(cpp_buf);
 
-    // This part below is based on the Flatbuffers gRPC SerializationTraits in
-    // flatbuffers/grpc.h
-
-    // Check if this is a single uncompressed slice.
-    if ((buffer->type == GRPC_BB_RAW) &&
-        (buffer->data.raw.compression == GRPC_COMPRESS_NONE) &&
-        (buffer->data.raw.slice_buffer.count == 1)) {
-      // If it is, then we can reference the `grpc_slice` directly.
-      grpc_slice slice = buffer->data.raw.slice_buffer.slices[0];
-
-      if (slice.refcount) {
-        // Increment reference count so this memory remains valid
-        *out = std::make_shared<GrpcBuffer>(slice, true);
-      } else {
-        // Small slices (less than GRPC_SLICE_INLINED_SIZE bytes) are
-        // inlined into the structure and must be copied.
-        const uint8_t length = slice.data.inlined.length;
-        ARROW_ASSIGN_OR_RAISE(*out, arrow::AllocateBuffer(length));
-        std::memcpy((*out)->mutable_data(), slice.data.inlined.bytes, length);
-      }
+    if (buffer->type == GRPC_BB_RAW &&
+        buffer->data.raw.compression == GRPC_COMPRESS_NONE) {
+      // Borrow the slices; the ByteBuffer keeps them alive while we parse
+      const grpc_slice_buffer& slice_buffer = buffer->data.raw.slice_buffer;
+      slices_.assign(slice_buffer.slices, slice_buffer.slices + slice_buffer.count);
     } else {
-      // Otherwise, we need to use `grpc_byte_buffer_reader_readall` to read
-      // `buffer` into a single contiguous `grpc_slice`. The gRPC reader gives
-      // us back a new slice with the refcount already incremented.
+      // Compressed messages must be decompressed by the gRPC reader, which
+      // gives us back a new slice with the refcount already incremented.
       grpc_byte_buffer_reader reader;
       if (!grpc_byte_buffer_reader_init(&reader, buffer)) {
         return Status::IOError("Internal gRPC error reading from ByteBuffer");
       }
-      grpc_slice slice = grpc_byte_buffer_reader_readall(&reader);
-      if (slice.refcount) {
-        // Steal the slice reference
-        *out = std::make_shared<GrpcBuffer>(slice, false);
-      } else {
-        // grpc_byte_buffer_reader_readall can give us an inlined slice,
-        // copy the data as above
-        const uint8_t length = slice.data.inlined.length;
-        ARROW_ASSIGN_OR_RAISE(*out, arrow::AllocateBuffer(length));
-        std::memcpy((*out)->mutable_data(), slice.data.inlined.bytes, length);
-      }
+      slices_.push_back(grpc_byte_buffer_reader_readall(&reader));
       grpc_byte_buffer_reader_destroy(&reader);
+      owns_slices_ = true;
     }
 
+    offsets_.reserve(slices_.size() + 1);
+    offsets_.push_back(0);
+    for (const grpc_slice& slice : slices_) {
+      offsets_.push_back(offsets_.back() + static_cast<int64_t>(GRPC_SLICE_LENGTH(slice)));
+    }
+    wrapped_.resize(slices_.size());
     return Status::OK();
   }
 
+  int64_t size() const { return offsets_.back(); }
+
+  /// \brief Get a range of the message as an Arrow buffer.
+  arrow::Result<std::shared_ptr<Buffer>> GetRange(int64_t offset, int64_t length) {
+    if (offset < 0 || length < 0 || offset + length > size()) {
+      return Status::IOError("FlightData field extends past the end of the message");
+    }
+    const size_t index = FindSlice(offset);
+    if (index < slices_.size() && offset + length <= offsets_[index + 1] &&
+        slices_[index].refcount) {
+      if (!wrapped_[index]) {
+        // Increment reference count so this memory remains valid after the
+        // ByteBuffer is cleared
+        wrapped_[index] = std::make_shared<GrpcBuffer>(slices_[index], /*incref=*/true);
+      }
+      return SliceBuffer(wrapped_[index], offset - offsets_[index], length);
+    }
+
+    // The range spans several slices, or lies in a small slice inlined
+    // into the slice structure: gather it into an aligned buffer
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> out, AllocateBuffer(length));
+    uint8_t* dest = out->mutable_data();
+    int64_t remaining = length;
+    for (size_t i = index; remaining > 0; i++) {
+      const int64_t start = std::max<int64_t>(offset - offsets_[i], 0);
+      const int64_t chunk = std::min(offsets_[i + 1] - offsets_[i] - start, remaining);
+      std::memcpy(dest, GRPC_SLICE_START_PTR(slices_[i]) + start, chunk);
+      dest += chunk;
+      remaining -= chunk;
+    }
+    return out;
+  }
+
+  bool Next(const void** data, int* size) override {
+    const size_t index = FindSlice(position_);
+    if (index >= slices_.size()) return false;
+    const int64_t start = position_ - offsets_[index];
+    *data = GRPC_SLICE_START_PTR(slices_[index]) + start;
+    *size = static_cast<int>(offsets_[index + 1] - position_);
+    position_ = offsets_[index + 1];
+    return true;
+  }
+
+  void BackUp(int count) override { position_ -= count; }
+
+  bool Skip(int count) override {
+    if (position_ + count > size()) {
+      position_ = size();
+      return false;
+    }
+    position_ += count;
+    return true;
+  }
+
+  int64_t ByteCount() const override { return position_; }
+
  private:
-  grpc_slice slice_;
+  // Index of the slice containing the given offset (slices_.size() at
+  // the end of the message), skipping empty slices
+  size_t FindSlice(int64_t offset) const {
+    auto it = std::upper_bound(offsets_.begin(), offsets_.end(), offset);
+    return static_cast<size_t>(it - offsets_.begin()) - 1;
+  }
+
+  std::vector<grpc_slice> slices_;
+  // Offset of each slice in the message, plus the total size
+  std::vector<int64_t> offsets_;
+  // Zero-copy wrappers of slices, created on demand
+  std::vector<std::shared_ptr<Buffer>> wrapped_;
+  bool owns_slices_ = false;
+  int64_t position_ = 0;
 };
 
+bool ReadBytesZeroCopy(GrpcSliceInputStream* source, CodedInputStream* input,
+                       std::shared_ptr<Buffer>* out) {
+  uint32_t length;
+  if (!input->ReadVarint32(&length)) {
+    return false;
+  }
+  auto maybe_buf =
+      source->GetRange(input->CurrentPosition(), static_cast<int64_t>(length));
+  if (!maybe_buf.ok()) {
+    return false;
+  }
+  *out = maybe_buf.MoveValueUnsafe();
+  return input->Skip(static_cast<int>(length));
+}
+
 // Destructor callback for grpc::Slice
 void ReleaseBuffer(void* buf_ptr) {
   delete reinterpret_cast<std::shared_ptr<Buffer>*>(buf_ptr);
@@ -178,6 +248,10 @@ arrow::Result<::grpc::Slice> SliceFromBuffer(const std::shared_ptr<Buffer>& buf)
 
 const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
 
+// Metadata fields at least this large are referenced by the outgoing
+// ByteBuffer rather than copied into its header slice
+constexpr int64_t kMinAliasedFieldSize = 4096;
+
 // Update the sizes of our Protobuf fields based on the given IPC payload.
 ::grpc::Status IpcMessageHeaderSize(const arrow::ipc::IpcPayload& ipc_msg, bool has_body,
                                     size_t* header_size, int32_t* metadata_size) {
@@ -240,15 +314,22 @@ const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
   // Validated in WritePayload since returning error here causes gRPC to fail an assertion
   DCHECK_LE(body_size, kInt32Max);
 
-  // Allocate and initialize slices
-  std::vector<::grpc::Slice> slices;
-  slices.emplace_back(header_size);
+  // Large metadata is sent from its own buffer. Its tag and length stay
+  // in the header slice, which is split around it.
+  const bool alias_metadata = has_ipc && metadata_size >= kMinAliasedFieldSize;
+  const bool alias_app_metadata = app_metadata_size >= kMinAliasedFieldSize;
+  if (alias_metadata) header_size -= metadata_size;
+  if (alias_app_metadata) header_size -= app_metadata_size;
+  // Header offsets at which referenced fields are inserted
+  std::vector<std::pair<int, std::shared_ptr<Buffer>>> aliased_fields;
+
+  ::grpc::Slice header(header_size);
 
   // Force the header_stream to be destructed, which actually flushes
   // the data into the slice.
   {
-    ArrayOutputStream header_writer(const_cast<uint8_t*>(slices[0].begin()),
-                                    static_cast<int>(slices[0].size()));
+    ArrayOutputStream header_writer(const_cast<uint8_t*>(header.begin()),
+                                    static_cast<int>(header.size()));
     CodedOutputStream header_stream(&header_writer);
 
     // Write descriptor
@@ -265,8 +346,12 @@ const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
       WireFormatLite::WriteTag(pb::FlightData::kDataHeaderFieldNumber,
                                WireFormatLite::WIRETYPE_LENGTH_DELIMITED, &header_stream);
       header_stream.WriteVarint32(metadata_size);
-      header_stream.WriteRawMaybeAliased(ipc_msg.metadata->data(),
-                                         static_cast<int>(ipc_msg.metadata->size()));
+      if (alias_metadata) {
+        aliased_fields.emplace_back(header_stream.ByteCount(), ipc_msg.metadata);
+      } else {
+        header_stream.WriteRawMaybeAliased(ipc_msg.metadata->data(),
+                                           static_cast<int>(ipc_msg.metadata->size()));
+      }
     }
 
     // Write app metadata
@@ -274,8 +359,12 @@ const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
       WireFormatLite::WriteTag(pb::FlightData::kAppMetadataFieldNumber,
                                WireFormatLite::WIRETYPE_LENGTH_DELIMITED, &header_stream);
       header_stream.WriteVarint32(app_metadata_size);
-      header_stream.WriteRawMaybeAliased(msg.app_metadata->data(),
-                                         static_cast<int>(msg.app_metadata->size()));
+      if (alias_app_metadata) {
+        aliased_fields.emplace_back(header_stream.ByteCount(), msg.app_metadata);
+      } else {
+        header_stream.WriteRawMaybeAliased(msg.app_metadata->data(),
+                                           static_cast<int>(msg.app_metadata->size()));
+      }
     }
 
     if (has_body) {
@@ -283,31 +372,56 @@ const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
       WireFormatLite::WriteTag(pb::FlightData::kDataBodyFieldNumber,
                                WireFormatLite::WIRETYPE_LENGTH_DELIMITED, &header_stream);
       header_stream.WriteVarint32(static_cast<uint32_t>(body_size));
+    }
 
-      // Enqueue body buffers for writing, without copying
-      for (const auto& buffer : ipc_msg.body_buffers) {
-        // Buffer may be null when the row length is zero, or when all
-        // entries are invalid.
-        if (!buffer || buffer->size() == 0) continue;
-
-        ::grpc::Slice slice;
-        auto status = SliceFromBuffer(buffer).Value(&slice);
-        if (ARROW_PREDICT_FALSE(!status.ok())) {
-          // This will likely lead to abort as gRPC cannot recover from an error here
-          return ToGrpcStatus(status);
-        }
-        slices.push_back(std::move(slice));
+    DCHECK_EQ(static_cast<int>(header_size), header_stream.ByteCount());
+  }
 
-        // Write padding if not multiple of 8
-        const auto remainder = static_cast<int>(
-            bit_util::RoundUpToMultipleOf8(buffer->size()) - buffer->size());
-        if (remainder) {
-          slices.emplace_back(kPaddingBytes, remainder);
-        }
+  // Allocate and initialize slices
+  std::vector<::grpc::Slice> slices;
+  if (aliased_fields.empty()) {
+    slices.push_back(std::move(header));
+  } else {
+    // Sub-slices share the header allocation
+    size_t begin = 0;
+    for (const auto& [split, buffer] : aliased_fields) {
+      slices.push_back(header.sub(begin, split));
+      ::grpc::Slice slice;
+      auto status = SliceFromBuffer(buffer).Value(&slice);
+      if (ARROW_PREDICT_FALSE(!status.ok())) {
+        return ToGrpcStatus(status);
       }
+      slices.push_back(std::move(slice));
+      begin = split;
+    }
+    if (begin < header_size) {
+      slices.push_back(header.sub(begin, header_size));
     }
+  }
 
-    DCHECK_EQ(static_cast<int>(header_size), header_stream.ByteCount());
+  if (has_body) {
+    // Enqueue body buffers for writing, without copying
+    for (const auto& buffer : ipc_msg.body_buffers) {
+      // Buffer may be null when the row length is zero, or when all
+      // entries are invalid.
+      if (!buffer || buffer->size() == 0) continue;
+
+      ::grpc::Slice slice;
+      auto status = SliceFromBuffer(buffer).Value(&slice);
+      if (ARROW_PREDICT_FALSE(!status.ok())) {
+        // This will likely lead to abort as gRPC cannot recover from an error here
+        return ToGrpcStatus(status);
+      }
+      slices.push_back(std::move(slice));
+
+      // Write padding if not multiple of 8. The padding is static, so
+      // no slice is allocated for it.
+      const auto remainder = static_cast<int>(
+          bit_util::RoundUpToMultipleOf8(buffer->size()) - buffer->size());
+      if (remainder) {
+        slices.emplace_back(kPaddingBytes, remainder, ::grpc::Slice::STATIC_SLICE);
+      }
+    }
   }
 
   // Hand off the slices to the returned ByteBuffer
@@ -330,11 +444,11 @@ const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
   out->metadata = nullptr;
   out->body = nullptr;
 
-  std::shared_ptr<arrow::Buffer> wrapped_buffer;
-  GRPC_RETURN_NOT_OK(GrpcBuffer::Wrap(buffer, &wrapped_buffer));
+  GrpcSliceInputStream slice_stream;
+  GRPC_RETURN_NOT_OK(slice_stream.Init(buffer));
 
-  auto buffer_length = static_cast<int>(wrapped_buffer->size());
-  CodedInputStream pb_stream(wrapped_buffer->data(), buffer_length);
+  auto buffer_length = static_cast<int>(slice_stream.size());
+  CodedInputStream pb_stream(&slice_stream);
 
   pb_stream.SetTotalBytesLimit(buffer_length);
 
@@ -363,18 +477,18 @@ const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
         out->descriptor = std::make_unique<arrow::flight::FlightDescriptor>(descriptor);
       } break;
       case pb::FlightData::kDataHeaderFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->metadata)) {
+        if (!ReadBytesZeroCopy(&slice_stream, &pb_stream, &out->metadata)) {
           return {::grpc::StatusCode::INTERNAL, "Unable to read FlightData metadata"};
         }
       } break;
       case pb::FlightData::kAppMetadataFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->app_metadata)) {
+        if (!ReadBytesZeroCopy(&slice_stream, &pb_stream, &out->app_metadata)) {
           return {::grpc::StatusCode::INTERNAL,
                   "Unable to read FlightData application metadata"};
         }
       } break;
       case pb::FlightData::kDataBodyFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->body)) {
+        if (!ReadBytesZeroCopy(&slice_stream, &pb_stream, &out->body)) {
           return {::grpc::StatusCode::INTERNAL, "Unable to read FlightData body"};
         }
       } break;
@@ -0,0 +1,530 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// UCX client transport for Arrow Flight
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/flight/client.h"
+#include "arrow/flight/client_auth.h"
+#include "arrow/flight/middleware.h"
+#include "arrow/flight/transport.h"
+#include "arrow/flight/transport/ucx/ucx_internal.h"
+#include "arrow/flight/types.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string.h"
+#include "arrow/util/uri.h"
+
+namespace arrow {
+namespace flight {
+namespace transport {
+namespace ucx {
+
+namespace {
+
+class UcxClientImpl;
+
+/// \brief Per-call state: a connection taken from the client's pool,
+///   returned to it when the call completes.
+class ClientCall {
+ public:
+  ClientCall(UcxClientImpl* client, std::unique_ptr<UcpCallDriver> driver)
+      : client_(client), driver_(std::move(driver)) {}
+  ~ClientCall();
+
+  UcpCallDriver* driver() const { return driver_.get(); }
+
+  /// \brief Read frames until the final headers, passing buffer frames
+  ///   to the callback, and return the server status.
+  Status ReadUntilStatus(const std::function<Status(std::shared_ptr<Buffer>)>& on_buffer);
+
+  /// \brief Record the final headers of the call.
+  void Finished(const Frame& frame) {
+    auto headers = HeadersFrame::Parse(frame.buffer);
+    server_status_ = headers.ok() ? headers->GetStatus() : headers.status();
+    finished_ = true;
+  }
+  /// \brief Record a transport failure; the connection is not reused.
+  void Failed(Status status) {
+    transport_status_ = std::move(status);
+    finished_ = true;
+  }
+
+  bool finished() const { return finished_; }
+  Status status() const {
+    RETURN_NOT_OK(transport_status_);
+    return server_status_;
+  }
+
+ private:
+  UcxClientImpl* client_;
+  std::unique_ptr<UcpCallDriver> driver_;
+  bool finished_ = false;
+  Status server_status_;
+  Status transport_status_;
+};
+
+/// \brief A data stream for DoGet, DoPut and DoExchange.
+class UcxClientStream : public internal::ClientDataStream {
+ public:
+  UcxClientStream(std::unique_ptr<ClientCall> call, bool client_streams)
+      : call_(std::move(call)), writes_done_(!client_streams) {}
+
+  bool ReadData(internal::FlightData* data) override {
+    std::lock_guard<std::mutex> guard(read_mutex_);
+    while (!call_->finished()) {
+      auto maybe_frame = call_->driver()->ReadFrame();
+      if (!maybe_frame.ok()) {
+        call_->Failed(maybe_frame.status());
+        return false;
+      }
+      const Frame& frame = *maybe_frame;
+      switch (frame.type) {
+        case FrameType::kHeaders:
+          call_->Finished(frame);
+          return false;
+        case FrameType::kPayloadHeader: {
+          Status status = call_->driver()->ReadFlightData(frame, data);
+          if (!status.ok()) {
+            call_->Failed(std::move(status));
+            return false;
+          }
+          return true;
+        }
+        case FrameType::kBuffer:
+          // Stray DoPut metadata; not expected here
+          continue;
+        default:
+          call_->Failed(Status::IOError("Unexpected frame type ",
+                                        static_cast<int>(frame.type)));
+          return false;
+      }
+    }
+    return false;
+  }
+
+  bool ReadPutMetadata(std::shared_ptr<Buffer>* out) override {
+    std::lock_guard<std::mutex> guard(read_mutex_);
+    while (!call_->finished()) {
+      auto maybe_frame = call_->driver()->ReadFrame();
+      if (!maybe_frame.ok()) {
+        call_->Failed(maybe_frame.status());
+        return false;
+      }
+      switch (maybe_frame->type) {
+        case FrameType::kHeaders:
+          call_->Finished(*maybe_frame);
+          return false;
+        case FrameType::kBuffer:
+          *out = std::move(maybe_frame->buffer);
+          return true;
+        default:
+          call_->Failed(Status::IOError("Unexpected frame type ",
+                                        static_cast<int>(maybe_frame->type)));
+          return false;
+      }
+    }
+    return false;
+  }
+
+  arrow::Result<bool> WriteData(const FlightPayload& payload) override {
+    if (writes_done_ || call_->finished()) return false;
+    Status status = call_->driver()->SendFlightPayload(payload);
+    if (!status.ok()) {
+      // The status will be reported by Finish()
+      std::lock_guard<std::mutex> guard(read_mutex_);
+      call_->Failed(std::move(status));
+      return false;
+    }
+    return true;
+  }
+
+  Status WritesDone() override {
+    if (writes_done_) return Status::OK();
+    writes_done_ = true;
+    // An empty headers frame ends the client's half of the call
+    return call_->driver()->SendHeaders({});
+  }
+
+ protected:
+  Status DoFinish() override {
+    // The server drains our half of the call even if it already sent
+    // its status, so always end it
+    Status status = WritesDone();
+    std::lock_guard<std::mutex> guard(read_mutex_);
+    if (!status.ok()) {
+      call_->Failed(std::move(status));
+    }
+    // Drain anything the server still sends, so the connection can be
+    // reused
+    if (!call_->finished()) {
+      ARROW_UNUSED(call_->ReadUntilStatus(
+          [](std::shared_ptr<Buffer>) { return Status::OK(); }));
+    }
+    return call_->status();
+  }
+
+ private:
+  std::unique_ptr<ClientCall> call_;
+  std::mutex read_mutex_;
+  bool writes_done_;
+};
+
+class UcxClientAuthSender : public ClientAuthSender {
+ public:
+  explicit UcxClientAuthSender(UcpCallDriver* driver) : driver_(driver) {}
+  Status Write(const std::string& token) override {
+    return driver_->SendBuffer(Buffer(token));
+  }
+
+ private:
+  UcpCallDriver* driver_;
+};
+
+class UcxClientAuthReader : public ClientAuthReader {
+ public:
+  explicit UcxClientAuthReader(ClientCall* call) : call_(call) {}
+  Status Read(std::string* token) override {
+    if (call_->finished()) return Status::IOError("Stream is closed.");
+    ARROW_ASSIGN_OR_RAISE(Frame frame, call_->driver()->ReadFrame());
+    if (frame.type == FrameType::kHeaders) {
+      call_->Finished(frame);
+      return Status::IOError("Stream is closed.");
+    }
+    if (frame.type != FrameType::kBuffer) {
+      return Status::IOError("Unexpected frame type ", static_cast<int>(frame.type));
+    }
+    *token = frame.buffer->ToString();
+    return Status::OK();
+  }
+
+ private:
+  ClientCall* call_;
+};
+
+class UcxClientImpl : public internal::ClientTransport {
+ public:
+  ~UcxClientImpl() override {
+    ARROW_WARN_NOT_OK(Close(), "UcxClientImpl: Close() failed");
+  }
+
+  Status Init(const FlightClientOptions& options, const Location& location,
+              const arrow::util::Uri& uri) override {
+    if (!options.middleware.empty()) {
+      return Status::NotImplemented("Client middleware with the UCX transport");
+    }
+    ARROW_ASSIGN_OR_RAISE(address_length_, UriToSockaddr(uri, &address_));
+    ARROW_ASSIGN_OR_RAISE(ucp_context_, UcpContext::Make());
+    // Connect eagerly so that an unreachable server is reported here
+    ARROW_ASSIGN_OR_RAISE(auto driver, Connect());
+    ReturnConnection(std::move(driver));
+    return Status::OK();
+  }
+
+  Status Close() override {
+    std::deque<std::unique_ptr<UcpCallDriver>> connections;
+    {
+      std::lock_guard<std::mutex> guard(connections_mutex_);
+      closed_ = true;
+      connections.swap(connections_);
+    }
+    Status status;
+    for (auto& connection : connections) {
+      status &= connection->Close();
+    }
+    return status;
+  }
+
+  Status Authenticate(const FlightCallOptions& options,
+                      std::unique_ptr<ClientAuthHandler> auth_handler) override {
+    auth_handler_ = std::move(auth_handler);
+    ARROW_ASSIGN_OR_RAISE(auto call, StartCall(options, FlightMethod::Handshake));
+    UcxClientAuthSender outgoing(call->driver());
+    UcxClientAuthReader incoming(call.get());
+    Status status = auth_handler_->Authenticate(&outgoing, &incoming);
+    // End our half of the handshake, then wait for the server's status
+    Status end_status = call->driver()->SendHeaders({});
+    if (!end_status.ok()) {
+      call->Failed(end_status);
+      return end_status;
+    }
+    Status server_status = call->ReadUntilStatus(
+        [](std::shared_ptr<Buffer>) { return Status::OK(); });
+    // Prefer the server's explanation of a failed handshake
+    if (!server_status.ok()) return server_status;
+    return status;
+  }
+
+  Status ListFlights(const FlightCallOptions& options, const Criteria& criteria,
+                     std::unique_ptr<FlightListing>* listing) override {
+    ARROW_ASSIGN_OR_RAISE(auto request, criteria.SerializeToString());
+    std::vector<FlightInfo> flights;
+    RETURN_NOT_OK(
+        UnaryCall(options, FlightMethod::ListFlights, &request,
+                  [&](std::shared_ptr<Buffer> buffer) -> Status {
+                    ARROW_ASSIGN_OR_RAISE(
+                        auto info, FlightInfo::Deserialize(std::string_view(*buffer)));
+                    flights.push_back(std::move(*info));
+                    return Status::OK();
+                  }));
+    listing->reset(new SimpleFlightListing(std::move(flights)));
+    return Status::OK();
+  }
+
+  Status DoAction(const FlightCallOptions& options, const Action& action,
+                  std::unique_ptr<ResultStream>* results) override {
+    ARROW_ASSIGN_OR_RAISE(auto request, action.SerializeToString());
+    std::vector<Result> collected;
+    RETURN_NOT_OK(UnaryCall(options, FlightMethod::DoAction, &request,
+                            [&](std::shared_ptr<Buffer> buffer) -> Status {
+                              ARROW_ASSIGN_OR_RAISE(
+                                  auto result,
+                                  Result::Deserialize(std::string_view(*buffer)));
+                              collected.push_back(std::move(result));
+                              return Status::OK();
+                            }));
+    results->reset(new SimpleResultStream(std::move(collected)));
+    return Status::OK();
+  }
+
+  Status ListActions(const FlightCallOptions& options,
+                     std::vector<ActionType>* actions) override {
+    return UnaryCall(options, FlightMethod::ListActions, /*request=*/nullptr,
+                     [&](std::shared_ptr<Buffer> buffer) -> Status {
+                       ARROW_ASSIGN_OR_RAISE(
+                           auto type, ActionType::Deserialize(std::string_view(*buffer)));
+                       actions->push_back(std::move(type));
+                       return Status::OK();
+                     });
+  }
+
+  Status GetFlightInfo(const FlightCallOptions& options,
+                       const FlightDescriptor& descriptor,
+                       std::unique_ptr<FlightInfo>* info) override {
+    ARROW_ASSIGN_OR_RAISE(auto request, descriptor.SerializeToString());
+    RETURN_NOT_OK(UnaryCall(options, FlightMethod::GetFlightInfo, &request,
+                            [&](std::shared_ptr<Buffer> buffer) -> Status {
+                              return FlightInfo::Deserialize(std::string_view(*buffer))
+                                  .Value(info);
+                            }));
+    if (!*info) return Status::IOError("Server did not send a FlightInfo");
+    return Status::OK();
+  }
+
+  Status PollFlightInfo(const FlightCallOptions& options,
+                        const FlightDescriptor& descriptor,
+                        std::unique_ptr<PollInfo>* info) override {
+    ARROW_ASSIGN_OR_RAISE(auto request, descriptor.SerializeToString());
+    RETURN_NOT_OK(UnaryCall(options, FlightMethod::PollFlightInfo, &request,
+                            [&](std::shared_ptr<Buffer> buffer) -> Status {
+                              return PollInfo::Deserialize(std::string_view(*buffer))
+                                  .Value(info);
+                            }));
+    if (!*info) return Status::IOError("Server did not send a PollInfo");
+    return Status::OK();
+  }
+
+  arrow::Result<std::unique_ptr<SchemaResult>> GetSchema(
+      const FlightCallOptions& options, const FlightDescriptor& descriptor) override {
+    ARROW_ASSIGN_OR_RAISE(auto request, descriptor.SerializeToString());
+    std::unique_ptr<SchemaResult> schema_result;
+    RETURN_NOT_OK(UnaryCall(options, FlightMethod::GetSchema, &request,
+                            [&](std::shared_ptr<Buffer> buffer) -> Status {
+                              ARROW_ASSIGN_OR_RAISE(
+                                  auto result,
+                                  SchemaResult::Deserialize(std::string_view(*buffer)));
+                              schema_result =
+                                  std::make_unique<SchemaResult>(std::move(result));
+                              return Status::OK();
+                            }));
+    if (!schema_result) return Status::IOError("Server did not send a SchemaResult");
+    return schema_result;
+  }
+
+  Status DoGet(const FlightCallOptions& options, const Ticket& ticket,
+               std::unique_ptr<internal::ClientDataStream>* out) override {
+    ARROW_ASSIGN_OR_RAISE(auto request, ticket.SerializeToString());
+    ARROW_ASSIGN_OR_RAISE(auto call, StartCall(options, FlightMethod::DoGet));
+    RETURN_NOT_OK(call->driver()->SendBuffer(Buffer(request)));
+    *out = std::make_unique<UcxClientStream>(std::move(call), /*client_streams=*/false);
+    return Status::OK();
+  }
+
+  Status DoPut(const FlightCallOptions& options,
+               std::unique_ptr<internal::ClientDataStream>* out) override {
+    ARROW_ASSIGN_OR_RAISE(auto call, StartCall(options, FlightMethod::DoPut));
+    *out = std::make_unique<UcxClientStream>(std::move(call), /*client_streams=*/true);
+    return Status::OK();
+  }
+
+  Status DoExchange(const FlightCallOptions& options,
+                    std::unique_ptr<internal::ClientDataStream>* out) override {
+    ARROW_ASSIGN_OR_RAISE(auto call, StartCall(options, FlightMethod::DoExchange));
+    *out = std::make_unique<UcxClientStream>(std::move(call), /*client_streams=*/true);
+    return Status::OK();
+  }
+
+  /// \brief Give a connection back to the pool, or close it if it
+  ///   cannot be reused.
+  void ReturnConnection(std::unique_ptr<UcpCallDriver> driver) {
+    if (driver->is_connected()) {
+      std::lock_guard<std::mutex> guard(connections_mutex_);
+      if (!closed_) {
+        connections_.push_back(std::move(driver));
+        return;
+      }
+    }
+    ARROW_WARN_NOT_OK(driver->Close(), "Error closing UCX connection");
+  }
+
+ private:
+  arrow::Result<std::unique_ptr<UcpCallDriver>> Connect() {
+    // Each connection gets its own worker, so that calls on different
+    // connections can progress in parallel from different threads
+    ARROW_ASSIGN_OR_RAISE(auto worker, UcpWorker::Make(ucp_context_));
+    return UcpCallDriver::Connect(std::move(worker), address_, address_length_);
+  }
+
+  arrow::Result<std::unique_ptr<UcpCallDriver>> GetConnection() {
+    {
+      std::lock_guard<std::mutex> guard(connections_mutex_);
+      if (closed_) return Status::Invalid("Client is closed");
+      while (!connections_.empty()) {
+        auto driver = std::move(connections_.front());
+        connections_.pop_front();
+        if (driver->is_connected()) return driver;
+        ARROW_UNUSED(driver->Close());
+      }
+    }
+    return Connect();
+  }
+
+  /// \brief Take a connection and send the call headers.
+  arrow::Result<std::unique_ptr<ClientCall>> StartCall(const FlightCallOptions& options,
+                                                       FlightMethod method) {
+    HeaderList headers;
+    headers.emplace_back(kHeaderMethod,
+                         ::arrow::internal::ToChars(static_cast<int>(method)));
+    for (const auto& header : options.headers) {
+      headers.push_back(header);
+    }
+    if (auth_handler_ && method != FlightMethod::Handshake) {
+      std::string token;
+      RETURN_NOT_OK(auth_handler_->GetToken(&token));
+      headers.emplace_back(kHeaderAuthToken, std::move(token));
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto driver, GetConnection());
+    driver->set_memory_manager(options.memory_manager);
+    auto call = std::make_unique<ClientCall>(this, std::move(driver));
+    Status status = call->driver()->SendHeaders(headers);
+    if (!status.ok()) {
+      call->Failed(status);
+      return status;
+    }
+    return call;
+  }
+
+  /// \brief Make a call with an optional request, and a stream of
+  ///   buffers in response.
+  Status UnaryCall(const FlightCallOptions& options, FlightMethod method,
+                   const std::string* request,
+                   const std::function<Status(std::shared_ptr<Buffer>)>& on_buffer) {
+    ARROW_ASSIGN_OR_RAISE(auto call, StartCall(options, method));
+    if (request) {
+      Status status = call->driver()->SendBuffer(Buffer(*request));
+      if (!status.ok()) {
+        call->Failed(status);
+        return status;
+      }
+    }
+    return call->ReadUntilStatus(on_buffer);
+  }
+
+  std::shared_ptr<UcpContext> ucp_context_;
+  sockaddr_storage address_;
+  size_t address_length_ = 0;
+  std::unique_ptr<ClientAuthHandler> auth_handler_;
+
+  std::mutex connections_mutex_;
+  std::deque<std::unique_ptr<UcpCallDriver>> connections_;
+  bool closed_ = false;
+};
+
+ClientCall::~ClientCall() {
+  if (!driver_) return;
+  if (finished_ && transport_status_.ok()) {
+    client_->ReturnConnection(std::move(driver_));
+  } else {
+    // The call was abandoned or failed midway, so the connection is in
+    // an unknown state
+    ARROW_UNUSED(driver_->Close());
+  }
+}
+
+Status ClientCall::ReadUntilStatus(
+    const std::function<Status(std::shared_ptr<Buffer>)>& on_buffer) {
+  Status callback_status;
+  while (!finished_) {
+    auto maybe_frame = driver_->ReadFrame();
+    if (!maybe_frame.ok()) {
+      Failed(maybe_frame.status());
+      break;
+    }
+    switch (maybe_frame->type) {
+      case FrameType::kHeaders:
+        Finished(*maybe_frame);
+        break;
+      case FrameType::kBuffer:
+        // Keep reading after an error, so the connection can be reused
+        if (callback_status.ok()) {
+          callback_status = on_buffer(std::move(maybe_frame->buffer));
+        }
+        break;
+      case FrameType::kPayloadHeader:
+      case FrameType::kPayloadBody:
+        // Unread data of an abandoned stream
+        break;
+      default:
+        Failed(Status::IOError("Unexpected frame type ",
+                               static_cast<int>(maybe_frame->type)));
+        break;
+    }
+  }
+  RETURN_NOT_OK(status());
+  return callback_status;
+}
+
+}  // namespace
+
+arrow::Result<std::unique_ptr<internal::ClientTransport>> MakeUcxClientImpl() {
+  return std::make_unique<UcxClientImpl>();
+}
+
+}  // namespace ucx
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,739 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/transport/ucx/ucx_internal.h"
+
+#include <netdb.h>
+#include <poll.h>
+
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <mutex>
+
+#include "arrow/buffer.h"
+#include "arrow/device.h"
+#include "arrow/memory_pool.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/endian.h"
+#include "arrow/util/logging_internal.h"
+#include "arrow/util/string.h"
+
+namespace arrow {
+namespace flight {
+namespace transport {
+namespace ucx {
+
+using internal::TransportStatus;
+using ::arrow::internal::ToChars;
+
+namespace {
+
+/// How long a blocked thread sleeps on the worker before checking
+/// again, in case a wakeup was consumed by another thread.
+constexpr int kWaitTimeoutMs = 100;
+
+const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+
+// Layout of a payload header frame. The fixed part is followed by the
+// descriptor, the IPC metadata and the application metadata, each
+// padded to a multiple of 8 bytes so that the IPC metadata stays
+// aligned.
+struct PayloadHeaderLayout {
+  uint32_t flags;
+  uint32_t descriptor_size;
+  uint32_t metadata_size;
+  uint32_t app_metadata_size;
+  int64_t body_size;
+};
+static_assert(sizeof(PayloadHeaderLayout) == 24, "PayloadHeaderLayout must be packed");
+
+constexpr uint32_t kHasDescriptor = 1;
+constexpr uint32_t kHasMetadata = 2;
+constexpr uint32_t kHasAppMetadata = 4;
+
+void PutUInt32(uint32_t value, uint8_t** out) {
+  value = bit_util::ToLittleEndian(value);
+  std::memcpy(*out, &value, sizeof(value));
+  *out += sizeof(value);
+}
+
+bool GetUInt32(const uint8_t** data, const uint8_t* end, uint32_t* out) {
+  if (end - *data < static_cast<int64_t>(sizeof(uint32_t))) return false;
+  uint32_t value;
+  std::memcpy(&value, *data, sizeof(value));
+  *out = bit_util::FromLittleEndian(value);
+  *data += sizeof(value);
+  return true;
+}
+
+std::string SockaddrToString(const sockaddr_storage& address) {
+  char host[NI_MAXHOST];
+  char port[NI_MAXSERV];
+  const socklen_t length = address.ss_family == AF_INET6 ? sizeof(sockaddr_in6)
+                                                         : sizeof(sockaddr_in);
+  if (getnameinfo(reinterpret_cast<const sockaddr*>(&address), length, host,
+                  sizeof(host), port, sizeof(port), NI_NUMERICHOST | NI_NUMERICSERV) !=
+      0) {
+    return "<unknown>";
+  }
+  if (address.ss_family == AF_INET6) {
+    return std::string("ucx:[") + host + "]:" + port;
+  }
+  return std::string("ucx:") + host + ":" + port;
+}
+
+}  // namespace
+
+//------------------------------------------------------------
+// Headers
+
+arrow::Result<std::shared_ptr<Buffer>> HeadersFrame::Serialize(
+    const HeaderList& headers) {
+  int64_t total_size = sizeof(uint32_t);
+  for (const auto& header : headers) {
+    total_size += 2 * sizeof(uint32_t) + header.first.size() + header.second.size();
+  }
+  if (headers.size() > std::numeric_limits<uint32_t>::max()) {
+    return Status::Invalid("Too many headers: ", headers.size());
+  }
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer, AllocateBuffer(total_size));
+  uint8_t* out = buffer->mutable_data();
+  PutUInt32(static_cast<uint32_t>(headers.size()), &out);
+  for (const auto& header : headers) {
+    if (header.first.size() > std::numeric_limits<uint32_t>::max() ||
+        header.second.size() > std::numeric_limits<uint32_t>::max()) {
+      return Status::Invalid("Header ", header.first, " is too large");
+    }
+    PutUInt32(static_cast<uint32_t>(header.first.size()), &out);
+    PutUInt32(static_cast<uint32_t>(header.second.size()), &out);
+    std::memcpy(out, header.first.data(), header.first.size());
+    out += header.first.size();
+    std::memcpy(out, header.second.data(), header.second.size());
+    out += header.second.size();
+  }
+  DCHECK_EQ(out, buffer->data() + total_size);
+  return buffer;
+}
+
+arrow::Result<HeadersFrame> HeadersFrame::Parse(std::shared_ptr<Buffer> buffer) {
+  HeadersFrame frame;
+  const uint8_t* data = buffer->data();
+  const uint8_t* end = data + buffer->size();
+  uint32_t count = 0;
+  if (!GetUInt32(&data, end, &count)) {
+    return Status::IOError("Headers frame is truncated");
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t key_size = 0, value_size = 0;
+    if (!GetUInt32(&data, end, &key_size) || !GetUInt32(&data, end, &value_size) ||
+        end - data < static_cast<int64_t>(key_size) + static_cast<int64_t>(value_size)) {
+      return Status::IOError("Headers frame is truncated");
+    }
+    std::string_view key(reinterpret_cast<const char*>(data), key_size);
+    data += key_size;
+    std::string_view value(reinterpret_cast<const char*>(data), value_size);
+    data += value_size;
+    frame.headers_.emplace_back(key, value);
+  }
+  frame.buffer_ = std::move(buffer);
+  return frame;
+}
+
+std::optional<std::string_view> HeadersFrame::Get(std::string_view key) const {
+  for (const auto& header : headers_) {
+    if (header.first == key) return header.second;
+  }
+  return std::nullopt;
+}
+
+Status HeadersFrame::GetStatus() const {
+  const auto code_str = Get(kHeaderStatus);
+  if (!code_str) {
+    return Status::IOError("Server did not send a status");
+  }
+  std::string message(Get(kHeaderMessage).value_or(""));
+  Status status =
+      TransportStatus::FromCodeStringAndMessage(std::string(*code_str), std::move(message))
+          .ToStatus();
+  if (status.ok()) return status;
+
+  // Recover the exact Arrow status, if the server sent it
+  const auto arrow_code_str = Get(kHeaderArrowStatus);
+  if (!arrow_code_str) return status;
+  auto to_optional = [this](const char* key) -> std::optional<std::string> {
+    if (auto value = Get(key)) return std::string(*value);
+    return std::nullopt;
+  };
+  return internal::ReconstructStatus(
+      std::string(*arrow_code_str), status, to_optional(kHeaderArrowMessage),
+      to_optional(kHeaderArrowDetail), to_optional(kHeaderErrorDetails),
+      FlightStatusDetail::UnwrapStatus(status));
+}
+
+HeaderList StatusToHeaders(const Status& status) {
+  TransportStatus transport_status = TransportStatus::FromStatus(status);
+  HeaderList headers;
+  headers.emplace_back(kHeaderStatus, ToChars(static_cast<int>(transport_status.code)));
+  headers.emplace_back(kHeaderMessage, std::move(transport_status.message));
+  if (!status.ok()) {
+    headers.emplace_back(kHeaderArrowStatus, ToChars(static_cast<int>(status.code())));
+    headers.emplace_back(kHeaderArrowMessage, status.message());
+    if (status.detail()) {
+      headers.emplace_back(kHeaderArrowDetail, status.detail()->ToString());
+    }
+    auto flight_detail = FlightStatusDetail::UnwrapStatus(status);
+    if (flight_detail && !flight_detail->extra_info().empty()) {
+      headers.emplace_back(kHeaderErrorDetails, flight_detail->extra_info());
+    }
+  }
+  return headers;
+}
+
+//------------------------------------------------------------
+// UcpCallDriver
+
+namespace {
+
+// A frame being received. Rendezvous frames are ready once UCX has
+// finished transferring their data into our buffer.
+struct PendingFrame {
+  FrameType type;
+  uint32_t counter;
+  std::shared_ptr<Buffer> buffer;
+  bool ready = false;
+  Status status;
+  // Rendezvous descriptor of data not yet requested
+  void* rndv_descriptor = nullptr;
+};
+
+void RecvDataCallback(void* request, ucs_status_t status, size_t length,
+                      void* user_data) {
+  // Owned by the callback so that the frame outlives the driver if the
+  // transfer is cancelled while the worker is torn down
+  std::unique_ptr<std::shared_ptr<PendingFrame>> frame(
+      reinterpret_cast<std::shared_ptr<PendingFrame>*>(user_data));
+  (*frame)->status = FromUcsStatus("ucp_am_recv_data_nbx", status);
+  (*frame)->ready = true;
+}
+
+}  // namespace
+
+class UcpCallDriver::Impl {
+ public:
+  explicit Impl(std::shared_ptr<UcpWorker> worker)
+      : worker_(std::move(worker)),
+        memory_manager_(CPUDevice::Instance()->default_memory_manager()) {}
+
+  ~Impl() { ARROW_WARN_NOT_OK(Close(), "UcpCallDriver: Close() failed"); }
+
+  Status Init() {
+    ucp_am_handler_param_t handler_params;
+    std::memset(&handler_params, 0, sizeof(handler_params));
+    handler_params.field_mask = UCP_AM_HANDLER_PARAM_FIELD_ID |
+                                UCP_AM_HANDLER_PARAM_FIELD_CB |
+                                UCP_AM_HANDLER_PARAM_FIELD_ARG |
+                                UCP_AM_HANDLER_PARAM_FIELD_FLAGS;
+    handler_params.id = kUcpAmHandlerId;
+    handler_params.flags = UCP_AM_FLAG_WHOLE_MSG;
+    handler_params.cb = &Impl::HandleIncomingActiveMessage;
+    handler_params.arg = this;
+    RETURN_NOT_OK(FromUcsStatus(
+        "ucp_worker_set_am_recv_handler",
+        ucp_worker_set_am_recv_handler(worker_->get(), &handler_params)));
+    return FromUcsStatus("ucp_worker_get_efd", ucp_worker_get_efd(worker_->get(), &efd_));
+  }
+
+  Status CreateEndpoint(ucp_ep_params_t* params, std::string peer) {
+    peer_ = std::move(peer);
+    params->field_mask |=
+        UCP_EP_PARAM_FIELD_ERR_HANDLER | UCP_EP_PARAM_FIELD_ERR_HANDLING_MODE;
+    params->err_mode = UCP_ERR_HANDLING_MODE_PEER;
+    params->err_handler.cb = &Impl::HandleEndpointError;
+    params->err_handler.arg = this;
+    std::lock_guard<std::mutex> guard(mutex_);
+    return FromUcsStatus("ucp_ep_create",
+                         ucp_ep_create(worker_->get(), params, &endpoint_));
+  }
+
+  Status SendFrame(FrameType type, const void* data, size_t length) {
+    return SendActiveMessage(type, data, length, ucp_dt_make_contig(1));
+  }
+
+  Status SendFrame(FrameType type, const std::vector<ucp_dt_iov_t>& iov) {
+    return SendActiveMessage(type, iov.data(), iov.size(), ucp_dt_make_iov());
+  }
+
+  Status SendFlightPayload(const FlightPayload& payload) {
+    const ipc::IpcPayload& ipc_msg = payload.ipc_message;
+
+    // Gather the body buffers (and their padding) without copying them
+    std::vector<std::shared_ptr<Buffer>> cpu_buffers;
+    std::vector<ucp_dt_iov_t> body;
+    int64_t body_size = 0;
+    for (const auto& buffer : ipc_msg.body_buffers) {
+      // Buffer may be null when the row length is zero, or when all
+      // entries are invalid.
+      if (!buffer || buffer->size() == 0) continue;
+      std::shared_ptr<Buffer> cpu_buffer = buffer;
+      if (!buffer->is_cpu()) {
+        ARROW_ASSIGN_OR_RAISE(cpu_buffer, Buffer::ViewOrCopy(
+                                              buffer, default_cpu_memory_manager()));
+      }
+      body.push_back(
+          {const_cast<uint8_t*>(cpu_buffer->data()), static_cast<size_t>(buffer->size())});
+      const auto remainder = static_cast<size_t>(
+          bit_util::RoundUpToMultipleOf8(buffer->size()) - buffer->size());
+      if (remainder) {
+        body.push_back({const_cast<uint8_t*>(kPaddingBytes), remainder});
+      }
+      body_size += bit_util::RoundUpToMultipleOf8(buffer->size());
+      cpu_buffers.push_back(std::move(cpu_buffer));
+    }
+
+    PayloadHeaderLayout layout;
+    std::memset(&layout, 0, sizeof(layout));
+    auto add_section = [&](const std::shared_ptr<Buffer>& section, uint32_t flag,
+                           uint32_t* size) -> Status {
+      if (!section) return Status::OK();
+      if (section->size() > std::numeric_limits<uint32_t>::max()) {
+        return Status::Invalid("FlightData field is too large: ", section->size());
+      }
+      layout.flags |= flag;
+      *size = static_cast<uint32_t>(section->size());
+      return Status::OK();
+    };
+    RETURN_NOT_OK(add_section(payload.descriptor, kHasDescriptor, &layout.descriptor_size));
+    RETURN_NOT_OK(add_section(ipc_msg.metadata, kHasMetadata, &layout.metadata_size));
+    RETURN_NOT_OK(
+        add_section(payload.app_metadata, kHasAppMetadata, &layout.app_metadata_size));
+    layout.body_size = body_size;
+
+    const int64_t header_size =
+        sizeof(layout) + bit_util::RoundUpToMultipleOf8(layout.descriptor_size) +
+        bit_util::RoundUpToMultipleOf8(layout.metadata_size) +
+        bit_util::RoundUpToMultipleOf8(layout.app_metadata_size);
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> header, AllocateBuffer(header_size));
+    std::memset(header->mutable_data(), 0, header_size);
+    uint8_t* out = header->mutable_data();
+    PutUInt32(layout.flags, &out);
+    PutUInt32(layout.descriptor_size, &out);
+    PutUInt32(layout.metadata_size, &out);
+    PutUInt32(layout.app_metadata_size, &out);
+    const int64_t le_body_size = bit_util::ToLittleEndian(layout.body_size);
+    std::memcpy(out, &le_body_size, sizeof(le_body_size));
+    out += sizeof(le_body_size);
+    for (const auto* section :
+         {&payload.descriptor, &ipc_msg.metadata, &payload.app_metadata}) {
+      if (!*section) continue;
+      std::memcpy(out, (*section)->data(), (*section)->size());
+      out += bit_util::RoundUpToMultipleOf8((*section)->size());
+    }
+
+    RETURN_NOT_OK(SendFrame(FrameType::kPayloadHeader, header->data(), header->size()));
+    if (body_size > 0) {
+      RETURN_NOT_OK(SendFrame(FrameType::kPayloadBody, body));
+    }
+    return Status::OK();
+  }
+
+  arrow::Result<Frame> ReadFrame() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      if (!frames_.empty() && frames_.front()->ready) {
+        std::shared_ptr<PendingFrame> pending = std::move(frames_.front());
+        frames_.pop_front();
+        RETURN_NOT_OK(pending->status);
+        if (pending->counter != recv_counter_) {
+          return Status::IOError("Received frame ", pending->counter, " from ", peer_,
+                                 " but expected frame ", recv_counter_);
+        }
+        recv_counter_++;
+        return Frame{pending->type, pending->counter, std::move(pending->buffer)};
+      }
+      if (frames_.empty()) {
+        RETURN_NOT_OK(connection_status_);
+      }
+      Progress(&lock);
+    }
+  }
+
+  arrow::Result<bool> WaitForFrame(const std::atomic<bool>& stop) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop.load()) {
+      if (!frames_.empty() && frames_.front()->ready) return true;
+      if (frames_.empty()) {
+        RETURN_NOT_OK(connection_status_);
+      }
+      Progress(&lock);
+    }
+    return false;
+  }
+
+  Status ReadFlightData(const Frame& header_frame, internal::FlightData* out) {
+    if (header_frame.type != FrameType::kPayloadHeader) {
+      return Status::IOError("Expected a payload header frame but got frame type ",
+                             static_cast<int>(header_frame.type));
+    }
+    const std::shared_ptr<Buffer>& header = header_frame.buffer;
+    const uint8_t* data = header->data();
+    const uint8_t* end = data + header->size();
+    PayloadHeaderLayout layout;
+    if (!GetUInt32(&data, end, &layout.flags) ||
+        !GetUInt32(&data, end, &layout.descriptor_size) ||
+        !GetUInt32(&data, end, &layout.metadata_size) ||
+        !GetUInt32(&data, end, &layout.app_metadata_size) ||
+        end - data < static_cast<int64_t>(sizeof(int64_t))) {
+      return Status::IOError("Payload header frame is truncated");
+    }
+    std::memcpy(&layout.body_size, data, sizeof(int64_t));
+    layout.body_size = bit_util::FromLittleEndian(layout.body_size);
+    int64_t offset = sizeof(layout);
+
+    auto read_section = [&](uint32_t flag, uint32_t size,
+                            std::shared_ptr<Buffer>* section) -> Status {
+      if (!(layout.flags & flag)) return Status::OK();
+      if (offset + static_cast<int64_t>(size) > header->size()) {
+        return Status::IOError("Payload header frame is truncated");
+      }
+      *section = SliceBuffer(header, offset, size);
+      offset += bit_util::RoundUpToMultipleOf8(size);
+      return Status::OK();
+    };
+    std::shared_ptr<Buffer> descriptor;
+    RETURN_NOT_OK(read_section(kHasDescriptor, layout.descriptor_size, &descriptor));
+    RETURN_NOT_OK(read_section(kHasMetadata, layout.metadata_size, &out->metadata));
+    RETURN_NOT_OK(
+        read_section(kHasAppMetadata, layout.app_metadata_size, &out->app_metadata));
+    if (descriptor) {
+      ARROW_ASSIGN_OR_RAISE(auto descr,
+                            FlightDescriptor::Deserialize(std::string_view(*descriptor)));
+      out->descriptor = std::make_unique<FlightDescriptor>(std::move(descr));
+    }
+
+    if (layout.body_size > 0) {
+      ARROW_ASSIGN_OR_RAISE(Frame body, ReadFrame());
+      if (body.type != FrameType::kPayloadBody) {
+        return Status::IOError("Expected a payload body frame but got frame type ",
+                               static_cast<int>(body.type));
+      }
+      if (body.buffer->size() != layout.body_size) {
+        return Status::IOError("Expected a payload body of ", layout.body_size,
+                               " bytes but got ", body.buffer->size());
+      }
+      out->body = std::move(body.buffer);
+      if (!memory_manager_->is_cpu()) {
+        ARROW_ASSIGN_OR_RAISE(out->body, Buffer::Copy(out->body, memory_manager_));
+      }
+    } else {
+      out->body = std::make_shared<Buffer>(nullptr, 0);
+    }
+    return Status::OK();
+  }
+
+  void set_memory_manager(std::shared_ptr<MemoryManager> memory_manager) {
+    if (memory_manager) memory_manager_ = std::move(memory_manager);
+  }
+
+  bool is_connected() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return endpoint_ != nullptr && connection_status_.ok();
+  }
+
+  const std::string& peer() const { return peer_; }
+
+  Status Close() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!endpoint_) return Status::OK();
+
+    ucp_request_param_t param;
+    std::memset(&param, 0, sizeof(param));
+    if (connection_status_.ok()) {
+      // Best effort: let the peer know we are going away, so it does
+      // not have to wait for the transport to time out
+      FrameHeader header{kFrameVersion, FrameType::kDisconnect, 0, send_counter_++};
+      param.op_attr_mask = UCP_OP_ATTR_FIELD_DATATYPE;
+      param.datatype = ucp_dt_make_contig(1);
+      ARROW_UNUSED(WaitRequest(&lock,
+                               ucp_am_send_nbx(endpoint_, kUcpAmHandlerId, &header,
+                                               sizeof(header), nullptr, 0, &param)));
+      std::memset(&param, 0, sizeof(param));
+    } else {
+      param.op_attr_mask = UCP_OP_ATTR_FIELD_FLAGS;
+      param.flags = UCP_EP_CLOSE_FLAG_FORCE;
+    }
+    ucp_ep_h endpoint = endpoint_;
+    endpoint_ = nullptr;
+    if (connection_status_.ok()) {
+      connection_status_ = Status::IOError("Connection to ", peer_, " was closed");
+    }
+    // The peer may already be gone, which is not an error when closing
+    ARROW_UNUSED(WaitRequest(&lock, ucp_ep_close_nbx(endpoint, &param)));
+    return Status::OK();
+  }
+
+ private:
+  Status SendActiveMessage(FrameType type, const void* data, size_t count,
+                           ucp_datatype_t datatype) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    RETURN_NOT_OK(connection_status_);
+    // The header is copied by UCX, and we wait for the send to
+    // complete before returning, so it can live on the stack
+    FrameHeader header{kFrameVersion, type, 0, send_counter_++};
+    ucp_request_param_t param;
+    std::memset(&param, 0, sizeof(param));
+    param.op_attr_mask = UCP_OP_ATTR_FIELD_DATATYPE;
+    param.datatype = datatype;
+    ucs_status_ptr_t request = ucp_am_send_nbx(endpoint_, kUcpAmHandlerId, &header,
+                                               sizeof(header), data, count, &param);
+    RETURN_NOT_OK(WaitRequest(&lock, request));
+    // The peer may have gone away while we were sending
+    return connection_status_;
+  }
+
+  Status WaitRequest(std::unique_lock<std::mutex>* lock, ucs_status_ptr_t request) {
+    if (request == nullptr) return Status::OK();
+    if (UCS_PTR_IS_ERR(request)) {
+      return FromUcsStatus("UCX request failed", UCS_PTR_STATUS(request));
+    }
+    ucs_status_t status;
+    while ((status = ucp_request_check_status(request)) == UCS_INPROGRESS) {
+      Progress(lock);
+    }
+    ucp_request_free(request);
+    return FromUcsStatus("UCX request failed", status);
+  }
+
+  // Progress the worker, or sleep until it has events. Must be called
+  // with the lock held; the lock is released while sleeping.
+  void Progress(std::unique_lock<std::mutex>* lock) {
+    if (ucp_worker_progress(worker_->get()) != 0) {
+      StartRendezvousReceives();
+      // Another thread may be sleeping on events we just consumed
+      if (waiters_ > 0) ucp_worker_signal(worker_->get());
+      return;
+    }
+    const ucs_status_t status = ucp_worker_arm(worker_->get());
+    if (status == UCS_ERR_BUSY) return;  // Events are pending
+    if (status != UCS_OK) {
+      ARROW_LOG(WARNING) << "ucp_worker_arm failed: " << ucs_status_string(status);
+      return;
+    }
+    waiters_++;
+    lock->unlock();
+    struct pollfd pfd;
+    pfd.fd = efd_;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    ARROW_UNUSED(poll(&pfd, 1, kWaitTimeoutMs));
+    lock->lock();
+    waiters_--;
+  }
+
+  // Ask UCX to transfer the data of rendezvous frames straight into
+  // our buffers. This is where RDMA happens on networks supporting it.
+  void StartRendezvousReceives() {
+    for (const auto& frame : frames_) {
+      if (!frame->rndv_descriptor) continue;
+      void* descriptor = frame->rndv_descriptor;
+      frame->rndv_descriptor = nullptr;
+
+      auto* user_data = new std::shared_ptr<PendingFrame>(frame);
+      ucp_request_param_t param;
+      std::memset(&param, 0, sizeof(param));
+      param.op_attr_mask = UCP_OP_ATTR_FIELD_CALLBACK | UCP_OP_ATTR_FIELD_USER_DATA |
+                           UCP_OP_ATTR_FIELD_DATATYPE;
+      param.cb.recv_am = &RecvDataCallback;
+      param.user_data = user_data;
+      param.datatype = ucp_dt_make_contig(1);
+      ucs_status_ptr_t request =
+          ucp_am_recv_data_nbx(worker_->get(), descriptor, frame->buffer->mutable_data(),
+                               static_cast<size_t>(frame->buffer->size()), &param);
+      if (UCS_PTR_IS_ERR(request)) {
+        delete user_data;
+        frame->status = FromUcsStatus("ucp_am_recv_data_nbx", UCS_PTR_STATUS(request));
+        frame->ready = true;
+      } else if (request == nullptr) {
+        // Completed immediately; the callback is not called
+        delete user_data;
+        frame->ready = true;
+      } else {
+        // Released by UCX once the transfer completes
+        ucp_request_free(request);
+      }
+    }
+  }
+
+  ucs_status_t HandleIncomingActiveMessage(const void* header, size_t header_length,
+                                           void* data, size_t data_length,
+                                           const ucp_am_recv_param_t* param) {
+    FrameHeader frame_header;
+    if (header_length != sizeof(frame_header)) {
+      connection_status_ =
+          Status::IOError("Invalid frame header of ", header_length, " bytes");
+      return UCS_OK;
+    }
+    std::memcpy(&frame_header, header, sizeof(frame_header));
+    if (frame_header.version != kFrameVersion) {
+      connection_status_ = Status::IOError("Unsupported frame version ",
+                                           static_cast<int>(frame_header.version));
+      return UCS_OK;
+    }
+    if (frame_header.type == FrameType::kDisconnect) {
+      connection_status_ =
+          Status::IOError("Connection closed by ", peer_)
+              .WithDetail(
+                  std::make_shared<FlightStatusDetail>(FlightStatusCode::Unavailable));
+      return UCS_OK;
+    }
+
+    auto frame = std::make_shared<PendingFrame>();
+    frame->type = frame_header.type;
+    frame->counter = frame_header.counter;
+    frames_.push_back(frame);
+    auto maybe_buffer = AllocateBuffer(static_cast<int64_t>(data_length));
+    if (!maybe_buffer.ok()) {
+      frame->status = maybe_buffer.status();
+      frame->ready = true;
+      return UCS_OK;
+    }
+    frame->buffer = std::move(maybe_buffer).MoveValueUnsafe();
+
+    if (param->recv_attr & UCP_AM_RECV_ATTR_FLAG_RNDV) {
+      // Only a descriptor has arrived; the data is fetched once we are
+      // out of the callback
+      frame->rndv_descriptor = data;
+      return UCS_INPROGRESS;
+    }
+    // Eager data is only valid during the callback
+    if (data_length > 0) {
+      std::memcpy(frame->buffer->mutable_data(), data, data_length);
+    }
+    frame->ready = true;
+    return UCS_OK;
+  }
+
+  static ucs_status_t HandleIncomingActiveMessage(void* self, const void* header,
+                                                  size_t header_length, void* data,
+                                                  size_t data_length,
+                                                  const ucp_am_recv_param_t* param) {
+    return reinterpret_cast<Impl*>(self)->HandleIncomingActiveMessage(
+        header, header_length, data, data_length, param);
+  }
+
+  static void HandleEndpointError(void* self, ucp_ep_h, ucs_status_t status) {
+    auto* impl = reinterpret_cast<Impl*>(self);
+    // Keep the first error, or replace a clean close
+    if (impl->connection_status_.ok()) {
+      impl->connection_status_ =
+          FromUcsStatus("Connection to " + impl->peer_ + " failed", status);
+    }
+  }
+
+  std::shared_ptr<UcpWorker> worker_;
+  std::shared_ptr<MemoryManager> memory_manager_;
+  std::string peer_;
+  int efd_ = -1;
+
+  // Guards the worker and everything below
+  mutable std::mutex mutex_;
+  ucp_ep_h endpoint_ = nullptr;
+  Status connection_status_;
+  std::deque<std::shared_ptr<PendingFrame>> frames_;
+  uint32_t send_counter_ = 0;
+  uint32_t recv_counter_ = 0;
+  int waiters_ = 0;
+};
+
+UcpCallDriver::UcpCallDriver(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+UcpCallDriver::~UcpCallDriver() = default;
+
+arrow::Result<std::unique_ptr<UcpCallDriver>> UcpCallDriver::Connect(
+    std::shared_ptr<UcpWorker> worker, const sockaddr_storage& address,
+    size_t address_length) {
+  auto impl = std::make_unique<Impl>(std::move(worker));
+  RETURN_NOT_OK(impl->Init());
+
+  ucp_ep_params_t params;
+  std::memset(&params, 0, sizeof(params));
+  params.field_mask = UCP_EP_PARAM_FIELD_FLAGS | UCP_EP_PARAM_FIELD_SOCK_ADDR;
+  params.flags = UCP_EP_PARAMS_FLAGS_CLIENT_SERVER;
+  params.sockaddr.addr = reinterpret_cast<const sockaddr*>(&address);
+  params.sockaddr.addrlen = static_cast<socklen_t>(address_length);
+  RETURN_NOT_OK(impl->CreateEndpoint(&params, SockaddrToString(address)));
+  return std::unique_ptr<UcpCallDriver>(new UcpCallDriver(std::move(impl)));
+}
+
+arrow::Result<std::unique_ptr<UcpCallDriver>> UcpCallDriver::Accept(
+    std::shared_ptr<UcpWorker> worker, ucp_conn_request_h conn_request) {
+  auto impl = std::make_unique<Impl>(std::move(worker));
+  RETURN_NOT_OK(impl->Init());
+
+  std::string peer = "<unknown>";
+  ucp_conn_request_attr_t attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.field_mask = UCP_CONN_REQUEST_ATTR_FIELD_CLIENT_ADDR;
+  if (ucp_conn_request_query(conn_request, &attr) == UCS_OK) {
+    peer = SockaddrToString(attr.client_address);
+  }
+
+  ucp_ep_params_t params;
+  std::memset(&params, 0, sizeof(params));
+  params.field_mask = UCP_EP_PARAM_FIELD_CONN_REQUEST;
+  params.conn_request = conn_request;
+  RETURN_NOT_OK(impl->CreateEndpoint(&params, std::move(peer)));
+  return std::unique_ptr<UcpCallDriver>(new UcpCallDriver(std::move(impl)));
+}
+
+Status UcpCallDriver::SendHeaders(const HeaderList& headers) {
+  ARROW_ASSIGN_OR_RAISE(auto buffer, HeadersFrame::Serialize(headers));
+  return impl_->SendFrame(FrameType::kHeaders, buffer->data(), buffer->size());
+}
+
+Status UcpCallDriver::SendBuffer(const Buffer& buffer) {
+  return impl_->SendFrame(FrameType::kBuffer, buffer.data(), buffer.size());
+}
+
+Status UcpCallDriver::SendFlightPayload(const FlightPayload& payload) {
+  return impl_->SendFlightPayload(payload);
+}
+
+arrow::Result<Frame> UcpCallDriver::ReadFrame() { return impl_->ReadFrame(); }
+
+arrow::Result<bool> UcpCallDriver::WaitForFrame(const std::atomic<bool>& stop) {
+  return impl_->WaitForFrame(stop);
+}
+
+Status UcpCallDriver::ReadFlightData(const Frame& header_frame,
+                                     internal::FlightData* out) {
+  return impl_->ReadFlightData(header_frame, out);
+}
+
+void UcpCallDriver::set_memory_manager(std::shared_ptr<MemoryManager> memory_manager) {
+  impl_->set_memory_manager(std::move(memory_manager));
+}
+
+bool UcpCallDriver::is_connected() const { return impl_->is_connected(); }
+
+const std::string& UcpCallDriver::peer() const { return impl_->peer(); }
+
+Status UcpCallDriver::Close() { return impl_->Close(); }
+
+}  // namespace ucx
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
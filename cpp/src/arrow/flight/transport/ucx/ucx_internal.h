@@ -0,0 +1,211 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Wire protocol and connection handling shared by the UCX client and
+// server.
+//
+// A connection carries one call at a time. Every message is a UCP
+// active message whose (small, copied) header is a FrameHeader and
+// whose data is the frame payload. UCX sends small payloads eagerly
+// and large ones with the rendezvous protocol, which on RDMA-capable
+// networks lets the receiver read the data directly out of the
+// sender's buffers into its own.
+//
+// A call is:
+//
+// 1. The client sends a headers frame with the method and the call
+//    headers, followed by the request (a buffer frame) for methods
+//    that take one.
+// 2. Both sides exchange buffer frames (e.g. results, handshake
+//    tokens, DoPut metadata) and payload frames (FlightData) as the
+//    method requires. A payload is a payload header frame (descriptor,
+//    IPC metadata and application metadata), followed by a payload
+//    body frame if the IPC message has a body. The body buffers are
+//    sent as an I/O vector, without copying them.
+// 3. For methods where the client streams data, the client ends its
+//    half of the call with a second (possibly empty) headers frame.
+// 4. The server ends the call with a headers frame carrying the
+//    status and any trailers.
+
+#pragma once
+
+#include <sys/socket.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include "arrow/flight/transport.h"
+#include "arrow/flight/transport/ucx/util_internal.h"
+#include "arrow/flight/types.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+namespace flight {
+namespace transport {
+namespace ucx {
+
+/// The URI scheme of the UCX transport.
+static constexpr char kSchemeUcx[] = "ucx";
+
+/// The active message handler ID used for all frames.
+static constexpr unsigned int kUcpAmHandlerId = 0x1024;
+
+/// The version of the framing protocol.
+static constexpr uint8_t kFrameVersion = 1;
+
+/// \brief Header names used by the protocol.
+///
+/// Names starting with a colon are reserved for the transport.
+static constexpr char kHeaderMethod[] = ":method";
+static constexpr char kHeaderStatus[] = ":status";
+static constexpr char kHeaderMessage[] = ":message";
+static constexpr char kHeaderArrowStatus[] = "x-arrow-status";
+static constexpr char kHeaderArrowMessage[] = "x-arrow-status-message-bin";
+static constexpr char kHeaderArrowDetail[] = "x-arrow-status-detail-bin";
+static constexpr char kHeaderErrorDetails[] = "x-arrow-error-details-bin";
+static constexpr char kHeaderAuthToken[] = "auth-token-bin";
+
+using HeaderList = std::vector<std::pair<std::string, std::string>>;
+
+enum class FrameType : uint8_t {
+  /// Call headers, end of the client's stream, or the final status
+  kHeaders = 0,
+  /// An opaque buffer (serialized requests and results, tokens, metadata)
+  kBuffer = 1,
+  /// Descriptor, IPC metadata and application metadata of a FlightData
+  kPayloadHeader = 2,
+  /// The IPC body of a FlightData
+  kPayloadBody = 3,
+  /// The peer is closing the connection
+  kDisconnect = 4,
+};
+
+/// \brief The active message header of every frame.
+struct FrameHeader {
+  uint8_t version;
+  FrameType type;
+  uint16_t reserved;
+  /// Sequence number of the frame, per connection and direction
+  uint32_t counter;
+};
+static_assert(sizeof(FrameHeader) == 8, "FrameHeader must be packed");
+
+/// \brief A received frame.
+struct Frame {
+  FrameType type;
+  uint32_t counter;
+  std::shared_ptr<Buffer> buffer;
+};
+
+/// \brief A parsed headers frame.
+///
+/// The keys and values are views of the frame buffer.
+class HeadersFrame {
+ public:
+  static arrow::Result<std::shared_ptr<Buffer>> Serialize(const HeaderList& headers);
+  static arrow::Result<HeadersFrame> Parse(std::shared_ptr<Buffer> buffer);
+
+  /// \brief Get the first value of a header, if present.
+  std::optional<std::string_view> Get(std::string_view key) const;
+  const std::vector<std::pair<std::string_view, std::string_view>>& headers() const {
+    return headers_;
+  }
+
+  /// \brief Reconstruct the status carried by the final headers of a call.
+  Status GetStatus() const;
+
+ private:
+  std::shared_ptr<Buffer> buffer_;
+  std::vector<std::pair<std::string_view, std::string_view>> headers_;
+};
+
+/// \brief Encode a status as headers, to end a call.
+HeaderList StatusToHeaders(const Status& status);
+
+/// \brief Drives one connection: sends frames and reads incoming ones.
+///
+/// Each connection has its own worker, so that connections can be
+/// used from different threads in parallel. A driver can be used
+/// from several threads (e.g. one reading and one writing during
+/// DoExchange); the worker is only progressed by one of them at a
+/// time.
+class UcpCallDriver {
+ public:
+  ~UcpCallDriver();
+  ARROW_DISALLOW_COPY_AND_ASSIGN(UcpCallDriver);
+
+  /// \brief Connect to a server.
+  static arrow::Result<std::unique_ptr<UcpCallDriver>> Connect(
+      std::shared_ptr<UcpWorker> worker, const sockaddr_storage& address,
+      size_t address_length);
+  /// \brief Accept a connection request received by a listener.
+  static arrow::Result<std::unique_ptr<UcpCallDriver>> Accept(
+      std::shared_ptr<UcpWorker> worker, ucp_conn_request_h conn_request);
+
+  Status SendHeaders(const HeaderList& headers);
+  Status SendBuffer(const Buffer& buffer);
+  /// \brief Send a FlightData, without copying its body buffers.
+  Status SendFlightPayload(const FlightPayload& payload);
+
+  /// \brief Block until the next frame arrives.
+  arrow::Result<Frame> ReadFrame();
+  /// \brief Block until a frame arrives, or until *stop becomes true.
+  ///
+  /// \return true if a frame is ready to be read.
+  arrow::Result<bool> WaitForFrame(const std::atomic<bool>& stop);
+  /// \brief Read the rest of a FlightData given its payload header frame.
+  Status ReadFlightData(const Frame& header_frame, internal::FlightData* out);
+
+  /// \brief Allocate received frames with this memory manager.
+  ///
+  /// Frames are received in CPU memory; bodies are copied if the memory
+  /// manager is not a CPU one.
+  void set_memory_manager(std::shared_ptr<MemoryManager> memory_manager);
+
+  /// \brief Whether the connection is still usable.
+  bool is_connected() const;
+  /// \brief Get a description of the remote end.
+  const std::string& peer() const;
+
+  /// \brief Tell the peer we are going away, then close the endpoint.
+  Status Close();
+
+ private:
+  class Impl;
+  explicit UcpCallDriver(std::unique_ptr<Impl> impl);
+  std::unique_ptr<Impl> impl_;
+};
+
+arrow::Result<std::unique_ptr<internal::ClientTransport>> MakeUcxClientImpl();
+arrow::Result<std::unique_ptr<internal::ServerTransport>> MakeUcxServerImpl(
+    FlightServerBase* base, std::shared_ptr<MemoryManager> memory_manager);
+
+}  // namespace ucx
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,639 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// UCX server transport for Arrow Flight
+
+#include <poll.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/flight/server.h"
+#include "arrow/flight/server_auth.h"
+#include "arrow/flight/server_middleware.h"
+#include "arrow/flight/transport.h"
+#include "arrow/flight/transport/ucx/ucx_internal.h"
+#include "arrow/flight/transport_server.h"
+#include "arrow/flight/types.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/uri.h"
+#include "arrow/util/value_parsing.h"
+
+namespace arrow {
+namespace flight {
+namespace transport {
+namespace ucx {
+
+namespace {
+
+class UcxServerCallContext : public ServerCallContext {
+ public:
+  UcxServerCallContext(const UcpCallDriver* driver, const HeadersFrame& headers)
+      : driver_(driver) {
+    for (const auto& header : headers.headers()) {
+      // Don't expose the transport's own headers
+      if (!header.first.empty() && header.first[0] == ':') continue;
+      incoming_headers_.insert(header);
+    }
+  }
+
+  const std::string& peer_identity() const override { return peer_identity_; }
+  const std::string& peer() const override { return driver_->peer(); }
+  bool is_cancelled() const override { return !driver_->is_connected(); }
+  const CallHeaders& incoming_headers() const override { return incoming_headers_; }
+
+  // Headers and trailers both travel with the status at the end of the
+  // call
+  void AddHeader(const std::string& key, const std::string& value) const override {
+    outgoing_headers_.emplace_back(key, value);
+  }
+  void AddTrailer(const std::string& key, const std::string& value) const override {
+    outgoing_headers_.emplace_back(key, value);
+  }
+
+  ServerMiddleware* GetMiddleware(const std::string& key) const override {
+    const auto& instance = middleware_map_.find(key);
+    if (instance == middleware_map_.end()) {
+      return nullptr;
+    }
+    return instance->second.get();
+  }
+
+  /// \brief Run the middleware and build the headers ending the call.
+  HeaderList FinishRequest(const Status& status) {
+    for (const auto& instance : middleware_) {
+      instance->CallCompleted(status);
+    }
+    HeaderList headers = StatusToHeaders(status);
+    for (auto& header : outgoing_headers_) {
+      headers.push_back(std::move(header));
+    }
+    return headers;
+  }
+
+ private:
+  friend class UcxServerTransport;
+  const UcpCallDriver* driver_;
+  std::string peer_identity_;
+  std::vector<std::shared_ptr<ServerMiddleware>> middleware_;
+  std::unordered_map<std::string, std::shared_ptr<ServerMiddleware>> middleware_map_;
+  CallHeaders incoming_headers_;
+  mutable HeaderList outgoing_headers_;
+};
+
+class UcxAddServerHeaders : public AddCallHeaders {
+ public:
+  explicit UcxAddServerHeaders(const UcxServerCallContext* context) : context_(context) {}
+
+  void AddHeader(const std::string& key, const std::string& value) override {
+    context_->AddHeader(key, value);
+  }
+
+ private:
+  const UcxServerCallContext* context_;
+};
+
+// A ServerDataStream for DoGet, DoPut and DoExchange.
+class UcxServerDataStream : public internal::ServerDataStream {
+ public:
+  explicit UcxServerDataStream(UcpCallDriver* driver) : driver_(driver) {}
+
+  bool ReadData(internal::FlightData* data) override {
+    while (!writes_done_) {
+      auto maybe_frame = driver_->ReadFrame();
+      if (!maybe_frame.ok()) {
+        status_ = maybe_frame.status();
+        writes_done_ = true;
+        return false;
+      }
+      switch (maybe_frame->type) {
+        case FrameType::kHeaders:
+          writes_done_ = true;
+          return false;
+        case FrameType::kPayloadHeader:
+          status_ = driver_->ReadFlightData(*maybe_frame, data);
+          if (!status_.ok()) {
+            writes_done_ = true;
+            return false;
+          }
+          return true;
+        default:
+          status_ = Status::IOError("Unexpected frame type ",
+                                    static_cast<int>(maybe_frame->type));
+          writes_done_ = true;
+          return false;
+      }
+    }
+    return false;
+  }
+
+  arrow::Result<bool> WriteData(const FlightPayload& payload) override {
+    RETURN_NOT_OK(driver_->SendFlightPayload(payload));
+    return true;
+  }
+
+  Status WritePutMetadata(const Buffer& payload) override {
+    return driver_->SendBuffer(payload);
+  }
+
+  /// \brief Discard what is left of the client's half of the call.
+  Status Drain() {
+    internal::FlightData data;
+    while (ReadData(&data)) {
+    }
+    return status_;
+  }
+
+ private:
+  UcpCallDriver* driver_;
+  bool writes_done_ = false;
+  Status status_;
+};
+
+class UcxServerAuthSender : public ServerAuthSender {
+ public:
+  explicit UcxServerAuthSender(UcpCallDriver* driver) : driver_(driver) {}
+  Status Write(const std::string& message) override {
+    return driver_->SendBuffer(Buffer(message));
+  }
+
+ private:
+  UcpCallDriver* driver_;
+};
+
+class UcxServerAuthReader : public ServerAuthReader {
+ public:
+  explicit UcxServerAuthReader(UcpCallDriver* driver) : driver_(driver) {}
+  Status Read(std::string* token) override {
+    if (done_) return Status::IOError("Stream is closed.");
+    ARROW_ASSIGN_OR_RAISE(Frame frame, driver_->ReadFrame());
+    if (frame.type == FrameType::kHeaders) {
+      done_ = true;
+      return Status::IOError("Stream is closed.");
+    }
+    if (frame.type != FrameType::kBuffer) {
+      return Status::IOError("Unexpected frame type ", static_cast<int>(frame.type));
+    }
+    *token = frame.buffer->ToString();
+    return Status::OK();
+  }
+
+  /// \brief Discard what is left of the client's half of the handshake.
+  Status Drain() {
+    while (!done_) {
+      ARROW_ASSIGN_OR_RAISE(Frame frame, driver_->ReadFrame());
+      done_ = frame.type == FrameType::kHeaders;
+    }
+    return Status::OK();
+  }
+
+ private:
+  UcpCallDriver* driver_;
+  bool done_ = false;
+};
+
+// The ServerTransport implementation for UCX. A listener thread accepts
+// connections; each connection is then served by its own thread and
+// worker.
+class UcxServerTransport : public internal::ServerTransport {
+ public:
+  using internal::ServerTransport::ServerTransport;
+
+  ~UcxServerTransport() override {
+    ARROW_WARN_NOT_OK(Shutdown(), "UcxServerTransport: Shutdown() failed");
+  }
+
+  Status Init(const FlightServerOptions& options, const arrow::util::Uri& uri) override {
+    auth_handler_ = options.auth_handler;
+    middleware_ = options.middleware;
+
+    sockaddr_storage address;
+    ARROW_ASSIGN_OR_RAISE(size_t address_length, UriToSockaddr(uri, &address));
+    ARROW_ASSIGN_OR_RAISE(ucp_context_, UcpContext::Make());
+    // Connection requests are delivered on the listener thread, but
+    // handed off to (and accepted by) connection threads
+    ARROW_ASSIGN_OR_RAISE(listener_worker_,
+                          UcpWorker::Make(ucp_context_, UCS_THREAD_MODE_MULTI));
+
+    ucp_listener_params_t params;
+    std::memset(&params, 0, sizeof(params));
+    params.field_mask =
+        UCP_LISTENER_PARAM_FIELD_SOCK_ADDR | UCP_LISTENER_PARAM_FIELD_CONN_HANDLER;
+    params.sockaddr.addr = reinterpret_cast<const sockaddr*>(&address);
+    params.sockaddr.addrlen = static_cast<socklen_t>(address_length);
+    params.conn_handler.cb = &UcxServerTransport::HandleIncomingConnection;
+    params.conn_handler.arg = this;
+
+    if (options.builder_hook) {
+      options.builder_hook(&params);
+    }
+
+    RETURN_NOT_OK(FromUcsStatus(
+        "ucp_listener_create",
+        ucp_listener_create(listener_worker_->get(), &params, &listener_)));
+
+    ucp_listener_attr_t attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.field_mask = UCP_LISTENER_ATTR_FIELD_SOCKADDR;
+    RETURN_NOT_OK(FromUcsStatus("ucp_listener_query",
+                                ucp_listener_query(listener_, &attr)));
+    ARROW_ASSIGN_OR_RAISE(int port, SockaddrToPort(attr.sockaddr));
+    ARROW_ASSIGN_OR_RAISE(
+        location_,
+        Location::ForScheme(kSchemeUcx, arrow::util::UriEncodeHost(uri.host()), port));
+
+    RETURN_NOT_OK(FromUcsStatus("ucp_worker_get_efd",
+                                ucp_worker_get_efd(listener_worker_->get(), &efd_)));
+    listening_.store(true);
+    listener_thread_ = std::thread([this] { RunListener(); });
+    return Status::OK();
+  }
+
+  Status Shutdown() override {
+    if (!listening_.exchange(false)) return Status::OK();
+    shutting_down_.store(true);
+    if (listener_thread_.joinable()) listener_thread_.join();
+
+    std::vector<std::thread> threads;
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      threads.swap(connection_threads_);
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    // Reject connections that arrived after the last accept
+    for (ucp_conn_request_h request : pending_requests_) {
+      ucp_listener_reject(listener_, request);
+    }
+    pending_requests_.clear();
+    if (listener_) {
+      ucp_listener_destroy(listener_);
+      listener_ = nullptr;
+    }
+    listener_worker_.reset();
+
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      shut_down_ = true;
+    }
+    shut_down_cv_.notify_all();
+    return Status::OK();
+  }
+
+  Status Shutdown(const std::chrono::system_clock::time_point& deadline) override {
+    // Let in-flight calls finish until the deadline; calls are only
+    // interrupted between frames, so this is best effort
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      draining_.store(true);
+      shut_down_cv_.wait_until(lock, deadline, [this] { return active_calls_ == 0; });
+    }
+    return Shutdown();
+  }
+
+  Status Wait() override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    shut_down_cv_.wait(lock, [this] { return shut_down_; });
+    return Status::OK();
+  }
+
+  Location location() const override { return location_; }
+
+ private:
+  static void HandleIncomingConnection(ucp_conn_request_h connection_request,
+                                       void* data) {
+    // Called from ucp_worker_progress on the listener thread
+    auto* self = reinterpret_cast<UcxServerTransport*>(data);
+    self->pending_requests_.push_back(connection_request);
+  }
+
+  void RunListener() {
+    while (listening_.load()) {
+      if (ucp_worker_progress(listener_worker_->get()) == 0) {
+        const ucs_status_t status = ucp_worker_arm(listener_worker_->get());
+        if (status == UCS_OK) {
+          struct pollfd pfd = {efd_, POLLIN, 0};
+          // Wake up periodically to notice a shutdown
+          ::poll(&pfd, 1, /*timeout=*/100);
+        } else if (status != UCS_ERR_BUSY) {
+          ARROW_LOG(WARNING) << "ucp_worker_arm failed: " << ucs_status_string(status);
+        }
+      }
+
+      while (!pending_requests_.empty()) {
+        ucp_conn_request_h request = pending_requests_.front();
+        pending_requests_.pop_front();
+        if (draining_.load()) {
+          ucp_listener_reject(listener_, request);
+          continue;
+        }
+        std::lock_guard<std::mutex> guard(mutex_);
+        connection_threads_.emplace_back(
+            [this, request] { RunConnection(request); });
+      }
+    }
+  }
+
+  void RunConnection(ucp_conn_request_h request) {
+    auto maybe_worker = UcpWorker::Make(ucp_context_);
+    if (!maybe_worker.ok()) {
+      ARROW_LOG(WARNING) << "Could not create UCX worker: "
+                         << maybe_worker.status().ToString();
+      ucp_listener_reject(listener_, request);
+      return;
+    }
+    auto maybe_driver = UcpCallDriver::Accept(maybe_worker.MoveValueUnsafe(), request);
+    if (!maybe_driver.ok()) {
+      ARROW_LOG(WARNING) << "Could not accept UCX connection: "
+                         << maybe_driver.status().ToString();
+      return;
+    }
+    std::unique_ptr<UcpCallDriver> driver = maybe_driver.MoveValueUnsafe();
+    driver->set_memory_manager(memory_manager_);
+
+    while (!shutting_down_.load() && !draining_.load()) {
+      auto ready = driver->WaitForFrame(shutting_down_);
+      if (!ready.ok() || !*ready) break;
+      auto frame = driver->ReadFrame();
+      if (!frame.ok()) break;
+
+      {
+        std::lock_guard<std::mutex> guard(mutex_);
+        active_calls_++;
+      }
+      Status status = HandleCall(driver.get(), *frame);
+      {
+        std::lock_guard<std::mutex> guard(mutex_);
+        active_calls_--;
+      }
+      shut_down_cv_.notify_all();
+      if (!status.ok()) {
+        // The connection is unusable; the client will see the disconnect
+        ARROW_LOG(DEBUG) << "Closing UCX connection to " << driver->peer() << ": "
+                         << status.ToString();
+        break;
+      }
+    }
+    ARROW_UNUSED(driver->Close());
+  }
+
+  /// \brief Serve one call.
+  ///
+  /// \return An error if the connection can no longer be used.
+  Status HandleCall(UcpCallDriver* driver, const Frame& frame) {
+    if (frame.type != FrameType::kHeaders) {
+      return Status::IOError("Expected call headers but got frame type ",
+                             static_cast<int>(frame.type));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto headers, HeadersFrame::Parse(frame.buffer));
+    const auto method_str = headers.Get(kHeaderMethod);
+    int method_int = 0;
+    if (!method_str || !::arrow::internal::ParseValue<Int32Type>(
+                           method_str->data(), method_str->size(), &method_int)) {
+      return Status::IOError("Call headers did not contain a valid method");
+    }
+    const auto method = static_cast<FlightMethod>(method_int);
+
+    UcxServerCallContext context(driver, headers);
+    UcxServerDataStream stream(driver);
+    Status status;
+    switch (method) {
+      case FlightMethod::Handshake: {
+        UcxServerAuthReader incoming(driver);
+        status = DoHandshake(driver, context, &incoming);
+        RETURN_NOT_OK(SendStatus(driver, &context, status));
+        return incoming.Drain();
+      }
+      case FlightMethod::ListFlights:
+      case FlightMethod::GetFlightInfo:
+      case FlightMethod::PollFlightInfo:
+      case FlightMethod::GetSchema:
+      case FlightMethod::DoAction: {
+        ARROW_ASSIGN_OR_RAISE(Frame request, driver->ReadFrame());
+        if (request.type != FrameType::kBuffer) {
+          return Status::IOError("Expected a request but got frame type ",
+                                 static_cast<int>(request.type));
+        }
+        status = StartCall(method, driver, &context);
+        if (status.ok()) {
+          status = DoUnaryCall(method, driver, context, *request.buffer);
+        }
+        RETURN_NOT_OK(driver->is_connected() ? Status::OK() : status);
+        return SendStatus(driver, &context, status);
+      }
+      case FlightMethod::ListActions: {
+        status = StartCall(method, driver, &context);
+        if (status.ok()) {
+          std::vector<ActionType> types;
+          status = base()->ListActions(context, &types);
+          for (size_t i = 0; status.ok() && i < types.size(); i++) {
+            status = SendSerialized(driver, types[i]);
+          }
+        }
+        RETURN_NOT_OK(driver->is_connected() ? Status::OK() : status);
+        return SendStatus(driver, &context, status);
+      }
+      case FlightMethod::DoGet: {
+        ARROW_ASSIGN_OR_RAISE(Frame request, driver->ReadFrame());
+        if (request.type != FrameType::kBuffer) {
+          return Status::IOError("Expected a request but got frame type ",
+                                 static_cast<int>(request.type));
+        }
+        status = StartCall(method, driver, &context);
+        if (status.ok()) {
+          auto ticket = Ticket::Deserialize(std::string_view(*request.buffer));
+          status = ticket.ok() ? ServerTransport::DoGet(context, *ticket, &stream)
+                               : ticket.status();
+        }
+        RETURN_NOT_OK(driver->is_connected() ? Status::OK() : status);
+        return SendStatus(driver, &context, status);
+      }
+      case FlightMethod::DoPut:
+      case FlightMethod::DoExchange: {
+        status = StartCall(method, driver, &context);
+        if (status.ok()) {
+          status = method == FlightMethod::DoPut
+                       ? ServerTransport::DoPut(context, &stream)
+                       : ServerTransport::DoExchange(context, &stream);
+        }
+        RETURN_NOT_OK(driver->is_connected() ? Status::OK() : status);
+        // Send the status right away, since the client may be waiting
+        // on it, then consume the rest of the client's stream
+        RETURN_NOT_OK(SendStatus(driver, &context, status));
+        return stream.Drain();
+      }
+      default:
+        return Status::IOError("Unknown Flight method ", method_int);
+    }
+  }
+
+  Status DoHandshake(UcpCallDriver* driver, UcxServerCallContext& context,
+                     UcxServerAuthReader* incoming) {
+    RETURN_NOT_OK(StartMiddleware(FlightMethod::Handshake, &context));
+    if (!auth_handler_) {
+      return Status::NotImplemented(
+          "This service does not have an authentication mechanism enabled.");
+    }
+    UcxServerAuthSender outgoing(driver);
+    return auth_handler_->Authenticate(context, &outgoing, incoming);
+  }
+
+  Status DoUnaryCall(FlightMethod method, UcpCallDriver* driver,
+                     const UcxServerCallContext& context, const Buffer& request) {
+    const std::string_view serialized(request);
+    switch (method) {
+      case FlightMethod::ListFlights: {
+        ARROW_ASSIGN_OR_RAISE(auto criteria, Criteria::Deserialize(serialized));
+        std::unique_ptr<FlightListing> listing;
+        RETURN_NOT_OK(base()->ListFlights(context, &criteria, &listing));
+        if (!listing) return Status::OK();
+        while (true) {
+          ARROW_ASSIGN_OR_RAISE(auto info, listing->Next());
+          if (!info) break;
+          RETURN_NOT_OK(SendSerialized(driver, *info));
+        }
+        return Status::OK();
+      }
+      case FlightMethod::GetFlightInfo: {
+        ARROW_ASSIGN_OR_RAISE(auto descriptor, FlightDescriptor::Deserialize(serialized));
+        std::unique_ptr<FlightInfo> info;
+        RETURN_NOT_OK(base()->GetFlightInfo(context, descriptor, &info));
+        if (!info) return Status::KeyError("Flight not found");
+        return SendSerialized(driver, *info);
+      }
+      case FlightMethod::PollFlightInfo: {
+        ARROW_ASSIGN_OR_RAISE(auto descriptor, FlightDescriptor::Deserialize(serialized));
+        std::unique_ptr<PollInfo> info;
+        RETURN_NOT_OK(base()->PollFlightInfo(context, descriptor, &info));
+        if (!info) return Status::KeyError("Flight not found");
+        return SendSerialized(driver, *info);
+      }
+      case FlightMethod::GetSchema: {
+        ARROW_ASSIGN_OR_RAISE(auto descriptor, FlightDescriptor::Deserialize(serialized));
+        std::unique_ptr<SchemaResult> result;
+        RETURN_NOT_OK(base()->GetSchema(context, descriptor, &result));
+        if (!result) return Status::KeyError("Flight not found");
+        return SendSerialized(driver, *result);
+      }
+      case FlightMethod::DoAction: {
+        ARROW_ASSIGN_OR_RAISE(auto action, Action::Deserialize(serialized));
+        std::unique_ptr<ResultStream> results;
+        RETURN_NOT_OK(base()->DoAction(context, action, &results));
+        if (!results) return Status::OK();
+        while (true) {
+          ARROW_ASSIGN_OR_RAISE(auto result, results->Next());
+          if (!result) break;
+          RETURN_NOT_OK(SendSerialized(driver, *result));
+        }
+        return Status::OK();
+      }
+      default:
+        return Status::NotImplemented("Method ", ToString(method));
+    }
+  }
+
+  template <typename T>
+  Status SendSerialized(UcpCallDriver* driver, const T& value) {
+    ARROW_ASSIGN_OR_RAISE(auto serialized, value.SerializeToString());
+    return driver->SendBuffer(Buffer(serialized));
+  }
+
+  /// \brief Authenticate the client (if applicable) and run middleware.
+  Status StartCall(FlightMethod method, UcpCallDriver* driver,
+                   UcxServerCallContext* context) {
+    if (auth_handler_) {
+      std::string token;
+      const auto [begin, end] = context->incoming_headers_.equal_range(kHeaderAuthToken);
+      if (begin != end) token = std::string(begin->second);
+      RETURN_NOT_OK(auth_handler_->IsValid(*context, token, &context->peer_identity_));
+    }
+    return StartMiddleware(method, context);
+  }
+
+  Status StartMiddleware(FlightMethod method, UcxServerCallContext* context) {
+    const CallInfo info{method};
+    for (const auto& factory : middleware_) {
+      std::shared_ptr<ServerMiddleware> instance;
+      RETURN_NOT_OK(factory.second->StartCall(info, *context, &instance));
+      if (instance != nullptr) {
+        context->middleware_.push_back(instance);
+        context->middleware_map_.insert({factory.first, instance});
+      }
+    }
+    UcxAddServerHeaders outgoing_headers(context);
+    for (const auto& instance : context->middleware_) {
+      instance->SendingHeaders(&outgoing_headers);
+    }
+    return Status::OK();
+  }
+
+  Status SendStatus(UcpCallDriver* driver, UcxServerCallContext* context,
+                    const Status& status) {
+    return driver->SendHeaders(context->FinishRequest(status));
+  }
+
+  std::shared_ptr<ServerAuthHandler> auth_handler_;
+  std::vector<std::pair<std::string, std::shared_ptr<ServerMiddlewareFactory>>>
+      middleware_;
+  Location location_;
+
+  std::shared_ptr<UcpContext> ucp_context_;
+  std::shared_ptr<UcpWorker> listener_worker_;
+  ucp_listener_h listener_ = nullptr;
+  int efd_ = -1;
+  // Only touched by the listener thread (and by Shutdown once it has
+  // been joined)
+  std::deque<ucp_conn_request_h> pending_requests_;
+  std::thread listener_thread_;
+
+  std::atomic<bool> listening_{false};
+  std::atomic<bool> shutting_down_{false};
+  std::atomic<bool> draining_{false};
+
+  std::mutex mutex_;
+  std::condition_variable shut_down_cv_;
+  std::vector<std::thread> connection_threads_;
+  int active_calls_ = 0;
+  bool shut_down_ = false;
+};
+
+}  // namespace
+
+arrow::Result<std::unique_ptr<internal::ServerTransport>> MakeUcxServerImpl(
+    FlightServerBase* base, std::shared_ptr<MemoryManager> memory_manager) {
+  return std::make_unique<UcxServerTransport>(base, std::move(memory_manager));
+}
+
+}  // namespace ucx
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,143 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/transport/ucx/util_internal.h"
+
+#include <netdb.h>
+#include <netinet/in.h>
+
+#include <cstring>
+
+#include "arrow/flight/types.h"
+#include "arrow/util/uri.h"
+
+namespace arrow {
+namespace flight {
+namespace transport {
+namespace ucx {
+
+Status FromUcsStatus(const std::string& context, ucs_status_t ucs_status) {
+  switch (ucs_status) {
+    case UCS_OK:
+      return Status::OK();
+    case UCS_INPROGRESS:
+      return Status::IOError(context, ": UCX operation still in progress");
+    case UCS_ERR_CANCELED:
+      return Status::Cancelled(context, ": ", ucs_status_string(ucs_status));
+    case UCS_ERR_NO_MEMORY:
+      return Status::OutOfMemory(context, ": ", ucs_status_string(ucs_status));
+    case UCS_ERR_INVALID_PARAM:
+      return Status::Invalid(context, ": ", ucs_status_string(ucs_status));
+    case UCS_ERR_UNSUPPORTED:
+      return Status::NotImplemented(context, ": ", ucs_status_string(ucs_status));
+    case UCS_ERR_CONNECTION_RESET:
+    case UCS_ERR_ENDPOINT_TIMEOUT:
+    case UCS_ERR_NOT_CONNECTED:
+    case UCS_ERR_UNREACHABLE:
+      return Status::IOError(context, ": ", ucs_status_string(ucs_status))
+          .WithDetail(std::make_shared<FlightStatusDetail>(FlightStatusCode::Unavailable));
+    default:
+      return Status::IOError(context, ": ", ucs_status_string(ucs_status));
+  }
+}
+
+arrow::Result<size_t> UriToSockaddr(const arrow::util::Uri& uri, sockaddr_storage* out) {
+  const std::string host = uri.host();
+  const std::string port = uri.port_text().empty() ? "0" : uri.port_text();
+
+  struct addrinfo hints;
+  std::memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  hints.ai_flags = AI_NUMERICSERV;
+
+  struct addrinfo* info = nullptr;
+  const int err = getaddrinfo(host.empty() ? nullptr : host.c_str(), port.c_str(),
+                              &hints, &info);
+  if (err != 0) {
+    return Status::IOError("Could not resolve host ", host, ": ", gai_strerror(err));
+  }
+  std::unique_ptr<struct addrinfo, decltype(&freeaddrinfo)> guard(info, &freeaddrinfo);
+  for (struct addrinfo* it = info; it != nullptr; it = it->ai_next) {
+    if (it->ai_family == AF_INET || it->ai_family == AF_INET6) {
+      std::memset(out, 0, sizeof(*out));
+      std::memcpy(out, it->ai_addr, it->ai_addrlen);
+      return static_cast<size_t>(it->ai_addrlen);
+    }
+  }
+  return Status::IOError("Host ", host, " has no IPv4 or IPv6 address");
+}
+
+arrow::Result<int> SockaddrToPort(const sockaddr_storage& address) {
+  switch (address.ss_family) {
+    case AF_INET:
+      return ntohs(reinterpret_cast<const sockaddr_in&>(address).sin_port);
+    case AF_INET6:
+      return ntohs(reinterpret_cast<const sockaddr_in6&>(address).sin6_port);
+    default:
+      return Status::Invalid("Unknown socket address family ", address.ss_family);
+  }
+}
+
+UcpContext::~UcpContext() {
+  if (ucp_context_) ucp_cleanup(ucp_context_);
+}
+
+arrow::Result<std::shared_ptr<UcpContext>> UcpContext::Make() {
+  ucp_config_t* ucp_config = nullptr;
+  RETURN_NOT_OK(FromUcsStatus("ucp_config_read",
+                              ucp_config_read(/*env_prefix=*/nullptr,
+                                              /*filename=*/nullptr, &ucp_config)));
+
+  ucp_params_t ucp_params;
+  std::memset(&ucp_params, 0, sizeof(ucp_params));
+  ucp_params.field_mask = UCP_PARAM_FIELD_FEATURES | UCP_PARAM_FIELD_MT_WORKERS_SHARED;
+  // Active messages carry all frames; wakeup lets idle connections
+  // sleep instead of spinning
+  ucp_params.features = UCP_FEATURE_AM | UCP_FEATURE_WAKEUP;
+  // Each connection has its own worker, driven by whichever thread
+  // is making the call
+  ucp_params.mt_workers_shared = 1;
+
+  ucp_context_h ucp_context = nullptr;
+  const ucs_status_t status = ucp_init(&ucp_params, ucp_config, &ucp_context);
+  ucp_config_release(ucp_config);
+  RETURN_NOT_OK(FromUcsStatus("ucp_init", status));
+  return std::make_shared<UcpContext>(ucp_context);
+}
+
+UcpWorker::~UcpWorker() {
+  if (ucp_worker_) ucp_worker_destroy(ucp_worker_);
+}
+
+arrow::Result<std::shared_ptr<UcpWorker>> UcpWorker::Make(
+    std::shared_ptr<UcpContext> context, ucs_thread_mode_t thread_mode) {
+  ucp_worker_params_t worker_params;
+  std::memset(&worker_params, 0, sizeof(worker_params));
+  worker_params.field_mask = UCP_WORKER_PARAM_FIELD_THREAD_MODE;
+  worker_params.thread_mode = thread_mode;
+
+  ucp_worker_h ucp_worker = nullptr;
+  RETURN_NOT_OK(FromUcsStatus(
+      "ucp_worker_create", ucp_worker_create(context->get(), &worker_params, &ucp_worker)));
+  return std::make_shared<UcpWorker>(std::move(context), ucp_worker);
+}
+
+}  // namespace ucx
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,95 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <sys/socket.h>
+
+#include <memory>
+#include <string>
+
+#include <ucp/api/ucp.h>
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+namespace util {
+class Uri;
+}  // namespace util
+namespace flight {
+namespace transport {
+namespace ucx {
+
+/// \brief Convert a UCS status to an Arrow status.
+Status FromUcsStatus(const std::string& context, ucs_status_t ucs_status);
+
+/// \brief Resolve the host and port of a URI to a socket address.
+///
+/// \return The length of the address written to out.
+arrow::Result<size_t> UriToSockaddr(const arrow::util::Uri& uri, sockaddr_storage* out);
+
+/// \brief Get the port of a socket address.
+arrow::Result<int> SockaddrToPort(const sockaddr_storage& address);
+
+/// \brief An owned UCP context.
+class UcpContext final {
+ public:
+  UcpContext() = default;
+  explicit UcpContext(ucp_context_h context) : ucp_context_(context) {}
+  ~UcpContext();
+  ARROW_DISALLOW_COPY_AND_ASSIGN(UcpContext);
+
+  ucp_context_h get() const { return ucp_context_; }
+
+  /// \brief Create a context with the features used by Flight.
+  static arrow::Result<std::shared_ptr<UcpContext>> Make();
+
+ private:
+  ucp_context_h ucp_context_ = nullptr;
+};
+
+/// \brief An owned UCP worker, keeping its context alive.
+class UcpWorker final {
+ public:
+  UcpWorker() = default;
+  UcpWorker(std::shared_ptr<UcpContext> context, ucp_worker_h worker)
+      : ucp_context_(std::move(context)), ucp_worker_(worker) {}
+  ~UcpWorker();
+  ARROW_DISALLOW_COPY_AND_ASSIGN(UcpWorker);
+
+  ucp_worker_h get() const { return ucp_worker_; }
+  const std::shared_ptr<UcpContext>& context() const { return ucp_context_; }
+
+  /// \brief Create a worker.
+  ///
+  /// A worker is only driven by one thread at a time, unless
+  /// thread_mode says otherwise.
+  static arrow::Result<std::shared_ptr<UcpWorker>> Make(
+      std::shared_ptr<UcpContext> context,
+      ucs_thread_mode_t thread_mode = UCS_THREAD_MODE_SERIALIZED);
+
+ private:
+  std::shared_ptr<UcpContext> ucp_context_;
+  ucp_worker_h ucp_worker_ = nullptr;
+};
+
+}  // namespace ucx
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
@@ -35,6 +35,7 @@ class ClientMiddlewareFactory;
 struct Criteria;
 class FlightCallOptions;
 struct FlightClientOptions;
+class FlightClientPool;
 struct FlightDescriptor;
 struct FlightEndpoint;
 class FlightInfo;
@@ -102,6 +102,8 @@ const char* kSchemeGrpcTcp = "grpc+tcp";
 const char* kSchemeGrpcUnix = "grpc+unix";
 const char* kSchemeGrpcTls = "grpc+tls";
 
+const char* kAcceptCompressionHeader = "x-arrow-flight-accept-compression";
+
 const char* kErrorDetailTypeId = "flight::FlightStatusDetail";
 
 const char* FlightStatusDetail::type_id() const { return kErrorDetailTypeId; }
@@ -159,6 +159,11 @@ Status MakeFlightError(FlightStatusCode code, std::string message,
 /// Header values are ordered.
 using CallHeaders = std::multimap<std::string_view, std::string_view>;
 
+/// \brief The header a client lists the codecs it accepts data compressed
+///     with in, as comma-separated names from util::Codec::GetCodecAsString.
+ARROW_FLIGHT_EXPORT
+extern const char* kAcceptCompressionHeader;
+
 /// \brief A TLS certificate plus key.
 struct ARROW_FLIGHT_EXPORT CertKeyPair {
   /// \brief The certificate in PEM format.
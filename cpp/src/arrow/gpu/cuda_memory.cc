@@ -20,23 +20,35 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <cuda.h>
 
+#include "arrow/array/data.h"
 #include "arrow/buffer.h"
 #include "arrow/device.h"
 #include "arrow/io/memory.h"
 #include "arrow/memory_pool.h"
+#include "arrow/memory_pool_internal.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/thread_pool.h"
 
 #include "arrow/gpu/cuda_context.h"
 #include "arrow/gpu/cuda_internal.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace cuda {
 
 using internal::ContextSaver;
@@ -486,6 +498,338 @@ Result<uint8_t*> GetHostAddress(uintptr_t device_ptr) {
   return static_cast<uint8_t*>(ptr);
 }
 
+// ----------------------------------------------------------------------
+// Page-locked host memory pool
+
+namespace {
+
+// Blocks are page-aligned and sized in powers of two, so that freed blocks
+// can be reused for any allocation of the same size class
+constexpr int64_t kMinHostBlockSize = 4096;
+
+class CudaHostMemoryPool : public MemoryPool {
+ public:
+  CudaHostMemoryPool(std::shared_ptr<CudaContext> context, int64_t max_cached_bytes)
+      : context_(std::move(context)), max_cached_bytes_(max_cached_bytes) {}
+
+  ~CudaHostMemoryPool() override { ReleaseUnused(); }
+
+  using MemoryPool::Allocate;
+  using MemoryPool::Free;
+  using MemoryPool::Reallocate;
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override {
+    if (size < 0) {
+      return Status::Invalid("negative malloc size");
+    }
+    if (alignment > kMinHostBlockSize) {
+      return Status::Invalid("CUDA host memory pool does not support alignment ",
+                             alignment);
+    }
+    if (size == 0) {
+      *out = memory_pool::internal::kZeroSizeArea;
+      return Status::OK();
+    }
+    RETURN_NOT_OK(AllocateBlock(BlockSize(size), out));
+    stats_.DidAllocateBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) override {
+    if (new_size < 0) {
+      return Status::Invalid("negative realloc size");
+    }
+    if (old_size > 0 && new_size > 0 && BlockSize(old_size) == BlockSize(new_size)) {
+      // The block is large enough already
+      stats_.DidReallocateBytes(old_size, new_size);
+      return Status::OK();
+    }
+    uint8_t* out;
+    RETURN_NOT_OK(Allocate(new_size, alignment, &out));
+    std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    Free(*ptr, old_size, alignment);
+    *ptr = out;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override {
+    if (buffer == memory_pool::internal::kZeroSizeArea) {
+      DCHECK_EQ(size, 0);
+      return;
+    }
+    const int64_t block_size = BlockSize(size);
+    stats_.DidFreeBytes(size);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (cached_bytes_ + block_size <= max_cached_bytes_) {
+        free_blocks_[block_size].push_back(buffer);
+        cached_bytes_ += block_size;
+        return;
+      }
+    }
+    FreeBlock(buffer);
+  }
+
+  void ReleaseUnused() override {
+    std::unordered_map<int64_t, std::vector<uint8_t*>> free_blocks;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      free_blocks.swap(free_blocks_);
+      cached_bytes_ = 0;
+    }
+    for (const auto& size_class : free_blocks) {
+      for (uint8_t* block : size_class.second) {
+        FreeBlock(block);
+      }
+    }
+  }
+
+  int64_t bytes_allocated() const override { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const override { return stats_.max_memory(); }
+
+  int64_t total_bytes_allocated() const override {
+    return stats_.total_bytes_allocated();
+  }
+
+  int64_t num_allocations() const override { return stats_.num_allocations(); }
+
+  std::string backend_name() const override { return "cuda_host"; }
+
+ private:
+  static int64_t BlockSize(int64_t size) {
+    return std::max(kMinHostBlockSize, bit_util::NextPower2(size));
+  }
+
+  Status AllocateBlock(int64_t block_size, uint8_t** out) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = free_blocks_.find(block_size);
+      if (it != free_blocks_.end() && !it->second.empty()) {
+        *out = it->second.back();
+        it->second.pop_back();
+        cached_bytes_ -= block_size;
+        return Status::OK();
+      }
+    }
+    ContextSaver set_temporary(*context_);
+    void* ptr;
+    CU_RETURN_NOT_OK("cuMemHostAlloc",
+                     cuMemHostAlloc(&ptr, static_cast<size_t>(block_size),
+                                    CU_MEMHOSTALLOC_PORTABLE));
+    *out = reinterpret_cast<uint8_t*>(ptr);
+    return Status::OK();
+  }
+
+  static void FreeBlock(uint8_t* block) {
+    // DCHECK_OK still evaluates its argument in release mode
+    DCHECK_OK(internal::StatusFromCuda(cuMemFreeHost(block), "cuMemFreeHost"));
+  }
+
+  std::shared_ptr<CudaContext> context_;
+  const int64_t max_cached_bytes_;
+  ::arrow::internal::MemoryPoolStats stats_;
+
+  std::mutex mutex_;
+  std::unordered_map<int64_t, std::vector<uint8_t*>> free_blocks_;
+  int64_t cached_bytes_ = 0;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<MemoryPool>> MakeCudaHostMemoryPool(int device_number,
+                                                           int64_t max_cached_bytes) {
+  ARROW_ASSIGN_OR_RAISE(auto manager, CudaDeviceManager::Instance());
+  ARROW_ASSIGN_OR_RAISE(auto device, manager->GetDevice(device_number));
+  ARROW_ASSIGN_OR_RAISE(auto context, device->GetContext());
+  return std::make_shared<CudaHostMemoryPool>(std::move(context), max_cached_bytes);
+}
+
+// ----------------------------------------------------------------------
+// Stream-ordered copies
+
+namespace {
+
+// Kept alive until the stream has executed the copies
+struct AsyncCopyState {
+  std::vector<std::shared_ptr<Buffer>> sources;
+  Future<> done = Future<>::Make();
+};
+
+void CUDA_CB OnAsyncCopiesDone(void* user_data) {
+  std::unique_ptr<AsyncCopyState> state(static_cast<AsyncCopyState*>(user_data));
+  // Host functions must not call into CUDA, which the continuations of the
+  // future may do: run them on another thread
+  auto done = state->done;
+  auto status = ::arrow::internal::GetCpuThreadPool()->Spawn(
+      [done]() mutable { done.MarkFinished(); });
+  if (!status.ok()) {
+    done.MarkFinished();
+  }
+}
+
+class AsyncCopier {
+ public:
+  AsyncCopier(std::shared_ptr<MemoryManager> to, std::shared_ptr<Device::Stream> stream)
+      : to_(std::move(to)),
+        stream_(std::move(stream)),
+        state_(std::make_unique<AsyncCopyState>()) {}
+
+  ~AsyncCopier() {
+    if (state_ && context_) {
+      // Copies were enqueued but Finish() was not reached: the sources must
+      // outlive them
+      ContextSaver set_temporary(*context_);
+      DCHECK_OK(internal::StatusFromCuda(cuStreamSynchronize(cu_stream_),
+                                         "cuStreamSynchronize"));
+    }
+  }
+
+  Status Init() {
+    if (stream_) {
+      auto cuda_stream = dynamic_cast<const CudaDevice::Stream*>(stream_.get());
+      if (cuda_stream == nullptr) {
+        return Status::TypeError("Expected a CUDA stream");
+      }
+      cu_stream_ = cuda_stream->value();
+    }
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<Buffer>> Copy(const std::shared_ptr<Buffer>& buf) {
+    const auto& from = buf->memory_manager();
+    const auto size = static_cast<size_t>(buf->size());
+    if (from->is_cpu() && IsCudaMemoryManager(*to_)) {
+      ARROW_ASSIGN_OR_RAISE(auto to_context, CudaContextOf(*to_));
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> dest,
+                            to_context->Allocate(buf->size()));
+      ContextSaver set_temporary(*to_context);
+      CU_RETURN_NOT_OK("cuMemcpyHtoDAsync",
+                       cuMemcpyHtoDAsync(static_cast<CUdeviceptr>(dest->address()),
+                                         buf->data(), size, cu_stream_));
+      return Enqueued(buf, std::move(to_context), std::move(dest));
+    }
+    if (IsCudaMemoryManager(*from) && (to_->is_cpu() || IsCudaMemoryManager(*to_))) {
+      ARROW_ASSIGN_OR_RAISE(auto from_context, CudaContextOf(*from));
+      // Order the copy after the work producing the buffer
+      if (auto sync_event = buf->device_sync_event()) {
+        if (stream_) {
+          RETURN_NOT_OK(stream_->WaitEvent(*sync_event));
+        } else {
+          RETURN_NOT_OK(sync_event->Wait());
+        }
+      }
+      const auto src = static_cast<CUdeviceptr>(buf->address());
+      if (to_->is_cpu()) {
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> dest,
+                              to_->AllocateBuffer(buf->size()));
+        ContextSaver set_temporary(*from_context);
+        CU_RETURN_NOT_OK("cuMemcpyDtoHAsync",
+                         cuMemcpyDtoHAsync(dest->mutable_data(), src, size, cu_stream_));
+        return Enqueued(buf, std::move(from_context), std::move(dest));
+      }
+      ARROW_ASSIGN_OR_RAISE(auto to_context, CudaContextOf(*to_));
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> dest,
+                            to_context->Allocate(buf->size()));
+      const auto dst = static_cast<CUdeviceptr>(dest->address());
+      ContextSaver set_temporary(*from_context);
+      if (to_context->handle() == from_context->handle()) {
+        CU_RETURN_NOT_OK("cuMemcpyDtoDAsync",
+                         cuMemcpyDtoDAsync(dst, src, size, cu_stream_));
+      } else {
+        CU_RETURN_NOT_OK(
+            "cuMemcpyPeerAsync",
+            cuMemcpyPeerAsync(dst, reinterpret_cast<CUcontext>(to_context->handle()), src,
+                              reinterpret_cast<CUcontext>(from_context->handle()), size,
+                              cu_stream_));
+      }
+      return Enqueued(buf, std::move(from_context), std::move(dest));
+    }
+    // Not a CUDA copy
+    return MemoryManager::CopyBuffer(buf, to_);
+  }
+
+  Result<std::shared_ptr<ArrayData>> Copy(const ArrayData& data) {
+    auto out = data.Copy();
+    for (auto& buffer : out->buffers) {
+      if (buffer) {
+        ARROW_ASSIGN_OR_RAISE(buffer, Copy(buffer));
+      }
+    }
+    for (auto& child : out->child_data) {
+      ARROW_ASSIGN_OR_RAISE(child, Copy(*child));
+    }
+    if (out->dictionary) {
+      ARROW_ASSIGN_OR_RAISE(out->dictionary, Copy(*out->dictionary));
+    }
+    return out;
+  }
+
+  /// Return a future completing once the stream has executed all copies
+  Future<> Finish() {
+    if (context_ == nullptr) {
+      // Nothing was enqueued
+      return Future<>::MakeFinished();
+    }
+    auto done = state_->done;
+    ContextSaver set_temporary(*context_);
+    CU_RETURN_NOT_OK("cuLaunchHostFunc",
+                     cuLaunchHostFunc(cu_stream_, OnAsyncCopiesDone, state_.get()));
+    // Now owned by the host function
+    state_.release();
+    return done;
+  }
+
+ private:
+  static Result<std::shared_ptr<CudaContext>> CudaContextOf(const MemoryManager& mm) {
+    return checked_cast<const CudaMemoryManager&>(mm).cuda_device()->GetContext();
+  }
+
+  std::shared_ptr<Buffer> Enqueued(const std::shared_ptr<Buffer>& source,
+                                   std::shared_ptr<CudaContext> context,
+                                   std::shared_ptr<Buffer> dest) {
+    state_->sources.push_back(source);
+    if (context_ == nullptr) {
+      context_ = std::move(context);
+    }
+    return dest;
+  }
+
+  std::shared_ptr<MemoryManager> to_;
+  std::shared_ptr<Device::Stream> stream_;
+  // The legacy default stream unless a stream is given
+  CUstream cu_stream_{};
+  // The context the stream is used from
+  std::shared_ptr<CudaContext> context_;
+  std::unique_ptr<AsyncCopyState> state_;
+};
+
+}  // namespace
+
+Future<std::shared_ptr<Buffer>> CopyBufferAsync(std::shared_ptr<Buffer> buf,
+                                                const std::shared_ptr<MemoryManager>& to,
+                                                std::shared_ptr<Device::Stream> stream) {
+  AsyncCopier copier(to, std::move(stream));
+  RETURN_NOT_OK(copier.Init());
+  ARROW_ASSIGN_OR_RAISE(auto dest, copier.Copy(buf));
+  return copier.Finish().Then([dest]() { return dest; });
+}
+
+Future<std::shared_ptr<RecordBatch>> CopyBatchToAsync(
+    std::shared_ptr<RecordBatch> batch, const std::shared_ptr<MemoryManager>& to,
+    std::shared_ptr<Device::Stream> stream) {
+  AsyncCopier copier(to, std::move(stream));
+  RETURN_NOT_OK(copier.Init());
+  std::vector<std::shared_ptr<ArrayData>> columns(batch->num_columns());
+  for (int i = 0; i < batch->num_columns(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(columns[i], copier.Copy(*batch->column_data(i)));
+  }
+  auto out = RecordBatch::Make(batch->schema(), batch->num_rows(), std::move(columns),
+                               to->device()->device_type());
+  return copier.Finish().Then([out]() { return out; });
+}
+
 Result<std::shared_ptr<MemoryManager>> DefaultMemoryMapper(ArrowDeviceType device_type,
                                                            int64_t device_id) {
   switch (device_type) {
@@ -22,9 +22,11 @@
 
 #include "arrow/buffer.h"
 #include "arrow/c/abi.h"
+#include "arrow/device.h"
 #include "arrow/gpu/visibility.h"
 #include "arrow/io/concurrency.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/future.h"
 
 namespace arrow {
 namespace cuda {
@@ -252,6 +254,51 @@ ARROW_CUDA_EXPORT
 Result<std::shared_ptr<CudaHostBuffer>> AllocateCudaHostBuffer(int device_number,
                                                                const int64_t size);
 
+/// \brief EXPERIMENTAL: Create a memory pool of page-locked host memory
+///
+/// Page-locked ("pinned") memory can be copied to and from CUDA devices
+/// asynchronously and at full bus bandwidth, unlike pageable memory which is
+/// first staged through a driver buffer. Use this pool as the host memory pool
+/// for reads whose results are sent to a device (e.g. IPC or Parquet reads).
+///
+/// Pinning memory is expensive, so freed blocks are kept for reuse, up to
+/// max_cached_bytes; ReleaseUnused() returns them to the system.
+///
+/// \param[in] device_number device to expose host memory
+/// \param[in] max_cached_bytes maximum size of freed blocks kept for reuse
+/// \return the memory pool
+ARROW_CUDA_EXPORT
+Result<std::shared_ptr<MemoryPool>> MakeCudaHostMemoryPool(
+    int device_number, int64_t max_cached_bytes = 256 * 1024 * 1024);
+
+/// \brief EXPERIMENTAL: Copy a buffer to another device, ordered on a CUDA stream
+///
+/// Copies between the CPU and a CUDA device, or between CUDA devices, are
+/// enqueued on the stream and the returned future completes once the stream
+/// has executed them. The source buffer is kept alive until then. Copies to
+/// the CPU allocate the destination with the CPU memory manager `to`: give it
+/// a pinned memory pool for the copy to be truly asynchronous.
+///
+/// Other copies are done synchronously, as with MemoryManager::CopyBuffer.
+///
+/// \param[in] buf the buffer to copy
+/// \param[in] to the memory manager of the destination
+/// \param[in] stream a CudaDevice::Stream; if null, the default stream is used
+ARROW_CUDA_EXPORT
+Future<std::shared_ptr<Buffer>> CopyBufferAsync(std::shared_ptr<Buffer> buf,
+                                                const std::shared_ptr<MemoryManager>& to,
+                                                std::shared_ptr<Device::Stream> stream);
+
+/// \brief EXPERIMENTAL: Copy a record batch to another device, ordered on a
+/// CUDA stream
+///
+/// All buffers of the batch are copied as with CopyBufferAsync, and the
+/// returned future completes once the stream has executed all copies.
+ARROW_CUDA_EXPORT
+Future<std::shared_ptr<RecordBatch>> CopyBatchToAsync(
+    std::shared_ptr<RecordBatch> batch, const std::shared_ptr<MemoryManager>& to,
+    std::shared_ptr<Device::Stream> stream);
+
 /// Low-level: get a device address through which the CPU data be accessed.
 ARROW_CUDA_EXPORT
 Result<uintptr_t> GetDeviceAddress(const uint8_t* cpu_data,
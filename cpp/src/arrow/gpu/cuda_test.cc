@@ -16,6 +16,7 @@
 // under the License.
 
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <string>
 
@@ -30,6 +31,7 @@
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/test_common.h"
 #include "arrow/status.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 
@@ -282,6 +284,44 @@ TEST_F(TestCudaDevice, ExplicitStream) {
   }
 }
 
+TEST_F(TestCudaDevice, CopyAsync) {
+  ASSERT_OK_AND_ASSIGN(auto stream, device_->MakeStream());
+  ASSERT_OK_AND_ASSIGN(auto pool, MakeCudaHostMemoryPool(kGpuNumber));
+  auto pinned_mm = CPUDevice::memory_manager(pool.get());
+  auto cpu_buffer = Buffer::FromString("some data");
+
+  // CPU -> device
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto device_buffer,
+                                CopyBufferAsync(cpu_buffer, mm_, stream));
+  ASSERT_EQ(device_buffer->device(), device_);
+  AssertCudaBufferEquals(*device_buffer, "some data");
+
+  // device -> device
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto other_buffer,
+                                CopyBufferAsync(device_buffer, mm_, stream));
+  ASSERT_EQ(other_buffer->device(), device_);
+  ASSERT_NE(other_buffer->address(), device_buffer->address());
+  AssertCudaBufferEquals(*other_buffer, "some data");
+
+  // device -> pinned CPU memory, on the default stream
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto host_buffer,
+                                CopyBufferAsync(other_buffer, pinned_mm, nullptr));
+  ASSERT_TRUE(host_buffer->is_cpu());
+  AssertBufferEqual(*host_buffer, "some data");
+  ASSERT_EQ(pool->bytes_allocated(), host_buffer->size());
+
+  // Record batches, with nested data
+  auto batch = RecordBatchFromJSON(
+      schema({field("ints", int32()), field("lists", list(utf8()))}),
+      R"([{"ints": 1, "lists": ["a", null]}, {"ints": null, "lists": null}])");
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto device_batch, CopyBatchToAsync(batch, mm_, stream));
+  ASSERT_EQ(device_batch->device_type(), DeviceAllocationType::kCUDA);
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto host_batch,
+                                CopyBatchToAsync(device_batch, pinned_mm, stream));
+  ASSERT_OK(host_batch->ValidateFull());
+  AssertBatchesEqual(*batch, *host_batch);
+}
+
 // ------------------------------------------------------------------------
 // Test CudaContext
 
@@ -468,6 +508,40 @@ TEST_F(TestCudaHostBuffer, ViewOnDevice) {
   ASSERT_EQ(buffer->device_type(), DeviceAllocationType::kCUDA_HOST);
 }
 
+TEST_F(TestCudaHostBuffer, MemoryPool) {
+  ASSERT_OK_AND_ASSIGN(auto pool, MakeCudaHostMemoryPool(kGpuNumber,
+                                                         /*max_cached_bytes=*/8192));
+  ASSERT_EQ(pool->backend_name(), "cuda_host");
+
+  ASSERT_OK_AND_ASSIGN(auto buffer, AllocateBuffer(1000, pool.get()));
+  ASSERT_EQ(pool->bytes_allocated(), 1000);
+  // The memory is page-locked, hence mapped on the device
+  ASSERT_OK_AND_ASSIGN(auto device_address, GetDeviceAddress(buffer->data(), context_));
+  ASSERT_NE(device_address, 0);
+
+  // Freed blocks are reused
+  const uint8_t* address = buffer->data();
+  buffer.reset();
+  ASSERT_EQ(pool->bytes_allocated(), 0);
+  ASSERT_OK_AND_ASSIGN(buffer, AllocateBuffer(2000, pool.get()));
+  ASSERT_EQ(buffer->data(), address);
+
+  // Resizing within the block does not move the data
+  ASSERT_OK_AND_ASSIGN(auto resizable, AllocateResizableBuffer(100, pool.get()));
+  std::memset(resizable->mutable_data(), 42, 100);
+  address = resizable->data();
+  ASSERT_OK(resizable->Resize(3000));
+  ASSERT_EQ(resizable->data(), address);
+  ASSERT_OK(resizable->Resize(100000));
+  ASSERT_EQ(resizable->data()[99], 42);
+  ASSERT_EQ(pool->bytes_allocated(), 2000 + resizable->capacity());
+
+  resizable.reset();
+  buffer.reset();
+  ASSERT_EQ(pool->bytes_allocated(), 0);
+  pool->ReleaseUnused();
+}
+
 // ------------------------------------------------------------------------
 // Test CudaBufferWriter
 
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cmath>
 #include <mutex>
 #include <utility>
@@ -28,10 +29,56 @@
 #include "arrow/result.h"
 #include "arrow/util/future.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/metrics.h"
 
 namespace arrow {
 namespace io {
 
+namespace {
+
+struct CacheMetrics {
+  util::Counter* requested_ranges;
+  util::Counter* coalesced_ranges;
+  util::Counter* hits;
+  util::Counter* misses;
+
+  static const CacheMetrics& Get() {
+    static const CacheMetrics metrics = [] {
+      auto* registry = util::MetricsRegistry::Global();
+      return CacheMetrics{registry->GetCounter("io.read_range_cache.requested_ranges"),
+                          registry->GetCounter("io.read_range_cache.coalesced_ranges"),
+                          registry->GetCounter("io.read_range_cache.hits"),
+                          registry->GetCounter("io.read_range_cache.misses")};
+    }();
+    return metrics;
+  }
+};
+
+struct CoalescingLimits {
+  int64_t hole_size_limit;
+  int64_t range_size_limit;
+};
+
+// See CacheOptions::MakeFromNetworkMetrics for the derivation
+CoalescingLimits ComputeCoalescingLimits(double time_to_first_byte_sec,
+                                         double transfer_bandwidth_bytes_per_sec,
+                                         double ideal_bandwidth_utilization_frac,
+                                         int64_t max_ideal_request_size_bytes) {
+  // hole_size_limit = TTFB * BW
+  const auto hole_size_limit = static_cast<int64_t>(
+      std::round(time_to_first_byte_sec * transfer_bandwidth_bytes_per_sec));
+
+  // range_size_limit = min(MAX_IDEAL_REQUEST_SIZE,
+  //                        hole_size_limit * BW_util_frac / (1 - BW_util_frac))
+  const int64_t range_size_limit = std::min(
+      max_ideal_request_size_bytes,
+      static_cast<int64_t>(std::round(hole_size_limit * ideal_bandwidth_utilization_frac /
+                                      (1 - ideal_bandwidth_utilization_frac))));
+  return {hole_size_limit, range_size_limit};
+}
+
+}  // namespace
+
 CacheOptions CacheOptions::Defaults() {
   return CacheOptions{internal::ReadRangeCache::kDefaultHoleSizeLimit,
                       internal::ReadRangeCache::kDefaultRangeSizeLimit,
@@ -114,20 +161,88 @@ CacheOptions CacheOptions::MakeFromNetworkMetrics(int64_t time_to_first_byte_mil
       transfer_bandwidth_mib_per_sec * 1024 * 1024;
   const int64_t max_ideal_request_size_bytes = max_ideal_request_size_mib * 1024 * 1024;
 
-  // hole_size_limit = TTFB * BW
-  const auto hole_size_limit = static_cast<int64_t>(
-      std::round(time_to_first_byte_sec * transfer_bandwidth_bytes_per_sec));
-  DCHECK_GT(hole_size_limit, 0) << "Computed hole_size_limit must be > 0";
+  const auto limits = ComputeCoalescingLimits(
+      time_to_first_byte_sec, static_cast<double>(transfer_bandwidth_bytes_per_sec),
+      ideal_bandwidth_utilization_frac, max_ideal_request_size_bytes);
+  DCHECK_GT(limits.hole_size_limit, 0) << "Computed hole_size_limit must be > 0";
+  DCHECK_GT(limits.range_size_limit, 0) << "Computed range_size_limit must be > 0";
 
-  // range_size_limit = min(MAX_IDEAL_REQUEST_SIZE,
-  //                        hole_size_limit * BW_util_frac / (1 - BW_util_frac))
-  const int64_t range_size_limit = std::min(
-      max_ideal_request_size_bytes,
-      static_cast<int64_t>(std::round(hole_size_limit * ideal_bandwidth_utilization_frac /
-                                      (1 - ideal_bandwidth_utilization_frac))));
-  DCHECK_GT(range_size_limit, 0) << "Computed range_size_limit must be > 0";
+  return {limits.hole_size_limit, limits.range_size_limit, /*lazy=*/false,
+          /*prefetch_limit=*/0};
+}
 
-  return {hole_size_limit, range_size_limit, /*lazy=*/false, /*prefetch_limit=*/0};
+AdaptiveCacheTuner::AdaptiveCacheTuner(double smoothing_factor,
+                                       double ideal_bandwidth_utilization_frac,
+                                       int64_t max_ideal_request_size_mib,
+                                       int64_t max_prefetch_limit)
+    : smoothing_factor_(smoothing_factor),
+      ideal_bandwidth_utilization_frac_(ideal_bandwidth_utilization_frac),
+      max_ideal_request_size_mib_(max_ideal_request_size_mib),
+      max_prefetch_limit_(max_prefetch_limit) {
+  DCHECK_GT(smoothing_factor, 0) << "Smoothing factor must be > 0";
+  DCHECK_LE(smoothing_factor, 1) << "Smoothing factor must be <= 1";
+  DCHECK_GT(ideal_bandwidth_utilization_frac, 0)
+      << "Ideal bandwidth utilization fraction must be > 0";
+  DCHECK_LT(ideal_bandwidth_utilization_frac, 1.0)
+      << "Ideal bandwidth utilization fraction must be < 1";
+  DCHECK_GT(max_ideal_request_size_mib, 0) << "Max Ideal request size must be > 0";
+  DCHECK_GT(max_prefetch_limit, 0) << "Max prefetch limit must be > 0";
+}
+
+void AdaptiveCacheTuner::RecordRead(int64_t nbytes, double duration_sec) {
+  if (nbytes <= 0 || duration_sec <= 0) {
+    return;
+  }
+  const double x = static_cast<double>(nbytes);
+  const double y = duration_sec;
+  std::lock_guard<std::mutex> lock(mutex_);
+  const double alpha = num_reads_ == 0 ? 1.0 : smoothing_factor_;
+  mean_x_ += alpha * (x - mean_x_);
+  mean_y_ += alpha * (y - mean_y_);
+  mean_xx_ += alpha * (x * x - mean_xx_);
+  mean_xy_ += alpha * (x * y - mean_xy_);
+  metrics_.num_reads = ++num_reads_;
+
+  // Least squares fit of duration = TTFB + nbytes / BW. The estimates are left
+  // unchanged when the read sizes are too uniform to tell both terms apart.
+  const double var_x = mean_xx_ - mean_x_ * mean_x_;
+  if (var_x <= 1e-6 * mean_x_ * mean_x_) {
+    return;
+  }
+  const double slope = (mean_xy_ - mean_x_ * mean_y_) / var_x;
+  if (slope <= 0) {
+    return;
+  }
+  metrics_.bandwidth_bytes_per_sec = 1 / slope;
+  metrics_.time_to_first_byte_sec = std::max(0.0, mean_y_ - slope * mean_x_);
+}
+
+AdaptiveCacheTuner::Metrics AdaptiveCacheTuner::metrics() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return metrics_;
+}
+
+CacheOptions AdaptiveCacheTuner::Tune(const CacheOptions& base_options) const {
+  const Metrics metrics = this->metrics();
+  if (!metrics.estimated()) {
+    return base_options;
+  }
+  const auto limits = ComputeCoalescingLimits(
+      metrics.time_to_first_byte_sec, metrics.bandwidth_bytes_per_sec,
+      ideal_bandwidth_utilization_frac_, max_ideal_request_size_mib_ * 1024 * 1024);
+  CacheOptions options = base_options;
+  // CoalesceReadRanges requires range_size_limit > hole_size_limit
+  options.range_size_limit = std::max<int64_t>(limits.range_size_limit, 2);
+  options.hole_size_limit =
+      std::clamp<int64_t>(limits.hole_size_limit, 1, options.range_size_limit - 1);
+  if (options.lazy && options.prefetch_limit > 0) {
+    // Number of ranges transferred during the time to first byte of the next one
+    const auto prefetch_limit = static_cast<int64_t>(
+        std::ceil(static_cast<double>(limits.hole_size_limit) /
+                  static_cast<double>(options.range_size_limit)));
+    options.prefetch_limit = std::clamp<int64_t>(prefetch_limit, 1, max_prefetch_limit_);
+  }
+  return options;
 }
 
 namespace internal {
@@ -135,6 +250,9 @@ namespace internal {
 struct RangeCacheEntry {
   ReadRange range;
   Future<std::shared_ptr<Buffer>> future;
+  // The bytes of the requested ranges in this range not yet handed out by Read(),
+  // only tracked with CacheOptions::release_after_read
+  int64_t unread_bytes = 0;
 
   RangeCacheEntry() = default;
   RangeCacheEntry(const ReadRange& range_, Future<std::shared_ptr<Buffer>> future_)
@@ -149,6 +267,8 @@ struct ReadRangeCache::Impl {
   std::shared_ptr<RandomAccessFile> owned_file;
   RandomAccessFile* file;
   IOContext ctx;
+  // The options given by the user, and the ones in effect
+  CacheOptions base_options;
   CacheOptions options;
 
   // Ordered by offset (so as to find a matching region by binary search)
@@ -156,28 +276,83 @@ struct ReadRangeCache::Impl {
 
   virtual ~Impl() = default;
 
+  // Read a range from the file, recording the read duration if tuning is enabled
+  Future<std::shared_ptr<Buffer>> ReadAsync(const ReadRange& range) {
+    auto fut = file->ReadAsync(ctx, range.offset, range.length);
+    if (base_options.tuner) {
+      auto start = std::chrono::steady_clock::now();
+      fut.AddCallback([tuner = base_options.tuner,
+                       start](const Result<std::shared_ptr<Buffer>>& result) {
+        if (result.ok()) {
+          std::chrono::duration<double> duration =
+              std::chrono::steady_clock::now() - start;
+          tuner->RecordRead((*result)->size(), duration.count());
+        }
+      });
+    }
+    return fut;
+  }
+
+  virtual CacheOptions GetOptions() { return options; }
+
   // Get the future corresponding to a range
   virtual Future<std::shared_ptr<Buffer>> MaybeRead(RangeCacheEntry* entry) {
     return entry->future;
   }
 
+  // Read a range ahead of time, if not already done
+  virtual void Prefetch(RangeCacheEntry* entry) {
+    if (!entry->future.is_valid()) {
+      entry->future = ReadAsync(entry->range);
+    }
+  }
+
+  // Called when Read() hands out a range of the given entry
+  virtual void OnRead(RangeCacheEntry* entry, const ReadRange& range) {}
+
   // Make cache entries for ranges
   virtual std::vector<RangeCacheEntry> MakeCacheEntries(
       const std::vector<ReadRange>& ranges) {
     std::vector<RangeCacheEntry> new_entries;
     new_entries.reserve(ranges.size());
     for (const auto& range : ranges) {
-      new_entries.emplace_back(range, file->ReadAsync(ctx, range.offset, range.length));
+      new_entries.emplace_back(range, ReadAsync(range));
     }
     return new_entries;
   }
 
   // Add the given ranges to the cache, coalescing them where possible
   virtual Status Cache(std::vector<ReadRange> ranges) {
+    if (base_options.tuner) {
+      options = base_options.tuner->Tune(base_options);
+    }
+    CacheMetrics::Get().requested_ranges->Add(static_cast<int64_t>(ranges.size()));
+    std::vector<ReadRange> requested;
+    if (options.release_after_read) {
+      requested = ranges;
+    }
     ARROW_ASSIGN_OR_RAISE(
         ranges, internal::CoalesceReadRanges(std::move(ranges), options.hole_size_limit,
                                              options.range_size_limit));
+    CacheMetrics::Get().coalesced_ranges->Add(static_cast<int64_t>(ranges.size()));
     std::vector<RangeCacheEntry> new_entries = MakeCacheEntries(ranges);
+    if (!requested.empty()) {
+      // Both are ordered by offset, and each requested range is in a coalesced one
+      std::sort(requested.begin(), requested.end(),
+                [](const ReadRange& left, const ReadRange& right) {
+                  return left.offset < right.offset;
+                });
+      auto entry_it = new_entries.begin();
+      for (const auto& range : requested) {
+        while (entry_it != new_entries.end() && !entry_it->range.Contains(range)) {
+          ++entry_it;
+        }
+        if (entry_it == new_entries.end()) {
+          break;
+        }
+        entry_it->unread_bytes += range.length;
+      }
+    }
     // Add new entries, themselves ordered by offset
     if (entries.size() > 0) {
       std::vector<RangeCacheEntry> merged(entries.size() + new_entries.size());
@@ -210,6 +385,7 @@ struct ReadRangeCache::Impl {
           return entry.range.offset + entry.range.length < range.offset + range.length;
         });
     if (it != entries.end() && it->range.Contains(range)) {
+      CacheMetrics::Get().hits->Add();
       auto fut = MaybeRead(&*it);
       ARROW_ASSIGN_OR_RAISE(auto buf, fut.result());
       if (options.lazy && options.prefetch_limit > 0) {
@@ -217,15 +393,14 @@ struct ReadRangeCache::Impl {
         for (auto next_it = it + 1;
              next_it != entries.end() && num_prefetched < options.prefetch_limit;
              ++next_it) {
-          if (!next_it->future.is_valid()) {
-            next_it->future =
-                file->ReadAsync(ctx, next_it->range.offset, next_it->range.length);
-          }
+          Prefetch(&*next_it);
           ++num_prefetched;
         }
       }
+      OnRead(&*it, range);
       return SliceBuffer(std::move(buf), range.offset - it->range.offset, range.length);
     }
+    CacheMetrics::Get().misses->Add();
     return Status::Invalid("ReadRangeCache did not find matching cache entry");
   }
 
@@ -272,7 +447,7 @@ struct ReadRangeCache::LazyImpl : public ReadRangeCache::Impl {
   Future<std::shared_ptr<Buffer>> MaybeRead(RangeCacheEntry* entry) override {
     // Called by superclass Read()/WaitFor() so we have the lock
     if (!entry->future.is_valid()) {
-      entry->future = file->ReadAsync(ctx, entry->range.offset, entry->range.length);
+      entry->future = ReadAsync(entry->range);
     }
     return entry->future;
   }
@@ -289,6 +464,11 @@ struct ReadRangeCache::LazyImpl : public ReadRangeCache::Impl {
     return new_entries;
   }
 
+  CacheOptions GetOptions() override {
+    std::unique_lock<std::mutex> guard(entry_mutex);
+    return ReadRangeCache::Impl::GetOptions();
+  }
+
   Status Cache(std::vector<ReadRange> ranges) override {
     std::unique_lock<std::mutex> guard(entry_mutex);
     return ReadRangeCache::Impl::Cache(std::move(ranges));
@@ -310,14 +490,110 @@ struct ReadRangeCache::LazyImpl : public ReadRangeCache::Impl {
   }
 };
 
+// Bound the memory used by the cache, and release ranges once they have been read.
+struct ReadRangeCache::BoundedImpl : public ReadRangeCache::LazyImpl {
+  // Whether to read ranges ahead of time, as done by Impl with lazy = false
+  bool eager = false;
+  // The bytes of the ranges being read or held
+  int64_t held_bytes = 0;
+
+  virtual ~BoundedImpl() = default;
+
+  bool Consumed(const RangeCacheEntry& entry) const {
+    return options.release_after_read && entry.unread_bytes <= 0;
+  }
+
+  // Whether the range may be read before being requested
+  bool CanReadAhead(const RangeCacheEntry& entry) const {
+    return options.memory_limit <= 0 || held_bytes == 0 ||
+           held_bytes + entry.range.length <= options.memory_limit;
+  }
+
+  void Issue(RangeCacheEntry* entry) {
+    entry->future = ReadAsync(entry->range);
+    held_bytes += entry->range.length;
+  }
+
+  // Read the following ranges ahead of time, as far as the memory limit allows
+  void IssueReads() {
+    for (auto& entry : entries) {
+      if (entry.future.is_valid() || Consumed(entry)) {
+        continue;
+      }
+      if (!CanReadAhead(entry)) {
+        break;
+      }
+      Issue(&entry);
+    }
+  }
+
+  Future<std::shared_ptr<Buffer>> MaybeRead(RangeCacheEntry* entry) override {
+    // Called by superclass Read()/WaitFor() so we have the lock
+    if (!entry->future.is_valid()) {
+      Issue(entry);
+    }
+    return entry->future;
+  }
+
+  void Prefetch(RangeCacheEntry* entry) override {
+    if (!entry->future.is_valid() && !Consumed(*entry) && CanReadAhead(*entry)) {
+      Issue(entry);
+    }
+  }
+
+  void OnRead(RangeCacheEntry* entry, const ReadRange& range) override {
+    if (!options.release_after_read) {
+      return;
+    }
+    entry->unread_bytes -= range.length;
+    if (entry->unread_bytes <= 0 && entry->future.is_valid()) {
+      entry->future = Future<std::shared_ptr<Buffer>>();
+      held_bytes -= entry->range.length;
+      if (eager) {
+        IssueReads();
+      }
+    }
+  }
+
+  Status Cache(std::vector<ReadRange> ranges) override {
+    std::unique_lock<std::mutex> guard(entry_mutex);
+    RETURN_NOT_OK(ReadRangeCache::Impl::Cache(std::move(ranges)));
+    if (eager) {
+      IssueReads();
+    }
+    return Status::OK();
+  }
+
+  Future<> Wait() override {
+    std::unique_lock<std::mutex> guard(entry_mutex);
+    // Ranges already handed out are not read again
+    std::vector<Future<>> futures;
+    for (auto& entry : entries) {
+      if (!Consumed(entry)) {
+        futures.emplace_back(MaybeRead(&entry));
+      }
+    }
+    return AllComplete(futures);
+  }
+};
+
 ReadRangeCache::ReadRangeCache(std::shared_ptr<RandomAccessFile> owned_file,
                                RandomAccessFile* file, IOContext ctx,
-                               CacheOptions options)
-    : impl_(options.lazy ? new LazyImpl() : new Impl()) {
+                               CacheOptions options) {
+  if (options.memory_limit > 0 || options.release_after_read) {
+    auto impl = std::make_unique<BoundedImpl>();
+    impl->eager = !options.lazy;
+    impl_ = std::move(impl);
+  } else if (options.lazy) {
+    impl_ = std::make_unique<LazyImpl>();
+  } else {
+    impl_ = std::make_unique<Impl>();
+  }
   impl_->owned_file = std::move(owned_file);
   impl_->file = file;
   impl_->ctx = std::move(ctx);
-  impl_->options = options;
+  impl_->base_options = options;
+  impl_->options = std::move(options);
 }
 
 ReadRangeCache::~ReadRangeCache() = default;
@@ -332,6 +608,8 @@ Result<std::shared_ptr<Buffer>> ReadRangeCache::Read(ReadRange range) {
 
 Future<> ReadRangeCache::Wait() { return impl_->Wait(); }
 
+CacheOptions ReadRangeCache::options() const { return impl_->GetOptions(); }
+
 Future<> ReadRangeCache::WaitFor(std::vector<ReadRange> ranges) {
   return impl_->WaitFor(std::move(ranges));
 }
@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -30,6 +31,8 @@
 namespace arrow {
 namespace io {
 
+class AdaptiveCacheTuner;
+
 struct ARROW_EXPORT CacheOptions {
   static constexpr double kDefaultIdealBandwidthUtilizationFrac = 0.9;
   static constexpr int64_t kDefaultMaxIdealRequestSizeMib = 64;
@@ -51,11 +54,31 @@ struct ARROW_EXPORT CacheOptions {
   /// \brief The maximum number of ranges to be prefetched. This is only used
   ///   for lazy cache to asynchronously read some ranges after reading the target range.
   int64_t prefetch_limit = 0;
+  /// \brief The maximum number of bytes of coalesced ranges being read or held by
+  ///   the cache, or 0 for no limit.
+  ///
+  /// When the limit is reached, no range is read ahead of time (either because of
+  /// lazy = false or of prefetch_limit) until memory is released. Ranges explicitly
+  /// requested by Read() or WaitFor() are always read. This is mostly useful together
+  /// with release_after_read.
+  int64_t memory_limit = 0;
+  /// \brief Whether to release a coalesced range once all the ranges given to Cache()
+  ///   that it contains have been handed out by Read().
+  ///
+  /// A released range is read again from the file if it is requested once more.
+  bool release_after_read = false;
+  /// \brief If set, the coalescing parameters above are adjusted from the latency
+  ///   and throughput of the reads issued by the caches using these options.
+  ///
+  /// The same tuner can be shared by all the caches reading from a given filesystem,
+  /// so that the measurements of each read benefit subsequent ones.
+  std::shared_ptr<AdaptiveCacheTuner> tuner;
 
   bool operator==(const CacheOptions& other) const {
     return hole_size_limit == other.hole_size_limit &&
            range_size_limit == other.range_size_limit && lazy == other.lazy &&
-           prefetch_limit == other.prefetch_limit;
+           prefetch_limit == other.prefetch_limit && memory_limit == other.memory_limit &&
+           release_after_read == other.release_after_read && tuner == other.tuner;
   }
 
   /// \brief Construct CacheOptions from network storage metrics (e.g. S3).
@@ -82,6 +105,80 @@ struct ARROW_EXPORT CacheOptions {
   static CacheOptions LazyDefaults();
 };
 
+/// \brief Estimate network storage metrics from observed reads and derive
+/// CacheOptions from them.
+///
+/// Each read is modelled as `duration = time_to_first_byte + nbytes / bandwidth`, and
+/// both metrics are estimated by a linear regression over an exponentially weighted
+/// history of (size, duration) samples, so that the estimates follow changes in the
+/// storage behaviour. Durations measured by ReadRangeCache include the time spent
+/// waiting for the IOContext executor.
+///
+/// The coalescing parameters are then derived as in
+/// CacheOptions::MakeFromNetworkMetrics. The prefetch limit of lazy caches that
+/// prefetch is set to the number of coalesced ranges transferred while waiting for the
+/// first byte of a request.
+///
+/// This class is thread-safe.
+class ARROW_EXPORT AdaptiveCacheTuner {
+ public:
+  static constexpr double kDefaultSmoothingFactor = 0.1;
+  static constexpr int64_t kDefaultMaxPrefetchLimit = 16;
+
+  /// \brief The current estimates
+  struct Metrics {
+    /// The number of reads recorded
+    int64_t num_reads = 0;
+    /// The estimated time to first byte in seconds, 0 if not estimated yet
+    double time_to_first_byte_sec = 0;
+    /// The estimated transfer bandwidth in bytes per second, 0 if not estimated yet
+    double bandwidth_bytes_per_sec = 0;
+
+    bool estimated() const { return bandwidth_bytes_per_sec > 0; }
+  };
+
+  /// \param[in] smoothing_factor The weight of each new sample in the history,
+  ///   between 0 (exclusive) and 1 (inclusive).
+  /// \param[in] ideal_bandwidth_utilization_frac See
+  ///   CacheOptions::MakeFromNetworkMetrics.
+  /// \param[in] max_ideal_request_size_mib See CacheOptions::MakeFromNetworkMetrics.
+  /// \param[in] max_prefetch_limit The maximum prefetch limit chosen.
+  explicit AdaptiveCacheTuner(
+      double smoothing_factor = kDefaultSmoothingFactor,
+      double ideal_bandwidth_utilization_frac =
+          CacheOptions::kDefaultIdealBandwidthUtilizationFrac,
+      int64_t max_ideal_request_size_mib = CacheOptions::kDefaultMaxIdealRequestSizeMib,
+      int64_t max_prefetch_limit = kDefaultMaxPrefetchLimit);
+
+  /// \brief Record the duration of a read of `nbytes` bytes.
+  void RecordRead(int64_t nbytes, double duration_sec);
+
+  /// \brief Return the current estimates.
+  Metrics metrics() const;
+
+  /// \brief Return the options to use instead of `base_options`.
+  ///
+  /// The base options are returned unchanged until the metrics are estimated.
+  /// The `lazy` flag is never changed, and the prefetch limit is only changed if
+  /// `base_options` has a non-zero prefetch_limit and is lazy.
+  CacheOptions Tune(const CacheOptions& base_options) const;
+
+ private:
+  const double smoothing_factor_;
+  const double ideal_bandwidth_utilization_frac_;
+  const int64_t max_ideal_request_size_mib_;
+  const int64_t max_prefetch_limit_;
+
+  mutable std::mutex mutex_;
+  int64_t num_reads_ = 0;
+  // Exponentially weighted moments of the read sizes (x) and durations (y)
+  double mean_x_ = 0;
+  double mean_y_ = 0;
+  double mean_xx_ = 0;
+  double mean_xy_ = 0;
+  Metrics metrics_;
+};
+
 namespace internal {
 
 /// \brief A read cache designed to hide IO latencies when reading.
@@ -142,9 +239,13 @@ class ARROW_EXPORT ReadRangeCache {
   /// \brief Wait until all given ranges have been cached.
   Future<> WaitFor(std::vector<ReadRange> ranges);
 
+  /// \brief The options in effect, as last chosen by CacheOptions::tuner if any.
+  CacheOptions options() const;
+
  protected:
   struct Impl;
   struct LazyImpl;
+  struct BoundedImpl;
 
   ReadRangeCache(std::shared_ptr<RandomAccessFile> owned_file, RandomAccessFile* file,
                  IOContext ctx, CacheOptions options);
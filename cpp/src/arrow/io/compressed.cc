@@ -19,17 +19,21 @@
 
 #include <algorithm>
 #include <cstring>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/io/util_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -227,6 +231,83 @@ std::shared_ptr<OutputStream> CompressedOutputStream::raw() const { return impl_
 // ----------------------------------------------------------------------
 // CompressedInputStream implementation
 
+namespace {
+
+// The decompressors shared by the frames decompressed in parallel
+struct DecompressorPool {
+  std::shared_ptr<Decompressor> Take() {
+    std::lock_guard<std::mutex> lock(mutex);
+    DCHECK(!decompressors.empty());
+    auto decompressor = std::move(decompressors.back());
+    decompressors.pop_back();
+    return decompressor;
+  }
+
+  void Put(std::shared_ptr<Decompressor> decompressor) {
+    std::lock_guard<std::mutex> lock(mutex);
+    decompressors.push_back(std::move(decompressor));
+  }
+
+  std::mutex mutex;
+  std::vector<std::shared_ptr<Decompressor>> decompressors;
+};
+
+constexpr int64_t kMinFrameOutputSize = 1024 * 1024;
+
+Result<std::shared_ptr<ResizableBuffer>> DecompressFrame(Decompressor* decompressor,
+                                                         const Buffer& frame,
+                                                         MemoryPool* pool) {
+  RETURN_NOT_OK(decompressor->Reset());
+  ARROW_ASSIGN_OR_RAISE(
+      auto decompressed,
+      AllocateResizableBuffer(std::max(kMinFrameOutputSize, 4 * frame.size()), pool));
+  int64_t input_pos = 0;
+  int64_t output_pos = 0;
+  while (!decompressor->IsFinished()) {
+    if (output_pos == decompressed->size()) {
+      RETURN_NOT_OK(decompressed->Resize(2 * decompressed->size()));
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        auto result,
+        decompressor->Decompress(frame.size() - input_pos, frame.data() + input_pos,
+                                 decompressed->size() - output_pos,
+                                 decompressed->mutable_data() + output_pos));
+    input_pos += result.bytes_read;
+    output_pos += result.bytes_written;
+    if (result.bytes_read == 0 && result.bytes_written == 0) {
+      if (input_pos == frame.size() || !result.need_more_output) {
+        return Status::IOError("Truncated compressed stream");
+      }
+      RETURN_NOT_OK(decompressed->Resize(2 * decompressed->size()));
+    }
+  }
+  if (input_pos != frame.size()) {
+    return Status::IOError("Compressed frame has trailing data");
+  }
+  RETURN_NOT_OK(decompressed->Resize(output_pos));
+  return decompressed;
+}
+
+using FrameFuture = Future<std::shared_ptr<ResizableBuffer>>;
+
+FrameFuture DecompressFrameAsync(::arrow::internal::Executor* executor,
+                                 std::shared_ptr<DecompressorPool> decompressors,
+                                 std::shared_ptr<Buffer> frame, MemoryPool* pool) {
+  auto task = [decompressors = std::move(decompressors), frame = std::move(frame),
+               pool]() -> Result<std::shared_ptr<ResizableBuffer>> {
+    auto decompressor = decompressors->Take();
+    auto result = DecompressFrame(decompressor.get(), *frame, pool);
+    decompressors->Put(std::move(decompressor));
+    return result;
+  };
+  if (executor == nullptr) {
+    return FrameFuture::MakeFinished(task());
+  }
+  return DeferNotOk(executor->Submit(std::move(task)));
+}
+
+}  // namespace
+
 class CompressedInputStream::Impl {
  public:
   Impl(MemoryPool* pool, const std::shared_ptr<InputStream>& raw)
@@ -239,9 +320,21 @@ class CompressedInputStream::Impl {
         fresh_decompressor_(false),
         total_pos_(0) {}
 
-  Status Init(Codec* codec) {
+  Status Init(Codec* codec, const CompressedInputStreamOptions& options) {
     ARROW_ASSIGN_OR_RAISE(decompressor_, codec->MakeDecompressor());
     fresh_decompressor_ = true;
+    if (options.use_threads) {
+      executor_ = ::arrow::internal::GetCpuThreadPool();
+      readahead_frames_ = options.readahead_frames > 0
+                              ? options.readahead_frames
+                              : 2 * executor_->GetCapacity();
+      // One decompressor per frame in flight, plus the frame being read
+      frame_decompressors_ = std::make_shared<DecompressorPool>();
+      for (int32_t i = 0; i <= readahead_frames_; ++i) {
+        ARROW_ASSIGN_OR_RAISE(auto decompressor, codec->MakeDecompressor());
+        frame_decompressors_->decompressors.push_back(std::move(decompressor));
+      }
+    }
     return Status::OK();
   }
 
@@ -355,9 +448,95 @@ class CompressedInputStream::Impl {
     return read_bytes;
   }
 
+  // Return the next frame found in the compressed data, or null if the data left
+  // can't be split into frames.
+  Result<std::shared_ptr<Buffer>> SplitFrame() {
+    while (true) {
+      const int64_t pending_avail = pending_ ? pending_->size() - pending_pos_ : 0;
+      if (pending_avail > 0) {
+        auto maybe_frame_size = decompressor_->FrameCompressedSize(
+            pending_avail, pending_->data() + pending_pos_);
+        if (!maybe_frame_size.ok()) {
+          return nullptr;
+        }
+        if (*maybe_frame_size > 0) {
+          auto frame = SliceBuffer(pending_, pending_pos_, *maybe_frame_size);
+          pending_pos_ += *maybe_frame_size;
+          return frame;
+        }
+      }
+      if (raw_eof_ || pending_avail >= kMaxFrameSize) {
+        // Truncated or oversized frame
+        return nullptr;
+      }
+      // Read at least as much as is pending, so that large frames are only
+      // copied a logarithmic number of times
+      ARROW_ASSIGN_OR_RAISE(auto chunk,
+                            raw_->Read(std::max(kParallelChunkSize, pending_avail)));
+      if (chunk->size() == 0) {
+        raw_eof_ = true;
+      } else if (pending_avail == 0) {
+        pending_ = std::move(chunk);
+        pending_pos_ = 0;
+      } else {
+        ARROW_ASSIGN_OR_RAISE(
+            pending_,
+            ConcatenateBuffers({SliceBuffer(pending_, pending_pos_), chunk}, pool_));
+        pending_pos_ = 0;
+      }
+    }
+  }
+
+  // Keep up to readahead_frames_ frames decompressing on the executor
+  Status SubmitFrames() {
+    // Waiting on a thread of the executor could starve it
+    const bool inline_decompression = executor_->OwnsThisThread();
+    const size_t readahead =
+        inline_decompression ? 1 : static_cast<size_t>(readahead_frames_);
+    while (frames_.size() < readahead) {
+      ARROW_ASSIGN_OR_RAISE(auto frame, SplitFrame());
+      if (frame == nullptr) {
+        break;
+      }
+      frames_.push_back(
+          DecompressFrameAsync(inline_decompression ? nullptr : executor_,
+                               frame_decompressors_, std::move(frame), pool_));
+    }
+    return Status::OK();
+  }
+
+  // Move on to the next frame decompressed in parallel.  Returns false once the
+  // stream can't be split anymore, leaving the rest to the serial decompressor.
+  Result<bool> NextFrame() {
+    if (frames_.empty()) {
+      RETURN_NOT_OK(SubmitFrames());
+    }
+    if (frames_.empty()) {
+      executor_ = nullptr;
+      if (pending_ && pending_pos_ < pending_->size()) {
+        compressed_ = SliceBuffer(pending_, pending_pos_);
+        compressed_pos_ = 0;
+      }
+      pending_.reset();
+      return false;
+    }
+    auto frame = std::move(frames_.front());
+    frames_.pop_front();
+    RETURN_NOT_OK(SubmitFrames());
+    ARROW_ASSIGN_OR_RAISE(decompressed_, frame.result());
+    decompressed_pos_ = 0;
+    return true;
+  }
+
   // Try to feed more data into the decompressed_ buffer.
   // Returns whether there is more data to read.
   Result<bool> RefillDecompressed() {
+    if (executor_ != nullptr) {
+      ARROW_ASSIGN_OR_RAISE(bool has_frame, NextFrame());
+      if (has_frame) {
+        return true;
+      }
+    }
     // First try to read data from the decompressor, unless we haven't read any
     // compressed data yet.
     if (compressed_ && compressed_->size() != 0) {
@@ -431,6 +610,10 @@ class CompressedInputStream::Impl {
   static const int64_t kChunkSize = 64 * 1024;
   // Decompress 1 MB at a time
   static const int64_t kDecompressSize = 1024 * 1024;
+  // Read 4 MB compressed data at a time when splitting frames
+  static constexpr int64_t kParallelChunkSize = 4 * 1024 * 1024;
+  // Streams whose frames are larger than this are decompressed serially
+  static const int64_t kMaxFrameSize = 64 * 1024 * 1024;
 
   MemoryPool* pool_;
   std::shared_ptr<InputStream> raw_;
@@ -451,14 +634,32 @@ class CompressedInputStream::Impl {
   bool fresh_decompressor_;
   // Total number of bytes decompressed
   int64_t total_pos_;
+
+  // Parallel decompression, see CompressedInputStreamOptions.  executor_ is
+  // null once the stream is decompressed serially.
+  ::arrow::internal::Executor* executor_ = nullptr;
+  int32_t readahead_frames_ = 0;
+  std::shared_ptr<DecompressorPool> frame_decompressors_;
+  // Compressed data read from raw_ but not split into frames yet
+  std::shared_ptr<Buffer> pending_;
+  int64_t pending_pos_ = 0;
+  bool raw_eof_ = false;
+  // The frames being decompressed, in stream order
+  std::deque<FrameFuture> frames_;
 };
 
 Result<std::shared_ptr<CompressedInputStream>> CompressedInputStream::Make(
     Codec* codec, const std::shared_ptr<InputStream>& raw, MemoryPool* pool) {
+  return Make(codec, raw, CompressedInputStreamOptions{}, pool);
+}
+
+Result<std::shared_ptr<CompressedInputStream>> CompressedInputStream::Make(
+    Codec* codec, const std::shared_ptr<InputStream>& raw,
+    const CompressedInputStreamOptions& options, MemoryPool* pool) {
   // CAUTION: codec is not owned
   std::shared_ptr<CompressedInputStream> res(new CompressedInputStream);
   res->impl_.reset(new Impl(pool, raw));
-  RETURN_NOT_OK(res->impl_->Init(codec));
+  RETURN_NOT_OK(res->impl_->Init(codec, options));
   return res;
 }
 
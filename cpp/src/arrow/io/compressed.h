@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -79,6 +80,21 @@ class ARROW_EXPORT CompressedOutputStream : public OutputStream {
   std::unique_ptr<Impl> impl_;
 };
 
+/// \brief Options for the parallel decompression of a CompressedInputStream
+struct ARROW_EXPORT CompressedInputStreamOptions {
+  /// \brief Decompress the frames of the stream in parallel on the CPU thread pool
+  ///
+  /// Streams made of several concatenated frames (multi-frame ZSTD, LZ4 frame,
+  /// BGZF gzip) are split on their frame boundaries and the frames decompressed
+  /// ahead of the reader, which still sees them in order.  Other streams, and
+  /// streams read from a CPU thread pool thread, are decompressed serially.
+  bool use_threads = false;
+  /// \brief The maximum number of frames decompressed ahead of the reader
+  ///
+  /// 0 means twice the capacity of the CPU thread pool.
+  int32_t readahead_frames = 0;
+};
+
 class ARROW_EXPORT CompressedInputStream
     : public internal::InputStreamConcurrencyWrapper<CompressedInputStream> {
  public:
@@ -92,6 +108,15 @@ class ARROW_EXPORT CompressedInputStream
       util::Codec* codec, const std::shared_ptr<InputStream>& raw,
       MemoryPool* pool = default_memory_pool());
 
+  /// \brief Create a compressed input stream wrapping the given input stream.
+  ///
+  /// As above, optionally decompressing in parallel.  The codec is only used
+  /// during this call.
+  static Result<std::shared_ptr<CompressedInputStream>> Make(
+      util::Codec* codec, const std::shared_ptr<InputStream>& raw,
+      const CompressedInputStreamOptions& options,
+      MemoryPool* pool = default_memory_pool());
+
   // InputStream interface
 
   bool closed() const override;
@@ -197,4 +197,59 @@ BENCHMARK_TEMPLATE(CompressedInputStreamNonZeroCopyBufferReturnedByCallee,
     ->Apply(CompressedInputArguments);
 #endif
 
+#ifdef ARROW_WITH_ZSTD
+// Read a stream of independently compressed 1 MB frames, like the output of
+// pzstd or bgzip
+static void CompressedInputStreamFrames(::benchmark::State& state,
+                                        Compression::type compression) {
+  const int64_t input_size = 64 * 1024 * 1024;
+  const int64_t frame_size = 1024 * 1024;
+  const bool use_threads = state.range(0) != 0;
+
+  const std::vector<uint8_t> data = MakeCompressibleData(static_cast<int>(input_size));
+  auto codec = ::arrow::util::Codec::Create(compression).ValueOrDie();
+  std::vector<std::shared_ptr<Buffer>> frames;
+  for (int64_t offset = 0; offset < input_size; offset += frame_size) {
+    int64_t max_compress_len = codec->MaxCompressedLen(frame_size, data.data() + offset);
+    std::shared_ptr<::arrow::ResizableBuffer> frame =
+        ::arrow::AllocateResizableBuffer(max_compress_len).ValueOrDie();
+    const int64_t compressed_length =
+        codec
+            ->Compress(frame_size, data.data() + offset, max_compress_len,
+                       frame->mutable_data())
+            .ValueOrDie();
+    ABORT_NOT_OK(frame->Resize(compressed_length));
+    frames.push_back(std::move(frame));
+  }
+  auto buf = ConcatenateBuffers(frames).ValueOrDie();
+
+  CompressedInputStreamOptions options;
+  options.use_threads = use_threads;
+  auto read_buffer = ::arrow::AllocateBuffer(frame_size).ValueOrDie();
+  for (auto _ : state) {
+    auto reader = std::make_shared<::arrow::io::BufferReader>(buf);
+    auto input_stream =
+        ::arrow::io::CompressedInputStream::Make(codec.get(), reader, options)
+            .ValueOrDie();
+    auto remaining_size = input_size;
+    while (remaining_size > 0) {
+      auto value = input_stream->Read(frame_size, read_buffer->mutable_data());
+      ABORT_NOT_OK(value);
+      remaining_size -= value.ValueOrDie();
+    }
+  }
+  state.SetBytesProcessed(input_size * state.iterations());
+}
+
+static void CompressedInputStreamZstdFrames(::benchmark::State& state) {
+  CompressedInputStreamFrames(state, Compression::ZSTD);
+}
+
+BENCHMARK(CompressedInputStreamZstdFrames)
+    ->ArgNames({"use_threads"})
+    ->Arg(0)
+    ->Arg(1)
+    ->UseRealTime();
+#endif
+
 }  // namespace arrow::io
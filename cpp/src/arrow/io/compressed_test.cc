@@ -81,10 +81,12 @@ std::shared_ptr<Buffer> CompressDataOneShot(Codec* codec,
 }
 
 Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed,
-                                int64_t* stream_pos, std::vector<uint8_t>* out) {
+                                int64_t* stream_pos, std::vector<uint8_t>* out,
+                                const CompressedInputStreamOptions& options = {}) {
   // Create compressed input stream
   auto buffer_reader = std::make_shared<BufferReader>(compressed);
-  ARROW_ASSIGN_OR_RAISE(auto stream, CompressedInputStream::Make(codec, buffer_reader));
+  ARROW_ASSIGN_OR_RAISE(auto stream,
+                        CompressedInputStream::Make(codec, buffer_reader, options));
 
   std::vector<uint8_t> decompressed;
   int64_t decompressed_size = 0;
@@ -237,6 +239,81 @@ TEST_P(CompressedInputStreamTest, ConcatenatedStreams) {
   ASSERT_EQ(decompressed, expected);
 }
 
+TEST_P(CompressedInputStreamTest, ParallelDecompression) {
+  auto codec = MakeCodec();
+  CompressedInputStreamOptions options;
+  options.use_threads = true;
+  options.readahead_frames = 3;
+
+  // Frames of various sizes, some of them empty
+  std::vector<std::shared_ptr<Buffer>> frames;
+  std::vector<uint8_t> expected;
+  for (int i = 0; i < 20; ++i) {
+    auto data = (i % 3 == 0) ? MakeRandomData(i * 1000) : MakeCompressibleData(i * 5000);
+    frames.push_back(CompressDataOneShot(codec.get(), data));
+    expected.insert(expected.end(), data.begin(), data.end());
+  }
+  ASSERT_OK_AND_ASSIGN(auto concatenated, ConcatenateBuffers(frames));
+  std::vector<uint8_t> decompressed;
+  int64_t stream_pos = -1;
+  ASSERT_OK(RunCompressedInputStream(codec.get(), concatenated, &stream_pos,
+                                     &decompressed, options));
+  ASSERT_EQ(decompressed, expected);
+  ASSERT_EQ(stream_pos, static_cast<int64_t>(expected.size()));
+
+  // A truncated last frame is detected
+  auto truncated = SliceBuffer(concatenated, 0, concatenated->size() - 3);
+  ASSERT_RAISES(IOError, RunCompressedInputStream(codec.get(), truncated, nullptr,
+                                                  &decompressed, options));
+
+  // So is garbage after valid frames
+  ASSERT_OK_AND_ASSIGN(
+      auto invalid,
+      ConcatenateBuffers({concatenated, Buffer::FromVector(MakeRandomData(100))}));
+  ASSERT_RAISES(IOError, RunCompressedInputStream(codec.get(), invalid, nullptr,
+                                                  &decompressed, options));
+}
+
+#ifdef ARROW_WITH_ZLIB
+TEST(TestGZipInputStream, ParallelBgzfDecompression) {
+  // Turn gzip members into BGZF blocks by adding a "BC" extra subfield holding
+  // the block size to their header
+  auto make_bgzf_block = [](const Buffer& member) {
+    constexpr int kHeaderSize = 10;
+    std::vector<uint8_t> block(member.data(), member.data() + kHeaderSize);
+    block[3] |= 0x04;
+    const int64_t block_size = member.size() + 8;
+    block.insert(block.end(), {6, 0, 'B', 'C', 2, 0,
+                               static_cast<uint8_t>((block_size - 1) & 0xff),
+                               static_cast<uint8_t>((block_size - 1) >> 8)});
+    block.insert(block.end(), member.data() + kHeaderSize, member.data() + member.size());
+    return Buffer::FromVector(std::move(block));
+  };
+
+  auto codec = *Codec::Create(Compression::GZIP);
+  std::vector<std::shared_ptr<Buffer>> blocks;
+  std::vector<uint8_t> expected;
+  for (int i = 0; i < 10; ++i) {
+    auto data = MakeCompressibleData(10000 + i * 1000);
+    blocks.push_back(make_bgzf_block(*CompressDataOneShot(codec.get(), data)));
+    expected.insert(expected.end(), data.begin(), data.end());
+  }
+  ASSERT_OK_AND_ASSIGN(auto concatenated, ConcatenateBuffers(blocks));
+
+  CompressedInputStreamOptions options;
+  options.use_threads = true;
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(RunCompressedInputStream(codec.get(), concatenated, nullptr, &decompressed,
+                                     options));
+  ASSERT_EQ(decompressed, expected);
+
+  // Check the split on the BGZF block sizes
+  ASSERT_OK_AND_ASSIGN(auto decompressor, codec->MakeDecompressor());
+  ASSERT_OK_AND_EQ(blocks[0]->size(), decompressor->FrameCompressedSize(
+                                          concatenated->size(), concatenated->data()));
+}
+#endif
+
 TEST_P(CompressedOutputStreamTest, CompressibleData) {
   auto codec = MakeCodec();
   auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
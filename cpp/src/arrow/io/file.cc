@@ -48,14 +48,19 @@
 
 #include "arrow/io/file.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/io/uring_internal.h"
 #include "arrow/io/util_internal.h"
 
 #include "arrow/buffer.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/metrics.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -215,6 +220,41 @@ class OSFile {
 // ----------------------------------------------------------------------
 // ReadableFile implementation
 
+namespace {
+
+// Read from a file opened with O_DIRECT.  Reads must stay aligned, so unlike
+// FileReadAt(), a read returning a partial block is taken as the end of file.
+Result<int64_t> DirectReadAt(int fd, uint8_t* buffer, int64_t position, int64_t nbytes,
+                             int64_t alignment) {
+#ifdef _WIN32
+  return Status::NotImplemented("Direct IO is not supported on Windows");
+#else
+  int64_t bytes_read = 0;
+  while (bytes_read < nbytes) {
+    int64_t chunksize = std::min<int64_t>(
+        bit_util::RoundDown(std::numeric_limits<int32_t>::max(), alignment),
+        nbytes - bytes_read);
+    int64_t ret = static_cast<int64_t>(
+        pread(fd, buffer + bytes_read, static_cast<size_t>(chunksize),
+              static_cast<off_t>(position + bytes_read)));
+    if (ret == -1 && errno == EINTR) {
+      continue;
+    }
+    if (ret == -1) {
+      return IOErrorFromErrno(errno, "Error reading bytes from file");
+    }
+    bytes_read += ret;
+    if (ret == 0 || ret % alignment != 0) {
+      // EOF
+      break;
+    }
+  }
+  return bytes_read;
+#endif
+}
+
+}  // namespace
+
 class ReadableFile::ReadableFileImpl : public OSFile {
  public:
   explicit ReadableFileImpl(MemoryPool* pool) : OSFile(), pool_(pool) {}
@@ -222,7 +262,52 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   Status Open(const std::string& path) { return OpenReadable(path); }
   Status Open(int fd) { return OpenReadable(fd); }
 
+  Status Open(const std::string& path, const ReadableFileOptions& options) {
+    RETURN_NOT_OK(OpenReadable(path));
+    io_uring_ = options.io_uring;
+    if (options.direct_io) {
+      EnableDirectIO();
+    }
+    return Status::OK();
+  }
+
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const std::vector<ReadRange>& ranges) {
+    DCHECK_NE(io_uring_, nullptr);
+    Status st = CheckClosed();
+    if (!st.ok()) {
+      return std::vector<Future<std::shared_ptr<Buffer>>>(
+          ranges.size(), Future<std::shared_ptr<Buffer>>::MakeFinished(st));
+    }
+    return io_uring_->ReadMany(fd_.fd(), ranges, pool_, alignment_);
+  }
+
+  bool has_io_uring() const { return io_uring_ != nullptr; }
+
+  bool direct_io() const { return direct_io_; }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) {
+    if (alignment_ == 0) {
+      return OSFile::Read(nbytes, out);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAlignedBuffer(nbytes));
+    std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+    return buffer->size();
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) {
+    if (alignment_ == 0) {
+      return OSFile::ReadAt(position, nbytes, out);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAlignedBufferAt(position, nbytes));
+    std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+    return buffer->size();
+  }
+
   Result<std::shared_ptr<Buffer>> ReadBuffer(int64_t nbytes) {
+    if (alignment_ != 0) {
+      return ReadAlignedBuffer(nbytes);
+    }
     ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
 
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, Read(nbytes, buffer->mutable_data()));
@@ -235,6 +320,9 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   }
 
   Result<std::shared_ptr<Buffer>> ReadBufferAt(int64_t position, int64_t nbytes) {
+    if (alignment_ != 0) {
+      return ReadAlignedBufferAt(position, nbytes);
+    }
     ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
 
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
@@ -267,6 +355,10 @@ class ReadableFile::ReadableFileImpl : public OSFile {
     RETURN_NOT_OK(CheckClosed());
     for (const auto& range : ranges) {
       RETURN_NOT_OK(internal::ValidateRange(range.offset, range.length));
+      if (direct_io_) {
+        // Prefetching into the page cache would defeat the purpose of direct IO
+        continue;
+      }
 #if defined(POSIX_FADV_WILLNEED)
       int ret = posix_fadvise(fd_.fd(), range.offset, range.length, POSIX_FADV_WILLNEED);
       if (ret) {
@@ -288,7 +380,58 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   }
 
  private:
+  // Try to bypass the page cache, keeping regular reads if that is not supported
+  void EnableDirectIO() {
+#if defined(O_DIRECT)
+    const int flags = fcntl(fd_.fd(), F_GETFL);
+    if (flags != -1 && fcntl(fd_.fd(), F_SETFL, flags | O_DIRECT) == 0) {
+      direct_io_ = true;
+      alignment_ = kDirectIOAlignment;
+    }
+#elif defined(F_NOCACHE)
+    // F_NOCACHE doesn't constrain the alignment of reads
+    direct_io_ = fcntl(fd_.fd(), F_NOCACHE, 1) != -1;
+#endif
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadAlignedBuffer(int64_t nbytes) {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPositioned());
+    ARROW_ASSIGN_OR_RAISE(int64_t position, Tell());
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAligned(position, nbytes));
+    RETURN_NOT_OK(::arrow::internal::FileSeek(fd_.fd(), position + buffer->size()));
+    return buffer;
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadAlignedBufferAt(int64_t position, int64_t nbytes) {
+    RETURN_NOT_OK(CheckClosed());
+    // As in ReadAt(), leave the file position undefined
+    need_seeking_.store(true);
+    return ReadAligned(position, nbytes);
+  }
+
+  // Read the aligned blocks covering the given range, and return the range as a
+  // slice of them
+  Result<std::shared_ptr<Buffer>> ReadAligned(int64_t position, int64_t nbytes) {
+    RETURN_NOT_OK(internal::ValidateRange(position, nbytes));
+    const int64_t aligned_start = bit_util::RoundDown(position, alignment_);
+    const int64_t aligned_end = bit_util::RoundUp(position + nbytes, alignment_);
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer,
+                          AllocateBuffer(aligned_end - aligned_start, alignment_, pool_));
+    ARROW_ASSIGN_OR_RAISE(
+        int64_t bytes_read,
+        DirectReadAt(fd_.fd(), buffer->mutable_data(), aligned_start,
+                     aligned_end - aligned_start, alignment_));
+    const int64_t offset = position - aligned_start;
+    return SliceBuffer(std::move(buffer), offset,
+                       std::clamp<int64_t>(bytes_read - offset, 0, nbytes));
+  }
+
   MemoryPool* pool_;
+  std::shared_ptr<internal::IoUring> io_uring_;
+  bool direct_io_ = false;
+  // Alignment required by direct IO, or 0 if reads are not constrained
+  int64_t alignment_ = 0;
 };
 
 ReadableFile::ReadableFile(MemoryPool* pool) { impl_.reset(new ReadableFileImpl(pool)); }
@@ -308,6 +451,13 @@ Result<std::shared_ptr<ReadableFile>> ReadableFile::Open(int fd, MemoryPool* poo
   return file;
 }
 
+Result<std::shared_ptr<ReadableFile>> ReadableFile::Open(
+    const std::string& path, MemoryPool* pool, const ReadableFileOptions& options) {
+  auto file = std::shared_ptr<ReadableFile>(new ReadableFile(pool));
+  RETURN_NOT_OK(file->impl_->Open(path, options));
+  return file;
+}
+
 Status ReadableFile::DoClose() { return impl_->Close(); }
 
 bool ReadableFile::closed() const { return !impl_->is_open(); }
@@ -318,20 +468,42 @@ Status ReadableFile::WillNeed(const std::vector<ReadRange>& ranges) {
 
 Result<int64_t> ReadableFile::DoTell() const { return impl_->Tell(); }
 
+namespace {
+
+// Count a read request to a local file and the bytes it returned
+void RecordLocalRead(int64_t bytes_read) {
+  static util::Counter* requests =
+      util::MetricsRegistry::Global()->GetCounter("fs.local.requests");
+  static util::Counter* bytes =
+      util::MetricsRegistry::Global()->GetCounter("fs.local.bytes_read");
+  requests->Add();
+  bytes->Add(bytes_read);
+}
+
+}  // namespace
+
 Result<int64_t> ReadableFile::DoRead(int64_t nbytes, void* out) {
-  return impl_->Read(nbytes, out);
+  ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, impl_->Read(nbytes, out));
+  RecordLocalRead(bytes_read);
+  return bytes_read;
 }
 
 Result<int64_t> ReadableFile::DoReadAt(int64_t position, int64_t nbytes, void* out) {
-  return impl_->ReadAt(position, nbytes, out);
+  ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, impl_->ReadAt(position, nbytes, out));
+  RecordLocalRead(bytes_read);
+  return bytes_read;
 }
 
 Result<std::shared_ptr<Buffer>> ReadableFile::DoReadAt(int64_t position, int64_t nbytes) {
-  return impl_->ReadBufferAt(position, nbytes);
+  ARROW_ASSIGN_OR_RAISE(auto buffer, impl_->ReadBufferAt(position, nbytes));
+  RecordLocalRead(buffer->size());
+  return buffer;
 }
 
 Result<std::shared_ptr<Buffer>> ReadableFile::DoRead(int64_t nbytes) {
-  return impl_->ReadBuffer(nbytes);
+  ARROW_ASSIGN_OR_RAISE(auto buffer, impl_->ReadBuffer(nbytes));
+  RecordLocalRead(buffer->size());
+  return buffer;
 }
 
 Result<int64_t> ReadableFile::DoGetSize() { return impl_->size(); }
@@ -340,6 +512,33 @@ Status ReadableFile::DoSeek(int64_t pos) { return impl_->Seek(pos); }
 
 int ReadableFile::file_descriptor() const { return impl_->fd(); }
 
+bool ReadableFile::direct_io() const { return impl_->direct_io(); }
+
+Future<std::shared_ptr<Buffer>> ReadableFile::ReadAsync(const IOContext& ctx,
+                                                        int64_t position,
+                                                        int64_t nbytes) {
+  if (!impl_->has_io_uring()) {
+    return RandomAccessFile::ReadAsync(ctx, position, nbytes);
+  }
+  return ReadManyAsync(ctx, {{position, nbytes}})[0];
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> ReadableFile::ReadManyAsync(
+    const IOContext& ctx, const std::vector<ReadRange>& ranges) {
+  if (!impl_->has_io_uring()) {
+    return RandomAccessFile::ReadManyAsync(ctx, ranges);
+  }
+  auto futures = impl_->ReadManyAsync(ranges);
+  auto self = shared_from_this();
+  for (auto& future : futures) {
+    // Keep the file open until the read completes
+    future.AddCallback([self](const Result<std::shared_ptr<Buffer>>&) {});
+    // The io_uring completion thread must not run the caller's continuations
+    future = ctx.executor()->Transfer(std::move(future));
+  }
+  return futures;
+}
+
 // ----------------------------------------------------------------------
 // FileOutputStream
 
@@ -36,6 +36,12 @@ class Status;
 
 namespace io {
 
+namespace internal {
+
+class IoUring;
+
+}  // namespace internal
+
 /// \brief An operating system file open in write-only mode.
 class ARROW_EXPORT FileOutputStream : public OutputStream {
  public:
@@ -80,6 +86,24 @@ class ARROW_EXPORT FileOutputStream : public OutputStream {
   std::unique_ptr<FileOutputStreamImpl> impl_;
 };
 
+/// \brief Options for opening a ReadableFile
+struct ARROW_EXPORT ReadableFileOptions {
+  /// \brief Whether to bypass the OS page cache, where supported
+  ///
+  /// This avoids large one-shot scans evicting the working set of other
+  /// processes from the page cache.  On Linux, the file is opened with
+  /// O_DIRECT: reads are widened to ReadableFile::kDirectIOAlignment boundaries,
+  /// into buffers allocated from the MemoryPool with that alignment, and the
+  /// requested ranges are returned as zero-copy slices of these buffers.
+  /// On macOS, F_NOCACHE is used instead.  If the platform or the filesystem
+  /// does not support it, regular reads are used, see ReadableFile::direct_io().
+  bool direct_io = false;
+
+  /// \brief The io_uring serving ReadAsync() and ReadManyAsync(), or null
+  /// to issue them on the IO thread pool
+  std::shared_ptr<internal::IoUring> io_uring;
+};
+
 /// \brief An operating system file open in read-only mode.
 ///
 /// Reads through this implementation are unbuffered.  If many small reads
@@ -107,12 +131,42 @@ class ARROW_EXPORT ReadableFile
   static Result<std::shared_ptr<ReadableFile>> Open(
       int fd, MemoryPool* pool = default_memory_pool());
 
+  /// \brief Open a local file for reading
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] pool a MemoryPool for memory allocations
+  /// \param[in] options how to read the file
+  /// \return ReadableFile instance
+  static Result<std::shared_ptr<ReadableFile>> Open(const std::string& path,
+                                                    MemoryPool* pool,
+                                                    const ReadableFileOptions& options);
+
+  /// The alignment of file offsets, lengths and buffers for direct IO
+  static constexpr int64_t kDirectIOAlignment = 4096;
+
   bool closed() const override;
 
   int file_descriptor() const;
 
+  /// \brief Whether reads bypass the OS page cache
+  bool direct_io() const;
+
   Status WillNeed(const std::vector<ReadRange>& ranges) override;
 
+  /// \cond FALSE
+  using RandomAccessFile::ReadAsync;
+  using RandomAccessFile::ReadManyAsync;
+  /// \endcond
+
+  /// \brief Read asynchronously, without blocking an IO thread if an io_uring is used
+  Future<std::shared_ptr<Buffer>> ReadAsync(const IOContext&, int64_t position,
+                                            int64_t nbytes) override;
+
+  /// \brief Read many ranges asynchronously
+  ///
+  /// If an io_uring is used, all ranges are submitted to the kernel at once.
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const IOContext&, const std::vector<ReadRange>& ranges) override;
+
  private:
   friend RandomAccessFileConcurrencyWrapper<ReadableFile>;
 
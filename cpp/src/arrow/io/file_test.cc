@@ -20,7 +20,9 @@
 #  include <unistd.h>
 #endif
 
+#include <algorithm>
 #include <atomic>
+#include <cerrno>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
@@ -28,6 +30,7 @@
 #include <fstream>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <thread>
 #include <vector>
 
@@ -38,6 +41,7 @@
 #include "arrow/io/interfaces.h"
 #include "arrow/io/stdio.h"
 #include "arrow/io/test_common.h"
+#include "arrow/io/uring_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
@@ -423,6 +427,150 @@ TEST_F(TestReadableFile, ReadManyAsync) {
   AssertBufferEqual(*buf3, "da");
 }
 
+TEST_F(TestReadableFile, ReadManyAsyncIoUring) {
+  if (!internal::IoUring::IsSupported()) {
+    GTEST_SKIP() << "io_uring not supported";
+  }
+  MakeTestFile();
+  // A small queue depth so that submissions wait for completions
+  ReadableFileOptions options;
+  ASSERT_OK_AND_ASSIGN(options.io_uring, internal::IoUring::Make(/*queue_depth=*/2));
+  ASSERT_OK_AND_ASSIGN(file_, ReadableFile::Open(path_, default_memory_pool(), options));
+  options.io_uring.reset();
+
+  ASSERT_OK_AND_ASSIGN(auto buf, file_->ReadAsync({}, 1, 10).result());
+  AssertBufferEqual(*buf, "estdata");
+
+  std::vector<ReadRange> ranges;
+  for (int i = 0; i < 100; ++i) {
+    ranges.push_back({i % 8, 3});
+  }
+  ranges.push_back({8, 2});
+  ranges.push_back({2, 0});
+  auto futs = file_->ReadManyAsync(ranges);
+  ASSERT_EQ(futs.size(), ranges.size());
+  const std::string data = "testdata";
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_OK_AND_ASSIGN(buf, futs[i].result());
+    AssertBufferEqual(*buf, data.substr(i % 8, 3));
+  }
+  ASSERT_OK_AND_ASSIGN(buf, futs[100].result());
+  AssertBufferEqual(*buf, "");
+  ASSERT_OK_AND_ASSIGN(buf, futs[101].result());
+  AssertBufferEqual(*buf, "");
+
+  ASSERT_RAISES(Invalid, file_->ReadAsync({}, -1, 1).result());
+
+  ASSERT_OK(file_->Close());
+  ASSERT_RAISES(Invalid, file_->ReadAsync({}, 0, 4).result());
+}
+
+TEST_F(TestReadableFile, IoUringTransientCompletion) {
+  if (!internal::IoUring::IsSupported()) {
+    GTEST_SKIP() << "io_uring not supported";
+  }
+  constexpr int64_t kAlignment = ReadableFile::kDirectIOAlignment;
+  const int64_t file_size = 3 * kAlignment + 100;
+  std::string data(file_size, '\0');
+  random_bytes(file_size, 0, reinterpret_cast<uint8_t*>(data.data()));
+  {
+    std::ofstream stream(path_.c_str(), std::ios::binary);
+    stream << data;
+  }
+  ASSERT_OK_AND_ASSIGN(file_, ReadableFile::Open(path_));
+  ASSERT_OK_AND_ASSIGN(auto ring, internal::IoUring::Make());
+  const int fd = file_->file_descriptor();
+
+  // Interrupted reads are retried, also when they are aligned
+  for (int errnum : {EAGAIN, EINTR, EBUSY}) {
+    ARROW_SCOPED_TRACE("errnum = ", errnum);
+    for (int64_t alignment : {int64_t{0}, kAlignment}) {
+      ARROW_SCOPED_TRACE("alignment = ", alignment);
+      ring->InjectResultsForTesting(-errnum, /*count=*/2);
+      auto fut = ring->Read(fd, 10, file_size, default_memory_pool(), alignment);
+      ASSERT_OK_AND_ASSIGN(auto buf, fut.result());
+      AssertBufferEqual(*buf, std::string_view(data).substr(10));
+    }
+  }
+
+  ring->InjectResultsForTesting(-EIO, /*count=*/1);
+  ASSERT_RAISES(IOError,
+                ring->Read(fd, 0, 10, default_memory_pool(), kAlignment).result());
+}
+
+TEST_F(TestReadableFile, DirectIO) {
+  // Not a multiple of the alignment, so that the last block is partial
+  const int64_t file_size = 3 * ReadableFile::kDirectIOAlignment + 100;
+  std::string data(file_size, '\0');
+  random_bytes(file_size, 0, reinterpret_cast<uint8_t*>(data.data()));
+  {
+    std::ofstream stream(path_.c_str(), std::ios::binary);
+    stream << data;
+  }
+
+  ReadableFileOptions options;
+  options.direct_io = true;
+  if (internal::IoUring::IsSupported()) {
+    ASSERT_OK_AND_ASSIGN(options.io_uring, internal::IoUring::Make());
+  }
+  ASSERT_OK_AND_ASSIGN(file_, ReadableFile::Open(path_, default_memory_pool(), options));
+  if (!file_->direct_io()) {
+    GTEST_SKIP() << "direct I/O not supported on this file system";
+  }
+  ASSERT_OK_AND_EQ(file_size, file_->GetSize());
+
+  auto check_range = [&](int64_t position, int64_t nbytes) {
+    ARROW_SCOPED_TRACE("position = ", position, ", nbytes = ", nbytes);
+    const int64_t expected_size = std::max<int64_t>(
+        0, std::min<int64_t>(nbytes, file_size - std::min(position, file_size)));
+    const auto expected = std::string_view(data).substr(
+        std::min(position, file_size), static_cast<size_t>(expected_size));
+    ASSERT_OK_AND_ASSIGN(auto buf, file_->ReadAt(position, nbytes));
+    AssertBufferEqual(*buf, expected);
+    ASSERT_OK_AND_ASSIGN(buf, file_->ReadAsync({}, position, nbytes).result());
+    AssertBufferEqual(*buf, expected);
+    std::string out(static_cast<size_t>(nbytes), '\0');
+    ASSERT_OK_AND_EQ(expected_size, file_->ReadAt(position, nbytes, out.data()));
+    ASSERT_EQ(std::string_view(out).substr(0, expected_size), expected);
+  };
+  check_range(0, 10);
+  check_range(1, 4096);
+  check_range(4095, 2);
+  check_range(4096, 4096);
+  check_range(5000, 3 * 4096);
+  check_range(file_size - 1, 1);
+  check_range(file_size, 10);
+  check_range(file_size + 5000, 10);
+  check_range(123, 0);
+
+  // Coalesced ranges are sliced out of aligned reads
+  std::vector<ReadRange> ranges = {{0, 10}, {10, 5000}, {8000, 100}, {12000, 500}};
+  auto futs = file_->ReadManyAsync(ranges);
+  ASSERT_EQ(futs.size(), ranges.size());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto buf, futs[i].result());
+    const int64_t expected_size =
+        std::min(ranges[i].length, file_size - ranges[i].offset);
+    AssertBufferEqual(*buf, std::string_view(data).substr(ranges[i].offset,
+                                                          expected_size));
+  }
+
+  // Sequential reads keep track of the unaligned file position
+  ASSERT_OK(file_->Seek(0));
+  ASSERT_OK_AND_ASSIGN(auto buf, file_->Read(7));
+  AssertBufferEqual(*buf, std::string_view(data).substr(0, 7));
+  ASSERT_OK_AND_ASSIGN(buf, file_->Read(2 * ReadableFile::kDirectIOAlignment));
+  AssertBufferEqual(*buf, std::string_view(data).substr(
+                              7, 2 * ReadableFile::kDirectIOAlignment));
+  ASSERT_OK_AND_EQ(7 + 2 * ReadableFile::kDirectIOAlignment, file_->Tell());
+  ASSERT_OK_AND_ASSIGN(buf, file_->Read(file_size));
+  AssertBufferEqual(*buf, std::string_view(data).substr(
+                              7 + 2 * ReadableFile::kDirectIOAlignment));
+  ASSERT_OK_AND_EQ(file_size, file_->Tell());
+
+  ASSERT_OK(file_->Close());
+}
+
 TEST_F(TestReadableFile, SeekingRequired) {
   MakeTestFile();
   OpenFile();
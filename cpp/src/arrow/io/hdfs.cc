@@ -22,6 +22,7 @@
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -118,7 +119,8 @@ Status GetPathInfoFailed(const std::string& path) {
 // Private implementation for read-only files
 class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
  public:
-  explicit HdfsReadableFileImpl(MemoryPool* pool) : pool_(pool) {}
+  explicit HdfsReadableFileImpl(const io::IOContext& io_context)
+      : io_context_(io_context), pool_(io_context.pool()) {}
 
   Status Close() {
     if (is_open_) {
@@ -127,8 +129,13 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
       // the error doesn't get propagated properly and the second close
       // initiated by the destructor raises a segfault
       is_open_ = false;
-      int ret = driver_->CloseFile(fs_, file_);
-      CHECK_FAILURE(ret, "CloseFile");
+      std::lock_guard<std::mutex> guard(lock_);
+      if (num_zero_copy_buffers_ > 0) {
+        // The zero-copy buffers must be released to the open file
+        close_pending_ = true;
+        return Status::OK();
+      }
+      return CloseFile();
     }
     return Status::OK();
   }
@@ -162,9 +169,14 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
     return total_bytes;
   }
 
-  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) {
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes,
+                                         FileInterface* owner) {
     RETURN_NOT_OK(CheckClosed());
 
+    ARROW_ASSIGN_OR_RAISE(auto zero_copy_buffer, ReadZeroCopy(position, nbytes, owner));
+    if (zero_copy_buffer) {
+      return zero_copy_buffer;
+    }
     ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
                           ReadAt(position, nbytes, buffer->mutable_data()));
@@ -193,9 +205,14 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
     return total_bytes;
   }
 
-  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) {
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes, FileInterface* owner) {
     RETURN_NOT_OK(CheckClosed());
 
+    ARROW_ASSIGN_OR_RAISE(auto zero_copy_buffer,
+                          ReadZeroCopy(/*position=*/std::nullopt, nbytes, owner));
+    if (zero_copy_buffer) {
+      return zero_copy_buffer;
+    }
     ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, Read(nbytes, buffer->mutable_data()));
     if (bytes_read < nbytes) {
@@ -217,17 +234,112 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
     return size;
   }
 
-  void set_memory_pool(MemoryPool* pool) { pool_ = pool; }
-
   void set_buffer_size(int32_t buffer_size) { buffer_size_ = buffer_size; }
 
+  void EnableZeroCopy(bool skip_checksum) {
+    if (!driver_->HasReadZero()) {
+      return;
+    }
+    zero_copy_options_ = driver_->RzOptionsAlloc();
+    if (zero_copy_options_ != nullptr &&
+        driver_->RzOptionsSetSkipChecksum(zero_copy_options_, skip_checksum) != 0) {
+      driver_->RzOptionsFree(zero_copy_options_);
+      zero_copy_options_ = nullptr;
+    }
+  }
+
+  bool supports_zero_copy() const { return zero_copy_options_ != nullptr; }
+
+  const io::IOContext& io_context() const { return io_context_; }
+
  private:
+  // Block data memory-mapped by libhdfs, released when the buffer is destroyed
+  class ZeroCopyBuffer : public Buffer {
+   public:
+    ZeroCopyBuffer(const void* data, int64_t size, hadoopRzBuffer* rz_buffer,
+                   HdfsReadableFileImpl* impl, std::shared_ptr<FileInterface> owner)
+        : Buffer(static_cast<const uint8_t*>(data), size),
+          rz_buffer_(rz_buffer),
+          impl_(impl),
+          owner_(std::move(owner)) {}
+
+    ~ZeroCopyBuffer() override { impl_->ReleaseZeroCopyBuffer(rz_buffer_); }
+
+   private:
+    hadoopRzBuffer* rz_buffer_;
+    HdfsReadableFileImpl* impl_;
+    // Keeps impl_ alive
+    std::shared_ptr<FileInterface> owner_;
+  };
+
+  // Read nbytes at position, or at the current position, without copying them.
+  // Returns null when the range cannot be memory-mapped.
+  Result<std::shared_ptr<Buffer>> ReadZeroCopy(std::optional<int64_t> position,
+                                               int64_t nbytes, FileInterface* owner) {
+    if (zero_copy_options_ == nullptr || nbytes <= 0 ||
+        nbytes > std::numeric_limits<int32_t>::max()) {
+      return nullptr;
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    if (position.has_value()) {
+      RETURN_NOT_OK(Seek(*position));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(position, Tell());
+    }
+    errno = 0;
+    hadoopRzBuffer* rz_buffer =
+        driver_->ReadZero(file_, zero_copy_options_, static_cast<int32_t>(nbytes));
+    if (rz_buffer == nullptr) {
+      if (errno == EPROTONOSUPPORT) {
+        // Not a short-circuit local read, or checksums are needed
+        return nullptr;
+      }
+      return IOErrorFromErrno(errno, "HDFS zero-copy read failed");
+    }
+    const void* data = driver_->RzBufferGet(rz_buffer);
+    const int32_t length = driver_->RzBufferLength(rz_buffer);
+    if (data == nullptr || length < nbytes) {
+      // EOF, or the range spans several blocks: copy it instead
+      driver_->RzBufferFree(file_, rz_buffer);
+      RETURN_NOT_OK(Seek(*position));
+      return nullptr;
+    }
+    ++num_zero_copy_buffers_;
+    return std::make_shared<ZeroCopyBuffer>(data, length, rz_buffer, this,
+                                            owner->shared_from_this());
+  }
+
+  void ReleaseZeroCopyBuffer(hadoopRzBuffer* rz_buffer) {
+    std::lock_guard<std::mutex> guard(lock_);
+    driver_->RzBufferFree(file_, rz_buffer);
+    if (--num_zero_copy_buffers_ == 0 && close_pending_) {
+      close_pending_ = false;
+      ARROW_WARN_NOT_OK(CloseFile(), "Failed to close HdfsReadableFile");
+    }
+  }
+
+  Status CloseFile() {
+    if (zero_copy_options_ != nullptr) {
+      driver_->RzOptionsFree(zero_copy_options_);
+      zero_copy_options_ = nullptr;
+    }
+    int ret = driver_->CloseFile(fs_, file_);
+    CHECK_FAILURE(ret, "CloseFile");
+    return Status::OK();
+  }
+
+  io::IOContext io_context_;
   MemoryPool* pool_;
   int32_t buffer_size_;
+
+  hadoopRzOptions* zero_copy_options_ = nullptr;
+  // Protected by lock_
+  int64_t num_zero_copy_buffers_ = 0;
+  bool close_pending_ = false;
 };
 
 HdfsReadableFile::HdfsReadableFile(const io::IOContext& io_context) {
-  impl_.reset(new HdfsReadableFileImpl(io_context.pool()));
+  impl_.reset(new HdfsReadableFileImpl(io_context));
 }
 
 HdfsReadableFile::~HdfsReadableFile() {
@@ -244,7 +356,7 @@ Result<int64_t> HdfsReadableFile::ReadAt(int64_t position, int64_t nbytes, void*
 
 Result<std::shared_ptr<Buffer>> HdfsReadableFile::ReadAt(int64_t position,
                                                          int64_t nbytes) {
-  return impl_->ReadAt(position, nbytes);
+  return impl_->ReadAt(position, nbytes, this);
 }
 
 Result<int64_t> HdfsReadableFile::Read(int64_t nbytes, void* buffer) {
@@ -252,7 +364,7 @@ Result<int64_t> HdfsReadableFile::Read(int64_t nbytes, void* buffer) {
 }
 
 Result<std::shared_ptr<Buffer>> HdfsReadableFile::Read(int64_t nbytes) {
-  return impl_->Read(nbytes);
+  return impl_->Read(nbytes, this);
 }
 
 Result<int64_t> HdfsReadableFile::GetSize() { return impl_->GetSize(); }
@@ -261,6 +373,10 @@ Status HdfsReadableFile::Seek(int64_t position) { return impl_->Seek(position);
 
 Result<int64_t> HdfsReadableFile::Tell() const { return impl_->Tell(); }
 
+bool HdfsReadableFile::supports_zero_copy() const { return impl_->supports_zero_copy(); }
+
+const io::IOContext& HdfsReadableFile::io_context() const { return impl_->io_context(); }
+
 // ----------------------------------------------------------------------
 // File writing
 
@@ -391,6 +507,8 @@ class HadoopFileSystem::HadoopFileSystemImpl {
     port_ = config->port;
     user_ = config->user;
     kerb_ticket_ = config->kerb_ticket;
+    zero_copy_read_ = config->zero_copy_read;
+    zero_copy_skip_checksum_ = config->zero_copy_skip_checksum;
 
     return Status::OK();
   }
@@ -523,6 +641,9 @@ class HadoopFileSystem::HadoopFileSystemImpl {
     *file = std::shared_ptr<HdfsReadableFile>(new HdfsReadableFile(io_context));
     (*file)->impl_->set_members(path, driver_, fs_, handle);
     (*file)->impl_->set_buffer_size(buffer_size);
+    if (zero_copy_read_) {
+      (*file)->impl_->EnableZeroCopy(zero_copy_skip_checksum_);
+    }
 
     return Status::OK();
   }
@@ -586,6 +707,8 @@ class HadoopFileSystem::HadoopFileSystemImpl {
   std::string user_;
   int port_;
   std::string kerb_ticket_;
+  bool zero_copy_read_ = false;
+  bool zero_copy_skip_checksum_ = false;
 
   hdfsFS fs_;
 };
@@ -90,6 +90,11 @@ struct HdfsConnectionConfig {
   std::string user;
   std::string kerb_ticket;
   std::unordered_map<std::string, std::string> extra_conf;
+  // Read through libhdfs's zero-copy API when possible, see HdfsReadableFile
+  bool zero_copy_read = false;
+  // Skip checksums in zero-copy reads. Unless a block is cached by the
+  // DataNode, HDFS only memory-maps it when checksums are skipped.
+  bool zero_copy_skip_checksum = false;
 };
 
 class ARROW_EXPORT HadoopFileSystem : public FileSystem {
@@ -230,6 +235,12 @@ class ARROW_EXPORT HdfsReadableFile : public RandomAccessFile {
 
   // NOTE: If you wish to read a particular range of a file in a multithreaded
   // context, you may prefer to use ReadAt to avoid locking issues
+  //
+  // With HdfsConnectionConfig::zero_copy_read, the methods returning a Buffer
+  // return memory-mapped block data of short-circuit local reads without
+  // copying it, and fall back to a copy for ranges that cannot be mapped (e.g.
+  // remote or spanning several blocks). Closing the file while such buffers
+  // are alive defers releasing the file until they are destroyed.
   Result<int64_t> Read(int64_t nbytes, void* out) override;
   Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override;
   Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override;
@@ -239,6 +250,10 @@ class ARROW_EXPORT HdfsReadableFile : public RandomAccessFile {
   Result<int64_t> Tell() const override;
   Result<int64_t> GetSize() override;
 
+  bool supports_zero_copy() const override;
+
+  const io::IOContext& io_context() const override;
+
  private:
   explicit HdfsReadableFile(const io::IOContext&);
 
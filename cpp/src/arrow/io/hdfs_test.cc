@@ -462,5 +462,40 @@ TEST_F(TestHadoopFileSystem, ThreadSafety) {
   ASSERT_EQ(niter * 4, correct_count);
 }
 
+TEST_F(TestHadoopFileSystem, ZeroCopyRead) {
+  SKIP_IF_NO_DRIVER();
+  ASSERT_OK(this->MakeScratchDir());
+
+  auto path = this->ScratchPath("zero-copy");
+  const int size = 100;
+  std::vector<uint8_t> data = RandomData(size);
+  ASSERT_OK(this->WriteDummyFile(path, data.data(), size));
+
+  HdfsConnectionConfig conf = this->conf_;
+  conf.zero_copy_read = true;
+  conf.zero_copy_skip_checksum = true;
+  std::shared_ptr<HadoopFileSystem> client;
+  ASSERT_OK(HadoopFileSystem::Connect(&conf, &client));
+
+  std::shared_ptr<HdfsReadableFile> file;
+  ASSERT_OK(client->OpenReadable(path, &file));
+
+  // Falls back to copying reads when the blocks are not local
+  ASSERT_OK_AND_ASSIGN(auto buffer, file->ReadAt(10, 50));
+  ASSERT_EQ(50, buffer->size());
+  ASSERT_EQ(0, memcmp(data.data() + 10, buffer->data(), 50));
+  ASSERT_OK_AND_ASSIGN(auto tail, file->Read(size));
+  ASSERT_EQ(size, tail->size());
+  ASSERT_EQ(0, memcmp(data.data(), tail->data(), size));
+
+  // The buffers outlive the file
+  ASSERT_OK(file->Close());
+  ASSERT_TRUE(file->closed());
+  ASSERT_EQ(0, memcmp(data.data() + 10, buffer->data(), 50));
+  buffer.reset();
+  tail.reset();
+  ASSERT_OK(client->Disconnect());
+}
+
 }  // namespace io
 }  // namespace arrow
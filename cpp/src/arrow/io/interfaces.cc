@@ -410,6 +410,9 @@ std::shared_ptr<ThreadPool> MakeIOThreadPool() {
   if (!maybe_pool.ok()) {
     maybe_pool.status().Abort("Failed to create global IO thread pool");
   }
+#ifdef ARROW_ENABLE_THREADING
+  (*maybe_pool)->SetMetricsPrefix("thread_pool.io");
+#endif
   return *std::move(maybe_pool);
 }
 
@@ -378,5 +378,115 @@ Status BufferReader::DoSeek(int64_t position) {
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// In-memory chunked buffer reader
+
+ChunkedBufferReader::ChunkedBufferReader(BufferVector chunks, MemoryPool* pool)
+    : pool_(pool), position_(0), is_open_(true) {
+  offsets_.push_back(0);
+  for (auto& chunk : chunks) {
+    DCHECK(chunk->is_cpu());
+    // Empty chunks are dropped so that every position belongs to a single chunk
+    if (chunk->size() > 0) {
+      offsets_.push_back(offsets_.back() + chunk->size());
+      chunks_.push_back(std::move(chunk));
+    }
+  }
+}
+
+Status ChunkedBufferReader::DoClose() {
+  is_open_ = false;
+  return Status::OK();
+}
+
+bool ChunkedBufferReader::closed() const { return !is_open_; }
+
+bool ChunkedBufferReader::supports_zero_copy() const { return true; }
+
+Result<int64_t> ChunkedBufferReader::DoTell() const {
+  RETURN_NOT_OK(CheckClosed());
+  return position_;
+}
+
+size_t ChunkedBufferReader::FindChunk(int64_t position) const {
+  auto it = std::upper_bound(offsets_.begin(), offsets_.end(), position);
+  return static_cast<size_t>(it - offsets_.begin()) - 1;
+}
+
+Future<std::shared_ptr<Buffer>> ChunkedBufferReader::ReadAsync(const IOContext&,
+                                                               int64_t position,
+                                                               int64_t nbytes) {
+  return Future<std::shared_ptr<Buffer>>::MakeFinished(DoReadAt(position, nbytes));
+}
+
+Result<int64_t> ChunkedBufferReader::DoReadAt(int64_t position, int64_t nbytes,
+                                              void* out) {
+  RETURN_NOT_OK(CheckClosed());
+
+  ARROW_ASSIGN_OR_RAISE(nbytes,
+                        internal::ValidateReadRange(position, nbytes, offsets_.back()));
+  DCHECK_GE(nbytes, 0);
+  int64_t copied = 0;
+  for (size_t i = nbytes > 0 ? FindChunk(position) : 0; copied < nbytes; ++i) {
+    const int64_t chunk_offset = position + copied - offsets_[i];
+    const int64_t copy_size =
+        std::min(nbytes - copied, chunks_[i]->size() - chunk_offset);
+    memcpy(static_cast<uint8_t*>(out) + copied, chunks_[i]->data() + chunk_offset,
+           copy_size);
+    copied += copy_size;
+  }
+  return nbytes;
+}
+
+Result<std::shared_ptr<Buffer>> ChunkedBufferReader::DoReadAt(int64_t position,
+                                                              int64_t nbytes) {
+  RETURN_NOT_OK(CheckClosed());
+
+  ARROW_ASSIGN_OR_RAISE(nbytes,
+                        internal::ValidateReadRange(position, nbytes, offsets_.back()));
+  DCHECK_GE(nbytes, 0);
+  if (nbytes == 0) {
+    return std::make_shared<Buffer>(reinterpret_cast<const uint8_t*>(""), 0);
+  }
+  const size_t i = FindChunk(position);
+  if (position + nbytes <= offsets_[i + 1]) {
+    return SliceBuffer(chunks_[i], position - offsets_[i], nbytes);
+  }
+  // The range straddles several chunks
+  ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateBuffer(nbytes, pool_));
+  RETURN_NOT_OK(DoReadAt(position, nbytes, buffer->mutable_data()));
+  return std::shared_ptr<Buffer>(std::move(buffer));
+}
+
+Result<int64_t> ChunkedBufferReader::DoRead(int64_t nbytes, void* out) {
+  RETURN_NOT_OK(CheckClosed());
+  ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, DoReadAt(position_, nbytes, out));
+  position_ += bytes_read;
+  return bytes_read;
+}
+
+Result<std::shared_ptr<Buffer>> ChunkedBufferReader::DoRead(int64_t nbytes) {
+  RETURN_NOT_OK(CheckClosed());
+  ARROW_ASSIGN_OR_RAISE(auto buffer, DoReadAt(position_, nbytes));
+  position_ += buffer->size();
+  return buffer;
+}
+
+Result<int64_t> ChunkedBufferReader::DoGetSize() {
+  RETURN_NOT_OK(CheckClosed());
+  return offsets_.back();
+}
+
+Status ChunkedBufferReader::DoSeek(int64_t position) {
+  RETURN_NOT_OK(CheckClosed());
+
+  if (position < 0 || position > offsets_.back()) {
+    return Status::IOError("Seek out of bounds");
+  }
+
+  position_ = position;
+  return Status::OK();
+}
+
 }  // namespace io
 }  // namespace arrow
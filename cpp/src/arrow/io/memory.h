@@ -193,5 +193,59 @@ class ARROW_EXPORT BufferReader
   bool is_open_;
 };
 
+/// \class ChunkedBufferReader
+/// \brief Random access reads on a sequence of CPU buffers, viewed as one contiguous
+/// file
+///
+/// Reads falling within a single chunk are zero-copy slices of that chunk; reads
+/// straddling chunk boundaries are copied into a buffer allocated from the given pool.
+class ARROW_EXPORT ChunkedBufferReader
+    : public internal::RandomAccessFileConcurrencyWrapper<ChunkedBufferReader> {
+ public:
+  explicit ChunkedBufferReader(BufferVector chunks,
+                               MemoryPool* pool = default_memory_pool());
+
+  bool closed() const override;
+
+  bool supports_zero_copy() const override;
+
+  const BufferVector& chunks() const { return chunks_; }
+
+  // Synchronous ReadAsync override
+  Future<std::shared_ptr<Buffer>> ReadAsync(const IOContext&, int64_t position,
+                                            int64_t nbytes) override;
+
+ protected:
+  friend RandomAccessFileConcurrencyWrapper<ChunkedBufferReader>;
+
+  Status DoClose();
+
+  Result<int64_t> DoRead(int64_t nbytes, void* buffer);
+  Result<std::shared_ptr<Buffer>> DoRead(int64_t nbytes);
+  Result<int64_t> DoReadAt(int64_t position, int64_t nbytes, void* out);
+  Result<std::shared_ptr<Buffer>> DoReadAt(int64_t position, int64_t nbytes);
+
+  Result<int64_t> DoTell() const;
+  Status DoSeek(int64_t position);
+  Result<int64_t> DoGetSize();
+
+  Status CheckClosed() const {
+    if (!is_open_) {
+      return Status::Invalid("Operation forbidden on closed ChunkedBufferReader");
+    }
+    return Status::OK();
+  }
+
+  // Index of the chunk containing the given position, which must be in bounds
+  size_t FindChunk(int64_t position) const;
+
+  BufferVector chunks_;
+  // Offset of each chunk in the file, followed by the file size
+  std::vector<int64_t> offsets_;
+  MemoryPool* pool_;
+  int64_t position_;
+  bool is_open_;
+};
+
 }  // namespace io
 }  // namespace arrow
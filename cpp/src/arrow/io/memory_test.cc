@@ -316,6 +316,42 @@ TEST(TestBufferReader, Lifetime) {
   });
 }
 
+TEST(TestChunkedBufferReader, Basics) {
+  auto chunk1 = Buffer::FromString("data");
+  auto chunk2 = Buffer::FromString("12");
+  auto chunk3 = Buffer::FromString("3456");
+  ChunkedBufferReader reader({chunk1, std::make_shared<Buffer>(""), chunk2, chunk3});
+  ASSERT_TRUE(reader.supports_zero_copy());
+  ASSERT_OK_AND_EQ(10, reader.GetSize());
+
+  // Reads within a chunk are zero-copy
+  ASSERT_OK_AND_ASSIGN(auto buffer, reader.ReadAt(1, 3));
+  AssertBufferEqual(*buffer, "ata");
+  ASSERT_EQ(chunk1->data() + 1, buffer->data());
+  ASSERT_OK_AND_ASSIGN(buffer, reader.ReadAt(4, 2));
+  ASSERT_EQ(chunk2->data(), buffer->data());
+
+  // Reads straddling chunks are copied
+  ASSERT_OK_AND_ASSIGN(buffer, reader.ReadAt(2, 7));
+  AssertBufferEqual(*buffer, "ta12345");
+  ASSERT_OK_AND_ASSIGN(buffer, reader.ReadAt(8, 10));  // Truncated
+  AssertBufferEqual(*buffer, "56");
+  ASSERT_OK_AND_ASSIGN(buffer, reader.ReadAt(10, 1));
+  ASSERT_EQ(0, buffer->size());
+
+  ASSERT_OK_AND_ASSIGN(buffer, reader.Read(5));
+  AssertBufferEqual(*buffer, "data1");
+  char out[5];
+  ASSERT_OK_AND_EQ(5, reader.Read(5, out));
+  ASSERT_EQ("23456", std::string(out, 5));
+  ASSERT_OK_AND_EQ(10, reader.Tell());
+
+  ASSERT_RAISES(Invalid, reader.ReadAt(-1, 1));
+  ASSERT_RAISES(IOError, reader.Seek(11));
+  ASSERT_OK(reader.Close());
+  ASSERT_RAISES(Invalid, reader.ReadAt(0, 1));
+}
+
 TEST(TestRandomAccessFile, GetStream) {
   std::string data = "data1data2data3data4data5";
 
@@ -800,31 +836,38 @@ TEST(RangeReadCache, Concurrency) {
                                 {25, 0}, {10, 4}, {14, 0}, {15, 4}};
 
   for (auto lazy : std::vector<bool>{false, true}) {
-    SCOPED_TRACE(lazy);
-    CacheOptions options = CacheOptions::Defaults();
-    options.hole_size_limit = 2;
-    options.range_size_limit = 10;
-    options.lazy = lazy;
+    for (auto bounded : std::vector<bool>{false, true}) {
+      SCOPED_TRACE(lazy);
+      SCOPED_TRACE(bounded);
+      CacheOptions options = CacheOptions::Defaults();
+      options.hole_size_limit = 2;
+      options.range_size_limit = 10;
+      options.lazy = lazy;
+      if (bounded) {
+        options.memory_limit = 10;
+        options.release_after_read = true;
+      }
 
-    {
-      internal::ReadRangeCache cache(file, {}, options);
-      ASSERT_OK(cache.Cache(ranges));
-      std::vector<Future<std::shared_ptr<Buffer>>> futures;
-      for (const auto& range : ranges) {
-        futures.push_back(
-            cache.WaitFor({range}).Then([&cache, range]() { return cache.Read(range); }));
+      {
+        internal::ReadRangeCache cache(file, {}, options);
+        ASSERT_OK(cache.Cache(ranges));
+        std::vector<Future<std::shared_ptr<Buffer>>> futures;
+        for (const auto& range : ranges) {
+          futures.push_back(cache.WaitFor({range}).Then(
+              [&cache, range]() { return cache.Read(range); }));
+        }
+        for (auto fut : futures) {
+          ASSERT_FINISHES_OK(fut);
+        }
       }
-      for (auto fut : futures) {
-        ASSERT_FINISHES_OK(fut);
+      {
+        internal::ReadRangeCache cache(file, {}, options);
+        ASSERT_OK(cache.Cache(ranges));
+        ASSERT_OK(arrow::internal::ParallelFor(
+            static_cast<int>(ranges.size()),
+            [&](int index) { return cache.Read(ranges[index]).status(); }));
       }
     }
-    {
-      internal::ReadRangeCache cache(file, {}, options);
-      ASSERT_OK(cache.Cache(ranges));
-      ASSERT_OK(arrow::internal::ParallelFor(
-          static_cast<int>(ranges.size()),
-          [&](int index) { return cache.Read(ranges[index]).status(); }));
-    }
   }
 }
 
@@ -917,6 +960,112 @@ TEST(RangeReadCache, LazyWithPrefetching) {
   ASSERT_RAISES(Invalid, cache.Read({25, 2}));
 }
 
+TEST(RangeReadCache, ReleaseAfterRead) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  auto file = std::make_shared<CountingBufferReader>(std::make_shared<Buffer>(data));
+  CacheOptions options = CacheOptions::Defaults();
+  options.hole_size_limit = 0;
+  options.range_size_limit = 4;
+  options.memory_limit = 8;
+  options.release_after_read = true;
+  internal::ReadRangeCache cache(file, {}, options);
+
+  // Coalesced into {0, 4}, {6, 4}, {15, 4}, {20, 4}
+  ASSERT_OK(cache.Cache({{0, 4}, {6, 2}, {8, 2}, {15, 4}, {20, 4}}));
+  // Only the ranges fitting in the memory limit are read
+  ASSERT_EQ(2, file->read_count());
+
+  ASSERT_OK_AND_ASSIGN(auto buf, cache.Read({0, 4}));
+  AssertBufferEqual(*buf, "abcd");
+  // {0, 4} was released, making room for {15, 4}
+  ASSERT_EQ(3, file->read_count());
+
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({6, 2}));
+  AssertBufferEqual(*buf, "gh");
+  ASSERT_EQ(3, file->read_count());
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({8, 2}));
+  AssertBufferEqual(*buf, "ij");
+  // {6, 4} was released, making room for {20, 4}
+  ASSERT_EQ(4, file->read_count());
+
+  // Released ranges are read again if needed
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({0, 4}));
+  AssertBufferEqual(*buf, "abcd");
+  ASSERT_EQ(5, file->read_count());
+
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({15, 4}));
+  AssertBufferEqual(*buf, "pqrs");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({20, 4}));
+  AssertBufferEqual(*buf, "uvwx");
+  ASSERT_EQ(5, file->read_count());
+  // Released ranges are not read again by Wait()
+  ASSERT_FINISHES_OK(cache.Wait());
+  ASSERT_EQ(5, file->read_count());
+
+  ASSERT_RAISES(Invalid, cache.Read({10, 4}));
+}
+
+TEST(RangeReadCache, LazyReleaseAfterRead) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  auto file = std::make_shared<CountingBufferReader>(std::make_shared<Buffer>(data));
+  CacheOptions options = CacheOptions::LazyDefaults();
+  options.hole_size_limit = 0;
+  options.range_size_limit = 4;
+  options.prefetch_limit = 2;
+  options.memory_limit = 8;
+  options.release_after_read = true;
+  internal::ReadRangeCache cache(file, {}, options);
+
+  ASSERT_OK(cache.Cache({{0, 4}, {5, 4}, {10, 4}, {15, 4}}));
+  ASSERT_EQ(0, file->read_count());
+
+  ASSERT_OK_AND_ASSIGN(auto buf, cache.Read({0, 4}));
+  AssertBufferEqual(*buf, "abcd");
+  // Read {0, 4} and prefetch {5, 4}, not {10, 4} because of the memory limit
+  ASSERT_EQ(2, file->read_count());
+
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({5, 4}));
+  AssertBufferEqual(*buf, "fghi");
+  // {0, 4} was released, making room to prefetch {10, 4}
+  ASSERT_EQ(3, file->read_count());
+
+  // Requested ranges are read regardless of the memory limit
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({15, 4}));
+  AssertBufferEqual(*buf, "pqrs");
+  ASSERT_EQ(4, file->read_count());
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({10, 4}));
+  AssertBufferEqual(*buf, "klmn");
+  ASSERT_EQ(4, file->read_count());
+}
+
+TEST(RangeReadCache, MemoryLimit) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  auto file = std::make_shared<CountingBufferReader>(std::make_shared<Buffer>(data));
+  CacheOptions options = CacheOptions::Defaults();
+  options.hole_size_limit = 0;
+  options.range_size_limit = 4;
+  options.memory_limit = 8;
+  internal::ReadRangeCache cache(file, {}, options);
+
+  ASSERT_OK(cache.Cache({{0, 4}, {5, 4}, {10, 4}, {15, 4}}));
+  ASSERT_EQ(2, file->read_count());
+
+  // Without release_after_read, ranges are kept and nothing else is read ahead
+  ASSERT_OK_AND_ASSIGN(auto buf, cache.Read({0, 4}));
+  AssertBufferEqual(*buf, "abcd");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({0, 4}));
+  AssertBufferEqual(*buf, "abcd");
+  ASSERT_EQ(2, file->read_count());
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({15, 4}));
+  AssertBufferEqual(*buf, "pqrs");
+  ASSERT_EQ(3, file->read_count());
+  ASSERT_FINISHES_OK(cache.Wait());
+  ASSERT_EQ(4, file->read_count());
+}
+
 TEST(CacheOptions, Basics) {
   auto check = [](const CacheOptions actual, const double expected_hole_size_limit_MiB,
                   const double expected_range_size_limit_MiB) -> void {
@@ -941,6 +1090,102 @@ TEST(CacheOptions, Basics) {
   check(CacheOptions::MakeFromNetworkMetrics(5, 500, .75, 5), 2.5, 5);
 }
 
+TEST(AdaptiveCacheTuner, Basics) {
+  constexpr int64_t kMiB = 1024 * 1024;
+  // TTFB = 5 ms, BW = 500 MiB/s
+  auto record = [](AdaptiveCacheTuner* tuner, double ttfb_sec, double bw_mib_per_sec) {
+    for (int64_t size_mib : {1, 8, 2, 6, 4}) {
+      tuner->RecordRead(size_mib * kMiB, ttfb_sec + size_mib / bw_mib_per_sec);
+    }
+  };
+
+  AdaptiveCacheTuner tuner;
+  ASSERT_FALSE(tuner.metrics().estimated());
+  ASSERT_EQ(tuner.Tune(CacheOptions::Defaults()), CacheOptions::Defaults());
+  // Reads of a single size are not enough to tell latency and bandwidth apart
+  for (int i = 0; i < 3; ++i) {
+    tuner.RecordRead(kMiB, 0.01);
+  }
+  ASSERT_EQ(tuner.metrics().num_reads, 3);
+  ASSERT_FALSE(tuner.metrics().estimated());
+
+  record(&tuner, 0.005, 500);
+  auto metrics = tuner.metrics();
+  ASSERT_EQ(metrics.num_reads, 8);
+  ASSERT_TRUE(metrics.estimated());
+  ASSERT_GT(metrics.time_to_first_byte_sec, 0);
+  ASSERT_GT(metrics.bandwidth_bytes_per_sec, 0);
+
+  AdaptiveCacheTuner fresh_tuner;
+  record(&fresh_tuner, 0.005, 500);
+  metrics = fresh_tuner.metrics();
+  ASSERT_NEAR(metrics.time_to_first_byte_sec, 0.005, 1e-9);
+  ASSERT_NEAR(metrics.bandwidth_bytes_per_sec, 500.0 * kMiB, 1e-3);
+  auto options = fresh_tuner.Tune(CacheOptions::Defaults());
+  auto expected = CacheOptions::MakeFromNetworkMetrics(5, 500);
+  ASSERT_NEAR(options.hole_size_limit, expected.hole_size_limit, 1);
+  ASSERT_NEAR(options.range_size_limit, expected.range_size_limit, 10);
+  ASSERT_FALSE(options.lazy);
+  ASSERT_EQ(options.prefetch_limit, 0);
+
+  // The estimates follow changes in the storage behaviour
+  for (int i = 0; i < 20; ++i) {
+    record(&fresh_tuner, 0.05, 100);
+  }
+  metrics = fresh_tuner.metrics();
+  ASSERT_NEAR(metrics.time_to_first_byte_sec, 0.05, 1e-3);
+  ASSERT_NEAR(metrics.bandwidth_bytes_per_sec / kMiB, 100, 1);
+}
+
+TEST(AdaptiveCacheTuner, PrefetchLimit) {
+  constexpr int64_t kMiB = 1024 * 1024;
+  AdaptiveCacheTuner tuner;
+  // TTFB = 500 ms, BW = 500 MiB/s: requests are capped at 64 MiB, and 4 of them
+  // are transferred during the time to first byte
+  for (int64_t size_mib : {1, 8, 2, 6, 4}) {
+    tuner.RecordRead(size_mib * kMiB, 0.5 + size_mib / 500.0);
+  }
+
+  CacheOptions base_options = CacheOptions::LazyDefaults();
+  auto options = tuner.Tune(base_options);
+  ASSERT_EQ(options.range_size_limit, 64 * kMiB);
+  ASSERT_EQ(options.hole_size_limit, 64 * kMiB - 1);
+  ASSERT_TRUE(options.lazy);
+  ASSERT_EQ(options.prefetch_limit, 0);
+
+  base_options.prefetch_limit = 1;
+  options = tuner.Tune(base_options);
+  ASSERT_EQ(options.prefetch_limit, 4);
+}
+
+TEST(RangeReadCache, AdaptiveTuning) {
+  constexpr int64_t kMiB = 1024 * 1024;
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  for (auto lazy : std::vector<bool>{false, true}) {
+    SCOPED_TRACE(lazy);
+    auto tuner = std::make_shared<AdaptiveCacheTuner>();
+    CacheOptions options = lazy ? CacheOptions::LazyDefaults() : CacheOptions::Defaults();
+    options.tuner = tuner;
+    auto file = std::make_shared<CountingBufferReader>(std::make_shared<Buffer>(data));
+    internal::ReadRangeCache cache(file, {}, options);
+    ASSERT_EQ(cache.options(), options);
+
+    for (int64_t size_mib : {1, 8, 2, 6, 4}) {
+      tuner->RecordRead(size_mib * kMiB, 0.005 + size_mib / 500.0);
+    }
+    // The options are tuned when ranges are added
+    const CacheOptions expected = tuner->Tune(options);
+    ASSERT_OK(cache.Cache({{1, 2}, {20, 2}}));
+    ASSERT_EQ(cache.options(), expected);
+    ASSERT_EQ(expected.tuner, tuner);
+    ASSERT_GT(cache.options().hole_size_limit, 20);
+    ASSERT_OK_AND_ASSIGN(auto buf, cache.Read({20, 2}));
+    AssertBufferEqual(*buf, "uv");
+    ASSERT_EQ(1, file->read_count());
+  }
+}
+
 TEST(IOThreadPool, Capacity) {
 #ifndef ARROW_ENABLE_THREADING
   GTEST_SKIP() << "Test requires threading enabled";
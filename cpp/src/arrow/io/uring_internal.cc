@@ -0,0 +1,537 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/uring_internal.h"
+
+#if defined(__linux__) && defined(__has_include)
+#  if __has_include(<linux/io_uring.h>)
+#    define ARROW_HAVE_IO_URING
+#  endif
+#endif
+
+#ifdef ARROW_HAVE_IO_URING
+#  include <linux/io_uring.h>
+#  include <sys/mman.h>
+#  include <sys/syscall.h>
+#  include <sys/uio.h>
+#  include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/memory_pool.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/future.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging_internal.h"
+
+namespace arrow {
+
+using internal::IOErrorFromErrno;
+
+namespace io {
+namespace internal {
+
+#ifdef ARROW_HAVE_IO_URING
+
+namespace {
+
+int IoUringSetup(uint32_t entries, io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int ring_fd, uint32_t to_submit, uint32_t min_complete,
+                 uint32_t flags) {
+  return static_cast<int>(syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete,
+                                  flags, nullptr, 0));
+}
+
+bool IsTransientError(int errnum) {
+  return errnum == EINTR || errnum == EAGAIN || errnum == EBUSY;
+}
+
+// A read in flight.  Owned by the ring between submission and completion.
+struct ReadOperation {
+  int fd;
+  // The range actually read, widened to the alignment if any
+  int64_t offset;
+  int64_t length;
+  // Bytes read so far, as the kernel may return short reads
+  int64_t bytes_read = 0;
+  // For aligned reads, the range to return as a slice of the buffer
+  int64_t alignment = 0;
+  int64_t slice_offset = 0;
+  int64_t slice_length = 0;
+  std::shared_ptr<ResizableBuffer> buffer;
+  struct iovec iov;
+  Future<std::shared_ptr<Buffer>> future;
+};
+
+using FailedOperations = std::vector<std::pair<ReadOperation*, Status>>;
+
+// user_data of the no-op submitted to stop the completion thread
+constexpr uint64_t kStopUserData = 0;
+
+}  // namespace
+
+class IoUring::Impl {
+ public:
+  Impl() = default;
+
+  ~Impl() {
+    if (sqes_ != nullptr) {
+      munmap(sqes_, sq_entries_ * sizeof(io_uring_sqe));
+    }
+    if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) {
+      munmap(cq_ring_, cq_ring_size_);
+    }
+    if (sq_ring_ != nullptr) {
+      munmap(sq_ring_, sq_ring_size_);
+    }
+    if (ring_fd_ >= 0) {
+      close(ring_fd_);
+    }
+  }
+
+  Status Init(int32_t queue_depth) {
+    if (queue_depth <= 0) {
+      return Status::Invalid("io_uring queue depth must be positive, got ", queue_depth);
+    }
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    ring_fd_ = IoUringSetup(static_cast<uint32_t>(queue_depth), &params);
+    if (ring_fd_ < 0) {
+      return IOErrorFromErrno(errno, "io_uring_setup failed");
+    }
+    sq_entries_ = params.sq_entries;
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+      sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(sq_ring_, Map(sq_ring_size_, IORING_OFF_SQ_RING));
+    if (single_mmap) {
+      cq_ring_ = sq_ring_;
+    } else {
+      ARROW_ASSIGN_OR_RAISE(cq_ring_, Map(cq_ring_size_, IORING_OFF_CQ_RING));
+    }
+    ARROW_ASSIGN_OR_RAISE(void* sqes,
+                          Map(sq_entries_ * sizeof(io_uring_sqe), IORING_OFF_SQES));
+    sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+    auto sq_ring = static_cast<uint8_t*>(sq_ring_);
+    sq_head_ = reinterpret_cast<uint32_t*>(sq_ring + params.sq_off.head);
+    sq_tail_ = reinterpret_cast<uint32_t*>(sq_ring + params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<uint32_t*>(sq_ring + params.sq_off.ring_mask);
+    // Submission queue entries are used in order, so the indirection array is
+    // set up once as the identity.
+    auto sq_array = reinterpret_cast<uint32_t*>(sq_ring + params.sq_off.array);
+    for (uint32_t i = 0; i < sq_entries_; ++i) {
+      sq_array[i] = i;
+    }
+    sqe_tail_ = *sq_tail_;
+
+    auto cq_ring = static_cast<uint8_t*>(cq_ring_);
+    cq_head_ = reinterpret_cast<uint32_t*>(cq_ring + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<uint32_t*>(cq_ring + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<uint32_t*>(cq_ring + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe*>(cq_ring + params.cq_off.cqes);
+
+    // Keep the number of operations in flight below the completion queue size,
+    // so that completions never overflow.  One slot is reserved for Stop().
+    max_in_flight_ = params.cq_entries - 1;
+    return Status::OK();
+  }
+
+  void StartCompletionThread(std::shared_ptr<Impl> self) {
+    completion_thread_ = std::thread([self = std::move(self)]() { self->ReapLoop(); });
+  }
+
+  // Stop the completion thread once all reads in flight have completed
+  void Stop() {
+    FailedOperations failed;
+    Status st;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      io_uring_sqe* sqe = NextSqeLocked(&failed);
+      std::memset(sqe, 0, sizeof(*sqe));
+      sqe->opcode = IORING_OP_NOP;
+      sqe->user_data = kStopUserData;
+      ++sqe_tail_;
+      st = FlushLocked(&failed);
+    }
+    FinishFailed(std::move(failed));
+
+    if (!st.ok()) {
+      // The completion thread would never see the stop request
+      ARROW_LOG(ERROR) << "Failed stopping io_uring completion thread: " << st.ToString();
+      completion_thread_.detach();
+    } else if (std::this_thread::get_id() == completion_thread_.get_id()) {
+      // The last reference was dropped from a completion callback
+      completion_thread_.detach();
+    } else {
+      completion_thread_.join();
+    }
+  }
+
+  void Submit(std::vector<std::unique_ptr<ReadOperation>> operations) {
+    DCHECK_NE(std::this_thread::get_id(), completion_thread_.get_id())
+        << "io_uring reads must not be submitted from completion callbacks";
+    FailedOperations failed;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      for (auto& operation : operations) {
+        if (in_flight_ == max_in_flight_) {
+          // Make sure the reads queued so far are submitted before waiting for them
+          ARROW_UNUSED(FlushLocked(&failed));
+          in_flight_cv_.wait(lock, [&]() { return in_flight_ < max_in_flight_; });
+        }
+        ++in_flight_;
+        PrepareReadLocked(operation.release(), &failed);
+      }
+      ARROW_UNUSED(FlushLocked(&failed));
+    }
+    FinishFailed(std::move(failed));
+  }
+
+  void InjectResults(int32_t res, int count) {
+    injected_result_ = res;
+    num_injected_results_ = count;
+  }
+
+ private:
+  Result<void*> Map(size_t size, off_t offset) {
+    void* addr =
+        mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+             offset);
+    if (addr == MAP_FAILED) {
+      return IOErrorFromErrno(errno, "Failed mapping io_uring ring");
+    }
+    return addr;
+  }
+
+  // Return the next free submission queue entry, submitting the queued ones if
+  // the queue is full.  Without SQPOLL, the kernel consumes all entries during
+  // io_uring_enter(), so this always succeeds.
+  io_uring_sqe* NextSqeLocked(FailedOperations* failed) {
+    if (sqe_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) == sq_entries_) {
+      ARROW_UNUSED(FlushLocked(failed));
+    }
+    return &sqes_[sqe_tail_ & sq_mask_];
+  }
+
+  // Queue the remaining part of a read
+  void PrepareReadLocked(ReadOperation* operation, FailedOperations* failed) {
+    const int64_t remaining = operation->length - operation->bytes_read;
+    operation->iov.iov_base = operation->buffer->mutable_data() + operation->bytes_read;
+    operation->iov.iov_len = static_cast<size_t>(remaining);
+    io_uring_sqe* sqe = NextSqeLocked(failed);
+    std::memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_READV;
+    sqe->fd = operation->fd;
+    sqe->off = static_cast<uint64_t>(operation->offset + operation->bytes_read);
+    sqe->addr = reinterpret_cast<uint64_t>(&operation->iov);
+    sqe->len = 1;
+    sqe->user_data = reinterpret_cast<uint64_t>(operation);
+    ++sqe_tail_;
+  }
+
+  // Submit all queued entries.  On failure, the entries not consumed by the
+  // kernel are taken back and their reads failed.
+  Status FlushLocked(FailedOperations* failed) {
+    __atomic_store_n(sq_tail_, sqe_tail_, __ATOMIC_RELEASE);
+    while (true) {
+      const uint32_t head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+      const uint32_t to_submit = sqe_tail_ - head;
+      if (to_submit == 0) {
+        return Status::OK();
+      }
+      if (IoUringEnter(ring_fd_, to_submit, 0, 0) >= 0) {
+        continue;
+      }
+      const int errnum = errno;
+      if (IsTransientError(errnum)) {
+        std::this_thread::yield();
+        continue;
+      }
+      Status st = IOErrorFromErrno(errnum, "io_uring_enter failed");
+      for (uint32_t i = head; i != sqe_tail_; ++i) {
+        const uint64_t user_data = sqes_[i & sq_mask_].user_data;
+        if (user_data != kStopUserData) {
+          failed->emplace_back(reinterpret_cast<ReadOperation*>(user_data), st);
+          --in_flight_;
+        }
+      }
+      sqe_tail_ = head;
+      __atomic_store_n(sq_tail_, sqe_tail_, __ATOMIC_RELEASE);
+      in_flight_cv_.notify_all();
+      return st;
+    }
+  }
+
+  void FinishFailed(FailedOperations failed) {
+    for (auto& [operation, st] : failed) {
+      Finish(operation, std::move(st));
+    }
+  }
+
+  void Finish(ReadOperation* operation, Result<std::shared_ptr<Buffer>> result) {
+    auto future = std::move(operation->future);
+    delete operation;
+    future.MarkFinished(std::move(result));
+  }
+
+  void Complete(ReadOperation* operation, int32_t res) {
+    if (res > 0) {
+      operation->bytes_read += res;
+    }
+    // A short read that is not a multiple of the alignment ends at end of file
+    const bool short_read =
+        res > 0 && operation->bytes_read < operation->length &&
+        (operation->alignment == 0 || res % operation->alignment == 0);
+    if (res < 0 && !IsTransientError(-res)) {
+      Finish(operation, IOErrorFromErrno(-res, "io_uring read failed"));
+    } else if (res < 0 || short_read) {
+      // Interrupted or short read: read the rest
+      FailedOperations failed;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        PrepareReadLocked(operation, &failed);
+        ARROW_UNUSED(FlushLocked(&failed));
+      }
+      FinishFailed(std::move(failed));
+      return;
+    } else {
+      // Read fully, or reached end of file
+      auto buffer = std::move(operation->buffer);
+      Status st;
+      if (operation->alignment != 0) {
+        const int64_t available = operation->bytes_read - operation->slice_offset;
+        const int64_t length = std::clamp<int64_t>(available, 0, operation->slice_length);
+        const int64_t offset = operation->slice_offset;
+        Finish(operation, SliceBuffer(std::move(buffer), offset, length));
+      } else {
+        if (operation->bytes_read < operation->length) {
+          st = buffer->Resize(operation->bytes_read);
+          buffer->ZeroPadding();
+        }
+        if (st.ok()) {
+          Finish(operation, std::shared_ptr<Buffer>(std::move(buffer)));
+        } else {
+          Finish(operation, std::move(st));
+        }
+      }
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    --in_flight_;
+    in_flight_cv_.notify_one();
+  }
+
+  void ReapLoop() {
+    bool stopping = false;
+    while (true) {
+      if (IoUringEnter(ring_fd_, 0, 1, IORING_ENTER_GETEVENTS) < 0 &&
+          !IsTransientError(errno)) {
+        ARROW_LOG(FATAL) << "io_uring_enter failed: "
+                         << ::arrow::internal::ErrnoMessage(errno);
+      }
+      uint32_t head = *cq_head_;
+      const uint32_t tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+      for (; head != tail; ++head) {
+        const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+        const uint64_t user_data = cqe.user_data;
+        int32_t res = cqe.res;
+        // Release the entry before completing, as completing may submit again
+        __atomic_store_n(cq_head_, head + 1, __ATOMIC_RELEASE);
+        if (user_data == kStopUserData) {
+          stopping = true;
+        } else {
+          if (num_injected_results_ > 0) {
+            --num_injected_results_;
+            res = injected_result_;
+          }
+          Complete(reinterpret_cast<ReadOperation*>(user_data), res);
+        }
+      }
+      if (stopping) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (in_flight_ == 0) {
+          return;
+        }
+      }
+    }
+  }
+
+  int ring_fd_ = -1;
+
+  void* sq_ring_ = nullptr;
+  size_t sq_ring_size_ = 0;
+  uint32_t* sq_head_ = nullptr;
+  uint32_t* sq_tail_ = nullptr;
+  uint32_t sq_mask_ = 0;
+  uint32_t sq_entries_ = 0;
+  io_uring_sqe* sqes_ = nullptr;
+
+  void* cq_ring_ = nullptr;
+  size_t cq_ring_size_ = 0;
+  uint32_t* cq_head_ = nullptr;
+  uint32_t* cq_tail_ = nullptr;
+  uint32_t cq_mask_ = 0;
+  io_uring_cqe* cqes_ = nullptr;
+
+  // Protects the submission queue and the counters below
+  std::mutex mutex_;
+  std::condition_variable in_flight_cv_;
+  // Local submission queue tail, published to the kernel by FlushLocked()
+  uint32_t sqe_tail_ = 0;
+  uint32_t in_flight_ = 0;
+  uint32_t max_in_flight_ = 0;
+
+  // See IoUring::InjectResultsForTesting()
+  std::atomic<int32_t> injected_result_{0};
+  std::atomic<int> num_injected_results_{0};
+
+  std::thread completion_thread_;
+};
+
+IoUring::IoUring() = default;
+
+IoUring::~IoUring() {
+  if (impl_) {
+    impl_->Stop();
+  }
+}
+
+Result<std::shared_ptr<IoUring>> IoUring::Make(int32_t queue_depth) {
+  auto impl = std::make_shared<Impl>();
+  RETURN_NOT_OK(impl->Init(queue_depth));
+  impl->StartCompletionThread(impl);
+  std::shared_ptr<IoUring> ring(new IoUring());
+  ring->impl_ = std::move(impl);
+  return ring;
+}
+
+bool IoUring::IsSupported() {
+  static const bool supported = []() {
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    int ring_fd = IoUringSetup(1, &params);
+    if (ring_fd < 0) {
+      return false;
+    }
+    close(ring_fd);
+    return true;
+  }();
+  return supported;
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> IoUring::ReadMany(
+    int fd, const std::vector<ReadRange>& ranges, MemoryPool* pool, int64_t alignment) {
+  std::vector<Future<std::shared_ptr<Buffer>>> futures;
+  futures.reserve(ranges.size());
+  std::vector<std::unique_ptr<ReadOperation>> operations;
+  operations.reserve(ranges.size());
+  for (const auto& range : ranges) {
+    Status st = ValidateRange(range.offset, range.length);
+    if (!st.ok()) {
+      futures.push_back(Future<std::shared_ptr<Buffer>>::MakeFinished(std::move(st)));
+      continue;
+    }
+    auto operation = std::make_unique<ReadOperation>();
+    operation->fd = fd;
+    operation->offset = range.offset;
+    operation->length = range.length;
+    if (alignment != 0) {
+      operation->offset = bit_util::RoundDown(range.offset, alignment);
+      operation->length =
+          bit_util::RoundUp(range.offset + range.length, alignment) - operation->offset;
+      operation->alignment = alignment;
+      operation->slice_offset = range.offset - operation->offset;
+      operation->slice_length = range.length;
+    }
+    auto maybe_buffer = alignment != 0
+                            ? AllocateResizableBuffer(operation->length, alignment, pool)
+                            : AllocateResizableBuffer(operation->length, pool);
+    if (!maybe_buffer.ok()) {
+      futures.push_back(
+          Future<std::shared_ptr<Buffer>>::MakeFinished(maybe_buffer.status()));
+      continue;
+    }
+    if (operation->length == 0) {
+      futures.push_back(Future<std::shared_ptr<Buffer>>::MakeFinished(
+          std::shared_ptr<Buffer>(std::move(maybe_buffer).MoveValueUnsafe())));
+      continue;
+    }
+    operation->buffer = std::move(maybe_buffer).MoveValueUnsafe();
+    operation->future = Future<std::shared_ptr<Buffer>>::Make();
+    futures.push_back(operation->future);
+    operations.push_back(std::move(operation));
+  }
+  if (!operations.empty()) {
+    impl_->Submit(std::move(operations));
+  }
+  return futures;
+}
+
+void IoUring::InjectResultsForTesting(int32_t res, int count) {
+  impl_->InjectResults(res, count);
+}
+
+#else  // !ARROW_HAVE_IO_URING
+
+IoUring::IoUring() = default;
+
+IoUring::~IoUring() = default;
+
+Result<std::shared_ptr<IoUring>> IoUring::Make(int32_t queue_depth) {
+  return Status::NotImplemented("io_uring is not supported on this platform");
+}
+
+bool IoUring::IsSupported() { return false; }
+
+std::vector<Future<std::shared_ptr<Buffer>>> IoUring::ReadMany(
+    int fd, const std::vector<ReadRange>& ranges, MemoryPool* pool, int64_t alignment) {
+  return std::vector<Future<std::shared_ptr<Buffer>>>(
+      ranges.size(), Future<std::shared_ptr<Buffer>>::MakeFinished(Status::NotImplemented(
+                         "io_uring is not supported on this platform")));
+}
+
+void IoUring::InjectResultsForTesting(int32_t res, int count) {}
+
+#endif  // ARROW_HAVE_IO_URING
+
+Future<std::shared_ptr<Buffer>> IoUring::Read(int fd, int64_t offset, int64_t length,
+                                              MemoryPool* pool, int64_t alignment) {
+  return ReadMany(fd, {{offset, length}}, pool, alignment)[0];
+}
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
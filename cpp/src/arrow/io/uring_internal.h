@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+namespace internal {
+
+/// \brief An io_uring instance serving asynchronous reads of local files.
+///
+/// Reads are submitted from the calling thread, batching all the ranges of a
+/// ReadMany() call in a single system call.  A background thread reaps the
+/// completions and finishes the corresponding futures, so that no thread is
+/// blocked for the duration of a read.
+///
+/// An instance can be shared by any number of files.  It is only available on
+/// Linux (kernel 5.1 or later), see IsSupported().
+class ARROW_EXPORT IoUring {
+ public:
+  static constexpr int32_t kDefaultQueueDepth = 128;
+
+  ~IoUring();
+
+  /// \brief Create an io_uring with the given submission queue depth
+  ///
+  /// At most twice `queue_depth` reads are in flight at any time; further
+  /// submissions block until earlier reads complete.
+  static Result<std::shared_ptr<IoUring>> Make(int32_t queue_depth = kDefaultQueueDepth);
+
+  /// \brief Whether io_uring support is compiled in and allowed by the kernel
+  static bool IsSupported();
+
+  /// \brief Read the given ranges of a file descriptor into buffers allocated from `pool`
+  ///
+  /// As with ReadAt(), reads past the end of file return truncated buffers.
+  /// The file descriptor must remain open until the returned futures complete.
+  /// The futures are finished from the background thread; callers should
+  /// transfer them to another executor before attaching expensive callbacks.
+  ///
+  /// If `alignment` is non-zero (for files opened with O_DIRECT), each range is
+  /// widened to `alignment` boundaries and read into a buffer with that alignment,
+  /// of which the requested range is returned as a slice.
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadMany(
+      int fd, const std::vector<ReadRange>& ranges, MemoryPool* pool,
+      int64_t alignment = 0);
+
+  /// \brief Read a single range, see ReadMany()
+  Future<std::shared_ptr<Buffer>> Read(int fd, int64_t offset, int64_t length,
+                                       MemoryPool* pool, int64_t alignment = 0);
+
+  /// \brief Replace the result of the next `count` read completions with `res`
+  ///
+  /// For testing only: `res` is a byte count or a negated errno value, as
+  /// reported by the kernel.
+  void InjectResultsForTesting(int32_t res, int count);
+
+ private:
+  IoUring();
+
+  class Impl;
+  std::shared_ptr<Impl> impl_;
+};
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
@@ -21,6 +21,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -83,7 +84,20 @@ Status WritePadding(io::OutputStream* stream, int64_t nbytes) {
 class Message::MessageImpl {
  public:
   explicit MessageImpl(std::shared_ptr<Buffer> metadata, std::shared_ptr<Buffer> body)
-      : metadata_(std::move(metadata)), message_(nullptr), body_(std::move(body)) {}
+      : metadata_(std::move(metadata)), message_(nullptr), body_(std::move(body)) {
+    if (body_) {
+      body_chunks_.push_back(body_);
+    }
+  }
+
+  MessageImpl(std::shared_ptr<Buffer> metadata, BufferVector body_chunks)
+      : metadata_(std::move(metadata)),
+        message_(nullptr),
+        body_chunks_(std::move(body_chunks)) {
+    if (body_chunks_.size() == 1) {
+      body_ = body_chunks_[0];
+    }
+  }
 
   Status Open() {
     RETURN_NOT_OK(
@@ -134,7 +148,20 @@ class Message::MessageImpl {
 
   int64_t body_length() const { return message_->bodyLength(); }
 
-  std::shared_ptr<Buffer> body() const { return body_; }
+  std::shared_ptr<Buffer> body() const {
+    if (body_chunks_.size() > 1) {
+      // Concatenate the chunks on first use, leaving the body null on failure
+      std::call_once(body_once_, [this] {
+        auto maybe_body = ConcatenateBuffers(body_chunks_);
+        if (maybe_body.ok()) {
+          body_ = maybe_body.MoveValueUnsafe();
+        }
+      });
+    }
+    return body_;
+  }
+
+  const BufferVector& body_chunks() const { return body_chunks_; }
 
   std::shared_ptr<Buffer> metadata() const { return metadata_; }
 
@@ -150,14 +177,18 @@ class Message::MessageImpl {
   // The reconstructed custom_metadata field from the Message Flatbuffer
   std::shared_ptr<const KeyValueMetadata> custom_metadata_;
 
-  // The message body, if any
-  std::shared_ptr<Buffer> body_;
+  // The message body, if any, concatenated lazily when made of several chunks
+  mutable std::shared_ptr<Buffer> body_;
+  mutable std::once_flag body_once_;
+  BufferVector body_chunks_;
 };
 
 Message::Message(std::shared_ptr<Buffer> metadata, std::shared_ptr<Buffer> body) {
   impl_.reset(new MessageImpl(std::move(metadata), std::move(body)));
 }
 
+Message::Message(std::unique_ptr<MessageImpl> impl) : impl_(std::move(impl)) {}
+
 Result<std::unique_ptr<Message>> Message::Open(std::shared_ptr<Buffer> metadata,
                                                std::shared_ptr<Buffer> body) {
   std::unique_ptr<Message> result(new Message(std::move(metadata), std::move(body)));
@@ -165,10 +196,20 @@ Result<std::unique_ptr<Message>> Message::Open(std::shared_ptr<Buffer> metadata,
   return result;
 }
 
+Result<std::unique_ptr<Message>> Message::Open(std::shared_ptr<Buffer> metadata,
+                                               BufferVector body_chunks) {
+  std::unique_ptr<Message> result(new Message(
+      std::make_unique<MessageImpl>(std::move(metadata), std::move(body_chunks))));
+  RETURN_NOT_OK(result->impl_->Open());
+  return result;
+}
+
 Message::~Message() {}
 
 std::shared_ptr<Buffer> Message::body() const { return impl_->body(); }
 
+const BufferVector& Message::body_chunks() const { return impl_->body_chunks(); }
+
 int64_t Message::body_length() const { return impl_->body_length(); }
 
 std::shared_ptr<Buffer> Message::metadata() const { return impl_->metadata(); }
@@ -248,14 +289,18 @@ Status Message::SerializeTo(io::OutputStream* stream, const IpcWriteOptions& opt
 
   *output_length = metadata_length;
 
-  auto body_buffer = body();
-  if (body_buffer) {
-    RETURN_NOT_OK(stream->Write(body_buffer));
-    *output_length += body_buffer->size();
+  const auto& body_buffers = body_chunks();
+  if (!body_buffers.empty()) {
+    int64_t body_size = 0;
+    for (const auto& body_buffer : body_buffers) {
+      RETURN_NOT_OK(stream->Write(body_buffer));
+      body_size += body_buffer->size();
+    }
+    *output_length += body_size;
 
-    DCHECK_GE(this->body_length(), body_buffer->size());
+    DCHECK_GE(this->body_length(), body_size);
 
-    int64_t remainder = this->body_length() - body_buffer->size();
+    int64_t remainder = this->body_length() - body_size;
     RETURN_NOT_OK(WritePadding(stream, remainder));
     *output_length += remainder;
   }
@@ -899,17 +944,22 @@ class MessageDecoder::MessageDecoderImpl {
       buffered_size_ -= used_size;
       return Status::OK();
     } else {
-      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> body,
-                            AllocateBuffer(next_required_size_, pool_));
-      RETURN_NOT_OK(ConsumeDataChunks(next_required_size_, body->mutable_data()));
-      return ConsumeBody(&body);
+      // The body spans several chunks: reference them instead of concatenating them,
+      // so that only the body buffers straddling chunk boundaries get copied
+      ARROW_ASSIGN_OR_RAISE(auto body_chunks, TakeDataChunks(next_required_size_));
+      ARROW_ASSIGN_OR_RAISE(std::unique_ptr<Message> message,
+                            Message::Open(metadata_, std::move(body_chunks)));
+      return ConsumeMessage(std::move(message));
     }
   }
 
   Status ConsumeBody(std::shared_ptr<Buffer>* buffer) {
     ARROW_ASSIGN_OR_RAISE(std::unique_ptr<Message> message,
                           Message::Open(metadata_, *buffer));
+    return ConsumeMessage(std::move(message));
+  }
 
+  Status ConsumeMessage(std::unique_ptr<Message> message) {
     RETURN_NOT_OK(listener_->OnMessageDecoded(std::move(message)));
     state_ = State::INITIAL;
     next_required_size_ = kMessageDecoderNextRequiredSizeInitial;
@@ -957,6 +1007,37 @@ class MessageDecoder::MessageDecoderImpl {
     return Status::OK();
   }
 
+  // Remove the first nbytes of the buffered chunks and return them as CPU buffers
+  Result<BufferVector> TakeDataChunks(int64_t nbytes) {
+    BufferVector out;
+    size_t n_used_chunks = 0;
+    auto required_size = nbytes;
+    std::shared_ptr<Buffer> last_chunk;
+    for (auto& chunk : chunks_) {
+      if (!chunk->is_cpu()) {
+        ARROW_ASSIGN_OR_RAISE(chunk, Buffer::ViewOrCopy(chunk, memory_manager_));
+      }
+      n_used_chunks++;
+      if (chunk->size() > required_size) {
+        out.push_back(SliceBuffer(chunk, 0, required_size));
+        last_chunk = SliceBuffer(chunk, required_size);
+        required_size = 0;
+        break;
+      }
+      required_size -= chunk->size();
+      out.push_back(chunk);
+      if (required_size == 0) {
+        break;
+      }
+    }
+    chunks_.erase(chunks_.begin(), chunks_.begin() + n_used_chunks);
+    if (last_chunk.get() != nullptr) {
+      chunks_.insert(chunks_.begin(), std::move(last_chunk));
+    }
+    buffered_size_ -= nbytes - required_size;
+    return out;
+  }
+
   std::shared_ptr<MessageDecoderListener> listener_;
   MemoryPool* pool_;
   std::shared_ptr<MemoryManager> memory_manager_;
@@ -61,6 +61,18 @@ class ARROW_EXPORT Message {
   static Result<std::unique_ptr<Message>> Open(std::shared_ptr<Buffer> metadata,
                                                std::shared_ptr<Buffer> body);
 
+  /// \brief Create and validate a Message instance whose body is made of several
+  /// consecutive CPU buffers
+  ///
+  /// The chunks are not concatenated: body() only does so when first called, while
+  /// the IPC readers read the body buffers from the chunks directly.
+  ///
+  /// \param[in] metadata a buffer containing the Flatbuffer metadata
+  /// \param[in] body_chunks the buffers making up the message body
+  /// \return the created message
+  static Result<std::unique_ptr<Message>> Open(std::shared_ptr<Buffer> metadata,
+                                               BufferVector body_chunks);
+
   /// \brief Read message body and create Message given Flatbuffer metadata
   /// \param[in] metadata containing a serialized Message flatbuffer
   /// \param[in] stream an InputStream
@@ -102,6 +114,11 @@ class ARROW_EXPORT Message {
   /// \return buffer is null if no body
   std::shared_ptr<Buffer> body() const;
 
+  /// \brief The buffers making up the Message body, empty if no body
+  ///
+  /// This is a single buffer unless the message was opened from several chunks.
+  const BufferVector& body_chunks() const;
+
   /// \brief The expected body length according to the metadata, for
   /// verification purposes
   int64_t body_length() const;
@@ -134,6 +151,8 @@ class ARROW_EXPORT Message {
  private:
   // Hide serialization details from user API
   class MessageImpl;
+  explicit Message(std::unique_ptr<MessageImpl> impl);
+
   std::unique_ptr<MessageImpl> impl_;
 
   ARROW_DISALLOW_COPY_AND_ASSIGN(Message);
@@ -80,6 +80,10 @@ bool HasValidityBitmap(Type::type type_id, MetadataVersion version);
 
 static constexpr const char* kArrowMagicBytes = "ARROW1";
 
+// Schema metadata key holding the base64-encoded ZSTD dictionary the body buffers
+// are compressed with
+static constexpr const char* kZstdDictionaryKey = "ARROW:ipc:zstd_dictionary";
+
 struct FieldMetadata {
   int64_t length;
   int64_t null_count;
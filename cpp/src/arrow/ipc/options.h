@@ -84,10 +84,40 @@ struct ARROW_EXPORT IpcWriteOptions {
   /// prior to 12.0.0.
   std::optional<double> min_space_savings;
 
+  /// \brief ZSTD dictionary to compress the body buffers with
+  ///
+  /// If set, the codec must be ZSTD: the stream and file writers then compress with a
+  /// codec of the same compression level using this dictionary (e.g. as trained by
+  /// TrainZstdDictionary()), and embed the dictionary once in the custom metadata of
+  /// the schema so that readers decompress with it.  This mostly improves the
+  /// compression of streams of small record batches.
+  ///
+  /// Earlier readers cannot decompress such streams.
+  std::shared_ptr<Buffer> compression_dictionary;
+
   /// \brief Use global CPU thread pool to parallelize any computational tasks
   /// like compression
   bool use_threads = true;
 
+  /// \brief Maximum number of bytes of a body buffer compressed as a single frame
+  ///
+  /// When using threads with the ZSTD codec, body buffers larger than this are split
+  /// in chunks compressed in parallel, and written as concatenated ZSTD frames (which
+  /// any ZSTD decoder accepts).  Readers decompress the frames of such buffers in
+  /// parallel as well.  Splitting a buffer slightly degrades the compression ratio.
+  ///
+  /// LZ4_FRAME buffers are always compressed as a single frame, as earlier readers
+  /// reject concatenated LZ4 frames.  If 0 (the default), buffers are not split.
+  int64_t compression_chunk_size = 0;
+
+  /// \brief Write the record batch messages in the background
+  ///
+  /// If true, a record batch is written to the sink on the IO thread pool while the
+  /// next one is serialized (and compressed).  The sink must then not be accessed
+  /// until the writer is closed, and write errors may be reported by the call
+  /// writing the next record batch or closing the writer.
+  bool pipeline_writes = false;
+
   /// \brief Whether to emit dictionary deltas
   ///
   /// If false, a changed dictionary for a given field will emit a full
@@ -120,12 +150,46 @@ struct ARROW_EXPORT IpcWriteOptions {
   /// and deltas.
   bool unify_dictionaries = false;
 
+  /// \brief Whether to unify dictionaries incrementally across record batches
+  ///
+  /// If true, the dictionary of each top-level dictionary column is unified with
+  /// the dictionaries of the previous record batches, and the indices of the
+  /// column are transposed to the unified dictionary.  Only the values not
+  /// written yet are emitted, as a dictionary delta, instead of a dictionary
+  /// replacement.  This works for both IPC streams and files.
+  ///
+  /// The unified dictionary must fit the index type of the column, and the
+  /// dictionaries must not contain nulls.  Dictionaries nested in other columns or
+  /// with a value type not supported by DictionaryUnifier keep the behavior given
+  /// by emit_dictionary_deltas.
+  bool unify_dictionary_deltas = false;
+
   /// \brief Format version to use for IPC messages and their metadata.
   ///
   /// Presently using V5 version (readable by 1.0.0 and later).
   /// V4 is also available (readable by 0.8.0 and later).
   MetadataVersion metadata_version = MetadataVersion::V5;
 
+  /// \brief Record a row index in the custom metadata of the file footer
+  ///
+  /// The index holds the cumulative row counts of the record batches, which lets
+  /// RecordBatchFileReader::ReadRows seek to a row without reading the metadata of
+  /// every record batch.
+  ///
+  /// This option is ignored for IPC streams.
+  bool write_row_index = false;
+
+  /// \brief Top-level fields to record the per-batch minimum and maximum values of
+  ///
+  /// The values are the indices of fields in the schema.  The minimum and maximum
+  /// non-null values of boolean, integer, floating point and binary-like fields are
+  /// recorded in the custom metadata of the file footer (along with the row index) so
+  /// that readers can skip record batches, see
+  /// RecordBatchFileReader::GetRecordBatchStatistics.
+  ///
+  /// This option is ignored for IPC streams.
+  std::vector<int> statistics_fields;
+
   static IpcWriteOptions Defaults();
 };
 
@@ -156,6 +220,8 @@ struct ARROW_EXPORT IpcReadOptions {
   ///
   /// If empty (the default), return all deserialized fields.
   /// If non-empty, the values are the indices of fields in the top-level schema.
+  /// When reading from a file, only the buffers of the included fields are read,
+  /// and the neighbouring ones are coalesced into a single read.
   std::vector<int> included_fields;
 
   /// \brief Use global CPU thread pool to parallelize any computational tasks
@@ -189,6 +255,24 @@ struct ARROW_EXPORT IpcReadOptions {
   /// The lazy property will always be reset to true to deliver the expected behavior
   io::CacheOptions pre_buffer_cache_options = io::CacheOptions::LazyDefaults();
 
+  /// \brief Number of record batches the generator of
+  /// RecordBatchFileReader::GetRecordBatchGenerator reads ahead of the one requested
+  ///
+  /// When coalescing is enabled, the reads of the batches read ahead are coalesced
+  /// following the cache options given to the generator, instead of pre-buffering
+  /// the whole file.  If use_threads is true and no executor is given, the batches
+  /// are then decoded (and decompressed) on the CPU thread pool while the next ones
+  /// are being read on the I/O thread pool.
+  ///
+  /// Default (0) only reads a batch when it is requested.
+  int32_t batch_readahead = 0;
+
+  /// \brief Maximum number of bytes of the record batches read ahead
+  ///
+  /// The requested batch is always read, whatever its size.  Default (0) doesn't
+  /// limit the batches read ahead other than by batch_readahead.
+  int64_t readahead_bytes_limit = 0;
+
   static IpcReadOptions Defaults();
 };
 
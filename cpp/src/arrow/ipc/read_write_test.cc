@@ -22,8 +22,14 @@
 #include <numeric>
 #include <ostream>
 #include <string>
+#include <thread>
 #include <unordered_set>
 
+#ifdef __linux__
+#  include <sys/wait.h>
+#  include <unistd.h>
+#endif
+
 #include <flatbuffers/flatbuffers.h>
 #include <gmock/gmock-matchers.h>
 #include <gtest/gtest.h>
@@ -38,6 +44,8 @@
 #include "arrow/ipc/metadata_internal.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/reader_internal.h"
+#include "arrow/ipc/row_index_internal.h"
+#include "arrow/ipc/shared_memory.h"
 #include "arrow/ipc/test_common.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/record_batch.h"
@@ -784,6 +792,12 @@ TEST_F(TestWriteRecordBatch, WriteWithCompression) {
     write_options.use_threads = false;
     read_options.use_threads = false;
     CheckRoundtrip(*batch, write_options, read_options);
+
+    // Check compression of the body buffers in chunks
+    write_options = IpcWriteOptions::Defaults();
+    ASSERT_OK_AND_ASSIGN(write_options.codec, util::Codec::Create(codec));
+    write_options.compression_chunk_size = 100;
+    CheckRoundtrip(*batch, write_options);
   }
 
   std::vector<Compression::type> disallowed_codecs = {
@@ -799,6 +813,42 @@ TEST_F(TestWriteRecordBatch, WriteWithCompression) {
   }
 }
 
+TEST_F(TestWriteRecordBatch, WriteWithChunkedCompression) {
+  if (!util::Codec::IsAvailable(Compression::ZSTD)) {
+    GTEST_SKIP() << "ZSTD support not built";
+  }
+  random::RandomArrayGenerator rg(/*seed=*/0);
+  auto batch = RecordBatch::Make(schema({field("f0", utf8())}), 10000,
+                                 {rg.String(10000, 0, 100, 0.1)});
+
+  auto write_options = IpcWriteOptions::Defaults();
+  ASSERT_OK_AND_ASSIGN(write_options.codec, util::Codec::Create(Compression::ZSTD));
+  write_options.compression_chunk_size = 4096;
+  IpcPayload payload;
+  ASSERT_OK(GetRecordBatchPayload(*batch, write_options, &payload));
+  // The data buffer is compressed as several frames, which a single decompression call
+  // accepts as well
+  const auto& strings = checked_cast<const StringArray&>(*batch->column(0));
+  const Buffer& data = *payload.body_buffers[2];
+  const int64_t uncompressed_size =
+      bit_util::FromLittleEndian(util::SafeLoadAs<int64_t>(data.data()));
+  ASSERT_EQ(uncompressed_size, strings.total_values_length());
+  ASSERT_OK_AND_ASSIGN(auto decompressed, AllocateBuffer(uncompressed_size));
+  ASSERT_OK_AND_EQ(uncompressed_size,
+                   write_options.codec->Decompress(
+                       data.size() - sizeof(int64_t), data.data() + sizeof(int64_t),
+                       uncompressed_size, decompressed->mutable_data()));
+  ASSERT_EQ(decompressed->ToString(), std::string(reinterpret_cast<const char*>(
+                                                      strings.raw_data()),
+                                                  uncompressed_size));
+
+  for (bool use_threads : {true, false}) {
+    auto read_options = IpcReadOptions::Defaults();
+    read_options.use_threads = use_threads;
+    CheckRoundtrip(*batch, write_options, read_options);
+  }
+}
+
 TEST_F(TestWriteRecordBatch, WriteWithCompressionAndMinSavings) {
   // A small batch that's known to be compressible
   auto batch = RecordBatchFromJSON(schema({field("n", int64())}), R"([
@@ -2128,6 +2178,41 @@ TEST_F(TestFileFormatGeneratorCoalesced, Errors) {
                              reader->GetRecordBatchGenerator(/*coalesce=*/true));
 }
 
+TEST(TestFileFormatGeneratorReadahead, ReadCoalesced) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+  const int num_batches = 7;
+
+  FileWriterHelper helper;
+  ASSERT_OK(helper.Init(batch->schema(), IpcWriteOptions::Defaults()));
+  for (int i = 0; i < num_batches; ++i) {
+    ASSERT_OK(helper.WriteBatch(batch->Slice(i, batch->num_rows() - i)));
+  }
+  ASSERT_OK(helper.Finish());
+
+  for (const bool coalesce : {false, true}) {
+    for (const int64_t bytes_limit : {0, 1, 1 << 12}) {
+      ARROW_SCOPED_TRACE("coalesce = ", coalesce, ", bytes_limit = ", bytes_limit);
+      auto options = IpcReadOptions::Defaults();
+      options.batch_readahead = 3;
+      options.readahead_bytes_limit = bytes_limit;
+      auto buf_reader = std::make_shared<NoZeroCopyBufferReader>(helper.buffer_);
+      ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(buf_reader, options));
+      ASSERT_OK_AND_ASSIGN(auto generator, reader->GetRecordBatchGenerator(coalesce));
+
+      std::vector<Future<std::shared_ptr<RecordBatch>>> futures;
+      for (int i = 0; i < num_batches; ++i) {
+        futures.push_back(generator());
+      }
+      ASSERT_FINISHES_OK_AND_EQ(nullptr, generator());
+      for (int i = 0; i < num_batches; ++i) {
+        ASSERT_FINISHES_OK_AND_ASSIGN(auto out_batch, futures[i]);
+        AssertBatchesEqual(*batch->Slice(i, batch->num_rows() - i), *out_batch);
+      }
+    }
+  }
+}
+
 TEST(TestRecordBatchStreamReader, EmptyStreamWithDictionaries) {
   // ARROW-6006
   auto f0 = arrow::field("f0", arrow::dictionary(arrow::int8(), arrow::utf8()));
@@ -2282,6 +2367,46 @@ TEST(TestStreamDecoder, NextRequiredSize) {
   ASSERT_EQ(next_required_size - 1, decoder.next_required_size());
 }
 
+TEST(TestStreamDecoder, ZeroCopyChunks) {
+  constexpr int kNumColumns = 32;
+  constexpr int64_t kChunkSize = 16 * 1024;
+  random::RandomArrayGenerator rng(/*seed=*/0);
+  FieldVector fields;
+  ArrayVector columns;
+  for (int i = 0; i < kNumColumns; ++i) {
+    fields.push_back(field("f" + std::to_string(i), int32(), /*nullable=*/false));
+    columns.push_back(rng.Int32(1000, 0, 100, /*null_probability=*/0));
+  }
+  auto batch = RecordBatch::Make(schema(fields), 1000, columns);
+
+  StreamWriterHelper writer_helper;
+  ASSERT_OK(writer_helper.Init(batch->schema(), IpcWriteOptions::Defaults()));
+  ASSERT_OK(writer_helper.WriteBatch(batch));
+  ASSERT_OK(writer_helper.Finish());
+  const auto& stream = writer_helper.buffer_;
+
+  auto listener = std::make_shared<CollectListener>();
+  StreamDecoder decoder(listener);
+  for (int64_t offset = 0; offset < stream->size(); offset += kChunkSize) {
+    ASSERT_OK(decoder.Consume(SliceBuffer(stream, offset, kChunkSize)));
+  }
+  ASSERT_EQ(1, listener->num_record_batches());
+  const auto& decoded = listener->record_batches()[0];
+  AssertBatchesEqual(*batch, *decoded);
+
+  // Only the value buffers straddling chunk boundaries are copied, the other ones
+  // point into the stream
+  int num_zero_copy = 0;
+  for (const auto& column : decoded->columns()) {
+    const uint8_t* data = column->data()->buffers[1]->data();
+    if (data >= stream->data() && data < stream->data() + stream->size()) {
+      ++num_zero_copy;
+    }
+  }
+  const int num_chunks = static_cast<int>(bit_util::CeilDiv(stream->size(), kChunkSize));
+  ASSERT_GE(num_zero_copy, kNumColumns - num_chunks);
+}
+
 template <typename WriterHelperType>
 class TestDictionaryReplacement : public ::testing::Test {
  public:
@@ -2585,6 +2710,42 @@ class TestDictionaryReplacement : public ::testing::Test {
     }
   }
 
+  void TestUnifyDictionaryDeltas() {
+    write_options_.unify_dictionary_deltas = true;
+
+    auto type = dictionary(int8(), utf8());
+    auto batch1 = MakeBatch(ArrayFromJSON(type, R"(["foo", "foo", "bar", null])"));
+    // Same values, different order
+    auto batch2 = MakeBatch(ArrayFromJSON(type, R"(["bar", null, "foo"])"));
+    // Some new values, neither a delta nor a replacement of the dictionary written
+    auto batch3 = MakeBatch(ArrayFromJSON(type, R"(["quux", "foo", "zzz"])"));
+    auto batch4 = MakeBatch(ArrayFromJSON(type, R"(["foo", "bar", "quux", "zzz"])"));
+    RecordBatchVector batches{batch1, batch2, batch3, batch4};
+
+    RecordBatchVector actual;
+    ASSERT_OK(RoundTrip(batches, &actual));
+    CheckStatsConsistent();
+    CheckBatchesLogical(batches, actual);
+    EXPECT_EQ(read_stats_.num_messages, 7);  // including schema message
+    EXPECT_EQ(read_stats_.num_record_batches, 4);
+    EXPECT_EQ(read_stats_.num_dictionary_batches, 2);
+    EXPECT_EQ(read_stats_.num_replaced_dictionaries, 0);
+    EXPECT_EQ(read_stats_.num_dictionary_deltas, 1);
+    // The last batch has the unified dictionary
+    AssertBatchesEqual(*batch4, *actual[3]);
+
+    // The unified dictionary must fit the index type
+    std::string values1 = "[0", values2 = "[100";
+    for (int i = 1; i < 100; ++i) {
+      values1 += ", " + std::to_string(i);
+      values2 += ", " + std::to_string(100 + i);
+    }
+    auto int_type = dictionary(int8(), int32());
+    CheckWritingFails({MakeBatch(ArrayFromJSON(int_type, values1 + "]")),
+                       MakeBatch(ArrayFromJSON(int_type, values2 + "]"))},
+                      1);
+  }
+
   Status RoundTrip(const RecordBatchVector& in_batches, RecordBatchVector* out_batches) {
     WriterHelper writer_helper;
     RETURN_NOT_OK(writer_helper.Init(in_batches[0]->schema(), write_options_));
@@ -2806,6 +2967,10 @@ TYPED_TEST(TestDictionaryReplacement, DeltaDictNestedInner) {
   this->TestDeltaDictNestedInner();
 }
 
+TYPED_TEST(TestDictionaryReplacement, UnifyDictionaryDeltas) {
+  this->TestUnifyDictionaryDeltas();
+}
+
 // ----------------------------------------------------------------------
 // Miscellanea
 
@@ -3076,18 +3241,28 @@ TEST(TestRecordBatchFileReaderIo, ReadSingleFieldInTheEnd) {
 
 TEST(TestRecordBatchFileReaderIo, SkipTheFieldInTheMiddle) {
   // read the bool field and the int64 field
-  // two IOs for body are expected, first for reading bool and the second for reading
-  // int64
-  // + 5 bool:  5 bits (1 byte)
+  // the skipped int32 field is a small hole, so the two reads are coalesced into one
+  // spanning from the bool field to the end of the int64 field
+  // + 5 bool:  5 bits      (aligned to  8 bytes)
+  // + 5 int32: 5 * 4 bytes (aligned to 24 bytes)
   // + 5 int64: 5 * 8 bytes
-  GetReadRecordBatchReadRanges({0, 2}, {1, 40});
+  GetReadRecordBatchReadRanges({0, 2}, {8 + 24 + 40});
 }
 
 TEST(TestRecordBatchFileReaderIo, ReadTwoContinuousFields) {
   // read the int32 field and the int64 field
-  // + 5 int32: 5 * 4 bytes
+  // the padding of the int32 field is coalesced into a single read
+  // + 5 int32: 5 * 4 bytes (aligned to 24 bytes)
   // + 5 int64: 5 * 8 bytes
-  GetReadRecordBatchReadRanges({1, 2}, {20, 40});
+  GetReadRecordBatchReadRanges({1, 2}, {24 + 40});
+}
+
+TEST(TestRecordBatchFileReaderIo, ReadDistantFieldsSeparately) {
+  // with enough rows the skipped int32 field is larger than the hole size limit
+  // of the default cache options, so the bool and int64 fields are read separately
+  // + 4096 bool:  4096 bits      (512 bytes)
+  // + 4096 int64: 4096 * 8 bytes (32768 bytes)
+  GetReadRecordBatchReadRanges(4096, {0, 2}, {512, 4096 * 8});
 }
 
 TEST(TestRecordBatchFileReaderIo, ReadTwoContinuousFieldsWithIoMerged) {
@@ -3100,6 +3275,273 @@ TEST(TestRecordBatchFileReaderIo, ReadTwoContinuousFieldsWithIoMerged) {
   GetReadRecordBatchReadRanges(64, {0, 1}, {8 + 64 * 4});
 }
 
+std::shared_ptr<Buffer> MakeRowIndexFile(const IpcWriteOptions& options) {
+  auto schema_ = schema({field("i", int64()), field("s", utf8())});
+  EXPECT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create(0));
+  EXPECT_OK_AND_ASSIGN(auto writer, MakeFileWriter(sink.get(), schema_, options));
+  for (const char* json : {R"([[0, "a"], [1, "c"], [2, null]])", "[]",
+                           R"([[3, "b"], [null, "d"]])", R"([[5, "e"], [6, "f"]])"}) {
+    ARROW_EXPECT_OK(writer->WriteRecordBatch(*RecordBatchFromJSON(schema_, json)));
+  }
+  ARROW_EXPECT_OK(writer->Close());
+  EXPECT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  return buffer;
+}
+
+TEST(TestRecordBatchWriter, PipelineWrites) {
+  auto schema_ = schema({field("i", int64()), field("s", utf8())});
+  random::RandomArrayGenerator rg(/*seed=*/0);
+  RecordBatchVector batches;
+  for (int i = 0; i < 10; ++i) {
+    batches.push_back(RecordBatch::Make(
+        schema_, 1000, {rg.Int64(1000, 0, 100), rg.String(1000, 0, 10, 0.1)}));
+  }
+  ASSERT_OK_AND_ASSIGN(auto expected, Table::FromRecordBatches(batches));
+
+  auto write_options = IpcWriteOptions::Defaults();
+  write_options.pipeline_writes = true;
+  if (util::Codec::IsAvailable(Compression::ZSTD)) {
+    ASSERT_OK_AND_ASSIGN(write_options.codec, util::Codec::Create(Compression::ZSTD));
+  }
+  for (bool is_file_format : {false, true}) {
+    ARROW_SCOPED_TRACE("is_file_format = ", is_file_format);
+    ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create(0));
+    std::shared_ptr<RecordBatchWriter> writer;
+    if (is_file_format) {
+      ASSERT_OK_AND_ASSIGN(writer, MakeFileWriter(sink, schema_, write_options));
+    } else {
+      ASSERT_OK_AND_ASSIGN(writer, MakeStreamWriter(sink, schema_, write_options));
+    }
+    for (const auto& batch : batches) {
+      ASSERT_OK(writer->WriteRecordBatch(*batch));
+    }
+    ASSERT_OK(writer->Close());
+    ASSERT_EQ(writer->stats().num_record_batches, 10);
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    std::shared_ptr<Table> table;
+    if (is_file_format) {
+      ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(
+                                            std::make_shared<io::BufferReader>(buffer)));
+      ASSERT_OK_AND_ASSIGN(table, reader->ToTable());
+    } else {
+      ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchStreamReader::Open(
+                                            std::make_shared<io::BufferReader>(buffer)));
+      ASSERT_OK_AND_ASSIGN(table, reader->ToTable());
+    }
+    AssertTablesEqual(*expected, *table);
+  }
+}
+
+TEST(TestRecordBatchWriter, CompressionDictionary) {
+  if (!util::Codec::IsAvailable(Compression::ZSTD)) {
+    GTEST_SKIP() << "ZSTD support not built";
+  }
+  // Many small batches of similar data
+  auto schema_ = schema({field("id", int64()), field("url", utf8())});
+  RecordBatchVector batches;
+  for (int i = 0; i < 100; ++i) {
+    std::string json = "[";
+    for (int j = 0; j < 20; ++j) {
+      const int id = (i * 7919 + j * 104729) % 1000;
+      json += std::string(j > 0 ? "," : "") + "{\"id\": " + std::to_string(i * 20 + j) +
+              ", \"url\": \"https://example.com/products/item-" + std::to_string(id) +
+              "?ref=search&page=" + std::to_string(id % 10) + "\"}";
+    }
+    json += "]";
+    batches.push_back(RecordBatchFromJSON(schema_, json));
+  }
+  ASSERT_OK_AND_ASSIGN(auto expected, Table::FromRecordBatches(batches));
+
+  auto write_options = IpcWriteOptions::Defaults();
+  ASSERT_OK_AND_ASSIGN(write_options.codec, util::Codec::Create(Compression::ZSTD));
+  auto write = [&](bool is_file_format) -> Result<std::shared_ptr<Buffer>> {
+    ARROW_ASSIGN_OR_RAISE(auto sink, io::BufferOutputStream::Create(0));
+    std::shared_ptr<RecordBatchWriter> writer;
+    if (is_file_format) {
+      ARROW_ASSIGN_OR_RAISE(writer, MakeFileWriter(sink, schema_, write_options));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(writer, MakeStreamWriter(sink, schema_, write_options));
+    }
+    for (const auto& batch : batches) {
+      RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+    }
+    RETURN_NOT_OK(writer->Close());
+    return sink->Finish();
+  };
+  ASSERT_OK_AND_ASSIGN(auto without_dictionary, write(/*is_file_format=*/false));
+
+  ASSERT_OK_AND_ASSIGN(
+      write_options.compression_dictionary,
+      TrainCompressionDictionary({batches.begin(), batches.begin() + 50},
+                                 /*max_dictionary_size=*/4096, write_options));
+  for (bool is_file_format : {false, true}) {
+    ARROW_SCOPED_TRACE("is_file_format = ", is_file_format);
+    ASSERT_OK_AND_ASSIGN(auto buffer, write(is_file_format));
+    if (!is_file_format) {
+      // The dictionary is only written once
+      ASSERT_LT(buffer->size(), without_dictionary->size());
+    }
+
+    std::shared_ptr<Table> table;
+    if (is_file_format) {
+      ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(
+                                            std::make_shared<io::BufferReader>(buffer)));
+      ASSERT_TRUE(reader->schema()->metadata()->Contains(internal::kZstdDictionaryKey));
+      ASSERT_OK_AND_ASSIGN(table, reader->ToTable());
+    } else {
+      ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchStreamReader::Open(
+                                            std::make_shared<io::BufferReader>(buffer)));
+      ASSERT_TRUE(reader->schema()->metadata()->Contains(internal::kZstdDictionaryKey));
+      ASSERT_OK_AND_ASSIGN(table, reader->ToTable());
+    }
+    AssertTablesEqual(*expected, *table, /*same_chunk_layout=*/true);
+  }
+
+  // Writing without the dictionary drops it from the schema
+  ASSERT_OK_AND_ASSIGN(auto buffer, write(/*is_file_format=*/false));
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchStreamReader::Open(
+                                        std::make_shared<io::BufferReader>(buffer)));
+  schema_ = reader->schema();
+  write_options.compression_dictionary.reset();
+  ASSERT_OK_AND_ASSIGN(buffer, write(/*is_file_format=*/false));
+  ASSERT_OK_AND_ASSIGN(reader, RecordBatchStreamReader::Open(
+                                   std::make_shared<io::BufferReader>(buffer)));
+  ASSERT_FALSE(reader->schema()->metadata()->Contains(internal::kZstdDictionaryKey));
+  ASSERT_OK_AND_ASSIGN(auto table, reader->ToTable());
+  AssertTablesEqual(*expected, *table);
+
+  // The dictionary requires the ZSTD codec
+  write_options.compression_dictionary = Buffer::FromString("dictionary");
+  write_options.codec.reset();
+  ASSERT_RAISES(Invalid, write(/*is_file_format=*/false));
+}
+
+TEST(TestRecordBatchWriter, SetCompressionEnabled) {
+  if (!util::Codec::IsAvailable(Compression::ZSTD)) {
+    GTEST_SKIP() << "ZSTD support not built";
+  }
+  // Compressible data, so that compressed batches are smaller
+  auto schema_ = schema({field("f0", int64())});
+  Int64Builder builder;
+  ASSERT_OK(builder.AppendEmptyValues(10000));
+  ASSERT_OK_AND_ASSIGN(auto zeros, builder.Finish());
+  auto batch = RecordBatch::Make(schema_, zeros->length(), {zeros});
+
+  auto write_options = IpcWriteOptions::Defaults();
+  ASSERT_OK_AND_ASSIGN(write_options.codec, util::Codec::Create(Compression::ZSTD));
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create(0));
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeStreamWriter(sink, schema_, write_options));
+  int64_t last_serialized_size = 0;
+  for (bool enabled : {true, false, false, true}) {
+    ARROW_SCOPED_TRACE("enabled = ", enabled);
+    ASSERT_OK(internal::SetCompressionEnabled(writer.get(), enabled));
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+    const int64_t serialized_size = writer->stats().total_serialized_body_size;
+    if (enabled) {
+      ASSERT_LT(serialized_size - last_serialized_size, zeros->length() * 8);
+    } else {
+      ASSERT_EQ(serialized_size - last_serialized_size, zeros->length() * 8);
+    }
+    last_serialized_size = serialized_size;
+  }
+  ASSERT_OK(writer->Close());
+
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchStreamReader::Open(
+                                        std::make_shared<io::BufferReader>(buffer)));
+  ASSERT_OK_AND_ASSIGN(auto batches, reader->ToRecordBatches());
+  ASSERT_EQ(4, batches.size());
+  for (const auto& read_batch : batches) {
+    AssertBatchesEqual(*batch, *read_batch);
+  }
+
+  // Compression can't be enabled without a codec
+  ASSERT_OK_AND_ASSIGN(sink, io::BufferOutputStream::Create(0));
+  ASSERT_OK_AND_ASSIGN(writer, MakeStreamWriter(sink, schema_));
+  ASSERT_RAISES(Invalid, internal::SetCompressionEnabled(writer.get(), true));
+  ASSERT_OK(internal::SetCompressionEnabled(writer.get(), false));
+}
+
+class TestRecordBatchFileReaderRowIndex : public ::testing::TestWithParam<bool> {};
+
+TEST_P(TestRecordBatchFileReaderRowIndex, ReadRows) {
+  auto options = IpcWriteOptions::Defaults();
+  options.write_row_index = GetParam();
+  auto buffer = MakeRowIndexFile(options);
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(
+                                        std::make_shared<io::BufferReader>(buffer)));
+  ASSERT_EQ(reader->metadata() != nullptr &&
+                reader->metadata()->Contains(internal::kRowOffsetsKey),
+            GetParam());
+  ASSERT_OK_AND_ASSIGN(auto all_rows, reader->ToTable());
+  ASSERT_OK_AND_EQ(7, reader->CountRows());
+
+  for (auto [offset, length] : std::vector<std::pair<int64_t, int64_t>>{
+           {0, 7}, {1, 3}, {3, 2}, {2, 4}, {4, 100}, {7, 1}, {3, 0}}) {
+    ARROW_SCOPED_TRACE("offset = ", offset, ", length = ", length);
+    ASSERT_OK_AND_ASSIGN(auto rows, reader->ReadRows(offset, length));
+    ASSERT_OK(rows->ValidateFull());
+    ASSERT_OK_AND_ASSIGN(auto expected, all_rows->CombineChunks());
+    AssertTablesEqual(*expected->Slice(offset, length), *rows,
+                      /*same_chunk_layout=*/false);
+  }
+  ASSERT_RAISES(Invalid, reader->ReadRows(-1, 2));
+}
+
+TEST_P(TestRecordBatchFileReaderRowIndex, SkipRecordBatches) {
+  auto options = IpcWriteOptions::Defaults();
+  if (GetParam()) {
+    options.statistics_fields = {0, 1};
+  }
+  auto buffer = MakeRowIndexFile(options);
+  io::BufferReader buffer_reader(buffer);
+  auto tracked = io::TrackedRandomAccessFile::Make(&buffer_reader);
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(tracked.get()));
+
+  ASSERT_OK_AND_ASSIGN(auto statistics, reader->GetRecordBatchStatistics(2));
+  ASSERT_EQ(statistics.size(), 2);
+  if (GetParam()) {
+    ASSERT_NE(statistics[0], nullptr);
+    ASSERT_EQ(statistics[0]->row_count, ArrayStatistics::CountType(int64_t{2}));
+    ASSERT_EQ(statistics[0]->min, ArrayStatistics::ValueType(int64_t{3}));
+    ASSERT_EQ(statistics[0]->max, ArrayStatistics::ValueType(int64_t{3}));
+    ASSERT_TRUE(statistics[0]->is_min_exact);
+    ASSERT_EQ(statistics[1]->min, ArrayStatistics::ValueType(std::string("b")));
+    ASSERT_EQ(statistics[1]->max, ArrayStatistics::ValueType(std::string("d")));
+    ASSERT_OK_AND_ASSIGN(statistics, reader->GetRecordBatchStatistics(1));
+    ASSERT_EQ(statistics[0]->min, std::nullopt);
+  } else {
+    ASSERT_EQ(statistics[0], nullptr);
+    ASSERT_EQ(statistics[1], nullptr);
+  }
+  ASSERT_RAISES(IndexError, reader->GetRecordBatchStatistics(4));
+
+  // Keep the batches which may have i > 2
+  const int64_t reads_before = tracked->num_reads();
+  ASSERT_OK_AND_ASSIGN(
+      auto rows,
+      reader->ReadRecordBatches(
+          [](const std::vector<std::shared_ptr<ArrayStatistics>>& statistics) {
+            if (statistics[0] == nullptr) return true;
+            return !statistics[0]->max.has_value() ||
+                   std::get<int64_t>(*statistics[0]->max) > 2;
+          }));
+  ASSERT_OK(rows->ValidateFull());
+  ASSERT_EQ(rows->num_rows(), GetParam() ? 4 : 7);
+  // Skipped record batches are not read
+  ASSERT_EQ(tracked->num_reads() - reads_before, GetParam() ? 4 : 8);
+
+  auto invalid_options = IpcWriteOptions::Defaults();
+  invalid_options.statistics_fields = {2};
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create(0));
+  ASSERT_RAISES(Invalid, MakeFileWriter(sink.get(), schema({field("i", int64())}),
+                                        invalid_options));
+}
+
+INSTANTIATE_TEST_SUITE_P(TestRecordBatchFileReaderRowIndex,
+                         TestRecordBatchFileReaderRowIndex, ::testing::Bool());
+
 constexpr static int kNumBatches = 10;
 // It can be difficult to know the exact size of the schema.  Instead we just make the
 // row data big enough that we can easily identify if a read is for a schema or for
@@ -3223,6 +3665,214 @@ INSTANTIATE_TEST_SUITE_P(PreBufferingTests, PreBufferingTest,
                            }
                          });
 
+TEST(TestSharedMemory, RoundTrip) {
+  auto maybe_pool = SharedMemoryPool::Make(1 << 20);
+  if (maybe_pool.status().IsNotImplemented()) {
+    GTEST_SKIP() << maybe_pool.status().message();
+  }
+  ASSERT_OK_AND_ASSIGN(auto pool, maybe_pool);
+  random::RandomArrayGenerator rng(/*seed=*/0);
+  auto schema_ = schema({field("i", int32()), field("s", utf8())});
+  auto in_pool = RecordBatch::Make(
+      schema_, 1000,
+      {rng.Int32(1000, 0, 100, 0.1, kDefaultBufferAlignment, pool.get()),
+       rng.String(1000, 0, 10, 0.1, kDefaultBufferAlignment, pool.get())});
+  auto out_of_pool = RecordBatch::Make(
+      schema_, 100, {rng.Int32(100, 0, 100, 0.1), rng.String(100, 0, 10, 0.1)});
+
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer,
+                       MakeSharedMemoryStreamWriter(sink.get(), schema_, pool));
+  const int64_t bytes_allocated = pool->bytes_allocated();
+  // The buffers allocated from the pool are not copied, the other ones are
+  ASSERT_OK(writer->WriteRecordBatch(*in_pool));
+  ASSERT_EQ(bytes_allocated, pool->bytes_allocated());
+  ASSERT_OK(writer->WriteRecordBatch(*out_of_pool));
+  ASSERT_GT(pool->bytes_allocated(), bytes_allocated);
+  ASSERT_OK(writer->Close());
+
+  ASSERT_OK_AND_ASSIGN(auto metadata, sink->Finish());
+  io::BufferReader source(metadata);
+  ASSERT_OK_AND_ASSIGN(auto reader, OpenSharedMemoryStreamReader(&source, pool->fd()));
+  ASSERT_OK_AND_ASSIGN(auto batches, reader->ToRecordBatches());
+  ASSERT_EQ(2, batches.size());
+  AssertBatchesEqual(*in_pool, *batches[0]);
+  AssertBatchesEqual(*out_of_pool, *batches[1]);
+}
+
+// Blocking reads from the read end of a pipe
+class PipeInputStream : public io::InputStream {
+ public:
+  explicit PipeInputStream(::arrow::internal::FileDescriptor fd) : fd_(std::move(fd)) {}
+
+  Status Close() override { return fd_.Close(); }
+  bool closed() const override { return fd_.closed(); }
+  Result<int64_t> Tell() const override { return position_; }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    int64_t total = 0;
+    while (total < nbytes) {
+      ARROW_ASSIGN_OR_RAISE(auto bytes_read,
+                            ::arrow::internal::FileRead(
+                                fd_.fd(), static_cast<uint8_t*>(out) + total,
+                                nbytes - total));
+      if (bytes_read == 0) break;
+      total += bytes_read;
+    }
+    position_ += total;
+    return total;
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes));
+    ARROW_ASSIGN_OR_RAISE(auto bytes_read, Read(nbytes, buffer->mutable_data()));
+    RETURN_NOT_OK(buffer->Resize(bytes_read));
+    return std::shared_ptr<Buffer>(std::move(buffer));
+  }
+
+ private:
+  ::arrow::internal::FileDescriptor fd_;
+  int64_t position_ = 0;
+};
+
+TEST(TestSharedMemory, ReuseReleasedMemory) {
+  // Many more batches than fit in the pool, each released by the reader once read
+  auto maybe_pool = SharedMemoryPool::Make(64 * 1024, /*max_in_flight=*/4);
+  if (maybe_pool.status().IsNotImplemented()) {
+    GTEST_SKIP() << maybe_pool.status().message();
+  }
+  ASSERT_OK_AND_ASSIGN(auto pool, maybe_pool);
+  random::RandomArrayGenerator rng(/*seed=*/0);
+  auto batch = RecordBatch::Make(schema({field("i", int64())}), 1000,
+                                 {rng.Int64(1000, 0, 1000, /*null_probability=*/0)});
+
+  ASSERT_OK_AND_ASSIGN(auto pipe, ::arrow::internal::CreatePipe());
+  ASSERT_OK_AND_ASSIGN(auto sink, io::FileOutputStream::Open(pipe.wfd.Detach()));
+  PipeInputStream source(std::move(pipe.rfd));
+  constexpr int kNumBatches = 100;
+  std::thread writer_thread([&] {
+    ASSERT_OK_AND_ASSIGN(auto writer,
+                         MakeSharedMemoryStreamWriter(sink.get(), batch->schema(), pool));
+    for (int i = 0; i < kNumBatches; ++i) {
+      ASSERT_OK(writer->WriteRecordBatch(*batch));
+    }
+    ASSERT_OK(writer->Close());
+    ASSERT_OK(sink->Close());
+  });
+
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       OpenSharedMemoryStreamReader(&source, pool->fd()));
+  int num_batches = 0;
+  while (true) {
+    ASSERT_OK_AND_ASSIGN(auto read_batch, reader->Next());
+    if (read_batch == nullptr) break;
+    AssertBatchesEqual(*batch, *read_batch);
+    ++num_batches;
+  }
+  writer_thread.join();
+  ASSERT_EQ(kNumBatches, num_batches);
+}
+
+TEST(TestSharedMemory, ReaderRetainsTooManyBatches) {
+  // The reader keeps every batch, which only works for up to max_in_flight batches
+  auto maybe_pool = SharedMemoryPool::Make(64 * 1024, /*max_in_flight=*/2);
+  if (maybe_pool.status().IsNotImplemented()) {
+    GTEST_SKIP() << maybe_pool.status().message();
+  }
+  ASSERT_OK_AND_ASSIGN(auto pool, maybe_pool);
+  random::RandomArrayGenerator rng(/*seed=*/0);
+  auto batch = RecordBatch::Make(schema({field("i", int64())}), 100,
+                                 {rng.Int64(100, 0, 1000, /*null_probability=*/0)});
+
+  ASSERT_OK_AND_ASSIGN(auto pipe, ::arrow::internal::CreatePipe());
+  ASSERT_OK_AND_ASSIGN(auto sink, io::FileOutputStream::Open(pipe.wfd.Detach()));
+  PipeInputStream source(std::move(pipe.rfd));
+  auto shm_options = SharedMemoryWriteOptions::Defaults();
+  shm_options.wait_timeout = 0.1;
+  std::thread writer_thread([&] {
+    ASSERT_OK_AND_ASSIGN(
+        auto writer,
+        MakeSharedMemoryStreamWriter(sink.get(), batch->schema(), pool,
+                                     IpcWriteOptions::Defaults(), shm_options));
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+    EXPECT_RAISES_WITH_MESSAGE_THAT(IOError, ::testing::HasSubstr("Timed out"),
+                                    writer->WriteRecordBatch(*batch));
+    ASSERT_OK(writer->Close());
+    ASSERT_OK(sink->Close());
+  });
+
+  ASSERT_OK_AND_ASSIGN(auto reader, OpenSharedMemoryStreamReader(&source, pool->fd()));
+  ASSERT_OK_AND_ASSIGN(auto batches, reader->ToRecordBatches());
+  writer_thread.join();
+  ASSERT_EQ(2, batches.size());
+}
+
+TEST(TestSharedMemory, CancelWaitForReader) {
+  auto maybe_pool = SharedMemoryPool::Make(64 * 1024, /*max_in_flight=*/1);
+  if (maybe_pool.status().IsNotImplemented()) {
+    GTEST_SKIP() << maybe_pool.status().message();
+  }
+  ASSERT_OK_AND_ASSIGN(auto pool, maybe_pool);
+  auto batch = RecordBatchFromJSON(schema({field("i", int64())}), "[[1], [2]]");
+
+  StopSource stop_source;
+  auto shm_options = SharedMemoryWriteOptions::Defaults();
+  shm_options.wait_timeout = -1;
+  shm_options.stop_token = stop_source.token();
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeSharedMemoryStreamWriter(
+                                        sink.get(), batch->schema(), pool,
+                                        IpcWriteOptions::Defaults(), shm_options));
+  // Nothing reads the first batch, so the second one waits for its slot
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  stop_source.RequestStop();
+  ASSERT_RAISES(Cancelled, writer->WriteRecordBatch(*batch));
+}
+
+#ifdef __linux__
+TEST(TestSharedMemory, ReaderProcessExits) {
+  auto maybe_pool = SharedMemoryPool::Make(64 * 1024, /*max_in_flight=*/1);
+  if (maybe_pool.status().IsNotImplemented()) {
+    GTEST_SKIP() << maybe_pool.status().message();
+  }
+  ASSERT_OK_AND_ASSIGN(auto pool, maybe_pool);
+  auto batch = RecordBatchFromJSON(schema({field("i", int64())}), "[[1], [2]]");
+  ASSERT_OK_AND_ASSIGN(auto pipe, ::arrow::internal::CreatePipe());
+
+  auto child_pid = fork();
+  if (child_pid == -1) {
+    ASSERT_OK(::arrow::internal::IOErrorFromErrno(errno, "Error calling fork(): "));
+  }
+  if (child_pid == 0) {
+    // Child: read the first batch, then exit without releasing it
+    ARROW_UNUSED(pipe.wfd.Close());
+    PipeInputStream source(std::move(pipe.rfd));
+    auto maybe_reader = OpenSharedMemoryStreamReader(&source, pool->fd());
+    if (!maybe_reader.ok()) std::_Exit(1);
+    auto maybe_batch = (*maybe_reader)->Next();
+    std::_Exit(maybe_batch.ok() && *maybe_batch != nullptr ? 0 : 1);
+  }
+
+  // Parent
+  ASSERT_OK(pipe.rfd.Close());
+  ASSERT_OK_AND_ASSIGN(auto sink, io::FileOutputStream::Open(pipe.wfd.Detach()));
+  auto shm_options = SharedMemoryWriteOptions::Defaults();
+  shm_options.wait_timeout = 60;
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeSharedMemoryStreamWriter(
+                                        sink.get(), batch->schema(), pool,
+                                        IpcWriteOptions::Defaults(), shm_options));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  // The child is not reaped yet: the writer must notice it is a zombie
+  EXPECT_RAISES_WITH_MESSAGE_THAT(IOError, ::testing::HasSubstr("exited"),
+                                  writer->WriteRecordBatch(*batch));
+  int child_status;
+  ASSERT_EQ(child_pid, waitpid(child_pid, &child_status, 0));
+  ASSERT_TRUE(WIFEXITED(child_status));
+  ASSERT_EQ(0, WEXITSTATUS(child_status));
+}
+#endif
+
 Result<std::shared_ptr<RecordBatch>> MakeBatchWithDictionaries(const int length) {
   auto dict_type = dictionary(int32(), int32());
   auto schema_ = ::arrow::schema(
@@ -20,8 +20,11 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <deque>
+#include <limits>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -37,9 +40,11 @@
 #include "arrow/io/caching.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata_internal.h"
 #include "arrow/ipc/reader_internal.h"
+#include "arrow/ipc/row_index_internal.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/record_batch.h"
 #include "arrow/sparse_tensor.h"
@@ -48,6 +53,7 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/align_util.h"
+#include "arrow/util/base64.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
@@ -100,7 +106,7 @@ Status InvalidMessageType(MessageType expected, MessageType actual) {
 
 #define CHECK_HAS_BODY(message)                                       \
   do {                                                                \
-    if ((message).body() == nullptr) {                                \
+    if ((message).body_chunks().empty()) {                            \
       return Status::IOError("Expected body in IPC message of type ", \
                              FormatMessageType((message).type()));    \
     }                                                                 \
@@ -114,6 +120,16 @@ Status InvalidMessageType(MessageType expected, MessageType actual) {
     }                                                                   \
   } while (0)
 
+// Open the body of a message for reading its buffers, zero-copy as long as they do
+// not straddle the chunks the body is made of
+Result<std::shared_ptr<io::RandomAccessFile>> OpenMessageBody(const Message& message) {
+  const auto& chunks = message.body_chunks();
+  if (chunks.size() > 1) {
+    return std::make_shared<io::ChunkedBufferReader>(chunks);
+  }
+  return Buffer::GetReader(message.body());
+}
+
 // ----------------------------------------------------------------------
 // Record batch read path
 
@@ -132,6 +148,10 @@ struct IpcReadContext {
 
   const IpcReadOptions& options;
 
+  /// \brief Codec decompressing the ZSTD buffers, if the schema embeds the dictionary
+  /// they are compressed with
+  std::shared_ptr<util::Codec> zstd_codec;
+
   MetadataVersion metadata_version;
 
   Compression::type compression;
@@ -531,45 +551,96 @@ class ArrayLoader {
   ArrayData* out_ = nullptr;
 };
 
-Result<std::shared_ptr<Buffer>> DecompressBuffer(const std::shared_ptr<Buffer>& buf,
-                                                 const IpcReadOptions& options,
-                                                 util::Codec* codec) {
-  if (buf == nullptr || buf->size() == 0) {
-    return buf;
-  }
-
-  if (buf->size() < 8) {
-    return Status::Invalid(
-        "Likely corrupted message, compressed buffers "
-        "are larger than 8 bytes by construction");
-  }
-
-  const uint8_t* data = buf->data();
-  int64_t compressed_size = buf->size() - sizeof(int64_t);
-  int64_t uncompressed_size = bit_util::FromLittleEndian(util::SafeLoadAs<int64_t>(data));
+// A frame of compressed data and the size of its decompressed content
+struct CompressedFrame {
+  int64_t offset;
+  int64_t length;
+  int64_t decompressed_length;
+};
 
-  if (uncompressed_size == -1) {
-    return SliceBuffer(buf, sizeof(int64_t), compressed_size);
+// Find the frames of ZSTD-compressed data (see RFC 8878), which the writer emits for
+// large buffers (see IpcWriteOptions::compression_chunk_size).  Returns an empty vector
+// if the data is a single frame or cannot be split, e.g. if a frame header does not
+// record the size of its content.
+std::vector<CompressedFrame> FindZstdFrames(const uint8_t* data, int64_t length) {
+  constexpr uint32_t kFrameMagic = 0xFD2FB528;
+  constexpr int kDictionaryIdSizes[] = {0, 1, 2, 4};
+
+  std::vector<CompressedFrame> frames;
+  int64_t position = 0;
+  while (position < length) {
+    const int64_t frame_offset = position;
+    if (length - position < 5 ||
+        bit_util::FromLittleEndian(util::SafeLoadAs<uint32_t>(data + position)) !=
+            kFrameMagic) {
+      return {};
+    }
+    position += 4;
+
+    // Frame header
+    const uint8_t descriptor = data[position++];
+    const int content_size_flag = descriptor >> 6;
+    const bool single_segment = (descriptor & 0x20) != 0;
+    const bool has_checksum = (descriptor & 0x04) != 0;
+    const int content_size_length =
+        content_size_flag == 0 ? (single_segment ? 1 : 0) : (1 << content_size_flag);
+    if (content_size_length == 0) {
+      return {};
+    }
+    const int64_t header_length = (single_segment ? 0 : 1) +
+                                  kDictionaryIdSizes[descriptor & 0x03] +
+                                  content_size_length;
+    if (length - position < header_length) {
+      return {};
+    }
+    position += header_length - content_size_length;
+    uint64_t content_size = 0;
+    for (int i = 0; i < content_size_length; ++i) {
+      content_size |= static_cast<uint64_t>(data[position + i]) << (8 * i);
+    }
+    if (content_size_length == 2) {
+      content_size += 256;
+    }
+    position += content_size_length;
+    if (content_size > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+      return {};
+    }
+
+    // Blocks
+    bool last_block = false;
+    while (!last_block) {
+      if (length - position < 3) {
+        return {};
+      }
+      const uint32_t block_header = data[position] | (data[position + 1] << 8) |
+                                    (data[position + 2] << 16);
+      position += 3;
+      last_block = (block_header & 1) != 0;
+      const uint32_t block_type = (block_header >> 1) & 3;
+      // RLE blocks hold a single byte, and type 3 is reserved
+      const int64_t block_length = block_type == 1 ? 1 : (block_header >> 3);
+      if (block_type == 3 || length - position < block_length) {
+        return {};
+      }
+      position += block_length;
+    }
+    if (has_checksum) {
+      if (length - position < 4) {
+        return {};
+      }
+      position += 4;
+    }
+    frames.push_back({frame_offset, position - frame_offset,
+                      static_cast<int64_t>(content_size)});
   }
-
-  ARROW_ASSIGN_OR_RAISE(auto uncompressed,
-                        AllocateBuffer(uncompressed_size, options.memory_pool));
-
-  ARROW_ASSIGN_OR_RAISE(
-      int64_t actual_decompressed,
-      codec->Decompress(compressed_size, data + sizeof(int64_t), uncompressed_size,
-                        uncompressed->mutable_data()));
-  if (actual_decompressed != uncompressed_size) {
-    return Status::Invalid("Failed to fully decompress buffer, expected ",
-                           uncompressed_size, " bytes but decompressed ",
-                           actual_decompressed);
+  if (frames.size() < 2) {
+    return {};
   }
-
-  // R build with openSUSE155 requires an explicit shared_ptr construction
-  return std::shared_ptr<Buffer>(std::move(uncompressed));
+  return frames;
 }
 
 Status DecompressBuffers(Compression::type compression, const IpcReadOptions& options,
+                         const std::shared_ptr<util::Codec>& zstd_codec,
                          ArrayDataVector* fields) {
   struct BufferAccumulator {
     using BufferPtrVector = std::vector<std::shared_ptr<Buffer>*>;
@@ -594,15 +665,87 @@ Status DecompressBuffers(Compression::type compression, const IpcReadOptions& op
   // Flatten all buffers
   auto buffers = BufferAccumulator{}.Get(*fields);
 
-  std::unique_ptr<util::Codec> codec;
-  ARROW_ASSIGN_OR_RAISE(codec, util::Codec::Create(compression));
+  std::shared_ptr<util::Codec> codec =
+      compression == Compression::ZSTD ? zstd_codec : nullptr;
+  if (codec == nullptr) {
+    ARROW_ASSIGN_OR_RAISE(codec, util::Codec::Create(compression));
+  }
 
-  return ::arrow::internal::OptionalParallelFor(
-      options.use_threads, static_cast<int>(buffers.size()), [&](int i) {
-        ARROW_ASSIGN_OR_RAISE(*buffers[i],
-                              DecompressBuffer(*buffers[i], options, codec.get()));
+  // Compressed data decompressed on its own: a whole buffer or, for buffers made of
+  // several ZSTD frames, one of the frames so that they are decompressed in parallel
+  struct DecompressionTask {
+    const uint8_t* input;
+    int64_t input_length;
+    uint8_t* output;
+    int64_t output_length;
+  };
+  std::vector<DecompressionTask> tasks;
+  std::vector<std::shared_ptr<Buffer>> uncompressed_buffers(buffers.size());
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    const auto& buf = *buffers[i];
+    if (buf == nullptr || buf->size() == 0) {
+      continue;
+    }
+    if (buf->size() < 8) {
+      return Status::Invalid(
+          "Likely corrupted message, compressed buffers "
+          "are larger than 8 bytes by construction");
+    }
+
+    const uint8_t* data = buf->data() + sizeof(int64_t);
+    int64_t compressed_size = buf->size() - sizeof(int64_t);
+    int64_t uncompressed_size =
+        bit_util::FromLittleEndian(util::SafeLoadAs<int64_t>(buf->data()));
+
+    if (uncompressed_size == -1) {
+      *buffers[i] = SliceBuffer(buf, sizeof(int64_t), compressed_size);
+      continue;
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto uncompressed,
+                          AllocateBuffer(uncompressed_size, options.memory_pool));
+    uint8_t* output = uncompressed->mutable_data();
+    uncompressed_buffers[i] = std::move(uncompressed);
+
+    std::vector<CompressedFrame> frames;
+    if (options.use_threads && compression == Compression::ZSTD) {
+      frames = FindZstdFrames(data, compressed_size);
+    }
+    int64_t frames_length = 0;
+    for (const auto& frame : frames) {
+      frames_length += frame.decompressed_length;
+    }
+    if (frames.empty() || frames_length != uncompressed_size) {
+      tasks.push_back({data, compressed_size, output, uncompressed_size});
+      continue;
+    }
+    for (const auto& frame : frames) {
+      tasks.push_back({data + frame.offset, frame.length, output,
+                       frame.decompressed_length});
+      output += frame.decompressed_length;
+    }
+  }
+
+  RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+      options.use_threads, static_cast<int>(tasks.size()), [&](int i) {
+        const DecompressionTask& task = tasks[i];
+        ARROW_ASSIGN_OR_RAISE(int64_t actual_decompressed,
+                              codec->Decompress(task.input_length, task.input,
+                                                task.output_length, task.output));
+        if (actual_decompressed != task.output_length) {
+          return Status::Invalid("Failed to fully decompress buffer, expected ",
+                                 task.output_length, " bytes but decompressed ",
+                                 actual_decompressed);
+        }
         return Status::OK();
-      });
+      }));
+
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    if (uncompressed_buffers[i] != nullptr) {
+      *buffers[i] = std::move(uncompressed_buffers[i]);
+    }
+  }
+  return Status::OK();
 }
 
 Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
@@ -650,8 +793,8 @@ Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
     filtered_columns = std::move(columns);
   }
   if (context.compression != Compression::UNCOMPRESSED) {
-    RETURN_NOT_OK(
-        DecompressBuffers(context.compression, context.options, &filtered_columns));
+    RETURN_NOT_OK(DecompressBuffers(context.compression, context.options,
+                                    context.zstd_codec, &filtered_columns));
   }
 
   // swap endian in a set of ArrayData if necessary (swap_endian == true)
@@ -805,12 +948,28 @@ Status GetInclusionMaskAndOutSchema(const std::shared_ptr<Schema>& full_schema,
   return Status::OK();
 }
 
+// Make the codec decompressing with the ZSTD dictionary embedded in the schema
+// metadata, or return null if there is none
+Result<std::shared_ptr<util::Codec>> MakeZstdDictionaryCodec(const Schema& schema) {
+  const auto& metadata = schema.metadata();
+  const int index = metadata ? metadata->FindKey(internal::kZstdDictionaryKey) : -1;
+  if (index < 0 || !util::Codec::IsAvailable(Compression::ZSTD)) {
+    return nullptr;
+  }
+  util::ZstdCodecOptions codec_options;
+  codec_options.dictionary =
+      Buffer::FromString(util::base64_decode(metadata->value(index)));
+  return util::Codec::Create(Compression::ZSTD, codec_options);
+}
+
 Status UnpackSchemaMessage(const void* opaque_schema, const IpcReadOptions& options,
                            DictionaryMemo* dictionary_memo,
                            std::shared_ptr<Schema>* schema,
                            std::shared_ptr<Schema>* out_schema,
-                           std::vector<bool>* field_inclusion_mask, bool* swap_endian) {
+                           std::vector<bool>* field_inclusion_mask, bool* swap_endian,
+                           std::shared_ptr<util::Codec>* zstd_codec) {
   RETURN_NOT_OK(internal::GetSchema(opaque_schema, dictionary_memo, schema));
+  ARROW_ASSIGN_OR_RAISE(*zstd_codec, MakeZstdDictionaryCodec(**schema));
 
   // If we are selecting only certain fields, populate the inclusion mask now
   // for fast lookups
@@ -829,12 +988,13 @@ Status UnpackSchemaMessage(const Message& message, const IpcReadOptions& options
                            DictionaryMemo* dictionary_memo,
                            std::shared_ptr<Schema>* schema,
                            std::shared_ptr<Schema>* out_schema,
-                           std::vector<bool>* field_inclusion_mask, bool* swap_endian) {
+                           std::vector<bool>* field_inclusion_mask, bool* swap_endian,
+                           std::shared_ptr<util::Codec>* zstd_codec) {
   CHECK_MESSAGE_TYPE(MessageType::SCHEMA, message.type());
   CHECK_HAS_NO_BODY(message);
 
   return UnpackSchemaMessage(message.header(), options, dictionary_memo, schema,
-                             out_schema, field_inclusion_mask, swap_endian);
+                             out_schema, field_inclusion_mask, swap_endian, zstd_codec);
 }
 
 Status ReadDictionary(const Buffer& metadata, const IpcReadContext& context,
@@ -876,7 +1036,8 @@ Status ReadDictionary(const Buffer& metadata, const IpcReadContext& context,
 
   if (compression != Compression::UNCOMPRESSED) {
     ArrayDataVector dict_fields{dict_data};
-    RETURN_NOT_OK(DecompressBuffers(compression, context.options, &dict_fields));
+    RETURN_NOT_OK(DecompressBuffers(compression, context.options, context.zstd_codec,
+                                    &dict_fields));
   }
 
   // swap endian in dict_data if necessary (swap_endian == true)
@@ -904,7 +1065,7 @@ Status ReadDictionary(const Message& message, const IpcReadContext& context,
   // Only invoke this method if we already know we have a dictionary message
   DCHECK_EQ(message.type(), MessageType::DICTIONARY_BATCH);
   CHECK_HAS_BODY(message);
-  ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message.body()));
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenMessageBody(message));
   return ReadDictionary(*message.metadata(), context, kind, reader.get());
 }
 
@@ -918,6 +1079,7 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
   // Empty means do not use
   std::vector<bool> inclusion_mask;
   IpcReadContext context(const_cast<DictionaryMemo*>(dictionary_memo), options, false);
+  ARROW_ASSIGN_OR_RAISE(context.zstd_codec, MakeZstdDictionaryCodec(*schema));
   RETURN_NOT_OK(GetInclusionMaskAndOutSchema(schema, context.options.included_fields,
                                              &inclusion_mask, &out_schema));
   ARROW_ASSIGN_OR_RAISE(
@@ -932,7 +1094,7 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
   std::unique_ptr<Message> message;
   RETURN_NOT_OK(ReadContiguousPayload(file, &message));
   CHECK_HAS_BODY(*message);
-  ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenMessageBody(*message));
   return ReadRecordBatch(*message->metadata(), schema, dictionary_memo, options,
                          reader.get());
 }
@@ -942,11 +1104,21 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
     const DictionaryMemo* dictionary_memo, const IpcReadOptions& options) {
   CHECK_MESSAGE_TYPE(MessageType::RECORD_BATCH, message.type());
   CHECK_HAS_BODY(message);
-  ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message.body()));
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenMessageBody(message));
   return ReadRecordBatch(*message.metadata(), schema, dictionary_memo, options,
                          reader.get());
 }
 
+namespace {
+
+// Readers allocate from the "ipc" child of a TrackingMemoryPool, if given one
+IpcReadOptions WithIpcMemoryPool(IpcReadOptions options) {
+  options.memory_pool = ChildMemoryPool(options.memory_pool, "ipc");
+  return options;
+}
+
+}  // namespace
+
 // Streaming format decoder
 class StreamDecoderInternal : public MessageDecoderListener {
  public:
@@ -960,7 +1132,7 @@ class StreamDecoderInternal : public MessageDecoderListener {
   explicit StreamDecoderInternal(std::shared_ptr<Listener> listener,
                                  IpcReadOptions options)
       : listener_(std::move(listener)),
-        options_(std::move(options)),
+        options_(WithIpcMemoryPool(std::move(options))),
         state_(State::SCHEMA),
         field_inclusion_mask_(),
         num_required_initial_dictionaries_(0),
@@ -1016,7 +1188,7 @@ class StreamDecoderInternal : public MessageDecoderListener {
   Status OnSchemaMessageDecoded(std::unique_ptr<Message> message) {
     RETURN_NOT_OK(UnpackSchemaMessage(*message, options_, &dictionary_memo_, &schema_,
                                       &filtered_schema_, &field_inclusion_mask_,
-                                      &swap_endian_));
+                                      &swap_endian_, &zstd_codec_));
 
     num_required_initial_dictionaries_ = dictionary_memo_.fields().num_dicts();
     num_read_initial_dictionaries_ = 0;
@@ -1049,8 +1221,9 @@ class StreamDecoderInternal : public MessageDecoderListener {
       return ReadDictionary(*message);
     } else {
       CHECK_HAS_BODY(*message);
-      ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+      ARROW_ASSIGN_OR_RAISE(auto reader, OpenMessageBody(*message));
       IpcReadContext context(&dictionary_memo_, options_, swap_endian_);
+      context.zstd_codec = zstd_codec_;
       ARROW_ASSIGN_OR_RAISE(
           auto batch_with_metadata,
           ReadRecordBatchInternal(*message->metadata(), schema_, field_inclusion_mask_,
@@ -1064,6 +1237,7 @@ class StreamDecoderInternal : public MessageDecoderListener {
   Status ReadDictionary(const Message& message) {
     DictionaryKind kind;
     IpcReadContext context(&dictionary_memo_, options_, swap_endian_);
+    context.zstd_codec = zstd_codec_;
     RETURN_NOT_OK(::arrow::ipc::ReadDictionary(message, context, &kind));
     ++stats_.num_dictionary_batches;
     switch (kind) {
@@ -1090,6 +1264,7 @@ class StreamDecoderInternal : public MessageDecoderListener {
   std::shared_ptr<Schema> filtered_schema_;
   ReadStats stats_;
   bool swap_endian_;
+  std::shared_ptr<util::Codec> zstd_codec_;
 };
 
 // ----------------------------------------------------------------------
@@ -1258,11 +1433,13 @@ class WholeIpcFileRecordBatchGenerator {
   explicit WholeIpcFileRecordBatchGenerator(
       std::shared_ptr<RecordBatchFileReaderImpl> state,
       std::shared_ptr<io::internal::ReadRangeCache> cached_source,
-      const io::IOContext& io_context, arrow::internal::Executor* executor)
+      const io::IOContext& io_context, arrow::internal::Executor* executor,
+      std::optional<io::CacheOptions> coalesce_options = std::nullopt)
       : state_(std::move(state)),
         cached_source_(std::move(cached_source)),
         io_context_(io_context),
         executor_(executor),
+        coalesce_options_(std::move(coalesce_options)),
         index_(0) {}
 
   Future<Item> operator()();
@@ -1272,14 +1449,27 @@ class WholeIpcFileRecordBatchGenerator {
       RecordBatchFileReaderImpl* state,
       std::vector<std::shared_ptr<Message>> dictionary_messages);
   static Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
-      RecordBatchFileReaderImpl* state, Message* message);
+      RecordBatchFileReaderImpl* state, const IpcReadOptions& options,
+      Message* message);
 
  private:
+  // Start reading the record batch at index_ and the ones read ahead of it
+  Status ReadAhead();
+  Status ReadCoalesced(const std::vector<FileBlock>& blocks);
+
   std::shared_ptr<RecordBatchFileReaderImpl> state_;
   std::shared_ptr<io::internal::ReadRangeCache> cached_source_;
   io::IOContext io_context_;
   arrow::internal::Executor* executor_;
+  // If set, the reads of the batches read ahead are coalesced with these options
+  std::optional<io::CacheOptions> coalesce_options_;
   int index_;
+  // The index of the next record batch to start reading
+  int read_index_ = 0;
+  // The reads of the record batches from index_ to read_index_, and their sizes
+  std::deque<Future<std::shared_ptr<Message>>> pending_reads_;
+  std::deque<int64_t> pending_sizes_;
+  int64_t pending_bytes_ = 0;
   // Odd Future type, but this lets us use All() easily
   Future<> read_dictionaries_;
 };
@@ -1315,31 +1505,6 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return internal::GetMetadataVersion(footer_->version());
   }
 
-  static Status LoadFieldsSubset(const flatbuf::RecordBatch* metadata,
-                                 const IpcReadOptions& options,
-                                 io::RandomAccessFile* file,
-                                 const std::shared_ptr<Schema>& schema,
-                                 const std::vector<bool>* inclusion_mask,
-                                 MetadataVersion metadata_version = MetadataVersion::V5) {
-    ArrayLoader loader(metadata, metadata_version, options, file);
-    for (int i = 0; i < schema->num_fields(); ++i) {
-      const Field& field = *schema->field(i);
-      if (!inclusion_mask || (*inclusion_mask)[i]) {
-        // Read field
-        ArrayData column;
-        RETURN_NOT_OK(loader.Load(&field, &column));
-        if (metadata->length() != column.length) {
-          return Status::IOError("Array length did not match record batch length");
-        }
-      } else {
-        // Skip field. This logic must be executed to advance the state of the
-        // loader to the next field
-        RETURN_NOT_OK(loader.SkipField(&field));
-      }
-    }
-    return Status::OK();
-  }
-
   Future<std::shared_ptr<RecordBatch>> ReadRecordBatchAsync(int i) {
     DCHECK_GE(i, 0);
     DCHECK_LT(i, num_record_batches());
@@ -1379,23 +1544,35 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
 
     RETURN_NOT_OK(WaitForDictionaryReadFinished());
 
-    FieldsLoaderFunction fields_loader = {};
+    ARROW_ASSIGN_OR_RAISE(auto block, GetRecordBatchBlock(i));
     if (!field_inclusion_mask_.empty()) {
-      auto& schema = schema_;
-      auto& inclusion_mask = field_inclusion_mask_;
-      auto& read_options = options_;
-      fields_loader = [schema, inclusion_mask, read_options](const void* metadata,
-                                                             io::RandomAccessFile* file) {
-        return LoadFieldsSubset(static_cast<const flatbuf::RecordBatch*>(metadata),
-                                read_options, file, schema, &inclusion_mask);
-      };
+      // Only read the metadata here: the buffers of the selected fields are then
+      // read through a range cache, coalescing the neighbouring ones, rather than
+      // reading (or copying) the whole body.
+      RETURN_NOT_OK(CheckAligned(block));
+      ARROW_ASSIGN_OR_RAISE(auto metadata,
+                            file_->ReadAt(block.offset, block.metadata_length));
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Message> metadata_message,
+                            ReadMessage(std::move(metadata), nullptr));
+      stats_.num_messages.fetch_add(1, std::memory_order_relaxed);
+      auto result = ReadRecordBatchBuffers(i, metadata_message).result();
+      ARROW_ASSIGN_OR_RAISE(auto batch, result);
+      stats_.num_record_batches.fetch_add(1, std::memory_order_relaxed);
+      ARROW_ASSIGN_OR_RAISE(auto message, GetFlatbufMessage(metadata_message));
+      std::shared_ptr<KeyValueMetadata> custom_metadata;
+      if (message->custom_metadata() != nullptr) {
+        RETURN_NOT_OK(
+            internal::GetKeyValueMetadata(message->custom_metadata(), &custom_metadata));
+      }
+      return RecordBatchWithMetadata{std::move(batch), std::move(custom_metadata)};
     }
-    ARROW_ASSIGN_OR_RAISE(auto block, GetRecordBatchBlock(i));
-    ARROW_ASSIGN_OR_RAISE(auto message, ReadMessageFromBlock(block, fields_loader));
+
+    ARROW_ASSIGN_OR_RAISE(auto message, ReadMessageFromBlock(block));
 
     CHECK_HAS_BODY(*message);
-    ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+    ARROW_ASSIGN_OR_RAISE(auto reader, OpenMessageBody(*message));
     IpcReadContext context(&dictionary_memo_, options_, swap_endian_);
+    context.zstd_codec = zstd_codec_;
     ARROW_ASSIGN_OR_RAISE(
         auto batch_with_metadata,
         ReadRecordBatchInternal(*message->metadata(), schema_, field_inclusion_mask_,
@@ -1405,22 +1582,76 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   }
 
   Result<int64_t> CountRows() override {
-    int64_t total = 0;
-    for (int i = 0; i < num_record_batches(); i++) {
-      ARROW_ASSIGN_OR_RAISE(auto block, GetRecordBatchBlock(i));
-      ARROW_ASSIGN_OR_RAISE(auto outer_message, ReadMessageFromBlock(block));
-      auto metadata = outer_message->metadata();
-      const flatbuf::Message* message = nullptr;
-      RETURN_NOT_OK(
-          internal::VerifyMessage(metadata->data(), metadata->size(), &message));
-      auto batch = message->header_as_RecordBatch();
-      if (batch == nullptr) {
-        return Status::IOError(
-            "Header-type of flatbuffer-encoded Message is not RecordBatch.");
+    RETURN_NOT_OK(EnsureRowOffsets());
+    return row_offsets_->back();
+  }
+
+  Result<std::shared_ptr<Table>> ReadRows(int64_t offset, int64_t length) override {
+    if (offset < 0 || length < 0) {
+      return Status::Invalid("Invalid row range: offset ", offset, ", length ", length);
+    }
+    RETURN_NOT_OK(EnsureRowOffsets());
+    const std::vector<int64_t>& row_offsets = *row_offsets_;
+    const int64_t end = offset + std::min(length, row_offsets.back() - offset);
+
+    RecordBatchVector batches;
+    // The last record batch starting before the first row of the range
+    int i = static_cast<int>(
+        std::upper_bound(row_offsets.begin(), row_offsets.end(), offset) -
+        row_offsets.begin() - 1);
+    for (; i < num_record_batches() && row_offsets[i] < end; ++i) {
+      const int64_t batch_length = row_offsets[i + 1] - row_offsets[i];
+      if (batch_length == 0) continue;
+      ARROW_ASSIGN_OR_RAISE(auto batch, ReadRecordBatch(i));
+      if (batch->num_rows() != batch_length) {
+        return Status::IOError("Record batch ", i, " has ", batch->num_rows(),
+                               " rows but the row index of the file has ",
+                               batch_length);
+      }
+      const int64_t slice_offset = std::max(offset, row_offsets[i]) - row_offsets[i];
+      const int64_t slice_length =
+          std::min(end, row_offsets[i + 1]) - row_offsets[i] - slice_offset;
+      if (slice_length < batch_length) {
+        batch = batch->Slice(slice_offset, slice_length);
       }
-      total += batch->length();
+      batches.push_back(std::move(batch));
+    }
+    return Table::FromRecordBatches(out_schema_, std::move(batches));
+  }
+
+  Result<std::vector<std::shared_ptr<ArrayStatistics>>> GetRecordBatchStatistics(
+      int i) override {
+    if (i < 0 || i >= num_record_batches()) {
+      return Status::IndexError("Record batch index ", i, " out of bounds");
     }
-    return total;
+    RETURN_NOT_OK(EnsureMinMax());
+    std::vector<std::shared_ptr<ArrayStatistics>> statistics(min_max_->size());
+    for (size_t j = 0; j < statistics.size(); ++j) {
+      const auto& min_max = (*min_max_)[j];
+      if (min_max.empty()) continue;
+      // Statistics are always written along with the row index
+      RETURN_NOT_OK(EnsureRowOffsets());
+      auto field_statistics = std::make_shared<ArrayStatistics>();
+      field_statistics->row_count = (*row_offsets_)[i + 1] - (*row_offsets_)[i];
+      field_statistics->min = min_max[2 * i];
+      field_statistics->is_min_exact = true;
+      field_statistics->max = min_max[2 * i + 1];
+      field_statistics->is_max_exact = true;
+      statistics[j] = std::move(field_statistics);
+    }
+    return statistics;
+  }
+
+  Result<std::shared_ptr<Table>> ReadRecordBatches(
+      const StatisticsPredicate& predicate) override {
+    RecordBatchVector batches;
+    for (int i = 0; i < num_record_batches(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto statistics, GetRecordBatchStatistics(i));
+      if (!predicate(statistics)) continue;
+      ARROW_ASSIGN_OR_RAISE(auto batch, ReadRecordBatch(i));
+      batches.push_back(std::move(batch));
+    }
+    return Table::FromRecordBatches(out_schema_, std::move(batches));
   }
 
   Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset,
@@ -1440,14 +1671,14 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
           file, file->io_context(), options.pre_buffer_cache_options);
     }
     file_ = file;
-    options_ = options;
+    options_ = WithIpcMemoryPool(options);
     footer_offset_ = footer_offset;
     RETURN_NOT_OK(ReadFooter());
 
     // Get the schema and record any observed dictionaries
     RETURN_NOT_OK(UnpackSchemaMessage(footer_->schema(), options, &dictionary_memo_,
                                       &schema_, &out_schema_, &field_inclusion_mask_,
-                                      &swap_endian_));
+                                      &swap_endian_, &zstd_codec_));
     stats_.num_messages.fetch_add(1, std::memory_order_relaxed);
     return Status::OK();
   }
@@ -1469,7 +1700,7 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
           file, file->io_context(), options.pre_buffer_cache_options);
     }
     file_ = file;
-    options_ = options;
+    options_ = WithIpcMemoryPool(options);
     footer_offset_ = footer_offset;
     auto cpu_executor = ::arrow::internal::GetCpuThreadPool();
     auto self = std::dynamic_pointer_cast<RecordBatchFileReaderImpl>(shared_from_this());
@@ -1477,7 +1708,8 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
       // Get the schema and record any observed dictionaries
       RETURN_NOT_OK(UnpackSchemaMessage(
           self->footer_->schema(), options, &self->dictionary_memo_, &self->schema_,
-          &self->out_schema_, &self->field_inclusion_mask_, &self->swap_endian_));
+          &self->out_schema_, &self->field_inclusion_mask_, &self->swap_endian_,
+          &self->zstd_codec_));
       self->stats_.num_messages.fetch_add(1, std::memory_order_relaxed);
       return Status::OK();
     });
@@ -1500,24 +1732,42 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     // Prebuffering's read patterns are also slightly worse than the alternative
     // when doing whole-file reads because the logic is not in place to recognize
     // we can just read the entire file up-front
+    //
+    // When coalescing a zero-copy file, e.g. a memory-mapped one, the selective
+    // generator still pays off: it passes only the ranges of the included fields
+    // to WillNeed, rather than whole record batches.
+    const bool zero_copy = file_->supports_zero_copy();
     if (!options_.included_fields.empty() &&
         options_.included_fields.size() != schema_->fields().size() &&
-        !file_->supports_zero_copy()) {
+        (!zero_copy || coalesce)) {
       RETURN_NOT_OK(state->PreBufferMetadata({}));
       return SelectiveIpcFileRecordBatchGenerator(std::move(state));
     }
 
     std::shared_ptr<io::internal::ReadRangeCache> cached_source;
-    if (coalesce && !file_->supports_zero_copy()) {
+    std::optional<io::CacheOptions> coalesce_options;
+    if (coalesce && !zero_copy) {
       if (!owned_file_) return Status::Invalid("Cannot coalesce without an owned file");
-      // Since the user is asking for all fields then we can cache the entire
-      // file (up to the footer)
-      cached_source = std::make_shared<io::internal::ReadRangeCache>(file_, io_context,
-                                                                     cache_options);
-      RETURN_NOT_OK(cached_source->Cache({{0, footer_offset_}}));
+      if (options_.batch_readahead > 0) {
+        // Only coalesce the reads of the batches read ahead, so as to bound the
+        // memory held by the generator
+        coalesce_options = cache_options;
+      } else {
+        // Since the user is asking for all fields then we can cache the entire
+        // file (up to the footer)
+        cached_source = std::make_shared<io::internal::ReadRangeCache>(
+            file_, io_context, cache_options);
+        RETURN_NOT_OK(cached_source->Cache({{0, footer_offset_}}));
+      }
+    }
+    if (executor == nullptr && options_.batch_readahead > 0 && options_.use_threads &&
+        !zero_copy) {
+      // Keep decoding and decompression off the I/O threads reading ahead
+      executor = arrow::internal::GetCpuThreadPool();
     }
     return WholeIpcFileRecordBatchGenerator(std::move(state), std::move(cached_source),
-                                            io_context, executor);
+                                            io_context, executor,
+                                            std::move(coalesce_options));
   }
 
   Status DoPreBufferMetadata(const std::vector<int>& indices) {
@@ -1577,6 +1827,52 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     }
   };
 
+  // Load the row offsets of the record batches from the row index of the footer or,
+  // if there is none, from the metadata of the record batches
+  Status EnsureRowOffsets() {
+    if (row_offsets_.has_value()) {
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        row_offsets_, internal::ReadRowOffsets(metadata_.get(), num_record_batches()));
+    if (row_offsets_.has_value()) {
+      return Status::OK();
+    }
+    std::vector<int64_t> row_offsets = {0};
+    for (int i = 0; i < num_record_batches(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto block, GetRecordBatchBlock(i));
+      RETURN_NOT_OK(CheckAligned(block));
+      ARROW_ASSIGN_OR_RAISE(auto metadata,
+                            file_->ReadAt(block.offset, block.metadata_length));
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Message> message_obj,
+                            ReadMessage(std::move(metadata), nullptr));
+      stats_.num_messages.fetch_add(1, std::memory_order_relaxed);
+      ARROW_ASSIGN_OR_RAISE(auto message, GetFlatbufMessage(message_obj));
+      ARROW_ASSIGN_OR_RAISE(auto batch, GetBatchFromMessage(message));
+      row_offsets.push_back(row_offsets.back() + batch->length());
+    }
+    row_offsets_ = std::move(row_offsets);
+    return Status::OK();
+  }
+
+  // Load the minimum and maximum values recorded in the footer for the fields of
+  // out_schema_
+  Status EnsureMinMax() {
+    if (min_max_.has_value()) {
+      return Status::OK();
+    }
+    std::vector<std::vector<std::optional<ArrayStatistics::ValueType>>> min_max;
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      if (!field_inclusion_mask_.empty() && !field_inclusion_mask_[i]) continue;
+      ARROW_ASSIGN_OR_RAISE(
+          auto field_min_max,
+          internal::ReadMinMax(metadata_.get(), i, num_record_batches()));
+      min_max.push_back(std::move(field_min_max));
+    }
+    min_max_ = std::move(min_max);
+    return Status::OK();
+  }
+
   Result<FileBlock> GetRecordBatchBlock(int i) const {
     return FileBlockFromFlatbuffer(footer_->recordBatches()->Get(i), footer_offset_);
   }
@@ -1607,6 +1903,7 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
       const std::vector<std::shared_ptr<Message>>& dictionary_messages) {
     DCHECK_EQ(dictionary_messages.size(), static_cast<size_t>(num_dictionaries()));
     IpcReadContext context(&dictionary_memo_, options_, swap_endian_);
+    context.zstd_codec = zstd_codec_;
     for (int i = 0; i < num_dictionaries(); ++i) {
       RETURN_NOT_OK(ReadOneDictionary(i, dictionary_messages[i].get(), context));
     }
@@ -1616,7 +1913,7 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   Status ReadOneDictionary(int dict_index, Message* message,
                            const IpcReadContext& context) {
     CHECK_HAS_BODY(*message);
-    ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+    ARROW_ASSIGN_OR_RAISE(auto reader, OpenMessageBody(*message));
     DictionaryKind kind;
     RETURN_NOT_OK(ReadDictionary(*message->metadata(), context, &kind, reader.get()));
     if (kind == DictionaryKind::Replacement) {
@@ -1690,6 +1987,7 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   Result<IpcReadContext> GetIpcReadContext(const flatbuf::Message* message,
                                            const flatbuf::RecordBatch* batch) {
     IpcReadContext context(&dictionary_memo_, options_, swap_endian_);
+    context.zstd_codec = zstd_codec_;
     Compression::type compression;
     RETURN_NOT_OK(GetCompression(batch, &compression));
     if (context.compression == Compression::UNCOMPRESSED &&
@@ -1796,7 +2094,8 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
 
       if (context.compression != Compression::UNCOMPRESSED) {
         RETURN_NOT_OK(
-            DecompressBuffers(context.compression, context.options, &filtered_columns));
+            DecompressBuffers(context.compression, context.options,
+                              context.zstd_codec, &filtered_columns));
       }
 
       // swap endian in a set of ArrayData if necessary (swap_endian == true)
@@ -1830,23 +2129,28 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
       int index, Future<std::shared_ptr<Message>> message_fut) {
     stats_.num_record_batches.fetch_add(1, std::memory_order_relaxed);
     return dictionary_load_finished_.Then([message_fut] { return message_fut; })
-        .Then([this, index](const std::shared_ptr<Message>& message_obj)
-                  -> Future<std::shared_ptr<RecordBatch>> {
-          ARROW_ASSIGN_OR_RAISE(auto block, GetRecordBatchBlock(index));
-          ARROW_ASSIGN_OR_RAISE(auto message, GetFlatbufMessage(message_obj));
-          ARROW_ASSIGN_OR_RAISE(auto batch, GetBatchFromMessage(message));
-          ARROW_ASSIGN_OR_RAISE(auto context, GetIpcReadContext(message, batch));
-
-          auto read_context = std::make_shared<CachedRecordBatchReadContext>(
-              schema_, batch, std::move(context), file_, owned_file_,
-              block.offset + static_cast<int64_t>(block.metadata_length),
-              block.body_length);
-          RETURN_NOT_OK(read_context->CalculateLoadRequest());
-          return read_context->ReadAsync().Then(
-              [read_context] { return read_context->CreateRecordBatch(); });
+        .Then([this, index](const std::shared_ptr<Message>& message_obj) {
+          return ReadRecordBatchBuffers(index, message_obj);
         });
   }
 
+  /// Read the buffers of the included fields of a record batch whose metadata has
+  /// already been read, coalescing the neighbouring ranges
+  Future<std::shared_ptr<RecordBatch>> ReadRecordBatchBuffers(
+      int index, const std::shared_ptr<Message>& message_obj) {
+    ARROW_ASSIGN_OR_RAISE(auto block, GetRecordBatchBlock(index));
+    ARROW_ASSIGN_OR_RAISE(auto message, GetFlatbufMessage(message_obj));
+    ARROW_ASSIGN_OR_RAISE(auto batch, GetBatchFromMessage(message));
+    ARROW_ASSIGN_OR_RAISE(auto context, GetIpcReadContext(message, batch));
+
+    auto read_context = std::make_shared<CachedRecordBatchReadContext>(
+        schema_, batch, std::move(context), file_, owned_file_,
+        block.offset + static_cast<int64_t>(block.metadata_length), block.body_length);
+    RETURN_NOT_OK(read_context->CalculateLoadRequest());
+    return read_context->ReadAsync().Then(
+        [read_context] { return read_context->CreateRecordBatch(); });
+  }
+
   Status ReadFooter() {
     auto fut = ReadFooterAsync(/*executor=*/nullptr);
     return fut.status();
@@ -1936,6 +2240,11 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   // Schema with deselected fields dropped
   std::shared_ptr<Schema> out_schema_;
 
+  // Loaded on demand by EnsureRowOffsets() and EnsureMinMax()
+  std::optional<std::vector<int64_t>> row_offsets_;
+  std::optional<std::vector<std::vector<std::optional<ArrayStatistics::ValueType>>>>
+      min_max_;
+
   AtomicReadStats stats_;
   std::shared_ptr<io::internal::ReadRangeCache> metadata_cache_;
   std::unordered_set<int> cached_data_blocks_;
@@ -1944,6 +2253,7 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   std::unordered_map<int, Future<>> cached_data_requests_;
 
   bool swap_endian_;
+  std::shared_ptr<util::Codec> zstd_codec_;
 };
 
 Future<SelectiveIpcFileRecordBatchGenerator::Item>
@@ -1983,8 +2293,12 @@ WholeIpcFileRecordBatchGenerator::operator()() {
   if (index_ >= state_->num_record_batches()) {
     return Future<Item>::MakeFinished(IterationTraits<Item>::End());
   }
-  ARROW_ASSIGN_OR_RAISE(auto block, state->GetRecordBatchBlock(index_++));
-  auto read_message = ReadBlock(block);
+  RETURN_NOT_OK(ReadAhead());
+  auto read_message = std::move(pending_reads_.front());
+  pending_reads_.pop_front();
+  pending_bytes_ -= pending_sizes_.front();
+  pending_sizes_.pop_front();
+  ++index_;
   auto read_messages = read_dictionaries_.Then([read_message]() { return read_message; });
   // Force transfer. This may be wasteful in some cases, but ensures we get off the
   // I/O threads as soon as possible, and ensures we don't decode record batches
@@ -1993,15 +2307,89 @@ WholeIpcFileRecordBatchGenerator::operator()() {
     auto executor = executor_;
     return read_messages.Then(
         [=](const std::shared_ptr<Message>& message) -> Future<Item> {
-          return DeferNotOk(executor->Submit(
-              [=]() { return ReadRecordBatch(state.get(), message.get()); }));
+          return DeferNotOk(executor->Submit([=]() {
+            // Several batches are decoded at a time on the executor, don't block one
+            // of its threads waiting for the decompression tasks of a single batch
+            IpcReadOptions options = state->options_;
+            options.use_threads = false;
+            return ReadRecordBatch(state.get(), options, message.get());
+          }));
         });
   }
   return read_messages.Then([=](const std::shared_ptr<Message>& message) -> Result<Item> {
-    return ReadRecordBatch(state.get(), message.get());
+    return ReadRecordBatch(state.get(), state->options_, message.get());
   });
 }
 
+Status WholeIpcFileRecordBatchGenerator::ReadAhead() {
+  const IpcReadOptions& options = state_->options_;
+  std::vector<FileBlock> blocks;
+  while (read_index_ < state_->num_record_batches() &&
+         read_index_ <= index_ + std::max(options.batch_readahead, 0)) {
+    ARROW_ASSIGN_OR_RAISE(auto block, state_->GetRecordBatchBlock(read_index_));
+    const int64_t size = block.metadata_length + block.body_length;
+    if (read_index_ > index_ && options.readahead_bytes_limit > 0 &&
+        pending_bytes_ + size > options.readahead_bytes_limit) {
+      break;
+    }
+    pending_sizes_.push_back(size);
+    pending_bytes_ += size;
+    blocks.push_back(block);
+    ++read_index_;
+  }
+  if (coalesce_options_.has_value() && blocks.size() > 1) {
+    return ReadCoalesced(blocks);
+  }
+  for (const auto& block : blocks) {
+    pending_reads_.push_back(ReadBlock(block));
+  }
+  return Status::OK();
+}
+
+Status WholeIpcFileRecordBatchGenerator::ReadCoalesced(
+    const std::vector<FileBlock>& blocks) {
+  std::vector<io::ReadRange> ranges;
+  for (const auto& block : blocks) {
+    RETURN_NOT_OK(CheckAligned(block));
+    ranges.push_back({block.offset, block.metadata_length + block.body_length});
+  }
+  ARROW_ASSIGN_OR_RAISE(auto coalesced, io::internal::CoalesceReadRanges(
+                                            ranges, coalesce_options_->hole_size_limit,
+                                            coalesce_options_->range_size_limit));
+  std::vector<Future<std::shared_ptr<Buffer>>> reads;
+  for (const auto& range : coalesced) {
+    reads.push_back(state_->file_->ReadAsync(io_context_, range.offset, range.length));
+  }
+  auto pool = state_->options_.memory_pool;
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    // The coalesced ranges are sorted and each block is contained in one of them
+    auto it = std::upper_bound(coalesced.begin(), coalesced.end(), ranges[i].offset,
+                               [](int64_t offset, const io::ReadRange& range) {
+                                 return offset < range.offset;
+                               });
+    DCHECK(it != coalesced.begin());
+    --it;
+    const int64_t offset = ranges[i].offset - it->offset;
+    const int64_t length = ranges[i].length;
+    const FileBlock block = blocks[i];
+    pending_reads_.push_back(reads[it - coalesced.begin()].Then(
+        [=](const std::shared_ptr<Buffer>& buffer) -> Result<std::shared_ptr<Message>> {
+          if (buffer->size() < offset + length) {
+            return Status::IOError("Expected to be able to read ", length,
+                                   " bytes for message at offset ", block.offset);
+          }
+          io::BufferReader stream(SliceBuffer(buffer, offset, length));
+          ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Message> message,
+                                ReadMessage(&stream, pool));
+          if (message == nullptr) {
+            return Status::Invalid("Unexpected empty message in IPC file format");
+          }
+          return CheckBodyLength(std::move(message), block);
+        }));
+  }
+  return Status::OK();
+}
+
 Future<std::shared_ptr<Message>> WholeIpcFileRecordBatchGenerator::ReadBlock(
     const FileBlock& block) {
   if (cached_source_) {
@@ -2020,10 +2408,11 @@ Future<std::shared_ptr<Message>> WholeIpcFileRecordBatchGenerator::ReadBlock(
 }
 
 Result<std::shared_ptr<RecordBatch>> WholeIpcFileRecordBatchGenerator::ReadRecordBatch(
-    RecordBatchFileReaderImpl* state, Message* message) {
+    RecordBatchFileReaderImpl* state, const IpcReadOptions& options, Message* message) {
   CHECK_HAS_BODY(*message);
-  ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
-  IpcReadContext context(&state->dictionary_memo_, state->options_, state->swap_endian_);
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenMessageBody(*message));
+  IpcReadContext context(&state->dictionary_memo_, options, state->swap_endian_);
+  context.zstd_codec = state->zstd_codec_;
   ARROW_ASSIGN_OR_RAISE(
       auto batch_with_metadata,
       ReadRecordBatchInternal(*message->metadata(), state->schema_,
@@ -2642,7 +3031,7 @@ Result<std::shared_ptr<SparseTensor>> ReadSparseTensor(const Buffer& metadata,
 
 Result<std::shared_ptr<SparseTensor>> ReadSparseTensor(const Message& message) {
   CHECK_HAS_BODY(message);
-  ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message.body()));
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenMessageBody(message));
   return ReadSparseTensor(*message.metadata(), reader.get());
 }
 
@@ -2651,7 +3040,7 @@ Result<std::shared_ptr<SparseTensor>> ReadSparseTensor(io::InputStream* file) {
   RETURN_NOT_OK(ReadContiguousPayload(file, &message));
   CHECK_MESSAGE_TYPE(MessageType::SPARSE_TENSOR, message->type());
   CHECK_HAS_BODY(*message);
-  ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenMessageBody(*message));
   return ReadSparseTensor(*message->metadata(), reader.get());
 }
 
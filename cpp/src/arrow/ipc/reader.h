@@ -21,10 +21,12 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/statistics.h"
 #include "arrow/io/caching.h"
 #include "arrow/io/type_fwd.h"
 #include "arrow/ipc/message.h"
@@ -203,6 +205,45 @@ class ARROW_EXPORT RecordBatchFileReader
   /// \brief Computes the total number of rows in the file.
   virtual Result<int64_t> CountRows() = 0;
 
+  /// \brief Read a range of rows from the file
+  ///
+  /// Only the record batches holding the rows are read, and sliced to the range.  If
+  /// the file was written with IpcWriteOptions::write_row_index, they are found from
+  /// the row index of the footer.  Otherwise, the metadata of all the record batches is
+  /// read (once) to count their rows.
+  ///
+  /// \param[in] offset the index of the first row to read
+  /// \param[in] length the number of rows to read, truncated at the end of the file
+  /// \return a table with the schema() of the reader
+  virtual Result<std::shared_ptr<Table>> ReadRows(int64_t offset, int64_t length) = 0;
+
+  /// \brief Return the statistics of a record batch recorded in the file footer
+  ///
+  /// Statistics (the exact minimum and maximum values and the row count) are only
+  /// available for the fields listed in IpcWriteOptions::statistics_fields when the
+  /// file was written.
+  ///
+  /// \param[in] i the index of the record batch
+  /// \return one entry per field of schema(), null for the fields without statistics
+  virtual Result<std::vector<std::shared_ptr<ArrayStatistics>>> GetRecordBatchStatistics(
+      int i) = 0;
+
+  /// \brief A predicate on the statistics of a record batch, as returned by
+  /// GetRecordBatchStatistics
+  ///
+  /// The predicate returns false if the record batch can be skipped.
+  using StatisticsPredicate =
+      std::function<bool(const std::vector<std::shared_ptr<ArrayStatistics>>&)>;
+
+  /// \brief Read the record batches whose statistics satisfy a predicate
+  ///
+  /// The record batches which are skipped are not read at all.
+  ///
+  /// \param[in] predicate the predicate deciding whether to read each record batch
+  /// \return a table with the schema() of the reader
+  virtual Result<std::shared_ptr<Table>> ReadRecordBatches(
+      const StatisticsPredicate& predicate) = 0;
+
   /// \brief Begin loading metadata for the desired batches into memory.
   ///
   /// This method will also begin loading all dictionaries messages into memory.
@@ -217,13 +258,18 @@ class ARROW_EXPORT RecordBatchFileReader
 
   /// \brief Get a reentrant generator of record batches.
   ///
-  /// \param[in] coalesce If true, enable I/O coalescing.
+  /// \param[in] coalesce If true, enable I/O coalescing.  For a file supporting
+  ///     zero-copy reads, such as a memory-mapped file, this only matters when
+  ///     IpcReadOptions::included_fields is set: just the ranges of the included
+  ///     fields are then passed to RandomAccessFile::WillNeed.
   /// \param[in] io_context The IOContext to use (controls which thread pool
   ///     is used for I/O).
   /// \param[in] cache_options Options for coalescing (if enabled).
   /// \param[in] executor Optionally, an executor to use for decoding record
   ///     batches. This is generally only a benefit for very wide and/or
-  ///     compressed batches.
+  ///     compressed batches.  If null, IpcReadOptions::batch_readahead is set and
+  ///     the file doesn't support zero-copy reads, the CPU thread pool is used
+  ///     (unless IpcReadOptions::use_threads is false).
   virtual Result<AsyncGenerator<std::shared_ptr<RecordBatch>>> GetRecordBatchGenerator(
       const bool coalesce = false,
       const io::IOContext& io_context = io::default_io_context(),
@@ -0,0 +1,285 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/ipc/row_index_internal.h"
+
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "arrow/array.h"
+#include "arrow/record_batch.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/base64.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/key_value_metadata.h"
+#include "arrow/util/string.h"
+#include "arrow/util/value_parsing.h"
+#include "arrow/visit_type_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace ipc {
+namespace internal {
+
+namespace {
+
+using ValueType = ArrayStatistics::ValueType;
+
+// Compute the minimum and maximum non-null values of an array, ignoring NaNs.  Types
+// without a natural order (and nested types) get no values.
+struct MinMaxVisitor {
+  const Array& array;
+  std::optional<ValueType> min;
+  std::optional<ValueType> max;
+
+  Status Visit(const DataType&) { return Status::OK(); }
+
+  Status Visit(const BooleanType&) { return Compute<BooleanType, bool>(); }
+
+  template <typename T>
+  enable_if_integer<T, Status> Visit(const T&) {
+    using CType =
+        std::conditional_t<is_signed_integer_type<T>::value, int64_t, uint64_t>;
+    return Compute<T, CType>();
+  }
+
+  Status Visit(const FloatType&) { return Compute<FloatType, double>(); }
+
+  Status Visit(const DoubleType&) { return Compute<DoubleType, double>(); }
+
+  template <typename T>
+  enable_if_base_binary<T, Status> Visit(const T&) {
+    return Compute<T, std::string_view>();
+  }
+
+  template <typename T>
+  enable_if_binary_view_like<T, Status> Visit(const T&) {
+    return Compute<T, std::string_view>();
+  }
+
+  template <typename T, typename CType>
+  Status Compute() {
+    using ArrayType = typename TypeTraits<T>::ArrayType;
+    const auto& typed_array = checked_cast<const ArrayType&>(array);
+    std::optional<CType> lo, hi;
+    for (int64_t i = 0; i < typed_array.length(); ++i) {
+      if (typed_array.IsNull(i)) continue;
+      const auto value = static_cast<CType>(typed_array.GetView(i));
+      if constexpr (std::is_floating_point_v<CType>) {
+        if (std::isnan(value)) continue;
+      }
+      if (!lo.has_value() || value < *lo) lo = value;
+      if (!hi.has_value() || *hi < value) hi = value;
+    }
+    if (lo.has_value()) {
+      if constexpr (std::is_same_v<CType, std::string_view>) {
+        min = std::string(*lo);
+        max = std::string(*hi);
+      } else {
+        min = *lo;
+        max = *hi;
+      }
+    }
+    return Status::OK();
+  }
+};
+
+void EncodeValue(const std::optional<ValueType>& value, std::string* out) {
+  if (!value.has_value()) {
+    out->push_back('-');
+    return;
+  }
+  struct Visitor {
+    std::string* out;
+
+    void operator()(bool v) { out->append(v ? "b1" : "b0"); }
+    void operator()(int64_t v) { out->append("i" + std::to_string(v)); }
+    void operator()(uint64_t v) { out->append("u" + std::to_string(v)); }
+    void operator()(double v) {
+      uint64_t bits;
+      std::memcpy(&bits, &v, sizeof(bits));
+      out->append("d" + std::to_string(bits));
+    }
+    void operator()(const std::string& v) {
+      out->append("s" + ::arrow::util::base64_encode(v));
+    }
+  };
+  std::visit(Visitor{out}, *value);
+}
+
+Result<std::optional<ValueType>> DecodeValue(std::string_view encoded) {
+  const auto invalid = [&] {
+    return Status::IOError("Invalid value in the row index of the file footer: '",
+                           encoded, "'");
+  };
+  if (encoded.empty()) {
+    return invalid();
+  }
+  const std::string_view payload = encoded.substr(1);
+  switch (encoded[0]) {
+    case '-':
+      if (!payload.empty()) return invalid();
+      return std::nullopt;
+    case 'b':
+      if (payload != "0" && payload != "1") return invalid();
+      return ValueType(payload == "1");
+    case 'i': {
+      int64_t value;
+      if (!::arrow::internal::ParseValue<Int64Type>(payload.data(), payload.size(),
+                                                    &value)) {
+        return invalid();
+      }
+      return ValueType(value);
+    }
+    case 'u':
+    case 'd': {
+      uint64_t value;
+      if (!::arrow::internal::ParseValue<UInt64Type>(payload.data(), payload.size(),
+                                                     &value)) {
+        return invalid();
+      }
+      if (encoded[0] == 'u') {
+        return ValueType(value);
+      }
+      double double_value;
+      std::memcpy(&double_value, &value, sizeof(double_value));
+      return ValueType(double_value);
+    }
+    case 's':
+      return ValueType(::arrow::util::base64_decode(payload));
+    default:
+      return invalid();
+  }
+}
+
+// Split a comma-separated footer value, an empty value being an empty list
+std::vector<std::string_view> SplitValues(std::string_view value) {
+  if (value.empty()) {
+    return {};
+  }
+  return ::arrow::internal::SplitString(value, ',');
+}
+
+}  // namespace
+
+RowIndexBuilder::RowIndexBuilder(std::vector<int> statistics_fields)
+    : statistics_fields_(std::move(statistics_fields)),
+      row_offsets_({0}),
+      min_max_(statistics_fields_.size()) {}
+
+Status RowIndexBuilder::Append(const RecordBatch& batch) {
+  for (size_t i = 0; i < statistics_fields_.size(); ++i) {
+    const int field_index = statistics_fields_[i];
+    if (field_index < 0 || field_index >= batch.num_columns()) {
+      return Status::Invalid("Out of bounds field index for statistics: ", field_index);
+    }
+    const auto& column = *batch.column(field_index);
+    MinMaxVisitor visitor{column};
+    RETURN_NOT_OK(VisitTypeInline(*column.type(), &visitor));
+    min_max_[i].push_back(std::move(visitor.min));
+    min_max_[i].push_back(std::move(visitor.max));
+  }
+  row_offsets_.push_back(row_offsets_.back() + batch.num_rows());
+  return Status::OK();
+}
+
+Result<std::shared_ptr<const KeyValueMetadata>> RowIndexBuilder::Finish(
+    const std::shared_ptr<const KeyValueMetadata>& metadata) const {
+  auto out = metadata ? metadata->Copy() : std::make_shared<KeyValueMetadata>();
+
+  std::string row_offsets;
+  for (int64_t offset : row_offsets_) {
+    if (!row_offsets.empty()) row_offsets.push_back(',');
+    row_offsets.append(std::to_string(offset));
+  }
+  RETURN_NOT_OK(out->Set(kRowOffsetsKey, std::move(row_offsets)));
+
+  for (size_t i = 0; i < statistics_fields_.size(); ++i) {
+    std::string min_max;
+    for (const auto& value : min_max_[i]) {
+      if (!min_max.empty()) min_max.push_back(',');
+      EncodeValue(value, &min_max);
+    }
+    RETURN_NOT_OK(out->Set(kMinMaxKeyPrefix + std::to_string(statistics_fields_[i]),
+                           std::move(min_max)));
+  }
+  return out;
+}
+
+Result<std::optional<std::vector<int64_t>>> ReadRowOffsets(
+    const KeyValueMetadata* metadata, int num_record_batches) {
+  if (metadata == nullptr) {
+    return std::nullopt;
+  }
+  const int64_t index = metadata->FindKey(kRowOffsetsKey);
+  if (index < 0) {
+    return std::nullopt;
+  }
+  const auto values = SplitValues(metadata->value(index));
+  if (values.size() != static_cast<size_t>(num_record_batches) + 1) {
+    return Status::IOError("Row index of the file footer has ", values.size(),
+                           " values but the file has ", num_record_batches,
+                           " record batches");
+  }
+  std::vector<int64_t> row_offsets(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (!::arrow::internal::ParseValue<Int64Type>(values[i].data(), values[i].size(),
+                                                  &row_offsets[i]) ||
+        row_offsets[i] < (i == 0 ? 0 : row_offsets[i - 1]) ||
+        (i == 0 && row_offsets[i] != 0)) {
+      return Status::IOError("Invalid row offset in the file footer: '", values[i],
+                             "'");
+    }
+  }
+  return row_offsets;
+}
+
+Result<std::vector<std::optional<ValueType>>> ReadMinMax(const KeyValueMetadata* metadata,
+                                                         int field_index,
+                                                         int num_record_batches) {
+  std::vector<std::optional<ValueType>> min_max;
+  if (metadata == nullptr) {
+    return min_max;
+  }
+  const int64_t index = metadata->FindKey(kMinMaxKeyPrefix + std::to_string(field_index));
+  if (index < 0) {
+    return min_max;
+  }
+  const auto values = SplitValues(metadata->value(index));
+  if (values.size() != 2 * static_cast<size_t>(num_record_batches)) {
+    return Status::IOError("Statistics of field ", field_index,
+                           " in the file footer have ", values.size(),
+                           " values but the file has ", num_record_batches,
+                           " record batches");
+  }
+  min_max.reserve(values.size());
+  for (const auto& value : values) {
+    ARROW_ASSIGN_OR_RAISE(auto decoded, DecodeValue(value));
+    min_max.push_back(std::move(decoded));
+  }
+  return min_max;
+}
+
+}  // namespace internal
+}  // namespace ipc
+}  // namespace arrow
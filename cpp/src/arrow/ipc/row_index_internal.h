@@ -0,0 +1,90 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Row index of IPC files, stored in the custom metadata of the file footer
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "arrow/array/statistics.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace ipc {
+namespace internal {
+
+/// \brief Footer metadata key holding the cumulative row counts of the record batches
+///
+/// The value is a comma-separated list of num_record_batches + 1 integers: the row
+/// offset of each record batch followed by the total number of rows.
+constexpr char kRowOffsetsKey[] = "ARROW:ipc:row_offsets";
+
+/// \brief Prefix of the footer metadata keys holding the per-batch minimum and
+/// maximum values of a top-level field, followed by the index of the field
+///
+/// The value is a comma-separated list of 2 * num_record_batches values (the minimum
+/// then the maximum of each record batch).  Each value is a type tag followed by its
+/// payload: '-' (no value), 'b' (boolean, 0 or 1), 'i' (int64), 'u' (uint64), 'd'
+/// (double, as the uint64 of its bits) or 's' (base64-encoded string).
+constexpr char kMinMaxKeyPrefix[] = "ARROW:ipc:min_max:";
+
+/// \brief Accumulate the row index of the record batches written to an IPC file
+class ARROW_EXPORT RowIndexBuilder {
+ public:
+  /// \param[in] statistics_fields indices of the top-level fields to record the
+  /// minimum and maximum values of
+  explicit RowIndexBuilder(std::vector<int> statistics_fields);
+
+  Status Append(const RecordBatch& batch);
+
+  /// \brief Add (or replace) the row index keys of the given footer metadata
+  Result<std::shared_ptr<const KeyValueMetadata>> Finish(
+      const std::shared_ptr<const KeyValueMetadata>& metadata) const;
+
+ private:
+  std::vector<int> statistics_fields_;
+  std::vector<int64_t> row_offsets_;
+  // Minimum and maximum value of each batch, indexed like statistics_fields_
+  std::vector<std::vector<std::optional<ArrayStatistics::ValueType>>> min_max_;
+};
+
+/// \brief Read the row offsets recorded in the footer metadata of a file
+///
+/// \return std::nullopt if the file has no row index
+ARROW_EXPORT
+Result<std::optional<std::vector<int64_t>>> ReadRowOffsets(
+    const KeyValueMetadata* metadata, int num_record_batches);
+
+/// \brief Read the minimum and maximum values of a field recorded in the footer
+/// metadata of a file
+///
+/// \return the minimum and maximum value of each record batch (2 * num_record_batches
+/// values), or an empty vector if they were not recorded
+ARROW_EXPORT
+Result<std::vector<std::optional<ArrayStatistics::ValueType>>> ReadMinMax(
+    const KeyValueMetadata* metadata, int field_index, int num_record_batches);
+
+}  // namespace internal
+}  // namespace ipc
+}  // namespace arrow
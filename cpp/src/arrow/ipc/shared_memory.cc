@@ -0,0 +1,736 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/ipc/shared_memory.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#  include <fcntl.h>
+#  include <signal.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+#include "arrow/buffer.h"
+#include "arrow/device.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/ipc/metadata_internal.h"
+#include "arrow/memory_pool_internal.h"
+#include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/endian.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging_internal.h"
+#include "arrow/util/ubsan.h"
+
+#include "generated/Message_generated.h"
+
+namespace arrow {
+
+using memory_pool::internal::kZeroSizeArea;
+
+namespace ipc {
+
+namespace {
+
+constexpr uint64_t kRegionMagic = 0x4d454d5348574f52ULL;  // "ROWHSMEM"
+
+using SlotFlag = std::atomic<int32_t>;
+static_assert(SlotFlag::is_always_lock_free,
+              "Slot flags are shared between processes and must be lock free");
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "Header fields are shared between processes and must be lock free");
+
+// Layout of the start of a shared memory region, followed by the release flags of
+// the message slots and (at data_offset) by the allocatable data
+struct RegionHeader {
+  uint64_t magic;
+  int64_t data_offset;
+  int64_t data_size;
+  int32_t num_slots;
+  // The process id of the reader, or 0 until a reader opened the region
+  std::atomic<int32_t> reader_pid;
+  // The inode of the PID namespace reader_pid belongs to
+  std::atomic<uint64_t> reader_pid_namespace;
+};
+
+#ifdef __linux__
+uint64_t CurrentPidNamespace() {
+  static const uint64_t pid_namespace = [] {
+    struct stat st;
+    return stat("/proc/self/ns/pid", &st) == 0 ? static_cast<uint64_t>(st.st_ino) : 0;
+  }();
+  return pid_namespace;
+}
+
+// Whether the process exited, including zombies which were not reaped yet
+bool ProcessExited(int32_t pid) {
+  if (kill(pid, 0) == -1) {
+    return errno == ESRCH;
+  }
+  std::ifstream stat_file("/proc/" + std::to_string(pid) + "/stat");
+  std::string stat_line;
+  if (!std::getline(stat_file, stat_line)) {
+    return false;
+  }
+  // The state follows the command name, which is parenthesized
+  const auto name_end = stat_line.rfind(')');
+  if (name_end == std::string::npos || name_end + 2 >= stat_line.size()) {
+    return false;
+  }
+  const char state = stat_line[name_end + 2];
+  return state == 'Z' || state == 'X';
+}
+#endif
+
+// A mapping of a shared memory region.  Each message with a body written through the
+// region occupies a slot (in order, modulo the number of slots) whose flag is set by
+// the writer when sending the message and cleared by the reader when releasing it.
+class SharedMemoryRegion {
+ public:
+  ~SharedMemoryRegion() {
+#ifdef __linux__
+    if (base_ != nullptr) {
+      ARROW_UNUSED(munmap(base_, static_cast<size_t>(mapped_size_)));
+    }
+#endif
+  }
+
+  static Result<std::shared_ptr<SharedMemoryRegion>> Create(int64_t capacity,
+                                                            int32_t num_slots) {
+    if (capacity <= 0) {
+      return Status::Invalid("Shared memory capacity must be positive");
+    }
+    if (num_slots <= 0) {
+      return Status::Invalid("Maximum number of messages in flight must be positive");
+    }
+#ifdef __linux__
+    const int64_t page_size = ::arrow::internal::GetPageSize();
+    const int64_t data_offset = bit_util::RoundUp(
+        static_cast<int64_t>(sizeof(RegionHeader) + num_slots * sizeof(SlotFlag)),
+        page_size);
+    const int64_t data_size = bit_util::RoundUp(capacity, page_size);
+    int fd = memfd_create("arrow-ipc", MFD_CLOEXEC);
+    if (fd == -1) {
+      return ::arrow::internal::IOErrorFromErrno(errno, "Failed to create memfd");
+    }
+    ::arrow::internal::FileDescriptor owned_fd(fd);
+    if (ftruncate(fd, data_offset + data_size) == -1) {
+      return ::arrow::internal::IOErrorFromErrno(errno,
+                                                 "Failed to resize shared memory");
+    }
+    ARROW_ASSIGN_OR_RAISE(auto region, Map(std::move(owned_fd), data_offset + data_size));
+    auto header = new (region->base_) RegionHeader();
+    header->magic = kRegionMagic;
+    header->data_offset = data_offset;
+    header->data_size = data_size;
+    header->num_slots = num_slots;
+    for (int32_t i = 0; i < num_slots; ++i) {
+      new (region->SlotAt(i)) SlotFlag(0);
+    }
+    region->Init(*header);
+    return region;
+#else
+    return Status::NotImplemented("Shared memory IPC is only supported on Linux");
+#endif
+  }
+
+  static Result<std::shared_ptr<SharedMemoryRegion>> Open(int fd) {
+#ifdef __linux__
+    int dup_fd = dup(fd);
+    if (dup_fd == -1) {
+      return ::arrow::internal::IOErrorFromErrno(errno, "Failed to duplicate fd");
+    }
+    ::arrow::internal::FileDescriptor owned_fd(dup_fd);
+    struct stat st;
+    if (fstat(dup_fd, &st) == -1) {
+      return ::arrow::internal::IOErrorFromErrno(errno, "Failed to stat shared memory");
+    }
+    const int64_t size = static_cast<int64_t>(st.st_size);
+    if (size < static_cast<int64_t>(sizeof(RegionHeader))) {
+      return Status::Invalid("File is not an IPC shared memory region");
+    }
+    ARROW_ASSIGN_OR_RAISE(auto region, Map(std::move(owned_fd), size));
+    auto& header = *reinterpret_cast<RegionHeader*>(region->base_);
+    if (header.magic != kRegionMagic || header.num_slots <= 0 ||
+        header.data_offset < static_cast<int64_t>(sizeof(RegionHeader) +
+                                                  header.num_slots * sizeof(SlotFlag)) ||
+        header.data_size < 0 || header.data_offset > size - header.data_size) {
+      return Status::Invalid("File is not an IPC shared memory region");
+    }
+    region->Init(header);
+    // Let the writer notice if this process exits without releasing its messages
+    header.reader_pid_namespace.store(CurrentPidNamespace(), std::memory_order_relaxed);
+    header.reader_pid.store(static_cast<int32_t>(getpid()), std::memory_order_release);
+    return region;
+#else
+    ARROW_UNUSED(fd);
+    return Status::NotImplemented("Shared memory IPC is only supported on Linux");
+#endif
+  }
+
+  int fd() const { return fd_.fd(); }
+
+  uint8_t* data() const { return data_; }
+
+  int64_t size() const { return data_size_; }
+
+  int32_t num_slots() const { return num_slots_; }
+
+  // The release flag of the slot of the given message
+  SlotFlag* slot(int64_t message_index) const {
+    return SlotAt(static_cast<int32_t>(message_index % num_slots_));
+  }
+
+  bool Contains(const uint8_t* data, int64_t size) const {
+    return data >= data_ && size <= data_size_ && data - data_ <= data_size_ - size;
+  }
+
+  // Fail if the process which opened the region for reading exited.  This is only
+  // known when both processes share a PID namespace.
+  Status CheckReaderAlive() const {
+#ifdef __linux__
+    const auto& header = *reinterpret_cast<const RegionHeader*>(base_);
+    const int32_t pid = header.reader_pid.load(std::memory_order_acquire);
+    if (pid <= 0 || CurrentPidNamespace() == 0 ||
+        header.reader_pid_namespace.load(std::memory_order_relaxed) !=
+            CurrentPidNamespace()) {
+      return Status::OK();
+    }
+    if (ProcessExited(pid)) {
+      return Status::IOError("Shared memory reader process ", pid, " exited");
+    }
+#endif
+    return Status::OK();
+  }
+
+ private:
+  explicit SharedMemoryRegion(::arrow::internal::FileDescriptor fd)
+      : fd_(std::move(fd)) {}
+
+#ifdef __linux__
+  static Result<std::shared_ptr<SharedMemoryRegion>> Map(
+      ::arrow::internal::FileDescriptor fd, int64_t size) {
+    void* base = mmap(nullptr, static_cast<size_t>(size), PROT_READ | PROT_WRITE,
+                      MAP_SHARED, fd.fd(), 0);
+    if (base == MAP_FAILED) {
+      return ::arrow::internal::IOErrorFromErrno(errno, "Failed to map shared memory");
+    }
+    std::shared_ptr<SharedMemoryRegion> region(new SharedMemoryRegion(std::move(fd)));
+    region->base_ = static_cast<uint8_t*>(base);
+    region->mapped_size_ = size;
+    return region;
+  }
+#endif
+
+  void Init(const RegionHeader& header) {
+    data_ = base_ + header.data_offset;
+    data_size_ = header.data_size;
+    num_slots_ = header.num_slots;
+  }
+
+  SlotFlag* SlotAt(int32_t i) const {
+    return reinterpret_cast<SlotFlag*>(base_ + sizeof(RegionHeader)) + i;
+  }
+
+  ::arrow::internal::FileDescriptor fd_;
+  uint8_t* base_ = nullptr;
+  int64_t mapped_size_ = 0;
+  uint8_t* data_ = nullptr;
+  int64_t data_size_ = 0;
+  int32_t num_slots_ = 0;
+};
+
+// Allocations are made in multiples of this size, so that the free ranges stay
+// aligned to it
+constexpr int64_t kAllocationGranularity = 64;
+
+int64_t AllocationSize(int64_t size) {
+  return bit_util::RoundUp(size, kAllocationGranularity);
+}
+
+// Waits of the writer for the reader to release messages, which fail when the
+// reader does not within the timeout
+class ReaderBackoff {
+ public:
+  ReaderBackoff(const SharedMemoryRegion& region,
+                const SharedMemoryWriteOptions& options)
+      : region_(region), options_(options), start_(std::chrono::steady_clock::now()) {}
+
+  Status Wait(const char* waiting_for) {
+    RETURN_NOT_OK(options_.stop_token.Poll());
+    if (spins_ < 64) {
+      ++spins_;
+      std::this_thread::yield();
+      return Status::OK();
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+    // Check about every 10 ms whether to give up
+    if (++sleeps_ % 100 != 0) {
+      return Status::OK();
+    }
+    RETURN_NOT_OK(region_.CheckReaderAlive());
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start_;
+    if (options_.wait_timeout >= 0 && elapsed.count() > options_.wait_timeout) {
+      return Status::IOError("Timed out after ", options_.wait_timeout,
+                             " s waiting for the shared memory reader to release ",
+                             waiting_for, " (the reader may hold at most ",
+                             region_.num_slots(), " messages at a time)");
+    }
+    return Status::OK();
+  }
+
+ private:
+  const SharedMemoryRegion& region_;
+  const SharedMemoryWriteOptions& options_;
+  const std::chrono::steady_clock::time_point start_;
+  int spins_ = 0;
+  int64_t sleeps_ = 0;
+};
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// SharedMemoryPool
+
+class SharedMemoryPool::Impl {
+ public:
+  explicit Impl(std::shared_ptr<SharedMemoryRegion> region)
+      : region_(std::move(region)), in_flight_(region_->num_slots()) {
+    free_ranges_.emplace(0, region_->size());
+  }
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+    if (size < 0) {
+      return Status::Invalid("negative malloc size");
+    }
+    if (size == 0) {
+      *out = kZeroSizeArea;
+      return Status::OK();
+    }
+    if (TryAllocate(size, alignment, out)) {
+      return Status::OK();
+    }
+    // Free the memory of the messages the reader released since the last write
+    ReclaimReleased();
+    if (TryAllocate(size, alignment, out)) {
+      return Status::OK();
+    }
+    return Status::OutOfMemory("Shared memory pool of ", region_->size(),
+                               " bytes cannot allocate ", size, " more bytes");
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    if (buffer == kZeroSizeArea) {
+      return;
+    }
+    DCHECK(region_->Contains(buffer, size));
+    int64_t offset = buffer - region_->data();
+    int64_t length = AllocationSize(size);
+    std::lock_guard<std::mutex> lock(mutex_);
+    // Merge with the adjacent free ranges
+    auto next = free_ranges_.lower_bound(offset);
+    if (next != free_ranges_.end() && next->first == offset + length) {
+      length += next->second;
+      next = free_ranges_.erase(next);
+    }
+    if (next != free_ranges_.begin()) {
+      auto prev = std::prev(next);
+      if (prev->first + prev->second == offset) {
+        prev->second += length;
+        stats_.DidFreeBytes(size);
+        return;
+      }
+    }
+    free_ranges_.emplace_hint(next, offset, length);
+    stats_.DidFreeBytes(size);
+  }
+
+  // Wait for the reader to release the slot of the given message, then hold the
+  // buffers of the message in it until the reader releases it again
+  Status AcquireSlot(int64_t message_index, const SharedMemoryWriteOptions& options) {
+    SlotFlag* flag = region_->slot(message_index);
+    ReaderBackoff backoff(*region_, options);
+    while (flag->load(std::memory_order_acquire) != 0) {
+      RETURN_NOT_OK(backoff.Wait("a message slot"));
+    }
+    ReclaimReleased();
+    return Status::OK();
+  }
+
+  void RetainInSlot(int64_t message_index, BufferVector buffers) {
+    {
+      std::lock_guard<std::mutex> lock(in_flight_mutex_);
+      in_flight_[message_index % region_->num_slots()] = std::move(buffers);
+    }
+    region_->slot(message_index)->store(1, std::memory_order_release);
+  }
+
+  // Whether some message sent to the reader was not released yet
+  bool HasInFlight() {
+    std::lock_guard<std::mutex> lock(in_flight_mutex_);
+    return std::any_of(in_flight_.begin(), in_flight_.end(),
+                       [](const BufferVector& buffers) { return !buffers.empty(); });
+  }
+
+  // Free the buffers held for the reader, whether released or not
+  void ClearInFlight() {
+    std::vector<BufferVector> in_flight(region_->num_slots());
+    {
+      std::lock_guard<std::mutex> lock(in_flight_mutex_);
+      in_flight_.swap(in_flight);
+    }
+  }
+
+  void ReclaimReleased() {
+    std::vector<BufferVector> released;
+    {
+      std::lock_guard<std::mutex> lock(in_flight_mutex_);
+      for (int32_t i = 0; i < region_->num_slots(); ++i) {
+        if (!in_flight_[i].empty() &&
+            region_->slot(i)->load(std::memory_order_acquire) == 0) {
+          released.push_back(std::move(in_flight_[i]));
+          in_flight_[i].clear();
+        }
+      }
+    }
+    // The buffers are freed into the pool outside of the lock
+  }
+
+  const std::shared_ptr<SharedMemoryRegion>& region() const { return region_; }
+
+  ::arrow::internal::MemoryPoolStats stats_;
+
+ private:
+  bool TryAllocate(int64_t size, int64_t alignment, uint8_t** out) {
+    const int64_t length = AllocationSize(size);
+    alignment = std::max(alignment, kAllocationGranularity);
+    std::lock_guard<std::mutex> lock(mutex_);
+    // First fit
+    for (auto it = free_ranges_.begin(); it != free_ranges_.end(); ++it) {
+      const int64_t range_start = it->first;
+      const int64_t range_end = it->first + it->second;
+      // The data area is page-aligned, so offsets are aligned like addresses
+      const int64_t start = bit_util::RoundUp(range_start, alignment);
+      if (start + length > range_end) {
+        continue;
+      }
+      free_ranges_.erase(it);
+      if (start > range_start) {
+        free_ranges_.emplace(range_start, start - range_start);
+      }
+      if (start + length < range_end) {
+        free_ranges_.emplace(start + length, range_end - start - length);
+      }
+      *out = region_->data() + start;
+      stats_.DidAllocateBytes(size);
+      return true;
+    }
+    return false;
+  }
+
+  std::shared_ptr<SharedMemoryRegion> region_;
+  std::mutex mutex_;
+  // Offset and length of the free ranges of the region
+  std::map<int64_t, int64_t> free_ranges_;
+  std::mutex in_flight_mutex_;
+  // Buffers of the messages sent to the reader, indexed by slot
+  std::vector<BufferVector> in_flight_;
+};
+
+SharedMemoryPool::SharedMemoryPool(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+SharedMemoryPool::~SharedMemoryPool() {
+  // The buffers held for the reader are freed into this pool
+  impl_->ClearInFlight();
+}
+
+Result<std::shared_ptr<SharedMemoryPool>> SharedMemoryPool::Make(int64_t capacity,
+                                                                 int32_t max_in_flight) {
+  ARROW_ASSIGN_OR_RAISE(auto region, SharedMemoryRegion::Create(capacity, max_in_flight));
+  return std::shared_ptr<SharedMemoryPool>(
+      new SharedMemoryPool(std::make_unique<Impl>(std::move(region))));
+}
+
+Status SharedMemoryPool::Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+  return impl_->Allocate(size, alignment, out);
+}
+
+Status SharedMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                    int64_t alignment, uint8_t** ptr) {
+  if (new_size < 0) {
+    return Status::Invalid("negative realloc size");
+  }
+  if (*ptr != kZeroSizeArea && AllocationSize(new_size) == AllocationSize(old_size) &&
+      new_size > 0) {
+    // Fits in the current allocation
+    impl_->stats_.DidReallocateBytes(old_size, new_size);
+    return Status::OK();
+  }
+  uint8_t* out;
+  RETURN_NOT_OK(impl_->Allocate(new_size, alignment, &out));
+  if (*ptr != kZeroSizeArea) {
+    std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+  }
+  impl_->Free(*ptr, old_size);
+  *ptr = out;
+  return Status::OK();
+}
+
+void SharedMemoryPool::Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+  impl_->Free(buffer, size);
+}
+
+int64_t SharedMemoryPool::bytes_allocated() const {
+  return impl_->stats_.bytes_allocated();
+}
+
+int64_t SharedMemoryPool::max_memory() const { return impl_->stats_.max_memory(); }
+
+int64_t SharedMemoryPool::total_bytes_allocated() const {
+  return impl_->stats_.total_bytes_allocated();
+}
+
+int64_t SharedMemoryPool::num_allocations() const {
+  return impl_->stats_.num_allocations();
+}
+
+std::string SharedMemoryPool::backend_name() const { return "shared_memory"; }
+
+int SharedMemoryPool::fd() const { return impl_->region()->fd(); }
+
+int64_t SharedMemoryPool::capacity() const { return impl_->region()->size(); }
+
+// ----------------------------------------------------------------------
+// Writer
+
+SharedMemoryWriteOptions SharedMemoryWriteOptions::Defaults() {
+  return SharedMemoryWriteOptions();
+}
+
+namespace {
+
+static_assert(sizeof(flatbuf::Buffer) == 2 * sizeof(int64_t),
+              "Unexpected layout of the Buffer struct");
+
+// Copy the metadata of a message, replacing the offsets of its body buffers
+Result<std::shared_ptr<Buffer>> ReplaceBufferOffsets(
+    const Buffer& metadata, const std::vector<int64_t>& offsets) {
+  const flatbuf::Message* message;
+  RETURN_NOT_OK(internal::VerifyMessage(metadata.data(), metadata.size(), &message));
+  const flatbuf::RecordBatch* batch = message->header_as_RecordBatch();
+  if (batch == nullptr && message->header_as_DictionaryBatch() != nullptr) {
+    batch = message->header_as_DictionaryBatch()->data();
+  }
+  if (batch == nullptr) {
+    return Status::NotImplemented(
+        "Only record batches and dictionaries can be written to shared memory");
+  }
+  const auto buffers = batch->buffers();
+  const size_t num_buffers = buffers == nullptr ? 0 : buffers->size();
+  if (num_buffers != offsets.size()) {
+    return Status::Invalid("IPC message has ", num_buffers, " buffers but ",
+                           offsets.size(), " body buffers");
+  }
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> out,
+                        Buffer::CopyNonOwned(metadata, default_cpu_memory_manager()));
+  for (size_t i = 0; i < num_buffers; ++i) {
+    // Buffer is a struct stored inline in the flatbuffer, its offset field first
+    const auto position =
+        reinterpret_cast<const uint8_t*>(buffers->Get(i)) - metadata.data();
+    util::SafeStore(out->mutable_data() + position, bit_util::ToLittleEndian(offsets[i]));
+  }
+  return out;
+}
+
+}  // namespace
+
+class SharedMemoryPayloadWriter : public internal::IpcPayloadWriter {
+ public:
+  SharedMemoryPayloadWriter(io::OutputStream* sink,
+                            std::shared_ptr<SharedMemoryPool> pool,
+                            const IpcWriteOptions& options,
+                            const SharedMemoryWriteOptions& shm_options)
+      : sink_(sink),
+        pool_(std::move(pool)),
+        options_(options),
+        shm_options_(shm_options) {}
+
+  Status WritePayload(const IpcPayload& payload) override {
+    int32_t metadata_length = 0;  // unused
+    if (!Message::HasBody(payload.type)) {
+      return WriteMessage(*payload.metadata, options_, sink_, &metadata_length);
+    }
+    auto* impl = pool_->impl_.get();
+    const auto& region = impl->region();
+    RETURN_NOT_OK(impl->AcquireSlot(num_messages_, shm_options_));
+
+    BufferVector retained;
+    std::vector<int64_t> offsets;
+    for (const auto& buffer : payload.body_buffers) {
+      if (buffer == nullptr || buffer->size() == 0) {
+        offsets.push_back(0);
+        continue;
+      }
+      std::shared_ptr<Buffer> shared = buffer;
+      if (!buffer->is_cpu() || !region->Contains(buffer->data(), buffer->size()) ||
+          !bit_util::IsMultipleOf8(buffer->data() - region->data())) {
+        ARROW_ASSIGN_OR_RAISE(shared, CopyToRegion(buffer));
+      }
+      offsets.push_back(shared->data() - region->data());
+      retained.push_back(std::move(shared));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto metadata,
+                          ReplaceBufferOffsets(*payload.metadata, offsets));
+
+    impl->RetainInSlot(num_messages_++, std::move(retained));
+    return WriteMessage(*metadata, options_, sink_, &metadata_length);
+  }
+
+  Status Close() override {
+    // End of stream marker
+    constexpr int32_t kZeroLength = 0;
+    if (!options_.write_legacy_ipc_format) {
+      RETURN_NOT_OK(sink_->Write(&internal::kIpcContinuationToken, sizeof(int32_t)));
+    }
+    return sink_->Write(&kZeroLength, sizeof(int32_t));
+  }
+
+ private:
+  Result<std::shared_ptr<Buffer>> CopyToRegion(const std::shared_ptr<Buffer>& buffer) {
+    auto memory_manager = CPUDevice::memory_manager(pool_.get());
+    ReaderBackoff backoff(*pool_->impl_->region(), shm_options_);
+    while (true) {
+      auto maybe_copy = Buffer::Copy(buffer, memory_manager);
+      if (!maybe_copy.status().IsOutOfMemory() || !pool_->impl_->HasInFlight()) {
+        return maybe_copy;
+      }
+      RETURN_NOT_OK(backoff.Wait("memory"));
+    }
+  }
+
+  io::OutputStream* sink_;
+  std::shared_ptr<SharedMemoryPool> pool_;
+  IpcWriteOptions options_;
+  SharedMemoryWriteOptions shm_options_;
+  // The number of messages with a body written, which determines their slot
+  int64_t num_messages_ = 0;
+};
+
+Result<std::unique_ptr<internal::IpcPayloadWriter>> MakeSharedMemoryPayloadWriter(
+    io::OutputStream* sink, std::shared_ptr<SharedMemoryPool> pool,
+    const IpcWriteOptions& options, const SharedMemoryWriteOptions& shm_options) {
+  if (pool == nullptr) {
+    return Status::Invalid("A shared memory pool is required");
+  }
+  return std::make_unique<SharedMemoryPayloadWriter>(sink, std::move(pool), options,
+                                                     shm_options);
+}
+
+Result<std::shared_ptr<RecordBatchWriter>> MakeSharedMemoryStreamWriter(
+    io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
+    std::shared_ptr<SharedMemoryPool> pool, const IpcWriteOptions& options,
+    const SharedMemoryWriteOptions& shm_options) {
+  ARROW_ASSIGN_OR_RAISE(
+      auto payload_writer,
+      MakeSharedMemoryPayloadWriter(sink, std::move(pool), options, shm_options));
+  return internal::OpenRecordBatchWriter(std::move(payload_writer), schema, options);
+}
+
+// ----------------------------------------------------------------------
+// Reader
+
+namespace {
+
+// A view of a shared memory region serving as the body of a message, which releases
+// the slot of the message when destroyed
+class SharedMemoryBody : public Buffer {
+ public:
+  SharedMemoryBody(std::shared_ptr<SharedMemoryRegion> region, int64_t message_index)
+      : Buffer(region->data(), region->size()),
+        region_(std::move(region)),
+        flag_(region_->slot(message_index)) {}
+
+  ~SharedMemoryBody() override { flag_->store(0, std::memory_order_release); }
+
+ private:
+  std::shared_ptr<SharedMemoryRegion> region_;
+  SlotFlag* flag_;
+};
+
+class SharedMemoryMessageReader : public MessageReader, public MessageDecoderListener {
+ public:
+  SharedMemoryMessageReader(io::InputStream* stream,
+                            std::shared_ptr<SharedMemoryRegion> region)
+      : stream_(stream),
+        region_(std::move(region)),
+        decoder_(std::shared_ptr<SharedMemoryMessageReader>(this, [](void*) {}),
+                 default_memory_pool(), /*skip_body=*/true) {}
+
+  Status OnMessageDecoded(std::unique_ptr<Message> message) override {
+    message_ = std::move(message);
+    return Status::OK();
+  }
+
+  Result<std::unique_ptr<Message>> ReadNextMessage() override {
+    ARROW_RETURN_NOT_OK(DecodeMessage(&decoder_, stream_));
+    if (message_ == nullptr || !Message::HasBody(message_->type())) {
+      return std::move(message_);
+    }
+    // The body buffers were written at their offsets in the region
+    auto message = std::move(message_);
+    auto body = std::make_shared<SharedMemoryBody>(region_, num_messages_++);
+    return Message::Open(message->metadata(), std::move(body));
+  }
+
+ private:
+  io::InputStream* stream_;
+  std::shared_ptr<SharedMemoryRegion> region_;
+  std::unique_ptr<Message> message_;
+  MessageDecoder decoder_;
+  int64_t num_messages_ = 0;
+};
+
+}  // namespace
+
+Result<std::unique_ptr<MessageReader>> OpenSharedMemoryMessageReader(
+    io::InputStream* stream, int fd) {
+  ARROW_ASSIGN_OR_RAISE(auto region, SharedMemoryRegion::Open(fd));
+  return std::make_unique<SharedMemoryMessageReader>(stream, std::move(region));
+}
+
+Result<std::shared_ptr<RecordBatchStreamReader>> OpenSharedMemoryStreamReader(
+    io::InputStream* stream, int fd, const IpcReadOptions& options) {
+  ARROW_ASSIGN_OR_RAISE(auto message_reader, OpenSharedMemoryMessageReader(stream, fd));
+  return RecordBatchStreamReader::Open(std::move(message_reader), options);
+}
+
+}  // namespace ipc
+}  // namespace arrow
@@ -0,0 +1,182 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Zero-copy IPC transport between processes sharing a region of memory
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "arrow/io/type_fwd.h"
+#include "arrow/ipc/message.h"
+#include "arrow/ipc/options.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/cancel.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace ipc {
+
+class SharedMemoryPayloadWriter;
+
+/// \brief A memory pool allocating from a region of shared memory
+///
+/// The region is backed by an anonymous memory file (memfd) which the reading
+/// process maps from a file descriptor, received for instance over a Unix socket
+/// (SCM_RIGHTS) or opened as /proc/<pid>/fd/<fd>.  Record batches whose buffers are
+/// allocated from the pool are passed to the reader without being copied, see
+/// MakeSharedMemoryStreamWriter.
+///
+/// Allocations fail with OutOfMemory when the region is full.  The memory of the
+/// buffers written to the reader is only reused once the reader released the record
+/// batches referencing it.
+///
+/// The reader may hold at most max_in_flight messages with a body at a time: a
+/// reader retaining every batch, for instance with RecordBatchReader::ToTable(),
+/// can only read streams of at most that many batches.  Beyond that the writer
+/// fails once SharedMemoryWriteOptions::wait_timeout expires.
+///
+/// This API is EXPERIMENTAL and only available on Linux.
+class ARROW_EXPORT SharedMemoryPool : public MemoryPool {
+ public:
+  /// The default maximum number of messages the reader may hold at a time
+  static constexpr int32_t kDefaultMaxInFlight = 1024;
+
+  /// \brief Create a pool over a new region of shared memory
+  ///
+  /// \param[in] capacity the size of the region in bytes
+  /// \param[in] max_in_flight the maximum number of messages with a body sent but not
+  /// yet released by the reader; the writer waits for the reader when it is reached,
+  /// see SharedMemoryWriteOptions
+  static Result<std::shared_ptr<SharedMemoryPool>> Make(
+      int64_t capacity, int32_t max_in_flight = kDefaultMaxInFlight);
+
+  ~SharedMemoryPool() override;
+
+  using MemoryPool::Allocate;
+  using MemoryPool::Free;
+  using MemoryPool::Reallocate;
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override;
+
+  int64_t bytes_allocated() const override;
+  int64_t max_memory() const override;
+  int64_t total_bytes_allocated() const override;
+  int64_t num_allocations() const override;
+  std::string backend_name() const override;
+
+  /// \brief The file descriptor of the shared memory region, owned by the pool
+  int fd() const;
+
+  /// \brief The number of bytes which can be allocated from the region
+  int64_t capacity() const;
+
+ private:
+  friend class SharedMemoryPayloadWriter;
+
+  class Impl;
+  explicit SharedMemoryPool(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief Options for writing record batches through shared memory
+struct ARROW_EXPORT SharedMemoryWriteOptions {
+  /// \brief How long, in seconds, the writer waits for the reader to release a
+  /// message slot or memory of the region before failing with IOError
+  ///
+  /// A negative value waits indefinitely.  The writer also fails as soon as it
+  /// notices that the reader process exited.
+  double wait_timeout = 60;
+
+  /// \brief A token interrupting the waits for the reader with a Cancelled error
+  StopToken stop_token = StopToken::Unstoppable();
+
+  static SharedMemoryWriteOptions Defaults();
+};
+
+/// \brief Create an IPC payload writer passing record batches through shared memory
+///
+/// Only the IPC metadata of the messages is written to the sink; the offsets of the
+/// body buffers it records are offsets in the shared memory region.  Body buffers
+/// allocated from the pool are referenced where they are, the other ones (such as
+/// compressed buffers) are first copied into the region.
+///
+/// The encapsulated messages are read back with OpenSharedMemoryMessageReader.
+///
+/// Writing a message with a body waits for the reader when max_in_flight messages
+/// are not released yet, or when the region is too full to copy the body into it.
+///
+/// \param[in] sink the stream the IPC metadata is written to
+/// \param[in] pool the shared memory pool holding the body buffers
+/// \param[in] options options for serialization
+/// \param[in] shm_options options for waiting for the reader
+ARROW_EXPORT
+Result<std::unique_ptr<internal::IpcPayloadWriter>> MakeSharedMemoryPayloadWriter(
+    io::OutputStream* sink, std::shared_ptr<SharedMemoryPool> pool,
+    const IpcWriteOptions& options = IpcWriteOptions::Defaults(),
+    const SharedMemoryWriteOptions& shm_options = SharedMemoryWriteOptions::Defaults());
+
+/// \brief Create an IPC stream writer passing record batches through shared memory
+///
+/// \see MakeSharedMemoryPayloadWriter
+///
+/// \param[in] sink the stream the IPC metadata is written to
+/// \param[in] schema the schema of the record batches to be written
+/// \param[in] pool the shared memory pool holding the body buffers
+/// \param[in] options options for serialization
+/// \param[in] shm_options options for waiting for the reader
+ARROW_EXPORT
+Result<std::shared_ptr<RecordBatchWriter>> MakeSharedMemoryStreamWriter(
+    io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
+    std::shared_ptr<SharedMemoryPool> pool,
+    const IpcWriteOptions& options = IpcWriteOptions::Defaults(),
+    const SharedMemoryWriteOptions& shm_options = SharedMemoryWriteOptions::Defaults());
+
+/// \brief Open a reader of the messages written by a shared memory payload writer
+///
+/// The bodies of the messages are zero-copy views of the shared memory region, which
+/// the writer reuses once every buffer read from the message was released.
+///
+/// \param[in] stream the stream the IPC metadata is read from
+/// \param[in] fd a file descriptor of the shared memory region, which is duplicated
+ARROW_EXPORT
+Result<std::unique_ptr<MessageReader>> OpenSharedMemoryMessageReader(
+    io::InputStream* stream, int fd);
+
+/// \brief Open a reader of the record batches written by a shared memory stream
+/// writer
+///
+/// \param[in] stream the stream the IPC metadata is read from
+/// \param[in] fd a file descriptor of the shared memory region, which is duplicated
+/// \param[in] options options for reading
+ARROW_EXPORT
+Result<std::shared_ptr<RecordBatchStreamReader>> OpenSharedMemoryStreamReader(
+    io::InputStream* stream, int fd,
+    const IpcReadOptions& options = IpcReadOptions::Defaults());
+
+}  // namespace ipc
+}  // namespace arrow
@@ -31,6 +31,7 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/buffer.h"
 #include "arrow/device.h"
 #include "arrow/extension_type.h"
@@ -39,23 +40,28 @@
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata_internal.h"
+#include "arrow/ipc/row_index_internal.h"
 #include "arrow/ipc/util.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
+#include "arrow/scalar.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/base64.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/endian.h"
+#include "arrow/util/int_util.h"
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visit_array_inline.h"
 #include "arrow/visit_data_inline.h"
 #include "arrow/visit_type_inline.h"
@@ -193,19 +199,18 @@ class RecordBatchSerializer {
     return space_savings >= *options_.min_space_savings;
   }
 
-  Status CompressBuffer(const Buffer& buffer, util::Codec* codec,
-                        std::shared_ptr<Buffer>* out) {
-    // Convert buffer to uncompressed-length-prefixed buffer. The actual body may or may
-    // not be compressed, depending on user-preference and projected size reduction.
-    int64_t maximum_length = codec->MaxCompressedLen(buffer.size(), buffer.data());
+  // Convert a compressed buffer to an uncompressed-length-prefixed body buffer.  The
+  // actual body may or may not be compressed, depending on user-preference and projected
+  // size reduction.
+  //
+  // `result` holds the compressed data after the prefix, and has room for at least the
+  // maximum compressed length of the buffer.
+  Status FinishCompressedBuffer(const Buffer& buffer,
+                                std::unique_ptr<ResizableBuffer> result,
+                                int64_t actual_length, std::shared_ptr<Buffer>* out) {
+    const int64_t maximum_length = result->size() - static_cast<int64_t>(sizeof(int64_t));
     int64_t prefixed_length = buffer.size();
 
-    ARROW_ASSIGN_OR_RAISE(
-        auto result,
-        AllocateResizableBuffer(maximum_length + sizeof(int64_t), options_.memory_pool));
-    ARROW_ASSIGN_OR_RAISE(auto actual_length,
-                          codec->Compress(buffer.size(), buffer.data(), maximum_length,
-                                          result->mutable_data() + sizeof(int64_t)));
     // FIXME: Not the most sophisticated way to handle this. Ideally, you'd want to avoid
     // pre-compressing the entire buffer via some kind of sampling method. As the feature
     // gains adoption, this may become a worthwhile optimization.
@@ -236,19 +241,73 @@ class RecordBatchSerializer {
   }
 
   Status CompressBodyBuffers() {
-    RETURN_NOT_OK(
-        internal::CheckCompressionSupported(options_.codec->compression_type()));
+    util::Codec* codec = options_.codec.get();
+    RETURN_NOT_OK(internal::CheckCompressionSupported(codec->compression_type()));
+
+    // A range of a body buffer compressed on its own.  Large buffers are split in
+    // chunks compressed in parallel when the codec decodes concatenated frames.
+    struct Chunk {
+      size_t buffer_index;
+      int64_t offset;
+      int64_t length;
+      // Where the chunk is compressed in the output buffer
+      int64_t output_offset;
+      int64_t maximum_length;
+      int64_t compressed_length = 0;
+    };
+    const int64_t chunk_size =
+        (options_.use_threads && codec->compression_type() == Compression::ZSTD)
+            ? options_.compression_chunk_size
+            : 0;
 
-    auto CompressOne = [&](size_t i) {
-      if (out_->body_buffers[i]->size() > 0) {
-        RETURN_NOT_OK(CompressBuffer(*out_->body_buffers[i], options_.codec.get(),
-                                     &out_->body_buffers[i]));
+    std::vector<std::unique_ptr<ResizableBuffer>> results(out_->body_buffers.size());
+    std::vector<Chunk> chunks;
+    for (size_t i = 0; i < out_->body_buffers.size(); ++i) {
+      const Buffer& buffer = *out_->body_buffers[i];
+      if (buffer.size() == 0) continue;
+      int64_t output_offset = sizeof(int64_t);
+      int64_t length;
+      for (int64_t offset = 0; offset < buffer.size(); offset += length) {
+        length = buffer.size() - offset;
+        if (chunk_size > 0) length = std::min(length, chunk_size);
+        const int64_t maximum_length =
+            codec->MaxCompressedLen(length, buffer.data() + offset);
+        chunks.push_back({i, offset, length, output_offset, maximum_length});
+        output_offset += maximum_length;
       }
+      ARROW_ASSIGN_OR_RAISE(results[i],
+                            AllocateResizableBuffer(output_offset, options_.memory_pool));
+    }
+
+    auto CompressOne = [&](size_t i) {
+      Chunk& chunk = chunks[i];
+      const Buffer& buffer = *out_->body_buffers[chunk.buffer_index];
+      ARROW_ASSIGN_OR_RAISE(
+          chunk.compressed_length,
+          codec->Compress(
+              chunk.length, buffer.data() + chunk.offset, chunk.maximum_length,
+              results[chunk.buffer_index]->mutable_data() + chunk.output_offset));
       return Status::OK();
     };
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        options_.use_threads, static_cast<int>(chunks.size()), CompressOne));
 
-    return ::arrow::internal::OptionalParallelFor(
-        options_.use_threads, static_cast<int>(out_->body_buffers.size()), CompressOne);
+    auto chunk = chunks.begin();
+    for (size_t i = 0; i < out_->body_buffers.size(); ++i) {
+      if (results[i] == nullptr) continue;
+      // Move the compressed chunks next to each other
+      uint8_t* data = results[i]->mutable_data() + sizeof(int64_t);
+      int64_t compressed_length = 0;
+      for (; chunk != chunks.end() && chunk->buffer_index == i; ++chunk) {
+        std::memmove(data + compressed_length,
+                     data + chunk->output_offset - sizeof(int64_t),
+                     static_cast<size_t>(chunk->compressed_length));
+        compressed_length += chunk->compressed_length;
+      }
+      RETURN_NOT_OK(FinishCompressedBuffer(*out_->body_buffers[i], std::move(results[i]),
+                                           compressed_length, &out_->body_buffers[i]));
+    }
+    return Status::OK();
   }
 
   Status Assemble(const RecordBatch& batch) {
@@ -1189,21 +1248,41 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
   // A RecordBatchWriter implementation that writes to a IpcPayloadWriter.
   IpcFormatWriter(std::unique_ptr<internal::IpcPayloadWriter> payload_writer,
                   const Schema& schema, const IpcWriteOptions& options,
-                  bool is_file_format)
+                  bool is_file_format,
+                  std::shared_ptr<RowIndexBuilder> row_index = NULLPTR)
       : payload_writer_(std::move(payload_writer)),
         schema_(schema),
         mapper_(schema),
         is_file_format_(is_file_format),
-        options_(options) {}
+        row_index_(std::move(row_index)),
+        options_(options),
+        codec_(options.codec) {}
 
   // A Schema-owning constructor variant
   IpcFormatWriter(std::unique_ptr<internal::IpcPayloadWriter> payload_writer,
                   const std::shared_ptr<Schema>& schema, const IpcWriteOptions& options,
-                  bool is_file_format)
-      : IpcFormatWriter(std::move(payload_writer), *schema, options, is_file_format) {
+                  bool is_file_format,
+                  std::shared_ptr<RowIndexBuilder> row_index = NULLPTR)
+      : IpcFormatWriter(std::move(payload_writer), *schema, options, is_file_format,
+                        std::move(row_index)) {
     shared_schema_ = schema;
   }
 
+  ~IpcFormatWriter() override {
+    // The pending write refers to this writer
+    ARROW_WARN_NOT_OK(FinishPendingWrite(), "Error writing record batch");
+  }
+
+  Status SetCompressionEnabled(bool enabled) {
+    if (enabled && codec_ == nullptr) {
+      return Status::Invalid("Writer was opened without a compression codec");
+    }
+    // The pending write uses the current options
+    RETURN_NOT_OK(FinishPendingWrite());
+    options_.codec = enabled ? codec_ : nullptr;
+    return Status::OK();
+  }
+
   Status WriteRecordBatch(const RecordBatch& batch) override {
     return WriteRecordBatch(batch, NULLPTR);
   }
@@ -1220,17 +1299,11 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
 
     RETURN_NOT_OK(CheckStarted());
 
-    RETURN_NOT_OK(WriteDictionaries(batch));
-
-    IpcPayload payload;
-    RETURN_NOT_OK(GetRecordBatchPayload(batch, custom_metadata, options_, &payload));
-    RETURN_NOT_OK(WritePayload(payload));
-    ++stats_.num_record_batches;
-
-    stats_.total_raw_body_size += payload.raw_body_length;
-    stats_.total_serialized_body_size += payload.body_length;
-
-    return Status::OK();
+    if (options_.unify_dictionary_deltas) {
+      ARROW_ASSIGN_OR_RAISE(auto unified_batch, UnifyDictionaries(batch));
+      return DoWriteRecordBatch(*unified_batch, custom_metadata);
+    }
+    return DoWriteRecordBatch(batch, custom_metadata);
   }
 
   Status WriteTable(const Table& table, int64_t max_chunksize) override {
@@ -1245,6 +1318,7 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
 
   Status Close() override {
     RETURN_NOT_OK(CheckStarted());
+    RETURN_NOT_OK(FinishPendingWrite());
     RETURN_NOT_OK(payload_writer_->Close());
     closed_ = true;
     return Status::OK();
@@ -1269,6 +1343,115 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
     return Status::OK();
   }
 
+  Status DoWriteRecordBatch(
+      const RecordBatch& batch,
+      const std::shared_ptr<const KeyValueMetadata>& custom_metadata) {
+    if (options_.pipeline_writes) {
+      // Serialize this batch while the previous one is being written
+      auto payload = std::make_shared<IpcPayload>();
+      Status status = GetRecordBatchPayload(batch, custom_metadata, options_,
+                                            payload.get());
+      RETURN_NOT_OK(FinishPendingWrite());
+      RETURN_NOT_OK(status);
+      RETURN_NOT_OK(WriteDictionaries(batch));
+      ARROW_ASSIGN_OR_RAISE(pending_write_,
+                            io::default_io_context().executor()->Submit([this, payload] {
+                              return payload_writer_->WritePayload(*payload);
+                            }));
+      ++stats_.num_messages;
+      return RecordBatchWritten(batch, *payload);
+    }
+
+    RETURN_NOT_OK(WriteDictionaries(batch));
+
+    IpcPayload payload;
+    RETURN_NOT_OK(GetRecordBatchPayload(batch, custom_metadata, options_, &payload));
+    RETURN_NOT_OK(WritePayload(payload));
+    return RecordBatchWritten(batch, payload);
+  }
+
+  // Unify the dictionaries of the top-level columns with the ones already written,
+  // see IpcWriteOptions::unify_dictionary_deltas
+  Result<std::shared_ptr<RecordBatch>> UnifyDictionaries(const RecordBatch& batch) {
+    ArrayVector columns = batch.columns();
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      if (columns[i]->type_id() != Type::DICTIONARY) {
+        continue;
+      }
+      const auto& array = checked_cast<const DictionaryArray&>(*columns[i]);
+      const auto& dict_type = checked_cast<const DictionaryType&>(*array.type());
+      ARROW_ASSIGN_OR_RAISE(const int64_t dictionary_id, mapper_.GetFieldId({i}));
+      auto it = unified_dictionaries_.find(dictionary_id);
+      if (it == unified_dictionaries_.end()) {
+        // A null unifier records that the value type is not supported
+        auto maybe_unifier =
+            DictionaryUnifier::Make(dict_type.value_type(), options_.memory_pool);
+        it = unified_dictionaries_
+                 .emplace(dictionary_id,
+                          UnifiedDictionary{maybe_unifier.ok()
+                                                ? maybe_unifier.MoveValueUnsafe()
+                                                : nullptr})
+                 .first;
+      }
+      UnifiedDictionary& unified = it->second;
+      if (unified.unifier == nullptr) {
+        continue;
+      }
+
+      if (array.dictionary() != unified.last_input) {
+        RETURN_NOT_OK(
+            unified.unifier->Unify(*array.dictionary(), &unified.last_transpose_map));
+        unified.last_input = array.dictionary();
+        const int64_t length = unified.dictionary ? unified.dictionary->length() : 0;
+        ARROW_ASSIGN_OR_RAISE(auto delta, unified.unifier->GetDelta(length));
+        if (unified.dictionary == nullptr) {
+          unified.dictionary = std::move(delta);
+        } else if (delta->length() > 0) {
+          ARROW_ASSIGN_OR_RAISE(unified.dictionary,
+                                Concatenate({unified.dictionary, delta},
+                                            options_.memory_pool));
+        }
+        if (unified.dictionary->length() > 0 &&
+            !::arrow::internal::IntegersCanFit(
+                 Int64Scalar(unified.dictionary->length() - 1), *dict_type.index_type())
+                 .ok()) {
+          return Status::Invalid("Unified dictionary of length ",
+                                 unified.dictionary->length(), " for field ",
+                                 schema_.field(i)->name(), " doesn't fit index type ",
+                                 *dict_type.index_type());
+        }
+        // The indices are left as they are when the unified dictionary starts with
+        // the values of this one
+        const auto* transpose_map = unified.last_transpose_map->data_as<int32_t>();
+        unified.last_is_identity = true;
+        for (int64_t j = 0; j < array.dictionary()->length(); ++j) {
+          if (transpose_map[j] != j) {
+            unified.last_is_identity = false;
+            break;
+          }
+        }
+      }
+
+      if (unified.last_is_identity) {
+        auto data = array.data()->Copy();
+        data->dictionary = unified.dictionary->data();
+        columns[i] = MakeArray(std::move(data));
+      } else {
+        ARROW_ASSIGN_OR_RAISE(
+            columns[i],
+            array.Transpose(array.type(), unified.dictionary,
+                            unified.last_transpose_map->data_as<int32_t>(),
+                            options_.memory_pool));
+      }
+    }
+    return RecordBatch::Make(batch.schema(), batch.num_rows(), std::move(columns));
+  }
+
+  bool IsUnifiedDictionary(int64_t dictionary_id) const {
+    auto it = unified_dictionaries_.find(dictionary_id);
+    return it != unified_dictionaries_.end() && it->second.unifier != nullptr;
+  }
+
   Status WriteDictionaries(const RecordBatch& batch) {
     ARROW_ASSIGN_OR_RAISE(const auto dictionaries, CollectDictionaries(batch, mapper_));
     const auto equal_options = EqualOptions().nans_equal(true);
@@ -1298,7 +1481,10 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
         }
 
         // (the read path doesn't support outer dictionary deltas, don't emit them)
-        if (new_length > last_length && options_.emit_dictionary_deltas &&
+        if (new_length > last_length && IsUnifiedDictionary(dictionary_id)) {
+          // The unified dictionary only grows
+          delta_start = last_length;
+        } else if (new_length > last_length && options_.emit_dictionary_deltas &&
             !HasNestedDict(*dictionary->data()) &&
             ((*last_dictionary)
                  ->RangeEquals(dictionary, 0, last_length, 0, equal_options))) {
@@ -1345,11 +1531,35 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
     return Status::OK();
   }
 
+  Status RecordBatchWritten(const RecordBatch& batch, const IpcPayload& payload) {
+    ++stats_.num_record_batches;
+    if (row_index_) {
+      RETURN_NOT_OK(row_index_->Append(batch));
+    }
+
+    stats_.total_raw_body_size += payload.raw_body_length;
+    stats_.total_serialized_body_size += payload.body_length;
+
+    return Status::OK();
+  }
+
+  // Wait for the record batch being written in the background, if any
+  Status FinishPendingWrite() {
+    if (!pending_write_.is_valid()) {
+      return Status::OK();
+    }
+    auto pending_write = std::move(pending_write_);
+    pending_write_ = Future<>();
+    return pending_write.status();
+  }
+
   std::unique_ptr<IpcPayloadWriter> payload_writer_;
   std::shared_ptr<Schema> shared_schema_;
   const Schema& schema_;
   const DictionaryFieldMapper mapper_;
   const bool is_file_format_;
+  // Shared with the PayloadFileWriter which writes it in the footer
+  const std::shared_ptr<RowIndexBuilder> row_index_;
 
   // A map of last-written dictionaries by id.
   // This is required to avoid the same dictionary again and again,
@@ -1358,10 +1568,27 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
   // The latter is also why we can't use weak_ptr.
   std::unordered_map<int64_t, std::shared_ptr<Array>> last_dictionaries_;
 
+  struct UnifiedDictionary {
+    std::unique_ptr<DictionaryUnifier> unifier;
+    // The unified dictionary written so far
+    std::shared_ptr<Array> dictionary;
+    // The last dictionary unified and its transposition to the unified dictionary
+    std::shared_ptr<Array> last_input;
+    std::shared_ptr<Buffer> last_transpose_map;
+    bool last_is_identity = false;
+  };
+  // The dictionaries unified by id, when IpcWriteOptions::unify_dictionary_deltas
+  // is enabled
+  std::unordered_map<int64_t, UnifiedDictionary> unified_dictionaries_;
+
   bool started_ = false;
   bool closed_ = false;
   IpcWriteOptions options_;
+  // The codec the writer was opened with, when compression is disabled
+  const std::shared_ptr<util::Codec> codec_;
   WriteStats stats_;
+  // The record batch being written when IpcWriteOptions::pipeline_writes is enabled
+  Future<> pending_write_;
 };
 
 class StreamBookKeeper {
@@ -1449,14 +1676,20 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
  public:
   PayloadFileWriter(const IpcWriteOptions& options, const std::shared_ptr<Schema>& schema,
                     const std::shared_ptr<const KeyValueMetadata>& metadata,
-                    io::OutputStream* sink)
-      : StreamBookKeeper(options, sink), schema_(schema), metadata_(metadata) {}
+                    io::OutputStream* sink,
+                    std::shared_ptr<RowIndexBuilder> row_index = NULLPTR)
+      : StreamBookKeeper(options, sink),
+        schema_(schema),
+        metadata_(metadata),
+        row_index_(std::move(row_index)) {}
   PayloadFileWriter(const IpcWriteOptions& options, const std::shared_ptr<Schema>& schema,
                     const std::shared_ptr<const KeyValueMetadata>& metadata,
-                    std::shared_ptr<io::OutputStream> sink)
+                    std::shared_ptr<io::OutputStream> sink,
+                    std::shared_ptr<RowIndexBuilder> row_index = NULLPTR)
       : StreamBookKeeper(options, std::move(sink)),
         schema_(schema),
-        metadata_(metadata) {}
+        metadata_(metadata),
+        row_index_(std::move(row_index)) {}
 
   ~PayloadFileWriter() override = default;
 
@@ -1506,8 +1739,12 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
     // Write file footer
     RETURN_NOT_OK(UpdatePosition());
     int64_t initial_position = position_;
+    std::shared_ptr<const KeyValueMetadata> metadata = metadata_;
+    if (row_index_) {
+      ARROW_ASSIGN_OR_RAISE(metadata, row_index_->Finish(metadata_));
+    }
     RETURN_NOT_OK(
-        WriteFileFooter(*schema_, dictionaries_, record_batches_, metadata_, sink_));
+        WriteFileFooter(*schema_, dictionaries_, record_batches_, metadata, sink_));
 
     // Write footer length
     RETURN_NOT_OK(UpdatePosition());
@@ -1527,45 +1764,107 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
  protected:
   std::shared_ptr<Schema> schema_;
   std::shared_ptr<const KeyValueMetadata> metadata_;
+  std::shared_ptr<RowIndexBuilder> row_index_;
   std::vector<FileBlock> dictionaries_;
   std::vector<FileBlock> record_batches_;
 };
 
+// Return the builder of the row index requested by the options, if any
+Result<std::shared_ptr<RowIndexBuilder>> MakeRowIndexBuilder(
+    const Schema& schema, const IpcWriteOptions& options) {
+  if (!options.write_row_index && options.statistics_fields.empty()) {
+    return NULLPTR;
+  }
+  for (int field_index : options.statistics_fields) {
+    if (field_index < 0 || field_index >= schema.num_fields()) {
+      return Status::Invalid("Out of bounds field index for statistics: ", field_index);
+    }
+  }
+  return std::make_shared<RowIndexBuilder>(options.statistics_fields);
+}
+
+// Embed the compression dictionary of the options, if any, in the schema metadata and
+// make the codec compressing with it
+Status PrepareCompressionDictionary(std::shared_ptr<Schema>* schema,
+                                    IpcWriteOptions* options) {
+  const auto& metadata = (*schema)->metadata();
+  if (options->compression_dictionary == nullptr) {
+    // Readers must not decompress with a dictionary the batches weren't compressed with
+    if (metadata != nullptr && metadata->Contains(kZstdDictionaryKey)) {
+      auto stripped = metadata->Copy();
+      RETURN_NOT_OK(stripped->Delete(kZstdDictionaryKey));
+      *schema = (*schema)->WithMetadata(std::move(stripped));
+    }
+    return Status::OK();
+  }
+  if (options->codec == nullptr ||
+      options->codec->compression_type() != Compression::ZSTD) {
+    return Status::Invalid("A compression dictionary requires the ZSTD codec");
+  }
+  util::ZstdCodecOptions codec_options;
+  codec_options.compression_level = options->codec->compression_level();
+  codec_options.dictionary = options->compression_dictionary;
+  ARROW_ASSIGN_OR_RAISE(options->codec,
+                        util::Codec::Create(Compression::ZSTD, codec_options));
+
+  auto with_dictionary = metadata ? metadata->Copy() : key_value_metadata({}, {});
+  RETURN_NOT_OK(with_dictionary->Set(
+      kZstdDictionaryKey,
+      util::base64_encode(std::string_view(*options->compression_dictionary))));
+  *schema = (*schema)->WithMetadata(std::move(with_dictionary));
+  return Status::OK();
+}
+
 }  // namespace internal
 
 Result<std::shared_ptr<RecordBatchWriter>> MakeStreamWriter(
     io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options) {
+  auto writer_schema = schema;
+  auto writer_options = options;
+  RETURN_NOT_OK(internal::PrepareCompressionDictionary(&writer_schema, &writer_options));
   return std::make_shared<internal::IpcFormatWriter>(
-      std::make_unique<internal::PayloadStreamWriter>(sink, options), schema, options,
-      /*is_file_format=*/false);
+      std::make_unique<internal::PayloadStreamWriter>(sink, writer_options),
+      writer_schema, writer_options, /*is_file_format=*/false);
 }
 
 Result<std::shared_ptr<RecordBatchWriter>> MakeStreamWriter(
     std::shared_ptr<io::OutputStream> sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options) {
+  auto writer_schema = schema;
+  auto writer_options = options;
+  RETURN_NOT_OK(internal::PrepareCompressionDictionary(&writer_schema, &writer_options));
   return std::make_shared<internal::IpcFormatWriter>(
-      std::make_unique<internal::PayloadStreamWriter>(std::move(sink), options), schema,
-      options, /*is_file_format=*/false);
+      std::make_unique<internal::PayloadStreamWriter>(std::move(sink), writer_options),
+      writer_schema, writer_options, /*is_file_format=*/false);
 }
 
 Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
     io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options,
     const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  auto writer_schema = schema;
+  auto writer_options = options;
+  RETURN_NOT_OK(internal::PrepareCompressionDictionary(&writer_schema, &writer_options));
+  ARROW_ASSIGN_OR_RAISE(auto row_index, internal::MakeRowIndexBuilder(*schema, options));
   return std::make_shared<internal::IpcFormatWriter>(
-      std::make_unique<internal::PayloadFileWriter>(options, schema, metadata, sink),
-      schema, options, /*is_file_format=*/true);
+      std::make_unique<internal::PayloadFileWriter>(writer_options, writer_schema,
+                                                    metadata, sink, row_index),
+      writer_schema, writer_options, /*is_file_format=*/true, row_index);
 }
 
 Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
     std::shared_ptr<io::OutputStream> sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options,
     const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  auto writer_schema = schema;
+  auto writer_options = options;
+  RETURN_NOT_OK(internal::PrepareCompressionDictionary(&writer_schema, &writer_options));
+  ARROW_ASSIGN_OR_RAISE(auto row_index, internal::MakeRowIndexBuilder(*schema, options));
   return std::make_shared<internal::IpcFormatWriter>(
-      std::make_unique<internal::PayloadFileWriter>(options, schema, metadata,
-                                                    std::move(sink)),
-      schema, options, /*is_file_format=*/true);
+      std::make_unique<internal::PayloadFileWriter>(writer_options, writer_schema,
+                                                    metadata, std::move(sink), row_index),
+      writer_schema, writer_options, /*is_file_format=*/true, row_index);
 }
 
 namespace internal {
@@ -1577,13 +1876,24 @@ Result<std::unique_ptr<RecordBatchWriter>> OpenRecordBatchWriter(
   if (schema == nullptr) {
     return Status::Invalid("nullptr for Schema not allowed");
   }
+  auto writer_schema = schema;
+  auto writer_options = options;
+  RETURN_NOT_OK(PrepareCompressionDictionary(&writer_schema, &writer_options));
   auto writer = std::make_unique<internal::IpcFormatWriter>(
-      std::move(sink), schema, options, /*is_file_format=*/false);
+      std::move(sink), writer_schema, writer_options, /*is_file_format=*/false);
   RETURN_NOT_OK(writer->Start());
   // R build with openSUSE155 requires an explicit unique_ptr construction
   return std::unique_ptr<RecordBatchWriter>(std::move(writer));
 }
 
+Status SetCompressionEnabled(RecordBatchWriter* writer, bool enabled) {
+  auto ipc_writer = dynamic_cast<IpcFormatWriter*>(writer);
+  if (ipc_writer == nullptr) {
+    return Status::TypeError("Not an IPC RecordBatchWriter");
+  }
+  return ipc_writer->SetCompressionEnabled(enabled);
+}
+
 Result<std::unique_ptr<IpcPayloadWriter>> MakePayloadStreamWriter(
     io::OutputStream* sink, const IpcWriteOptions& options) {
   return std::make_unique<internal::PayloadStreamWriter>(sink, options);
@@ -1601,6 +1911,26 @@ Result<std::unique_ptr<IpcPayloadWriter>> MakePayloadFileWriter(
 // ----------------------------------------------------------------------
 // Serialization public APIs
 
+Result<std::shared_ptr<Buffer>> TrainCompressionDictionary(
+    const std::vector<std::shared_ptr<RecordBatch>>& batches,
+    int64_t max_dictionary_size, const IpcWriteOptions& options) {
+  // The samples are the body buffers as they would be compressed
+  IpcWriteOptions uncompressed_options = options;
+  uncompressed_options.codec.reset();
+  uncompressed_options.compression_dictionary.reset();
+  std::vector<std::shared_ptr<Buffer>> samples;
+  for (const auto& batch : batches) {
+    IpcPayload payload;
+    RETURN_NOT_OK(GetRecordBatchPayload(*batch, uncompressed_options, &payload));
+    for (auto& buffer : payload.body_buffers) {
+      if (buffer != nullptr && buffer->size() > 0) {
+        samples.push_back(std::move(buffer));
+      }
+    }
+  }
+  return util::TrainZstdDictionary(samples, max_dictionary_size);
+}
+
 Result<std::shared_ptr<Buffer>> SerializeRecordBatch(const RecordBatch& batch,
                                                      std::shared_ptr<MemoryManager> mm) {
   auto options = IpcWriteOptions::Defaults();
@@ -251,6 +251,21 @@ ARROW_EXPORT
 Status WriteRecordBatchStream(const std::vector<std::shared_ptr<RecordBatch>>& batches,
                               const IpcWriteOptions& options, io::OutputStream* dst);
 
+/// \brief Train a ZSTD dictionary for compressing record batches like the given ones
+///
+/// The body buffers of the sample batches are used as training samples.  The result
+/// is meant to be set as IpcWriteOptions::compression_dictionary.
+///
+/// \param[in] batches sample record batches, representative of the ones to write
+/// \param[in] max_dictionary_size the maximum size of the dictionary in bytes
+/// \param[in] options options for serialization
+/// \return the dictionary
+ARROW_EXPORT
+Result<std::shared_ptr<Buffer>> TrainCompressionDictionary(
+    const std::vector<std::shared_ptr<RecordBatch>>& batches,
+    int64_t max_dictionary_size = util::kDefaultZstdDictionarySize,
+    const IpcWriteOptions& options = IpcWriteOptions::Defaults());
+
 /// \brief Compute the number of bytes needed to write an IPC payload
 ///     including metadata
 ///
@@ -470,6 +485,17 @@ Result<std::unique_ptr<RecordBatchWriter>> OpenRecordBatchWriter(
     std::unique_ptr<IpcPayloadWriter> sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options = IpcWriteOptions::Defaults());
 
+/// \brief Enable or disable compression of the next messages of an IPC writer.
+///
+/// Readers take the compression of each message from its own metadata,
+/// so it may change within a stream. Compression can only be enabled
+/// if the writer was opened with a codec.
+///
+/// \param[in] writer a writer returned by an IPC writer factory
+/// \param[in] enabled whether to compress with the writer's codec
+ARROW_EXPORT
+Status SetCompressionEnabled(RecordBatchWriter* writer, bool enabled);
+
 }  // namespace internal
 }  // namespace ipc
 }  // namespace arrow
@@ -39,6 +39,17 @@ enum class UnexpectedFieldBehavior : char {
   InferType
 };
 
+enum class ParserBackend : char {
+  /// Parse with RapidJSON
+  RapidJson,
+  /// Parse with simdjson's On-Demand API, only available if Arrow was built with
+  /// ARROW_WITH_SIMDJSON
+  ///
+  /// Usually faster than RapidJSON, but NaN and Infinity aren't accepted as numbers,
+  /// and skip_trailing_fields only skips the rest of the current object.
+  Simdjson
+};
+
 struct ARROW_EXPORT ParseOptions {
   // Parsing options
 
@@ -53,6 +64,17 @@ struct ARROW_EXPORT ParseOptions {
   /// How JSON fields outside of explicit_schema (if given) are treated
   UnexpectedFieldBehavior unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
 
+  /// Whether to skip the rest of a line once all fields of explicit_schema were read
+  ///
+  /// Only used if unexpected_field_behavior is Ignore and newlines_in_values is false.
+  /// Reading a few fields out of wide objects is then much faster, but the skipped
+  /// part of a line is not validated: malformed JSON or duplicate keys there are
+  /// not detected, and any other object on the same line is not read.
+  bool skip_trailing_fields = false;
+
+  /// The JSON library used to parse blocks
+  ParserBackend parser_backend = ParserBackend::RapidJson;
+
   /// Create parsing options with default values
   static ParseOptions Defaults();
 };
@@ -17,6 +17,8 @@
 
 #include "arrow/json/parser.h"
 
+#include <algorithm>
+#include <cstring>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -33,14 +35,20 @@
 
 #include "arrow/array.h"
 #include "arrow/array/builder_binary.h"
+#include "arrow/buffer.h"
 #include "arrow/buffer_builder.h"
 #include "arrow/type.h"
 #include "arrow/util/bitset_stack_internal.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/config.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/trie_internal.h"
 #include "arrow/visit_type_inline.h"
 
+#ifdef ARROW_WITH_SIMDJSON
+#  include <simdjson.h>
+#endif
+
 namespace arrow {
 
 using internal::BitsetStack;
@@ -50,6 +58,16 @@ namespace json {
 
 namespace rj = arrow::rapidjson;
 
+#ifdef ARROW_WITH_SIMDJSON
+namespace od = simdjson::ondemand;
+
+// simdjson reads up to this many bytes past the end of its input
+constexpr int64_t kBlockPadding = simdjson::SIMDJSON_PADDING;
+#else
+// The NUL terminator of blocks parsed in situ
+constexpr int64_t kBlockPadding = 1;
+#endif
+
 template <typename... T>
 static Status ParseError(T&&... t) {
   return Status::Invalid("JSON parse error: ", std::forward<T>(t)...);
@@ -728,7 +746,8 @@ class HandlerBase : public BlockParser,
   /// @}
 
   /// \brief Set up builders using an expected Schema
-  Status Initialize(const std::shared_ptr<Schema>& s) {
+  Status Initialize(const std::shared_ptr<Schema>& s, ParserBackend backend) {
+    backend_ = backend;
     auto type = struct_({});
     if (s) {
       type = struct_(s->fields());
@@ -762,11 +781,11 @@ class HandlerBase : public BlockParser,
   }
 
  protected:
-  template <typename Handler, typename Stream>
-  Status DoParse(Handler& handler, Stream&& json, size_t json_size) {
+  template <typename Handler>
+  Status DoParse(Handler& handler, rj::InsituStringStream& json, size_t json_size) {
     constexpr auto parse_flags = rj::kParseIterativeFlag | rj::kParseNanAndInfFlag |
                                  rj::kParseStopWhenDoneFlag |
-                                 rj::kParseNumbersAsStringsFlag;
+                                 rj::kParseNumbersAsStringsFlag | rj::kParseInsituFlag;
 
     rj::Reader reader;
     // ensure that the loop can exit when the block too large.
@@ -783,6 +802,15 @@ class HandlerBase : public BlockParser,
           // parsed all objects, finish
           return Status::OK();
         case rj::kParseErrorTermination:
+          if (skip_rest_of_line_) {
+            // handler closed the row early, resume parsing at the next line
+            skip_rest_of_line_ = false;
+            auto end = json.head_ + json_size;
+            auto eol = static_cast<char*>(
+                std::memchr(json.src_, '\n', static_cast<size_t>(end - json.src_)));
+            json.src_ = eol != nullptr ? eol + 1 : end;
+            continue;
+          }
           // handler emitted an error
           return handler.Error();
         default:
@@ -796,10 +824,188 @@ class HandlerBase : public BlockParser,
   template <typename Handler>
   Status DoParse(Handler& handler, const std::shared_ptr<Buffer>& json) {
     RETURN_NOT_OK(ReserveScalarStorage(json->size()));
-    rj::MemoryStream ms(reinterpret_cast<const char*>(json->data()), json->size());
-    using InputStream = rj::EncodedInputStream<rj::UTF8<>, rj::MemoryStream>;
-    return DoParse(handler, InputStream(ms), static_cast<size_t>(json->size()));
+    // Parse a NUL-terminated (and, for simdjson, padded) copy of the block: RapidJSON
+    // parses it in situ, so that strings are unescaped in place instead of onto the
+    // reader's stack, and can use its SIMD whitespace and string scanning (see
+    // rapidjson_defs.h). Handlers copy everything they keep, so the copy can be
+    // reused for the next block.
+    if (block_copy_ == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(block_copy_,
+                            AllocateResizableBuffer(json->size() + kBlockPadding, pool_));
+    } else {
+      RETURN_NOT_OK(
+          block_copy_->Resize(json->size() + kBlockPadding, /*shrink_to_fit=*/false));
+    }
+    auto data = reinterpret_cast<char*>(block_copy_->mutable_data());
+    std::memcpy(data, json->data(), static_cast<size_t>(json->size()));
+    data[json->size()] = '\0';
+
+    // Skip the UTF-8 byte order mark, if any
+    size_t offset = 0;
+    if (json->size() >= 3 && std::memcmp(data, "\xEF\xBB\xBF", 3) == 0) {
+      offset = 3;
+    }
+    auto size = static_cast<size_t>(json->size()) - offset;
+#ifdef ARROW_WITH_SIMDJSON
+    if (backend_ == ParserBackend::Simdjson) {
+      return DoParseSimdjson(handler, data + offset, size);
+    }
+#endif
+    rj::InsituStringStream stream(data + offset);
+    return DoParse(handler, stream, size);
+  }
+
+#ifdef ARROW_WITH_SIMDJSON
+  /// \brief Parse a block with simdjson's On-Demand API
+  ///
+  /// Every row is walked from start to end, calling the same handler methods as
+  /// rj::Reader does.
+  template <typename Handler>
+  Status DoParseSimdjson(Handler& handler, const char* json, size_t json_size) {
+    // A single batch spans the whole block, so that its documents are indexed at once
+    auto batch_size = std::max(json_size, simdjson::dom::MINIMAL_BATCH_SIZE);
+    od::document_stream stream;
+    auto error = simdjson_parser_.iterate_many(json, json_size, batch_size).get(stream);
+    if (ARROW_PREDICT_FALSE(error)) {
+      return ParseError(simdjson::error_message(error));
+    }
+    for (auto it = stream.begin(); it != stream.end(); ++it, ++num_rows_) {
+      // ensure that the loop can exit when the block too large.
+      if (ARROW_PREDICT_FALSE(num_rows_ == std::numeric_limits<int32_t>::max())) {
+        return Status::Invalid("Row count overflowed int32_t");
+      }
+      od::document_reference doc;
+      od::json_type type;
+      od::value value;
+      if (ARROW_PREDICT_FALSE((error = (*it).get(doc)) || (error = doc.type().get(type)))) {
+        return ParseError(simdjson::error_message(error), " in row ", num_rows_);
+      }
+      if (ARROW_PREDICT_FALSE(type != od::json_type::object &&
+                              type != od::json_type::array)) {
+        // simdjson only walks scalar documents through accessors of the document
+        return IllegallyChangedTo(type == od::json_type::null      ? Kind::kNull
+                                  : type == od::json_type::boolean ? Kind::kBoolean
+                                  : type == od::json_type::string  ? Kind::kString
+                                                                   : Kind::kNumber);
+      }
+      if (ARROW_PREDICT_FALSE(error = doc.get_value().get(value))) {
+        return ParseError(simdjson::error_message(error), " in row ", num_rows_);
+      }
+      if (ARROW_PREDICT_FALSE(!WalkSimdjson(handler, value))) {
+        if (skip_rest_of_line_) {
+          // handler closed the row early, the stream resumes at the next one
+          skip_rest_of_line_ = false;
+          continue;
+        }
+        return handler.Error();
+      }
+    }
+    if (ARROW_PREDICT_FALSE(stream.truncated_bytes() != 0)) {
+      return ParseError(simdjson::error_message(simdjson::INCOMPLETE_ARRAY_OR_OBJECT),
+                        " in row ", num_rows_);
+    }
+    return Status::OK();
+  }
+
+  /// \brief Pass a value and its children to the handler
+  ///
+  /// Returns false if the handler stopped or simdjson emitted an error, which is then
+  /// stored as status_.
+  template <typename Handler>
+  bool WalkSimdjson(Handler& handler, od::value value) {
+    od::json_type type;
+    simdjson::error_code error = value.type().get(type);
+    switch (error ? static_cast<od::json_type>(0) : type) {
+      case od::json_type::object: {
+        od::object object;
+        if ((error = value.get_object().get(object)) || !handler.StartObject()) {
+          break;
+        }
+        for (auto field_result : object) {
+          od::field field;
+          std::string_view key;
+          if ((error = std::move(field_result).get(field)) ||
+              (error = field.unescaped_key().get(key))) {
+            break;
+          }
+          if (!handler.Key(key.data(), static_cast<rj::SizeType>(key.size())) ||
+              !WalkSimdjson(handler, field.value())) {
+            return false;
+          }
+        }
+        if (!error) {
+          return handler.EndObject();
+        }
+        break;
+      }
+      case od::json_type::array: {
+        od::array array;
+        if ((error = value.get_array().get(array)) || !handler.StartArray()) {
+          break;
+        }
+        rj::SizeType size = 0;
+        for (auto element_result : array) {
+          od::value element;
+          if ((error = std::move(element_result).get(element))) {
+            break;
+          }
+          if (!WalkSimdjson(handler, element)) {
+            return false;
+          }
+          ++size;
+        }
+        if (!error) {
+          return handler.EndArray(size);
+        }
+        break;
+      }
+      case od::json_type::number: {
+        // Numbers are kept as strings like with rj::kParseNumbersAsStringsFlag, but
+        // are still validated. Integers too large for 64 bits are fine.
+        std::string_view token = value.raw_json_token();
+        od::number number;
+        error = value.get_number().get(number);
+        if (error && error != simdjson::BIGINT_ERROR) {
+          break;
+        }
+        error = simdjson::SUCCESS;
+        // The token extends to the next structural character
+        token = token.substr(0, token.find_last_not_of(" \t\n\r") + 1);
+        return handler.RawNumber(token.data(), static_cast<rj::SizeType>(token.size()));
+      }
+      case od::json_type::string: {
+        std::string_view str;
+        if ((error = value.get_string().get(str))) {
+          break;
+        }
+        return handler.String(str.data(), static_cast<rj::SizeType>(str.size()));
+      }
+      case od::json_type::boolean: {
+        bool b;
+        if ((error = value.get_bool().get(b))) {
+          break;
+        }
+        return handler.Bool(b);
+      }
+      case od::json_type::null: {
+        bool is_null;
+        if ((error = value.is_null().get(is_null)) ||
+            (!is_null && (error = simdjson::N_ATOM_ERROR))) {
+          break;
+        }
+        return handler.Null();
+      }
+      default:
+        // type() failed, or the value isn't valid JSON
+        error = error ? error : simdjson::TAPE_ERROR;
+        break;
+    }
+    if (error) {
+      status_ = ParseError(simdjson::error_message(error), " in row ", num_rows_);
+    }
+    return false;
   }
+#endif
 
   /// \defgroup handlerbase-append-methods append non-nested values
   ///
@@ -941,6 +1147,15 @@ class HandlerBase : public BlockParser,
   // top of this stack == field_index_
   std::vector<int> field_index_stack_;
   StringBuilder scalar_values_builder_;
+  ParserBackend backend_ = ParserBackend::RapidJson;
+  // padded copy of the block being parsed, modified in place by rj::Reader
+  std::unique_ptr<ResizableBuffer> block_copy_;
+#ifdef ARROW_WITH_SIMDJSON
+  od::parser simdjson_parser_;
+#endif
+  // set by a handler which has closed the current row and stopped the reader, so that
+  // the rest of its line (with simdjson, of the row) is skipped
+  bool skip_rest_of_line_ = false;
 };
 
 template <UnexpectedFieldBehavior>
@@ -974,7 +1189,8 @@ class Handler<UnexpectedFieldBehavior::Error> : public HandlerBase {
 template <>
 class Handler<UnexpectedFieldBehavior::Ignore> : public HandlerBase {
  public:
-  using HandlerBase::HandlerBase;
+  Handler(MemoryPool* pool, bool skip_trailing_fields)
+      : HandlerBase(pool), skip_trailing_fields_(skip_trailing_fields) {}
 
   Status Parse(const std::shared_ptr<Buffer>& json) override {
     return DoParse(*this, json);
@@ -1009,7 +1225,9 @@ class Handler<UnexpectedFieldBehavior::Ignore> : public HandlerBase {
   }
 
   bool StartObject() {
-    ++depth_;
+    if (++depth_ == 1) {
+      row_fields_seen_ = 0;
+    }
     if (Skipping()) {
       return true;
     }
@@ -1024,9 +1242,20 @@ class Handler<UnexpectedFieldBehavior::Ignore> : public HandlerBase {
     if (Skipping()) {
       return true;
     }
+    if (depth_ == 1 && skip_trailing_fields_ &&
+        row_fields_seen_ == Cast<Kind::kObject>(builder_stack_.back())->num_fields()) {
+      // every expected field of this row has been read: close the row and have the
+      // reader skip the rest of its line
+      if (!EndObject()) {
+        return false;
+      }
+      skip_rest_of_line_ = true;
+      return false;
+    }
     bool duplicate_keys = false;
     if (ARROW_PREDICT_TRUE(
             SetFieldBuilder(std::string_view(key, len), &duplicate_keys))) {
+      row_fields_seen_ += depth_ == 1;
       return true;
     }
     if (ARROW_PREDICT_FALSE(duplicate_keys)) {
@@ -1070,6 +1299,9 @@ class Handler<UnexpectedFieldBehavior::Ignore> : public HandlerBase {
 
   int depth_ = 0;
   int skip_depth_ = std::numeric_limits<int>::max();
+  bool skip_trailing_fields_;
+  // number of expected fields read so far in the current row
+  int row_fields_seen_ = 0;
 };
 
 template <>
@@ -1173,10 +1405,18 @@ Status BlockParser::Make(MemoryPool* pool, const ParseOptions& options,
                          std::unique_ptr<BlockParser>* out) {
   DCHECK(options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType ||
          options.explicit_schema != nullptr);
+#ifndef ARROW_WITH_SIMDJSON
+  if (options.parser_backend == ParserBackend::Simdjson) {
+    return Status::NotImplemented(
+        "The simdjson JSON parser backend requires Arrow to be built with "
+        "ARROW_WITH_SIMDJSON");
+  }
+#endif
 
   switch (options.unexpected_field_behavior) {
     case UnexpectedFieldBehavior::Ignore: {
-      *out = std::make_unique<Handler<UnexpectedFieldBehavior::Ignore>>(pool);
+      *out = std::make_unique<Handler<UnexpectedFieldBehavior::Ignore>>(
+          pool, options.skip_trailing_fields && !options.newlines_in_values);
       break;
     }
     case UnexpectedFieldBehavior::Error: {
@@ -1187,7 +1427,8 @@ Status BlockParser::Make(MemoryPool* pool, const ParseOptions& options,
       *out = std::make_unique<Handler<UnexpectedFieldBehavior::InferType>>(pool);
       break;
   }
-  return static_cast<HandlerBase&>(**out).Initialize(options.explicit_schema);
+  return static_cast<HandlerBase&>(**out).Initialize(options.explicit_schema,
+                                                     options.parser_backend);
 }
 
 Status BlockParser::Make(const ParseOptions& options, std::unique_ptr<BlockParser>* out) {
@@ -26,6 +26,7 @@
 #include "arrow/json/test_common.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/config.h"
 
 namespace arrow {
 namespace json {
@@ -218,6 +219,38 @@ static void ParseJSONFields(benchmark::State& state) {  // NOLINT non-const refe
   BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), parse_options);
 }
 
+static void ParseJSONProjectedFields(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const bool skip_trailing_fields = !!state.range(0);
+  const int32_t num_rows = 2000;
+  const int num_fields = 200;
+
+  // Read the first 3 fields of wide, consistently ordered objects
+  auto fields = GenerateTestFields(num_fields, 10);
+  auto parse_options = ParseOptions::Defaults();
+  parse_options.explicit_schema = schema({fields[0], fields[1], fields[2]});
+  parse_options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  parse_options.skip_trailing_fields = skip_trailing_fields;
+
+  auto json = GenerateTestData(fields, num_rows);
+  BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), parse_options);
+}
+
+static void ParseJSONBackend(benchmark::State& state) {  // NOLINT non-const reference
+  const auto backend = static_cast<ParserBackend>(state.range(0));
+  const int32_t num_rows = 20000;
+  const int num_fields = 20;
+
+  auto fields = GenerateTestFields(num_fields, 10);
+  auto parse_options = ParseOptions::Defaults();
+  parse_options.explicit_schema = schema(fields);
+  parse_options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+  parse_options.parser_backend = backend;
+
+  auto json = GenerateTestData(fields, num_rows);
+  BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), parse_options);
+}
+
 BENCHMARK(ChunkJSONPrettyPrinted);
 BENCHMARK(ChunkJSONLineDelimited);
 BENCHMARK(ParseJSONBlockWithSchema);
@@ -230,5 +263,16 @@ BENCHMARK(ParseJSONFields)
     ->ArgNames({"ordered", "schema", "sparsity", "num_fields"})
     ->ArgsProduct({{1, 0}, {1, 0}, {0, 10, 90}, {10, 100, 1000}});
 
+BENCHMARK(ParseJSONProjectedFields)->ArgNames({"skip_trailing_fields"})->Arg(0)->Arg(1);
+
+BENCHMARK(ParseJSONBackend)
+    ->ArgNames({"backend"})
+    ->Arg(static_cast<int>(ParserBackend::RapidJson));
+#ifdef ARROW_WITH_SIMDJSON
+BENCHMARK(ParseJSONBackend)
+    ->ArgNames({"backend"})
+    ->Arg(static_cast<int>(ParserBackend::Simdjson));
+#endif
+
 }  // namespace json
 }  // namespace arrow
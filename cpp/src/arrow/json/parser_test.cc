@@ -25,12 +25,14 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/buffer.h"
 #include "arrow/json/options.h"
 #include "arrow/json/test_common.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/config.h"
 
 namespace arrow {
 
@@ -89,11 +91,9 @@ void AssertUnconvertedStructArraysEqual(const StructArray& expected,
   }
 }
 
-void AssertParseColumns(ParseOptions options, string_view src_str,
-                        const std::vector<std::shared_ptr<Field>>& fields,
-                        const std::vector<std::string>& columns_json) {
-  std::shared_ptr<Array> parsed;
-  ASSERT_OK(ParseFromString(options, src_str, &parsed));
+void AssertParsedColumns(const std::shared_ptr<Array>& parsed,
+                         const std::vector<std::shared_ptr<Field>>& fields,
+                         const std::vector<std::string>& columns_json) {
   auto struct_array = std::static_pointer_cast<StructArray>(parsed);
   for (size_t i = 0; i < fields.size(); ++i) {
     auto column_expected = ArrayFromJSON(fields[i]->type(), columns_json[i]);
@@ -102,6 +102,14 @@ void AssertParseColumns(ParseOptions options, string_view src_str,
   }
 }
 
+void AssertParseColumns(ParseOptions options, string_view src_str,
+                        const std::vector<std::shared_ptr<Field>>& fields,
+                        const std::vector<std::string>& columns_json) {
+  std::shared_ptr<Array> parsed;
+  ASSERT_OK(ParseFromString(options, src_str, &parsed));
+  AssertParsedColumns(parsed, fields, columns_json);
+}
+
 // TODO(bkietz) parameterize (at least some of) these tests over UnexpectedFieldBehavior
 
 TEST(BlockParserWithSchema, Basics) {
@@ -235,6 +243,25 @@ TEST(BlockParserWithSchema, FailOnIncompleteJson) {
   ASSERT_RAISES(Invalid, ParseFromString(options, "{\"a\":0, \"b\"", &parsed));
 }
 
+TEST(BlockParserWithSchema, SkipTrailingFields) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema = schema({field("a", int32()), field("b", utf8())});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  options.skip_trailing_fields = true;
+  // Everything after the last expected field of a line is skipped, unvalidated
+  std::string src = R"({"a": 1, "b": "x", "c": [1, 2], "a": 5, "d": )" "\n"
+                    R"({"c": {"d": 1}, "b": "y"})" "\n"
+                    R"({"b": "z", "x": 0, "a": 3, "y": {}})" "\n"
+                    R"({"b": "w", "a": 4})";
+  AssertParseColumns(options, src, {field("a", utf8()), field("b", utf8())},
+                     {R"(["1", null, "3", "4"])", R"(["x", "y", "z", "w"])"});
+
+  // Not applicable to objects spanning several lines
+  options.newlines_in_values = true;
+  std::shared_ptr<Array> parsed;
+  ASSERT_RAISES(Invalid, ParseFromString(options, src, &parsed));
+}
+
 TEST(BlockParser, Basics) {
   auto options = ParseOptions::Defaults();
   options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
@@ -321,5 +348,123 @@ TEST(BlockParser, AdHoc) {
        R"([{"c":true, "d": "1991-02-03"}, {"c":false, "d":"2019-04-01"}])"});
 }
 
+class BlockParserBackend : public ::testing::TestWithParam<ParserBackend> {
+ public:
+  ParseOptions Options() {
+    auto options = ParseOptions::Defaults();
+    options.parser_backend = GetParam();
+    return options;
+  }
+};
+
+TEST_P(BlockParserBackend, Basics) {
+  AssertParseColumns(
+      Options(), scalars_only_src(),
+      {field("hello", utf8()), field("world", boolean()), field("yo", utf8())},
+      {"[\"3.5\", \"3.25\", \"3.125\", \"0.0\"]", "[false, null, null, true]",
+       "[\"thing\", null, \"\xe5\xbf\x8d\", null]"});
+}
+
+TEST_P(BlockParserBackend, Nested) {
+  AssertParseColumns(Options(), nested_src(),
+                     {field("yo", utf8()), field("arr", list(utf8())),
+                      field("nuf", struct_({field("ps", utf8())}))},
+                     {"[\"thing\", null, \"\xe5\xbf\x8d\", null]",
+                      R"([["1", "2", "3"], ["2"], [], null])",
+                      R"([{"ps":null}, {}, {"ps":"78"}, {"ps":"90"}])"});
+}
+
+TEST_P(BlockParserBackend, ByteOrderMark) {
+  AssertParseColumns(Options(), "\xef\xbb\xbf{\"a\": 1}\n{\"a\": 2}\n",
+                     {field("a", utf8())}, {R"(["1", "2"])"});
+}
+
+TEST_P(BlockParserBackend, Escapes) {
+  // Unescaped strings and keys are shorter than in the JSON, what follows them must be
+  // left intact
+  std::string src = R"({"a": "x\"y\\z\n\u00e9", "b\u0063": "\ud83d\ude00", "d": 1}
+{"a": "plain", "bc": "\t", "d": 2}
+)";
+  AssertParseColumns(Options(), src,
+                     {field("a", utf8()), field("bc", utf8()), field("d", utf8())},
+                     {R"(["x\"y\\z\n\u00e9", "plain"])", R"(["\ud83d\ude00", "\t"])",
+                      R"(["1", "2"])"});
+}
+
+TEST_P(BlockParserBackend, MultipleBlocks) {
+  // The copy of a block is reused for the next, smaller or larger, ones
+  std::vector<std::string> blocks = {
+      R"({"a": "a rather long string", "b": [1, 2]})"
+      "\n"
+      R"({"a": "x"})",
+      R"({"b": [3]})", "",
+      R"({"a": "\u0041", "c": true})"
+      "\n"
+      R"({"c": false})"};
+  std::unique_ptr<BlockParser> parser;
+  ASSERT_OK(BlockParser::Make(Options(), &parser));
+  for (const auto& block : blocks) {
+    ASSERT_OK(parser->Parse(std::make_shared<Buffer>(block)));
+  }
+  ASSERT_EQ(parser->num_rows(), 5);
+  std::shared_ptr<Array> parsed;
+  ASSERT_OK(parser->Finish(&parsed));
+  AssertParsedColumns(
+      parsed, {field("a", utf8()), field("b", list(utf8())), field("c", boolean())},
+      {R"(["a rather long string", "x", null, "A", null])",
+       R"([["1", "2"], null, ["3"], null, null])", "[null, null, null, true, false]"});
+}
+
+TEST_P(BlockParserBackend, SkipTrailingFields) {
+  auto options = Options();
+  options.explicit_schema =
+      schema({field("a", int32()), field("s", struct_({field("b", utf8())}))});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  options.skip_trailing_fields = true;
+  // Unexpected fields are skipped at any depth until all expected top-level fields
+  // were read, then the rest of the row is skipped
+  std::string src = R"({"s": {"b": "x", "c": 1}, "a": 1, "t": [1, {"u": 2}]})"
+                    "\n"
+                    R"({"t": 0, "a": 2, "s": {"c": [], "b": "y"}, "a": 3})"
+                    "\n"
+                    R"({"a": 4})";
+  AssertParseColumns(options, src,
+                     {field("a", utf8()), field("s", struct_({field("b", utf8())}))},
+                     {R"(["1", "2", "4"])", R"([{"b": "x"}, {"b": "y"}, null])"});
+
+  options.skip_trailing_fields = false;
+  std::shared_ptr<Array> parsed;
+  ASSERT_RAISES(Invalid, ParseFromString(options, src, &parsed));
+}
+
+TEST_P(BlockParserBackend, FailOnInvalidJson) {
+  std::shared_ptr<Array> parsed;
+  for (std::string src : {"{\"a\": 1}\n{\"a\": }", "{\"a\": -x}", "{\"a\": nul}",
+                          "{\"a\": 1}\n{\"a\": [1, 2}"}) {
+    ARROW_SCOPED_TRACE("src = ", src);
+    ASSERT_RAISES(Invalid, ParseFromString(Options(), src, &parsed));
+  }
+}
+
+std::vector<ParserBackend> AvailableBackends() {
+  std::vector<ParserBackend> backends = {ParserBackend::RapidJson};
+#ifdef ARROW_WITH_SIMDJSON
+  backends.push_back(ParserBackend::Simdjson);
+#endif
+  return backends;
+}
+
+INSTANTIATE_TEST_SUITE_P(BlockParserBackend, BlockParserBackend,
+                         ::testing::ValuesIn(AvailableBackends()));
+
+#ifndef ARROW_WITH_SIMDJSON
+TEST(BlockParser, SimdjsonNotAvailable) {
+  auto options = ParseOptions::Defaults();
+  options.parser_backend = ParserBackend::Simdjson;
+  std::unique_ptr<BlockParser> parser;
+  ASSERT_RAISES(NotImplemented, BlockParser::Make(options, &parser));
+}
+#endif
+
 }  // namespace json
 }  // namespace arrow
@@ -18,14 +18,23 @@
 #include "arrow/memory_pool_internal.h"
 
 #include <algorithm>  // IWYU pragma: keep
+#include <array>
 #include <atomic>
+#include <cmath>
 #include <cstdlib>   // IWYU pragma: keep
 #include <cstring>   // IWYU pragma: keep
+#include <fstream>
 #include <iostream>  // IWYU pragma: keep
 #include <limits>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <random>
+#include <sstream>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
 
 #if defined(sun) || defined(__sun)
 #  include <stdlib.h>
@@ -49,6 +58,14 @@
 #  include <malloc.h>
 #endif
 
+#ifndef _WIN32
+#  include <sys/mman.h>
+#endif
+
+#ifdef ARROW_WITH_BACKTRACE
+#  include <execinfo.h>
+#endif
+
 #ifdef ARROW_MIMALLOC
 #  include <mimalloc.h>
 #endif
@@ -69,6 +86,7 @@ namespace {
 
 constexpr char kDefaultBackendEnvVar[] = "ARROW_DEFAULT_MEMORY_POOL";
 constexpr char kDebugMemoryEnvVar[] = "ARROW_DEBUG_MEMORY_POOL";
+constexpr char kLargePagesEnvVar[] = "ARROW_MEMORY_POOL_LARGE_PAGES";
 
 enum class MemoryPoolBackend : uint8_t { System, Jemalloc, Mimalloc };
 
@@ -135,6 +153,41 @@ std::optional<MemoryPoolBackend> UserSelectedBackend() {
   return user_selected_backend;
 }
 
+// Return the LargePageOptions selected by the user through the
+// ARROW_MEMORY_POOL_LARGE_PAGES environment variable, if any.  The variable holds
+// a comma-separated list of "transparent", "explicit" and "prefault".
+std::optional<LargePageOptions> UserLargePageOptions() {
+  static auto user_options = []() -> std::optional<LargePageOptions> {
+    auto maybe_value = internal::GetEnvVar(kLargePagesEnvVar);
+    if (!maybe_value.ok()) {
+      return {};
+    }
+    const auto value = *std::move(maybe_value);
+    if (value.empty() || value == "none") {
+      return {};
+    }
+    auto options = LargePageOptions::Defaults();
+    options.transparent_huge_pages = false;
+    for (const auto token : internal::SplitString(value, ',')) {
+      if (token == "transparent") {
+        options.transparent_huge_pages = true;
+      } else if (token == "explicit") {
+        options.explicit_huge_pages = true;
+      } else if (token == "prefault") {
+        options.prefault = true;
+      } else {
+        ARROW_LOG(WARNING) << "Unsupported option '" << token << "' specified in "
+                           << kLargePagesEnvVar
+                           << " (supported options are 'transparent', 'explicit', "
+                              "'prefault' and 'none')";
+      }
+    }
+    return options;
+  }();
+
+  return user_options;
+}
+
 MemoryPoolBackend DefaultBackend() {
   auto backend = UserSelectedBackend();
   if (backend.has_value()) {
@@ -666,7 +719,9 @@ Status mimalloc_memory_pool(MemoryPool** out) {
 #endif
 }
 
-MemoryPool* default_memory_pool() {
+namespace {
+
+MemoryPool* default_backend_memory_pool() {
   auto backend = DefaultBackend();
   switch (backend) {
     case MemoryPoolBackend::System:
@@ -685,6 +740,19 @@ MemoryPool* default_memory_pool() {
   }
 }
 
+}  // namespace
+
+MemoryPool* default_memory_pool() {
+  if (UserLargePageOptions().has_value()) {
+    // Leaked on purpose: buffers from the default pool may be freed during
+    // static destruction
+    static auto* large_page_pool =
+        new LargePageMemoryPool(default_backend_memory_pool(), *UserLargePageOptions());
+    return large_page_pool;
+  }
+  return default_backend_memory_pool();
+}
+
 #ifndef ARROW_JEMALLOC
 Status jemalloc_set_decay_ms(int ms) {
   return Status::NotImplemented("jemalloc support is not built");
@@ -857,9 +925,628 @@ std::vector<std::string> SupportedMemoryBackendNames() {
   return supported;
 }
 
+///////////////////////////////////////////////////////////////////////
+// ArenaMemoryPool implementation
+
+class ArenaMemoryPool::ArenaMemoryPoolImpl {
+ public:
+  ArenaMemoryPoolImpl(MemoryPool* pool, int64_t chunk_size)
+      : pool_(pool),
+        chunk_size_(bit_util::NextPower2(std::max(chunk_size, kMinChunkSize))),
+        max_small_size_(chunk_size_ / 8),
+        max_small_alignment_(std::min(kMaxSmallAlignment, chunk_size_ / 2)) {}
+
+  ~ArenaMemoryPoolImpl() {
+    DCHECK_EQ(stats_.bytes_allocated(), 0)
+        << "ArenaMemoryPool destroyed while allocations are still alive";
+    if (current_ != nullptr && --header(current_)->refs == 0) {
+      free_chunks_.push_back(current_);
+    }
+    ReleaseFreeChunks();
+  }
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+    if (!IsSmall(size, alignment)) {
+      RETURN_NOT_OK(pool_->Allocate(size, alignment, out));
+    } else {
+      std::lock_guard<std::mutex> lock(mutex_);
+      RETURN_NOT_OK(AllocateSmallUnlocked(size, alignment, out));
+    }
+    stats_.DidAllocateBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) {
+    const bool old_small = IsSmall(old_size, alignment);
+    const bool new_small = IsSmall(new_size, alignment);
+    if (!old_small && !new_small) {
+      RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, alignment, ptr));
+      stats_.DidReallocateBytes(old_size, new_size);
+      return Status::OK();
+    }
+    if (old_small && new_small) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      // Grow or shrink the most recent allocation in place
+      if (*ptr == last_allocation_ && *ptr + new_size <= current_ + chunk_size_) {
+        current_offset_ = (*ptr - current_) + new_size;
+        stats_.DidReallocateBytes(old_size, new_size);
+        return Status::OK();
+      }
+    }
+    uint8_t* out;
+    RETURN_NOT_OK(Allocate(new_size, alignment, &out));
+    memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    Free(*ptr, old_size, alignment);
+    *ptr = out;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+    stats_.DidFreeBytes(size);
+    if (!IsSmall(size, alignment)) {
+      pool_->Free(buffer, size, alignment);
+      return;
+    }
+    uint8_t* chunk = reinterpret_cast<uint8_t*>(reinterpret_cast<uintptr_t>(buffer) &
+                                                ~static_cast<uintptr_t>(chunk_size_ - 1));
+    if (--header(chunk)->refs == 0) {
+      // The chunk was retired and this was its last allocation
+      std::lock_guard<std::mutex> lock(mutex_);
+      free_chunks_.push_back(chunk);
+    }
+  }
+
+  void ReleaseUnused() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ReleaseFreeChunks();
+    }
+    pool_->ReleaseUnused();
+  }
+
+  void PrintStats() { pool_->PrintStats(); }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  int64_t total_bytes_allocated() const { return stats_.total_bytes_allocated(); }
+
+  int64_t num_allocations() const { return stats_.num_allocations(); }
+
+  std::string backend_name() const { return pool_->backend_name(); }
+
+  int64_t bytes_reserved() const { return bytes_reserved_.load(); }
+
+  int64_t num_chunks_allocated() const { return num_chunks_allocated_.load(); }
+
+ private:
+  static constexpr int64_t kMinChunkSize = 4096;
+  // The header of a chunk is stored in its first bytes, allocations start after it
+  static constexpr int64_t kChunkHeaderSize = 64;
+  static constexpr int64_t kMaxSmallAlignment = 4096;
+
+  struct ChunkHeader {
+    // The number of live allocations in the chunk, plus one while the chunk is
+    // the one being allocated from
+    std::atomic<int64_t> refs;
+  };
+
+  static ChunkHeader* header(uint8_t* chunk) {
+    return reinterpret_cast<ChunkHeader*>(chunk);
+  }
+
+  // An aligned small allocation always fits in a fresh chunk: it starts at most at
+  // chunk_size_ / 2 and takes at most chunk_size_ / 8 bytes
+  bool IsSmall(int64_t size, int64_t alignment) const {
+    return size > 0 && size <= max_small_size_ && alignment <= max_small_alignment_;
+  }
+
+  Status AllocateSmallUnlocked(int64_t size, int64_t alignment, uint8_t** out) {
+    int64_t offset = bit_util::RoundUpToPowerOf2(current_offset_, alignment);
+    if (current_ == nullptr || offset + size > chunk_size_) {
+      RETURN_NOT_OK(NextChunkUnlocked());
+      offset = bit_util::RoundUpToPowerOf2(kChunkHeaderSize, alignment);
+      DCHECK_LE(offset + size, chunk_size_);
+    }
+    ++header(current_)->refs;
+    *out = last_allocation_ = current_ + offset;
+    current_offset_ = offset + size;
+    return Status::OK();
+  }
+
+  Status NextChunkUnlocked() {
+    uint8_t* chunk;
+    if (!free_chunks_.empty()) {
+      chunk = free_chunks_.back();
+      free_chunks_.pop_back();
+    } else {
+      RETURN_NOT_OK(pool_->Allocate(chunk_size_, chunk_size_, &chunk));
+      bytes_reserved_ += chunk_size_;
+      ++num_chunks_allocated_;
+    }
+    new (chunk) ChunkHeader{{1}};
+    if (current_ != nullptr && --header(current_)->refs == 0) {
+      free_chunks_.push_back(current_);
+    }
+    current_ = chunk;
+    current_offset_ = kChunkHeaderSize;
+    last_allocation_ = nullptr;
+    return Status::OK();
+  }
+
+  void ReleaseFreeChunks() {
+    for (uint8_t* chunk : free_chunks_) {
+      pool_->Free(chunk, chunk_size_, chunk_size_);
+      bytes_reserved_ -= chunk_size_;
+    }
+    free_chunks_.clear();
+  }
+
+  MemoryPool* pool_;
+  const int64_t chunk_size_;
+  const int64_t max_small_size_;
+  const int64_t max_small_alignment_;
+  internal::MemoryPoolStats stats_;
+  std::atomic<int64_t> bytes_reserved_{0};
+  std::atomic<int64_t> num_chunks_allocated_{0};
+
+  std::mutex mutex_;
+  uint8_t* current_ = nullptr;
+  int64_t current_offset_ = 0;
+  uint8_t* last_allocation_ = nullptr;
+  std::vector<uint8_t*> free_chunks_;
+};
+
+ArenaMemoryPool::ArenaMemoryPool(MemoryPool* wrapped_pool, int64_t chunk_size)
+    : impl_(new ArenaMemoryPoolImpl(wrapped_pool, chunk_size)) {}
+
+ArenaMemoryPool::~ArenaMemoryPool() {}
+
+Status ArenaMemoryPool::Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+  return impl_->Allocate(size, alignment, out);
+}
+
+Status ArenaMemoryPool::Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                                   uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, alignment, ptr);
+}
+
+void ArenaMemoryPool::Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+  return impl_->Free(buffer, size, alignment);
+}
+
+void ArenaMemoryPool::ReleaseUnused() { impl_->ReleaseUnused(); }
+
+void ArenaMemoryPool::PrintStats() { impl_->PrintStats(); }
+
+int64_t ArenaMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t ArenaMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t ArenaMemoryPool::total_bytes_allocated() const {
+  return impl_->total_bytes_allocated();
+}
+
+int64_t ArenaMemoryPool::num_allocations() const { return impl_->num_allocations(); }
+
+std::string ArenaMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+int64_t ArenaMemoryPool::bytes_reserved() const { return impl_->bytes_reserved(); }
+
+int64_t ArenaMemoryPool::num_chunks_allocated() const {
+  return impl_->num_chunks_allocated();
+}
+
+///////////////////////////////////////////////////////////////////////
+// LargePageMemoryPool implementation
+
+class LargePageMemoryPool::LargePageMemoryPoolImpl {
+ public:
+  LargePageMemoryPoolImpl(MemoryPool* pool, LargePageOptions options)
+      : pool_(pool), options_(options) {}
+
+  ~LargePageMemoryPoolImpl() {
+    DCHECK_EQ(stats_.bytes_allocated(), 0)
+        << "LargePageMemoryPool destroyed while allocations are still alive";
+    std::lock_guard<std::mutex> lock(mutex_);
+    TrimCacheUnlocked(/*max_cached=*/0);
+  }
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+    if (!IsLarge(size, alignment)) {
+      RETURN_NOT_OK(pool_->Allocate(size, alignment, out));
+    } else {
+      if (size > kMaxLargeSize) {
+        return Status::OutOfMemory("malloc of size ", size, " failed");
+      }
+      RETURN_NOT_OK(AllocateLarge(MappedSize(size), out));
+    }
+    stats_.DidAllocateBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) {
+    const bool old_large = IsLarge(old_size, alignment);
+    const bool new_large = IsLarge(new_size, alignment);
+    if (!old_large && !new_large) {
+      RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, alignment, ptr));
+      stats_.DidReallocateBytes(old_size, new_size);
+      return Status::OK();
+    }
+    if (old_large && new_large && MappedSize(old_size) == MappedSize(new_size)) {
+      // The mapping already has room for the new size
+      stats_.DidReallocateBytes(old_size, new_size);
+      return Status::OK();
+    }
+    uint8_t* out;
+    RETURN_NOT_OK(Allocate(new_size, alignment, &out));
+    memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    Free(*ptr, old_size, alignment);
+    *ptr = out;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+    stats_.DidFreeBytes(size);
+    if (!IsLarge(size, alignment)) {
+      pool_->Free(buffer, size, alignment);
+      return;
+    }
+    const int64_t mapped_size = MappedSize(size);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (bytes_cached_.load() + mapped_size <= options_.max_cached) {
+        cache_[mapped_size].push_back(buffer);
+        bytes_cached_ += mapped_size;
+        return;
+      }
+    }
+    Unmap(buffer, mapped_size);
+  }
+
+  void ReleaseUnused() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      TrimCacheUnlocked(options_.warm_reserve);
+    }
+    pool_->ReleaseUnused();
+  }
+
+  void PrintStats() {
+    std::cerr << "Large page mappings: " << bytes_mapped_.load() << " bytes mapped, "
+              << bytes_cached_.load() << " bytes cached, " << num_mappings_.load()
+              << " mappings created" << std::endl;
+    pool_->PrintStats();
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  int64_t total_bytes_allocated() const { return stats_.total_bytes_allocated(); }
+
+  int64_t num_allocations() const { return stats_.num_allocations(); }
+
+  std::string backend_name() const { return pool_->backend_name(); }
+
+  int64_t bytes_mapped() const { return bytes_mapped_.load(); }
+
+  int64_t bytes_cached() const { return bytes_cached_.load(); }
+
+  int64_t num_mappings() const { return num_mappings_.load(); }
+
+ private:
+  static constexpr int64_t kPageSize = 4096;
+  // Larger sizes cannot be rounded up to a huge page without overflowing
+  static constexpr int64_t kMaxLargeSize =
+      std::numeric_limits<int64_t>::max() - 2 * kHugePageSize;
+
+  bool IsLarge(int64_t size, int64_t alignment) const {
+#ifdef _WIN32
+    return false;
+#else
+    return size > 0 && size >= options_.min_size && alignment <= kHugePageSize;
+#endif
+  }
+
+  static int64_t MappedSize(int64_t size) {
+    return bit_util::RoundUpToPowerOf2(std::min(size, kMaxLargeSize), kHugePageSize);
+  }
+
+  Status AllocateLarge(int64_t mapped_size, uint8_t** out) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = cache_.find(mapped_size);
+      if (it != cache_.end()) {
+        *out = it->second.back();
+        it->second.pop_back();
+        if (it->second.empty()) {
+          cache_.erase(it);
+        }
+        bytes_cached_ -= mapped_size;
+        return Status::OK();
+      }
+    }
+    RETURN_NOT_OK(Map(mapped_size, out));
+    bytes_mapped_ += mapped_size;
+    ++num_mappings_;
+    if (options_.prefault) {
+      auto data = reinterpret_cast<volatile uint8_t*>(*out);
+      for (int64_t offset = 0; offset < mapped_size; offset += kPageSize) {
+        data[offset] = 0;
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Map(int64_t mapped_size, uint8_t** out) {
+#ifdef _WIN32
+    return Status::NotImplemented("Large page mappings are not supported on Windows");
+#else
+    const auto length = static_cast<size_t>(mapped_size);
+#  ifdef MAP_HUGETLB
+    if (options_.explicit_huge_pages) {
+      // Huge page mappings are naturally aligned on the huge page size
+      void* addr = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      if (addr != MAP_FAILED) {
+        *out = reinterpret_cast<uint8_t*>(addr);
+        return Status::OK();
+      }
+    }
+#  endif
+    // Over-map by a huge page and trim the ends, to get an aligned mapping
+    const size_t padded_length = length + kHugePageSize;
+    void* addr =
+        mmap(nullptr, padded_length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+             -1, 0);
+    if (addr == MAP_FAILED) {
+      return Status::OutOfMemory("mmap of size ", mapped_size, " failed");
+    }
+    auto start = reinterpret_cast<uintptr_t>(addr);
+    auto aligned = static_cast<uintptr_t>(bit_util::RoundUpToPowerOf2(
+        static_cast<uint64_t>(start), static_cast<uint64_t>(kHugePageSize)));
+    if (aligned > start) {
+      munmap(addr, aligned - start);
+    }
+    const uintptr_t end = start + padded_length;
+    if (end > aligned + length) {
+      munmap(reinterpret_cast<void*>(aligned + length), end - (aligned + length));
+    }
+    *out = reinterpret_cast<uint8_t*>(aligned);
+#  ifdef MADV_HUGEPAGE
+    if (options_.transparent_huge_pages) {
+      // Only a hint: this fails if transparent huge pages are disabled
+      ARROW_UNUSED(madvise(*out, length, MADV_HUGEPAGE));
+    }
+#  endif
+    return Status::OK();
+#endif
+  }
+
+  void Unmap(uint8_t* buffer, int64_t mapped_size) {
+#ifndef _WIN32
+    if (munmap(buffer, static_cast<size_t>(mapped_size)) != 0) {
+      ARROW_LOG(WARNING) << "munmap of size " << mapped_size << " failed";
+    }
+    bytes_mapped_ -= mapped_size;
+#endif
+  }
+
+  // Unmap cached mappings, largest first, until at most `max_cached` bytes remain
+  void TrimCacheUnlocked(int64_t max_cached) {
+    while (bytes_cached_.load() > max_cached && !cache_.empty()) {
+      auto it = std::prev(cache_.end());
+      Unmap(it->second.back(), it->first);
+      bytes_cached_ -= it->first;
+      it->second.pop_back();
+      if (it->second.empty()) {
+        cache_.erase(it);
+      }
+    }
+  }
+
+  MemoryPool* pool_;
+  const LargePageOptions options_;
+  internal::MemoryPoolStats stats_;
+  std::atomic<int64_t> bytes_mapped_{0};
+  std::atomic<int64_t> bytes_cached_{0};
+  std::atomic<int64_t> num_mappings_{0};
+
+  std::mutex mutex_;
+  // Freed mappings by size
+  std::map<int64_t, std::vector<uint8_t*>> cache_;
+};
+
+LargePageMemoryPool::LargePageMemoryPool(MemoryPool* wrapped_pool,
+                                         LargePageOptions options)
+    : impl_(new LargePageMemoryPoolImpl(wrapped_pool, options)) {}
+
+LargePageMemoryPool::~LargePageMemoryPool() {}
+
+Status LargePageMemoryPool::Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+  return impl_->Allocate(size, alignment, out);
+}
+
+Status LargePageMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                       int64_t alignment, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, alignment, ptr);
+}
+
+void LargePageMemoryPool::Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+  return impl_->Free(buffer, size, alignment);
+}
+
+void LargePageMemoryPool::ReleaseUnused() { impl_->ReleaseUnused(); }
+
+void LargePageMemoryPool::PrintStats() { impl_->PrintStats(); }
+
+int64_t LargePageMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t LargePageMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t LargePageMemoryPool::total_bytes_allocated() const {
+  return impl_->total_bytes_allocated();
+}
+
+int64_t LargePageMemoryPool::num_allocations() const { return impl_->num_allocations(); }
+
+std::string LargePageMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+int64_t LargePageMemoryPool::bytes_mapped() const { return impl_->bytes_mapped(); }
+
+int64_t LargePageMemoryPool::bytes_cached() const { return impl_->bytes_cached(); }
+
+int64_t LargePageMemoryPool::num_mappings() const { return impl_->num_mappings(); }
+
+///////////////////////////////////////////////////////////////////////
+// TrackingMemoryPool implementation
+
+void MemoryPoolSnapshot::Visit(
+    const std::function<void(const std::string& path, const MemoryPoolSnapshot&)>& visit)
+    const {
+  std::function<void(const std::string&, const MemoryPoolSnapshot&)> visit_path =
+      [&](const std::string& parent_path, const MemoryPoolSnapshot& snapshot) {
+        const auto path =
+            parent_path.empty() ? snapshot.name : parent_path + "/" + snapshot.name;
+        visit(path, snapshot);
+        for (const auto& child : snapshot.children) {
+          visit_path(path, child);
+        }
+      };
+  visit_path("", *this);
+}
+
+std::string MemoryPoolSnapshot::ToString() const {
+  std::stringstream ss;
+  Visit([&](const std::string& path, const MemoryPoolSnapshot& snapshot) {
+    ss << path << ": " << snapshot.bytes_allocated << " bytes allocated, "
+       << snapshot.max_memory << " max, " << snapshot.total_bytes_allocated
+       << " total in " << snapshot.num_allocations << " allocations";
+    if (snapshot.limit != TrackingMemoryPool::kNoLimit) {
+      ss << ", limit " << snapshot.limit;
+    }
+    ss << "\n";
+  });
+  return ss.str();
+}
+
+struct TrackingMemoryPool::Children {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<TrackingMemoryPool>> pools;
+};
+
+TrackingMemoryPool::TrackingMemoryPool(MemoryPool* wrapped_pool, std::string name,
+                                       int64_t limit)
+    : wrapped_(wrapped_pool),
+      parent_(nullptr),
+      name_(std::move(name)),
+      limit_(limit),
+      children_(new Children) {}
+
+TrackingMemoryPool::TrackingMemoryPool(TrackingMemoryPool* parent, std::string name)
+    : wrapped_(parent),
+      parent_(parent),
+      name_(std::move(name)),
+      limit_(kNoLimit),
+      children_(new Children) {}
+
+TrackingMemoryPool::~TrackingMemoryPool() = default;
+
+Status TrackingMemoryPool::CheckLimit(int64_t size) const {
+  const int64_t limit = limit_.load();
+  const int64_t allocated = stats_.bytes_allocated();
+  if (limit != kNoLimit && size > limit - allocated) {
+    return Status::OutOfMemory("MemoryPool '", name_, "' bytes_allocated ", allocated,
+                               " + requested ", size, " exceeds its limit of ", limit);
+  }
+  return Status::OK();
+}
+
+Status TrackingMemoryPool::Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+  RETURN_NOT_OK(CheckLimit(size));
+  RETURN_NOT_OK(wrapped_->Allocate(size, alignment, out));
+  stats_.DidAllocateBytes(size);
+  return Status::OK();
+}
+
+Status TrackingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                      int64_t alignment, uint8_t** ptr) {
+  if (new_size > old_size) {
+    RETURN_NOT_OK(CheckLimit(new_size - old_size));
+  }
+  RETURN_NOT_OK(wrapped_->Reallocate(old_size, new_size, alignment, ptr));
+  stats_.DidReallocateBytes(old_size, new_size);
+  return Status::OK();
+}
+
+void TrackingMemoryPool::Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+  wrapped_->Free(buffer, size, alignment);
+  stats_.DidFreeBytes(size);
+}
+
+void TrackingMemoryPool::PrintStats() { std::cerr << Snapshot().ToString(); }
+
+TrackingMemoryPool* TrackingMemoryPool::child(const std::string& name) {
+  std::lock_guard<std::mutex> lock(children_->mutex);
+  for (const auto& child : children_->pools) {
+    if (child->name() == name) {
+      return child.get();
+    }
+  }
+  children_->pools.emplace_back(new TrackingMemoryPool(this, name));
+  return children_->pools.back().get();
+}
+
+MemoryPoolSnapshot TrackingMemoryPool::Snapshot() const {
+  MemoryPoolSnapshot snapshot;
+  snapshot.name = name_;
+  snapshot.bytes_allocated = bytes_allocated();
+  snapshot.max_memory = max_memory();
+  snapshot.total_bytes_allocated = total_bytes_allocated();
+  snapshot.num_allocations = num_allocations();
+  snapshot.limit = limit();
+  std::lock_guard<std::mutex> lock(children_->mutex);
+  for (const auto& child : children_->pools) {
+    snapshot.children.push_back(child->Snapshot());
+  }
+  return snapshot;
+}
+
+MemoryPool* ChildMemoryPool(MemoryPool* pool, const std::string& name) {
+  auto tracking_pool = dynamic_cast<TrackingMemoryPool*>(pool);
+  if (tracking_pool == nullptr || tracking_pool->name() == name) {
+    return pool;
+  }
+  return tracking_pool->child(name);
+}
+
 ///////////////////////////////////////////////////////////////////////
 // CappedMemoryPool implementation
 
+struct CappedMemoryPool::PressureState {
+  std::mutex mutex;
+  std::vector<std::shared_ptr<MemoryPressureListener>> listeners;
+  std::atomic<bool> above_soft_limit{false};
+
+  std::vector<std::shared_ptr<MemoryPressureListener>> GetListeners() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return listeners;
+  }
+};
+
+CappedMemoryPool::CappedMemoryPool(MemoryPool* wrapped_pool,
+                                   int64_t bytes_allocated_limit, int64_t soft_limit)
+    : wrapped_(wrapped_pool),
+      bytes_allocated_limit_(bytes_allocated_limit),
+      soft_limit_(std::min(soft_limit, bytes_allocated_limit)),
+      pressure_state_(std::make_unique<PressureState>()) {}
+
+CappedMemoryPool::~CappedMemoryPool() = default;
+
 Status CappedMemoryPool::Allocate(int64_t size, int64_t alignment, uint8_t** out) {
   // XXX Another thread may allocate memory between the limit check and
   // the `Allocate` call. It is possible for the two allocations to be successful
@@ -870,7 +1557,9 @@ Status CappedMemoryPool::Allocate(int64_t size, int64_t alignment, uint8_t** out
   if (ARROW_PREDICT_FALSE(bytes_allocated_limit_ - allocated < size)) {
     return OutOfMemory(allocated, size);
   }
-  return wrapped_->Allocate(size, alignment, out);
+  RETURN_NOT_OK(wrapped_->Allocate(size, alignment, out));
+  CheckSoftLimit();
+  return Status::OK();
 }
 
 Status CappedMemoryPool::Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
@@ -881,14 +1570,70 @@ Status CappedMemoryPool::Reallocate(int64_t old_size, int64_t new_size, int64_t
       return OutOfMemory(allocated, new_size - old_size);
     }
   }
-  return wrapped_->Reallocate(old_size, new_size, alignment, ptr);
+  RETURN_NOT_OK(wrapped_->Reallocate(old_size, new_size, alignment, ptr));
+  CheckSoftLimit();
+  return Status::OK();
 }
 
 void CappedMemoryPool::Free(uint8_t* buffer, int64_t size, int64_t alignment) {
-  return wrapped_->Free(buffer, size, alignment);
+  wrapped_->Free(buffer, size, alignment);
+  CheckSoftLimit();
+}
+
+bool CappedMemoryPool::soft_limit_exceeded() const {
+  return pressure_state_->above_soft_limit.load(std::memory_order_relaxed);
+}
+
+void CappedMemoryPool::AddPressureListener(
+    std::shared_ptr<MemoryPressureListener> listener) {
+  DCHECK_NE(listener, nullptr);
+  {
+    std::lock_guard<std::mutex> lock(pressure_state_->mutex);
+    pressure_state_->listeners.push_back(listener);
+  }
+  if (soft_limit_exceeded()) {
+    listener->OnSoftLimitExceeded(wrapped_->bytes_allocated());
+  }
+}
+
+void CappedMemoryPool::RemovePressureListener(const MemoryPressureListener* listener) {
+  std::lock_guard<std::mutex> lock(pressure_state_->mutex);
+  auto& listeners = pressure_state_->listeners;
+  listeners.erase(std::remove_if(listeners.begin(), listeners.end(),
+                                 [&](const std::shared_ptr<MemoryPressureListener>& l) {
+                                   return l.get() == listener;
+                                 }),
+                  listeners.end());
+}
+
+void CappedMemoryPool::CheckSoftLimit() {
+  if (soft_limit_ >= bytes_allocated_limit_) {
+    // No soft limit configured
+    return;
+  }
+  const int64_t allocated = wrapped_->bytes_allocated();
+  const bool above = allocated > soft_limit_;
+  // Only the thread that flips the flag notifies, so that each transition is
+  // reported once
+  if (pressure_state_->above_soft_limit.load(std::memory_order_relaxed) == above ||
+      pressure_state_->above_soft_limit.exchange(above) == above) {
+    return;
+  }
+  // Listeners are called without holding the lock so that they can (un)register
+  // other listeners
+  for (const auto& listener : pressure_state_->GetListeners()) {
+    if (above) {
+      listener->OnSoftLimitExceeded(allocated);
+    } else {
+      listener->OnSoftLimitCleared(allocated);
+    }
+  }
 }
 
 Status CappedMemoryPool::OutOfMemory(int64_t current_allocated, int64_t requested) const {
+  for (const auto& listener : pressure_state_->GetListeners()) {
+    listener->OnHardLimitReached(current_allocated, requested);
+  }
   return Status::OutOfMemory(
       "MemoryPool bytes_allocated cap exceeded: "
       "limit=",
@@ -896,6 +1641,269 @@ Status CappedMemoryPool::OutOfMemory(int64_t current_allocated, int64_t requeste
       ", requested=", requested);
 }
 
+///////////////////////////////////////////////////////////////////////
+// AllocationProfilerMemoryPool implementation
+
+namespace {
+
+thread_local std::string_view current_allocation_tag;
+
+// The number of bytes the current thread still has to allocate before the next
+// sample, shared by all profiling pools
+thread_local int64_t bytes_until_sample = -1;
+
+int64_t NextSamplingDistance(int64_t sampling_interval) {
+  // Exponentially distributed distances make every byte equally likely to be
+  // sampled, regardless of the allocation sizes.
+  thread_local std::mt19937_64 rng(::arrow::internal::GetRandomSeed());
+  std::exponential_distribution<double> distribution(
+      1.0 / static_cast<double>(sampling_interval));
+  return std::max<int64_t>(1, static_cast<int64_t>(distribution(rng)));
+}
+
+std::vector<void*> CaptureStack(int max_depth) {
+#ifdef ARROW_WITH_BACKTRACE
+  // Skip the frames of the profiler itself
+  constexpr int kSkippedFrames = 3;
+  std::vector<void*> frames(max_depth + kSkippedFrames);
+  const int depth = backtrace(frames.data(), static_cast<int>(frames.size()));
+  if (depth <= kSkippedFrames) return {};
+  return std::vector<void*>(frames.begin() + kSkippedFrames, frames.begin() + depth);
+#else
+  ARROW_UNUSED(max_depth);
+  return {};
+#endif
+}
+
+}  // namespace
+
+ScopedAllocationTag::ScopedAllocationTag(std::string_view tag)
+    : previous_(current_allocation_tag) {
+  current_allocation_tag = tag;
+}
+
+ScopedAllocationTag::~ScopedAllocationTag() { current_allocation_tag = previous_; }
+
+std::string_view ScopedAllocationTag::current() { return current_allocation_tag; }
+
+class AllocationProfilerMemoryPool::Impl {
+ public:
+  explicit Impl(AllocationProfilerOptions options) : options_(options) {}
+
+  // Whether an allocation of `size` bytes should be sampled.  This is the only
+  // work done for most allocations.
+  bool ShouldSample(int64_t size) {
+    if (ARROW_PREDICT_FALSE(bytes_until_sample < 0)) {
+      bytes_until_sample = NextSamplingDistance(options_.sampling_interval);
+    }
+    bytes_until_sample -= size;
+    if (ARROW_PREDICT_TRUE(bytes_until_sample > 0)) return false;
+    bytes_until_sample = NextSamplingDistance(options_.sampling_interval);
+    return true;
+  }
+
+  void RecordAllocation(uint8_t* buffer, int64_t size) {
+    Site::Key key{std::string(current_allocation_tag),
+                  options_.record_stack ? CaptureStack(options_.max_stack_depth)
+                                        : std::vector<void*>{}};
+    // The number of allocations of this size that one sample stands for
+    const double weight =
+        1.0 / -std::expm1(-static_cast<double>(size) /
+                          static_cast<double>(options_.sampling_interval));
+    Site* site;
+    {
+      std::lock_guard<std::mutex> lock(sites_mutex_);
+      site = &sites_[std::move(key)];
+      site->live_samples++;
+      site->live_sampled_bytes += size;
+      site->total_samples++;
+      site->total_sampled_bytes += size;
+      site->live_count += weight;
+      site->live_bytes += weight * static_cast<double>(size);
+      site->total_count += weight;
+      site->total_bytes += weight * static_cast<double>(size);
+    }
+    LiveShard& shard = ShardFor(buffer);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.samples[buffer] = Sample{site, size, weight};
+    num_live_samples_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // Forget `buffer` if it was sampled, return whether it was
+  bool RecordFree(uint8_t* buffer) {
+    if (num_live_samples_.load(std::memory_order_relaxed) == 0) return false;
+    Sample sample;
+    {
+      LiveShard& shard = ShardFor(buffer);
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      auto it = shard.samples.find(buffer);
+      if (it == shard.samples.end()) return false;
+      sample = it->second;
+      shard.samples.erase(it);
+      num_live_samples_.fetch_sub(1, std::memory_order_relaxed);
+    }
+    std::lock_guard<std::mutex> lock(sites_mutex_);
+    Site* site = sample.site;
+    site->live_samples--;
+    site->live_sampled_bytes -= sample.size;
+    site->live_count -= sample.weight;
+    site->live_bytes -= sample.weight * static_cast<double>(sample.size);
+    return true;
+  }
+
+  std::vector<AllocationSite> Sites() const {
+    std::vector<AllocationSite> result;
+    {
+      std::lock_guard<std::mutex> lock(sites_mutex_);
+      result.reserve(sites_.size());
+      for (const auto& [key, site] : sites_) {
+        AllocationSite out;
+        out.tag = key.tag;
+        out.stack = key.stack;
+        out.live_count = std::llround(site.live_count);
+        out.live_bytes = std::llround(site.live_bytes);
+        out.total_count = std::llround(site.total_count);
+        out.total_bytes = std::llround(site.total_bytes);
+        result.push_back(std::move(out));
+      }
+    }
+    std::stable_sort(result.begin(), result.end(),
+                     [](const AllocationSite& left, const AllocationSite& right) {
+                       return left.live_bytes > right.live_bytes;
+                     });
+    return result;
+  }
+
+  // See the heap profile format of gperftools; the sampling interval in the
+  // header lets pprof scale the sampled counts and bytes back up.
+  Status WriteHeapProfile(std::ostream* out) const {
+    std::stringstream body;
+    int64_t live_samples = 0, live_bytes = 0, total_samples = 0, total_bytes = 0;
+    {
+      std::lock_guard<std::mutex> lock(sites_mutex_);
+      for (const auto& [key, site] : sites_) {
+        if (key.stack.empty()) continue;
+        live_samples += site.live_samples;
+        live_bytes += site.live_sampled_bytes;
+        total_samples += site.total_samples;
+        total_bytes += site.total_sampled_bytes;
+        body << site.live_samples << ": " << site.live_sampled_bytes << " ["
+             << site.total_samples << ": " << site.total_sampled_bytes << "] @";
+        for (void* frame : key.stack) {
+          body << " 0x" << std::hex << reinterpret_cast<uintptr_t>(frame) << std::dec;
+        }
+        body << "\n";
+      }
+    }
+    *out << "heap profile: " << live_samples << ": " << live_bytes << " ["
+         << total_samples << ": " << total_bytes << "] @ heap_v2/"
+         << options_.sampling_interval << "\n"
+         << body.str();
+#ifdef __linux__
+    // Let pprof map the addresses back to the binaries they belong to
+    std::ifstream maps("/proc/self/maps");
+    if (maps) {
+      *out << "\nMAPPED_LIBRARIES:\n" << maps.rdbuf();
+    }
+#endif
+    if (!*out) {
+      return Status::IOError("Failed writing heap profile");
+    }
+    return Status::OK();
+  }
+
+ private:
+  struct Site {
+    struct Key {
+      std::string tag;
+      std::vector<void*> stack;
+
+      bool operator<(const Key& other) const {
+        return std::tie(tag, stack) < std::tie(other.tag, other.stack);
+      }
+    };
+
+    // Actual samples, as written to heap profiles
+    int64_t live_samples = 0;
+    int64_t live_sampled_bytes = 0;
+    int64_t total_samples = 0;
+    int64_t total_sampled_bytes = 0;
+    // Estimates of the allocations the samples stand for
+    double live_count = 0;
+    double live_bytes = 0;
+    double total_count = 0;
+    double total_bytes = 0;
+  };
+
+  struct Sample {
+    Site* site = nullptr;
+    int64_t size = 0;
+    double weight = 0;
+  };
+
+  // Sampled buffers that are not freed yet, sharded by address so that frees
+  // from different threads seldom contend
+  struct LiveShard {
+    std::mutex mutex;
+    std::unordered_map<uint8_t*, Sample> samples;
+  };
+  static constexpr int kNumLiveShards = 16;
+
+  LiveShard& ShardFor(uint8_t* buffer) {
+    // Drop the low bits, which are mostly determined by the alignment
+    return live_shards_[(reinterpret_cast<uintptr_t>(buffer) >> 6) % kNumLiveShards];
+  }
+
+  const AllocationProfilerOptions options_;
+  mutable std::mutex sites_mutex_;
+  std::map<Site::Key, Site> sites_;
+  std::array<LiveShard, kNumLiveShards> live_shards_;
+  std::atomic<int64_t> num_live_samples_{0};
+};
+
+AllocationProfilerMemoryPool::AllocationProfilerMemoryPool(
+    MemoryPool* wrapped_pool, AllocationProfilerOptions options)
+    : wrapped_(wrapped_pool), impl_(std::make_unique<Impl>(options)) {}
+
+AllocationProfilerMemoryPool::~AllocationProfilerMemoryPool() = default;
+
+Status AllocationProfilerMemoryPool::Allocate(int64_t size, int64_t alignment,
+                                              uint8_t** out) {
+  RETURN_NOT_OK(wrapped_->Allocate(size, alignment, out));
+  if (size > 0 && impl_->ShouldSample(size)) {
+    impl_->RecordAllocation(*out, size);
+  }
+  return Status::OK();
+}
+
+Status AllocationProfilerMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                                int64_t alignment, uint8_t** ptr) {
+  uint8_t* old_buffer = *ptr;
+  RETURN_NOT_OK(wrapped_->Reallocate(old_size, new_size, alignment, ptr));
+  // A sampled buffer stays sampled, attributed to the call site that resized it.
+  // Otherwise only the growth counts towards the next sample.
+  const bool was_sampled = impl_->RecordFree(old_buffer);
+  if (new_size > 0 &&
+      (was_sampled || impl_->ShouldSample(std::max<int64_t>(new_size - old_size, 0)))) {
+    impl_->RecordAllocation(*ptr, new_size);
+  }
+  return Status::OK();
+}
+
+void AllocationProfilerMemoryPool::Free(uint8_t* buffer, int64_t size,
+                                        int64_t alignment) {
+  impl_->RecordFree(buffer);
+  wrapped_->Free(buffer, size, alignment);
+}
+
+std::vector<AllocationSite> AllocationProfilerMemoryPool::Sites() const {
+  return impl_->Sites();
+}
+
+Status AllocationProfilerMemoryPool::WriteHeapProfile(std::ostream* out) const {
+  return impl_->WriteHeapProfile(out);
+}
+
 // -----------------------------------------------------------------------
 // Pool buffer and allocation
 
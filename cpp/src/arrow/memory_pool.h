@@ -20,8 +20,12 @@
 #include <atomic>
 #include <cstdint>
 #include <functional>
+#include <iosfwd>
+#include <limits>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -246,15 +250,186 @@ class ARROW_EXPORT ProxyMemoryPool : public MemoryPool {
   std::unique_ptr<ProxyMemoryPoolImpl> impl_;
 };
 
+/// \brief EXPERIMENTAL MemoryPool carving small allocations out of large chunks
+///
+/// Small allocations are served by bumping a pointer into the current chunk,
+/// chunks being allocated from the wrapped pool.  Memory freed inside a chunk is
+/// not reused right away: once every allocation carved out of a chunk has been
+/// freed, the whole chunk is recycled for further allocations.  Recycled chunks
+/// are handed back to the wrapped pool by ReleaseUnused() or when the arena is
+/// destroyed.  Allocations larger than an eighth of the chunk size are forwarded
+/// to the wrapped pool.
+///
+/// This suits the many short-lived scratch buffers allocated while processing a
+/// batch, which avoid a round-trip through the general purpose allocator.  It is
+/// a poor fit for long-lived allocations, since a single one keeps its whole chunk
+/// alive.
+///
+/// Statistics reflect the allocations made through the arena, not the chunks.
+/// All allocations must be freed before the arena is destroyed.
+class ARROW_EXPORT ArenaMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kDefaultChunkSize = 1 << 20;
+
+  /// \brief Create an arena on top of another pool
+  ///
+  /// \param[in] wrapped_pool the pool chunks and large allocations come from
+  /// \param[in] chunk_size the size of a chunk, rounded up to a power of two
+  explicit ArenaMemoryPool(MemoryPool* wrapped_pool,
+                           int64_t chunk_size = kDefaultChunkSize);
+  ~ArenaMemoryPool() override;
+
+  using MemoryPool::Allocate;
+  using MemoryPool::Free;
+  using MemoryPool::Reallocate;
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override;
+  void ReleaseUnused() override;
+  void PrintStats() override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  int64_t total_bytes_allocated() const override;
+
+  int64_t num_allocations() const override;
+
+  std::string backend_name() const override;
+
+  /// The number of bytes held in chunks, whether in use or kept for recycling
+  int64_t bytes_reserved() const;
+
+  /// The number of chunks allocated from the wrapped pool so far
+  int64_t num_chunks_allocated() const;
+
+ private:
+  class ArenaMemoryPoolImpl;
+  std::unique_ptr<ArenaMemoryPoolImpl> impl_;
+};
+
+/// \brief Options for LargePageMemoryPool
+struct ARROW_EXPORT LargePageOptions {
+  /// Allocations smaller than this are forwarded to the wrapped pool
+  int64_t min_size = 1 << 20;
+  /// Advise the kernel to back the mappings with transparent huge pages
+  bool transparent_huge_pages = true;
+  /// Map explicitly reserved huge pages (hugetlbfs), falling back to regular
+  /// pages when none are available
+  bool explicit_huge_pages = false;
+  /// Touch every page of a new mapping upfront, so that page faults are not
+  /// taken by the first writer of the buffer
+  bool prefault = false;
+  /// Bytes of freed mappings kept for reuse by ReleaseUnused()
+  int64_t warm_reserve = 64 << 20;
+  /// Bytes of freed mappings kept for reuse at all; mappings freed beyond that
+  /// are returned to the OS right away
+  int64_t max_cached = 256 << 20;
+
+  static LargePageOptions Defaults() { return LargePageOptions(); }
+};
+
+/// \brief EXPERIMENTAL MemoryPool serving large allocations from huge pages
+///
+/// Allocations of at least `min_size` bytes are mapped directly from the OS in
+/// multiples of 2 MiB, aligned on 2 MiB boundaries so that they can be backed
+/// by huge pages, which reduces TLB misses and the number of page faults when
+/// scanning large buffers.  Freed mappings are cached per size and recycled for
+/// further allocations of the same rounded size, which avoids faulting in fresh
+/// pages again.  ReleaseUnused() unmaps cached mappings, except for a warm
+/// reserve of `warm_reserve` bytes.
+///
+/// Smaller allocations, and allocations with an alignment larger than 2 MiB,
+/// are forwarded to the wrapped pool.  On platforms without mmap() all
+/// allocations are forwarded.
+///
+/// Statistics reflect the allocations made through the pool, not the mappings.
+/// The default memory pool can be wrapped in a LargePageMemoryPool by setting
+/// the ARROW_MEMORY_POOL_LARGE_PAGES environment variable.
+class ARROW_EXPORT LargePageMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kHugePageSize = 2 << 20;
+
+  explicit LargePageMemoryPool(MemoryPool* wrapped_pool,
+                               LargePageOptions options = LargePageOptions::Defaults());
+  ~LargePageMemoryPool() override;
+
+  using MemoryPool::Allocate;
+  using MemoryPool::Free;
+  using MemoryPool::Reallocate;
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override;
+  void ReleaseUnused() override;
+  void PrintStats() override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  int64_t total_bytes_allocated() const override;
+
+  int64_t num_allocations() const override;
+
+  std::string backend_name() const override;
+
+  /// The number of bytes currently mapped, whether in use or cached for reuse
+  int64_t bytes_mapped() const;
+
+  /// The number of bytes of freed mappings cached for reuse
+  int64_t bytes_cached() const;
+
+  /// The number of mappings created from the OS so far
+  int64_t num_mappings() const;
+
+ private:
+  class LargePageMemoryPoolImpl;
+  std::unique_ptr<LargePageMemoryPoolImpl> impl_;
+};
+
+/// \brief Receives notifications about the memory pressure of a CappedMemoryPool
+///
+/// Notifications are delivered synchronously from the thread that allocates or
+/// frees memory, possibly while the pool is being used by other threads.
+/// Implementations should therefore only record the event (e.g. set a flag that
+/// an operator checks before buffering more data) and must not allocate from or
+/// free to the pool that notifies them.  Under concurrent use notifications are
+/// best-effort: transitions may be reported late or out of order.
+class ARROW_EXPORT MemoryPressureListener {
+ public:
+  virtual ~MemoryPressureListener() = default;
+
+  /// \brief The bytes allocated from the pool went above its soft limit
+  virtual void OnSoftLimitExceeded(int64_t bytes_allocated) {}
+
+  /// \brief The bytes allocated from the pool went back under its soft limit
+  virtual void OnSoftLimitCleared(int64_t bytes_allocated) {}
+
+  /// \brief An allocation was rejected because it would exceed the hard limit
+  virtual void OnHardLimitReached(int64_t bytes_allocated, int64_t requested) {}
+};
+
 /// EXPERIMENTAL MemoryPool wrapper with an upper limit
 ///
+/// Allocations that would take the pool above `bytes_allocated_limit` (the hard
+/// limit) fail with OutOfMemory.  An optional soft limit, lower than the hard
+/// limit, can be set to warn registered MemoryPressureListener instances that
+/// they should release memory (e.g. by spilling to disk) before allocations start
+/// failing.
+///
 /// Checking for limits is not done in a fully thread-safe way, therefore
 /// multi-threaded allocations might be able to go successfully above the
 /// configured limit.
 class ARROW_EXPORT CappedMemoryPool : public MemoryPool {
  public:
-  CappedMemoryPool(MemoryPool* wrapped_pool, int64_t bytes_allocated_limit)
-      : wrapped_(wrapped_pool), bytes_allocated_limit_(bytes_allocated_limit) {}
+  CappedMemoryPool(MemoryPool* wrapped_pool, int64_t bytes_allocated_limit,
+                   int64_t soft_limit = std::numeric_limits<int64_t>::max());
+  ~CappedMemoryPool() override;
 
   using MemoryPool::Allocate;
   using MemoryPool::Reallocate;
@@ -280,11 +455,258 @@ class ARROW_EXPORT CappedMemoryPool : public MemoryPool {
 
   std::string backend_name() const override { return wrapped_->backend_name(); }
 
+  int64_t hard_limit() const { return bytes_allocated_limit_; }
+  int64_t soft_limit() const { return soft_limit_; }
+
+  /// \brief Whether the bytes allocated are currently above the soft limit
+  bool soft_limit_exceeded() const;
+
+  /// \brief Register a listener to be notified of memory pressure
+  ///
+  /// If the soft limit is already exceeded, the listener is notified right away.
+  void AddPressureListener(std::shared_ptr<MemoryPressureListener> listener);
+
+  /// \brief Unregister a listener previously passed to AddPressureListener
+  void RemovePressureListener(const MemoryPressureListener* listener);
+
  private:
   Status OutOfMemory(int64_t current_allocated, int64_t requested) const;
+  void CheckSoftLimit();
+
+  struct PressureState;
 
   MemoryPool* wrapped_;
   const int64_t bytes_allocated_limit_;
+  const int64_t soft_limit_;
+  std::unique_ptr<PressureState> pressure_state_;
+};
+
+/// \brief The statistics of a TrackingMemoryPool and of its children
+struct ARROW_EXPORT MemoryPoolSnapshot {
+  std::string name;
+  int64_t bytes_allocated = 0;
+  int64_t max_memory = 0;
+  int64_t total_bytes_allocated = 0;
+  int64_t num_allocations = 0;
+  /// The limit of the pool, or TrackingMemoryPool::kNoLimit
+  int64_t limit = -1;
+  std::vector<MemoryPoolSnapshot> children;
+
+  /// \brief Call `visit` with the slash-separated path of this snapshot and each
+  /// of its descendants, e.g. "root/acero/ipc", in depth-first order
+  ///
+  /// This is convenient to export the statistics to a metrics system.
+  void Visit(
+      const std::function<void(const std::string& path, const MemoryPoolSnapshot&)>&
+          visit) const;
+
+  /// \brief A human-readable representation, one line per pool
+  std::string ToString() const;
+};
+
+/// \brief EXPERIMENTAL MemoryPool attributing allocations to named children
+///
+/// A TrackingMemoryPool keeps its own statistics, and optionally enforces a limit
+/// on the bytes allocated through it.  Children are created on demand by name and
+/// allocate through their parent, so the statistics of a parent include those of
+/// its children.  Snapshot() returns the statistics of the whole hierarchy.
+///
+/// Children are owned by their parent and live as long as it does, so that
+/// buffers allocated from a child can outlive whoever asked for the child.
+///
+/// Arrow components that allocate significant amounts of memory (Parquet, Acero,
+/// IPC and Flight readers) allocate from a child named after them when given a
+/// TrackingMemoryPool, see ChildMemoryPool().
+class ARROW_EXPORT TrackingMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kNoLimit = -1;
+
+  /// \brief Create a root pool
+  ///
+  /// \param[in] wrapped_pool the pool the memory comes from
+  /// \param[in] name the name of the pool in snapshots
+  /// \param[in] limit the maximum number of bytes allocated through the pool
+  explicit TrackingMemoryPool(MemoryPool* wrapped_pool, std::string name = "root",
+                              int64_t limit = kNoLimit);
+  ~TrackingMemoryPool() override;
+
+  using MemoryPool::Allocate;
+  using MemoryPool::Free;
+  using MemoryPool::Reallocate;
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override;
+
+  void ReleaseUnused() override { wrapped_->ReleaseUnused(); }
+
+  void PrintStats() override;
+
+  int64_t bytes_allocated() const override { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const override { return stats_.max_memory(); }
+
+  int64_t total_bytes_allocated() const override {
+    return stats_.total_bytes_allocated();
+  }
+
+  int64_t num_allocations() const override { return stats_.num_allocations(); }
+
+  std::string backend_name() const override { return wrapped_->backend_name(); }
+
+  /// \brief Return the child with the given name, creating it if needed
+  ///
+  /// The child is owned by this pool.
+  TrackingMemoryPool* child(const std::string& name);
+
+  const std::string& name() const { return name_; }
+
+  /// The parent of this pool, or null for a root pool
+  TrackingMemoryPool* parent() const { return parent_; }
+
+  int64_t limit() const { return limit_.load(); }
+
+  /// \brief Change the limit of the pool
+  ///
+  /// Lowering the limit under the bytes currently allocated only makes further
+  /// allocations fail.
+  void set_limit(int64_t limit) { limit_.store(limit); }
+
+  /// \brief The statistics of this pool and all its descendants
+  MemoryPoolSnapshot Snapshot() const;
+
+ private:
+  TrackingMemoryPool(TrackingMemoryPool* parent, std::string name);
+
+  Status CheckLimit(int64_t size) const;
+
+  MemoryPool* wrapped_;
+  TrackingMemoryPool* parent_;
+  const std::string name_;
+  std::atomic<int64_t> limit_;
+  internal::MemoryPoolStats stats_;
+
+  struct Children;
+  std::unique_ptr<Children> children_;
+};
+
+/// \brief Return the pool a component named `name` should allocate from
+///
+/// If `pool` is a TrackingMemoryPool, this is its child named `name` (or `pool`
+/// itself if it is already named `name`), otherwise `pool` itself.
+ARROW_EXPORT MemoryPool* ChildMemoryPool(MemoryPool* pool, const std::string& name);
+
+/// \brief Options for AllocationProfilerMemoryPool
+struct ARROW_EXPORT AllocationProfilerOptions {
+  /// One allocation is sampled every `sampling_interval` bytes allocated on
+  /// average.  Lower values give more precise profiles at a higher cost.
+  int64_t sampling_interval = 512 * 1024;
+  /// Record the call stack of sampled allocations, if Arrow was built with
+  /// backtrace support
+  bool record_stack = true;
+  /// The maximum number of frames recorded per call stack
+  int max_stack_depth = 32;
+
+  static AllocationProfilerOptions Defaults() { return AllocationProfilerOptions(); }
+};
+
+/// \brief The sampled allocations attributed to a call site
+///
+/// Counts and bytes are estimates of the actual allocations, scaled up from the
+/// sampled ones.
+struct ARROW_EXPORT AllocationSite {
+  /// The innermost ScopedAllocationTag active when the allocations were made,
+  /// or empty
+  std::string tag;
+  /// The return addresses of the call stack, innermost first (empty if stacks
+  /// are not recorded)
+  std::vector<void*> stack;
+  /// Allocations not freed yet
+  int64_t live_count = 0;
+  int64_t live_bytes = 0;
+  /// All allocations since the pool was created
+  int64_t total_count = 0;
+  int64_t total_bytes = 0;
+};
+
+/// \brief EXPERIMENTAL MemoryPool sampling allocations to find where memory is held
+///
+/// Unlike LoggingMemoryPool, only about one allocation per `sampling_interval`
+/// bytes is looked at, so that the pool can stay enabled under load (e.g. in a
+/// long-running server).  Each sampled allocation is attributed to its call
+/// stack and to the tag of the innermost ScopedAllocationTag of the allocating
+/// thread, and is tracked until it is freed.  Sites() then tells which call
+/// sites hold the live memory, which helps tracking down leaks and retained
+/// memory.
+///
+/// WriteHeapProfile() dumps the live samples in the legacy heap profile format
+/// of gperftools, which `pprof` reads and symbolizes.
+class ARROW_EXPORT AllocationProfilerMemoryPool : public MemoryPool {
+ public:
+  explicit AllocationProfilerMemoryPool(
+      MemoryPool* wrapped_pool,
+      AllocationProfilerOptions options = AllocationProfilerOptions::Defaults());
+  ~AllocationProfilerMemoryPool() override;
+
+  using MemoryPool::Allocate;
+  using MemoryPool::Free;
+  using MemoryPool::Reallocate;
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override;
+
+  void ReleaseUnused() override { wrapped_->ReleaseUnused(); }
+
+  void PrintStats() override { wrapped_->PrintStats(); }
+
+  int64_t bytes_allocated() const override { return wrapped_->bytes_allocated(); }
+
+  int64_t max_memory() const override { return wrapped_->max_memory(); }
+
+  int64_t total_bytes_allocated() const override {
+    return wrapped_->total_bytes_allocated();
+  }
+
+  int64_t num_allocations() const override { return wrapped_->num_allocations(); }
+
+  std::string backend_name() const override { return wrapped_->backend_name(); }
+
+  /// \brief The call sites of the sampled allocations, by decreasing live bytes
+  std::vector<AllocationSite> Sites() const;
+
+  /// \brief Write the live sampled allocations as a heap profile readable by pprof
+  ///
+  /// Call sites without a call stack are left out of the profile.
+  Status WriteHeapProfile(std::ostream* out) const;
+
+ private:
+  class Impl;
+
+  MemoryPool* wrapped_;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief Attribute the allocations of the current thread to `tag`
+///
+/// While the scope is alive, allocations sampled by an AllocationProfilerMemoryPool
+/// from the current thread are attributed to `tag` (e.g. "parquet.decode").  Scopes
+/// nest, the innermost one wins.  `tag` must outlive the scope, which is the case
+/// of string literals.
+class ARROW_EXPORT ScopedAllocationTag {
+ public:
+  explicit ScopedAllocationTag(std::string_view tag);
+  ~ScopedAllocationTag();
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ScopedAllocationTag);
+
+  /// The tag of the innermost scope of the current thread, or empty
+  static std::string_view current();
+
+ private:
+  std::string_view previous_;
 };
 
 /// \brief Return a process-wide memory pool based on the system allocator.
@@ -49,6 +49,14 @@ struct Mimalloc {
 };
 #endif
 
+// Large allocations mapped from huge pages on top of the default pool
+struct LargePages {
+  static Result<MemoryPool*> GetAllocator() {
+    static LargePageMemoryPool pool(default_memory_pool());
+    return &pool;
+  }
+};
+
 static void TouchCacheLines(uint8_t* data, int64_t nbytes) {
   uint8_t total = 0;
   while (nbytes > 0) {
@@ -116,7 +124,7 @@ static void AllocateTouchDeallocate(
 
 #define BENCHMARK_ALLOCATE_ARGS       \
   ->RangeMultiplier(16)               \
-      ->Range(4096, 16 * 1024 * 1024) \
+      ->Range(4096, 64 * 1024 * 1024) \
       ->ArgName("size")               \
       ->UseRealTime()                 \
       ->ThreadRange(1, 32)
@@ -129,6 +137,9 @@ BENCHMARK(TouchArea) BENCHMARK_ALLOCATE_ARGS;
 BENCHMARK_ALLOCATE(AllocateDeallocate, SystemAlloc);
 BENCHMARK_ALLOCATE(AllocateTouchDeallocate, SystemAlloc);
 
+BENCHMARK_ALLOCATE(AllocateDeallocate, LargePages);
+BENCHMARK_ALLOCATE(AllocateTouchDeallocate, LargePages);
+
 #ifdef ARROW_JEMALLOC
 BENCHMARK_ALLOCATE(AllocateDeallocate, Jemalloc);
 BENCHMARK_ALLOCATE(AllocateTouchDeallocate, Jemalloc);
@@ -17,7 +17,13 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include <limits>
 #include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -295,10 +301,11 @@ class TestCappedMemoryPool : public ::arrow::TestMemoryPoolBase {
  public:
   MemoryPool* memory_pool() override { return InitPool(/*limit=*/1'000'000'000LL); }
 
-  MemoryPool* InitPool(int64_t limit) {
+  MemoryPool* InitPool(int64_t limit,
+                       int64_t soft_limit = std::numeric_limits<int64_t>::max()) {
     proxy_memory_pool_ = std::make_shared<ProxyMemoryPool>(default_memory_pool());
     capped_memory_pool_ =
-        std::make_shared<CappedMemoryPool>(proxy_memory_pool_.get(), limit);
+        std::make_shared<CappedMemoryPool>(proxy_memory_pool_.get(), limit, soft_limit);
     return capped_memory_pool_.get();
   }
 
@@ -380,4 +387,500 @@ TEST_F(TestCappedMemoryPool, ReallocateLimit) {
   pool->Free(data2, 300);
 }
 
+namespace {
+
+class RecordingPressureListener : public MemoryPressureListener {
+ public:
+  void OnSoftLimitExceeded(int64_t bytes_allocated) override {
+    events.push_back({"exceeded", bytes_allocated});
+  }
+  void OnSoftLimitCleared(int64_t bytes_allocated) override {
+    events.push_back({"cleared", bytes_allocated});
+  }
+  void OnHardLimitReached(int64_t bytes_allocated, int64_t requested) override {
+    events.push_back({"hard", bytes_allocated + requested});
+  }
+
+  std::vector<std::pair<std::string, int64_t>> events;
+};
+
+}  // namespace
+
+TEST_F(TestCappedMemoryPool, SoftLimit) {
+  auto pool = InitPool(/*limit=*/1000, /*soft_limit=*/500);
+  ASSERT_EQ(1000, capped_memory_pool_->hard_limit());
+  ASSERT_EQ(500, capped_memory_pool_->soft_limit());
+  auto listener = std::make_shared<RecordingPressureListener>();
+  capped_memory_pool_->AddPressureListener(listener);
+
+  uint8_t* data1;
+  uint8_t* data2;
+  ASSERT_OK(pool->Allocate(400, &data1));
+  ASSERT_FALSE(capped_memory_pool_->soft_limit_exceeded());
+  ASSERT_TRUE(listener->events.empty());
+
+  // Soft limit exceeded: the allocation still succeeds
+  ASSERT_OK(pool->Allocate(200, &data2));
+  ASSERT_TRUE(capped_memory_pool_->soft_limit_exceeded());
+  ASSERT_OK(pool->Reallocate(200, 300, &data2));
+  pool->Free(data2, 300);
+  ASSERT_FALSE(capped_memory_pool_->soft_limit_exceeded());
+
+  using Event = std::pair<std::string, int64_t>;
+  std::vector<Event> expected = {Event{"exceeded", 600}, Event{"cleared", 400}};
+  ASSERT_EQ(expected, listener->events);
+
+  // A listener registered while under pressure is notified right away
+  ASSERT_OK(pool->Allocate(200, &data2));
+  auto late_listener = std::make_shared<RecordingPressureListener>();
+  capped_memory_pool_->AddPressureListener(late_listener);
+  expected = {Event{"exceeded", 600}};
+  ASSERT_EQ(expected, late_listener->events);
+
+  capped_memory_pool_->RemovePressureListener(late_listener.get());
+  pool->Free(data2, 200);
+  ASSERT_EQ(1, late_listener->events.size());
+  ASSERT_EQ(4, listener->events.size());
+
+  pool->Free(data1, 400);
+}
+
+TEST_F(TestCappedMemoryPool, HardLimitListener) {
+  auto pool = InitPool(/*limit=*/1000);
+  ASSERT_EQ(1000, capped_memory_pool_->soft_limit());
+  auto listener = std::make_shared<RecordingPressureListener>();
+  capped_memory_pool_->AddPressureListener(listener);
+
+  uint8_t* data;
+  ASSERT_OK(pool->Allocate(600, &data));
+  ASSERT_RAISES(OutOfMemory, pool->Allocate(401, &data));
+  ASSERT_RAISES(OutOfMemory, pool->Reallocate(600, 1100, &data));
+
+  using Event = std::pair<std::string, int64_t>;
+  std::vector<Event> expected = {Event{"hard", 1001}, Event{"hard", 1100}};
+  ASSERT_EQ(expected, listener->events);
+
+  pool->Free(data, 600);
+}
+
+class TestArenaMemoryPool : public ::arrow::TestMemoryPoolBase {
+ public:
+  MemoryPool* memory_pool() override {
+    return InitPool(ArenaMemoryPool::kDefaultChunkSize);
+  }
+
+  ArenaMemoryPool* InitPool(int64_t chunk_size) {
+    arena_memory_pool_.reset();
+    proxy_memory_pool_ = std::make_shared<ProxyMemoryPool>(default_memory_pool());
+    arena_memory_pool_ =
+        std::make_shared<ArenaMemoryPool>(proxy_memory_pool_.get(), chunk_size);
+    return arena_memory_pool_.get();
+  }
+
+ protected:
+  std::shared_ptr<ProxyMemoryPool> proxy_memory_pool_;
+  std::shared_ptr<ArenaMemoryPool> arena_memory_pool_;
+};
+
+TEST_F(TestArenaMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestArenaMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestArenaMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST_F(TestArenaMemoryPool, Alignment) { this->TestAlignment(); }
+
+TEST_F(TestArenaMemoryPool, ChunkRecycling) {
+  constexpr int64_t kChunkSize = 4096;
+  // The largest allocation carved out of a chunk, 7 of them fit in a chunk
+  constexpr int64_t kSize = kChunkSize / 8;
+  auto pool = InitPool(kChunkSize);
+  auto chunk_of = [&](uint8_t* ptr) {
+    return reinterpret_cast<uintptr_t>(ptr) / kChunkSize;
+  };
+
+  std::vector<uint8_t*> first(7);
+  for (auto& ptr : first) {
+    ASSERT_OK(pool->Allocate(kSize, &ptr));
+    ASSERT_EQ(chunk_of(first[0]), chunk_of(ptr));
+  }
+  ASSERT_EQ(1, pool->num_chunks_allocated());
+  ASSERT_EQ(kChunkSize, pool->bytes_reserved());
+  ASSERT_EQ(kChunkSize, proxy_memory_pool_->bytes_allocated());
+  ASSERT_EQ(7 * kSize, pool->bytes_allocated());
+
+  std::vector<uint8_t*> second(8);
+  for (auto& ptr : second) {
+    ASSERT_OK(pool->Allocate(kSize, &ptr));
+    if (&ptr == &second[0]) {
+      // The first chunk is full
+      ASSERT_EQ(2, pool->num_chunks_allocated());
+      ASSERT_NE(chunk_of(first[0]), chunk_of(ptr));
+      // Once everything allocated from it is freed it can be recycled
+      for (auto first_ptr : first) {
+        pool->Free(first_ptr, kSize);
+      }
+    }
+  }
+  // The last allocation didn't fit in the second chunk and reused the first one
+  ASSERT_EQ(chunk_of(first[0]), chunk_of(second[7]));
+  ASSERT_EQ(2, pool->num_chunks_allocated());
+  ASSERT_EQ(2 * kChunkSize, pool->bytes_reserved());
+  ASSERT_EQ(8 * kSize, pool->bytes_allocated());
+
+  // Large allocations bypass the chunks
+  uint8_t* large;
+  ASSERT_OK(pool->Allocate(kChunkSize, &large));
+  ASSERT_EQ(2, pool->num_chunks_allocated());
+  ASSERT_EQ(3 * kChunkSize, proxy_memory_pool_->bytes_allocated());
+  pool->Free(large, kChunkSize);
+
+  for (auto ptr : second) {
+    pool->Free(ptr, kSize);
+  }
+  ASSERT_EQ(0, pool->bytes_allocated());
+  // The second chunk was released by its last allocation and can be handed back,
+  // the current one is kept
+  pool->ReleaseUnused();
+  ASSERT_EQ(kChunkSize, pool->bytes_reserved());
+  arena_memory_pool_.reset();
+  ASSERT_EQ(0, proxy_memory_pool_->bytes_allocated());
+}
+
+TEST_F(TestArenaMemoryPool, ReallocateInPlace) {
+  auto pool = InitPool(/*chunk_size=*/4096);
+  uint8_t* data;
+  uint8_t* other;
+  ASSERT_OK(pool->Allocate(10, &data));
+  uint8_t* original = data;
+  ASSERT_OK(pool->Reallocate(10, 100, &data));
+  ASSERT_EQ(original, data);
+  ASSERT_EQ(100, pool->bytes_allocated());
+
+  // Not the latest allocation anymore
+  ASSERT_OK(pool->Allocate(10, &other));
+  data[0] = 42;
+  ASSERT_OK(pool->Reallocate(100, 200, &data));
+  ASSERT_NE(original, data);
+  ASSERT_EQ(42, data[0]);
+  ASSERT_EQ(210, pool->bytes_allocated());
+
+  pool->Free(data, 200);
+  pool->Free(other, 10);
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+TEST_F(TestArenaMemoryPool, LargeAlignment) {
+  constexpr int64_t kChunkSize = 4096;
+  auto pool = InitPool(kChunkSize);
+  // Aligned to more than half a chunk, the allocation would start past the end of
+  // a fresh chunk and goes to the wrapped pool instead
+  for (int64_t alignment : {kChunkSize, 2 * kChunkSize}) {
+    ARROW_SCOPED_TRACE("alignment = ", alignment);
+    uint8_t* data;
+    ASSERT_OK(pool->Allocate(1, alignment, &data));
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % alignment);
+    ASSERT_EQ(0, pool->num_chunks_allocated());
+    data[0] = 42;
+    pool->Free(data, 1, alignment);
+  }
+
+  // Half a chunk is still carved out of one
+  uint8_t* data;
+  ASSERT_OK(pool->Allocate(kChunkSize / 8, kChunkSize / 2, &data));
+  ASSERT_EQ(1, pool->num_chunks_allocated());
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % (kChunkSize / 2));
+  std::memset(data, 0, kChunkSize / 8);
+  pool->Free(data, kChunkSize / 8, kChunkSize / 2);
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+class TestLargePageMemoryPool : public ::arrow::TestMemoryPoolBase {
+ public:
+  MemoryPool* memory_pool() override { return InitPool(LargePageOptions::Defaults()); }
+
+  LargePageMemoryPool* InitPool(LargePageOptions options) {
+    large_page_memory_pool_.reset();
+    proxy_memory_pool_ = std::make_shared<ProxyMemoryPool>(default_memory_pool());
+    large_page_memory_pool_ =
+        std::make_shared<LargePageMemoryPool>(proxy_memory_pool_.get(), options);
+    return large_page_memory_pool_.get();
+  }
+
+ protected:
+  std::shared_ptr<ProxyMemoryPool> proxy_memory_pool_;
+  std::shared_ptr<LargePageMemoryPool> large_page_memory_pool_;
+};
+
+TEST_F(TestLargePageMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestLargePageMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestLargePageMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST_F(TestLargePageMemoryPool, Alignment) { this->TestAlignment(); }
+
+#ifndef _WIN32
+TEST_F(TestLargePageMemoryPool, Recycling) {
+  constexpr int64_t kHugePage = LargePageMemoryPool::kHugePageSize;
+  auto options = LargePageOptions::Defaults();
+  options.min_size = 1 << 20;
+  options.prefault = true;
+  options.warm_reserve = 4 * kHugePage;
+  options.max_cached = 8 * kHugePage;
+  auto pool = InitPool(options);
+
+  // Small allocations go to the wrapped pool
+  uint8_t* small;
+  ASSERT_OK(pool->Allocate(1000, &small));
+  ASSERT_EQ(1000, proxy_memory_pool_->bytes_allocated());
+  ASSERT_EQ(0, pool->num_mappings());
+
+  // Large allocations are mapped in multiples of the huge page size
+  uint8_t* large;
+  ASSERT_OK(pool->Allocate(3 * kHugePage + 1, &large));
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(large) % kHugePage);
+  ASSERT_EQ(1, pool->num_mappings());
+  ASSERT_EQ(4 * kHugePage, pool->bytes_mapped());
+  ASSERT_EQ(1000, proxy_memory_pool_->bytes_allocated());
+  ASSERT_EQ(3 * kHugePage + 1001, pool->bytes_allocated());
+  large[3 * kHugePage] = 42;
+
+  // Growing within the mapping doesn't move the data
+  uint8_t* original = large;
+  ASSERT_OK(pool->Reallocate(3 * kHugePage + 1, 4 * kHugePage, &large));
+  ASSERT_EQ(original, large);
+  ASSERT_EQ(42, large[3 * kHugePage]);
+
+  // A freed mapping is recycled for an allocation of the same rounded size
+  pool->Free(large, 4 * kHugePage);
+  ASSERT_EQ(4 * kHugePage, pool->bytes_cached());
+  ASSERT_OK(pool->Allocate(3 * kHugePage + 100, &large));
+  ASSERT_EQ(original, large);
+  ASSERT_EQ(1, pool->num_mappings());
+  ASSERT_EQ(0, pool->bytes_cached());
+
+  uint8_t* other;
+  ASSERT_OK(pool->Allocate(2 * kHugePage, &other));
+  ASSERT_EQ(2, pool->num_mappings());
+  pool->Free(large, 3 * kHugePage + 100);
+  pool->Free(other, 2 * kHugePage);
+  ASSERT_EQ(6 * kHugePage, pool->bytes_cached());
+
+  // ReleaseUnused trims the largest mappings down to the warm reserve
+  pool->ReleaseUnused();
+  ASSERT_EQ(2 * kHugePage, pool->bytes_cached());
+  ASSERT_EQ(2 * kHugePage, pool->bytes_mapped());
+
+  // Mappings freed beyond the cache limit are unmapped right away
+  uint8_t* huge;
+  ASSERT_OK(pool->Allocate(8 * kHugePage, &huge));
+  pool->Free(huge, 8 * kHugePage);
+  ASSERT_EQ(2 * kHugePage, pool->bytes_cached());
+  ASSERT_EQ(2 * kHugePage, pool->bytes_mapped());
+
+  pool->Free(small, 1000);
+  ASSERT_EQ(0, pool->bytes_allocated());
+  large_page_memory_pool_.reset();
+  ASSERT_EQ(0, proxy_memory_pool_->bytes_allocated());
+}
+#endif
+
+class TestTrackingMemoryPool : public ::arrow::TestMemoryPoolBase {
+ public:
+  MemoryPool* memory_pool() override {
+    tracking_memory_pool_ = std::make_shared<TrackingMemoryPool>(default_memory_pool());
+    return tracking_memory_pool_->child("child");
+  }
+
+ protected:
+  std::shared_ptr<TrackingMemoryPool> tracking_memory_pool_;
+};
+
+TEST_F(TestTrackingMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestTrackingMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestTrackingMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST_F(TestTrackingMemoryPool, Alignment) { this->TestAlignment(); }
+
+TEST_F(TestTrackingMemoryPool, Hierarchy) {
+  TrackingMemoryPool root(default_memory_pool(), "root", /*limit=*/1000);
+  auto parquet = root.child("parquet");
+  auto acero = root.child("acero");
+  ASSERT_EQ(parquet, root.child("parquet"));
+  ASSERT_EQ(&root, parquet->parent());
+  auto acero_ipc = ChildMemoryPool(acero, "ipc");
+  ASSERT_EQ(acero->child("ipc"), acero_ipc);
+  // Asking a pool for a child with its own name returns the pool itself
+  ASSERT_EQ(acero, ChildMemoryPool(acero, "acero"));
+  // Other pools are returned as is
+  ASSERT_EQ(default_memory_pool(), ChildMemoryPool(default_memory_pool(), "ipc"));
+
+  uint8_t *a, *b, *c;
+  ASSERT_OK(parquet->Allocate(100, &a));
+  ASSERT_OK(acero_ipc->Allocate(200, &b));
+  ASSERT_OK(acero->Allocate(300, &c));
+  ASSERT_EQ(100, parquet->bytes_allocated());
+  ASSERT_EQ(500, acero->bytes_allocated());
+  ASSERT_EQ(600, root.bytes_allocated());
+
+  // Limits apply to the descendants of a pool
+  acero->set_limit(600);
+  ASSERT_RAISES(OutOfMemory, acero_ipc->Reallocate(200, 400, &b));
+  ASSERT_RAISES(OutOfMemory, parquet->Allocate(401, &b));
+  ASSERT_OK(acero_ipc->Reallocate(200, 300, &b));
+
+  auto snapshot = root.Snapshot();
+  ASSERT_EQ("root", snapshot.name);
+  ASSERT_EQ(700, snapshot.bytes_allocated);
+  ASSERT_EQ(1000, snapshot.limit);
+  ASSERT_EQ(2, snapshot.children.size());
+  std::vector<std::pair<std::string, int64_t>> allocated;
+  snapshot.Visit([&](const std::string& path, const MemoryPoolSnapshot& snapshot) {
+    allocated.emplace_back(path, snapshot.bytes_allocated);
+  });
+  std::vector<std::pair<std::string, int64_t>> expected = {
+      {"root", 700}, {"root/parquet", 100}, {"root/acero", 600}, {"root/acero/ipc", 300}};
+  ASSERT_EQ(expected, allocated);
+  ASSERT_NE(std::string::npos,
+            snapshot.ToString().find("root/acero: 600 bytes allocated, 600 max"));
+
+  parquet->Free(a, 100);
+  acero_ipc->Free(b, 300);
+  acero->Free(c, 300);
+  ASSERT_EQ(0, root.bytes_allocated());
+  ASSERT_EQ(0, acero_ipc->bytes_allocated());
+  ASSERT_EQ(300, acero_ipc->max_memory());
+}
+
+class TestAllocationProfilerMemoryPool : public ::arrow::TestMemoryPoolBase {
+ public:
+  MemoryPool* memory_pool() override {
+    // Sample every allocation to exercise the bookkeeping
+    AllocationProfilerOptions options;
+    options.sampling_interval = 1;
+    pool_ = std::make_shared<AllocationProfilerMemoryPool>(default_memory_pool(),
+                                                           options);
+    return pool_.get();
+  }
+
+ protected:
+  std::shared_ptr<AllocationProfilerMemoryPool> pool_;
+};
+
+TEST_F(TestAllocationProfilerMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestAllocationProfilerMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestAllocationProfilerMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST_F(TestAllocationProfilerMemoryPool, Alignment) { this->TestAlignment(); }
+
+TEST_F(TestAllocationProfilerMemoryPool, Sites) {
+  AllocationProfilerOptions options;
+  options.sampling_interval = 1;
+  options.record_stack = false;
+  AllocationProfilerMemoryPool pool(default_memory_pool(), options);
+
+  uint8_t *a, *b, *c;
+  {
+    ScopedAllocationTag tag("outer");
+    {
+      ScopedAllocationTag inner_tag("inner");
+      ASSERT_EQ("inner", ScopedAllocationTag::current());
+      ASSERT_OK(pool.Allocate(1000, &a));
+      ASSERT_OK(pool.Allocate(1000, &b));
+    }
+    ASSERT_OK(pool.Allocate(100, &c));
+  }
+  ASSERT_EQ("", ScopedAllocationTag::current());
+
+  auto sites = pool.Sites();
+  ASSERT_EQ(2, sites.size());
+  ASSERT_EQ("inner", sites[0].tag);
+  ASSERT_TRUE(sites[0].stack.empty());
+  ASSERT_EQ(2, sites[0].live_count);
+  ASSERT_EQ(2000, sites[0].live_bytes);
+  ASSERT_EQ("outer", sites[1].tag);
+  ASSERT_EQ(100, sites[1].live_bytes);
+
+  // Resized buffers are attributed to the call site that resized them
+  ASSERT_OK(pool.Reallocate(1000, 1500, &b));
+  pool.Free(a, 1000);
+  sites = pool.Sites();
+  ASSERT_EQ(3, sites.size());
+  ASSERT_EQ("", sites[0].tag);
+  ASSERT_EQ(1500, sites[0].live_bytes);
+  ASSERT_EQ("outer", sites[1].tag);
+  ASSERT_EQ(100, sites[1].live_bytes);
+  ASSERT_EQ("inner", sites[2].tag);
+  ASSERT_EQ(0, sites[2].live_count);
+  ASSERT_EQ(0, sites[2].live_bytes);
+  ASSERT_EQ(2, sites[2].total_count);
+  ASSERT_EQ(2000, sites[2].total_bytes);
+
+  pool.Free(b, 1500);
+  pool.Free(c, 100);
+  for (const auto& site : pool.Sites()) {
+    ASSERT_EQ(0, site.live_bytes);
+  }
+}
+
+TEST_F(TestAllocationProfilerMemoryPool, Sampling) {
+  // With large allocations compared to the sampling interval, nearly all of them
+  // are sampled, and the estimates are close to the actual allocations
+  AllocationProfilerOptions options;
+  options.sampling_interval = 1024;
+  options.record_stack = false;
+  AllocationProfilerMemoryPool pool(default_memory_pool(), options);
+  std::vector<uint8_t*> buffers(100);
+  for (auto& buffer : buffers) {
+    ASSERT_OK(pool.Allocate(64 * 1024, &buffer));
+  }
+  auto sites = pool.Sites();
+  ASSERT_EQ(1, sites.size());
+  ASSERT_NEAR(100, sites[0].live_count, 1);
+  ASSERT_NEAR(100 * 64 * 1024, sites[0].live_bytes, 64 * 1024);
+  for (auto buffer : buffers) {
+    pool.Free(buffer, 64 * 1024);
+  }
+}
+
+TEST_F(TestAllocationProfilerMemoryPool, WriteHeapProfile) {
+  AllocationProfilerOptions options;
+  options.sampling_interval = 1;
+  AllocationProfilerMemoryPool pool(default_memory_pool(), options);
+  uint8_t* buffer;
+  ASSERT_OK(pool.Allocate(1000, &buffer));
+
+  std::stringstream ss;
+  ASSERT_OK(pool.WriteHeapProfile(&ss));
+  const std::string profile = ss.str();
+  ASSERT_EQ(0, profile.find("heap profile: ")) << profile;
+  ASSERT_NE(std::string::npos, profile.find("@ heap_v2/1\n")) << profile;
+  if (!pool.Sites()[0].stack.empty()) {
+    ASSERT_EQ(0, profile.find("heap profile: 1: 1000 [1: 1000]")) << profile;
+    ASSERT_NE(std::string::npos, profile.find("1: 1000 [1: 1000] @ 0x")) << profile;
+  }
+  pool.Free(buffer, 1000);
+}
+
 }  // namespace arrow
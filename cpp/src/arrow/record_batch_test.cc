@@ -20,6 +20,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -1203,6 +1204,45 @@ TEST_F(TestRecordBatch, ToTensorUnsupportedMixedFloat16) {
       batch1->ToTensor());
 }
 
+TEST_F(TestRecordBatch, ToTensorLargeColumnMajor) {
+  // Large enough to be converted a range of columns at a time
+  const int64_t length = 4096;
+  const int num_columns = 300;
+  random::RandomArrayGenerator gen(42);
+
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Array>> columns;
+  for (int i = 0; i < num_columns; ++i) {
+    // Mix in sliced columns, columns with nulls and columns that need a cast
+    if (i % 3 == 0) {
+      fields.push_back(field("f" + std::to_string(i), int32()));
+      columns.push_back(gen.Int32(length + 10, -100, 100)->Slice(i % 10, length));
+    } else {
+      fields.push_back(field("f" + std::to_string(i), float64()));
+      columns.push_back(gen.Float64(length, -1, 1, /*null_probability=*/0.1));
+    }
+  }
+  auto batch = RecordBatch::Make(::arrow::schema(fields), length, columns);
+
+  ASSERT_OK_AND_ASSIGN(auto tensor,
+                       batch->ToTensor(/*null_to_nan=*/true, /*row_major=*/false));
+  ASSERT_OK(tensor->Validate());
+  ASSERT_TRUE(tensor->is_column_major());
+  ASSERT_OK_AND_ASSIGN(auto row_major_tensor, batch->ToTensor(/*null_to_nan=*/true));
+  for (int i = 0; i < num_columns; ++i) {
+    for (int64_t j = 0; j < length; ++j) {
+      const double value = tensor->Value<DoubleType>({j, i});
+      const double row_major_value = row_major_tensor->Value<DoubleType>({j, i});
+      if (columns[i]->IsNull(j)) {
+        ASSERT_TRUE(std::isnan(value));
+        ASSERT_TRUE(std::isnan(row_major_value));
+      } else {
+        ASSERT_EQ(value, row_major_value);
+      }
+    }
+  }
+}
+
 namespace {
 template <typename ArrowType,
           typename = std::enable_if_t<is_boolean_type<ArrowType>::value ||
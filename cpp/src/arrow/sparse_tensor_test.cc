@@ -17,6 +17,7 @@
 
 // Unit tests for DataType (and subclasses), Field, and Schema
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <memory>
@@ -1676,4 +1677,66 @@ TEST(TestSparseCSFMatrixForUInt64Index, Make) {
   ASSERT_RAISES(Invalid, SparseCSFTensor::Make(dense_tensor, uint64()));
 }
 
+// Large enough to be converted in several tasks when the CPU pool has
+// more than one thread
+class TestLargeSparseTensorConversion : public ::testing::Test {
+ public:
+  void SetUp() {
+    values_.resize(kNumRows * kNumCols);
+    for (int64_t i = 0; i < static_cast<int64_t>(values_.size()); i += 37) {
+      values_[i] = static_cast<double>(i % 1000 + 1);
+    }
+    // A run of zero rows, and a row without zeros
+    std::fill_n(values_.begin() + 100 * kNumCols, 50 * kNumCols, 0.0);
+    std::fill_n(values_.begin() + 200 * kNumCols, kNumCols, -1.0);
+    non_zero_length_ = std::count_if(values_.begin(), values_.end(),
+                                     [](double value) { return value != 0; });
+  }
+
+  void CheckRoundTrip(const Tensor& tensor) {
+    ASSERT_OK_AND_ASSIGN(auto coo, SparseCOOTensor::Make(tensor, int32()));
+    ASSERT_EQ(non_zero_length_, coo->non_zero_length());
+    ASSERT_OK_AND_ASSIGN(auto coo_dense, coo->ToTensor());
+    ASSERT_TRUE(tensor.Equals(*coo_dense));
+
+    ASSERT_OK_AND_ASSIGN(auto csr, SparseCSRMatrix::Make(tensor, int32()));
+    ASSERT_EQ(non_zero_length_, csr->non_zero_length());
+    ASSERT_OK_AND_ASSIGN(auto csr_dense, csr->ToTensor());
+    ASSERT_TRUE(tensor.Equals(*csr_dense));
+
+    ASSERT_OK_AND_ASSIGN(auto csc, SparseCSCMatrix::Make(tensor, int64()));
+    ASSERT_EQ(non_zero_length_, csc->non_zero_length());
+    ASSERT_OK_AND_ASSIGN(auto csc_dense, csc->ToTensor());
+    ASSERT_TRUE(tensor.Equals(*csc_dense));
+  }
+
+ protected:
+  static constexpr int64_t kNumRows = 1500;
+  static constexpr int64_t kNumCols = 1000;
+
+  std::vector<double> values_;
+  int64_t non_zero_length_;
+};
+
+TEST_F(TestLargeSparseTensorConversion, RowMajor) {
+  Tensor tensor(float64(), Buffer::Wrap(values_), {kNumRows, kNumCols});
+  CheckRoundTrip(tensor);
+}
+
+TEST_F(TestLargeSparseTensorConversion, ColumnMajor) {
+  Tensor tensor(float64(), Buffer::Wrap(values_), {kNumRows, kNumCols},
+                {sizeof(double), sizeof(double) * kNumRows});
+  CheckRoundTrip(tensor);
+}
+
+TEST_F(TestLargeSparseTensorConversion, Tensor3D) {
+  Tensor tensor(float64(), Buffer::Wrap(values_), {30, 50, kNumCols});
+  ASSERT_OK_AND_ASSIGN(auto coo, SparseCOOTensor::Make(tensor, int64()));
+  ASSERT_EQ(non_zero_length_, coo->non_zero_length());
+  auto si = internal::checked_pointer_cast<SparseCOOIndex>(coo->sparse_index());
+  ASSERT_TRUE(si->is_canonical());
+  ASSERT_OK_AND_ASSIGN(auto dense, coo->ToTensor());
+  ASSERT_TRUE(tensor.Equals(*dense));
+}
+
 }  // namespace arrow
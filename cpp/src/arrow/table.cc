@@ -41,6 +41,8 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/vector.h"
 
 namespace arrow {
@@ -587,41 +589,62 @@ bool Table::Equals(const Table& other, const EqualOptions& opts) const {
   return true;
 }
 
-Result<std::shared_ptr<Table>> Table::CombineChunks(MemoryPool* pool) const {
-  const int ncolumns = num_columns();
-  std::vector<std::shared_ptr<ChunkedArray>> compacted_columns(ncolumns);
-  for (int i = 0; i < ncolumns; ++i) {
-    const auto& col = column(i);
-    if (col->num_chunks() <= 1) {
-      compacted_columns[i] = col;
-      continue;
-    }
+namespace {
 
-    if (is_binary_like(col->type()->id())) {
-      // ARROW-5744 Allow binary columns to be combined into multiple chunks to avoid
-      // buffer overflow
-      ArrayVector chunks;
-      int chunk_i = 0;
-      while (chunk_i < col->num_chunks()) {
-        ArrayVector safe_chunks;
-        int64_t data_length = 0;
-        for (; chunk_i < col->num_chunks(); ++chunk_i) {
-          const auto& chunk = col->chunk(chunk_i);
-          data_length += checked_cast<const BinaryArray&>(*chunk).total_values_length();
-          if (data_length >= kBinaryMemoryLimit) {
-            break;
-          }
-          safe_chunks.push_back(chunk);
+Result<std::shared_ptr<ChunkedArray>> CombineColumnChunks(
+    const std::shared_ptr<ChunkedArray>& col, MemoryPool* pool,
+    internal::Executor* executor) {
+  if (col->num_chunks() <= 1) {
+    return col;
+  }
+
+  if (is_binary_like(col->type()->id())) {
+    // ARROW-5744 Allow binary columns to be combined into multiple chunks to avoid
+    // buffer overflow
+    ArrayVector chunks;
+    int chunk_i = 0;
+    while (chunk_i < col->num_chunks()) {
+      ArrayVector safe_chunks;
+      int64_t data_length = 0;
+      for (; chunk_i < col->num_chunks(); ++chunk_i) {
+        const auto& chunk = col->chunk(chunk_i);
+        data_length += checked_cast<const BinaryArray&>(*chunk).total_values_length();
+        if (data_length >= kBinaryMemoryLimit) {
+          break;
         }
-        chunks.emplace_back();
-        ARROW_ASSIGN_OR_RAISE(chunks.back(), Concatenate(safe_chunks, pool));
+        safe_chunks.push_back(chunk);
       }
-      compacted_columns[i] = std::make_shared<ChunkedArray>(std::move(chunks));
-    } else {
-      ARROW_ASSIGN_OR_RAISE(auto compacted, Concatenate(col->chunks(), pool));
-      compacted_columns[i] = std::make_shared<ChunkedArray>(compacted);
+      chunks.emplace_back();
+      ARROW_ASSIGN_OR_RAISE(chunks.back(), Concatenate(safe_chunks, pool, executor));
     }
+    return std::make_shared<ChunkedArray>(std::move(chunks));
   }
+  ARROW_ASSIGN_OR_RAISE(auto compacted, Concatenate(col->chunks(), pool, executor));
+  return std::make_shared<ChunkedArray>(compacted);
+}
+
+}  // namespace
+
+Result<std::shared_ptr<Table>> Table::CombineChunks(MemoryPool* pool) const {
+  return CombineChunks(pool, /*executor=*/nullptr);
+}
+
+Result<std::shared_ptr<Table>> Table::CombineChunks(MemoryPool* pool,
+                                                    internal::Executor* executor) const {
+  const int ncolumns = num_columns();
+  std::vector<std::shared_ptr<ChunkedArray>> compacted_columns(ncolumns);
+  // Combine columns concurrently if that keeps the executor busy, otherwise split up
+  // the copies of each column.  Never both, as the nested wait could deadlock.
+  const bool across_columns = executor != nullptr && ncolumns >= executor->GetCapacity();
+  internal::Executor* column_executor = across_columns ? nullptr : executor;
+  RETURN_NOT_OK(internal::OptionalParallelFor(
+      across_columns, ncolumns,
+      [&](int i) -> Status {
+        ARROW_ASSIGN_OR_RAISE(compacted_columns[i],
+                              CombineColumnChunks(column(i), pool, column_executor));
+        return Status::OK();
+      },
+      executor));
   return Table::Make(schema(), std::move(compacted_columns), num_rows_);
 }
 
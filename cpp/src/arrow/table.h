@@ -235,6 +235,18 @@ class ARROW_EXPORT Table {
   Result<std::shared_ptr<Table>> CombineChunks(
       MemoryPool* pool = default_memory_pool()) const;
 
+  /// \brief Make a new table by combining the chunks this table has, copying data
+  /// concurrently on an executor.
+  ///
+  /// Columns are combined concurrently when there are enough of them to occupy the
+  /// executor, otherwise the copies within each column are split up.  This must not
+  /// be called from a task running on the executor.
+  ///
+  /// \param[in] pool The pool for buffer allocations
+  /// \param[in] executor The executor to copy data on
+  Result<std::shared_ptr<Table>> CombineChunks(MemoryPool* pool,
+                                               internal::Executor* executor) const;
+
   /// \brief Make a new record batch by combining the chunks this table has.
   ///
   /// All the underlying chunks in the ChunkedArray of each column are
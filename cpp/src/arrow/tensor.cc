@@ -30,6 +30,7 @@
 
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/tensor/converter.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
@@ -44,6 +45,18 @@ using internal::checked_cast;
 
 namespace internal {
 
+int ConversionTaskCount(int64_t size, int64_t length) {
+  if (size < kParallelConversionMinSize || length < 2) {
+    return 1;
+  }
+  auto executor = GetCpuThreadPool();
+  if (executor->GetCapacity() < 2 || executor->OwnsThisThread()) {
+    return 1;
+  }
+  // A few tasks per thread to balance rows of different densities
+  return static_cast<int>(std::min<int64_t>(length, 4 * executor->GetCapacity()));
+}
+
 Status ComputeRowMajorStrides(const FixedWidthType& type,
                               const std::vector<int64_t>& shape,
                               std::vector<int64_t>* strides) {
@@ -290,17 +303,30 @@ inline void ConvertColumnsToTensor(const RecordBatch& batch, uint8_t* out,
   using CType = typename arrow::TypeTraits<DataType>::CType;
   auto* out_values = reinterpret_cast<CType*>(out);
 
-  int i = 0;
-  for (const auto& column : batch.columns()) {
-    if (row_major) {
+  if (row_major) {
+    int i = 0;
+    for (const auto& column : batch.columns()) {
       ConvertColumnsToTensorRowMajorVisitor<CType> visitor{out_values, *column->data(),
                                                            batch.num_columns(), i++};
       DCHECK_OK(VisitTypeInline(*column->type(), &visitor));
-    } else {
-      ConvertColumnsToTensorVisitor<CType> visitor{out_values, *column->data()};
-      DCHECK_OK(VisitTypeInline(*column->type(), &visitor));
     }
-  }
+    return;
+  }
+
+  // In column-major order each column fills its own contiguous slice of the
+  // output, so that large batches can be converted a range of columns at a time
+  const int64_t num_rows = batch.num_rows();
+  const int num_cols = batch.num_columns();
+  DCHECK_OK(internal::ForEachConversionRange(
+      internal::ConversionTaskCount(num_rows * num_cols, num_cols), num_cols,
+      [&](int, int64_t begin, int64_t end) {
+        CType* column_values = out_values + begin * num_rows;
+        for (int i = static_cast<int>(begin); i < end; ++i) {
+          ConvertColumnsToTensorVisitor<CType> visitor{column_values,
+                                                       *batch.column_data(i)};
+          DCHECK_OK(VisitTypeInline(*batch.schema()->field(i)->type(), &visitor));
+        }
+      }));
 }
 
 Status RecordBatchToTensor(const RecordBatch& batch, bool null_to_nan, bool row_major,
@@ -19,11 +19,33 @@
 
 #include "arrow/sparse_tensor.h"  // IWYU pragma: export
 
+#include <algorithm>
+#include <cstdint>
 #include <memory>
 
+#include "arrow/util/parallel.h"
+
 namespace arrow {
 namespace internal {
 
+/// \brief The number of tasks to convert `length` rows of a tensor of `size` elements
+///
+/// Tensors of at least kParallelConversionMinSize elements are converted on the
+/// CPU thread pool, unless called from one of its threads.
+constexpr int64_t kParallelConversionMinSize = 1 << 20;
+
+int ConversionTaskCount(int64_t size, int64_t length);
+
+/// \brief Call func(task, begin, end) on `num_tasks` consecutive ranges covering
+/// [0, length), in parallel if there are several
+template <typename Func>
+Status ForEachConversionRange(int num_tasks, int64_t length, Func&& func) {
+  return OptionalParallelFor(num_tasks > 1, num_tasks, [&](int task) {
+    func(task, length * task / num_tasks, length * (task + 1) / num_tasks);
+    return Status::OK();
+  });
+}
+
 struct SparseTensorConverterMixin {
   static bool IsNonZero(const uint8_t val) { return val != 0; }
 
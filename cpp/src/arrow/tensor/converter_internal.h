@@ -17,8 +17,64 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "arrow/tensor/converter.h"
 
+namespace arrow {
+namespace internal {
+
+// The values of the tensors are compared to zero as unsigned integers of the same
+// width, which is what the DISPATCH macro below instantiates the converters with.
+
+/// \brief Count the nonzero values of `length` values `stride` bytes apart
+template <typename c_value_type>
+int64_t CountNonZeroValues(const uint8_t* data, int64_t length, int64_t stride) {
+  int64_t count = 0;
+  if (stride == sizeof(c_value_type)) {
+    // Vectorized by the compiler
+    const auto* values = reinterpret_cast<const c_value_type*>(data);
+    for (int64_t i = 0; i < length; ++i) {
+      count += values[i] != 0;
+    }
+  } else {
+    for (int64_t i = 0; i < length; ++i) {
+      count += *reinterpret_cast<const c_value_type*>(data + i * stride) != 0;
+    }
+  }
+  return count;
+}
+
+/// \brief Call visit(i, value) for the nonzero values of `length` values `stride`
+/// bytes apart
+template <typename c_value_type, typename Visit>
+void VisitNonZeroValues(const uint8_t* data, int64_t length, int64_t stride,
+                        Visit&& visit) {
+  int64_t i = 0;
+  if (stride == sizeof(c_value_type)) {
+    // Skip blocks of zeros, the bulk of sparse data, eight values at a time
+    constexpr int64_t kBlockSize = 8;
+    const auto* values = reinterpret_cast<const c_value_type*>(data);
+    for (; i + kBlockSize <= length; i += kBlockSize) {
+      c_value_type any = 0;
+      for (int64_t j = 0; j < kBlockSize; ++j) {
+        any |= values[i + j];
+      }
+      if (any == 0) continue;
+      for (int64_t j = i; j < i + kBlockSize; ++j) {
+        if (values[j] != 0) visit(j, values[j]);
+      }
+    }
+  }
+  for (; i < length; ++i) {
+    const auto value = *reinterpret_cast<const c_value_type*>(data + i * stride);
+    if (value != 0) visit(i, value);
+  }
+}
+
+}  // namespace internal
+}  // namespace arrow
+
 #define DISPATCH(ACTION, index_elsize, value_elsize, ...) \
   switch (index_elsize) {                                 \
     case 1:                                               \
@@ -27,6 +27,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/logging_internal.h"
 #include "arrow/util/macros.h"
 #include "arrow/visit_type_inline.h"
 
@@ -52,27 +53,63 @@ inline void IncrementRowMajorIndex(std::vector<c_index_type>& coord,
   }
 }
 
+// Scan the contiguous data of the tensor as rows along the last dimension of
+// `shape`, the shape of the tensor in memory order.  Large tensors are converted in
+// parallel over ranges of rows, after counting the nonzero values of each range to
+// know where its output starts.
 template <typename c_index_type, typename c_value_type>
-void ConvertRowMajorTensor(const Tensor& tensor, c_index_type* indices,
-                           c_value_type* values, const int64_t size) {
+void ConvertContiguousTensor(const Tensor& tensor, const std::vector<int64_t>& shape,
+                             c_index_type* indices, c_value_type* values) {
   const auto ndim = tensor.ndim();
-  const auto& shape = tensor.shape();
-  const c_value_type* tensor_data =
-      reinterpret_cast<const c_value_type*>(tensor.raw_data());
+  const int64_t row_length = shape[ndim - 1];
+  if (tensor.size() == 0) {
+    return;
+  }
+  const int64_t num_rows = tensor.size() / row_length;
+  const int64_t row_size = row_length * sizeof(c_value_type);
+  const uint8_t* tensor_data = tensor.raw_data();
+  const std::vector<int64_t> row_shape(shape.begin(), shape.end() - 1);
+
+  const int num_tasks = ConversionTaskCount(tensor.size(), num_rows);
+  std::vector<int64_t> task_offsets(num_tasks + 1, 0);
+  if (num_tasks > 1) {
+    DCHECK_OK(ForEachConversionRange(
+        num_tasks, num_rows, [&](int task, int64_t begin, int64_t end) {
+          task_offsets[task + 1] = CountNonZeroValues<c_value_type>(
+              tensor_data + begin * row_size, (end - begin) * row_length,
+              sizeof(c_value_type));
+        }));
+    std::partial_sum(task_offsets.begin(), task_offsets.end(), task_offsets.begin());
+  }
 
-  constexpr c_value_type zero = 0;
-  std::vector<c_index_type> coord(ndim, 0);
-  for (int64_t n = tensor.size(); n > 0; --n) {
-    const c_value_type x = *tensor_data;
-    if (ARROW_PREDICT_FALSE(x != zero)) {
-      std::copy(coord.begin(), coord.end(), indices);
-      *values++ = x;
-      indices += ndim;
-    }
+  DCHECK_OK(ForEachConversionRange(
+      num_tasks, num_rows, [&](int task, int64_t begin, int64_t end) {
+        c_index_type* out_indices = indices + task_offsets[task] * ndim;
+        c_value_type* out_values = values + task_offsets[task];
+        // The coordinates of the first row of the range
+        std::vector<c_index_type> coord(ndim, 0);
+        for (int64_t d = ndim - 2, row = begin; d >= 0; --d) {
+          coord[d] = static_cast<c_index_type>(row % row_shape[d]);
+          row /= row_shape[d];
+        }
+        for (int64_t row = begin; row < end; ++row) {
+          VisitNonZeroValues<c_value_type>(
+              tensor_data + row * row_size, row_length, sizeof(c_value_type),
+              [&](int64_t i, c_value_type value) {
+                std::copy(coord.begin(), coord.end() - 1, out_indices);
+                out_indices[ndim - 1] = static_cast<c_index_type>(i);
+                out_indices += ndim;
+                *out_values++ = value;
+              });
+          IncrementRowMajorIndex(coord, row_shape);
+        }
+      }));
+}
 
-    IncrementRowMajorIndex(coord, shape);
-    ++tensor_data;
-  }
+template <typename c_index_type, typename c_value_type>
+void ConvertRowMajorTensor(const Tensor& tensor, c_index_type* indices,
+                           c_value_type* values, const int64_t size) {
+  ConvertContiguousTensor(tensor, tensor.shape(), indices, values);
 }
 
 template <typename c_index_type, typename c_value_type>
@@ -81,7 +118,9 @@ void ConvertColumnMajorTensor(const Tensor& tensor, c_index_type* out_indices,
   const auto ndim = tensor.ndim();
   std::vector<c_index_type> indices(ndim * size);
   std::vector<c_value_type> values(size);
-  ConvertRowMajorTensor(tensor, indices.data(), values.data(), size);
+  const std::vector<int64_t> reversed_shape(tensor.shape().rbegin(),
+                                            tensor.shape().rend());
+  ConvertContiguousTensor(tensor, reversed_shape, indices.data(), values.data());
 
   // transpose indices
   for (int64_t i = 0; i < size; ++i) {
@@ -106,12 +145,10 @@ void ConvertColumnMajorTensor(const Tensor& tensor, c_index_type* out_indices,
   });
 
   // transfer result
-  const auto* indices_data = indices.data();
   for (int64_t i = 0; i < size; ++i) {
-    out_values[i] = values[i];
+    out_values[i] = values[order[i]];
 
-    std::copy_n(indices_data, ndim, out_indices);
-    indices_data += ndim;
+    std::copy_n(indices.data() + order[i] * ndim, ndim, out_indices);
     out_indices += ndim;
   }
 }
@@ -309,20 +346,26 @@ Result<std::shared_ptr<Tensor>> MakeTensorFromSparseCOOTensor(
 
   const auto* raw_data = sparse_tensor->raw_data();
   const int ndim = sparse_tensor->ndim();
-
-  for (int64_t i = 0; i < sparse_tensor->non_zero_length(); ++i) {
-    int64_t offset = 0;
-
-    for (int j = 0; j < ndim; ++j) {
-      auto index = static_cast<int64_t>(
-          SparseTensorConverterMixin::GetIndexValue(coords_data, index_elsize));
-      offset += index * strides[j];
-      coords_data += index_elsize;
-    }
-
-    std::copy_n(raw_data, value_elsize, values + offset);
-    raw_data += value_elsize;
-  }
+  const int64_t non_zero_length = sparse_tensor->non_zero_length();
+
+  // Each nonzero value has distinct coordinates
+  RETURN_NOT_OK(ForEachConversionRange(
+      ConversionTaskCount(sparse_tensor->size(), non_zero_length), non_zero_length,
+      [&](int, int64_t begin, int64_t end) {
+        const uint8_t* index_data = coords_data + begin * ndim * index_elsize;
+        for (int64_t i = begin; i < end; ++i) {
+          int64_t offset = 0;
+
+          for (int j = 0; j < ndim; ++j) {
+            auto index = static_cast<int64_t>(
+                SparseTensorConverterMixin::GetIndexValue(index_data, index_elsize));
+            offset += index * strides[j];
+            index_data += index_elsize;
+          }
+
+          std::copy_n(raw_data + i * value_elsize, value_elsize, values + offset);
+        }
+      }));
 
   return std::make_shared<Tensor>(sparse_tensor->type(), std::move(values_buffer),
                                   sparse_tensor->shape(), strides,
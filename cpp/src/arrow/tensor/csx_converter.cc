@@ -15,11 +15,12 @@
 // specific language governing permissions and limitations
 // under the License.
 
-#include "arrow/tensor/converter.h"
+#include "arrow/tensor/converter_internal.h"
 
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <vector>
 
 #include "arrow/buffer.h"
@@ -38,10 +39,7 @@ namespace {
 // ----------------------------------------------------------------------
 // SparseTensorConverter for SparseCSRIndex
 
-class SparseCSXMatrixConverter : private SparseTensorConverterMixin {
-  using SparseTensorConverterMixin::AssignIndex;
-  using SparseTensorConverterMixin::IsNonZero;
-
+class SparseCSXMatrixConverter {
  public:
   SparseCSXMatrixConverter(SparseMatrixCompressedAxis axis, const Tensor& tensor,
                            const std::shared_ptr<DataType>& index_value_type,
@@ -59,67 +57,79 @@ class SparseCSXMatrixConverter : private SparseTensorConverterMixin {
     if (ndim > 2) {
       return Status::Invalid("Invalid tensor dimension");
     }
+    if (ndim <= 1) {
+      return Status::NotImplemented("TODO for ndim <= 1");
+    }
 
-    const int major_axis = static_cast<int>(axis_);
-    const int64_t n_major = tensor_.shape()[major_axis];
-    const int64_t n_minor = tensor_.shape()[1 - major_axis];
-    ARROW_ASSIGN_OR_RAISE(int64_t nonzero_count, tensor_.CountNonZero());
-
-    std::shared_ptr<Buffer> indptr_buffer;
-    std::shared_ptr<Buffer> indices_buffer;
+#define CONVERT_CSX_MATRIX(index_type, value_type, func) \
+  return func<index_type, value_type>()
 
-    ARROW_ASSIGN_OR_RAISE(auto values_buffer,
-                          AllocateBuffer(value_elsize * nonzero_count, pool_));
-    auto* values = values_buffer->mutable_data();
+    DISPATCH(CONVERT_CSX_MATRIX, index_elsize, value_elsize, ConvertTyped);
 
-    const auto* tensor_data = tensor_.raw_data();
+#undef CONVERT_CSX_MATRIX
 
-    if (ndim <= 1) {
-      return Status::NotImplemented("TODO for ndim <= 1");
-    } else {
-      ARROW_ASSIGN_OR_RAISE(indptr_buffer,
-                            AllocateBuffer(index_elsize * (n_major + 1), pool_));
-      auto* indptr = indptr_buffer->mutable_data();
-
-      ARROW_ASSIGN_OR_RAISE(indices_buffer,
-                            AllocateBuffer(index_elsize * nonzero_count, pool_));
-      auto* indices = indices_buffer->mutable_data();
-
-      std::vector<int64_t> coords(2);
-      int64_t k = 0;
-      std::fill_n(indptr, index_elsize, 0);
-      indptr += index_elsize;
-      for (int64_t i = 0; i < n_major; ++i) {
-        for (int64_t j = 0; j < n_minor; ++j) {
-          if (axis_ == SparseMatrixCompressedAxis::ROW) {
-            coords = {i, j};
-          } else {
-            coords = {j, i};
-          }
-          const int64_t offset = tensor_.CalculateValueOffset(coords);
-          if (std::any_of(tensor_data + offset, tensor_data + offset + value_elsize,
-                          IsNonZero)) {
-            std::copy_n(tensor_data + offset, value_elsize, values);
-            values += value_elsize;
+    return Status::Invalid("Unsupported index or value width");
+  }
 
-            AssignIndex(indices, j, index_elsize);
-            indices += index_elsize;
+  std::shared_ptr<SparseIndex> sparse_index;
+  std::shared_ptr<Buffer> data;
 
-            k++;
+ private:
+  // Count the nonzero values of each major slice, then gather them, both in
+  // parallel over ranges of slices for large matrices
+  template <typename c_index_type, typename c_value_type>
+  Status ConvertTyped() {
+    const int major_axis = static_cast<int>(axis_);
+    const int64_t n_major = tensor_.shape()[major_axis];
+    const int64_t n_minor = tensor_.shape()[1 - major_axis];
+    const int64_t major_stride = tensor_.strides()[major_axis];
+    const int64_t minor_stride = tensor_.strides()[1 - major_axis];
+    const uint8_t* tensor_data = tensor_.raw_data();
+    const int num_tasks = ConversionTaskCount(tensor_.size(), n_major);
+
+    std::vector<int64_t> indptr(n_major + 1, 0);
+    RETURN_NOT_OK(ForEachConversionRange(
+        num_tasks, n_major, [&](int, int64_t begin, int64_t end) {
+          for (int64_t i = begin; i < end; ++i) {
+            indptr[i + 1] = CountNonZeroValues<c_value_type>(
+                tensor_data + i * major_stride, n_minor, minor_stride);
           }
-        }
-        AssignIndex(indptr, k, index_elsize);
-        indptr += index_elsize;
-      }
-    }
+        }));
+    std::partial_sum(indptr.begin(), indptr.end(), indptr.begin());
+    const int64_t nonzero_count = indptr[n_major];
+
+    ARROW_ASSIGN_OR_RAISE(auto indptr_buffer,
+                          AllocateBuffer(sizeof(c_index_type) * (n_major + 1), pool_));
+    ARROW_ASSIGN_OR_RAISE(auto indices_buffer,
+                          AllocateBuffer(sizeof(c_index_type) * nonzero_count, pool_));
+    ARROW_ASSIGN_OR_RAISE(auto values_buffer,
+                          AllocateBuffer(sizeof(c_value_type) * nonzero_count, pool_));
+    auto* out_indptr = indptr_buffer->mutable_data_as<c_index_type>();
+    auto* out_indices = indices_buffer->mutable_data_as<c_index_type>();
+    auto* out_values = values_buffer->mutable_data_as<c_value_type>();
+    std::copy(indptr.begin(), indptr.end(), out_indptr);
+
+    RETURN_NOT_OK(ForEachConversionRange(
+        num_tasks, n_major, [&](int, int64_t begin, int64_t end) {
+          for (int64_t i = begin; i < end; ++i) {
+            int64_t k = indptr[i];
+            VisitNonZeroValues<c_value_type>(
+                tensor_data + i * major_stride, n_minor, minor_stride,
+                [&](int64_t j, c_value_type value) {
+                  out_indices[k] = static_cast<c_index_type>(j);
+                  out_values[k] = value;
+                  ++k;
+                });
+          }
+        }));
 
     std::vector<int64_t> indptr_shape({n_major + 1});
-    std::shared_ptr<Tensor> indptr_tensor =
-        std::make_shared<Tensor>(index_value_type_, indptr_buffer, indptr_shape);
+    std::shared_ptr<Tensor> indptr_tensor = std::make_shared<Tensor>(
+        index_value_type_, std::move(indptr_buffer), indptr_shape);
 
     std::vector<int64_t> indices_shape({nonzero_count});
-    std::shared_ptr<Tensor> indices_tensor =
-        std::make_shared<Tensor>(index_value_type_, indices_buffer, indices_shape);
+    std::shared_ptr<Tensor> indices_tensor = std::make_shared<Tensor>(
+        index_value_type_, std::move(indices_buffer), indices_shape);
 
     if (axis_ == SparseMatrixCompressedAxis::ROW) {
       sparse_index = std::make_shared<SparseCSRIndex>(indptr_tensor, indices_tensor);
@@ -131,10 +141,6 @@ class SparseCSXMatrixConverter : private SparseTensorConverterMixin {
     return Status::OK();
   }
 
-  std::shared_ptr<SparseIndex> sparse_index;
-  std::shared_ptr<Buffer> data;
-
- private:
   SparseMatrixCompressedAxis axis_;
   const Tensor& tensor_;
   const std::shared_ptr<DataType>& index_value_type_;
@@ -182,32 +188,35 @@ Result<std::shared_ptr<Tensor>> MakeTensorFromSparseCSXMatrix(
   RETURN_NOT_OK(ComputeRowMajorStrides(fw_value_type, shape, &strides));
 
   const auto nc = shape[1];
-
-  int64_t offset = 0;
-  for (int64_t i = 0; i < indptr->size() - 1; ++i) {
-    const auto start =
-        SparseTensorConverterMixin::GetIndexValue(indptr_data, indptr_elsize);
-    const auto stop = SparseTensorConverterMixin::GetIndexValue(
-        indptr_data + indptr_elsize, indptr_elsize);
-
-    for (int64_t j = start; j < stop; ++j) {
-      const auto index = SparseTensorConverterMixin::GetIndexValue(
-          indices_data + j * indices_elsize, indices_elsize);
-      switch (axis) {
-        case SparseMatrixCompressedAxis::ROW:
-          offset = (index + i * nc) * value_elsize;
-          break;
-        case SparseMatrixCompressedAxis::COLUMN:
-          offset = (i + index * nc) * value_elsize;
-          break;
-      }
-
-      std::copy_n(raw_data, value_elsize, values + offset);
-      raw_data += value_elsize;
-    }
-
-    indptr_data += indptr_elsize;
-  }
+  const int64_t n_major = indptr->size() - 1;
+
+  // Each major slice fills distinct values of the dense tensor
+  RETURN_NOT_OK(ForEachConversionRange(
+      ConversionTaskCount(tensor_size, n_major), n_major,
+      [&](int, int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+          const auto start = SparseTensorConverterMixin::GetIndexValue(
+              indptr_data + i * indptr_elsize, indptr_elsize);
+          const auto stop = SparseTensorConverterMixin::GetIndexValue(
+              indptr_data + (i + 1) * indptr_elsize, indptr_elsize);
+
+          int64_t offset = 0;
+          for (int64_t j = start; j < stop; ++j) {
+            const auto index = SparseTensorConverterMixin::GetIndexValue(
+                indices_data + j * indices_elsize, indices_elsize);
+            switch (axis) {
+              case SparseMatrixCompressedAxis::ROW:
+                offset = (index + i * nc) * value_elsize;
+                break;
+              case SparseMatrixCompressedAxis::COLUMN:
+                offset = (i + index * nc) * value_elsize;
+                break;
+            }
+
+            std::copy_n(raw_data + j * value_elsize, value_elsize, values + offset);
+          }
+        }
+      }));
 
   return std::make_shared<Tensor>(value_type, std::move(values_buffer), shape, strides,
                                   dim_names);
@@ -19,6 +19,8 @@
 
 #include <numeric>
 #include <random>
+#include <utility>
+#include <vector>
 
 #include "arrow/sparse_tensor.h"
 #include "arrow/testing/gtest_util.h"
@@ -228,4 +230,65 @@ BENCHMARK_CONVERT_TENSOR(Tensor, CSF, Float, Int64);
 BENCHMARK_CONVERT_TENSOR(Tensor, CSF, Double, Int32);
 BENCHMARK_CONVERT_TENSOR(Tensor, CSF, Double, Int64);
 
+// Matrices of state.range(0) rows of 1000 values, 1% of them nonzero.  Large
+// matrices are converted in parallel.
+template <typename ValueType>
+std::shared_ptr<Tensor> MakeLargeMatrix(int64_t num_rows) {
+  using c_value_type = typename ValueType::c_type;
+  constexpr int64_t kNumCols = 1000;
+  std::vector<c_value_type> values(num_rows * kNumCols);
+  std::default_random_engine rng(42);
+  std::uniform_int_distribution<int64_t> dist(0, num_rows * kNumCols - 1);
+  for (int64_t i = 0; i < num_rows * kNumCols / 100; ++i) {
+    values[dist(rng)] = static_cast<c_value_type>(i % 100 + 1);
+  }
+  auto buffer = Buffer::FromVector(std::move(values));
+  return std::make_shared<Tensor>(TypeTraits<ValueType>::type_singleton(),
+                                  std::move(buffer),
+                                  std::vector<int64_t>{num_rows, kNumCols});
+}
+
+template <typename SparseType, typename ValueType>
+static void ConvertLargeMatrixToSparse(benchmark::State& state) {
+  auto tensor = MakeLargeMatrix<ValueType>(state.range(0));
+  std::shared_ptr<SparseType> sparse_tensor;
+  for (auto _ : state) {
+    ABORT_NOT_OK(SparseType::Make(*tensor, int64()).Value(&sparse_tensor));
+  }
+  benchmark::DoNotOptimize(sparse_tensor);
+  state.SetItemsProcessed(state.iterations() * tensor->size());
+  state.SetBytesProcessed(state.iterations() * tensor->data()->size());
+}
+
+template <typename SparseType, typename ValueType>
+static void ConvertLargeSparseToMatrix(benchmark::State& state) {
+  auto tensor = MakeLargeMatrix<ValueType>(state.range(0));
+  std::shared_ptr<SparseType> sparse_tensor;
+  ABORT_NOT_OK(SparseType::Make(*tensor, int64()).Value(&sparse_tensor));
+  std::shared_ptr<Tensor> dense_tensor;
+  for (auto _ : state) {
+    ABORT_NOT_OK(sparse_tensor->ToTensor().Value(&dense_tensor));
+  }
+  benchmark::DoNotOptimize(dense_tensor);
+  state.SetItemsProcessed(state.iterations() * tensor->size());
+  state.SetBytesProcessed(state.iterations() * tensor->data()->size());
+}
+
+static void SetLargeMatrixArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgName("num_rows")->Arg(1000)->Arg(10000)->UseRealTime();
+}
+
+BENCHMARK_TEMPLATE(ConvertLargeMatrixToSparse, SparseCOOTensor, DoubleType)
+    ->Apply(SetLargeMatrixArgs);
+BENCHMARK_TEMPLATE(ConvertLargeMatrixToSparse, SparseCSRMatrix, DoubleType)
+    ->Apply(SetLargeMatrixArgs);
+BENCHMARK_TEMPLATE(ConvertLargeMatrixToSparse, SparseCSCMatrix, DoubleType)
+    ->Apply(SetLargeMatrixArgs);
+BENCHMARK_TEMPLATE(ConvertLargeSparseToMatrix, SparseCOOTensor, DoubleType)
+    ->Apply(SetLargeMatrixArgs);
+BENCHMARK_TEMPLATE(ConvertLargeSparseToMatrix, SparseCSRMatrix, DoubleType)
+    ->Apply(SetLargeMatrixArgs);
+BENCHMARK_TEMPLATE(ConvertLargeSparseToMatrix, SparseCSCMatrix, DoubleType)
+    ->Apply(SetLargeMatrixArgs);
+
 }  // namespace arrow
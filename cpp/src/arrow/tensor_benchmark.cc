@@ -26,7 +26,7 @@
 namespace arrow {
 
 template <typename ValueType>
-static void BatchToTensorSimple(benchmark::State& state) {
+static void BatchToTensor(benchmark::State& state, bool row_major) {
   using CType = typename ValueType::c_type;
   std::shared_ptr<DataType> ty = TypeTraits<ValueType>::type_singleton();
 
@@ -45,12 +45,23 @@ static void BatchToTensorSimple(benchmark::State& state) {
   auto batch = RecordBatch::Make(schema, num_rows, columns);
 
   for (auto _ : state) {
-    ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor());
+    ASSERT_OK_AND_ASSIGN(auto tensor,
+                         batch->ToTensor(/*null_to_nan=*/false, row_major));
   }
   state.SetItemsProcessed(state.iterations() * num_rows * num_cols);
   state.SetBytesProcessed(state.iterations() * ty->byte_width() * num_rows * num_cols);
 }
 
+template <typename ValueType>
+static void BatchToTensorSimple(benchmark::State& state) {
+  BatchToTensor<ValueType>(state, /*row_major=*/true);
+}
+
+template <typename ValueType>
+static void BatchToTensorColumnMajor(benchmark::State& state) {
+  BatchToTensor<ValueType>(state, /*row_major=*/false);
+}
+
 void SetArgs(benchmark::internal::Benchmark* bench) {
   for (int64_t size : {kL1Size, kL2Size}) {
     for (int64_t num_columns : {3, 30, 300}) {
@@ -65,4 +76,18 @@ BENCHMARK_TEMPLATE(BatchToTensorSimple, Int16Type)->Apply(SetArgs);
 BENCHMARK_TEMPLATE(BatchToTensorSimple, Int32Type)->Apply(SetArgs);
 BENCHMARK_TEMPLATE(BatchToTensorSimple, Int64Type)->Apply(SetArgs);
 
+// Large batches are converted to column-major tensors in parallel
+void SetColumnMajorArgs(benchmark::internal::Benchmark* bench) {
+  for (int64_t size : {kL2Size, int64_t{64} << 20}) {
+    for (int64_t num_columns : {3, 30, 300}) {
+      bench->Args({size, num_columns});
+      bench->ArgNames({"size", "num_columns"});
+    }
+  }
+  bench->UseRealTime();
+}
+
+BENCHMARK_TEMPLATE(BatchToTensorColumnMajor, Int32Type)->Apply(SetColumnMajorArgs);
+BENCHMARK_TEMPLATE(BatchToTensorColumnMajor, DoubleType)->Apply(SetColumnMajorArgs);
+
 }  // namespace arrow
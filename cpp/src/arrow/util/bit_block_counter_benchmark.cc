@@ -26,6 +26,7 @@
 #include "arrow/testing/random.h"
 #include "arrow/util/bit_block_counter.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/bitmap_reader.h"
 
 namespace arrow {
@@ -120,6 +121,7 @@ struct BinaryBitBlockBenchmark {
   std::shared_ptr<Array> left;
   std::shared_ptr<Array> right;
   int64_t expected;
+  int64_t expected_count;
   const Int8Array* left_int8;
   const Int8Array* right_int8;
 
@@ -137,13 +139,50 @@ struct BinaryBitBlockBenchmark {
 
     // Compute the expected result
     expected = 0;
+    expected_count = 0;
     for (int64_t i = this->offset; i < bitmap_length; ++i) {
       if (left_int8->IsValid(i) && right_int8->IsValid(i)) {
         expected += left_int8->Value(i) + right_int8->Value(i);
+        ++expected_count;
       }
     }
   }
 
+  // Count the positions valid on both sides, as when sizing a selection
+  void BenchBitBlockCounterCount() {
+    for (auto _ : state) {
+      BinaryBitBlockCounter scanner(left->null_bitmap_data(), this->offset,
+                                    right->null_bitmap_data(), this->offset,
+                                    bitmap_length - this->offset);
+      int64_t count = 0;
+      while (true) {
+        BitBlockCount block = scanner.NextAndWord();
+        if (block.length == 0) {
+          break;
+        }
+        count += block.popcount;
+      }
+      // Sanity check
+      if (count != expected_count) {
+        std::abort();
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * bitmap_length);
+  }
+
+  void BenchCountAndSetBits() {
+    for (auto _ : state) {
+      int64_t count = CountAndSetBits(left->null_bitmap_data(), this->offset,
+                                      right->null_bitmap_data(), this->offset,
+                                      bitmap_length - this->offset);
+      // Sanity check
+      if (count != expected_count) {
+        std::abort();
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * bitmap_length);
+  }
+
   void BenchBitBlockCounter() {
     const uint8_t* left_bitmap = left->null_bitmap_data();
     const uint8_t* right_bitmap = right->null_bitmap_data();
@@ -250,6 +289,22 @@ static void BinaryBitmapReaderSumWithOffset(benchmark::State& state) {
   BinaryBitBlockBenchmark(state, /*offset=*/4).BenchBitmapReader();
 }
 
+static void BinaryBitBlockCounterCount(benchmark::State& state) {
+  BinaryBitBlockBenchmark(state, /*offset=*/0).BenchBitBlockCounterCount();
+}
+
+static void BinaryBitBlockCounterCountWithOffset(benchmark::State& state) {
+  BinaryBitBlockBenchmark(state, /*offset=*/4).BenchBitBlockCounterCount();
+}
+
+static void CountAndSetBitsCount(benchmark::State& state) {
+  BinaryBitBlockBenchmark(state, /*offset=*/0).BenchCountAndSetBits();
+}
+
+static void CountAndSetBitsCountWithOffset(benchmark::State& state) {
+  BinaryBitBlockBenchmark(state, /*offset=*/4).BenchCountAndSetBits();
+}
+
 // Range value: average number of total values per null
 BENCHMARK(BitBlockCounterSum)->Range(2, 1 << 16);
 BENCHMARK(BitBlockCounterSumWithOffset)->Range(2, 1 << 16);
@@ -261,6 +316,10 @@ BENCHMARK(BinaryBitBlockCounterSum)->Range(2, 1 << 16);
 BENCHMARK(BinaryBitBlockCounterSumWithOffset)->Range(2, 1 << 16);
 BENCHMARK(BinaryBitmapReaderSum)->Range(2, 1 << 16);
 BENCHMARK(BinaryBitmapReaderSumWithOffset)->Range(2, 1 << 16);
+BENCHMARK(BinaryBitBlockCounterCount)->Range(2, 1 << 16);
+BENCHMARK(BinaryBitBlockCounterCountWithOffset)->Range(2, 1 << 16);
+BENCHMARK(CountAndSetBitsCount)->Range(2, 1 << 16);
+BENCHMARK(CountAndSetBitsCountWithOffset)->Range(2, 1 << 16);
 
 }  // namespace internal
 }  // namespace arrow
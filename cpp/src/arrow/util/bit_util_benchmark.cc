@@ -439,17 +439,44 @@ static void SetBitsTo(benchmark::State& state) {
   state.SetBytesProcessed(state.iterations() * nbytes);
 }
 
-static void CountSetBits(benchmark::State& state) {
+template <int64_t Offset>
+static void CountSetBitsImpl(benchmark::State& state) {
   int64_t nbytes = state.range(0);
   std::shared_ptr<Buffer> buffer = CreateRandomBuffer(nbytes);
 
   for (auto _ : state) {
-    auto count = internal::CountSetBits(buffer->data(), /*bit_offset=*/0, nbytes * 8);
+    auto count = internal::CountSetBits(buffer->data(), Offset, nbytes * 8 - Offset);
     benchmark::DoNotOptimize(count);
   }
   state.SetBytesProcessed(state.iterations() * nbytes);
 }
 
+static void CountSetBits(benchmark::State& state) { CountSetBitsImpl<0>(state); }
+
+static void CountSetBitsWithOffset(benchmark::State& state) { CountSetBitsImpl<3>(state); }
+
+template <int64_t Offset = 0>
+static void CountAndSetBits(benchmark::State& state) {
+  int64_t nbytes = state.range(0);
+  std::shared_ptr<Buffer> left = CreateRandomBuffer(nbytes);
+  std::shared_ptr<Buffer> right = CreateRandomBuffer(nbytes);
+
+  for (auto _ : state) {
+    auto count = internal::CountAndSetBits(left->data(), Offset, right->data(),
+                                           /*right_offset=*/0, nbytes * 8 - Offset);
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetBytesProcessed(state.iterations() * nbytes);
+}
+
+static void CountAndSetBitsWithoutOffset(benchmark::State& state) {
+  CountAndSetBits<0>(state);
+}
+
+static void CountAndSetBitsWithOffset(benchmark::State& state) {
+  CountAndSetBits<3>(state);
+}
+
 template <int64_t OffsetSrc, int64_t OffsetDest = 0>
 static void CopyBitmap(benchmark::State& state) {  // NOLINT non-const reference
   const int64_t buffer_size = state.range(0);
@@ -481,6 +508,25 @@ static void CopyBitmapWithOffset(benchmark::State& state) {  // NOLINT non-const
 // Trigger the slow path where both source and dest buffer are not byte aligned.
 static void CopyBitmapWithOffsetBoth(benchmark::State& state) { CopyBitmap<3, 7>(state); }
 
+template <int64_t OffsetSrc>
+static void InvertBitmap(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t buffer_size = state.range(0);
+  std::shared_ptr<Buffer> buffer = CreateRandomBuffer(buffer_size);
+  const int64_t length = buffer_size * 8 - OffsetSrc;
+  auto inverted = *AllocateEmptyBitmap(length);
+
+  for (auto _ : state) {
+    internal::InvertBitmap(buffer->data(), OffsetSrc, length,
+                           inverted->mutable_data(), /*dest_offset=*/0);
+  }
+
+  state.SetBytesProcessed(state.iterations() * buffer_size);
+}
+
+static void InvertBitmapWithoutOffset(benchmark::State& state) { InvertBitmap<0>(state); }
+
+static void InvertBitmapWithOffset(benchmark::State& state) { InvertBitmap<4>(state); }
+
 // Benchmark the worst case of comparing two identical bitmap
 template <int64_t Offset = 0>
 static void BitmapEquals(benchmark::State& state) {
@@ -531,6 +577,9 @@ BENCHMARK(VisitBits)->Arg(kBufferSize);
 BENCHMARK(VisitBitsUnrolled)->Arg(kBufferSize);
 BENCHMARK(SetBitsTo)->Arg(2)->Arg(1 << 4)->Arg(1 << 10)->Arg(1 << 17);
 BENCHMARK(CountSetBits)->Arg(1 << 4)->Arg(1 << 10)->Arg(1 << 17);
+BENCHMARK(CountSetBitsWithOffset)->Arg(1 << 4)->Arg(1 << 10)->Arg(1 << 17);
+BENCHMARK(CountAndSetBitsWithoutOffset)->Arg(1 << 4)->Arg(1 << 10)->Arg(1 << 17);
+BENCHMARK(CountAndSetBitsWithOffset)->Arg(1 << 4)->Arg(1 << 10)->Arg(1 << 17);
 
 #ifdef ARROW_WITH_BENCHMARKS_REFERENCE
 static void ReferenceNaiveBitmapWriter(benchmark::State& state) {
@@ -549,6 +598,8 @@ BENCHMARK(GenerateBitsUnrolled)->Arg(kBufferSize);
 BENCHMARK(CopyBitmapWithoutOffset)->Arg(kBufferSize);
 BENCHMARK(CopyBitmapWithOffset)->Arg(kBufferSize);
 BENCHMARK(CopyBitmapWithOffsetBoth)->Arg(kBufferSize);
+BENCHMARK(InvertBitmapWithoutOffset)->Arg(kBufferSize);
+BENCHMARK(InvertBitmapWithOffset)->Arg(kBufferSize);
 
 BENCHMARK(BitmapEqualsWithoutOffset)->Arg(kBufferSize);
 BENCHMARK(BitmapEqualsWithOffset)->Arg(kBufferSize);
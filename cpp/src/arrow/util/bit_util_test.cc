@@ -117,10 +117,26 @@ struct GenerateBitsUnrolledFunctor {
   }
 };
 
+struct GenerateBitsFromBytesFunctor {
+  template <class Generator>
+  void operator()(uint8_t* bitmap, int64_t start_offset, int64_t length, Generator&& g) {
+    // Use assorted non-zero bytes for set bits
+    std::vector<uint8_t> bytes(length);
+    int64_t false_count = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      bytes[i] = g() ? static_cast<uint8_t>(0x80 >> (i % 8)) : 0;
+      false_count += bytes[i] == 0;
+    }
+    ASSERT_EQ(false_count, internal::GenerateBitsFromBytes(bitmap, start_offset, length,
+                                                           bytes.data()));
+  }
+};
+
 template <typename T>
 class TestGenerateBits : public ::testing::Test {};
 
-typedef ::testing::Types<GenerateBitsFunctor, GenerateBitsUnrolledFunctor>
+typedef ::testing::Types<GenerateBitsFunctor, GenerateBitsUnrolledFunctor,
+                         GenerateBitsFromBytesFunctor>
     GenerateBitsTypes;
 TYPED_TEST_SUITE(TestGenerateBits, GenerateBitsTypes);
 
@@ -327,6 +343,30 @@ TEST(BitUtilTests, TestCountSetBits) {
   }
 }
 
+TEST(BitUtilTests, TestCountAndSetBits) {
+  const int kBufferSize = 1000;
+  alignas(8) uint8_t left[kBufferSize] = {0};
+  alignas(8) uint8_t right[kBufferSize] = {0};
+  const int buffer_bits = kBufferSize * 8;
+
+  random_bytes(kBufferSize, 0, left);
+  random_bytes(kBufferSize, 1, right);
+
+  for (const int64_t left_offset : {0, 5, 8, 67}) {
+    for (const int64_t right_offset : {0, 3, 64}) {
+      for (const int64_t length : {0, 100, buffer_bits - 130}) {
+        int64_t expected = 0;
+        for (int64_t i = 0; i < length; ++i) {
+          expected += bit_util::GetBit(left, left_offset + i) &&
+                      bit_util::GetBit(right, right_offset + i);
+        }
+        ASSERT_EQ(expected, internal::CountAndSetBits(left, left_offset, right,
+                                                      right_offset, length));
+      }
+    }
+  }
+}
+
 TEST(BitUtilTests, TestSetBitsTo) {
   using bit_util::SetBitsTo;
   for (const auto fill_byte_int : {0x00, 0xff}) {
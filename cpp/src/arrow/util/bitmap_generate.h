@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 
@@ -24,6 +25,8 @@
 #include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/endian.h"
+#include "arrow/util/ubsan.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -108,5 +111,47 @@ void GenerateBitsUnrolled(uint8_t* bitmap, int64_t start_offset, int64_t length,
   }
 }
 
+// Write one bit per input byte into a bitmap area, a bit being set iff its byte
+// is non-zero, and return the number of zero bytes.  Same bitmap area semantics
+// as GenerateBits().
+//
+// Once the output is byte-aligned, eight bytes are packed at a time with
+// word-level bit tricks instead of one branch per byte.
+inline int64_t GenerateBitsFromBytes(uint8_t* bitmap, int64_t start_offset,
+                                     int64_t length, const uint8_t* bytes) {
+  int64_t false_count = 0;
+  const int64_t prefix = std::min<int64_t>(length, (8 - start_offset % 8) % 8);
+  int64_t i = 0;
+  GenerateBitsUnrolled(bitmap, start_offset, prefix, [&] {
+    const bool value = bytes[i++] != 0;
+    false_count += !value;
+    return value;
+  });
+
+  constexpr uint64_t kLowSevenBits = 0x7F7F7F7F7F7F7F7FULL;
+  constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+  // Gathers bit 8*k into bit 56+k
+  constexpr uint64_t kGatherBits = 0x0102040810204080ULL;
+  uint8_t* out = bitmap + (start_offset + prefix) / 8;
+  for (; i + 8 <= length; i += 8) {
+    const uint64_t word =
+        bit_util::FromLittleEndian(util::SafeLoadAs<uint64_t>(bytes + i));
+    // Set the high bit of each non-zero byte
+    const uint64_t nonzero =
+        (((word & kLowSevenBits) + kLowSevenBits) | word) & kHighBits;
+    const auto packed = static_cast<uint8_t>(((nonzero >> 7) * kGatherBits) >> 56);
+    *out++ = packed;
+    false_count += 8 - bit_util::PopCount(static_cast<uint32_t>(packed));
+  }
+
+  const int64_t suffix = length - i;
+  GenerateBitsUnrolled(bitmap, start_offset + i, suffix, [&] {
+    const bool value = bytes[i++] != 0;
+    false_count += !value;
+    return value;
+  });
+  return false_count;
+}
+
 }  // namespace internal
 }  // namespace arrow
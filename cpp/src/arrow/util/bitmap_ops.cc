@@ -28,13 +28,133 @@
 #include "arrow/util/align_util.h"
 #include "arrow/util/bit_block_counter.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops_internal.h"
 #include "arrow/util/bitmap_reader.h"
 #include "arrow/util/bitmap_writer.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/logging_internal.h"
 
 namespace arrow {
 namespace internal {
 
+namespace {
+
+// Below this many words, the SIMD kernels do not pay for their dispatch
+constexpr int64_t kMinSimdWords = 8;
+
+int64_t CountSetBitsWords(const uint64_t* u64_data, int64_t num_words) {
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  static const bool use_avx512 =
+      CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX512 | CpuInfo::AVX512VPOPCNTDQ);
+  if (use_avx512 && num_words >= kMinSimdWords) {
+    return CountSetBitsAvx512(u64_data, num_words);
+  }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  static const bool use_avx2 = CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX2);
+  if (use_avx2 && num_words >= kMinSimdWords) {
+    return CountSetBitsAvx2(u64_data, num_words);
+  }
+#endif
+  const uint64_t* end = u64_data + num_words;
+
+  constexpr int64_t kCountUnrollFactor = 4;
+  const int64_t words_rounded = bit_util::RoundDown(num_words, kCountUnrollFactor);
+  std::array<int64_t, kCountUnrollFactor> count_unroll{};
+
+  // Unroll the loop for better performance
+  for (int64_t i = 0; i < words_rounded; i += kCountUnrollFactor) {
+    // (hand-unrolled as some gcc versions would unnest a nested `for` loop)
+    count_unroll[0] += bit_util::PopCount(u64_data[0]);
+    count_unroll[1] += bit_util::PopCount(u64_data[1]);
+    count_unroll[2] += bit_util::PopCount(u64_data[2]);
+    count_unroll[3] += bit_util::PopCount(u64_data[3]);
+    u64_data += kCountUnrollFactor;
+  }
+  int64_t count = 0;
+  for (int64_t k = 0; k < kCountUnrollFactor; k++) {
+    count += count_unroll[k];
+  }
+
+  // The trailing part
+  for (; u64_data < end; ++u64_data) {
+    count += bit_util::PopCount(*u64_data);
+  }
+  return count;
+}
+
+// Apply `kind` to the leading whole bytes of the output with the widest
+// available SIMD kernel.  `out` must be byte-aligned.  Returns the number of bits
+// processed, a multiple of 8 that leaves at least one word to the caller.
+int64_t SimdBitmapOp(BitmapOpKind kind, const uint8_t* left, int64_t left_offset,
+                     const uint8_t* right, int64_t right_offset, int64_t length,
+                     uint8_t* out) {
+  const int64_t num_bytes = length / 8;
+  if (num_bytes < kMinSimdWords * 8) {
+    return 0;
+  }
+  left += left_offset / 8;
+  const int left_shift = static_cast<int>(left_offset % 8);
+  if (right != nullptr) {
+    right += right_offset / 8;
+  }
+  const int right_shift = static_cast<int>(right_offset % 8);
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  static const bool use_avx512 = CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX512);
+  if (use_avx512) {
+    return 8 * BitmapOpAvx512(kind, left, left_shift, right, right_shift, out,
+                              num_bytes);
+  }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  static const bool use_avx2 = CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX2);
+  if (use_avx2) {
+    return 8 * BitmapOpAvx2(kind, left, left_shift, right, right_shift, out, num_bytes);
+  }
+#endif
+  ARROW_UNUSED(left_shift);
+  ARROW_UNUSED(right_shift);
+  ARROW_UNUSED(kind);
+  return 0;
+}
+
+// Count the bits set in both bitmaps over their leading whole bytes with the
+// widest available SIMD kernel.  Adds to `*count` and returns the number of bits
+// processed, like SimdBitmapOp.
+int64_t SimdCountAndSetBits(const uint8_t* left, int64_t left_offset,
+                            const uint8_t* right, int64_t right_offset, int64_t length,
+                            int64_t* count) {
+  const int64_t num_bytes = length / 8;
+  if (num_bytes < kMinSimdWords * 8) {
+    return 0;
+  }
+  left += left_offset / 8;
+  right += right_offset / 8;
+  const int left_shift = static_cast<int>(left_offset % 8);
+  const int right_shift = static_cast<int>(right_offset % 8);
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  static const bool use_avx512 =
+      CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX512 | CpuInfo::AVX512VPOPCNTDQ);
+  if (use_avx512) {
+    return 8 * CountAndSetBitsAvx512(left, left_shift, right, right_shift, num_bytes,
+                                     count);
+  }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  static const bool use_avx2 = CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX2);
+  if (use_avx2) {
+    return 8 * CountAndSetBitsAvx2(left, left_shift, right, right_shift, num_bytes,
+                                   count);
+  }
+#endif
+  ARROW_UNUSED(left_shift);
+  ARROW_UNUSED(right_shift);
+  ARROW_UNUSED(count);
+  return 0;
+}
+
+}  // namespace
+
 int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
   constexpr int64_t pop_len = sizeof(uint64_t) * 8;
   DCHECK_GE(bit_offset, 0);
@@ -51,30 +171,7 @@ int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
     // popcount as much as possible with the widest possible count
     const uint64_t* u64_data = reinterpret_cast<const uint64_t*>(p.aligned_start);
     DCHECK_EQ(reinterpret_cast<size_t>(u64_data) & 7, 0);
-    const uint64_t* end = u64_data + p.aligned_words;
-
-    constexpr int64_t kCountUnrollFactor = 4;
-    const int64_t words_rounded =
-        bit_util::RoundDown(p.aligned_words, kCountUnrollFactor);
-    std::array<int64_t, kCountUnrollFactor> count_unroll{};
-
-    // Unroll the loop for better performance
-    for (int64_t i = 0; i < words_rounded; i += kCountUnrollFactor) {
-      // (hand-unrolled as some gcc versions would unnest a nested `for` loop)
-      count_unroll[0] += bit_util::PopCount(u64_data[0]);
-      count_unroll[1] += bit_util::PopCount(u64_data[1]);
-      count_unroll[2] += bit_util::PopCount(u64_data[2]);
-      count_unroll[3] += bit_util::PopCount(u64_data[3]);
-      u64_data += kCountUnrollFactor;
-    }
-    for (int64_t k = 0; k < kCountUnrollFactor; k++) {
-      count += count_unroll[k];
-    }
-
-    // The trailing part
-    for (; u64_data < end; ++u64_data) {
-      count += bit_util::PopCount(*u64_data);
-    }
+    count += CountSetBitsWords(u64_data, p.aligned_words);
   }
 
   // Account for left over bits (in theory we could fall back to smaller
@@ -91,9 +188,14 @@ int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
 int64_t CountAndSetBits(const uint8_t* left_bitmap, int64_t left_offset,
                         const uint8_t* right_bitmap, int64_t right_offset,
                         int64_t length) {
+  int64_t count = 0;
+  const int64_t done = SimdCountAndSetBits(left_bitmap, left_offset, right_bitmap,
+                                           right_offset, length, &count);
+  left_offset += done;
+  right_offset += done;
+  length -= done;
   BinaryBitBlockCounter bit_counter(left_bitmap, left_offset, right_bitmap, right_offset,
                                     length);
-  int64_t count = 0;
   while (true) {
     BitBlockCount block = bit_counter.NextAndWord();
     if (block.length == 0) {
@@ -129,6 +231,19 @@ void TransferBitmap(const uint8_t* data, int64_t offset, int64_t length,
   int64_t bit_offset = offset % 8;
   int64_t dest_bit_offset = dest_offset % 8;
 
+  // An aligned copy is a memcpy, everything else with a byte-aligned destination
+  // goes through the SIMD kernels first
+  if (dest_bit_offset == 0 && (bit_offset != 0 || mode == TransferMode::Invert)) {
+    const int64_t done =
+        SimdBitmapOp(mode == TransferMode::Invert ? BitmapOpKind::kInvert
+                                                  : BitmapOpKind::kCopy,
+                     data, offset, /*right=*/nullptr, /*right_offset=*/0, length,
+                     dest + dest_offset / 8);
+    offset += done;
+    dest_offset += done;
+    length -= done;
+  }
+
   if (bit_offset || dest_bit_offset) {
     auto reader = internal::BitmapWordReader<uint64_t>(data, offset, length);
     auto writer = internal::BitmapWordWriter<uint64_t>(dest, dest_offset, length);
@@ -376,9 +491,17 @@ void UnalignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t*
 // XXX: The bits before left/right/out_offset, if unaligned, are untouched. But not for
 // the bits after length. Caller should ensure proper alignment for the tail bits if
 // necessary, or correct the tail bits by subsequent calls.
-template <template <typename> class BitOp>
+template <template <typename> class BitOp, BitmapOpKind kKind>
 void BitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
               int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* dest) {
+  if (out_offset % 8 == 0) {
+    const int64_t done = SimdBitmapOp(kKind, left, left_offset, right, right_offset,
+                                      length, dest + out_offset / 8);
+    left_offset += done;
+    right_offset += done;
+    out_offset += done;
+    length -= done;
+  }
   if (out_offset % 8 == left_offset % 8 && out_offset % 8 == right_offset % 8) {
     // Fast case: can use byte-wise BitOp after handling leading unaligned bits.
     int64_t leading_unaligned_bits = (8 - left_offset % 8) % 8;
@@ -399,15 +522,15 @@ void BitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
   }
 }
 
-template <template <typename> class BitOp>
+template <template <typename> class BitOp, BitmapOpKind kKind>
 Result<std::shared_ptr<Buffer>> BitmapOp(MemoryPool* pool, const uint8_t* left,
                                          int64_t left_offset, const uint8_t* right,
                                          int64_t right_offset, int64_t length,
                                          int64_t out_offset) {
   const int64_t phys_bits = length + out_offset;
   ARROW_ASSIGN_OR_RAISE(auto out_buffer, AllocateEmptyBitmap(phys_bits, pool));
-  BitmapOp<BitOp>(left, left_offset, right, right_offset, length, out_offset,
-                  out_buffer->mutable_data());
+  BitmapOp<BitOp, kKind>(left, left_offset, right, right_offset, length, out_offset,
+                         out_buffer->mutable_data());
   return out_buffer;
 }
 
@@ -417,39 +540,42 @@ Result<std::shared_ptr<Buffer>> BitmapAnd(MemoryPool* pool, const uint8_t* left,
                                           int64_t left_offset, const uint8_t* right,
                                           int64_t right_offset, int64_t length,
                                           int64_t out_offset) {
-  return BitmapOp<std::bit_and>(pool, left, left_offset, right, right_offset, length,
-                                out_offset);
+  return BitmapOp<std::bit_and, BitmapOpKind::kAnd>(pool, left, left_offset, right,
+                                                    right_offset, length, out_offset);
 }
 
 void BitmapAnd(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
-  BitmapOp<std::bit_and>(left, left_offset, right, right_offset, length, out_offset, out);
+  BitmapOp<std::bit_and, BitmapOpKind::kAnd>(left, left_offset, right, right_offset,
+                                             length, out_offset, out);
 }
 
 Result<std::shared_ptr<Buffer>> BitmapOr(MemoryPool* pool, const uint8_t* left,
                                          int64_t left_offset, const uint8_t* right,
                                          int64_t right_offset, int64_t length,
                                          int64_t out_offset) {
-  return BitmapOp<std::bit_or>(pool, left, left_offset, right, right_offset, length,
-                               out_offset);
+  return BitmapOp<std::bit_or, BitmapOpKind::kOr>(pool, left, left_offset, right,
+                                                  right_offset, length, out_offset);
 }
 
 void BitmapOr(const uint8_t* left, int64_t left_offset, const uint8_t* right,
               int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
-  BitmapOp<std::bit_or>(left, left_offset, right, right_offset, length, out_offset, out);
+  BitmapOp<std::bit_or, BitmapOpKind::kOr>(left, left_offset, right, right_offset,
+                                           length, out_offset, out);
 }
 
 Result<std::shared_ptr<Buffer>> BitmapXor(MemoryPool* pool, const uint8_t* left,
                                           int64_t left_offset, const uint8_t* right,
                                           int64_t right_offset, int64_t length,
                                           int64_t out_offset) {
-  return BitmapOp<std::bit_xor>(pool, left, left_offset, right, right_offset, length,
-                                out_offset);
+  return BitmapOp<std::bit_xor, BitmapOpKind::kXor>(pool, left, left_offset, right,
+                                                    right_offset, length, out_offset);
 }
 
 void BitmapXor(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
-  BitmapOp<std::bit_xor>(left, left_offset, right, right_offset, length, out_offset, out);
+  BitmapOp<std::bit_xor, BitmapOpKind::kXor>(left, left_offset, right, right_offset,
+                                             length, out_offset, out);
 }
 
 template <typename T>
@@ -461,14 +587,15 @@ Result<std::shared_ptr<Buffer>> BitmapAndNot(MemoryPool* pool, const uint8_t* le
                                              int64_t left_offset, const uint8_t* right,
                                              int64_t right_offset, int64_t length,
                                              int64_t out_offset) {
-  return BitmapOp<AndNotOp>(pool, left, left_offset, right, right_offset, length,
-                            out_offset);
+  return BitmapOp<AndNotOp, BitmapOpKind::kAndNot>(pool, left, left_offset, right,
+                                                   right_offset, length, out_offset);
 }
 
 void BitmapAndNot(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                   int64_t right_offset, int64_t length, int64_t out_offset,
                   uint8_t* out) {
-  BitmapOp<AndNotOp>(left, left_offset, right, right_offset, length, out_offset, out);
+  BitmapOp<AndNotOp, BitmapOpKind::kAndNot>(left, left_offset, right, right_offset,
+                                            length, out_offset, out);
 }
 
 template <typename T>
@@ -480,13 +607,14 @@ Result<std::shared_ptr<Buffer>> BitmapOrNot(MemoryPool* pool, const uint8_t* lef
                                             int64_t left_offset, const uint8_t* right,
                                             int64_t right_offset, int64_t length,
                                             int64_t out_offset) {
-  return BitmapOp<OrNotOp>(pool, left, left_offset, right, right_offset, length,
-                           out_offset);
+  return BitmapOp<OrNotOp, BitmapOpKind::kOrNot>(pool, left, left_offset, right,
+                                                 right_offset, length, out_offset);
 }
 
 void BitmapOrNot(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                  int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
-  BitmapOp<OrNotOp>(left, left_offset, right, right_offset, length, out_offset, out);
+  BitmapOp<OrNotOp, BitmapOpKind::kOrNot>(left, left_offset, right, right_offset,
+                                          length, out_offset, out);
 }
 
 }  // namespace internal
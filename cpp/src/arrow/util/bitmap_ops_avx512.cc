@@ -0,0 +1,135 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/bitmap_ops_internal.h"
+#include "arrow/util/simd.h"
+
+namespace arrow::internal {
+
+// Same blocks as bitmap_ops_avx2.cc, twice as wide.
+
+namespace {
+
+template <BitmapOpKind kKind>
+inline __m512i Apply(__m512i left, __m512i right) {
+  const __m512i ones = _mm512_set1_epi64(-1);
+  if constexpr (kKind == BitmapOpKind::kAnd) {
+    return _mm512_and_si512(left, right);
+  } else if constexpr (kKind == BitmapOpKind::kOr) {
+    return _mm512_or_si512(left, right);
+  } else if constexpr (kKind == BitmapOpKind::kXor) {
+    return _mm512_xor_si512(left, right);
+  } else if constexpr (kKind == BitmapOpKind::kAndNot) {
+    return _mm512_andnot_si512(right, left);
+  } else if constexpr (kKind == BitmapOpKind::kOrNot) {
+    return _mm512_or_si512(left, _mm512_xor_si512(right, ones));
+  } else if constexpr (kKind == BitmapOpKind::kCopy) {
+    return left;
+  } else {
+    return _mm512_xor_si512(left, ones);
+  }
+}
+
+inline __m512i LoadShifted(const uint8_t* data, __m128i shift, __m128i complement) {
+  const __m512i lo = _mm512_loadu_si512(data);
+  const __m512i hi = _mm512_loadu_si512(data + 8);
+  return _mm512_or_si512(_mm512_srl_epi64(lo, shift), _mm512_sll_epi64(hi, complement));
+}
+
+template <BitmapOpKind kKind>
+int64_t BitmapOpImpl(const uint8_t* left, int left_shift, const uint8_t* right,
+                     int right_shift, uint8_t* out, int64_t num_bytes) {
+  constexpr bool kUnary = kKind == BitmapOpKind::kCopy || kKind == BitmapOpKind::kInvert;
+  const __m128i left_lo = _mm_cvtsi32_si128(left_shift);
+  const __m128i left_hi = _mm_cvtsi32_si128(64 - left_shift);
+  const __m128i right_lo = _mm_cvtsi32_si128(right_shift);
+  const __m128i right_hi = _mm_cvtsi32_si128(64 - right_shift);
+  int64_t i = 0;
+  for (; i + 64 + 8 <= num_bytes; i += 64) {
+    const __m512i l = LoadShifted(left + i, left_lo, left_hi);
+    __m512i r = l;
+    if constexpr (!kUnary) {
+      r = LoadShifted(right + i, right_lo, right_hi);
+    }
+    _mm512_storeu_si512(out + i, Apply<kKind>(l, r));
+  }
+  return i;
+}
+
+}  // namespace
+
+int64_t CountSetBitsAvx512(const uint64_t* words, int64_t num_words) {
+  __m512i total = _mm512_setzero_si512();
+  int64_t i = 0;
+  for (; i + 8 <= num_words; i += 8) {
+    total = _mm512_add_epi64(total, _mm512_popcnt_epi64(_mm512_loadu_si512(words + i)));
+  }
+  if (i < num_words) {
+    const __mmask8 tail = static_cast<__mmask8>((1U << (num_words - i)) - 1);
+    total = _mm512_add_epi64(
+        total, _mm512_popcnt_epi64(_mm512_maskz_loadu_epi64(tail, words + i)));
+  }
+  return _mm512_reduce_add_epi64(total);
+}
+
+int64_t CountAndSetBitsAvx512(const uint8_t* left, int left_shift, const uint8_t* right,
+                              int right_shift, int64_t num_bytes, int64_t* count) {
+  const __m128i left_lo = _mm_cvtsi32_si128(left_shift);
+  const __m128i left_hi = _mm_cvtsi32_si128(64 - left_shift);
+  const __m128i right_lo = _mm_cvtsi32_si128(right_shift);
+  const __m128i right_hi = _mm_cvtsi32_si128(64 - right_shift);
+  __m512i total = _mm512_setzero_si512();
+  int64_t i = 0;
+  for (; i + 64 + 8 <= num_bytes; i += 64) {
+    const __m512i both = _mm512_and_si512(LoadShifted(left + i, left_lo, left_hi),
+                                          LoadShifted(right + i, right_lo, right_hi));
+    total = _mm512_add_epi64(total, _mm512_popcnt_epi64(both));
+  }
+  *count += _mm512_reduce_add_epi64(total);
+  return i;
+}
+
+int64_t BitmapOpAvx512(BitmapOpKind kind, const uint8_t* left, int left_shift,
+                       const uint8_t* right, int right_shift, uint8_t* out,
+                       int64_t num_bytes) {
+  switch (kind) {
+    case BitmapOpKind::kAnd:
+      return BitmapOpImpl<BitmapOpKind::kAnd>(left, left_shift, right, right_shift, out,
+                                              num_bytes);
+    case BitmapOpKind::kOr:
+      return BitmapOpImpl<BitmapOpKind::kOr>(left, left_shift, right, right_shift, out,
+                                             num_bytes);
+    case BitmapOpKind::kXor:
+      return BitmapOpImpl<BitmapOpKind::kXor>(left, left_shift, right, right_shift, out,
+                                              num_bytes);
+    case BitmapOpKind::kAndNot:
+      return BitmapOpImpl<BitmapOpKind::kAndNot>(left, left_shift, right, right_shift,
+                                                 out, num_bytes);
+    case BitmapOpKind::kOrNot:
+      return BitmapOpImpl<BitmapOpKind::kOrNot>(left, left_shift, right, right_shift,
+                                                out, num_bytes);
+    case BitmapOpKind::kCopy:
+      return BitmapOpImpl<BitmapOpKind::kCopy>(left, left_shift, right, right_shift, out,
+                                               num_bytes);
+    case BitmapOpKind::kInvert:
+      return BitmapOpImpl<BitmapOpKind::kInvert>(left, left_shift, right, right_shift,
+                                                 out, num_bytes);
+  }
+  return 0;
+}
+
+}  // namespace arrow::internal
@@ -0,0 +1,67 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace arrow::internal {
+
+// SIMD kernels dispatched to by the functions of bitmap_ops.h.
+
+enum class BitmapOpKind : int8_t { kAnd, kOr, kXor, kAndNot, kOrNot, kCopy, kInvert };
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+/// \brief Count the set bits of `num_words` words
+int64_t CountSetBitsAvx2(const uint64_t* words, int64_t num_words);
+
+/// \brief Count the bits set in both bitmaps, over whole bytes
+///
+/// Same input layout and partial processing as BitmapOpAvx2: adds the count of
+/// the processed bytes to `*count` and returns their number.
+int64_t CountAndSetBitsAvx2(const uint8_t* left, int left_shift, const uint8_t* right,
+                            int right_shift, int64_t num_bytes, int64_t* count);
+
+/// \brief Apply a bitwise operation to whole bytes of a bitmap
+///
+/// Output byte i is computed from the bits starting at bit `left_shift` (resp.
+/// `right_shift`, both below 8) of input byte i.  `right` is not read by the
+/// unary kinds (kCopy, kInvert).  Only `num_bytes` bytes of the inputs are read;
+/// the kernel stops before the last, incomplete block and returns the number of
+/// bytes written, which the caller finishes with scalar code.
+int64_t BitmapOpAvx2(BitmapOpKind kind, const uint8_t* left, int left_shift,
+                     const uint8_t* right, int right_shift, uint8_t* out,
+                     int64_t num_bytes);
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+/// \brief Count the set bits of `num_words` words with VPOPCNTQ
+///
+/// Requires AVX512-VPOPCNTDQ in addition to the AVX-512 baseline.
+int64_t CountSetBitsAvx512(const uint64_t* words, int64_t num_words);
+
+/// \brief Same as CountAndSetBitsAvx2, with VPOPCNTQ
+int64_t CountAndSetBitsAvx512(const uint8_t* left, int left_shift, const uint8_t* right,
+                              int right_shift, int64_t num_bytes, int64_t* count);
+
+/// \brief Same as BitmapOpAvx2, with 512-bit blocks
+int64_t BitmapOpAvx512(BitmapOpKind kind, const uint8_t* left, int left_shift,
+                       const uint8_t* right, int right_shift, uint8_t* out,
+                       int64_t num_bytes);
+#endif
+
+}  // namespace arrow::internal
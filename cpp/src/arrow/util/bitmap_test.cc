@@ -15,6 +15,10 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <functional>
+#include <utility>
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -1236,6 +1240,44 @@ TEST(BitmapOpTest, PartialLeadingByteSafety) {
   }
 }
 
+TEST(BitmapOpTest, LongBitmaps) {
+  // Long enough for the SIMD kernels, with every mix of bit offsets
+  const int64_t num_bytes = 1000;
+  std::vector<uint8_t> left(num_bytes), right(num_bytes);
+  random_bytes(num_bytes, 0, left.data());
+  random_bytes(num_bytes, 1, right.data());
+
+  using BitOpFunc = void (*)(const uint8_t*, int64_t, const uint8_t*, int64_t, int64_t,
+                             int64_t, uint8_t*);
+  const std::vector<std::pair<BitOpFunc, std::function<bool(bool, bool)>>> ops = {
+      {BitmapAnd, [](bool l, bool r) { return l && r; }},
+      {BitmapOr, [](bool l, bool r) { return l || r; }},
+      {BitmapXor, [](bool l, bool r) { return l != r; }},
+      {BitmapAndNot, [](bool l, bool r) { return l && !r; }},
+      {BitmapOrNot, [](bool l, bool r) { return l || !r; }},
+  };
+  for (const auto& [op, expected_op] : ops) {
+    for (int64_t left_offset : {0, 3, 8, 67}) {
+      for (int64_t right_offset : {0, 5, 64}) {
+        for (int64_t out_offset : {0, 7, 16}) {
+          const int64_t length = num_bytes * 8 - 80;
+          ARROW_SCOPED_TRACE("offsets = ", left_offset, ", ", right_offset, ", ",
+                             out_offset);
+          std::vector<uint8_t> out(num_bytes);
+          op(left.data(), left_offset, right.data(), right_offset, length, out_offset,
+             out.data());
+          for (int64_t i = 0; i < length; ++i) {
+            ASSERT_EQ(bit_util::GetBit(out.data(), out_offset + i),
+                      expected_op(bit_util::GetBit(left.data(), left_offset + i),
+                                  bit_util::GetBit(right.data(), right_offset + i)))
+                << "at bit " << i;
+          }
+        }
+      }
+    }
+  }
+}
+
 // Tests for Bitmap visiting.
 
 // test the basic assumption of word level Bitmap::Visit
@@ -0,0 +1,167 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/buffer_pool.h"
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging_internal.h"
+
+namespace arrow {
+
+namespace util {
+
+namespace {
+
+constexpr int kNumShards = 8;
+
+}  // namespace
+
+struct BufferPool::Shard {
+  std::mutex mutex;
+  // Free buffers by size class
+  std::vector<std::vector<std::unique_ptr<ResizableBuffer>>> free_buffers;
+};
+
+BufferPool::BufferPool(MemoryPool* pool, Options options)
+    : pool_(pool),
+      options_(options),
+      num_size_classes_(
+          bit_util::Log2(static_cast<uint64_t>(options.max_buffer_size)) -
+          bit_util::Log2(static_cast<uint64_t>(options.min_buffer_size)) + 1),
+      shards_(new Shard[kNumShards]) {
+  DCHECK_GT(options_.min_buffer_size, 0);
+  DCHECK_GE(options_.max_buffer_size, options_.min_buffer_size);
+  for (int i = 0; i < kNumShards; ++i) {
+    shards_[i].free_buffers.resize(num_size_classes_);
+  }
+}
+
+BufferPool::~BufferPool() { Clear(); }
+
+std::shared_ptr<BufferPool> BufferPool::Make(MemoryPool* pool, Options options) {
+  options.min_buffer_size =
+      bit_util::NextPower2(std::max<int64_t>(1, options.min_buffer_size));
+  options.max_buffer_size = std::max(options.max_buffer_size, options.min_buffer_size);
+  return std::shared_ptr<BufferPool>(new BufferPool(pool, options));
+}
+
+int BufferPool::CeilSizeClass(int64_t size) const {
+  if (size > options_.max_buffer_size) {
+    return -1;
+  }
+  const auto capacity = static_cast<uint64_t>(std::max(size, options_.min_buffer_size));
+  return bit_util::Log2(capacity) -
+         bit_util::Log2(static_cast<uint64_t>(options_.min_buffer_size));
+}
+
+int BufferPool::FloorSizeClass(int64_t capacity) const {
+  if (capacity < options_.min_buffer_size) {
+    return -1;
+  }
+  const int size_class =
+      bit_util::Log2(static_cast<uint64_t>(capacity) + 1) - 1 -
+      bit_util::Log2(static_cast<uint64_t>(options_.min_buffer_size));
+  return std::min(size_class, num_size_classes_ - 1);
+}
+
+BufferPool::Shard& BufferPool::CurrentShard() {
+  const auto hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
+  return shards_[hash % kNumShards];
+}
+
+Result<std::shared_ptr<ResizableBuffer>> BufferPool::Acquire(int64_t size) {
+  ++num_acquired_;
+  const int size_class = CeilSizeClass(size);
+  if (size_class < 0) {
+    return AllocateResizableBuffer(size, pool_);
+  }
+
+  std::unique_ptr<ResizableBuffer> buffer;
+  {
+    auto& shard = CurrentShard();
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto& free_buffers = shard.free_buffers[size_class];
+    if (!free_buffers.empty()) {
+      buffer = std::move(free_buffers.back());
+      free_buffers.pop_back();
+    }
+  }
+  if (buffer) {
+    bytes_retained_ -= buffer->capacity();
+    ++num_reused_;
+    RETURN_NOT_OK(buffer->Resize(size, /*shrink_to_fit=*/false));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(buffer, AllocateResizableBuffer(
+                                      options_.min_buffer_size << size_class, pool_));
+    RETURN_NOT_OK(buffer->Resize(size, /*shrink_to_fit=*/false));
+  }
+
+  std::weak_ptr<BufferPool> weak_self = weak_from_this();
+  return std::shared_ptr<ResizableBuffer>(
+      buffer.release(), [weak_self = std::move(weak_self)](ResizableBuffer* buffer) {
+        if (auto self = weak_self.lock()) {
+          self->Release(buffer);
+        } else {
+          delete buffer;
+        }
+      });
+}
+
+void BufferPool::Release(ResizableBuffer* raw_buffer) {
+  std::unique_ptr<ResizableBuffer> buffer(raw_buffer);
+  const int64_t capacity = buffer->capacity();
+  const int size_class = FloorSizeClass(capacity);
+  if (size_class < 0) {
+    return;
+  }
+  if (bytes_retained_.fetch_add(capacity) + capacity > options_.max_retained_bytes) {
+    bytes_retained_ -= capacity;
+    return;
+  }
+  auto& shard = CurrentShard();
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  shard.free_buffers[size_class].push_back(std::move(buffer));
+}
+
+void BufferPool::Clear() {
+  for (int i = 0; i < kNumShards; ++i) {
+    std::vector<std::vector<std::unique_ptr<ResizableBuffer>>> free_buffers(
+        num_size_classes_);
+    {
+      std::lock_guard<std::mutex> lock(shards_[i].mutex);
+      std::swap(free_buffers, shards_[i].free_buffers);
+    }
+    for (const auto& buffers : free_buffers) {
+      for (const auto& buffer : buffers) {
+        bytes_retained_ -= buffer->capacity();
+      }
+    }
+  }
+}
+
+}  // namespace util
+
+}  // namespace arrow
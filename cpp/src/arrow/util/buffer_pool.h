@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+namespace util {
+
+/// \brief Recycles ResizableBuffers of similar sizes
+///
+/// Readers that allocate and free similar-sized scratch or decode buffers for
+/// every page, block or batch can acquire them from a BufferPool instead of the
+/// memory pool.  A buffer acquired from the pool goes back to it when the last
+/// reference to it is dropped, and is handed out again by a later Acquire() of a
+/// size in the same size class.  Size classes are powers of two.
+///
+/// Free buffers are kept in a few shards selected by the calling thread, so that
+/// threads decoding concurrently rarely contend on the same lock.  At most
+/// `max_retained_bytes` bytes of free buffers are kept, further buffers being
+/// freed to the memory pool.
+///
+/// Buffers may outlive the BufferPool they come from: they are then freed to the
+/// memory pool, which must outlive them as usual.
+class ARROW_EXPORT BufferPool : public std::enable_shared_from_this<BufferPool> {
+ public:
+  struct Options {
+    /// Buffers are recycled by capacities of at least this size
+    int64_t min_buffer_size = 4096;
+    /// Larger buffers are not recycled
+    int64_t max_buffer_size = 64 << 20;
+    /// The maximum number of bytes of free buffers kept for reuse
+    int64_t max_retained_bytes = 64 << 20;
+
+    static Options Defaults() { return Options(); }
+  };
+
+  ~BufferPool();
+
+  static std::shared_ptr<BufferPool> Make(MemoryPool* pool,
+                                          Options options = Options::Defaults());
+
+  /// \brief Return a buffer of `size` bytes, reusing a free buffer if possible
+  ///
+  /// The contents of the buffer are undefined.  The buffer may be resized by the
+  /// caller: it is recycled according to its capacity when released.
+  Result<std::shared_ptr<ResizableBuffer>> Acquire(int64_t size);
+
+  /// \brief Free all the buffers kept for reuse
+  void Clear();
+
+  MemoryPool* memory_pool() const { return pool_; }
+
+  /// The number of bytes of free buffers kept for reuse
+  int64_t bytes_retained() const { return bytes_retained_.load(); }
+
+  /// The number of buffers returned by Acquire()
+  int64_t num_acquired() const { return num_acquired_.load(); }
+
+  /// The number of buffers returned by Acquire() that were recycled
+  int64_t num_reused() const { return num_reused_.load(); }
+
+ private:
+  BufferPool(MemoryPool* pool, Options options);
+
+  // The index of the smallest size class holding `size` bytes, or -1 if too large
+  int CeilSizeClass(int64_t size) const;
+  // The index of the largest size class `capacity` bytes can serve, or -1
+  int FloorSizeClass(int64_t capacity) const;
+
+  void Release(ResizableBuffer* buffer);
+
+  struct Shard;
+  Shard& CurrentShard();
+
+  MemoryPool* pool_;
+  const Options options_;
+  const int num_size_classes_;
+  std::unique_ptr<Shard[]> shards_;
+  std::atomic<int64_t> bytes_retained_{0};
+  std::atomic<int64_t> num_acquired_{0};
+  std::atomic<int64_t> num_reused_{0};
+};
+
+}  // namespace util
+
+}  // namespace arrow
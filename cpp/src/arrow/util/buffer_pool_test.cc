@@ -0,0 +1,140 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/buffer_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace util {
+
+TEST(BufferPool, Reuse) {
+  auto pool = BufferPool::Make(default_memory_pool());
+
+  ASSERT_OK_AND_ASSIGN(auto buffer, pool->Acquire(5000));
+  ASSERT_EQ(buffer->size(), 5000);
+  ASSERT_GE(buffer->capacity(), 8192);
+  const uint8_t* data = buffer->data();
+  buffer.reset();
+  ASSERT_EQ(pool->bytes_retained(), 8192);
+
+  // Same size class: the buffer is recycled
+  ASSERT_OK_AND_ASSIGN(buffer, pool->Acquire(8000));
+  ASSERT_EQ(buffer->size(), 8000);
+  ASSERT_EQ(buffer->data(), data);
+  ASSERT_EQ(pool->bytes_retained(), 0);
+  ASSERT_EQ(pool->num_acquired(), 2);
+  ASSERT_EQ(pool->num_reused(), 1);
+
+  // Larger size class: a new buffer is allocated
+  ASSERT_OK_AND_ASSIGN(auto other, pool->Acquire(10000));
+  ASSERT_NE(other->data(), data);
+  ASSERT_EQ(pool->num_reused(), 1);
+  other.reset();
+  buffer.reset();
+  ASSERT_EQ(pool->bytes_retained(), 8192 + 16384);
+}
+
+TEST(BufferPool, ResizedBuffer) {
+  auto pool = BufferPool::Make(default_memory_pool());
+
+  ASSERT_OK_AND_ASSIGN(auto buffer, pool->Acquire(4096));
+  ASSERT_OK(buffer->Resize(20000));
+  const int64_t capacity = buffer->capacity();
+  buffer.reset();
+  // Recycled according to its new capacity
+  ASSERT_EQ(pool->bytes_retained(), capacity);
+  ASSERT_OK_AND_ASSIGN(buffer, pool->Acquire(16384));
+  ASSERT_EQ(pool->num_reused(), 1);
+}
+
+TEST(BufferPool, LargeBuffers) {
+  BufferPool::Options options;
+  options.max_buffer_size = 1 << 16;
+  auto pool = BufferPool::Make(default_memory_pool(), options);
+
+  ASSERT_OK_AND_ASSIGN(auto buffer, pool->Acquire((1 << 16) + 1));
+  buffer.reset();
+  ASSERT_EQ(pool->bytes_retained(), 0);
+  ASSERT_OK_AND_ASSIGN(buffer, pool->Acquire(1 << 16));
+  buffer.reset();
+  ASSERT_EQ(pool->bytes_retained(), 1 << 16);
+}
+
+TEST(BufferPool, MaxRetainedBytes) {
+  BufferPool::Options options;
+  options.max_retained_bytes = 3 * 4096;
+  auto pool = BufferPool::Make(default_memory_pool(), options);
+
+  std::vector<std::shared_ptr<ResizableBuffer>> buffers;
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto buffer, pool->Acquire(4096));
+    buffers.push_back(std::move(buffer));
+  }
+  buffers.clear();
+  ASSERT_EQ(pool->bytes_retained(), 3 * 4096);
+
+  pool->Clear();
+  ASSERT_EQ(pool->bytes_retained(), 0);
+  ASSERT_OK_AND_ASSIGN(auto buffer, pool->Acquire(4096));
+  ASSERT_EQ(pool->num_reused(), 0);
+}
+
+TEST(BufferPool, BufferOutlivesPool) {
+  auto memory_pool = default_memory_pool();
+  const int64_t bytes_allocated = memory_pool->bytes_allocated();
+
+  auto pool = BufferPool::Make(memory_pool);
+  ASSERT_OK_AND_ASSIGN(auto buffer, pool->Acquire(1000));
+  ASSERT_OK_AND_ASSIGN(auto other, pool->Acquire(1000));
+  other.reset();
+  pool.reset();
+  ASSERT_EQ(buffer->size(), 1000);
+  buffer.reset();
+  ASSERT_EQ(memory_pool->bytes_allocated(), bytes_allocated);
+}
+
+TEST(BufferPool, Threads) {
+  auto pool = BufferPool::Make(default_memory_pool());
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&]() {
+      for (int j = 0; j < 100; ++j) {
+        ASSERT_OK_AND_ASSIGN(auto buffer, pool->Acquire(4096 << (j % 4)));
+        buffer->mutable_data()[0] = static_cast<uint8_t>(j);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(pool->num_acquired(), 400);
+  ASSERT_GT(pool->num_reused(), 0);
+  ASSERT_LE(pool->bytes_retained(), 4 * (4096 + 8192 + 16384 + 32768));
+}
+
+}  // namespace util
+}  // namespace arrow
@@ -38,7 +38,10 @@ struct ByteStreamSplitDecodeDynamic {
     return std::array{
         Implementation{
             DispatchLevel::NONE,
-#if defined(ARROW_HAVE_NEON)
+#if defined(ARROW_HAVE_SVE256) || defined(ARROW_HAVE_SVE512)
+            // Fixed-size SVE vectors are wider than Neon's
+            &ByteStreamSplitDecodeSimd<xsimd::sve, kNumStreams>,
+#elif defined(ARROW_HAVE_NEON)
             // We always expect Neon to be available on Arm64
             &ByteStreamSplitDecodeSimd<xsimd::neon64, kNumStreams>,
 #elif defined(ARROW_HAVE_SSE4_2)
@@ -53,6 +56,9 @@ struct ByteStreamSplitDecodeDynamic {
             DispatchLevel::AVX2,
             &ByteStreamSplitDecodeSimd<xsimd::avx2, kNumStreams>,
         },
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+        Implementation{DispatchLevel::AVX512, &ByteStreamSplitDecodeAvx512<kNumStreams>},
 #endif
     };
   }
@@ -97,6 +103,9 @@ struct ByteStreamSplitEncodeDynamic {
         },
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
         Implementation{DispatchLevel::AVX2, &ByteStreamSplitEncodeAvx2<kNumStreams>},
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+        Implementation{DispatchLevel::AVX512, &ByteStreamSplitEncodeAvx512<kNumStreams>},
 #endif
     };
   }
@@ -24,6 +24,7 @@
 #include "arrow/util/ubsan.h"
 #include "arrow/util/visibility.h"
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstdint>
@@ -316,6 +317,30 @@ extern template ARROW_TEMPLATE_EXPORT void ByteStreamSplitEncodeAvx2<8>(const ui
 
 #  endif
 
+#  if defined(ARROW_HAVE_RUNTIME_AVX512)
+
+template <int kNumStreams>
+void ByteStreamSplitDecodeAvx512(const uint8_t*, int, int64_t, int64_t, uint8_t*);
+
+extern template ARROW_TEMPLATE_EXPORT void ByteStreamSplitDecodeAvx512<2>(
+    const uint8_t*, int, int64_t, int64_t, uint8_t*);
+extern template ARROW_TEMPLATE_EXPORT void ByteStreamSplitDecodeAvx512<4>(
+    const uint8_t*, int, int64_t, int64_t, uint8_t*);
+extern template ARROW_TEMPLATE_EXPORT void ByteStreamSplitDecodeAvx512<8>(
+    const uint8_t*, int, int64_t, int64_t, uint8_t*);
+
+template <int kNumStreams>
+void ByteStreamSplitEncodeAvx512(const uint8_t*, int, const int64_t, uint8_t*);
+
+extern template ARROW_TEMPLATE_EXPORT void ByteStreamSplitEncodeAvx512<2>(
+    const uint8_t*, int, const int64_t, uint8_t*);
+extern template ARROW_TEMPLATE_EXPORT void ByteStreamSplitEncodeAvx512<4>(
+    const uint8_t*, int, const int64_t, uint8_t*);
+extern template ARROW_TEMPLATE_EXPORT void ByteStreamSplitEncodeAvx512<8>(
+    const uint8_t*, int, const int64_t, uint8_t*);
+
+#  endif
+
 #endif
 
 //
@@ -477,6 +502,125 @@ extern template ARROW_TEMPLATE_EXPORT void ByteStreamSplitEncodeSimdDispatch<4>(
 extern template ARROW_TEMPLATE_EXPORT void ByteStreamSplitEncodeSimdDispatch<8>(
     const uint8_t*, int, const int64_t, uint8_t*);
 
+#if defined(ARROW_HAVE_SIMD_SPLIT)
+
+//
+// Implementations for other widths, such as FIXED_LEN_BYTE_ARRAY
+//
+// The streams are split in groups of 8, 4, 2 and 1 streams, each of them transposed
+// by the SIMD kernel of its width. Values are processed in blocks going through a
+// small scratch buffer, so that only the gathering or scattering of each group's
+// bytes within the values is done by scalar code.
+
+constexpr int64_t kByteStreamSplitGenericBlockSize = 512;
+
+// For narrower widths, gathering and scattering the groups costs more than the SIMD
+// transpositions save over the scalar implementations.
+constexpr int kByteStreamSplitGenericMinEncodeWidth = 9;
+constexpr int kByteStreamSplitGenericMinDecodeWidth = 5;
+
+inline int ByteStreamSplitGroupWidth(int num_streams) {
+  return num_streams >= 8 ? 8 : num_streams >= 4 ? 4 : num_streams >= 2 ? 2 : 1;
+}
+
+template <int kGroupWidth>
+void ByteStreamSplitEncodeGroup(const uint8_t* raw_values, int width, int first_stream,
+                                int64_t num_values, int64_t block_offset,
+                                int64_t block_size, uint8_t* scratch, uint8_t* out) {
+  uint8_t* group_values = scratch;
+  uint8_t* group_streams = scratch + kByteStreamSplitGenericBlockSize * kGroupWidth;
+  for (int64_t i = 0; i < block_size; ++i) {
+    std::memcpy(group_values + i * kGroupWidth,
+                raw_values + (block_offset + i) * width + first_stream, kGroupWidth);
+  }
+  ByteStreamSplitEncodeSimdDispatch<kGroupWidth>(group_values, kGroupWidth, block_size,
+                                                 group_streams);
+  for (int stream = 0; stream < kGroupWidth; ++stream) {
+    std::memcpy(out + (first_stream + stream) * num_values + block_offset,
+                group_streams + stream * block_size, block_size);
+  }
+}
+
+template <int kGroupWidth>
+void ByteStreamSplitDecodeGroup(const uint8_t* data, int width, int first_stream,
+                                int64_t stride, int64_t block_offset,
+                                int64_t block_size, uint8_t* scratch, uint8_t* out) {
+  ByteStreamSplitDecodeSimdDispatch<kGroupWidth>(
+      data + first_stream * stride + block_offset, kGroupWidth, block_size, stride,
+      scratch);
+  for (int64_t i = 0; i < block_size; ++i) {
+    std::memcpy(out + (block_offset + i) * width + first_stream,
+                scratch + i * kGroupWidth, kGroupWidth);
+  }
+}
+
+inline void ByteStreamSplitEncodeGeneric(const uint8_t* raw_values, int width,
+                                         const int64_t num_values, uint8_t* out) {
+  uint8_t scratch[2 * kByteStreamSplitGenericBlockSize * 8];
+  for (int64_t offset = 0; offset < num_values;
+       offset += kByteStreamSplitGenericBlockSize) {
+    const int64_t block_size =
+        std::min(kByteStreamSplitGenericBlockSize, num_values - offset);
+    for (int stream = 0; stream < width;) {
+      const int group_width = ByteStreamSplitGroupWidth(width - stream);
+      switch (group_width) {
+        case 8:
+          ByteStreamSplitEncodeGroup<8>(raw_values, width, stream, num_values, offset,
+                                        block_size, scratch, out);
+          break;
+        case 4:
+          ByteStreamSplitEncodeGroup<4>(raw_values, width, stream, num_values, offset,
+                                        block_size, scratch, out);
+          break;
+        case 2:
+          ByteStreamSplitEncodeGroup<2>(raw_values, width, stream, num_values, offset,
+                                        block_size, scratch, out);
+          break;
+        default:
+          for (int64_t i = offset; i < offset + block_size; ++i) {
+            out[stream * num_values + i] = raw_values[i * width + stream];
+          }
+      }
+      stream += group_width;
+    }
+  }
+}
+
+inline void ByteStreamSplitDecodeGeneric(const uint8_t* data, int width,
+                                         int64_t num_values, int64_t stride,
+                                         uint8_t* out) {
+  uint8_t scratch[kByteStreamSplitGenericBlockSize * 8];
+  for (int64_t offset = 0; offset < num_values;
+       offset += kByteStreamSplitGenericBlockSize) {
+    const int64_t block_size =
+        std::min(kByteStreamSplitGenericBlockSize, num_values - offset);
+    for (int stream = 0; stream < width;) {
+      const int group_width = ByteStreamSplitGroupWidth(width - stream);
+      switch (group_width) {
+        case 8:
+          ByteStreamSplitDecodeGroup<8>(data, width, stream, stride, offset, block_size,
+                                        scratch, out);
+          break;
+        case 4:
+          ByteStreamSplitDecodeGroup<4>(data, width, stream, stride, offset, block_size,
+                                        scratch, out);
+          break;
+        case 2:
+          ByteStreamSplitDecodeGroup<2>(data, width, stream, stride, offset, block_size,
+                                        scratch, out);
+          break;
+        default:
+          for (int64_t i = offset; i < offset + block_size; ++i) {
+            out[i * width + stream] = data[stream * stride + i];
+          }
+      }
+      stream += group_width;
+    }
+  }
+}
+
+#endif  // defined(ARROW_HAVE_SIMD_SPLIT)
+
 inline void ByteStreamSplitEncode(const uint8_t* raw_values, int width,
                                   const int64_t num_values, uint8_t* out) {
   switch (width) {
@@ -489,9 +633,16 @@ inline void ByteStreamSplitEncode(const uint8_t* raw_values, int width,
       return ByteStreamSplitEncodeSimdDispatch<4>(raw_values, width, num_values, out);
     case 8:
       return ByteStreamSplitEncodeSimdDispatch<8>(raw_values, width, num_values, out);
-    case 16:
-      return ByteStreamSplitEncodeScalar<16>(raw_values, width, num_values, out);
   }
+#if defined(ARROW_HAVE_SIMD_SPLIT)
+  if (width >= kByteStreamSplitGenericMinEncodeWidth) {
+    return ByteStreamSplitEncodeGeneric(raw_values, width, num_values, out);
+  }
+#else
+  if (width == 16) {
+    return ByteStreamSplitEncodeScalar<16>(raw_values, width, num_values, out);
+  }
+#endif
   return ByteStreamSplitEncodeScalarDynamic(raw_values, width, num_values, out);
 }
 
@@ -507,9 +658,16 @@ inline void ByteStreamSplitDecode(const uint8_t* data, int width, int64_t num_va
       return ByteStreamSplitDecodeSimdDispatch<4>(data, width, num_values, stride, out);
     case 8:
       return ByteStreamSplitDecodeSimdDispatch<8>(data, width, num_values, stride, out);
-    case 16:
-      return ByteStreamSplitDecodeScalar<16>(data, width, num_values, stride, out);
   }
+#if defined(ARROW_HAVE_SIMD_SPLIT)
+  if (width >= kByteStreamSplitGenericMinDecodeWidth) {
+    return ByteStreamSplitDecodeGeneric(data, width, num_values, stride, out);
+  }
+#else
+  if (width == 16) {
+    return ByteStreamSplitDecodeScalar<16>(data, width, num_values, stride, out);
+  }
+#endif
   return ByteStreamSplitDecodeScalarDynamic(data, width, num_values, stride, out);
 }
 
@@ -0,0 +1,258 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/byte_stream_split_internal.h"
+#include "arrow/util/math_internal.h"
+#include "arrow/util/simd.h"
+
+#include <xsimd/xsimd.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+namespace arrow::util::internal {
+
+using ::arrow::internal::ReversePow2;
+
+// The AVX-512 unpack instructions work within 128-bit lanes, so each lane of the
+// registers runs the SSE algorithm on its own block of 16 values per stream. The
+// 128-bit lanes are then transposed between the registers to restore the order of
+// the values (decoding), or transposed first to group each SSE block in the same
+// lane (encoding).
+//
+// Lane L of register i of the SSE algorithm holds the i-th 16-byte chunk of the
+// values of block L, i.e. chunk `L * kNumStreams + i` of the 64 * kNumStreams bytes
+// of values processed at once.
+
+namespace {
+
+// Transpose the 128-bit lanes of four registers:
+// `out[i]` lane `j` is `in[j]` lane `i`.
+inline void TransposeLanes4x4(const __m512i* in, __m512i* out) {
+  const __m512i t0 = _mm512_shuffle_i64x2(in[0], in[1], 0x44);
+  const __m512i t1 = _mm512_shuffle_i64x2(in[0], in[1], 0xEE);
+  const __m512i t2 = _mm512_shuffle_i64x2(in[2], in[3], 0x44);
+  const __m512i t3 = _mm512_shuffle_i64x2(in[2], in[3], 0xEE);
+  out[0] = _mm512_shuffle_i64x2(t0, t2, 0x88);
+  out[1] = _mm512_shuffle_i64x2(t0, t2, 0xDD);
+  out[2] = _mm512_shuffle_i64x2(t1, t3, 0x88);
+  out[3] = _mm512_shuffle_i64x2(t1, t3, 0xDD);
+}
+
+// Reorder registers holding chunk `L * kNumStreams + i` in lane L of register i into
+// registers holding consecutive chunks.
+template <int kNumStreams>
+void LanesToChunks(const __m512i* in, __m512i* out) {
+  if constexpr (kNumStreams == 2) {
+    const __m512i t0 = _mm512_shuffle_i64x2(in[0], in[1], 0x44);
+    const __m512i t1 = _mm512_shuffle_i64x2(in[0], in[1], 0xEE);
+    out[0] = _mm512_shuffle_i64x2(t0, t0, 0xD8);
+    out[1] = _mm512_shuffle_i64x2(t1, t1, 0xD8);
+  } else if constexpr (kNumStreams == 4) {
+    TransposeLanes4x4(in, out);
+  } else {
+    static_assert(kNumStreams == 8);
+    __m512i low[4], high[4];
+    TransposeLanes4x4(in, low);
+    TransposeLanes4x4(in + 4, high);
+    for (int i = 0; i < 4; ++i) {
+      out[i * 2] = low[i];
+      out[i * 2 + 1] = high[i];
+    }
+  }
+}
+
+// The inverse of LanesToChunks
+template <int kNumStreams>
+void ChunksToLanes(const __m512i* in, __m512i* out) {
+  if constexpr (kNumStreams == 2) {
+    out[0] = _mm512_shuffle_i64x2(in[0], in[1], 0x88);
+    out[1] = _mm512_shuffle_i64x2(in[0], in[1], 0xDD);
+  } else if constexpr (kNumStreams == 4) {
+    TransposeLanes4x4(in, out);
+  } else {
+    static_assert(kNumStreams == 8);
+    __m512i even[4], odd[4];
+    for (int i = 0; i < 4; ++i) {
+      even[i] = in[i * 2];
+      odd[i] = in[i * 2 + 1];
+    }
+    TransposeLanes4x4(even, out);
+    TransposeLanes4x4(odd, out + 4);
+  }
+}
+
+template <int kNumBytes>
+__m512i UnpackLo(__m512i a, __m512i b) {
+  if constexpr (kNumBytes == 2) {
+    return _mm512_unpacklo_epi16(a, b);
+  } else if constexpr (kNumBytes == 4) {
+    return _mm512_unpacklo_epi32(a, b);
+  } else {
+    static_assert(kNumBytes == 8);
+    return _mm512_unpacklo_epi64(a, b);
+  }
+}
+
+template <int kNumBytes>
+__m512i UnpackHi(__m512i a, __m512i b) {
+  if constexpr (kNumBytes == 2) {
+    return _mm512_unpackhi_epi16(a, b);
+  } else if constexpr (kNumBytes == 4) {
+    return _mm512_unpackhi_epi32(a, b);
+  } else {
+    static_assert(kNumBytes == 8);
+    return _mm512_unpackhi_epi64(a, b);
+  }
+}
+
+}  // namespace
+
+template <int kNumStreams>
+void ByteStreamSplitDecodeAvx512(const uint8_t* data, int width, int64_t num_values,
+                                 int64_t stride, uint8_t* out) {
+  assert(width == kNumStreams);
+  constexpr int kBatchSize = static_cast<int>(sizeof(__m512i));
+  constexpr int kNumStreamsLog2 = ReversePow2(kNumStreams);
+  static_assert(kNumStreamsLog2 != 0);
+
+  if (num_values < kBatchSize) {
+    // Back to AVX2 for small sizes
+    return ByteStreamSplitDecodeSimd<xsimd::avx2, kNumStreams>(data, width, num_values,
+                                                                stride, out);
+  }
+
+  const int64_t num_blocks = num_values / kBatchSize;
+
+  // First handle suffix.
+  for (int64_t i = num_blocks * kBatchSize; i < num_values; ++i) {
+    for (int b = 0; b < kNumStreams; ++b) {
+      out[i * kNumStreams + b] = data[b * stride + i];
+    }
+  }
+
+  constexpr int kNumStreamsHalf = kNumStreams / 2;
+  __m512i stage[kNumStreamsLog2 + 1][kNumStreams];
+  __m512i result[kNumStreams];
+
+  for (int64_t block_index = 0; block_index < num_blocks; ++block_index) {
+    for (int i = 0; i < kNumStreams; ++i) {
+      stage[0][i] = _mm512_loadu_si512(&data[block_index * kBatchSize + i * stride]);
+    }
+
+    // Same byte-level unpacking as ByteStreamSplitDecodeSimd, within each lane
+    for (int step = 0; step < kNumStreamsLog2; ++step) {
+      for (int i = 0; i < kNumStreamsHalf; ++i) {
+        stage[step + 1][i * 2] =
+            _mm512_unpacklo_epi8(stage[step][i], stage[step][kNumStreamsHalf + i]);
+        stage[step + 1][i * 2 + 1] =
+            _mm512_unpackhi_epi8(stage[step][i], stage[step][kNumStreamsHalf + i]);
+      }
+    }
+
+    LanesToChunks<kNumStreams>(stage[kNumStreamsLog2], result);
+    for (int i = 0; i < kNumStreams; ++i) {
+      _mm512_storeu_si512(&out[(block_index * kNumStreams + i) * kBatchSize], result[i]);
+    }
+  }
+}
+
+template <int kNumStreams>
+void ByteStreamSplitEncodeAvx512(const uint8_t* raw_values, int width,
+                                 const int64_t num_values, uint8_t* output_buffer_raw) {
+  assert(width == kNumStreams);
+  constexpr int kBatchSize = static_cast<int>(sizeof(__m512i));
+  static_assert(ReversePow2(kNumStreams) != 0);
+
+  if (num_values < kBatchSize) {
+    // Back to AVX2 for small sizes
+    return ByteStreamSplitEncodeAvx2<kNumStreams>(raw_values, width, num_values,
+                                                  output_buffer_raw);
+  }
+
+  const int64_t num_blocks = num_values / kBatchSize;
+
+  // First handle suffix.
+  for (int64_t i = num_blocks * kBatchSize; i < num_values; ++i) {
+    for (int j = 0; j < kNumStreams; ++j) {
+      output_buffer_raw[j * num_values + i] = raw_values[i * kNumStreams + j];
+    }
+  }
+
+  // Same steps as ByteStreamSplitEncodeSimd with 128-bit batches, see there.
+  constexpr int kLaneSize = 16;
+  constexpr int kNumValuesInLane = kLaneSize / kNumStreams;
+  constexpr int kNumBytes = 2 * kNumValuesInLane;
+  constexpr int kNumStepsByte = ReversePow2(kNumValuesInLane) + 1;
+  constexpr int kNumStepsLarge = ReversePow2(kLaneSize / kNumBytes);
+  constexpr int kNumSteps = kNumStepsByte + kNumStepsLarge;
+  constexpr int kNumStreamsHalf = kNumStreams / 2;
+
+  __m512i chunks[kNumStreams];
+  __m512i stage[kNumSteps + 1][kNumStreams];
+
+  for (int64_t block_index = 0; block_index < num_blocks; ++block_index) {
+    for (int i = 0; i < kNumStreams; ++i) {
+      chunks[i] =
+          _mm512_loadu_si512(&raw_values[(block_index * kNumStreams + i) * kBatchSize]);
+    }
+    ChunksToLanes<kNumStreams>(chunks, stage[0]);
+
+    for (int i = 0; i < kNumStreamsHalf; ++i) {
+      for (int step = 0; step < kNumStepsByte; ++step) {
+        stage[step + 1][i * 2] =
+            _mm512_unpacklo_epi8(stage[step][i * 2], stage[step][i * 2 + 1]);
+        stage[step + 1][i * 2 + 1] =
+            _mm512_unpackhi_epi8(stage[step][i * 2], stage[step][i * 2 + 1]);
+      }
+    }
+
+    if constexpr (kNumStepsLarge > 0) {
+      for (int step = kNumStepsByte; step < kNumSteps; ++step) {
+        for (int i = 0; i < kNumStreamsHalf; ++i) {
+          stage[step + 1][i * 2] = UnpackLo<kNumBytes>(stage[step][i],
+                                                       stage[step][i + kNumStreamsHalf]);
+          stage[step + 1][i * 2 + 1] = UnpackHi<kNumBytes>(
+              stage[step][i], stage[step][i + kNumStreamsHalf]);
+        }
+      }
+    }
+
+    // Each lane now holds 16 bytes of a stream for consecutive values
+    for (int i = 0; i < kNumStreams; ++i) {
+      _mm512_storeu_si512(&output_buffer_raw[i * num_values + block_index * kBatchSize],
+                          stage[kNumSteps][i]);
+    }
+  }
+}
+
+template void ByteStreamSplitDecodeAvx512<2>(const uint8_t*, int, int64_t, int64_t,
+                                             uint8_t*);
+template void ByteStreamSplitDecodeAvx512<4>(const uint8_t*, int, int64_t, int64_t,
+                                             uint8_t*);
+template void ByteStreamSplitDecodeAvx512<8>(const uint8_t*, int, int64_t, int64_t,
+                                             uint8_t*);
+
+template void ByteStreamSplitEncodeAvx512<2>(const uint8_t*, int, const int64_t,
+                                             uint8_t*);
+template void ByteStreamSplitEncodeAvx512<4>(const uint8_t*, int, const int64_t,
+                                             uint8_t*);
+template void ByteStreamSplitEncodeAvx512<8>(const uint8_t*, int, const int64_t,
+                                             uint8_t*);
+
+}  // namespace arrow::util::internal
@@ -33,11 +33,16 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/byte_stream_split_internal.h"
+#include "arrow/util/cpu_info.h"
 
 namespace arrow::util::internal {
 
+using ::arrow::internal::CpuInfo;
+
 using ByteStreamSplitTypes =
-    ::testing::Types<int8_t, int16_t, int32_t, int64_t, std::array<uint8_t, 3>>;
+    ::testing::Types<int8_t, int16_t, int32_t, int64_t, std::array<uint8_t, 3>,
+                     std::array<uint8_t, 7>, std::array<uint8_t, 12>,
+                     std::array<uint8_t, 16>>;
 
 template <typename Func>
 struct NamedFunc {
@@ -154,6 +159,16 @@ class TestByteStreamSplitSpecialized : public ::testing::Test {
 #  if defined(ARROW_HAVE_AVX2)
       funcs.push_back({"xsimd_avx2", &ByteStreamSplitDecodeSimd<xsimd::avx2, kWidth>});
 #  endif
+#  if defined(ARROW_HAVE_SVE256) || defined(ARROW_HAVE_SVE512)
+      funcs.push_back({"xsimd_sve", &ByteStreamSplitDecodeSimd<xsimd::sve, kWidth>});
+#  endif
+#  if defined(ARROW_HAVE_RUNTIME_AVX512)
+      if (CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX512)) {
+        funcs.push_back({"intrinsics_avx512", &ByteStreamSplitDecodeAvx512<kWidth>});
+      }
+#  endif
+    } else if constexpr (kWidth > 2) {
+      funcs.push_back({"generic", &ByteStreamSplitDecodeGeneric});
     }
 #endif  // defined(ARROW_HAVE_SIMD_SPLIT)
     return funcs;
@@ -181,6 +196,13 @@ class TestByteStreamSplitSpecialized : public ::testing::Test {
         funcs.push_back({"intrinsics_avx2", &ByteStreamSplitEncodeAvx2<kWidth>});
       }
 #  endif
+#  if defined(ARROW_HAVE_RUNTIME_AVX512)
+      if (CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX512)) {
+        funcs.push_back({"intrinsics_avx512", &ByteStreamSplitEncodeAvx512<kWidth>});
+      }
+#  endif
+    } else if constexpr (kWidth > 2) {
+      funcs.push_back({"generic", &ByteStreamSplitEncodeGeneric});
     }
 #endif  // defined(ARROW_HAVE_SIMD_SPLIT)
     return funcs;
@@ -206,6 +228,13 @@ TYPED_TEST(TestByteStreamSplitSpecialized, RoundtripMidsized) {
   }
 }
 
+TYPED_TEST(TestByteStreamSplitSpecialized, RoundtripLarge) {
+  // Several blocks of the AVX-512 and generic implementations
+  for (int64_t num_values : {1023, 1024, 1025, 3000}) {
+    this->TestRoundtrip(num_values);
+  }
+}
+
 TYPED_TEST(TestByteStreamSplitSpecialized, PiecewiseDecode) {
   this->TestPiecewiseDecode(/*num_values=*/500);
 }
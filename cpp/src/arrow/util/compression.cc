@@ -45,6 +45,10 @@ Status CheckSupportsCompressionLevel(Compression::type type) {
 
 int Codec::UseDefaultCompressionLevel() { return kUseDefaultCompressionLevel; }
 
+Result<int64_t> Decompressor::FrameCompressedSize(int64_t, const uint8_t*) {
+  return Status::NotImplemented("Splitting this compressed stream into frames");
+}
+
 Status Codec::Init() { return Status::OK(); }
 
 const std::string& Codec::GetCodecAsString(Compression::type t) {
@@ -191,11 +195,13 @@ Result<std::unique_ptr<Codec>> Codec::Create(Compression::type codec_type,
       codec = internal::MakeLz4RawCodec(compression_level);
 #endif
       break;
-    case Compression::LZ4_FRAME:
+    case Compression::LZ4_FRAME: {
 #ifdef ARROW_WITH_LZ4
-      codec = internal::MakeLz4FrameCodec(compression_level);
+      auto opt = dynamic_cast<const Lz4CodecOptions*>(&codec_options);
+      codec = internal::MakeLz4FrameCodec(compression_level, opt && opt->use_threads);
 #endif
       break;
+    }
     case Compression::LZ4_HADOOP:
 #ifdef ARROW_WITH_LZ4
       codec = internal::MakeLz4HadoopRawCodec();
@@ -207,7 +213,8 @@ Result<std::unique_ptr<Codec>> Codec::Create(Compression::type codec_type,
       codec = internal::MakeZSTDCodec(
           compression_level,
           opt ? opt->compression_context_params : std::vector<std::pair<int, int>>{},
-          opt ? opt->decompression_context_params : std::vector<std::pair<int, int>>{});
+          opt ? opt->decompression_context_params : std::vector<std::pair<int, int>>{},
+          opt ? opt->dictionary : nullptr, opt ? opt->num_workers : 0);
 #endif
       break;
     }
@@ -280,5 +287,14 @@ bool Codec::IsAvailable(Compression::type codec_type) {
   }
 }
 
+Result<std::shared_ptr<Buffer>> TrainZstdDictionary(
+    const std::vector<std::shared_ptr<Buffer>>& samples, int64_t max_dictionary_size) {
+#ifdef ARROW_WITH_ZSTD
+  return internal::TrainZSTDDictionary(samples, max_dictionary_size);
+#else
+  return Status::NotImplemented("Support for codec 'zstd' not built");
+#endif
+}
+
 }  // namespace util
 }  // namespace arrow
@@ -27,6 +27,7 @@
 
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/type_fwd.h"
 #include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
 
@@ -107,6 +108,14 @@ class ARROW_EXPORT Decompressor {
   /// \brief Reinitialize decompressor, making it ready for a new compressed stream.
   virtual Status Reset() = 0;
 
+  /// \brief Return the compressed size of the frame starting at `input`
+  ///
+  /// A compressed stream made of several concatenated frames can be split on
+  /// their boundaries, and each frame decompressed independently with a fresh
+  /// (or Reset()) decompressor.  Returns 0 if `input_len` bytes are not enough
+  /// to find the end of the frame, and NotImplemented if the format can't be split.
+  virtual Result<int64_t> FrameCompressedSize(int64_t input_len, const uint8_t* input);
+
   // XXX add methods for buffer size heuristics?
 };
 
@@ -144,6 +153,20 @@ class ARROW_EXPORT BrotliCodecOptions : public CodecOptions {
   std::optional<int> window_bits;
 };
 
+// ----------------------------------------------------------------------
+// Lz4 codec options implementation
+
+class ARROW_EXPORT Lz4CodecOptions : public CodecOptions {
+ public:
+  /// \brief Compress and decompress large LZ4_FRAME buffers in parallel
+  ///
+  /// One-shot compression then writes frames of independent 1 MiB blocks that are
+  /// compressed, and decompressed, in parallel on the CPU thread pool.  Streams,
+  /// frames with dependent blocks or checksums and calls from the CPU thread pool
+  /// itself are still processed on the calling thread.
+  bool use_threads = false;
+};
+
 // ----------------------------------------------------------------------
 // Zstd codec options implementation
 
@@ -152,8 +175,38 @@ class ARROW_EXPORT ZstdCodecOptions : public CodecOptions {
   // Valid keys can be found at https://facebook.github.io/zstd/zstd_manual.html.
   std::vector<std::pair<int, int>> compression_context_params;
   std::vector<std::pair<int, int>> decompression_context_params;
+  /// \brief Dictionary to compress and decompress with, e.g. as trained by
+  /// TrainZstdDictionary()
+  ///
+  /// Data compressed with a dictionary can only be decompressed with the same
+  /// dictionary.
+  std::shared_ptr<Buffer> dictionary;
+  /// \brief Number of threads compressing in parallel (ZSTD_c_nbWorkers)
+  ///
+  /// 0 compresses on the calling thread.  ZSTD splits large inputs into jobs
+  /// compressed by its own worker threads, both in one-shot and streaming
+  /// compression.  Ignored if the ZSTD library was built without multithreading
+  /// support.  Decompression is always single-threaded.
+  int num_workers = 0;
 };
 
+/// \brief Default maximum size of a dictionary trained by TrainZstdDictionary()
+constexpr int64_t kDefaultZstdDictionarySize = 112640;
+
+/// \brief Train a ZSTD dictionary from samples of the data to compress
+///
+/// A dictionary mostly improves the compression ratio of small inputs (a few
+/// kilobytes at most) sharing some content.  The samples should be representative of
+/// those inputs and, in total, around 100 times larger than the dictionary.
+///
+/// \param[in] samples the sample inputs
+/// \param[in] max_dictionary_size the maximum size of the dictionary in bytes
+/// \return the dictionary, to set as ZstdCodecOptions::dictionary
+ARROW_EXPORT
+Result<std::shared_ptr<Buffer>> TrainZstdDictionary(
+    const std::vector<std::shared_ptr<Buffer>>& samples,
+    int64_t max_dictionary_size = kDefaultZstdDictionarySize);
+
 /// \brief Compression codec
 class ARROW_EXPORT Codec {
  public:
@@ -228,6 +228,84 @@ static void ReferenceDecompression(
   state.SetBytesProcessed(state.iterations() * data.size());
 }
 
+static void ParallelCompression(
+    benchmark::State& state,  // NOLINT non-const reference
+    const CodecOptions& options) {
+  auto data = MakeCompressibleData(32 * 1024 * 1024);  // 32 MB
+
+  auto codec = *Codec::Create(static_cast<Compression::type>(state.range(0)), options);
+
+  while (state.KeepRunning()) {
+    std::vector<uint8_t> compressed_data;
+    auto compressed_size = Compress(codec.get(), data, &compressed_data);
+    state.counters["ratio"] =
+        static_cast<double>(data.size()) / static_cast<double>(compressed_size);
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+static void ParallelDecompression(
+    benchmark::State& state,  // NOLINT non-const reference
+    const CodecOptions& options) {
+  auto data = MakeCompressibleData(32 * 1024 * 1024);  // 32 MB
+
+  auto codec = *Codec::Create(static_cast<Compression::type>(state.range(0)), options);
+
+  std::vector<uint8_t> compressed_data;
+  ARROW_UNUSED(Compress(codec.get(), data, &compressed_data));
+
+  std::vector<uint8_t> decompressed_data(data);
+  while (state.KeepRunning()) {
+    auto result = codec->Decompress(compressed_data.size(), compressed_data.data(),
+                                    decompressed_data.size(), decompressed_data.data());
+    ARROW_CHECK(result.ok());
+    ARROW_CHECK(*result == static_cast<int64_t>(decompressed_data.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+#  ifdef ARROW_WITH_ZSTD
+static void ZstdWorkersCompression(
+    benchmark::State& state) {  // NOLINT non-const reference
+  ZstdCodecOptions options;
+  options.num_workers = static_cast<int>(state.range(1));
+  ParallelCompression(state, options);
+}
+
+BENCHMARK(ZstdWorkersCompression)
+    ->ArgNames({"codec", "workers"})
+    ->ArgsProduct({{Compression::ZSTD}, {0, 2, 4, 8}})
+    ->UseRealTime();
+#  endif
+
+#  ifdef ARROW_WITH_LZ4
+static Lz4CodecOptions Lz4ThreadsOptions(
+    benchmark::State& state) {  // NOLINT non-const reference
+  Lz4CodecOptions options;
+  options.use_threads = state.range(1) != 0;
+  return options;
+}
+
+static void Lz4ThreadsCompression(
+    benchmark::State& state) {  // NOLINT non-const reference
+  ParallelCompression(state, Lz4ThreadsOptions(state));
+}
+
+static void Lz4ThreadsDecompression(
+    benchmark::State& state) {  // NOLINT non-const reference
+  ParallelDecompression(state, Lz4ThreadsOptions(state));
+}
+
+BENCHMARK(Lz4ThreadsCompression)
+    ->ArgNames({"codec", "use_threads"})
+    ->ArgsProduct({{Compression::LZ4_FRAME}, {0, 1}})
+    ->UseRealTime();
+BENCHMARK(Lz4ThreadsDecompression)
+    ->ArgNames({"codec", "use_threads"})
+    ->ArgsProduct({{Compression::LZ4_FRAME}, {0, 1}})
+    ->UseRealTime();
+#  endif
+
 #  ifdef ARROW_WITH_ZLIB
 BENCHMARK_TEMPLATE(ReferenceStreamingCompression, Compression::GZIP);
 BENCHMARK_TEMPLATE(ReferenceCompression, Compression::GZIP);
@@ -61,7 +61,7 @@ constexpr int kLz4DefaultCompressionLevel = 1;
 // Lz4 frame format codec.
 
 std::unique_ptr<Codec> MakeLz4FrameCodec(
-    int compression_level = kLz4DefaultCompressionLevel);
+    int compression_level = kLz4DefaultCompressionLevel, bool use_threads = false);
 
 // Lz4 "raw" format codec.
 std::unique_ptr<Codec> MakeLz4RawCodec(
@@ -78,7 +78,11 @@ constexpr int kZSTDDefaultCompressionLevel = 1;
 std::unique_ptr<Codec> MakeZSTDCodec(
     int compression_level = kZSTDDefaultCompressionLevel,
     std::vector<std::pair<int, int>> compression_context_params = {},
-    std::vector<std::pair<int, int>> decompression_context_params = {});
+    std::vector<std::pair<int, int>> decompression_context_params = {},
+    std::shared_ptr<Buffer> dictionary = NULLPTR, int num_workers = 0);
+
+Result<std::shared_ptr<Buffer>> TrainZSTDDictionary(
+    const std::vector<std::shared_ptr<Buffer>>& samples, int64_t max_dictionary_size);
 
 }  // namespace internal
 }  // namespace util
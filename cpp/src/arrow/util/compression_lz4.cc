@@ -17,9 +17,12 @@
 
 #include "arrow/util/compression_internal.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include <lz4.h>
 #include <lz4frame.h>
@@ -31,6 +34,8 @@
 #include "arrow/util/endian.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/ubsan.h"
 
 #ifndef LZ4F_HEADER_SIZE_MAX
@@ -61,6 +66,31 @@ static LZ4F_preferences_t PreferencesWithCompressionLevel(int compression_level)
   return prefs;
 }
 
+#ifdef LZ4HC_CLEVEL_MIN
+constexpr int kMinHcCompressionLevel = LZ4HC_CLEVEL_MIN;
+#else  // For older versions of the lz4 library
+constexpr int kMinHcCompressionLevel = 3;
+#endif
+
+// Frames compressed in parallel are made of independent blocks of this size
+constexpr int64_t kParallelBlockSize = 1 << 20;
+constexpr LZ4F_blockSizeID_t kParallelBlockSizeId = LZ4F_max1MB;
+// The high bit of a block size marks a block stored uncompressed
+constexpr uint32_t kUncompressedBlockFlag = 0x80000000U;
+
+int64_t BlockMaxSize(LZ4F_blockSizeID_t block_size_id) {
+  switch (block_size_id) {
+    case LZ4F_max256KB:
+      return 256 << 10;
+    case LZ4F_max1MB:
+      return 1 << 20;
+    case LZ4F_max4MB:
+      return 4 << 20;
+    default:
+      return 64 << 10;
+  }
+}
+
 // ----------------------------------------------------------------------
 // Lz4 frame decompressor implementation
 
@@ -123,6 +153,43 @@ class LZ4Decompressor : public Decompressor {
 
   bool IsFinished() override { return finished_; }
 
+  Result<int64_t> FrameCompressedSize(int64_t input_len, const uint8_t* input) override {
+    // Walk the frame format: magic number, frame descriptor, blocks, end mark and
+    // optional content checksum
+    if (input_len < 8) {
+      return 0;
+    }
+    const uint32_t magic = bit_util::FromLittleEndian(util::SafeLoadAs<uint32_t>(input));
+    if ((magic & 0xFFFFFFF0U) == 0x184D2A50U) {
+      // Skippable frame
+      const uint32_t skip_len =
+          bit_util::FromLittleEndian(util::SafeLoadAs<uint32_t>(input + 4));
+      const int64_t frame_len = 8 + static_cast<int64_t>(skip_len);
+      return frame_len <= input_len ? frame_len : 0;
+    }
+    if (magic != 0x184D2204U) {
+      return Status::IOError("LZ4 frame size failed: unknown frame magic number");
+    }
+    const uint8_t flags = input[4];
+    const bool block_checksum = (flags & 0x10) != 0;
+    const bool content_size = (flags & 0x08) != 0;
+    const bool content_checksum = (flags & 0x04) != 0;
+    const bool dict_id = (flags & 0x01) != 0;
+    int64_t pos = 4 + 2 + (content_size ? 8 : 0) + (dict_id ? 4 : 0) + 1;
+    while (pos + 4 <= input_len) {
+      const uint32_t block_header =
+          bit_util::FromLittleEndian(util::SafeLoadAs<uint32_t>(input + pos));
+      pos += 4;
+      if (block_header == 0) {
+        pos += content_checksum ? 4 : 0;
+        return pos <= input_len ? pos : 0;
+      }
+      pos += (block_header & ~kUncompressedBlockFlag) +
+             (block_checksum ? 4 : 0);
+    }
+    return 0;
+  }
+
  protected:
   LZ4F_decompressionContext_t ctx_ = nullptr;
   bool finished_;
@@ -253,20 +320,30 @@ class LZ4Compressor : public Compressor {
 
 class Lz4FrameCodec : public Codec {
  public:
-  explicit Lz4FrameCodec(int compression_level)
+  Lz4FrameCodec(int compression_level, bool use_threads)
       : compression_level_(compression_level == kUseDefaultCompressionLevel
                                ? kLz4DefaultCompressionLevel
                                : compression_level),
-        prefs_(PreferencesWithCompressionLevel(compression_level_)) {}
+        prefs_(PreferencesWithCompressionLevel(compression_level_)),
+        use_threads_(use_threads) {}
 
   int64_t MaxCompressedLen(int64_t input_len,
                            const uint8_t* ARROW_ARG_UNUSED(input)) override {
-    return static_cast<int64_t>(
+    const auto max_len = static_cast<int64_t>(
         LZ4F_compressFrameBound(static_cast<size_t>(input_len), &prefs_));
+    if (!use_threads_) {
+      return max_len;
+    }
+    return std::max(max_len, MaxParallelCompressedLen(input_len));
   }
 
   Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
                            int64_t output_buffer_len, uint8_t* output_buffer) override {
+    if (auto executor = GetParallelExecutor(input_len);
+        executor != nullptr &&
+        output_buffer_len >= MaxParallelCompressedLen(input_len)) {
+      return CompressParallel(input_len, input, output_buffer, executor);
+    }
     auto output_len =
         LZ4F_compressFrame(output_buffer, static_cast<size_t>(output_buffer_len), input,
                            static_cast<size_t>(input_len), &prefs_);
@@ -278,6 +355,14 @@ class Lz4FrameCodec : public Codec {
 
   Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
                              int64_t output_buffer_len, uint8_t* output_buffer) override {
+    if (auto executor = GetParallelExecutor(output_buffer_len)) {
+      ARROW_ASSIGN_OR_RAISE(auto decompressed,
+                            DecompressParallel(input_len, input, output_buffer_len,
+                                               output_buffer, executor));
+      if (decompressed.has_value()) {
+        return *decompressed;
+      }
+    }
     ARROW_ASSIGN_OR_RAISE(auto decomp, MakeDecompressor());
 
     int64_t total_bytes_written = 0;
@@ -327,8 +412,192 @@ class Lz4FrameCodec : public Codec {
   int compression_level() const override { return compression_level_; }
 
  protected:
+  // The executor to process a buffer of `length` bytes in parallel on, if any
+  ::arrow::internal::Executor* GetParallelExecutor(int64_t length) const {
+    if (!use_threads_ || length < 2 * kParallelBlockSize) {
+      return nullptr;
+    }
+    auto executor = ::arrow::internal::GetCpuThreadPool();
+    // Waiting for tasks from a thread of the pool could starve it
+    if (executor->GetCapacity() < 2 || executor->OwnsThisThread()) {
+      return nullptr;
+    }
+    return executor;
+  }
+
+  LZ4F_preferences_t ParallelPreferences(int64_t input_len) const {
+    LZ4F_preferences_t prefs = prefs_;
+    prefs.frameInfo.blockMode = LZ4F_blockIndependent;
+    prefs.frameInfo.blockSizeID = kParallelBlockSizeId;
+    prefs.frameInfo.contentChecksumFlag = LZ4F_noContentChecksum;
+    prefs.frameInfo.blockChecksumFlag = LZ4F_noBlockChecksum;
+    prefs.frameInfo.contentSize = static_cast<uint64_t>(input_len);
+    return prefs;
+  }
+
+  // Room for the frame header, every block compressed at its worst and the end mark
+  static int64_t MaxParallelCompressedLen(int64_t input_len) {
+    const int64_t num_blocks = bit_util::CeilDiv(input_len, kParallelBlockSize);
+    const int64_t block_capacity = 4 + LZ4_compressBound(kParallelBlockSize);
+    return LZ4F_HEADER_SIZE_MAX + num_blocks * block_capacity + 4;
+  }
+
+  // Compress each block at its worst-case position, then pack the blocks behind
+  // the frame header
+  Result<int64_t> CompressParallel(int64_t input_len, const uint8_t* input,
+                                   uint8_t* output_buffer,
+                                   ::arrow::internal::Executor* executor) {
+    const LZ4F_preferences_t prefs = ParallelPreferences(input_len);
+    LZ4F_compressionContext_t ctx;
+    auto ret = LZ4F_createCompressionContext(&ctx, LZ4F_VERSION);
+    if (LZ4F_isError(ret)) {
+      return LZ4Error(ret, "LZ4 init failed: ");
+    }
+    const size_t header_len =
+        LZ4F_compressBegin(ctx, output_buffer, LZ4F_HEADER_SIZE_MAX, &prefs);
+    ARROW_UNUSED(LZ4F_freeCompressionContext(ctx));
+    if (LZ4F_isError(header_len)) {
+      return LZ4Error(header_len, "LZ4 compress begin failed: ");
+    }
+
+    const int num_blocks =
+        static_cast<int>(bit_util::CeilDiv(input_len, kParallelBlockSize));
+    const int block_capacity = LZ4_compressBound(kParallelBlockSize);
+    uint8_t* blocks = output_buffer + LZ4F_HEADER_SIZE_MAX;
+    std::vector<int64_t> block_lens(num_blocks);
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(
+        num_blocks,
+        [&](int i) {
+          const int64_t offset = i * kParallelBlockSize;
+          const int src_len =
+              static_cast<int>(std::min(kParallelBlockSize, input_len - offset));
+          const auto src = reinterpret_cast<const char*>(input + offset);
+          uint8_t* dst = blocks + static_cast<int64_t>(i) * (4 + block_capacity);
+          const auto compressed = reinterpret_cast<char*>(dst + 4);
+          const int compressed_len =
+              compression_level_ < kMinHcCompressionLevel
+                  ? LZ4_compress_default(src, compressed, src_len, block_capacity)
+                  : LZ4_compress_HC(src, compressed, src_len, block_capacity,
+                                    compression_level_);
+          uint32_t block_header;
+          if (compressed_len > 0 && compressed_len < src_len) {
+            block_header = static_cast<uint32_t>(compressed_len);
+            block_lens[i] = compressed_len;
+          } else {
+            block_header = static_cast<uint32_t>(src_len) | kUncompressedBlockFlag;
+            std::memcpy(compressed, src, static_cast<size_t>(src_len));
+            block_lens[i] = src_len;
+          }
+          util::SafeStore(dst, bit_util::ToLittleEndian(block_header));
+          return Status::OK();
+        },
+        executor));
+
+    int64_t output_len = static_cast<int64_t>(header_len);
+    for (int i = 0; i < num_blocks; ++i) {
+      std::memmove(output_buffer + output_len,
+                   blocks + static_cast<int64_t>(i) * (4 + block_capacity),
+                   static_cast<size_t>(4 + block_lens[i]));
+      output_len += 4 + block_lens[i];
+    }
+    // End mark
+    util::SafeStore(output_buffer + output_len, uint32_t{0});
+    return output_len + 4;
+  }
+
+  // Decompress the blocks of a frame in parallel, returning nullopt if the frame
+  // cannot be split (dependent blocks, checksums, several frames or blocks smaller
+  // than the maximum size before the last one) or is invalid, so that it goes
+  // through the sequential decompressor
+  Result<std::optional<int64_t>> DecompressParallel(
+      int64_t input_len, const uint8_t* input, int64_t output_buffer_len,
+      uint8_t* output_buffer, ::arrow::internal::Executor* executor) {
+    LZ4F_decompressionContext_t ctx;
+    auto ret = LZ4F_createDecompressionContext(&ctx, LZ4F_VERSION);
+    if (LZ4F_isError(ret)) {
+      return LZ4Error(ret, "LZ4 init failed: ");
+    }
+    LZ4F_frameInfo_t info;
+    size_t header_len = static_cast<size_t>(input_len);
+    ret = LZ4F_getFrameInfo(ctx, &info, input, &header_len);
+    ARROW_UNUSED(LZ4F_freeDecompressionContext(ctx));
+    if (LZ4F_isError(ret) || info.blockMode != LZ4F_blockIndependent ||
+        info.blockChecksumFlag != LZ4F_noBlockChecksum ||
+        info.contentChecksumFlag != LZ4F_noContentChecksum) {
+      return std::nullopt;
+    }
+    const int64_t block_max_size = BlockMaxSize(info.blockSizeID);
+
+    struct Block {
+      const uint8_t* data;
+      int64_t length;
+      bool compressed;
+    };
+    std::vector<Block> blocks;
+    int64_t pos = static_cast<int64_t>(header_len);
+    while (true) {
+      if (input_len - pos < 4) {
+        return std::nullopt;
+      }
+      const uint32_t block_header =
+          bit_util::FromLittleEndian(util::SafeLoadAs<uint32_t>(input + pos));
+      pos += 4;
+      if (block_header == 0) {
+        break;
+      }
+      const int64_t length = block_header & ~kUncompressedBlockFlag;
+      if (length > input_len - pos || length > block_max_size) {
+        return std::nullopt;
+      }
+      const bool compressed = (block_header & kUncompressedBlockFlag) == 0;
+      blocks.push_back({input + pos, length, compressed});
+      pos += length;
+    }
+    const auto num_blocks = static_cast<int64_t>(blocks.size());
+    if (pos != input_len || num_blocks < 2 ||
+        (num_blocks - 1) * block_max_size >= output_buffer_len) {
+      return std::nullopt;
+    }
+
+    std::vector<int64_t> decompressed_lens(num_blocks, -1);
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(
+        static_cast<int>(num_blocks),
+        [&](int i) {
+          const Block& block = blocks[i];
+          uint8_t* dst = output_buffer + i * block_max_size;
+          const int64_t capacity =
+              std::min(block_max_size, output_buffer_len - i * block_max_size);
+          if (!block.compressed) {
+            if (block.length <= capacity) {
+              std::memcpy(dst, block.data, static_cast<size_t>(block.length));
+              decompressed_lens[i] = block.length;
+            }
+          } else {
+            decompressed_lens[i] = LZ4_decompress_safe(
+                reinterpret_cast<const char*>(block.data), reinterpret_cast<char*>(dst),
+                static_cast<int>(block.length), static_cast<int>(capacity));
+          }
+          return Status::OK();
+        },
+        executor));
+
+    int64_t total = 0;
+    for (int64_t i = 0; i < num_blocks; ++i) {
+      if (decompressed_lens[i] < 0 ||
+          (i + 1 < num_blocks && decompressed_lens[i] != block_max_size)) {
+        return std::nullopt;
+      }
+      total += decompressed_lens[i];
+    }
+    if (info.contentSize != 0 && info.contentSize != static_cast<uint64_t>(total)) {
+      return std::nullopt;
+    }
+    return total;
+  }
+
   const int compression_level_;
   const LZ4F_preferences_t prefs_;
+  const bool use_threads_;
 };
 
 // ----------------------------------------------------------------------
@@ -360,12 +629,7 @@ class Lz4Codec : public Codec {
   Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
                            int64_t output_buffer_len, uint8_t* output_buffer) override {
     int64_t output_len;
-#ifdef LZ4HC_CLEVEL_MIN
-    constexpr int min_hc_clevel = LZ4HC_CLEVEL_MIN;
-#else  // For older versions of the lz4 library
-    constexpr int min_hc_clevel = 3;
-#endif
-    if (compression_level_ < min_hc_clevel) {
+    if (compression_level_ < kMinHcCompressionLevel) {
       output_len = LZ4_compress_default(
           reinterpret_cast<const char*>(input), reinterpret_cast<char*>(output_buffer),
           static_cast<int>(input_len), static_cast<int>(output_buffer_len));
@@ -529,8 +793,8 @@ class Lz4HadoopCodec : public Lz4Codec {
 
 }  // namespace
 
-std::unique_ptr<Codec> MakeLz4FrameCodec(int compression_level) {
-  return std::make_unique<Lz4FrameCodec>(compression_level);
+std::unique_ptr<Codec> MakeLz4FrameCodec(int compression_level, bool use_threads) {
+  return std::make_unique<Lz4FrameCodec>(compression_level, use_threads);
 }
 
 std::unique_ptr<Codec> MakeLz4HadoopRawCodec() {
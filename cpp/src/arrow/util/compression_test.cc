@@ -29,6 +29,7 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/buffer.h"
 #include "arrow/result.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
@@ -641,6 +642,72 @@ TEST(TestCodecMisc, ZstdStreamLargerWindowLog) {
   ASSERT_EQ(decompressed, data);
 }
 
+TEST(TestCodecMisc, ZstdDictionary) {
+#ifndef ARROW_WITH_ZSTD
+  GTEST_SKIP() << "Test requires Zstd compression";
+#endif
+
+  // Small inputs sharing most of their content
+  std::mt19937 rng(42);
+  auto make_input = [&]() {
+    std::string input;
+    for (int i = 0; i < 8; ++i) {
+      input += "{\"id\": " + std::to_string(rng() % 100000) +
+               ", \"name\": \"user_" + std::to_string(rng() % 1000) +
+               "\", \"status\": \"" + (rng() % 2 ? "active" : "inactive") + "\"}";
+    }
+    return Buffer::FromString(std::move(input));
+  };
+  std::vector<std::shared_ptr<Buffer>> samples;
+  for (int i = 0; i < 1000; ++i) {
+    samples.push_back(make_input());
+  }
+  ASSERT_OK_AND_ASSIGN(auto dictionary,
+                       TrainZstdDictionary(samples, /*max_dictionary_size=*/4096));
+  ASSERT_GT(dictionary->size(), 0);
+  ASSERT_LE(dictionary->size(), 4096);
+
+  ZstdCodecOptions options;
+  options.dictionary = dictionary;
+  ASSERT_OK_AND_ASSIGN(auto codec, Codec::Create(Compression::ZSTD, options));
+  ASSERT_OK_AND_ASSIGN(auto plain_codec, Codec::Create(Compression::ZSTD));
+
+  auto compress = [](Codec& codec, const Buffer& input) -> Result<std::vector<uint8_t>> {
+    std::vector<uint8_t> compressed(codec.MaxCompressedLen(input.size(), input.data()));
+    ARROW_ASSIGN_OR_RAISE(auto actual_size,
+                          codec.Compress(input.size(), input.data(), compressed.size(),
+                                         compressed.data()));
+    compressed.resize(actual_size);
+    return compressed;
+  };
+
+  auto input = make_input();
+  ASSERT_OK_AND_ASSIGN(auto compressed, compress(*codec, *input));
+  ASSERT_OK_AND_ASSIGN(auto plain_compressed, compress(*plain_codec, *input));
+  ASSERT_LT(compressed.size(), plain_compressed.size());
+
+  std::vector<uint8_t> decompressed(input->size());
+  ASSERT_OK_AND_EQ(input->size(),
+                   codec->Decompress(compressed.size(), compressed.data(),
+                                     decompressed.size(), decompressed.data()));
+  ASSERT_EQ(0, std::memcmp(decompressed.data(), input->data(), input->size()));
+  // The dictionary is needed to decompress
+  ASSERT_RAISES(IOError,
+                plain_codec->Decompress(compressed.size(), compressed.data(),
+                                        decompressed.size(), decompressed.data()));
+
+  // Streaming decompression uses the dictionary as well
+  ASSERT_OK_AND_ASSIGN(auto decompressor, codec->MakeDecompressor());
+  ASSERT_OK_AND_ASSIGN(
+      auto result, decompressor->Decompress(compressed.size(), compressed.data(),
+                                            decompressed.size(), decompressed.data()));
+  ASSERT_EQ(result.bytes_written, input->size());
+  ASSERT_TRUE(decompressor->IsFinished());
+
+  // Training needs enough samples
+  ASSERT_RAISES(Invalid, TrainZstdDictionary({input}));
+}
+
 TEST_P(CodecTest, MinMaxCompressionLevel) {
   auto type = GetCompression();
   ASSERT_OK_AND_ASSIGN(auto codec, Codec::Create(type));
@@ -873,5 +940,42 @@ TEST(TestCodecLZ4Hadoop, Compatibility) {
 }
 #endif
 
+#ifdef ARROW_WITH_LZ4
+TEST(TestCodecLZ4Frame, UseThreads) {
+  // Frames compressed in parallel are read back by the serial codec and vice versa
+  Lz4CodecOptions options;
+  options.use_threads = true;
+  ASSERT_OK_AND_ASSIGN(auto c1, Codec::Create(Compression::LZ4_FRAME, options));
+  ASSERT_OK_AND_ASSIGN(auto c2, Codec::Create(Compression::LZ4_FRAME));
+
+  // Several blocks, the last one partial
+  const int data_size = 5 * 1024 * 1024 + 1234;
+  for (const auto& data : {MakeRandomData(data_size), MakeCompressibleData(data_size)}) {
+    CheckCodecRoundtrip(c1, c2, data, /*check_reverse=*/false);
+    CheckCodecRoundtrip(c2, c1, data, /*check_reverse=*/false);
+    CheckCodecRoundtrip(c1, c1, data, /*check_reverse=*/false);
+  }
+  // Inputs too small to be split
+  CheckCodecRoundtrip(c1, c2, MakeCompressibleData(1000), /*check_reverse=*/false);
+
+  options.compression_level = 9;
+  ASSERT_OK_AND_ASSIGN(c1, Codec::Create(Compression::LZ4_FRAME, options));
+  CheckCodecRoundtrip(c1, c2, MakeCompressibleData(data_size), /*check_reverse=*/false);
+}
+#endif
+
+#ifdef ARROW_WITH_ZSTD
+TEST(TestCodecMisc, ZstdNumWorkers) {
+  ZstdCodecOptions options;
+  options.num_workers = 4;
+  ASSERT_OK_AND_ASSIGN(auto c1, Codec::Create(Compression::ZSTD, options));
+  ASSERT_OK_AND_ASSIGN(auto c2, Codec::Create(Compression::ZSTD));
+
+  const int data_size = 5 * 1024 * 1024 + 1234;
+  CheckCodecRoundtrip(c1, c2, MakeRandomData(data_size), /*check_reverse=*/false);
+  CheckCodecRoundtrip(c1, c2, MakeCompressibleData(data_size), /*check_reverse=*/false);
+}
+#endif
+
 }  // namespace util
 }  // namespace arrow
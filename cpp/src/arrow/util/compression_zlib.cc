@@ -173,6 +173,35 @@ class GZipDecompressor : public Decompressor {
 
   bool IsFinished() override { return finished_; }
 
+  Result<int64_t> FrameCompressedSize(int64_t input_len, const uint8_t* input) override {
+    // Only BGZF members, which record their size in a "BC" extra subfield, can be
+    // found without inflating them
+    if (format_ != GZipFormat::GZIP) {
+      return Decompressor::FrameCompressedSize(input_len, input);
+    }
+    constexpr uint8_t kExtraFieldFlag = 0x04;
+    if (input_len < 12) {
+      return 0;
+    }
+    if (input[0] != 0x1f || input[1] != 0x8b || (input[3] & kExtraFieldFlag) == 0) {
+      return Status::NotImplemented("Splitting gzip members other than BGZF blocks");
+    }
+    const int64_t extra_len = input[10] | (input[11] << 8);
+    if (input_len < 12 + extra_len) {
+      return 0;
+    }
+    for (int64_t pos = 12; pos + 4 <= 12 + extra_len;) {
+      const int64_t subfield_len = input[pos + 2] | (input[pos + 3] << 8);
+      if (input[pos] == 'B' && input[pos + 1] == 'C' && subfield_len == 2 &&
+          pos + 6 <= 12 + extra_len) {
+        const int64_t block_size = (input[pos + 4] | (input[pos + 5] << 8)) + 1;
+        return block_size <= input_len ? block_size : 0;
+      }
+      pos += 4 + subfield_len;
+    }
+    return Status::NotImplemented("Splitting gzip members other than BGZF blocks");
+  }
+
  protected:
   Status ZlibError(const char* prefix_msg) {
     return ZlibErrorPrefix(prefix_msg, stream_.msg);
@@ -17,14 +17,19 @@
 
 #include "arrow/util/compression_internal.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include <zdict.h>
 #include <zstd.h>
+#include <zstd_errors.h>
 
+#include "arrow/buffer.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/logging_internal.h"
@@ -40,6 +45,8 @@ namespace {
 
 using CCtxPtr = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>;
 using DCtxPtr = std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)>;
+using CDictPtr = std::unique_ptr<ZSTD_CDict, decltype(&ZSTD_freeCDict)>;
+using DDictPtr = std::unique_ptr<ZSTD_DDict, decltype(&ZSTD_freeDDict)>;
 
 Status ZSTDError(size_t ret, const char* prefix_msg) {
   return Status::IOError(prefix_msg, ZSTD_getErrorName(ret));
@@ -86,6 +93,18 @@ class ZSTDDecompressor : public Decompressor {
 
   bool IsFinished() override { return finished_; }
 
+  Result<int64_t> FrameCompressedSize(int64_t input_len, const uint8_t* input) override {
+    const size_t ret =
+        ZSTD_findFrameCompressedSize(input, static_cast<size_t>(input_len));
+    if (ZSTD_isError(ret)) {
+      if (ZSTD_getErrorCode(ret) == ZSTD_error_srcSize_wrong) {
+        return 0;
+      }
+      return ZSTDError(ret, "ZSTD frame size failed: ");
+    }
+    return static_cast<int64_t>(ret);
+  }
+
  private:
   DCtxPtr stream_;
   bool finished_{false};
@@ -160,12 +179,32 @@ class ZSTDCodec : public Codec {
  public:
   explicit ZSTDCodec(int compression_level,
                      std::vector<std::pair<int, int>> compression_context_params,
-                     std::vector<std::pair<int, int>> decompression_context_params)
+                     std::vector<std::pair<int, int>> decompression_context_params,
+                     std::shared_ptr<Buffer> dictionary, int num_workers)
       : compression_level_(compression_level == kUseDefaultCompressionLevel
                                ? kZSTDDefaultCompressionLevel
                                : compression_level),
         compression_context_params_(std::move(compression_context_params)),
-        decompression_context_params_(std::move(decompression_context_params)) {}
+        decompression_context_params_(std::move(decompression_context_params)),
+        dictionary_(std::move(dictionary)),
+        num_workers_(num_workers) {}
+
+  Status Init() override {
+    if (dictionary_ == nullptr) {
+      return Status::OK();
+    }
+    // The digested dictionaries are read-only, and shared by the contexts of all the
+    // calls to this codec
+    cdict_.reset(ZSTD_createCDict(dictionary_->data(),
+                                  static_cast<size_t>(dictionary_->size()),
+                                  compression_level_));
+    ddict_.reset(ZSTD_createDDict(dictionary_->data(),
+                                  static_cast<size_t>(dictionary_->size())));
+    if (cdict_ == nullptr || ddict_ == nullptr) {
+      return Status::Invalid("Invalid ZSTD dictionary");
+    }
+    return Status::OK();
+  }
 
   Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
                              int64_t output_buffer_len, uint8_t* output_buffer) override {
@@ -242,6 +281,24 @@ class ZSTDCodec : public Codec {
         return ZSTDError(ret, "ZSTD_CCtx create failed: ");
       }
     }
+    if (num_workers_ > 0) {
+      // The upper bound is 0 when the library was built without multithreading
+      const ZSTD_bounds bounds = ZSTD_cParam_getBounds(ZSTD_c_nbWorkers);
+      const int num_workers =
+          ZSTD_isError(bounds.error) ? 0 : std::min(num_workers_, bounds.upperBound);
+      if (num_workers > 0) {
+        ret = ZSTD_CCtx_setParameter(cctx.get(), ZSTD_c_nbWorkers, num_workers);
+        if (ZSTD_isError(ret)) {
+          return ZSTDError(ret, "ZSTD_CCtx create failed: ");
+        }
+      }
+    }
+    if (cdict_ != nullptr) {
+      ret = ZSTD_CCtx_refCDict(cctx.get(), cdict_.get());
+      if (ZSTD_isError(ret)) {
+        return ZSTDError(ret, "ZSTD_CCtx create failed: ");
+      }
+    }
     return cctx;
   }
 
@@ -257,22 +314,68 @@ class ZSTDCodec : public Codec {
         return ZSTDError(ret, "ZSTD_DCtx create failed: ");
       }
     }
+    if (ddict_ != nullptr) {
+      auto ret = ZSTD_DCtx_refDDict(dctx.get(), ddict_.get());
+      if (ZSTD_isError(ret)) {
+        return ZSTDError(ret, "ZSTD_DCtx create failed: ");
+      }
+    }
     return dctx;
   }
 
   const int compression_level_;
   const std::vector<std::pair<int, int>> compression_context_params_;
   const std::vector<std::pair<int, int>> decompression_context_params_;
+  const std::shared_ptr<Buffer> dictionary_;
+  const int num_workers_;
+  CDictPtr cdict_{nullptr, ZSTD_freeCDict};
+  DDictPtr ddict_{nullptr, ZSTD_freeDDict};
 };
 
 }  // namespace
 
 std::unique_ptr<Codec> MakeZSTDCodec(
     int compression_level, std::vector<std::pair<int, int>> compression_context_params,
-    std::vector<std::pair<int, int>> decompression_context_params) {
-  return std::make_unique<ZSTDCodec>(compression_level,
-                                     std::move(compression_context_params),
-                                     std::move(decompression_context_params));
+    std::vector<std::pair<int, int>> decompression_context_params,
+    std::shared_ptr<Buffer> dictionary, int num_workers) {
+  return std::make_unique<ZSTDCodec>(
+      compression_level, std::move(compression_context_params),
+      std::move(decompression_context_params), std::move(dictionary), num_workers);
+}
+
+Result<std::shared_ptr<Buffer>> TrainZSTDDictionary(
+    const std::vector<std::shared_ptr<Buffer>>& samples, int64_t max_dictionary_size) {
+  if (max_dictionary_size <= 0) {
+    return Status::Invalid("ZSTD dictionary size must be positive");
+  }
+  // ZDICT takes the samples concatenated
+  std::vector<size_t> sample_sizes;
+  int64_t total_size = 0;
+  for (const auto& sample : samples) {
+    if (sample != nullptr && sample->size() > 0) {
+      sample_sizes.push_back(static_cast<size_t>(sample->size()));
+      total_size += sample->size();
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(auto concatenated, AllocateBuffer(total_size));
+  uint8_t* out = concatenated->mutable_data();
+  for (const auto& sample : samples) {
+    if (sample != nullptr && sample->size() > 0) {
+      std::memcpy(out, sample->data(), static_cast<size_t>(sample->size()));
+      out += sample->size();
+    }
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto dictionary, AllocateResizableBuffer(max_dictionary_size));
+  const size_t ret = ZDICT_trainFromBuffer(
+      dictionary->mutable_data(), static_cast<size_t>(max_dictionary_size),
+      concatenated->data(), sample_sizes.data(),
+      static_cast<unsigned>(sample_sizes.size()));
+  if (ZDICT_isError(ret)) {
+    return Status::Invalid("ZSTD dictionary training failed: ", ZDICT_getErrorName(ret));
+  }
+  RETURN_NOT_OK(dictionary->Resize(static_cast<int64_t>(ret)));
+  return std::shared_ptr<Buffer>(std::move(dictionary));
 }
 
 }  // namespace internal
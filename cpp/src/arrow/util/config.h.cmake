@@ -33,6 +33,7 @@
 #define ARROW_PACKAGE_KIND "@ARROW_PACKAGE_KIND@"
 
 #cmakedefine ARROW_COMPUTE
+#cmakedefine ARROW_COROUTINES
 #cmakedefine ARROW_CSV
 #cmakedefine ARROW_CUDA
 #cmakedefine ARROW_DATASET
@@ -61,7 +62,9 @@
 #cmakedefine ARROW_WITH_MUSL
 #cmakedefine ARROW_WITH_OPENTELEMETRY
 #cmakedefine ARROW_WITH_RE2
+#cmakedefine ARROW_WITH_SIMDJSON
 #cmakedefine ARROW_WITH_SNAPPY
+#cmakedefine ARROW_WITH_UCX
 #cmakedefine ARROW_WITH_UTF8PROC
 #cmakedefine ARROW_WITH_ZLIB
 #cmakedefine ARROW_WITH_ZSTD
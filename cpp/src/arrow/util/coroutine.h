@@ -0,0 +1,295 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+// C++20 coroutine support for Future and AsyncGenerator.
+//
+// Only available when Arrow is built with ARROW_COROUTINES=ON.
+//
+// - A coroutine returning Future<T> runs eagerly until its first suspension, and
+//   finishes the returned future with the value or Status it co_returns.
+//   A coroutine returning Future<> must `co_return Status`.
+// - `co_await future` suspends until `future` finishes and yields its
+//   Result<T> (or Status for Future<>).  The coroutine is resumed by the thread
+//   finishing the future, unless awaited through AwaitOn().
+// - `co_await TransferTo(executor)` resumes the coroutine on `executor`.
+// - A coroutine returning CoroutineGenerator<T> produces the items of an
+//   AsyncGenerator<T> with `co_yield`, and ends it with `co_return Status`.
+//
+// Since coroutines cannot use ARROW_RETURN_NOT_OK and ARROW_ASSIGN_OR_RAISE,
+// ARROW_CO_RETURN_NOT_OK and ARROW_CO_ASSIGN_OR_RAISE are provided instead:
+//
+//   Future<int64_t> CountRows(AsyncGenerator<std::shared_ptr<RecordBatch>> gen) {
+//     int64_t num_rows = 0;
+//     while (true) {
+//       ARROW_CO_ASSIGN_OR_RAISE(auto batch, co_await gen());
+//       if (IsIterationEnd(batch)) co_return num_rows;
+//       num_rows += batch->num_rows();
+//     }
+//   }
+
+#include "arrow/util/config.h"
+
+#ifdef ARROW_COROUTINES
+
+#  include <coroutine>
+#  include <memory>
+#  include <type_traits>
+#  include <utility>
+
+#  include "arrow/result.h"
+#  include "arrow/status.h"
+#  include "arrow/util/async_generator_fwd.h"
+#  include "arrow/util/future.h"
+#  include "arrow/util/iterator.h"
+#  include "arrow/util/logging.h"
+#  include "arrow/util/macros.h"
+#  include "arrow/util/thread_pool.h"
+
+#  define ARROW_CO_RETURN_NOT_OK(status)               \
+    do {                                               \
+      ::arrow::Status __s = ::arrow::ToStatus(status); \
+      if (ARROW_PREDICT_FALSE(!__s.ok())) {            \
+        co_return __s;                                 \
+      }                                                \
+    } while (false)
+
+#  define ARROW_CO_ASSIGN_OR_RAISE_IMPL(result_name, lhs, rexpr) \
+    auto&& result_name = (rexpr);                                \
+    if (ARROW_PREDICT_FALSE(!(result_name).ok())) {              \
+      co_return (result_name).status();                          \
+    }                                                            \
+    lhs = std::move(result_name).ValueUnsafe();
+
+#  define ARROW_CO_ASSIGN_OR_RAISE(lhs, rexpr)                                       \
+    ARROW_CO_ASSIGN_OR_RAISE_IMPL(                                                  \
+        ARROW_ASSIGN_OR_RAISE_NAME(_error_or_value, __COUNTER__), lhs, rexpr);
+
+namespace arrow {
+
+namespace detail {
+
+inline Status UnhandledCoroutineException() {
+  return Status::UnknownError("Unhandled exception in coroutine");
+}
+
+/// The promise of a coroutine returning Future<T>
+template <typename T>
+struct FuturePromise {
+  Future<T> get_return_object() { return future; }
+
+  std::suspend_never initial_suspend() noexcept { return {}; }
+  std::suspend_never final_suspend() noexcept { return {}; }
+
+  void return_value(typename Future<T>::SyncType result) {
+    future.MarkFinished(std::move(result));
+  }
+
+  void unhandled_exception() { future.MarkFinished(UnhandledCoroutineException()); }
+
+  Future<T> future = Future<T>::Make();
+};
+
+}  // namespace detail
+
+/// \brief Awaiter suspending a coroutine until a Future finishes
+template <typename T>
+class FutureAwaiter {
+ public:
+  using SyncType = typename Future<T>::SyncType;
+
+  explicit FutureAwaiter(Future<T> future, internal::Executor* executor = NULLPTR)
+      : future_(std::move(future)), executor_(executor) {}
+
+  bool await_ready() const {
+    return future_.is_finished() &&
+           (executor_ == NULLPTR || executor_->IsCurrentExecutor());
+  }
+
+  bool await_suspend(std::coroutine_handle<> handle) {
+    // The coroutine, and this awaiter with it, may be resumed and destroyed by
+    // another thread as soon as the callback is added: only use locals from there.
+    Future<T> future = future_;
+    internal::Executor* executor = executor_;
+    CallbackOptions options;
+    if (executor != NULLPTR) {
+      options.should_schedule = ShouldSchedule::IfDifferentExecutor;
+      options.executor = executor;
+    }
+    if (future.TryAddCallback(
+            [handle] { return [handle](const Result<T>&) { handle.resume(); }; },
+            options)) {
+      return true;
+    }
+    // Already finished, but we need to move to the executor
+    return executor != NULLPTR && executor->Spawn([handle] { handle.resume(); }).ok();
+  }
+
+  SyncType await_resume() {
+    if constexpr (Future<T>::is_empty) {
+      return future_.status();
+    } else {
+      return future_.result();
+    }
+  }
+
+ private:
+  Future<T> future_;
+  internal::Executor* executor_;
+};
+
+template <typename T>
+FutureAwaiter<T> operator co_await(Future<T> future) {
+  return FutureAwaiter<T>(std::move(future));
+}
+
+/// \brief Await `future`, resuming the coroutine on `executor`
+template <typename T>
+FutureAwaiter<T> AwaitOn(Future<T> future, internal::Executor* executor) {
+  return FutureAwaiter<T>(std::move(future), executor);
+}
+
+/// \brief Awaiter resuming a coroutine on an executor
+///
+/// `co_await TransferTo(executor)` yields the Status of spawning the
+/// continuation; the coroutine keeps running on the current thread on error.
+class TransferAwaiter {
+ public:
+  explicit TransferAwaiter(internal::Executor* executor) : executor_(executor) {}
+
+  bool await_ready() const { return executor_->IsCurrentExecutor(); }
+
+  bool await_suspend(std::coroutine_handle<> handle) {
+    Status st = executor_->Spawn([handle] { handle.resume(); });
+    if (ARROW_PREDICT_TRUE(st.ok())) {
+      // Don't touch `this`, the coroutine may already be running elsewhere
+      return true;
+    }
+    status_ = std::move(st);
+    return false;
+  }
+
+  Status await_resume() { return std::move(status_); }
+
+ private:
+  internal::Executor* executor_;
+  Status status_;
+};
+
+inline TransferAwaiter TransferTo(internal::Executor* executor) {
+  return TransferAwaiter(executor);
+}
+
+/// \brief An AsyncGenerator<T> implemented by a coroutine
+///
+/// The coroutine starts running on the first call of the generator and runs
+/// until its first `co_yield`, which finishes the future returned by that call.
+/// Each further call resumes it until the next `co_yield`.  `co_return
+/// Status::OK()` ends the generator; `co_return` of an error fails the pending
+/// call, after which the generator is ended.
+///
+/// Like most generators, this generator is not reentrant: a call must not be
+/// made before the future of the previous call has finished.  The coroutine is
+/// kept alive while it runs, even if the generator itself is destroyed.
+template <typename T>
+class CoroutineGenerator {
+ public:
+  struct promise_type;
+  using Handle = std::coroutine_handle<promise_type>;
+
+  Future<T> operator()() const {
+    Handle handle = state_->handle;
+    if (handle.done()) {
+      return Future<T>::MakeFinished(IterationTraits<T>::End());
+    }
+    promise_type& promise = handle.promise();
+    ARROW_DCHECK(!promise.pending.is_valid()) << "CoroutineGenerator is not reentrant";
+    auto future = Future<T>::Make();
+    promise.pending = future;
+    promise.keep_alive = state_;
+    handle.resume();
+    return future;
+  }
+
+ private:
+  struct State {
+    explicit State(Handle handle) : handle(handle) {}
+    ~State() { handle.destroy(); }
+
+    Handle handle;
+  };
+
+  // Finishes the pending call once the coroutine is suspended, so that the
+  // consumer may resume it from the future's callbacks.
+  struct YieldAwaiter {
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(Handle handle) noexcept {
+      promise_type& promise = handle.promise();
+      // May release the last reference to the coroutine frame: use locals only
+      std::shared_ptr<State> keep_alive = std::move(promise.keep_alive);
+      Future<T> pending = std::move(promise.pending);
+      pending.MarkFinished(std::move(result));
+    }
+
+    void await_resume() const noexcept {}
+
+    Result<T> result;
+  };
+
+ public:
+  struct promise_type {
+    CoroutineGenerator get_return_object() {
+      return CoroutineGenerator(std::make_shared<State>(Handle::from_promise(*this)));
+    }
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    YieldAwaiter final_suspend() noexcept {
+      if (status.ok()) {
+        return YieldAwaiter{IterationTraits<T>::End()};
+      }
+      return YieldAwaiter{std::move(status)};
+    }
+
+    YieldAwaiter yield_value(T value) { return YieldAwaiter{std::move(value)}; }
+
+    void return_value(Status st) { status = std::move(st); }
+
+    void unhandled_exception() { status = detail::UnhandledCoroutineException(); }
+
+    // The future returned by the call being served
+    Future<T> pending;
+    std::shared_ptr<State> keep_alive;
+    Status status;
+  };
+
+ private:
+  explicit CoroutineGenerator(std::shared_ptr<State> state) : state_(std::move(state)) {}
+
+  std::shared_ptr<State> state_;
+};
+
+}  // namespace arrow
+
+template <typename T, typename... Args>
+struct std::coroutine_traits<arrow::Future<T>, Args...> {
+  using promise_type = arrow::detail::FuturePromise<T>;
+};
+
+#endif  // ARROW_COROUTINES
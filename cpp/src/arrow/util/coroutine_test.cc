@@ -0,0 +1,171 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/coroutine.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "arrow/testing/future_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/config.h"
+#include "arrow/util/test_common.h"
+#include "arrow/util/thread_pool.h"
+
+#ifdef ARROW_COROUTINES
+
+namespace arrow {
+
+namespace {
+
+Future<int> AddOne(Future<int> input) {
+  ARROW_CO_ASSIGN_OR_RAISE(int value, co_await input);
+  co_return value + 1;
+}
+
+Future<> CheckPositive(Future<int> input) {
+  ARROW_CO_ASSIGN_OR_RAISE(int value, co_await input);
+  if (value <= 0) {
+    co_return Status::Invalid("not positive: ", value);
+  }
+  co_return Status::OK();
+}
+
+CoroutineGenerator<TestInt> Range(Future<> start, int stop) {
+  ARROW_CO_RETURN_NOT_OK(co_await start);
+  for (int i = 0; i < stop; ++i) {
+    co_yield TestInt(i);
+  }
+  co_return Status::OK();
+}
+
+CoroutineGenerator<TestInt> FailAfter(int num_items) {
+  for (int i = 0; i < num_items; ++i) {
+    co_yield TestInt(i);
+  }
+  co_return Status::IOError("failed after ", num_items);
+}
+
+Future<int64_t> Sum(AsyncGenerator<TestInt> gen) {
+  int64_t sum = 0;
+  while (true) {
+    ARROW_CO_ASSIGN_OR_RAISE(TestInt item, co_await gen());
+    if (IsIterationEnd(item)) {
+      co_return sum;
+    }
+    sum += item.value;
+  }
+}
+
+}  // namespace
+
+TEST(Coroutine, AwaitFuture) {
+  auto input = Future<int>::Make();
+  auto output = AddOne(input);
+  ASSERT_FALSE(output.is_finished());
+  input.MarkFinished(41);
+  ASSERT_FINISHES_OK_AND_EQ(42, output);
+
+  // Already finished futures don't suspend
+  ASSERT_FINISHES_OK_AND_EQ(2, AddOne(Future<int>::MakeFinished(1)));
+}
+
+TEST(Coroutine, Errors) {
+  auto input = Future<int>::Make();
+  auto output = AddOne(input);
+  input.MarkFinished(Status::IOError("boom"));
+  ASSERT_FINISHES_AND_RAISES(IOError, output);
+
+  ASSERT_FINISHES_OK(CheckPositive(Future<int>::MakeFinished(1)));
+  ASSERT_FINISHES_AND_RAISES(Invalid, CheckPositive(Future<int>::MakeFinished(0)));
+}
+
+TEST(Coroutine, AwaitOnExecutor) {
+  ASSERT_OK_AND_ASSIGN(auto pool, internal::ThreadPool::Make(1));
+  auto on_pool = [](Future<> input,
+                    internal::Executor* executor) -> Future<bool> {
+    ARROW_CO_RETURN_NOT_OK(co_await AwaitOn(std::move(input), executor));
+    co_return executor->IsCurrentExecutor();
+  };
+  auto input = Future<>::Make();
+  auto output = on_pool(input, pool.get());
+  input.MarkFinished();
+  ASSERT_FINISHES_OK_AND_EQ(true, output);
+
+  // Also moves to the executor if the future is already finished
+  ASSERT_FINISHES_OK_AND_EQ(true, on_pool(Future<>::MakeFinished(), pool.get()));
+}
+
+TEST(Coroutine, TransferTo) {
+  ASSERT_OK_AND_ASSIGN(auto pool, internal::ThreadPool::Make(1));
+  auto transfer = [](internal::Executor* executor) -> Future<bool> {
+    ARROW_CO_RETURN_NOT_OK(co_await TransferTo(executor));
+    co_return executor->IsCurrentExecutor();
+  };
+  ASSERT_FALSE(pool->IsCurrentExecutor());
+  ASSERT_FINISHES_OK_AND_EQ(true, transfer(pool.get()));
+}
+
+TEST(CoroutineGenerator, Basics) {
+  AsyncGenerator<TestInt> gen = Range(Future<>::MakeFinished(), 4);
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto values, CollectAsyncGenerator(gen));
+  ASSERT_EQ(values, std::vector<TestInt>({0, 1, 2, 3}));
+  // Stays ended
+  ASSERT_FINISHES_OK_AND_EQ(IterationEnd<TestInt>(), gen());
+}
+
+TEST(CoroutineGenerator, Suspended) {
+  auto start = Future<>::Make();
+  AsyncGenerator<TestInt> gen = Range(start, 100);
+  auto sum = Sum(gen);
+  ASSERT_FALSE(sum.is_finished());
+  start.MarkFinished();
+  ASSERT_FINISHES_OK_AND_EQ(4950, sum);
+}
+
+TEST(CoroutineGenerator, Errors) {
+  AsyncGenerator<TestInt> gen = FailAfter(2);
+  ASSERT_FINISHES_OK_AND_EQ(TestInt(0), gen());
+  ASSERT_FINISHES_OK_AND_EQ(TestInt(1), gen());
+  ASSERT_FINISHES_AND_RAISES(IOError, gen());
+  ASSERT_FINISHES_OK_AND_EQ(IterationEnd<TestInt>(), gen());
+
+  auto start = Future<>::Make();
+  AsyncGenerator<TestInt> failed_start = Range(start, 1);
+  auto first = failed_start();
+  start.MarkFinished(Status::Cancelled("cancelled"));
+  ASSERT_FINISHES_AND_RAISES(Cancelled, first);
+}
+
+TEST(CoroutineGenerator, OutlivedByCoroutine) {
+  // The generator may be dropped while its coroutine is suspended
+  auto start = Future<>::Make();
+  Future<TestInt> first;
+  {
+    AsyncGenerator<TestInt> gen = Range(start, 10);
+    first = gen();
+  }
+  start.MarkFinished();
+  ASSERT_FINISHES_OK_AND_EQ(TestInt(0), first);
+}
+
+}  // namespace arrow
+
+#endif  // ARROW_COROUTINES
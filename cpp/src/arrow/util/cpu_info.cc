@@ -190,6 +190,7 @@ void OsRetrieveCpuInfo(int64_t* hardware_flags, CpuInfo::Vendor* vendor,
     zmm_enabled = (xcr0 & 0xE0) == 0xE0;
   }
 
+  if (features_ECX[1]) *hardware_flags |= CpuInfo::PCLMULQDQ;
   if (features_ECX[9]) *hardware_flags |= CpuInfo::SSSE3;
   if (features_ECX[19]) *hardware_flags |= CpuInfo::SSE4_1;
   if (features_ECX[20]) *hardware_flags |= CpuInfo::SSE4_2;
@@ -201,10 +202,12 @@ void OsRetrieveCpuInfo(int64_t* hardware_flags, CpuInfo::Vendor* vendor,
   if (highest_valid_id > register_EAX_id) {
     __cpuidex(cpu_info.data(), register_EAX_id, 0);
     std::bitset<32> features_EBX = cpu_info[1];
+    std::bitset<32> features_ECX7 = cpu_info[2];
 
     if (features_EBX[3]) *hardware_flags |= CpuInfo::BMI1;
     if (features_EBX[5]) *hardware_flags |= CpuInfo::AVX2;
     if (features_EBX[8]) *hardware_flags |= CpuInfo::BMI2;
+    if (features_ECX7[10]) *hardware_flags |= CpuInfo::VPCLMULQDQ;
     // ARROW-11427: only use AVX512 if enabled by the OS
     if (zmm_enabled) {
       if (features_EBX[16]) *hardware_flags |= CpuInfo::AVX512F;
@@ -212,6 +215,7 @@ void OsRetrieveCpuInfo(int64_t* hardware_flags, CpuInfo::Vendor* vendor,
       if (features_EBX[28]) *hardware_flags |= CpuInfo::AVX512CD;
       if (features_EBX[30]) *hardware_flags |= CpuInfo::AVX512BW;
       if (features_EBX[31]) *hardware_flags |= CpuInfo::AVX512VL;
+      if (features_ECX7[14]) *hardware_flags |= CpuInfo::AVX512VPOPCNTDQ;
     }
   }
 }
@@ -357,7 +361,9 @@ int64_t LinuxParseCpuFlags(const std::string& values) {
       {"avx512f", CpuInfo::AVX512F},   {"avx512cd", CpuInfo::AVX512CD},
       {"avx512vl", CpuInfo::AVX512VL}, {"avx512dq", CpuInfo::AVX512DQ},
       {"avx512bw", CpuInfo::AVX512BW}, {"bmi1", CpuInfo::BMI1},
-      {"bmi2", CpuInfo::BMI2},
+      {"bmi2", CpuInfo::BMI2},         {"pclmulqdq", CpuInfo::PCLMULQDQ},
+      {"vpclmulqdq", CpuInfo::VPCLMULQDQ},
+      {"avx512_vpopcntdq", CpuInfo::AVX512VPOPCNTDQ},
 #    elif defined(CPUINFO_ARCH_ARM)
       {"asimd", CpuInfo::ASIMD},
 #    endif
@@ -53,6 +53,9 @@ class ARROW_EXPORT CpuInfo {
   static constexpr int64_t AVX512 = AVX512F | AVX512CD | AVX512VL | AVX512DQ | AVX512BW;
   static constexpr int64_t BMI1 = (1LL << 11);
   static constexpr int64_t BMI2 = (1LL << 12);
+  static constexpr int64_t PCLMULQDQ = (1LL << 13);
+  static constexpr int64_t VPCLMULQDQ = (1LL << 14);
+  static constexpr int64_t AVX512VPOPCNTDQ = (1LL << 15);
 
   /// Arm features
   static constexpr int64_t ASIMD = (1LL << 32);
@@ -89,9 +89,16 @@
 #include "arrow/util/crc32.h"
 
 #include <cstdint>
+#include <cstring>
 
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/crc32_internal.h"
 #include "arrow/util/endian.h"
 
+#if defined(__ARM_FEATURE_CRC32)
+#  include <arm_acle.h>
+#endif
+
 namespace arrow {
 namespace internal {
 
@@ -857,7 +864,7 @@ static const uint32_t crc32_lookup[16][256] = {
     }};
 
 /* compute CRC32 */
-uint32_t crc32(uint32_t prev, const void* data, size_t length) {
+static uint32_t crc32_scalar(uint32_t prev, const void* data, size_t length) {
   uint32_t crc = ~prev;
   unsigned unaligned;
   const uint8_t* current_char;
@@ -962,5 +969,50 @@ uint32_t crc32(uint32_t prev, const void* data, size_t length) {
   return ~crc;
 }
 
+#if defined(__ARM_FEATURE_CRC32) && ARROW_LITTLE_ENDIAN
+// The ARMv8 CRC32 instructions use the zlib polynomial
+static uint32_t crc32_arm(uint32_t prev, const uint8_t* data, size_t length) {
+  uint32_t crc = ~prev;
+  for (; length >= 8; data += 8, length -= 8) {
+    uint64_t word;
+    std::memcpy(&word, data, sizeof(word));
+    crc = __crc32d(crc, word);
+  }
+  for (; length > 0; ++data, --length) {
+    crc = __crc32b(crc, *data);
+  }
+  return ~crc;
+}
+#endif
+
+uint32_t crc32(uint32_t prev, const void* data, size_t length) {
+#if defined(__ARM_FEATURE_CRC32) && ARROW_LITTLE_ENDIAN
+  return crc32_arm(prev, static_cast<const uint8_t*>(data), length);
+#else
+  auto bytes = static_cast<const uint8_t*>(data);
+#  if defined(ARROW_HAVE_RUNTIME_AVX512)
+  static const bool use_vpclmul = CpuInfo::GetInstance()->IsSupported(
+      CpuInfo::AVX512 | CpuInfo::PCLMULQDQ | CpuInfo::VPCLMULQDQ);
+  if (use_vpclmul && length >= 256) {
+    const size_t simd_length = length & ~static_cast<size_t>(63);
+    prev = crc32_vpclmul(prev, bytes, simd_length);
+    bytes += simd_length;
+    length -= simd_length;
+  }
+#  endif
+#  if defined(ARROW_HAVE_RUNTIME_AVX2)
+  static const bool use_pclmul =
+      CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX2 | CpuInfo::PCLMULQDQ);
+  if (use_pclmul && length >= 64) {
+    const size_t simd_length = length & ~static_cast<size_t>(15);
+    prev = crc32_pclmul(prev, bytes, simd_length);
+    bytes += simd_length;
+    length -= simd_length;
+  }
+#  endif
+  return crc32_scalar(prev, bytes, length);
+#endif
+}
+
 }  // namespace internal
 }  // namespace arrow
@@ -0,0 +1,98 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/crc32_internal.h"
+#include "arrow/util/simd.h"
+
+namespace arrow::internal {
+
+// Folding of 128-bit blocks with carry-less multiplication, as described in
+// "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction"
+// (Intel, 2009).  Each constant is x^n mod P(x) for the zlib polynomial,
+// bit-reflected and shifted left by one.
+
+namespace {
+
+// x^(512 + 32), x^(512 - 32): fold by 64 bytes
+constexpr int64_t kFold512Lo = 0x0154442bd4;
+constexpr int64_t kFold512Hi = 0x01c6e41596;
+// x^(128 + 32), x^(128 - 32): fold by 16 bytes
+constexpr int64_t kFold128Lo = 0x01751997d0;
+constexpr int64_t kFold128Hi = 0x00ccaa009e;
+// x^64
+constexpr int64_t kFold64 = 0x0163cd6124;
+// Barrett reduction: floor(x^64 / P(x)) and P(x), bit-reflected
+constexpr int64_t kBarrettMu = 0x01f7011641;
+constexpr int64_t kPolynomial = 0x01db710641;
+
+inline __m128i Fold(__m128i value, __m128i constants) {
+  return _mm_xor_si128(_mm_clmulepi64_si128(value, constants, 0x00),
+                       _mm_clmulepi64_si128(value, constants, 0x11));
+}
+
+inline __m128i Load(const uint8_t* data) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+}
+
+}  // namespace
+
+uint32_t crc32_pclmul(uint32_t prev, const uint8_t* data, size_t length) {
+  __m128i x1 = _mm_xor_si128(Load(data), _mm_cvtsi32_si128(static_cast<int>(~prev)));
+  __m128i x2 = Load(data + 16);
+  __m128i x3 = Load(data + 32);
+  __m128i x4 = Load(data + 48);
+  data += 64;
+  length -= 64;
+
+  // Fold four independent streams of 16-byte blocks
+  __m128i k = _mm_set_epi64x(kFold512Hi, kFold512Lo);
+  while (length >= 64) {
+    x1 = _mm_xor_si128(Fold(x1, k), Load(data));
+    x2 = _mm_xor_si128(Fold(x2, k), Load(data + 16));
+    x3 = _mm_xor_si128(Fold(x3, k), Load(data + 32));
+    x4 = _mm_xor_si128(Fold(x4, k), Load(data + 48));
+    data += 64;
+    length -= 64;
+  }
+
+  // Fold them into a single block
+  k = _mm_set_epi64x(kFold128Hi, kFold128Lo);
+  x1 = _mm_xor_si128(Fold(x1, k), x2);
+  x1 = _mm_xor_si128(Fold(x1, k), x3);
+  x1 = _mm_xor_si128(Fold(x1, k), x4);
+  while (length >= 16) {
+    x1 = _mm_xor_si128(Fold(x1, k), Load(data));
+    data += 16;
+    length -= 16;
+  }
+
+  // Reduce 128 bits to 64 bits
+  const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+  x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, k, 0x10), _mm_srli_si128(x1, 8));
+  x2 = _mm_srli_si128(x1, 4);
+  x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), _mm_cvtsi64_si128(kFold64), 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+
+  // Barrett reduction to 32 bits
+  k = _mm_set_epi64x(kBarrettMu, kPolynomial);
+  x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k, 0x10);
+  x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask32), k, 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+  return ~static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+}
+
+}  // namespace arrow::internal
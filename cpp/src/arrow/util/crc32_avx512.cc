@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/crc32_internal.h"
+#include "arrow/util/simd.h"
+
+namespace arrow::internal {
+
+// Same folding as crc32_pclmul, with each 128-bit lane of a 512-bit register
+// folding its own stream of 16-byte blocks.
+
+namespace {
+
+// x^(2048 + 32), x^(2048 - 32): fold by 256 bytes
+constexpr int64_t kFold2048Lo = 0x011542778a;
+constexpr int64_t kFold2048Hi = 0x01322d1430;
+// x^(512 + 32), x^(512 - 32): fold by 64 bytes
+constexpr int64_t kFold512Lo = 0x0154442bd4;
+constexpr int64_t kFold512Hi = 0x01c6e41596;
+// x^(128 + 32), x^(128 - 32): fold by 16 bytes
+constexpr int64_t kFold128Lo = 0x01751997d0;
+constexpr int64_t kFold128Hi = 0x00ccaa009e;
+// x^64
+constexpr int64_t kFold64 = 0x0163cd6124;
+// Barrett reduction: floor(x^64 / P(x)) and P(x), bit-reflected
+constexpr int64_t kBarrettMu = 0x01f7011641;
+constexpr int64_t kPolynomial = 0x01db710641;
+
+// Fold `value` and xor it with `data`
+inline __m512i Fold(__m512i value, __m512i constants, __m512i data) {
+  return _mm512_ternarylogic_epi64(_mm512_clmulepi64_epi128(value, constants, 0x00),
+                                   _mm512_clmulepi64_epi128(value, constants, 0x11),
+                                   data, 0x96);
+}
+
+inline __m128i Fold(__m128i value, __m128i constants) {
+  return _mm_xor_si128(_mm_clmulepi64_si128(value, constants, 0x00),
+                       _mm_clmulepi64_si128(value, constants, 0x11));
+}
+
+inline __m512i Broadcast(int64_t hi, int64_t lo) {
+  return _mm512_broadcast_i32x4(_mm_set_epi64x(hi, lo));
+}
+
+}  // namespace
+
+uint32_t crc32_vpclmul(uint32_t prev, const uint8_t* data, size_t length) {
+  const __m128i initial = _mm_cvtsi32_si128(static_cast<int>(~prev));
+  __m512i z0 =
+      _mm512_xor_si512(_mm512_loadu_si512(data), _mm512_zextsi128_si512(initial));
+  __m512i z1 = _mm512_loadu_si512(data + 64);
+  __m512i z2 = _mm512_loadu_si512(data + 128);
+  __m512i z3 = _mm512_loadu_si512(data + 192);
+  data += 256;
+  length -= 256;
+
+  __m512i k = Broadcast(kFold2048Hi, kFold2048Lo);
+  while (length >= 256) {
+    z0 = Fold(z0, k, _mm512_loadu_si512(data));
+    z1 = Fold(z1, k, _mm512_loadu_si512(data + 64));
+    z2 = Fold(z2, k, _mm512_loadu_si512(data + 128));
+    z3 = Fold(z3, k, _mm512_loadu_si512(data + 192));
+    data += 256;
+    length -= 256;
+  }
+
+  k = Broadcast(kFold512Hi, kFold512Lo);
+  z0 = Fold(z0, k, z1);
+  z0 = Fold(z0, k, z2);
+  z0 = Fold(z0, k, z3);
+  while (length >= 64) {
+    z0 = Fold(z0, k, _mm512_loadu_si512(data));
+    data += 64;
+    length -= 64;
+  }
+
+  // Fold the lanes into a single block
+  __m128i k128 = _mm_set_epi64x(kFold128Hi, kFold128Lo);
+  __m128i x1 = _mm512_castsi512_si128(z0);
+  x1 = _mm_xor_si128(Fold(x1, k128), _mm512_extracti32x4_epi32(z0, 1));
+  x1 = _mm_xor_si128(Fold(x1, k128), _mm512_extracti32x4_epi32(z0, 2));
+  x1 = _mm_xor_si128(Fold(x1, k128), _mm512_extracti32x4_epi32(z0, 3));
+
+  // Reduce 128 bits to 64 bits
+  const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+  x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, k128, 0x10), _mm_srli_si128(x1, 8));
+  __m128i x2 = _mm_srli_si128(x1, 4);
+  x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), _mm_cvtsi64_si128(kFold64), 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+
+  // Barrett reduction to 32 bits
+  k128 = _mm_set_epi64x(kBarrettMu, kPolynomial);
+  x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k128, 0x10);
+  x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask32), k128, 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+  return ~static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+}
+
+}  // namespace arrow::internal
@@ -0,0 +1,47 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "arrow/util/crc32.h"
+
+namespace arrow {
+namespace internal {
+
+static void Crc32(benchmark::State& state) {  // NOLINT non-const reference
+  const auto length = static_cast<size_t>(state.range(0));
+  std::vector<uint8_t> data(length);
+  std::mt19937 gen(42);
+  for (auto& byte : data) {
+    byte = static_cast<uint8_t>(gen());
+  }
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(crc32(0, data.data(), length));
+  }
+  state.SetBytesProcessed(state.iterations() * length);
+}
+
+// From a small data page to a large one
+BENCHMARK(Crc32)->Arg(100)->Arg(4 * 1024)->Arg(64 * 1024)->Arg(1024 * 1024);
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,43 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace arrow::internal {
+
+// Hardware-accelerated CRC32 kernels, dispatched to by crc32().
+//
+// Like crc32(), they take and return a finalized CRC value.
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+/// \brief CRC32 by folding 128-bit blocks with PCLMULQDQ
+///
+/// `length` must be a multiple of 16 and at least 64.
+uint32_t crc32_pclmul(uint32_t prev, const uint8_t* data, size_t length);
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+/// \brief CRC32 by folding 512-bit blocks with VPCLMULQDQ
+///
+/// `length` must be a multiple of 64 and at least 256.
+uint32_t crc32_vpclmul(uint32_t prev, const uint8_t* data, size_t length);
+#endif
+
+}  // namespace arrow::internal
@@ -107,4 +107,32 @@ TEST(Crc32Test, matchesBoost32Type) {
   }
 }
 
+TEST(Crc32Test, AllLengths) {
+  // Cover the hardware-accelerated kernels and their remainders
+  constexpr size_t kMaxLength = 1100;
+  std::vector<uint8_t> buffer(kMaxLength + 3);
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<uint32_t> dist;
+  for (auto& byte : buffer) {
+    byte = static_cast<uint8_t>(dist(gen));
+  }
+
+  for (size_t offset = 0; offset < 3; ++offset) {
+    for (size_t length = 0; length <= kMaxLength; ++length) {
+      const uint8_t* data = buffer.data() + offset;
+      boost::crc_32_type boost_crc;
+      boost_crc.process_bytes(data, length);
+      ASSERT_EQ(boost_crc.checksum(), internal::crc32(0, data, length))
+          << "offset " << offset << ", length " << length;
+
+      // Running checksum
+      const size_t split = length / 3;
+      const uint32_t prefix_crc = internal::crc32(0, data, split);
+      ASSERT_EQ(boost_crc.checksum(),
+                internal::crc32(prefix_crc, data + split, length - split))
+          << "offset " << offset << ", length " << length;
+    }
+  }
+}
+
 }  // namespace arrow
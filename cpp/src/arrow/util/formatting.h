@@ -32,6 +32,7 @@
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/string.h"
 #include "arrow/util/time.h"
@@ -201,6 +202,38 @@ constexpr size_t Digits10(Int value) {
   return value <= 9 ? 1 : Digits10(value / 10) + 1;
 }
 
+// Same as Digits10, without a loop over the digits
+inline int CountDigits(uint64_t value) {
+  static constexpr uint64_t kPowersOf10[] = {
+      1ULL,
+      10ULL,
+      100ULL,
+      1000ULL,
+      10000ULL,
+      100000ULL,
+      1000000ULL,
+      10000000ULL,
+      100000000ULL,
+      1000000000ULL,
+      10000000000ULL,
+      100000000000ULL,
+      1000000000000ULL,
+      10000000000000ULL,
+      100000000000000ULL,
+      1000000000000000ULL,
+      10000000000000000ULL,
+      100000000000000000ULL,
+      1000000000000000000ULL,
+      10000000000000000000ULL,
+  };
+  // 1233 / 4096 approximates log10(2), so `approx` is either the number of digits
+  // or one less, which a comparison with the next power of ten resolves.
+  // Setting the low bit never crosses a power of ten, but counts 0 as one digit.
+  value |= 1;
+  const int approx = (bit_util::NumRequiredBits(value) * 1233) >> 12;
+  return approx + (value >= kPowersOf10[approx] ? 1 : 0);
+}
+
 }  // namespace detail
 
 template <typename ARROW_TYPE>
@@ -223,6 +256,19 @@ class IntToStringFormatterMixin {
     }
     return append(detail::ViewDigitBuffer(buffer, cursor));
   }
+
+  /// \brief Return the number of characters needed to format `value`
+  static int64_t FormattedSize(value_type value) {
+    return detail::CountDigits(detail::Abs(value)) + (value < 0 ? 1 : 0);
+  }
+
+  /// \brief Format `value` into the FormattedSize(value) characters ending at `end`
+  static void FormatBackward(value_type value, char* end) {
+    detail::FormatAllDigits(detail::Abs(value), &end);
+    if (value < 0) {
+      detail::FormatOneChar('-', &end);
+    }
+  }
 };
 
 template <>
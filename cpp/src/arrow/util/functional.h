@@ -17,7 +17,9 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <new>
 #include <tuple>
 #include <type_traits>
 
@@ -130,30 +132,91 @@ class FnOnce<R(A...)> {
   template <typename Fn,
             typename = typename std::enable_if<std::is_convertible<
                 decltype(std::declval<Fn&&>()(std::declval<A>()...)), R>::value>::type>
-  FnOnce(Fn fn) : impl_(new FnImpl<Fn>(std::move(fn))) {  // NOLINT runtime/explicit
+  FnOnce(Fn fn) {  // NOLINT runtime/explicit
+    if constexpr (kStoredInline<Fn>) {
+      impl_ = new (storage_) FnImpl<Fn>(std::move(fn));
+    } else {
+      impl_ = new FnImpl<Fn>(std::move(fn));
+    }
+  }
+
+  FnOnce(FnOnce&& other) noexcept { MoveFrom(&other); }
+
+  FnOnce& operator=(FnOnce&& other) noexcept {
+    if (this != &other) {
+      Reset();
+      MoveFrom(&other);
+    }
+    return *this;
   }
 
+  ~FnOnce() { Reset(); }
+
   explicit operator bool() const { return impl_ != NULLPTR; }
 
   R operator()(A... a) && {
-    auto bye = std::move(impl_);
-    return bye->invoke(std::forward<A&&>(a)...);
+    // Move the callable out of this FnOnce first, as invoking it may destroy us
+    FnOnce bye(std::move(*this));
+    return bye.impl_->invoke(std::forward<A&&>(a)...);
   }
 
  private:
+  // Small callables (such as most future callbacks) are stored inline to avoid
+  // a heap allocation per FnOnce.
+  static constexpr size_t kInlineSize = 6 * sizeof(void*);
+
   struct Impl {
     virtual ~Impl() = default;
     virtual R invoke(A&&... a) = 0;
+    // Move-construct into `storage`, only called on inline callables
+    virtual Impl* MoveTo(void* storage) noexcept = 0;
   };
 
   template <typename Fn>
   struct FnImpl : Impl {
     explicit FnImpl(Fn fn) : fn_(std::move(fn)) {}
     R invoke(A&&... a) override { return std::move(fn_)(std::forward<A&&>(a)...); }
+    Impl* MoveTo(void* storage) noexcept override {
+      if constexpr (std::is_nothrow_move_constructible_v<Fn>) {
+        return new (storage) FnImpl(std::move(fn_));
+      } else {
+        return NULLPTR;  // unreachable, such callables are heap-allocated
+      }
+    }
     Fn fn_;
   };
 
-  std::unique_ptr<Impl> impl_;
+  template <typename Fn>
+  static constexpr bool kStoredInline =
+      sizeof(FnImpl<Fn>) <= kInlineSize &&
+      alignof(FnImpl<Fn>) <= alignof(std::max_align_t) &&
+      std::is_nothrow_move_constructible_v<Fn>;
+
+  bool is_inline() const {
+    return impl_ == reinterpret_cast<const Impl*>(storage_);
+  }
+
+  void MoveFrom(FnOnce* other) noexcept {
+    if (other->is_inline()) {
+      impl_ = other->impl_->MoveTo(storage_);
+      other->Reset();
+    } else {
+      impl_ = other->impl_;
+      other->impl_ = NULLPTR;
+    }
+  }
+
+  void Reset() noexcept {
+    if (is_inline()) {
+      impl_->~Impl();
+    } else {
+      delete impl_;
+    }
+    impl_ = NULLPTR;
+  }
+
+  Impl* impl_ = NULLPTR;
+  alignas(std::max_align_t) unsigned char storage_[kInlineSize];
 };
 
 }  // namespace internal
@@ -112,7 +112,7 @@ class ConcreteFutureImpl : public FutureImpl {
   }
 
   void DoMarkFinishedOrFailed(FutureState state) {
-    std::vector<CallbackRecord> callbacks;
+    internal::SmallVector<CallbackRecord, 1> callbacks;
     std::shared_ptr<FutureImpl> self;
     {
       std::unique_lock<std::mutex> lock(mutex_);
@@ -126,6 +126,7 @@ class ConcreteFutureImpl : public FutureImpl {
       DCHECK(!IsFutureFinished(state_)) << "Future already marked finished";
       if (!callbacks_.empty()) {
         callbacks = std::move(callbacks_);
+        callbacks_.clear();
         auto self_inner = shared_from_this();
         self = std::move(self_inner);
       }
@@ -205,12 +206,13 @@ ConcreteFutureImpl* GetConcreteFuture(FutureImpl* future) {
 
 }  // namespace
 
-std::unique_ptr<FutureImpl> FutureImpl::Make() {
-  return std::make_unique<ConcreteFutureImpl>();
+// A single allocation holds the implementation and its shared_ptr control block
+std::shared_ptr<FutureImpl> FutureImpl::Make() {
+  return std::make_shared<ConcreteFutureImpl>();
 }
 
-std::unique_ptr<FutureImpl> FutureImpl::MakeFinished(FutureState state) {
-  std::unique_ptr<ConcreteFutureImpl> ptr(new ConcreteFutureImpl());
+std::shared_ptr<FutureImpl> FutureImpl::MakeFinished(FutureState state) {
+  auto ptr = std::make_shared<ConcreteFutureImpl>();
   ptr->state_ = state;
   return ptr;
 }
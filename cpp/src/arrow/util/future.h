@@ -19,8 +19,10 @@
 
 #include <atomic>
 #include <cmath>
+#include <cstddef>
 #include <functional>
 #include <memory>
+#include <new>
 #include <optional>
 #include <type_traits>
 #include <utility>
@@ -33,6 +35,7 @@
 #include "arrow/util/config.h"
 #include "arrow/util/functional.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/small_vector.h"
 #include "arrow/util/tracing.h"
 #include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
@@ -262,8 +265,8 @@ class ARROW_EXPORT FutureImpl : public std::enable_shared_from_this<FutureImpl>
 
   FutureState state() { return state_.load(); }
 
-  static std::unique_ptr<FutureImpl> Make();
-  static std::unique_ptr<FutureImpl> MakeFinished(FutureState state);
+  static std::shared_ptr<FutureImpl> Make();
+  static std::shared_ptr<FutureImpl> MakeFinished(FutureState state);
 
 #ifdef ARROW_WITH_OPENTELEMETRY
   void SetSpan(util::tracing::Span* span) { span_ = span; }
@@ -279,6 +282,20 @@ class ARROW_EXPORT FutureImpl : public std::enable_shared_from_this<FutureImpl>
     return static_cast<Result<ValueType>*>(result_.get());
   }
 
+  template <typename ValueType>
+  void SetResult(Result<ValueType> res) {
+    using ResultType = Result<ValueType>;
+    if constexpr (sizeof(ResultType) <= kInlineResultSize &&
+                  alignof(ResultType) <= alignof(std::max_align_t)) {
+      result_.reset();
+      result_ = {new (inline_result_) ResultType(std::move(res)),
+                 [](void* p) { static_cast<ResultType*>(p)->~ResultType(); }};
+    } else {
+      result_ = {new ResultType(std::move(res)),
+                 [](void* p) { delete static_cast<ResultType*>(p); }};
+    }
+  }
+
   using Callback = internal::FnOnce<void(const FutureImpl& impl)>;
   void AddCallback(Callback callback, CallbackOptions opts);
   bool TryAddCallback(const std::function<Callback()>& callback_factory,
@@ -286,8 +303,10 @@ class ARROW_EXPORT FutureImpl : public std::enable_shared_from_this<FutureImpl>
 
   std::atomic<FutureState> state_{FutureState::PENDING};
 
-  // Type erased storage for arbitrary results
-  // XXX small objects could be stored inline instead of boxed in a pointer
+  // Type erased storage for arbitrary results.  Small results are stored in
+  // inline_result_ rather than boxed.
+  static constexpr size_t kInlineResultSize = 6 * sizeof(void*);
+  alignas(std::max_align_t) unsigned char inline_result_[kInlineResultSize];
   using Storage = std::unique_ptr<void, void (*)(void*)>;
   Storage result_{NULLPTR, NULLPTR};
 
@@ -295,7 +314,8 @@ class ARROW_EXPORT FutureImpl : public std::enable_shared_from_this<FutureImpl>
     Callback callback;
     CallbackOptions options;
   };
-  std::vector<CallbackRecord> callbacks_;
+  // Most futures have a single callback
+  internal::SmallVector<CallbackRecord, 1> callbacks_;
 #ifdef ARROW_WITH_OPENTELEMETRY
   util::tracing::Span* span_ = NULLPTR;
 #endif
@@ -647,8 +667,7 @@ class [[nodiscard]] Future {
   Result<ValueType>* GetResult() const { return impl_->CastResult<ValueType>(); }
 
   void SetResult(Result<ValueType> res) {
-    impl_->result_ = {new Result<ValueType>(std::move(res)),
-                      [](void* p) { delete static_cast<Result<ValueType>*>(p); }};
+    impl_->SetResult(std::move(res));
   }
 
   void DoMarkFinished(Result<ValueType> res) {
@@ -0,0 +1,85 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/util/future.h"
+
+namespace arrow {
+
+// Per-future overhead of creating and finishing a future
+static void FutureMakeFinished(benchmark::State& state) {
+  int64_t total = 0;
+  for (auto _ : state) {
+    auto fut = Future<int>::Make();
+    fut.MarkFinished(1);
+    total += *fut.result();
+  }
+  benchmark::DoNotOptimize(total);
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void FutureAlreadyFinished(benchmark::State& state) {
+  int64_t total = 0;
+  for (auto _ : state) {
+    auto fut = Future<int>::MakeFinished(1);
+    total += *fut.result();
+  }
+  benchmark::DoNotOptimize(total);
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Per-future overhead of a chain of continuations, as built by async generators
+static void FutureThenChain(benchmark::State& state) {
+  const auto chain_length = static_cast<int>(state.range(0));
+  int64_t total = 0;
+  for (auto _ : state) {
+    auto source = Future<int>::Make();
+    auto fut = source;
+    for (int i = 0; i < chain_length; ++i) {
+      fut = fut.Then([](int value) { return value + 1; });
+    }
+    source.MarkFinished(0);
+    total += *fut.result();
+  }
+  benchmark::DoNotOptimize(total);
+  state.SetItemsProcessed(state.iterations() * chain_length);
+}
+
+// Continuation on an already finished future, as when a generator has data ready
+static void FutureThenFinished(benchmark::State& state) {
+  int64_t total = 0;
+  for (auto _ : state) {
+    auto fut = Future<std::shared_ptr<RecordBatch>>::MakeFinished(nullptr).Then(
+        [](const std::shared_ptr<RecordBatch>& batch) { return batch == nullptr; });
+    total += *fut.result();
+  }
+  benchmark::DoNotOptimize(total);
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(FutureMakeFinished);
+BENCHMARK(FutureAlreadyFinished);
+BENCHMARK(FutureThenChain)->Arg(1)->Arg(4)->Arg(16);
+BENCHMARK(FutureThenFinished);
+
+}  // namespace arrow
@@ -18,6 +18,7 @@
 #include "arrow/util/future.h"
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <condition_variable>
 #include <memory>
@@ -1554,6 +1555,51 @@ TEST(FnOnceTest, MoveOnlyDataType) {
   ASSERT_EQ(i1.moves, 0);
 }
 
+TEST(FnOnceTest, SmallAndLargeCallables) {
+  // Small callables are stored inline, large ones are heap-allocated; both must
+  // survive moves and release their state once invoked.
+  auto state = std::make_shared<int>(1);
+  std::array<int64_t, 16> large{};
+  large[15] = 2;
+
+  FnOnce<int()> small_fn = [state] { return *state; };
+  FnOnce<int()> large_fn = [state, large] {
+    return *state + static_cast<int>(large[15]);
+  };
+  ASSERT_EQ(state.use_count(), 3);
+
+  FnOnce<int()> moved_small = std::move(small_fn);
+  FnOnce<int()> moved_large = std::move(large_fn);
+  ASSERT_FALSE(small_fn);
+  ASSERT_FALSE(large_fn);
+  ASSERT_EQ(state.use_count(), 3);
+
+  ASSERT_EQ(std::move(moved_small)(), 1);
+  ASSERT_FALSE(moved_small);
+  ASSERT_EQ(state.use_count(), 2);
+  ASSERT_EQ(std::move(moved_large)(), 3);
+  ASSERT_EQ(state.use_count(), 1);
+
+  // Reassigning destroys the previous callable
+  FnOnce<int()> fn = [state] { return 1; };
+  ASSERT_EQ(state.use_count(), 2);
+  fn = [] { return 2; };
+  ASSERT_EQ(state.use_count(), 1);
+  ASSERT_EQ(std::move(fn)(), 2);
+}
+
+TEST(FnOnceTest, DestroyedWhileInvoked) {
+  // The callable may destroy the FnOnce it was stored in
+  auto holder = std::make_unique<FnOnce<int()>>();
+  auto* raw_holder = holder.get();
+  *holder = [&holder] {
+    holder.reset();
+    return 42;
+  };
+  ASSERT_EQ(std::move(*raw_holder)(), 42);
+  ASSERT_EQ(holder, nullptr);
+}
+
 TEST(FutureTest, MatcherExamples) {
 #ifndef ARROW_ENABLE_THREADING
   GTEST_SKIP() << "Test requires threading support";
@@ -43,6 +43,8 @@
 #include "arrow/util/float16.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/prefetch.h"
+#include "arrow/util/simd.h"
 #include "arrow/util/ubsan.h"
 
 #define XXH_INLINE_ALL
@@ -285,6 +287,11 @@ class HashTable {
 
   uint64_t size() const { return size_; }
 
+  // Hint that `h` is about to be looked up
+  void Prefetch(hash_t h) const {
+    ARROW_PREFETCH(&entries_[FixHash(h) & capacity_mask_]);
+  }
+
   // Visit all non-empty entries in the table
   // The visit_func should have signature void(const Entry*)
   template <typename VisitFunc>
@@ -396,6 +403,210 @@ class HashTable {
   TypedBufferBuilder<Entry> entries_builder_;
 };
 
+// ----------------------------------------------------------------------
+// An open-addressing insert-only hash table probing groups of slots at once
+
+// A drop-in replacement for HashTable in the style of Abseil's "Swiss tables".
+// Besides the entries, the table stores one control byte per slot: either
+// kEmpty or 7 bits of the hash of the entry.  Slots are probed in groups of
+// kGroupSize, comparing all control bytes of a group in one SIMD instruction
+// and only reading the entries whose control byte matches.  Most lookups
+// therefore touch a single entry, even at a 7/8 load factor (HashTable keeps
+// its load factor <= 1/2), which makes the table smaller and more cache
+// friendly.
+
+template <typename Payload>
+class SwissHashTable {
+ public:
+  static constexpr hash_t kSentinel = 0ULL;
+  static constexpr uint64_t kGroupSize = 16;
+
+  struct Entry {
+    hash_t h;
+    Payload payload;
+
+    // An entry is valid if the hash is different from the sentinel value
+    operator bool() const { return h != kSentinel; }
+  };
+
+  SwissHashTable(MemoryPool* pool, uint64_t capacity)
+      : entries_builder_(pool), control_builder_(pool) {
+    ARROW_DCHECK_NE(pool, nullptr);
+    // Minimum of 32 elements, room for `capacity` elements below the max load
+    capacity = std::max<uint64_t>(capacity + capacity / 7 + 1, 32UL);
+    capacity_ = bit_util::NextPower2(capacity);
+    group_mask_ = capacity_ / kGroupSize - 1;
+    size_ = 0;
+
+    ARROW_DCHECK_OK(UpsizeBuffer(capacity_));
+  }
+
+  // Lookup with group probing
+  // cmp_func should have signature bool(const Payload*).
+  // Return a (Entry*, found) pair.
+  template <typename CmpFunc>
+  std::pair<Entry*, bool> Lookup(hash_t h, CmpFunc&& cmp_func) {
+    auto p = Lookup<DoCompare, CmpFunc>(h, std::forward<CmpFunc>(cmp_func));
+    return {&entries_[p.first], p.second};
+  }
+
+  template <typename CmpFunc>
+  std::pair<const Entry*, bool> Lookup(hash_t h, CmpFunc&& cmp_func) const {
+    auto p = Lookup<DoCompare, CmpFunc>(h, std::forward<CmpFunc>(cmp_func));
+    return {&entries_[p.first], p.second};
+  }
+
+  Status Insert(Entry* entry, hash_t h, const Payload& payload) {
+    // Ensure entry is empty before inserting
+    assert(!*entry);
+    h = FixHash(h);
+    control_[entry - entries_] = Tag(h);
+    entry->h = h;
+    entry->payload = payload;
+    ++size_;
+
+    if (ARROW_PREDICT_FALSE(NeedUpsizing())) {
+      return Upsize(capacity_ * 2);
+    }
+    return Status::OK();
+  }
+
+  uint64_t size() const { return size_; }
+
+  // Hint that `h` is about to be looked up
+  void Prefetch(hash_t h) const {
+    const uint64_t group = FixHash(h) & group_mask_;
+    ARROW_PREFETCH(control_ + group * kGroupSize);
+    ARROW_PREFETCH(entries_ + group * kGroupSize);
+  }
+
+  // Visit all non-empty entries in the table
+  // The visit_func should have signature void(const Entry*)
+  template <typename VisitFunc>
+  void VisitEntries(VisitFunc&& visit_func) const {
+    for (uint64_t i = 0; i < capacity_; i++) {
+      if (control_[i] != kEmpty) {
+        visit_func(&entries_[i]);
+      }
+    }
+  }
+
+ protected:
+  // Control byte of an empty slot; the tags of occupied slots are < 0x80
+  static constexpr uint8_t kEmpty = 0x80;
+
+  // NoCompare is for when the value is known not to exist in the table
+  enum CompareKind { DoCompare, NoCompare };
+
+  // The workhorse lookup function
+  template <CompareKind CKind, typename CmpFunc>
+  std::pair<uint64_t, bool> Lookup(hash_t h, CmpFunc&& cmp_func) const {
+    h = FixHash(h);
+    const uint8_t tag = Tag(h);
+    // The low bits of the hash select the first group, the high bits the tag
+    uint64_t group = h & group_mask_;
+
+    for (uint64_t step = 1;; ++step) {
+      const uint64_t base = group * kGroupSize;
+      const uint8_t* control = control_ + base;
+      if (CKind == DoCompare) {
+        for (uint32_t match = MatchByte(control, tag); match != 0; match &= match - 1) {
+          const uint64_t index = base + bit_util::CountTrailingZeros(match);
+          const Entry* entry = &entries_[index];
+          if (entry->h == h && cmp_func(&entry->payload)) {
+            return {index, true};
+          }
+        }
+      }
+      // Nothing is ever deleted, so the key would have been inserted in the
+      // first group with an empty slot
+      const uint32_t empty = MatchByte(control, kEmpty);
+      if (empty != 0) {
+        return {base + bit_util::CountTrailingZeros(empty), false};
+      }
+      // Triangular probing visits all groups since their number is a power of two
+      group = (group + step) & group_mask_;
+    }
+  }
+
+  // Return a bitmask of the slots of a group whose control byte is `byte`
+  static uint32_t MatchByte(const uint8_t* control, uint8_t byte) {
+#if defined(ARROW_HAVE_SSE4_2)
+    const __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(control));
+    const __m128i pattern = _mm_set1_epi8(static_cast<char>(byte));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(group, pattern)));
+#else
+    uint32_t mask = 0;
+    for (uint64_t i = 0; i < kGroupSize; ++i) {
+      mask |= static_cast<uint32_t>(control[i] == byte) << i;
+    }
+    return mask;
+#endif
+  }
+
+  static uint8_t Tag(hash_t h) { return static_cast<uint8_t>(h >> 57); }
+
+  bool NeedUpsizing() const {
+    // Keep the load factor <= 7/8
+    return size_ * 8 > capacity_ * 7;
+  }
+
+  Status UpsizeBuffer(uint64_t capacity) {
+    RETURN_NOT_OK(entries_builder_.Resize(capacity));
+    entries_ = entries_builder_.mutable_data();
+    memset(static_cast<void*>(entries_), 0, capacity * sizeof(Entry));
+    RETURN_NOT_OK(control_builder_.Resize(capacity));
+    control_ = control_builder_.mutable_data();
+    memset(control_, kEmpty, capacity);
+
+    return Status::OK();
+  }
+
+  Status Upsize(uint64_t new_capacity) {
+    assert(new_capacity > capacity_);
+    assert((new_capacity & (new_capacity - 1)) == 0);  // it's a power of two
+
+    // Stash old entries and seal builders, effectively resetting the Buffers
+    const Entry* old_entries = entries_;
+    const uint8_t* old_control = control_;
+    const uint64_t old_capacity = capacity_;
+    ARROW_ASSIGN_OR_RAISE(auto previous_entries,
+                          entries_builder_.FinishWithLength(old_capacity));
+    ARROW_ASSIGN_OR_RAISE(auto previous_control,
+                          control_builder_.FinishWithLength(old_capacity));
+    // Allocate new buffers
+    RETURN_NOT_OK(UpsizeBuffer(new_capacity));
+    capacity_ = new_capacity;
+    group_mask_ = new_capacity / kGroupSize - 1;
+
+    for (uint64_t i = 0; i < old_capacity; i++) {
+      if (old_control[i] != kEmpty) {
+        const Entry& entry = old_entries[i];
+        // Dummy compare function will not be called
+        auto p = Lookup<NoCompare>(entry.h, [](const Payload*) { return false; });
+        assert(!p.second);
+        control_[p.first] = old_control[i];
+        entries_[p.first] = entry;
+      }
+    }
+
+    return Status::OK();
+  }
+
+  hash_t FixHash(hash_t h) const { return (h == kSentinel) ? 42U : h; }
+
+  // The number of slots available in the hash table array.
+  uint64_t capacity_;
+  uint64_t group_mask_;
+  // The number of used slots in the hash table array.
+  uint64_t size_;
+
+  Entry* entries_;
+  uint8_t* control_;
+  TypedBufferBuilder<Entry> entries_builder_;
+  TypedBufferBuilder<uint8_t> control_builder_;
+};
+
 // XXX typedef memo_index_t int32_t ?
 
 constexpr int32_t kKeyNotFound = -1;
@@ -425,38 +636,15 @@ class ScalarMemoTable : public MemoTable {
   template <typename Value>
   int32_t Get(Value&& v) const {
     const Scalar value(std::forward<Value>(v));
-    auto cmp_func = [value](const Payload* payload) -> bool {
-      return ScalarHelper<Scalar, 0>::CompareScalars(payload->value, value);
-    };
-    hash_t h = ComputeHash(value);
-    auto p = hash_table_.Lookup(h, cmp_func);
-    if (p.second) {
-      return p.first->payload.memo_index;
-    } else {
-      return kKeyNotFound;
-    }
+    return GetHashed(value, ComputeHash(value));
   }
 
   template <typename Value, typename Func1, typename Func2>
   Status GetOrInsert(Value&& v, Func1&& on_found, Func2&& on_not_found,
                      int32_t* out_memo_index) {
     const Scalar value(std::forward<Value>(v));
-    auto cmp_func = [value](const Payload* payload) -> bool {
-      return ScalarHelper<Scalar, 0>::CompareScalars(value, payload->value);
-    };
-    hash_t h = ComputeHash(value);
-    auto p = hash_table_.Lookup(h, cmp_func);
-    int32_t memo_index;
-    if (p.second) {
-      memo_index = p.first->payload.memo_index;
-      on_found(memo_index);
-    } else {
-      memo_index = size();
-      RETURN_NOT_OK(hash_table_.Insert(p.first, h, {value, memo_index}));
-      on_not_found(memo_index);
-    }
-    *out_memo_index = memo_index;
-    return Status::OK();
+    return GetOrInsertHashed(value, ComputeHash(value), std::forward<Func1>(on_found),
+                             std::forward<Func2>(on_not_found), out_memo_index);
   }
 
   template <typename Value>
@@ -464,6 +652,24 @@ class ScalarMemoTable : public MemoTable {
     return GetOrInsert(value, [](int32_t i) {}, [](int32_t i) {}, out_memo_index);
   }
 
+  // Look up `length` values, writing their memo index (or kKeyNotFound) to `out`.
+  //
+  // The batch variants hash a chunk of values and prefetch their slots before
+  // probing any of them, which overlaps the cache misses of large tables.
+  void GetBatch(const Scalar* values, int64_t length, int32_t* out) const {
+    ARROW_DCHECK_OK(VisitHashedBatch(values, length, [&](int64_t i, hash_t h) {
+      out[i] = GetHashed(values[i], h);
+      return Status::OK();
+    }));
+  }
+
+  // Look up or insert `length` values, writing their memo index to `out`
+  Status GetOrInsertBatch(const Scalar* values, int64_t length, int32_t* out) {
+    return VisitHashedBatch(values, length, [&](int64_t i, hash_t h) {
+      return GetOrInsertHashed(values[i], h, [](int32_t) {}, [](int32_t) {}, &out[i]);
+    });
+  }
+
   int32_t GetNull() const { return null_index_; }
 
   template <typename Func1, typename Func2>
@@ -529,6 +735,59 @@ class ScalarMemoTable : public MemoTable {
     return ScalarHelper<Scalar, 0>::ComputeHash(value);
   }
 
+  // The number of values hashed and prefetched ahead of the probes
+  static constexpr int64_t kBatchSize = 64;
+
+  int32_t GetHashed(const Scalar& value, hash_t h) const {
+    auto cmp_func = [&value](const Payload* payload) -> bool {
+      return ScalarHelper<Scalar, 0>::CompareScalars(payload->value, value);
+    };
+    auto p = hash_table_.Lookup(h, cmp_func);
+    if (p.second) {
+      return p.first->payload.memo_index;
+    } else {
+      return kKeyNotFound;
+    }
+  }
+
+  template <typename Func1, typename Func2>
+  Status GetOrInsertHashed(const Scalar& value, hash_t h, Func1&& on_found,
+                           Func2&& on_not_found, int32_t* out_memo_index) {
+    auto cmp_func = [&value](const Payload* payload) -> bool {
+      return ScalarHelper<Scalar, 0>::CompareScalars(value, payload->value);
+    };
+    auto p = hash_table_.Lookup(h, cmp_func);
+    int32_t memo_index;
+    if (p.second) {
+      memo_index = p.first->payload.memo_index;
+      on_found(memo_index);
+    } else {
+      memo_index = size();
+      RETURN_NOT_OK(hash_table_.Insert(p.first, h, {value, memo_index}));
+      on_not_found(memo_index);
+    }
+    *out_memo_index = memo_index;
+    return Status::OK();
+  }
+
+  // Call visit_func(i, hash of values[i]) for all values, in order
+  template <typename VisitFunc>
+  Status VisitHashedBatch(const Scalar* values, int64_t length,
+                          VisitFunc&& visit_func) const {
+    hash_t hashes[kBatchSize];
+    for (int64_t start = 0; start < length; start += kBatchSize) {
+      const int64_t batch_length = std::min(kBatchSize, length - start);
+      for (int64_t i = 0; i < batch_length; ++i) {
+        hashes[i] = ComputeHash(values[start + i]);
+        hash_table_.Prefetch(hashes[i]);
+      }
+      for (int64_t i = 0; i < batch_length; ++i) {
+        RETURN_NOT_OK(visit_func(start + i, hashes[i]));
+      }
+    }
+    return Status::OK();
+  }
+
  public:
   // defined here so that `HashTableType` is visible
   // Merge entries from `other_table` into `this->hash_table_`.
@@ -661,7 +920,8 @@ class SmallScalarMemoTable : public MemoTable {
 // ----------------------------------------------------------------------
 // A memoization table for variable-sized binary data.
 
-template <typename BinaryBuilderT>
+template <typename BinaryBuilderT,
+          template <class> class HashTableTemplateType = HashTable>
 class BinaryMemoTable : public MemoTable {
  public:
   using builder_offset_type = typename BinaryBuilderT::offset_type;
@@ -880,8 +1140,8 @@ class BinaryMemoTable : public MemoTable {
     int32_t memo_index;
   };
 
-  using HashTableType = HashTable<Payload>;
-  using HashTableEntry = typename HashTable<Payload>::Entry;
+  using HashTableType = HashTableTemplateType<Payload>;
+  using HashTableEntry = typename HashTableType::Entry;
   HashTableType hash_table_;
   BinaryBuilderT binary_builder_;
 
@@ -111,6 +111,83 @@ static void HashLargeStrings(benchmark::State& state) {  // NOLINT non-const ref
   BenchmarkStringHashing(state, values);
 }
 
+// Values drawn from `cardinality` distinct integers
+static std::vector<int64_t> MakeMemoValues(int64_t cardinality) {
+  const std::vector<int64_t> distinct =
+      MakeIntegers<int64_t>(static_cast<int32_t>(cardinality));
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<size_t> index_dist(0, distinct.size() - 1);
+  std::vector<int64_t> values(1 << 20);
+  std::generate(values.begin(), values.end(),
+                [&]() { return distinct[index_dist(gen)]; });
+  return values;
+}
+
+template <template <class> class HashTableTemplateType>
+static void MemoTableInsert(benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<int64_t> values = MakeMemoValues(state.range(0));
+
+  for (auto _ : state) {
+    ScalarMemoTable<int64_t, HashTableTemplateType> table(default_memory_pool());
+    int32_t memo_index;
+    for (const int64_t v : values) {
+      ABORT_NOT_OK(table.GetOrInsert(v, &memo_index));
+    }
+    benchmark::DoNotOptimize(table.size());
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <template <class> class HashTableTemplateType>
+static void MemoTableInsertBatch(benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<int64_t> values = MakeMemoValues(state.range(0));
+  std::vector<int32_t> memo_indices(values.size());
+
+  for (auto _ : state) {
+    ScalarMemoTable<int64_t, HashTableTemplateType> table(default_memory_pool());
+    ABORT_NOT_OK(table.GetOrInsertBatch(values.data(),
+                                        static_cast<int64_t>(values.size()),
+                                        memo_indices.data()));
+    benchmark::DoNotOptimize(table.size());
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <template <class> class HashTableTemplateType>
+static void MemoTableLookup(benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<int64_t> values = MakeMemoValues(state.range(0));
+  ScalarMemoTable<int64_t, HashTableTemplateType> table(default_memory_pool());
+  int32_t memo_index;
+  for (const int64_t v : values) {
+    ABORT_NOT_OK(table.GetOrInsert(v, &memo_index));
+  }
+
+  for (auto _ : state) {
+    int64_t total = 0;
+    for (const int64_t v : values) {
+      total += table.Get(v);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <template <class> class HashTableTemplateType>
+static void MemoTableLookupBatch(benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<int64_t> values = MakeMemoValues(state.range(0));
+  std::vector<int32_t> memo_indices(values.size());
+  ScalarMemoTable<int64_t, HashTableTemplateType> table(default_memory_pool());
+  ABORT_NOT_OK(table.GetOrInsertBatch(values.data(), static_cast<int64_t>(values.size()),
+                                      memo_indices.data()));
+
+  for (auto _ : state) {
+    table.GetBatch(values.data(), static_cast<int64_t>(values.size()),
+                   memo_indices.data());
+    benchmark::DoNotOptimize(memo_indices.data());
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
 // ----------------------------------------------------------------------
 // Benchmark declarations
 
@@ -119,5 +196,19 @@ BENCHMARK(HashSmallStrings);
 BENCHMARK(HashMediumStrings);
 BENCHMARK(HashLargeStrings);
 
+// Number of distinct values
+static void MemoTableArgs(benchmark::internal::Benchmark* bench) {
+  bench->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+}
+
+BENCHMARK_TEMPLATE(MemoTableInsert, HashTable)->Apply(MemoTableArgs);
+BENCHMARK_TEMPLATE(MemoTableInsert, SwissHashTable)->Apply(MemoTableArgs);
+BENCHMARK_TEMPLATE(MemoTableInsertBatch, HashTable)->Apply(MemoTableArgs);
+BENCHMARK_TEMPLATE(MemoTableInsertBatch, SwissHashTable)->Apply(MemoTableArgs);
+BENCHMARK_TEMPLATE(MemoTableLookup, HashTable)->Apply(MemoTableArgs);
+BENCHMARK_TEMPLATE(MemoTableLookup, SwissHashTable)->Apply(MemoTableArgs);
+BENCHMARK_TEMPLATE(MemoTableLookupBatch, HashTable)->Apply(MemoTableArgs);
+BENCHMARK_TEMPLATE(MemoTableLookupBatch, SwissHashTable)->Apply(MemoTableArgs);
+
 }  // namespace internal
 }  // namespace arrow
@@ -376,6 +376,95 @@ TEST(ScalarMemoTable, StressInt64) {
   ASSERT_EQ(table.size(), map.size());
 }
 
+TEST(ScalarMemoTable, SwissInt64) {
+  const int64_t A = 1234, B = 0, C = -98765321, D = 12345678901234LL, E = -1;
+
+  ScalarMemoTable<int64_t, SwissHashTable> table(default_memory_pool(), 0);
+  ASSERT_EQ(table.size(), 0);
+  AssertGet(table, A, kKeyNotFound);
+  AssertGetOrInsert(table, A, 0);
+  AssertGetOrInsert(table, B, 1);
+  AssertGetOrInsert(table, C, 2);
+  AssertGetOrInsertNull(table, 3);
+  AssertGetOrInsert(table, D, 4);
+  AssertGetOrInsert(table, E, 5);
+
+  AssertGet(table, A, 0);
+  AssertGet(table, E, 5);
+  AssertGetOrInsert(table, C, 2);
+  AssertGetOrInsertNull(table, 3);
+
+  ASSERT_EQ(table.size(), 6);
+  std::vector<int64_t> values(6);
+  table.CopyValues(values.data());
+  EXPECT_THAT(values, testing::ElementsAre(A, B, C, 0, D, E));
+}
+
+TEST(ScalarMemoTable, SwissStressInt64) {
+  // Enough distinct values to upsize the table several times
+#ifdef ARROW_VALGRIND
+  const int32_t n_values = 500;
+#else
+  const int32_t n_values = 100000;
+#endif
+  const auto distinct = MakeDistinctIntegers<int64_t>(n_values);
+  const std::vector<int64_t> values(distinct.begin(), distinct.end());
+
+  ScalarMemoTable<int64_t, SwissHashTable> table(default_memory_pool(), 0);
+  for (int32_t i = 0; i < n_values; ++i) {
+    AssertGetOrInsert(table, values[i], i);
+  }
+  ASSERT_EQ(table.size(), n_values);
+  for (int32_t i = 0; i < n_values; ++i) {
+    AssertGet(table, values[i], i);
+  }
+  AssertGet(table, int64_t{-1}, kKeyNotFound);
+
+  std::vector<int64_t> copied(n_values);
+  table.CopyValues(copied.data());
+  ASSERT_EQ(copied, values);
+}
+
+template <template <class> class HashTableTemplateType>
+void CheckScalarMemoTableBatch() {
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int64_t> value_dist(-5000, 5000);
+  std::vector<int64_t> values(20000);
+  for (auto& value : values) {
+    value = value_dist(gen);
+  }
+
+  ScalarMemoTable<int64_t, HashTableTemplateType> table(default_memory_pool(), 0);
+  ScalarMemoTable<int64_t> expected_table(default_memory_pool(), 0);
+  // Insert the first half one by one, the second half in a batch
+  const int64_t half = static_cast<int64_t>(values.size()) / 2;
+  std::vector<int32_t> expected(values.size()), actual(values.size());
+  for (int64_t i = 0; i < half; ++i) {
+    ASSERT_OK(table.GetOrInsert(values[i], &actual[i]));
+  }
+  ASSERT_OK(table.GetOrInsertBatch(values.data() + half,
+                                   static_cast<int64_t>(values.size()) - half,
+                                   actual.data() + half));
+  for (size_t i = 0; i < values.size(); ++i) {
+    ASSERT_OK(expected_table.GetOrInsert(values[i], &expected[i]));
+  }
+  ASSERT_EQ(actual, expected);
+  ASSERT_EQ(table.size(), expected_table.size());
+
+  std::vector<int64_t> lookups = {0, -5001, 5001, values[0], values.back()};
+  std::vector<int32_t> found(lookups.size());
+  table.GetBatch(lookups.data(), static_cast<int64_t>(lookups.size()), found.data());
+  for (size_t i = 0; i < lookups.size(); ++i) {
+    ASSERT_EQ(found[i], expected_table.Get(lookups[i]));
+  }
+  ASSERT_EQ(found[1], kKeyNotFound);
+  ASSERT_EQ(found[3], 0);
+}
+
+TEST(ScalarMemoTable, Batch) { CheckScalarMemoTableBatch<HashTable>(); }
+
+TEST(ScalarMemoTable, SwissBatch) { CheckScalarMemoTableBatch<SwissHashTable>(); }
+
 TEST(BinaryMemoTable, Basics) {
   std::string A = "", B = "a", C = "foo", D = "bar", E, F;
   E += '\0';
@@ -480,6 +569,27 @@ TEST(BinaryMemoTable, Stress) {
   ASSERT_EQ(table.size(), map.size());
 }
 
+TEST(BinaryMemoTable, SwissStress) {
+#ifdef ARROW_VALGRIND
+  const int32_t n_values = 20;
+#else
+  const int32_t n_values = 10000;
+#endif
+
+  const auto distinct = MakeDistinctStrings(n_values);
+  const std::vector<std::string> values(distinct.begin(), distinct.end());
+
+  BinaryMemoTable<BinaryBuilder, SwissHashTable> table(default_memory_pool(), 0);
+  for (int32_t i = 0; i < n_values; ++i) {
+    AssertGetOrInsert(table, values[i], i);
+  }
+  AssertGetOrInsertNull(table, n_values);
+  for (int32_t i = 0; i < n_values; ++i) {
+    AssertGet(table, values[i], i);
+  }
+  ASSERT_EQ(table.size(), n_values + 1);
+}
+
 TEST(BinaryMemoTable, Empty) {
   BinaryMemoTable<BinaryBuilder> table(default_memory_pool());
   ASSERT_EQ(table.size(), 0);
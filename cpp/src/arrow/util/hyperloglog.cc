@@ -0,0 +1,303 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/hyperloglog_internal.h"
+
+#include <cmath>
+#include <limits>
+
+#include "arrow/status.h"
+#include "arrow/util/endian.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging_internal.h"
+#include "arrow/util/ubsan.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+constexpr uint8_t kFormatVersion = 1;
+constexpr uint8_t kSparseEncoding = 0;
+constexpr uint8_t kDenseEncoding = 1;
+constexpr int64_t kHeaderSize = 3;
+
+// Helpers of Ertl's improved estimator, see section 4 of the paper
+double Sigma(double x) {
+  if (x == 1) return std::numeric_limits<double>::infinity();
+  double y = 1;
+  double z = x;
+  double z_prev;
+  do {
+    x *= x;
+    z_prev = z;
+    z += x * y;
+    y += y;
+  } while (z != z_prev);
+  return z;
+}
+
+double Tau(double x) {
+  if (x == 0 || x == 1) return 0;
+  double y = 1;
+  double z = 1 - x;
+  double z_prev;
+  do {
+    x = std::sqrt(x);
+    z_prev = z;
+    y *= 0.5;
+    z -= (1 - x) * (1 - x) * y;
+  } while (z != z_prev);
+  return z / 3;
+}
+
+}  // namespace
+
+HyperLogLog::HyperLogLog(int precision) : precision_(precision) {
+  DCHECK_GE(precision, kMinPrecision);
+  DCHECK_LE(precision, kMaxPrecision);
+}
+
+uint64_t HyperLogLog::HashBytes(const void* data, int64_t length) {
+  // Mix the hash with a 64-bit finalizer, as the small string hash doesn't
+  // spread its entropy over all bits
+  uint64_t h = ComputeStringHash<0>(data, length);
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+void HyperLogLog::CompactSparse() {
+  // Sort by index then rank, and keep the highest rank of each index
+  std::sort(sparse_.begin(), sparse_.end());
+  size_t out = 0;
+  for (size_t i = 0; i < sparse_.size(); ++i) {
+    if (out > 0 && (sparse_[out - 1] >> kRankBits) == (sparse_[i] >> kRankBits)) {
+      sparse_[out - 1] = sparse_[i];
+    } else {
+      sparse_[out++] = sparse_[i];
+    }
+  }
+  sparse_.resize(out);
+  // Past half its capacity, the sparse representation isn't worth it anymore
+  if (sparse_.size() >= sparse_capacity() / 2) {
+    ToDense();
+  }
+}
+
+void HyperLogLog::ToDense() {
+  DCHECK(!is_dense());
+  registers_.assign(size_t{1} << precision_, 0);
+  constexpr uint32_t rank_mask = (1 << kRankBits) - 1;
+  for (uint32_t entry : sparse_) {
+    auto& reg = registers_[entry >> kRankBits];
+    reg = std::max(reg, static_cast<uint8_t>(entry & rank_mask));
+  }
+  sparse_.clear();
+  sparse_.shrink_to_fit();
+}
+
+void HyperLogLog::Reduce(int precision) {
+  DCHECK_LT(precision, precision_);
+  const int shift = precision_ - precision;
+  const uint32_t dropped_mask = (1U << shift) - 1;
+  // The dropped index bits become the leading bits of the rank
+  auto reduce = [&](uint32_t index, uint8_t rank, uint32_t* new_index) -> uint8_t {
+    *new_index = index >> shift;
+    const uint32_t dropped = index & dropped_mask;
+    if (dropped == 0) {
+      return static_cast<uint8_t>(shift + rank);
+    }
+    return static_cast<uint8_t>(bit_util::CountLeadingZeros(dropped) - (32 - shift) + 1);
+  };
+
+  if (is_dense()) {
+    std::vector<uint8_t> registers(size_t{1} << precision, 0);
+    for (uint32_t index = 0; index < registers_.size(); ++index) {
+      if (registers_[index] == 0) continue;
+      uint32_t new_index;
+      uint8_t rank = reduce(index, registers_[index], &new_index);
+      registers[new_index] = std::max(registers[new_index], rank);
+    }
+    registers_ = std::move(registers);
+  } else {
+    constexpr uint32_t rank_mask = (1 << kRankBits) - 1;
+    for (auto& entry : sparse_) {
+      uint32_t new_index;
+      uint8_t rank = reduce(entry >> kRankBits, entry & rank_mask, &new_index);
+      entry = new_index << kRankBits | rank;
+    }
+  }
+  precision_ = precision;
+  if (!is_dense()) {
+    CompactSparse();
+  }
+}
+
+void HyperLogLog::Merge(const HyperLogLog& other) {
+  if (other.precision_ > precision_) {
+    HyperLogLog reduced = other;
+    reduced.Reduce(precision_);
+    Merge(reduced);
+    return;
+  }
+  if (other.precision_ < precision_) {
+    Reduce(other.precision_);
+  }
+
+  if (other.is_dense()) {
+    if (!is_dense()) ToDense();
+    for (size_t i = 0; i < registers_.size(); ++i) {
+      registers_[i] = std::max(registers_[i], other.registers_[i]);
+    }
+  } else if (is_dense()) {
+    constexpr uint32_t rank_mask = (1 << kRankBits) - 1;
+    for (uint32_t entry : other.sparse_) {
+      auto& reg = registers_[entry >> kRankBits];
+      reg = std::max(reg, static_cast<uint8_t>(entry & rank_mask));
+    }
+  } else {
+    sparse_.insert(sparse_.end(), other.sparse_.begin(), other.sparse_.end());
+    CompactSparse();
+  }
+}
+
+std::vector<int64_t> HyperLogLog::RankHistogram() const {
+  const int64_t num_registers = int64_t{1} << precision_;
+  std::vector<int64_t> histogram(64 - precision_ + 2, 0);
+  if (is_dense()) {
+    for (uint8_t reg : registers_) {
+      ++histogram[reg];
+    }
+    return histogram;
+  }
+  HyperLogLog compacted = *this;
+  compacted.CompactSparse();
+  if (compacted.is_dense()) {
+    return compacted.RankHistogram();
+  }
+  constexpr uint32_t rank_mask = (1 << kRankBits) - 1;
+  for (uint32_t entry : compacted.sparse_) {
+    ++histogram[entry & rank_mask];
+  }
+  histogram[0] = num_registers - static_cast<int64_t>(compacted.sparse_.size());
+  return histogram;
+}
+
+int64_t HyperLogLog::Estimate() const {
+  const double m = static_cast<double>(int64_t{1} << precision_);
+  const int q = 64 - precision_;
+  const auto histogram = RankHistogram();
+
+  double z = m * Tau(1 - histogram[q + 1] / m);
+  for (int k = q; k >= 1; --k) {
+    z = 0.5 * (z + histogram[k]);
+  }
+  z += m * Sigma(histogram[0] / m);
+  // alpha_inf = 1 / (2 * ln(2))
+  constexpr double kAlphaInf = 0.7213475204444817;
+  return std::llround(kAlphaInf * m * m / z);
+}
+
+std::string HyperLogLog::Serialize() const {
+  HyperLogLog compacted = *this;
+  if (!compacted.is_dense()) {
+    compacted.CompactSparse();
+  }
+
+  std::string out;
+  out.push_back(static_cast<char>(kFormatVersion));
+  out.push_back(static_cast<char>(precision_));
+  if (compacted.is_dense()) {
+    out.push_back(static_cast<char>(kDenseEncoding));
+    out.append(reinterpret_cast<const char*>(compacted.registers_.data()),
+               compacted.registers_.size());
+  } else {
+    out.push_back(static_cast<char>(kSparseEncoding));
+    const auto num_entries = static_cast<uint32_t>(compacted.sparse_.size());
+    out.resize(kHeaderSize + sizeof(uint32_t) * (1 + num_entries));
+    char* data = out.data() + kHeaderSize;
+    util::SafeStore(data, bit_util::ToLittleEndian(num_entries));
+    for (uint32_t i = 0; i < num_entries; ++i) {
+      util::SafeStore(data + sizeof(uint32_t) * (i + 1),
+                      bit_util::ToLittleEndian(compacted.sparse_[i]));
+    }
+  }
+  return out;
+}
+
+Result<HyperLogLog> HyperLogLog::Deserialize(std::string_view data) {
+  auto invalid = [&](const char* reason) {
+    return Status::Invalid("Invalid HyperLogLog sketch: ", reason);
+  };
+  if (static_cast<int64_t>(data.size()) < kHeaderSize) {
+    return invalid("too short");
+  }
+  if (static_cast<uint8_t>(data[0]) != kFormatVersion) {
+    return invalid("unsupported version");
+  }
+  const int precision = static_cast<uint8_t>(data[1]);
+  if (precision < kMinPrecision || precision > kMaxPrecision) {
+    return invalid("precision out of range");
+  }
+  HyperLogLog hll(precision);
+  const uint8_t max_rank = static_cast<uint8_t>(64 - precision + 1);
+  const size_t num_registers = size_t{1} << precision;
+  const uint8_t encoding = static_cast<uint8_t>(data[2]);
+  data.remove_prefix(kHeaderSize);
+
+  if (encoding == kDenseEncoding) {
+    if (data.size() != num_registers) {
+      return invalid("wrong number of registers");
+    }
+    hll.registers_.assign(data.begin(), data.end());
+    for (uint8_t reg : hll.registers_) {
+      if (reg > max_rank) return invalid("register out of range");
+    }
+    return hll;
+  }
+  if (encoding != kSparseEncoding) {
+    return invalid("unknown encoding");
+  }
+  if (data.size() < sizeof(uint32_t)) {
+    return invalid("too short");
+  }
+  const auto* bytes = reinterpret_cast<const uint8_t*>(data.data());
+  const uint32_t num_entries =
+      bit_util::FromLittleEndian(util::SafeLoadAs<uint32_t>(bytes));
+  if (data.size() != sizeof(uint32_t) * (static_cast<size_t>(num_entries) + 1)) {
+    return invalid("wrong number of entries");
+  }
+  hll.sparse_.resize(num_entries);
+  constexpr uint32_t rank_mask = (1 << kRankBits) - 1;
+  for (uint32_t i = 0; i < num_entries; ++i) {
+    const uint32_t entry = bit_util::FromLittleEndian(
+        util::SafeLoadAs<uint32_t>(bytes + sizeof(uint32_t) * (i + 1)));
+    if ((entry >> kRankBits) >= num_registers || (entry & rank_mask) > max_rank) {
+      return invalid("entry out of range");
+    }
+    hll.sparse_[i] = entry;
+  }
+  hll.CompactSparse();
+  return hll;
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,115 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// approximate count of distinct values with O(1) space, based on 'HyperLogLog in
+// Practice: Algorithmic Engineering of a State of The Art Cardinality Estimation
+// Algorithm' from Heule, Nunkesser & Hall (sparse representation) and 'New
+// cardinality estimation algorithms for HyperLogLog sketches' from Ertl (estimator)
+// - https://research.google/pubs/pub40671/
+// - https://arxiv.org/abs/1702.01284
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+class ARROW_EXPORT HyperLogLog {
+ public:
+  static constexpr int kMinPrecision = 4;
+  static constexpr int kMaxPrecision = 18;
+
+  // precision must be between kMinPrecision and kMaxPrecision; the sketch uses
+  // up to 2^precision bytes and has a relative standard error of about
+  // 1.04 / sqrt(2^precision)
+  explicit HyperLogLog(int precision = 14);
+
+  int precision() const { return precision_; }
+
+  // whether the registers are materialized (otherwise the sketch only stores
+  // the registers that were set, which is much smaller for small cardinalities)
+  bool is_dense() const { return !registers_.empty(); }
+
+  // add a 64-bit hash of a value; the hash must be well mixed, see HashBytes()
+  void Add(uint64_t hash) {
+    const auto index = static_cast<uint32_t>(hash >> (64 - precision_));
+    const uint8_t rank = Rank(hash << precision_);
+    if (is_dense()) {
+      if (registers_[index] < rank) registers_[index] = rank;
+    } else {
+      AddSparse(index, rank);
+    }
+  }
+
+  // merge another sketch into this one; if the precisions differ, the result
+  // has the lower precision of the two
+  void Merge(const HyperLogLog& other);
+
+  // estimated number of distinct values added to the sketch
+  int64_t Estimate() const;
+
+  // binary representation that can be persisted and deserialized to merge later
+  std::string Serialize() const;
+  static Result<HyperLogLog> Deserialize(std::string_view data);
+
+  // hash of a value in the form expected by Add(); the hash only depends on the
+  // bytes, so it is stable across processes
+  static uint64_t HashBytes(const void* data, int64_t length);
+
+ private:
+  static constexpr int kRankBits = 6;
+
+  uint8_t Rank(uint64_t w) const {
+    const int max_rank = 64 - precision_ + 1;
+    return static_cast<uint8_t>(w == 0 ? max_rank
+                                       : std::min(bit_util::CountLeadingZeros(w) + 1,
+                                                  max_rank));
+  }
+
+  void AddSparse(uint32_t index, uint8_t rank) {
+    sparse_.push_back(index << kRankBits | rank);
+    if (sparse_.size() >= sparse_capacity()) CompactSparse();
+  }
+  size_t sparse_capacity() const { return (size_t{1} << precision_) / 4; }
+
+  // sort and deduplicate the sparse entries, converting to dense if too many
+  void CompactSparse();
+  void ToDense();
+  // reduce to a lower precision, as if the values had been added at that precision
+  void Reduce(int precision);
+  // histogram of register values, indexed by rank
+  std::vector<int64_t> RankHistogram() const;
+
+  int precision_;
+  // dense registers, one byte per register, empty if sparse
+  std::vector<uint8_t> registers_;
+  // sparse entries encoded as index << kRankBits | rank; may contain duplicates
+  // until compacted
+  std::vector<uint32_t> sparse_;
+};
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,154 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/hyperloglog_internal.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+uint64_t Hash(int64_t value) { return HyperLogLog::HashBytes(&value, sizeof(value)); }
+
+void AddRange(HyperLogLog* hll, int64_t begin, int64_t end) {
+  for (int64_t i = begin; i < end; ++i) {
+    hll->Add(Hash(i));
+  }
+}
+
+// Allow 4 standard errors, plus some slack for tiny counts
+void AssertEstimate(const HyperLogLog& hll, int64_t expected) {
+  const double error = 1.04 / std::sqrt(static_cast<double>(1 << hll.precision()));
+  EXPECT_NEAR(static_cast<double>(hll.Estimate()), static_cast<double>(expected),
+              4 * error * static_cast<double>(expected) + 1)
+      << "precision " << hll.precision();
+}
+
+}  // namespace
+
+TEST(HyperLogLogTest, Empty) {
+  HyperLogLog hll;
+  ASSERT_EQ(hll.Estimate(), 0);
+  ASSERT_FALSE(hll.is_dense());
+}
+
+TEST(HyperLogLogTest, SmallCardinalities) {
+  for (int64_t count : {1, 2, 10, 100, 1000}) {
+    HyperLogLog hll;
+    // Duplicates don't change the estimate
+    AddRange(&hll, 0, count);
+    AddRange(&hll, 0, count);
+    ASSERT_FALSE(hll.is_dense());
+    AssertEstimate(hll, count);
+  }
+}
+
+TEST(HyperLogLogTest, LargeCardinalities) {
+  for (int precision : {HyperLogLog::kMinPrecision, 10, 14, HyperLogLog::kMaxPrecision}) {
+    HyperLogLog hll(precision);
+    for (int64_t count : {10000, 100000, 1000000}) {
+      AddRange(&hll, count / 10, count);
+      AddRange(&hll, 0, count);
+      AssertEstimate(hll, count);
+    }
+    ASSERT_TRUE(hll.is_dense());
+  }
+}
+
+TEST(HyperLogLogTest, Merge) {
+  // sparse + sparse, sparse + dense, dense + sparse and dense + dense
+  for (int64_t left : {100, 100000}) {
+    for (int64_t right : {200, 200000}) {
+      HyperLogLog a, b;
+      AddRange(&a, 0, left);
+      // Overlapping ranges
+      AddRange(&b, left / 2, left / 2 + right);
+      a.Merge(b);
+      AssertEstimate(a, std::max(left, left / 2 + right));
+    }
+  }
+}
+
+TEST(HyperLogLogTest, MergeDifferentPrecisions) {
+  for (int64_t count : {100, 100000}) {
+    HyperLogLog low(10), high(16);
+    AddRange(&low, 0, count);
+    AddRange(&high, count, 2 * count);
+
+    HyperLogLog merged = high;
+    merged.Merge(low);
+    ASSERT_EQ(merged.precision(), 10);
+    AssertEstimate(merged, 2 * count);
+
+    // Reducing the precision gives the same registers as adding at that precision
+    HyperLogLog expected(10);
+    AddRange(&expected, 0, 2 * count);
+    ASSERT_EQ(merged.Serialize(), expected.Serialize());
+
+    low.Merge(high);
+    ASSERT_EQ(low.Serialize(), expected.Serialize());
+  }
+}
+
+TEST(HyperLogLogTest, SerializeRoundtrip) {
+  for (int64_t count : {0, 10, 100000}) {
+    HyperLogLog hll(12);
+    AddRange(&hll, 0, count);
+    const std::string serialized = hll.Serialize();
+    ASSERT_OK_AND_ASSIGN(auto deserialized, HyperLogLog::Deserialize(serialized));
+    ASSERT_EQ(deserialized.precision(), 12);
+    ASSERT_EQ(deserialized.Estimate(), hll.Estimate());
+    ASSERT_EQ(deserialized.Serialize(), serialized);
+  }
+  // Sparse sketches are much smaller than dense ones
+  HyperLogLog hll;
+  AddRange(&hll, 0, 10);
+  ASSERT_LT(hll.Serialize().size(), 64);
+}
+
+TEST(HyperLogLogTest, DeserializeInvalid) {
+  HyperLogLog hll(8);
+  AddRange(&hll, 0, 10);
+  const std::string sparse = hll.Serialize();
+  AddRange(&hll, 0, 1000);
+  const std::string dense = hll.Serialize();
+
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(""));
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(sparse.substr(0, sparse.size() - 1)));
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(dense.substr(0, dense.size() - 1)));
+
+  std::string wrong_version = sparse;
+  wrong_version[0] = 42;
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(wrong_version));
+  std::string wrong_precision = sparse;
+  wrong_precision[1] = 30;
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(wrong_precision));
+  std::string wrong_register = dense;
+  wrong_register.back() = 100;
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(wrong_register));
+}
+
+}  // namespace internal
+}  // namespace arrow
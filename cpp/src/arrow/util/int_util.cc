@@ -29,6 +29,7 @@
 #include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/string.h"
@@ -422,6 +423,18 @@ void UpcastInts(const int32_t* source, int64_t* dest, int64_t length) {
 template <typename InputInt, typename OutputInt>
 void TransposeInts(const InputInt* src, OutputInt* dest, int64_t length,
                    const int32_t* transpose_map) {
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  if constexpr (sizeof(InputInt) <= sizeof(int32_t) &&
+                sizeof(OutputInt) <= sizeof(int32_t)) {
+    static const bool use_avx2 = CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX2);
+    if (use_avx2) {
+      const int64_t processed = TransposeIntsAvx2(src, dest, length, transpose_map);
+      src += processed;
+      dest += processed;
+      length -= processed;
+    }
+  }
+#endif
   while (length >= 4) {
     dest[0] = static_cast<OutputInt>(transpose_map[src[0]]);
     dest[1] = static_cast<OutputInt>(transpose_map[src[1]]);
@@ -89,6 +89,16 @@ template <typename InputInt, typename OutputInt>
 ARROW_EXPORT void TransposeInts(const InputInt* source, OutputInt* dest, int64_t length,
                                 const int32_t* transpose_map);
 
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+/// \brief Transpose a prefix of `source` using AVX2 gathers
+///
+/// Only inputs and outputs of at most 32 bits are supported.  Returns the number
+/// of values processed; the caller handles the remaining tail.
+template <typename InputInt, typename OutputInt>
+ARROW_EXPORT int64_t TransposeIntsAvx2(const InputInt* source, OutputInt* dest,
+                                       int64_t length, const int32_t* transpose_map);
+#endif
+
 ARROW_EXPORT
 Status TransposeInts(const DataType& src_type, const DataType& dest_type,
                      const uint8_t* src, uint8_t* dest, int64_t src_offset,
@@ -0,0 +1,101 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <type_traits>
+
+#include "arrow/util/int_util.h"
+#include "arrow/util/simd.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// Load 8 source indices widened to 32 bits
+template <typename InputInt>
+inline __m256i LoadIndices(const InputInt* src) {
+  if constexpr (sizeof(InputInt) == 1) {
+    const __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+    return std::is_signed_v<InputInt> ? _mm256_cvtepi8_epi32(v) : _mm256_cvtepu8_epi32(v);
+  } else if constexpr (sizeof(InputInt) == 2) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    return std::is_signed_v<InputInt> ? _mm256_cvtepi16_epi32(v)
+                                      : _mm256_cvtepu16_epi32(v);
+  } else {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+  }
+}
+
+// Store 8 transposed 32-bit values narrowed to the output width.  Transpose map
+// entries are nonnegative and fit in OutputInt, so unsigned saturation is exact.
+template <typename OutputInt>
+inline void StoreValues(__m256i values, OutputInt* dest) {
+  if constexpr (sizeof(OutputInt) == 1) {
+    __m256i packed = _mm256_packus_epi32(values, values);
+    packed = _mm256_packus_epi16(packed, packed);
+    packed = _mm256_permutevar8x32_epi32(packed,
+                                         _mm256_setr_epi32(0, 4, 0, 0, 0, 0, 0, 0));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dest), _mm256_castsi256_si128(packed));
+  } else if constexpr (sizeof(OutputInt) == 2) {
+    __m256i packed = _mm256_packus_epi32(values, values);
+    packed = _mm256_permute4x64_epi64(packed, 0x08);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), _mm256_castsi256_si128(packed));
+  } else {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), values);
+  }
+}
+
+}  // namespace
+
+template <typename InputInt, typename OutputInt>
+int64_t TransposeIntsAvx2(const InputInt* src, OutputInt* dest, int64_t length,
+                          const int32_t* transpose_map) {
+  constexpr int64_t kBatchSize = 8;
+  const int64_t num_batches = length / kBatchSize;
+  for (int64_t i = 0; i < num_batches; ++i) {
+    const __m256i indices = LoadIndices(src);
+    StoreValues(_mm256_i32gather_epi32(transpose_map, indices, sizeof(int32_t)), dest);
+    src += kBatchSize;
+    dest += kBatchSize;
+  }
+  return num_batches * kBatchSize;
+}
+
+#define INSTANTIATE(SRC, DEST)                                \
+  template ARROW_TEMPLATE_EXPORT int64_t TransposeIntsAvx2( \
+      const SRC* source, DEST* dest, int64_t length, const int32_t* transpose_map);
+
+#define INSTANTIATE_ALL_DEST(DEST) \
+  INSTANTIATE(uint8_t, DEST)       \
+  INSTANTIATE(int8_t, DEST)        \
+  INSTANTIATE(uint16_t, DEST)      \
+  INSTANTIATE(int16_t, DEST)       \
+  INSTANTIATE(uint32_t, DEST)      \
+  INSTANTIATE(int32_t, DEST)
+
+INSTANTIATE_ALL_DEST(uint8_t)
+INSTANTIATE_ALL_DEST(int8_t)
+INSTANTIATE_ALL_DEST(uint16_t)
+INSTANTIATE_ALL_DEST(int16_t)
+INSTANTIATE_ALL_DEST(uint32_t)
+INSTANTIATE_ALL_DEST(int32_t)
+
+#undef INSTANTIATE
+#undef INSTANTIATE_ALL_DEST
+
+}  // namespace internal
+}  // namespace arrow
@@ -389,6 +389,27 @@ TEST(TransposeInts, Int8ToInt64) {
   ASSERT_EQ(dest, std::vector<int64_t>({2222, 4444, 6666, 1111, 4444, 3333}));
 }
 
+TEST(TransposeInts, Narrowing) {
+  // Long enough to exercise the vectorized paths, with a tail
+  constexpr int64_t kLength = 1003;
+  std::vector<int32_t> transpose_map(300);
+  for (size_t i = 0; i < transpose_map.size(); ++i) {
+    transpose_map[i] = static_cast<int32_t>((i * 7) % 256);
+  }
+  std::vector<uint16_t> src(kLength);
+  for (int64_t i = 0; i < kLength; ++i) {
+    src[i] = static_cast<uint16_t>((i * 13) % transpose_map.size());
+  }
+  std::vector<uint8_t> dest(kLength);
+  std::vector<uint8_t> expected(kLength);
+  for (int64_t i = 0; i < kLength; ++i) {
+    expected[i] = static_cast<uint8_t>(transpose_map[src[i]]);
+  }
+
+  TransposeInts(src.data(), dest.data(), kLength, transpose_map.data());
+  ASSERT_EQ(dest, expected);
+}
+
 void BoundsCheckPasses(const std::shared_ptr<DataType>& type,
                        const std::string& indices_json, uint64_t upper_limit) {
   auto indices = ArrayFromJSON(type, indices_json);
@@ -2229,6 +2229,121 @@ Result<int32_t> GetNumAffinityCores() {
 #endif
 }
 
+#if defined(__linux__)
+namespace {
+
+// Parse a Linux CPU list such as "0-3,8,10-11"
+Result<std::vector<int>> ParseCpuList(const std::string& cpu_list) {
+  std::vector<int> cpus;
+  std::stringstream ss(cpu_list);
+  std::string range;
+  while (std::getline(ss, range, ',')) {
+    if (range.empty() || range == "\n") {
+      continue;
+    }
+    int first = 0, last = 0;
+    char dash = 0;
+    std::stringstream range_ss(range);
+    range_ss >> first;
+    if (range_ss.fail()) {
+      return Status::IOError("Invalid CPU list: '", cpu_list, "'");
+    }
+    last = first;
+    if (range_ss >> dash) {
+      if (dash != '-' || !(range_ss >> last) || last < first) {
+        return Status::IOError("Invalid CPU list: '", cpu_list, "'");
+      }
+    }
+    for (int cpu = first; cpu <= last; ++cpu) {
+      cpus.push_back(cpu);
+    }
+  }
+  return cpus;
+}
+
+}  // namespace
+#endif
+
+Result<std::vector<std::vector<int>>> GetNumaNodeCpus() {
+#if defined(__linux__)
+  cpu_set_t mask;
+  if (sched_getaffinity(0, sizeof(mask), &mask) != 0) {
+    return IOErrorFromErrno(errno, "Could not read the CPU affinity.");
+  }
+  const auto is_allowed = [&](int cpu) {
+    return cpu >= 0 && cpu < CPU_SETSIZE && CPU_ISSET(cpu, &mask);
+  };
+
+  std::vector<std::pair<int, std::vector<int>>> nodes;
+  ARROW_ASSIGN_OR_RAISE(auto node_dir,
+                        PlatformFilename::FromString("/sys/devices/system/node"));
+  auto maybe_entries = ListDir(node_dir);
+  if (maybe_entries.ok()) {
+    for (const auto& entry : *maybe_entries) {
+      const std::string name = entry.ToString();
+      if (name.size() <= 4 || name.compare(0, 4, "node") != 0 ||
+          name.find_first_not_of("0123456789", 4) != std::string::npos) {
+        continue;
+      }
+      std::ifstream fp("/sys/devices/system/node/" + name + "/cpulist");
+      std::string cpu_list;
+      if (!std::getline(fp, cpu_list)) {
+        continue;
+      }
+      ARROW_ASSIGN_OR_RAISE(auto cpus, ParseCpuList(cpu_list));
+      cpus.erase(std::remove_if(cpus.begin(), cpus.end(),
+                                [&](int cpu) { return !is_allowed(cpu); }),
+                 cpus.end());
+      if (!cpus.empty()) {
+        nodes.emplace_back(std::stoi(name.substr(4)), std::move(cpus));
+      }
+    }
+  }
+  std::sort(nodes.begin(), nodes.end());
+
+  std::vector<std::vector<int>> result;
+  for (auto& node : nodes) {
+    result.push_back(std::move(node.second));
+  }
+  if (result.empty()) {
+    // Not a NUMA system (or sysfs is not available): a single node with all the
+    // CPUs we can run on
+    result.emplace_back();
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      if (is_allowed(cpu)) {
+        result.back().push_back(cpu);
+      }
+    }
+  }
+  return result;
+#else
+  return Status::NotImplemented("Only implemented for Linux");
+#endif
+}
+
+Status SetCurrentThreadAffinity(const std::vector<int>& cpus) {
+#if defined(__linux__)
+  if (cpus.empty()) {
+    return Status::Invalid("Cannot set an empty CPU affinity");
+  }
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  for (int cpu : cpus) {
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+      return Status::Invalid("Invalid CPU number: ", cpu);
+    }
+    CPU_SET(cpu, &mask);
+  }
+  // With a pid of 0, sched_setaffinity applies to the calling thread
+  if (sched_setaffinity(0, sizeof(mask), &mask) != 0) {
+    return IOErrorFromErrno(errno, "Could not set the CPU affinity.");
+  }
+  return Status::OK();
+#else
+  return Status::NotImplemented("Only implemented for Linux");
+#endif
+}
+
 Result<void*> LoadDynamicLibrary(const char* path) {
 #ifdef _WIN32
   ARROW_ASSIGN_OR_RAISE(auto platform_path, PlatformFilename::FromString(path));
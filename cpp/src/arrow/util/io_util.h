@@ -419,6 +419,21 @@ int64_t GetTotalMemoryBytes();
 /// If a value is returned, it is guaranteed to be greater or equal to one.
 ARROW_EXPORT Result<int32_t> GetNumAffinityCores();
 
+/// \brief Get the CPUs of each NUMA node of the system.
+///
+/// Each entry of the result lists the CPUs of one node, in node order.  Only the
+/// CPUs the current process is allowed to run on are listed, and nodes without any
+/// such CPU are omitted.  On systems without NUMA information a single node
+/// holding all the allowed CPUs is returned.
+///
+/// This is only implemented on Linux.
+ARROW_EXPORT Result<std::vector<std::vector<int>>> GetNumaNodeCpus();
+
+/// \brief Restrict the calling thread to run on the given CPUs.
+///
+/// This is only implemented on Linux.
+ARROW_EXPORT Status SetCurrentThreadAffinity(const std::vector<int>& cpus);
+
 /// \brief Load a dynamic library
 ///
 /// This wraps dlopen() except on Windows, where LoadLibrary() is called.
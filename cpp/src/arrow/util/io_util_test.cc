@@ -22,6 +22,7 @@
 #include <limits>
 #include <mutex>
 #include <optional>
+#include <set>
 #include <sstream>
 #include <thread>
 #include <vector>
@@ -34,6 +35,10 @@
 #  include <unistd.h>
 #endif
 
+#ifdef __linux__
+#  include <sched.h>
+#endif
+
 #include <gmock/gmock-matchers.h>
 #include <gtest/gtest.h>
 
@@ -1134,5 +1139,39 @@ TEST(CpuAffinity, NumberOfCores) {
 #endif
 }
 
+TEST(CpuAffinity, NumaNodeCpus) {
+  auto maybe_nodes = GetNumaNodeCpus();
+#ifdef __linux__
+  ASSERT_OK_AND_ASSIGN(auto nodes, maybe_nodes);
+  ASSERT_GE(nodes.size(), 1);
+  ASSERT_OK_AND_ASSIGN(auto affinity_cores, GetNumAffinityCores());
+  std::set<int> all_cpus;
+  for (const auto& cpus : nodes) {
+    ASSERT_FALSE(cpus.empty());
+    all_cpus.insert(cpus.begin(), cpus.end());
+  }
+  ASSERT_EQ(all_cpus.size(), static_cast<size_t>(affinity_cores));
+#else
+  ASSERT_RAISES(NotImplemented, maybe_nodes);
+#endif
+}
+
+TEST(CpuAffinity, SetCurrentThreadAffinity) {
+#ifdef __linux__
+  ASSERT_OK_AND_ASSIGN(auto nodes, GetNumaNodeCpus());
+  const int cpu = nodes[0][0];
+  std::thread thread([&] {
+    ASSERT_OK(SetCurrentThreadAffinity({cpu}));
+    ASSERT_OK_AND_EQ(1, GetNumAffinityCores());
+    ASSERT_EQ(cpu, sched_getcpu());
+  });
+  thread.join();
+  ASSERT_RAISES(Invalid, SetCurrentThreadAffinity({}));
+  ASSERT_RAISES(Invalid, SetCurrentThreadAffinity({-1}));
+#else
+  ASSERT_RAISES(NotImplemented, SetCurrentThreadAffinity({0}));
+#endif
+}
+
 }  // namespace internal
 }  // namespace arrow
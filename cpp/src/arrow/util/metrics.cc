@@ -0,0 +1,146 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/metrics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "arrow/util/bit_util.h"
+
+namespace arrow {
+namespace util {
+
+namespace detail {
+
+int CurrentMetricShard() {
+  static std::atomic<int> next_shard{0};
+  // Threads are spread round-robin over the shards in order of their first update
+  thread_local const int shard =
+      next_shard.fetch_add(1, std::memory_order_relaxed) % kNumMetricShards;
+  return shard;
+}
+
+}  // namespace detail
+
+int64_t Counter::value() const {
+  int64_t total = 0;
+  for (const Shard& shard : shards_) {
+    total += shard.value.load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+void Counter::Reset() {
+  for (Shard& shard : shards_) shard.value.store(0, std::memory_order_relaxed);
+}
+
+int64_t HistogramSnapshot::BucketUpperBound(int i) {
+  if (i == 0) return 0;
+  if (i >= kNumBuckets - 1) return std::numeric_limits<int64_t>::max();
+  return (int64_t{1} << i) - 1;
+}
+
+int64_t HistogramSnapshot::Quantile(double q) const {
+  if (count == 0) return 0;
+  const auto rank = static_cast<int64_t>(std::ceil(std::clamp(q, 0.0, 1.0) * count));
+  int64_t seen = 0;
+  for (int i = 0; i < kNumBuckets; i++) {
+    seen += buckets[i];
+    if (seen >= std::max<int64_t>(rank, 1)) return BucketUpperBound(i);
+  }
+  return BucketUpperBound(kNumBuckets - 1);
+}
+
+void Histogram::Record(int64_t value) {
+  const int bucket =
+      value < 1 ? 0 : bit_util::NumRequiredBits(static_cast<uint64_t>(value));
+  Shard& shard = shards_[detail::CurrentMetricShard()];
+  shard.sum.fetch_add(std::max<int64_t>(value, 0), std::memory_order_relaxed);
+  shard.buckets[std::min(bucket, HistogramSnapshot::kNumBuckets - 1)].fetch_add(
+      1, std::memory_order_relaxed);
+}
+
+HistogramSnapshot Histogram::snapshot() const {
+  HistogramSnapshot result;
+  for (const Shard& shard : shards_) {
+    result.sum += shard.sum.load(std::memory_order_relaxed);
+    for (int i = 0; i < HistogramSnapshot::kNumBuckets; i++) {
+      const int64_t bucket_count = shard.buckets[i].load(std::memory_order_relaxed);
+      result.buckets[i] += bucket_count;
+      result.count += bucket_count;
+    }
+  }
+  return result;
+}
+
+void Histogram::Reset() {
+  for (Shard& shard : shards_) {
+    shard.sum.store(0, std::memory_order_relaxed);
+    for (auto& bucket : shard.buckets) bucket.store(0, std::memory_order_relaxed);
+  }
+}
+
+MetricsRegistry::MetricsRegistry() = default;
+
+MetricsRegistry::~MetricsRegistry() = default;
+
+MetricsRegistry* MetricsRegistry::Global() {
+  // Leaked on purpose so that metrics can be updated during static destruction
+  static auto* registry = new MetricsRegistry();
+  return registry;
+}
+
+Counter* MetricsRegistry::GetCounter(std::string_view name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = counters_.find(name);
+  if (it == counters_.end()) {
+    it = counters_.emplace(std::string(name), std::make_unique<Counter>()).first;
+  }
+  return it->second.get();
+}
+
+Histogram* MetricsRegistry::GetHistogram(std::string_view name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = histograms_.find(name);
+  if (it == histograms_.end()) {
+    it = histograms_.emplace(std::string(name), std::make_unique<Histogram>()).first;
+  }
+  return it->second.get();
+}
+
+MetricsSnapshot MetricsRegistry::Snapshot() const {
+  MetricsSnapshot snapshot;
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto& [name, counter] : counters_) {
+    snapshot.counters[name] = counter->value();
+  }
+  for (const auto& [name, histogram] : histograms_) {
+    snapshot.histograms[name] = histogram->snapshot();
+  }
+  return snapshot;
+}
+
+void MetricsRegistry::Reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto& [_, counter] : counters_) counter->Reset();
+  for (auto& [_, histogram] : histograms_) histogram->Reset();
+}
+
+}  // namespace util
+}  // namespace arrow
@@ -0,0 +1,153 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace util {
+
+/// \defgroup metrics Always-on metrics
+///
+/// Counters and histograms cheap enough to be updated unconditionally on hot
+/// paths (I/O requests, page decoding, kernel execution...), unlike tracing.
+/// Updates go to per-thread shards of relaxed atomics, which are only summed
+/// when the metrics are read.
+///
+/// EXPERIMENTAL
+///
+/// @{
+
+namespace detail {
+
+constexpr int kNumMetricShards = 16;
+
+/// Return the shard that the calling thread updates
+ARROW_EXPORT int CurrentMetricShard();
+
+}  // namespace detail
+
+/// \brief A monotonically increasing count
+class ARROW_EXPORT Counter {
+ public:
+  void Add(int64_t value = 1) {
+    shards_[detail::CurrentMetricShard()].value.fetch_add(value,
+                                                           std::memory_order_relaxed);
+  }
+
+  /// \brief The sum of all the values added since creation or the last Reset()
+  int64_t value() const;
+
+  void Reset();
+
+ private:
+  struct alignas(64) Shard {
+    std::atomic<int64_t> value{0};
+  };
+  std::array<Shard, detail::kNumMetricShards> shards_;
+};
+
+/// \brief A point-in-time view of a Histogram
+struct ARROW_EXPORT HistogramSnapshot {
+  static constexpr int kNumBuckets = 64;
+
+  /// \brief The number of values recorded
+  int64_t count = 0;
+  /// \brief The sum of the values recorded
+  int64_t sum = 0;
+  /// \brief The number of values in each bucket.  Bucket 0 holds the values
+  /// less than 1, bucket i > 0 the values in [2^(i-1), 2^i).
+  std::array<int64_t, kNumBuckets> buckets{};
+
+  /// \brief The inclusive upper bound of the values of bucket `i`
+  static int64_t BucketUpperBound(int i);
+
+  double mean() const { return count == 0 ? 0.0 : static_cast<double>(sum) / count; }
+
+  /// \brief An upper bound of the `q`-quantile (0 <= q <= 1) of the values, with
+  /// the resolution of the buckets
+  int64_t Quantile(double q) const;
+};
+
+/// \brief A distribution of non-negative values (sizes, latencies in
+/// microseconds, queue depths...) over exponential buckets
+class ARROW_EXPORT Histogram {
+ public:
+  void Record(int64_t value);
+
+  HistogramSnapshot snapshot() const;
+
+  void Reset();
+
+ private:
+  struct alignas(64) Shard {
+    std::atomic<int64_t> sum{0};
+    std::array<std::atomic<int64_t>, HistogramSnapshot::kNumBuckets> buckets{};
+  };
+  std::array<Shard, detail::kNumMetricShards> shards_;
+};
+
+/// \brief The values of all the metrics of a registry at some point in time
+struct ARROW_EXPORT MetricsSnapshot {
+  std::map<std::string, int64_t> counters;
+  std::map<std::string, HistogramSnapshot> histograms;
+};
+
+/// \brief A set of named metrics
+///
+/// Metrics are created on first use and live as long as the registry, so the
+/// pointers returned can be cached (e.g. in a function-local static) to avoid
+/// the name lookup on hot paths.  Names are dot-separated, starting with the
+/// component that updates them, e.g. "io.read_range_cache.hits".
+class ARROW_EXPORT MetricsRegistry {
+ public:
+  MetricsRegistry();
+  ~MetricsRegistry();
+
+  /// \brief The registry that Arrow's own metrics are reported to
+  static MetricsRegistry* Global();
+
+  Counter* GetCounter(std::string_view name);
+  Histogram* GetHistogram(std::string_view name);
+
+  /// \brief Read the current value of all metrics
+  MetricsSnapshot Snapshot() const;
+
+  /// \brief Reset all metrics to zero
+  void Reset();
+
+ private:
+  mutable std::mutex mutex_;
+  std::map<std::string, std::unique_ptr<Counter>, std::less<>> counters_;
+  std::map<std::string, std::unique_ptr<Histogram>, std::less<>> histograms_;
+};
+
+/// @}
+
+}  // namespace util
+}  // namespace arrow
@@ -0,0 +1,112 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/util/metrics.h"
+
+namespace arrow::util {
+
+TEST(Counter, Basics) {
+  Counter counter;
+  ASSERT_EQ(counter.value(), 0);
+  counter.Add();
+  counter.Add(41);
+  ASSERT_EQ(counter.value(), 42);
+  counter.Reset();
+  ASSERT_EQ(counter.value(), 0);
+}
+
+TEST(Counter, ConcurrentAdds) {
+  constexpr int kNumThreads = 8;
+  constexpr int kAddsPerThread = 10000;
+  Counter counter;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; i++) {
+    threads.emplace_back([&] {
+      for (int j = 0; j < kAddsPerThread; j++) counter.Add();
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  ASSERT_EQ(counter.value(), kNumThreads * kAddsPerThread);
+}
+
+TEST(Histogram, Buckets) {
+  Histogram histogram;
+  for (int64_t value : {-5, 0, 1, 2, 3, 4, 1000}) {
+    histogram.Record(value);
+  }
+  HistogramSnapshot snapshot = histogram.snapshot();
+  ASSERT_EQ(snapshot.count, 7);
+  ASSERT_EQ(snapshot.sum, 1010);
+  ASSERT_EQ(snapshot.buckets[0], 2);  // -5, 0
+  ASSERT_EQ(snapshot.buckets[1], 1);  // 1
+  ASSERT_EQ(snapshot.buckets[2], 2);  // 2, 3
+  ASSERT_EQ(snapshot.buckets[3], 1);  // 4
+  ASSERT_EQ(snapshot.buckets[10], 1);  // 1000
+  ASSERT_EQ(HistogramSnapshot::BucketUpperBound(0), 0);
+  ASSERT_EQ(HistogramSnapshot::BucketUpperBound(2), 3);
+  ASSERT_EQ(HistogramSnapshot::BucketUpperBound(10), 1023);
+
+  histogram.Reset();
+  ASSERT_EQ(histogram.snapshot().count, 0);
+}
+
+TEST(Histogram, Quantiles) {
+  Histogram histogram;
+  ASSERT_EQ(histogram.snapshot().Quantile(0.5), 0);
+  for (int64_t value = 1; value <= 100; value++) {
+    histogram.Record(value);
+  }
+  HistogramSnapshot snapshot = histogram.snapshot();
+  ASSERT_DOUBLE_EQ(snapshot.mean(), 50.5);
+  ASSERT_EQ(snapshot.Quantile(0.0), 1);
+  // The 50th value (50) is in the [32, 64) bucket
+  ASSERT_EQ(snapshot.Quantile(0.5), 63);
+  ASSERT_EQ(snapshot.Quantile(1.0), 127);
+}
+
+TEST(MetricsRegistry, SnapshotAndReset) {
+  MetricsRegistry registry;
+  Counter* counter = registry.GetCounter("test.counter");
+  ASSERT_EQ(registry.GetCounter("test.counter"), counter);
+  Histogram* histogram = registry.GetHistogram("test.histogram");
+  ASSERT_EQ(registry.GetHistogram("test.histogram"), histogram);
+
+  counter->Add(3);
+  histogram->Record(5);
+  MetricsSnapshot snapshot = registry.Snapshot();
+  ASSERT_EQ(snapshot.counters.size(), 1);
+  ASSERT_EQ(snapshot.counters["test.counter"], 3);
+  ASSERT_EQ(snapshot.histograms.size(), 1);
+  ASSERT_EQ(snapshot.histograms["test.histogram"].count, 1);
+  ASSERT_EQ(snapshot.histograms["test.histogram"].sum, 5);
+
+  registry.Reset();
+  snapshot = registry.Snapshot();
+  ASSERT_EQ(snapshot.counters["test.counter"], 0);
+  ASSERT_EQ(snapshot.histograms["test.histogram"].count, 0);
+}
+
+TEST(MetricsRegistry, Global) {
+  ASSERT_EQ(MetricsRegistry::Global(), MetricsRegistry::Global());
+}
+
+}  // namespace arrow::util
@@ -0,0 +1,70 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/rle_encoding_internal.h"
+
+#include <array>
+
+#include "arrow/util/dispatch_internal.h"
+
+namespace arrow::util::internal {
+
+namespace {
+
+template <typename Uint>
+void GatherDictionaryScalar(const Uint* dictionary, const int32_t* indices,
+                            rle_size_t length, Uint* out) {
+  for (rle_size_t i = 0; i < length; ++i) {
+    out[i] = dictionary[indices[i]];
+  }
+}
+
+template <typename Uint>
+struct GatherDictionaryDynamicFunction {
+  using FunctionType = decltype(&GatherDictionaryScalar<Uint>);
+  using Implementation = std::pair<::arrow::internal::DispatchLevel, FunctionType>;
+
+  static constexpr auto implementations() {
+    using ::arrow::internal::DispatchLevel;
+    return std::array{
+        Implementation{DispatchLevel::NONE, &GatherDictionaryScalar<Uint>},
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+        Implementation{DispatchLevel::AVX2, &GatherDictionaryAvx2<Uint>},
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+        Implementation{DispatchLevel::AVX512, &GatherDictionaryAvx512<Uint>},
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+template <typename Uint>
+void GatherDictionary(const Uint* dictionary, const int32_t* indices, rle_size_t length,
+                      Uint* out) {
+  static ::arrow::internal::DynamicDispatch<GatherDictionaryDynamicFunction<Uint>>
+      dispatch;
+  return dispatch.func(dictionary, indices, length, out);
+}
+
+template void GatherDictionary<uint32_t>(const uint32_t*, const int32_t*, rle_size_t,
+                                         uint32_t*);
+template void GatherDictionary<uint64_t>(const uint64_t*, const int32_t*, rle_size_t,
+                                         uint64_t*);
+
+}  // namespace arrow::util::internal
@@ -22,6 +22,8 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
+#include <cstring>
 #include <limits>
 #include <type_traits>
 #include <variant>
@@ -32,6 +34,7 @@
 #include "arrow/util/bpacking_internal.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
 
 namespace arrow::util {
 
@@ -949,8 +952,9 @@ auto RunGetSpaced(Converter* converter, typename Converter::out_type* out,
     // buffer to benefit from unpacking intrinsics and data locality.
     // Quick benchmarking on a linux x86-64 cloud instance show that this previously
     // hard-coded value is appropriate.
+    // The buffer is fully written before being read, don't pay for zeroing it.
     static constexpr rle_size_t kBufferCapacity = 1024;
-    std::array<value_type, kBufferCapacity> buffer = {};
+    std::array<value_type, kBufferCapacity> buffer;
 
     rle_size_t buffer_start = 0;
     rle_size_t buffer_end = 0;
@@ -1167,6 +1171,33 @@ bool IndexInRange(I idx, int32_t dictionary_length) {
   return idx >= 0 && static_cast<T>(idx) < static_cast<T>(dictionary_length);
 }
 
+/// \brief Write `dictionary[indices[i]]` into `out` for `length` indices
+///
+/// The indices must be in range. Uses hardware gathers when available.
+template <typename Uint>
+ARROW_EXPORT void GatherDictionary(const Uint* dictionary, const int32_t* indices,
+                                   rle_size_t length, Uint* out);
+
+extern template ARROW_TEMPLATE_EXPORT void GatherDictionary<uint32_t>(
+    const uint32_t* dictionary, const int32_t* indices, rle_size_t length,
+    uint32_t* out);
+
+extern template ARROW_TEMPLATE_EXPORT void GatherDictionary<uint64_t>(
+    const uint64_t* dictionary, const int32_t* indices, rle_size_t length,
+    uint64_t* out);
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+template <typename Uint>
+void GatherDictionaryAvx2(const Uint* dictionary, const int32_t* indices,
+                          rle_size_t length, Uint* out);
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+template <typename Uint>
+void GatherDictionaryAvx512(const Uint* dictionary, const int32_t* indices,
+                            rle_size_t length, Uint* out);
+#endif
+
 // Converter for GetSpaced that handles runs of returned dictionary
 // indices.
 template <typename V, typename I>
@@ -1177,6 +1208,12 @@ struct DictionaryConverter {
 
   static constexpr bool kIsIdentity = false;
 
+  // Dictionaries of 4 and 8 bytes values (integers, floating point, and
+  // FixedLenByteArray pointers) are decoded with GatherDictionary.
+  static constexpr bool kCanGather =
+      std::is_same_v<in_type, int32_t> && std::is_trivially_copyable_v<out_type> &&
+      (sizeof(out_type) == sizeof(uint32_t) || sizeof(out_type) == sizeof(uint64_t));
+
   const out_type* dictionary;
   size_type dictionary_length;
 
@@ -1205,8 +1242,15 @@ struct DictionaryConverter {
   }
 
   void WriteRange(out_type* out, const in_type* values, size_type length) const {
-    for (size_type x = 0; x < length; x++) {
-      out[x] = dictionary[values[x]];
+    if constexpr (kCanGather) {
+      using Uint =
+          std::conditional_t<sizeof(out_type) == sizeof(uint32_t), uint32_t, uint64_t>;
+      GatherDictionary(reinterpret_cast<const Uint*>(dictionary), values, length,
+                       reinterpret_cast<Uint*>(out));
+    } else {
+      for (size_type x = 0; x < length; x++) {
+        out[x] = dictionary[values[x]];
+      }
     }
   }
 };
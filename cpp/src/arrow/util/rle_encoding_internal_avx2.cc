@@ -0,0 +1,52 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/rle_encoding_internal.h"
+#include "arrow/util/simd.h"
+
+namespace arrow::util::internal {
+
+template <typename Uint>
+void GatherDictionaryAvx2(const Uint* dictionary, const int32_t* indices,
+                          rle_size_t length, Uint* out) {
+  constexpr rle_size_t kBatchSize = sizeof(__m256i) / sizeof(Uint);
+  rle_size_t i = 0;
+  for (; i + kBatchSize <= length; i += kBatchSize) {
+    __m256i values;
+    if constexpr (sizeof(Uint) == sizeof(uint32_t)) {
+      const __m256i idx =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+      values = _mm256_i32gather_epi32(reinterpret_cast<const int*>(dictionary), idx,
+                                      sizeof(Uint));
+    } else {
+      const __m128i idx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i));
+      values = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(dictionary),
+                                      idx, sizeof(Uint));
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), values);
+  }
+  for (; i < length; ++i) {
+    out[i] = dictionary[indices[i]];
+  }
+}
+
+template void GatherDictionaryAvx2<uint32_t>(const uint32_t*, const int32_t*, rle_size_t,
+                                             uint32_t*);
+template void GatherDictionaryAvx2<uint64_t>(const uint64_t*, const int32_t*, rle_size_t,
+                                             uint64_t*);
+
+}  // namespace arrow::util::internal
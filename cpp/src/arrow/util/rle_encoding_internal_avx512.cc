@@ -0,0 +1,63 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/rle_encoding_internal.h"
+#include "arrow/util/simd.h"
+
+namespace arrow::util::internal {
+
+template <typename Uint>
+void GatherDictionaryAvx512(const Uint* dictionary, const int32_t* indices,
+                            rle_size_t length, Uint* out) {
+  constexpr rle_size_t kBatchSize = sizeof(__m512i) / sizeof(Uint);
+  rle_size_t i = 0;
+  for (; i + kBatchSize <= length; i += kBatchSize) {
+    __m512i values;
+    if constexpr (sizeof(Uint) == sizeof(uint32_t)) {
+      const __m512i idx = _mm512_loadu_si512(indices + i);
+      values = _mm512_i32gather_epi32(idx, dictionary, sizeof(Uint));
+    } else {
+      const __m256i idx =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+      values = _mm512_i32gather_epi64(idx, dictionary, sizeof(Uint));
+    }
+    _mm512_storeu_si512(out + i, values);
+  }
+  if (i < length) {
+    // Masked gather of the tail
+    const auto mask = static_cast<__mmask16>((1U << (length - i)) - 1);
+    if constexpr (sizeof(Uint) == sizeof(uint32_t)) {
+      const __m512i idx = _mm512_maskz_loadu_epi32(mask, indices + i);
+      const __m512i values = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask,
+                                                         idx, dictionary, sizeof(Uint));
+      _mm512_mask_storeu_epi32(out + i, mask, values);
+    } else {
+      const auto mask8 = static_cast<__mmask8>(mask);
+      const __m256i idx = _mm256_maskz_loadu_epi32(mask8, indices + i);
+      const __m512i values = _mm512_mask_i32gather_epi64(_mm512_setzero_si512(), mask8,
+                                                         idx, dictionary, sizeof(Uint));
+      _mm512_mask_storeu_epi64(out + i, mask8, values);
+    }
+  }
+}
+
+template void GatherDictionaryAvx512<uint32_t>(const uint32_t*, const int32_t*,
+                                               rle_size_t, uint32_t*);
+template void GatherDictionaryAvx512<uint64_t>(const uint64_t*, const int32_t*,
+                                               rle_size_t, uint64_t*);
+
+}  // namespace arrow::util::internal
@@ -1280,4 +1280,34 @@ TEST(RleBitPacked, GetBatchSpacedRoundtripUint64) {
   DoTestGetBatchSpacedRoundtrip<uint64_t>();
 }
 
+template <typename Uint>
+void DoTestGatherDictionary() {
+  std::default_random_engine gen(42);
+  std::vector<Uint> dictionary(37);
+  for (auto& value : dictionary) {
+    value = static_cast<Uint>(gen());
+  }
+  std::uniform_int_distribution<int32_t> index_dist(
+      0, static_cast<int32_t>(dictionary.size()) - 1);
+
+  // Cover the SIMD batches and the remainders
+  for (rle_size_t length = 0; length < 100; ++length) {
+    std::vector<int32_t> indices(length);
+    for (auto& index : indices) {
+      index = index_dist(gen);
+    }
+    std::vector<Uint> out(length + 1, 0);
+    internal::GatherDictionary(dictionary.data(), indices.data(), length, out.data());
+    for (rle_size_t i = 0; i < length; ++i) {
+      ASSERT_EQ(out[i], dictionary[indices[i]]) << "at position " << i;
+    }
+    ASSERT_EQ(out[length], 0) << "wrote past the end for length " << length;
+  }
+}
+
+TEST(RleBitPacked, GatherDictionary) {
+  DoTestGatherDictionary<uint32_t>();
+  DoTestGatherDictionary<uint64_t>();
+}
+
 }  // namespace arrow::util
@@ -22,12 +22,18 @@
 #include <iostream>
 #include <limits>
 #include <queue>
+#include <string>
+#include <string_view>
 #include <tuple>
+#include <type_traits>
 #include <vector>
 
+#include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/math_constants.h"
+#include "arrow/util/ubsan.h"
 
 namespace arrow {
 namespace internal {
@@ -341,7 +347,74 @@ class TDigest::TDigestImpl {
 
   double total_weight() const { return total_weight_; }
 
+  void Serialize(std::string* out) const {
+    const auto& td = tdigests_[current_];
+    auto append = [&](auto value) {
+      value = bit_util::ToLittleEndian(value);
+      out->append(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    out->reserve(kSerializedHeaderSize + td.size() * 2 * sizeof(double));
+    out->push_back(static_cast<char>(kSerializedVersion));
+    append(delta_);
+    append(min_);
+    append(max_);
+    append(static_cast<uint32_t>(td.size()));
+    for (const auto& centroid : td) {
+      append(centroid.mean);
+      append(centroid.weight);
+    }
+  }
+
+  Status Deserialize(std::string_view data) {
+    if (data.size() < kSerializedHeaderSize) {
+      return Status::Invalid("Invalid tdigest: too short");
+    }
+    const auto* bytes = reinterpret_cast<const uint8_t*>(data.data());
+    auto load = [&](auto* value) {
+      using T = std::decay_t<decltype(*value)>;
+      *value = bit_util::FromLittleEndian(util::SafeLoadAs<T>(bytes));
+      bytes += sizeof(T);
+    };
+    if (*bytes++ != kSerializedVersion) {
+      return Status::Invalid("Invalid tdigest: unsupported version");
+    }
+    uint32_t delta, num_centroids;
+    load(&delta);
+    if (delta != delta_) {
+      return Status::Invalid("Invalid tdigest: delta mismatch");
+    }
+    load(&min_);
+    load(&max_);
+    load(&num_centroids);
+    if (num_centroids > delta_) {
+      return Status::Invalid("Invalid tdigest: too many centroids");
+    }
+    if (data.size() !=
+        kSerializedHeaderSize + size_t{num_centroids} * 2 * sizeof(double)) {
+      return Status::Invalid("Invalid tdigest: wrong size");
+    }
+    auto& td = tdigests_[current_];
+    td.resize(num_centroids);
+    total_weight_ = 0;
+    for (auto& centroid : td) {
+      load(&centroid.mean);
+      load(&centroid.weight);
+      total_weight_ += centroid.weight;
+    }
+    if (num_centroids > 0 && !(min_ <= td.front().mean && td.back().mean <= max_)) {
+      return Status::Invalid("Invalid tdigest: min or max out of range");
+    }
+    return Validate();
+  }
+
+  uint32_t delta() const { return delta_; }
+
  private:
+  static constexpr uint8_t kSerializedVersion = 1;
+  // version, delta, min, max, number of centroids
+  static constexpr size_t kSerializedHeaderSize =
+      1 + sizeof(uint32_t) + 2 * sizeof(double) + sizeof(uint32_t);
+
   // must be declared before merger_, see constructor initialization list
   const uint32_t delta_;
 
@@ -411,6 +484,32 @@ bool TDigest::is_empty() const {
   return input_.size() == 0 && impl_->total_weight() == 0;
 }
 
+double TDigest::total_weight() const {
+  return impl_->total_weight() + static_cast<double>(input_.size());
+}
+
+std::string TDigest::Serialize() const {
+  MergeInput();
+  std::string out;
+  impl_->Serialize(&out);
+  return out;
+}
+
+Result<TDigest> TDigest::Deserialize(std::string_view data, uint32_t buffer_size) {
+  if (data.size() < 1 + sizeof(uint32_t)) {
+    return Status::Invalid("Invalid tdigest: too short");
+  }
+  const auto delta = bit_util::FromLittleEndian(
+      util::SafeLoadAs<uint32_t>(reinterpret_cast<const uint8_t*>(data.data()) + 1));
+  // delta sizes the centroid buffers, bound it before allocating them
+  if (delta < 10 || delta > (1 << 20)) {
+    return Status::Invalid("Invalid tdigest: delta out of range");
+  }
+  TDigest tdigest(delta, buffer_size);
+  RETURN_NOT_OK(tdigest.impl_->Deserialize(data));
+  return tdigest;
+}
+
 void TDigest::MergeInput() const {
   if (input_.size() > 0) {
     impl_->MergeInput(input_);  // will mutate input_
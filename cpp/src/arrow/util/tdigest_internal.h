@@ -24,6 +24,8 @@
 
 #include <cmath>
 #include <memory>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include "arrow/util/logging.h"
@@ -33,6 +35,8 @@
 namespace arrow {
 
 class Status;
+template <typename T>
+class Result;
 
 namespace internal {
 
@@ -88,6 +92,15 @@ class ARROW_EXPORT TDigest {
   // check if this tdigest contains no valid data points
   bool is_empty() const;
 
+  // total weight, i.e. number of data points summarized by this tdigest
+  double total_weight() const;
+
+  // serialize to a portable binary representation, buffered input is merged first
+  std::string Serialize() const;
+
+  // reconstruct a tdigest from the output of Serialize()
+  static Result<TDigest> Deserialize(std::string_view data, uint32_t buffer_size = 500);
+
  private:
   // merge input data with current tdigest
   void MergeInput() const;
@@ -26,6 +26,7 @@
 #include <algorithm>
 #include <cmath>
 #include <numeric>
+#include <string>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -287,5 +288,68 @@ TEST(TDigestTest, Misc) {
   }
 }
 
+TEST(TDigestTest, SerializeRoundtrip) {
+  const std::vector<double> quantiles = {0, 0.01, 0.1, 0.5, 0.9, 0.99, 1};
+  std::vector<double> values;
+  random_real(50000, 0x11223344, -1000.0, 1000.0, &values);
+
+  for (size_t size : {size_t{0}, size_t{1}, size_t{7}, values.size()}) {
+    ARROW_SCOPED_TRACE("size = ", size);
+    TDigest td(/*delta=*/50);
+    for (size_t i = 0; i < size; ++i) {
+      td.Add(values[i]);
+    }
+    ASSERT_OK_AND_ASSIGN(TDigest roundtripped, TDigest::Deserialize(td.Serialize()));
+    ASSERT_OK(roundtripped.Validate());
+    ASSERT_EQ(roundtripped.is_empty(), size == 0);
+    ASSERT_EQ(roundtripped.total_weight(), static_cast<double>(size));
+    for (double q : quantiles) {
+      if (size == 0) {
+        EXPECT_TRUE(std::isnan(roundtripped.Quantile(q)));
+      } else {
+        EXPECT_EQ(roundtripped.Quantile(q), td.Quantile(q)) << q;
+      }
+    }
+    ASSERT_EQ(roundtripped.Serialize(), td.Serialize());
+
+    // A deserialized tdigest accepts more data and merges
+    roundtripped.Add(1e6);
+    roundtripped.Merge(td);
+    ASSERT_OK(roundtripped.Validate());
+    ASSERT_EQ(roundtripped.total_weight(), static_cast<double>(2 * size + 1));
+    EXPECT_EQ(roundtripped.Max(), 1e6);
+  }
+}
+
+TEST(TDigestTest, DeserializeInvalid) {
+  TDigest td(/*delta=*/20);
+  for (double value : {1.0, 2.0, 3.0, 4.0}) {
+    td.Add(value);
+  }
+  const std::string serialized = td.Serialize();
+
+  ASSERT_RAISES(Invalid, TDigest::Deserialize(""));
+  ASSERT_RAISES(Invalid, TDigest::Deserialize(serialized.substr(0, 10)));
+  ASSERT_RAISES(Invalid,
+                TDigest::Deserialize(serialized.substr(0, serialized.size() - 1)));
+  ASSERT_RAISES(Invalid, TDigest::Deserialize(serialized + "x"));
+
+  std::string bad_version = serialized;
+  bad_version[0] = 42;
+  ASSERT_RAISES(Invalid, TDigest::Deserialize(bad_version));
+
+  std::string bad_delta = serialized;
+  bad_delta[1] = 1;
+  ASSERT_RAISES(Invalid, TDigest::Deserialize(bad_delta));
+
+  // Swap the means of the first two centroids so they are no longer sorted
+  std::string unsorted = serialized;
+  const size_t first_centroid = serialized.size() - 4 * 2 * sizeof(double);
+  std::swap_ranges(unsorted.begin() + first_centroid,
+                   unsorted.begin() + first_centroid + sizeof(double),
+                   unsorted.begin() + first_centroid + 2 * sizeof(double));
+  ASSERT_RAISES(Invalid, TDigest::Deserialize(unsorted));
+}
+
 }  // namespace internal
 }  // namespace arrow
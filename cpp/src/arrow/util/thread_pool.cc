@@ -18,10 +18,14 @@
 #include "arrow/util/thread_pool.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <list>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <thread>
 #include <vector>
@@ -30,6 +34,7 @@
 #include "arrow/util/config.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/metrics.h"
 #include "arrow/util/mutex.h"
 
 #include "arrow/util/tracing_internal.h"
@@ -56,6 +61,8 @@ struct QueuedTask {
   Task task;
   int32_t priority;
   uint64_t spawn_index;
+  // Only set by ThreadPool, to measure the time spent in the queue
+  std::chrono::steady_clock::time_point spawn_time{};
 
   // Implement comparison so that std::priority_queue will pop the low priorities more
   // urgently.
@@ -394,6 +401,23 @@ void SerialExecutor::RunLoop() {
 
 #ifdef ARROW_ENABLE_THREADING
 
+// Wrap the task to propagate a parent tracing span to it
+static FnOnce<void()> WithActiveSpan(FnOnce<void()> task) {
+#  ifdef ARROW_WITH_OPENTELEMETRY
+  struct {
+    void operator()() {
+      auto scope = ::arrow::internal::tracing::GetTracer()->WithActiveSpan(activeSpan);
+      std::move(func)();
+    }
+    FnOnce<void()> func;
+    opentelemetry::nostd::shared_ptr<opentelemetry::trace::Span> activeSpan;
+  } wrapper{std::move(task), ::arrow::internal::tracing::GetTracer()->GetCurrentSpan()};
+  return wrapper;
+#  else
+  return task;
+#  endif
+}
+
 struct ThreadPool::State {
   State() = default;
 
@@ -423,6 +447,25 @@ struct ThreadPool::State {
 
   std::vector<std::shared_ptr<Resource>> kept_alive_resources_;
 
+  // CPUs the workers are pinned to (empty if they aren't)
+  std::vector<int> cpu_affinity_;
+
+  // Statistics, see ThreadPoolStats
+  int busy_workers_ = 0;
+  int64_t completed_tasks_ = 0;
+  std::unordered_map<int64_t, int64_t> tasks_per_external_id_;
+  util::Histogram queue_wait_us_;
+  util::Histogram run_time_us_;
+
+  // Global registry metrics the statistics are also reported to (see SetMetricsPrefix)
+  struct RegistryMetrics {
+    util::Histogram* queue_wait_us;
+    util::Histogram* run_time_us;
+    util::Histogram* busy_workers;
+    util::Counter* completed_tasks;
+  };
+  std::optional<RegistryMetrics> registry_metrics_;
+
   // At-fork machinery
 
   void BeforeFork() { mutex_.lock(); }
@@ -433,15 +476,24 @@ struct ThreadPool::State {
     int desired_capacity = desired_capacity_;
     bool please_shutdown = please_shutdown_;
     bool quick_shutdown = quick_shutdown_;
+    std::vector<int> cpu_affinity = cpu_affinity_;
+    std::optional<RegistryMetrics> registry_metrics = registry_metrics_;
     new (this) State;  // force-reinitialize, including synchronization primitives
     desired_capacity_ = desired_capacity;
     please_shutdown_ = please_shutdown;
     quick_shutdown_ = quick_shutdown;
+    cpu_affinity_ = std::move(cpu_affinity);
+    registry_metrics_ = registry_metrics;
   }
 
   std::shared_ptr<AtForkHandler> atfork_handler_;
 };
 
+static int64_t MicrosecondsBetween(std::chrono::steady_clock::time_point start,
+                                   std::chrono::steady_clock::time_point end) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+}
+
 // The worker loop is an independent function so that it can keep running
 // after the ThreadPool is destroyed.
 static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
@@ -472,10 +524,20 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
 
       DCHECK_GE(state->tasks_queued_or_running_, 0);
       {
+        const auto start_time = std::chrono::steady_clock::now();
+        const int64_t queue_wait_us =
+            MicrosecondsBetween(state->pending_tasks_.top().spawn_time, start_time);
         Task task = std::move(const_cast<Task&>(state->pending_tasks_.top().task));
         state->pending_tasks_.pop();
+        const int busy_workers = ++state->busy_workers_;
+        const auto registry_metrics = state->registry_metrics_;
         StopToken* stop_token = &task.stop_token;
         lock.unlock();
+        state->queue_wait_us_.Record(queue_wait_us);
+        if (registry_metrics) {
+          registry_metrics->queue_wait_us->Record(queue_wait_us);
+          registry_metrics->busy_workers->Record(busy_workers);
+        }
         if (!stop_token->IsStopRequested()) {
           std::move(task.callable)();
         } else {
@@ -487,7 +549,16 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
           auto tmp_task = std::move(task);  // release resources before waiting for lock
           ARROW_UNUSED(tmp_task);
         }
+        const int64_t run_time_us =
+            MicrosecondsBetween(start_time, std::chrono::steady_clock::now());
+        state->run_time_us_.Record(run_time_us);
+        if (registry_metrics) {
+          registry_metrics->run_time_us->Record(run_time_us);
+          registry_metrics->completed_tasks->Add();
+        }
         lock.lock();
+        --state->busy_workers_;
+        ++state->completed_tasks_;
       }
       if (ARROW_PREDICT_FALSE(--state->tasks_queued_or_running_ == 0)) {
         state->cv_idle_.notify_all();
@@ -602,6 +673,33 @@ int ThreadPool::GetActualCapacity() {
   return static_cast<int>(state_->workers_.size());
 }
 
+ThreadPoolStats ThreadPool::GetStats() {
+  ThreadPoolStats stats;
+  {
+    std::unique_lock<std::mutex> lock(state_->mutex_);
+    stats.capacity = state_->desired_capacity_;
+    stats.num_workers = static_cast<int>(state_->workers_.size());
+    stats.busy_workers = state_->busy_workers_;
+    stats.queued_tasks = static_cast<int64_t>(state_->pending_tasks_.size());
+    stats.completed_tasks = state_->completed_tasks_;
+    stats.tasks_per_external_id = state_->tasks_per_external_id_;
+  }
+  stats.queue_wait_us = state_->queue_wait_us_.snapshot();
+  stats.run_time_us = state_->run_time_us_.snapshot();
+  return stats;
+}
+
+void ThreadPool::SetMetricsPrefix(std::string_view prefix) {
+  auto* registry = util::MetricsRegistry::Global();
+  const std::string name(prefix);
+  State::RegistryMetrics metrics{registry->GetHistogram(name + ".queue_wait_us"),
+                                 registry->GetHistogram(name + ".run_time_us"),
+                                 registry->GetHistogram(name + ".busy_workers"),
+                                 registry->GetCounter(name + ".completed_tasks")};
+  std::unique_lock<std::mutex> lock(state_->mutex_);
+  state_->registry_metrics_ = metrics;
+}
+
 Status ThreadPool::Shutdown(bool wait) {
   std::unique_lock<std::mutex> lock(state_->mutex_);
 
@@ -642,6 +740,12 @@ void ThreadPool::LaunchWorkersUnlocked(int threads) {
     auto it = --(state_->workers_.end());
     *it = std::thread([this, state, it] {
       current_thread_pool_ = this;
+      if (!state->cpu_affinity_.empty()) {
+        auto st = SetCurrentThreadAffinity(state->cpu_affinity_);
+        if (!st.ok()) {
+          ARROW_LOG(WARNING) << "Failed to pin thread pool worker: " << st.ToString();
+        }
+      }
       WorkerLoop(state, it);
     });
   }
@@ -649,23 +753,13 @@ void ThreadPool::LaunchWorkersUnlocked(int threads) {
 
 Status ThreadPool::SpawnReal(TaskHints hints, FnOnce<void()> task, StopToken stop_token,
                              StopCallback&& stop_callback) {
+  static util::Histogram* queue_depth =
+      util::MetricsRegistry::Global()->GetHistogram("thread_pool.queue_depth");
   {
-#  ifdef ARROW_WITH_OPENTELEMETRY
-    // Wrap the task to propagate a parent tracing span to it
     // This task-wrapping needs to be done before we grab the mutex because the
     // first call to OT (whatever that happens to be) will attempt to grab this mutex
     // when calling KeepAlive to keep the OT infrastructure alive.
-    struct {
-      void operator()() {
-        auto scope = ::arrow::internal::tracing::GetTracer()->WithActiveSpan(activeSpan);
-        std::move(func)();
-      }
-      FnOnce<void()> func;
-      opentelemetry::nostd::shared_ptr<opentelemetry::trace::Span> activeSpan;
-    } wrapper{std::forward<FnOnce<void()>>(task),
-              ::arrow::internal::tracing::GetTracer()->GetCurrentSpan()};
-    task = std::move(wrapper);
-#  endif
+    task = WithActiveSpan(std::move(task));
     std::lock_guard<std::mutex> lock(state_->mutex_);
     if (state_->please_shutdown_) {
       return Status::Invalid("operation forbidden during or after shutdown");
@@ -677,10 +771,15 @@ Status ThreadPool::SpawnReal(TaskHints hints, FnOnce<void()> task, StopToken sto
       // We can still spin up more workers so spin up a new worker
       LaunchWorkersUnlocked(/*threads=*/1);
     }
+    if (hints.external_id >= 0) {
+      ++state_->tasks_per_external_id_[hints.external_id];
+    }
     state_->pending_tasks_.push(
         QueuedTask{{std::move(task), std::move(stop_token), std::move(stop_callback)},
                    hints.priority,
-                   state_->spawned_tasks_count_++});
+                   state_->spawned_tasks_count_++,
+                   std::chrono::steady_clock::now()});
+    queue_depth->Record(static_cast<int64_t>(state_->pending_tasks_.size()));
   }
   state_->cv_.notify_one();
   return Status::OK();
@@ -698,6 +797,29 @@ Result<std::shared_ptr<ThreadPool>> ThreadPool::Make(int threads) {
   return pool;
 }
 
+Result<std::shared_ptr<ThreadPool>> ThreadPool::MakeWithAffinity(int threads,
+                                                                 std::vector<int> cpus) {
+  if (cpus.empty()) {
+    return Status::Invalid("ThreadPool CPU affinity must not be empty");
+  }
+  auto pool = std::shared_ptr<ThreadPool>(new ThreadPool());
+  pool->state_->cpu_affinity_ = std::move(cpus);
+  RETURN_NOT_OK(pool->SetCapacity(threads));
+  return pool;
+}
+
+Result<std::vector<std::shared_ptr<ThreadPool>>> MakeNumaNodeThreadPools() {
+  ARROW_ASSIGN_OR_RAISE(auto nodes, GetNumaNodeCpus());
+  std::vector<std::shared_ptr<ThreadPool>> pools;
+  for (auto& cpus : nodes) {
+    const int threads = static_cast<int>(cpus.size());
+    ARROW_ASSIGN_OR_RAISE(auto pool,
+                          ThreadPool::MakeWithAffinity(threads, std::move(cpus)));
+    pools.push_back(std::move(pool));
+  }
+  return pools;
+}
+
 Result<std::shared_ptr<ThreadPool>> ThreadPool::MakeEternal(int threads) {
   ARROW_ASSIGN_OR_RAISE(auto pool, Make(threads));
   // On Windows, the ThreadPool destructor may be called after non-main threads
@@ -753,6 +875,386 @@ int ThreadPool::DefaultCapacity() {
   return capacity;
 }
 
+// ----------------------------------------------------------------------
+// Work-stealing thread pool
+
+namespace {
+
+// A Chase-Lev work-stealing deque, following "Correct and Efficient Work-Stealing
+// for Weak Memory Models" (Le, Pop, Cohen, Zappa Nardelli, PPoPP 2013).
+//
+// Only the owning worker may call Push() and Pop(), which operate on the bottom
+// end of the deque.  Any thread may call Steal(), which takes from the top end.
+class WorkStealingDeque {
+ public:
+  static constexpr int64_t kInitialCapacity = 256;
+
+  WorkStealingDeque() {
+    buffers_.push_back(std::make_unique<Buffer>(kInitialCapacity));
+    buffer_.store(buffers_.back().get(), std::memory_order_relaxed);
+  }
+
+  ~WorkStealingDeque() {
+    while (Task* task = Pop()) {
+      delete task;
+    }
+  }
+
+  void Push(Task* task) {
+    const int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    const int64_t top = top_.load(std::memory_order_acquire);
+    Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+    if (bottom - top > buffer->capacity - 1) {
+      buffer = Grow(buffer, top, bottom);
+    }
+    buffer->Put(bottom, task);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+  }
+
+  // Return the most recently pushed task, or null if the deque is empty
+  Task* Pop() {
+    const int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+    bottom_.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = top_.load(std::memory_order_relaxed);
+    if (top > bottom) {
+      // Empty
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    Task* task = buffer->Get(bottom);
+    if (top == bottom) {
+      // Last task, race against stealers for it
+      if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                        std::memory_order_relaxed)) {
+        task = nullptr;
+      }
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return task;
+  }
+
+  // Return the oldest task, or null if the deque is empty or if another thread
+  // took that task first
+  Task* Steal() {
+    int64_t top = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int64_t bottom = bottom_.load(std::memory_order_acquire);
+    if (top >= bottom) {
+      return nullptr;
+    }
+    Buffer* buffer = buffer_.load(std::memory_order_acquire);
+    Task* task = buffer->Get(top);
+    if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return nullptr;
+    }
+    return task;
+  }
+
+ private:
+  struct Buffer {
+    explicit Buffer(int64_t capacity)
+        : capacity(capacity), slots(new std::atomic<Task*>[capacity]) {}
+
+    Task* Get(int64_t index) const {
+      return slots[index & (capacity - 1)].load(std::memory_order_relaxed);
+    }
+    void Put(int64_t index, Task* task) {
+      slots[index & (capacity - 1)].store(task, std::memory_order_relaxed);
+    }
+
+    const int64_t capacity;
+    std::unique_ptr<std::atomic<Task*>[]> slots;
+  };
+
+  Buffer* Grow(Buffer* buffer, int64_t top, int64_t bottom) {
+    auto grown = std::make_unique<Buffer>(buffer->capacity * 2);
+    for (int64_t i = top; i < bottom; ++i) {
+      grown->Put(i, buffer->Get(i));
+    }
+    Buffer* raw_grown = grown.get();
+    // Stealers may still be reading from the old buffer, so it is only released
+    // along with the deque
+    buffers_.push_back(std::move(grown));
+    buffer_.store(raw_grown, std::memory_order_release);
+    return raw_grown;
+  }
+
+  // Keep the ends on separate cache lines, `top_` is written by stealers while
+  // `bottom_` is written by the owner
+  alignas(64) std::atomic<int64_t> top_{0};
+  alignas(64) std::atomic<int64_t> bottom_{0};
+  std::atomic<Buffer*> buffer_;
+  // Only accessed by the owner
+  std::vector<std::unique_ptr<Buffer>> buffers_;
+};
+
+void RunTask(std::unique_ptr<Task> task) {
+  if (!task->stop_token.IsStopRequested()) {
+    std::move(task->callable)();
+  } else if (task->stop_callback) {
+    std::move(task->stop_callback)(task->stop_token.Poll());
+  }
+}
+
+}  // namespace
+
+struct WorkStealingThreadPool::State {
+  explicit State(int threads) {
+    for (int i = 0; i < threads; ++i) {
+      deques_.push_back(std::make_unique<WorkStealingDeque>());
+    }
+  }
+
+  ~State() {
+    for (Task* task : injected_tasks_) {
+      delete task;
+    }
+  }
+
+  // Find a task for the given worker: first in its own deque, then in the queue
+  // of tasks spawned from outside the pool, then in the other workers' deques.
+  Task* FindTask(int worker_index) {
+    if (Task* task = deques_[worker_index]->Pop()) {
+      return task;
+    }
+    if (Task* task = PopInjected()) {
+      return task;
+    }
+    const int num_workers = static_cast<int>(deques_.size());
+    for (int i = 1; i < num_workers; ++i) {
+      if (Task* task = deques_[(worker_index + i) % num_workers]->Steal()) {
+        return task;
+      }
+    }
+    return nullptr;
+  }
+
+  Task* PopInjected() {
+    if (num_injected_.load() == 0) {
+      return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(injection_mutex_);
+    if (injected_tasks_.empty()) {
+      return nullptr;
+    }
+    Task* task = injected_tasks_.front();
+    injected_tasks_.pop_front();
+    --num_injected_;
+    return task;
+  }
+
+  void TaskFinished() {
+    if (ARROW_PREDICT_FALSE(--tasks_queued_or_running_ == 0)) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      cv_idle_.notify_all();
+    }
+  }
+
+  // One deque per worker
+  std::vector<std::unique_ptr<WorkStealingDeque>> deques_;
+  std::vector<std::thread> workers_;
+
+  // Tasks spawned from threads that don't belong to the pool
+  std::mutex injection_mutex_;
+  std::deque<Task*> injected_tasks_;
+  std::atomic<int64_t> num_injected_{0};
+
+  // Number of tasks that were queued but not yet picked by a worker.  This can be
+  // transiently negative since a task is counted after it has been queued.
+  std::atomic<int64_t> num_queued_{0};
+  // Total number of tasks that are either queued or running
+  std::atomic<int64_t> tasks_queued_or_running_{0};
+
+  // Protects the sleeping of idle workers
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::condition_variable cv_idle_;
+  std::atomic<int> num_sleeping_{0};
+
+  // Are we shutting down?
+  std::atomic<bool> please_shutdown_{false};
+  std::atomic<bool> quick_shutdown_{false};
+
+  std::vector<std::shared_ptr<Resource>> kept_alive_resources_;
+};
+
+static thread_local WorkStealingThreadPool::State* current_work_stealing_state_ =
+    nullptr;
+static thread_local int current_work_stealing_worker_ = -1;
+
+// The worker loop is an independent function so that it can keep running
+// after the WorkStealingThreadPool is destroyed.
+static void WorkStealingWorkerLoop(std::shared_ptr<WorkStealingThreadPool::State> state,
+                                   int worker_index) {
+  current_work_stealing_state_ = state.get();
+  current_work_stealing_worker_ = worker_index;
+
+  while (!state->quick_shutdown_.load()) {
+    if (Task* task = state->FindTask(worker_index)) {
+      --state->num_queued_;
+      RunTask(std::unique_ptr<Task>(task));
+      state->TaskFinished();
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(state->mutex_);
+    if (state->please_shutdown_.load() && state->num_queued_.load() <= 0) {
+      break;
+    }
+    // A spawner increments `num_queued_` before checking `num_sleeping_`, so either
+    // we see the new task here or the spawner sees us sleeping and wakes us up.
+    ++state->num_sleeping_;
+    state->cv_.wait(lock, [&] {
+      return state->num_queued_.load() > 0 || state->please_shutdown_.load();
+    });
+    --state->num_sleeping_;
+  }
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool() = default;
+
+WorkStealingThreadPool::~WorkStealingThreadPool() {
+  if (state_->please_shutdown_.load()) {
+    return;
+  }
+  if (OwnsThisThread()) {
+    // The last reference to the pool was dropped by one of its own tasks, the
+    // workers can't be joined from here.
+    {
+      std::lock_guard<std::mutex> lock(state_->mutex_);
+      state_->please_shutdown_ = true;
+      state_->quick_shutdown_ = true;
+      state_->cv_.notify_all();
+    }
+    for (auto& worker : state_->workers_) {
+      worker.detach();
+    }
+    return;
+  }
+  ARROW_UNUSED(Shutdown(false /* wait */));
+}
+
+int WorkStealingThreadPool::GetCapacity() {
+  return static_cast<int>(state_->deques_.size());
+}
+
+int WorkStealingThreadPool::GetNumTasks() {
+  return static_cast<int>(state_->tasks_queued_or_running_.load());
+}
+
+bool WorkStealingThreadPool::OwnsThisThread() {
+  return current_work_stealing_state_ == state_;
+}
+
+Status WorkStealingThreadPool::Shutdown(bool wait) {
+  if (OwnsThisThread()) {
+    return Status::Invalid("Shutdown() cannot be called from a worker thread");
+  }
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex_);
+    if (state_->please_shutdown_.load()) {
+      return Status::Invalid("Shutdown() already called");
+    }
+    {
+      // See SpawnReal(): no task is injected once the flag is set
+      std::lock_guard<std::mutex> injection_lock(state_->injection_mutex_);
+      state_->please_shutdown_ = true;
+    }
+    state_->quick_shutdown_ = !wait;
+    state_->cv_.notify_all();
+  }
+  for (auto& worker : state_->workers_) {
+    worker.join();
+  }
+  state_->workers_.clear();
+
+  // The workers have exited, so the deques can be drained from this thread.  They
+  // may still hold tasks that were spawned concurrently with the call to Shutdown().
+  for (int i = 0; i < GetCapacity(); ++i) {
+    while (Task* task = state_->deques_[i]->Pop()) {
+      --state_->num_queued_;
+      if (wait) {
+        RunTask(std::unique_ptr<Task>(task));
+      } else {
+        delete task;
+      }
+      state_->TaskFinished();
+    }
+  }
+  while (Task* task = state_->PopInjected()) {
+    --state_->num_queued_;
+    if (wait) {
+      RunTask(std::unique_ptr<Task>(task));
+    } else {
+      delete task;
+    }
+    state_->TaskFinished();
+  }
+  return Status::OK();
+}
+
+void WorkStealingThreadPool::WaitForIdle() {
+  std::unique_lock<std::mutex> lock(state_->mutex_);
+  state_->cv_idle_.wait(lock,
+                        [this] { return state_->tasks_queued_or_running_.load() == 0; });
+}
+
+void WorkStealingThreadPool::KeepAlive(std::shared_ptr<Executor::Resource> resource) {
+  std::lock_guard<std::mutex> lock(state_->mutex_);
+  state_->kept_alive_resources_.push_back(std::move(resource));
+}
+
+Status WorkStealingThreadPool::SpawnReal(TaskHints hints, FnOnce<void()> task,
+                                         StopToken stop_token,
+                                         StopCallback&& stop_callback) {
+  task = WithActiveSpan(std::move(task));
+  auto queued_task = std::make_unique<Task>(
+      Task{std::move(task), std::move(stop_token), std::move(stop_callback)});
+  if (OwnsThisThread()) {
+    // Shutdown() drains the deques after joining the workers, so a task pushed by
+    // a worker before it exits is never lost
+    if (state_->please_shutdown_.load()) {
+      return Status::Invalid("operation forbidden during or after shutdown");
+    }
+    ++state_->tasks_queued_or_running_;
+    state_->deques_[current_work_stealing_worker_]->Push(queued_task.release());
+  } else {
+    // Check the flag under the lock of the queue, otherwise the task could be
+    // queued after Shutdown() has drained it
+    std::lock_guard<std::mutex> lock(state_->injection_mutex_);
+    if (state_->please_shutdown_.load()) {
+      return Status::Invalid("operation forbidden during or after shutdown");
+    }
+    ++state_->tasks_queued_or_running_;
+    state_->injected_tasks_.push_back(queued_task.release());
+    ++state_->num_injected_;
+  }
+  ++state_->num_queued_;
+  if (state_->num_sleeping_.load() > 0) {
+    std::lock_guard<std::mutex> lock(state_->mutex_);
+    state_->cv_.notify_one();
+  }
+  return Status::OK();
+}
+
+Result<std::shared_ptr<WorkStealingThreadPool>> WorkStealingThreadPool::Make(
+    int threads) {
+  if (threads <= 0) {
+    return Status::Invalid("WorkStealingThreadPool capacity must be > 0");
+  }
+  auto pool = std::shared_ptr<WorkStealingThreadPool>(new WorkStealingThreadPool());
+  pool->sp_state_ = std::make_shared<State>(threads);
+  pool->state_ = pool->sp_state_.get();
+  for (int i = 0; i < threads; ++i) {
+    pool->state_->workers_.emplace_back(
+        [state = pool->sp_state_, i] { WorkStealingWorkerLoop(state, i); });
+  }
+  return pool;
+}
+
 #else  // ARROW_ENABLE_THREADING
 ThreadPool::ThreadPool() {
   // default to max 'concurrency' of 8
@@ -820,6 +1322,9 @@ std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
   if (!maybe_pool.ok()) {
     maybe_pool.status().Abort("Failed to create global CPU thread pool");
   }
+#ifdef ARROW_ENABLE_THREADING
+  (*maybe_pool)->SetMetricsPrefix("thread_pool.cpu");
+#endif
   return *std::move(maybe_pool);
 }
 
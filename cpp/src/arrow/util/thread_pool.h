@@ -20,7 +20,9 @@
 #include <cstdint>
 #include <memory>
 #include <queue>
+#include <string_view>
 #include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
@@ -32,6 +34,7 @@
 #include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/metrics.h"
 #include "arrow/util/visibility.h"
 
 #if defined(_MSC_VER)
@@ -61,7 +64,9 @@ ARROW_EXPORT Status SetCpuThreadPoolCapacity(int threads);
 namespace internal {
 
 // Hints about a task that may be used by an Executor.
-// They are ignored by the provided ThreadPool implementation.
+// The provided ThreadPool and SerialExecutor implementations honor `priority`:
+// queued tasks with a lower priority run first, tasks of equal priority run in
+// the order they were spawned.  The other hints are currently ignored.
 struct TaskHints {
   // The lower, the more urgent
   int32_t priority = 0;
@@ -437,6 +442,26 @@ class ARROW_EXPORT SerialExecutor : public Executor {
 
 #ifdef ARROW_ENABLE_THREADING
 
+/// A snapshot of the activity of a ThreadPool, see ThreadPool::GetStats()
+struct ARROW_EXPORT ThreadPoolStats {
+  // The desired and actual number of worker threads
+  int capacity = 0;
+  int num_workers = 0;
+  // The number of workers currently running a task
+  int busy_workers = 0;
+  // The number of tasks waiting for a worker
+  int64_t queued_tasks = 0;
+  // The number of tasks that finished running (or were cancelled)
+  int64_t completed_tasks = 0;
+  // The time between spawning a task and a worker picking it up, in microseconds
+  util::HistogramSnapshot queue_wait_us;
+  // The time spent running tasks, in microseconds
+  util::HistogramSnapshot run_time_us;
+  // The number of tasks spawned for each TaskHints::external_id.  Tasks without
+  // an external id are not counted.
+  std::unordered_map<int64_t, int64_t> tasks_per_external_id;
+};
+
 /// An Executor implementation spawning tasks in FIFO manner on a fixed-size
 /// pool of worker threads.
 ///
@@ -448,6 +473,15 @@ class ARROW_EXPORT ThreadPool : public Executor {
   // Construct a thread pool with the given number of worker threads
   static Result<std::shared_ptr<ThreadPool>> Make(int threads);
 
+  // Like Make(), but the worker threads are only allowed to run on the given CPUs.
+  //
+  // Pinning a pool to the CPUs of one NUMA node (see GetNumaNodeCpus()) keeps
+  // the tasks it runs, and the memory they first touch, local to that node.
+  // Pinning is only supported on Linux; elsewhere a warning is logged and the
+  // workers run unpinned.
+  static Result<std::shared_ptr<ThreadPool>> MakeWithAffinity(int threads,
+                                                              std::vector<int> cpus);
+
   // Like Make(), but takes care that the returned ThreadPool is compatible
   // with destruction late at process exit.
   static Result<std::shared_ptr<ThreadPool>> MakeEternal(int threads);
@@ -463,6 +497,19 @@ class ARROW_EXPORT ThreadPool : public Executor {
   // Return the number of tasks either running or in the queue.
   int GetNumTasks();
 
+  // Return the queueing and running statistics of the pool since its creation.
+  //
+  // This is meant to tell CPU saturation (many busy workers, long queue waits)
+  // apart from long tasks holding the workers (long run times).
+  ThreadPoolStats GetStats();
+
+  // Also report the pool's statistics to the global util::MetricsRegistry, as
+  // "<prefix>.queue_wait_us", "<prefix>.run_time_us" and "<prefix>.busy_workers"
+  // histograms and a "<prefix>.completed_tasks" counter.  The busy worker count
+  // is sampled each time a task starts.  The global CPU and IO pools use the
+  // "thread_pool.cpu" and "thread_pool.io" prefixes.
+  void SetMetricsPrefix(std::string_view prefix);
+
   bool OwnsThisThread() override;
   // Dynamically change the number of worker threads.
   //
@@ -517,6 +564,65 @@ class ARROW_EXPORT ThreadPool : public Executor {
   State* state_;
   bool shutdown_on_destroy_;
 };
+
+/// An Executor implementation spawning tasks on a fixed-size pool of worker
+/// threads, each of which owns a work-stealing deque.
+///
+/// A task spawned from one of the pool's worker threads is pushed onto that
+/// worker's deque without taking any lock.  Workers pop their own tasks in LIFO
+/// order (which keeps recently produced data in cache) and, when they run out, steal
+/// the oldest tasks of other workers.  Tasks spawned from other threads go through
+/// a shared queue.  Compared to ThreadPool this removes the contention on a single
+/// queue when running tasks spawn many small tasks, as Acero plans do, at the cost
+/// of ignoring TaskHints::priority.
+///
+/// The pool can be used wherever an Executor is accepted, e.g. as the executor of
+/// a compute::ExecContext or as dataset::ScanOptions::cpu_executor.
+///
+/// Note: As with ThreadPool, any sort of nested parallelism will deadlock this
+/// executor.
+class ARROW_EXPORT WorkStealingThreadPool : public Executor {
+ public:
+  // Construct a thread pool with the given number of worker threads
+  static Result<std::shared_ptr<WorkStealingThreadPool>> Make(int threads);
+
+  // Destroy thread pool; the pool will first be shut down
+  ~WorkStealingThreadPool() override;
+
+  // Return the number of worker threads.
+  int GetCapacity() override;
+
+  // Return the number of tasks either running or queued.
+  int GetNumTasks();
+
+  bool OwnsThisThread() override;
+
+  // Shutdown the pool.  Once the pool starts shutting down, new tasks
+  // cannot be submitted anymore.
+  // If "wait" is true, shutdown waits for all pending tasks to be finished.
+  // If "wait" is false, workers are stopped as soon as currently executing
+  // tasks are finished.
+  Status Shutdown(bool wait = true);
+
+  // Wait for the thread pool to become idle
+  //
+  // This is useful for sequencing tests
+  void WaitForIdle();
+
+  void KeepAlive(std::shared_ptr<Executor::Resource> resource) override;
+
+  struct State;
+
+ protected:
+  WorkStealingThreadPool();
+
+  Status SpawnReal(TaskHints hints, FnOnce<void()> task, StopToken,
+                   StopCallback&&) override;
+
+  std::shared_ptr<State> sp_state_;
+  State* state_;
+};
+
 #else  // ARROW_ENABLE_THREADING
 // an executor implementation which pretends to be a thread pool but runs everything
 // on the main thread using a static queue (shared between all thread pools, otherwise
@@ -573,6 +679,19 @@ class ARROW_EXPORT ThreadPool : public SerialExecutor {
 // Return the process-global thread pool for CPU-bound tasks.
 ARROW_EXPORT ThreadPool* GetCpuThreadPool();
 
+#ifdef ARROW_ENABLE_THREADING
+// Create one thread pool per NUMA node, each with one worker per CPU of its node
+// and pinned to those CPUs.
+//
+// Running a query on one of these pools (e.g. by making it the executor of the
+// query's ExecContext) keeps all of the query's tasks on one node.  The memory
+// allocated and first written by those tasks is then placed on that node by the
+// operating system, so it is scanned without crossing sockets.
+//
+// This is only implemented on Linux.
+ARROW_EXPORT Result<std::vector<std::shared_ptr<ThreadPool>>> MakeNumaNodeThreadPools();
+#endif
+
 /// \brief Potentially run an async operation serially (if use_threads is false)
 /// \see RunSerially
 ///
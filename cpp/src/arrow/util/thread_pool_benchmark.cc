@@ -103,6 +103,75 @@ static void ThreadPoolSpawn(benchmark::State& state) {  // NOLINT non-const refe
   state.SetItemsProcessed(state.iterations() * nspawns);
 }
 
+// Benchmark WorkStealingThreadPool::Spawn, see ThreadPoolSpawn
+static void WorkStealingThreadPoolSpawn(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const auto nthreads = static_cast<int>(state.range(0));
+  const auto workload_size = static_cast<int32_t>(state.range(1));
+
+  Workload workload(workload_size);
+
+  const int32_t nspawns = 200000000 / workload_size + 1;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto pool = *WorkStealingThreadPool::Make(nthreads);
+    state.ResumeTiming();
+
+    for (int32_t i = 0; i < nspawns; ++i) {
+      ABORT_NOT_OK(pool->Spawn(std::ref(workload)));
+    }
+
+    ABORT_NOT_OK(pool->Shutdown(true /* wait */));
+    state.PauseTiming();
+    pool.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * nspawns);
+}
+
+// Benchmark tasks spawned from within running tasks, as Acero does when it splits
+// a batch into many small tasks.  Each of `nthreads` top-level tasks spawns its
+// share of the workload from a worker thread.
+template <typename PoolType>
+static void NestedSpawn(benchmark::State& state) {  // NOLINT non-const reference
+  const auto nthreads = static_cast<int>(state.range(0));
+  const auto workload_size = static_cast<int32_t>(state.range(1));
+
+  Workload workload(workload_size);
+
+  const int32_t nspawns_per_thread = (20000000 / workload_size + 1) / nthreads + 1;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::shared_ptr<PoolType> pool = *PoolType::Make(nthreads);
+    state.ResumeTiming();
+
+    for (int i = 0; i < nthreads; ++i) {
+      ABORT_NOT_OK(pool->Spawn([&] {
+        for (int32_t j = 0; j < nspawns_per_thread; ++j) {
+          ABORT_NOT_OK(pool->Spawn(std::ref(workload)));
+        }
+      }));
+    }
+
+    pool->WaitForIdle();
+    ABORT_NOT_OK(pool->Shutdown(true /* wait */));
+    state.PauseTiming();
+    pool.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * nthreads * nspawns_per_thread);
+}
+
+static void ThreadPoolNestedSpawn(benchmark::State& state) {  // NOLINT
+  NestedSpawn<ThreadPool>(state);
+}
+
+static void WorkStealingThreadPoolNestedSpawn(benchmark::State& state) {  // NOLINT
+  NestedSpawn<WorkStealingThreadPool>(state);
+}
+
 // Benchmark SerialExecutor::RunInSerialExecutor
 static void RunInSerialExecutor(benchmark::State& state) {  // NOLINT non-const reference
   const auto workload_size = static_cast<int32_t>(state.range(0));
@@ -218,6 +287,23 @@ static void ThreadPoolSpawn_Customize(benchmark::internal::Benchmark* b) {
   b->UseRealTime();
 }
 
+// Also run with as many threads as there are cores to show how the pools scale
+static void NestedSpawn_Customize(benchmark::internal::Benchmark* b) {
+  const int max_threads = ThreadPool::DefaultCapacity();
+  for (const int32_t w : {100, 1000, 10000}) {
+    for (const int nthreads : {1, 2, 4, 8, 16, 32}) {
+      if (nthreads <= max_threads) {
+        b->Args({nthreads, w});
+      }
+    }
+    if (max_threads > 32) {
+      b->Args({max_threads, w});
+    }
+  }
+  b->ArgNames({"threads", "task_cost"});
+  b->UseRealTime();
+}
+
 #ifdef ARROW_WITH_BENCHMARKS_REFERENCE
 
 // This benchmark simply provides a baseline indicating the raw cost of our workload
@@ -243,6 +329,9 @@ BENCHMARK(RunInSerialExecutor)->Apply(WorkloadCost_Customize);
 BENCHMARK(ThreadPoolSpawn)->Apply(ThreadPoolSpawn_Customize);
 BENCHMARK(ThreadedTaskGroup)->Apply(ThreadPoolSpawn_Customize);
 BENCHMARK(ThreadPoolSubmit)->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK(WorkStealingThreadPoolSpawn)->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK(ThreadPoolNestedSpawn)->Apply(NestedSpawn_Customize);
+BENCHMARK(WorkStealingThreadPoolNestedSpawn)->Apply(NestedSpawn_Customize);
 
 }  // namespace internal
 }  // namespace arrow
@@ -27,6 +27,7 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <string>
 #include <thread>
 #include <vector>
@@ -100,7 +101,7 @@ class AddTester {
 
   AddTester(AddTester&&) = default;
 
-  void SpawnTasks(ThreadPool* pool, AddTaskFunc add_func) {
+  void SpawnTasks(Executor* pool, AddTaskFunc add_func) {
     for (int i = 0; i < nadds_; ++i) {
       ASSERT_OK(pool->Spawn([this, add_func, i] { add_func(xs_[i], ys_[i], &outs_[i]); },
                             stop_token_));
@@ -803,6 +804,80 @@ TEST_F(TestThreadPool, SetCapacity) {
   ASSERT_EQ(pool->GetCapacity(), 7);
 }
 #endif
+#ifdef ARROW_ENABLE_THREADING
+TEST_F(TestThreadPool, MakeWithAffinity) {
+  ASSERT_RAISES(Invalid, ThreadPool::MakeWithAffinity(2, {}));
+#  ifndef __linux__
+  GTEST_SKIP() << "CPU affinity is only supported on Linux";
+#  endif
+  ASSERT_OK_AND_ASSIGN(auto nodes, GetNumaNodeCpus());
+  const int cpu = nodes[0][0];
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::MakeWithAffinity(3, {cpu}));
+  std::vector<Future<int32_t>> futures;
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit([] { return GetNumAffinityCores(); }));
+    futures.push_back(std::move(fut));
+  }
+  for (auto& fut : futures) {
+    ASSERT_OK_AND_EQ(1, fut.result());
+  }
+  ASSERT_OK(pool->Shutdown());
+}
+
+TEST_F(TestThreadPool, NumaNodeThreadPools) {
+#  ifndef __linux__
+  GTEST_SKIP() << "NUMA node discovery is only supported on Linux";
+#  endif
+  ASSERT_OK_AND_ASSIGN(auto nodes, GetNumaNodeCpus());
+  ASSERT_OK_AND_ASSIGN(auto pools, MakeNumaNodeThreadPools());
+  ASSERT_EQ(nodes.size(), pools.size());
+  for (size_t i = 0; i < pools.size(); ++i) {
+    ASSERT_EQ(static_cast<int>(nodes[i].size()), pools[i]->GetCapacity());
+    ASSERT_OK_AND_ASSIGN(auto fut,
+                         pools[i]->Submit([] { return GetNumAffinityCores(); }));
+    ASSERT_OK_AND_EQ(static_cast<int32_t>(nodes[i].size()), fut.result());
+  }
+}
+
+TEST_F(TestThreadPool, Stats) {
+  auto pool = this->MakeThreadPool(1);
+  pool->SetMetricsPrefix("test.thread_pool");
+  std::mutex mutex;
+  {
+    // Block the only worker while the other tasks are queued
+    std::unique_lock<std::mutex> lock(mutex);
+    ASSERT_OK(pool->Spawn([&mutex] { std::unique_lock<std::mutex> lock(mutex); }));
+    for (int i = 0; i < 4; ++i) {
+      TaskHints hints;
+      hints.external_id = i % 2;
+      ASSERT_OK(pool->Spawn(hints, [] {}));
+    }
+    BusyWait(10, [&] { return pool->GetStats().busy_workers == 1; });
+    auto stats = pool->GetStats();
+    ASSERT_EQ(stats.capacity, 1);
+    ASSERT_EQ(stats.num_workers, 1);
+    ASSERT_EQ(stats.busy_workers, 1);
+    ASSERT_EQ(stats.queued_tasks, 4);
+    ASSERT_EQ(stats.completed_tasks, 0);
+  }
+  pool->WaitForIdle();
+  auto stats = pool->GetStats();
+  ASSERT_EQ(stats.busy_workers, 0);
+  ASSERT_EQ(stats.queued_tasks, 0);
+  ASSERT_EQ(stats.completed_tasks, 5);
+  ASSERT_EQ(stats.queue_wait_us.count, 5);
+  ASSERT_EQ(stats.run_time_us.count, 5);
+  std::unordered_map<int64_t, int64_t> expected_per_id = {{0, 2}, {1, 2}};
+  ASSERT_EQ(stats.tasks_per_external_id, expected_per_id);
+
+  auto metrics = util::MetricsRegistry::Global()->Snapshot();
+  ASSERT_GE(metrics.counters["test.thread_pool.completed_tasks"], 5);
+  ASSERT_GE(metrics.histograms["test.thread_pool.run_time_us"].count, 5);
+  ASSERT_GE(metrics.histograms["test.thread_pool.busy_workers"].count, 5);
+  ASSERT_OK(pool->Shutdown());
+}
+#endif
+
 // Test Submit() functionality
 
 TEST_F(TestThreadPool, Submit) {
@@ -878,6 +953,142 @@ TEST_F(TestThreadPool, SubmitWithStopTokenCancelled) {
   }
 }
 
+#ifdef ARROW_ENABLE_THREADING
+
+// Tests for WorkStealingThreadPool
+
+TEST(TestWorkStealingThreadPool, InvalidCapacity) {
+  ASSERT_RAISES(Invalid, WorkStealingThreadPool::Make(0));
+}
+
+TEST(TestWorkStealingThreadPool, ConstructDestruct) {
+  for (int threads : {1, 2, 3, 8, 32}) {
+    ASSERT_OK_AND_ASSIGN(auto pool, WorkStealingThreadPool::Make(threads));
+    ASSERT_EQ(threads, pool->GetCapacity());
+  }
+}
+
+TEST(TestWorkStealingThreadPool, Spawn) {
+  ASSERT_OK_AND_ASSIGN(auto pool, WorkStealingThreadPool::Make(3));
+  AddTester add_tester(1000);
+  add_tester.SpawnTasks(pool.get(), task_add<int>);
+  ASSERT_OK(pool->Shutdown());
+  add_tester.CheckResults();
+  ASSERT_RAISES(Invalid, pool->Spawn([] {}));
+  ASSERT_RAISES(Invalid, pool->Shutdown());
+}
+
+TEST(TestWorkStealingThreadPool, SpawnNested) {
+  // Tasks spawned from worker threads go to the worker's own deque and must be
+  // picked up by the other workers as well
+  ASSERT_OK_AND_ASSIGN(auto pool, WorkStealingThreadPool::Make(8));
+  constexpr int kNumOuterTasks = 16;
+  constexpr int kNumInnerTasks = 500;
+  std::atomic<int> num_inner_run{0};
+  std::mutex mutex;
+  std::set<std::thread::id> inner_threads;
+  for (int i = 0; i < kNumOuterTasks; ++i) {
+    ASSERT_OK(pool->Spawn([&] {
+      for (int j = 0; j < kNumInnerTasks; ++j) {
+        ASSERT_OK(pool->Spawn([&] {
+          ASSERT_TRUE(pool->OwnsThisThread());
+          {
+            std::lock_guard<std::mutex> lock(mutex);
+            inner_threads.insert(std::this_thread::get_id());
+          }
+          SleepFor(1e-5);
+          ++num_inner_run;
+        }));
+      }
+    }));
+  }
+  pool->WaitForIdle();
+  ASSERT_EQ(kNumOuterTasks * kNumInnerTasks, num_inner_run.load());
+  ASSERT_EQ(0, pool->GetNumTasks());
+  ASSERT_FALSE(pool->OwnsThisThread());
+  ASSERT_GT(inner_threads.size(), 1);
+  ASSERT_OK(pool->Shutdown());
+}
+
+TEST(TestWorkStealingThreadPool, SpawnThreaded) {
+  ASSERT_OK_AND_ASSIGN(auto pool, WorkStealingThreadPool::Make(4));
+  std::vector<AddTester> add_testers;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; ++i) {
+    add_testers.emplace_back(200);
+  }
+  for (auto& add_tester : add_testers) {
+    threads.emplace_back(
+        [&] { add_tester.SpawnTasks(pool.get(), task_slow_add<int>{1e-4}); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_OK(pool->Shutdown());
+  for (auto& add_tester : add_testers) {
+    add_tester.CheckResults();
+  }
+}
+
+TEST(TestWorkStealingThreadPool, QuickShutdown) {
+  AddTester add_tester(100);
+  {
+    ASSERT_OK_AND_ASSIGN(auto pool, WorkStealingThreadPool::Make(3));
+    add_tester.SpawnTasks(pool.get(), task_slow_add<int>{/*seconds=*/0.02});
+    ASSERT_OK(pool->Shutdown(false /* wait */));
+    add_tester.CheckNotAllComputed();
+  }
+  add_tester.CheckNotAllComputed();
+}
+
+TEST(TestWorkStealingThreadPool, SpawnDuringShutdown) {
+  // Every task whose spawning succeeded runs, even when it races with Shutdown()
+  for (int repeat = 0; repeat < 20; ++repeat) {
+    ASSERT_OK_AND_ASSIGN(auto pool, WorkStealingThreadPool::Make(2));
+    std::atomic<int> spawned{0};
+    std::atomic<int> ran{0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+      threads.emplace_back([&] {
+        while (pool->Spawn([&] { ++ran; }).ok()) {
+          ++spawned;
+        }
+      });
+    }
+    SleepFor(1e-3);
+    ASSERT_OK(pool->Shutdown());
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    ASSERT_EQ(spawned.load(), ran.load());
+    ASSERT_RAISES(Invalid, pool->Spawn([] {}));
+  }
+}
+
+TEST(TestWorkStealingThreadPool, SubmitWithStopToken) {
+  ASSERT_OK_AND_ASSIGN(auto pool, WorkStealingThreadPool::Make(2));
+  ASSERT_OK_AND_ASSIGN(Future<int> fut, pool->Submit(add<int>, 4, 5));
+  ASSERT_OK_AND_EQ(9, fut.result());
+
+  StopSource stop_source;
+  stop_source.RequestStop();
+  ASSERT_OK_AND_ASSIGN(fut, pool->Submit(stop_source.token(), add<int>, 4, 5));
+  ASSERT_RAISES(Cancelled, fut.result());
+}
+
+TEST(TestWorkStealingThreadPool, DestroyFromOwnTask) {
+  ASSERT_OK_AND_ASSIGN(auto pool, WorkStealingThreadPool::Make(2));
+  Future<> destroyed = Future<>::Make();
+  ASSERT_OK(pool->Spawn([pool, destroyed]() mutable {
+    pool.reset();
+    destroyed.MarkFinished();
+  }));
+  pool.reset();
+  ASSERT_FINISHES_OK(destroyed);
+}
+
+#endif  // ARROW_ENABLE_THREADING
+
 // Test fork safety on Unix
 
 #if !(defined(_WIN32) || defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER) || \
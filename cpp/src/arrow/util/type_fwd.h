@@ -61,6 +61,7 @@ struct Compression {
 
 namespace util {
 class AsyncTaskScheduler;
+class BufferPool;
 class Compressor;
 class Decompressor;
 class Codec;
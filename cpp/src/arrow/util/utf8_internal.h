@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <bit>
 #include <cassert>
 #include <cstdint>
 #include <cstring>
@@ -81,6 +82,70 @@ static inline uint16_t ValidateOneUTF8Byte(uint8_t byte, uint16_t state) {
 
 ARROW_EXPORT void CheckUTF8Initialized();
 
+#if defined(ARROW_HAVE_NEON) || defined(ARROW_HAVE_SSE4_2)
+// Widest batch of bytes for the instruction set the code is compiled for:
+// 16 bytes with SSE4.2 and NEON, 32 bytes with AVX2 and 64 bytes with AVX-512.
+using AsciiSimdBatch = xsimd::batch<int8_t>;
+
+// Return the length of the longest prefix of whole SIMD batches that are all ASCII
+static inline int64_t AsciiBlocksPrefixLength(const uint8_t* data, int64_t len) {
+  constexpr int64_t kBatchSize = static_cast<int64_t>(AsciiSimdBatch::size);
+  const AsciiSimdBatch zero(static_cast<int8_t>(0));
+  int64_t i = 0;
+  for (; i + kBatchSize <= len; i += kBatchSize) {
+    const auto block =
+        AsciiSimdBatch::load_unaligned(reinterpret_cast<const int8_t*>(data + i));
+    // Non-ASCII bytes have their upper bit set, i.e. they are negative
+    if (xsimd::any(block < zero)) {
+      break;
+    }
+  }
+  return i;
+}
+#endif  // ARROW_HAVE_NEON || ARROW_HAVE_SSE4_2
+
+// Flip the case of ASCII letters: lower case letters if kToUpper, upper case
+// letters if kToLower, all of them if both are set. Other bytes are copied as is.
+template <bool kToUpper, bool kToLower>
+static inline void AsciiConvertCase(const uint8_t* input, int64_t length,
+                                    uint8_t* output) {
+  // Letters only differ from their other case by this bit, which is set in lower case
+  constexpr uint8_t kCaseBit = 0x20;
+  int64_t i = 0;
+#if defined(ARROW_HAVE_NEON) || defined(ARROW_HAVE_SSE4_2)
+  constexpr int64_t kBatchSize = static_cast<int64_t>(AsciiSimdBatch::size);
+  const AsciiSimdBatch case_bit(static_cast<int8_t>(kCaseBit));
+  const AsciiSimdBatch lower_a(static_cast<int8_t>('a'));
+  const AsciiSimdBatch lower_z(static_cast<int8_t>('z'));
+  const AsciiSimdBatch zero(static_cast<int8_t>(0));
+  for (; i + kBatchSize <= length; i += kBatchSize) {
+    auto block =
+        AsciiSimdBatch::load_unaligned(reinterpret_cast<const int8_t*>(input + i));
+    // Non-ASCII bytes are negative and stay out of the range once folded
+    const auto folded = block | case_bit;
+    auto flip = (folded >= lower_a) & (folded <= lower_z);
+    if constexpr (kToUpper && !kToLower) {
+      flip = flip & ((block & case_bit) != zero);
+    } else if constexpr (kToLower && !kToUpper) {
+      flip = flip & ((block & case_bit) == zero);
+    }
+    block = xsimd::select(flip, block ^ case_bit, block);
+    block.store_unaligned(reinterpret_cast<int8_t*>(output + i));
+  }
+#endif
+  for (; i < length; ++i) {
+    const uint8_t c = input[i];
+    const uint8_t folded = c | kCaseBit;
+    bool flip = folded >= 'a' && folded <= 'z';
+    if constexpr (kToUpper && !kToLower) {
+      flip &= (c & kCaseBit) != 0;
+    } else if constexpr (kToLower && !kToUpper) {
+      flip &= (c & kCaseBit) == 0;
+    }
+    output[i] = flip ? c ^ kCaseBit : c;
+  }
+}
+
 }  // namespace internal
 
 static inline bool ValidateUTF8Inline(const uint8_t* data, int64_t size) {
@@ -93,6 +158,15 @@ static inline bool ValidateUTF8Inline(const uint8_t* data, int64_t size) {
   internal::CheckUTF8Initialized();
 #endif
 
+#if defined(ARROW_HAVE_NEON) || defined(ARROW_HAVE_SSE4_2)
+  // Skip leading ASCII a SIMD register at a time, the common case for long strings
+  {
+    const int64_t ascii_length = internal::AsciiBlocksPrefixLength(data, size);
+    data += ascii_length;
+    size -= ascii_length;
+  }
+#endif
+
   while (size >= 8) {
     // XXX This is doing an unaligned access.  Contemporary architectures
     // (x86-64, AArch64, PPC64) support it natively and often have good
@@ -280,6 +354,44 @@ static inline bool ValidateAscii(std::string_view str) {
   return ValidateAscii(data, length);
 }
 
+/// Return the number of leading bytes of `data` that are ASCII characters
+static inline int64_t AsciiPrefixLength(const uint8_t* data, int64_t len) {
+  int64_t i = 0;
+#if defined(ARROW_HAVE_NEON) || defined(ARROW_HAVE_SSE4_2)
+  i = internal::AsciiBlocksPrefixLength(data, len);
+#endif
+  for (; i + 8 <= len; i += 8) {
+    if (SafeLoadAs<uint64_t>(data + i) & 0x8080808080808080ULL) {
+      break;
+    }
+  }
+  while (i < len && data[i] < 0x80) {
+    ++i;
+  }
+  return i;
+}
+
+/// Convert ASCII letters to lower case, other bytes are copied unchanged.
+/// `input` and `output` may be the same buffer.
+static inline void AsciiToLower(const uint8_t* input, int64_t length, uint8_t* output) {
+  internal::AsciiConvertCase</*kToUpper=*/false, /*kToLower=*/true>(input, length,
+                                                                       output);
+}
+
+/// Convert ASCII letters to upper case, other bytes are copied unchanged.
+/// `input` and `output` may be the same buffer.
+static inline void AsciiToUpper(const uint8_t* input, int64_t length, uint8_t* output) {
+  internal::AsciiConvertCase</*kToUpper=*/true, /*kToLower=*/false>(input, length,
+                                                                       output);
+}
+
+/// Swap the case of ASCII letters, other bytes are copied unchanged.
+/// `input` and `output` may be the same buffer.
+static inline void AsciiSwapCase(const uint8_t* input, int64_t length, uint8_t* output) {
+  internal::AsciiConvertCase</*kToUpper=*/true, /*kToLower=*/true>(input, length,
+                                                                      output);
+}
+
 // size of a valid UTF8 can be determined by looking at leading 4 bits of BYTE1
 // utf8_byte_size_table[0..7] --> pure ascii chars --> 1B length
 // utf8_byte_size_table[8..11] --> internal bytes --> 1B length
@@ -557,6 +669,14 @@ static inline bool UTF8AllOf(const uint8_t* first, const uint8_t* last, bool* re
 /// Count the number of codepoints in the given string (assuming it is valid UTF8).
 static inline int64_t UTF8Length(const uint8_t* first, const uint8_t* last) {
   int64_t length = 0;
+  // Count the non-continuation bytes of 8 bytes at a time: continuation bytes have
+  // their two upper bits set to 10.
+  while (last - first >= 8) {
+    const uint64_t word = SafeLoadAs<uint64_t>(first);
+    const uint64_t continuations = word & ~(word << 1) & 0x8080808080808080ULL;
+    length += 8 - std::popcount(continuations);
+    first += 8;
+  }
   while (first != last) {
     length += ((*first++ & 0xc0) != 0x80);
   }
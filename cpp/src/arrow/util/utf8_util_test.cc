@@ -562,5 +562,88 @@ TEST(UTF8Length, Basics) {
   ASSERT_EQ(length("\xf0\x9f\x99\x8c"), 1);
 }
 
+class UTF8LengthTest : public UTF8Test {};
+
+TEST_F(UTF8LengthTest, RandomValid) {
+  const int niters = 100;
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<size_t> valid_dist(0, all_valid_sequences.size() - 1);
+  std::uniform_int_distribution<int> nchars_dist(0, 200);
+
+  for (int i = 0; i < niters; ++i) {
+    const int nchars = nchars_dist(gen);
+    std::string s;
+    for (int j = 0; j < nchars; ++j) {
+      s += all_valid_sequences[valid_dist(gen)];
+    }
+    const auto* p = reinterpret_cast<const uint8_t*>(s.data());
+    ASSERT_EQ(UTF8Length(p, p + s.length()), nchars) << s;
+  }
+}
+
+TEST(AsciiPrefixLength, Basics) {
+  auto prefix_length = [](const std::string& s) {
+    return AsciiPrefixLength(reinterpret_cast<const uint8_t*>(s.data()),
+                             static_cast<int64_t>(s.length()));
+  };
+  ASSERT_EQ(prefix_length(""), 0);
+  ASSERT_EQ(prefix_length("abc"), 3);
+  ASSERT_EQ(prefix_length("\xc3\x81"), 0);
+  // Non-ASCII characters at all positions of strings longer than SIMD registers
+  for (int64_t length : {1, 7, 8, 15, 16, 31, 32, 63, 64, 65, 100, 200}) {
+    std::string ascii(length, 'x');
+    ASSERT_EQ(prefix_length(ascii), length);
+    for (int64_t pos = 0; pos < length; ++pos) {
+      std::string s = ascii;
+      s[pos] = '\x80';
+      ASSERT_EQ(prefix_length(s), pos) << "length=" << length;
+    }
+  }
+}
+
+TEST(AsciiConvertCase, RandomBytes) {
+  auto ref_lower = [](uint8_t c) -> uint8_t {
+    return (c >= 'A' && c <= 'Z') ? c + 32 : c;
+  };
+  auto ref_upper = [](uint8_t c) -> uint8_t {
+    return (c >= 'a' && c <= 'z') ? c - 32 : c;
+  };
+  auto ref_swapcase = [&](uint8_t c) -> uint8_t {
+    return (c >= 'a' && c <= 'z') ? ref_upper(c) : ref_lower(c);
+  };
+
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int> byte_dist(0, 255);
+  std::vector<uint8_t> input(300);
+  for (auto& c : input) {
+    c = static_cast<uint8_t>(byte_dist(gen));
+  }
+  // Make sure all letter boundaries are covered
+  for (uint8_t c : std::string_view("@AZ[`az{\xc1\xda\xe1\xfa")) {
+    input.push_back(c);
+  }
+
+  for (int64_t offset : {0, 1, 3}) {
+    for (int64_t length : {0, 1, 15, 16, 17, 33, 64, 100, 250}) {
+      const uint8_t* data = input.data() + offset;
+      std::vector<uint8_t> lower(length), upper(length), swapped(length);
+      AsciiToLower(data, length, lower.data());
+      AsciiToUpper(data, length, upper.data());
+      AsciiSwapCase(data, length, swapped.data());
+      for (int64_t i = 0; i < length; ++i) {
+        ASSERT_EQ(lower[i], ref_lower(data[i])) << "i=" << i;
+        ASSERT_EQ(upper[i], ref_upper(data[i])) << "i=" << i;
+        ASSERT_EQ(swapped[i], ref_swapcase(data[i])) << "i=" << i;
+      }
+    }
+  }
+  // Conversion can happen in place
+  std::vector<uint8_t> buffer = input;
+  AsciiToUpper(buffer.data(), static_cast<int64_t>(buffer.size()), buffer.data());
+  for (size_t i = 0; i < buffer.size(); ++i) {
+    ASSERT_EQ(buffer[i], ref_upper(input[i]));
+  }
+}
+
 }  // namespace util
 }  // namespace arrow
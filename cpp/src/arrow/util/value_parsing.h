@@ -23,6 +23,7 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <string>
@@ -32,6 +33,7 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/config.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/float16.h"
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/macros.h"
@@ -187,6 +189,65 @@ struct StringConverter<HalfFloatType> {
 
 inline uint8_t ParseDecimalDigit(char c) { return static_cast<uint8_t>(c - '0'); }
 
+namespace detail {
+
+// SWAR ("SIMD within a register") helpers, to check and parse 8 ASCII digits
+// at once.  A word holds 8 characters with the first one in the low byte.
+
+inline uint64_t LoadDigitsWord(const char* s) {
+  uint64_t word;
+  memcpy(&word, s, sizeof(word));
+  return bit_util::FromLittleEndian(word);
+}
+
+inline bool AreEightDigits(uint64_t word) {
+  // A byte is a digit iff its high nibble is 3, and still is after adding 6
+  return ((word & 0xF0F0F0F0F0F0F0F0ULL) |
+          (((word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+         0x3333333333333333ULL;
+}
+
+// Byte i of the result is the value of the two digits starting at byte i.
+// Only meaningful for bytes i and i + 1 being digits.
+inline uint64_t ParseDigitPairs(uint64_t word) {
+  word -= 0x3030303030303030ULL;
+  return word * 10 + (word >> 8);
+}
+
+inline uint32_t ParseEightDigits(uint64_t word) {
+  constexpr uint64_t kMask = 0x000000FF000000FFULL;
+  constexpr uint64_t kMul1 = 100 + (1000000ULL << 32);
+  constexpr uint64_t kMul2 = 1 + (10000ULL << 32);
+  word = ParseDigitPairs(word);
+  word = (((word & kMask) * kMul1) + (((word >> 16) & kMask) * kMul2)) >> 32;
+  return static_cast<uint32_t>(word);
+}
+
+// Parse a number of digits that cannot overflow T, 8 digits at a time
+template <typename T>
+inline bool ParseUnsignedBy8(const char* s, size_t length, T* out) {
+  T result = 0;
+  // Leading digits, so that the rest is a multiple of 8
+  for (size_t i = length % 8; i > 0; --i, --length) {
+    const uint8_t digit = ParseDecimalDigit(*s++);
+    if (ARROW_PREDICT_FALSE(digit > 9U)) {
+      return false;
+    }
+    result = static_cast<T>(result * 10U + digit);
+  }
+  for (; length > 0; length -= 8, s += 8) {
+    const uint64_t word = LoadDigitsWord(s);
+    if (ARROW_PREDICT_FALSE(!AreEightDigits(word))) {
+      return false;
+    }
+    result = static_cast<T>(result * 100000000U + ParseEightDigits(word));
+  }
+  *out = result;
+  return true;
+}
+
+}  // namespace detail
+
 #define PARSE_UNSIGNED_ITERATION(C_TYPE)          \
   if (length > 0) {                               \
     uint8_t digit = ParseDecimalDigit(*s++);      \
@@ -251,6 +312,9 @@ inline bool ParseUnsigned(const char* s, size_t length, uint16_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
+  if (length >= 8 && length <= 9) {
+    return detail::ParseUnsignedBy8(s, length, out);
+  }
   uint32_t result = 0;
   do {
     PARSE_UNSIGNED_ITERATION(uint32_t);
@@ -271,6 +335,9 @@ inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
+  if (length >= 8 && length <= 19) {
+    return detail::ParseUnsignedBy8(s, length, out);
+  }
   uint64_t result = 0;
   do {
     PARSE_UNSIGNED_ITERATION(uint64_t);
@@ -523,21 +590,20 @@ static inline bool ParseHHMM(const char* s, Duration* out) {
 
 template <typename Duration>
 static inline bool ParseHH_MM_SS(const char* s, Duration* out) {
-  uint8_t hours = 0;
-  uint8_t minutes = 0;
-  uint8_t seconds = 0;
-  if (ARROW_PREDICT_FALSE(s[2] != ':') || ARROW_PREDICT_FALSE(s[5] != ':')) {
+  // Parse all 8 characters at once, with the separators replaced with zeros
+  constexpr uint64_t kSeparators = 0x0000FF0000FF0000ULL;
+  const uint64_t word = LoadDigitsWord(s);
+  if (ARROW_PREDICT_FALSE((word & kSeparators) != 0x00003A00003A0000ULL)) {
     return false;
   }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 2, &hours))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 3, 2, &minutes))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 6, 2, &seconds))) {
+  const uint64_t digits = word ^ 0x00000A00000A0000ULL;  // ':' ^ '0' == 0x0A
+  if (ARROW_PREDICT_FALSE(!AreEightDigits(digits))) {
     return false;
   }
+  const uint64_t pairs = ParseDigitPairs(digits);
+  const auto hours = static_cast<uint8_t>(pairs);
+  const auto minutes = static_cast<uint8_t>(pairs >> 24);
+  const auto seconds = static_cast<uint8_t>(pairs >> 48);
   if (ARROW_PREDICT_FALSE(hours >= 24)) {
     return false;
   }
@@ -636,18 +702,20 @@ static inline bool ParseSubSeconds(const char* s, size_t length, TimeUnit::type
 
 template <typename Duration>
 static inline bool ParseYYYY_MM_DD(const char* s, Duration* since_epoch) {
-  uint16_t year = 0;
-  uint8_t month = 0;
-  uint8_t day = 0;
-  if (ARROW_PREDICT_FALSE(s[4] != '-') || ARROW_PREDICT_FALSE(s[7] != '-')) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 4, &year))) {
+  // Parse "YYYY-MM-" at once, with the separators replaced with zeros
+  constexpr uint64_t kSeparators = 0xFF0000FF00000000ULL;
+  const uint64_t word = detail::LoadDigitsWord(s);
+  if (ARROW_PREDICT_FALSE((word & kSeparators) != 0x2D00002D00000000ULL)) {
     return false;
   }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 5, 2, &month))) {
+  const uint64_t digits = word ^ 0x1D00001D00000000ULL;  // '-' ^ '0' == 0x1D
+  if (ARROW_PREDICT_FALSE(!detail::AreEightDigits(digits))) {
     return false;
   }
+  const uint64_t pairs = detail::ParseDigitPairs(digits);
+  const auto year = static_cast<uint16_t>((pairs & 0xFF) * 100 + ((pairs >> 16) & 0xFF));
+  const auto month = static_cast<uint8_t>(pairs >> 40);
+  uint8_t day = 0;
   if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 8, 2, &day))) {
     return false;
   }
@@ -56,6 +56,23 @@ static std::vector<std::string> MakeIntStrings(int32_t num_items) {
   return strings;
 }
 
+// Integers with at least 8 digits, e.g. identifiers or epoch timestamps
+template <typename c_int>
+static std::vector<std::string> MakeWideIntStrings(int32_t num_items) {
+  using c_int_limits = std::numeric_limits<c_int>;
+  std::vector<std::string> base_strings = {"12345678",
+                                           "987654321",
+                                           std::to_string(c_int_limits::max() / 3),
+                                           std::to_string(c_int_limits::max() / 100),
+                                           std::to_string(c_int_limits::min()),
+                                           std::to_string(c_int_limits::max())};
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < num_items; ++i) {
+    strings.push_back(base_strings[i % base_strings.size()]);
+  }
+  return strings;
+}
+
 template <typename c_int>
 static std::vector<std::string> MakeHexStrings(int32_t num_items) {
   int32_t num_bytes = sizeof(c_int);
@@ -125,9 +142,8 @@ static std::vector<c_float> MakeFloats(int32_t num_items) {
 }
 
 template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
-static void IntegerParsing(benchmark::State& state) {  // NOLINT non-const reference
-  auto strings = MakeIntStrings<C_TYPE>(1000);
-
+static void BenchIntegerParsing(benchmark::State& state,  // NOLINT non-const reference
+                                const std::vector<std::string>& strings) {
   while (state.KeepRunning()) {
     C_TYPE total = 0;
     for (const auto& s : strings) {
@@ -143,6 +159,16 @@ static void IntegerParsing(benchmark::State& state) {  // NOLINT non-const refer
   state.SetItemsProcessed(state.iterations() * strings.size());
 }
 
+template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
+static void IntegerParsing(benchmark::State& state) {  // NOLINT non-const reference
+  BenchIntegerParsing<ARROW_TYPE>(state, MakeIntStrings<C_TYPE>(1000));
+}
+
+template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
+static void WideIntegerParsing(benchmark::State& state) {  // NOLINT non-const reference
+  BenchIntegerParsing<ARROW_TYPE>(state, MakeWideIntStrings<C_TYPE>(1000));
+}
+
 template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
 static void HexParsing(benchmark::State& state) {  // NOLINT non-const reference
   auto strings = MakeHexStrings<C_TYPE>(1000);
@@ -269,6 +295,11 @@ BENCHMARK_TEMPLATE(IntegerParsing, UInt16Type);
 BENCHMARK_TEMPLATE(IntegerParsing, UInt32Type);
 BENCHMARK_TEMPLATE(IntegerParsing, UInt64Type);
 
+BENCHMARK_TEMPLATE(WideIntegerParsing, Int32Type);
+BENCHMARK_TEMPLATE(WideIntegerParsing, Int64Type);
+BENCHMARK_TEMPLATE(WideIntegerParsing, UInt32Type);
+BENCHMARK_TEMPLATE(WideIntegerParsing, UInt64Type);
+
 BENCHMARK_TEMPLATE(HexParsing, Int8Type);
 BENCHMARK_TEMPLATE(HexParsing, Int16Type);
 BENCHMARK_TEMPLATE(HexParsing, Int32Type);
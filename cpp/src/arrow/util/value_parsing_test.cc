@@ -462,6 +462,27 @@ TEST(StringConversion, ToUInt64) {
   AssertConversionFails<UInt64Type>("0x23512ak");
 }
 
+TEST(StringConversion, ToUInt64ManyDigits) {
+  // Exercise the 8-digits-at-a-time path with all lengths and leading digit counts
+  std::string digits = "1234567890123456789";
+  for (size_t length = 1; length <= digits.size(); ++length) {
+    const std::string s = digits.substr(0, length);
+    AssertConversion<UInt64Type>(s, std::stoull(s));
+    AssertConversion<Int64Type>("-" + s, -static_cast<int64_t>(std::stoull(s)));
+    // A non-digit anywhere is rejected
+    for (size_t pos = 0; pos < length; ++pos) {
+      for (char c : {'/', ':', ' ', 'a', '\xb0'}) {
+        std::string invalid = s;
+        invalid[pos] = c;
+        AssertConversionFails<UInt64Type>(invalid);
+      }
+    }
+  }
+  AssertConversion<UInt64Type>("00000000000000000001", 1);
+  AssertConversion<UInt32Type>("000000001", 1);
+  AssertConversion<UInt32Type>("999999999", 999999999);
+}
+
 TEST(StringConversion, ToDate32) {
   AssertConversion<Date32Type>("1970-01-01", 0);
   AssertConversion<Date32Type>("1970-01-02", 1);
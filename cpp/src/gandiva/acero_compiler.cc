@@ -0,0 +1,316 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/acero_compiler.h"
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/util.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/cast.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "gandiva/filter.h"
+#include "gandiva/projector.h"
+#include "gandiva/selection_vector.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace gandiva {
+
+using arrow::Datum;
+using arrow::Result;
+using arrow::acero::CompiledFilter;
+using arrow::acero::CompiledProjection;
+using arrow::compute::ExecBatch;
+using arrow::compute::ExecContext;
+using arrow::internal::checked_cast;
+
+namespace {
+
+// Compute functions translated to the Gandiva function of the same semantics.
+// "add", "subtract" and "multiply" wrap around on overflow in both.
+const std::unordered_map<std::string, std::string>& GandivaFunctionNames() {
+  static const std::unordered_map<std::string, std::string> names = {
+      {"add", "add"},
+      {"subtract", "subtract"},
+      {"multiply", "multiply"},
+      {"negate", "negative"},
+      {"equal", "equal"},
+      {"not_equal", "not_equal"},
+      {"less", "less_than"},
+      {"less_equal", "less_than_or_equal_to"},
+      {"greater", "greater_than"},
+      {"greater_equal", "greater_than_or_equal_to"},
+      {"invert", "not"},
+      {"is_null", "isnull"},
+      {"is_valid", "isnotnull"},
+  };
+  return names;
+}
+
+bool IsSupportedType(const arrow::DataType& type) {
+  return arrow::is_integer(type.id()) || type.id() == arrow::Type::FLOAT ||
+         type.id() == arrow::Type::DOUBLE || type.id() == arrow::Type::BOOL;
+}
+
+// The lossless casts which binding inserts to unify argument types
+std::optional<std::string> GandivaCastName(const arrow::DataType& from,
+                                           const arrow::DataType& to) {
+  if (to.id() == arrow::Type::INT64 && from.id() == arrow::Type::INT32) {
+    return "castBIGINT";
+  }
+  if (to.id() == arrow::Type::DOUBLE &&
+      (from.id() == arrow::Type::INT32 || from.id() == arrow::Type::FLOAT)) {
+    return "castFLOAT8";
+  }
+  return std::nullopt;
+}
+
+template <typename ArrowType>
+NodePtr MakeNumericLiteral(const arrow::Scalar& scalar) {
+  using ScalarType = typename arrow::TypeTraits<ArrowType>::ScalarType;
+  return TreeExprBuilder::MakeLiteral(checked_cast<const ScalarType&>(scalar).value);
+}
+
+NodePtr TranslateLiteral(const arrow::Scalar& scalar) {
+  if (!scalar.is_valid) return TreeExprBuilder::MakeNull(scalar.type);
+  switch (scalar.type->id()) {
+    case arrow::Type::BOOL:
+      return MakeNumericLiteral<arrow::BooleanType>(scalar);
+    case arrow::Type::INT8:
+      return MakeNumericLiteral<arrow::Int8Type>(scalar);
+    case arrow::Type::INT16:
+      return MakeNumericLiteral<arrow::Int16Type>(scalar);
+    case arrow::Type::INT32:
+      return MakeNumericLiteral<arrow::Int32Type>(scalar);
+    case arrow::Type::INT64:
+      return MakeNumericLiteral<arrow::Int64Type>(scalar);
+    case arrow::Type::UINT8:
+      return MakeNumericLiteral<arrow::UInt8Type>(scalar);
+    case arrow::Type::UINT16:
+      return MakeNumericLiteral<arrow::UInt16Type>(scalar);
+    case arrow::Type::UINT32:
+      return MakeNumericLiteral<arrow::UInt32Type>(scalar);
+    case arrow::Type::UINT64:
+      return MakeNumericLiteral<arrow::UInt64Type>(scalar);
+    case arrow::Type::FLOAT:
+      return MakeNumericLiteral<arrow::FloatType>(scalar);
+    case arrow::Type::DOUBLE:
+      return MakeNumericLiteral<arrow::DoubleType>(scalar);
+    default:
+      return nullptr;
+  }
+}
+
+// Translate a bound expression into a Gandiva tree, or return nullptr if it uses a
+// function or a type which has no Gandiva equivalent
+NodePtr Translate(const arrow::compute::Expression& expr, const arrow::Schema& schema) {
+  if (expr.type() == nullptr || !IsSupportedType(*expr.type())) return nullptr;
+
+  if (auto literal = expr.literal()) {
+    if (!literal->is_scalar()) return nullptr;
+    return TranslateLiteral(*literal->scalar());
+  }
+
+  if (auto param = expr.parameter()) {
+    // Nested field references would need a struct_field equivalent
+    if (param->indices.size() != 1) return nullptr;
+    return TreeExprBuilder::MakeField(schema.field(param->indices[0]));
+  }
+
+  auto call = expr.call();
+  NodeVector arguments;
+  for (const auto& argument : call->arguments) {
+    auto node = Translate(argument, schema);
+    if (node == nullptr) return nullptr;
+    arguments.push_back(std::move(node));
+  }
+
+  const std::string& name = call->function_name;
+  if (name == "and_kleene") return TreeExprBuilder::MakeAnd(arguments);
+  if (name == "or_kleene") return TreeExprBuilder::MakeOr(arguments);
+
+  const auto return_type = expr.type()->GetSharedPtr();
+  if (name == "cast") {
+    auto cast_name =
+        GandivaCastName(*call->arguments[0].type(), *expr.type());
+    if (!cast_name) return nullptr;
+    return TreeExprBuilder::MakeFunction(*cast_name, arguments, return_type);
+  }
+  if (name == "is_null" && call->options != nullptr &&
+      checked_cast<const arrow::compute::NullOptions&>(*call->options).nan_is_null) {
+    return nullptr;
+  }
+
+  const auto& names = GandivaFunctionNames();
+  auto it = names.find(name);
+  if (it == names.end()) return nullptr;
+  return TreeExprBuilder::MakeFunction(it->second, arguments, return_type);
+}
+
+class GandivaProjection : public CompiledProjection {
+ public:
+  GandivaProjection(std::shared_ptr<arrow::Schema> schema,
+                    std::shared_ptr<Projector> projector, ExpressionVector exprs,
+                    std::vector<size_t> positions, size_t num_exprs)
+      : schema_(std::move(schema)),
+        projector_(std::move(projector)),
+        exprs_(std::move(exprs)),
+        positions_(std::move(positions)),
+        num_exprs_(num_exprs) {}
+
+  Result<std::vector<Datum>> Execute(const ExecBatch& batch,
+                                     ExecContext* ctx) const override {
+    std::vector<Datum> out(num_exprs_);
+    arrow::ArrayVector arrays;
+    if (batch.length == 0) {
+      // Gandiva refuses empty record batches
+      for (const auto& expr : exprs_) {
+        ARROW_ASSIGN_OR_RAISE(auto array,
+                              arrow::MakeEmptyArray(expr->result()->type(),
+                                                    ctx->memory_pool()));
+        arrays.push_back(std::move(array));
+      }
+    } else {
+      ARROW_ASSIGN_OR_RAISE(auto record_batch,
+                            batch.ToRecordBatch(schema_, ctx->memory_pool()));
+      ARROW_RETURN_NOT_OK(
+          projector_->Evaluate(*record_batch, ctx->memory_pool(), &arrays));
+    }
+    for (size_t i = 0; i < positions_.size(); ++i) {
+      out[positions_[i]] = std::move(arrays[i]);
+    }
+    return out;
+  }
+
+ private:
+  std::shared_ptr<arrow::Schema> schema_;
+  std::shared_ptr<Projector> projector_;
+  ExpressionVector exprs_;
+  // The position of each compiled expression among those of the node
+  std::vector<size_t> positions_;
+  size_t num_exprs_;
+};
+
+class GandivaFilter : public CompiledFilter {
+ public:
+  GandivaFilter(std::shared_ptr<arrow::Schema> schema, std::shared_ptr<Filter> filter)
+      : schema_(std::move(schema)), filter_(std::move(filter)) {}
+
+  Result<std::shared_ptr<arrow::compute::SelectionVector>> Execute(
+      const ExecBatch& batch, ExecContext* ctx) const override {
+    std::shared_ptr<arrow::ArrayData> indices;
+    if (batch.length == 0) {
+      ARROW_ASSIGN_OR_RAISE(auto empty,
+                            arrow::MakeEmptyArray(arrow::int32(), ctx->memory_pool()));
+      indices = empty->data();
+    } else {
+      ARROW_ASSIGN_OR_RAISE(auto record_batch,
+                            batch.ToRecordBatch(schema_, ctx->memory_pool()));
+      std::shared_ptr<SelectionVector> selection;
+      ARROW_RETURN_NOT_OK(SelectionVector::MakeInt32(record_batch->num_rows(),
+                                                     ctx->memory_pool(), &selection));
+      ARROW_RETURN_NOT_OK(filter_->Evaluate(*record_batch, selection));
+      // Batches are shorter than 2^31 rows, so the uint32 slots are valid int32
+      indices = selection->ToArray()->data()->Copy();
+      indices->type = arrow::int32();
+    }
+    return std::make_shared<arrow::compute::SelectionVector>(std::move(indices));
+  }
+
+ private:
+  std::shared_ptr<arrow::Schema> schema_;
+  std::shared_ptr<Filter> filter_;
+};
+
+class GandivaExpressionCompiler : public arrow::acero::ExpressionCompiler {
+ public:
+  explicit GandivaExpressionCompiler(std::shared_ptr<Configuration> configuration)
+      : configuration_(std::move(configuration)) {}
+
+  Result<std::unique_ptr<CompiledProjection>> CompileProjection(
+      const std::shared_ptr<arrow::Schema>& input_schema,
+      const std::vector<arrow::compute::Expression>& exprs) override {
+    ExpressionVector translated;
+    std::vector<size_t> positions;
+    for (size_t i = 0; i < exprs.size(); ++i) {
+      auto node = Translate(exprs[i], *input_schema);
+      if (node == nullptr) continue;
+      translated.push_back(TreeExprBuilder::MakeExpression(
+          std::move(node),
+          arrow::field("expr_" + std::to_string(i), exprs[i].type()->GetSharedPtr())));
+      positions.push_back(i);
+    }
+    if (translated.empty()) return nullptr;
+
+    std::shared_ptr<Projector> projector;
+    if (!Projector::Make(input_schema, translated, configuration_, &projector).ok()) {
+      // Some translated function has no Gandiva signature for its argument types:
+      // keep only the expressions which compile on their own
+      ExpressionVector supported;
+      std::vector<size_t> supported_positions;
+      for (size_t i = 0; i < translated.size(); ++i) {
+        if (Projector::Make(input_schema, {translated[i]}, configuration_, &projector)
+                .ok()) {
+          supported.push_back(translated[i]);
+          supported_positions.push_back(positions[i]);
+        }
+      }
+      if (supported.empty()) return nullptr;
+      translated = std::move(supported);
+      positions = std::move(supported_positions);
+      ARROW_RETURN_NOT_OK(
+          Projector::Make(input_schema, translated, configuration_, &projector));
+    }
+    return std::make_unique<GandivaProjection>(input_schema, std::move(projector),
+                                               std::move(translated),
+                                               std::move(positions), exprs.size());
+  }
+
+  Result<std::unique_ptr<CompiledFilter>> CompileFilter(
+      const std::shared_ptr<arrow::Schema>& input_schema,
+      const arrow::compute::Expression& filter) override {
+    auto node = Translate(filter, *input_schema);
+    if (node == nullptr) return nullptr;
+
+    std::shared_ptr<Filter> gandiva_filter;
+    if (!Filter::Make(input_schema, TreeExprBuilder::MakeCondition(std::move(node)),
+                      configuration_, &gandiva_filter)
+             .ok()) {
+      return nullptr;
+    }
+    return std::make_unique<GandivaFilter>(input_schema, std::move(gandiva_filter));
+  }
+
+ private:
+  std::shared_ptr<Configuration> configuration_;
+};
+
+}  // namespace
+
+std::shared_ptr<arrow::acero::ExpressionCompiler> MakeAceroExpressionCompiler(
+    std::shared_ptr<Configuration> configuration) {
+  return std::make_shared<GandivaExpressionCompiler>(std::move(configuration));
+}
+
+}  // namespace gandiva
@@ -0,0 +1,41 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/acero/expression_compiler.h"
+#include "gandiva/configuration.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief Make an Acero ExpressionCompiler backed by Gandiva.
+///
+/// Set it as arrow::acero::QueryOptions::expression_compiler to run the project and
+/// filter nodes of a plan with a Gandiva Projector and Filter, which are compiled once
+/// per node and shared through the Gandiva cache. Expressions using functions or types
+/// that have no Gandiva equivalent are left to Acero's compute kernels.
+///
+/// \param[in] configuration run time configuration of the projectors and filters.
+GANDIVA_EXPORT
+std::shared_ptr<arrow::acero::ExpressionCompiler> MakeAceroExpressionCompiler(
+    std::shared_ptr<Configuration> configuration =
+        ConfigurationBuilder::DefaultConfiguration());
+
+}  // namespace gandiva
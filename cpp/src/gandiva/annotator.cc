@@ -94,7 +94,8 @@ void Annotator::PrepareBuffersForField(const FieldDescriptor& desc,
 }
 
 EvalBatchPtr Annotator::PrepareEvalBatch(const arrow::RecordBatch& record_batch,
-                                         const ArrayDataVector& out_vector) const {
+                                         const ArrayDataVector& out_vector,
+                                         int first_output) const {
   EvalBatchPtr eval_batch = std::make_shared<EvalBatch>(
       record_batch.num_rows(), buffer_count_, local_bitmap_count_);
 
@@ -112,7 +113,7 @@ EvalBatchPtr Annotator::PrepareEvalBatch(const arrow::RecordBatch& record_batch,
   }
 
   // Fill in the entries for the output fields.
-  int idx = 0;
+  int idx = first_output;
   for (auto& arraydata : out_vector) {
     const FieldDescriptorPtr& desc = out_descs_.at(idx);
     PrepareBuffersForField(*desc, *arraydata, eval_batch.get(), true /*is_output*/);
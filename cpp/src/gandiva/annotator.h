@@ -57,8 +57,12 @@ class GANDIVA_EXPORT Annotator {
   const void* const* GetHolderPointersArray() const { return holder_pointers_.data(); }
 
   /// Prepare an eval batch for the incoming record batch.
+  ///
+  /// out_vector holds the outputs starting at the output field with index
+  /// first_output, the output fields not in out_vector are left unset.
   EvalBatchPtr PrepareEvalBatch(const arrow::RecordBatch& record_batch,
-                                const ArrayDataVector& out_vector) const;
+                                const ArrayDataVector& out_vector,
+                                int first_output = 0) const;
 
   int buffer_count() const { return buffer_count_; }
 
@@ -26,6 +26,8 @@ namespace gandiva {
 
 constexpr auto kCacheCapacityEnvVar = "GANDIVA_CACHE_SIZE";
 constexpr auto kDefaultCacheSize = 5000;
+constexpr auto kCacheCapacityBytesEnvVar = "GANDIVA_CACHE_MAX_BYTES";
+constexpr int64_t kDefaultCacheCapacityBytes = 256LL * 1024 * 1024;
 
 namespace internal {
 int GetCacheCapacityFromEnvVar() {
@@ -47,6 +49,26 @@ int GetCacheCapacityFromEnvVar() {
   }
   return capacity;
 }
+
+int64_t GetCacheCapacityBytesFromEnvVar() {
+  auto maybe_env_value = ::arrow::internal::GetEnvVar(kCacheCapacityBytesEnvVar);
+  if (!maybe_env_value.ok()) {
+    return kDefaultCacheCapacityBytes;
+  }
+  const auto env_value = *std::move(maybe_env_value);
+  if (env_value.empty()) {
+    return kDefaultCacheCapacityBytes;
+  }
+  int64_t capacity = 0;
+  bool ok = ::arrow::internal::ParseValue<::arrow::Int64Type>(
+      env_value.c_str(), env_value.size(), &capacity);
+  if (!ok || capacity <= 0) {
+    ARROW_LOG(WARNING) << "Invalid cache size provided in " << kCacheCapacityBytesEnvVar
+                       << ". Using default cache size: " << kDefaultCacheCapacityBytes;
+    return kDefaultCacheCapacityBytes;
+  }
+  return capacity;
+}
 }  // namespace internal
 
 int GetCacheCapacity() {
@@ -54,8 +76,18 @@ int GetCacheCapacity() {
   return capacity;
 }
 
+int64_t GetCacheCapacityBytes() {
+  static const int64_t capacity = internal::GetCacheCapacityBytesFromEnvVar();
+  return capacity;
+}
+
 void LogCacheSize(size_t capacity) {
   ARROW_LOG(INFO) << "Creating gandiva cache with capacity of " << capacity;
 }
 
+void LogCacheSize(size_t capacity, uint64_t capacity_bytes) {
+  ARROW_LOG(INFO) << "Creating gandiva cache with capacity of " << capacity
+                  << " entries and " << capacity_bytes << " bytes";
+}
+
 }  // namespace gandiva
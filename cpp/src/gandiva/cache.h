@@ -17,11 +17,15 @@
 
 #pragma once
 
+#include <cstdint>
 #include <cstdlib>
+#include <memory>
 #include <mutex>
+#include <unordered_map>
+#include <utility>
 
 #include "arrow/util/macros.h"
-#include "gandiva/lru_cache.h"
+#include "gandiva/greedy_dual_size_cache.h"
 #include "gandiva/visibility.h"
 
 namespace gandiva {
@@ -32,20 +36,61 @@ namespace internal {
 // Also makes the testing easier.
 GANDIVA_EXPORT
 int GetCacheCapacityFromEnvVar();
+
+// Only called once by GetCacheCapacityBytes().
+GANDIVA_EXPORT
+int64_t GetCacheCapacityBytesFromEnvVar();
 }  // namespace internal
 
 GANDIVA_EXPORT
 int GetCacheCapacity();
 
+GANDIVA_EXPORT
+int64_t GetCacheCapacityBytes();
+
 GANDIVA_EXPORT
 void LogCacheSize(size_t capacity);
 
+GANDIVA_EXPORT
+void LogCacheSize(size_t capacity, uint64_t capacity_bytes);
+
+/// Thread-safe cache of compiled code.
+///
+/// Entries are bounded both in number and in total size, and are evicted
+/// according to how expensive they are to rebuild per byte (see
+/// GreedyDualSizeCache).
 template <class KeyType, typename ValueType>
 class Cache {
  public:
-  explicit Cache(size_t capacity) : cache_(capacity) { LogCacheSize(capacity); }
+  /// Exclusive right to build the code of a key, see LockBuild().
+  class BuildLock {
+   public:
+    BuildLock(Cache* cache, KeyType cache_key, std::shared_ptr<std::mutex> mutex)
+        : cache_(cache), cache_key_(std::move(cache_key)), mutex_(std::move(mutex)) {
+      mutex_->lock();
+    }
+
+    ~BuildLock() {
+      mutex_->unlock();
+      mutex_.reset();
+      cache_->ReleaseBuild(cache_key_);
+    }
+
+    ARROW_DISALLOW_COPY_AND_ASSIGN(BuildLock);
+
+   private:
+    Cache* cache_;
+    KeyType cache_key_;
+    std::shared_ptr<std::mutex> mutex_;
+  };
+
+  Cache(size_t capacity, uint64_t capacity_bytes) : cache_(capacity, capacity_bytes) {
+    LogCacheSize(capacity, capacity_bytes);
+  }
+
+  explicit Cache(size_t capacity) : Cache(capacity, GetCacheCapacityBytes()) {}
 
-  Cache() : Cache(GetCacheCapacity()) {}
+  Cache() : Cache(GetCacheCapacity(), GetCacheCapacityBytes()) {}
 
   ValueType GetObjectCode(const KeyType& cache_key) {
     std::optional<ValueType> result;
@@ -54,13 +99,61 @@ class Cache {
     return result != std::nullopt ? *result : nullptr;
   }
 
+  /// \param[in] cache_key the key of the entry
+  /// \param[in] module the compiled code
+  /// \param[in] size the memory footprint of the compiled code, in bytes
+  /// \param[in] cost the cost of building the code, e.g. in microseconds
+  void PutObjectCode(const KeyType& cache_key, const ValueType& module, uint64_t size,
+                     uint64_t cost) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    cache_.insert(cache_key, module, size, cost);
+  }
+
   void PutObjectCode(const KeyType& cache_key, const ValueType& module) {
+    PutObjectCode(cache_key, module, /*size=*/1, /*cost=*/1);
+  }
+
+  CacheStats stats() {
     std::lock_guard<std::mutex> lock(mtx_);
-    cache_.insert(cache_key, module);
+    return cache_.stats();
+  }
+
+  /// Serialize the builds of a key.
+  ///
+  /// The lock is held while the code of the key is looked up, built and cached, so
+  /// that concurrent requests for the same key wait for the first build and then
+  /// find its code in the cache instead of compiling it again. Builds of different
+  /// keys are not serialized.
+  BuildLock LockBuild(const KeyType& cache_key) {
+    std::shared_ptr<std::mutex> build_mutex;
+    {
+      std::lock_guard<std::mutex> lock(mtx_);
+      auto& in_flight = in_flight_builds_[cache_key];
+      build_mutex = in_flight.lock();
+      if (build_mutex == nullptr) {
+        build_mutex = std::make_shared<std::mutex>();
+        in_flight = build_mutex;
+      }
+    }
+    return BuildLock(this, cache_key, std::move(build_mutex));
   }
 
  private:
-  LruCache<KeyType, ValueType> cache_;
+  struct KeyHasher {
+    size_t operator()(const KeyType& key) const { return key.Hash(); }
+  };
+
+  void ReleaseBuild(const KeyType& cache_key) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto it = in_flight_builds_.find(cache_key);
+    if (it != in_flight_builds_.end() && it->second.expired()) {
+      in_flight_builds_.erase(it);
+    }
+  }
+
+  GreedyDualSizeCache<KeyType, ValueType> cache_;
+  // Keys being built, with the mutex held by the build in progress
+  std::unordered_map<KeyType, std::weak_ptr<std::mutex>, KeyHasher> in_flight_builds_;
   std::mutex mtx_;
 };
 }  // namespace gandiva
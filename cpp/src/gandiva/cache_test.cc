@@ -16,6 +16,11 @@
 // under the License.
 
 #include "gandiva/cache.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
@@ -44,9 +49,53 @@ TEST(TestCache, TestGetPut) {
   ASSERT_EQ(cache.GetObjectCode(TestCacheKey(2)), world);
 }
 
+TEST(TestCache, TestByteCapacity) {
+  Cache<TestCacheKey, std::shared_ptr<std::string>> cache(10, 100);
+  auto small = std::make_shared<std::string>("small");
+  cache.PutObjectCode(TestCacheKey(1), small, /*size=*/40, /*cost=*/1000);
+  auto large = std::make_shared<std::string>("large");
+  cache.PutObjectCode(TestCacheKey(2), large, /*size=*/50, /*cost=*/10);
+  auto other = std::make_shared<std::string>("other");
+  cache.PutObjectCode(TestCacheKey(3), other, /*size=*/40, /*cost=*/1000);
+  // the large and cheap entry is evicted first
+  ASSERT_EQ(cache.GetObjectCode(TestCacheKey(1)), small);
+  ASSERT_EQ(cache.GetObjectCode(TestCacheKey(2)), nullptr);
+  ASSERT_EQ(cache.GetObjectCode(TestCacheKey(3)), other);
+
+  auto stats = cache.stats();
+  ASSERT_EQ(stats.hits, 2);
+  ASSERT_EQ(stats.misses, 1);
+  ASSERT_EQ(stats.evictions, 1);
+  ASSERT_EQ(stats.entries, 2);
+  ASSERT_EQ(stats.bytes, 80);
+}
+
+TEST(TestCache, TestLockBuild) {
+  Cache<TestCacheKey, std::shared_ptr<std::string>> cache(10);
+  std::atomic<int> builds{0};
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back([&cache, &builds, i] {
+      TestCacheKey key(i % 2);
+      auto build_lock = cache.LockBuild(key);
+      if (cache.GetObjectCode(key) == nullptr) {
+        ++builds;
+        cache.PutObjectCode(key, std::make_shared<std::string>("code"));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  // each key is built once, the other threads wait and find it in the cache
+  ASSERT_EQ(builds, 2);
+}
+
 namespace {
 constexpr auto cache_capacity_env_var = "GANDIVA_CACHE_SIZE";
 constexpr auto default_cache_capacity = 5000;
+constexpr auto cache_capacity_bytes_env_var = "GANDIVA_CACHE_MAX_BYTES";
+constexpr int64_t default_cache_capacity_bytes = 256LL * 1024 * 1024;
 }  // namespace
 
 TEST(TestCache, TestGetCacheCapacityDefault) {
@@ -107,4 +156,34 @@ TEST(TestCache, TestGetCacheCapacityEnvVar) {
   }
 }
 
+TEST(TestCache, TestGetCacheCapacityBytesEnvVar) {
+  using ::arrow::EnvVarGuard;
+
+  ASSERT_EQ(GetCacheCapacityBytes(), default_cache_capacity_bytes);
+
+  // Empty.
+  {
+    EnvVarGuard guard(cache_capacity_bytes_env_var, "");
+    ASSERT_EQ(internal::GetCacheCapacityBytesFromEnvVar(), default_cache_capacity_bytes);
+  }
+
+  // Non-number.
+  {
+    EnvVarGuard guard(cache_capacity_bytes_env_var, "1GB");
+    ASSERT_EQ(internal::GetCacheCapacityBytesFromEnvVar(), default_cache_capacity_bytes);
+  }
+
+  // Valid number over int32 max.
+  {
+    EnvVarGuard guard(cache_capacity_bytes_env_var, "4294967296");
+    ASSERT_EQ(internal::GetCacheCapacityBytesFromEnvVar(), 4294967296LL);
+  }
+
+  // Negative number.
+  {
+    EnvVarGuard guard(cache_capacity_bytes_env_var, "-1");
+    ASSERT_EQ(internal::GetCacheCapacityBytesFromEnvVar(), default_cache_capacity_bytes);
+  }
+}
+
 }  // namespace gandiva
@@ -31,12 +31,14 @@ std::size_t Configuration::Hash() const {
   arrow::internal::hash_combine(result, static_cast<size_t>(target_host_cpu_));
   arrow::internal::hash_combine(
       result, reinterpret_cast<std::uintptr_t>(function_registry_.get()));
+  arrow::internal::hash_combine(result, static_cast<size_t>(parameterize_literals_));
   return result;
 }
 
 bool Configuration::operator==(const Configuration& other) const {
   return optimize_ == other.optimize_ && target_host_cpu_ == other.target_host_cpu_ &&
-         function_registry_ == other.function_registry_;
+         function_registry_ == other.function_registry_ &&
+         parameterize_literals_ == other.parameterize_literals_;
 }
 
 bool Configuration::operator!=(const Configuration& other) const {
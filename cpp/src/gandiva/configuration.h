@@ -53,12 +53,20 @@ class GANDIVA_EXPORT Configuration {
   bool optimize() const { return optimize_; }
   bool target_host_cpu() const { return target_host_cpu_; }
   bool dump_ir() const { return dump_ir_; }
+  bool lazy_compilation() const { return lazy_compilation_; }
+  bool parameterize_literals() const { return parameterize_literals_; }
   std::shared_ptr<FunctionRegistry> function_registry() const {
     return function_registry_;
   }
 
   void set_optimize(bool optimize) { optimize_ = optimize; }
   void set_dump_ir(bool dump_ir) { dump_ir_ = dump_ir; }
+  void set_lazy_compilation(bool lazy_compilation) {
+    lazy_compilation_ = lazy_compilation;
+  }
+  void set_parameterize_literals(bool parameterize_literals) {
+    parameterize_literals_ = parameterize_literals;
+  }
   void target_host_cpu(bool target_host_cpu) { target_host_cpu_ = target_host_cpu; }
   void set_function_registry(std::shared_ptr<FunctionRegistry> function_registry) {
     function_registry_ = std::move(function_registry);
@@ -72,6 +80,14 @@ class GANDIVA_EXPORT Configuration {
   // flag indicating if IR dumping is needed, defaults to false, and turning it on will
   // negatively affect performance
   bool dump_ir_ = false;
+  // flag indicating if the functions of the module are compiled to machine code on
+  // their first call rather than when the module is built, defaults to false. Code
+  // compiled lazily is not stored in the object caches.
+  bool lazy_compilation_ = false;
+  // flag indicating if the generated code reads the numeric and temporal literals at
+  // runtime, so that expressions differing only in those share their compiled code.
+  // Defaults to false, as the constants can no longer be folded by the optimizer.
+  bool parameterize_literals_ = false;
 };
 
 /// \brief configuration builder for gandiva
@@ -204,11 +204,18 @@ class GANDIVA_EXPORT LiteralDex : public Dex {
 
   const LiteralHolder& holder() const { return holder_; }
 
+  /// Index of the pointer to the value in the holder pointers if the literal is
+  /// parameterized, i.e. read at runtime, or -1 if the value is a constant of the code.
+  int holder_idx() const { return holder_idx_; }
+
+  void set_holder_idx(int holder_idx) { holder_idx_ = holder_idx; }
+
   void Accept(DexVisitor& visitor) override { visitor.Visit(*this); }
 
  private:
   DataTypePtr type_;
   LiteralHolder holder_;
+  int holder_idx_ = -1;
 };
 
 /// decomposed if-else expression.
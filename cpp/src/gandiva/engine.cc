@@ -198,7 +198,8 @@ Result<std::unique_ptr<llvm::jitlink::InProcessMemoryManager>> CreateMemmoryMana
   return AsArrowResult(maybe_mem_manager, "Could not create memory manager: ");
 }
 
-Status UseJITLinkIfEnabled(llvm::orc::LLJITBuilder& jit_builder) {
+template <typename JITBuilder>
+Status UseJITLinkIfEnabled(JITBuilder& jit_builder) {
   static auto maybe_use_jit_link = ::arrow::internal::GetEnvVar("GANDIVA_USE_JIT_LINK");
   if (maybe_use_jit_link.ok()) {
     ARROW_ASSIGN_OR_RAISE(static auto memory_manager, CreateMemmoryManager());
@@ -217,10 +218,13 @@ Status UseJITLinkIfEnabled(llvm::orc::LLJITBuilder& jit_builder) {
 }
 #endif
 
+// JITBuilder is either llvm::orc::LLJITBuilder, or llvm::orc::LLLazyJITBuilder to
+// compile the functions on their first call
+template <typename JITBuilder>
 Result<std::unique_ptr<llvm::orc::LLJIT>> BuildJIT(
     llvm::orc::JITTargetMachineBuilder jtmb,
     std::optional<std::reference_wrapper<GandivaObjectCache>>& object_cache) {
-  llvm::orc::LLJITBuilder jit_builder;
+  JITBuilder jit_builder;
 
 #ifdef JIT_LINK_SUPPORTED
   ARROW_RETURN_NOT_OK(UseJITLinkIfEnabled(jit_builder));
@@ -246,11 +250,11 @@ Result<std::unique_ptr<llvm::orc::LLJIT>> BuildJIT(
                         AsArrowResult(maybe_jit, "Could not create LLJIT instance: "));
 
   AddProcessSymbol(*jit);
-  return jit;
+  return std::unique_ptr<llvm::orc::LLJIT>(std::move(jit));
 }
 
-arrow::Status VerifyAndLinkModule(
-    llvm::Module& dest_module,
+Result<std::unique_ptr<llvm::Module>> VerifyModule(
+    const llvm::Module& dest_module,
     llvm::Expected<std::unique_ptr<llvm::Module>> src_module_or_error) {
   ARROW_ASSIGN_OR_RAISE(
       auto src_ir_module,
@@ -263,7 +267,14 @@ arrow::Status VerifyAndLinkModule(
   ARROW_RETURN_IF(
       llvm::verifyModule(*src_ir_module, &error_stream),
       Status::CodeGenError("verify of IR Module failed: " + error_stream.str()));
+  return src_ir_module;
+}
 
+arrow::Status VerifyAndLinkModule(
+    llvm::Module& dest_module,
+    llvm::Expected<std::unique_ptr<llvm::Module>> src_module_or_error) {
+  ARROW_ASSIGN_OR_RAISE(auto src_ir_module,
+                        VerifyModule(dest_module, std::move(src_module_or_error)));
   ARROW_RETURN_IF(llvm::Linker::linkModules(dest_module, std::move(src_ir_module)),
                   Status::CodeGenError("failed to link IR Modules"));
 
@@ -323,6 +334,7 @@ Engine::Engine(const std::shared_ptr<Configuration>& conf,
       ir_builder_(std::make_unique<llvm::IRBuilder<>>(*context_)),
       types_(*context_),
       optimize_(conf->optimize()),
+      lazy_compilation_(conf->lazy_compilation()),
       cached_(cached),
       function_registry_(conf->function_registry()),
       target_machine_(std::move(target_machine)),
@@ -368,7 +380,16 @@ Result<std::unique_ptr<Engine>> Engine::Make(
   std::call_once(llvm_init_once_flag, InitOnce);
 
   ARROW_ASSIGN_OR_RAISE(auto jtmb, MakeTargetMachineBuilder(*conf));
-  ARROW_ASSIGN_OR_RAISE(auto jit, BuildJIT(jtmb, object_cache));
+  std::unique_ptr<llvm::orc::LLJIT> jit;
+  if (conf->lazy_compilation()) {
+    // the module is compiled function by function, so there is no single object
+    // file to store in the object cache
+    std::optional<std::reference_wrapper<GandivaObjectCache>> no_object_cache;
+    ARROW_ASSIGN_OR_RAISE(
+        jit, BuildJIT<llvm::orc::LLLazyJITBuilder>(jtmb, no_object_cache));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(jit, BuildJIT<llvm::orc::LLJITBuilder>(jtmb, object_cache));
+  }
   auto maybe_tm = jtmb.createTargetMachine();
   ARROW_ASSIGN_OR_RAISE(auto target_machine,
                         AsArrowResult(maybe_tm, "Could not create target machine: "));
@@ -405,7 +426,34 @@ Status Engine::LoadPreCompiledIR() {
       llvm::getOwningLazyBitcodeModule(std::move(buffer), *context());
   // NOTE: llvm::handleAllErrors() fails linking with RTTI-disabled LLVM builds
   // (ARROW-5148)
-  ARROW_RETURN_NOT_OK(VerifyAndLinkModule(*module_, std::move(module_or_error)));
+  ARROW_ASSIGN_OR_RAISE(precompiled_module_,
+                        VerifyModule(*module_, std::move(module_or_error)));
+
+  // Only declare the functions for now: the bodies stay unmaterialized, and only
+  // those the expressions end up calling are linked by LinkPreCompiledIR().
+  for (const llvm::Function& function : precompiled_module_->functions()) {
+    if (function.isIntrinsic() || function.hasLocalLinkage() ||
+        module_->getFunction(function.getName()) != nullptr) {
+      continue;
+    }
+    auto declaration =
+        llvm::Function::Create(function.getFunctionType(),
+                               llvm::GlobalValue::ExternalLinkage, function.getName(),
+                               module_.get());
+    declaration->setAttributes(function.getAttributes());
+  }
+  return Status::OK();
+}
+
+Status Engine::LinkPreCompiledIR() {
+  if (precompiled_module_ == nullptr) {
+    return Status::OK();
+  }
+  // With LinkOnlyNeeded, only the functions declared in the main module are
+  // linked, along with the functions and globals they reference.
+  ARROW_RETURN_IF(llvm::Linker::linkModules(*module_, std::move(precompiled_module_),
+                                            llvm::Linker::Flags::LinkOnlyNeeded),
+                  Status::CodeGenError("failed to link pre-compiled IR module"));
   return Status::OK();
 }
 
@@ -523,6 +571,10 @@ static void OptimizeModuleWithLegacyPassManager(llvm::Module& module,
 // Optimise and compile the module.
 Status Engine::FinalizeModule() {
   if (!cached_) {
+    // Drop the unused functions first, so that the pre-compiled functions only
+    // they call are not linked, then again to internalize the linked ones.
+    ARROW_RETURN_NOT_OK(RemoveUnusedFunctions());
+    ARROW_RETURN_NOT_OK(LinkPreCompiledIR());
     ARROW_RETURN_NOT_OK(RemoveUnusedFunctions());
 
     if (optimize_) {
@@ -546,7 +598,10 @@ Status Engine::FinalizeModule() {
     }
 
     llvm::orc::ThreadSafeModule tsm(std::move(module_), std::move(context_));
-    auto error = lljit_->addIRModule(std::move(tsm));
+    auto error =
+        lazy_compilation_
+            ? static_cast<llvm::orc::LLLazyJIT&>(*lljit_).addLazyIRModule(std::move(tsm))
+            : lljit_->addIRModule(std::move(tsm));
     if (error) {
       return Status::CodeGenError("Failed to add IR module to LLJIT: ",
                                   llvm::toString(std::move(error)));
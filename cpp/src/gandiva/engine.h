@@ -103,10 +103,15 @@ class GANDIVA_EXPORT Engine {
 
   static void InitOnce();
 
-  /// load pre-compiled IR modules from precompiled_bitcode.cc and merge them into
-  /// the main module.
+  /// load pre-compiled IR modules from precompiled_bitcode.cc and declare their
+  /// functions in the main module. The definitions are linked by
+  /// `LinkPreCompiledIR` once the functions used by the module are known.
   Status LoadPreCompiledIR();
 
+  /// link the definitions of the pre-compiled functions referenced by the main
+  /// module, and of the functions they depend on.
+  Status LinkPreCompiledIR();
+
   // load external pre-compiled bitcodes into module
   Status LoadExternalPreCompiledIR();
 
@@ -120,11 +125,14 @@ class GANDIVA_EXPORT Engine {
   std::unique_ptr<llvm::orc::LLJIT> lljit_;
   std::unique_ptr<llvm::IRBuilder<>> ir_builder_;
   std::unique_ptr<llvm::Module> module_;
+  // lazily materialized pre-compiled IR, until linked into `module_`
+  std::unique_ptr<llvm::Module> precompiled_module_;
   LLVMTypes types_;
 
   std::vector<std::string> functions_to_compile_;
 
   bool optimize_ = true;
+  bool lazy_compilation_ = false;
   bool module_finalized_ = false;
   bool cached_;
   bool functions_loaded_ = false;
@@ -21,11 +21,13 @@
 #include <stack>
 #include <string>
 #include <unordered_set>
+#include <variant>
 #include <vector>
 
 #include "arrow/util/logging_internal.h"
 #include "gandiva/annotator.h"
 #include "gandiva/dex.h"
+#include "gandiva/expression_fingerprint.h"
 #include "gandiva/function_holder_maker_registry.h"
 #include "gandiva/function_registry.h"
 #include "gandiva/function_signature.h"
@@ -239,6 +241,16 @@ Status ExprDecomposer::Visit(const InExpressionNode<std::string>& node) {
 
 Status ExprDecomposer::Visit(const LiteralNode& node) {
   auto value_dex = std::make_shared<LiteralDex>(node.return_type(), node.holder());
+  if (parameterize_literals_ && IsParameterizableLiteral(node)) {
+    // The code reads the value through a holder pointer, so that it can be reused
+    // for other values of the literal.
+    void* value = std::visit(
+        [](const auto& held) {
+          return const_cast<void*>(static_cast<const void*>(&held));
+        },
+        value_dex->holder());
+    value_dex->set_holder_idx(annotator_.AddHolderPointer(value));
+  }
   DexPtr validity_dex;
   if (node.is_null()) {
     validity_dex = std::make_shared<FalseDex>();
@@ -38,8 +38,14 @@ class Annotator;
 /// value expressions.
 class GANDIVA_EXPORT ExprDecomposer : public NodeVisitor {
  public:
-  explicit ExprDecomposer(const FunctionRegistry& registry, Annotator& annotator)
-      : registry_(registry), annotator_(annotator), nested_if_else_(false) {}
+  /// \param parameterize_literals read the parameterizable literals at runtime, see
+  /// IsParameterizableLiteral
+  explicit ExprDecomposer(const FunctionRegistry& registry, Annotator& annotator,
+                          bool parameterize_literals = false)
+      : registry_(registry),
+        annotator_(annotator),
+        nested_if_else_(false),
+        parameterize_literals_(parameterize_literals) {}
 
   Status Decompose(const Node& root, ValueValidityPairPtr* out) {
     auto status = root.Accept(*this);
@@ -126,6 +132,7 @@ class GANDIVA_EXPORT ExprDecomposer : public NodeVisitor {
   std::stack<std::unique_ptr<IfStackEntry>> if_entries_stack_;
   ValueValidityPairPtr result_;
   bool nested_if_else_;
+  bool parameterize_literals_;
 };
 
 }  // namespace gandiva
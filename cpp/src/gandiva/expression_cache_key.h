@@ -19,50 +19,74 @@
 
 #include <stddef.h>
 
+#include <string>
 #include <thread>
 
 #include "arrow/util/hash_util.h"
 #include "gandiva/arrow.h"
 #include "gandiva/configuration.h"
 #include "gandiva/expression.h"
+#include "gandiva/expression_fingerprint.h"
 #include "gandiva/selection_vector.h"
 #include "gandiva/visibility.h"
 
 namespace gandiva {
 
+/// \brief Key of the compiled code of expressions in the cache.
+///
+/// Keys compare the fingerprints of the expressions (see ExpressionFingerprint)
+/// rather than their schema, so that the code is reused for schemas that differ in
+/// field names, metadata or unreferenced fields, and, if the configuration
+/// parameterizes literals, for expressions that differ in their constants.
 class ExpressionCacheKey {
  public:
   ExpressionCacheKey(SchemaPtr schema, std::shared_ptr<Configuration> configuration,
                      ExpressionVector expression_vector, SelectionVector::Mode mode)
-      : schema_(schema), mode_(mode), uniquifier_(0), configuration_(configuration) {
-    static const int kSeedValue = 4;
-    size_t result = kSeedValue;
+      : mode_(mode),
+        uniquifier_(0),
+        configuration_(configuration),
+        is_condition_(false) {
     for (auto& expr : expression_vector) {
-      std::string expr_as_string = expr->ToString();
-      expressions_as_strings_.push_back(expr_as_string);
-      arrow::internal::hash_combine(result, expr_as_string);
-      UpdateUniquifier(expr_as_string);
+      UpdateUniquifier(expr->ToString());
     }
+    fingerprint_ = ExpressionFingerprint(expression_vector,
+                                         configuration->parameterize_literals());
+    static const int kSeedValue = 4;
+    size_t result = kSeedValue;
+    arrow::internal::hash_combine(result, fingerprint_);
     arrow::internal::hash_combine(result, static_cast<size_t>(mode));
     arrow::internal::hash_combine(result, configuration->Hash());
-    arrow::internal::hash_combine(result, schema_->ToString());
     arrow::internal::hash_combine(result, uniquifier_);
     hash_code_ = result;
   }
 
+  /// Key of a FilterProjector, which compiles a condition and expressions together.
+  ExpressionCacheKey(SchemaPtr schema, std::shared_ptr<Configuration> configuration,
+                     const ExpressionPtr& condition,
+                     const ExpressionVector& expression_vector,
+                     SelectionVector::Mode mode)
+      : ExpressionCacheKey(schema, configuration,
+                           ConditionAndExpressions(condition, expression_vector), mode) {
+    is_filter_project_ = true;
+    arrow::internal::hash_combine(hash_code_, std::string("filter_project"));
+  }
+
   ExpressionCacheKey(SchemaPtr schema, std::shared_ptr<Configuration> configuration,
                      Expression& expression)
-      : schema_(schema),
-        mode_(SelectionVector::MODE_NONE),
+      : mode_(SelectionVector::MODE_NONE),
         uniquifier_(0),
-        configuration_(configuration) {
-    static const int kSeedValue = 4;
-    size_t result = kSeedValue;
-    expressions_as_strings_.push_back(expression.ToString());
+        configuration_(configuration),
+        is_condition_(true) {
     UpdateUniquifier(expression.ToString());
+    // The key does not own the expression
+    ExpressionPtr expr(std::shared_ptr<Expression>(), &expression);
+    fingerprint_ =
+        ExpressionFingerprint({expr}, configuration->parameterize_literals());
 
+    static const int kSeedValue = 4;
+    size_t result = kSeedValue;
+    arrow::internal::hash_combine(result, fingerprint_);
     arrow::internal::hash_combine(result, configuration->Hash());
-    arrow::internal::hash_combine(result, schema_->ToString());
     arrow::internal::hash_combine(result, uniquifier_);
     hash_code_ = result;
   }
@@ -79,24 +103,42 @@ class ExpressionCacheKey {
 
   size_t Hash() const { return hash_code_; }
 
+  /// A key that identifies the compiled code across processes, or an empty
+  /// string if the configuration cannot be identified that way (e.g. it uses a
+  /// custom function registry).
+  std::string ToPersistentKey() const {
+    if (configuration_->function_registry() != default_function_registry()) {
+      return "";
+    }
+    std::string key =
+        is_filter_project_ ? "filter_project" : (is_condition_ ? "filter" : "projector");
+    key += "\nmode " + std::to_string(static_cast<int>(mode_));
+    key += "\noptimize " + std::to_string(configuration_->optimize());
+    key += "\ntarget_host_cpu " + std::to_string(configuration_->target_host_cpu());
+    key += "\nparameterize_literals " +
+           std::to_string(configuration_->parameterize_literals());
+    key += "\nexprs " + fingerprint_;
+    return key;
+  }
+
   bool operator==(const ExpressionCacheKey& other) const {
     if (hash_code_ != other.hash_code_) {
       return false;
     }
 
-    if (!(schema_->Equals(*other.schema_, true))) {
+    if (configuration_ != other.configuration_) {
       return false;
     }
 
-    if (configuration_ != other.configuration_) {
+    if (mode_ != other.mode_) {
       return false;
     }
 
-    if (mode_ != other.mode_) {
+    if (is_filter_project_ != other.is_filter_project_) {
       return false;
     }
 
-    if (expressions_as_strings_ != other.expressions_as_strings_) {
+    if (fingerprint_ != other.fingerprint_) {
       return false;
     }
 
@@ -110,12 +152,20 @@ class ExpressionCacheKey {
   bool operator!=(const ExpressionCacheKey& other) const { return !(*this == other); }
 
  private:
+  static ExpressionVector ConditionAndExpressions(const ExpressionPtr& condition,
+                                                  const ExpressionVector& expressions) {
+    ExpressionVector result{condition};
+    result.insert(result.end(), expressions.begin(), expressions.end());
+    return result;
+  }
+
   size_t hash_code_;
-  SchemaPtr schema_;
-  std::vector<std::string> expressions_as_strings_;
+  std::string fingerprint_;
   SelectionVector::Mode mode_;
   uint32_t uniquifier_;
   std::shared_ptr<Configuration> configuration_;
+  bool is_condition_;
+  bool is_filter_project_ = false;
 };
 
 }  // namespace gandiva
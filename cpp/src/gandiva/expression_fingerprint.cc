@@ -0,0 +1,175 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "gandiva/expression_fingerprint.h"
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "gandiva/node_visitor.h"
+
+namespace gandiva {
+
+namespace {
+
+class FingerprintVisitor : public NodeVisitor {
+ public:
+  explicit FingerprintVisitor(bool parameterize_literals)
+      : parameterize_literals_(parameterize_literals) {}
+
+  Status Visit(const FieldNode& node) override {
+    auto inserted = field_ordinals_.emplace(node.field()->name(),
+                                            static_cast<int>(field_ordinals_.size()));
+    out_ << "$" << inserted.first->second << ":" << node.field()->type()->ToString();
+    return Status::OK();
+  }
+
+  Status Visit(const FunctionNode& node) override {
+    out_ << node.descriptor()->name() << "->" << node.return_type()->ToString() << "(";
+    for (const auto& child : node.children()) {
+      ARROW_RETURN_NOT_OK(child->Accept(*this));
+      out_ << ",";
+    }
+    out_ << ")";
+    return Status::OK();
+  }
+
+  Status Visit(const IfNode& node) override {
+    out_ << "if->" << node.return_type()->ToString() << "(";
+    ARROW_RETURN_NOT_OK(node.condition()->Accept(*this));
+    out_ << ",";
+    ARROW_RETURN_NOT_OK(node.then_node()->Accept(*this));
+    out_ << ",";
+    ARROW_RETURN_NOT_OK(node.else_node()->Accept(*this));
+    out_ << ")";
+    return Status::OK();
+  }
+
+  Status Visit(const LiteralNode& node) override {
+    if (parameterize_literals_ && IsParameterizableLiteral(node)) {
+      out_ << "?" << node.return_type()->ToString();
+    } else {
+      // Length-prefixed, string values must not be confused with the structure
+      std::string literal = node.ToString();
+      out_ << literal.size() << ":" << literal;
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const BooleanNode& node) override {
+    out_ << (node.expr_type() == BooleanNode::AND ? "and(" : "or(");
+    for (const auto& child : node.children()) {
+      ARROW_RETURN_NOT_OK(child->Accept(*this));
+      out_ << ",";
+    }
+    out_ << ")";
+    return Status::OK();
+  }
+
+  Status Visit(const InExpressionNode<int32_t>& node) override { return VisitIn(node); }
+  Status Visit(const InExpressionNode<int64_t>& node) override { return VisitIn(node); }
+  Status Visit(const InExpressionNode<float>& node) override { return VisitIn(node); }
+  Status Visit(const InExpressionNode<double>& node) override { return VisitIn(node); }
+  Status Visit(const InExpressionNode<gandiva::DecimalScalar128>& node) override {
+    out_ << "decimal(" << node.get_precision() << "," << node.get_scale() << ")";
+    return VisitIn(node);
+  }
+  Status Visit(const InExpressionNode<std::string>& node) override {
+    return VisitIn(node);
+  }
+
+  std::string fingerprint() const { return out_.str(); }
+
+  void EndExpression(const Expression& expr) {
+    out_ << "->" << expr.result()->type()->ToString() << ";";
+  }
+
+ private:
+  template <typename Type>
+  Status VisitIn(const InExpressionNode<Type>& node) {
+    out_ << "in(";
+    ARROW_RETURN_NOT_OK(node.eval_expr()->Accept(*this));
+    // The values are held in a hash set, sort them to be independent of its order
+    std::vector<std::string> values;
+    values.reserve(node.values().size());
+    for (const auto& value : node.values()) {
+      std::stringstream ss;
+      ss.precision(std::numeric_limits<double>::max_digits10);
+      ss << value;
+      values.push_back(ss.str());
+    }
+    std::sort(values.begin(), values.end());
+    for (const auto& value : values) {
+      out_ << "," << value.size() << ":" << value;
+    }
+    out_ << ")";
+    return Status::OK();
+  }
+
+  const bool parameterize_literals_;
+  std::unordered_map<std::string, int> field_ordinals_;
+  std::stringstream out_;
+};
+
+}  // namespace
+
+bool IsParameterizableLiteral(const LiteralNode& node) {
+  if (node.is_null() || node.return_type() == nullptr) {
+    return false;
+  }
+  switch (node.return_type()->id()) {
+    case arrow::Type::BOOL:
+    case arrow::Type::UINT8:
+    case arrow::Type::UINT16:
+    case arrow::Type::UINT32:
+    case arrow::Type::UINT64:
+    case arrow::Type::INT8:
+    case arrow::Type::INT16:
+    case arrow::Type::INT32:
+    case arrow::Type::INT64:
+    case arrow::Type::FLOAT:
+    case arrow::Type::DOUBLE:
+    case arrow::Type::DATE32:
+    case arrow::Type::DATE64:
+    case arrow::Type::TIME32:
+    case arrow::Type::TIME64:
+    case arrow::Type::TIMESTAMP:
+    case arrow::Type::INTERVAL_MONTHS:
+    case arrow::Type::INTERVAL_DAY_TIME:
+      return true;
+    default:
+      return false;
+  }
+}
+
+std::string ExpressionFingerprint(const ExpressionVector& exprs,
+                                  bool parameterize_literals) {
+  FingerprintVisitor visitor(parameterize_literals);
+  for (const auto& expr : exprs) {
+    // Every node type is handled, visiting cannot fail
+    ARROW_CHECK_OK(expr->root()->Accept(visitor));
+    visitor.EndExpression(*expr);
+  }
+  return visitor.fingerprint();
+}
+
+}  // namespace gandiva
@@ -0,0 +1,47 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <string>
+
+#include "gandiva/expression.h"
+#include "gandiva/node.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief Returns true if the code generated for the literal reads its value at
+/// runtime when literals are parameterized, rather than embedding it.
+///
+/// Only non-null literals of fixed-width, non-decimal types are parameterized:
+/// string patterns and decimals are specialized on at build time.
+GANDIVA_EXPORT bool IsParameterizableLiteral(const LiteralNode& node);
+
+/// \brief A canonical description of the expressions, which keys their compiled code.
+///
+/// The fingerprint only holds what the generated code depends on: the structure of
+/// the expressions, their result types and the types of the fields they reference.
+/// Fields are numbered in order of first reference, so the field names, the schema
+/// metadata and the fields of the schema that are not referenced do not change it.
+/// With `parameterize_literals`, the values of parameterizable literals are left out
+/// too, so that expressions differing only in those constants share their code.
+GANDIVA_EXPORT std::string ExpressionFingerprint(const ExpressionVector& exprs,
+                                                 bool parameterize_literals);
+
+}  // namespace gandiva
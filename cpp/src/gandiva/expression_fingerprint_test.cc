@@ -0,0 +1,101 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "gandiva/expression_fingerprint.h"
+
+#include <gtest/gtest.h>
+
+#include "gandiva/tree_expr_builder.h"
+
+namespace gandiva {
+
+using arrow::boolean;
+using arrow::field;
+using arrow::int32;
+using arrow::int64;
+using arrow::utf8;
+
+namespace {
+
+ExpressionPtr LessThan(const FieldPtr& a, const FieldPtr& b, int32_t value) {
+  auto sum = TreeExprBuilder::MakeFunction(
+      "add", {TreeExprBuilder::MakeField(a), TreeExprBuilder::MakeField(b)}, int32());
+  auto less_than = TreeExprBuilder::MakeFunction(
+      "less_than", {sum, TreeExprBuilder::MakeLiteral(value)}, boolean());
+  return TreeExprBuilder::MakeExpression(less_than, field("res", boolean()));
+}
+
+}  // namespace
+
+TEST(TestExpressionFingerprint, FieldNames) {
+  auto f0 = field("f0", int32());
+  auto f1 = field("f1", int32());
+  auto fingerprint = ExpressionFingerprint({LessThan(f0, f1, 5)}, false);
+
+  // Only the order of first reference matters
+  EXPECT_EQ(fingerprint, ExpressionFingerprint(
+                             {LessThan(field("x", int32()), field("y", int32()), 5)},
+                             false));
+  EXPECT_NE(fingerprint, ExpressionFingerprint({LessThan(f0, f0, 5)}, false));
+  EXPECT_NE(fingerprint,
+            ExpressionFingerprint({LessThan(f0, field("f1", int64()), 5)}, false));
+  // Fields are numbered across the expressions
+  EXPECT_NE(ExpressionFingerprint({LessThan(f0, f1, 5), LessThan(f0, f1, 5)}, false),
+            ExpressionFingerprint({LessThan(f0, f1, 5), LessThan(f1, f0, 5)}, false));
+}
+
+TEST(TestExpressionFingerprint, ParameterizedLiterals) {
+  auto f0 = field("f0", int32());
+  auto f1 = field("f1", int32());
+  EXPECT_NE(ExpressionFingerprint({LessThan(f0, f1, 5)}, false),
+            ExpressionFingerprint({LessThan(f0, f1, 7)}, false));
+  EXPECT_EQ(ExpressionFingerprint({LessThan(f0, f1, 5)}, true),
+            ExpressionFingerprint({LessThan(f0, f1, 7)}, true));
+
+  // String literals are not parameterized
+  auto MakeLike = [&](const std::string& pattern) {
+    auto like = TreeExprBuilder::MakeFunction(
+        "like",
+        {TreeExprBuilder::MakeField(field("s", utf8())),
+         TreeExprBuilder::MakeStringLiteral(pattern)},
+        boolean());
+    return TreeExprBuilder::MakeExpression(like, field("res", boolean()));
+  };
+  EXPECT_NE(ExpressionFingerprint({MakeLike("a%")}, true),
+            ExpressionFingerprint({MakeLike("b%")}, true));
+
+  auto null_literal = TreeExprBuilder::MakeNull(int32());
+  EXPECT_TRUE(IsParameterizableLiteral(
+      dynamic_cast<const LiteralNode&>(*TreeExprBuilder::MakeLiteral(int32_t{5}))));
+  EXPECT_FALSE(IsParameterizableLiteral(dynamic_cast<const LiteralNode&>(*null_literal)));
+}
+
+TEST(TestExpressionFingerprint, InValues) {
+  auto f0 = field("f0", int32());
+  auto MakeIn = [&](const std::unordered_set<int32_t>& values) {
+    return TreeExprBuilder::MakeExpression(
+        TreeExprBuilder::MakeInExpressionInt32(TreeExprBuilder::MakeField(f0), values),
+        field("res", boolean()));
+  };
+  EXPECT_EQ(ExpressionFingerprint({MakeIn({1, 2, 3})}, true),
+            ExpressionFingerprint({MakeIn({3, 2, 1})}, true));
+  EXPECT_NE(ExpressionFingerprint({MakeIn({1, 2, 3})}, true),
+            ExpressionFingerprint({MakeIn({1, 2, 4})}, true));
+}
+
+}  // namespace gandiva
@@ -20,6 +20,8 @@
 #include <memory>
 #include <utility>
 
+#include "arrow/util/thread_pool.h"
+
 #include "gandiva/bitmap_accumulator.h"
 #include "gandiva/cache.h"
 #include "gandiva/condition.h"
@@ -52,29 +54,24 @@ Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
 
   ExpressionCacheKey cache_key(schema, configuration, conditionToKey);
 
-  bool is_cached = false;
-
-  std::shared_ptr<llvm::MemoryBuffer> prev_cached_obj;
-  prev_cached_obj = cache->GetObjectCode(cache_key);
-
-  // Verify if previous filter obj code was cached
-  if (prev_cached_obj != nullptr) {
-    is_cached = true;
-  }
+  // Wait for a concurrent build of the same filter, to reuse its code
+  auto build_lock = cache->LockBuild(cache_key);
 
   GandivaObjectCache obj_cache(cache, cache_key);
 
+  // Verify if previous filter obj code was cached, in this process or on disk
+  bool is_cached = obj_cache.HasObject();
+
   // Build LLVM generator, and generate code for the specified expression
   ARROW_ASSIGN_OR_RAISE(auto llvm_gen,
                         LLVMGenerator::Make(configuration, is_cached, obj_cache));
 
-  if (!is_cached) {
-    // Run the validation on the expression.
-    // Return if the expression is invalid since we will not be able to process further.
-    ExprValidator expr_validator(llvm_gen->types(), schema,
-                                 configuration->function_registry());
-    ARROW_RETURN_NOT_OK(expr_validator.Validate(condition));
-  }
+  // Run the validation on the expression, even if the code is cached: the cache key
+  // does not include the schema.
+  // Return if the expression is invalid since we will not be able to process further.
+  ExprValidator expr_validator(llvm_gen->types(), schema,
+                               configuration->function_registry());
+  ARROW_RETURN_NOT_OK(expr_validator.Validate(condition));
 
   // Set the object cache for LLVM
   ARROW_RETURN_NOT_OK(llvm_gen->SetLLVMObjectCache(obj_cache));
@@ -88,6 +85,17 @@ Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
   return Status::OK();
 }
 
+arrow::Future<std::shared_ptr<Filter>> Filter::MakeAsync(
+    SchemaPtr schema, ConditionPtr condition, std::shared_ptr<Configuration> config) {
+  return arrow::DeferNotOk(LLVMGenerator::GetCompileThreadPool()->Submit(
+      [schema = std::move(schema), condition = std::move(condition),
+       config = std::move(config)]() -> Result<std::shared_ptr<Filter>> {
+        std::shared_ptr<Filter> filter;
+        ARROW_RETURN_NOT_OK(Make(schema, condition, config, &filter));
+        return filter;
+      }));
+}
+
 Status Filter::Evaluate(const arrow::RecordBatch& batch,
                         std::shared_ptr<SelectionVector> out_selection) {
   const auto num_rows = batch.num_rows();
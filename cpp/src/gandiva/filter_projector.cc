@@ -0,0 +1,179 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/filter_projector.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "gandiva/bitmap_accumulator.h"
+#include "gandiva/cache.h"
+#include "gandiva/expr_validator.h"
+#include "gandiva/llvm_generator.h"
+#include "gandiva/local_bitmaps_holder.h"
+#include "gandiva/projector.h"
+#include "gandiva/selection_vector_impl.h"
+
+namespace gandiva {
+
+FilterProjector::FilterProjector(std::unique_ptr<LLVMGenerator> llvm_generator,
+                                 SchemaPtr schema, FieldVector output_fields,
+                                 SelectionVector::Mode selection_vector_mode,
+                                 bool built_from_cache)
+    : llvm_generator_(std::move(llvm_generator)),
+      schema_(std::move(schema)),
+      output_fields_(std::move(output_fields)),
+      selection_vector_mode_(selection_vector_mode),
+      built_from_cache_(built_from_cache) {}
+
+FilterProjector::~FilterProjector() {}
+
+Status FilterProjector::Make(SchemaPtr schema, ConditionPtr condition,
+                             const ExpressionVector& exprs,
+                             SelectionVector::Mode selection_vector_mode,
+                             std::shared_ptr<Configuration> configuration,
+                             std::shared_ptr<FilterProjector>* filter_projector) {
+  ARROW_RETURN_IF(schema == nullptr, Status::Invalid("Schema cannot be null"));
+  ARROW_RETURN_IF(condition == nullptr, Status::Invalid("Condition cannot be null"));
+  ARROW_RETURN_IF(exprs.empty(), Status::Invalid("Expressions cannot be empty"));
+  ARROW_RETURN_IF(selection_vector_mode == SelectionVector::MODE_NONE,
+                  Status::Invalid("A selection vector mode is required"));
+  ARROW_RETURN_IF(configuration == nullptr,
+                  Status::Invalid("Configuration cannot be null"));
+
+  std::shared_ptr<Cache<ExpressionCacheKey, std::shared_ptr<llvm::MemoryBuffer>>> cache =
+      LLVMGenerator::GetCache();
+
+  ExpressionCacheKey cache_key(schema, configuration, condition, exprs,
+                               selection_vector_mode);
+
+  // Wait for a concurrent build of the same filter-projector, to reuse its code
+  auto build_lock = cache->LockBuild(cache_key);
+
+  GandivaObjectCache obj_cache(cache, cache_key);
+
+  // Verify if previous filter-projector obj code was cached, in this process or on
+  // disk
+  bool is_cached = obj_cache.HasObject();
+
+  // Build LLVM generator, and generate code for the condition and expressions
+  ARROW_ASSIGN_OR_RAISE(auto llvm_gen,
+                        LLVMGenerator::Make(configuration, is_cached, obj_cache));
+
+  // Run the validation on the condition and expressions, even if the code is cached:
+  // the cache key does not include the schema.
+  // Return if any of them is invalid since we will not be able to process further.
+  ExprValidator expr_validator(llvm_gen->types(), schema,
+                               configuration->function_registry());
+  ARROW_RETURN_NOT_OK(expr_validator.Validate(condition));
+  for (auto& expr : exprs) {
+    ARROW_RETURN_NOT_OK(expr_validator.Validate(expr));
+  }
+
+  // Set the object cache for LLVM
+  ARROW_RETURN_NOT_OK(llvm_gen->SetLLVMObjectCache(obj_cache));
+
+  ARROW_RETURN_NOT_OK(
+      llvm_gen->BuildFilterProject(condition, exprs, selection_vector_mode));
+
+  // save the output field types. Used to allocate the outputs at Evaluate() time.
+  FieldVector output_fields;
+  output_fields.reserve(exprs.size());
+  for (auto& expr : exprs) {
+    output_fields.push_back(expr->result());
+  }
+
+  *filter_projector = std::shared_ptr<FilterProjector>(
+      new FilterProjector(std::move(llvm_gen), schema, std::move(output_fields),
+                          selection_vector_mode, is_cached));
+  return Status::OK();
+}
+
+Status FilterProjector::EvaluateCondition(
+    const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+    std::shared_ptr<SelectionVector>* selection_vector) const {
+  const auto num_rows = batch.num_rows();
+  switch (selection_vector_mode_) {
+    case SelectionVector::MODE_UINT16:
+      ARROW_RETURN_NOT_OK(SelectionVector::MakeInt16(num_rows, pool, selection_vector));
+      break;
+    case SelectionVector::MODE_UINT32:
+      ARROW_RETURN_NOT_OK(SelectionVector::MakeInt32(num_rows, pool, selection_vector));
+      break;
+    default:
+      ARROW_RETURN_NOT_OK(SelectionVector::MakeInt64(num_rows, pool, selection_vector));
+      break;
+  }
+
+  // Allocate three local_bitmaps (one for output, one for validity, one to compute the
+  // intersection).
+  LocalBitMapsHolder bitmaps(num_rows, 3 /*local_bitmaps*/);
+  int64_t bitmap_size = bitmaps.GetLocalBitMapSize();
+
+  auto validity = std::make_shared<arrow::Buffer>(bitmaps.GetLocalBitMap(0), bitmap_size);
+  auto value = std::make_shared<arrow::Buffer>(bitmaps.GetLocalBitMap(1), bitmap_size);
+  auto array_data = arrow::ArrayData::Make(arrow::boolean(), num_rows, {validity, value});
+
+  ARROW_RETURN_NOT_OK(llvm_generator_->ExecuteCondition(batch, array_data));
+
+  // Compute the intersection of the value and validity.
+  auto result = bitmaps.GetLocalBitMap(2);
+  BitMapAccumulator::IntersectBitMaps(
+      result, {bitmaps.GetLocalBitMap(0), bitmaps.GetLocalBitMap(1)}, {0, 0}, num_rows);
+
+  return (*selection_vector)->PopulateFromBitMap(result, bitmap_size, num_rows - 1);
+}
+
+Status FilterProjector::Evaluate(const arrow::RecordBatch& batch,
+                                 arrow::MemoryPool* pool,
+                                 arrow::ArrayVector* output) const {
+  ARROW_RETURN_IF(!batch.schema()->Equals(*schema_),
+                  Status::Invalid("Schema in RecordBatch must match schema in Make()"));
+  ARROW_RETURN_IF(batch.num_rows() == 0,
+                  Status::Invalid("RecordBatch must be non-empty."));
+  ARROW_RETURN_IF(output == nullptr, Status::Invalid("Output must be non-null."));
+  ARROW_RETURN_IF(pool == nullptr, Status::Invalid("Memory pool must be non-null."));
+
+  std::shared_ptr<SelectionVector> selection_vector;
+  ARROW_RETURN_NOT_OK(EvaluateCondition(batch, pool, &selection_vector));
+
+  // The outputs are sized by the number of matching records.
+  const auto num_selected = selection_vector->GetNumSlots();
+  ArrayDataVector output_data_vecs;
+  for (auto& field : output_fields_) {
+    ArrayDataPtr output_data;
+    ARROW_RETURN_NOT_OK(
+        Projector::AllocArrayData(field->type(), num_selected, pool, &output_data));
+    output_data_vecs.push_back(output_data);
+  }
+
+  if (num_selected > 0) {
+    ARROW_RETURN_NOT_OK(
+        llvm_generator_->ExecuteProjection(batch, *selection_vector, output_data_vecs));
+  }
+
+  output->clear();
+  for (auto& array_data : output_data_vecs) {
+    output->push_back(arrow::MakeArray(array_data));
+  }
+  return Status::OK();
+}
+
+const std::string& FilterProjector::DumpIR() { return llvm_generator_->ir(); }
+
+}  // namespace gandiva
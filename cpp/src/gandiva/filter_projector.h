@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "arrow/status.h"
+
+#include "gandiva/arrow.h"
+#include "gandiva/condition.h"
+#include "gandiva/configuration.h"
+#include "gandiva/expression.h"
+#include "gandiva/selection_vector.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+class LLVMGenerator;
+
+/// \brief filter records based on a condition, and project the matching records.
+///
+/// The condition and the expressions are compiled into a single module, once for
+/// both. Evaluate() evaluates the condition on all the records of the batch, then the
+/// expressions only on the records that match it, so the output arrays have one
+/// entry per matching record. This is equivalent to, and cheaper than, a Filter
+/// followed by a Projector built with a selection vector.
+class GANDIVA_EXPORT FilterProjector {
+ public:
+  // Inline dtor will attempt to resolve the destructor for
+  // LLVMGenerator on MSVC, so we compile the dtor in the object code
+  ~FilterProjector();
+
+  /// Build a filter-projector for the given schema, condition and expressions.
+  ///
+  /// \param[in] schema schema for the record batches, the condition and expressions.
+  /// \param[in] condition filter condition.
+  /// \param[in] exprs vector of expressions evaluated on the matching records.
+  /// \param[in] selection_vector_mode mode of the selection vector holding the matching
+  ///            records, which bounds the size of the batches. MODE_NONE is invalid.
+  /// \param[in] configuration run time configuration.
+  /// \param[out] filter_projector the returned filter-projector object
+  static Status Make(SchemaPtr schema, ConditionPtr condition,
+                     const ExpressionVector& exprs,
+                     SelectionVector::Mode selection_vector_mode,
+                     std::shared_ptr<Configuration> configuration,
+                     std::shared_ptr<FilterProjector>* filter_projector);
+
+  /// Evaluate the specified record batch, and return the allocated and populated output
+  /// arrays for the records that match the condition. The output arrays will be
+  /// allocated from the memory pool 'pool', and added to the vector 'output'.
+  ///
+  /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in] pool memory pool used to allocate the output arrays.
+  /// \param[out] output the vector of allocated/populated arrays.
+  Status Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                  arrow::ArrayVector* output) const;
+
+  const std::string& DumpIR();
+
+  bool GetBuiltFromCache() const { return built_from_cache_; }
+
+ private:
+  FilterProjector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
+                  FieldVector output_fields, SelectionVector::Mode selection_vector_mode,
+                  bool built_from_cache);
+
+  /// Evaluate the condition, and return the selection vector of the matching records.
+  Status EvaluateCondition(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                           std::shared_ptr<SelectionVector>* selection_vector) const;
+
+  std::unique_ptr<LLVMGenerator> llvm_generator_;
+  SchemaPtr schema_;
+  FieldVector output_fields_;
+  SelectionVector::Mode selection_vector_mode_;
+  bool built_from_cache_;
+};
+
+}  // namespace gandiva
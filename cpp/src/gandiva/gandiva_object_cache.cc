@@ -17,16 +17,51 @@
 
 #include "gandiva/gandiva_object_cache.h"
 
+#include <chrono>
 #include <utility>
 
+#include "arrow/util/logging.h"
+
 namespace gandiva {
 
 GandivaObjectCache::GandivaObjectCache(
     std::shared_ptr<Cache<ExpressionCacheKey, std::shared_ptr<llvm::MemoryBuffer>>>&
         cache,
-    ExpressionCacheKey key)
-    : cache_key_(std::move(key)) {
+    ExpressionCacheKey key, std::shared_ptr<PersistentCache> persistent_cache)
+    : cache_key_(std::move(key)), start_time_(std::chrono::steady_clock::now()) {
   cache_ = cache;
+  if (persistent_cache != nullptr) {
+    persistent_key_ = cache_key_.ToPersistentKey();
+    if (!persistent_key_.empty()) {
+      persistent_cache_ = std::move(persistent_cache);
+    }
+  }
+}
+
+uint64_t GandivaObjectCache::ElapsedMicros() const {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - start_time_)
+      .count();
+}
+
+bool GandivaObjectCache::HasObject() {
+  if (looked_up_) {
+    return cached_obj_ != nullptr;
+  }
+  // Look the key up once, so that each build counts as a single hit or miss
+  looked_up_ = true;
+  cached_obj_ = cache_->GetObjectCode(cache_key_);
+  if (cached_obj_ != nullptr || persistent_cache_ == nullptr) {
+    return cached_obj_ != nullptr;
+  }
+  cached_obj_ = persistent_cache_->Get(persistent_key_);
+  if (cached_obj_ == nullptr) {
+    return false;
+  }
+  // Reloading from disk is what it would take to rebuild this entry
+  cache_->PutObjectCode(cache_key_, cached_obj_, cached_obj_->getBufferSize(),
+                        ElapsedMicros());
+  return true;
 }
 
 void GandivaObjectCache::notifyObjectCompiled(const llvm::Module* M,
@@ -35,14 +70,26 @@ void GandivaObjectCache::notifyObjectCompiled(const llvm::Module* M,
       llvm::MemoryBuffer::getMemBufferCopy(Obj.getBuffer(), Obj.getBufferIdentifier());
   std::shared_ptr<llvm::MemoryBuffer> obj_code = std::move(obj_buffer);
 
-  cache_->PutObjectCode(cache_key_, obj_code);
+  // The cost of the entry is the time spent building it, from IR generation
+  // to machine code
+  cache_->PutObjectCode(cache_key_, obj_code, obj_code->getBufferSize(),
+                        ElapsedMicros());
+  looked_up_ = true;
+  cached_obj_ = obj_code;
+
+  if (persistent_cache_ != nullptr) {
+    auto status = persistent_cache_->Put(persistent_key_, Obj);
+    if (!status.ok()) {
+      ARROW_LOG(WARNING) << "Failed to persist gandiva object code: "
+                         << status.ToString();
+    }
+  }
 }
 
 std::unique_ptr<llvm::MemoryBuffer> GandivaObjectCache::getObject(const llvm::Module* M) {
-  std::shared_ptr<llvm::MemoryBuffer> cached_obj = cache_->GetObjectCode(cache_key_);
-  if (cached_obj != nullptr) {
-    std::unique_ptr<llvm::MemoryBuffer> cached_buffer = cached_obj->getMemBufferCopy(
-        cached_obj->getBuffer(), cached_obj->getBufferIdentifier());
+  if (HasObject()) {
+    std::unique_ptr<llvm::MemoryBuffer> cached_buffer = cached_obj_->getMemBufferCopy(
+        cached_obj_->getBuffer(), cached_obj_->getBufferIdentifier());
     return cached_buffer;
   }
   return nullptr;
@@ -17,6 +17,11 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
 #if defined(_MSC_VER)
 #  pragma warning(push)
 #  pragma warning(disable : 4244)
@@ -31,24 +36,42 @@
 
 #include "gandiva/cache.h"
 #include "gandiva/expression_cache_key.h"
+#include "gandiva/persistent_cache.h"
 
 namespace gandiva {
 /// Class that enables the LLVM to use a custom rule to deal with the object code.
+///
+/// Object code is kept in the in-process cache and, when one is configured, in
+/// the persistent cache shared with other processes.
 class GandivaObjectCache : public llvm::ObjectCache {
  public:
   explicit GandivaObjectCache(
       std::shared_ptr<Cache<ExpressionCacheKey, std::shared_ptr<llvm::MemoryBuffer>>>&
           cache,
-      ExpressionCacheKey key);
+      ExpressionCacheKey key,
+      std::shared_ptr<PersistentCache> persistent_cache = GetPersistentCache());
 
   ~GandivaObjectCache() {}
 
+  /// Whether object code is cached for the key. Code found in the persistent
+  /// cache is loaded into the in-process cache. The caches are only looked up
+  /// on the first call.
+  bool HasObject();
+
   void notifyObjectCompiled(const llvm::Module* M, llvm::MemoryBufferRef Obj);
 
   std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* M);
 
  private:
+  uint64_t ElapsedMicros() const;
+
   ExpressionCacheKey cache_key_;
   std::shared_ptr<Cache<ExpressionCacheKey, std::shared_ptr<llvm::MemoryBuffer>>> cache_;
+  std::shared_ptr<PersistentCache> persistent_cache_;
+  std::string persistent_key_;
+  // Start of the build, the elapsed time is used as the cost of the entry
+  std::chrono::steady_clock::time_point start_time_;
+  bool looked_up_ = false;
+  std::shared_ptr<llvm::MemoryBuffer> cached_obj_;
 };
 }  // namespace gandiva
@@ -0,0 +1,160 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+namespace gandiva {
+
+/// Counters describing the behavior of a cache
+struct CacheStats {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  uint64_t evictions = 0;
+  /// Number of entries currently cached
+  size_t entries = 0;
+  /// Total size of the entries currently cached
+  uint64_t bytes = 0;
+};
+
+// a cache which evicts the entries that are cheapest to recompute per byte,
+// using the greedy dual size frequency (GDSF) policy.
+//
+// Each entry has a priority of clock + frequency * cost / size, where cost is
+// what it took to compute the value (e.g. the compilation time) and frequency
+// is the number of times it was used. The entry with the lowest priority is
+// evicted first and the clock is raised to its priority, so entries that are
+// not used anymore age out even if they were expensive.
+template <class Key, class Value>
+class GreedyDualSizeCache {
+ public:
+  using key_type = Key;
+  using value_type = Value;
+  struct hasher {
+    template <typename I>
+    std::size_t operator()(const I& i) const {
+      return i.Hash();
+    }
+  };
+
+  /// \param[in] capacity the maximum number of entries
+  /// \param[in] capacity_bytes the maximum total size of the entries
+  GreedyDualSizeCache(size_t capacity, uint64_t capacity_bytes)
+      : capacity_(capacity), capacity_bytes_(capacity_bytes) {}
+
+  size_t size() const { return map_.size(); }
+
+  size_t capacity() const { return capacity_; }
+
+  uint64_t capacity_bytes() const { return capacity_bytes_; }
+
+  bool empty() const { return map_.empty(); }
+
+  bool contains(const key_type& key) { return map_.find(key) != map_.end(); }
+
+  CacheStats stats() const {
+    CacheStats stats = stats_;
+    stats.entries = map_.size();
+    stats.bytes = bytes_;
+    return stats;
+  }
+
+  void insert(const key_type& key, const value_type& value, uint64_t size,
+              uint64_t cost) {
+    size = std::max<uint64_t>(size, 1);
+    if (capacity_ == 0 || size > capacity_bytes_ || map_.find(key) != map_.end()) {
+      return;
+    }
+    while (!map_.empty() &&
+           (map_.size() >= capacity_ || bytes_ + size > capacity_bytes_)) {
+      evict();
+    }
+
+    Entry entry{value, size, std::max<uint64_t>(cost, 1), 1, priority_queue_.end()};
+    auto inserted = map_.emplace(key, std::move(entry)).first;
+    inserted->second.position =
+        priority_queue_.emplace(Priority(inserted->second), &inserted->first);
+    bytes_ += size;
+  }
+
+  std::optional<value_type> get(const key_type& key) {
+    auto it = map_.find(key);
+    if (it == map_.end()) {
+      ++stats_.misses;
+      return std::nullopt;
+    }
+    ++stats_.hits;
+
+    Entry& entry = it->second;
+    ++entry.frequency;
+    priority_queue_.erase(entry.position);
+    entry.position = priority_queue_.emplace(Priority(entry), &it->first);
+    return entry.value;
+  }
+
+  void clear() {
+    map_.clear();
+    priority_queue_.clear();
+    bytes_ = 0;
+    clock_ = 0;
+  }
+
+ private:
+  using priority_queue_type = std::multimap<double, const key_type*>;
+
+  struct Entry {
+    value_type value;
+    uint64_t size;
+    uint64_t cost;
+    uint64_t frequency;
+    typename priority_queue_type::iterator position;
+  };
+
+  double Priority(const Entry& entry) const {
+    return clock_ + static_cast<double>(entry.frequency) *
+                        static_cast<double>(entry.cost) /
+                        static_cast<double>(entry.size);
+  }
+
+  void evict() {
+    // evict the entry with the lowest priority; among equal priorities the
+    // multimap keeps insertion order, so the oldest entry goes first
+    auto lowest = priority_queue_.begin();
+    clock_ = lowest->first;
+    auto it = map_.find(*lowest->second);
+    bytes_ -= it->second.size;
+    priority_queue_.erase(lowest);
+    map_.erase(it);
+    ++stats_.evictions;
+  }
+
+  std::unordered_map<key_type, Entry, hasher> map_;
+  priority_queue_type priority_queue_;
+  size_t capacity_;
+  uint64_t capacity_bytes_;
+  uint64_t bytes_ = 0;
+  double clock_ = 0;
+  CacheStats stats_;
+};
+
+}  // namespace gandiva
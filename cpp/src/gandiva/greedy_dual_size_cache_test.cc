@@ -0,0 +1,123 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/greedy_dual_size_cache.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace gandiva {
+
+class TestCacheKey {
+ public:
+  explicit TestCacheKey(int tmp) : tmp_(tmp) {}
+  std::size_t Hash() const { return tmp_; }
+  bool operator==(const TestCacheKey& other) const { return tmp_ == other.tmp_; }
+
+ private:
+  int tmp_;
+};
+
+TEST(TestGreedyDualSizeCache, TestEntryCapacity) {
+  GreedyDualSizeCache<TestCacheKey, std::string> cache(2, 1000);
+  cache.insert(TestCacheKey(1), "hello", 1, 1);
+  cache.insert(TestCacheKey(2), "hello", 1, 1);
+  cache.insert(TestCacheKey(1), "world", 1, 1);
+  cache.insert(TestCacheKey(3), "hello", 1, 1);
+  // all entries are equivalent, so the oldest one is evicted
+  ASSERT_EQ(2, cache.size());
+  ASSERT_EQ(cache.get(TestCacheKey(1)), std::nullopt);
+  ASSERT_EQ(*cache.get(TestCacheKey(2)), "hello");
+}
+
+TEST(TestGreedyDualSizeCache, TestByteCapacity) {
+  GreedyDualSizeCache<TestCacheKey, std::string> cache(100, 100);
+  cache.insert(TestCacheKey(1), "small", 10, 10);
+  cache.insert(TestCacheKey(2), "small", 10, 10);
+  cache.insert(TestCacheKey(3), "large", 95, 10);
+  // the large entry needs both small ones to go
+  ASSERT_EQ(1, cache.size());
+  ASSERT_EQ(95, cache.stats().bytes);
+  ASSERT_EQ(*cache.get(TestCacheKey(3)), "large");
+
+  // entries over the capacity are not cached
+  cache.insert(TestCacheKey(4), "huge", 101, 10);
+  ASSERT_EQ(cache.get(TestCacheKey(4)), std::nullopt);
+  ASSERT_EQ(*cache.get(TestCacheKey(3)), "large");
+}
+
+TEST(TestGreedyDualSizeCache, TestCostPerByte) {
+  GreedyDualSizeCache<TestCacheKey, std::string> cache(100, 100);
+  // a large module that was cheap to compile
+  cache.insert(TestCacheKey(1), "large cheap", 50, 10);
+  // small modules that were expensive to compile
+  cache.insert(TestCacheKey(2), "small expensive", 20, 100);
+  cache.insert(TestCacheKey(3), "small expensive", 20, 100);
+  cache.insert(TestCacheKey(4), "small expensive", 20, 100);
+  // the large entry is the cheapest to rebuild per byte
+  ASSERT_EQ(cache.get(TestCacheKey(1)), std::nullopt);
+  ASSERT_EQ(3, cache.size());
+  ASSERT_EQ(1, cache.stats().evictions);
+}
+
+TEST(TestGreedyDualSizeCache, TestFrequency) {
+  GreedyDualSizeCache<TestCacheKey, std::string> cache(2, 1000);
+  cache.insert(TestCacheKey(1), "hello", 1, 1);
+  cache.insert(TestCacheKey(2), "hello", 1, 1);
+  cache.get(TestCacheKey(1));
+  cache.insert(TestCacheKey(3), "hello", 1, 1);
+  // key 1 was used more often, so key 2 is evicted
+  ASSERT_EQ(*cache.get(TestCacheKey(1)), "hello");
+  ASSERT_EQ(cache.get(TestCacheKey(2)), std::nullopt);
+}
+
+TEST(TestGreedyDualSizeCache, TestAging) {
+  GreedyDualSizeCache<TestCacheKey, std::string> cache(2, 1000);
+  cache.insert(TestCacheKey(1), "popular", 1, 1);
+  for (int i = 0; i < 3; ++i) {
+    cache.get(TestCacheKey(1));
+  }
+  // each eviction raises the priority of new entries, so entries that are
+  // used repeatedly eventually outrank the old popular one
+  for (int key = 2; key < 10; ++key) {
+    cache.insert(TestCacheKey(key), "recent", 1, 1);
+    cache.get(TestCacheKey(key));
+  }
+  ASSERT_EQ(cache.get(TestCacheKey(1)), std::nullopt);
+}
+
+TEST(TestGreedyDualSizeCache, TestStats) {
+  GreedyDualSizeCache<TestCacheKey, std::string> cache(1, 1000);
+  cache.insert(TestCacheKey(1), "hello", 5, 1);
+  cache.get(TestCacheKey(1));
+  cache.get(TestCacheKey(2));
+  cache.insert(TestCacheKey(2), "world", 7, 1);
+
+  auto stats = cache.stats();
+  ASSERT_EQ(stats.hits, 1);
+  ASSERT_EQ(stats.misses, 1);
+  ASSERT_EQ(stats.evictions, 1);
+  ASSERT_EQ(stats.entries, 1);
+  ASSERT_EQ(stats.bytes, 7);
+
+  cache.clear();
+  ASSERT_TRUE(cache.empty());
+  ASSERT_EQ(cache.stats().bytes, 0);
+}
+
+}  // namespace gandiva
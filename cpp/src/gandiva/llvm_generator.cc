@@ -21,7 +21,10 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/util/io_util.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/util/value_parsing.h"
 #include "gandiva/bitmap_accumulator.h"
 #include "gandiva/decimal_ir.h"
 #include "gandiva/dex.h"
@@ -38,16 +41,19 @@ namespace gandiva {
   }
 
 LLVMGenerator::LLVMGenerator(bool cached,
-                             std::shared_ptr<FunctionRegistry> function_registry)
+                             std::shared_ptr<FunctionRegistry> function_registry,
+                             bool parameterize_literals)
     : cached_(cached),
       function_registry_(std::move(function_registry)),
+      parameterize_literals_(parameterize_literals),
       enable_ir_traces_(false) {}
 
 Result<std::unique_ptr<LLVMGenerator>> LLVMGenerator::Make(
     const std::shared_ptr<Configuration>& config, bool cached,
     std::optional<std::reference_wrapper<GandivaObjectCache>> object_cache) {
   std::unique_ptr<LLVMGenerator> llvm_generator(
-      new LLVMGenerator(cached, config->function_registry()));
+      new LLVMGenerator(cached, config->function_registry(),
+                        config->parameterize_literals()));
 
   ARROW_ASSIGN_OR_RAISE(llvm_generator->engine_,
                         Engine::Make(config, cached, object_cache));
@@ -63,6 +69,37 @@ LLVMGenerator::GetCache() {
   return shared_cache;
 }
 
+namespace {
+
+constexpr auto kCompileThreadsEnvVar = "GANDIVA_COMPILE_THREADS";
+
+int GetCompileThreads() {
+  const int default_threads = arrow::internal::ThreadPool::DefaultCapacity();
+  auto maybe_env_value = ::arrow::internal::GetEnvVar(kCompileThreadsEnvVar);
+  if (!maybe_env_value.ok() || maybe_env_value->empty()) {
+    return default_threads;
+  }
+  const auto env_value = *std::move(maybe_env_value);
+  int threads = 0;
+  bool ok = ::arrow::internal::ParseValue<::arrow::Int32Type>(
+      env_value.c_str(), env_value.size(), &threads);
+  if (!ok || threads <= 0) {
+    ARROW_LOG(WARNING) << "Invalid number of threads provided in "
+                       << kCompileThreadsEnvVar
+                       << ". Using default: " << default_threads;
+    return default_threads;
+  }
+  return threads;
+}
+
+}  // namespace
+
+arrow::internal::ThreadPool* LLVMGenerator::GetCompileThreadPool() {
+  static std::shared_ptr<arrow::internal::ThreadPool> compile_pool =
+      arrow::internal::ThreadPool::MakeEternal(GetCompileThreads()).ValueOrDie();
+  return compile_pool.get();
+}
+
 Status LLVMGenerator::SetLLVMObjectCache(GandivaObjectCache& object_cache) {
   return engine_->SetLLVMObjectCache(object_cache);
 }
@@ -70,7 +107,7 @@ Status LLVMGenerator::SetLLVMObjectCache(GandivaObjectCache& object_cache) {
 Status LLVMGenerator::Add(const ExpressionPtr expr, const FieldDescriptorPtr output) {
   int idx = static_cast<int>(compiled_exprs_.size());
   // decompose the expression to separate out value and validities.
-  ExprDecomposer decomposer(*function_registry_, annotator_);
+  ExprDecomposer decomposer(*function_registry_, annotator_, parameterize_literals_);
   ValueValidityPairPtr value_validity;
   ARROW_RETURN_NOT_OK(decomposer.Decompose(*expr->root(), &value_validity));
   // Generate the IR function for the decomposed expression.
@@ -118,6 +155,36 @@ Status LLVMGenerator::Build(const ExpressionVector& exprs) {
   return Build(exprs, SelectionVector::Mode::MODE_NONE);
 }
 
+/// \brief Build the code for a condition on all the records, followed by the code
+/// for the expression trees on the selected records.
+Status LLVMGenerator::BuildFilterProject(const ExpressionPtr& condition,
+                                         const ExpressionVector& exprs,
+                                         SelectionVector::Mode mode) {
+  // The condition is the first compiled expression, in the default mode.
+  selection_vector_mode_ = SelectionVector::Mode::MODE_NONE;
+  auto condition_output = annotator_.AddOutputFieldDescriptor(condition->result());
+  ARROW_RETURN_NOT_OK(Add(condition, condition_output));
+
+  selection_vector_mode_ = mode;
+  for (auto& expr : exprs) {
+    auto output = annotator_.AddOutputFieldDescriptor(expr->result());
+    ARROW_RETURN_NOT_OK(Add(expr, output));
+  }
+
+  // Compile and inject into the process' memory the generated functions.
+  ARROW_RETURN_NOT_OK(engine_->FinalizeModule());
+
+  // setup the jit functions for each expression.
+  for (size_t i = 0; i < compiled_exprs_.size(); ++i) {
+    auto expr_mode = i == 0 ? SelectionVector::Mode::MODE_NONE : mode;
+    auto fn_name = compiled_exprs_[i]->GetFunctionName(expr_mode);
+    ARROW_ASSIGN_OR_RAISE(auto fn_ptr, engine_->CompiledFunction(fn_name));
+    compiled_exprs_[i]->SetJITFunction(expr_mode, reinterpret_cast<EvalFunc>(fn_ptr));
+  }
+
+  return Status::OK();
+}
+
 /// Execute the compiled module against the provided vectors.
 Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
                               const ArrayDataVector& output_vector) const {
@@ -129,11 +196,6 @@ Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
 Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
                               const SelectionVector* selection_vector,
                               const ArrayDataVector& output_vector) const {
-  DCHECK_GT(record_batch.num_rows(), 0);
-
-  auto eval_batch = annotator_.PrepareEvalBatch(record_batch, output_vector);
-  DCHECK_GT(eval_batch->GetNumBuffers(), 0);
-
   auto mode = SelectionVector::MODE_NONE;
   if (selection_vector != nullptr) {
     mode = selection_vector->GetMode();
@@ -142,8 +204,42 @@ Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
     return Status::Invalid("llvm expression built for selection vector mode ",
                            selection_vector_mode_, " received vector with mode ", mode);
   }
+  return ExecuteExprs(record_batch, selection_vector, output_vector, /*first_expr=*/0);
+}
 
-  for (auto& compiled_expr : compiled_exprs_) {
+Status LLVMGenerator::ExecuteCondition(const arrow::RecordBatch& record_batch,
+                                       const ArrayDataPtr& condition_output) const {
+  return ExecuteExprs(record_batch, nullptr, {condition_output}, /*first_expr=*/0);
+}
+
+Status LLVMGenerator::ExecuteProjection(const arrow::RecordBatch& record_batch,
+                                        const SelectionVector& selection_vector,
+                                        const ArrayDataVector& output_vector) const {
+  if (selection_vector.GetMode() != selection_vector_mode_) {
+    return Status::Invalid("llvm expression built for selection vector mode ",
+                           selection_vector_mode_, " received vector with mode ",
+                           selection_vector.GetMode());
+  }
+  // The condition is the first compiled expression.
+  return ExecuteExprs(record_batch, &selection_vector, output_vector, /*first_expr=*/1);
+}
+
+Status LLVMGenerator::ExecuteExprs(const arrow::RecordBatch& record_batch,
+                                   const SelectionVector* selection_vector,
+                                   const ArrayDataVector& output_vector,
+                                   int first_expr) const {
+  DCHECK_GT(record_batch.num_rows(), 0);
+
+  auto eval_batch = annotator_.PrepareEvalBatch(record_batch, output_vector, first_expr);
+  DCHECK_GT(eval_batch->GetNumBuffers(), 0);
+
+  auto mode = SelectionVector::MODE_NONE;
+  if (selection_vector != nullptr) {
+    mode = selection_vector->GetMode();
+  }
+
+  for (size_t i = 0; i < output_vector.size(); ++i) {
+    const auto& compiled_expr = compiled_exprs_[first_expr + i];
     // generate data/offset vectors.
     const uint8_t* selection_buffer = nullptr;
     auto num_output_rows = record_batch.num_rows();
@@ -700,6 +796,29 @@ void LLVMGenerator::Visitor::Visit(const LiteralDex& dex) {
   llvm::Value* value = nullptr;
   llvm::Value* len = nullptr;
 
+  if (dex.holder_idx() != -1) {
+    // Parameterized literal, load the value from its holder.
+    llvm::IRBuilder<>* builder = ir_builder();
+    llvm::BasicBlock* saved_block = builder->GetInsertBlock();
+    builder->SetInsertPoint(entry_block_);
+
+    llvm::Value* holder = generator_->LoadVectorAtIndex(
+        arg_holder_ptrs_, types->i64_type(), dex.holder_idx(), "literal");
+    // bool is held in a byte
+    bool is_bool = dex.type()->id() == arrow::Type::BOOL;
+    llvm::Type* type = is_bool ? types->i8_type() : types->IRType(dex.type()->id());
+    value = builder->CreateLoad(
+        type, builder->CreateIntToPtr(holder, types->ptr_type(type)), "literal_value");
+    if (is_bool) {
+      value = builder->CreateTrunc(value, types->i1_type());
+    }
+
+    builder->SetInsertPoint(saved_block);
+    ADD_VISITOR_TRACE("visit parameterized Literal %T", value);
+    result_.reset(new LValue(value));
+    return;
+  }
+
   switch (dex.type()->id()) {
     case arrow::Type::BOOL:
       value = types->i1_constant(std::get<bool>(dex.holder()));
@@ -25,6 +25,7 @@
 #include <vector>
 
 #include "arrow/util/macros.h"
+#include "arrow/util/type_fwd.h"
 #include "gandiva/annotator.h"
 #include "gandiva/compiled_expr.h"
 #include "gandiva/configuration.h"
@@ -58,6 +59,13 @@ class GANDIVA_EXPORT LLVMGenerator {
   static std::shared_ptr<Cache<ExpressionCacheKey, std::shared_ptr<llvm::MemoryBuffer>>>
   GetCache();
 
+  /// \brief Get the thread pool on which projectors and filters are built
+  /// asynchronously.
+  ///
+  /// The number of threads is read from the GANDIVA_COMPILE_THREADS environment
+  /// variable, and defaults to the number of hardware threads.
+  static arrow::internal::ThreadPool* GetCompileThreadPool();
+
   /// \brief Set LLVM ObjectCache.
   Status SetLLVMObjectCache(GandivaObjectCache& object_cache);
 
@@ -69,6 +77,13 @@ class GANDIVA_EXPORT LLVMGenerator {
   /// element in the vector represents an expression tree
   Status Build(const ExpressionVector& exprs);
 
+  /// \brief Build the code for a condition, evaluated on all the records, and for
+  /// expression trees evaluated on the records selected by a selection vector of
+  /// the given mode, in a single module. The generated code is run with
+  /// ExecuteCondition() and ExecuteProjection().
+  Status BuildFilterProject(const ExpressionPtr& condition, const ExpressionVector& exprs,
+                            SelectionVector::Mode mode);
+
   /// \brief Execute the built expression against the provided arguments for
   /// default mode.
   Status Execute(const arrow::RecordBatch& record_batch,
@@ -80,6 +95,17 @@ class GANDIVA_EXPORT LLVMGenerator {
                  const SelectionVector* selection_vector,
                  const ArrayDataVector& output_vector) const;
 
+  /// \brief Execute the condition built by BuildFilterProject() against all the
+  /// records.
+  Status ExecuteCondition(const arrow::RecordBatch& record_batch,
+                          const ArrayDataPtr& condition_output) const;
+
+  /// \brief Execute the expressions built by BuildFilterProject() against the
+  /// records specified in the selection_vector.
+  Status ExecuteProjection(const arrow::RecordBatch& record_batch,
+                           const SelectionVector& selection_vector,
+                           const ArrayDataVector& output_vector) const;
+
   SelectionVector::Mode selection_vector_mode() { return selection_vector_mode_; }
   LLVMTypes* types() { return engine_->types(); }
   llvm::Module* module() { return engine_->module(); }
@@ -87,7 +113,8 @@ class GANDIVA_EXPORT LLVMGenerator {
 
  private:
   explicit LLVMGenerator(bool cached,
-                         std::shared_ptr<FunctionRegistry> function_registry);
+                         std::shared_ptr<FunctionRegistry> function_registry,
+                         bool parameterize_literals = false);
 
   FRIEND_TEST(TestLLVMGenerator, VerifyPCFunctions);
   FRIEND_TEST(TestLLVMGenerator, TestAdd);
@@ -194,6 +221,12 @@ class GANDIVA_EXPORT LLVMGenerator {
   // the expression going to 'output'.
   Status Add(const ExpressionPtr expr, const FieldDescriptorPtr output);
 
+  // Execute the compiled expressions starting at index 'first_expr', one for each
+  // array of 'output_vector'.
+  Status ExecuteExprs(const arrow::RecordBatch& record_batch,
+                      const SelectionVector* selection_vector,
+                      const ArrayDataVector& output_vector, int first_expr) const;
+
   /// Generate code to load the vector at specified index in the 'arg_addrs' array.
   llvm::Value* LoadVectorAtIndex(llvm::Value* arg_addrs, llvm::Type* type, int idx,
                                  const std::string& name);
@@ -263,6 +296,7 @@ class GANDIVA_EXPORT LLVMGenerator {
   std::vector<std::unique_ptr<CompiledExpr>> compiled_exprs_;
   bool cached_;
   std::shared_ptr<FunctionRegistry> function_registry_;
+  bool parameterize_literals_;
   Annotator annotator_;
   SelectionVector::Mode selection_vector_mode_;
 
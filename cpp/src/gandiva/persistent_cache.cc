@@ -0,0 +1,257 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/persistent_cache.h"
+
+#include <algorithm>
+#include <chrono>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable : 4244)
+#  pragma warning(disable : 4141)
+#  pragma warning(disable : 4146)
+#  pragma warning(disable : 4267)
+#  pragma warning(disable : 4624)
+#endif
+
+#include <llvm/Config/llvm-config.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MD5.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/Process.h>
+#include <llvm/Support/raw_ostream.h>
+#if LLVM_VERSION_MAJOR >= 18
+#  include <llvm/TargetParser/Host.h>
+#else
+#  include <llvm/Support/Host.h>
+#endif
+
+#if defined(_MSC_VER)
+#  pragma warning(pop)
+#endif
+
+#include "arrow/util/config.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/value_parsing.h"
+
+namespace gandiva {
+
+constexpr auto kPersistentCacheDirEnvVar = "GANDIVA_PERSISTENT_CACHE_DIR";
+constexpr auto kPersistentCacheCapacityEnvVar = "GANDIVA_PERSISTENT_CACHE_SIZE";
+constexpr int64_t kDefaultPersistentCacheCapacity = 256LL * 1024 * 1024;
+constexpr auto kEntryExtension = ".gdvobj";
+
+namespace {
+
+// Identifies the process that can load an entry: object code is only reused
+// by the same Arrow and LLVM versions on the same target.
+const std::string& EntryHeader() {
+  static const std::string header = [] {
+    std::string result = "gandiva-object-cache 1\narrow " ARROW_VERSION_STRING
+                         "\nllvm " LLVM_VERSION_STRING "\ntriple ";
+    result += llvm::sys::getProcessTriple();
+    result += "\ncpu ";
+    result += llvm::sys::getHostCPUName().str();
+    result += "\n";
+    return result;
+  }();
+  return header;
+}
+
+std::string KeyPrefix(const std::string& key) {
+  return EntryHeader() + std::to_string(key.size()) + "\n" + key;
+}
+
+}  // namespace
+
+namespace internal {
+int64_t GetPersistentCacheCapacityFromEnvVar() {
+  auto maybe_env_value = ::arrow::internal::GetEnvVar(kPersistentCacheCapacityEnvVar);
+  if (!maybe_env_value.ok()) {
+    return kDefaultPersistentCacheCapacity;
+  }
+  const auto env_value = *std::move(maybe_env_value);
+  if (env_value.empty()) {
+    return kDefaultPersistentCacheCapacity;
+  }
+  int64_t capacity = 0;
+  bool ok = ::arrow::internal::ParseValue<::arrow::Int64Type>(
+      env_value.c_str(), env_value.size(), &capacity);
+  if (!ok || capacity <= 0) {
+    ARROW_LOG(WARNING) << "Invalid persistent cache size provided in "
+                       << kPersistentCacheCapacityEnvVar
+                       << ". Using default size: " << kDefaultPersistentCacheCapacity;
+    return kDefaultPersistentCacheCapacity;
+  }
+  return capacity;
+}
+}  // namespace internal
+
+arrow::Result<std::shared_ptr<PersistentCache>> PersistentCache::Make(
+    std::string directory, int64_t capacity) {
+  ARROW_RETURN_IF(directory.empty(),
+                  arrow::Status::Invalid("Persistent cache directory cannot be empty"));
+  ARROW_RETURN_IF(capacity <= 0,
+                  arrow::Status::Invalid("Persistent cache capacity must be positive"));
+  if (auto ec = llvm::sys::fs::create_directories(directory)) {
+    return arrow::Status::IOError("Cannot create Gandiva cache directory '", directory,
+                                  "': ", ec.message());
+  }
+  return std::shared_ptr<PersistentCache>(
+      new PersistentCache(std::move(directory), capacity));
+}
+
+std::string PersistentCache::PathFor(const std::string& key) const {
+  llvm::MD5 hasher;
+  hasher.update(EntryHeader());
+  hasher.update(key);
+  llvm::MD5::MD5Result digest;
+  hasher.final(digest);
+
+  llvm::SmallString<128> path(directory_);
+  llvm::sys::path::append(path, digest.digest() + kEntryExtension);
+  return std::string(path.str());
+}
+
+std::unique_ptr<llvm::MemoryBuffer> PersistentCache::Get(const std::string& key) {
+  const std::string path = PathFor(key);
+  auto maybe_buffer = llvm::MemoryBuffer::getFile(path);
+  if (!maybe_buffer) {
+    return nullptr;
+  }
+  llvm::StringRef contents = (*maybe_buffer)->getBuffer();
+  const std::string prefix = KeyPrefix(key);
+  if (!contents.startswith(prefix)) {
+    // Written by another version, or a digest collision: drop the stale entry
+    llvm::sys::fs::remove(path);
+    return nullptr;
+  }
+
+  // Refresh the modification time, which orders entries for eviction
+  int fd = -1;
+  if (!llvm::sys::fs::openFileForWrite(path, fd, llvm::sys::fs::CD_OpenExisting,
+                                       llvm::sys::fs::OF_Append)) {
+    llvm::sys::fs::setLastAccessAndModificationTime(fd, std::chrono::system_clock::now());
+    llvm::sys::Process::SafelyCloseFileDescriptor(fd);
+  }
+
+  return llvm::MemoryBuffer::getMemBufferCopy(contents.drop_front(prefix.size()), path);
+}
+
+arrow::Status PersistentCache::Put(const std::string& key, llvm::MemoryBufferRef object) {
+  // Write to a temporary file first so that concurrent readers never see a
+  // partial entry
+  llvm::SmallString<128> model(directory_);
+  llvm::sys::path::append(model, "%%%%%%%%%%%%.tmp");
+  llvm::SmallString<128> temp_path;
+  int fd = -1;
+  if (auto ec = llvm::sys::fs::createUniqueFile(model, fd, temp_path)) {
+    return arrow::Status::IOError("Cannot create file in Gandiva cache directory '",
+                                  directory_, "': ", ec.message());
+  }
+  {
+    llvm::raw_fd_ostream out(fd, /*shouldClose=*/true);
+    out << KeyPrefix(key) << object.getBuffer();
+    out.close();
+    if (out.has_error()) {
+      auto ec = out.error();
+      out.clear_error();
+      llvm::sys::fs::remove(temp_path);
+      return arrow::Status::IOError("Cannot write Gandiva cache entry: ", ec.message());
+    }
+  }
+  if (auto ec = llvm::sys::fs::rename(temp_path, PathFor(key))) {
+    llvm::sys::fs::remove(temp_path);
+    return arrow::Status::IOError("Cannot write Gandiva cache entry: ", ec.message());
+  }
+  return Evict();
+}
+
+arrow::Status PersistentCache::Evict() {
+  struct Entry {
+    std::string path;
+    int64_t size;
+    llvm::sys::TimePoint<> last_used;
+  };
+
+  std::lock_guard<std::mutex> lock(evict_mutex_);
+  std::vector<Entry> entries;
+  int64_t total_size = 0;
+  std::error_code ec;
+  for (llvm::sys::fs::directory_iterator it(directory_, ec), end; it != end && !ec;
+       it.increment(ec)) {
+    if (llvm::sys::path::extension(it->path()) != kEntryExtension) {
+      continue;
+    }
+    // Entries may be removed concurrently by other processes
+    auto status = it->status();
+    if (!status) {
+      continue;
+    }
+    auto size = static_cast<int64_t>(status->getSize());
+    entries.push_back({it->path(), size, status->getLastModificationTime()});
+    total_size += size;
+  }
+  if (ec) {
+    return arrow::Status::IOError("Cannot list Gandiva cache directory '", directory_,
+                                  "': ", ec.message());
+  }
+  if (total_size <= capacity_) {
+    return arrow::Status::OK();
+  }
+
+  std::sort(entries.begin(), entries.end(), [](const Entry& left, const Entry& right) {
+    // Break ties by path, since mtimes may be as coarse as seconds
+    return std::tie(left.last_used, left.path) < std::tie(right.last_used, right.path);
+  });
+  for (const auto& entry : entries) {
+    if (total_size <= capacity_) {
+      break;
+    }
+    llvm::sys::fs::remove(entry.path);
+    total_size -= entry.size;
+  }
+  return arrow::Status::OK();
+}
+
+std::shared_ptr<PersistentCache> GetPersistentCache() {
+  static const std::shared_ptr<PersistentCache> cache =
+      []() -> std::shared_ptr<PersistentCache> {
+    auto maybe_directory = ::arrow::internal::GetEnvVar(kPersistentCacheDirEnvVar);
+    if (!maybe_directory.ok() || maybe_directory->empty()) {
+      return nullptr;
+    }
+    auto maybe_cache = PersistentCache::Make(
+        *std::move(maybe_directory), internal::GetPersistentCacheCapacityFromEnvVar());
+    if (!maybe_cache.ok()) {
+      ARROW_LOG(WARNING) << "Gandiva persistent cache disabled: "
+                         << maybe_cache.status().ToString();
+      return nullptr;
+    }
+    ARROW_LOG(INFO) << "Using gandiva persistent cache in " << (*maybe_cache)->directory()
+                    << " with capacity of " << (*maybe_cache)->capacity() << " bytes";
+    return *std::move(maybe_cache);
+  }();
+  return cache;
+}
+
+}  // namespace gandiva
@@ -0,0 +1,99 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#if defined(_MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable : 4244)
+#  pragma warning(disable : 4141)
+#  pragma warning(disable : 4146)
+#  pragma warning(disable : 4267)
+#  pragma warning(disable : 4624)
+#endif
+
+#include <llvm/Support/MemoryBuffer.h>
+
+#if defined(_MSC_VER)
+#  pragma warning(pop)
+#endif
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+namespace internal {
+// Only called once by GetPersistentCache().
+// Do the actual work of reading the cache capacity from env var.
+GANDIVA_EXPORT
+int64_t GetPersistentCacheCapacityFromEnvVar();
+}  // namespace internal
+
+/// \brief Directory of compiled object code shared between processes.
+///
+/// Each entry is a file named after a digest of its key. The file starts with a
+/// header recording the Arrow and LLVM versions and the target the code was
+/// compiled for, followed by the full key; entries whose header does not match
+/// the running process are treated as misses and removed. When the total size
+/// of the directory grows over the capacity, the least recently used entries
+/// are removed.
+class GANDIVA_EXPORT PersistentCache {
+ public:
+  /// \brief Open (and create if needed) a cache directory
+  ///
+  /// \param[in] directory the directory holding the object files
+  /// \param[in] capacity the maximum total size of the entries, in bytes
+  static arrow::Result<std::shared_ptr<PersistentCache>> Make(std::string directory,
+                                                              int64_t capacity);
+
+  /// \brief Return the object code stored for key, or nullptr
+  std::unique_ptr<llvm::MemoryBuffer> Get(const std::string& key);
+
+  /// \brief Store the object code for key, evicting old entries if needed
+  arrow::Status Put(const std::string& key, llvm::MemoryBufferRef object);
+
+  const std::string& directory() const { return directory_; }
+  int64_t capacity() const { return capacity_; }
+
+ private:
+  PersistentCache(std::string directory, int64_t capacity)
+      : directory_(std::move(directory)), capacity_(capacity) {}
+
+  std::string PathFor(const std::string& key) const;
+  arrow::Status Evict();
+
+  const std::string directory_;
+  const int64_t capacity_;
+  std::mutex evict_mutex_;
+};
+
+/// \brief The process-wide persistent cache
+///
+/// The cache is enabled by setting GANDIVA_PERSISTENT_CACHE_DIR to a directory;
+/// its capacity in bytes can be set with GANDIVA_PERSISTENT_CACHE_SIZE. Returns
+/// nullptr when the cache is disabled or the directory cannot be created.
+GANDIVA_EXPORT
+std::shared_ptr<PersistentCache> GetPersistentCache();
+
+}  // namespace gandiva
@@ -0,0 +1,192 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/persistent_cache.h"
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+#include "gandiva/gandiva_object_cache.h"
+#include "gandiva/tests/test_util.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace gandiva {
+
+using ::arrow::internal::TemporaryDir;
+
+class TestPersistentCache : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(temp_dir_, TemporaryDir::Make("gandiva-persistent-cache-"));
+  }
+
+  std::string directory() { return temp_dir_->path().ToString() + "cache"; }
+
+  std::vector<::arrow::internal::PlatformFilename> ListEntries() {
+    EXPECT_OK_AND_ASSIGN(auto entries, ::arrow::internal::ListDir(
+                                           *temp_dir_->path().Join("cache")));
+    return entries;
+  }
+
+  std::string EntryPath(const ::arrow::internal::PlatformFilename& entry) {
+    EXPECT_OK_AND_ASSIGN(auto directory, temp_dir_->path().Join("cache"));
+    return directory.Join(entry).ToString();
+  }
+
+  // Backdate an entry rather than sleeping between operations, since file
+  // modification times can be as coarse as a few seconds
+  void SetLastUsed(const std::string& path, std::chrono::seconds age) {
+    std::filesystem::last_write_time(
+        path, std::filesystem::file_time_type::clock::now() - age);
+  }
+
+  static std::string ToString(const std::unique_ptr<llvm::MemoryBuffer>& buffer) {
+    return buffer == nullptr ? "<null>" : buffer->getBuffer().str();
+  }
+
+  std::unique_ptr<TemporaryDir> temp_dir_;
+};
+
+TEST_F(TestPersistentCache, TestGetPut) {
+  ASSERT_OK_AND_ASSIGN(auto cache, PersistentCache::Make(directory(), 1 << 20));
+  ASSERT_EQ(cache->Get("first"), nullptr);
+
+  ASSERT_OK(cache->Put("first", llvm::MemoryBufferRef("object one", "one")));
+  ASSERT_OK(cache->Put("second", llvm::MemoryBufferRef("object two", "two")));
+  ASSERT_EQ(ToString(cache->Get("first")), "object one");
+  ASSERT_EQ(ToString(cache->Get("second")), "object two");
+
+  // Entries are visible to other instances using the same directory
+  ASSERT_OK_AND_ASSIGN(auto other, PersistentCache::Make(directory(), 1 << 20));
+  ASSERT_EQ(ToString(other->Get("first")), "object one");
+  ASSERT_EQ(other->Get("third"), nullptr);
+
+  // Overwriting an entry replaces it
+  ASSERT_OK(cache->Put("first", llvm::MemoryBufferRef("object 1", "one")));
+  ASSERT_EQ(ToString(other->Get("first")), "object 1");
+  ASSERT_EQ(ListEntries().size(), 2);
+}
+
+TEST_F(TestPersistentCache, TestInvalidEntry) {
+  ASSERT_OK_AND_ASSIGN(auto cache, PersistentCache::Make(directory(), 1 << 20));
+  ASSERT_OK(cache->Put("key", llvm::MemoryBufferRef("object", "id")));
+  auto entries = ListEntries();
+  ASSERT_EQ(entries.size(), 1);
+
+  // Simulate an entry written by another LLVM version
+  auto path = temp_dir_->path().Join("cache")->Join(entries[0]);
+  ASSERT_OK_AND_ASSIGN(auto fd, ::arrow::internal::FileOpenWritable(path));
+  const std::string contents = "gandiva-object-cache 1\nllvm 0.0.0\nobject";
+  ASSERT_OK(::arrow::internal::FileWrite(
+      fd.fd(), reinterpret_cast<const uint8_t*>(contents.data()), contents.size()));
+  ASSERT_OK(fd.Close());
+
+  ASSERT_EQ(cache->Get("key"), nullptr);
+  ASSERT_EQ(ListEntries().size(), 0);
+}
+
+TEST_F(TestPersistentCache, TestEviction) {
+  const std::string object(1000, 'x');
+  // Room for two entries and their headers
+  ASSERT_OK_AND_ASSIGN(auto cache, PersistentCache::Make(directory(), 2600));
+
+  ASSERT_OK(cache->Put("first", llvm::MemoryBufferRef(object, "1")));
+  auto entries = ListEntries();
+  ASSERT_EQ(entries.size(), 1);
+  const auto first_path = EntryPath(entries[0]);
+  ASSERT_OK(cache->Put("second", llvm::MemoryBufferRef(object, "2")));
+  entries = ListEntries();
+  ASSERT_EQ(entries.size(), 2);
+  auto second_path = EntryPath(entries[0]);
+  if (second_path == first_path) second_path = EntryPath(entries[1]);
+  SetLastUsed(first_path, std::chrono::seconds(300));
+  SetLastUsed(second_path, std::chrono::seconds(200));
+
+  // Using an entry makes it the most recent one
+  ASSERT_NE(cache->Get("first"), nullptr);
+  ASSERT_OK(cache->Put("third", llvm::MemoryBufferRef(object, "3")));
+
+  ASSERT_EQ(ListEntries().size(), 2);
+  ASSERT_NE(cache->Get("first"), nullptr);
+  ASSERT_EQ(cache->Get("second"), nullptr);
+  ASSERT_NE(cache->Get("third"), nullptr);
+}
+
+TEST_F(TestPersistentCache, TestObjectCache) {
+  ASSERT_OK_AND_ASSIGN(auto persistent_cache,
+                       PersistentCache::Make(directory(), 1 << 20));
+  auto field_a = arrow::field("a", arrow::int32());
+  auto schema = arrow::schema({field_a});
+  auto expr = TreeExprBuilder::MakeExpression("negative", {field_a},
+                                              arrow::field("res", arrow::int32()));
+  ExpressionCacheKey key(schema, TestConfiguration(), {expr},
+                         SelectionVector::Mode::MODE_NONE);
+
+  using MemoryCache = Cache<ExpressionCacheKey, std::shared_ptr<llvm::MemoryBuffer>>;
+  auto memory_cache = std::make_shared<MemoryCache>(10);
+  GandivaObjectCache object_cache(memory_cache, key, persistent_cache);
+  ASSERT_FALSE(object_cache.HasObject());
+  object_cache.notifyObjectCompiled(nullptr, llvm::MemoryBufferRef("object", "id"));
+  ASSERT_TRUE(object_cache.HasObject());
+
+  // A new process starts with an empty in-memory cache
+  auto other_memory_cache = std::make_shared<MemoryCache>(10);
+  GandivaObjectCache other_object_cache(other_memory_cache, key, persistent_cache);
+  ASSERT_TRUE(other_object_cache.HasObject());
+  ASSERT_NE(other_memory_cache->GetObjectCode(key), nullptr);
+  ASSERT_EQ(ToString(other_object_cache.getObject(nullptr)), "object");
+
+  // Code built with a custom function registry is not persisted
+  auto custom_configuration =
+      ConfigurationBuilder().build(std::make_shared<FunctionRegistry>());
+  ExpressionCacheKey custom_key(schema, custom_configuration, {expr},
+                                SelectionVector::Mode::MODE_NONE);
+  GandivaObjectCache custom_object_cache(memory_cache, custom_key, persistent_cache);
+  custom_object_cache.notifyObjectCompiled(nullptr,
+                                           llvm::MemoryBufferRef("custom", "id"));
+  ASSERT_EQ(ListEntries().size(), 1);
+}
+
+TEST(TestPersistentCacheCapacity, TestGetCapacityFromEnvVar) {
+  using ::arrow::EnvVarGuard;
+  constexpr auto env_var = "GANDIVA_PERSISTENT_CACHE_SIZE";
+  constexpr int64_t default_capacity = 256LL * 1024 * 1024;
+
+  {
+    EnvVarGuard guard(env_var, "");
+    ASSERT_EQ(internal::GetPersistentCacheCapacityFromEnvVar(), default_capacity);
+  }
+  {
+    EnvVarGuard guard(env_var, "invalid");
+    ASSERT_EQ(internal::GetPersistentCacheCapacityFromEnvVar(), default_capacity);
+  }
+  {
+    EnvVarGuard guard(env_var, "0");
+    ASSERT_EQ(internal::GetPersistentCacheCapacityFromEnvVar(), default_capacity);
+  }
+  {
+    EnvVarGuard guard(env_var, "8589934592");
+    ASSERT_EQ(internal::GetPersistentCacheCapacityFromEnvVar(), 8589934592LL);
+  }
+}
+
+}  // namespace gandiva
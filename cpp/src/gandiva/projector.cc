@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 #include "gandiva/cache.h"
 #include "gandiva/expr_validator.h"
@@ -67,31 +68,26 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
 
   ExpressionCacheKey cache_key(schema, configuration, exprs, selection_vector_mode);
 
-  bool is_cached = false;
-
-  std::shared_ptr<llvm::MemoryBuffer> prev_cached_obj;
-  prev_cached_obj = cache->GetObjectCode(cache_key);
-
-  // Verify if previous projector obj code was cached
-  if (prev_cached_obj != nullptr) {
-    is_cached = true;
-  }
+  // Wait for a concurrent build of the same projector, to reuse its code
+  auto build_lock = cache->LockBuild(cache_key);
 
   GandivaObjectCache obj_cache(cache, cache_key);
 
+  // Verify if previous projector obj code was cached, in this process or on disk
+  bool is_cached = obj_cache.HasObject();
+
   // Build LLVM generator, and generate code for the specified expressions
   ARROW_ASSIGN_OR_RAISE(auto llvm_gen,
                         LLVMGenerator::Make(configuration, is_cached, obj_cache));
 
-  // Run the validation on the expressions.
+  // Run the validation on the expressions, even if the code is cached: the cache
+  // key does not include the schema.
   // Return if any of the expression is invalid since
   // we will not be able to process further.
-  if (!is_cached) {
-    ExprValidator expr_validator(llvm_gen->types(), schema,
-                                 configuration->function_registry());
-    for (auto& expr : exprs) {
-      ARROW_RETURN_NOT_OK(expr_validator.Validate(expr));
-    }
+  ExprValidator expr_validator(llvm_gen->types(), schema,
+                               configuration->function_registry());
+  for (auto& expr : exprs) {
+    ARROW_RETURN_NOT_OK(expr_validator.Validate(expr));
   }
 
   // Set the object cache for LLVM
@@ -114,6 +110,19 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
   return Status::OK();
 }
 
+arrow::Future<std::shared_ptr<Projector>> Projector::MakeAsync(
+    SchemaPtr schema, ExpressionVector exprs, SelectionVector::Mode selection_vector_mode,
+    std::shared_ptr<Configuration> configuration) {
+  return arrow::DeferNotOk(LLVMGenerator::GetCompileThreadPool()->Submit(
+      [schema = std::move(schema), exprs = std::move(exprs), selection_vector_mode,
+       configuration = std::move(configuration)]() -> Result<std::shared_ptr<Projector>> {
+        std::shared_ptr<Projector> projector;
+        ARROW_RETURN_NOT_OK(
+            Make(schema, exprs, selection_vector_mode, configuration, &projector));
+        return projector;
+      }));
+}
+
 Status Projector::Evaluate(const arrow::RecordBatch& batch,
                            const ArrayDataVector& output_data_vecs) const {
   return Evaluate(batch, nullptr, output_data_vecs);
@@ -186,8 +195,7 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
 
 // TODO : handle complex vectors (list/map/..)
 Status Projector::AllocArrayData(const DataTypePtr& type, int64_t num_records,
-                                 arrow::MemoryPool* pool,
-                                 ArrayDataPtr* array_data) const {
+                                 arrow::MemoryPool* pool, ArrayDataPtr* array_data) {
   arrow::Status astatus;
   std::vector<std::shared_ptr<arrow::Buffer>> buffers;
 
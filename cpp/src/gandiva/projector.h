@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 
 #include "gandiva/arrow.h"
 #include "gandiva/configuration.h"
@@ -77,6 +78,21 @@ class GANDIVA_EXPORT Projector {
                      std::shared_ptr<Configuration> configuration,
                      std::shared_ptr<Projector>* projector);
 
+  /// Build a projector asynchronously, on the thread pool dedicated to compilation.
+  ///
+  /// Projectors for different expressions are compiled concurrently. Concurrent
+  /// builds of the same expressions wait for the first one and reuse its code.
+  ///
+  /// \param[in] schema schema for the record batches, and the expressions.
+  /// \param[in] exprs vector of expressions.
+  /// \param[in] selection_vector_mode mode of selection vector
+  /// \param[in] configuration run time configuration.
+  /// \return a future of the projector
+  static arrow::Future<std::shared_ptr<Projector>> MakeAsync(
+      SchemaPtr schema, ExpressionVector exprs,
+      SelectionVector::Mode selection_vector_mode,
+      std::shared_ptr<Configuration> configuration);
+
   /// Evaluate the specified record batch, and return the allocated and populated output
   /// arrays. The output arrays will be allocated from the memory pool 'pool', and added
   /// to the vector 'output'.
@@ -128,9 +144,11 @@ class GANDIVA_EXPORT Projector {
   Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
             const FieldVector& output_fields, std::shared_ptr<Configuration>);
 
+  friend class FilterProjector;
+
   /// Allocate an ArrowData of length 'length'.
-  Status AllocArrayData(const DataTypePtr& type, int64_t num_records,
-                        arrow::MemoryPool* pool, ArrayDataPtr* array_data) const;
+  static Status AllocArrayData(const DataTypePtr& type, int64_t num_records,
+                               arrow::MemoryPool* pool, ArrayDataPtr* array_data);
 
   /// Validate that the ArrayData has sufficient capacity to accommodate 'num_records'.
   Status ValidateArrayDataCapacity(const arrow::ArrayData& array_data,
@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/acero_compiler.h"
+
+#include <gtest/gtest.h>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/expression.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "gandiva/tests/test_util.h"
+
+namespace gandiva {
+
+using arrow::acero::Declaration;
+using arrow::acero::QueryOptions;
+using arrow::compute::call;
+using arrow::compute::field_ref;
+using arrow::compute::literal;
+
+class TestAceroCompiler : public ::testing::Test {
+ public:
+  void SetUp() override {
+    schema_ = arrow::schema({arrow::field("a", arrow::int32()),
+                             arrow::field("b", arrow::int32()),
+                             arrow::field("s", arrow::utf8())});
+    table_ = arrow::TableFromJSON(schema_, {R"([
+      [1, 2, "x"], [3, null, "yy"], [null, 5, "zzz"], [7, 8, null]
+    ])",
+                                            R"([
+      [9, -10, ""], [11, 12, "abc"]
+    ])"});
+  }
+
+  // Run source -> filter -> project with and without the Gandiva backend
+  void AssertSameResults(arrow::compute::Expression filter,
+                         std::vector<arrow::compute::Expression> projections) {
+    Declaration plan = Declaration::Sequence(
+        {{"table_source", arrow::acero::TableSourceNodeOptions(table_, 2)},
+         {"filter", arrow::acero::FilterNodeOptions(filter)},
+         {"project", arrow::acero::ProjectNodeOptions(projections)}});
+
+    QueryOptions options;
+    options.use_threads = false;
+    ASSERT_OK_AND_ASSIGN(auto expected, arrow::acero::DeclarationToTable(plan, options));
+
+    options.expression_compiler = MakeAceroExpressionCompiler(TestConfiguration());
+    ASSERT_OK_AND_ASSIGN(auto actual, arrow::acero::DeclarationToTable(plan, options));
+    arrow::AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+
+ protected:
+  std::shared_ptr<arrow::Schema> schema_;
+  std::shared_ptr<arrow::Table> table_;
+};
+
+TEST_F(TestAceroCompiler, FilterAndProject) {
+  AssertSameResults(
+      and_(greater(call("add", {field_ref("a"), field_ref("b")}), literal(2)),
+           is_valid(field_ref("a"))),
+      {call("multiply", {field_ref("a"), field_ref("b")}),
+       call("add", {field_ref("a"), literal(int64_t(1))}),
+       less(field_ref("b"), literal(5.5)),
+       // Not supported by the backend, evaluated with the compute kernels
+       call("utf8_length", {field_ref("s")}), field_ref("s")});
+}
+
+TEST_F(TestAceroCompiler, EmptyBatches) {
+  AssertSameResults(greater(field_ref("a"), literal(100)),
+                    {call("subtract", {field_ref("a"), field_ref("b")})});
+}
+
+TEST_F(TestAceroCompiler, Unsupported) {
+  AssertSameResults(equal(field_ref("s"), literal("abc")), {field_ref("a")});
+
+  auto compiler = MakeAceroExpressionCompiler(TestConfiguration());
+  ASSERT_OK_AND_ASSIGN(auto filter,
+                       equal(field_ref("s"), literal("abc")).Bind(*schema_));
+  ASSERT_OK_AND_ASSIGN(auto compiled_filter, compiler->CompileFilter(schema_, filter));
+  ASSERT_EQ(compiled_filter, nullptr);
+
+  ASSERT_OK_AND_ASSIGN(auto projection,
+                       call("utf8_length", {field_ref("s")}).Bind(*schema_));
+  ASSERT_OK_AND_ASSIGN(auto compiled_projection,
+                       compiler->CompileProjection(schema_, {projection}));
+  ASSERT_EQ(compiled_projection, nullptr);
+}
+
+}  // namespace gandiva
@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 #include "arrow/memory_pool.h"
 #include "gandiva/filter.h"
+#include "gandiva/filter_projector.h"
 #include "gandiva/projector.h"
 #include "gandiva/selection_vector.h"
 #include "gandiva/tests/test_util.h"
@@ -93,6 +94,71 @@ TEST_F(TestFilterProject, TestSimple16) {
   EXPECT_ARROW_ARRAY_EQUALS(result, outputs.at(0));
 }
 
+TEST_F(TestFilterProject, TestFused) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto field2 = field("f2", int32());
+  auto sum_field = field("sum", int32());
+  auto less_than_field = field("less_than", boolean());
+  auto schema = arrow::schema({field0, field1, field2});
+
+  // Build condition f0 < f1, and project f1 + f2 and f2 < f0
+  auto node_f0 = TreeExprBuilder::MakeField(field0);
+  auto node_f1 = TreeExprBuilder::MakeField(field1);
+  auto less_than_function =
+      TreeExprBuilder::MakeFunction("less_than", {node_f0, node_f1}, arrow::boolean());
+  auto condition = TreeExprBuilder::MakeCondition(less_than_function);
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field1, field2}, sum_field);
+  auto less_than_expr =
+      TreeExprBuilder::MakeExpression("less_than", {field2, field0}, less_than_field);
+
+  std::shared_ptr<FilterProjector> filter_projector;
+  ASSERT_OK(FilterProjector::Make(schema, condition, {sum_expr, less_than_expr},
+                                  SelectionVector::MODE_UINT32, TestConfiguration(),
+                                  &filter_projector));
+  EXPECT_FALSE(filter_projector->GetBuiltFromCache());
+
+  // Create a row-batch with some sample data
+  int num_records = 5;
+  auto array0 = MakeArrowArrayInt32({1, 2, 6, 40, 3}, {true, true, true, true, true});
+  auto array1 = MakeArrowArrayInt32({5, 9, 3, 17, 6}, {true, true, true, true, true});
+  auto array2 = MakeArrowArrayInt32({0, 2, 6, 40, 3}, {true, true, true, true, false});
+  // expected output, for the records 0, 1 and 4
+  auto exp_sum = MakeArrowArrayInt32({5, 11, 0}, {true, true, false});
+  auto exp_less_than = MakeArrowArrayBool({true, false, false}, {true, true, false});
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1, array2});
+
+  arrow::ArrayVector outputs;
+  ASSERT_OK(filter_projector->Evaluate(*in_batch, pool_, &outputs));
+  ASSERT_EQ(outputs.size(), 2);
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_less_than, outputs.at(1));
+
+  // no matching records
+  auto none_batch =
+      arrow::RecordBatch::Make(schema, num_records, {array1, array1, array2});
+  ASSERT_OK(filter_projector->Evaluate(*none_batch, pool_, &outputs));
+  EXPECT_EQ(outputs.at(0)->length(), 0);
+  EXPECT_EQ(outputs.at(1)->length(), 0);
+
+  // the same filter-projector is found in the cache, but not a projector of the
+  // same expressions
+  ASSERT_OK(FilterProjector::Make(schema, condition, {sum_expr, less_than_expr},
+                                  SelectionVector::MODE_UINT32, TestConfiguration(),
+                                  &filter_projector));
+  EXPECT_TRUE(filter_projector->GetBuiltFromCache());
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {condition, sum_expr, less_than_expr},
+                            SelectionVector::MODE_UINT32, TestConfiguration(),
+                            &projector));
+  EXPECT_FALSE(projector->GetBuiltFromCache());
+
+  ASSERT_RAISES(Invalid, FilterProjector::Make(schema, condition, {sum_expr},
+                                               SelectionVector::MODE_NONE,
+                                               TestConfiguration(), &filter_projector));
+}
+
 TEST_F(TestFilterProject, TestSimple32) {
   // schema for input fields
   auto field0 = field("f0", int32());
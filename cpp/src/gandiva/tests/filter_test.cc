@@ -68,15 +68,36 @@ TEST_F(TestFilter, TestFilterCache) {
   EXPECT_TRUE(status.ok());
   EXPECT_TRUE(cached_filter->GetBuiltFromCache());
 
-  // schema is different should return a new filter.
+  // schema only differs in an unused field, should reuse the code.
   auto field2 = field("f2_filter_cache", int32());
   auto different_schema = arrow::schema({field0, field1, field2});
+  std::shared_ptr<Filter> filter_unused_field;
+  status = Filter::Make(different_schema, condition, configuration, &filter_unused_field);
+  EXPECT_TRUE(status.ok());
+  EXPECT_TRUE(filter_unused_field->GetBuiltFromCache());
+
+  // field types are different, should return a new filter.
+  auto field0_int64 = field("f0_filter_cache", int64());
+  auto field1_int64 = field("f1_filter_cache", int64());
+  auto int64_schema = arrow::schema({field0_int64, field1_int64});
+  auto node_f0_int64 = TreeExprBuilder::MakeField(field0_int64);
+  auto node_f1_int64 = TreeExprBuilder::MakeField(field1_int64);
+  auto sum_int64 = TreeExprBuilder::MakeFunction("add", {node_f0_int64, node_f1_int64},
+                                                 arrow::int64());
+  auto int64_condition = TreeExprBuilder::MakeCondition(TreeExprBuilder::MakeFunction(
+      "less_than", {sum_int64, TreeExprBuilder::MakeLiteral((int64_t)10)},
+      arrow::boolean()));
   std::shared_ptr<Filter> should_be_new_filter;
-  status =
-      Filter::Make(different_schema, condition, configuration, &should_be_new_filter);
+  status = Filter::Make(int64_schema, int64_condition, configuration,
+                        &should_be_new_filter);
   EXPECT_TRUE(status.ok());
   EXPECT_FALSE(should_be_new_filter->GetBuiltFromCache());
 
+  // a cached condition is still validated against the schema
+  std::shared_ptr<Filter> invalid_filter;
+  status = Filter::Make(int64_schema, condition, configuration, &invalid_filter);
+  EXPECT_FALSE(status.ok());
+
   // condition is different, should return a new filter.
   auto greater_than_10 = TreeExprBuilder::MakeFunction(
       "greater_than", {sum_func, literal_10}, arrow::boolean());
@@ -121,6 +142,42 @@ TEST_F(TestFilter, TestFilterCacheNullTreatment) {
   EXPECT_TRUE(filter.get() != should_be_new_filter.get());
 }
 
+TEST_F(TestFilter, TestFilterCacheParameterizedLiterals) {
+  auto field0 = field("f0_param", int32());
+  auto schema = arrow::schema({field0});
+  auto configuration = std::make_shared<Configuration>(*TestConfiguration());
+  configuration->set_parameterize_literals(true);
+
+  auto MakeLessThan = [&](int32_t value) {
+    return TreeExprBuilder::MakeCondition(TreeExprBuilder::MakeFunction(
+        "less_than",
+        {TreeExprBuilder::MakeField(field0), TreeExprBuilder::MakeLiteral(value)},
+        arrow::boolean()));
+  };
+
+  std::shared_ptr<Filter> filter5;
+  ASSERT_OK(Filter::Make(schema, MakeLessThan(5), configuration, &filter5));
+  EXPECT_FALSE(filter5->GetBuiltFromCache());
+
+  // f0 < 7 shares the code of f0 < 5
+  std::shared_ptr<Filter> filter7;
+  ASSERT_OK(Filter::Make(schema, MakeLessThan(7), configuration, &filter7));
+  EXPECT_TRUE(filter7->GetBuiltFromCache());
+
+  int num_records = 5;
+  auto array0 = MakeArrowArrayInt32({4, 5, 6, 7, 8}, {true, true, true, true, true});
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0});
+
+  std::shared_ptr<SelectionVector> selection_vector;
+  ASSERT_OK(SelectionVector::MakeInt16(num_records, pool_, &selection_vector));
+  ASSERT_OK(filter5->Evaluate(*in_batch, selection_vector));
+  EXPECT_ARROW_ARRAY_EQUALS(MakeArrowArrayUint16({0}), selection_vector->ToArray());
+
+  ASSERT_OK(SelectionVector::MakeInt16(num_records, pool_, &selection_vector));
+  ASSERT_OK(filter7->Evaluate(*in_batch, selection_vector));
+  EXPECT_ARROW_ARRAY_EQUALS(MakeArrowArrayUint16({0, 1, 2}), selection_vector->ToArray());
+}
+
 TEST_F(TestFilter, TestSimple) {
   // schema for input fields
   auto field0 = field("f0", int32());
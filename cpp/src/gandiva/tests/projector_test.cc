@@ -26,6 +26,7 @@
 #include <cmath>
 
 #include "arrow/memory_pool.h"
+#include "arrow/util/key_value_metadata.h"
 #include "gandiva/function_registry.h"
 #include "gandiva/literal_holder.h"
 #include "gandiva/node.h"
@@ -81,14 +82,14 @@ TEST_F(TestProjector, TestProjectCache) {
   ASSERT_OK(status);
   EXPECT_TRUE(cached_projector->GetBuiltFromCache());
 
-  // schema is different should return a new projector.
+  // schema only differs in an unused field, should reuse the code.
   auto field2 = field("f2", int32());
   auto different_schema = arrow::schema({field0, field1, field2});
-  std::shared_ptr<Projector> should_be_new_projector;
+  std::shared_ptr<Projector> projector_unused_field;
   status = Projector::Make(different_schema, {sum_expr, sub_expr}, configuration,
-                           &should_be_new_projector);
+                           &projector_unused_field);
   ASSERT_OK(status);
-  EXPECT_FALSE(should_be_new_projector->GetBuiltFromCache());
+  EXPECT_TRUE(projector_unused_field->GetBuiltFromCache());
 
   // expression list is different should return a new projector.
   std::shared_ptr<Projector> should_be_new_projector1;
@@ -129,6 +130,52 @@ TEST_F(TestProjector, TestProjectCacheFieldNames) {
   EXPECT_TRUE(projector_01.get() != projector_12.get());
 }
 
+TEST_F(TestProjector, TestProjectCacheParameterizedLiterals) {
+  auto configuration = std::make_shared<Configuration>(*TestConfiguration());
+  configuration->set_parameterize_literals(true);
+  auto res = field("res", int64());
+
+  auto MakeAddLiteral = [&](const std::string& field_name, int64_t value) {
+    auto field0 = field(field_name, int64());
+    auto add = TreeExprBuilder::MakeFunction(
+        "add",
+        {TreeExprBuilder::MakeField(field0), TreeExprBuilder::MakeLiteral(value)},
+        int64());
+    return std::make_pair(arrow::schema({field0}),
+                          TreeExprBuilder::MakeExpression(add, res));
+  };
+
+  auto [schema5, add5] = MakeAddLiteral("f0_param", 5);
+  std::shared_ptr<Projector> projector5;
+  ASSERT_OK(Projector::Make(schema5, {add5}, configuration, &projector5));
+  EXPECT_FALSE(projector5->GetBuiltFromCache());
+
+  // Another constant, field name and schema metadata share the code
+  auto [schema7, add7] = MakeAddLiteral("f1_param", 7);
+  schema7 = schema7->WithMetadata(arrow::key_value_metadata({"k"}, {"v"}));
+  std::shared_ptr<Projector> projector7;
+  ASSERT_OK(Projector::Make(schema7, {add7}, configuration, &projector7));
+  EXPECT_TRUE(projector7->GetBuiltFromCache());
+
+  auto array = MakeArrowArrayInt64({1, 2, 3}, {true, true, false});
+  arrow::ArrayVector outputs;
+  ASSERT_OK(projector5->Evaluate(*arrow::RecordBatch::Make(schema5, 3, {array}), pool_,
+                                 &outputs));
+  EXPECT_ARROW_ARRAY_EQUALS(MakeArrowArrayInt64({6, 7, 0}, {true, true, false}),
+                            outputs.at(0));
+  outputs.clear();
+  ASSERT_OK(projector7->Evaluate(*arrow::RecordBatch::Make(schema7, 3, {array}), pool_,
+                                 &outputs));
+  EXPECT_ARROW_ARRAY_EQUALS(MakeArrowArrayInt64({8, 9, 0}, {true, true, false}),
+                            outputs.at(0));
+
+  // The constants are part of the code without parameterization
+  std::shared_ptr<Projector> projector_constant;
+  ASSERT_OK(Projector::Make(schema5, {add5}, TestConfiguration(), &projector_constant));
+  ASSERT_OK(Projector::Make(schema7, {add7}, TestConfiguration(), &projector_constant));
+  EXPECT_FALSE(projector_constant->GetBuiltFromCache());
+}
+
 TEST_F(TestProjector, TestProjectCacheDouble) {
   auto schema = arrow::schema({});
   auto res = field("result", arrow::float64());
@@ -295,6 +342,61 @@ TEST_F(TestProjector, TestIntSumSub) {
   EXPECT_ARROW_ARRAY_EQUALS(exp_sub, outputs.at(1));
 }
 
+TEST_F(TestProjector, TestMakeAsync) {
+  auto field0 = field("f0_async", int32());
+  auto field1 = field("f1_async", int32());
+  auto schema = arrow::schema({field0, field1});
+  auto field_mul = field("multiply", int32());
+  auto mul_expr =
+      TreeExprBuilder::MakeExpression("multiply", {field0, field1}, field_mul);
+
+  // concurrent builds of the same projector compile it only once
+  auto first = Projector::MakeAsync(schema, {mul_expr}, SelectionVector::MODE_NONE,
+                                    TestConfiguration());
+  auto second = Projector::MakeAsync(schema, {mul_expr}, SelectionVector::MODE_NONE,
+                                     TestConfiguration());
+  ASSERT_OK_AND_ASSIGN(auto first_projector, first.result());
+  ASSERT_OK_AND_ASSIGN(auto second_projector, second.result());
+  EXPECT_NE(first_projector->GetBuiltFromCache(),
+            second_projector->GetBuiltFromCache());
+
+  auto array0 = MakeArrowArrayInt32({1, 2, 3}, {true, true, false});
+  auto array1 = MakeArrowArrayInt32({4, 5, 6}, {true, true, true});
+  auto exp_mul = MakeArrowArrayInt32({4, 10, 0}, {true, true, false});
+  auto in_batch = arrow::RecordBatch::Make(schema, 3, {array0, array1});
+  arrow::ArrayVector outputs;
+  ASSERT_OK(second_projector->Evaluate(*in_batch, pool_, &outputs));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_mul, outputs.at(0));
+
+  // invalid expressions fail the future
+  auto bad_expr = TreeExprBuilder::MakeExpression("multiply", {field0, field1},
+                                                  field("multiply", arrow::utf8()));
+  ASSERT_RAISES(Invalid, Projector::MakeAsync(schema, {bad_expr},
+                                              SelectionVector::MODE_NONE,
+                                              TestConfiguration())
+                             .result());
+}
+
+TEST_F(TestProjector, TestLazyCompilation) {
+  auto field0 = field("f0_lazy", int64());
+  auto schema = arrow::schema({field0});
+  auto field_fac = field("fact", int64());
+  auto fac_expr = TreeExprBuilder::MakeExpression("factorial", {field0}, field_fac);
+
+  auto configuration = std::make_shared<Configuration>(*TestConfiguration());
+  configuration->set_lazy_compilation(true);
+
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {fac_expr}, configuration, &projector));
+
+  auto array0 = MakeArrowArrayInt64({1, 2, 3, 4}, {true, true, true, true});
+  auto exp_fac = MakeArrowArrayInt64({1, 2, 6, 24}, {true, true, true, true});
+  auto in_batch = arrow::RecordBatch::Make(schema, 4, {array0});
+  arrow::ArrayVector outputs;
+  ASSERT_OK(projector->Evaluate(*in_batch, pool_, &outputs));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_fac, outputs.at(0));
+}
+
 template <typename TYPE, typename C_TYPE>
 static void TestArithmeticOpsForType(arrow::MemoryPool* pool) {
   auto atype = arrow::TypeTraits<TYPE>::type_singleton();
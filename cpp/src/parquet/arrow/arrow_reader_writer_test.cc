@@ -57,6 +57,7 @@
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/range.h"
+#include "arrow/util/thread_pool.h"
 
 #ifdef ARROW_CSV
 #  include "arrow/csv/api.h"
@@ -1538,6 +1539,59 @@ TEST_F(TestBinaryLikeParquetIO, StringView) {
                  ::arrow::utf8_view(), ::arrow::utf8());
 }
 
+TEST_F(TestBinaryLikeParquetIO, StringViewReferencesPageData) {
+#ifdef ARROW_WITH_SNAPPY
+  const auto codec = Compression::SNAPPY;
+#else
+  const auto codec = Compression::UNCOMPRESSED;
+#endif
+  // Values long enough not to be inlined in the views
+  ::arrow::StringBuilder builder;
+  ::arrow::StringViewBuilder expected_builder;
+  for (int i = 0; i < 2000; ++i) {
+    const std::string value = "a value that is not inlined #" + std::to_string(i % 100);
+    ASSERT_OK(builder.Append(value));
+    ASSERT_OK(expected_builder.Append(value));
+  }
+  ASSERT_OK_AND_ASSIGN(auto values, builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto expected, expected_builder.Finish());
+  auto table = Table::Make(::arrow::schema({::arrow::field("s", ::arrow::utf8())}),
+                           {values});
+
+  ArrowReaderProperties reader_properties;
+  reader_properties.set_binary_type(::arrow::Type::STRING_VIEW);
+  for (bool use_dictionary : {false, true}) {
+    ARROW_SCOPED_TRACE("use_dictionary = ", use_dictionary);
+    // Small compressed pages: reading them reuses the decompression buffer unless
+    // the views reference it
+    WriterProperties::Builder writer_builder;
+    writer_builder.data_pagesize(1024)->compression(codec);
+    if (use_dictionary) {
+      writer_builder.enable_dictionary();
+    } else {
+      writer_builder.disable_dictionary();
+    }
+    std::shared_ptr<Table> result;
+    ASSERT_NO_FATAL_FAILURE(DoRoundtrip(table, table->num_rows(), &result,
+                                        writer_builder.build(),
+                                        default_arrow_writer_properties(),
+                                        reader_properties));
+    ASSERT_OK(result->ValidateFull());
+    ASSERT_EQ(1, result->column(0)->num_chunks());
+    const auto& chunk = result->column(0)->chunk(0);
+    AssertArraysEqual(*expected, *chunk);
+
+    const size_t num_buffers = chunk->data()->buffers.size();
+    if (use_dictionary) {
+      // All the views reference the dictionary
+      ASSERT_EQ(3, num_buffers);
+    } else {
+      // The views reference the data pages
+      ASSERT_GT(num_buffers, 3);
+    }
+  }
+}
+
 using TestJsonParquetIO = TestParquetIO<::arrow::extension::JsonExtensionType>;
 
 TEST_F(TestJsonParquetIO, JsonExtension) {
@@ -2517,6 +2571,85 @@ TEST(TestArrowReadWrite, ReadTableManually) {
   AssertTablesEqual(*actual, *expected, /*same_chunk_layout=*/false);
 }
 
+TEST(TestArrowReadWrite, ReadColumnChunkInto) {
+  auto schema = ::arrow::schema({
+      ::arrow::field("int64", ::arrow::int64()),
+      ::arrow::field("double", ::arrow::float64(), /*nullable=*/false),
+      ::arrow::field("fsb", ::arrow::fixed_size_binary(3)),
+      ::arrow::field("str", ::arrow::utf8()),
+      ::arrow::field("large_str", ::arrow::large_utf8(), /*nullable=*/false),
+      ::arrow::field("int8", ::arrow::int8()),
+      ::arrow::field("list", ::arrow::list(::arrow::int32())),
+  });
+  auto table = ::arrow::TableFromJSON(schema, {R"([
+      [1, 1.5, "abc", "a", "", 1, [1]],
+      [null, 2.5, null, null, "bc", 2, null],
+      [3, 3.5, "def", "", "def", null, []],
+      [null, 4.5, null, "ghij", "g", 4, [4, 5]],
+      [5, 5.5, "klm", "kl", "", 5, [6]]
+    ])"});
+  ASSERT_OK_AND_ASSIGN(auto buffer, WriteTableToBuffer(table, /*row_group_size=*/3));
+  ASSERT_OK_AND_ASSIGN(auto reader, OpenFile(std::make_shared<BufferReader>(buffer),
+                                             ::arrow::default_memory_pool()));
+  reader->set_batch_size(2);
+  ASSERT_EQ(2, reader->num_row_groups());
+
+  for (int row_group = 0; row_group < reader->num_row_groups(); ++row_group) {
+    const int64_t offset = row_group * 3;
+    const int64_t num_rows = std::min<int64_t>(3, table->num_rows() - offset);
+    for (int column = 0; column < 5; ++column) {
+      ARROW_SCOPED_TRACE("row group = ", row_group, ", column = ", column);
+      auto chunk_reader = reader->RowGroup(row_group)->Column(column);
+      ASSERT_OK_AND_ASSIGN(auto sizes, chunk_reader->GetBufferSizes());
+      const auto& type = schema->field(column)->type();
+      ASSERT_EQ(sizes[0], schema->field(column)->nullable() ? 1 : 0);
+      if (type->id() == ::arrow::Type::INT64 || type->id() == ::arrow::Type::DOUBLE) {
+        ASSERT_EQ(sizes, std::vector<int64_t>({sizes[0], num_rows * 8}));
+      }
+
+      // Caller-provided buffers, the data buffer of binary columns being sized from
+      // the size statistics
+      std::vector<std::shared_ptr<Buffer>> buffers;
+      for (int64_t size : sizes) {
+        if (size == 0 && buffers.empty()) {
+          buffers.push_back(nullptr);
+        } else {
+          ASSERT_GE(size, 0);
+          ASSERT_OK_AND_ASSIGN(auto buffer, ::arrow::AllocateBuffer(size));
+          buffers.push_back(std::move(buffer));
+        }
+      }
+      auto out = ArrayData::Make(type, 0, std::move(buffers));
+      ASSERT_OK(chunk_reader->ReadInto(out));
+      auto actual = ::arrow::MakeArray(out);
+      ASSERT_OK(actual->ValidateFull());
+      AssertArraysEqual(*table->column(column)->Slice(offset, num_rows)->chunk(0),
+                        *actual, /*verbose=*/true);
+    }
+
+    // Binary data larger than the buffer
+    auto chunk_reader = reader->RowGroup(row_group)->Column(3);
+    ASSERT_OK_AND_ASSIGN(auto sizes, chunk_reader->GetBufferSizes());
+    ASSERT_OK_AND_ASSIGN(auto validity, ::arrow::AllocateBuffer(sizes[0]));
+    ASSERT_OK_AND_ASSIGN(auto offsets, ::arrow::AllocateBuffer(sizes[1]));
+    ASSERT_OK_AND_ASSIGN(auto data, ::arrow::AllocateBuffer(sizes[2] - 1));
+    ASSERT_RAISES(CapacityError,
+                  chunk_reader->ReadInto(ArrayData::Make(
+                      ::arrow::utf8(), 0,
+                      {std::move(validity), std::move(offsets), std::move(data)})));
+
+    // Wrong type, too small buffers, unsupported types
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Buffer> values, ::arrow::AllocateBuffer(8));
+    auto row_group_reader = reader->RowGroup(row_group);
+    ASSERT_RAISES(TypeError, row_group_reader->Column(0)->ReadInto(ArrayData::Make(
+                                 ::arrow::int32(), 0, {nullptr, values})));
+    ASSERT_RAISES(Invalid, row_group_reader->Column(1)->ReadInto(ArrayData::Make(
+                               ::arrow::float64(), 0, {nullptr, values})));
+    ASSERT_RAISES(NotImplemented, row_group_reader->Column(5)->GetBufferSizes());
+    ASSERT_RAISES(NotImplemented, row_group_reader->Column(6)->GetBufferSizes());
+  }
+}
+
 void TestGetRecordBatchReader(
     ArrowReaderProperties properties = default_arrow_reader_properties()) {
   const int num_columns = 20;
@@ -2730,6 +2863,117 @@ TEST(TestArrowReadWrite, GetRecordBatchGenerator) {
   }
 }
 
+TEST(TestArrowReadWrite, ReadRowGroupsAsync) {
+  const int num_rows = 2048;
+  const int row_group_size = 512;
+  const int num_columns = 4;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, row_group_size,
+                                             default_arrow_writer_properties(), &buffer));
+
+  for (auto [row_group_readahead, column_readahead] :
+       std::vector<std::pair<int, int>>{{0, 1}, {1, 0}, {3, 2}, {8, 8}}) {
+    ARROW_SCOPED_TRACE("row_group_readahead = ", row_group_readahead,
+                       ", column_readahead = ", column_readahead);
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    properties.set_row_group_readahead(row_group_readahead);
+    properties.set_column_readahead(column_readahead);
+    std::shared_ptr<FileReader> reader;
+    {
+      std::unique_ptr<FileReader> unique_reader;
+      FileReaderBuilder builder;
+      ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+      ASSERT_OK(builder.properties(properties)->Build(&unique_reader));
+      reader = std::move(unique_reader);
+    }
+
+    ASSERT_OK_AND_ASSIGN(
+        auto actual, reader->ReadRowGroupsAsync(reader, {0, 1, 2, 3}, {0, 1, 2, 3})
+                         .result());
+    AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+    ASSERT_EQ(actual->column(0)->num_chunks(), 4);
+
+    ASSERT_OK_AND_ASSIGN(actual,
+                         reader->ReadRowGroupsAsync(reader, {2, 0}, {3, 1}).result());
+    ASSERT_OK_AND_ASSIGN(auto expected, table->SelectColumns({3, 1}));
+    ASSERT_OK_AND_ASSIGN(
+        expected, ::arrow::ConcatenateTables(
+                      {expected->Slice(2 * row_group_size, row_group_size),
+                       expected->Slice(0, row_group_size)}));
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+
+    // No columns
+    ASSERT_OK_AND_ASSIGN(actual, reader->ReadRowGroupsAsync(reader, {0, 1}, {}).result());
+    ASSERT_EQ(actual->num_columns(), 0);
+    ASSERT_EQ(actual->num_rows(), 2 * row_group_size);
+
+    // No row groups
+    ASSERT_OK_AND_ASSIGN(actual, reader->ReadRowGroupsAsync(reader, {}, {0}).result());
+    ASSERT_EQ(actual->num_columns(), 1);
+    ASSERT_EQ(actual->num_rows(), 0);
+
+    ASSERT_OK_AND_ASSIGN(auto column,
+                         reader->ReadColumnAsync(reader, 2, {1, 2, 3}).result());
+    ASSERT_EQ(column->num_chunks(), 3);
+    ::arrow::AssertChunkedEquivalent(*table->column(2)->Slice(row_group_size), *column);
+
+    // The decoding can run on a given executor
+    ASSERT_OK_AND_ASSIGN(auto cpu_executor, ::arrow::internal::ThreadPool::Make(2));
+    ASSERT_OK_AND_ASSIGN(
+        actual,
+        reader->ReadRowGroupsAsync(reader, {0, 1, 2, 3}, {0, 1, 2, 3}, cpu_executor.get())
+            .result());
+    AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+
+    ASSERT_RAISES(Invalid, reader->ReadRowGroupsAsync(reader, {4}, {0}).result());
+    ASSERT_RAISES(Invalid, reader->ReadRowGroupsAsync(reader, {0}, {4}).result());
+    ASSERT_RAISES(Invalid, reader->ReadColumnAsync(reader, 4, {0}).result());
+    ASSERT_RAISES(Invalid, reader->ReadColumnAsync(reader, 0, {-1}).result());
+  }
+}
+
+TEST(TestArrowReadWrite, ReadRowGroupsAsyncNested) {
+  auto type = ::arrow::struct_({::arrow::field("a", ::arrow::int32()),
+                                ::arrow::field("b", ::arrow::utf8())});
+  auto schema = ::arrow::schema(
+      {::arrow::field("s", type), ::arrow::field("c", ::arrow::int64())});
+  auto table = Table::Make(
+      schema, {ArrayFromJSON(type, R"([{"a": 1, "b": "x"}, null, {"a": null, "b": "z"},
+                                       {"a": 4, "b": null}])"),
+               ArrayFromJSON(::arrow::int64(), "[1, 2, 3, null]")});
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, /*row_group_size=*/2,
+                                             default_arrow_writer_properties(), &buffer));
+  std::shared_ptr<FileReader> reader;
+  {
+    std::unique_ptr<FileReader> unique_reader;
+    FileReaderBuilder builder;
+    ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+    ASSERT_OK(builder.Build(&unique_reader));
+    reader = std::move(unique_reader);
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto actual,
+                       reader->ReadRowGroupsAsync(reader, {0, 1}, {0, 1, 2}).result());
+  AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+
+  // Only some leaves of the struct
+  ASSERT_OK_AND_ASSIGN(actual, reader->ReadRowGroupsAsync(reader, {0, 1}, {1}).result());
+  ASSERT_OK_AND_ASSIGN(auto expected, reader->ReadRowGroups({0, 1}, {1}));
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+
+  ASSERT_OK_AND_ASSIGN(auto column, reader->ReadColumnAsync(reader, 0, {1, 0}).result());
+  ::arrow::AssertChunkedEquivalent(
+      ChunkedArray({table->column(0)->Slice(2)->chunk(0),
+                    table->column(0)->Slice(0, 2)->chunk(0)}),
+      *column);
+}
+
 TEST(TestArrowReadWrite, ScanContents) {
   const int num_columns = 20;
   const int num_rows = 1000;
@@ -5782,6 +6026,49 @@ TEST(TestArrowReadWrite, WriteRecordBatchNotProduceEmptyRowGroup) {
   }
 }
 
+TEST(TestArrowReadWrite, WriteRecordBatchMaxBufferedRowGroupBytes) {
+  auto pool = ::arrow::default_memory_pool();
+  auto sink = CreateOutputStream();
+  // 2500 PLAIN-encoded int64 values fit in a row group
+  constexpr int64_t max_buffered_bytes = 20000;
+  auto writer_properties = WriterProperties::Builder()
+                               .disable_dictionary()
+                               ->max_buffered_row_group_bytes(max_buffered_bytes)
+                               ->build();
+  auto arrow_writer_properties = default_arrow_writer_properties();
+
+  auto schema = ::arrow::schema({::arrow::field("a", ::arrow::int64())});
+  std::shared_ptr<SchemaDescriptor> parquet_schema;
+  ASSERT_OK_NO_THROW(ToParquetSchema(schema.get(), *writer_properties,
+                                     *arrow_writer_properties, &parquet_schema));
+  auto schema_node = std::static_pointer_cast<GroupNode>(parquet_schema->schema_root());
+
+  auto writer = ParquetFileWriter::Open(sink, schema_node, writer_properties);
+  std::unique_ptr<FileWriter> arrow_writer;
+  ASSERT_OK(FileWriter::Make(pool, std::move(writer), schema, arrow_writer_properties,
+                             &arrow_writer));
+  auto gen = ::arrow::random::RandomArrayGenerator(/*seed=*/42);
+  constexpr int64_t num_batches = 10;
+  constexpr int64_t batch_length = 1000;
+  for (int i = 0; i < num_batches; ++i) {
+    auto values = gen.Int64(batch_length, 0, 1000, /*null_probability=*/0);
+    auto record_batch = ::arrow::RecordBatch::Make(schema, batch_length, {values});
+    ASSERT_OK_NO_THROW(arrow_writer->WriteRecordBatch(*record_batch));
+  }
+  ASSERT_OK_NO_THROW(arrow_writer->Close());
+
+  // Row groups are closed early, without exceeding the limit
+  auto file_metadata = arrow_writer->metadata();
+  ASSERT_GE(file_metadata->num_row_groups(), 4);
+  int64_t num_rows = 0;
+  for (int i = 0; i < file_metadata->num_row_groups(); ++i) {
+    EXPECT_LE(file_metadata->RowGroup(i)->num_rows(),
+              max_buffered_bytes / static_cast<int64_t>(sizeof(int64_t)));
+    num_rows += file_metadata->RowGroup(i)->num_rows();
+  }
+  ASSERT_EQ(num_batches * batch_length, num_rows);
+}
+
 TEST(TestArrowReadWrite, MultithreadedWrite) {
   const int num_columns = 20;
   const int num_rows = 1000;
@@ -5812,6 +6099,41 @@ TEST(TestArrowReadWrite, MultithreadedWrite) {
   ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result));
 }
 
+TEST(TestArrowReadWrite, MultithreadedWriteTable) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  auto sink = CreateOutputStream();
+  auto write_props = WriterProperties::Builder().write_batch_size(100)->build();
+  auto pool = ::arrow::default_memory_pool();
+  auto arrow_properties = ArrowWriterProperties::Builder().set_use_threads(true)->build();
+  PARQUET_ASSIGN_OR_THROW(
+      auto writer, FileWriter::Open(*table->schema(), pool, sink, std::move(write_props),
+                                    std::move(arrow_properties)));
+  ASSERT_OK_NO_THROW(writer->WriteTable(*table, /*chunk_size=*/300));
+  // A following record batch goes to a new row group
+  PARQUET_ASSIGN_OR_THROW(auto batch, table->Slice(0, 10)->CombineChunksToBatch(pool));
+  ASSERT_OK_NO_THROW(writer->WriteRecordBatch(*batch));
+  ASSERT_OK_NO_THROW(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  auto file_metadata = writer->metadata();
+  ASSERT_EQ(5, file_metadata->num_row_groups());
+  std::vector<int64_t> expected_num_rows = {300, 300, 300, 100, 10};
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(expected_num_rows[i], file_metadata->RowGroup(i)->num_rows());
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       OpenFile(std::make_shared<BufferReader>(buffer), pool));
+  ASSERT_OK_AND_ASSIGN(auto result, reader->ReadTable());
+  ASSERT_OK_AND_ASSIGN(auto expected,
+                       ::arrow::ConcatenateTables({table, table->Slice(0, 10)}));
+  ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*expected, *result, false));
+}
+
 TEST(TestArrowReadWrite, FuzzReader) {
   using ::parquet::fuzzing::internal::FuzzReader;
 
@@ -35,6 +35,7 @@
 #include "arrow/testing/builder.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 
 #include "parquet/arrow/reader.h"
@@ -453,6 +454,128 @@ TEST_F(ParquetPageIndexRoundTripTest, EnablePerColumn) {
                             /*null_counts=*/{0}}));
 }
 
+class ParquetRowSelectionTest : public ::testing::Test, public TestingWithPageIndex {
+ public:
+  void SetUp() override {
+    auto writer_properties = WriterProperties::Builder()
+                                 .enable_write_page_index()
+                                 ->max_row_group_length(100)
+                                 ->write_batch_size(10)
+                                 ->data_pagesize(1) /* about 10 rows per page */
+                                 ->build();
+    auto schema =
+        ::arrow::schema({::arrow::field("c0", ::arrow::int64()),
+                         ::arrow::field("c1", ::arrow::utf8()),
+                         ::arrow::field("c2", ::arrow::list(::arrow::int64()))});
+    ::arrow::random::RandomArrayGenerator rag(/*seed=*/42);
+    table_ = Table::Make(schema, {rag.ArrayOf(::arrow::int64(), kNumRows, 0.1),
+                                  rag.ArrayOf(::arrow::utf8(), kNumRows, 0.1),
+                                  rag.ArrayOf(schema->field(2)->type(), kNumRows, 0.1)});
+    WriteFile(writer_properties, table_);
+  }
+
+  std::unique_ptr<FileReader> OpenReader(bool pre_buffer) {
+    auto arrow_properties = default_arrow_reader_properties();
+    arrow_properties.set_pre_buffer(pre_buffer);
+    arrow_properties.set_batch_size(7);
+    EXPECT_OK_AND_ASSIGN(
+        auto reader,
+        FileReader::Make(default_memory_pool(),
+                         ParquetFileReader::Open(std::make_shared<BufferReader>(buffer_)),
+                         arrow_properties));
+    return reader;
+  }
+
+  std::shared_ptr<Table> ExpectedRows(const std::vector<int>& row_groups,
+                                      const std::vector<RowRanges>& row_ranges) {
+    std::vector<std::shared_ptr<Table>> slices;
+    for (size_t i = 0; i < row_groups.size(); ++i) {
+      for (const auto& range : row_ranges[i].ranges()) {
+        slices.push_back(
+            table_->Slice(row_groups[i] * kRowGroupLength + range.start, range.length()));
+      }
+    }
+    if (slices.empty()) {
+      slices.push_back(table_->Slice(0, 0));
+    }
+    EXPECT_OK_AND_ASSIGN(auto expected, ::arrow::ConcatenateTables(slices));
+    return expected;
+  }
+
+ protected:
+  static constexpr int64_t kNumRows = 250;
+  static constexpr int64_t kRowGroupLength = 100;
+
+  std::shared_ptr<Table> table_;
+};
+
+TEST_F(ParquetRowSelectionTest, ReadRowRanges) {
+  std::vector<uint8_t> bitmap(::arrow::bit_util::BytesForBits(50), 0);
+  for (int64_t i : {0, 1, 2, 23, 24, 49}) {
+    ::arrow::bit_util::SetBit(bitmap.data(), i);
+  }
+  const std::vector<int> row_groups = {0, 1, 2};
+  const std::vector<RowRanges> row_ranges = {
+      RowRanges({{5, 17}, {40, 41}, {99, 100}}), RowRanges(),
+      RowRanges::FromBitmap(bitmap.data(), 0, 50)};
+
+  for (bool pre_buffer : {false, true}) {
+    ARROW_SCOPED_TRACE("pre_buffer = ", pre_buffer);
+    auto reader = OpenReader(pre_buffer);
+    ASSERT_OK_AND_ASSIGN(auto batch_reader,
+                         reader->GetRecordBatchReader(row_groups, {0, 1, 2}, row_ranges));
+    ASSERT_OK_AND_ASSIGN(auto actual, batch_reader->ToTable());
+    ::arrow::AssertTablesEqual(*ExpectedRows(row_groups, row_ranges), *actual,
+                               /*same_chunk_layout=*/false);
+  }
+
+  // Projected columns and row groups in another order
+  auto reader = OpenReader(/*pre_buffer=*/true);
+  ASSERT_OK_AND_ASSIGN(
+      auto batch_reader,
+      reader->GetRecordBatchReader({2, 0}, {2}, {row_ranges[2], row_ranges[0]}));
+  ASSERT_OK_AND_ASSIGN(auto actual, batch_reader->ToTable());
+  ASSERT_OK_AND_ASSIGN(auto expected, ExpectedRows({2, 0}, {row_ranges[2], row_ranges[0]})
+                                          ->SelectColumns({2}));
+  ::arrow::AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST_F(ParquetRowSelectionTest, SkipsPages) {
+  auto reader = ParquetFileReader::Open(std::make_shared<BufferReader>(buffer_));
+  auto offset_index = reader->GetPageIndexReader()->RowGroup(0)->GetOffsetIndex(0);
+  ASSERT_NE(offset_index, nullptr);
+  const auto& page_locations = offset_index->page_locations();
+  ASSERT_GT(page_locations.size(), 3U);
+
+  // The last row of the second page and the first row of the third one
+  const int64_t row = page_locations[2].first_row_index;
+  RowRanges rows({{row - 1, row + 1}});
+  ASSERT_EQ(SelectPages(*offset_index, rows, kRowGroupLength),
+            std::vector<int32_t>({1, 2}));
+
+  RowRanges page_rows;
+  auto page_reader =
+      reader->RowGroup(0)->GetColumnPageReader(0, *offset_index, rows, &page_rows);
+  ASSERT_EQ(page_rows, RowRanges({{page_locations[1].first_row_index,
+                                   page_locations[3].first_row_index}}));
+  int num_data_pages = 0;
+  while (auto page = page_reader->NextPage()) {
+    if (page->type() == PageType::DATA_PAGE || page->type() == PageType::DATA_PAGE_V2) {
+      ++num_data_pages;
+    }
+  }
+  ASSERT_EQ(2, num_data_pages);
+}
+
+TEST_F(ParquetRowSelectionTest, InvalidRowRanges) {
+  auto reader = OpenReader(/*pre_buffer=*/false);
+  ASSERT_RAISES(Invalid, reader->GetRecordBatchReader({0, 1}, {0}, {RowRanges()}));
+  ASSERT_RAISES(IndexError,
+                reader->GetRecordBatchReader({2}, {0}, {RowRanges({{0, 51}})}));
+  ASSERT_RAISES(Invalid, reader->GetRecordBatchReader(
+                             {0, 0}, {0}, {RowRanges::All(10), RowRanges::All(10)}));
+}
+
 class ParquetBloomFilterRoundTripTest : public ::testing::Test,
                                         public TestingWithPageIndex {
  public:
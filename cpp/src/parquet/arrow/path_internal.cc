@@ -81,9 +81,18 @@
 //     - It tries to avoid using Status for common return states.
 //     - Avoids virtual dispatch in favor of if/else statements on a set of well known
 //     classes.
+//
+// Flat paths.
+//
+// Paths with at most one list and no all-null node (e.g. struct<primitive>,
+// list<primitive>, list<struct<primitive>>) skip the node state machine: their
+// definition levels are first filled for the leaf and then overwritten by the
+// null runs of each nullable ancestor, and their repetition levels come directly
+// from the list offsets (see WriteFlatPath).
 
 #include "parquet/arrow/path_internal.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <memory>
@@ -326,6 +335,8 @@ class ListPathNode {
         def_level_if_empty_(def_level_if_empty) {}
 
   int16_t rep_level() const { return rep_level_; }
+  int16_t def_level_if_empty() const { return def_level_if_empty_; }
+  const RangeSelector& selector() const { return selector_; }
 
   IterationResult Run(ElementRange* range, ElementRange* child_range,
                       PathWriteContext* context) {
@@ -527,8 +538,185 @@ struct PathInfo {
   int16_t max_rep_level = 0;
   bool has_dictionary = false;
   bool leaf_is_nullable = false;
+  // Whether the path can be written by WriteFlatPath
+  bool is_flat = false;
+  // The position of the list node in a flat path, -1 if there is none
+  int flat_list_index = -1;
 };
 
+// Overwrite the definition levels of the elements [start, end) of
+// `out` where one of the nullable nodes [begin, end) is null.  Outer nodes
+// are applied last, as the outermost null ancestor defines the level.
+void ApplyNullableNodes(const PathInfo::Node* nodes_begin,
+                        const PathInfo::Node* nodes_end, int64_t start, int64_t end,
+                        int16_t* out) {
+  for (const PathInfo::Node* node = nodes_end; node != nodes_begin;) {
+    const auto& nullable = std::get<NullableNode>(*--node);
+    ::arrow::internal::BitRunReader reader(nullable.null_bitmap_,
+                                           nullable.entry_offset_ + start, end - start);
+    int64_t position = 0;
+    for (::arrow::internal::BitRun run = reader.NextRun(); run.length != 0;
+         run = reader.NextRun()) {
+      if (!run.set) {
+        std::fill(out + position, out + position + run.length,
+                  nullable.def_level_if_null_);
+      }
+      position += run.length;
+    }
+  }
+}
+
+// Compute the definition levels of the elements [start, end) of a path of
+// nullable nodes ending with a terminal node.
+void FillFlatDefLevels(const PathInfo::Node* nodes_begin,
+                       const PathInfo::Node* nodes_end, int64_t start, int64_t end,
+                       int16_t* out) {
+  const PathInfo::Node& terminal = *(nodes_end - 1);
+  if (const auto* present = std::get_if<AllPresentTerminalNode>(&terminal)) {
+    std::fill(out, out + (end - start), present->def_level);
+  } else {
+    const auto& nullable = std::get<NullableTerminalNode>(terminal);
+    int16_t* position = out;
+    auto bit_visitor = [&](bool is_set) {
+      *position++ = is_set ? nullable.def_level_if_present_ : nullable.def_level_if_null_;
+    };
+    ::arrow::internal::VisitBitsUnrolled(nullable.bitmap_,
+                                         nullable.element_offset_ + start, end - start,
+                                         bit_visitor);
+  }
+  ApplyNullableNodes(nodes_begin, nodes_end - 1, start, end, out);
+}
+
+// Compute the levels of a flat path with a list node.  Each element of
+// `root_range` yields a single level when null above the list or empty,
+// and one level per child element otherwise.
+template <typename RangeSelector>
+Status WriteFlatListLevels(const ElementRange& root_range, const PathInfo& path_info,
+                           PathWriteContext* context) {
+  const PathInfo::Node* nodes = path_info.path.data();
+  const PathInfo::Node* list_node = nodes + path_info.flat_list_index;
+  const PathInfo::Node* nodes_end = nodes + path_info.path.size();
+  const auto& list = std::get<ListPathNode<RangeSelector>>(*list_node);
+  const RangeSelector& selector = list.selector();
+  const int16_t rep_level = list.rep_level();
+
+  // The definition levels of the elements that are null above the list,
+  // kLevelNotSet for the others
+  std::vector<int16_t> outer_def_levels(root_range.Size(), kLevelNotSet);
+  ApplyNullableNodes(nodes, list_node, root_range.start, root_range.end,
+                     outer_def_levels.data());
+
+  int64_t num_levels = 0;
+  for (int64_t i = 0; i < root_range.Size(); ++i) {
+    int64_t size = 0;
+    if (outer_def_levels[i] == kLevelNotSet) {
+      size = selector.GetRange(root_range.start + i).Size();
+    }
+    num_levels += std::max<int64_t>(size, 1);
+  }
+  RETURN_NOT_OK(context->def_levels.Reserve(num_levels));
+  RETURN_NOT_OK(context->rep_levels.Reserve(num_levels));
+  int16_t* def_levels = context->def_levels.mutable_data() + context->def_levels.length();
+  int16_t* rep_levels = context->rep_levels.mutable_data() + context->rep_levels.length();
+
+  // Consecutive non-empty lists have adjacent child ranges, whose definition
+  // levels are computed together
+  ElementRange pending{0, 0};
+  int64_t pending_position = 0;
+  auto flush_pending = [&]() {
+    if (!pending.Empty()) {
+      FillFlatDefLevels(list_node + 1, nodes_end, pending.start, pending.end,
+                        def_levels + pending_position);
+    }
+    pending = ElementRange{0, 0};
+  };
+
+  int64_t position = 0;
+  for (int64_t i = 0; i < root_range.Size(); ++i) {
+    int16_t def_level = outer_def_levels[i];
+    ElementRange child_range{0, 0};
+    if (def_level == kLevelNotSet) {
+      child_range = selector.GetRange(root_range.start + i);
+      if (child_range.Empty()) {
+        def_level = list.def_level_if_empty();
+      }
+    }
+    if (def_level != kLevelNotSet) {
+      flush_pending();
+      rep_levels[position] = rep_level - 1;
+      def_levels[position] = def_level;
+      ++position;
+      continue;
+    }
+    if (pending.Empty() || pending.end != child_range.start) {
+      flush_pending();
+      pending = child_range;
+      pending_position = position;
+    } else {
+      pending.end = child_range.end;
+    }
+    context->RecordPostListVisit(child_range);
+    rep_levels[position] = rep_level - 1;
+    std::fill(rep_levels + position + 1, rep_levels + position + child_range.Size(),
+              rep_level);
+    position += child_range.Size();
+  }
+  flush_pending();
+  DCHECK_EQ(position, num_levels);
+  context->def_levels.UnsafeAdvance(num_levels);
+  context->rep_levels.UnsafeAdvance(num_levels);
+  return Status::OK();
+}
+
+// Compute the levels of a flat path, see the overview
+Status WriteFlatPath(const ElementRange& root_range, const PathInfo& path_info,
+                     PathWriteContext* context) {
+  if (path_info.flat_list_index < 0) {
+    RETURN_NOT_OK(context->def_levels.Reserve(root_range.Size()));
+    const PathInfo::Node* nodes = path_info.path.data();
+    FillFlatDefLevels(nodes, nodes + path_info.path.size(), root_range.start,
+                      root_range.end,
+                      context->def_levels.mutable_data() + context->def_levels.length());
+    context->def_levels.UnsafeAdvance(root_range.Size());
+    return Status::OK();
+  }
+  const PathInfo::Node& list = path_info.path[path_info.flat_list_index];
+  if (std::holds_alternative<ListNode>(list)) {
+    return WriteFlatListLevels<VarRangeSelector<int32_t>>(root_range, path_info, context);
+  }
+  if (std::holds_alternative<LargeListNode>(list)) {
+    return WriteFlatListLevels<VarRangeSelector<int64_t>>(root_range, path_info, context);
+  }
+  return WriteFlatListLevels<FixedSizedRangeSelector>(root_range, path_info, context);
+}
+
+// Hand the levels computed for a path to `writer`
+Status FinishPath(PathInfo* path_info, PathWriteContext* context,
+                  MultipathLevelBuilderResult builder_result,
+                  const MultipathLevelBuilder::CallbackFunction& writer) {
+  builder_result.def_rep_level_count = context->def_levels.length();
+
+  if (context->rep_levels.length() > 0) {
+    // This case only occurs when there was a repeated element that needs to be
+    // processed.
+    builder_result.rep_levels = context->rep_levels.data();
+    std::swap(builder_result.post_list_visited_elements, context->visited_elements);
+    // If it is possible when processing lists that all lists where empty. In this
+    // case no elements would have been added to post_list_visited_elements. By
+    // added an empty element we avoid special casing in downstream consumers.
+    if (builder_result.post_list_visited_elements.empty()) {
+      builder_result.post_list_visited_elements.push_back({0, 0});
+    }
+  } else {
+    builder_result.post_list_visited_elements.push_back(
+        {0, builder_result.leaf_array->length()});
+    builder_result.rep_levels = nullptr;
+  }
+
+  builder_result.def_levels = context->def_levels.data();
+  return writer(builder_result);
+}
+
 /// Contains logic for writing a single leaf node to parquet.
 /// This tracks the path from root to leaf.
 ///
@@ -562,6 +750,11 @@ Status WritePath(ElementRange root_range, PathInfo* path_info,
     RETURN_NOT_OK(context.rep_levels.Reserve(root_range.Size()));
   }
 
+  if (path_info->is_flat) {
+    RETURN_NOT_OK(WriteFlatPath(root_range, *path_info, &context));
+    return FinishPath(path_info, &context, std::move(builder_result), writer);
+  }
+
   auto stack_base = &stack[0];
   auto stack_position = stack_base;
   // This is the main loop for calculated rep/def levels. The nodes
@@ -610,27 +803,7 @@ Status WritePath(ElementRange root_range, PathInfo* path_info,
     stack_position += static_cast<int>(result);
   }
   RETURN_NOT_OK(context.last_status);
-  builder_result.def_rep_level_count = context.def_levels.length();
-
-  if (context.rep_levels.length() > 0) {
-    // This case only occurs when there was a repeated element that needs to be
-    // processed.
-    builder_result.rep_levels = context.rep_levels.data();
-    std::swap(builder_result.post_list_visited_elements, context.visited_elements);
-    // If it is possible when processing lists that all lists where empty. In this
-    // case no elements would have been added to post_list_visited_elements. By
-    // added an empty element we avoid special casing in downstream consumers.
-    if (builder_result.post_list_visited_elements.empty()) {
-      builder_result.post_list_visited_elements.push_back({0, 0});
-    }
-  } else {
-    builder_result.post_list_visited_elements.push_back(
-        {0, builder_result.leaf_array->length()});
-    builder_result.rep_levels = nullptr;
-  }
-
-  builder_result.def_levels = context.def_levels.data();
-  return writer(builder_result);
+  return FinishPath(path_info, &context, std::move(builder_result), writer);
 }
 
 struct FixupVisitor {
@@ -690,6 +863,32 @@ PathInfo Fixup(PathInfo info) {
   return info;
 }
 
+// Check whether a path can be written by WriteFlatPath: nullable nodes with
+// at most one list node among them, followed by a terminal node that is not
+// all nulls.
+PathInfo MarkFlat(PathInfo info) {
+  if (info.path.empty() || info.max_rep_level > 1) {
+    return info;
+  }
+  const PathInfo::Node& terminal = info.path.back();
+  if (!std::holds_alternative<AllPresentTerminalNode>(terminal) &&
+      !std::holds_alternative<NullableTerminalNode>(terminal)) {
+    return info;
+  }
+  for (size_t i = 0; i + 1 < info.path.size(); ++i) {
+    const PathInfo::Node& node = info.path[i];
+    if (std::holds_alternative<NullableNode>(node)) {
+      continue;
+    }
+    if (info.flat_list_index >= 0 || std::holds_alternative<AllNullsTerminalNode>(node)) {
+      return info;
+    }
+    info.flat_list_index = static_cast<int>(i);
+  }
+  info.is_flat = true;
+  return info;
+}
+
 class PathBuilder {
  public:
   explicit PathBuilder(bool start_nullable) : nullable_in_parent_(start_nullable) {}
@@ -712,7 +911,7 @@ class PathBuilder {
                                                    array.offset(), info_.max_def_level));
     }
     info_.primitive_array = std::make_shared<T>(array.data());
-    paths_.push_back(Fixup(info_));
+    paths_.push_back(MarkFlat(Fixup(info_)));
   }
 
   template <typename T>
@@ -24,6 +24,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "arrow/array/array_base.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
 
@@ -511,6 +512,32 @@ TEST_F(MultipathLevelBuilderTest, TestStruct) {
       /*def_levels=*/std::vector<int16_t>({2, 2, 0}));
 }
 
+TEST_F(MultipathLevelBuilderTest, ListOfStructWithNullsAtEachLevel) {
+  auto entries = field("a", ::arrow::int64(), /*nullable=*/true);
+  auto list_type = list(::arrow::struct_({entries}));
+  auto array = ::arrow::ArrayFromJSON(list_type,
+                                      R"([[{"a": 1}, null, {"a": null}],
+                                          null,
+                                          [],
+                                          [{"a": 4}]])");
+
+  ASSERT_OK(
+      MultipathLevelBuilder::Write(*array, /*nullable=*/true, &context_, callback_));
+  ASSERT_THAT(results_, SizeIs(1));
+  results_[0].CheckLevels(/*def_levels=*/std::vector<int16_t>{4, 2, 3, 0, 1, 4},
+                          /*rep_levels=*/std::vector<int16_t>{0, 1, 1, 0, 0, 0});
+  ASSERT_THAT(results_[0].post_list_elements, SizeIs(1));
+  EXPECT_THAT(results_[0].post_list_elements[0].start, Eq(0));
+  EXPECT_THAT(results_[0].post_list_elements[0].end, Eq(4));
+
+  results_.clear();
+  ASSERT_OK(MultipathLevelBuilder::Write(*array->Slice(1), /*nullable=*/true, &context_,
+                                         callback_));
+  ASSERT_THAT(results_, SizeIs(1));
+  results_[0].CheckLevels(/*def_levels=*/std::vector<int16_t>{0, 1, 4},
+                          /*rep_levels=*/std::vector<int16_t>{0, 0, 0});
+}
+
 TEST_F(MultipathLevelBuilderTest, TestFixedSizeListNullableElements) {
   auto entries = field("Entries", ::arrow::int64());
   auto list_type = fixed_size_list(entries, 2);
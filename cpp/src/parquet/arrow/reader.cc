@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <deque>
 #include <memory>
 #include <random>
 #include <unordered_set>
@@ -54,6 +55,7 @@
 #include "parquet/page_index.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
+#include "parquet/size_statistics.h"
 
 using arrow::Array;
 using arrow::ArrayData;
@@ -79,6 +81,7 @@ using arrow::internal::Iota;
 
 // Help reduce verbosity
 using ParquetReader = parquet::ParquetFileReader;
+using ParquetColumnReader = parquet::ColumnReader;
 
 using parquet::internal::RecordReader;
 
@@ -138,6 +141,35 @@ std::shared_ptr<std::unordered_set<int>> VectorToSharedSet(
   return result;
 }
 
+// Return a generator of read(0), ..., read(count - 1), keeping up to `readahead`
+// reads in flight besides the one being consumed
+template <typename T>
+::arrow::AsyncGenerator<T> MakeReadaheadIndexGenerator(
+    int count, std::function<Future<T>(int)> read, int readahead) {
+  auto next_index = std::make_shared<int>(0);
+  ::arrow::AsyncGenerator<T> generator = [next_index, count,
+                                          read = std::move(read)]() -> Future<T> {
+    if (*next_index >= count) {
+      return ::arrow::AsyncGeneratorEnd<T>();
+    }
+    return read((*next_index)++);
+  };
+  if (readahead > 0) {
+    generator = ::arrow::MakeReadaheadGenerator(std::move(generator), readahead);
+  }
+  return generator;
+}
+
+// Append the column indices of the leaves below `field`
+void CollectLeafColumns(const SchemaField& field, std::vector<int>* out) {
+  if (field.is_leaf()) {
+    out->push_back(field.column_index);
+  }
+  for (const auto& child : field.children) {
+    CollectLeafColumns(child, out);
+  }
+}
+
 // Forward declaration
 Status GetReader(const SchemaField& field, const std::shared_ptr<ReaderContext>& context,
                  std::unique_ptr<ColumnReaderImpl>* out);
@@ -210,7 +242,8 @@ class FileReaderImpl : public FileReader {
   Status GetFieldReader(int i,
                         const std::shared_ptr<std::unordered_set<int>>& included_leaves,
                         const std::vector<int>& row_groups,
-                        std::unique_ptr<ColumnReaderImpl>* out) {
+                        std::unique_ptr<ColumnReaderImpl>* out,
+                        std::shared_ptr<const RowSelection> row_selection = nullptr) {
     // Should be covered by GetRecordBatchReader checks but
     // manifest_.schema_fields is a separate variable so be extra careful.
     if (ARROW_PREDICT_FALSE(i < 0 ||
@@ -227,13 +260,15 @@ class FileReaderImpl : public FileReader {
     ctx->filter_leaves = true;
     ctx->included_leaves = included_leaves;
     ctx->reader_properties = &reader_properties_;
+    ctx->row_selection = std::move(row_selection);
     return GetReader(manifest_.schema_fields[i], ctx, out);
   }
 
   Status GetFieldReaders(const std::vector<int>& column_indices,
                          const std::vector<int>& row_groups,
                          std::vector<std::shared_ptr<ColumnReaderImpl>>* out,
-                         std::shared_ptr<::arrow::Schema>* out_schema) {
+                         std::shared_ptr<::arrow::Schema>* out_schema,
+                         std::shared_ptr<const RowSelection> row_selection = nullptr) {
     // We only need to read schema fields which have columns indicated
     // in the indices vector
     ARROW_ASSIGN_OR_RAISE(std::vector<int> field_indices,
@@ -245,8 +280,8 @@ class FileReaderImpl : public FileReader {
     ::arrow::FieldVector out_fields(field_indices.size());
     for (size_t i = 0; i < out->size(); ++i) {
       std::unique_ptr<ColumnReaderImpl> reader;
-      RETURN_NOT_OK(
-          GetFieldReader(field_indices[i], included_leaves, row_groups, &reader));
+      RETURN_NOT_OK(GetFieldReader(field_indices[i], included_leaves, row_groups,
+                                   &reader, row_selection));
 
       out_fields[i] = reader->field();
       out->at(i) = std::move(reader);
@@ -317,7 +352,8 @@ class FileReaderImpl : public FileReader {
   // alive in async contexts.
   Future<std::shared_ptr<Table>> DecodeRowGroups(
       std::shared_ptr<FileReaderImpl> self, const std::vector<int>& row_groups,
-      const std::vector<int>& column_indices, ::arrow::internal::Executor* cpu_executor);
+      const std::vector<int>& column_indices, ::arrow::internal::Executor* cpu_executor,
+      std::shared_ptr<const RowSelection> row_selection = nullptr);
 
   Result<std::shared_ptr<Table>> ReadRowGroups(
       const std::vector<int>& row_groups) override {
@@ -337,6 +373,10 @@ class FileReaderImpl : public FileReader {
       const std::vector<int>& row_group_indices,
       const std::vector<int>& column_indices) override;
 
+  Result<std::unique_ptr<RecordBatchReader>> GetRecordBatchReader(
+      const std::vector<int>& row_group_indices, const std::vector<int>& column_indices,
+      const std::vector<RowRanges>& row_ranges) override;
+
   Result<std::unique_ptr<RecordBatchReader>> GetRecordBatchReader(
       const std::vector<int>& row_group_indices) override {
     return GetRecordBatchReader(row_group_indices,
@@ -355,6 +395,36 @@ class FileReaderImpl : public FileReader {
                           ::arrow::internal::Executor* cpu_executor,
                           int64_t rows_to_readahead) override;
 
+  ::arrow::Result<::arrow::AsyncGenerator<std::shared_ptr<::arrow::RecordBatch>>>
+  GetRecordBatchGenerator(std::shared_ptr<FileReader> reader,
+                          const std::vector<int> row_group_indices,
+                          const std::vector<int> column_indices,
+                          std::vector<RowRanges> row_ranges,
+                          ::arrow::internal::Executor* cpu_executor,
+                          int64_t rows_to_readahead) override;
+
+  Future<std::shared_ptr<Table>> ReadRowGroupsAsync(
+      std::shared_ptr<FileReader> reader, const std::vector<int>& row_groups,
+      const std::vector<int>& column_indices,
+      ::arrow::internal::Executor* cpu_executor) override;
+
+  Future<std::shared_ptr<ChunkedArray>> ReadColumnAsync(
+      std::shared_ptr<FileReader> reader, int i, const std::vector<int>& row_groups,
+      ::arrow::internal::Executor* cpu_executor) override;
+
+  // Helper for the asynchronous read methods: pre-buffer the given row groups and
+  // columns in a lazy cache, so that their I/O is only issued when waited for
+  Status PreBufferLazily(const std::vector<int>& row_groups,
+                         const std::vector<int>& column_indices);
+
+  // Helper for the asynchronous read methods: fetch the chunks of `leaves` in the
+  // given row group, then decode field `field_index` from them on `cpu_executor`
+  Future<std::shared_ptr<ChunkedArray>> DecodeFieldAsync(
+      const std::shared_ptr<FileReaderImpl>& self, int field_index,
+      const std::shared_ptr<std::unordered_set<int>>& included_leaves,
+      const std::vector<int>& leaves, int row_group,
+      ::arrow::internal::Executor* cpu_executor);
+
   int num_columns() const { return reader_->metadata()->num_columns(); }
 
   ParquetFileReader* parquet_reader() const override { return reader_.get(); }
@@ -381,6 +451,18 @@ class FileReaderImpl : public FileReader {
     END_PARQUET_CATCH_EXCEPTIONS
   }
 
+  // Validate the rows to read from each row group, load the offset indices used to
+  // skip pages and pre-buffer the selected pages if enabled. Row groups without any
+  // selected row are removed from `row_groups`.
+  Result<std::shared_ptr<RowSelection>> SelectRows(
+      const std::vector<int>& column_indices, const std::vector<RowRanges>& row_ranges,
+      std::vector<int>* row_groups);
+
+  // Build a RecordBatchReader once the data to read has been pre-buffered, if enabled
+  Result<std::unique_ptr<RecordBatchReader>> MakeRecordBatchReader(
+      const std::vector<int>& row_groups, const std::vector<int>& column_indices,
+      std::shared_ptr<const RowSelection> row_selection);
+
   MemoryPool* pool_;
   std::unique_ptr<ParquetFileReader> reader_;
   ArrowReaderProperties reader_properties_;
@@ -407,6 +489,175 @@ class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
   std::shared_ptr<::arrow::Schema> schema_;
 };
 
+namespace {
+
+// Whether the Arrow values of a column have the same layout as its decoded Parquet
+// values, so that they can be decoded in place
+bool CanReadInto(Type::type physical_type, const DataType& type) {
+  switch (physical_type) {
+    case Type::INT32:
+      return type.id() == ::arrow::Type::INT32 || type.id() == ::arrow::Type::UINT32 ||
+             type.id() == ::arrow::Type::DATE32 || type.id() == ::arrow::Type::TIME32;
+    case Type::INT64:
+      return type.id() == ::arrow::Type::INT64 || type.id() == ::arrow::Type::UINT64 ||
+             type.id() == ::arrow::Type::TIMESTAMP ||
+             type.id() == ::arrow::Type::TIME64 || type.id() == ::arrow::Type::DURATION;
+    case Type::FLOAT:
+      return type.id() == ::arrow::Type::FLOAT;
+    case Type::DOUBLE:
+      return type.id() == ::arrow::Type::DOUBLE;
+    case Type::FIXED_LEN_BYTE_ARRAY:
+      return type.id() == ::arrow::Type::FIXED_SIZE_BINARY;
+    case Type::BYTE_ARRAY:
+      return ::arrow::is_base_binary_like(type.id());
+    default:
+      return false;
+  }
+}
+
+Status CheckRowCount(const ColumnDescriptor* descr, int64_t position, int64_t num_rows) {
+  if (position != num_rows) {
+    return Status::Invalid("Column chunk '", descr->path()->ToDotString(), "' has ",
+                           position, " values, its row group has ", num_rows, " rows");
+  }
+  return Status::OK();
+}
+
+// Decode the values of a batch densely at its position in the output, then spread
+// them over their slots
+template <typename DType>
+Status ReadFixedWidthInto(ParquetColumnReader* column_reader, int64_t num_rows,
+                          int64_t batch_size, ArrayData* out) {
+  using T = typename DType::c_type;
+  auto* reader = checked_cast<TypedColumnReader<DType>*>(column_reader);
+  const int16_t max_def_level = reader->descr()->max_definition_level();
+  uint8_t* validity = max_def_level > 0 ? out->buffers[0]->mutable_data() : nullptr;
+  T* values = out->GetMutableValues<T>(1, 0);
+  std::vector<int16_t> def_levels(max_def_level > 0 ? batch_size : 0);
+  int64_t null_count = 0;
+  int64_t position = 0;
+  while (position < num_rows && reader->HasNext()) {
+    int64_t values_read = 0;
+    const int64_t levels_read = reader->ReadBatch(
+        std::min(batch_size, num_rows - position),
+        max_def_level > 0 ? def_levels.data() : nullptr,
+        /*rep_levels=*/nullptr, values + position, &values_read);
+    if (levels_read == 0) {
+      break;
+    }
+    if (max_def_level > 0) {
+      // Going from the back doesn't overwrite the values still to be moved
+      int64_t value = position + values_read;
+      for (int64_t i = position + levels_read - 1; i >= position; --i) {
+        const bool valid = def_levels[i - position] == max_def_level;
+        bit_util::SetBitTo(validity, i, valid);
+        if (valid) {
+          values[i] = values[--value];
+        } else {
+          values[i] = T{};
+          ++null_count;
+        }
+      }
+    }
+    position += levels_read;
+  }
+  out->null_count = null_count;
+  return CheckRowCount(reader->descr(), position, num_rows);
+}
+
+Status ReadFixedSizeBinaryInto(ParquetColumnReader* column_reader, int64_t num_rows,
+                               int64_t batch_size, ArrayData* out) {
+  auto* reader = checked_cast<FixedLenByteArrayReader*>(column_reader);
+  const int16_t max_def_level = reader->descr()->max_definition_level();
+  const int byte_width = reader->descr()->type_length();
+  uint8_t* validity = max_def_level > 0 ? out->buffers[0]->mutable_data() : nullptr;
+  uint8_t* data = out->GetMutableValues<uint8_t>(1, 0);
+  std::vector<int16_t> def_levels(max_def_level > 0 ? batch_size : 0);
+  std::vector<FixedLenByteArray> values(batch_size);
+  int64_t null_count = 0;
+  int64_t position = 0;
+  while (position < num_rows && reader->HasNext()) {
+    int64_t values_read = 0;
+    const int64_t levels_read = reader->ReadBatch(
+        std::min(batch_size, num_rows - position),
+        max_def_level > 0 ? def_levels.data() : nullptr,
+        /*rep_levels=*/nullptr, values.data(), &values_read);
+    if (levels_read == 0) {
+      break;
+    }
+    int64_t value = 0;
+    for (int64_t i = 0; i < levels_read; ++i) {
+      uint8_t* slot = data + (position + i) * byte_width;
+      if (max_def_level == 0 || def_levels[i] == max_def_level) {
+        std::memcpy(slot, values[value++].ptr, byte_width);
+      } else {
+        std::memset(slot, 0, byte_width);
+        ++null_count;
+      }
+      if (max_def_level > 0) {
+        bit_util::SetBitTo(validity, position + i, def_levels[i] == max_def_level);
+      }
+    }
+    position += levels_read;
+  }
+  out->null_count = null_count;
+  return CheckRowCount(reader->descr(), position, num_rows);
+}
+
+template <typename OffsetType>
+Status ReadBinaryInto(ParquetColumnReader* column_reader, int64_t num_rows,
+                      int64_t batch_size, ArrayData* out) {
+  auto* reader = checked_cast<ByteArrayReader*>(column_reader);
+  const int16_t max_def_level = reader->descr()->max_definition_level();
+  uint8_t* validity = max_def_level > 0 ? out->buffers[0]->mutable_data() : nullptr;
+  OffsetType* offsets = out->GetMutableValues<OffsetType>(1, 0);
+  uint8_t* data = out->buffers[2]->mutable_data();
+  const int64_t data_capacity = std::min<int64_t>(
+      out->buffers[2]->size(), std::numeric_limits<OffsetType>::max());
+  std::vector<int16_t> def_levels(max_def_level > 0 ? batch_size : 0);
+  std::vector<ByteArray> values(batch_size);
+  int64_t null_count = 0;
+  int64_t data_size = 0;
+  int64_t position = 0;
+  offsets[0] = 0;
+  while (position < num_rows && reader->HasNext()) {
+    int64_t values_read = 0;
+    const int64_t levels_read = reader->ReadBatch(
+        std::min(batch_size, num_rows - position),
+        max_def_level > 0 ? def_levels.data() : nullptr,
+        /*rep_levels=*/nullptr, values.data(), &values_read);
+    if (levels_read == 0) {
+      break;
+    }
+    int64_t value = 0;
+    for (int64_t i = 0; i < levels_read; ++i) {
+      if (max_def_level == 0 || def_levels[i] == max_def_level) {
+        const ByteArray& v = values[value++];
+        if (ARROW_PREDICT_FALSE(v.len > data_capacity - data_size)) {
+          return Status::CapacityError(
+              "The data of column chunk '", reader->descr()->path()->ToDotString(),
+              "' doesn't fit a buffer of ", data_capacity, " bytes");
+        }
+        if (v.len > 0) {
+          std::memcpy(data + data_size, v.ptr, v.len);
+        }
+        data_size += v.len;
+      } else {
+        ++null_count;
+      }
+      if (max_def_level > 0) {
+        bit_util::SetBitTo(validity, position + i, def_levels[i] == max_def_level);
+      }
+      offsets[position + i + 1] = static_cast<OffsetType>(data_size);
+    }
+    position += levels_read;
+  }
+  out->null_count = null_count;
+  return CheckRowCount(reader->descr(), position, num_rows);
+}
+
+}  // namespace
+
 class ColumnChunkReaderImpl : public ColumnChunkReader {
  public:
   ColumnChunkReaderImpl(FileReaderImpl* impl, int row_group_index, int column_index)
@@ -416,7 +667,116 @@ class ColumnChunkReaderImpl : public ColumnChunkReader {
     return impl_->ReadColumn(column_index_, {row_group_index_}, out);
   }
 
+  Result<std::vector<int64_t>> GetBufferSizes() override {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    ARROW_ASSIGN_OR_RAISE(const SchemaField* field, GetFlatField());
+    auto metadata = impl_->parquet_reader()->metadata()->RowGroup(row_group_index_);
+    const int64_t num_rows = metadata->num_rows();
+    const ColumnDescriptor* descr = metadata->schema()->Column(field->column_index);
+    const DataType& type = *field->field->type();
+
+    std::vector<int64_t> sizes;
+    sizes.push_back(descr->max_definition_level() > 0 ? bit_util::BytesForBits(num_rows)
+                                                      : 0);
+    if (::arrow::is_base_binary_like(type.id())) {
+      const int64_t offset_width = ::arrow::is_large_binary_like(type.id()) ? 8 : 4;
+      sizes.push_back((num_rows + 1) * offset_width);
+      auto size_stats = metadata->ColumnChunk(field->column_index)->size_statistics();
+      sizes.push_back(size_stats != nullptr &&
+                              size_stats->unencoded_byte_array_data_bytes.has_value()
+                          ? *size_stats->unencoded_byte_array_data_bytes
+                          : -1);
+    } else {
+      sizes.push_back(
+          num_rows * checked_cast<const ::arrow::FixedWidthType&>(type).byte_width());
+    }
+    return sizes;
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
+  Status ReadInto(const std::shared_ptr<ArrayData>& out) override {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    ARROW_ASSIGN_OR_RAISE(const SchemaField* field, GetFlatField());
+    const DataType& type = *field->field->type();
+    if (!out->type->Equals(type)) {
+      return Status::TypeError("Cannot read column chunk of type ", type, " into ",
+                               *out->type);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto sizes, GetBufferSizes());
+    if (out->buffers.size() != sizes.size()) {
+      return Status::Invalid("Expected ", sizes.size(), " buffers to read ", type,
+                             ", got ", out->buffers.size());
+    }
+    for (size_t i = 0; i < sizes.size(); ++i) {
+      const auto& buffer = out->buffers[i];
+      if (i == 0 && sizes[i] == 0) {
+        continue;
+      }
+      // The data of binary columns is checked while reading it
+      const int64_t min_size = i == 2 ? 0 : sizes[i];
+      if (buffer == nullptr || !buffer->is_mutable() || buffer->size() < min_size) {
+        return Status::Invalid("Buffer ", i, " must be mutable and have at least ",
+                               min_size, " bytes to read ", type);
+      }
+    }
+
+    auto row_group = impl_->parquet_reader()->RowGroup(row_group_index_);
+    const int64_t num_rows = row_group->metadata()->num_rows();
+    const int64_t batch_size = impl_->properties().batch_size();
+    std::shared_ptr<ParquetColumnReader> reader = row_group->Column(field->column_index);
+    switch (reader->type()) {
+      case Type::INT32:
+        RETURN_NOT_OK(ReadFixedWidthInto<Int32Type>(reader.get(), num_rows, batch_size,
+                                                    out.get()));
+        break;
+      case Type::INT64:
+        RETURN_NOT_OK(ReadFixedWidthInto<Int64Type>(reader.get(), num_rows, batch_size,
+                                                    out.get()));
+        break;
+      case Type::FLOAT:
+        RETURN_NOT_OK(ReadFixedWidthInto<FloatType>(reader.get(), num_rows, batch_size,
+                                                    out.get()));
+        break;
+      case Type::DOUBLE:
+        RETURN_NOT_OK(ReadFixedWidthInto<DoubleType>(reader.get(), num_rows, batch_size,
+                                                     out.get()));
+        break;
+      case Type::FIXED_LEN_BYTE_ARRAY:
+        RETURN_NOT_OK(
+            ReadFixedSizeBinaryInto(reader.get(), num_rows, batch_size, out.get()));
+        break;
+      default:
+        if (::arrow::is_large_binary_like(type.id())) {
+          RETURN_NOT_OK(
+              ReadBinaryInto<int64_t>(reader.get(), num_rows, batch_size, out.get()));
+        } else {
+          RETURN_NOT_OK(
+              ReadBinaryInto<int32_t>(reader.get(), num_rows, batch_size, out.get()));
+        }
+        break;
+    }
+    out->length = num_rows;
+    out->offset = 0;
+    return Status::OK();
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
  private:
+  // The schema field of the column, if it can be decoded in place
+  Result<const SchemaField*> GetFlatField() {
+    RETURN_NOT_OK(impl_->BoundsCheckColumn(column_index_));
+    RETURN_NOT_OK(impl_->BoundsCheckRowGroup(row_group_index_));
+    const SchemaField& field = impl_->manifest().schema_fields[column_index_];
+    const DataType& type = *field.field->type();
+    if (!field.is_leaf() || field.level_info.rep_level > 0 ||
+        !CanReadInto(impl_->manifest().descr->Column(field.column_index)->physical_type(),
+                     type)) {
+      return Status::NotImplemented("Reading column '", field.field->name(), "' of type ",
+                                    type, " into preallocated buffers");
+    }
+    return &field;
+  }
+
   FileReaderImpl* impl_;
   int column_index_;
   int row_group_index_;
@@ -500,7 +860,9 @@ class LeafReader : public ColumnReaderImpl {
       if (!record_reader_->HasMoreData()) {
         break;
       }
-      int64_t records_read = record_reader_->ReadRecords(records_to_read);
+      int64_t records_read = ctx_->row_selection != nullptr
+                                 ? ReadSelectedRecords(records_to_read)
+                                 : record_reader_->ReadRecords(records_to_read);
       records_to_read -= records_read;
       if (records_read == 0) {
         NextRowGroup();
@@ -515,10 +877,13 @@ class LeafReader : public ColumnReaderImpl {
         }
       }
     }
+    // The statistics of a row group do not apply to a selection of its rows
+    const bool attach_statistics =
+        num_target_row_groups == 1 && ctx_->row_selection == nullptr;
     RETURN_NOT_OK(TransferColumnData(
         record_reader_.get(),
-        num_target_row_groups == 1 ? input_->column_chunk_metadata() : nullptr, field_,
-        descr_, ctx_.get(), &out_));
+        attach_statistics ? input_->column_chunk_metadata() : nullptr, field_, descr_,
+        ctx_.get(), &out_));
     return Status::OK();
     END_PARQUET_CATCH_EXCEPTIONS
   }
@@ -533,16 +898,88 @@ class LeafReader : public ColumnReaderImpl {
 
  private:
   std::shared_ptr<ChunkedArray> out_;
+  // Records to skip, then to read, from the pages of the current row group
+  struct ReadRun {
+    int64_t skip;
+    int64_t length;
+  };
+
   void NextRowGroup() {
-    std::unique_ptr<PageReader> page_reader = input_->NextChunk();
+    if (ctx_->row_selection == nullptr) {
+      std::unique_ptr<PageReader> page_reader = input_->NextChunk();
+      record_reader_->SetPageReader(std::move(page_reader));
+      return;
+    }
+    RowRanges page_rows;
+    std::unique_ptr<PageReader> page_reader =
+        input_->NextChunk(*ctx_->row_selection, &page_rows);
+    read_runs_.clear();
+    if (page_reader != nullptr) {
+      ComputeReadRuns(ctx_->row_selection->row_ranges.at(input_->row_group_index()),
+                      page_rows);
+    }
     record_reader_->SetPageReader(std::move(page_reader));
   }
 
+  // Translate the selected rows of the row group into positions in the stream of
+  // rows stored in the pages returned by the page reader
+  void ComputeReadRuns(const RowRanges& selected, const RowRanges& page_rows) {
+    auto page_range = page_rows.ranges().begin();
+    // Position of page_range->start in the stream
+    int64_t page_range_position = 0;
+    int64_t position = 0;
+    for (const auto& range : selected.Intersect(page_rows).ranges()) {
+      while (page_range->end <= range.start) {
+        page_range_position += page_range->length();
+        ++page_range;
+      }
+      const int64_t start = page_range_position + (range.start - page_range->start);
+      read_runs_.push_back({start - position, range.length()});
+      position = start + range.length();
+    }
+    // Repeated columns buffer levels ahead of the records being read, they must all
+    // be consumed before moving to the next row group
+    const int64_t num_page_rows = page_rows.row_count();
+    if (descr_->max_repetition_level() > 0 && position < num_page_rows) {
+      read_runs_.push_back({num_page_rows - position, 0});
+    }
+  }
+
+  int64_t ReadSelectedRecords(int64_t max_records) {
+    int64_t records_read = 0;
+    while (records_read < max_records && !read_runs_.empty()) {
+      ReadRun& run = read_runs_.front();
+      if (run.skip > 0) {
+        if (record_reader_->SkipRecords(run.skip) != run.skip) {
+          throw ParquetException("Column chunk '", descr_->path()->ToDotString(),
+                                 "' has fewer rows than its offset index states");
+        }
+        run.skip = 0;
+      }
+      if (run.length > 0) {
+        int64_t n = record_reader_->ReadRecords(
+            std::min(run.length, max_records - records_read));
+        if (n == 0) {
+          throw ParquetException("Column chunk '", descr_->path()->ToDotString(),
+                                 "' has fewer rows than its offset index states");
+        }
+        run.length -= n;
+        records_read += n;
+      }
+      if (run.length == 0) {
+        read_runs_.pop_front();
+      }
+    }
+    return records_read;
+  }
+
   std::shared_ptr<ReaderContext> ctx_;
   std::shared_ptr<Field> field_;
   std::unique_ptr<FileColumnIterator> input_;
   const ColumnDescriptor* descr_;
   std::shared_ptr<RecordReader> record_reader_;
+  // Only used when reading a selection of rows
+  std::deque<ReadRun> read_runs_;
 };
 
 // Column reader for extension arrays
@@ -866,6 +1303,13 @@ Status GetReader(const SchemaField& field, const std::shared_ptr<Field>& arrow_f
     if (*out) {
       auto storage_type = (*out)->field()->type();
       if (!storage_type->Equals(storage_field->type())) {
+        const auto& extension_type =
+            checked_cast<const ExtensionType&>(*arrow_field->type());
+        if (extension_type.extension_name() == "parquet.variant") {
+          // Reading only some columns of a shredded Variant (see ShreddedVariantColumns)
+          // yields its pruned storage
+          return Status::OK();
+        }
         return Status::Invalid(
             "Due to column pruning only part of an extension's storage type was loaded.  "
             "An extension type cannot be created without all of its fields");
@@ -1015,9 +1459,91 @@ Result<std::unique_ptr<RecordBatchReader>> FileReaderImpl::GetRecordBatchReader(
     END_PARQUET_CATCH_EXCEPTIONS
   }
 
+  return MakeRecordBatchReader(row_groups, column_indices, /*row_selection=*/nullptr);
+}
+
+Result<std::shared_ptr<RowSelection>> FileReaderImpl::SelectRows(
+    const std::vector<int>& column_indices, const std::vector<RowRanges>& row_ranges,
+    std::vector<int>* row_groups) {
+  if (row_ranges.size() != row_groups->size()) {
+    return Status::Invalid("Expected row ranges for ", row_groups->size(),
+                           " row groups, got ", row_ranges.size());
+  }
+
+  auto selection = std::make_shared<RowSelection>();
+  // Row groups without any selected row are not read at all
+  std::vector<int> selected_row_groups;
+  std::vector<RowRanges> selected_row_ranges;
+  for (size_t i = 0; i < row_groups->size(); ++i) {
+    const int row_group = (*row_groups)[i];
+    const int64_t num_rows = reader_->metadata()->RowGroup(row_group)->num_rows();
+    if (!row_ranges[i].empty() && (row_ranges[i].ranges().front().start < 0 ||
+                                   row_ranges[i].ranges().back().end > num_rows)) {
+      return Status::IndexError("Row ranges ", row_ranges[i].ToString(),
+                                " out of bounds for row group ", row_group, " of ",
+                                num_rows, " rows");
+    }
+    if (!selection->row_ranges.emplace(row_group, row_ranges[i]).second) {
+      return Status::Invalid("Row group ", row_group, " is selected more than once");
+    }
+    if (!row_ranges[i].empty()) {
+      selected_row_groups.push_back(row_group);
+      selected_row_ranges.push_back(row_ranges[i]);
+    }
+  }
+
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  // Load the offset indices upfront as the page index reader is not thread-safe
+  std::shared_ptr<PageIndexReader> page_index_reader = reader_->GetPageIndexReader();
+  for (int row_group : selected_row_groups) {
+    auto row_group_index_reader = page_index_reader->RowGroup(row_group);
+    if (row_group_index_reader == nullptr) {
+      continue;
+    }
+    for (int column : column_indices) {
+      selection->offset_indices[{row_group, column}] =
+          row_group_index_reader->GetOffsetIndex(column);
+    }
+  }
+
+  if (reader_properties_.pre_buffer()) {
+    reader_->PreBuffer(
+        selected_row_groups, column_indices, selected_row_ranges,
+        [&](int row_group, int column) {
+          return selection->GetOffsetIndex(row_group, column);
+        },
+        reader_properties_.io_context(), reader_properties_.cache_options());
+  }
+  END_PARQUET_CATCH_EXCEPTIONS
+
+  *row_groups = std::move(selected_row_groups);
+  return selection;
+}
+
+Result<std::unique_ptr<RecordBatchReader>> FileReaderImpl::GetRecordBatchReader(
+    const std::vector<int>& row_group_indices, const std::vector<int>& column_indices,
+    const std::vector<RowRanges>& row_ranges) {
+  RETURN_NOT_OK(BoundsCheck(row_group_indices, column_indices));
+  std::vector<int> row_groups = row_group_indices;
+  ARROW_ASSIGN_OR_RAISE(auto selection,
+                        SelectRows(column_indices, row_ranges, &row_groups));
+  return MakeRecordBatchReader(row_groups, column_indices, std::move(selection));
+}
+
+Result<std::unique_ptr<RecordBatchReader>> FileReaderImpl::MakeRecordBatchReader(
+    const std::vector<int>& row_groups, const std::vector<int>& column_indices,
+    std::shared_ptr<const RowSelection> row_selection) {
+  auto row_group_num_rows = [&](int row_group) {
+    if (row_selection != nullptr) {
+      return row_selection->row_ranges.at(row_group).row_count();
+    }
+    return parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+  };
+
   std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
   std::shared_ptr<::arrow::Schema> batch_schema;
-  RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, &readers, &batch_schema));
+  RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, &readers, &batch_schema,
+                                row_selection));
 
   if (readers.empty()) {
     // Just generate all batches right now; they're cheap since they have no columns.
@@ -1028,7 +1554,7 @@ Result<std::unique_ptr<RecordBatchReader>> FileReaderImpl::GetRecordBatchReader(
     ::arrow::RecordBatchVector batches;
 
     for (int row_group : row_groups) {
-      int64_t num_rows = parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+      int64_t num_rows = row_group_num_rows(row_group);
 
       batches.insert(batches.end(), static_cast<size_t>(num_rows / batch_size),
                      max_sized_batch);
@@ -1044,7 +1570,7 @@ Result<std::unique_ptr<RecordBatchReader>> FileReaderImpl::GetRecordBatchReader(
 
   int64_t num_rows = 0;
   for (int row_group : row_groups) {
-    num_rows += parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+    num_rows += row_group_num_rows(row_group);
   }
 
   using ::arrow::RecordBatchIterator;
@@ -1109,11 +1635,13 @@ class RowGroupGenerator {
   explicit RowGroupGenerator(std::shared_ptr<FileReaderImpl> arrow_reader,
                              ::arrow::internal::Executor* cpu_executor,
                              std::vector<int> row_groups, std::vector<int> column_indices,
-                             int64_t min_rows_in_flight)
+                             int64_t min_rows_in_flight,
+                             std::shared_ptr<const RowSelection> row_selection = nullptr)
       : arrow_reader_(std::move(arrow_reader)),
         cpu_executor_(cpu_executor),
         row_groups_(std::move(row_groups)),
         column_indices_(std::move(column_indices)),
+        row_selection_(std::move(row_selection)),
         min_rows_in_flight_(min_rows_in_flight),
         rows_in_flight_(0),
         index_(0),
@@ -1151,19 +1679,24 @@ class RowGroupGenerator {
     std::vector<int> column_indices = column_indices_;
     auto reader = arrow_reader_;
     int64_t num_rows =
-        reader->parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+        row_selection_ != nullptr
+            ? row_selection_->row_ranges.at(row_group).row_count()
+            : reader->parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
     rows_in_flight_ += num_rows;
     ::arrow::Future<RecordBatchGenerator> row_group_read;
     if (!reader->properties().pre_buffer()) {
-      row_group_read = SubmitRead(cpu_executor_, reader, row_group, column_indices);
+      row_group_read =
+          SubmitRead(cpu_executor_, reader, row_group, column_indices, row_selection_);
     } else {
       auto ready = reader->parquet_reader()->WhenBuffered({row_group}, column_indices);
       if (cpu_executor_) ready = cpu_executor_->TransferAlways(ready);
       row_group_read =
           ready.Then([cpu_executor = cpu_executor_, reader, row_group,
-                      column_indices = std::move(
-                          column_indices)]() -> ::arrow::Future<RecordBatchGenerator> {
-            return ReadOneRowGroup(cpu_executor, reader, row_group, column_indices);
+                      column_indices = std::move(column_indices),
+                      row_selection = row_selection_]()
+                         -> ::arrow::Future<RecordBatchGenerator> {
+            return ReadOneRowGroup(cpu_executor, reader, row_group, column_indices,
+                                   row_selection);
           });
     }
     in_flight_reads_.push({std::move(row_group_read), num_rows});
@@ -1176,21 +1709,27 @@ class RowGroupGenerator {
   // async I/O without forcing readahead.
   static ::arrow::Future<RecordBatchGenerator> SubmitRead(
       ::arrow::internal::Executor* cpu_executor, std::shared_ptr<FileReaderImpl> self,
-      const int row_group, const std::vector<int>& column_indices) {
+      const int row_group, const std::vector<int>& column_indices,
+      std::shared_ptr<const RowSelection> row_selection) {
     if (!cpu_executor) {
-      return ReadOneRowGroup(cpu_executor, self, row_group, column_indices);
+      return ReadOneRowGroup(cpu_executor, self, row_group, column_indices,
+                             std::move(row_selection));
     }
     // If we have an executor, then force transfer (even if I/O was complete)
     return ::arrow::DeferNotOk(cpu_executor->Submit(ReadOneRowGroup, cpu_executor, self,
-                                                    row_group, column_indices));
+                                                    row_group, column_indices,
+                                                    std::move(row_selection)));
   }
 
   static ::arrow::Future<RecordBatchGenerator> ReadOneRowGroup(
       ::arrow::internal::Executor* cpu_executor, std::shared_ptr<FileReaderImpl> self,
-      const int row_group, const std::vector<int>& column_indices) {
+      const int row_group, const std::vector<int>& column_indices,
+      std::shared_ptr<const RowSelection> row_selection) {
     // Skips bound checks/pre-buffering, since we've done that already
     const int64_t batch_size = self->properties().batch_size();
-    return self->DecodeRowGroups(self, {row_group}, column_indices, cpu_executor)
+    return self
+        ->DecodeRowGroups(self, {row_group}, column_indices, cpu_executor,
+                          std::move(row_selection))
         .Then([batch_size](const std::shared_ptr<Table>& table)
                   -> ::arrow::Result<RecordBatchGenerator> {
           ::arrow::TableBatchReader table_reader(*table);
@@ -1204,6 +1743,7 @@ class RowGroupGenerator {
   ::arrow::internal::Executor* cpu_executor_;
   std::vector<int> row_groups_;
   std::vector<int> column_indices_;
+  std::shared_ptr<const RowSelection> row_selection_;
   int64_t min_rows_in_flight_;
   std::queue<ReadRequest> in_flight_reads_;
   int64_t rows_in_flight_;
@@ -1237,6 +1777,181 @@ FileReaderImpl::GetRecordBatchGenerator(std::shared_ptr<FileReader> reader,
   return concatenated;
 }
 
+::arrow::Result<::arrow::AsyncGenerator<std::shared_ptr<::arrow::RecordBatch>>>
+FileReaderImpl::GetRecordBatchGenerator(std::shared_ptr<FileReader> reader,
+                                        const std::vector<int> row_group_indices,
+                                        const std::vector<int> column_indices,
+                                        std::vector<RowRanges> row_ranges,
+                                        ::arrow::internal::Executor* cpu_executor,
+                                        int64_t rows_to_readahead) {
+  RETURN_NOT_OK(BoundsCheck(row_group_indices, column_indices));
+  if (rows_to_readahead < 0) {
+    return Status::Invalid("rows_to_readahead must be >= 0");
+  }
+  std::vector<int> row_groups = row_group_indices;
+  ARROW_ASSIGN_OR_RAISE(auto selection,
+                        SelectRows(column_indices, row_ranges, &row_groups));
+  ::arrow::AsyncGenerator<RowGroupGenerator::RecordBatchGenerator> row_group_generator =
+      RowGroupGenerator(::arrow::internal::checked_pointer_cast<FileReaderImpl>(reader),
+                        cpu_executor, std::move(row_groups), column_indices,
+                        rows_to_readahead, std::move(selection));
+  ::arrow::AsyncGenerator<std::shared_ptr<::arrow::RecordBatch>> concatenated =
+      ::arrow::MakeConcatenatedGenerator(std::move(row_group_generator));
+  WRAP_ASYNC_GENERATOR(std::move(concatenated));
+  return concatenated;
+}
+
+Status FileReaderImpl::PreBufferLazily(const std::vector<int>& row_groups,
+                                       const std::vector<int>& column_indices) {
+  // The readahead is driven by the callers, which wait for the chunks they need
+  ::arrow::io::CacheOptions cache_options = reader_properties_.cache_options();
+  cache_options.lazy = true;
+  cache_options.prefetch_limit = 0;
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  reader_->PreBuffer(row_groups, column_indices, reader_properties_.io_context(),
+                     cache_options);
+  END_PARQUET_CATCH_EXCEPTIONS
+  return Status::OK();
+}
+
+Future<std::shared_ptr<ChunkedArray>> FileReaderImpl::DecodeFieldAsync(
+    const std::shared_ptr<FileReaderImpl>& self, int field_index,
+    const std::shared_ptr<std::unordered_set<int>>& included_leaves,
+    const std::vector<int>& leaves, int row_group,
+    ::arrow::internal::Executor* cpu_executor) {
+  Future<> buffered;
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  buffered = reader_->WhenBuffered({row_group}, leaves);
+  END_PARQUET_CATCH_EXCEPTIONS
+  // Always transfer, so that decoding doesn't run on the I/O thread that completed
+  // the read
+  return cpu_executor->TransferAlways(std::move(buffered))
+      .Then([self, field_index, included_leaves,
+             row_group]() -> Result<std::shared_ptr<ChunkedArray>> {
+        std::unique_ptr<ColumnReaderImpl> reader;
+        RETURN_NOT_OK(
+            self->GetFieldReader(field_index, included_leaves, {row_group}, &reader));
+        std::shared_ptr<ChunkedArray> column;
+        RETURN_NOT_OK(self->ReadColumn(field_index, {row_group}, reader.get(), &column));
+        return column;
+      });
+}
+
+Future<std::shared_ptr<Table>> FileReaderImpl::ReadRowGroupsAsync(
+    std::shared_ptr<FileReader> reader, const std::vector<int>& row_groups,
+    const std::vector<int>& column_indices, ::arrow::internal::Executor* cpu_executor) {
+  RETURN_NOT_OK(BoundsCheck(row_groups, column_indices));
+  if (!cpu_executor) cpu_executor = ::arrow::internal::GetCpuThreadPool();
+
+  // The readers are only created for the schema, each column chunk gets its own
+  // reader when decoded
+  std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
+  std::shared_ptr<::arrow::Schema> result_schema;
+  RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, &readers, &result_schema));
+  readers.clear();
+  ARROW_ASSIGN_OR_RAISE(std::vector<int> field_indices,
+                        manifest_.GetFieldIndices(column_indices));
+  // The selected leaves of each field, which are fetched before decoding it
+  std::vector<std::vector<int>> field_leaves(field_indices.size());
+  for (int column_index : column_indices) {
+    ARROW_ASSIGN_OR_RAISE(std::vector<int> root,
+                          manifest_.GetFieldIndices({column_index}));
+    auto it = std::find(field_indices.begin(), field_indices.end(), root[0]);
+    field_leaves[it - field_indices.begin()].push_back(column_index);
+  }
+  RETURN_NOT_OK(PreBufferLazily(row_groups, column_indices));
+
+  auto self = ::arrow::internal::checked_pointer_cast<FileReaderImpl>(reader);
+  const int num_fields = static_cast<int>(field_indices.size());
+  const int columns_in_flight =
+      reader_properties_.column_readahead() > 0
+          ? std::min(reader_properties_.column_readahead(), num_fields)
+          : num_fields;
+  auto included_leaves = VectorToSharedSet(column_indices);
+  auto read_row_group = [self, cpu_executor, result_schema, columns_in_flight,
+                         field_indices = std::move(field_indices),
+                         field_leaves = std::move(field_leaves),
+                         included_leaves](int row_group)
+      -> Future<std::shared_ptr<Table>> {
+    const int64_t num_rows =
+        self->parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+    if (field_indices.empty()) {
+      return Table::Make(result_schema, ::arrow::ChunkedArrayVector{}, num_rows);
+    }
+    auto read_field = [self, cpu_executor, row_group, field_indices, field_leaves,
+                       included_leaves](int i) {
+      return self->DecodeFieldAsync(self, field_indices[i], included_leaves,
+                                    field_leaves[i], row_group, cpu_executor);
+    };
+    auto columns = MakeReadaheadIndexGenerator<std::shared_ptr<ChunkedArray>>(
+        static_cast<int>(field_indices.size()), std::move(read_field),
+        columns_in_flight - 1);
+    return ::arrow::CollectAsyncGenerator(std::move(columns))
+        .Then([result_schema, num_rows](const ::arrow::ChunkedArrayVector& columns)
+                  -> Result<std::shared_ptr<Table>> {
+          auto table = Table::Make(result_schema, columns, num_rows);
+          RETURN_NOT_OK(table->Validate());
+          return table;
+        });
+  };
+  auto tables = MakeReadaheadIndexGenerator<std::shared_ptr<Table>>(
+      static_cast<int>(row_groups.size()),
+      [row_groups, read_row_group = std::move(read_row_group)](int i) {
+        return read_row_group(row_groups[i]);
+      },
+      reader_properties_.row_group_readahead());
+  return ::arrow::CollectAsyncGenerator(std::move(tables))
+      .Then([result_schema](const std::vector<std::shared_ptr<Table>>& tables)
+                -> Result<std::shared_ptr<Table>> {
+        if (tables.empty()) {
+          return Table::MakeEmpty(result_schema);
+        }
+        return ::arrow::ConcatenateTables(tables);
+      });
+}
+
+Future<std::shared_ptr<ChunkedArray>> FileReaderImpl::ReadColumnAsync(
+    std::shared_ptr<FileReader> reader, int i, const std::vector<int>& row_groups,
+    ::arrow::internal::Executor* cpu_executor) {
+  if (i < 0 || static_cast<size_t>(i) >= manifest_.schema_fields.size()) {
+    return Status::Invalid("Field index out of bounds (got ", i,
+                           ", should be between 0 and ",
+                           manifest_.schema_fields.size() - 1, ")");
+  }
+  for (int row_group : row_groups) {
+    RETURN_NOT_OK(BoundsCheckRowGroup(row_group));
+  }
+  if (!cpu_executor) cpu_executor = ::arrow::internal::GetCpuThreadPool();
+
+  std::vector<int> leaves;
+  CollectLeafColumns(manifest_.schema_fields[i], &leaves);
+  std::unique_ptr<ColumnReaderImpl> field_reader;
+  RETURN_NOT_OK(GetFieldReader(i, VectorToSharedSet(leaves), row_groups, &field_reader));
+  std::shared_ptr<DataType> type = field_reader->field()->type();
+  field_reader.reset();
+  RETURN_NOT_OK(PreBufferLazily(row_groups, leaves));
+
+  auto self = ::arrow::internal::checked_pointer_cast<FileReaderImpl>(reader);
+  auto included_leaves = VectorToSharedSet(leaves);
+  auto read_row_group = [self, cpu_executor, i, row_groups, leaves = std::move(leaves),
+                         included_leaves](int index) {
+    return self->DecodeFieldAsync(self, i, included_leaves, leaves, row_groups[index],
+                                  cpu_executor);
+  };
+  auto chunks = MakeReadaheadIndexGenerator<std::shared_ptr<ChunkedArray>>(
+      static_cast<int>(row_groups.size()), std::move(read_row_group),
+      reader_properties_.row_group_readahead());
+  return ::arrow::CollectAsyncGenerator(std::move(chunks))
+      .Then([type](const ::arrow::ChunkedArrayVector& chunks)
+                -> Result<std::shared_ptr<ChunkedArray>> {
+        ::arrow::ArrayVector arrays;
+        for (const auto& chunk : chunks) {
+          arrays.insert(arrays.end(), chunk->chunks().begin(), chunk->chunks().end());
+        }
+        return ChunkedArray::Make(std::move(arrays), type);
+      });
+}
+
 Status FileReaderImpl::GetColumn(int i, FileColumnIteratorFactory iterator_factory,
                                  std::unique_ptr<ColumnReader>* out) {
   RETURN_NOT_OK(BoundsCheckColumn(i));
@@ -1272,12 +1987,14 @@ Result<std::shared_ptr<Table>> FileReaderImpl::ReadRowGroups(
 
 Future<std::shared_ptr<Table>> FileReaderImpl::DecodeRowGroups(
     std::shared_ptr<FileReaderImpl> self, const std::vector<int>& row_groups,
-    const std::vector<int>& column_indices, ::arrow::internal::Executor* cpu_executor) {
+    const std::vector<int>& column_indices, ::arrow::internal::Executor* cpu_executor,
+    std::shared_ptr<const RowSelection> row_selection) {
   // `self` is used solely to keep `this` alive in an async context - but we use this
   // in a sync context too so use `this` over `self`
   std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
   std::shared_ptr<::arrow::Schema> result_schema;
-  RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, &readers, &result_schema));
+  RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, &readers, &result_schema,
+                                row_selection));
   // OptionalParallelForAsync requires an executor
   if (!cpu_executor) cpu_executor = ::arrow::internal::GetCpuThreadPool();
 
@@ -1288,12 +2005,16 @@ Future<std::shared_ptr<Table>> FileReaderImpl::DecodeRowGroups(
     RETURN_NOT_OK(ReadColumn(static_cast<int>(i), row_groups, reader.get(), &column));
     return column;
   };
-  auto make_table = [result_schema, row_groups, self,
+  auto make_table = [result_schema, row_groups, row_selection, self,
                      this](const ::arrow::ChunkedArrayVector& columns)
       -> ::arrow::Result<std::shared_ptr<Table>> {
     int64_t num_rows = 0;
     if (!columns.empty()) {
       num_rows = columns[0]->length();
+    } else if (row_selection != nullptr) {
+      for (int i : row_groups) {
+        num_rows += row_selection->row_ranges.at(i).row_count();
+      }
     } else {
       for (int i : row_groups) {
         num_rows += parquet_reader()->metadata()->RowGroup(i)->num_rows();
@@ -29,6 +29,7 @@
 
 namespace arrow {
 
+struct ArrayData;
 class ChunkedArray;
 class KeyValueMetadata;
 class RecordBatchReader;
@@ -42,6 +43,7 @@ class RecordBatch;
 namespace parquet {
 
 class FileMetaData;
+class RowRanges;
 class SchemaDescriptor;
 
 namespace arrow {
@@ -192,6 +194,25 @@ class PARQUET_EXPORT FileReader {
   GetRecordBatchReader(const std::vector<int>& row_group_indices,
                        const std::vector<int>& column_indices) = 0;
 
+  /// \brief Return a RecordBatchReader of some rows of the row groups selected
+  /// from row_group_indices, whose columns are selected by column_indices.
+  ///
+  /// `row_ranges[k]` are the rows to read from `row_group_indices[k]`, relative to
+  /// the start of the row group, and a row group may only be selected once. Use
+  /// RowRanges::FromBitmap to select rows with a bitmap.
+  ///
+  /// Column chunks having an offset index only read (and pre-buffer) the data pages
+  /// holding some of the selected rows, the unwanted rows of these pages are skipped
+  /// without being materialized. Statistics are not attached to the returned arrays.
+  ///
+  /// \returns error Result if either row_group_indices or column_indices
+  ///     contains an invalid index, or if the row ranges are out of bounds
+  /// \note API EXPERIMENTAL
+  virtual ::arrow::Result<std::unique_ptr<::arrow::RecordBatchReader>>
+  GetRecordBatchReader(const std::vector<int>& row_group_indices,
+                       const std::vector<int>& column_indices,
+                       const std::vector<RowRanges>& row_ranges) = 0;
+
   /// \brief Return a RecordBatchReader of row groups selected from
   /// row_group_indices, whose columns are selected by column_indices.
   ///
@@ -234,6 +255,60 @@ class PARQUET_EXPORT FileReader {
                           ::arrow::internal::Executor* cpu_executor = NULLPTR,
                           int64_t rows_to_readahead = 0) = 0;
 
+  /// \brief Return a generator of record batches holding only the selected rows.
+  ///
+  /// Like the overload above, but only the rows in `row_ranges[i]` are read from
+  /// row group `row_group_indices[i]`, skipping whole pages using the page index
+  /// where possible. Row groups with no selected rows are not read.
+  ///
+  /// \returns error Result if either row_group_indices or column_indices contains an
+  ///     invalid index, or if the row ranges don't match the row groups
+  ///
+  /// \note API EXPERIMENTAL
+  virtual ::arrow::Result<
+      std::function<::arrow::Future<std::shared_ptr<::arrow::RecordBatch>>()>>
+  GetRecordBatchGenerator(std::shared_ptr<FileReader> reader,
+                          const std::vector<int> row_group_indices,
+                          const std::vector<int> column_indices,
+                          std::vector<RowRanges> row_ranges,
+                          ::arrow::internal::Executor* cpu_executor = NULLPTR,
+                          int64_t rows_to_readahead = 0) = 0;
+
+  /// \brief Read the given row groups columns into a Table asynchronously
+  ///
+  /// The column chunks are fetched through a lazy read cache on the I/O executor
+  /// of ArrowReaderProperties::io_context(). Each column of a row group is decoded
+  /// on `cpu_executor` as soon as its chunk is available, so that I/O threads never
+  /// decode data. ArrowReaderProperties::row_group_readahead() and
+  /// ArrowReaderProperties::column_readahead() bound how much is fetched ahead of
+  /// decoding.
+  ///
+  /// This replaces any data pre-buffered by an earlier read on this FileReader, so
+  /// other reads must not be in progress on it.
+  /// The pre_buffer() and use_threads() properties are not used: reads are always
+  /// coalesced, and columns are decoded concurrently up to column_readahead().
+  ///
+  /// \param reader should point to this reader, to keep it alive while reading
+  /// \param row_groups the row groups to read, in order
+  /// \param column_indices the leaf columns to read, see ReadTable()
+  /// \param cpu_executor the executor decoding the columns, defaults to the CPU
+  ///     thread pool
+  ///
+  /// \note API EXPERIMENTAL
+  virtual ::arrow::Future<std::shared_ptr<::arrow::Table>> ReadRowGroupsAsync(
+      std::shared_ptr<FileReader> reader, const std::vector<int>& row_groups,
+      const std::vector<int>& column_indices,
+      ::arrow::internal::Executor* cpu_executor = NULLPTR) = 0;
+
+  /// \brief Read column `i` of the given row groups asynchronously
+  ///
+  /// Like ReadRowGroupsAsync(), with `i` being a field index as in ReadColumn().
+  ///
+  /// \note API EXPERIMENTAL
+  virtual ::arrow::Future<std::shared_ptr<::arrow::ChunkedArray>> ReadColumnAsync(
+      std::shared_ptr<FileReader> reader, int i, const std::vector<int>& row_groups,
+      ::arrow::internal::Executor* cpu_executor = NULLPTR) = 0;
+
   /// Read all columns into a Table
   virtual ::arrow::Result<std::shared_ptr<::arrow::Table>> ReadTable() = 0;
 
@@ -345,6 +420,27 @@ class ColumnChunkReader {
  public:
   virtual ~ColumnChunkReader() = default;
   virtual ::arrow::Status Read(std::shared_ptr<::arrow::ChunkedArray>* out) = 0;
+
+  /// \brief Return the sizes of the buffers needed by ReadInto(), from the metadata
+  ///
+  /// The sizes follow the buffer layout of the column's Arrow type: the validity
+  /// bitmap (0 if the column is not nullable), then the values, or the offsets and
+  /// the data of binary columns. The data size of a binary column is only known if
+  /// the writer recorded size statistics, it is -1 otherwise.
+  ///
+  /// Only flat columns whose Arrow values need no conversion from their Parquet
+  /// representation are supported: 32 and 64-bit integers, dates, times,
+  /// timestamps and durations, floating point, fixed size binary and binary types.
+  virtual ::arrow::Result<std::vector<int64_t>> GetBufferSizes() = 0;
+
+  /// \brief Decode the column chunk directly into caller-provided buffers
+  ///
+  /// `out` must have the column's Arrow type and mutable buffers at least as large as
+  /// GetBufferSizes() (a null validity buffer is allowed if the column is not
+  /// nullable), except for the data buffer of binary columns: CapacityError is
+  /// returned if the data doesn't fit it. On success, the length and null count of
+  /// `out` are set to the ones of the column chunk.
+  virtual ::arrow::Status ReadInto(const std::shared_ptr<::arrow::ArrayData>& out) = 0;
 };
 
 // At this point, the column reader is a stream iterator. It only knows how to
@@ -21,7 +21,9 @@
 #include <cstdint>
 #include <deque>
 #include <functional>
+#include <map>
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -30,6 +32,7 @@
 #include "parquet/column_reader.h"
 #include "parquet/file_reader.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 
@@ -57,6 +60,20 @@ class ColumnReaderImpl;
 // ----------------------------------------------------------------------
 // Iteration utilities
 
+// The rows to read from some row groups, along with the offset indices used to
+// skip the data pages that do not hold any of them
+struct RowSelection {
+  // Keyed by row group
+  std::unordered_map<int, RowRanges> row_ranges;
+  // Keyed by (row group, column), nullptr if the column chunk has no offset index
+  std::map<std::pair<int, int>, std::shared_ptr<OffsetIndex>> offset_indices;
+
+  const OffsetIndex* GetOffsetIndex(int row_group, int column) const {
+    auto it = offset_indices.find({row_group, column});
+    return it == offset_indices.end() ? nullptr : it->second.get();
+  }
+};
+
 // Abstraction to decouple row group iteration details from the ColumnReader,
 // so we can read only a single row group if we want
 class FileColumnIterator {
@@ -82,6 +99,28 @@ class FileColumnIterator {
     return row_group_reader->GetColumnPageReader(column_index_);
   }
 
+  // Like NextChunk(), but the returned reader skips the data pages that hold none
+  // of the selected rows. `page_rows` is set to the rows stored in the other pages.
+  std::unique_ptr<::parquet::PageReader> NextChunk(const RowSelection& selection,
+                                                  RowRanges* page_rows) {
+    if (row_groups_.empty()) {
+      return nullptr;
+    }
+
+    row_group_index_ = row_groups_.front();
+    auto row_group_reader = reader_->RowGroup(row_group_index_);
+    row_groups_.pop_front();
+    const OffsetIndex* offset_index =
+        selection.GetOffsetIndex(row_group_index_, column_index_);
+    if (offset_index == nullptr) {
+      *page_rows = RowRanges::All(row_group_reader->metadata()->num_rows());
+      return row_group_reader->GetColumnPageReader(column_index_);
+    }
+    return row_group_reader->GetColumnPageReader(
+        column_index_, *offset_index, selection.row_ranges.at(row_group_index_),
+        page_rows);
+  }
+
   const SchemaDescriptor* schema() const { return schema_; }
 
   const ColumnDescriptor* descr() const { return schema_->Column(column_index_); }
@@ -118,6 +157,8 @@ struct ReaderContext {
   bool filter_leaves;
   std::shared_ptr<std::unordered_set<int>> included_leaves;
   ArrowReaderProperties* reader_properties;
+  // If set, only these rows are read
+  std::shared_ptr<const RowSelection> row_selection;
 
   bool IncludesLeaf(int leaf_index) const {
     if (this->filter_leaves) {
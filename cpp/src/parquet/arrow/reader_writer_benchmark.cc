@@ -719,6 +719,102 @@ static void BM_ReadListOfListColumn(::benchmark::State& state) {
 
 BENCHMARK(BM_ReadListOfListColumn)->Apply(NestedReadArguments);
 
+//
+// Benchmark writing a nested column
+//
+
+static void BenchmarkWriteArray(::benchmark::State& state,
+                                const std::shared_ptr<Array>& array, bool nullable,
+                                int64_t num_values, int64_t total_bytes) {
+  auto schema = ::arrow::schema({field("s", array->type(), nullable)});
+  auto table = Table::Make(schema, {array}, array->length());
+  EXIT_NOT_OK(table->Validate());
+
+  for (auto _ : state) {
+    auto output = CreateOutputStream();
+    EXIT_NOT_OK(WriteTable(*table, ::arrow::default_memory_pool(), output,
+                           /*chunk_size=*/table->num_rows()));
+  }
+  state.SetItemsProcessed(num_values * state.iterations());
+  state.SetBytesProcessed(total_bytes * state.iterations());
+}
+
+static void BM_WriteStructColumn(::benchmark::State& state) {
+  constexpr int64_t kNumValues = BENCHMARK_SIZE / 10;
+  const double null_probability = static_cast<double>(state.range(0)) / 100.0;
+  const int64_t kBytesPerValue = sizeof(int32_t) + sizeof(int64_t);
+
+  ::arrow::random::RandomArrayGenerator rng(42);
+  auto array = MakeStructArray(&rng, kNumValues, null_probability);
+
+  BenchmarkWriteArray(state, array, null_probability != 0.0, kNumValues,
+                      kBytesPerValue * kNumValues);
+}
+
+BENCHMARK(BM_WriteStructColumn)->Apply(NestedReadArguments);
+
+static void BM_WriteStructOfStructColumn(::benchmark::State& state) {
+  constexpr int64_t kNumValues = BENCHMARK_SIZE / 10;
+  const double null_probability = static_cast<double>(state.range(0)) / 100.0;
+  const int64_t kBytesPerValue = 2 * (sizeof(int32_t) + sizeof(int64_t));
+
+  ::arrow::random::RandomArrayGenerator rng(42);
+  auto values1 = MakeStructArray(&rng, kNumValues, null_probability);
+  auto values2 = MakeStructArray(&rng, kNumValues, null_probability);
+  auto array = MakeStructArray(&rng, {values1, values2}, null_probability);
+
+  BenchmarkWriteArray(state, array, null_probability != 0.0, kNumValues,
+                      kBytesPerValue * kNumValues);
+}
+
+BENCHMARK(BM_WriteStructOfStructColumn)->Apply(NestedReadArguments);
+
+static void BM_WriteListColumn(::benchmark::State& state) {
+  constexpr int64_t kNumValues = BENCHMARK_SIZE / 10;
+  const double null_probability = static_cast<double>(state.range(0)) / 100.0;
+  const int64_t kBytesPerValue = sizeof(int64_t);
+
+  ::arrow::random::RandomArrayGenerator rng(42);
+  auto values = rng.Int64(kNumValues, /*min=*/-5, /*max=*/5, null_probability);
+  auto array = rng.List(*values, kNumValues / 10, null_probability);
+
+  BenchmarkWriteArray(state, array, null_probability != 0.0, kNumValues,
+                      kBytesPerValue * kNumValues);
+}
+
+BENCHMARK(BM_WriteListColumn)->Apply(NestedReadArguments);
+
+static void BM_WriteListOfStructColumn(::benchmark::State& state) {
+  constexpr int64_t kNumValues = BENCHMARK_SIZE / 10;
+  const double null_probability = static_cast<double>(state.range(0)) / 100.0;
+  const int64_t kBytesPerValue = sizeof(int32_t) + sizeof(int64_t);
+
+  ::arrow::random::RandomArrayGenerator rng(42);
+  auto values = MakeStructArray(&rng, kNumValues, null_probability);
+  auto array = rng.List(*values, kNumValues / 10, null_probability);
+
+  BenchmarkWriteArray(state, array, null_probability != 0.0, kNumValues,
+                      kBytesPerValue * kNumValues);
+}
+
+BENCHMARK(BM_WriteListOfStructColumn)->Apply(NestedReadArguments);
+
+static void BM_WriteListOfListColumn(::benchmark::State& state) {
+  constexpr int64_t kNumValues = BENCHMARK_SIZE / 10;
+  const double null_probability = static_cast<double>(state.range(0)) / 100.0;
+  const int64_t kBytesPerValue = sizeof(int64_t);
+
+  ::arrow::random::RandomArrayGenerator rng(42);
+  auto values = rng.Int64(kNumValues, /*min=*/-5, /*max=*/5, null_probability);
+  auto inner = rng.List(*values, kNumValues / 10, null_probability);
+  auto array = rng.List(*inner, kNumValues / 100, null_probability);
+
+  BenchmarkWriteArray(state, array, null_probability != 0.0, kNumValues,
+                      kBytesPerValue * kNumValues);
+}
+
+BENCHMARK(BM_WriteListOfListColumn)->Apply(NestedReadArguments);
+
 //
 // Benchmark different ways of reading select row groups
 //
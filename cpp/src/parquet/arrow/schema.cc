@@ -133,16 +133,15 @@ Status VariantToNode(const std::shared_ptr<VariantExtensionType>& type,
                      const std::string& name, bool nullable, int field_id,
                      const WriterProperties& properties,
                      const ArrowWriterProperties& arrow_properties, NodePtr* out) {
-  NodePtr metadata_node;
-  RETURN_NOT_OK(FieldToNode("metadata", type->metadata(), properties, arrow_properties,
-                            &metadata_node));
-
-  NodePtr value_node;
-  RETURN_NOT_OK(
-      FieldToNode("value", type->value(), properties, arrow_properties, &value_node));
+  // The metadata, value and/or typed_value fields, in the order of the storage type
+  const auto& storage_fields = type->storage_type()->fields();
+  std::vector<NodePtr> nodes(storage_fields.size());
+  for (size_t i = 0; i < storage_fields.size(); ++i) {
+    RETURN_NOT_OK(FieldToNode(storage_fields[i]->name(), storage_fields[i], properties,
+                              arrow_properties, &nodes[i]));
+  }
 
-  *out = GroupNode::Make(name, RepetitionFromNullable(nullable),
-                         {std::move(metadata_node), std::move(value_node)},
+  *out = GroupNode::Make(name, RepetitionFromNullable(nullable), std::move(nodes),
                          LogicalType::Variant(), field_id);
 
   return Status::OK();
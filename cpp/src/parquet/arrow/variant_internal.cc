@@ -18,12 +18,15 @@
 #include "parquet/arrow/variant_internal.h"
 
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "arrow/extension_type.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/logging_internal.h"
+#include "parquet/arrow/schema.h"
 
 namespace parquet::arrow {
 
@@ -31,23 +34,24 @@ using ::arrow::Array;
 using ::arrow::ArrayData;
 using ::arrow::DataType;
 using ::arrow::ExtensionType;
+using ::arrow::Field;
 using ::arrow::Result;
+using ::arrow::Status;
 using ::arrow::Type;
 
 VariantExtensionType::VariantExtensionType(
     const std::shared_ptr<::arrow::DataType>& storage_type)
     : ::arrow::ExtensionType(storage_type) {
-  // GH-45948: Shredded variants will need to handle an optional shredded_value as
-  // well as value_ becoming optional.
-
-  // IsSupportedStorageType should have been called already, asserting that both
-  // metadata and value are present.
-  if (storage_type->field(0)->name() == "metadata") {
-    metadata_ = storage_type->field(0);
-    value_ = storage_type->field(1);
-  } else {
-    value_ = storage_type->field(0);
-    metadata_ = storage_type->field(1);
+  // IsSupportedStorageType should have been called already, asserting that metadata
+  // and value and/or typed_value are present.
+  for (const auto& field : storage_type->fields()) {
+    if (field->name() == "metadata") {
+      metadata_ = field;
+    } else if (field->name() == "value") {
+      value_ = field;
+    } else {
+      typed_value_ = field;
+    }
   }
 }
 
@@ -81,36 +85,39 @@ bool IsBinaryField(const std::shared_ptr<::arrow::Field> field) {
 
 bool VariantExtensionType::IsSupportedStorageType(
     const std::shared_ptr<DataType>& storage_type) {
-  // For now we only supported unshredded variants. Unshredded variant storage
-  // type should be a struct with a binary metadata and binary value.
-  //
-  // GH-45948: In shredded variants, the binary value field can be replaced
-  // with one or more of the following: object, array, typed_value, and
-  // variant_value.
-  if (storage_type->id() == Type::STRUCT) {
-    if (storage_type->num_fields() == 2) {
-      // Ordering of metadata and value fields does not matter, as we will assign
-      // these to the VariantExtensionType's member shared_ptrs in the constructor.
-      // Here we just need to check that they are both present.
-
-      const auto& field0 = storage_type->field(0);
-      const auto& field1 = storage_type->field(1);
-
-      bool metadata_and_value_present =
-          (field0->name() == "metadata" && field1->name() == "value") ||
-          (field1->name() == "metadata" && field0->name() == "value");
-
-      if (metadata_and_value_present) {
-        // Both metadata and value must be non-nullable binary types for unshredded
-        // variants. This will change in GH-46948, when we will require a Visitor
-        // to traverse the structure of the variant.
-        return IsBinaryField(field0) && IsBinaryField(field1) && !field0->nullable() &&
-               !field1->nullable();
-      }
+  // The storage type should be a struct with a binary metadata, and a binary value
+  // for unshredded variants. Shredded variants also have a typed_value, of any type,
+  // in which case value may be null (where typed_value is set) or absent. Ordering of
+  // the fields does not matter, as we will assign these to the VariantExtensionType's
+  // member shared_ptrs in the constructor.
+  if (storage_type->id() != Type::STRUCT) {
+    return false;
+  }
+  std::shared_ptr<Field> metadata, value, typed_value;
+  for (const auto& field : storage_type->fields()) {
+    std::shared_ptr<Field>* slot;
+    if (field->name() == "metadata") {
+      slot = &metadata;
+    } else if (field->name() == "value") {
+      slot = &value;
+    } else if (field->name() == "typed_value") {
+      slot = &typed_value;
+    } else {
+      return false;
     }
+    if (*slot != nullptr) {
+      return false;
+    }
+    *slot = field;
   }
 
-  return false;
+  if (metadata == nullptr || !IsBinaryField(metadata) || metadata->nullable()) {
+    return false;
+  }
+  if (typed_value == nullptr) {
+    return value != nullptr && IsBinaryField(value) && !value->nullable();
+  }
+  return value == nullptr || IsBinaryField(value);
 }
 
 Result<std::shared_ptr<DataType>> VariantExtensionType::Make(
@@ -123,11 +130,67 @@ Result<std::shared_ptr<DataType>> VariantExtensionType::Make(
   return std::make_shared<VariantExtensionType>(std::move(storage_type));
 }
 
-/// NOTE: this is still experimental. GH-45948 will add shredding support, at which point
-/// we need to separate this into unshredded_variant and shredded_variant helper
-/// functions.
+/// NOTE: this is still experimental.
 std::shared_ptr<DataType> variant(std::shared_ptr<DataType> storage_type) {
   return VariantExtensionType::Make(std::move(storage_type)).ValueOrDie();
 }
 
+namespace {
+
+const SchemaField* FindChild(const SchemaField& parent, std::string_view name) {
+  for (const auto& child : parent.children) {
+    if (child.field->name() == name) {
+      return &child;
+    }
+  }
+  return nullptr;
+}
+
+// Append the leaf columns of `field`, returning whether one of them is a binary value
+bool CollectLeafColumns(const SchemaField& field, std::vector<int>* out) {
+  if (field.is_leaf()) {
+    out->push_back(field.column_index);
+    return field.field->name() == "value";
+  }
+  bool has_value = false;
+  for (const auto& child : field.children) {
+    has_value |= CollectLeafColumns(child, out);
+  }
+  return has_value;
+}
+
+}  // namespace
+
+Result<std::vector<int>> ShreddedVariantColumns(const SchemaField& variant,
+                                                const std::vector<std::string>& path) {
+  const SchemaField* metadata = FindChild(variant, "metadata");
+  if (metadata == nullptr || !metadata->is_leaf()) {
+    return Status::Invalid("Not a Variant column: ", variant.field->ToString());
+  }
+  if (path.empty()) {
+    return std::vector<int>{};
+  }
+
+  const SchemaField* shredded = &variant;
+  for (const auto& name : path) {
+    // Only the fields of objects are shredded by name
+    const SchemaField* typed_value = FindChild(*shredded, "typed_value");
+    if (typed_value == nullptr || typed_value->is_leaf() ||
+        typed_value->field->type()->id() != Type::STRUCT) {
+      return std::vector<int>{};
+    }
+    shredded = FindChild(*typed_value, name);
+    if (shredded == nullptr) {
+      return std::vector<int>{};
+    }
+  }
+
+  std::vector<int> columns;
+  if (CollectLeafColumns(*shredded, &columns)) {
+    // Binary values reference the metadata of the Variant value they belong to
+    columns.insert(columns.begin(), metadata->column_index);
+  }
+  return columns;
+}
+
 }  // namespace parquet::arrow
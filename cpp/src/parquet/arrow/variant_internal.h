@@ -19,8 +19,10 @@
 
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "arrow/extension_type.h"
+#include "arrow/result.h"
 #include "parquet/platform.h"
 
 namespace parquet::arrow {
@@ -41,6 +43,20 @@ class PARQUET_EXPORT VariantArray : public ::arrow::ExtensionArray {
 ///   required binary value;
 /// }
 ///
+/// Shredded variant representation, where the values of the fields of objects (or
+/// the values themselves) are stored in typed columns, and `value` only holds the
+/// values which don't fit the shredded type:
+/// optional group variant_name (VARIANT) {
+///   required binary metadata;
+///   optional binary value;
+///   optional group typed_value {
+///     required group field_name {
+///       optional binary value;
+///       optional int64 typed_value;
+///     }
+///   }
+/// }
+///
 /// To read more about variant encoding, see the variant encoding spec at
 /// https://github.com/apache/parquet-format/blob/master/VariantEncoding.md
 ///
@@ -71,16 +87,36 @@ class PARQUET_EXPORT VariantExtensionType : public ::arrow::ExtensionType {
 
   std::shared_ptr<::arrow::Field> metadata() const { return metadata_; }
 
+  /// \brief The binary value field, or nullptr if all values are shredded
   std::shared_ptr<::arrow::Field> value() const { return value_; }
 
+  /// \brief The shredded value field, or nullptr for unshredded variants
+  std::shared_ptr<::arrow::Field> typed_value() const { return typed_value_; }
+
  private:
-  // TODO GH-45948 added shredded_value
   std::shared_ptr<::arrow::Field> metadata_;
   std::shared_ptr<::arrow::Field> value_;
+  std::shared_ptr<::arrow::Field> typed_value_;
 };
 
 /// \brief Return a VariantExtensionType instance.
 PARQUET_EXPORT std::shared_ptr<::arrow::DataType> variant(
     std::shared_ptr<::arrow::DataType> storage_type);
 
+struct SchemaField;
+
+/// \brief Return the leaf columns needed to read the value at `path` of a shredded
+/// Variant column.
+///
+/// `variant` is the SchemaField of a Variant column and `path` a path of object
+/// field names in the Variant values. If `path` is shredded, the returned columns
+/// are the `value` and `typed_value` columns of the shredded field (and the
+/// `metadata` column if the binary `value` must be decoded), in ascending order.
+/// Reading only these columns, and pruning with the statistics of the
+/// `typed_value` columns, avoids reading and parsing the whole Variant values.
+/// An empty vector is returned if `path` is not shredded, in which case the whole
+/// Variant column must be read.
+PARQUET_EXPORT ::arrow::Result<std::vector<int>> ShreddedVariantColumns(
+    const SchemaField& variant, const std::vector<std::string>& path);
+
 }  // namespace parquet::arrow
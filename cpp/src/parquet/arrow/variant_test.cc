@@ -21,12 +21,17 @@
 #include "arrow/ipc/test_common.h"
 #include "arrow/record_batch.h"
 #include "arrow/testing/gtest_util.h"
+#include "parquet/arrow/schema.h"
 #include "parquet/exception.h"
+#include "parquet/properties.h"
+#include "parquet/schema.h"
 
 namespace parquet::arrow {
 
 using ::arrow::binary;
 using ::arrow::struct_;
+using schema::GroupNode;
+using schema::PrimitiveNode;
 
 TEST(TestVariantExtensionType, StorageTypeValidation) {
   auto variant1 = variant(struct_({field("metadata", binary(), /*nullable=*/false),
@@ -66,4 +71,105 @@ TEST(TestVariantExtensionType, StorageTypeValidation) {
   }
 }
 
+TEST(TestVariantExtensionType, ShreddedStorageTypeValidation) {
+  auto typed_value = field("typed_value", struct_({field("a", ::arrow::int64())}));
+  auto shredded = std::dynamic_pointer_cast<VariantExtensionType>(
+      variant(struct_({field("metadata", binary(), /*nullable=*/false),
+                       field("value", binary()), typed_value})));
+  ASSERT_EQ("metadata", shredded->metadata()->name());
+  ASSERT_EQ("value", shredded->value()->name());
+  ASSERT_EQ("typed_value", shredded->typed_value()->name());
+
+  // The binary value may be absent if all values are shredded
+  auto fully_shredded = std::dynamic_pointer_cast<VariantExtensionType>(
+      variant(struct_({field("metadata", binary(), /*nullable=*/false), typed_value})));
+  ASSERT_EQ(nullptr, fully_shredded->value());
+  ASSERT_EQ("typed_value", fully_shredded->typed_value()->name());
+
+  auto nullable_metadata =
+      struct_({field("metadata", binary()), field("value", binary()), typed_value});
+  auto bad_value_type = struct_({field("metadata", binary(), /*nullable=*/false),
+                                 field("value", ::arrow::int32()), typed_value});
+  auto duplicate_field = struct_({field("metadata", binary(), /*nullable=*/false),
+                                  typed_value, typed_value});
+  for (const auto& storage_type : {nullable_metadata, bad_value_type, duplicate_field}) {
+    ASSERT_RAISES(Invalid, VariantExtensionType::Make(storage_type));
+  }
+}
+
+TEST(TestShreddedVariant, ShreddedVariantColumns) {
+  // optional group event (VARIANT) {
+  //   required binary metadata;                             // column 0
+  //   optional binary value;                                // column 1
+  //   optional group typed_value {
+  //     required group user_id {
+  //       optional binary value;                            // column 2
+  //       optional int64 typed_value;                       // column 3
+  //     }
+  //     required group location {
+  //       optional binary value;                            // column 4
+  //       optional group typed_value {
+  //         required group city {
+  //           optional binary value;                        // column 5
+  //           optional binary typed_value (STRING);         // column 6
+  //         }
+  //       }
+  //     }
+  //     required group count {
+  //       optional int32 typed_value;                       // column 7
+  //     }
+  //   }
+  // }
+  // required int32 id;                                      // column 8
+  auto binary_node = [](const std::string& name, Repetition::type repetition) {
+    return PrimitiveNode::Make(name, repetition, Type::BYTE_ARRAY);
+  };
+  auto user_id = GroupNode::Make(
+      "user_id", Repetition::REQUIRED,
+      {binary_node("value", Repetition::OPTIONAL),
+       PrimitiveNode::Make("typed_value", Repetition::OPTIONAL, Type::INT64)});
+  auto city = GroupNode::Make(
+      "city", Repetition::REQUIRED,
+      {binary_node("value", Repetition::OPTIONAL),
+       PrimitiveNode::Make("typed_value", Repetition::OPTIONAL, LogicalType::String(),
+                           Type::BYTE_ARRAY)});
+  auto location = GroupNode::Make(
+      "location", Repetition::REQUIRED,
+      {binary_node("value", Repetition::OPTIONAL),
+       GroupNode::Make("typed_value", Repetition::OPTIONAL, {city})});
+  auto count = GroupNode::Make(
+      "count", Repetition::REQUIRED,
+      {PrimitiveNode::Make("typed_value", Repetition::OPTIONAL, Type::INT32)});
+  auto event = GroupNode::Make(
+      "event", Repetition::OPTIONAL,
+      {binary_node("metadata", Repetition::REQUIRED),
+       binary_node("value", Repetition::OPTIONAL),
+       GroupNode::Make("typed_value", Repetition::OPTIONAL, {user_id, location, count})},
+      LogicalType::Variant());
+  auto id = PrimitiveNode::Make("id", Repetition::REQUIRED, Type::INT32);
+
+  SchemaDescriptor descr;
+  descr.Init(GroupNode::Make("schema", Repetition::REQUIRED, {event, id}));
+  SchemaManifest manifest;
+  ASSERT_OK(SchemaManifest::Make(&descr, /*metadata=*/nullptr,
+                                 default_arrow_reader_properties(), &manifest));
+  const SchemaField& variant_field = manifest.schema_fields[0];
+
+  auto columns = [&](const std::vector<std::string>& path) {
+    EXPECT_OK_AND_ASSIGN(auto columns, ShreddedVariantColumns(variant_field, path));
+    return columns;
+  };
+  ASSERT_EQ(columns({"user_id"}), std::vector<int>({0, 2, 3}));
+  ASSERT_EQ(columns({"location"}), std::vector<int>({0, 4, 5, 6}));
+  ASSERT_EQ(columns({"location", "city"}), std::vector<int>({0, 5, 6}));
+  // Fully shredded: the metadata isn't needed
+  ASSERT_EQ(columns({"count"}), std::vector<int>({7}));
+  // Not shredded
+  ASSERT_EQ(columns({}), std::vector<int>());
+  ASSERT_EQ(columns({"session"}), std::vector<int>());
+  ASSERT_EQ(columns({"user_id", "name"}), std::vector<int>());
+
+  ASSERT_RAISES(Invalid, ShreddedVariantColumns(manifest.schema_fields[1], {"a"}));
+}
+
 }  // namespace parquet::arrow
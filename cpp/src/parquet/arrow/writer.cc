@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <deque>
+#include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -406,6 +407,16 @@ class FileWriterImpl : public FileWriter {
     }
 
     auto WriteRowGroup = [&](int64_t offset, int64_t size) {
+      if (arrow_properties_->use_threads()) {
+        // Buffer the row group so that its columns can be encoded in parallel
+        RETURN_NOT_OK(NewBufferedRowGroup());
+        RETURN_NOT_OK(WriteBufferedColumns(table.columns(), offset, size));
+        // Close the row group now so that later calls to WriteRecordBatch() start
+        // a new one, as they do after an unbuffered row group
+        PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+        row_group_writer_ = nullptr;
+        return Status::OK();
+      }
       RETURN_NOT_OK(NewRowGroup());
       for (int i = 0; i < table.num_columns(); i++) {
         RETURN_NOT_OK(WriteColumnChunk(table.column(i), offset, size));
@@ -447,50 +458,26 @@ class FileWriterImpl : public FileWriter {
 
     // Initialize a new buffered row group writer if necessary.
     if (row_group_writer_ == nullptr || !row_group_writer_->buffered() ||
-        row_group_writer_->num_rows() >= max_row_group_length) {
+        BufferedRowGroupFull()) {
       RETURN_NOT_OK(NewBufferedRowGroup());
     }
 
-    auto WriteBatch = [&](int64_t offset, int64_t size) {
-      std::vector<std::unique_ptr<ArrowColumnWriterV2>> writers;
-      int column_index_start = 0;
-
-      for (int i = 0; i < batch.num_columns(); i++) {
-        ChunkedArray chunked_array{batch.column(i)};
-        ARROW_ASSIGN_OR_RAISE(
-            std::unique_ptr<ArrowColumnWriterV2> writer,
-            ArrowColumnWriterV2::Make(chunked_array, offset, size, schema_manifest_,
-                                      row_group_writer_, column_index_start));
-        column_index_start += writer->leaf_count();
-        if (arrow_properties_->use_threads()) {
-          writers.emplace_back(std::move(writer));
-        } else {
-          RETURN_NOT_OK(writer->Write(&column_write_context_));
-        }
-      }
-
-      if (arrow_properties_->use_threads()) {
-        DCHECK_EQ(parallel_column_write_contexts_.size(), writers.size());
-        RETURN_NOT_OK(::arrow::internal::ParallelFor(
-            static_cast<int>(writers.size()),
-            [&](int i) { return writers[i]->Write(&parallel_column_write_contexts_[i]); },
-            arrow_properties_->executor()));
-      }
-
-      return Status::OK();
-    };
+    std::vector<std::shared_ptr<ChunkedArray>> columns;
+    columns.reserve(batch.num_columns());
+    for (int i = 0; i < batch.num_columns(); i++) {
+      columns.push_back(std::make_shared<ChunkedArray>(batch.column(i)));
+    }
 
     int64_t offset = 0;
     while (offset < batch.num_rows()) {
       const int64_t batch_size =
-          std::min(max_row_group_length - row_group_writer_->num_rows(),
-                   batch.num_rows() - offset);
-      RETURN_NOT_OK(WriteBatch(offset, batch_size));
+          std::min({max_row_group_length - row_group_writer_->num_rows(),
+                    BufferedRowGroupRemainingRows(), batch.num_rows() - offset});
+      RETURN_NOT_OK(WriteBufferedColumns(columns, offset, batch_size));
       offset += batch_size;
 
       // Flush current row group writer and create a new writer if it is full.
-      if (row_group_writer_->num_rows() >= max_row_group_length &&
-          offset < batch.num_rows()) {
+      if (BufferedRowGroupFull() && offset < batch.num_rows()) {
         RETURN_NOT_OK(NewBufferedRowGroup());
       }
     }
@@ -519,6 +506,60 @@ class FileWriterImpl : public FileWriter {
  private:
   friend class FileWriter;
 
+  bool BufferedRowGroupFull() const {
+    return row_group_writer_->num_rows() >= properties().max_row_group_length() ||
+           row_group_writer_->total_buffered_bytes() >=
+               properties().max_buffered_row_group_bytes();
+  }
+
+  // Estimate how many more rows fit in the current buffered row group before it
+  // holds max_buffered_row_group_bytes, from the size of the rows already buffered.
+  int64_t BufferedRowGroupRemainingRows() const {
+    const int64_t num_rows = row_group_writer_->num_rows();
+    const int64_t buffered_bytes = row_group_writer_->total_buffered_bytes();
+    if (num_rows == 0 || buffered_bytes == 0) {
+      return std::numeric_limits<int64_t>::max();
+    }
+    const int64_t bytes_per_row = buffered_bytes / num_rows + 1;
+    const int64_t remaining_bytes =
+        properties().max_buffered_row_group_bytes() - buffered_bytes;
+    // Always make progress
+    return std::max<int64_t>(1, remaining_bytes / bytes_per_row);
+  }
+
+  // Write a slice of all columns to the current buffered row group. If
+  // arrow_properties_->use_threads() is true, the columns are encoded and compressed
+  // in parallel: their pages are kept in memory until the row group is closed, and
+  // then serialized in schema order.
+  Status WriteBufferedColumns(const std::vector<std::shared_ptr<ChunkedArray>>& columns,
+                              int64_t offset, int64_t size) {
+    std::vector<std::unique_ptr<ArrowColumnWriterV2>> writers;
+    int column_index_start = 0;
+
+    for (const auto& column : columns) {
+      ARROW_ASSIGN_OR_RAISE(
+          std::unique_ptr<ArrowColumnWriterV2> writer,
+          ArrowColumnWriterV2::Make(*column, offset, size, schema_manifest_,
+                                    row_group_writer_, column_index_start));
+      column_index_start += writer->leaf_count();
+      if (arrow_properties_->use_threads()) {
+        writers.emplace_back(std::move(writer));
+      } else {
+        RETURN_NOT_OK(writer->Write(&column_write_context_));
+      }
+    }
+
+    if (arrow_properties_->use_threads()) {
+      DCHECK_EQ(parallel_column_write_contexts_.size(), writers.size());
+      RETURN_NOT_OK(::arrow::internal::ParallelFor(
+          static_cast<int>(writers.size()),
+          [&](int i) { return writers[i]->Write(&parallel_column_write_contexts_[i]); },
+          arrow_properties_->executor()));
+    }
+
+    return Status::OK();
+  }
+
   std::shared_ptr<::arrow::Schema> schema_;
 
   SchemaManifest schema_manifest_;
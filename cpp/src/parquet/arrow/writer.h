@@ -81,6 +81,10 @@ class PARQUET_EXPORT FileWriter {
   ///
   /// \param table Arrow table to write.
   /// \param chunk_size maximum number of rows to write per row group.
+  ///
+  /// If ArrowWriterProperties::use_threads is true, the columns of each row
+  /// group are encoded in parallel and buffered in memory until the row group
+  /// is complete. The same deadlock warning as WriteRecordBatch() applies.
   virtual ::arrow::Status WriteTable(
       const ::arrow::Table& table, int64_t chunk_size = DEFAULT_MAX_ROW_GROUP_LENGTH) = 0;
 
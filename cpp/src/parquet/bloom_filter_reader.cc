@@ -16,6 +16,8 @@
 // under the License.
 
 #include "parquet/bloom_filter_reader.h"
+
+#include "arrow/io/memory.h"
 #include "parquet/bloom_filter.h"
 #include "parquet/exception.h"
 #include "parquet/metadata.h"
@@ -24,12 +26,15 @@ namespace parquet {
 
 class RowGroupBloomFilterReaderImpl final : public RowGroupBloomFilterReader {
  public:
-  RowGroupBloomFilterReaderImpl(std::shared_ptr<::arrow::io::RandomAccessFile> input,
-                                std::shared_ptr<RowGroupMetaData> row_group_metadata,
-                                const ReaderProperties& properties)
+  RowGroupBloomFilterReaderImpl(
+      std::shared_ptr<::arrow::io::RandomAccessFile> input,
+      std::shared_ptr<RowGroupMetaData> row_group_metadata,
+      const ReaderProperties& properties,
+      std::shared_ptr<::arrow::io::internal::ReadRangeCache> cache)
       : input_(std::move(input)),
         row_group_metadata_(std::move(row_group_metadata)),
-        properties_(properties) {}
+        properties_(properties),
+        cache_(std::move(cache)) {}
 
   std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) override;
 
@@ -42,6 +47,9 @@ class RowGroupBloomFilterReaderImpl final : public RowGroupBloomFilterReader {
 
   /// Reader properties used to deserialize thrift object.
   const ReaderProperties& properties_;
+
+  /// Cache of the bloom filters requested by BloomFilterReader::WillNeed(), if any.
+  std::shared_ptr<::arrow::io::internal::ReadRangeCache> cache_;
 };
 
 std::unique_ptr<BloomFilter> RowGroupBloomFilterReaderImpl::GetColumnBloomFilter(int i) {
@@ -76,6 +84,16 @@ std::unique_ptr<BloomFilter> RowGroupBloomFilterReaderImpl::GetColumnBloomFilter
           "bloom filter length + bloom filter offset greater than file size");
     }
   }
+  if (cache_ != nullptr && bloom_filter_length.has_value()) {
+    auto maybe_buffer = cache_->Read({*bloom_filter_offset, *bloom_filter_length});
+    if (maybe_buffer.ok()) {
+      ::arrow::io::BufferReader stream(std::move(maybe_buffer).ValueUnsafe());
+      auto bloom_filter =
+          BlockSplitBloomFilter::Deserialize(properties_, &stream, bloom_filter_length);
+      return std::make_unique<BlockSplitBloomFilter>(std::move(bloom_filter));
+    }
+    // Not requested by WillNeed(), read it directly below
+  }
   auto stream = ::arrow::io::RandomAccessFile::GetStream(
       input_, *bloom_filter_offset, file_size - *bloom_filter_offset);
   auto bloom_filter =
@@ -97,14 +115,40 @@ class BloomFilterReaderImpl final : public BloomFilterReader {
     }
   }
 
-  std::shared_ptr<RowGroupBloomFilterReader> RowGroup(int i) {
+  std::shared_ptr<RowGroupBloomFilterReader> RowGroup(int i) override {
     if (i < 0 || i >= file_metadata_->num_row_groups()) {
       throw ParquetException("Invalid row group ordinal: ", i);
     }
 
     auto row_group_metadata = file_metadata_->RowGroup(i);
     return std::make_shared<RowGroupBloomFilterReaderImpl>(
-        input_, std::move(row_group_metadata), properties_);
+        input_, std::move(row_group_metadata), properties_, cache_);
+  }
+
+  void WillNeed(const std::vector<int>& row_group_indices,
+                const std::vector<int>& column_indices, const ::arrow::io::IOContext& ctx,
+                const ::arrow::io::CacheOptions& options) override {
+    std::vector<::arrow::io::ReadRange> read_ranges;
+    for (int row_group : row_group_indices) {
+      auto row_group_metadata = file_metadata_->RowGroup(row_group);
+      for (int column : column_indices) {
+        auto col_chunk = row_group_metadata->ColumnChunk(column);
+        auto bloom_filter_offset = col_chunk->bloom_filter_offset();
+        auto bloom_filter_length = col_chunk->bloom_filter_length();
+        if (bloom_filter_offset.has_value() && bloom_filter_length.has_value() &&
+            *bloom_filter_offset >= 0 && *bloom_filter_length > 0) {
+          read_ranges.push_back({*bloom_filter_offset, *bloom_filter_length});
+        }
+      }
+    }
+    if (read_ranges.empty()) {
+      return;
+    }
+    if (cache_ == nullptr) {
+      cache_ = std::make_shared<::arrow::io::internal::ReadRangeCache>(input_, ctx,
+                                                                       options);
+    }
+    PARQUET_THROW_NOT_OK(cache_->Cache(std::move(read_ranges)));
   }
 
  private:
@@ -116,6 +160,9 @@ class BloomFilterReaderImpl final : public BloomFilterReader {
 
   /// Reader properties used to deserialize thrift object.
   const ReaderProperties& properties_;
+
+  /// Coalescing cache of the bloom filters requested by WillNeed().
+  std::shared_ptr<::arrow::io::internal::ReadRangeCache> cache_;
 };
 
 std::unique_ptr<BloomFilterReader> BloomFilterReader::Make(
@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <vector>
+
+#include "arrow/io/caching.h"
 #include "arrow/io/interfaces.h"
 #include "parquet/properties.h"
 #include "parquet/type_fwd.h"
@@ -63,6 +66,25 @@ class PARQUET_EXPORT BloomFilterReader {
   ///          to the RowGroupBloomFilterReader.
   /// \throws ParquetException if the index is out of bound.
   virtual std::shared_ptr<RowGroupBloomFilterReader> RowGroup(int i) = 0;
+
+  /// \brief Advise the reader which bloom filters will be read later.
+  ///
+  /// The bloom filters of the specified columns in the specified row groups are
+  /// cached with coalesced reads, so follow-up calls to GetColumnBloomFilter() for
+  /// them don't issue one small read each. With lazy cache options, nothing is read
+  /// until one of the cached bloom filters is first accessed.
+  ///
+  /// Bloom filters whose length is not recorded in the file metadata can't be cached
+  /// and are still read on demand.
+  ///
+  /// \param[in] row_group_indices list of row group ordinals to read bloom filters from.
+  /// \param[in] column_indices list of column ordinals to read bloom filters from.
+  /// \param[in] ctx the IO context used for the cached reads.
+  /// \param[in] options the options controlling coalescing of the cached reads.
+  virtual void WillNeed(const std::vector<int>& row_group_indices,
+                        const std::vector<int>& column_indices,
+                        const ::arrow::io::IOContext& ctx,
+                        const ::arrow::io::CacheOptions& options) = 0;
 };
 
 }  // namespace parquet
@@ -68,6 +68,26 @@ TEST(BloomFilterReader, ReadBloomFilter) {
   }
 }
 
+TEST(BloomFilterReader, WillNeed) {
+  std::vector<std::string> files = {"data_index_bloom_encoding_stats.parquet",
+                                    "data_index_bloom_encoding_with_length.parquet"};
+  for (const auto& test_file : files) {
+    ARROW_SCOPED_TRACE("test_file=", test_file);
+    std::string path = std::string(get_data_dir()) + "/" + test_file;
+    auto reader = ParquetFileReader::OpenFile(path, /*memory_map=*/false);
+    auto& bloom_filter_reader = reader->GetBloomFilterReader();
+    // Bloom filters without a recorded length are still read on demand
+    bloom_filter_reader.WillNeed({0}, {0}, ::arrow::io::default_io_context(),
+                                 ::arrow::io::CacheOptions::LazyDefaults());
+    auto bloom_filter = bloom_filter_reader.RowGroup(0)->GetColumnBloomFilter(0);
+    ASSERT_NE(nullptr, bloom_filter);
+    ByteArray exists{std::string_view("Hello")};
+    EXPECT_TRUE(bloom_filter->FindHash(bloom_filter->Hash(&exists)));
+    ByteArray not_exists{std::string_view("NOT_EXISTS")};
+    EXPECT_FALSE(bloom_filter->FindHash(bloom_filter->Hash(&not_exists)));
+  }
+}
+
 TEST(BloomFilterReader, FileNotHaveBloomFilter) {
   // Can still get a BloomFilterReader and a RowGroupBloomFilter
   // reader, but cannot get a non-null BloomFilter.
@@ -17,6 +17,7 @@
 
 #include "parquet/chunker_internal.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <iterator>
 #include <string>
@@ -103,6 +104,89 @@ uint64_t CalculateMask(int64_t min_chunk_size, int64_t max_chunk_size, int norm_
   }
 }
 
+/// Roll the gearhash `*hash` over `data[0, length)` without checking it against a
+/// mask.
+inline void GearhashRollUnchecked(const uint64_t* table, const uint8_t* data,
+                                  int64_t length, uint64_t* hash) {
+  uint64_t h = *hash;
+  for (int64_t i = 0; i < length; ++i) {
+    h = (h << 1) + table[data[i]];
+  }
+  *hash = h;
+}
+
+/// The serial version of GearhashRoll()
+int64_t GearhashRollSerial(const uint64_t* table, uint64_t mask, const uint8_t* data,
+                           int64_t length, uint64_t* hash) {
+  uint64_t h = *hash;
+  for (int64_t i = 0; i < length; ++i) {
+    h = (h << 1) + table[data[i]];
+    if (ARROW_PREDICT_FALSE((h & mask) == 0)) {
+      *hash = h;
+      return i + 1;
+    }
+  }
+  *hash = h;
+  return -1;
+}
+
+/// Roll the gearhash `*hash` over `data[0, length)` using `table`, stopping at the
+/// first byte after which the hash matches `mask`. Return the number of bytes rolled
+/// if the hash matched, -1 otherwise.
+///
+/// Since each byte is shifted out of the hash after 64 more bytes, the hash at any
+/// position only depends on the 64 preceding bytes. This allows rolling blocks of
+/// data as kNumLanes independent lanes, each lane but the first starting from the
+/// hash of the 64 bytes preceding it, which breaks the dependency chain of the hash
+/// and lets the table lookups of the lanes overlap. A block where a lane matched is
+/// rolled again serially to find the first match.
+int64_t GearhashRoll(const uint64_t* table, uint64_t mask, const uint8_t* data,
+                     int64_t length, uint64_t* hash) {
+  constexpr int kNumLanes = 4;
+  constexpr int64_t kLaneSize = 256;
+  constexpr int64_t kBlockSize = kNumLanes * kLaneSize;
+  constexpr int64_t kWindowSize = 64;
+
+  uint64_t h0 = *hash;
+  int64_t position = 0;
+  for (; length - position >= kBlockSize; position += kBlockSize) {
+    const uint8_t* lane0 = data + position;
+    const uint8_t* lane1 = lane0 + kLaneSize;
+    const uint8_t* lane2 = lane1 + kLaneSize;
+    const uint8_t* lane3 = lane2 + kLaneSize;
+    uint64_t h1 = 0, h2 = 0, h3 = 0;
+    for (int64_t i = -kWindowSize; i < 0; ++i) {
+      h1 = (h1 << 1) + table[lane1[i]];
+      h2 = (h2 << 1) + table[lane2[i]];
+      h3 = (h3 << 1) + table[lane3[i]];
+    }
+    const uint64_t block_hash = h0;
+    bool matched = false;
+    for (int64_t i = 0; i < kLaneSize; ++i) {
+      h0 = (h0 << 1) + table[lane0[i]];
+      h1 = (h1 << 1) + table[lane1[i]];
+      h2 = (h2 << 1) + table[lane2[i]];
+      h3 = (h3 << 1) + table[lane3[i]];
+      if (ARROW_PREDICT_FALSE(((h0 & mask) == 0) | ((h1 & mask) == 0) |
+                              ((h2 & mask) == 0) | ((h3 & mask) == 0))) {
+        matched = true;
+        break;
+      }
+    }
+    if (ARROW_PREDICT_FALSE(matched)) {
+      h0 = block_hash;
+      const int64_t rolled = GearhashRollSerial(table, mask, lane0, kBlockSize, &h0);
+      *hash = h0;
+      return position + rolled;
+    }
+    h0 = h3;
+  }
+  const int64_t rolled =
+      GearhashRollSerial(table, mask, data + position, length - position, &h0);
+  *hash = h0;
+  return rolled < 0 ? rolled : position + rolled;
+}
+
 }  // namespace
 
 class ContentDefinedChunker::Impl {
@@ -138,10 +222,7 @@ class ContentDefinedChunker::Impl {
       // chunking process since the gearhash doesn't need to be updated
       return;
     }
-    for (size_t i = 0; i < kByteWidth; ++i) {
-      rolling_hash_ = (rolling_hash_ << 1) + kGearhashTable[nth_run_][value[i]];
-      has_matched_ = has_matched_ || ((rolling_hash_ & rolling_hash_mask_) == 0);
-    }
+    RollBytes(value, kByteWidth);
   }
 
   template <typename T>
@@ -158,10 +239,21 @@ class ContentDefinedChunker::Impl {
       // chunking process since the gearhash doesn't need to be updated
       return;
     }
-    for (auto i = 0; i < length; ++i) {
-      rolling_hash_ = (rolling_hash_ << 1) + kGearhashTable[nth_run_][value[i]];
-      has_matched_ = has_matched_ || ((rolling_hash_ & rolling_hash_mask_) == 0);
+    RollBytes(value, length);
+  }
+
+  void RollBytes(const uint8_t* value, int64_t length) {
+    // The state is kept in locals, as the stores to the members couldn't be elided
+    // otherwise: `value` may alias them
+    const uint64_t* table = kGearhashTable[nth_run_];
+    uint64_t hash = rolling_hash_;
+    bool matched = false;
+    for (int64_t i = 0; i < length; ++i) {
+      hash = (hash << 1) + table[value[i]];
+      matched |= (hash & rolling_hash_mask_) == 0;
     }
+    rolling_hash_ = hash;
+    has_matched_ = has_matched_ || matched;
   }
 
   bool NeedNewChunk() {
@@ -316,6 +408,95 @@ class ContentDefinedChunker::Impl {
     return chunks;
   }
 
+  template <typename ByteOffsetFunc>
+  std::vector<Chunk> CalculateContiguous(const uint8_t* data, int64_t num_values,
+                                         const ByteOffsetFunc& ByteOffset) {
+    // Calculate the chunk boundaries for values without levels whose bytes are
+    // contiguous, value `i` spanning the bytes [ByteOffset(i), ByteOffset(i + 1)) of
+    // `data`.
+    //
+    // This produces the same chunks and state as Calculate() would, but rather than
+    // rolling the values one by one, the values which don't reach the minimum chunk
+    // size are skipped at once, then the bytes of the following values are rolled in
+    // bulk until the hash matches or the maximum chunk size is reached.
+    std::vector<Chunk> chunks;
+    int64_t prev_offset = 0;
+    int64_t offset = 0;
+
+    // The first value from `offset` after which the chunk size reaches `size`, or
+    // `num_values` if none does
+    auto find_value_reaching = [&](int64_t size) {
+      const int64_t base = ByteOffset(offset) - chunk_size_;
+      int64_t lo = offset;
+      int64_t hi = num_values;
+      while (lo < hi) {
+        const int64_t mid = lo + (hi - lo) / 2;
+        if (ByteOffset(mid + 1) - base >= size) {
+          hi = mid;
+        } else {
+          lo = mid + 1;
+        }
+      }
+      return lo;
+    };
+
+    while (offset < num_values) {
+      const int64_t first = find_value_reaching(min_chunk_size_);
+      if (first == num_values) {
+        chunk_size_ += ByteOffset(num_values) - ByteOffset(offset);
+        break;
+      }
+      const int64_t last = std::min(find_value_reaching(max_chunk_size_), num_values - 1);
+      const int64_t begin = ByteOffset(first);
+      const int64_t end = ByteOffset(last + 1);
+      const uint64_t* table = kGearhashTable[nth_run_];
+      const int64_t rolled = GearhashRoll(table, rolling_hash_mask_, data + begin,
+                                          end - begin, &rolling_hash_);
+
+      int64_t value = last;
+      if (rolled >= 0) {
+        // Find the value of the byte which matched, and roll the rest of it
+        has_matched_ = true;
+        const int64_t position = begin + rolled - 1;
+        int64_t lo = first;
+        int64_t hi = last;
+        while (lo < hi) {
+          const int64_t mid = lo + (hi - lo) / 2;
+          if (ByteOffset(mid + 1) > position) {
+            hi = mid;
+          } else {
+            lo = mid + 1;
+          }
+        }
+        value = lo;
+        const int64_t value_end = ByteOffset(value + 1);
+        GearhashRollUnchecked(table, data + begin + rolled, value_end - begin - rolled,
+                              &rolling_hash_);
+      }
+      chunk_size_ += ByteOffset(value + 1) - ByteOffset(offset);
+      offset = value + 1;
+
+      if (NeedNewChunk()) {
+        chunks.push_back({prev_offset, prev_offset, value - prev_offset});
+        prev_offset = value;
+      }
+    }
+
+    // add the last chunk if we have any levels left
+    if (prev_offset < num_values) {
+      chunks.push_back({prev_offset, prev_offset, num_values - prev_offset});
+    }
+#ifndef NDEBUG
+    ValidateChunks(chunks, num_values);
+#endif
+
+    return chunks;
+  }
+
+  bool HasLevels() const {
+    return level_info_.def_level > 0 || level_info_.rep_level > 0;
+  }
+
   template <int kByteWidth>
   std::vector<Chunk> CalculateFixedWidth(const int16_t* def_levels,
                                          const int16_t* rep_levels, int64_t num_levels,
@@ -323,6 +504,10 @@ class ContentDefinedChunker::Impl {
     const uint8_t* raw_values =
         values.data()->GetValues<uint8_t>(/*i=*/1, /*absolute_offset=*/0) +
         values.offset() * kByteWidth;
+    if (!HasLevels()) {
+      return CalculateContiguous(raw_values, num_levels,
+                                 [](int64_t i) { return i * kByteWidth; });
+    }
     return Calculate(def_levels, rep_levels, num_levels, [&](int64_t i) {
       return Roll<kByteWidth>(&raw_values[i * kByteWidth]);
     });
@@ -333,6 +518,12 @@ class ContentDefinedChunker::Impl {
                                          const int16_t* rep_levels, int64_t num_levels,
                                          const ::arrow::Array& values) {
     const auto& array = checked_cast<const ArrayType&>(values);
+    if (!HasLevels()) {
+      const auto* offsets = array.raw_value_offsets();
+      return CalculateContiguous(
+          array.raw_data(), num_levels,
+          [offsets](int64_t i) { return static_cast<int64_t>(offsets[i]); });
+    }
     return Calculate(def_levels, rep_levels, num_levels, [&](int64_t i) {
       typename ArrayType::offset_type length;
       const uint8_t* value = array.GetValue(i, &length);
@@ -353,6 +544,11 @@ class ContentDefinedChunker::Impl {
       } else if constexpr (ArrowType::type_id == ::arrow::Type::FIXED_SIZE_BINARY) {
         const auto& array = static_cast<const ::arrow::FixedSizeBinaryArray&>(values);
         const auto byte_width = array.byte_width();
+        if (!HasLevels()) {
+          return CalculateContiguous(array.GetValue(0), num_levels, [&](int64_t i) {
+            return i * static_cast<int64_t>(byte_width);
+          });
+        }
         return Calculate(def_levels, rep_levels, num_levels,
                          [&](int64_t i) { Roll(array.GetValue(i), byte_width); });
       } else if constexpr (ArrowType::type_id == ::arrow::Type::EXTENSION) {
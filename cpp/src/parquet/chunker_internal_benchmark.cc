@@ -0,0 +1,80 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "parquet/chunker_internal.h"
+#include "parquet/level_conversion.h"
+
+namespace parquet {
+
+using internal::ContentDefinedChunker;
+using internal::LevelInfo;
+
+namespace benchmarks {
+
+namespace {
+
+constexpr int64_t kNumValues = 1 << 20;
+constexpr int64_t kMinChunkSize = 256 * 1024;
+constexpr int64_t kMaxChunkSize = 1024 * 1024;
+
+}  // namespace
+
+static void ChunkerGetChunks(::benchmark::State& state,
+                             const std::shared_ptr<::arrow::DataType>& type,
+                             double null_probability) {
+  ::arrow::random::RandomArrayGenerator rag(42);
+  auto values = rag.ArrayOf(type, kNumValues, null_probability);
+
+  LevelInfo level_info;
+  std::vector<int16_t> def_levels;
+  if (null_probability > 0) {
+    level_info.def_level = 1;
+    def_levels.resize(kNumValues);
+    for (int64_t i = 0; i < kNumValues; ++i) {
+      def_levels[i] = values->IsValid(i) ? 1 : 0;
+    }
+  }
+
+  for (auto _ : state) {
+    ContentDefinedChunker chunker(level_info, kMinChunkSize, kMaxChunkSize);
+    auto chunks = chunker.GetChunks(def_levels.empty() ? nullptr : def_levels.data(),
+                                    /*rep_levels=*/nullptr, kNumValues, *values);
+    ::benchmark::DoNotOptimize(chunks);
+  }
+  state.SetItemsProcessed(state.iterations() * kNumValues);
+}
+
+BENCHMARK_CAPTURE(ChunkerGetChunks, Int8, ::arrow::int8(), 0.0);
+BENCHMARK_CAPTURE(ChunkerGetChunks, Int32, ::arrow::int32(), 0.0);
+BENCHMARK_CAPTURE(ChunkerGetChunks, Int64, ::arrow::int64(), 0.0);
+BENCHMARK_CAPTURE(ChunkerGetChunks, Int64Nullable, ::arrow::int64(), 0.1);
+BENCHMARK_CAPTURE(ChunkerGetChunks, FixedSizeBinary, ::arrow::fixed_size_binary(16),
+                  0.0);
+BENCHMARK_CAPTURE(ChunkerGetChunks, String, ::arrow::utf8(), 0.0);
+
+}  // namespace benchmarks
+
+}  // namespace parquet
@@ -18,11 +18,15 @@
 #include "parquet/column_reader.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <exception>
+#include <functional>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -38,12 +42,16 @@
 #include "arrow/type.h"
 #include "arrow/util/bit_stream_utils_internal.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/buffer_pool.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/crc32.h"
+#include "arrow/util/future.h"
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/metrics.h"
 #include "arrow/util/rle_encoding_internal.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/unreachable.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
@@ -62,7 +70,9 @@
 #  pragma warning(disable : 4250)
 #endif
 
+using arrow::Future;
 using arrow::MemoryPool;
+using arrow::Result;
 using arrow::internal::AddWithOverflow;
 using arrow::internal::checked_cast;
 using arrow::internal::MultiplyWithOverflow;
@@ -81,6 +91,18 @@ constexpr int64_t kMinLevelBatchSize = 1024;
 // Both RecordReader and the ColumnReader use this for skipping.
 constexpr int64_t kSkipScratchBatchSize = 1024;
 
+arrow::util::Counter* PagesDecodedCounter() {
+  static arrow::util::Counter* counter =
+      arrow::util::MetricsRegistry::Global()->GetCounter("parquet.pages_decoded");
+  return counter;
+}
+
+arrow::util::Counter* PagesSkippedCounter() {
+  static arrow::util::Counter* counter =
+      arrow::util::MetricsRegistry::Global()->GetCounter("parquet.pages_skipped");
+  return counter;
+}
+
 // Throws exception if number_decoded does not match expected.
 inline void CheckNumberDecoded(int64_t number_decoded, int64_t expected) {
   if (ARROW_PREDICT_FALSE(number_decoded != expected)) {
@@ -214,6 +236,97 @@ void CheckNumValuesInHeader(int num_values) {
   }
 }
 
+void VerifyPageChecksum(const Buffer& page_buffer, int compressed_len, int32_t crc,
+                        int32_t page_ordinal) {
+  uint32_t checksum =
+      ::arrow::internal::crc32(/* prev */ 0, page_buffer.data(), compressed_len);
+  if (static_cast<int32_t>(checksum) != crc) {
+    throw ParquetException(
+        "could not verify page integrity, CRC checksum verification failed for "
+        "page_ordinal " +
+        std::to_string(page_ordinal));
+  }
+}
+
+// Decompresses a page into `out`. The first `levels_byte_len` bytes of the page
+// are levels stored uncompressed (DataPageV2 only) and are copied as-is.
+void DecompressPage(::arrow::util::Codec* decompressor, const Buffer& page_buffer,
+                    int compressed_len, int uncompressed_len, int levels_byte_len,
+                    ResizableBuffer* out) {
+  if (compressed_len < levels_byte_len || uncompressed_len < levels_byte_len) {
+    throw ParquetException("Invalid page header");
+  }
+
+  // Grow the uncompressed buffer if we need to.
+  PARQUET_THROW_NOT_OK(out->Resize(uncompressed_len, /*shrink_to_fit=*/false));
+
+  if (levels_byte_len > 0) {
+    // First copy the levels as-is
+    uint8_t* decompressed = out->mutable_data();
+    memcpy(decompressed, page_buffer.data(), levels_byte_len);
+  }
+
+  // GH-31992: DataPageV2 may store only levels and no values when all
+  // values are null. In this case, Parquet java is known to produce a
+  // 0-len compressed area (which is invalid compressed input).
+  // See https://github.com/apache/parquet-java/issues/3122
+  int64_t decompressed_len = 0;
+  if (uncompressed_len - levels_byte_len != 0) {
+    // Decompress the values
+    PARQUET_ASSIGN_OR_THROW(
+        decompressed_len,
+        decompressor->Decompress(compressed_len - levels_byte_len,
+                                 page_buffer.data() + levels_byte_len,
+                                 uncompressed_len - levels_byte_len,
+                                 out->mutable_data() + levels_byte_len));
+  }
+
+  if (decompressed_len != uncompressed_len - levels_byte_len) {
+    throw ParquetException("Page didn't decompress to expected size, expected: " +
+                           std::to_string(uncompressed_len - levels_byte_len) +
+                           ", but got:" + std::to_string(decompressed_len));
+  }
+}
+
+// Decryption and decompression of a page read ahead by a SerializedPageReader.
+//
+// The task is spawned on the CPU thread pool, but the reader runs it itself if it
+// needs the page before a pool thread picked it up. Readers running on the thread
+// pool thus never block on tasks queued behind them.
+class PageDecompressionTask {
+ public:
+  using Function = std::function<Result<std::shared_ptr<Buffer>>()>;
+
+  explicit PageDecompressionTask(Function fn)
+      : fn_(std::move(fn)), future_(Future<std::shared_ptr<Buffer>>::Make()) {}
+
+  void Run() {
+    if (started_.exchange(true)) {
+      return;
+    }
+    Function fn = std::move(fn_);
+    future_.MarkFinished(fn());
+  }
+
+  // Return the page data, running the task on this thread if needed
+  Result<std::shared_ptr<Buffer>> Wait() {
+    Run();
+    return future_.MoveResult();
+  }
+
+  // Skip the task if it did not start yet, otherwise wait for it to finish
+  void Discard() {
+    if (started_.exchange(true)) {
+      future_.Wait();
+    }
+  }
+
+ private:
+  Function fn_;
+  std::atomic<bool> started_{false};
+  Future<std::shared_ptr<Buffer>> future_;
+};
+
 // ----------------------------------------------------------------------
 // SerializedPageReader deserializes Thrift metadata and pages that have been
 // assembled in a serialized stream for storing in a Parquet files
@@ -224,11 +337,17 @@ void CheckNumValuesInHeader(int num_values) {
 class SerializedPageReader : public PageReader {
  public:
   SerializedPageReader(std::shared_ptr<ArrowInputStream> stream, int64_t total_num_values,
-                       Compression::type codec, const ReaderProperties& properties,
+                       Compression::type codec,
+                       std::shared_ptr<const CodecOptions> codec_options,
+                       const ReaderProperties& properties,
                        const CryptoContext* crypto_ctx, bool always_compressed)
       : properties_(properties),
         stream_(std::move(stream)),
+        codec_(codec),
+        codec_options_(codec_options ? std::move(codec_options)
+                                     : std::make_shared<const CodecOptions>()),
         decompression_buffer_(AllocateBuffer(properties_.memory_pool(), 0)),
+        buffer_pool_(::arrow::util::BufferPool::Make(properties_.memory_pool())),
         page_ordinal_(0),
         seen_num_values_(0),
         total_num_values_(total_num_values) {
@@ -237,21 +356,62 @@ class SerializedPageReader : public PageReader {
       InitDecryption();
     }
     max_page_header_size_ = kDefaultMaxPageHeaderSize;
-    decompressor_ = GetCodec(codec);
+    decompressor_ = GetCodec(codec, *codec_options_);
     always_compressed_ = always_compressed;
   }
 
+  ~SerializedPageReader() override {
+    for (auto& pending : readahead_) {
+      if (pending.decompression != nullptr) {
+        pending.decompression->Discard();
+      }
+    }
+  }
+
   // Implement the PageReader interface
   //
   // The returned Page contains references that aren't guaranteed to live
   // beyond the next call to NextPage(). SerializedPageReader reuses the
   // decompression buffer internally, so if NextPage() is
-  // called then the content of previous page might be invalidated.
+  // called then the content of previous page might be invalidated,
+  // unless set_reuse_page_buffers(false) was called.
   std::shared_ptr<Page> NextPage() override;
 
   void set_max_page_header_size(uint32_t size) override { max_page_header_size_ = size; }
 
+  void set_reuse_page_buffers(bool reuse) override { reuse_page_buffers_ = reuse; }
+
  private:
+  // A page read from the stream and decrypted, but not decompressed yet.
+  struct RawPage {
+    format::PageHeader header;
+    std::shared_ptr<Buffer> buffer;
+    int compressed_len = 0;
+    // Set if the decryption of `buffer` was left to the caller, which must use this
+    // AAD since data_decryptor_ is updated for the following pages
+    std::optional<std::string> decryption_aad;
+    // Set if the verification of the checksum of `buffer` was left to the caller
+    std::optional<int32_t> expected_crc;
+    int32_t page_ordinal = 0;
+    // The page data needs decompression; always true except for DataPageV2
+    bool is_compressed = true;
+    // Length of the uncompressed levels at the start of a DataPageV2
+    int levels_byte_len = 0;
+    EncodedStatistics statistics;
+  };
+
+  // A page read ahead, whose checksum verification, decryption and decompression
+  // may still be in flight.
+  struct PendingPage {
+    RawPage raw;
+    std::shared_ptr<PageDecompressionTask> decompression;
+    // Bytes held by this page, counted against page_readahead_memory_limit()
+    int64_t memory_size = 0;
+    // Set when reading the page failed. The error is rethrown when the page is
+    // reached, so that the pages before it can still be read.
+    std::exception_ptr error;
+  };
+
   void UpdateDecryption(Decryptor* decryptor, int8_t module_type, std::string* page_aad);
 
   void InitDecryption();
@@ -265,17 +425,45 @@ class SerializedPageReader : public PageReader {
   // Fills in data_page_statistics.
   bool ShouldSkipPage(EncodedStatistics* data_page_statistics);
 
+  // Read, check and decrypt the next page that is not skipped. Returns
+  // std::nullopt at the end of the column chunk. If `defer` is true, the page
+  // is returned encrypted along with its AAD, and its checksum is not verified
+  // but returned in RawPage::expected_crc.
+  std::optional<RawPage> ReadRawPage(bool defer = false);
+
+  // Build the page returned to the caller from its (decompressed) data.
+  std::shared_ptr<Page> MakePage(RawPage raw_page, std::shared_ptr<Buffer> page_buffer);
+
+  std::shared_ptr<Page> NextPageWithReadahead();
+
+  // Read pages ahead until page_readahead() pages or the memory limit are reached,
+  // spawning the checksum verification, decryption and decompression of each of
+  // them.
+  void FillReadahead();
+
   const ReaderProperties properties_;
   std::shared_ptr<ArrowInputStream> stream_;
 
   format::PageHeader current_page_header_;
 
   // Compression codec to use.
+  Compression::type codec_;
+  std::shared_ptr<const CodecOptions> codec_options_;
   std::unique_ptr<::arrow::util::Codec> decompressor_;
   std::shared_ptr<ResizableBuffer> decompression_buffer_;
+  bool reuse_page_buffers_ = true;
+  // Recycles the decryption buffers, and the decompression buffers of pages that
+  // do not reuse decompression_buffer_
+  std::shared_ptr<::arrow::util::BufferPool> buffer_pool_;
 
   bool always_compressed_;
 
+  // Pages read ahead when properties_.page_readahead() is positive. Each of them
+  // is decompressed into its own buffer.
+  std::deque<PendingPage> readahead_;
+  int64_t readahead_bytes_ = 0;
+  bool readahead_finished_ = false;
+
   // The fields below are used for calculation of AAD (additional authenticated data)
   // suffix which is part of the Parquet Modular Encryption.
   // The AAD suffix for a parquet module is built internally by
@@ -287,8 +475,10 @@ class SerializedPageReader : public PageReader {
   // The CryptoContext used by this PageReader.
   CryptoContext crypto_ctx_;
   // This PageReader has its own Decryptor instances in order to be thread-safe.
+  // The data decryptor is shared with the readahead tasks, which decrypt with an
+  // explicit AAD.
   std::unique_ptr<Decryptor> meta_decryptor_;
-  std::unique_ptr<Decryptor> data_decryptor_;
+  std::shared_ptr<Decryptor> data_decryptor_;
 
   // The ordinal fields in the context below are used for AAD suffix calculation.
   int32_t page_ordinal_;  // page ordinal does not count the dictionary page
@@ -393,7 +583,8 @@ bool SerializedPageReader::ShouldSkipPage(EncodedStatistics* data_page_statistic
   return false;
 }
 
-std::shared_ptr<Page> SerializedPageReader::NextPage() {
+std::optional<SerializedPageReader::RawPage> SerializedPageReader::ReadRawPage(
+    bool defer) {
   ThriftDeserializer deserializer(properties_);
 
   // Loop here because there may be unhandled page types that we skip until
@@ -407,7 +598,7 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
     // until a maximum allowed header limit
     while (true) {
       PARQUET_ASSIGN_OR_THROW(auto view, stream_->Peek(allowed_page_size));
-      if (view.size() == 0) return nullptr;
+      if (view.size() == 0) return std::nullopt;
 
       // This gets used, then set by DeserializeThriftMsg
       header_size = static_cast<uint32_t>(view.size());
@@ -442,8 +633,9 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
       throw ParquetException("Invalid page header");
     }
 
-    EncodedStatistics data_page_statistics;
-    if (ShouldSkipPage(&data_page_statistics)) {
+    RawPage raw_page;
+    if (ShouldSkipPage(&raw_page.statistics)) {
+      PagesSkippedCounter()->Add();
       PARQUET_THROW_NOT_OK(stream_->Advance(compressed_len));
       continue;
     }
@@ -464,23 +656,24 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
 
     const PageType::type page_type = LoadEnumSafe(&current_page_header_.type);
 
+    raw_page.page_ordinal = page_ordinal_;
     if (properties_.page_checksum_verification() && current_page_header_.__isset.crc &&
         PageCanUseChecksum(page_type)) {
-      // verify crc
-      uint32_t checksum =
-          ::arrow::internal::crc32(/* prev */ 0, page_buffer->data(), compressed_len);
-      if (static_cast<int32_t>(checksum) != current_page_header_.crc) {
-        throw ParquetException(
-            "could not verify page integrity, CRC checksum verification failed for "
-            "page_ordinal " +
-            std::to_string(page_ordinal_));
+      if (defer) {
+        raw_page.expected_crc = current_page_header_.crc;
+      } else {
+        VerifyPageChecksum(*page_buffer, compressed_len, current_page_header_.crc,
+                           page_ordinal_);
       }
     }
 
     // Decrypt it if we need to
-    if (data_decryptor_ != nullptr) {
-      auto decryption_buffer = AllocateBuffer(
-          properties_.memory_pool(), data_decryptor_->PlaintextLength(compressed_len));
+    if (data_decryptor_ != nullptr && defer) {
+      raw_page.decryption_aad = data_decryptor_->aad();
+    } else if (data_decryptor_ != nullptr) {
+      PARQUET_ASSIGN_OR_THROW(
+          auto decryption_buffer,
+          buffer_pool_->Acquire(data_decryptor_->PlaintextLength(compressed_len)));
       compressed_len = data_decryptor_->Decrypt(
           page_buffer->span_as<uint8_t>(), decryption_buffer->mutable_span_as<uint8_t>());
 
@@ -489,103 +682,205 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
 
     if (page_type == PageType::DICTIONARY_PAGE) {
       crypto_ctx_.start_decrypt_with_dictionary_page = false;
-      const format::DictionaryPageHeader& dict_header =
-          current_page_header_.dictionary_page_header;
-      bool is_sorted = dict_header.__isset.is_sorted ? dict_header.is_sorted : false;
-
-      page_buffer =
-          DecompressIfNeeded(std::move(page_buffer), compressed_len, uncompressed_len);
-
-      return std::make_shared<DictionaryPage>(page_buffer, dict_header.num_values,
-                                              LoadEnumSafe(&dict_header.encoding),
-                                              is_sorted);
     } else if (page_type == PageType::DATA_PAGE) {
       ++page_ordinal_;
-      const format::DataPageHeader& header = current_page_header_.data_page_header;
-      page_buffer =
-          DecompressIfNeeded(std::move(page_buffer), compressed_len, uncompressed_len);
-
-      return std::make_shared<DataPageV1>(
-          page_buffer, header.num_values, LoadEnumSafe(&header.encoding),
-          LoadEnumSafe(&header.definition_level_encoding),
-          LoadEnumSafe(&header.repetition_level_encoding), uncompressed_len,
-          std::move(data_page_statistics));
     } else if (page_type == PageType::DATA_PAGE_V2) {
       ++page_ordinal_;
       const format::DataPageHeaderV2& header = current_page_header_.data_page_header_v2;
 
       // Arrow prior to 3.0.0 set is_compressed to false but still compressed.
-      bool is_compressed =
+      raw_page.is_compressed =
           (header.__isset.is_compressed ? header.is_compressed : false) ||
           always_compressed_;
-
-      // Uncompress if needed
-      int levels_byte_len;
       if (AddWithOverflow(header.definition_levels_byte_length,
-                          header.repetition_levels_byte_length, &levels_byte_len)) {
+                          header.repetition_levels_byte_length,
+                          &raw_page.levels_byte_len)) {
         throw ParquetException("Levels size too large (corrupt file?)");
       }
-      // DecompressIfNeeded doesn't take `is_compressed` into account as
-      // it's page type-agnostic.
-      if (is_compressed) {
-        page_buffer = DecompressIfNeeded(std::move(page_buffer), compressed_len,
-                                         uncompressed_len, levels_byte_len);
-      }
-
-      return std::make_shared<DataPageV2>(
-          page_buffer, header.num_values, header.num_nulls, header.num_rows,
-          LoadEnumSafe(&header.encoding), header.definition_levels_byte_length,
-          header.repetition_levels_byte_length, uncompressed_len, is_compressed,
-          std::move(data_page_statistics));
     } else {
       throw ParquetException(
           "Internal error, we have already skipped non-data pages in ShouldSkipPage()");
     }
+
+    raw_page.header = std::move(current_page_header_);
+    raw_page.buffer = std::move(page_buffer);
+    raw_page.compressed_len = compressed_len;
+    return raw_page;
   }
-  return std::shared_ptr<Page>(nullptr);
+  return std::nullopt;
 }
 
-std::shared_ptr<Buffer> SerializedPageReader::DecompressIfNeeded(
-    std::shared_ptr<Buffer> page_buffer, int compressed_len, int uncompressed_len,
-    int levels_byte_len) {
-  if (decompressor_ == nullptr) {
-    return page_buffer;
+std::shared_ptr<Page> SerializedPageReader::MakePage(
+    RawPage raw_page, std::shared_ptr<Buffer> page_buffer) {
+  const PageType::type page_type = LoadEnumSafe(&raw_page.header.type);
+  const int32_t uncompressed_len = raw_page.header.uncompressed_page_size;
+
+  if (page_type == PageType::DICTIONARY_PAGE) {
+    const format::DictionaryPageHeader& dict_header =
+        raw_page.header.dictionary_page_header;
+    bool is_sorted = dict_header.__isset.is_sorted ? dict_header.is_sorted : false;
+
+    return std::make_shared<DictionaryPage>(std::move(page_buffer),
+                                            dict_header.num_values,
+                                            LoadEnumSafe(&dict_header.encoding),
+                                            is_sorted);
+  } else if (page_type == PageType::DATA_PAGE) {
+    const format::DataPageHeader& header = raw_page.header.data_page_header;
+
+    return std::make_shared<DataPageV1>(
+        std::move(page_buffer), header.num_values, LoadEnumSafe(&header.encoding),
+        LoadEnumSafe(&header.definition_level_encoding),
+        LoadEnumSafe(&header.repetition_level_encoding), uncompressed_len,
+        std::move(raw_page.statistics));
+  } else {
+    ARROW_DCHECK_EQ(page_type, PageType::DATA_PAGE_V2);
+    const format::DataPageHeaderV2& header = raw_page.header.data_page_header_v2;
+
+    return std::make_shared<DataPageV2>(
+        std::move(page_buffer), header.num_values, header.num_nulls, header.num_rows,
+        LoadEnumSafe(&header.encoding), header.definition_levels_byte_length,
+        header.repetition_levels_byte_length, uncompressed_len, raw_page.is_compressed,
+        std::move(raw_page.statistics));
   }
-  if (compressed_len < levels_byte_len || uncompressed_len < levels_byte_len) {
-    throw ParquetException("Invalid page header");
+}
+
+std::shared_ptr<Page> SerializedPageReader::NextPage() {
+  if (properties_.page_readahead() > 0) {
+    return NextPageWithReadahead();
   }
 
-  // Grow the uncompressed buffer if we need to.
-  PARQUET_THROW_NOT_OK(
-      decompression_buffer_->Resize(uncompressed_len, /*shrink_to_fit=*/false));
+  std::optional<RawPage> raw_page = ReadRawPage();
+  if (!raw_page.has_value()) {
+    return std::shared_ptr<Page>(nullptr);
+  }
+  std::shared_ptr<Buffer> page_buffer = std::move(raw_page->buffer);
+  // DecompressIfNeeded doesn't take `is_compressed` into account as
+  // it's page type-agnostic.
+  if (raw_page->is_compressed) {
+    page_buffer = DecompressIfNeeded(std::move(page_buffer), raw_page->compressed_len,
+                                     raw_page->header.uncompressed_page_size,
+                                     raw_page->levels_byte_len);
+  }
+  return MakePage(std::move(*raw_page), std::move(page_buffer));
+}
 
-  if (levels_byte_len > 0) {
-    // First copy the levels as-is
-    uint8_t* decompressed = decompression_buffer_->mutable_data();
-    memcpy(decompressed, page_buffer->data(), levels_byte_len);
+std::shared_ptr<Page> SerializedPageReader::NextPageWithReadahead() {
+  FillReadahead();
+  if (readahead_.empty()) {
+    return std::shared_ptr<Page>(nullptr);
+  }
+  PendingPage pending = std::move(readahead_.front());
+  readahead_.pop_front();
+  readahead_bytes_ -= pending.memory_size;
+  if (pending.error) {
+    std::rethrow_exception(pending.error);
   }
 
-  // GH-31992: DataPageV2 may store only levels and no values when all
-  // values are null. In this case, Parquet java is known to produce a
-  // 0-len compressed area (which is invalid compressed input).
-  // See https://github.com/apache/parquet-java/issues/3122
-  int64_t decompressed_len = 0;
-  if (uncompressed_len - levels_byte_len != 0) {
-    // Decompress the values
-    PARQUET_ASSIGN_OR_THROW(
-        decompressed_len,
-        decompressor_->Decompress(
-            compressed_len - levels_byte_len, page_buffer->data() + levels_byte_len,
-            uncompressed_len - levels_byte_len,
-            decompression_buffer_->mutable_data() + levels_byte_len));
+  // Keep the following pages decompressing while this one is being decoded
+  FillReadahead();
+
+  std::shared_ptr<Buffer> page_buffer = std::move(pending.raw.buffer);
+  if (pending.decompression != nullptr) {
+    PARQUET_ASSIGN_OR_THROW(page_buffer, pending.decompression->Wait());
   }
+  return MakePage(std::move(pending.raw), std::move(page_buffer));
+}
 
-  if (decompressed_len != uncompressed_len - levels_byte_len) {
-    throw ParquetException("Page didn't decompress to expected size, expected: " +
-                           std::to_string(uncompressed_len - levels_byte_len) +
-                           ", but got:" + std::to_string(decompressed_len));
+void SerializedPageReader::FillReadahead() {
+  while (!readahead_finished_ &&
+         static_cast<int64_t>(readahead_.size()) < properties_.page_readahead() &&
+         (readahead_.empty() ||
+          readahead_bytes_ < properties_.page_readahead_memory_limit())) {
+    PendingPage pending;
+    try {
+      std::optional<RawPage> raw_page = ReadRawPage(/*defer=*/true);
+      if (!raw_page.has_value()) {
+        readahead_finished_ = true;
+        return;
+      }
+      pending.raw = std::move(*raw_page);
+    } catch (...) {
+      pending.error = std::current_exception();
+      readahead_finished_ = true;
+      readahead_.push_back(std::move(pending));
+      return;
+    }
+
+    pending.memory_size = pending.raw.compressed_len;
+    const bool decompress = decompressor_ != nullptr && pending.raw.is_compressed;
+    if (pending.raw.expected_crc.has_value() || pending.raw.decryption_aad.has_value() ||
+        decompress) {
+      // The task only captures values: it may outlive this reader, and each task
+      // uses its own codec instance since codecs are not thread-safe. Decryptors
+      // can be shared as long as the AAD is passed explicitly.
+      const std::optional<int32_t> expected_crc = pending.raw.expected_crc;
+      const int32_t page_ordinal = pending.raw.page_ordinal;
+      std::shared_ptr<Decryptor> decryptor;
+      std::string aad;
+      if (pending.raw.decryption_aad.has_value()) {
+        decryptor = data_decryptor_;
+        aad = std::move(*pending.raw.decryption_aad);
+        pending.memory_size += decryptor->PlaintextLength(pending.raw.compressed_len);
+      }
+      const Compression::type codec = codec_;
+      std::shared_ptr<const CodecOptions> codec_options = codec_options_;
+      std::shared_ptr<::arrow::util::BufferPool> buffer_pool = buffer_pool_;
+      std::shared_ptr<Buffer> input = pending.raw.buffer;
+      const int input_len = pending.raw.compressed_len;
+      const int uncompressed_len = pending.raw.header.uncompressed_page_size;
+      const int levels_byte_len = pending.raw.levels_byte_len;
+      pending.decompression = std::make_shared<PageDecompressionTask>(
+          [=]() -> Result<std::shared_ptr<Buffer>> {
+            BEGIN_PARQUET_CATCH_EXCEPTIONS
+            std::shared_ptr<Buffer> page_buffer = input;
+            int compressed_len = input_len;
+            if (expected_crc.has_value()) {
+              VerifyPageChecksum(*input, input_len, *expected_crc, page_ordinal);
+            }
+            if (decryptor != nullptr) {
+              PARQUET_ASSIGN_OR_THROW(
+                  std::shared_ptr<ResizableBuffer> decrypted,
+                  buffer_pool->Acquire(decryptor->PlaintextLength(input_len)));
+              compressed_len = decryptor->Decrypt(
+                  input->span_as<uint8_t>(), decrypted->mutable_span_as<uint8_t>(), aad);
+              page_buffer = std::move(decrypted);
+            }
+            if (!decompress) {
+              return page_buffer;
+            }
+            std::unique_ptr<::arrow::util::Codec> decompressor =
+                GetCodec(codec, *codec_options);
+            PARQUET_ASSIGN_OR_THROW(std::shared_ptr<ResizableBuffer> decompressed,
+                                    buffer_pool->Acquire(std::max(uncompressed_len, 0)));
+            DecompressPage(decompressor.get(), *page_buffer, compressed_len,
+                           uncompressed_len, levels_byte_len, decompressed.get());
+            return std::shared_ptr<Buffer>(std::move(decompressed));
+            END_PARQUET_CATCH_EXCEPTIONS
+          });
+      if (decompress) {
+        pending.memory_size += uncompressed_len;
+      }
+      PARQUET_THROW_NOT_OK(::arrow::internal::GetCpuThreadPool()->Spawn(
+          [task = pending.decompression]() { task->Run(); }));
+    }
+    readahead_bytes_ += pending.memory_size;
+    readahead_.push_back(std::move(pending));
   }
+}
 
+std::shared_ptr<Buffer> SerializedPageReader::DecompressIfNeeded(
+    std::shared_ptr<Buffer> page_buffer, int compressed_len, int uncompressed_len,
+    int levels_byte_len) {
+  if (decompressor_ == nullptr) {
+    return page_buffer;
+  }
+  if (!reuse_page_buffers_) {
+    // A negative length is rejected by DecompressPage below
+    PARQUET_ASSIGN_OR_THROW(decompression_buffer_,
+                            buffer_pool_->Acquire(std::max(uncompressed_len, 0)));
+  }
+  DecompressPage(decompressor_.get(), *page_buffer, compressed_len, uncompressed_len,
+                 levels_byte_len, decompression_buffer_.get());
   return decompression_buffer_;
 }
 
@@ -597,8 +892,18 @@ std::unique_ptr<PageReader> PageReader::Open(std::shared_ptr<ArrowInputStream> s
                                              const ReaderProperties& properties,
                                              bool always_compressed,
                                              const CryptoContext* ctx) {
+  return Open(std::move(stream), total_num_values, codec, /*codec_options=*/nullptr,
+              properties, always_compressed, ctx);
+}
+
+std::unique_ptr<PageReader> PageReader::Open(
+    std::shared_ptr<ArrowInputStream> stream, int64_t total_num_values,
+    Compression::type codec, std::shared_ptr<const CodecOptions> codec_options,
+    const ReaderProperties& properties, bool always_compressed,
+    const CryptoContext* ctx) {
   return std::unique_ptr<PageReader>(new SerializedPageReader(
-      std::move(stream), total_num_values, codec, properties, ctx, always_compressed));
+      std::move(stream), total_num_values, codec, std::move(codec_options), properties,
+      ctx, always_compressed));
 }
 
 std::unique_ptr<PageReader> PageReader::Open(std::shared_ptr<ArrowInputStream> stream,
@@ -609,7 +914,8 @@ std::unique_ptr<PageReader> PageReader::Open(std::shared_ptr<ArrowInputStream> s
                                              const CryptoContext* ctx) {
   return std::unique_ptr<PageReader>(
       new SerializedPageReader(std::move(stream), total_num_values, codec,
-                               ReaderProperties(pool), ctx, always_compressed));
+                               /*codec_options=*/nullptr, ReaderProperties(pool), ctx,
+                               always_compressed));
 }
 
 namespace {
@@ -704,11 +1010,13 @@ class ColumnReaderImplBase {
         const int64_t levels_byte_size = InitializeLevelDecoders(
             *page, page->repetition_level_encoding(), page->definition_level_encoding());
         InitializeDataDecoder(*page, levels_byte_size);
+        PagesDecodedCounter()->Add();
         return true;
       } else if (current_page_->type() == PageType::DATA_PAGE_V2) {
         const auto* page = static_cast<const DataPageV2*>(current_page_.get());
         int64_t levels_byte_size = InitializeLevelDecodersV2(*page);
         InitializeDataDecoder(*page, levels_byte_size);
+        PagesDecodedCounter()->Add();
         return true;
       } else {
         // We don't know what this page type is. We're allowed to skip non-data
@@ -877,8 +1185,14 @@ class ColumnReaderImplBase {
       }
     }
     current_encoding_ = encoding;
-    current_decoder_->SetData(static_cast<int>(num_buffered_values_), buffer,
-                              static_cast<int>(data_size));
+    if (reference_page_buffers_) {
+      current_decoder_->SetDataFromBuffer(static_cast<int>(num_buffered_values_),
+                                          page.buffer(), buffer,
+                                          static_cast<int>(data_size));
+    } else {
+      current_decoder_->SetData(static_cast<int>(num_buffered_values_), buffer,
+                                static_cast<int>(data_size));
+    }
   }
 
   // Available values in the current data page, value includes repeated values
@@ -922,6 +1236,10 @@ class ColumnReaderImplBase {
   /// DictionaryRecordReader
   bool new_dictionary_ = false;
 
+  /// Whether decoders may reference the page buffers in the decoded data, which
+  /// requires the page reader not to reuse them
+  bool reference_page_buffers_ = false;
+
   // The exposed encoding
   ExposedEncoding exposed_encoding_ = ExposedEncoding::NO_ENCODING;
 
@@ -1724,6 +2042,9 @@ class TypedRecordReader : public TypedColumnReaderImpl<DType>,
   void SetPageReader(std::unique_ptr<PageReader> reader) override {
     at_record_start_ = true;
     this->pager_ = std::move(reader);
+    if (this->reference_page_buffers_) {
+      this->pager_->set_reuse_page_buffers(false);
+    }
     ResetDecoders();
   }
 
@@ -2025,11 +2346,14 @@ class ByteArrayChunkedRecordReader final : public TypedRecordReader<ByteArrayTyp
       case ::arrow::Type::LARGE_STRING:
         accumulator_.builder = std::make_unique<::arrow::LargeStringBuilder>(pool);
         break;
+      // Binary-view values reference the page data instead of copying it
       case ::arrow::Type::BINARY_VIEW:
         accumulator_.builder = std::make_unique<::arrow::BinaryViewBuilder>(pool);
+        this->reference_page_buffers_ = true;
         break;
       case ::arrow::Type::STRING_VIEW:
         accumulator_.builder = std::make_unique<::arrow::StringViewBuilder>(pool);
+        this->reference_page_buffers_ = true;
         break;
       default:
         throw ParquetException("cannot read Parquet BYTE_ARRAY as Arrow " +
@@ -128,6 +128,13 @@ class PARQUET_EXPORT PageReader {
                                           const ReaderProperties& properties,
                                           bool always_compressed = false,
                                           const CryptoContext* ctx = NULLPTR);
+  /// \brief Open a page reader decompressing with the given codec options (e.g. the
+  /// ZSTD dictionary of the file), or the default ones if null
+  static std::unique_ptr<PageReader> Open(
+      std::shared_ptr<ArrowInputStream> stream, int64_t total_num_values,
+      Compression::type codec, std::shared_ptr<const CodecOptions> codec_options,
+      const ReaderProperties& properties, bool always_compressed = false,
+      const CryptoContext* ctx = NULLPTR);
 
   // If data_page_filter is present (not null), NextPage() will call the
   // callback function exactly once per page in the order the pages appear in
@@ -150,6 +157,13 @@ class PARQUET_EXPORT PageReader {
 
   virtual void set_max_page_header_size(uint32_t size) = 0;
 
+  // Set whether the buffers of returned pages may be reused by the following pages.
+  //
+  // Disabling reuse makes every returned Page own its data, so that it can be
+  // referenced after the next call to NextPage(), for example by BinaryView arrays
+  // decoded from it.
+  virtual void set_reuse_page_buffers(bool reuse) {}
+
  protected:
   // Callback that decides if we should skip a page or not.
   DataPageFilter data_page_filter_;
@@ -1297,6 +1297,11 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
     current_dict_encoder_ =
         dynamic_cast<DictEncoder<ParquetType>*>(current_encoder_.get());
 
+    if (properties->adaptive_encoding_enabled() &&
+        properties->encoding(descr_->path()) == Encoding::UNKNOWN) {
+      InitEncodingCandidates();
+    }
+
     if (bloom_filter != nullptr) {
       bloom_filter_writer_ = std::make_unique<BloomFilterWriter>(descr_, bloom_filter);
     }
@@ -1324,7 +1329,13 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
         properties->page_index_enabled(descr_->path());
   }
 
-  int64_t Close() override { return ColumnWriterImpl::Close(); }
+  int64_t Close() override {
+    if (!closed_ && !encoding_candidates_.empty() && num_buffered_values_ > 0) {
+      // Select the encoding before the dictionary page is written
+      AddDataPage();
+    }
+    return ColumnWriterImpl::Close();
+  }
 
   int64_t WriteBatch(int64_t num_values, const int16_t* def_levels,
                      const int16_t* rep_levels, const T* values) override {
@@ -1490,6 +1501,9 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
 
  protected:
   std::shared_ptr<Buffer> GetValuesBuffer() override {
+    if (ARROW_PREDICT_FALSE(!encoding_candidates_.empty())) {
+      return SelectEncoding();
+    }
     return current_encoder_->FlushValues();
   }
 
@@ -1651,6 +1665,132 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
   // which case we call back to the dense write path)
   std::shared_ptr<::arrow::Array> preserved_dictionary_;
 
+  // With adaptive encoding, the first values of the column chunk are also written
+  // to an encoder for each alternative encoding, until the first data page selects
+  // the encoding producing the smallest output.
+  struct EncodingCandidate {
+    std::unique_ptr<Encoder> encoder;
+    ValueEncoderType* value_encoder;
+  };
+  std::vector<EncodingCandidate> encoding_candidates_;
+  int64_t num_sampled_values_ = 0;
+
+  void InitEncodingCandidates() {
+    std::vector<Encoding::type> encodings;
+    switch (ParquetType::type_num) {
+      case Type::INT32:
+      case Type::INT64:
+        encodings = {Encoding::PLAIN, Encoding::DELTA_BINARY_PACKED,
+                     Encoding::BYTE_STREAM_SPLIT};
+        break;
+      case Type::FLOAT:
+      case Type::DOUBLE:
+        encodings = {Encoding::PLAIN, Encoding::BYTE_STREAM_SPLIT};
+        break;
+      case Type::INT96:
+        encodings = {Encoding::PLAIN};
+        break;
+      case Type::BYTE_ARRAY:
+        encodings = {Encoding::PLAIN, Encoding::DELTA_BYTE_ARRAY};
+        break;
+      case Type::FIXED_LEN_BYTE_ARRAY:
+        encodings = {Encoding::PLAIN, Encoding::DELTA_BYTE_ARRAY,
+                     Encoding::BYTE_STREAM_SPLIT};
+        break;
+      default:
+        // BOOLEAN keeps its configured encoding
+        return;
+    }
+    for (Encoding::type encoding : encodings) {
+      if (encoding == current_encoder_->encoding()) {
+        continue;
+      }
+      std::unique_ptr<Encoder> encoder =
+          MakeEncoder(ParquetType::type_num, encoding, /*use_dictionary=*/false, descr_,
+                      properties_->memory_pool());
+      auto value_encoder = dynamic_cast<ValueEncoderType*>(encoder.get());
+      encoding_candidates_.push_back({std::move(encoder), value_encoder});
+    }
+  }
+
+  bool SamplingComplete() const {
+    return !encoding_candidates_.empty() &&
+           num_sampled_values_ >= properties_->adaptive_encoding_sample_size();
+  }
+
+  // Size of `buffer` once written to a page, with compression if any
+  int64_t EstimatePageSize(const Buffer& buffer) {
+    if (!pager_->has_compressor() || buffer.size() == 0) {
+      return buffer.size();
+    }
+    pager_->Compress(buffer, compressor_temp_buffer_.get());
+    return std::min(compressor_temp_buffer_->size(), buffer.size());
+  }
+
+  // Flushes the sampled values from every candidate encoder and keeps the one
+  // with the smallest output (including the dictionary page, if any) for the rest
+  // of the column chunk.  Returns the values of the selected encoder.
+  std::shared_ptr<Buffer> SelectEncoding() {
+    std::shared_ptr<Buffer> selected_values = current_encoder_->FlushValues();
+    int64_t selected_size = EstimatePageSize(*selected_values);
+    if (current_dict_encoder_ != nullptr) {
+      std::shared_ptr<ResizableBuffer> dict_buffer = AllocateBuffer(
+          properties_->memory_pool(), current_dict_encoder_->dict_encoded_size());
+      current_dict_encoder_->WriteDict(dict_buffer->mutable_data());
+      selected_size += EstimatePageSize(*dict_buffer);
+    }
+
+    std::optional<size_t> selected;
+    for (size_t i = 0; i < encoding_candidates_.size(); ++i) {
+      std::shared_ptr<Buffer> values = encoding_candidates_[i].encoder->FlushValues();
+      const int64_t size = EstimatePageSize(*values);
+      if (size < selected_size) {
+        selected = i;
+        selected_size = size;
+        selected_values = std::move(values);
+      }
+    }
+
+    if (selected.has_value()) {
+      EncodingCandidate& candidate = encoding_candidates_[*selected];
+      if constexpr (std::is_same_v<T, ByteArray>) {
+        // Already reported through the previous encoder
+        candidate.encoder->ReportUnencodedDataBytes();
+      }
+      current_encoder_ = std::move(candidate.encoder);
+      current_value_encoder_ = candidate.value_encoder;
+      current_dict_encoder_ = nullptr;
+      // No page has been written yet, so the column chunk simply has no dictionary
+      has_dictionary_ = false;
+      encoding_ = current_encoder_->encoding();
+    }
+    encoding_candidates_.clear();
+    return selected_values;
+  }
+
+  void SampleValues(const T* values, int64_t num_values) {
+    for (auto& candidate : encoding_candidates_) {
+      candidate.value_encoder->Put(values, static_cast<int>(num_values));
+    }
+    num_sampled_values_ += num_values;
+  }
+
+  void SampleValuesSpaced(const T* values, int64_t num_values, int64_t num_spaced_values,
+                          const uint8_t* valid_bits, int64_t valid_bits_offset) {
+    for (auto& candidate : encoding_candidates_) {
+      candidate.value_encoder->PutSpaced(values, static_cast<int>(num_spaced_values),
+                                         valid_bits, valid_bits_offset);
+    }
+    num_sampled_values_ += num_values;
+  }
+
+  void SampleValues(const ::arrow::Array& values) {
+    for (auto& candidate : encoding_candidates_) {
+      candidate.encoder->Put(values);
+    }
+    num_sampled_values_ += values.length() - values.null_count();
+  }
+
   int64_t WriteLevels(int64_t num_levels, const int16_t* def_levels,
                       const int16_t* rep_levels) {
     // Update histograms now, to maximize cache efficiency.
@@ -1825,13 +1965,15 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
 
     if (check_page_limit &&
         (current_encoder_->EstimatedDataEncodedSize() >= properties_->data_pagesize() ||
-         num_buffered_rows_ >= properties_->max_rows_per_page())) {
+         num_buffered_rows_ >= properties_->max_rows_per_page() || SamplingComplete())) {
       AddDataPage();
     }
   }
 
   void FallbackToPlainEncoding() {
     if (IsDictionaryIndexEncoding(current_encoder_->encoding())) {
+      // Falling back settles the encoding
+      encoding_candidates_.clear();
       WriteDictionaryPage();
       // Serialize the buffered Dictionary Indices
       FlushBufferedDataPages();
@@ -1852,9 +1994,10 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
   // Only one Dictionary Page is written.
   // Fallback to PLAIN if dictionary page limit is reached.
   void CheckDictionarySizeLimit() {
-    if (!has_dictionary_ || fallback_) {
+    if (!has_dictionary_ || fallback_ || !encoding_candidates_.empty()) {
       // Either not using dictionary encoding, or we have already fallen back
-      // to PLAIN encoding because the size threshold was reached
+      // to PLAIN encoding because the size threshold was reached, or the
+      // encoding is still being selected
       return;
     }
 
@@ -1866,6 +2009,9 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
 
   void WriteValues(const T* values, int64_t num_values, int64_t num_nulls) {
     current_value_encoder_->Put(values, static_cast<int>(num_values));
+    if (ARROW_PREDICT_FALSE(!encoding_candidates_.empty())) {
+      SampleValues(values, num_values);
+    }
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(values, num_values, num_nulls);
     }
@@ -1898,6 +2044,10 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
   void WriteValuesSpaced(const T* values, int64_t num_values, int64_t num_spaced_values,
                          const uint8_t* valid_bits, int64_t valid_bits_offset,
                          int64_t num_levels, int64_t num_nulls) {
+    if (ARROW_PREDICT_FALSE(!encoding_candidates_.empty())) {
+      SampleValuesSpaced(values, num_values, num_spaced_values, valid_bits,
+                         valid_bits_offset);
+    }
     if (num_values != num_spaced_values) {
       current_value_encoder_->PutSpaced(values, static_cast<int>(num_spaced_values),
                                         valid_bits, valid_bits_offset);
@@ -1965,6 +2115,8 @@ Status TypedColumnWriterImpl<ParquetType>::WriteArrowDictionary(
     return WriteDense();
   }
 
+  // Dictionary arrays written directly keep dictionary encoding
+  encoding_candidates_.clear();
   auto dict_encoder = dynamic_cast<DictEncoder<ParquetType>*>(current_encoder_.get());
   const auto& data = checked_cast<const ::arrow::DictionaryArray&>(array);
   std::shared_ptr<::arrow::Array> dictionary = data.dictionary();
@@ -2491,6 +2643,9 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(
         data_slice, MaybeReplaceValidity(data_slice, null_count, ctx->memory_pool));
 
     current_encoder_->Put(*data_slice);
+    if (ARROW_PREDICT_FALSE(!encoding_candidates_.empty())) {
+      SampleValues(*data_slice);
+    }
     // Null values in ancestors count as nulls.
     const int64_t non_null = data_slice->length() - data_slice->null_count();
     if (page_statistics_ != nullptr) {
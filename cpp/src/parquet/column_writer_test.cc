@@ -16,6 +16,7 @@
 // under the License.
 
 #include <memory>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -1717,6 +1718,83 @@ TEST(TestColumnWriter, WriteDataPagesChangeOnRecordBoundariesWithSmallBatches) {
   }
 }
 
+TEST(TestColumnWriter, AdaptiveEncoding) {
+  auto sink = CreateOutputStream();
+  auto schema = std::static_pointer_cast<GroupNode>(GroupNode::Make(
+      "schema", Repetition::REQUIRED,
+      {schema::Int32("adaptive", Repetition::REQUIRED),
+       schema::Int32("explicit", Repetition::REQUIRED)}));
+  auto properties = WriterProperties::Builder()
+                        .enable_adaptive_encoding(/*sample_size=*/1000)
+                        ->encoding("explicit", Encoding::PLAIN)
+                        ->disable_dictionary("explicit")
+                        ->build();
+  auto file_writer = ParquetFileWriter::Open(sink, schema, properties);
+
+  constexpr int32_t num_values = 10000;
+  // Sorted values are best delta-encoded, a few distinct values are best
+  // dictionary-encoded.
+  std::vector<std::vector<int32_t>> row_group_values(2);
+  for (int32_t i = 0; i < num_values; ++i) {
+    row_group_values[0].push_back(i);
+    row_group_values[1].push_back((i * 7) % 4 * 1000000);
+  }
+  for (auto& values : row_group_values) {
+    auto rg_writer = file_writer->AppendRowGroup();
+    for (int i = 0; i < 2; ++i) {
+      auto writer = static_cast<parquet::Int32Writer*>(rg_writer->NextColumn());
+      writer->WriteBatch(num_values, nullptr, nullptr, values.data());
+    }
+  }
+  ASSERT_NO_THROW(file_writer->Close());
+
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  auto file_reader = ParquetFileReader::Open(
+      std::make_shared<::arrow::io::BufferReader>(buffer), default_reader_properties());
+  auto metadata = file_reader->metadata();
+  ASSERT_EQ(2, metadata->num_row_groups());
+
+  auto data_page_encodings = [&](int row_group, int column) {
+    std::set<Encoding::type> encodings;
+    for (const auto& stats :
+         metadata->RowGroup(row_group)->ColumnChunk(column)->encoding_stats()) {
+      if (stats.page_type == PageType::DATA_PAGE) {
+        encodings.insert(stats.encoding);
+      }
+    }
+    return encodings;
+  };
+  // The encoding is selected again for each row group
+  EXPECT_EQ(std::set<Encoding::type>{Encoding::DELTA_BINARY_PACKED},
+            data_page_encodings(0, 0));
+  EXPECT_FALSE(metadata->RowGroup(0)->ColumnChunk(0)->has_dictionary_page());
+  EXPECT_EQ(std::set<Encoding::type>{Encoding::RLE_DICTIONARY},
+            data_page_encodings(1, 0));
+  EXPECT_TRUE(metadata->RowGroup(1)->ColumnChunk(0)->has_dictionary_page());
+  // Explicitly set encodings are kept
+  for (int row_group = 0; row_group < 2; ++row_group) {
+    EXPECT_EQ(std::set<Encoding::type>{Encoding::PLAIN},
+              data_page_encodings(row_group, 1));
+  }
+
+  for (int row_group = 0; row_group < 2; ++row_group) {
+    for (int column = 0; column < 2; ++column) {
+      auto reader = std::static_pointer_cast<Int32Reader>(
+          file_reader->RowGroup(row_group)->Column(column));
+      std::vector<int32_t> values_out(num_values);
+      int64_t total_read = 0;
+      while (reader->HasNext()) {
+        int64_t values_read = 0;
+        reader->ReadBatch(num_values - total_read, nullptr, nullptr,
+                          values_out.data() + total_read, &values_read);
+        total_read += values_read;
+      }
+      ASSERT_EQ(num_values, total_read);
+      ASSERT_EQ(row_group_values[row_group], values_out);
+    }
+  }
+}
+
 class ColumnWriterTestSizeEstimated : public ::testing::Test {
  public:
   void SetUp() {
@@ -48,6 +48,7 @@
 #include "arrow/util/ubsan.h"
 #include "arrow/visit_data_inline.h"
 
+#include "parquet/delta_decoding_internal.h"
 #include "parquet/exception.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
@@ -165,8 +166,19 @@ struct ArrowBinaryHelper<ByteArrayType, ArrowBinaryType> {
   static constexpr bool kIsBinaryView =
       ::arrow::is_binary_view_like_type<ArrowBinaryType>::value;
 
-  explicit ArrowBinaryHelper(Accumulator* acc)
-      : builder_(checked_cast<BuilderType*>(acc->builder.get())) {}
+  // When reading into a binary-view array, values located in `values_buffer` are
+  // appended as views into it instead of being copied.
+  explicit ArrowBinaryHelper(Accumulator* acc,
+                             const std::shared_ptr<Buffer>& values_buffer = NULLPTR)
+      : builder_(checked_cast<BuilderType*>(acc->builder.get())) {
+    if constexpr (kIsBinaryView) {
+      if (values_buffer != nullptr) {
+        values_buffer_ = values_buffer;
+        values_begin_ = values_buffer->data();
+        values_end_ = values_begin_ + values_buffer->size();
+      }
+    }
+  }
 
   // Prepare will reserve the number of entries in the current chunk.
   // If estimated_data_length is provided, it will also reserve the estimated data length,
@@ -185,6 +197,12 @@ struct ArrowBinaryHelper<ByteArrayType, ArrowBinaryType> {
 
   Status AppendValue(const uint8_t* data, int32_t length,
                      std::optional<int64_t> estimated_remaining_data_length = {}) {
+    if constexpr (kIsBinaryView) {
+      if (data >= values_begin_ && data + length <= values_end_ &&
+          values_buffer_ != nullptr) {
+        return builder_->AppendFromBuffer(values_buffer_, data, length);
+      }
+    }
     if (!kIsBinaryView && estimated_remaining_data_length.has_value()) {
       // Assume Prepare() was already called with an estimated_data_length
       builder_->UnsafeAppend(data, length);
@@ -200,6 +218,9 @@ struct ArrowBinaryHelper<ByteArrayType, ArrowBinaryType> {
 
  private:
   BuilderType* builder_;
+  std::shared_ptr<Buffer> values_buffer_;
+  const uint8_t* values_begin_ = NULLPTR;
+  const uint8_t* values_end_ = NULLPTR;
 };
 
 template <>
@@ -227,11 +248,13 @@ struct ArrowBinaryHelper<FLBAType, ::arrow::FixedSizeBinaryType> {
 };
 
 // Call `func(&helper, args...)` where `helper` is a ArrowBinaryHelper<> instance
-// suitable for the Parquet DType and accumulator `acc`.
+// suitable for the Parquet DType and accumulator `acc`. When reading into a
+// binary-view array, values located in `values_buffer` (if not null) are not copied.
 template <typename DType, typename Function, typename... Args>
 auto DispatchArrowBinaryHelper(typename EncodingTraits<DType>::Accumulator* acc,
                                int64_t length,
                                std::optional<int64_t> estimated_data_length,
+                               const std::shared_ptr<Buffer>& values_buffer,
                                Function&& func, Args&&... args) {
   static_assert(std::is_same_v<DType, ByteArrayType> || std::is_same_v<DType, FLBAType>,
                 "unsupported DType");
@@ -251,7 +274,7 @@ auto DispatchArrowBinaryHelper(typename EncodingTraits<DType>::Accumulator* acc,
       }
       case ::arrow::Type::BINARY_VIEW:
       case ::arrow::Type::STRING_VIEW: {
-        ArrowBinaryHelper<DType, ::arrow::BinaryViewType> helper(acc);
+        ArrowBinaryHelper<DType, ::arrow::BinaryViewType> helper(acc, values_buffer);
         RETURN_NOT_OK(helper.Prepare(length, estimated_data_length));
         return func(&helper, std::forward<Args>(args)...);
       }
@@ -727,6 +750,17 @@ class PlainByteArrayDecoder : public PlainDecoder<ByteArrayType> {
   using Base::DecodeSpaced;
   using Base::PlainDecoder;
 
+  void SetData(int num_values, const uint8_t* data, int len) override {
+    Base::SetData(num_values, data, len);
+    data_buffer_.reset();
+  }
+
+  void SetDataFromBuffer(int num_values, std::shared_ptr<Buffer> buffer,
+                         const uint8_t* data, int len) override {
+    Base::SetData(num_values, data, len);
+    data_buffer_ = std::move(buffer);
+  }
+
   // ----------------------------------------------------------------------
   // Dictionary read paths
 
@@ -807,7 +841,7 @@ class PlainByteArrayDecoder : public PlainDecoder<ByteArrayType> {
     };
 
     return DispatchArrowBinaryHelper<ByteArrayType>(
-        out, num_values, estimated_data_length, visit_binary_helper);
+        out, num_values, estimated_data_length, data_buffer_, visit_binary_helper);
   }
 
   template <typename BuilderType>
@@ -847,6 +881,9 @@ class PlainByteArrayDecoder : public PlainDecoder<ByteArrayType> {
     *out_values_decoded = values_decoded;
     return Status::OK();
   }
+
+  // Buffer holding the page data, if given with SetDataFromBuffer()
+  std::shared_ptr<Buffer> data_buffer_;
 };
 
 class PlainFLBADecoder : public PlainDecoder<FLBAType>, public FLBADecoder {
@@ -873,7 +910,8 @@ class DictDecoderImpl : public TypedDecoderImpl<Type>, public DictDecoder<Type>
         dictionary_length_(0),
         byte_array_data_(AllocateBuffer(pool, 0)),
         byte_array_offsets_(AllocateBuffer(pool, 0)),
-        indices_scratch_space_(AllocateBuffer(pool, 0)) {}
+        indices_scratch_space_(AllocateBuffer(pool, 0)),
+        pool_(pool) {}
 
   // Perform type-specific initialization
   void SetDict(TypedDecoder<Type>* dictionary) override;
@@ -1026,6 +1064,8 @@ class DictDecoderImpl : public TypedDecoderImpl<Type>, public DictDecoder<Type>
   std::shared_ptr<ResizableBuffer> indices_scratch_space_;
 
   ::arrow::util::RleBitPackedDecoder<int32_t> idx_decoder_;
+
+  MemoryPool* pool_;
 };
 
 template <typename Type>
@@ -1048,6 +1088,11 @@ void DictDecoderImpl<ByteArrayType>::SetDict(TypedDecoder<ByteArrayType>* dictio
   for (int i = 0; i < dictionary_length_; ++i) {
     total_size += dict_values[i].len;
   }
+  // Binary-view arrays decoded with the previous dictionary may still reference
+  // its data
+  if (byte_array_data_.use_count() > 1) {
+    byte_array_data_ = AllocateBuffer(pool_, 0);
+  }
   PARQUET_THROW_NOT_OK(byte_array_data_->Resize(total_size,
                                                 /*shrink_to_fit=*/false));
   PARQUET_THROW_NOT_OK(
@@ -1341,8 +1386,10 @@ class DictByteArrayDecoderImpl : public DictDecoderImpl<ByteArrayType> {
     // The `len_` in the ByteArrayDictDecoder is the total length of the
     // RLE/Bit-pack encoded data size, so, we cannot use `len_` to reserve
     // space for binary data.
+    // Binary-view values reference the dictionary data instead of copying it.
     return DispatchArrowBinaryHelper<ByteArrayType>(
-        out, num_values, /*estimated_data_length=*/{}, visit_binary_helper);
+        out, num_values, /*estimated_data_length=*/{}, byte_array_data_,
+        visit_binary_helper);
   }
 
   template <typename BuilderType>
@@ -1435,7 +1482,6 @@ template <typename DType>
 class DeltaBitPackDecoder : public TypedDecoderImpl<DType> {
  public:
   using T = typename DType::c_type;
-  using UT = std::make_unsigned_t<T>;
 
   explicit DeltaBitPackDecoder(const ColumnDescriptor* descr,
                                MemoryPool* pool = ::arrow::default_memory_pool())
@@ -1622,13 +1668,8 @@ class DeltaBitPackDecoder : public TypedDecoderImpl<DType> {
           values_decode) {
         ParquetException::EofException();
       }
-      for (int j = 0; j < values_decode; ++j) {
-        // Addition between min_delta, packed int and last_value should be treated as
-        // unsigned addition. Overflow is as expected.
-        buffer[i + j] = static_cast<UT>(min_delta_) + static_cast<UT>(buffer[i + j]) +
-                        static_cast<UT>(last_value_);
-        last_value_ = buffer[i + j];
-      }
+      last_value_ = ::parquet::internal::DeltaDecode(buffer + i, values_decode,
+                                                     min_delta_, last_value_);
       values_remaining_current_mini_block_ -= values_decode;
       i += values_decode;
     }
@@ -1797,7 +1838,8 @@ class DeltaLengthByteArrayDecoder : public TypedDecoderImpl<ByteArrayType> {
       return Status::OK();
     };
     return DispatchArrowBinaryHelper<ByteArrayType>(
-        out, num_values, /*estimated_data_length=*/{}, visit_binary_helper);
+        out, num_values, /*estimated_data_length=*/{}, /*values_buffer=*/nullptr,
+        visit_binary_helper);
   }
 
   std::shared_ptr<::arrow::bit_util::BitReader> decoder_;
@@ -2134,6 +2176,7 @@ class DeltaByteArrayDecoderImpl : public TypedDecoderImpl<DType> {
       return Status::OK();
     };
     return DispatchArrowBinaryHelper<DType>(out, num_values, /*estimated_data_length=*/{},
+                                            /*values_buffer=*/nullptr,
                                             visit_binary_helper);
   }
 
@@ -0,0 +1,125 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/delta_decoding_internal.h"
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2) || defined(ARROW_HAVE_RUNTIME_AVX512)
+#  include "parquet/delta_decoding_simd_internal.h"
+#endif
+
+#define PARQUET_IMPL_NAMESPACE standard
+#include "parquet/delta_decoding_inc.h"
+#undef PARQUET_IMPL_NAMESPACE
+
+#include <utility>
+#include <vector>
+
+#include "arrow/util/dispatch_internal.h"
+#include "arrow/util/simd.h"
+
+namespace parquet::internal {
+
+namespace {
+
+using ::arrow::internal::DispatchLevel;
+using ::arrow::internal::DynamicDispatch;
+
+#if defined(ARROW_HAVE_NEON)
+// NEON is always available when compiled in, so it is the baseline implementation.
+
+int32_t DeltaDecodeNeon(int32_t* values, int64_t num_values, int32_t min_delta,
+                        int32_t last_value) {
+  const uint32x4_t zero = vdupq_n_u32(0);
+  const uint32x4_t min_delta_v = vdupq_n_u32(static_cast<uint32_t>(min_delta));
+  uint32x4_t carry = vdupq_n_u32(static_cast<uint32_t>(last_value));
+  auto* out = reinterpret_cast<uint32_t*>(values);
+  int64_t i = 0;
+  for (; i + 4 <= num_values; i += 4) {
+    uint32x4_t x = vaddq_u32(vld1q_u32(out + i), min_delta_v);
+    // Prefix sum of the 4 lanes
+    x = vaddq_u32(x, vextq_u32(zero, x, 3));
+    x = vaddq_u32(x, vextq_u32(zero, x, 2));
+    x = vaddq_u32(x, carry);
+    vst1q_u32(out + i, x);
+    carry = vdupq_laneq_u32(x, 3);
+  }
+  return standard::DeltaDecodeScalar(values + i, num_values - i, min_delta,
+                                     static_cast<int32_t>(vgetq_lane_u32(carry, 0)));
+}
+
+int64_t DeltaDecodeNeon(int64_t* values, int64_t num_values, int64_t min_delta,
+                        int64_t last_value) {
+  const uint64x2_t zero = vdupq_n_u64(0);
+  const uint64x2_t min_delta_v = vdupq_n_u64(static_cast<uint64_t>(min_delta));
+  uint64x2_t carry = vdupq_n_u64(static_cast<uint64_t>(last_value));
+  auto* out = reinterpret_cast<uint64_t*>(values);
+  int64_t i = 0;
+  for (; i + 2 <= num_values; i += 2) {
+    uint64x2_t x = vaddq_u64(vld1q_u64(out + i), min_delta_v);
+    x = vaddq_u64(x, vextq_u64(zero, x, 1));
+    x = vaddq_u64(x, carry);
+    vst1q_u64(out + i, x);
+    carry = vdupq_laneq_u64(x, 1);
+  }
+  return standard::DeltaDecodeScalar(values + i, num_values - i, min_delta,
+                                     static_cast<int64_t>(vgetq_lane_u64(carry, 0)));
+}
+
+template <typename T>
+T DeltaDecodeStandard(T* values, int64_t num_values, T min_delta, T last_value) {
+  return DeltaDecodeNeon(values, num_values, min_delta, last_value);
+}
+#else
+template <typename T>
+T DeltaDecodeStandard(T* values, int64_t num_values, T min_delta, T last_value) {
+  return standard::DeltaDecodeScalar(values, num_values, min_delta, last_value);
+}
+#endif
+
+template <typename T>
+struct DeltaDecodeDynamicFunction {
+  using FunctionType = T (*)(T*, int64_t, T, T);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::NONE, DeltaDecodeStandard<T>}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+            ,
+            {DispatchLevel::AVX2, static_cast<FunctionType>(DeltaDecodeAvx2)}
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+            ,
+            {DispatchLevel::AVX512, static_cast<FunctionType>(DeltaDecodeAvx512)}
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+int32_t DeltaDecode(int32_t* values, int64_t num_values, int32_t min_delta,
+                    int32_t last_value) {
+  static DynamicDispatch<DeltaDecodeDynamicFunction<int32_t>> dispatch;
+  return dispatch.func(values, num_values, min_delta, last_value);
+}
+
+int64_t DeltaDecode(int64_t* values, int64_t num_values, int64_t min_delta,
+                    int64_t last_value) {
+  static DynamicDispatch<DeltaDecodeDynamicFunction<int64_t>> dispatch;
+  return dispatch.func(values, num_values, min_delta, last_value);
+}
+
+}  // namespace parquet::internal
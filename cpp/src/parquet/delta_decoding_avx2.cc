@@ -0,0 +1,72 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#define PARQUET_IMPL_NAMESPACE avx2
+#include "parquet/delta_decoding_inc.h"
+#undef PARQUET_IMPL_NAMESPACE
+
+#include <immintrin.h>
+
+#include "parquet/delta_decoding_simd_internal.h"
+
+namespace parquet::internal {
+
+int32_t DeltaDecodeAvx2(int32_t* values, int64_t num_values, int32_t min_delta,
+                        int32_t last_value) {
+  const __m256i min_delta_v = _mm256_set1_epi32(min_delta);
+  const __m256i last_lane = _mm256_set1_epi32(7);
+  __m256i carry = _mm256_set1_epi32(last_value);
+  int64_t i = 0;
+  for (; i + 8 <= num_values; i += 8) {
+    auto* out = reinterpret_cast<__m256i*>(values + i);
+    __m256i x = _mm256_add_epi32(_mm256_loadu_si256(out), min_delta_v);
+    // Prefix sum within each 128-bit lane...
+    x = _mm256_add_epi32(x, _mm256_slli_si256(x, 4));
+    x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+    // ... then add the total of the low lane to the high lane.
+    const __m256i low_total = _mm256_shuffle_epi32(x, 0xFF);
+    x = _mm256_add_epi32(x, _mm256_permute2x128_si256(low_total, low_total, 0x08));
+    x = _mm256_add_epi32(x, carry);
+    _mm256_storeu_si256(out, x);
+    carry = _mm256_permutevar8x32_epi32(x, last_lane);
+  }
+  return avx2::DeltaDecodeScalar(values + i, num_values - i, min_delta,
+                                 _mm_cvtsi128_si32(_mm256_castsi256_si128(carry)));
+}
+
+int64_t DeltaDecodeAvx2(int64_t* values, int64_t num_values, int64_t min_delta,
+                        int64_t last_value) {
+  const __m256i min_delta_v = _mm256_set1_epi64x(min_delta);
+  __m256i carry = _mm256_set1_epi64x(last_value);
+  int64_t i = 0;
+  for (; i + 4 <= num_values; i += 4) {
+    auto* out = reinterpret_cast<__m256i*>(values + i);
+    __m256i x = _mm256_add_epi64(_mm256_loadu_si256(out), min_delta_v);
+    x = _mm256_add_epi64(x, _mm256_slli_si256(x, 8));
+    const __m256i low_total = _mm256_permute4x64_epi64(x, _MM_SHUFFLE(1, 1, 1, 1));
+    x = _mm256_add_epi64(
+        x, _mm256_blend_epi32(_mm256_setzero_si256(), low_total, 0xF0));
+    x = _mm256_add_epi64(x, carry);
+    _mm256_storeu_si256(out, x);
+    carry = _mm256_permute4x64_epi64(x, _MM_SHUFFLE(3, 3, 3, 3));
+  }
+  return avx2::DeltaDecodeScalar(
+      values + i, num_values - i, min_delta,
+      static_cast<int64_t>(_mm_cvtsi128_si64(_mm256_castsi256_si128(carry))));
+}
+
+}  // namespace parquet::internal
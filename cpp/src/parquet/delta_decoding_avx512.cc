@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#define PARQUET_IMPL_NAMESPACE avx512
+#include "parquet/delta_decoding_inc.h"
+#undef PARQUET_IMPL_NAMESPACE
+
+#include <immintrin.h>
+
+#include "parquet/delta_decoding_simd_internal.h"
+
+namespace parquet::internal {
+
+namespace {
+
+// Shift `v` up by `n` 32-bit elements across the whole register, filling with zeros
+template <int n>
+__m512i ShiftUpEpi32(__m512i v) {
+  return _mm512_alignr_epi32(v, _mm512_setzero_si512(), 16 - n);
+}
+
+template <int n>
+__m512i ShiftUpEpi64(__m512i v) {
+  return _mm512_alignr_epi64(v, _mm512_setzero_si512(), 8 - n);
+}
+
+}  // namespace
+
+int32_t DeltaDecodeAvx512(int32_t* values, int64_t num_values, int32_t min_delta,
+                          int32_t last_value) {
+  const __m512i min_delta_v = _mm512_set1_epi32(min_delta);
+  const __m512i last_element = _mm512_set1_epi32(15);
+  __m512i carry = _mm512_set1_epi32(last_value);
+  int64_t i = 0;
+  for (; i + 16 <= num_values; i += 16) {
+    __m512i x = _mm512_add_epi32(_mm512_loadu_si512(values + i), min_delta_v);
+    // Prefix sum within each 128-bit lane
+    x = _mm512_add_epi32(x, _mm512_bslli_epi128(x, 4));
+    x = _mm512_add_epi32(x, _mm512_bslli_epi128(x, 8));
+    // Prefix sum of the lane totals, added to the following lanes
+    __m512i lane_totals = _mm512_shuffle_epi32(x, _MM_PERM_DDDD);
+    lane_totals = _mm512_add_epi32(lane_totals, ShiftUpEpi32<4>(lane_totals));
+    lane_totals = _mm512_add_epi32(lane_totals, ShiftUpEpi32<8>(lane_totals));
+    x = _mm512_add_epi32(x, ShiftUpEpi32<4>(lane_totals));
+    x = _mm512_add_epi32(x, carry);
+    _mm512_storeu_si512(values + i, x);
+    carry = _mm512_permutexvar_epi32(last_element, x);
+  }
+  return avx512::DeltaDecodeScalar(values + i, num_values - i, min_delta,
+                                   _mm512_cvtsi512_si32(carry));
+}
+
+int64_t DeltaDecodeAvx512(int64_t* values, int64_t num_values, int64_t min_delta,
+                          int64_t last_value) {
+  const __m512i min_delta_v = _mm512_set1_epi64(min_delta);
+  const __m512i last_element = _mm512_set1_epi64(7);
+  __m512i carry = _mm512_set1_epi64(last_value);
+  int64_t i = 0;
+  for (; i + 8 <= num_values; i += 8) {
+    __m512i x = _mm512_add_epi64(_mm512_loadu_si512(values + i), min_delta_v);
+    x = _mm512_add_epi64(x, _mm512_bslli_epi128(x, 8));
+    __m512i lane_totals = _mm512_permutex_epi64(x, _MM_SHUFFLE(3, 3, 1, 1));
+    lane_totals = _mm512_add_epi64(lane_totals, ShiftUpEpi64<2>(lane_totals));
+    lane_totals = _mm512_add_epi64(lane_totals, ShiftUpEpi64<4>(lane_totals));
+    x = _mm512_add_epi64(x, ShiftUpEpi64<2>(lane_totals));
+    x = _mm512_add_epi64(x, carry);
+    _mm512_storeu_si512(values + i, x);
+    carry = _mm512_permutexvar_epi64(last_element, x);
+  }
+  return avx512::DeltaDecodeScalar(
+      values + i, num_values - i, min_delta,
+      static_cast<int64_t>(_mm_cvtsi128_si64(_mm512_castsi512_si128(carry))));
+}
+
+}  // namespace parquet::internal
@@ -0,0 +1,43 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+// Used to make sure ODR rule isn't violated.
+#ifndef PARQUET_IMPL_NAMESPACE
+#  error "PARQUET_IMPL_NAMESPACE must be defined"
+#endif
+namespace parquet::internal::PARQUET_IMPL_NAMESPACE {
+
+/// Scalar DeltaDecode(), also used for the tail of the SIMD implementations.
+template <typename T>
+inline T DeltaDecodeScalar(T* values, int64_t num_values, T min_delta, T last_value) {
+  using UT = std::make_unsigned_t<T>;
+  // Addition between min_delta, packed int and last_value should be treated as
+  // unsigned addition. Overflow is as expected.
+  UT last = static_cast<UT>(last_value);
+  for (int64_t i = 0; i < num_values; ++i) {
+    last += static_cast<UT>(min_delta) + static_cast<UT>(values[i]);
+    values[i] = static_cast<T>(last);
+  }
+  return static_cast<T>(last);
+}
+
+}  // namespace parquet::internal::PARQUET_IMPL_NAMESPACE
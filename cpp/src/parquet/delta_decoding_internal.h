@@ -0,0 +1,38 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "parquet/platform.h"
+
+namespace parquet::internal {
+
+/// \brief Reconstruct DELTA_BINARY_PACKED values from their deltas, in place.
+///
+/// On input, `values` holds the bit-unpacked deltas of a miniblock. On output,
+/// `values[i]` is `last_value` plus the sum of `min_delta + delta` for deltas
+/// 0 to i, computed with wrapping arithmetic as required by the format.
+///
+/// \return the last reconstructed value, or `last_value` if `num_values` is 0
+PARQUET_EXPORT int32_t DeltaDecode(int32_t* values, int64_t num_values,
+                                   int32_t min_delta, int32_t last_value);
+PARQUET_EXPORT int64_t DeltaDecode(int64_t* values, int64_t num_values,
+                                   int64_t min_delta, int64_t last_value);
+
+}  // namespace parquet::internal
@@ -0,0 +1,36 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace parquet::internal {
+
+// Defined in delta_decoding_avx2.cc and delta_decoding_avx512.cc
+
+int32_t DeltaDecodeAvx2(int32_t* values, int64_t num_values, int32_t min_delta,
+                        int32_t last_value);
+int64_t DeltaDecodeAvx2(int64_t* values, int64_t num_values, int64_t min_delta,
+                        int64_t last_value);
+
+int32_t DeltaDecodeAvx512(int32_t* values, int64_t num_values, int32_t min_delta,
+                          int32_t last_value);
+int64_t DeltaDecodeAvx512(int64_t* values, int64_t num_values, int64_t min_delta,
+                          int64_t last_value);
+
+}  // namespace parquet::internal
@@ -134,6 +134,9 @@ struct EncodingTraits<ByteArrayType> {
   /// and `BinaryViewBuilder`.
   /// If the builder is a `BinaryBuilder`, `chunks` can accumulate several
   /// arrays as needed to work around the 32-bit offset limit.
+  /// If the builder is a `BinaryViewBuilder`, PLAIN decoders given their data with
+  /// `SetDataFromBuffer` and dictionary decoders append views into the page data
+  /// and the dictionary respectively, instead of copying the values.
   struct Accumulator {
     std::unique_ptr<::arrow::ArrayBuilder> builder;
     std::vector<std::shared_ptr<::arrow::Array>> chunks;
@@ -257,6 +260,14 @@ class Decoder {
   // directly relates to the number of physical values.
   virtual void SetData(int num_values, const uint8_t* data, int len) = 0;
 
+  // Like SetData(), for data held by `buffer`. Decoders producing Arrow BinaryView
+  // data may reference the values in `buffer` instead of copying them, so its
+  // contents must not be modified while the decoded arrays are alive.
+  virtual void SetDataFromBuffer(int num_values, std::shared_ptr<::arrow::Buffer> buffer,
+                                 const uint8_t* data, int len) {
+    SetData(num_values, data, len);
+  }
+
   // Returns the number of values left (for the last call to SetData()). This is
   // the number of values left in this page.
   virtual int values_left() const = 0;
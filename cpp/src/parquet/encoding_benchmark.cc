@@ -31,12 +31,21 @@
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/util/byte_stream_split_internal.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/visit_data_inline.h"
 
+#include "parquet/delta_decoding_internal.h"
+#if defined(ARROW_HAVE_RUNTIME_AVX2) || defined(ARROW_HAVE_RUNTIME_AVX512)
+#  include "parquet/delta_decoding_simd_internal.h"
+#endif
 #include "parquet/encoding.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 
+#define PARQUET_IMPL_NAMESPACE standard
+#include "parquet/delta_decoding_inc.h"
+#undef PARQUET_IMPL_NAMESPACE
+
 using arrow::default_memory_pool;
 using arrow::MemoryPool;
 
@@ -51,6 +60,8 @@ namespace parquet {
 
 using schema::PrimitiveNode;
 
+using ::arrow::internal::CpuInfo;
+
 std::shared_ptr<ColumnDescriptor> Int64Schema(Repetition::type repetition) {
   auto node = PrimitiveNode::Make("int64", repetition, Type::INT64);
   return std::make_shared<ColumnDescriptor>(node, repetition != Repetition::REQUIRED,
@@ -494,6 +505,18 @@ static void BM_ByteStreamSplitEncode_Double_Scalar(benchmark::State& state) {
       state, ::arrow::util::internal::ByteStreamSplitEncodeScalar<sizeof(double)>);
 }
 
+template <int N>
+static void BM_ByteStreamSplitDecode_FLBA_Scalar(benchmark::State& state) {
+  BM_ByteStreamSplitDecode<std::array<int8_t, N>>(
+      state, ::arrow::util::internal::ByteStreamSplitDecodeScalarDynamic);
+}
+
+template <int N>
+static void BM_ByteStreamSplitEncode_FLBA_Scalar(benchmark::State& state) {
+  BM_ByteStreamSplitEncode<std::array<int8_t, N>>(
+      state, ::arrow::util::internal::ByteStreamSplitEncodeScalarDynamic);
+}
+
 static void ByteStreamSplitApply(::benchmark::internal::Benchmark* bench) {
   // Reduce the number of variations by only testing the two range ends.
   bench->Arg(MIN_RANGE)->Arg(MAX_RANGE);
@@ -503,6 +526,8 @@ BENCHMARK(BM_ByteStreamSplitDecode_Float_Generic)->Apply(ByteStreamSplitApply);
 BENCHMARK(BM_ByteStreamSplitDecode_Double_Generic)->Apply(ByteStreamSplitApply);
 BENCHMARK_TEMPLATE(BM_ByteStreamSplitDecode_FLBA_Generic, 2)->Apply(ByteStreamSplitApply);
 BENCHMARK_TEMPLATE(BM_ByteStreamSplitDecode_FLBA_Generic, 7)->Apply(ByteStreamSplitApply);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitDecode_FLBA_Generic, 12)
+    ->Apply(ByteStreamSplitApply);
 BENCHMARK_TEMPLATE(BM_ByteStreamSplitDecode_FLBA_Generic, 16)
     ->Apply(ByteStreamSplitApply);
 
@@ -510,6 +535,8 @@ BENCHMARK(BM_ByteStreamSplitEncode_Float_Generic)->Apply(ByteStreamSplitApply);
 BENCHMARK(BM_ByteStreamSplitEncode_Double_Generic)->Apply(ByteStreamSplitApply);
 BENCHMARK_TEMPLATE(BM_ByteStreamSplitEncode_FLBA_Generic, 2)->Apply(ByteStreamSplitApply);
 BENCHMARK_TEMPLATE(BM_ByteStreamSplitEncode_FLBA_Generic, 7)->Apply(ByteStreamSplitApply);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitEncode_FLBA_Generic, 12)
+    ->Apply(ByteStreamSplitApply);
 BENCHMARK_TEMPLATE(BM_ByteStreamSplitEncode_FLBA_Generic, 16)
     ->Apply(ByteStreamSplitApply);
 
@@ -519,6 +546,12 @@ BENCHMARK(BM_ByteStreamSplitDecode_Double_Scalar)->Apply(ByteStreamSplitApply);
 BENCHMARK(BM_ByteStreamSplitEncode_Int16_Scalar)->Apply(ByteStreamSplitApply);
 BENCHMARK(BM_ByteStreamSplitEncode_Float_Scalar)->Apply(ByteStreamSplitApply);
 BENCHMARK(BM_ByteStreamSplitEncode_Double_Scalar)->Apply(ByteStreamSplitApply);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitDecode_FLBA_Scalar, 7)->Apply(ByteStreamSplitApply);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitDecode_FLBA_Scalar, 12)->Apply(ByteStreamSplitApply);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitDecode_FLBA_Scalar, 16)->Apply(ByteStreamSplitApply);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitEncode_FLBA_Scalar, 7)->Apply(ByteStreamSplitApply);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitEncode_FLBA_Scalar, 12)->Apply(ByteStreamSplitApply);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitEncode_FLBA_Scalar, 16)->Apply(ByteStreamSplitApply);
 
 #if defined(ARROW_HAVE_SSE4_2)
 static void BM_ByteStreamSplitDecode_Int16_Sse2(benchmark::State& state) {
@@ -616,6 +649,45 @@ static void BM_ByteStreamSplitEncode_Float_Avx2_xsimd(benchmark::State& state) {
 BENCHMARK(BM_ByteStreamSplitEncode_Float_Avx2_xsimd)->Apply(ByteStreamSplitApply);
 #endif
 
+#if defined(ARROW_HAVE_AVX512)
+static void BM_ByteStreamSplitDecode_Int16_Avx512(benchmark::State& state) {
+  BM_ByteStreamSplitDecode<int16_t>(
+      state, ::arrow::util::internal::ByteStreamSplitDecodeAvx512<sizeof(int16_t)>);
+}
+
+static void BM_ByteStreamSplitDecode_Float_Avx512(benchmark::State& state) {
+  BM_ByteStreamSplitDecode<float>(
+      state, ::arrow::util::internal::ByteStreamSplitDecodeAvx512<sizeof(float)>);
+}
+
+static void BM_ByteStreamSplitDecode_Double_Avx512(benchmark::State& state) {
+  BM_ByteStreamSplitDecode<double>(
+      state, ::arrow::util::internal::ByteStreamSplitDecodeAvx512<sizeof(double)>);
+}
+
+static void BM_ByteStreamSplitEncode_Int16_Avx512(benchmark::State& state) {
+  BM_ByteStreamSplitEncode<int16_t>(
+      state, ::arrow::util::internal::ByteStreamSplitEncodeAvx512<sizeof(int16_t)>);
+}
+
+static void BM_ByteStreamSplitEncode_Float_Avx512(benchmark::State& state) {
+  BM_ByteStreamSplitEncode<float>(
+      state, ::arrow::util::internal::ByteStreamSplitEncodeAvx512<sizeof(float)>);
+}
+
+static void BM_ByteStreamSplitEncode_Double_Avx512(benchmark::State& state) {
+  BM_ByteStreamSplitEncode<double>(
+      state, ::arrow::util::internal::ByteStreamSplitEncodeAvx512<sizeof(double)>);
+}
+
+BENCHMARK(BM_ByteStreamSplitDecode_Int16_Avx512)->Apply(ByteStreamSplitApply);
+BENCHMARK(BM_ByteStreamSplitDecode_Float_Avx512)->Apply(ByteStreamSplitApply);
+BENCHMARK(BM_ByteStreamSplitDecode_Double_Avx512)->Apply(ByteStreamSplitApply);
+BENCHMARK(BM_ByteStreamSplitEncode_Int16_Avx512)->Apply(ByteStreamSplitApply);
+BENCHMARK(BM_ByteStreamSplitEncode_Float_Avx512)->Apply(ByteStreamSplitApply);
+BENCHMARK(BM_ByteStreamSplitEncode_Double_Avx512)->Apply(ByteStreamSplitApply);
+#endif
+
 #if defined(ARROW_HAVE_NEON)
 static void BM_ByteStreamSplitDecode_Int16_Neon(benchmark::State& state) {
   BM_ByteStreamSplitDecode<int16_t>(
@@ -661,6 +733,30 @@ BENCHMARK(BM_ByteStreamSplitEncode_Float_Neon)->Apply(ByteStreamSplitApply);
 BENCHMARK(BM_ByteStreamSplitEncode_Double_Neon)->Apply(ByteStreamSplitApply);
 #endif
 
+#if defined(ARROW_HAVE_SVE256) || defined(ARROW_HAVE_SVE512)
+static void BM_ByteStreamSplitDecode_Int16_Sve(benchmark::State& state) {
+  BM_ByteStreamSplitDecode<int16_t>(
+      state,
+      ::arrow::util::internal::ByteStreamSplitDecodeSimd<xsimd::sve, sizeof(int16_t)>);
+}
+
+static void BM_ByteStreamSplitDecode_Float_Sve(benchmark::State& state) {
+  BM_ByteStreamSplitDecode<float>(
+      state,
+      ::arrow::util::internal::ByteStreamSplitDecodeSimd<xsimd::sve, sizeof(float)>);
+}
+
+static void BM_ByteStreamSplitDecode_Double_Sve(benchmark::State& state) {
+  BM_ByteStreamSplitDecode<double>(
+      state,
+      ::arrow::util::internal::ByteStreamSplitDecodeSimd<xsimd::sve, sizeof(double)>);
+}
+
+BENCHMARK(BM_ByteStreamSplitDecode_Int16_Sve)->Apply(ByteStreamSplitApply);
+BENCHMARK(BM_ByteStreamSplitDecode_Float_Sve)->Apply(ByteStreamSplitApply);
+BENCHMARK(BM_ByteStreamSplitDecode_Double_Sve)->Apply(ByteStreamSplitApply);
+#endif
+
 template <typename DType>
 static auto MakeDeltaBitPackingInputFixed(size_t length) {
   using T = typename DType::c_type;
@@ -777,6 +873,92 @@ BENCHMARK(BM_DeltaBitPackingDecode_Int64_Narrow)->Range(MIN_RANGE, MAX_RANGE);
 BENCHMARK(BM_DeltaBitPackingDecode_Int32_Wide)->Range(MIN_RANGE, MAX_RANGE);
 BENCHMARK(BM_DeltaBitPackingDecode_Int64_Wide)->Range(MIN_RANGE, MAX_RANGE);
 
+// Benchmark the reconstruction of values from unpacked deltas alone, as done by the
+// DELTA_BINARY_PACKED decoder for each miniblock.
+template <typename T, typename DeltaDecodeFunc>
+static void BM_DeltaDecode(benchmark::State& state, DeltaDecodeFunc&& func) {
+  std::vector<T> deltas(state.range(0));
+  ::arrow::randint<T, T>(deltas.size(), 0, 1000, &deltas);
+  std::vector<T> values(deltas.size());
+  for (auto _ : state) {
+    std::copy(deltas.begin(), deltas.end(), values.begin());
+    benchmark::DoNotOptimize(
+        func(values.data(), static_cast<int64_t>(values.size()), T{-500}, T{0}));
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_DeltaDecode_Int32_Scalar(benchmark::State& state) {
+  BM_DeltaDecode<int32_t>(state, internal::standard::DeltaDecodeScalar<int32_t>);
+}
+
+static void BM_DeltaDecode_Int64_Scalar(benchmark::State& state) {
+  BM_DeltaDecode<int64_t>(state, internal::standard::DeltaDecodeScalar<int64_t>);
+}
+
+static void BM_DeltaDecode_Int32_Dispatch(benchmark::State& state) {
+  BM_DeltaDecode<int32_t>(
+      state, [](auto... args) { return internal::DeltaDecode(args...); });
+}
+
+static void BM_DeltaDecode_Int64_Dispatch(benchmark::State& state) {
+  BM_DeltaDecode<int64_t>(
+      state, [](auto... args) { return internal::DeltaDecode(args...); });
+}
+
+BENCHMARK(BM_DeltaDecode_Int32_Scalar)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaDecode_Int64_Scalar)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaDecode_Int32_Dispatch)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaDecode_Int64_Dispatch)->Range(MIN_RANGE, MAX_RANGE);
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+static void BM_DeltaDecode_Int32_Avx2(benchmark::State& state) {
+  if (!CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX2)) {
+    state.SkipWithError("AVX2 not supported");
+    return;
+  }
+  BM_DeltaDecode<int32_t>(
+      state, [](auto... args) { return internal::DeltaDecodeAvx2(args...); });
+}
+
+static void BM_DeltaDecode_Int64_Avx2(benchmark::State& state) {
+  if (!CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX2)) {
+    state.SkipWithError("AVX2 not supported");
+    return;
+  }
+  BM_DeltaDecode<int64_t>(
+      state, [](auto... args) { return internal::DeltaDecodeAvx2(args...); });
+}
+
+BENCHMARK(BM_DeltaDecode_Int32_Avx2)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaDecode_Int64_Avx2)->Range(MIN_RANGE, MAX_RANGE);
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+static void BM_DeltaDecode_Int32_Avx512(benchmark::State& state) {
+  if (!CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX512)) {
+    state.SkipWithError("AVX512 not supported");
+    return;
+  }
+  BM_DeltaDecode<int32_t>(
+      state, [](auto... args) { return internal::DeltaDecodeAvx512(args...); });
+}
+
+static void BM_DeltaDecode_Int64_Avx512(benchmark::State& state) {
+  if (!CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX512)) {
+    state.SkipWithError("AVX512 not supported");
+    return;
+  }
+  BM_DeltaDecode<int64_t>(
+      state, [](auto... args) { return internal::DeltaDecodeAvx512(args...); });
+}
+
+BENCHMARK(BM_DeltaDecode_Int32_Avx512)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaDecode_Int64_Avx512)->Range(MIN_RANGE, MAX_RANGE);
+#endif
+
 static void ByteArrayCustomArguments(benchmark::internal::Benchmark* b) {
   b->ArgsProduct({{8, 64, 1024}, {512, 2048}})
       ->ArgNames({"max-string-length", "batch-size"});
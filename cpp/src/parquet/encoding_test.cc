@@ -41,6 +41,7 @@
 #include "arrow/util/endian.h"
 #include "arrow/util/span.h"
 #include "arrow/util/string.h"
+#include "parquet/delta_decoding_internal.h"
 #include "parquet/encoding.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
@@ -1967,6 +1968,38 @@ TYPED_TEST(TestDeltaBitPackEncoding, DeltaBitPackedSize) {
   ASSERT_EQ(encoded->size(), encoded_size);
 }
 
+// Test the (possibly SIMD) reconstruction of values from deltas against a scalar
+// loop, for all lengths around the vector widths and with wrapping arithmetic.
+TYPED_TEST(TestDeltaBitPackEncoding, DeltaDecodeKernel) {
+  using T = typename TypeParam::c_type;
+  using UT = std::make_unsigned_t<T>;
+  constexpr int kMaxValues = 100;
+
+  std::vector<T> deltas(kMaxValues);
+  ::arrow::randint<T, T>(kMaxValues, std::numeric_limits<T>::min(),
+                         std::numeric_limits<T>::max(), &deltas);
+  for (const T min_delta : {T{0}, T{-7}, std::numeric_limits<T>::min()}) {
+    for (const T last_value : {T{0}, T{42}, std::numeric_limits<T>::max()}) {
+      for (int num_values = 0; num_values <= kMaxValues; ++num_values) {
+        ARROW_SCOPED_TRACE("num_values = ", num_values, ", min_delta = ", min_delta,
+                           ", last_value = ", last_value);
+        std::vector<T> expected(deltas.begin(), deltas.begin() + num_values);
+        UT last = static_cast<UT>(last_value);
+        for (T& value : expected) {
+          last += static_cast<UT>(min_delta) + static_cast<UT>(value);
+          value = static_cast<T>(last);
+        }
+
+        std::vector<T> values(deltas.begin(), deltas.begin() + num_values);
+        const T result =
+            internal::DeltaDecode(values.data(), num_values, min_delta, last_value);
+        ASSERT_EQ(static_cast<T>(last), result);
+        ASSERT_EQ(expected, values);
+      }
+    }
+  }
+}
+
 // ----------------------------------------------------------------------
 // Rle for Boolean encode/decode tests.
 
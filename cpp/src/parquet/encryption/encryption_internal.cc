@@ -26,6 +26,7 @@
 #include <array>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -98,6 +99,49 @@ class AesCryptoContext {
     return ctx;
   }
 
+  // A cipher context in use by an encryption or decryption call. It is given back
+  // to the owning AesCryptoContext on destruction, so that the next call only has
+  // to set its key and IV instead of allocating and initializing a new context.
+  class CachedCipherContext {
+   public:
+    CachedCipherContext(const AesCryptoContext* owner, CipherContext ctx)
+        : owner_(owner), ctx_(std::move(ctx)) {}
+    ~CachedCipherContext() { owner_->ReleaseCipherContext(std::move(ctx_)); }
+
+    CachedCipherContext(const CachedCipherContext&) = delete;
+    CachedCipherContext& operator=(const CachedCipherContext&) = delete;
+
+    EVP_CIPHER_CTX* get() const { return ctx_.get(); }
+
+   private:
+    const AesCryptoContext* owner_;
+    CipherContext ctx_;
+  };
+
+  // Take a context initialized with this cipher out of the cache, or return a null
+  // context if there is none.
+  CipherContext TakeCachedCipherContext() const {
+    std::lock_guard<std::mutex> lock(cached_contexts_mutex_);
+    if (cached_contexts_.empty()) {
+      return CipherContext(nullptr, DeleteCipherContext);
+    }
+    CipherContext ctx = std::move(cached_contexts_.back());
+    cached_contexts_.pop_back();
+    return ctx;
+  }
+
+  void ReleaseCipherContext(CipherContext ctx) const {
+    std::lock_guard<std::mutex> lock(cached_contexts_mutex_);
+    if (cached_contexts_.size() < kMaxCachedCipherContexts) {
+      cached_contexts_.push_back(std::move(ctx));
+    }
+  }
+
+  // One context per thread concurrently using this encryptor or decryptor
+  static constexpr size_t kMaxCachedCipherContexts = 16;
+  mutable std::mutex cached_contexts_mutex_;
+  mutable std::vector<CipherContext> cached_contexts_;
+
   int32_t aes_mode_;
   int32_t key_length_;
   int32_t ciphertext_size_delta_;
@@ -133,7 +177,8 @@ class AesEncryptor::AesEncryptorImpl : public AesCryptoContext {
   }
 
  private:
-  [[nodiscard]] CipherContext MakeCipherContext() const;
+  // Return a context initialized with this cipher, to be keyed by the caller
+  [[nodiscard]] CachedCipherContext MakeCipherContext() const;
 
   int32_t GcmEncrypt(span<const uint8_t> plaintext, span<const uint8_t> key,
                      span<const uint8_t> nonce, span<const uint8_t> aad,
@@ -148,9 +193,13 @@ AesEncryptor::AesEncryptorImpl::AesEncryptorImpl(ParquetCipher::type alg_id,
                                                  bool write_length)
     : AesCryptoContext(alg_id, key_len, metadata, write_length) {}
 
-AesCryptoContext::CipherContext AesEncryptor::AesEncryptorImpl::MakeCipherContext()
-    const {
-  auto ctx = NewCipherContext();
+AesCryptoContext::CachedCipherContext
+AesEncryptor::AesEncryptorImpl::MakeCipherContext() const {
+  CipherContext ctx = TakeCachedCipherContext();
+  if (ctx) {
+    return CachedCipherContext(this, std::move(ctx));
+  }
+  ctx = NewCipherContext();
   if (kGcmMode == aes_mode_) {
     // Init AES-GCM with specified key length
     if (16 == key_length_) {
@@ -170,7 +219,7 @@ AesCryptoContext::CipherContext AesEncryptor::AesEncryptorImpl::MakeCipherContex
       ENCRYPT_INIT(ctx.get(), EVP_aes_256_ctr());
     }
   }
-  return ctx;
+  return CachedCipherContext(this, std::move(ctx));
 }
 
 int32_t AesEncryptor::AesEncryptorImpl::SignedFooterEncrypt(
@@ -427,7 +476,8 @@ class AesDecryptor::AesDecryptorImpl : AesCryptoContext {
   }
 
  private:
-  [[nodiscard]] CipherContext MakeCipherContext() const;
+  // Return a context initialized with this cipher, to be keyed by the caller
+  [[nodiscard]] CachedCipherContext MakeCipherContext() const;
 
   /// Get the actual ciphertext length, inclusive of the length buffer length,
   /// and validate that the provided buffer size is large enough.
@@ -452,9 +502,13 @@ AesDecryptor::AesDecryptorImpl::AesDecryptorImpl(ParquetCipher::type alg_id,
                                                  bool contains_length)
     : AesCryptoContext(alg_id, key_len, metadata, contains_length) {}
 
-AesCryptoContext::CipherContext AesDecryptor::AesDecryptorImpl::MakeCipherContext()
-    const {
-  auto ctx = NewCipherContext();
+AesCryptoContext::CachedCipherContext
+AesDecryptor::AesDecryptorImpl::MakeCipherContext() const {
+  CipherContext ctx = TakeCachedCipherContext();
+  if (ctx) {
+    return CachedCipherContext(this, std::move(ctx));
+  }
+  ctx = NewCipherContext();
   if (kGcmMode == aes_mode_) {
     // Init AES-GCM with specified key length
     if (16 == key_length_) {
@@ -474,7 +528,7 @@ AesCryptoContext::CipherContext AesDecryptor::AesDecryptorImpl::MakeCipherContex
       DECRYPT_INIT(ctx.get(), EVP_aes_256_ctr());
     }
   }
-  return ctx;
+  return CachedCipherContext(this, std::move(ctx));
 }
 
 std::unique_ptr<AesEncryptor> AesEncryptor::Make(ParquetCipher::type alg_id,
@@ -45,6 +45,8 @@ constexpr int8_t kBloomFilterHeader = 8;
 constexpr int8_t kBloomFilterBitset = 9;
 
 /// Performs AES encryption operations with GCM or CTR ciphers.
+///
+/// Calls may be made concurrently. OpenSSL cipher contexts are reused across calls.
 class PARQUET_EXPORT AesEncryptor {
  public:
   /// Can serve one key length only. Possible values: 16, 24, 32 bytes.
@@ -81,6 +83,8 @@ class PARQUET_EXPORT AesEncryptor {
 };
 
 /// Performs AES decryption operations with GCM or CTR ciphers.
+///
+/// Calls may be made concurrently. OpenSSL cipher contexts are reused across calls.
 class PARQUET_EXPORT AesDecryptor {
  public:
   /// \brief Construct an AesDecryptor
@@ -49,7 +49,13 @@ int32_t Decryptor::CiphertextLength(int32_t plaintext_len) const {
 
 int32_t Decryptor::Decrypt(::arrow::util::span<const uint8_t> ciphertext,
                            ::arrow::util::span<uint8_t> plaintext) {
-  return aes_decryptor_->Decrypt(ciphertext, key_.as_span(), str2span(aad_), plaintext);
+  return Decrypt(ciphertext, plaintext, aad_);
+}
+
+int32_t Decryptor::Decrypt(::arrow::util::span<const uint8_t> ciphertext,
+                           ::arrow::util::span<uint8_t> plaintext,
+                           const std::string& aad) const {
+  return aes_decryptor_->Decrypt(ciphertext, key_.as_span(), str2span(aad), plaintext);
 }
 
 // InternalFileDecryptor
@@ -47,6 +47,7 @@ class PARQUET_EXPORT Decryptor {
   ~Decryptor();
 
   const std::string& file_aad() const { return file_aad_; }
+  const std::string& aad() const { return aad_; }
   void UpdateAad(const std::string& aad) { aad_ = aad; }
   ::arrow::MemoryPool* pool() { return pool_; }
 
@@ -54,6 +55,10 @@ class PARQUET_EXPORT Decryptor {
   [[nodiscard]] int32_t CiphertextLength(int32_t plaintext_len) const;
   int32_t Decrypt(::arrow::util::span<const uint8_t> ciphertext,
                   ::arrow::util::span<uint8_t> plaintext);
+  /// Decrypt with the given AAD rather than the current one. Unlike UpdateAad(),
+  /// this may be called concurrently from several threads.
+  int32_t Decrypt(::arrow::util::span<const uint8_t> ciphertext,
+                  ::arrow::util::span<uint8_t> plaintext, const std::string& aad) const;
 
  private:
   std::unique_ptr<encryption::AesDecryptor> aes_decryptor_;
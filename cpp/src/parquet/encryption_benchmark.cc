@@ -0,0 +1,150 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/io/memory.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/secure_string.h"
+#include "parquet/arrow/reader.h"
+#include "parquet/arrow/writer.h"
+#include "parquet/encryption/encryption.h"
+#include "parquet/encryption/encryption_internal.h"
+#include "parquet/file_reader.h"
+#include "parquet/platform.h"
+#include "parquet/properties.h"
+
+namespace parquet {
+
+using ::arrow::util::SecureString;
+
+namespace benchmarks {
+
+namespace {
+
+const SecureString kFooterKey("0123456789012345");
+const std::string kAad = "benchmark module aad";
+
+constexpr int64_t kNumRows = 1 << 20;
+constexpr int kNumColumns = 4;
+
+}  // namespace
+
+// Raw AES throughput on a buffer the size of a data page
+
+static void AesGcmEncrypt(::benchmark::State& state) {
+  const auto plaintext_len = static_cast<int32_t>(state.range(0));
+  auto encryptor = encryption::AesEncryptor::Make(ParquetCipher::AES_GCM_V1, 16,
+                                                  /*metadata=*/false);
+  std::vector<uint8_t> plaintext(plaintext_len, 0x5a);
+  std::vector<uint8_t> ciphertext(encryptor->CiphertextLength(plaintext_len));
+
+  for (auto _ : state) {
+    encryptor->Encrypt(plaintext, kFooterKey.as_span(), str2span(kAad), ciphertext);
+    ::benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * plaintext_len);
+}
+
+static void AesGcmDecrypt(::benchmark::State& state) {
+  const auto plaintext_len = static_cast<int32_t>(state.range(0));
+  auto encryptor = encryption::AesEncryptor::Make(ParquetCipher::AES_GCM_V1, 16,
+                                                  /*metadata=*/false);
+  auto decryptor = encryption::AesDecryptor::Make(ParquetCipher::AES_GCM_V1, 16,
+                                                  /*metadata=*/false);
+  std::vector<uint8_t> plaintext(plaintext_len, 0x5a);
+  std::vector<uint8_t> ciphertext(encryptor->CiphertextLength(plaintext_len));
+  encryptor->Encrypt(plaintext, kFooterKey.as_span(), str2span(kAad), ciphertext);
+
+  for (auto _ : state) {
+    decryptor->Decrypt(ciphertext, kFooterKey.as_span(), str2span(kAad), plaintext);
+    ::benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * plaintext_len);
+}
+
+BENCHMARK(AesGcmEncrypt)->Arg(64 * 1024)->Arg(1024 * 1024);
+BENCHMARK(AesGcmDecrypt)->Arg(64 * 1024)->Arg(1024 * 1024);
+
+// Reading a whole file, encrypted or not, with or without page readahead
+
+static std::shared_ptr<::arrow::Table> MakeTable() {
+  ::arrow::random::RandomArrayGenerator rag(42);
+  ::arrow::FieldVector fields;
+  ::arrow::ArrayVector columns;
+  for (int i = 0; i < kNumColumns; ++i) {
+    fields.push_back(::arrow::field("c" + std::to_string(i), ::arrow::int64(),
+                                    /*nullable=*/false));
+    columns.push_back(rag.Int64(kNumRows, 0, 1LL << 40, /*null_probability=*/0));
+  }
+  return ::arrow::Table::Make(::arrow::schema(fields), columns);
+}
+
+static void ReadFile(::benchmark::State& state, bool encrypted) {
+  const auto page_readahead = static_cast<int32_t>(state.range(0));
+  auto table = MakeTable();
+
+  WriterProperties::Builder writer_builder;
+  // Unique values: keep plain encoding so that pages are large
+  writer_builder.disable_dictionary();
+  if (encrypted) {
+    writer_builder.encryption(FileEncryptionProperties::Builder(kFooterKey).build());
+  }
+  auto output = CreateOutputStream();
+  ABORT_NOT_OK(arrow::WriteTable(*table, ::arrow::default_memory_pool(), output,
+                                 kNumRows, writer_builder.build()));
+  PARQUET_ASSIGN_OR_THROW(auto buffer, output->Finish());
+
+  ReaderProperties properties;
+  properties.set_page_readahead(page_readahead);
+  if (encrypted) {
+    properties.file_decryption_properties(
+        FileDecryptionProperties::Builder().footer_key(kFooterKey)->build());
+  }
+
+  for (auto _ : state) {
+    auto reader = ParquetFileReader::Open(
+        std::make_shared<::arrow::io::BufferReader>(buffer), properties);
+    std::unique_ptr<arrow::FileReader> arrow_reader;
+    ASSIGN_OR_ABORT(arrow_reader,
+                    arrow::FileReader::Make(::arrow::default_memory_pool(),
+                                            std::move(reader)));
+    std::shared_ptr<::arrow::Table> result;
+    ASSIGN_OR_ABORT(result, arrow_reader->ReadTable());
+    ::benchmark::DoNotOptimize(result);
+  }
+  state.SetBytesProcessed(state.iterations() * kNumRows * kNumColumns *
+                          static_cast<int64_t>(sizeof(int64_t)));
+}
+
+static void ReadPlainFile(::benchmark::State& state) { ReadFile(state, false); }
+
+static void ReadEncryptedFile(::benchmark::State& state) { ReadFile(state, true); }
+
+BENCHMARK(ReadPlainFile)->ArgName("page_readahead")->Arg(0)->Arg(4)->UseRealTime();
+BENCHMARK(ReadEncryptedFile)->ArgName("page_readahead")->Arg(0)->Arg(4)->UseRealTime();
+
+}  // namespace benchmarks
+
+}  // namespace parquet
@@ -196,9 +196,11 @@ class TestPageSerde : public ::testing::Test {
 
   void TestPageSerdeCrc(bool write_checksum, bool write_page_corrupt,
                         bool verification_checksum, bool has_dictionary = false,
-                        bool write_data_page_v2 = false);
+                        bool write_data_page_v2 = false, int32_t page_readahead = 0);
 
-  void TestPageCompressionRoundTrip(const std::vector<int>& page_sizes);
+  void TestPageCompressionRoundTrip(
+      const std::vector<int>& page_sizes,
+      const ReaderProperties& properties = ReaderProperties());
 
  protected:
   std::shared_ptr<::arrow::io::BufferOutputStream> out_stream_;
@@ -214,7 +216,7 @@ class TestPageSerde : public ::testing::Test {
 
 void TestPageSerde::TestPageSerdeCrc(bool write_checksum, bool write_page_corrupt,
                                      bool verification_checksum, bool has_dictionary,
-                                     bool write_data_page_v2) {
+                                     bool write_data_page_v2, int32_t page_readahead) {
   auto codec_types = GetSupportedCodecTypes();
   codec_types.push_back(Compression::UNCOMPRESSED);
   const int32_t num_rows = 32;  // dummy value
@@ -278,6 +280,7 @@ void TestPageSerde::TestPageSerdeCrc(bool write_checksum, bool write_page_corrup
     }
     ReaderProperties readerProperties;
     readerProperties.set_page_checksum_verification(verification_checksum);
+    readerProperties.set_page_readahead(page_readahead);
     InitSerializedPageReader(num_rows * num_pages, codec_type, readerProperties);
 
     for (int i = 0; i < num_pages; ++i) {
@@ -708,7 +711,8 @@ TEST_F(TestPageSerde, TestFailLargePageHeaders) {
   ASSERT_THROW(page_reader_->NextPage(), ParquetException);
 }
 
-void TestPageSerde::TestPageCompressionRoundTrip(const std::vector<int>& page_sizes) {
+void TestPageSerde::TestPageCompressionRoundTrip(const std::vector<int>& page_sizes,
+                                                 const ReaderProperties& properties) {
   auto codec_types = GetSupportedCodecTypes();
 
   const int32_t num_rows = 32;  // dummy value
@@ -740,7 +744,7 @@ void TestPageSerde::TestPageCompressionRoundTrip(const std::vector<int>& page_si
       ASSERT_OK(out_stream_->Write(buffer.data(), actual_size));
     }
 
-    InitSerializedPageReader(num_rows * num_pages, codec_type);
+    InitSerializedPageReader(num_rows * num_pages, codec_type, properties);
 
     std::shared_ptr<Page> page;
     const DataPageV1* data_page;
@@ -751,6 +755,7 @@ void TestPageSerde::TestPageCompressionRoundTrip(const std::vector<int>& page_si
       ASSERT_EQ(data_size, data_page->size());
       ASSERT_EQ(0, memcmp(faux_data[i].data(), data_page->data(), data_size));
     }
+    ASSERT_EQ(nullptr, page_reader_->NextPage());
 
     ResetStream();
   }
@@ -778,6 +783,49 @@ TEST_F(TestPageSerde, PageSizeResetWhenRead) {
   this->TestPageCompressionRoundTrip(page_sizes);
 }
 
+TEST_F(TestPageSerde, CompressionWithPageReadahead) {
+  std::vector<int> page_sizes;
+  page_sizes.reserve(10);
+  for (int i = 0; i < 10; ++i) {
+    page_sizes.push_back((i + 1) * 64);
+  }
+  ReaderProperties properties;
+  properties.set_page_readahead(3);
+  this->TestPageCompressionRoundTrip(page_sizes, properties);
+
+  // A memory limit below the size of a single page still reads one page ahead
+  properties.set_page_readahead_memory_limit(1);
+  this->TestPageCompressionRoundTrip(page_sizes, properties);
+}
+
+TEST_F(TestPageSerde, PageReadaheadDefersErrors) {
+  const int32_t num_rows = 32;
+  data_page_header_.num_values = num_rows;
+  std::vector<uint8_t> faux_data;
+  test::random_bytes(64, 0, &faux_data);
+  uint32_t checksum = ::arrow::internal::crc32(/*prev=*/0, faux_data.data(), 64);
+  ASSERT_NO_FATAL_FAILURE(WriteDataPageHeader(1024, 64, 64, checksum));
+  ASSERT_OK(out_stream_->Write(faux_data.data(), 64));
+  // The second page has a bad checksum
+  ASSERT_NO_FATAL_FAILURE(WriteDataPageHeader(1024, 64, 64, checksum + 1));
+  ASSERT_OK(out_stream_->Write(faux_data.data(), 64));
+
+  ReaderProperties properties;
+  properties.set_page_checksum_verification(true);
+  properties.set_page_readahead(4);
+  InitSerializedPageReader(num_rows * 2, Compression::UNCOMPRESSED, properties);
+
+  // The first page is returned although reading ahead already failed
+  const auto page = page_reader_->NextPage();
+  ASSERT_NE(nullptr, page);
+  const auto data_page = static_cast<const DataPageV1*>(page.get());
+  ASSERT_EQ(0, memcmp(faux_data.data(), data_page->data(), 64));
+  EXPECT_THROW_THAT([&]() { page_reader_->NextPage(); }, ParquetException,
+                    ::testing::Property(
+                        &ParquetException::what,
+                        ::testing::HasSubstr("CRC checksum verification failed")));
+}
+
 TEST_F(TestPageSerde, LZONotSupported) {
   // Must await PARQUET-530
   int data_size = 1024;
@@ -827,6 +875,16 @@ TEST_F(TestPageSerde, CrcCheckFail) {
                          /* verification_checksum */ true);
 }
 
+TEST_F(TestPageSerde, CrcCheckWithPageReadahead) {
+  // Checksums are verified on the thread pool
+  this->TestPageSerdeCrc(/* write_checksum */ true, /* write_page_corrupt */ false,
+                         /* verification_checksum */ true, /* has_dictionary */ true,
+                         /* write_data_page_v2 */ false, /* page_readahead */ 3);
+  this->TestPageSerdeCrc(/* write_checksum */ true, /* write_page_corrupt */ true,
+                         /* verification_checksum */ true, /* has_dictionary */ true,
+                         /* write_data_page_v2 */ false, /* page_readahead */ 3);
+}
+
 TEST_F(TestPageSerde, CrcCorruptNotChecked) {
   this->TestPageSerdeCrc(/* write_checksum */ true, /* write_page_corrupt */ true,
                          /* verification_checksum */ false);
@@ -20,20 +20,26 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <unordered_map>
 #include <utility>
 
+#include "arrow/buffer.h"
 #include "arrow/io/caching.h"
 #include "arrow/io/file.h"
 #include "arrow/io/memory.h"
 #include "arrow/io/util_internal.h"
+#include "arrow/util/base64.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/future.h"
 #include "arrow/util/int_util_overflow.h"
+#include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/ubsan.h"
 #include "parquet/bloom_filter.h"
@@ -166,6 +172,25 @@ std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(int i) {
   return contents_->GetColumnPageReader(i);
 }
 
+std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(
+    int i, const OffsetIndex& offset_index, const RowRanges& rows,
+    RowRanges* page_rows) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->GetColumnPageReader(i, offset_index, rows, page_rows);
+}
+
+std::unique_ptr<PageReader> RowGroupReader::Contents::GetColumnPageReader(
+    int i, const OffsetIndex& offset_index, const RowRanges& rows,
+    RowRanges* page_rows) {
+  *page_rows = RowRanges::All(metadata()->num_rows());
+  return GetColumnPageReader(i);
+}
+
 // Returns the rowgroup metadata
 const RowGroupMetaData* RowGroupReader::metadata() const { return contents_->metadata(); }
 
@@ -212,6 +237,48 @@ namespace {
   return {col_start, col_length};
 }
 
+/// Whether the data pages of a column chunk can be read selectively.
+///
+/// The page ordinal is part of the AAD of encrypted pages, so all of them must be
+/// read in order.
+bool CanSkipPages(const ColumnChunkMetaData& column_metadata,
+                  const OffsetIndex* offset_index) {
+  return offset_index != nullptr && !offset_index->page_locations().empty() &&
+         column_metadata.crypto_metadata() == nullptr;
+}
+
+/// Compute the sections of a column chunk that should be read to get its dictionary
+/// page, if any, and the given data pages. Adjacent pages are read together.
+std::vector<::arrow::io::ReadRange> ComputeColumnChunkPageRanges(
+    const ::arrow::io::ReadRange& col_range, const OffsetIndex& offset_index,
+    const std::vector<int32_t>& pages) {
+  const auto& page_locations = offset_index.page_locations();
+  const int64_t col_end = col_range.offset + col_range.length;
+  std::vector<::arrow::io::ReadRange> ranges;
+  // Everything before the first data page, i.e. the dictionary page
+  const int64_t first_page_offset = page_locations[0].offset;
+  if (first_page_offset < col_range.offset || first_page_offset > col_end) {
+    throw ParquetException("Invalid offset index (corrupt file?)");
+  }
+  if (first_page_offset > col_range.offset) {
+    ranges.push_back({col_range.offset, first_page_offset - col_range.offset});
+  }
+  for (int32_t page : pages) {
+    const PageLocation& location = page_locations[page];
+    if (location.offset < col_range.offset || location.compressed_page_size < 0 ||
+        location.offset + location.compressed_page_size > col_end) {
+      throw ParquetException("Invalid offset index (corrupt file?)");
+    }
+    if (!ranges.empty() &&
+        ranges.back().offset + ranges.back().length == location.offset) {
+      ranges.back().length += location.compressed_page_size;
+    } else {
+      ranges.push_back({location.offset, location.compressed_page_size});
+    }
+  }
+  return ranges;
+}
+
 }  // namespace
 
 // RowGroupReader::Contents implementation for the Parquet file specification
@@ -221,14 +288,16 @@ class SerializedRowGroup : public RowGroupReader::Contents {
                      std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source,
                      int64_t source_size, FileMetaData* file_metadata,
                      int row_group_number, ReaderProperties props,
-                     std::shared_ptr<Buffer> prebuffered_column_chunks_bitmap)
+                     std::shared_ptr<Buffer> prebuffered_column_chunks_bitmap,
+                     std::shared_ptr<const CodecOptions> zstd_codec_options)
       : source_(std::move(source)),
         cached_source_(std::move(cached_source)),
         source_size_(source_size),
         file_metadata_(file_metadata),
         properties_(std::move(props)),
         row_group_ordinal_(row_group_number),
-        prebuffered_column_chunks_bitmap_(std::move(prebuffered_column_chunks_bitmap)) {
+        prebuffered_column_chunks_bitmap_(std::move(prebuffered_column_chunks_bitmap)),
+        zstd_codec_options_(std::move(zstd_codec_options)) {
     row_group_metadata_ = file_metadata->RowGroup(row_group_number);
   }
 
@@ -238,13 +307,10 @@ class SerializedRowGroup : public RowGroupReader::Contents {
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i) override {
     // Read column chunk from the file
-    auto col = row_group_metadata_->ColumnChunk(i);
-
     ::arrow::io::ReadRange col_range =
         ComputeColumnChunkRange(file_metadata_, source_size_, row_group_ordinal_, i);
     std::shared_ptr<ArrowInputStream> stream;
-    if (cached_source_ && prebuffered_column_chunks_bitmap_ != nullptr &&
-        ::arrow::bit_util::GetBit(prebuffered_column_chunks_bitmap_->data(), i)) {
+    if (IsPrebuffered(i)) {
       // PARQUET-1698: if read coalescing is enabled, read from pre-buffered
       // segments.
       PARQUET_ASSIGN_OR_THROW(auto buffer, cached_source_->Read(col_range));
@@ -252,7 +318,60 @@ class SerializedRowGroup : public RowGroupReader::Contents {
     } else {
       stream = properties_.GetStream(source_, col_range.offset, col_range.length);
     }
+    return OpenPageReader(i, std::move(stream));
+  }
+
+  std::unique_ptr<PageReader> GetColumnPageReader(int i, const OffsetIndex& offset_index,
+                                                  const RowRanges& rows,
+                                                  RowRanges* page_rows) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    const int64_t num_rows = row_group_metadata_->num_rows();
+    if (!CanSkipPages(*col, &offset_index)) {
+      *page_rows = RowRanges::All(num_rows);
+      return GetColumnPageReader(i);
+    }
 
+    std::vector<int32_t> pages = SelectPages(offset_index, rows, num_rows);
+    *page_rows = PageRowRanges(offset_index, pages, num_rows);
+    ::arrow::io::ReadRange col_range =
+        ComputeColumnChunkRange(file_metadata_, source_size_, row_group_ordinal_, i);
+    std::vector<::arrow::io::ReadRange> page_ranges =
+        ComputeColumnChunkPageRanges(col_range, offset_index, pages);
+
+    // Only the selected pages are read, then stitched together so that the page
+    // reader sees them as a contiguous column chunk.
+    const bool prebuffered = IsPrebuffered(i);
+    ::arrow::BufferVector buffers;
+    buffers.reserve(page_ranges.size());
+    for (const auto& range : page_ranges) {
+      std::shared_ptr<Buffer> buffer;
+      if (prebuffered) {
+        PARQUET_ASSIGN_OR_THROW(buffer, cached_source_->Read(range));
+      } else {
+        PARQUET_ASSIGN_OR_THROW(buffer, source_->ReadAt(range.offset, range.length));
+      }
+      buffers.push_back(std::move(buffer));
+    }
+    std::shared_ptr<Buffer> data;
+    if (buffers.size() == 1) {
+      data = std::move(buffers[0]);
+    } else {
+      PARQUET_ASSIGN_OR_THROW(
+          data, ::arrow::ConcatenateBuffers(buffers, properties_.memory_pool()));
+    }
+    return OpenPageReader(i,
+                          std::make_shared<::arrow::io::BufferReader>(std::move(data)));
+  }
+
+ private:
+  bool IsPrebuffered(int i) const {
+    return cached_source_ && prebuffered_column_chunks_bitmap_ != nullptr &&
+           ::arrow::bit_util::GetBit(prebuffered_column_chunks_bitmap_->data(), i);
+  }
+
+  std::unique_ptr<PageReader> OpenPageReader(int i,
+                                             std::shared_ptr<ArrowInputStream> stream) {
+    auto col = row_group_metadata_->ColumnChunk(i);
     std::unique_ptr<ColumnCryptoMetaData> crypto_metadata = col->crypto_metadata();
 
     // Prior to Arrow 3.0.0, is_compressed was always set to false in column headers,
@@ -260,10 +379,13 @@ class SerializedRowGroup : public RowGroupReader::Contents {
     bool always_compressed = file_metadata_->writer_version().VersionLt(
         ApplicationVersion::PARQUET_CPP_10353_FIXED_VERSION());
 
+    std::shared_ptr<const CodecOptions> codec_options =
+        col->compression() == Compression::ZSTD ? zstd_codec_options_ : nullptr;
+
     // Column is encrypted only if crypto_metadata exists.
     if (!crypto_metadata) {
-      return PageReader::Open(stream, col->num_values(), col->compression(), properties_,
-                              always_compressed);
+      return PageReader::Open(stream, col->num_values(), col->compression(),
+                              std::move(codec_options), properties_, always_compressed);
     }
 
     // The column is encrypted
@@ -285,11 +407,11 @@ class SerializedRowGroup : public RowGroupReader::Contents {
                       static_cast<int16_t>(row_group_ordinal_), static_cast<int16_t>(i),
                       std::move(meta_decryptor_factory),
                       std::move(data_decryptor_factory)};
-    return PageReader::Open(stream, col->num_values(), col->compression(), properties_,
-                            always_compressed, &ctx);
+    return PageReader::Open(stream, col->num_values(), col->compression(),
+                            std::move(codec_options), properties_, always_compressed,
+                            &ctx);
   }
 
- private:
   std::shared_ptr<ArrowInputFile> source_;
   // Will be nullptr if PreBuffer() is not called.
   std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source_;
@@ -299,6 +421,7 @@ class SerializedRowGroup : public RowGroupReader::Contents {
   ReaderProperties properties_;
   int row_group_ordinal_;
   const std::shared_ptr<const Buffer> prebuffered_column_chunks_bitmap_;
+  const std::shared_ptr<const CodecOptions> zstd_codec_options_;
 };
 
 // ----------------------------------------------------------------------
@@ -328,12 +451,28 @@ class SerializedFile : public ParquetFileReader::Contents {
 
     std::unique_ptr<SerializedRowGroup> contents = std::make_unique<SerializedRowGroup>(
         source_, cached_source_, source_size_, file_metadata_.get(), i, properties_,
-        std::move(prebuffered_column_chunks_bitmap));
+        std::move(prebuffered_column_chunks_bitmap), zstd_codec_options());
     return std::make_shared<RowGroupReader>(std::move(contents));
   }
 
   std::shared_ptr<FileMetaData> metadata() const override { return file_metadata_; }
 
+  // The options to decompress the ZSTD column chunks with, holding the dictionary
+  // recorded in the footer if any
+  const std::shared_ptr<const CodecOptions>& zstd_codec_options() {
+    std::call_once(zstd_codec_options_once_, [this] {
+      const auto& metadata = file_metadata_->key_value_metadata();
+      const int64_t index = metadata ? metadata->FindKey(kZstdDictionaryKey) : -1;
+      if (index >= 0) {
+        auto options = std::make_shared<::arrow::util::ZstdCodecOptions>();
+        options->dictionary =
+            Buffer::FromString(::arrow::util::base64_decode(metadata->value(index)));
+        zstd_codec_options_ = std::move(options);
+      }
+    });
+    return zstd_codec_options_;
+  }
+
   std::shared_ptr<PageIndexReader> GetPageIndexReader() override {
     if (!file_metadata_) {
       // Usually this won't happen if user calls one of the static Open() functions
@@ -382,6 +521,7 @@ class SerializedFile : public ParquetFileReader::Contents {
         std::make_shared<::arrow::io::internal::ReadRangeCache>(source_, ctx, options);
     std::vector<::arrow::io::ReadRange> ranges;
     prebuffered_column_chunks_.clear();
+    prebuffered_page_ranges_.clear();
     int num_cols = file_metadata_->num_columns();
     // a bitmap for buffered columns.
     std::shared_ptr<Buffer> buffer_columns;
@@ -402,6 +542,54 @@ class SerializedFile : public ParquetFileReader::Contents {
     PARQUET_THROW_NOT_OK(cached_source_->Cache(ranges));
   }
 
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices,
+                 const std::vector<RowRanges>& row_ranges,
+                 const ParquetFileReader::OffsetIndexGetter& get_offset_index,
+                 const ::arrow::io::IOContext& ctx,
+                 const ::arrow::io::CacheOptions& options) {
+    if (row_ranges.size() != row_groups.size()) {
+      throw ParquetException("Expected row ranges for ", row_groups.size(),
+                             " row groups, got ", row_ranges.size());
+    }
+    cached_source_ =
+        std::make_shared<::arrow::io::internal::ReadRangeCache>(source_, ctx, options);
+    std::vector<::arrow::io::ReadRange> ranges;
+    prebuffered_column_chunks_.clear();
+    prebuffered_page_ranges_.clear();
+    int num_cols = file_metadata_->num_columns();
+    // a bitmap for buffered columns.
+    std::shared_ptr<Buffer> buffer_columns;
+    if (!row_groups.empty()) {
+      PARQUET_THROW_NOT_OK(AllocateEmptyBitmap(num_cols, properties_.memory_pool())
+                               .Value(&buffer_columns));
+      for (int col : column_indices) {
+        ::arrow::bit_util::SetBit(buffer_columns->mutable_data(), col);
+      }
+    }
+    for (size_t k = 0; k < row_groups.size(); ++k) {
+      const int row = row_groups[k];
+      auto row_group_metadata = file_metadata_->RowGroup(row);
+      const int64_t num_rows = row_group_metadata->num_rows();
+      prebuffered_column_chunks_[row] = buffer_columns;
+      for (int col : column_indices) {
+        ::arrow::io::ReadRange col_range =
+            ComputeColumnChunkRange(file_metadata_.get(), source_size_, row, col);
+        const OffsetIndex* offset_index = get_offset_index(row, col);
+        auto column_metadata = row_group_metadata->ColumnChunk(col);
+        if (!CanSkipPages(*column_metadata, offset_index)) {
+          ranges.push_back(col_range);
+          continue;
+        }
+        std::vector<int32_t> pages = SelectPages(*offset_index, row_ranges[k], num_rows);
+        auto page_ranges = ComputeColumnChunkPageRanges(col_range, *offset_index, pages);
+        ranges.insert(ranges.end(), page_ranges.begin(), page_ranges.end());
+        prebuffered_page_ranges_[{row, col}] = std::move(page_ranges);
+      }
+    }
+    PARQUET_THROW_NOT_OK(cached_source_->Cache(ranges));
+  }
+
   Result<std::vector<::arrow::io::ReadRange>> GetReadRanges(
       const std::vector<int>& row_groups, const std::vector<int>& column_indices,
       int64_t hole_size_limit, int64_t range_size_limit) {
@@ -425,6 +613,11 @@ class SerializedFile : public ParquetFileReader::Contents {
     std::vector<::arrow::io::ReadRange> ranges;
     for (int row : row_groups) {
       for (int col : column_indices) {
+        auto it = prebuffered_page_ranges_.find({row, col});
+        if (it != prebuffered_page_ranges_.end()) {
+          ranges.insert(ranges.end(), it->second.begin(), it->second.end());
+          continue;
+        }
         ranges.push_back(
             ComputeColumnChunkRange(file_metadata_.get(), source_size_, row, col));
       }
@@ -613,9 +806,15 @@ class SerializedFile : public ParquetFileReader::Contents {
   ReaderProperties properties_;
   std::shared_ptr<PageIndexReader> page_index_reader_;
   std::unique_ptr<BloomFilterReader> bloom_filter_reader_;
+  std::once_flag zstd_codec_options_once_;
+  std::shared_ptr<const CodecOptions> zstd_codec_options_;
   // Maps row group ordinal and prebuffer status of its column chunks in the form of a
   // bitmap buffer.
   std::unordered_map<int, std::shared_ptr<Buffer>> prebuffered_column_chunks_;
+  // The sections of the column chunks of which only some data pages were
+  // prebuffered, keyed by row group and column ordinals.
+  std::map<std::pair<int, int>, std::vector<::arrow::io::ReadRange>>
+      prebuffered_page_ranges_;
 
   // \return The true length of the metadata in bytes
   uint32_t ParseUnencryptedFileMetadata(
@@ -863,6 +1062,64 @@ Future<std::unique_ptr<ParquetFileReader>> ParquetFileReader::OpenAsync(
   END_PARQUET_CATCH_EXCEPTIONS
 }
 
+namespace {
+
+const std::shared_ptr<FileMetaDataCache>& MetaDataCacheFor(
+    const ReaderProperties& props) {
+  static const std::shared_ptr<FileMetaDataCache> kNoCache;
+  // Decrypted metadata holds a decryptor bound to the properties it was read with,
+  // and must not be handed to readers with possibly different keys.
+  if (props.file_decryption_properties() != nullptr) {
+    return kNoCache;
+  }
+  return props.metadata_cache();
+}
+
+}  // namespace
+
+std::unique_ptr<ParquetFileReader> ParquetFileReader::Open(
+    std::shared_ptr<::arrow::io::RandomAccessFile> source, const ReaderProperties& props,
+    const FileMetaDataCache::Key& cache_key) {
+  const auto& cache = MetaDataCacheFor(props);
+  if (cache == nullptr) {
+    return Open(std::move(source), props);
+  }
+  auto metadata = cache->Get(cache_key);
+  const bool cached = metadata != nullptr;
+  auto result = Open(std::move(source), props, std::move(metadata));
+  if (!cached) {
+    cache->Put(cache_key, result->metadata());
+  }
+  return result;
+}
+
+Future<std::unique_ptr<ParquetFileReader>> ParquetFileReader::OpenAsync(
+    std::shared_ptr<::arrow::io::RandomAccessFile> source, const ReaderProperties& props,
+    const FileMetaDataCache::Key& cache_key) {
+  auto cache = MetaDataCacheFor(props);
+  if (cache == nullptr) {
+    return OpenAsync(std::move(source), props);
+  }
+  auto metadata = cache->Get(cache_key);
+  if (metadata != nullptr) {
+    return OpenAsync(std::move(source), props, std::move(metadata));
+  }
+  auto fut = OpenAsync(std::move(source), props);
+  // TODO(ARROW-12259): workaround since we have Future<(move-only type)>
+  auto completed = Future<std::unique_ptr<ParquetFileReader>>::Make();
+  fut.AddCallback([fut, completed, cache = std::move(cache), cache_key](
+                      const Result<std::unique_ptr<ParquetFileReader>>& reader) mutable {
+    if (!reader.ok()) {
+      completed.MarkFinished(reader.status());
+      return;
+    }
+    std::unique_ptr<ParquetFileReader> result = fut.MoveResult().MoveValueUnsafe();
+    cache->Put(cache_key, result->metadata());
+    completed.MarkFinished(std::move(result));
+  });
+  return completed;
+}
+
 void ParquetFileReader::Open(std::unique_ptr<ParquetFileReader::Contents> contents) {
   contents_ = std::move(contents);
 }
@@ -905,6 +1162,19 @@ void ParquetFileReader::PreBuffer(const std::vector<int>& row_groups,
   file->PreBuffer(row_groups, column_indices, ctx, options);
 }
 
+void ParquetFileReader::PreBuffer(const std::vector<int>& row_groups,
+                                  const std::vector<int>& column_indices,
+                                  const std::vector<RowRanges>& row_ranges,
+                                  const OffsetIndexGetter& get_offset_index,
+                                  const ::arrow::io::IOContext& ctx,
+                                  const ::arrow::io::CacheOptions& options) {
+  // Access private methods here
+  SerializedFile* file =
+      ::arrow::internal::checked_cast<SerializedFile*>(contents_.get());
+  file->PreBuffer(row_groups, column_indices, row_ranges, get_offset_index, ctx,
+                  options);
+}
+
 Result<std::vector<::arrow::io::ReadRange>> ParquetFileReader::GetReadRanges(
     const std::vector<int>& row_groups, const std::vector<int>& column_indices,
     int64_t hole_size_limit, int64_t range_size_limit) {
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -25,6 +26,7 @@
 #include "arrow/io/caching.h"
 #include "arrow/util/type_fwd.h"
 #include "parquet/metadata.h"  // IWYU pragma: keep
+#include "parquet/metadata_cache.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 
@@ -32,10 +34,12 @@ namespace parquet {
 
 class ColumnReader;
 class FileMetaData;
+class OffsetIndex;
 class PageIndexReader;
 class BloomFilterReader;
 class PageReader;
 class RowGroupMetaData;
+class RowRanges;
 
 namespace internal {
 class RecordReader;
@@ -49,6 +53,10 @@ class PARQUET_EXPORT RowGroupReader {
   struct Contents {
     virtual ~Contents() {}
     virtual std::unique_ptr<PageReader> GetColumnPageReader(int i) = 0;
+    // The default implementation returns all the pages of the column chunk
+    virtual std::unique_ptr<PageReader> GetColumnPageReader(
+        int i, const OffsetIndex& offset_index, const RowRanges& rows,
+        RowRanges* page_rows);
     virtual const RowGroupMetaData* metadata() const = 0;
     virtual const ReaderProperties* properties() const = 0;
   };
@@ -95,6 +103,21 @@ class PARQUET_EXPORT RowGroupReader {
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i);
 
+  // Construct a PageReader only returning the data pages of the column chunk that
+  // hold some of the given rows (and its dictionary page, if any).
+  //
+  // The pages are located with the offset index of the column chunk, the others are
+  // neither read nor decompressed. Encrypted column chunks are returned in full as
+  // the page ordinals are part of their decryption AAD.
+  //
+  // `page_rows` is set to the rows stored in the returned pages, which is a superset
+  // of `rows`. Callers must skip the remaining unwanted rows themselves.
+  //
+  // \note API EXPERIMENTAL
+  std::unique_ptr<PageReader> GetColumnPageReader(int i, const OffsetIndex& offset_index,
+                                                  const RowRanges& rows,
+                                                  RowRanges* page_rows);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -149,6 +172,20 @@ class PARQUET_EXPORT ParquetFileReader {
       const ReaderProperties& props = default_reader_properties(),
       std::shared_ptr<FileMetaData> metadata = NULLPTR);
 
+  // Create a file reader instance, reusing the metadata cached for `cache_key` in
+  // props.metadata_cache() if any. On a miss the footer is read and added to the
+  // cache. Without a cache, or with decryption properties, this is equivalent to
+  // Open(source, props).
+  static std::unique_ptr<ParquetFileReader> Open(
+      std::shared_ptr<::arrow::io::RandomAccessFile> source,
+      const ReaderProperties& props, const FileMetaDataCache::Key& cache_key);
+
+  // Asynchronous version of the above.
+  // Does not throw - all errors are reported through the Future.
+  static ::arrow::Future<std::unique_ptr<ParquetFileReader>> OpenAsync(
+      std::shared_ptr<::arrow::io::RandomAccessFile> source,
+      const ReaderProperties& props, const FileMetaDataCache::Key& cache_key);
+
   void Open(std::unique_ptr<Contents> contents);
   void Close();
 
@@ -201,6 +238,28 @@ class PARQUET_EXPORT ParquetFileReader {
                  const ::arrow::io::IOContext& ctx,
                  const ::arrow::io::CacheOptions& options);
 
+  /// Returns the offset index of a column chunk given its row group and column
+  /// ordinals, or nullptr if the column chunk should be read in full.
+  using OffsetIndexGetter = std::function<const OffsetIndex*(int, int)>;
+
+  /// Pre-buffer the data pages holding some rows of the specified row groups.
+  ///
+  /// Like the other overload, except that `row_ranges[k]` are the rows to read
+  /// from `row_groups[k]`: only the dictionary page and the data pages holding some
+  /// of these rows are buffered, as returned by
+  /// RowGroupReader::GetColumnPageReader(i, offset_index, rows, page_rows).
+  /// Column chunks without offset index are buffered in full.
+  ///
+  /// Reading the column chunks with other rows than the buffered ones fails.
+  ///
+  /// This method may throw.
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices,
+                 const std::vector<RowRanges>& row_ranges,
+                 const OffsetIndexGetter& get_offset_index,
+                 const ::arrow::io::IOContext& ctx,
+                 const ::arrow::io::CacheOptions& options);
+
   /// Retrieve the list of byte ranges that would need to be read to retrieve
   /// the data for the specified row groups and column indices.
   ///
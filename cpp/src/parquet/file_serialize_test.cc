@@ -19,7 +19,10 @@
 #include <gtest/gtest.h>
 
 #include "arrow/testing/gtest_compat.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/config.h"
+#include "arrow/util/key_value_metadata.h"
 
 #include "parquet/column_reader.h"
 #include "parquet/column_writer.h"
@@ -480,6 +483,83 @@ TEST(ParquetRoundtrip, AllNulls) {
   EXPECT_THAT(def_levels, ElementsAre(0, 0, 0));
 }
 
+#ifdef ARROW_WITH_ZSTD
+TEST(ParquetRoundtrip, ZstdDictionary) {
+  // Small pages of similar strings, without dictionary encoding
+  constexpr int kValueCount = 20000;
+  std::vector<std::string> strings;
+  for (int i = 0; i < kValueCount; ++i) {
+    const int id = (i * 7919) % 1000;
+    strings.push_back("https://example.com/products/item-" + std::to_string(id) +
+                      "?ref=search&page=" + std::to_string(id % 10));
+  }
+  std::vector<ByteArray> values(strings.begin(), strings.end());
+
+  // Train the dictionary on samples of the size of a page
+  std::vector<std::shared_ptr<Buffer>> samples;
+  std::string sample;
+  for (const auto& value : strings) {
+    sample += value;
+    if (sample.size() > 1024) {
+      samples.push_back(Buffer::FromString(std::move(sample)));
+      sample.clear();
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto dictionary, ::arrow::util::TrainZstdDictionary(
+                                            samples, /*max_dictionary_size=*/4096));
+
+  auto schema = std::static_pointer_cast<GroupNode>(GroupNode::Make(
+      "schema", Repetition::REQUIRED,
+      {PrimitiveNode::Make("col", Repetition::REQUIRED, Type::BYTE_ARRAY)}));
+  auto write = [&](std::shared_ptr<::arrow::util::CodecOptions> codec_options) {
+    auto sink = CreateOutputStream();
+    auto writer_props = WriterProperties::Builder()
+                            .disable_dictionary()
+                            ->data_pagesize(1024)
+                            ->compression(Compression::ZSTD)
+                            ->codec_options(codec_options)
+                            ->build();
+    auto file_writer = ParquetFileWriter::Open(sink, schema, writer_props);
+    auto rg_writer = file_writer->AppendRowGroup();
+    auto col_writer = static_cast<ByteArrayWriter*>(rg_writer->NextColumn());
+    col_writer->WriteBatch(kValueCount, nullptr, nullptr, values.data());
+    rg_writer->Close();
+    file_writer->Close();
+    PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+    return buffer;
+  };
+  auto without_dictionary = write(std::make_shared<::arrow::util::CodecOptions>());
+  auto codec_options = std::make_shared<::arrow::util::ZstdCodecOptions>();
+  codec_options->dictionary = dictionary;
+  auto buffer = write(codec_options);
+  ASSERT_LT(buffer->size(), without_dictionary->size());
+
+  for (int32_t page_readahead : {0, 4}) {
+    ARROW_SCOPED_TRACE("page_readahead = ", page_readahead);
+    ReaderProperties props = default_reader_properties();
+    props.set_page_readahead(page_readahead);
+    auto file_reader = ParquetFileReader::Open(
+        std::make_shared<::arrow::io::BufferReader>(buffer), props);
+    ASSERT_TRUE(
+        file_reader->metadata()->key_value_metadata()->Contains(kZstdDictionaryKey));
+    auto column_reader =
+        std::static_pointer_cast<ByteArrayReader>(file_reader->RowGroup(0)->Column(0));
+    std::vector<ByteArray> values_out(kValueCount);
+    int64_t total_values_read = 0;
+    while (column_reader->HasNext()) {
+      int64_t values_read;
+      column_reader->ReadBatch(kValueCount - total_values_read, nullptr, nullptr,
+                               values_out.data() + total_values_read, &values_read);
+      total_values_read += values_read;
+    }
+    ASSERT_EQ(kValueCount, total_values_read);
+    for (int i = 0; i < kValueCount; ++i) {
+      ASSERT_EQ(strings[i], std::string_view(values_out[i]));
+    }
+  }
+}
+#endif
+
 }  // namespace test
 
 }  // namespace parquet
@@ -20,9 +20,13 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#include "arrow/buffer.h"
+#include "arrow/util/base64.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/endian.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging_internal.h"
@@ -69,6 +73,10 @@ int64_t RowGroupWriter::total_compressed_bytes_written() const {
   return contents_->total_compressed_bytes_written();
 }
 
+int64_t RowGroupWriter::total_buffered_bytes() const {
+  return contents_->total_buffered_bytes();
+}
+
 bool RowGroupWriter::buffered() const { return contents_->buffered(); }
 
 int RowGroupWriter::current_column() { return contents_->current_column(); }
@@ -198,6 +206,21 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
     return total_compressed_bytes_written;
   }
 
+  int64_t total_buffered_bytes() const override {
+    int64_t total_buffered_bytes = 0;
+    for (const auto& column_writer : column_writers_) {
+      if (column_writer) {
+        total_buffered_bytes += column_writer->total_compressed_bytes() +
+                                column_writer->estimated_buffered_value_bytes();
+        if (buffered_row_group_) {
+          // Pages are written to an in-memory sink until the row group is closed
+          total_buffered_bytes += column_writer->total_compressed_bytes_written();
+        }
+      }
+    }
+    return total_buffered_bytes;
+  }
+
   bool buffered() const override { return buffered_row_group_; }
 
   void Close() override {
@@ -438,6 +461,35 @@ class FileSerializer : public ParquetFileWriter::Contents {
     } else {
       throw ParquetException("Appending to file not implemented.");
     }
+    AddZstdDictionary();
+  }
+
+  // Record the dictionary the ZSTD columns are compressed with in the footer, so that
+  // readers decompress them with it
+  void AddZstdDictionary() {
+    std::shared_ptr<Buffer> dictionary;
+    for (int i = 0; i < schema_.num_columns(); ++i) {
+      const auto& path = schema_.Column(i)->path();
+      if (properties_->compression(path) != Compression::ZSTD) {
+        continue;
+      }
+      const auto* options = dynamic_cast<const ::arrow::util::ZstdCodecOptions*>(
+          properties_->codec_options(path).get());
+      if (options == nullptr || options->dictionary == nullptr) {
+        continue;
+      }
+      if (dictionary != nullptr && !dictionary->Equals(*options->dictionary)) {
+        throw ParquetException(
+            "All the ZSTD columns of a file must be compressed with the same "
+            "dictionary");
+      }
+      dictionary = options->dictionary;
+    }
+    if (dictionary != nullptr) {
+      AddKeyValueMetadata(::arrow::key_value_metadata(
+          {kZstdDictionaryKey},
+          {::arrow::util::base64_encode(std::string_view(*dictionary))}));
+    }
   }
 
   void CloseEncryptedFile(FileEncryptionProperties* file_encryption_properties) {
@@ -34,6 +34,11 @@ class ColumnWriter;
 static constexpr uint8_t kParquetMagic[4] = {'P', 'A', 'R', '1'};
 static constexpr uint8_t kParquetEMagic[4] = {'P', 'A', 'R', 'E'};
 
+// Key of the file key-value metadata holding the base64-encoded ZSTD dictionary the
+// ZSTD column chunks are compressed with, if any (see
+// ::arrow::util::ZstdCodecOptions::dictionary)
+static constexpr char kZstdDictionaryKey[] = "ARROW:zstd_dictionary";
+
 class PARQUET_EXPORT RowGroupWriter {
  public:
   // Forward declare a virtual class 'Contents' to aid dependency injection and more
@@ -58,6 +63,8 @@ class PARQUET_EXPORT RowGroupWriter {
     virtual int64_t total_compressed_bytes() const = 0;
     /// \brief total compressed bytes written by the page writer
     virtual int64_t total_compressed_bytes_written() const = 0;
+    /// \brief total bytes held in memory by the column writers
+    virtual int64_t total_buffered_bytes() const = 0;
 
     virtual bool buffered() const = 0;
   };
@@ -99,6 +106,10 @@ class PARQUET_EXPORT RowGroupWriter {
   int64_t total_compressed_bytes() const;
   /// \brief total compressed bytes written by the page writer
   int64_t total_compressed_bytes_written() const;
+  /// \brief total bytes held in memory by the column writers: encoded values of
+  /// the current pages, pages waiting for their dictionary page and, for a buffered
+  /// row group, all pages written so far.
+  int64_t total_buffered_bytes() const;
 
   /// Returns whether the current RowGroupWriter is in the buffered mode and is created
   /// by calling ParquetFileWriter::AppendBufferedRowGroup.
@@ -19,7 +19,6 @@
 
 #include <algorithm>
 #include <limits>
-#include <optional>
 
 #include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
@@ -40,90 +39,19 @@ namespace parquet::internal {
 namespace {
 
 using ::arrow::internal::CpuInfo;
-using ::std::optional;
 
 template <typename OffsetType>
 void DefRepLevelsToListInfo(const int16_t* def_levels, const int16_t* rep_levels,
                             int64_t num_def_levels, LevelInfo level_info,
                             ValidityBitmapInputOutput* output, OffsetType* offsets) {
-  OffsetType* orig_pos = offsets;
-  optional<::arrow::internal::FirstTimeBitmapWriter> valid_bits_writer;
-  if (output->valid_bits) {
-    valid_bits_writer.emplace(output->valid_bits, output->valid_bits_offset,
-                              output->values_read_upper_bound);
-  }
-  for (int x = 0; x < num_def_levels; x++) {
-    // Skip items that belong to empty or null ancestor lists and further nested lists.
-    if (def_levels[x] < level_info.repeated_ancestor_def_level ||
-        rep_levels[x] > level_info.rep_level) {
-      continue;
-    }
-
-    if (rep_levels[x] == level_info.rep_level) {
-      // A continuation of an existing list.
-      // offsets can be null for structs with repeated children (we don't need to know
-      // offsets until we get to the children).
-      if (offsets != nullptr) {
-        if (ARROW_PREDICT_FALSE(*offsets == std::numeric_limits<OffsetType>::max())) {
-          throw ParquetException("List index overflow.");
-        }
-        *offsets += 1;
-      }
-    } else {
-      if (ARROW_PREDICT_FALSE(
-              (valid_bits_writer.has_value() &&
-               valid_bits_writer->position() >= output->values_read_upper_bound) ||
-              (offsets - orig_pos) >= output->values_read_upper_bound)) {
-        std::stringstream ss;
-        ss << "Definition levels exceeded upper bound: "
-           << output->values_read_upper_bound;
-        throw ParquetException(ss.str());
-      }
-
-      // current_rep < list rep_level i.e. start of a list (ancestor empty lists are
-      // filtered out above).
-      // offsets can be null for structs with repeated children (we don't need to know
-      // offsets until we get to the children).
-      if (offsets != nullptr) {
-        ++offsets;
-        // Use cumulative offsets because variable size lists are more common than
-        // fixed size lists so it should be cheaper to make these cumulative and
-        // subtract when validating fixed size lists.
-        *offsets = *(offsets - 1);
-        if (def_levels[x] >= level_info.def_level) {
-          if (ARROW_PREDICT_FALSE(*offsets == std::numeric_limits<OffsetType>::max())) {
-            throw ParquetException("List index overflow.");
-          }
-          *offsets += 1;
-        }
-      }
-
-      if (valid_bits_writer.has_value()) {
-        // the level_info def level for lists reflects element present level.
-        // the prior level distinguishes between empty lists.
-        if (def_levels[x] >= level_info.def_level - 1) {
-          valid_bits_writer->Set();
-        } else {
-          output->null_count++;
-          valid_bits_writer->Clear();
-        }
-        valid_bits_writer->Next();
-      }
-    }
-  }
-  if (valid_bits_writer.has_value()) {
-    valid_bits_writer->Finish();
-  }
-  if (offsets != nullptr) {
-    output->values_read = offsets - orig_pos;
-  } else if (valid_bits_writer.has_value()) {
-    output->values_read = valid_bits_writer->position();
-  }
-  if (output->null_count > 0 && level_info.null_slot_usage > 1) {
-    throw ParquetException(
-        "Null values with null_slot_usage > 1 not supported."
-        "(i.e. FixedSizeLists with null values are not supported)");
+#if defined(ARROW_HAVE_RUNTIME_BMI2)
+  if (CpuInfo::GetInstance()->HasEfficientBmi2()) {
+    return DefRepLevelsToListBmi2(def_levels, rep_levels, num_def_levels, level_info,
+                                  output, offsets);
   }
+#endif
+  standard::DefRepLevelsToListInfoSimd<OffsetType>(def_levels, rep_levels, num_def_levels,
+                                                   level_info, output, offsets);
 }
 
 }  // namespace
@@ -78,3 +78,38 @@ void BM_DefinitionLevelsToBitmapRepeatedMostPresent(::benchmark::State& state) {
 }
 
 BENCHMARK(BM_DefinitionLevelsToBitmapRepeatedMostPresent);
+
+// Rep/def levels of lists of `list_length` elements, with every 10th list null.
+void BM_DefRepLevelsToList(::benchmark::State& state) {
+  const int64_t list_length = state.range(0);
+  std::vector<int16_t> def_levels;
+  std::vector<int16_t> rep_levels;
+  int64_t num_lists = 0;
+  while (static_cast<int64_t>(def_levels.size()) < kLevelCount) {
+    if (num_lists++ % 10 == 0) {
+      def_levels.push_back(kMissingDefLevel);
+      rep_levels.push_back(0);
+      continue;
+    }
+    def_levels.insert(def_levels.end(), list_length, kPresentDefLevel);
+    rep_levels.push_back(0);
+    rep_levels.insert(rep_levels.end(), list_length - 1, kHasRepeatedElements);
+  }
+  std::vector<uint8_t> bitmap(/*count=*/num_lists, 0);
+  std::vector<int32_t> offsets(num_lists + 1, 0);
+  parquet::internal::LevelInfo info;
+  info.def_level = kPresentDefLevel;
+  info.rep_level = 1;
+  parquet::internal::ValidityBitmapInputOutput validity_io;
+  validity_io.values_read_upper_bound = num_lists;
+  validity_io.valid_bits = bitmap.data();
+  for (auto _ : state) {
+    parquet::internal::DefRepLevelsToList(def_levels.data(), rep_levels.data(),
+                                          def_levels.size(), info, &validity_io,
+                                          offsets.data());
+  }
+  ::benchmark::DoNotOptimize(offsets);
+  state.SetBytesProcessed(int64_t(state.iterations()) * def_levels.size());
+}
+
+BENCHMARK(BM_DefRepLevelsToList)->Arg(1)->Arg(4)->Arg(32);
@@ -27,4 +27,12 @@ void DefLevelsToBitmapBmi2WithRepeatedParent(const int16_t* def_levels,
                                              int64_t num_def_levels, LevelInfo level_info,
                                              ValidityBitmapInputOutput* output);
 
+void DefRepLevelsToListBmi2(const int16_t* def_levels, const int16_t* rep_levels,
+                            int64_t num_def_levels, LevelInfo level_info,
+                            ValidityBitmapInputOutput* output, int32_t* offsets);
+
+void DefRepLevelsToListBmi2(const int16_t* def_levels, const int16_t* rep_levels,
+                            int64_t num_def_levels, LevelInfo level_info,
+                            ValidityBitmapInputOutput* output, int64_t* offsets);
+
 }  // namespace parquet::internal
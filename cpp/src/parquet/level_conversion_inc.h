@@ -20,13 +20,17 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <iterator>
 #include <limits>
+#include <optional>
+#include <sstream>
 
 #include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_writer.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/simd.h"
+#include "arrow/util/ubsan.h"
 #include "parquet/exception.h"
 #include "parquet/level_comparison.h"
 
@@ -352,4 +356,148 @@ void DefLevelsToBitmapSimd(const int16_t* def_levels, int64_t num_def_levels,
   writer.Finish();
 }
 
+/// Packs kExtractBitsSize flags of 0 or 1 into a bitmap.
+inline uint64_t PackLevelFlags(const uint8_t* flags) {
+  uint64_t bitmap = 0;
+  for (int64_t x = 0; x < kExtractBitsSize; x += 8) {
+    // Gathers the low bit of each byte in the top byte of the product.
+    const auto word = ::arrow::bit_util::FromLittleEndian(
+        ::arrow::util::SafeLoadAs<uint64_t>(flags + x));
+    bitmap |= ((word * 0x0102040810204080ULL) >> 56) << x;
+  }
+  return bitmap;
+}
+
+/// Converts a batch of exactly kExtractBitsSize rep/def levels to list offsets
+/// and validity, see DefRepLevelsToListInfoSimd.  Returns the number of lists
+/// started in the batch.
+template <typename OffsetType>
+int64_t DefRepLevelsBatchToListInfo(const int16_t* def_levels,
+                                    const int16_t* rep_levels,
+                                    int64_t upper_bound_remaining, LevelInfo level_info,
+                                    ValidityBitmapInputOutput* output,
+                                    ::arrow::internal::FirstTimeBitmapWriter* writer,
+                                    OffsetType** offsets) {
+  // Evaluate the level predicates as byte flags first: with a fixed trip count
+  // and no loop-carried state, compilers vectorize this loop.
+  //
+  // Levels of empty or null ancestor lists and of further nested lists are
+  // skipped, the others either continue the current list or start a new one.
+  uint8_t started_flags[kExtractBitsSize];
+  uint8_t element_flags[kExtractBitsSize];
+  uint8_t valid_flags[kExtractBitsSize];
+  for (int64_t x = 0; x < kExtractBitsSize; x++) {
+    const bool considered = (def_levels[x] >= level_info.repeated_ancestor_def_level) &
+                            (rep_levels[x] <= level_info.rep_level);
+    const bool started = considered & (rep_levels[x] < level_info.rep_level);
+    started_flags[x] = started;
+    // A level adds an element when it continues a list or starts a non-empty one.
+    element_flags[x] = considered & ((rep_levels[x] == level_info.rep_level) |
+                                     (def_levels[x] >= level_info.def_level));
+    // the level_info def level for lists reflects element present level.
+    // the prior level distinguishes between empty lists.
+    valid_flags[x] = def_levels[x] >= level_info.def_level - 1;
+  }
+  const uint64_t started = PackLevelFlags(started_flags);
+  const int64_t started_count = ::arrow::bit_util::PopCount(started);
+  if (ARROW_PREDICT_FALSE(started_count > upper_bound_remaining)) {
+    std::stringstream ss;
+    ss << "Definition levels exceeded upper bound: " << output->values_read_upper_bound;
+    throw ParquetException(ss.str());
+  }
+
+  // offsets can be null for structs with repeated children (we don't need to know
+  // offsets until we get to the children).
+  if (*offsets != nullptr) {
+    const uint64_t elements = PackLevelFlags(element_flags);
+    const int64_t element_count = ::arrow::bit_util::PopCount(elements);
+    const OffsetType base = **offsets;
+    if (ARROW_PREDICT_FALSE(element_count >
+                            static_cast<int64_t>(std::numeric_limits<OffsetType>::max() -
+                                                 base))) {
+      throw ParquetException("List index overflow.");
+    }
+    // Offsets are cumulative: starting a list closes the current one with the
+    // elements seen before it.
+    OffsetType* out = *offsets;
+    if (started_count > kExtractBitsSize / 2) {
+      // Mostly empty or single element lists: walk the levels without branching.
+      OffsetType value = base;
+      for (int64_t x = 0; x < kExtractBitsSize; x++) {
+        out += started_flags[x];
+        value += element_flags[x];
+        *out = value;
+      }
+    } else {
+      // Long lists: jump from one list start to the next.
+      for (uint64_t remaining = started; remaining != 0; remaining &= remaining - 1) {
+        const uint64_t preceding = ::arrow::bit_util::LeastSignificantBitMask(
+            static_cast<uint64_t>(::arrow::bit_util::CountTrailingZeros(remaining)));
+        *out++ = base + static_cast<OffsetType>(
+                            ::arrow::bit_util::PopCount(elements & preceding));
+      }
+      *out = base + static_cast<OffsetType>(element_count);
+    }
+    *offsets = out;
+  }
+
+  if (writer != nullptr) {
+    const auto valid = static_cast<extract_bitmap_t>(PackLevelFlags(valid_flags));
+    const uint64_t valid_bits =
+        ExtractBits(valid, static_cast<extract_bitmap_t>(started));
+    writer->AppendWord(valid_bits, started_count);
+    output->null_count += started_count - ::arrow::bit_util::PopCount(valid_bits);
+  }
+  return started_count;
+}
+
+/// Converts rep/def levels to the offsets and validity of the list at
+/// level_info, kExtractBitsSize levels at a time.
+template <typename OffsetType>
+void DefRepLevelsToListInfoSimd(const int16_t* def_levels, const int16_t* rep_levels,
+                                int64_t num_def_levels, LevelInfo level_info,
+                                ValidityBitmapInputOutput* output, OffsetType* offsets) {
+  std::optional<::arrow::internal::FirstTimeBitmapWriter> writer;
+  if (output->valid_bits) {
+    writer.emplace(output->valid_bits, output->valid_bits_offset,
+                   output->values_read_upper_bound);
+  }
+  OffsetType* orig_pos = offsets;
+  int64_t values_read = 0;
+  auto convert_batch = [&](const int16_t* batch_def_levels,
+                           const int16_t* batch_rep_levels) {
+    values_read += DefRepLevelsBatchToListInfo<OffsetType>(
+        batch_def_levels, batch_rep_levels, output->values_read_upper_bound - values_read,
+        level_info, output, writer.has_value() ? &*writer : nullptr, &offsets);
+  };
+  for (; num_def_levels >= kExtractBitsSize; num_def_levels -= kExtractBitsSize) {
+    convert_batch(def_levels, rep_levels);
+    def_levels += kExtractBitsSize;
+    rep_levels += kExtractBitsSize;
+  }
+  if (num_def_levels > 0) {
+    // Pad the last batch with levels of further nested lists, which are skipped.
+    int16_t last_def_levels[kExtractBitsSize] = {};
+    int16_t last_rep_levels[kExtractBitsSize];
+    std::fill(std::begin(last_rep_levels), std::end(last_rep_levels),
+              std::numeric_limits<int16_t>::max());
+    std::copy(def_levels, def_levels + num_def_levels, last_def_levels);
+    std::copy(rep_levels, rep_levels + num_def_levels, last_rep_levels);
+    convert_batch(last_def_levels, last_rep_levels);
+  }
+  if (writer.has_value()) {
+    writer->Finish();
+  }
+  if (offsets != nullptr) {
+    output->values_read = offsets - orig_pos;
+  } else if (writer.has_value()) {
+    output->values_read = values_read;
+  }
+  if (output->null_count > 0 && level_info.null_slot_usage > 1) {
+    throw ParquetException(
+        "Null values with null_slot_usage > 1 not supported."
+        "(i.e. FixedSizeLists with null values are not supported)");
+  }
+}
+
 }  // namespace parquet::internal::PARQUET_IMPL_NAMESPACE
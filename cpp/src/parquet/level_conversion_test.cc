@@ -23,6 +23,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -344,6 +345,46 @@ TYPED_TEST(NestedListTest, TestOverflow) {
   this->Run(test_data, level_info);
 }
 
+TYPED_TEST(NestedListTest, NullAndEmptyListsAcrossBatches) {
+  // 200 lists spanning several batches of levels: list x has x % 5 elements,
+  // except every 7th list which is null.
+  LevelInfo level_info;
+  level_info.rep_level = 1;
+  level_info.def_level = 2;
+  level_info.repeated_ancestor_def_level = 0;
+
+  constexpr int kNumLists = 200;
+  MultiLevelTestData test_data;
+  std::vector<typename TypeParam::OffsetsType> expected_offsets = {0};
+  std::string expected_validity;
+  for (int x = 0; x < kNumLists; x++) {
+    const int length = x % 7 == 3 ? 0 : x % 5;
+    if (x % 7 == 3) {
+      test_data.def_levels.push_back(0);
+    } else {
+      test_data.def_levels.insert(test_data.def_levels.end(), std::max(length, 1),
+                                  length == 0 ? 1 : 2);
+    }
+    test_data.rep_levels.push_back(0);
+    test_data.rep_levels.insert(test_data.rep_levels.end(), std::max(length - 1, 0),
+                                /*rep_level=*/1);
+    expected_offsets.push_back(expected_offsets.back() + length);
+    expected_validity += x % 7 == 3 ? "0" : "1";
+  }
+
+  this->InitForLength(kNumLists);
+  typename TypeParam::OffsetsType* next_position = this->Run(test_data, level_info);
+
+  EXPECT_EQ(next_position, this->offsets_.data() + kNumLists);
+  EXPECT_THAT(this->offsets_, testing::ElementsAreArray(expected_offsets));
+
+  EXPECT_EQ(this->validity_io_.values_read, kNumLists);
+  EXPECT_EQ(this->validity_io_.null_count, 29);
+  std::string validity = BitmapToString(this->validity_io_.valid_bits, kNumLists);
+  validity.erase(std::remove(validity.begin(), validity.end(), ' '), validity.end());
+  EXPECT_EQ(validity, expected_validity);
+}
+
 TEST(TestOnlyExtractBitsSoftware, BasicTest) {
   auto check = [](uint64_t bitmap, uint64_t selection, uint64_t expected) -> void {
     EXPECT_EQ(TestOnlyExtractBitsSoftware(bitmap, selection), expected);
@@ -18,8 +18,10 @@
 #include "parquet/metadata.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cinttypes>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <random>
 #include <sstream>
@@ -601,6 +603,107 @@ const std::shared_ptr<const KeyValueMetadata>& ColumnChunkMetaData::key_value_me
   return impl_->key_value_metadata();
 }
 
+namespace {
+
+// Offset and length of a thrift message within a serialized footer
+using ByteRange = std::pair<uint32_t, uint32_t>;
+
+// Thrift field ids of FileMetaData.row_groups and RowGroup.columns
+constexpr int16_t kRowGroupsFieldId = 4;
+constexpr int16_t kColumnsFieldId = 1;
+
+// A row group of a lazily decoded footer (see
+// ReaderProperties::set_lazy_metadata_decoding()). All fields but the column chunks
+// are decoded on construction, and each column chunk is decoded on first access.
+class LazyRowGroup {
+ public:
+  LazyRowGroup(std::shared_ptr<const std::string> footer, ByteRange range,
+               const ReaderProperties& properties)
+      : footer_(std::move(footer)), deserializer_(properties) {
+    uint32_t len = range.second;
+    deserializer_.DeserializeMessageSkippingList(data(range.first), &len,
+                                                 kColumnsFieldId, &row_group_,
+                                                 &column_ranges_);
+    if (ARROW_PREDICT_FALSE(column_ranges_.size() >
+                            static_cast<size_t>(std::numeric_limits<int>::max()))) {
+      throw ParquetException("Row group had too many columns: ", column_ranges_.size());
+    }
+    for (ByteRange& column_range : column_ranges_) {
+      column_range.first += range.first;
+    }
+    columns_.resize(column_ranges_.size());
+  }
+
+  // The row group without its column chunks
+  const format::RowGroup& row_group() const { return row_group_; }
+
+  int num_columns() const { return static_cast<int>(column_ranges_.size()); }
+
+  const format::ColumnChunk* column(int i) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (columns_[i] == nullptr) {
+      auto column = std::make_unique<format::ColumnChunk>();
+      uint32_t len = column_ranges_[i].second;
+      deserializer_.DeserializeMessage(data(column_ranges_[i].first), &len, column.get());
+      columns_[i] = std::move(column);
+    }
+    return columns_[i].get();
+  }
+
+  // Return a copy of the row group with all its column chunks
+  format::RowGroup Decode() {
+    format::RowGroup row_group = row_group_;
+    row_group.columns.reserve(column_ranges_.size());
+    for (int i = 0; i < num_columns(); ++i) {
+      row_group.columns.push_back(*column(i));
+    }
+    return row_group;
+  }
+
+ private:
+  const uint8_t* data(uint32_t offset) const {
+    return reinterpret_cast<const uint8_t*>(footer_->data()) + offset;
+  }
+
+  const std::shared_ptr<const std::string> footer_;
+  ThriftDeserializer deserializer_;
+  format::RowGroup row_group_;
+  std::vector<ByteRange> column_ranges_;
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<format::ColumnChunk>> columns_;
+};
+
+// The row groups of a lazily decoded footer, each decoded on first access
+class LazyRowGroups {
+ public:
+  LazyRowGroups(const uint8_t* footer, uint32_t footer_len,
+                std::vector<ByteRange> ranges, const ReaderProperties& properties)
+      : footer_(std::make_shared<const std::string>(reinterpret_cast<const char*>(footer),
+                                                    footer_len)),
+        ranges_(std::move(ranges)),
+        properties_(properties),
+        row_groups_(ranges_.size()) {}
+
+  int size() const { return static_cast<int>(ranges_.size()); }
+
+  LazyRowGroup* Get(int i) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (row_groups_[i] == nullptr) {
+      row_groups_[i] = std::make_unique<LazyRowGroup>(footer_, ranges_[i], properties_);
+    }
+    return row_groups_[i].get();
+  }
+
+ private:
+  const std::shared_ptr<const std::string> footer_;
+  const std::vector<ByteRange> ranges_;
+  const ReaderProperties properties_;
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<LazyRowGroup>> row_groups_;
+};
+
+}  // namespace
+
 // row-group metadata
 class RowGroupMetaData::RowGroupMetaDataImpl {
  public:
@@ -621,11 +724,27 @@ class RowGroupMetaData::RowGroupMetaDataImpl {
     }
   }
 
+  explicit RowGroupMetaDataImpl(LazyRowGroup* lazy_row_group,
+                                const SchemaDescriptor* schema,
+                                const ReaderProperties& properties,
+                                const ApplicationVersion* writer_version,
+                                std::shared_ptr<InternalFileDecryptor> file_decryptor)
+      : RowGroupMetaDataImpl(&lazy_row_group->row_group(), schema, properties,
+                             writer_version, std::move(file_decryptor)) {
+    lazy_row_group_ = lazy_row_group;
+  }
+
   bool Equals(const RowGroupMetaDataImpl& other) const {
-    return *row_group_ == *other.row_group_;
+    if (lazy_row_group_ == nullptr && other.lazy_row_group_ == nullptr) {
+      return *row_group_ == *other.row_group_;
+    }
+    return Decode() == other.Decode();
   }
 
-  inline int num_columns() const { return static_cast<int>(row_group_->columns.size()); }
+  inline int num_columns() const {
+    return lazy_row_group_ != nullptr ? lazy_row_group_->num_columns()
+                                      : static_cast<int>(row_group_->columns.size());
+  }
 
   inline int64_t num_rows() const { return row_group_->num_rows; }
 
@@ -643,8 +762,11 @@ class RowGroupMetaData::RowGroupMetaDataImpl {
     if (i >= 0 && i < num_columns()) {
       int16_t row_group_ordinal =
           row_group_->__isset.ordinal ? row_group_->ordinal : static_cast<int16_t>(-1);
-      return ColumnChunkMetaData::Make(&row_group_->columns[i], schema_->Column(i),
-                                       properties_, writer_version_, row_group_ordinal, i,
+      const format::ColumnChunk* column = lazy_row_group_ != nullptr
+                                               ? lazy_row_group_->column(i)
+                                               : &row_group_->columns[i];
+      return ColumnChunkMetaData::Make(column, schema_->Column(i), properties_,
+                                       writer_version_, row_group_ordinal, i,
                                        file_decryptor_);
     }
     throw ParquetException("The file only has ", num_columns(),
@@ -664,7 +786,13 @@ class RowGroupMetaData::RowGroupMetaDataImpl {
   }
 
  private:
+  format::RowGroup Decode() const {
+    return lazy_row_group_ != nullptr ? lazy_row_group_->Decode() : *row_group_;
+  }
+
   const format::RowGroup* row_group_;
+  // Set if the column chunks of row_group_ are decoded on demand
+  LazyRowGroup* lazy_row_group_ = nullptr;
   const SchemaDescriptor* schema_;
   const ReaderProperties properties_;
   const ApplicationVersion* writer_version_;
@@ -687,6 +815,9 @@ RowGroupMetaData::RowGroupMetaData(const void* metadata, const SchemaDescriptor*
                                      schema, properties, writer_version,
                                      std::move(file_decryptor))} {}
 
+RowGroupMetaData::RowGroupMetaData(std::unique_ptr<RowGroupMetaDataImpl> impl)
+    : impl_(std::move(impl)) {}
+
 RowGroupMetaData::~RowGroupMetaData() = default;
 
 bool RowGroupMetaData::Equals(const RowGroupMetaData& other) const {
@@ -783,9 +914,19 @@ class FileMetaData::FileMetaDataImpl {
         file_decryptor_ != nullptr ? file_decryptor_->GetFooterDecryptor() : nullptr;
 
     ThriftDeserializer deserializer(properties_);
-    deserializer.DeserializeMessage(reinterpret_cast<const uint8_t*>(metadata),
-                                    metadata_len, metadata_.get(),
-                                    footer_decryptor.get());
+    if (properties_.lazy_metadata_decoding() && footer_decryptor == nullptr) {
+      std::vector<ByteRange> row_group_ranges;
+      deserializer.DeserializeMessageSkippingList(
+          reinterpret_cast<const uint8_t*>(metadata), metadata_len, kRowGroupsFieldId,
+          metadata_.get(), &row_group_ranges);
+      lazy_row_groups_ = std::make_unique<LazyRowGroups>(
+          reinterpret_cast<const uint8_t*>(metadata), *metadata_len,
+          std::move(row_group_ranges), properties_);
+    } else {
+      deserializer.DeserializeMessage(reinterpret_cast<const uint8_t*>(metadata),
+                                      metadata_len, metadata_.get(),
+                                      footer_decryptor.get());
+    }
     metadata_len_ = *metadata_len;
 
     if (metadata_->__isset.created_by) {
@@ -804,6 +945,7 @@ class FileMetaData::FileMetaDataImpl {
     if (file_decryptor_ == nullptr) {
       throw ParquetException("Decryption not set properly. cannot verify signature");
     }
+    DecodeRowGroups();
     // serialize the footer
     uint8_t* serialized_data;
     uint32_t serialized_len = metadata_len_;
@@ -838,6 +980,9 @@ class FileMetaData::FileMetaDataImpl {
   inline int num_columns() const { return schema_.num_columns(); }
   inline int64_t num_rows() const { return metadata_->num_rows; }
   inline int num_row_groups() const {
+    if (is_lazy()) {
+      return lazy_row_groups_->size();
+    }
     return static_cast<int>(metadata_->row_groups.size());
   }
   inline int32_t version() const { return metadata_->version; }
@@ -860,6 +1005,7 @@ class FileMetaData::FileMetaDataImpl {
 
   void WriteTo(::arrow::io::OutputStream* dst,
                const std::shared_ptr<Encryptor>& encryptor) const {
+    DecodeRowGroups();
     ThriftSerializer serializer;
     // Only in encrypted files with plaintext footers the
     // encryption_algorithm is set in footer
@@ -895,11 +1041,19 @@ class FileMetaData::FileMetaDataImpl {
          << " row groups, requested metadata for row group: " << i;
       throw ParquetException(ss.str());
     }
+    if (is_lazy()) {
+      return std::unique_ptr<RowGroupMetaData>(
+          new RowGroupMetaData(std::make_unique<RowGroupMetaData::RowGroupMetaDataImpl>(
+              lazy_row_groups_->Get(i), &schema_, properties_, &writer_version_,
+              file_decryptor_)));
+    }
     return RowGroupMetaData::Make(&metadata_->row_groups[i], &schema_, properties_,
                                   &writer_version_, file_decryptor_);
   }
 
   bool Equals(const FileMetaDataImpl& other) const {
+    DecodeRowGroups();
+    other.DecodeRowGroups();
     return *metadata_ == *other.metadata_;
   }
 
@@ -910,6 +1064,7 @@ class FileMetaData::FileMetaDataImpl {
   }
 
   void set_file_path(const std::string& path) {
+    DecodeRowGroups();
     for (format::RowGroup& row_group : metadata_->row_groups) {
       for (format::ColumnChunk& chunk : row_group.columns) {
         chunk.__set_file_path(path);
@@ -917,13 +1072,16 @@ class FileMetaData::FileMetaDataImpl {
     }
   }
 
-  format::RowGroup& row_group(int i) {
+  format::RowGroup row_group(int i) const {
     if (!(i >= 0 && i < num_row_groups())) {
       std::stringstream ss;
       ss << "The file only has " << num_row_groups()
          << " row groups, requested metadata for row group: " << i;
       throw ParquetException(ss.str());
     }
+    if (is_lazy()) {
+      return lazy_row_groups_->Get(i)->Decode();
+    }
     return metadata_->row_groups[i];
   }
 
@@ -934,6 +1092,7 @@ class FileMetaData::FileMetaDataImpl {
       throw ParquetException(msg);
     }
 
+    DecodeRowGroups();
     // ARROW-13654: `other` may point to self, be careful not to enter an infinite loop
     const int n = other->num_row_groups();
     // ARROW-16613: do not use reserve() as that may suppress overallocation
@@ -969,8 +1128,8 @@ class FileMetaData::FileMetaDataImpl {
 
     int i = 0;
     for (int selected_index : row_groups) {
-      metadata->num_rows += row_group(selected_index).num_rows;
-      metadata->row_groups[i++] = row_group(selected_index);
+      metadata->row_groups[i] = row_group(selected_index);
+      metadata->num_rows += metadata->row_groups[i++].num_rows;
     }
 
     metadata->key_value_metadata = metadata_->key_value_metadata;
@@ -989,6 +1148,7 @@ class FileMetaData::FileMetaDataImpl {
   }
 
   std::string SerializeUnencrypted(bool scrub, bool debug) const {
+    DecodeRowGroups();
     auto md = *metadata_;
     if (scrub) Scrub(&md);
     if (debug) {
@@ -1020,6 +1180,32 @@ class FileMetaData::FileMetaDataImpl {
   std::shared_ptr<const KeyValueMetadata> key_value_metadata_;
   const ReaderProperties properties_;
   std::shared_ptr<InternalFileDecryptor> file_decryptor_;
+  // Only set with ReaderProperties::lazy_metadata_decoding(). metadata_->row_groups
+  // is left empty until DecodeRowGroups() is called.
+  std::unique_ptr<LazyRowGroups> lazy_row_groups_;
+  mutable std::mutex decode_mutex_;
+  mutable std::atomic<bool> row_groups_decoded_{false};
+
+  bool is_lazy() const { return lazy_row_groups_ != nullptr && !row_groups_decoded_; }
+
+  // Populate metadata_->row_groups from the lazily decoded row groups, for operations
+  // that need the whole thrift message. Row groups already returned by RowGroup()
+  // remain valid.
+  void DecodeRowGroups() const {
+    if (!is_lazy()) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(decode_mutex_);
+    if (row_groups_decoded_) {
+      return;
+    }
+    std::vector<format::RowGroup> row_groups(lazy_row_groups_->size());
+    for (int i = 0; i < lazy_row_groups_->size(); ++i) {
+      row_groups[i] = lazy_row_groups_->Get(i)->Decode();
+    }
+    metadata_->row_groups = std::move(row_groups);
+    row_groups_decoded_ = true;
+  }
 
   void InitSchema() {
     if (metadata_->schema.empty()) {
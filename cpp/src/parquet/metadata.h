@@ -226,6 +226,7 @@ class PARQUET_EXPORT RowGroupMetaData {
   std::vector<SortingColumn> sorting_columns() const;
 
  private:
+  friend class FileMetaData;
   explicit RowGroupMetaData(
       const void* metadata, const SchemaDescriptor* schema,
       const ReaderProperties& properties,
@@ -233,6 +234,7 @@ class PARQUET_EXPORT RowGroupMetaData {
       std::shared_ptr<InternalFileDecryptor> file_decryptor = NULLPTR);
   // PIMPL Idiom
   class RowGroupMetaDataImpl;
+  explicit RowGroupMetaData(std::unique_ptr<RowGroupMetaDataImpl> impl);
   std::unique_ptr<RowGroupMetaDataImpl> impl_;
 };
 
@@ -92,15 +92,25 @@ class MetadataBenchmark {
     return buf;
   }
 
-  void ReadFile(std::shared_ptr<Buffer> contents) {
+  // Open the file and access the column chunk metadata of the first
+  // `num_columns_read` columns in every row group
+  void ReadFile(std::shared_ptr<Buffer> contents, bool lazy_decoding = false,
+                int num_columns_read = 0) {
     auto source = std::make_shared<BufferReader>(contents);
     ReaderProperties props;
+    props.set_lazy_metadata_decoding(lazy_decoding);
     auto reader = ParquetFileReader::Open(source, props);
     auto metadata = reader->metadata();
     ARROW_CHECK_EQ(metadata->num_columns(), num_columns_);
     ARROW_CHECK_EQ(metadata->num_row_groups(), num_row_groups_);
     // There should be one row per row group
     ARROW_CHECK_EQ(metadata->num_rows(), num_row_groups_);
+    for (int rg = 0; rg < num_row_groups_; ++rg) {
+      auto row_group = metadata->RowGroup(rg);
+      for (int col = 0; col < num_columns_read; ++col) {
+        ARROW_CHECK_EQ(row_group->ColumnChunk(col)->num_values(), 1);
+      }
+    }
     reader->Close();
   }
 
@@ -131,6 +141,18 @@ void ReadMetadataSetArgs(benchmark::internal::Benchmark* bench) {
   WriteMetadataSetArgs(bench);
 }
 
+void ReadWideMetadataSetArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"num_columns", "num_row_groups", "lazy"});
+
+  for (int num_columns : {1000, 10000}) {
+    for (int num_row_groups : {1, 10}) {
+      for (int lazy : {0, 1}) {
+        bench->Args({num_columns, num_row_groups, lazy});
+      }
+    }
+  }
+}
+
 void WriteFileMetadataAndData(benchmark::State& state) {
   MetadataBenchmark benchmark(&state);
 
@@ -150,7 +172,21 @@ void ReadFileMetadata(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations());
 }
 
+// Open files with wide schemas and read the metadata of only a few columns, with
+// either eager or lazy decoding of the row group metadata
+void ReadWideFileMetadataColumnSubset(benchmark::State& state) {
+  MetadataBenchmark benchmark(&state);
+  auto contents = benchmark.WriteFile(&state);
+  const bool lazy_decoding = state.range(2) != 0;
+
+  for (auto _ : state) {
+    benchmark.ReadFile(contents, lazy_decoding, /*num_columns_read=*/5);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
 BENCHMARK(WriteFileMetadataAndData)->Apply(WriteMetadataSetArgs);
 BENCHMARK(ReadFileMetadata)->Apply(ReadMetadataSetArgs);
+BENCHMARK(ReadWideFileMetadataColumnSubset)->Apply(ReadWideMetadataSetArgs);
 
 }  // namespace parquet
@@ -0,0 +1,169 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/metadata_cache.h"
+
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/util/hash_util.h"
+#include "parquet/metadata.h"
+
+namespace parquet {
+
+namespace {
+
+struct KeyHash {
+  size_t operator()(const FileMetaDataCache::Key& key) const {
+    size_t hash = std::hash<std::string>{}(key.path);
+    ::arrow::internal::hash_combine(hash, key.size);
+    ::arrow::internal::hash_combine(hash, key.version);
+    return hash;
+  }
+};
+
+int64_t EntryCost(const FileMetaData& metadata) {
+  return static_cast<int64_t>(metadata.size());
+}
+
+}  // namespace
+
+class FileMetaDataCache::Impl {
+ public:
+  explicit Impl(int64_t capacity) : capacity_(capacity) {}
+
+  std::shared_ptr<FileMetaData> Get(const Key& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+      ++misses_;
+      return nullptr;
+    }
+    ++hits_;
+    // Move the entry to the front of the LRU list
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return it->second->second;
+  }
+
+  void Put(const Key& key, std::shared_ptr<FileMetaData> metadata) {
+    const int64_t cost = EntryCost(*metadata);
+    std::lock_guard<std::mutex> lock(mutex_);
+    EraseUnlocked(key);
+    if (cost > capacity_) {
+      return;
+    }
+    lru_.emplace_front(key, std::move(metadata));
+    entries_.emplace(key, lru_.begin());
+    size_ += cost;
+    while (size_ > capacity_) {
+      EraseUnlocked(lru_.back().first);
+    }
+  }
+
+  void Erase(const Key& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    EraseUnlocked(key);
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    lru_.clear();
+    size_ = 0;
+  }
+
+  int64_t capacity() const { return capacity_; }
+
+  int64_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return size_;
+  }
+
+  int64_t num_entries() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int64_t>(entries_.size());
+  }
+
+  int64_t hits() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hits_;
+  }
+
+  int64_t misses() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return misses_;
+  }
+
+ private:
+  using Entry = std::pair<Key, std::shared_ptr<FileMetaData>>;
+
+  void EraseUnlocked(const Key& key) {
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+      return;
+    }
+    size_ -= EntryCost(*it->second->second);
+    lru_.erase(it->second);
+    entries_.erase(it);
+  }
+
+  const int64_t capacity_;
+  mutable std::mutex mutex_;
+  // Most recently used entries first
+  std::list<Entry> lru_;
+  std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> entries_;
+  int64_t size_ = 0;
+  int64_t hits_ = 0;
+  int64_t misses_ = 0;
+};
+
+FileMetaDataCache::FileMetaDataCache(int64_t capacity)
+    : impl_(std::make_unique<Impl>(capacity)) {}
+
+FileMetaDataCache::~FileMetaDataCache() = default;
+
+const std::shared_ptr<FileMetaDataCache>& FileMetaDataCache::ProcessWide() {
+  static const auto cache = std::make_shared<FileMetaDataCache>();
+  return cache;
+}
+
+std::shared_ptr<FileMetaData> FileMetaDataCache::Get(const Key& key) {
+  return impl_->Get(key);
+}
+
+void FileMetaDataCache::Put(const Key& key, std::shared_ptr<FileMetaData> metadata) {
+  impl_->Put(key, std::move(metadata));
+}
+
+void FileMetaDataCache::Erase(const Key& key) { impl_->Erase(key); }
+
+void FileMetaDataCache::Clear() { impl_->Clear(); }
+
+int64_t FileMetaDataCache::capacity() const { return impl_->capacity(); }
+
+int64_t FileMetaDataCache::size() const { return impl_->size(); }
+
+int64_t FileMetaDataCache::num_entries() const { return impl_->num_entries(); }
+
+int64_t FileMetaDataCache::hits() const { return impl_->hits(); }
+
+int64_t FileMetaDataCache::misses() const { return impl_->misses(); }
+
+}  // namespace parquet
@@ -0,0 +1,95 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "parquet/platform.h"
+#include "parquet/type_fwd.h"
+
+namespace parquet {
+
+/// \brief A size-bounded cache of decoded file metadata, shared across readers.
+///
+/// Opening a Parquet file requires reading and decoding its footer, which costs one
+/// or two round trips on high latency filesystems. Readers opened with a cache
+/// (see ReaderProperties::set_metadata_cache()) reuse the FileMetaData of a file
+/// opened before instead.
+///
+/// Entries identify a version of a file by its path, size and a version tag such as
+/// its modification time or ETag, so that a rewritten file isn't read with stale
+/// metadata. The cost of an entry is the size of its serialized footer, and the least
+/// recently used entries are evicted first once the capacity is exceeded.
+///
+/// This class is thread-safe.
+class PARQUET_EXPORT FileMetaDataCache {
+ public:
+  static constexpr int64_t kDefaultCapacity = 64 * 1024 * 1024;
+
+  struct PARQUET_EXPORT Key {
+    /// The path of the file, qualified enough to be unique across filesystems
+    std::string path;
+    /// The size of the file in bytes
+    int64_t size = -1;
+    /// A tag changing whenever the file is rewritten, e.g. its modification time
+    std::string version;
+
+    bool operator==(const Key& other) const {
+      return path == other.path && size == other.size && version == other.version;
+    }
+    bool operator!=(const Key& other) const { return !(*this == other); }
+  };
+
+  /// \brief Create a cache holding up to `capacity` bytes of serialized footers.
+  explicit FileMetaDataCache(int64_t capacity = kDefaultCapacity);
+  ~FileMetaDataCache();
+
+  /// \brief Return the process-wide cache, with the default capacity.
+  static const std::shared_ptr<FileMetaDataCache>& ProcessWide();
+
+  /// \brief Return the cached metadata for `key`, or nullptr if not cached.
+  std::shared_ptr<FileMetaData> Get(const Key& key);
+
+  /// \brief Cache the metadata of `key`, replacing any previous entry.
+  ///
+  /// Metadata larger than the capacity of the cache is not cached.
+  void Put(const Key& key, std::shared_ptr<FileMetaData> metadata);
+
+  /// \brief Remove the entry for `key`, if any.
+  void Erase(const Key& key);
+
+  /// \brief Remove all entries. The hit and miss counters are kept.
+  void Clear();
+
+  int64_t capacity() const;
+  /// \brief The total cost of the cached entries, in bytes
+  int64_t size() const;
+  int64_t num_entries() const;
+  /// \brief The number of calls to Get() which found an entry
+  int64_t hits() const;
+  /// \brief The number of calls to Get() which didn't find an entry
+  int64_t misses() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace parquet
@@ -19,9 +19,12 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/future.h"
 #include "arrow/util/key_value_metadata.h"
 #include "parquet/file_reader.h"
 #include "parquet/file_writer.h"
+#include "parquet/metadata_cache.h"
 #include "parquet/schema.h"
 #include "parquet/statistics.h"
 #include "parquet/test_util.h"
@@ -470,6 +473,166 @@ TEST(Metadata, TestSortingColumns) {
   EXPECT_EQ(sorting_columns, row_group_read_metadata->sorting_columns());
 }
 
+TEST(Metadata, TestLazyDecoding) {
+  schema::NodeVector fields;
+  fields.push_back(schema::Int32("sort_col", Repetition::REQUIRED));
+  fields.push_back(schema::Int32("int_col", Repetition::REQUIRED));
+  auto schema = std::static_pointer_cast<schema::GroupNode>(
+      schema::GroupNode::Make("schema", Repetition::REQUIRED, fields));
+  SortingColumn sorting_column;
+  sorting_column.column_idx = 0;
+  sorting_column.descending = false;
+  sorting_column.nulls_first = false;
+  auto writer_props =
+      WriterProperties::Builder().set_sorting_columns({sorting_column})->build();
+
+  auto sink = CreateOutputStream();
+  auto file_writer = ParquetFileWriter::Open(sink, schema, writer_props);
+  for (int32_t i = 0; i < 3; ++i) {
+    auto row_group_writer = file_writer->AppendRowGroup();
+    for (int32_t j = 0; j < 2; ++j) {
+      std::vector<int32_t> values = {i, j, i + j + 1};
+      auto column_writer = static_cast<Int32Writer*>(row_group_writer->NextColumn());
+      column_writer->WriteBatch(i + 1, nullptr, nullptr, values.data());
+    }
+    row_group_writer->Close();
+  }
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+
+  ReaderProperties lazy_props;
+  lazy_props.set_lazy_metadata_decoding(true);
+  auto eager =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer))
+          ->metadata();
+  auto lazy = ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer),
+                                      lazy_props)
+                  ->metadata();
+  ASSERT_EQ(3, lazy->num_row_groups());
+  ASSERT_EQ(eager->num_rows(), lazy->num_rows());
+  ASSERT_EQ(eager->size(), lazy->size());
+  ASSERT_TRUE(lazy->schema()->Equals(*eager->schema()));
+
+  std::vector<std::unique_ptr<RowGroupMetaData>> lazy_row_groups;
+  for (int i = 0; i < 3; ++i) {
+    auto eager_row_group = eager->RowGroup(i);
+    auto lazy_row_group = lazy->RowGroup(i);
+    ASSERT_EQ(2, lazy_row_group->num_columns());
+    ASSERT_EQ(i + 1, lazy_row_group->num_rows());
+    ASSERT_EQ(eager_row_group->sorting_columns(), lazy_row_group->sorting_columns());
+    for (int j = 0; j < 2; ++j) {
+      ASSERT_TRUE(
+          lazy_row_group->ColumnChunk(j)->Equals(*eager_row_group->ColumnChunk(j)));
+    }
+    ASSERT_TRUE(lazy_row_group->Equals(*eager_row_group));
+    lazy_row_groups.push_back(std::move(lazy_row_group));
+  }
+  ASSERT_THROW(lazy->RowGroup(3), ParquetException);
+  ASSERT_THROW(lazy_row_groups[0]->ColumnChunk(2), ParquetException);
+
+  ASSERT_TRUE(lazy->Subset({2, 0})->Equals(*eager->Subset({2, 0})));
+
+  // Operations on the whole footer decode all row groups first
+  ASSERT_EQ(eager->SerializeToString(), lazy->SerializeToString());
+  ASSERT_TRUE(lazy->Equals(*eager));
+  lazy->AppendRowGroups(*eager);
+  ASSERT_EQ(6, lazy->num_row_groups());
+  ASSERT_TRUE(lazy->RowGroup(5)->Equals(*eager->RowGroup(2)));
+  // Row groups returned before remain valid
+  ASSERT_EQ(3, lazy_row_groups[2]->ColumnChunk(1)->num_values());
+}
+
+std::shared_ptr<Buffer> WriteEmptyFile(const std::string& column_name) {
+  schema::NodeVector fields;
+  fields.push_back(schema::Int32(column_name, Repetition::REQUIRED));
+  auto schema = std::static_pointer_cast<schema::GroupNode>(
+      schema::GroupNode::Make("schema", Repetition::REQUIRED, fields));
+  auto sink = CreateOutputStream();
+  auto file_writer = ParquetFileWriter::Open(sink, schema);
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+  return buffer;
+}
+
+TEST(FileMetaDataCache, OpenWithKey) {
+  auto buffer = WriteEmptyFile("a");
+  auto cache = std::make_shared<FileMetaDataCache>();
+  ReaderProperties props;
+  props.set_metadata_cache(cache);
+  const FileMetaDataCache::Key key{"mem://a.parquet", buffer->size(), "1"};
+
+  auto first =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer), props,
+                              key);
+  ASSERT_EQ(0, cache->hits());
+  ASSERT_EQ(1, cache->misses());
+  ASSERT_EQ(1, cache->num_entries());
+  ASSERT_EQ(static_cast<int64_t>(first->metadata()->size()), cache->size());
+
+  auto second_future = ParquetFileReader::OpenAsync(
+      std::make_shared<::arrow::io::BufferReader>(buffer), props, key);
+  ASSERT_OK_AND_ASSIGN(auto second, second_future.MoveResult());
+  ASSERT_EQ(1, cache->hits());
+  ASSERT_EQ(first->metadata(), second->metadata());
+
+  // A different version of the file misses
+  auto other_key = key;
+  other_key.version = "2";
+  auto third =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer), props,
+                              other_key);
+  ASSERT_EQ(2, cache->misses());
+  ASSERT_NE(first->metadata(), third->metadata());
+  ASSERT_EQ(2, cache->num_entries());
+}
+
+TEST(FileMetaDataCache, EvictsLeastRecentlyUsed) {
+  std::vector<std::shared_ptr<FileMetaData>> metadata;
+  for (const auto& name : {"a", "b", "c"}) {
+    auto reader = ParquetFileReader::Open(
+        std::make_shared<::arrow::io::BufferReader>(WriteEmptyFile(name)));
+    metadata.push_back(reader->metadata());
+  }
+  const uint32_t entry_size = metadata[0]->size();
+  ASSERT_EQ(entry_size, metadata[1]->size());
+  ASSERT_EQ(entry_size, metadata[2]->size());
+  FileMetaDataCache cache(/*capacity=*/2 * entry_size);
+  auto key = [](const std::string& path) {
+    return FileMetaDataCache::Key{path, /*size=*/100, /*version=*/""};
+  };
+
+  cache.Put(key("a"), metadata[0]);
+  cache.Put(key("b"), metadata[1]);
+  ASSERT_EQ(metadata[0], cache.Get(key("a")));
+  // "b" is now the least recently used entry
+  cache.Put(key("c"), metadata[2]);
+  ASSERT_EQ(2, cache.num_entries());
+  ASSERT_EQ(2 * entry_size, cache.size());
+  ASSERT_EQ(nullptr, cache.Get(key("b")));
+  ASSERT_EQ(metadata[0], cache.Get(key("a")));
+  ASSERT_EQ(metadata[2], cache.Get(key("c")));
+  ASSERT_EQ(3, cache.hits());
+  ASSERT_EQ(1, cache.misses());
+
+  // Replacing an entry doesn't count it twice
+  cache.Put(key("c"), metadata[2]);
+  ASSERT_EQ(2 * entry_size, cache.size());
+
+  cache.Erase(key("a"));
+  ASSERT_EQ(1, cache.num_entries());
+  ASSERT_EQ(entry_size, cache.size());
+
+  // Entries larger than the cache are not added
+  FileMetaDataCache small_cache(/*capacity=*/entry_size - 1);
+  small_cache.Put(key("a"), metadata[0]);
+  ASSERT_EQ(0, small_cache.num_entries());
+
+  cache.Clear();
+  ASSERT_EQ(0, cache.num_entries());
+  ASSERT_EQ(0, cache.size());
+  ASSERT_EQ(3, cache.hits());
+}
+
 TEST(ApplicationVersion, Basics) {
   ApplicationVersion version("parquet-mr version 1.7.9");
   ApplicationVersion version1("parquet-mr version 1.8.0");
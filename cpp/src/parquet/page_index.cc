@@ -26,12 +26,15 @@
 #include "parquet/statistics.h"
 #include "parquet/thrift_internal.h"
 
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/unreachable.h"
 
+#include <algorithm>
 #include <limits>
 #include <numeric>
+#include <sstream>
 
 namespace parquet {
 
@@ -958,6 +961,128 @@ RowGroupIndexReadRange PageIndexReader::DeterminePageIndexRangesInRowGroup(
   return read_range;
 }
 
+// ----------------------------------------------------------------------
+// RowRanges
+
+RowRanges::RowRanges(std::vector<Range> ranges) {
+  std::sort(ranges.begin(), ranges.end(), [](const Range& left, const Range& right) {
+    return left.start < right.start;
+  });
+  for (const Range& range : ranges) {
+    if (range.start >= range.end) {
+      continue;
+    }
+    if (!ranges_.empty() && range.start <= ranges_.back().end) {
+      ranges_.back().end = std::max(ranges_.back().end, range.end);
+    } else {
+      ranges_.push_back(range);
+    }
+  }
+}
+
+RowRanges RowRanges::All(int64_t num_rows) { return RowRanges({{0, num_rows}}); }
+
+RowRanges RowRanges::FromBitmap(const uint8_t* bitmap, int64_t offset, int64_t length) {
+  RowRanges row_ranges;
+  ::arrow::internal::SetBitRunReader reader(bitmap, offset, length);
+  for (auto run = reader.NextRun(); run.length > 0; run = reader.NextRun()) {
+    row_ranges.ranges_.push_back({run.position, run.position + run.length});
+  }
+  return row_ranges;
+}
+
+int64_t RowRanges::row_count() const {
+  int64_t count = 0;
+  for (const Range& range : ranges_) {
+    count += range.length();
+  }
+  return count;
+}
+
+bool RowRanges::Overlaps(int64_t start, int64_t end) const {
+  // First range ending after start
+  auto it = std::upper_bound(
+      ranges_.begin(), ranges_.end(), start,
+      [](int64_t row, const Range& range) { return row < range.end; });
+  return it != ranges_.end() && it->start < end && start < end;
+}
+
+RowRanges RowRanges::Intersect(const RowRanges& other) const {
+  RowRanges out;
+  auto left = ranges_.begin();
+  auto right = other.ranges_.begin();
+  while (left != ranges_.end() && right != other.ranges_.end()) {
+    const int64_t start = std::max(left->start, right->start);
+    const int64_t end = std::min(left->end, right->end);
+    if (start < end) {
+      out.ranges_.push_back({start, end});
+    }
+    if (left->end < right->end) {
+      ++left;
+    } else {
+      ++right;
+    }
+  }
+  return out;
+}
+
+RowRanges RowRanges::Union(const RowRanges& other) const {
+  std::vector<Range> ranges = ranges_;
+  ranges.insert(ranges.end(), other.ranges_.begin(), other.ranges_.end());
+  return RowRanges(std::move(ranges));
+}
+
+std::string RowRanges::ToString() const {
+  std::stringstream ss;
+  ss << "[";
+  for (size_t i = 0; i < ranges_.size(); ++i) {
+    if (i > 0) {
+      ss << ", ";
+    }
+    ss << "[" << ranges_[i].start << ", " << ranges_[i].end << ")";
+  }
+  ss << "]";
+  return ss.str();
+}
+
+namespace {
+
+int64_t PageLastRow(const std::vector<PageLocation>& page_locations, size_t page,
+                    int64_t num_rows) {
+  return page + 1 < page_locations.size() ? page_locations[page + 1].first_row_index
+                                          : num_rows;
+}
+
+}  // namespace
+
+std::vector<int32_t> SelectPages(const OffsetIndex& offset_index, const RowRanges& rows,
+                                 int64_t num_rows) {
+  const auto& page_locations = offset_index.page_locations();
+  std::vector<int32_t> pages;
+  for (size_t i = 0; i < page_locations.size(); ++i) {
+    if (rows.Overlaps(page_locations[i].first_row_index,
+                      PageLastRow(page_locations, i, num_rows))) {
+      pages.push_back(static_cast<int32_t>(i));
+    }
+  }
+  return pages;
+}
+
+RowRanges PageRowRanges(const OffsetIndex& offset_index,
+                        const std::vector<int32_t>& pages, int64_t num_rows) {
+  const auto& page_locations = offset_index.page_locations();
+  std::vector<RowRanges::Range> ranges;
+  ranges.reserve(pages.size());
+  for (int32_t page : pages) {
+    if (page < 0 || static_cast<size_t>(page) >= page_locations.size()) {
+      throw ParquetException("Invalid page ordinal ", page);
+    }
+    ranges.push_back({page_locations[page].first_row_index,
+                      PageLastRow(page_locations, page, num_rows)});
+  }
+  return RowRanges(std::move(ranges));
+}
+
 // ----------------------------------------------------------------------
 // Public factory functions
 
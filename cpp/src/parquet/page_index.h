@@ -24,6 +24,7 @@
 #include "parquet/types.h"
 
 #include <optional>
+#include <string>
 #include <vector>
 
 namespace parquet {
@@ -146,6 +147,76 @@ class PARQUET_EXPORT OffsetIndex {
   virtual const std::vector<int64_t>& unencoded_byte_array_data_bytes() const = 0;
 };
 
+/// \brief A set of rows of a row group, stored as sorted and disjoint ranges.
+///
+/// Row numbers are relative to the start of the row group.
+class PARQUET_EXPORT RowRanges {
+ public:
+  /// \brief The rows in [start, end)
+  struct Range {
+    int64_t start;
+    int64_t end;
+
+    int64_t length() const { return end - start; }
+    bool operator==(const Range& other) const {
+      return start == other.start && end == other.end;
+    }
+  };
+
+  RowRanges() = default;
+
+  /// \brief Create a set from ranges given in any order, which may overlap.
+  ///
+  /// Empty ranges are ignored.
+  explicit RowRanges(std::vector<Range> ranges);
+
+  /// \brief The rows in [0, num_rows)
+  static RowRanges All(int64_t num_rows);
+
+  /// \brief The rows whose bit is set in a bitmap, row i being bit (offset + i).
+  static RowRanges FromBitmap(const uint8_t* bitmap, int64_t offset, int64_t length);
+
+  /// \brief The sorted and disjoint ranges of the set.
+  const std::vector<Range>& ranges() const { return ranges_; }
+
+  /// \brief The number of rows in the set.
+  int64_t row_count() const;
+
+  bool empty() const { return ranges_.empty(); }
+
+  /// \brief Whether any row in [start, end) is in the set.
+  bool Overlaps(int64_t start, int64_t end) const;
+
+  RowRanges Intersect(const RowRanges& other) const;
+  RowRanges Union(const RowRanges& other) const;
+
+  bool operator==(const RowRanges& other) const { return ranges_ == other.ranges_; }
+
+  std::string ToString() const;
+
+ private:
+  std::vector<Range> ranges_;
+};
+
+/// \brief Select the data pages of a column chunk holding some of the given rows.
+///
+/// \param[in] offset_index offset index of the column chunk.
+/// \param[in] rows the rows to read.
+/// \param[in] num_rows the number of rows in the row group.
+/// \returns the ordinals of the selected pages, in increasing order.
+PARQUET_EXPORT
+std::vector<int32_t> SelectPages(const OffsetIndex& offset_index, const RowRanges& rows,
+                                 int64_t num_rows);
+
+/// \brief The rows stored in some data pages of a column chunk.
+///
+/// \param[in] offset_index offset index of the column chunk.
+/// \param[in] pages the ordinals of the pages, in increasing order.
+/// \param[in] num_rows the number of rows in the row group.
+PARQUET_EXPORT
+RowRanges PageRowRanges(const OffsetIndex& offset_index,
+                        const std::vector<int32_t>& pages, int64_t num_rows);
+
 /// \brief Interface for reading the page index for a Parquet row group.
 class PARQUET_EXPORT RowGroupPageIndexReader {
  public:
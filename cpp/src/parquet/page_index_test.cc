@@ -419,6 +419,46 @@ TEST(PageIndex, DeterminePageIndexRangesInRowGroupWithMissingPageIndex) {
                          -1);
 }
 
+TEST(RowRanges, Basics) {
+  using Range = RowRanges::Range;
+  RowRanges ranges({{20, 30}, {0, 5}, {4, 10}, {15, 15}, {30, 32}});
+  ASSERT_EQ(std::vector<Range>({{0, 10}, {20, 32}}), ranges.ranges());
+  ASSERT_EQ(22, ranges.row_count());
+  ASSERT_EQ("[[0, 10), [20, 32)]", ranges.ToString());
+  ASSERT_TRUE(RowRanges().empty());
+  ASSERT_EQ(RowRanges({{0, 7}}), RowRanges::All(7));
+
+  ASSERT_TRUE(ranges.Overlaps(9, 20));
+  ASSERT_FALSE(ranges.Overlaps(10, 20));
+  ASSERT_TRUE(ranges.Overlaps(31, 100));
+  ASSERT_FALSE(ranges.Overlaps(32, 100));
+  ASSERT_FALSE(ranges.Overlaps(5, 5));
+
+  RowRanges other({{5, 25}, {31, 40}});
+  ASSERT_EQ(RowRanges({{5, 10}, {20, 25}, {31, 32}}), ranges.Intersect(other));
+  ASSERT_EQ(RowRanges({{0, 40}}), ranges.Union(other));
+  ASSERT_TRUE(ranges.Intersect(RowRanges()).empty());
+
+  const uint8_t bitmap[] = {0b11100110, 0b00000001};
+  ASSERT_EQ(RowRanges({{0, 2}, {4, 8}}), RowRanges::FromBitmap(bitmap, 1, 9));
+}
+
+TEST(RowRanges, SelectPages) {
+  auto builder = OffsetIndexBuilder::Make();
+  builder->AddPage(/*offset=*/100, /*compressed_page_size=*/10, /*first_row_index=*/0);
+  builder->AddPage(/*offset=*/110, /*compressed_page_size=*/10, /*first_row_index=*/10);
+  builder->AddPage(/*offset=*/120, /*compressed_page_size=*/10, /*first_row_index=*/25);
+  builder->Finish(/*final_position=*/0);
+  auto offset_index = builder->Build();
+
+  auto pages = SelectPages(*offset_index, RowRanges({{9, 10}, {30, 31}}), 40);
+  ASSERT_EQ(std::vector<int32_t>({0, 2}), pages);
+  ASSERT_EQ(RowRanges({{0, 10}, {25, 40}}), PageRowRanges(*offset_index, pages, 40));
+  ASSERT_TRUE(SelectPages(*offset_index, RowRanges(), 40).empty());
+  ASSERT_EQ(std::vector<int32_t>({0, 1, 2}),
+            SelectPages(*offset_index, RowRanges::All(40), 40));
+}
+
 void TestWriteOffsetIndex(bool write_size_stats) {
   /// Create offset index via the OffsetIndexBuilder interface.
   auto builder = OffsetIndexBuilder::Make();
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -24,6 +25,7 @@
 #include <utility>
 
 #include "arrow/io/caching.h"
+#include "arrow/memory_pool.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/type_fwd.h"
@@ -69,10 +71,14 @@ constexpr int32_t kDefaultThriftContainerSizeLimit = 1000 * 1000;
 // PARQUET-978: Minimize footer reads by reading 64 KB from the end of the file
 constexpr int64_t kDefaultFooterReadSize = 64 * 1024;
 
+constexpr int64_t kDefaultPageReadaheadMemoryLimit = 64 * 1024 * 1024;
+
 class PARQUET_EXPORT ReaderProperties {
  public:
+  /// If `pool` is a ::arrow::TrackingMemoryPool, reads allocate from its child
+  /// named "parquet".
   explicit ReaderProperties(MemoryPool* pool = ::arrow::default_memory_pool())
-      : pool_(pool) {}
+      : pool_(::arrow::ChildMemoryPool(pool, "parquet")) {}
 
   MemoryPool* memory_pool() const { return pool_; }
 
@@ -139,6 +145,48 @@ class PARQUET_EXPORT ReaderProperties {
   void set_footer_read_size(size_t size) { footer_read_size_ = size; }
   size_t footer_read_size() const { return footer_read_size_; }
 
+  /// \brief Set whether to decode the row groups of the file metadata on demand.
+  ///
+  /// By default the whole footer is decoded when a file is opened. When enabled, only
+  /// the file level fields are decoded at first: the thrift-encoded row groups are
+  /// kept in a copy of the footer, and each row group and column chunk is decoded
+  /// the first time it is accessed. This makes opening files with wide schemas and
+  /// many row groups much cheaper when only a few columns are read. Footers of files
+  /// with encrypted footers are always decoded eagerly. Default false.
+  void set_lazy_metadata_decoding(bool lazy) { lazy_metadata_decoding_ = lazy; }
+  bool lazy_metadata_decoding() const { return lazy_metadata_decoding_; }
+
+  /// \brief Set a cache of file metadata shared with other readers.
+  ///
+  /// ParquetFileReader::Open() overloads taking a FileMetaDataCache::Key look up
+  /// the footer of the file in this cache before reading it, and add it on a miss.
+  /// Files with decryption properties are never cached. Default nullptr (disabled).
+  void set_metadata_cache(std::shared_ptr<FileMetaDataCache> cache) {
+    metadata_cache_ = std::move(cache);
+  }
+  const std::shared_ptr<FileMetaDataCache>& metadata_cache() const {
+    return metadata_cache_;
+  }
+
+  /// \brief Set the number of pages to decompress ahead in each column chunk.
+  ///
+  /// When positive, page readers verify the checksum of (if enabled), decrypt and
+  /// decompress up to this many of the following pages of their column chunk on the
+  /// CPU thread pool while the current page is being decoded. A checksum mismatch is
+  /// reported when the page is reached. Default 0 (pages are processed on the reading
+  /// thread when needed).
+  void set_page_readahead(int32_t num_pages) { page_readahead_ = num_pages; }
+  int32_t page_readahead() const { return page_readahead_; }
+
+  /// \brief Set the limit on the uncompressed size of pages read ahead.
+  ///
+  /// This bounds the memory held by each page reader for pages that were read ahead
+  /// but not returned yet. At least one page is always read ahead.
+  void set_page_readahead_memory_limit(int64_t size) {
+    page_readahead_memory_limit_ = size;
+  }
+  int64_t page_readahead_memory_limit() const { return page_readahead_memory_limit_; }
+
  private:
   MemoryPool* pool_;
   int64_t buffer_size_ = kDefaultBufferSize;
@@ -146,20 +194,27 @@ class PARQUET_EXPORT ReaderProperties {
   int32_t thrift_container_size_limit_ = kDefaultThriftContainerSizeLimit;
   bool buffered_stream_enabled_ = false;
   bool page_checksum_verification_ = false;
+  bool lazy_metadata_decoding_ = false;
+  int32_t page_readahead_ = 0;
+  int64_t page_readahead_memory_limit_ = kDefaultPageReadaheadMemoryLimit;
   // Used with a RecordReader.
   bool read_dense_for_nullable_ = false;
   size_t footer_read_size_ = kDefaultFooterReadSize;
   std::shared_ptr<FileDecryptionProperties> file_decryption_properties_;
+  std::shared_ptr<FileMetaDataCache> metadata_cache_;
 };
 
 ReaderProperties PARQUET_EXPORT default_reader_properties();
 
 static constexpr int64_t kDefaultDataPageSize = 1024 * 1024;
 static constexpr int64_t kDefaultMaxRowsPerPage = 20'000;
+static constexpr int64_t kDefaultAdaptiveEncodingSampleSize = 4096;
 static constexpr bool DEFAULT_IS_DICTIONARY_ENABLED = true;
 static constexpr int64_t DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT = kDefaultDataPageSize;
 static constexpr int64_t DEFAULT_WRITE_BATCH_SIZE = 1024;
 static constexpr int64_t DEFAULT_MAX_ROW_GROUP_LENGTH = 1024 * 1024;
+static constexpr int64_t kDefaultMaxBufferedRowGroupBytes =
+    std::numeric_limits<int64_t>::max();
 static constexpr bool DEFAULT_ARE_STATISTICS_ENABLED = true;
 static constexpr int64_t DEFAULT_MAX_STATISTICS_SIZE = 4096;
 static constexpr Encoding::type DEFAULT_ENCODING = Encoding::UNKNOWN;
@@ -343,6 +398,7 @@ class PARQUET_EXPORT WriterProperties {
           dictionary_pagesize_limit_(DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT),
           write_batch_size_(DEFAULT_WRITE_BATCH_SIZE),
           max_row_group_length_(DEFAULT_MAX_ROW_GROUP_LENGTH),
+          max_buffered_row_group_bytes_(kDefaultMaxBufferedRowGroupBytes),
           pagesize_(kDefaultDataPageSize),
           max_rows_per_page_(kDefaultMaxRowsPerPage),
           version_(ParquetVersion::PARQUET_2_6),
@@ -352,13 +408,16 @@ class PARQUET_EXPORT WriterProperties {
           page_checksum_enabled_(false),
           size_statistics_level_(DEFAULT_SIZE_STATISTICS_LEVEL),
           content_defined_chunking_enabled_(false),
-          content_defined_chunking_options_({}) {}
+          content_defined_chunking_options_({}),
+          adaptive_encoding_enabled_(false),
+          adaptive_encoding_sample_size_(kDefaultAdaptiveEncodingSampleSize) {}
 
     explicit Builder(const WriterProperties& properties)
         : pool_(properties.memory_pool()),
           dictionary_pagesize_limit_(properties.dictionary_pagesize_limit()),
           write_batch_size_(properties.write_batch_size()),
           max_row_group_length_(properties.max_row_group_length()),
+          max_buffered_row_group_bytes_(properties.max_buffered_row_group_bytes()),
           pagesize_(properties.data_pagesize()),
           max_rows_per_page_(properties.max_rows_per_page()),
           version_(properties.version()),
@@ -372,7 +431,9 @@ class PARQUET_EXPORT WriterProperties {
           content_defined_chunking_enabled_(
               properties.content_defined_chunking_enabled()),
           content_defined_chunking_options_(
-              properties.content_defined_chunking_options()) {
+              properties.content_defined_chunking_options()),
+          adaptive_encoding_enabled_(properties.adaptive_encoding_enabled()),
+          adaptive_encoding_sample_size_(properties.adaptive_encoding_sample_size()) {
       CopyColumnSpecificProperties(properties);
     }
 
@@ -402,9 +463,40 @@ class PARQUET_EXPORT WriterProperties {
       return this;
     }
 
+    /// \brief EXPERIMENTAL: Select the encoding of each column chunk from its data.
+    ///
+    /// The first `sample_size` values of each column chunk are encoded with every
+    /// encoding applicable to the column's physical type (PLAIN, dictionary,
+    /// DELTA_BINARY_PACKED, DELTA_BYTE_ARRAY and BYTE_STREAM_SPLIT), and the encoding
+    /// producing the smallest compressed output is used for the rest of the column
+    /// chunk.  The choice is made again for every row group, and is reported in the
+    /// encodings and encoding stats of the column chunk metadata.
+    ///
+    /// This only applies to columns without an explicitly set encoding. Dictionary
+    /// encoding is only considered for columns with dictionary encoding enabled,
+    /// and still falls back to PLAIN if the dictionary grows too large.
+    Builder* enable_adaptive_encoding(
+        int64_t sample_size = kDefaultAdaptiveEncodingSampleSize) {
+      if (sample_size <= 0) {
+        throw ParquetException("Adaptive encoding sample size must be positive");
+      }
+      adaptive_encoding_enabled_ = true;
+      adaptive_encoding_sample_size_ = sample_size;
+      return this;
+    }
+
+    /// \brief EXPERIMENTAL: Use the configured encodings. Default.
+    Builder* disable_adaptive_encoding() {
+      adaptive_encoding_enabled_ = false;
+      return this;
+    }
+
     /// Specify the memory pool for the writer. Default default_memory_pool.
+    ///
+    /// If `pool` is a ::arrow::TrackingMemoryPool, the writer allocates from its
+    /// child named "parquet".
     Builder* memory_pool(MemoryPool* pool) {
-      pool_ = pool;
+      pool_ = ::arrow::ChildMemoryPool(pool, "parquet");
       return this;
     }
 
@@ -468,6 +560,23 @@ class PARQUET_EXPORT WriterProperties {
       return this;
     }
 
+    /// Specify the max number of bytes a buffered row group may hold in memory.
+    /// Default unlimited.
+    ///
+    /// The pages of a buffered row group (see
+    /// ParquetFileWriter::AppendBufferedRowGroup) are kept in memory until it is
+    /// closed.  parquet::arrow::FileWriter::WriteRecordBatch() closes the row group
+    /// early, before it reaches max_row_group_length, once its encoded pages and
+    /// buffered values take at least this many bytes.  Row groups written column
+    /// by column do not buffer their pages, and are not affected.
+    Builder* max_buffered_row_group_bytes(int64_t max_buffered_row_group_bytes) {
+      if (max_buffered_row_group_bytes <= 0) {
+        throw ParquetException("max_buffered_row_group_bytes must be positive");
+      }
+      max_buffered_row_group_bytes_ = max_buffered_row_group_bytes;
+      return this;
+    }
+
     /// Specify the data page size.
     /// Default 1MB.
     Builder* data_pagesize(int64_t pg_size) {
@@ -867,11 +976,13 @@ class PARQUET_EXPORT WriterProperties {
 
       return std::shared_ptr<WriterProperties>(new WriterProperties(
           pool_, dictionary_pagesize_limit_, write_batch_size_, max_row_group_length_,
-          pagesize_, max_rows_per_page_, version_, created_by_, page_checksum_enabled_,
-          size_statistics_level_, std::move(file_encryption_properties_),
+          max_buffered_row_group_bytes_, pagesize_, max_rows_per_page_, version_,
+          created_by_, page_checksum_enabled_, size_statistics_level_,
+          std::move(file_encryption_properties_),
           default_column_properties_, column_properties, data_page_version_,
           store_decimal_as_integer_, std::move(sorting_columns_),
-          content_defined_chunking_enabled_, content_defined_chunking_options_));
+          content_defined_chunking_enabled_, content_defined_chunking_options_,
+          adaptive_encoding_enabled_, adaptive_encoding_sample_size_));
     }
 
    private:
@@ -881,6 +992,7 @@ class PARQUET_EXPORT WriterProperties {
     int64_t dictionary_pagesize_limit_;
     int64_t write_batch_size_;
     int64_t max_row_group_length_;
+    int64_t max_buffered_row_group_bytes_;
     int64_t pagesize_;
     int64_t max_rows_per_page_;
     ParquetVersion::type version_;
@@ -907,6 +1019,9 @@ class PARQUET_EXPORT WriterProperties {
 
     bool content_defined_chunking_enabled_;
     CdcOptions content_defined_chunking_options_;
+
+    bool adaptive_encoding_enabled_;
+    int64_t adaptive_encoding_sample_size_;
   };
 
   inline MemoryPool* memory_pool() const { return pool_; }
@@ -917,6 +1032,10 @@ class PARQUET_EXPORT WriterProperties {
 
   inline int64_t max_row_group_length() const { return max_row_group_length_; }
 
+  inline int64_t max_buffered_row_group_bytes() const {
+    return max_buffered_row_group_bytes_;
+  }
+
   inline int64_t data_pagesize() const { return pagesize_; }
 
   inline int64_t max_rows_per_page() const { return max_rows_per_page_; }
@@ -944,6 +1063,11 @@ class PARQUET_EXPORT WriterProperties {
     return size_statistics_level_;
   }
 
+  inline bool adaptive_encoding_enabled() const { return adaptive_encoding_enabled_; }
+  inline int64_t adaptive_encoding_sample_size() const {
+    return adaptive_encoding_sample_size_;
+  }
+
   inline Encoding::type dictionary_index_encoding() const {
     if (parquet_version_ == ParquetVersion::PARQUET_1_0) {
       return Encoding::PLAIN_DICTIONARY;
@@ -1046,19 +1170,22 @@ class PARQUET_EXPORT WriterProperties {
  private:
   explicit WriterProperties(
       MemoryPool* pool, int64_t dictionary_pagesize_limit, int64_t write_batch_size,
-      int64_t max_row_group_length, int64_t pagesize, int64_t max_rows_per_page,
-      ParquetVersion::type version, const std::string& created_by,
+      int64_t max_row_group_length, int64_t max_buffered_row_group_bytes,
+      int64_t pagesize, int64_t max_rows_per_page, ParquetVersion::type version,
+      const std::string& created_by,
       bool page_write_checksum_enabled, SizeStatisticsLevel size_statistics_level,
       std::shared_ptr<FileEncryptionProperties> file_encryption_properties,
       const ColumnProperties& default_column_properties,
       const std::unordered_map<std::string, ColumnProperties>& column_properties,
       ParquetDataPageVersion data_page_version, bool store_short_decimal_as_integer,
       std::vector<SortingColumn> sorting_columns, bool content_defined_chunking_enabled,
-      CdcOptions content_defined_chunking_options)
+      CdcOptions content_defined_chunking_options, bool adaptive_encoding_enabled,
+      int64_t adaptive_encoding_sample_size)
       : pool_(pool),
         dictionary_pagesize_limit_(dictionary_pagesize_limit),
         write_batch_size_(write_batch_size),
         max_row_group_length_(max_row_group_length),
+        max_buffered_row_group_bytes_(max_buffered_row_group_bytes),
         pagesize_(pagesize),
         max_rows_per_page_(max_rows_per_page),
         parquet_data_page_version_(data_page_version),
@@ -1072,12 +1199,15 @@ class PARQUET_EXPORT WriterProperties {
         default_column_properties_(default_column_properties),
         column_properties_(column_properties),
         content_defined_chunking_enabled_(content_defined_chunking_enabled),
-        content_defined_chunking_options_(content_defined_chunking_options) {}
+        content_defined_chunking_options_(content_defined_chunking_options),
+        adaptive_encoding_enabled_(adaptive_encoding_enabled),
+        adaptive_encoding_sample_size_(adaptive_encoding_sample_size) {}
 
   MemoryPool* pool_;
   int64_t dictionary_pagesize_limit_;
   int64_t write_batch_size_;
   int64_t max_row_group_length_;
+  int64_t max_buffered_row_group_bytes_;
   int64_t pagesize_;
   int64_t max_rows_per_page_;
   ParquetDataPageVersion parquet_data_page_version_;
@@ -1096,6 +1226,9 @@ class PARQUET_EXPORT WriterProperties {
 
   bool content_defined_chunking_enabled_;
   CdcOptions content_defined_chunking_options_;
+
+  bool adaptive_encoding_enabled_;
+  int64_t adaptive_encoding_sample_size_;
 };
 
 PARQUET_EXPORT const std::shared_ptr<WriterProperties>& default_writer_properties();
@@ -1108,6 +1241,13 @@ static constexpr bool kArrowDefaultUseThreads = false;
 // Default number of rows to read when using ::arrow::RecordBatchReader
 static constexpr int64_t kArrowDefaultBatchSize = 64 * 1024;
 
+// Default number of row groups fetched ahead by the asynchronous read methods
+static constexpr int32_t kArrowDefaultRowGroupReadahead = 1;
+
+// Default number of columns of a row group fetched and decoded concurrently by the
+// asynchronous read methods (0 means all of them)
+static constexpr int32_t kArrowDefaultColumnReadahead = 0;
+
 constexpr inline ::arrow::Type::type kArrowDefaultBinaryType = ::arrow::Type::BINARY;
 constexpr inline ::arrow::Type::type kArrowDefaultListType = ::arrow::Type::LIST;
 
@@ -1120,6 +1260,8 @@ class PARQUET_EXPORT ArrowReaderProperties {
         batch_size_(kArrowDefaultBatchSize),
         pre_buffer_(true),
         cache_options_(::arrow::io::CacheOptions::LazyDefaults()),
+        row_group_readahead_(kArrowDefaultRowGroupReadahead),
+        column_readahead_(kArrowDefaultColumnReadahead),
         coerce_int96_timestamp_unit_(::arrow::TimeUnit::NANO),
         binary_type_(kArrowDefaultBinaryType),
         list_type_(kArrowDefaultListType),
@@ -1214,6 +1356,26 @@ class PARQUET_EXPORT ArrowReaderProperties {
   /// Return the execution context used for read coalescing.
   const ::arrow::io::IOContext& io_context() const { return io_context_; }
 
+  /// \brief Set the number of row groups, besides the one being decoded, whose
+  /// column chunks are fetched in advance by FileReader::ReadRowGroupsAsync and
+  /// FileReader::ReadColumnAsync (default 1).
+  ///
+  /// Higher values hide more I/O latency at the expense of memory.
+  void set_row_group_readahead(int32_t num_row_groups) {
+    row_group_readahead_ = num_row_groups;
+  }
+  /// Return the number of row groups fetched ahead by the asynchronous read methods.
+  int32_t row_group_readahead() const { return row_group_readahead_; }
+
+  /// \brief Set the maximum number of columns of a row group that are fetched and
+  /// decoded concurrently by FileReader::ReadRowGroupsAsync (default 0, meaning
+  /// all selected columns).
+  ///
+  /// Lower values bound the memory used to read very wide row groups.
+  void set_column_readahead(int32_t num_columns) { column_readahead_ = num_columns; }
+  /// Return the number of columns fetched ahead by the asynchronous read methods.
+  int32_t column_readahead() const { return column_readahead_; }
+
   /// Set timestamp unit to use for deprecated INT96-encoded timestamps
   /// (default is NANO).
   void set_coerce_int96_timestamp_unit(::arrow::TimeUnit::type unit) {
@@ -1270,6 +1432,8 @@ class PARQUET_EXPORT ArrowReaderProperties {
   bool pre_buffer_;
   ::arrow::io::IOContext io_context_;
   ::arrow::io::CacheOptions cache_options_;
+  int32_t row_group_readahead_;
+  int32_t column_readahead_;
   ::arrow::TimeUnit::type coerce_int96_timestamp_unit_;
   ::arrow::Type::type binary_type_;
   ::arrow::Type::type list_type_;
@@ -1375,6 +1539,12 @@ class PARQUET_EXPORT ArrowWriterProperties {
     /// \brief Set whether to use multiple threads to write columns
     /// in parallel in the buffered row group mode.
     ///
+    /// This applies to FileWriter::WriteRecordBatch() and
+    /// FileWriter::WriteTable(), which then writes each row group in the
+    /// buffered mode: column chunks are encoded and compressed in parallel
+    /// into memory, and serialized in schema order once the row group is
+    /// complete.
+    ///
     /// WARNING: If writing multiple files in parallel in the same
     /// executor, deadlock may occur if use_threads is true. Please
     /// disable it in this case.
@@ -592,6 +592,75 @@ class ThriftDeserializer {
     }
   }
 
+  // Deserialize an unencrypted thrift struct from buf/len like DeserializeMessage(),
+  // but skip over the elements of its list field `list_field_id` instead of decoding
+  // them. That list is left empty in `deserialized_msg`, and the byte range of each of
+  // its elements relative to buf is appended to `element_ranges`, so they can be
+  // deserialized individually later on.
+  template <class T>
+  void DeserializeMessageSkippingList(
+      const uint8_t* buf, uint32_t* len, int16_t list_field_id, T* deserialized_msg,
+      std::vector<std::pair<uint32_t, uint32_t>>* element_ranges) {
+    using apache::thrift::protocol::TType;
+    auto tmem_transport = CreateReadOnlyMemoryBuffer(const_cast<uint8_t*>(buf), *len);
+    auto tproto = apache::thrift::protocol::TCompactProtocolT<ThriftBuffer>(
+        tmem_transport, string_size_limit_, container_size_limit_);
+    auto position = [&]() { return *len - tmem_transport->available_read(); };
+    // Byte range of the list within buf, header included
+    uint32_t list_begin = 0;
+    uint32_t list_end = 0;
+    try {
+      std::string name;
+      TType field_type;
+      int16_t field_id;
+      tproto.readStructBegin(name);
+      while (true) {
+        tproto.readFieldBegin(name, field_type, field_id);
+        if (field_type == apache::thrift::protocol::T_STOP) {
+          break;
+        }
+        if (field_id == list_field_id && field_type == apache::thrift::protocol::T_LIST &&
+            list_end == 0) {
+          list_begin = position();
+          TType element_type;
+          uint32_t size;
+          tproto.readListBegin(element_type, size);
+          if (element_type != apache::thrift::protocol::T_STRUCT) {
+            throw ParquetException("Expected a list of structs");
+          }
+          for (uint32_t i = 0; i < size; ++i) {
+            const uint32_t element_begin = position();
+            apache::thrift::protocol::skip(tproto, element_type);
+            element_ranges->emplace_back(element_begin, position() - element_begin);
+          }
+          tproto.readListEnd();
+          list_end = position();
+        } else {
+          apache::thrift::protocol::skip(tproto, field_type);
+        }
+        tproto.readFieldEnd();
+      }
+      tproto.readStructEnd();
+    } catch (std::exception& e) {
+      std::stringstream ss;
+      ss << "Couldn't deserialize thrift: " << e.what() << "\n";
+      throw ParquetException(ss.str());
+    }
+    *len = position();
+
+    // Decode the other fields from a copy of the message where the list is replaced
+    // by an empty list of structs, whose compact protocol header is a single byte.
+    constexpr uint8_t kEmptyStructListHeader = 0x0C;
+    std::string message(reinterpret_cast<const char*>(buf), *len);
+    if (list_end != 0) {
+      message.replace(list_begin, list_end - list_begin, 1,
+                      static_cast<char>(kEmptyStructListHeader));
+    }
+    uint32_t message_len = static_cast<uint32_t>(message.size());
+    DeserializeUnencryptedMessage(reinterpret_cast<const uint8_t*>(message.data()),
+                                  &message_len, deserialized_msg);
+  }
+
  private:
   // On Thrift 0.14.0+, we want to use TConfiguration to raise the max message size
   // limit (ARROW-13655).  If we wanted to protect against huge messages, we could
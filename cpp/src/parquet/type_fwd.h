@@ -64,6 +64,7 @@ struct ParquetVersion {
 
 class FileMetaData;
 class FileCryptoMetaData;
+class FileMetaDataCache;
 class RowGroupMetaData;
 
 class ColumnDescriptor;